@@ -0,0 +1,190 @@
+#include <benchmark/benchmark.h>
+#include "matx.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace matx;
+
+/* Host executor benchmarks
+ *
+ * nvbench only times work on a CUDA stream, so the host executor is benchmarked with Google Benchmark.
+ * Every benchmark takes the thread count as its first argument and the problem size as its second. Each
+ * reports the bytes it touches as GB/s, and the speedup over its own one-thread run divided by the
+ * thread count as Efficiency.
+ */
+
+namespace {
+
+std::vector<int64_t> ThreadCounts()
+{
+  std::vector<int64_t> counts;
+  const int64_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+  for (int64_t t = 1; t < max_threads; t *= 2) {
+    counts.push_back(t);
+  }
+  counts.push_back(max_threads);
+  return counts;
+}
+
+// Seconds per iteration of the one-thread run of each benchmark and size. Thread counts are registered
+// in increasing order, so the one-thread run always comes first.
+std::map<std::string, double> &SingleThreadSeconds()
+{
+  static std::map<std::string, double> seconds;
+  return seconds;
+}
+
+template <typename Fn>
+void RunHostBench(benchmark::State &state, const std::string &name, double bytes, Fn &&fn)
+{
+  const int threads = static_cast<int>(state.range(0));
+  SelectThreadsHostExecutor exec{HostExecParams{threads, true}};
+
+  // Untimed run to create plans and start the pool
+  fn(exec);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    fn(exec);
+  }
+  const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  const double per_iter = elapsed / static_cast<double>(state.iterations());
+
+  const std::string key = name + "/" + std::to_string(state.range(1));
+  if (threads == 1) {
+    SingleThreadSeconds()[key] = per_iter;
+  }
+
+  state.counters["Threads"] = threads;
+  state.counters["GB/s"] = benchmark::Counter(bytes * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+  auto single = SingleThreadSeconds().find(key);
+  if (single != SingleThreadSeconds().end()) {
+    state.counters["Efficiency"] = single->second / (per_iter * threads);
+  }
+}
+
+} // namespace
+
+/* Element-wise */
+void host_elementwise(benchmark::State &state)
+{
+  const index_t n = static_cast<index_t>(state.range(1));
+  auto a = make_tensor<float>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto b = make_tensor<float>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto c = make_tensor<float>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto y = make_tensor<float>({n}, MATX_HOST_MALLOC_MEMORY);
+  SingleThreadedHostExecutor init{};
+  (a = ones<float>({n})).run(init);
+  (b = ones<float>({n}) * 2.0f).run(init);
+  (c = ones<float>({n}) * 3.0f).run(init);
+
+  RunHostBench(state, "elementwise", 4.0 * static_cast<double>(n * sizeof(float)),
+    [&](auto &exec) { (y = a * b + sin(c)).run(exec); });
+}
+BENCHMARK(host_elementwise)->ArgsProduct({ThreadCounts(), {1 << 20, 1 << 24}})->UseRealTime();
+
+/* Reductions */
+void host_sum_full(benchmark::State &state)
+{
+  const index_t n = static_cast<index_t>(state.range(1));
+  auto a = make_tensor<float>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto s = make_tensor<float>({}, MATX_HOST_MALLOC_MEMORY);
+  (a = ones<float>({n})).run(SingleThreadedHostExecutor{});
+
+  RunHostBench(state, "sum_full", static_cast<double>(n * sizeof(float)),
+    [&](auto &exec) { (s = sum(a)).run(exec); });
+}
+BENCHMARK(host_sum_full)->ArgsProduct({ThreadCounts(), {1 << 20, 1 << 24}})->UseRealTime();
+
+void host_sum_rows(benchmark::State &state)
+{
+  constexpr index_t cols = 1024;
+  const index_t rows = static_cast<index_t>(state.range(1)) / cols;
+  auto a = make_tensor<float>({rows, cols}, MATX_HOST_MALLOC_MEMORY);
+  auto s = make_tensor<float>({rows}, MATX_HOST_MALLOC_MEMORY);
+  (a = ones<float>({rows, cols})).run(SingleThreadedHostExecutor{});
+
+  RunHostBench(state, "sum_rows", static_cast<double>(rows * cols * sizeof(float)),
+    [&](auto &exec) { (s = sum(a, {1})).run(exec); });
+}
+BENCHMARK(host_sum_rows)->ArgsProduct({ThreadCounts(), {1 << 20, 1 << 24}})->UseRealTime();
+
+void host_argmax(benchmark::State &state)
+{
+  const index_t n = static_cast<index_t>(state.range(1));
+  auto a = make_tensor<float>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto mv = make_tensor<float>({}, MATX_HOST_MALLOC_MEMORY);
+  auto mi = make_tensor<index_t>({}, MATX_HOST_MALLOC_MEMORY);
+  (a = random<float>({n}, UNIFORM)).run(SingleThreadedHostExecutor{});
+
+  RunHostBench(state, "argmax", static_cast<double>(n * sizeof(float)),
+    [&](auto &exec) { (mtie(mv, mi) = argmax(a)).run(exec); });
+}
+BENCHMARK(host_argmax)->ArgsProduct({ThreadCounts(), {1 << 20, 1 << 24}})->UseRealTime();
+
+/* FFT */
+#if MATX_EN_CPU_FFT
+void host_fft_batched(benchmark::State &state)
+{
+  constexpr index_t len = 4096;
+  const index_t batches = static_cast<index_t>(state.range(1)) / len;
+  auto x = make_tensor<cuda::std::complex<float>>({batches, len}, MATX_HOST_MALLOC_MEMORY);
+  auto y = make_tensor<cuda::std::complex<float>>({batches, len}, MATX_HOST_MALLOC_MEMORY);
+  (x = random<cuda::std::complex<float>>({batches, len}, NORMAL)).run(SingleThreadedHostExecutor{});
+
+  RunHostBench(state, "fft_batched", 2.0 * static_cast<double>(batches * len * sizeof(cuda::std::complex<float>)),
+    [&](auto &exec) { (y = fft(x)).run(exec); });
+}
+BENCHMARK(host_fft_batched)->ArgsProduct({ThreadCounts(), {1 << 20, 1 << 22}})->UseRealTime();
+#endif
+
+/* BLAS */
+#if MATX_EN_CPU_MATMUL
+void host_matmul(benchmark::State &state)
+{
+  const index_t n = static_cast<index_t>(state.range(1));
+  auto a = make_tensor<float>({n, n}, MATX_HOST_MALLOC_MEMORY);
+  auto b = make_tensor<float>({n, n}, MATX_HOST_MALLOC_MEMORY);
+  auto c = make_tensor<float>({n, n}, MATX_HOST_MALLOC_MEMORY);
+  (a = random<float>({n, n}, UNIFORM)).run(SingleThreadedHostExecutor{});
+  (b = random<float>({n, n}, UNIFORM)).run(SingleThreadedHostExecutor{});
+
+  RunHostBench(state, "matmul", 3.0 * static_cast<double>(n * n * sizeof(float)),
+    [&](auto &exec) { (c = matmul(a, b)).run(exec); });
+  state.counters["GFLOP/s"] = benchmark::Counter(2.0 * static_cast<double>(n * n * n) * 1e-9,
+                                                 benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(host_matmul)->ArgsProduct({ThreadCounts(), {512, 2048}})->UseRealTime();
+#endif
+
+/* LAPACK */
+#if MATX_EN_CPU_SOLVER
+void host_chol_batched(benchmark::State &state)
+{
+  constexpr index_t batches = 256;
+  const index_t n = static_cast<index_t>(state.range(1));
+  auto a = make_tensor<float>({batches, n, n}, MATX_HOST_MALLOC_MEMORY);
+  auto l = make_tensor<float>({batches, n, n}, MATX_HOST_MALLOC_MEMORY);
+
+  // Symmetric and diagonally dominant, so every matrix is positive definite
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        a(b, i, j) = i == j ? static_cast<float>(n) : 0.5f / static_cast<float>(1 + std::abs(i - j));
+      }
+    }
+  }
+
+  RunHostBench(state, "chol_batched", 2.0 * static_cast<double>(batches * n * n * sizeof(float)),
+    [&](auto &exec) { (l = chol(a, SolverFillMode::LOWER)).run(exec); });
+}
+BENCHMARK(host_chol_batched)->ArgsProduct({ThreadCounts(), {64, 256}})->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
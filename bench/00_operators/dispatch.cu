@@ -0,0 +1,272 @@
+#include <benchmark/benchmark.h>
+#include "matx.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+
+using namespace matx;
+
+/* Host-side dispatch cost
+ *
+ * These benchmarks time how long the host takes to build and launch an expression on tensors so small
+ * that the device work is negligible. They measure wall time on the host and do not wait for the GPU,
+ * except for a sync every DISPATCH_SYNC_EVERY launches (outside the timed region) so the launch queue
+ * never fills up and blocks. Results are per run() call.
+ */
+
+static constexpr int64_t DISPATCH_SYNC_EVERY = 256;
+static constexpr index_t DISPATCH_SIZE = 16;
+
+template <typename Exec, typename Fn>
+static void RunDispatchBench(benchmark::State &state, Exec &exec, Fn &&fn)
+{
+  // Untimed run to create plans, compile kernels, and fill caches
+  fn();
+  exec.sync();
+
+  int64_t launches = 0;
+  for (auto _ : state) {
+    fn();
+    if (++launches % DISPATCH_SYNC_EVERY == 0) {
+      state.PauseTiming();
+      exec.sync();
+      state.ResumeTiming();
+    }
+  }
+  exec.sync();
+  state.SetItemsProcessed(state.iterations());
+}
+
+/* Operator construction only, without launching */
+static void dispatch_construct_expression(benchmark::State &state)
+{
+  auto a = make_tensor<float>({DISPATCH_SIZE});
+  auto b = make_tensor<float>({DISPATCH_SIZE});
+  auto c = make_tensor<float>({DISPATCH_SIZE});
+  for (auto _ : state) {
+    auto op = (c = sin(a) * b + 2.0f * a);
+    benchmark::DoNotOptimize(op);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(dispatch_construct_expression);
+
+/* Element-wise expressions on the CUDA executor */
+static void dispatch_cuda_add(benchmark::State &state)
+{
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+  auto a = make_tensor<float>({DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<float>({DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<float>({DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+
+  RunDispatchBench(state, exec, [&]() { (c = a + b).run(exec); });
+  cudaStreamDestroy(stream);
+}
+BENCHMARK(dispatch_cuda_add);
+
+static void dispatch_cuda_expression(benchmark::State &state)
+{
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+  auto a = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+
+  RunDispatchBench(state, exec, [&]() { (c = sin(a) * transpose(b) + 2.0f * a).run(exec); });
+  cudaStreamDestroy(stream);
+}
+BENCHMARK(dispatch_cuda_expression);
+
+/* Same expression with every NVTX level enabled. Only differs from the above when built with NVTX ranges. */
+static void dispatch_cuda_expression_nvtx(benchmark::State &state)
+{
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+  auto a = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+
+  MATX_NVTX_SET_LOG_LEVEL(matx_nvxtLogLevels::MATX_NVTX_LOG_ALL);
+  RunDispatchBench(state, exec, [&]() { (c = sin(a) * transpose(b) + 2.0f * a).run(exec); });
+  MATX_NVTX_SET_LOG_LEVEL(matx_nvxtLogLevels::MATX_NVTX_LOG_API);
+  cudaStreamDestroy(stream);
+}
+BENCHMARK(dispatch_cuda_expression_nvtx);
+
+/* Transforms whose plans come from the cache, so each run() includes a cache lookup */
+static void dispatch_cuda_fft_cached(benchmark::State &state)
+{
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+  auto a = make_tensor<cuda::std::complex<float>>({DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<cuda::std::complex<float>>({DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+
+  RunDispatchBench(state, exec, [&]() { (b = fft(a)).run(exec); });
+  cudaStreamDestroy(stream);
+}
+BENCHMARK(dispatch_cuda_fft_cached);
+
+static void dispatch_cuda_matmul_cached(benchmark::State &state)
+{
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+  auto a = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+
+  RunDispatchBench(state, exec, [&]() { (c = matmul(a, b)).run(exec); });
+  cudaStreamDestroy(stream);
+}
+BENCHMARK(dispatch_cuda_matmul_cached);
+
+static void dispatch_cuda_sum(benchmark::State &state)
+{
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+  auto a = make_tensor<float>({DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto s = make_tensor<float>({}, MATX_DEVICE_MEMORY);
+
+  RunDispatchBench(state, exec, [&]() { (s = sum(a)).run(exec); });
+  cudaStreamDestroy(stream);
+}
+BENCHMARK(dispatch_cuda_sum);
+
+/* Replaying a captured graph of the same expression, for comparison with eager dispatch */
+static void dispatch_cuda_graph_launch(benchmark::State &state)
+{
+  cudaStream_t stream;
+  cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking);
+  cudaExecutor exec{stream};
+  auto a = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+
+  cudaGraph graph;
+  exec.capture(graph, [&]() { (c = sin(a) * transpose(b) + 2.0f * a).run(exec); });
+  RunDispatchBench(state, exec, [&]() { exec.launch(graph); });
+  graph.reset();
+  cudaStreamDestroy(stream);
+}
+BENCHMARK(dispatch_cuda_graph_launch);
+
+#ifdef MATX_EN_JIT
+/* JIT executor. The first run compiles the kernel; later runs hit the in-memory kernel cache. */
+static void dispatch_jit_expression(benchmark::State &state)
+{
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  CUDAJITExecutor exec{stream};
+  auto a = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+
+  RunDispatchBench(state, exec, [&]() { (c = sin(a) * transpose(b) + 2.0f * a).run(exec); });
+  cudaStreamDestroy(stream);
+}
+BENCHMARK(dispatch_jit_expression);
+
+/* JIT compile and cache costs for representative fused expressions. Every iteration drops the kernels
+ * held in memory with ClearJITMemoryCaches and times the first launch after it. Cold runs point
+ * MATX_CACHE_DIR at a new empty directory so NVRTC has to compile, while disk runs reuse a warmed
+ * directory so the kernel is loaded from its cached cubin. */
+enum class JITCacheState { COLD, DISK };
+
+template <typename Fn>
+static void RunJITCompileBench(benchmark::State &state, JITCacheState cache_state, Fn &&fn)
+{
+  const auto root = std::filesystem::temp_directory_path() / ("matx_jit_bench_" + std::to_string(getpid()));
+  const char *prev = std::getenv("MATX_CACHE_DIR");
+  const std::string prev_dir = prev != nullptr ? prev : "";
+
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  CUDAJITExecutor exec{stream};
+
+  if (cache_state == JITCacheState::DISK) {
+    std::filesystem::create_directories(root / "warm");
+    setenv("MATX_CACHE_DIR", (root / "warm").c_str(), 1);
+    fn(exec);
+    exec.sync();
+  }
+
+  int64_t iter = 0;
+  for (auto _ : state) {
+    if (cache_state == JITCacheState::COLD) {
+      const auto dir = root / ("cold_" + std::to_string(iter++));
+      std::filesystem::create_directories(dir);
+      setenv("MATX_CACHE_DIR", dir.c_str(), 1);
+    }
+    ClearJITMemoryCaches();
+
+    const auto start = std::chrono::steady_clock::now();
+    fn(exec);
+    exec.sync();
+    state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  }
+
+  if (prev != nullptr) {
+    setenv("MATX_CACHE_DIR", prev_dir.c_str(), 1);
+  }
+  else {
+    unsetenv("MATX_CACHE_DIR");
+  }
+  std::filesystem::remove_all(root);
+  cudaStreamDestroy(stream);
+}
+
+static void jit_compile_elementwise(benchmark::State &state)
+{
+  auto a = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  RunJITCompileBench(state, static_cast<JITCacheState>(state.range(0)),
+    [&](auto &exec) { (c = sin(a) * transpose(b) + 2.0f * a).run(exec); });
+}
+BENCHMARK(jit_compile_elementwise)->Arg(0)->Arg(1)->ArgName("disk")->UseManualTime()->Iterations(5)
+  ->Unit(benchmark::kMillisecond);
+
+static void jit_compile_complex_broadcast(benchmark::State &state)
+{
+  auto x = make_tensor<cuda::std::complex<float>>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto w = make_tensor<cuda::std::complex<float>>({DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  auto y = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_DEVICE_MEMORY);
+  RunJITCompileBench(state, static_cast<JITCacheState>(state.range(0)),
+    [&](auto &exec) { (y = abs2(x * conj(clone<2>(w, {DISPATCH_SIZE, matxKeepDim})))).run(exec); });
+}
+BENCHMARK(jit_compile_complex_broadcast)->Arg(0)->Arg(1)->ArgName("disk")->UseManualTime()->Iterations(5)
+  ->Unit(benchmark::kMillisecond);
+#endif
+
+/* Host executor on a single thread, which is all a tensor this small should use */
+static void dispatch_host_expression(benchmark::State &state)
+{
+  SingleThreadedHostExecutor exec{};
+  auto a = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_HOST_MALLOC_MEMORY);
+  auto b = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_HOST_MALLOC_MEMORY);
+  auto c = make_tensor<float>({DISPATCH_SIZE, DISPATCH_SIZE}, MATX_HOST_MALLOC_MEMORY);
+
+  RunDispatchBench(state, exec, [&]() { (c = sin(a) * transpose(b) + 2.0f * a).run(exec); });
+}
+BENCHMARK(dispatch_host_expression);
+
+static void dispatch_host_sum(benchmark::State &state)
+{
+  SingleThreadedHostExecutor exec{};
+  auto a = make_tensor<float>({DISPATCH_SIZE}, MATX_HOST_MALLOC_MEMORY);
+  auto s = make_tensor<float>({}, MATX_HOST_MALLOC_MEMORY);
+
+  RunDispatchBench(state, exec, [&]() { (s = sum(a)).run(exec); });
+}
+BENCHMARK(dispatch_host_sum);
+
+BENCHMARK_MAIN();
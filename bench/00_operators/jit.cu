@@ -0,0 +1,88 @@
+#include "matx.h"
+#include <nvbench/nvbench.cuh>
+
+using namespace matx;
+
+/* Kernel runtime of the same fused expression launched by the ahead-of-time CUDA executor and by the
+ * JIT executor. The elements per thread picked for a launch depends on the value type, so the type
+ * axis covers the EPT values both executors choose between. Compile and cache-hit costs of the JIT
+ * executor are host-side and measured in matx_dispatch_bench.
+ */
+using jit_types = nvbench::type_list<float, double, matxFp16, cuda::std::complex<float>>;
+
+template <typename ValueType>
+void jit_vs_aot_elementwise(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+#ifdef MATX_EN_JIT
+  const index_t n = static_cast<index_t>(state.get_int64("Tensor Size"));
+  const bool use_jit = state.get_string("Executor") == "jit";
+
+  auto a = make_tensor<ValueType>({n}, MATX_DEVICE_MEMORY);
+  auto b = make_tensor<ValueType>({n}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<ValueType>({n}, MATX_DEVICE_MEMORY);
+  (a = ones<ValueType>({n})).run();
+  (b = ones<ValueType>({n})).run();
+
+  state.add_element_count(n, "NumElements");
+  state.add_global_memory_reads<ValueType>(2 * n);
+  state.add_global_memory_writes<ValueType>(n);
+
+  // Compile outside the measurement
+  if (use_jit) {
+    (c = sin(a) * b + a * b).run(CUDAJITExecutor{});
+  }
+  cudaDeviceSynchronize();
+
+  state.exec([&](nvbench::launch &launch) {
+    if (use_jit) {
+      (c = sin(a) * b + a * b).run(CUDAJITExecutor{launch.get_stream()});
+    }
+    else {
+      (c = sin(a) * b + a * b).run(cudaExecutor{launch.get_stream()});
+    }
+  });
+#else
+  state.skip("JIT support is not enabled. Build with MATX_EN_JIT.");
+#endif
+}
+NVBENCH_BENCH_TYPES(jit_vs_aot_elementwise, NVBENCH_TYPE_AXES(jit_types))
+  .add_int64_power_of_two_axis("Tensor Size", nvbench::range(20, 24, 4))
+  .add_string_axis("Executor", {"cuda", "jit"});
+
+template <typename ValueType>
+void jit_vs_aot_broadcast(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+#ifdef MATX_EN_JIT
+  const index_t n = static_cast<index_t>(state.get_int64("Tensor Size"));
+  const bool use_jit = state.get_string("Executor") == "jit";
+
+  auto a = make_tensor<ValueType>({n, n}, MATX_DEVICE_MEMORY);
+  auto v = make_tensor<ValueType>({n}, MATX_DEVICE_MEMORY);
+  auto c = make_tensor<ValueType>({n, n}, MATX_DEVICE_MEMORY);
+  (a = ones<ValueType>({n, n})).run();
+  (v = ones<ValueType>({n})).run();
+
+  state.add_element_count(n * n, "NumElements");
+  state.add_global_memory_reads<ValueType>(n * n + n);
+  state.add_global_memory_writes<ValueType>(n * n);
+
+  if (use_jit) {
+    (c = transpose(a) * clone<2>(v, {n, matxKeepDim}) + a).run(CUDAJITExecutor{});
+  }
+  cudaDeviceSynchronize();
+
+  state.exec([&](nvbench::launch &launch) {
+    if (use_jit) {
+      (c = transpose(a) * clone<2>(v, {n, matxKeepDim}) + a).run(CUDAJITExecutor{launch.get_stream()});
+    }
+    else {
+      (c = transpose(a) * clone<2>(v, {n, matxKeepDim}) + a).run(cudaExecutor{launch.get_stream()});
+    }
+  });
+#else
+  state.skip("JIT support is not enabled. Build with MATX_EN_JIT.");
+#endif
+}
+NVBENCH_BENCH_TYPES(jit_vs_aot_broadcast, NVBENCH_TYPE_AXES(jit_types))
+  .add_int64_power_of_two_axis("Tensor Size", nvbench::range(10, 12, 2))
+  .add_string_axis("Executor", {"cuda", "jit"});
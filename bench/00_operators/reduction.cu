@@ -152,3 +152,82 @@ NVBENCH_BENCH_TYPES(reduce_4d, NVBENCH_TYPE_AXES(reduce_types))
   .add_int64_power_of_two_axis("Size1", nvbench::range(5, 5, 1))
   .add_int64_power_of_two_axis("Size2", nvbench::range(5, 5, 1))
   .add_int64_power_of_two_axis("Size3", nvbench::range(5, 5, 1));
+
+// Sum of a 2D tensor over one axis. Axis 0 reduces across rows, reading the kept columns coalesced,
+// and axis 1 reduces each contiguous row.
+template <typename ValueType>
+void reduce_axis(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  cudaExecutor exec{0};
+  const index_t rows = static_cast<index_t>(state.get_int64("Rows"));
+  const index_t cols = static_cast<index_t>(state.get_int64("Cols"));
+  const int axis = static_cast<int>(state.get_int64("Axis"));
+
+  if (rows * cols > (index_t{1} << 26)) {
+    state.skip("Input too large");
+    return;
+  }
+
+  auto t2 = make_tensor<ValueType>({rows, cols});
+  auto out = make_tensor<ValueType>({axis == 0 ? cols : rows});
+  (t2 = random<ValueType>(t2.Shape(), UNIFORM)).run(exec);
+  exec.sync();
+
+  state.add_global_memory_reads<ValueType>(rows * cols, "DataSize");
+  state.add_global_memory_writes<ValueType>(out.Size(0));
+
+  state.exec([&](nvbench::launch &launch) {
+    if (axis == 0) {
+      (out = matx::sum(t2, {0})).run(cudaExecutor{launch.get_stream()});
+    }
+    else {
+      (out = matx::sum(t2, {1})).run(cudaExecutor{launch.get_stream()});
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(reduce_axis, NVBENCH_TYPE_AXES(reduce_types))
+  .add_int64_power_of_two_axis("Rows", nvbench::range(4, 22, 6))
+  .add_int64_power_of_two_axis("Cols", nvbench::range(4, 22, 6))
+  .add_int64_axis("Axis", {0, 1});
+
+// Many short rows of a 2D tensor, where each row is too short to fill a block. The row length picks a
+// thread, a warp or a block per row.
+template <typename ValueType>
+void reduce_rows(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  cudaExecutor exec{0};
+  const index_t len = static_cast<index_t>(state.get_int64("Row Length"));
+  const index_t rows = (index_t{1} << 24) / len;
+  const std::string op = state.get_string("Op");
+
+  auto t2 = make_tensor<ValueType>({rows, len});
+  auto out = make_tensor<ValueType>({rows});
+  auto idx = make_tensor<index_t>({rows});
+  (t2 = random<ValueType>(t2.Shape(), UNIFORM)).run(exec);
+  exec.sync();
+
+  state.add_element_count(rows * len, "NumElements");
+  state.add_global_memory_reads<ValueType>(rows * len);
+  state.add_global_memory_writes<ValueType>(rows);
+
+  state.exec([&](nvbench::launch &launch) {
+    cudaExecutor e{launch.get_stream()};
+    if (op == "sum") {
+      (out = matx::sum(t2)).run(e);
+    }
+    else if (op == "max") {
+      (out = matx::max(t2)).run(e);
+    }
+    else if (op == "argmax") {
+      (mtie(out, idx) = matx::argmax(t2)).run(e);
+    }
+    else {
+      (out = matx::var(t2)).run(e);
+    }
+  });
+}
+
+NVBENCH_BENCH_TYPES(reduce_rows, NVBENCH_TYPE_AXES(reduce_types))
+  .add_int64_power_of_two_axis("Row Length", nvbench::range(2, 14, 2))
+  .add_string_axis("Op", {"sum", "max", "argmax", "var"});
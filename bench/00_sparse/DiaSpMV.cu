@@ -0,0 +1,53 @@
+#include "matx.h"
+#include <nvbench/nvbench.cuh>
+
+using namespace matx;
+
+using spmv_types = nvbench::type_list<float, double, cuda::std::complex<float>>;
+
+// Banded DIA-I SpMV with a symmetric band of the given number of diagonals,
+// optionally over a uniform batch of such matrices in a single launch.
+template <typename ValueType>
+void banded_DiaSpMV_bench(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  cudaExecutor exec{0};
+
+  const index_t N = static_cast<index_t>(state.get_int64("N"));
+  const index_t D = static_cast<index_t>(state.get_int64("Diags"));
+  const index_t Batch = static_cast<index_t>(state.get_int64("Batch"));
+
+  auto vals = make_tensor<ValueType, 1>({Batch * D * N}, MATX_DEVICE_MEMORY);
+  auto offsets = make_tensor<index_t, 1>({D});
+  auto B = make_tensor<ValueType, 1>({Batch * N}, MATX_DEVICE_MEMORY);
+  auto C = make_tensor<ValueType, 1>({Batch * N}, MATX_DEVICE_MEMORY);
+
+  for (index_t d = 0; d < D; d++) {
+    offsets(d) = d - D / 2;
+  }
+  (vals = ones()).run(exec);
+  (B = ones()).run(exec);
+  (C = zeros()).run(exec);
+  exec.sync();
+
+  state.add_global_memory_reads<ValueType>(Batch * (D + 1) * N);
+  state.add_global_memory_writes<ValueType>(Batch * N);
+
+  if (Batch == 1) {
+    auto A = experimental::make_tensor_dia<experimental::DIA_INDEX_I>(
+        vals, offsets, {N, N});
+    state.exec([&A, &B, &C](nvbench::launch &launch) {
+      (C = matvec(A, B)).run(cudaExecutor(launch.get_stream()));
+    });
+  } else {
+    auto A = experimental::make_tensor_uniform_batched_dia<
+        experimental::DIA_INDEX_I>(vals, offsets, {Batch, N, N});
+    state.exec([&A, &B, &C](nvbench::launch &launch) {
+      (C = matvec(A, B)).run(cudaExecutor(launch.get_stream()));
+    });
+  }
+}
+
+NVBENCH_BENCH_TYPES(banded_DiaSpMV_bench, NVBENCH_TYPE_AXES(spmv_types))
+    .add_int64_power_of_two_axis("N", nvbench::range(14, 18, 4))
+    .add_int64_axis("Diags", {5, 9, 27})
+    .add_int64_axis("Batch", {1, 8});
@@ -0,0 +1,296 @@
+#include "matx.h"
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace matx;
+
+using sparse_types = nvbench::type_list<float, double, cuda::std::complex<float>>;
+
+/* Sparse benchmarks over generated matrices with the sparsity structures of common SuiteSparse classes:
+ *
+ *   banded   - 9 diagonals centered on the main diagonal, as from a stencil discretization
+ *   powerlaw - row lengths falling off as 1/rank with rows shuffled, as in web and social graphs
+ *   block    - dense 32x32 blocks, four per block row including the diagonal, as in FEM problems
+ *
+ * Every matrix is strictly diagonally dominant, so it can also be used for direct solves. Throughput is
+ * reported per stored nonzero, so the results are comparable across structures and sizes.
+ */
+
+namespace {
+
+constexpr int SPARSE_BAND_HALF_WIDTH = 4;
+constexpr index_t SPARSE_BLOCK_SIZE = 32;
+constexpr int SPARSE_BLOCKS_PER_ROW = 4;
+
+struct HostCSR {
+  std::vector<int32_t> rowp;
+  std::vector<int32_t> col;
+  std::vector<double> val;
+};
+
+HostCSR GenerateMatrix(const std::string &kind, index_t n)
+{
+  std::mt19937_64 rng(42);
+  std::vector<std::vector<int32_t>> rows(n);
+
+  if (kind == "banded") {
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = std::max<index_t>(0, i - SPARSE_BAND_HALF_WIDTH);
+           j <= std::min<index_t>(n - 1, i + SPARSE_BAND_HALF_WIDTH); j++) {
+        rows[i].push_back(static_cast<int32_t>(j));
+      }
+    }
+  }
+  else if (kind == "powerlaw") {
+    std::vector<index_t> rank(n);
+    for (index_t i = 0; i < n; i++) {
+      rank[i] = i;
+    }
+    std::shuffle(rank.begin(), rank.end(), rng);
+    std::uniform_int_distribution<int32_t> col_dist(0, static_cast<int32_t>(n - 1));
+    for (index_t i = 0; i < n; i++) {
+      const index_t len = std::max<index_t>(2, (n / 4) / (rank[i] + 1));
+      rows[i].push_back(static_cast<int32_t>(i));
+      for (index_t k = 1; k < len; k++) {
+        rows[i].push_back(col_dist(rng));
+      }
+    }
+  }
+  else {
+    const index_t nblocks = n / SPARSE_BLOCK_SIZE;
+    std::uniform_int_distribution<index_t> block_dist(0, nblocks - 1);
+    for (index_t br = 0; br < nblocks; br++) {
+      std::vector<index_t> bcols{br};
+      for (int k = 1; k < SPARSE_BLOCKS_PER_ROW; k++) {
+        bcols.push_back(block_dist(rng));
+      }
+      for (index_t r = br * SPARSE_BLOCK_SIZE; r < (br + 1) * SPARSE_BLOCK_SIZE; r++) {
+        for (auto bc : bcols) {
+          for (index_t c = bc * SPARSE_BLOCK_SIZE; c < (bc + 1) * SPARSE_BLOCK_SIZE; c++) {
+            rows[r].push_back(static_cast<int32_t>(c));
+          }
+        }
+      }
+    }
+  }
+
+  HostCSR csr;
+  csr.rowp.push_back(0);
+  for (index_t i = 0; i < n; i++) {
+    auto &r = rows[i];
+    std::sort(r.begin(), r.end());
+    r.erase(std::unique(r.begin(), r.end()), r.end());
+    for (auto j : r) {
+      csr.col.push_back(j);
+      csr.val.push_back(j == i ? static_cast<double>(r.size()) : -0.5);
+    }
+    csr.rowp.push_back(static_cast<int32_t>(csr.col.size()));
+  }
+  return csr;
+}
+
+template <typename T>
+auto ToDevice(const std::vector<T> &h)
+{
+  auto t = make_tensor<T>({static_cast<index_t>(h.size())}, MATX_DEVICE_MEMORY);
+  cudaMemcpy(t.Data(), h.data(), h.size() * sizeof(T), cudaMemcpyHostToDevice);
+  return t;
+}
+
+template <typename ValueType>
+std::vector<ValueType> CastValues(const HostCSR &h)
+{
+  std::vector<ValueType> v(h.val.size());
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = static_cast<ValueType>(h.val[i]);
+  }
+  return v;
+}
+
+template <typename ValueType>
+auto MakeCSR(const HostCSR &h, index_t n)
+{
+  auto val = ToDevice(CastValues<ValueType>(h));
+  auto rowp = ToDevice(h.rowp);
+  auto col = ToDevice(h.col);
+  return experimental::make_tensor_csr(val, rowp, col, {n, n});
+}
+
+void AddNnzThroughput(nvbench::state &state, const HostCSR &h)
+{
+  state.add_element_count(static_cast<size_t>(h.col.size()), "NNZ");
+}
+
+} // namespace
+
+/* SpMV */
+template <typename ValueType>
+void sparse_spmv(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  const index_t n = static_cast<index_t>(state.get_int64("N"));
+  const std::string kind = state.get_string("Matrix");
+  const std::string format = state.get_string("Format");
+  if (format == "DIA" && kind != "banded") {
+    state.skip("DIA is only benchmarked for the banded matrix");
+    return;
+  }
+
+  const HostCSR h = GenerateMatrix(kind, n);
+  const index_t nnz = static_cast<index_t>(h.col.size());
+  auto x = make_tensor<ValueType>({n}, MATX_DEVICE_MEMORY);
+  auto y = make_tensor<ValueType>({n}, MATX_DEVICE_MEMORY);
+  (x = ones()).run();
+
+  AddNnzThroughput(state, h);
+  state.add_global_memory_writes<ValueType>(n);
+
+  if (format == "CSR") {
+    auto A = MakeCSR<ValueType>(h, n);
+    state.add_global_memory_reads<ValueType>(nnz + n);
+    state.add_global_memory_reads<int32_t>(nnz + n + 1);
+    cudaDeviceSynchronize();
+    state.exec([&](nvbench::launch &launch) {
+      (y = matvec(A, x)).run(cudaExecutor{launch.get_stream()});
+    });
+  }
+  else {
+    // DIA-I stores every diagonal with one entry per row, zero padded at the ends
+    constexpr index_t diags = 2 * SPARSE_BAND_HALF_WIDTH + 1;
+    std::vector<ValueType> hvals(diags * n, ValueType(0));
+    std::vector<index_t> hoffs(diags);
+    for (index_t d = 0; d < diags; d++) {
+      hoffs[d] = d - SPARSE_BAND_HALF_WIDTH;
+    }
+    for (index_t i = 0; i < n; i++) {
+      for (int32_t k = h.rowp[i]; k < h.rowp[i + 1]; k++) {
+        hvals[(h.col[k] - i + SPARSE_BAND_HALF_WIDTH) * n + i] = static_cast<ValueType>(h.val[k]);
+      }
+    }
+    auto vals = ToDevice(hvals);
+    auto offs = ToDevice(hoffs);
+    auto A = experimental::make_tensor_dia<experimental::DIA_INDEX_I>(vals, offs, {n, n});
+    state.add_global_memory_reads<ValueType>(diags * n + n);
+    cudaDeviceSynchronize();
+    state.exec([&](nvbench::launch &launch) {
+      (y = matvec(A, x)).run(cudaExecutor{launch.get_stream()});
+    });
+  }
+}
+NVBENCH_BENCH_TYPES(sparse_spmv, NVBENCH_TYPE_AXES(sparse_types))
+    .add_int64_power_of_two_axis("N", nvbench::range(14, 17, 3))
+    .add_string_axis("Matrix", {"banded", "powerlaw", "block"})
+    .add_string_axis("Format", {"CSR", "DIA"});
+
+/* SpMM */
+template <typename ValueType>
+void sparse_spmm(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  const index_t n = static_cast<index_t>(state.get_int64("N"));
+  const index_t k = static_cast<index_t>(state.get_int64("Cols"));
+  const HostCSR h = GenerateMatrix(state.get_string("Matrix"), n);
+  const index_t nnz = static_cast<index_t>(h.col.size());
+
+  auto A = MakeCSR<ValueType>(h, n);
+  auto B = make_tensor<ValueType>({n, k}, MATX_DEVICE_MEMORY);
+  auto C = make_tensor<ValueType>({n, k}, MATX_DEVICE_MEMORY);
+  (B = ones()).run();
+  cudaDeviceSynchronize();
+
+  AddNnzThroughput(state, h);
+  state.add_global_memory_reads<ValueType>(nnz + n * k);
+  state.add_global_memory_reads<int32_t>(nnz + n + 1);
+  state.add_global_memory_writes<ValueType>(n * k);
+
+  state.exec([&](nvbench::launch &launch) {
+    (C = matmul(A, B)).run(cudaExecutor{launch.get_stream()});
+  });
+}
+NVBENCH_BENCH_TYPES(sparse_spmm, NVBENCH_TYPE_AXES(sparse_types))
+    .add_int64_power_of_two_axis("N", nvbench::range(14, 17, 3))
+    .add_int64_axis("Cols", {8, 64})
+    .add_string_axis("Matrix", {"banded", "powerlaw", "block"});
+
+/* Direct solve with cuDSS. The first solve runs the analysis outside the measurement, so the measured
+ * solves refactorize with the same sparsity pattern and solve. */
+template <typename ValueType>
+void sparse_solve(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  if constexpr (!detail::CheckDssSolverSupport<cudaExecutor>()) {
+    state.skip("cuDSS support is not enabled. Build with MATX_EN_CUDSS.");
+  }
+  else {
+    const index_t n = static_cast<index_t>(state.get_int64("N"));
+    const index_t nrhs = static_cast<index_t>(state.get_int64("RHS"));
+    const HostCSR h = GenerateMatrix(state.get_string("Matrix"), n);
+
+    auto A = MakeCSR<ValueType>(h, n);
+    auto X = make_tensor<ValueType>({nrhs, n}, MATX_DEVICE_MEMORY);
+    auto Y = make_tensor<ValueType>({nrhs, n}, MATX_DEVICE_MEMORY);
+    (Y = ones()).run();
+    (X = solve(A, Y)).run();
+    cudaDeviceSynchronize();
+
+    AddNnzThroughput(state, h);
+    state.exec([&](nvbench::launch &launch) {
+      (X = solve(A, Y)).run(cudaExecutor{launch.get_stream()});
+    });
+  }
+}
+NVBENCH_BENCH_TYPES(sparse_solve, NVBENCH_TYPE_AXES(sparse_types))
+    .add_int64_power_of_two_axis("N", nvbench::range(14, 17, 3))
+    .add_int64_axis("RHS", {1, 16})
+    .add_string_axis("Matrix", {"banded", "block"});
+
+/* Conversions between dense, COO, and CSR */
+template <typename ValueType>
+void sparse_convert(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  const index_t n = static_cast<index_t>(state.get_int64("N"));
+  const std::string conv = state.get_string("Conversion");
+  const HostCSR h = GenerateMatrix(state.get_string("Matrix"), n);
+  const index_t nnz = static_cast<index_t>(h.col.size());
+
+  auto A = MakeCSR<ValueType>(h, n);
+  auto D = make_tensor<ValueType>({n, n}, MATX_DEVICE_MEMORY);
+  (D = sparse2dense(A)).run();
+  cudaDeviceSynchronize();
+
+  AddNnzThroughput(state, h);
+
+  if (conv == "dense2sparse") {
+    auto S = experimental::make_zero_tensor_csr<ValueType, int32_t, int32_t>({n, n}, MATX_DEVICE_MEMORY);
+    state.add_global_memory_reads<ValueType>(n * n);
+    state.exec(nvbench::exec_tag::sync, [&](nvbench::launch &launch) {
+      (S = dense2sparse(D)).run(cudaExecutor{launch.get_stream()});
+    });
+  }
+  else if (conv == "sparse2dense") {
+    state.add_global_memory_writes<ValueType>(n * n);
+    state.exec([&](nvbench::launch &launch) {
+      (D = sparse2dense(A)).run(cudaExecutor{launch.get_stream()});
+    });
+  }
+  else {
+    std::vector<int32_t> hrow(nnz);
+    for (index_t i = 0; i < n; i++) {
+      std::fill(hrow.begin() + h.rowp[i], hrow.begin() + h.rowp[i + 1], static_cast<int32_t>(i));
+    }
+    auto val = ToDevice(CastValues<ValueType>(h));
+    auto row = ToDevice(hrow);
+    auto col = ToDevice(h.col);
+    auto Acoo = experimental::make_tensor_coo(val, row, col, {n, n});
+    auto S = experimental::make_zero_tensor_csr<ValueType, int32_t, int32_t>({n, n}, MATX_DEVICE_MEMORY);
+    state.add_global_memory_reads<int32_t>(nnz);
+    state.exec([&](nvbench::launch &launch) {
+      (S = sparse2sparse(Acoo)).run(cudaExecutor{launch.get_stream()});
+    });
+  }
+}
+NVBENCH_BENCH_TYPES(sparse_convert, NVBENCH_TYPE_AXES(sparse_types))
+    .add_int64_power_of_two_axis("N", nvbench::range(11, 13, 2))
+    .add_string_axis("Matrix", {"banded", "powerlaw", "block"})
+    .add_string_axis("Conversion", {"dense2sparse", "sparse2dense", "coo2csr"});
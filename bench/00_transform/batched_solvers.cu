@@ -0,0 +1,96 @@
+#include "matx.h"
+#include <nvbench/nvbench.cuh>
+#include "peak_memory.h"
+
+#include <string>
+
+using namespace matx;
+
+using batched_solver_types =
+    nvbench::type_list<float, double, cuda::std::complex<float>, cuda::std::complex<double>>;
+
+// Largest input tensor a configuration may allocate. Larger size and batch combinations are skipped.
+constexpr size_t BATCHED_SOLVER_MAX_BYTES = size_t{1} << 29;
+
+/* Batched dense solvers over matrix size and batch count, to show where the batched cuSOLVER and cuBLAS
+   paths cross over from the per-matrix ones. Each measurement is reported per matrix. There is no dense
+   solve operator, so "solve" is the usual dense pattern of matmul(inv(A), B) with one right-hand side. */
+template <typename ValueType>
+void batched_solver(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  BenchPeakMemory peak{state};
+  using AType = ValueType;
+  using RType = typename inner_op_type_t<AType>::type;
+
+  const index_t n = static_cast<index_t>(state.get_int64("Size"));
+  const index_t batch = static_cast<index_t>(state.get_int64("Batch"));
+  const std::string op = state.get_string("Op");
+
+  if (static_cast<size_t>(batch * n * n) * sizeof(AType) > BATCHED_SOLVER_MAX_BYTES) {
+    state.skip("Input too large");
+    return;
+  }
+
+  cudaExecutor exec{};
+  auto B = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+  auto A = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+
+  // Hermitian positive definite input, so every solver accepts it
+  (B = random<AType>({batch, n, n}, NORMAL)).run(exec);
+  (A = matmul(B, conj(transpose_matrix(B)))).run(exec);
+  exec.sync();
+
+  state.add_element_count(batch, "Matrices");
+  state.add_global_memory_reads<AType>(batch * n * n);
+
+  // Runs once to create plans and workspaces, then under measurement
+  auto bench = [&](auto &&fn) {
+    fn(exec);
+    exec.sync();
+    state.exec([&fn](nvbench::launch &launch) { fn(cudaExecutor{launch.get_stream()}); });
+  };
+
+  if (op == "inv") {
+    auto O = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+    bench([&](auto e) { (O = inv(A)).run(e); });
+  }
+  else if (op == "chol") {
+    auto L = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+    bench([&](auto e) { (L = chol(A, SolverFillMode::LOWER)).run(e); });
+  }
+  else if (op == "lu") {
+    auto LU = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+    auto piv = make_tensor<int64_t>({batch, n}, MATX_DEVICE_MEMORY);
+    bench([&](auto e) { (mtie(LU, piv) = lu(A)).run(e); });
+  }
+  else if (op == "qr") {
+    auto QR = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+    auto tau = make_tensor<AType>({batch, n}, MATX_DEVICE_MEMORY);
+    bench([&](auto e) { (mtie(QR, tau) = qr_solver(A)).run(e); });
+  }
+  else if (op == "svd") {
+    auto U = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+    auto S = make_tensor<RType>({batch, n}, MATX_DEVICE_MEMORY);
+    auto VT = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+    bench([&](auto e) { (mtie(U, S, VT) = svd(A)).run(e); });
+  }
+  else if (op == "eig") {
+    auto V = make_tensor<AType>({batch, n, n}, MATX_DEVICE_MEMORY);
+    auto W = make_tensor<RType>({batch, n}, MATX_DEVICE_MEMORY);
+    bench([&](auto e) { (mtie(V, W) = eig(A)).run(e); });
+  }
+  else if (op == "det") {
+    auto d = make_tensor<AType>({batch}, MATX_DEVICE_MEMORY);
+    bench([&](auto e) { (d = det(A)).run(e); });
+  }
+  else {
+    auto Y = make_tensor<AType>({batch, n, 1}, MATX_DEVICE_MEMORY);
+    auto X = make_tensor<AType>({batch, n, 1}, MATX_DEVICE_MEMORY);
+    (Y = ones()).run(exec);
+    bench([&](auto e) { (X = matmul(inv(A), Y)).run(e); });
+  }
+}
+NVBENCH_BENCH_TYPES(batched_solver, NVBENCH_TYPE_AXES(batched_solver_types))
+  .add_string_axis("Op", {"inv", "chol", "lu", "qr", "svd", "eig", "det", "solve"})
+  .add_int64_power_of_two_axis("Size", nvbench::range(2, 10, 2))
+  .add_int64_axis("Batch", {1, 100, 10000, 1000000});
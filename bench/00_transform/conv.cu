@@ -1,5 +1,6 @@
 #include "matx.h"
 #include <nvbench/nvbench.cuh>
+#include "peak_memory.h"
 #include "matx/core/half_complex.h"
 #include "matx/core/nvtx.h"
 
@@ -13,6 +14,7 @@ template <typename ValueType>
 void conv1d_direct_4d_batch(nvbench::state &state,
                             nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   cudaExecutor exec{0};
   auto out = make_tensor<ValueType>({4, 2, 14, 288 + 4096 + 133 - 1});
   auto at = make_tensor<ValueType>({ 4, 2, 14, 133});
@@ -36,6 +38,7 @@ template <typename ValueType>
 void conv1d_direct_2d_batch(nvbench::state &state,
                             nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   cudaExecutor exec{0};
 
   auto out = make_tensor<ValueType>({4 * 2* 14, 288 + 4096 + 133 - 1});
@@ -57,6 +60,7 @@ template <typename ValueType>
 void conv1d_direct_large(nvbench::state &state,
                             nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   cudaExecutor exec{0};
   const index_t signal_size = static_cast<index_t>(state.get_int64("Signal Size"));
   const index_t filter_size = static_cast<index_t>(state.get_int64("Filter Size"));
@@ -83,6 +87,7 @@ template <typename ValueType>
 void conv1d_fft_large(nvbench::state &state,
                             nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   cudaExecutor exec{0};
   const index_t signal_size = static_cast<index_t>(state.get_int64("Signal Size"));
   const index_t filter_size = static_cast<index_t>(state.get_int64("Filter Size"));
@@ -110,6 +115,7 @@ template <typename ValueType>
 void conv2d_direct_batch(nvbench::state &state,
                             nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   cudaExecutor exec{0};
   auto at = make_tensor<ValueType>({256, 1024, 1024});
   auto bt = make_tensor<ValueType>({256, 16, 16});
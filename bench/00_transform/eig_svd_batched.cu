@@ -0,0 +1,98 @@
+#include "matx.h"
+#include <nvbench/nvbench.cuh>
+#include "peak_memory.h"
+#include "matx/core/nvtx.h"
+
+using namespace matx;
+
+using jacobi_types =
+    nvbench::type_list<float, double, cuda::std::complex<float>, cuda::std::complex<double>>;
+
+/* Batched eigen/SVD benchmarks of small matrices. The "jacobi" axis selects between the
+   batched Jacobi solvers (1) and the general-size solvers (0) */
+template <typename ValueType>
+void eig_batch(nvbench::state &state,
+                            nvbench::type_list<ValueType>)
+{
+  BenchPeakMemory peak{state};
+  using AType = ValueType;
+  using WType = typename inner_op_type_t<AType>::type;
+
+  cudaStream_t stream = 0;
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream));
+  cudaExecutor exec{stream};
+
+  const index_t batch = static_cast<index_t>(state.get_int64("batch"));
+  const index_t n = static_cast<index_t>(state.get_int64("size"));
+  JacobiParams jacobi;
+  jacobi.enable = state.get_int64("jacobi") != 0;
+
+  auto B = make_tensor<AType>({batch, n, n});
+  auto A = make_tensor<AType>({batch, n, n});
+  auto V = make_tensor<AType>({batch, n, n});
+  auto W = make_tensor<WType>({batch, n});
+
+  // Hermitian positive semi-definite input, like a sample covariance
+  (B = random<AType>({batch, n, n}, NORMAL)).run(exec);
+  (A = matmul(B, conj(transpose_matrix(B)))).run(exec);
+
+  // warm up
+  nvtxRangePushA("Warmup");
+  (mtie(V, W) = eig(A, EigenMode::VECTOR, SolverFillMode::UPPER, jacobi)).run(exec);
+  exec.sync();
+  nvtxRangePop();
+
+  MATX_NVTX_START_RANGE( "Exec", matx_nvxtLogLevels::MATX_NVTX_LOG_ALL, 1 )
+  state.exec(
+   [&V, &W, &A, &jacobi](nvbench::launch &launch) {
+      (mtie(V, W) = eig(A, EigenMode::VECTOR, SolverFillMode::UPPER, jacobi)).run(cudaExecutor{launch.get_stream()}); });
+  MATX_NVTX_END_RANGE( 1 )
+
+}
+NVBENCH_BENCH_TYPES(eig_batch, NVBENCH_TYPE_AXES(jacobi_types))
+  .add_int64_axis("size", {8, 16, 32})
+  .add_int64_axis("batch", {1000, 10000})
+  .add_int64_axis("jacobi", {0, 1});
+
+
+template <typename ValueType>
+void svd_batch(nvbench::state &state,
+                            nvbench::type_list<ValueType>)
+{
+  BenchPeakMemory peak{state};
+  using AType = ValueType;
+  using SType = typename inner_op_type_t<AType>::type;
+
+  cudaStream_t stream = 0;
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream));
+  cudaExecutor exec{stream};
+
+  const index_t batch = static_cast<index_t>(state.get_int64("batch"));
+  const index_t n = static_cast<index_t>(state.get_int64("size"));
+  JacobiParams jacobi;
+  jacobi.enable = state.get_int64("jacobi") != 0;
+
+  auto A = make_tensor<AType>({batch, n, n});
+  auto U = make_tensor<AType>({batch, n, n});
+  auto VT = make_tensor<AType>({batch, n, n});
+  auto S = make_tensor<SType>({batch, n});
+
+  (A = random<AType>({batch, n, n}, NORMAL)).run(exec);
+
+  // warm up
+  nvtxRangePushA("Warmup");
+  (mtie(U, S, VT) = svd(A, SVDMode::ALL, SVDHostAlgo::DC, jacobi)).run(exec);
+  exec.sync();
+  nvtxRangePop();
+
+  MATX_NVTX_START_RANGE( "Exec", matx_nvxtLogLevels::MATX_NVTX_LOG_ALL, 1 )
+  state.exec(
+   [&U, &S, &VT, &A, &jacobi](nvbench::launch &launch) {
+      (mtie(U, S, VT) = svd(A, SVDMode::ALL, SVDHostAlgo::DC, jacobi)).run(cudaExecutor{launch.get_stream()}); });
+  MATX_NVTX_END_RANGE( 1 )
+
+}
+NVBENCH_BENCH_TYPES(svd_batch, NVBENCH_TYPE_AXES(jacobi_types))
+  .add_int64_axis("size", {8, 16, 32})
+  .add_int64_axis("batch", {1000, 10000})
+  .add_int64_axis("jacobi", {0, 1});
@@ -1,4 +1,5 @@
 #include <nvbench/nvbench.cuh>
+#include "peak_memory.h"
 #include "matx.h"
 
 #ifdef MATX_EN_CUTENSOR
@@ -9,6 +10,7 @@ using einsum_permute_types = nvbench::type_list<float, double, cuda::std::comple
 template <typename ValueType>
 void einsum_permute(nvbench::state &state, nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   auto x = make_tensor<ValueType>({1000,200,6,300});
   auto y = make_tensor<ValueType>({300,1000,6,200});
 
@@ -1,5 +1,6 @@
 #include "matx.h"
 #include <nvbench/nvbench.cuh>
+#include "peak_memory.h"
 
 using namespace matx;
 
@@ -11,6 +12,7 @@ template <typename ValueType>
 void fft1d_no_batches_pow_2(nvbench::state &state,
                             nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   // Get current parameters:
   const int x_len = static_cast<int>(state.get_int64("FFT size"));
 
@@ -28,6 +30,7 @@ template <typename ValueType>
 void fft1d_no_batches_non_pow_2(nvbench::state &state,
                                 nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   // Get current parameters:
   const int x_len = static_cast<int>(state.get_int64("FFT size"));
 
@@ -43,6 +46,7 @@ NVBENCH_BENCH_TYPES(fft1d_no_batches_non_pow_2, NVBENCH_TYPE_AXES(fft_types))
 template <typename ValueType>
 void fft1d_batches_pow_2(nvbench::state &state, nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   // Get current parameters:
   const int x_len = static_cast<int>(state.get_int64("FFT size"));
 
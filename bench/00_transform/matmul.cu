@@ -1,5 +1,6 @@
 #include "matx.h"
 #include <nvbench/nvbench.cuh>
+#include "peak_memory.h"
 
 using namespace matx;
 
@@ -11,6 +12,7 @@ using matmul_types =
 template <typename ValueType>
 void pow2_matmul_bench(nvbench::state &state, nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   // Get current parameters:
   const index_t M = static_cast<index_t>(state.get_int64("M"));
   const index_t N = static_cast<index_t>(state.get_int64("N"));
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "matx.h"
+#include <nvbench/nvbench.cuh>
+
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * Reports the peak memory a transform benchmark allocated through MatX when MATX_BENCH_PEAK_MEMORY=1
+ *
+ * Construct one at the top of a benchmark, before any tensors are created. The transform caches are
+ * cleared first so that plans and workspaces created by the benchmark are counted. When it goes out of
+ * scope, the peak bytes allocated since construction are added as the "Peak Memory" summary, and the bytes
+ * still held by the transform caches as "Cache Memory". Memory that CUDA libraries allocate without going
+ * through MatX is not counted.
+ */
+class BenchPeakMemory {
+public:
+  explicit BenchPeakMemory(nvbench::state &state) : state_(state)
+  {
+    const char *env = std::getenv("MATX_BENCH_PEAK_MEMORY");
+    enabled_ = env != nullptr && std::strcmp(env, "0") != 0;
+    if (!enabled_) {
+      return;
+    }
+
+    cudaDeviceSynchronize();
+    matx::ClearCaches();
+    matx::matxResetPeakMemoryStats();
+    size_t total, max;
+    matx::matxGetMemoryStats(&base_, &total, &max);
+  }
+
+  ~BenchPeakMemory()
+  {
+    if (!enabled_) {
+      return;
+    }
+
+    size_t current, total, max;
+    matx::matxGetMemoryStats(&current, &total, &max);
+    size_t hits, misses, evictions, entries, cache_bytes;
+    matx::GetCacheStats(&hits, &misses, &evictions, &entries, &cache_bytes);
+
+    auto &peak = state_.add_summary("Peak Memory");
+    peak.set_string("hint", "bytes");
+    peak.set_string("short_name", "Peak Mem");
+    peak.set_string("description", "Peak bytes allocated through MatX, including transform plans and workspaces");
+    peak.set_float64("value", static_cast<double>(max > base_ ? max - base_ : 0));
+
+    auto &cache = state_.add_summary("Cache Memory");
+    cache.set_string("hint", "bytes");
+    cache.set_string("short_name", "Cache Mem");
+    cache.set_string("description", "Bytes held by transform plans and workspaces in the MatX caches");
+    cache.set_float64("value", static_cast<double>(cache_bytes));
+  }
+
+private:
+  nvbench::state &state_;
+  bool enabled_ = false;
+  size_t base_ = 0;
+};
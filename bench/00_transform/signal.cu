@@ -0,0 +1,252 @@
+#include "matx.h"
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+using namespace matx;
+
+/* Polyphase channelizer. The decimation factor equals the channel count (maximally decimated) and the
+   filter has a fixed number of taps per channel, matching how the channelizer is typically used. */
+using channelize_types = nvbench::type_list<float, double, cuda::std::complex<float>, cuda::std::complex<double>>;
+
+template <typename InType>
+void channelize_poly_bench(nvbench::state &state, nvbench::type_list<InType>)
+{
+  using OutType = cuda::std::complex<typename inner_op_type_t<InType>::type>;
+  const index_t batches = static_cast<index_t>(state.get_int64("Batch"));
+  const index_t channels = static_cast<index_t>(state.get_int64("Channels"));
+  const index_t filter_len = static_cast<index_t>(state.get_int64("Taps Per Channel")) * channels;
+  const index_t input_len = static_cast<index_t>(state.get_int64("Input Length"));
+  const index_t output_len_per_channel = (input_len + channels - 1) / channels;
+
+  auto input = make_tensor<InType>({batches, input_len}, MATX_DEVICE_MEMORY);
+  auto filter = make_tensor<InType>({filter_len}, MATX_DEVICE_MEMORY);
+  auto output = make_tensor<OutType>({batches, output_len_per_channel, channels}, MATX_DEVICE_MEMORY);
+  (input = ones()).run();
+  (filter = ones()).run();
+
+  state.add_element_count(batches * channels * output_len_per_channel, "Output Points");
+  state.add_global_memory_reads<InType>(batches * input_len);
+  state.add_global_memory_writes<OutType>(batches * channels * output_len_per_channel);
+
+  (output = channelize_poly(input, filter, channels, channels)).run();
+  cudaDeviceSynchronize();
+
+  state.exec([&](nvbench::launch &launch) {
+    (output = channelize_poly(input, filter, channels, channels)).run(cudaExecutor{launch.get_stream()});
+  });
+}
+NVBENCH_BENCH_TYPES(channelize_poly_bench, NVBENCH_TYPE_AXES(channelize_types))
+  .add_int64_axis("Batch", {1, 42})
+  .add_int64_axis("Channels", {3, 8, 16, 64})
+  .add_int64_axis("Taps Per Channel", {17, 32})
+  .add_int64_axis("Input Length", {3000, 256000});
+
+/* Polyphase resampler. The filter has 10 * max(up, down) taps on either side of its center, as
+   scipy.signal.resample_poly would design. */
+using resample_types = nvbench::type_list<float, double, cuda::std::complex<float>>;
+
+template <typename InType>
+void resample_poly_bench(nvbench::state &state, nvbench::type_list<InType>)
+{
+  const index_t batches = static_cast<index_t>(state.get_int64("Batch"));
+  const index_t input_len = static_cast<index_t>(state.get_int64("Input Length"));
+  const std::string ratio = state.get_string("Up/Down");
+  const index_t up = std::stoll(ratio.substr(0, ratio.find('/')));
+  const index_t down = std::stoll(ratio.substr(ratio.find('/') + 1));
+  const index_t filter_len = 2 * 10 * std::max(up, down) + 1;
+  const index_t filter_len_per_phase = (filter_len + up - 1) / up;
+  const index_t up_len = input_len * up;
+  const index_t output_len = up_len / down + ((up_len % down) ? 1 : 0);
+  if (batches * output_len > (index_t{1} << 28)) {
+    state.skip("Output too large");
+    return;
+  }
+
+  auto input = make_tensor<InType>({batches, input_len}, MATX_DEVICE_MEMORY);
+  auto filter = make_tensor<InType>({filter_len}, MATX_DEVICE_MEMORY);
+  auto output = make_tensor<InType>({batches, output_len}, MATX_DEVICE_MEMORY);
+  (input = ones()).run();
+  (filter = ones()).run();
+
+  state.add_element_count(batches * output_len, "Output Points");
+  state.add_global_memory_reads<InType>(batches * input_len);
+  state.add_global_memory_writes<InType>(batches * output_len);
+
+  (output = resample_poly(input, filter, up, down)).run();
+  cudaDeviceSynchronize();
+
+  state.exec([&](nvbench::launch &launch) {
+    (output = resample_poly(input, filter, up, down)).run(cudaExecutor{launch.get_stream()});
+  });
+
+  const double seconds = state.get_summary("Batch GPU").get_float64("value");
+  auto &summ = state.add_summary("GFLOPS");
+  summ.set_string("hint", "item_rate");
+  summ.set_string("short_name", "GFLOPS");
+  summ.set_string("description", "Billions of filter operations per second");
+  summ.set_float64("value", static_cast<double>(batches * (2 * filter_len_per_phase - 1) * output_len) /
+                                seconds / 1e9);
+}
+NVBENCH_BENCH_TYPES(resample_poly_bench, NVBENCH_TYPE_AXES(resample_types))
+  .add_int64_axis("Batch", {1, 42})
+  .add_int64_axis("Input Length", {3000, 256000, 10000000})
+  .add_string_axis("Up/Down", {"384/3125", "384/175", "2/3", "4/5", "7/64", "1/4", "1/16", "4/1", "16/1"});
+
+/* Recursive (IIR) filter with a second-order recursive and non-recursive section */
+using filter_types = nvbench::type_list<float, double>;
+
+template <typename ValueType>
+void iir_filter(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  const index_t batches = static_cast<index_t>(state.get_int64("Batch"));
+  const index_t len = static_cast<index_t>(state.get_int64("Signal Length"));
+  const auto rec = cuda::std::array<ValueType, 2>{ValueType(0.4), ValueType(-0.1)};
+  const auto nonrec = cuda::std::array<ValueType, 2>{ValueType(2.0), ValueType(1.0)};
+
+  auto in = make_tensor<ValueType>({batches, len}, MATX_DEVICE_MEMORY);
+  auto out = make_tensor<ValueType>({batches, len}, MATX_DEVICE_MEMORY);
+  (in = random<ValueType>({batches, len}, UNIFORM)).run();
+
+  state.add_element_count(batches * len, "Samples");
+  state.add_global_memory_reads<ValueType>(batches * len);
+  state.add_global_memory_writes<ValueType>(batches * len);
+
+  (out = filter(in, rec, nonrec)).run();
+  cudaDeviceSynchronize();
+
+  state.exec([&](nvbench::launch &launch) {
+    (out = filter(in, rec, nonrec)).run(cudaExecutor{launch.get_stream()});
+  });
+}
+NVBENCH_BENCH_TYPES(iir_filter, NVBENCH_TYPE_AXES(filter_types))
+  .add_int64_axis("Batch", {1, 64})
+  .add_int64_power_of_two_axis("Signal Length", nvbench::range(16, 22, 6));
+
+/* Welch power spectral density with 50% overlapping segments and a Hann window */
+using pwelch_types = nvbench::type_list<cuda::std::complex<float>, cuda::std::complex<double>>;
+
+template <typename ValueType>
+void pwelch_bench(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  using RealType = typename ValueType::value_type;
+  const index_t len = static_cast<index_t>(state.get_int64("Signal Length"));
+  const index_t nperseg = static_cast<index_t>(state.get_int64("Segment Length"));
+  const index_t noverlap = nperseg / 2;
+
+  auto x = make_tensor<ValueType>({len}, MATX_DEVICE_MEMORY);
+  auto w = make_tensor<RealType>({nperseg}, MATX_DEVICE_MEMORY);
+  auto Pxx = make_tensor<RealType>({nperseg}, MATX_DEVICE_MEMORY);
+  (x = random<ValueType>({len}, NORMAL)).run();
+  (w = hanning<0>({nperseg})).run();
+
+  state.add_element_count(len, "Samples");
+  state.add_global_memory_reads<ValueType>(len);
+
+  (Pxx = pwelch(x, w, nperseg, noverlap, nperseg)).run();
+  cudaDeviceSynchronize();
+
+  state.exec([&](nvbench::launch &launch) {
+    (Pxx = pwelch(x, w, nperseg, noverlap, nperseg)).run(cudaExecutor{launch.get_stream()});
+  });
+}
+NVBENCH_BENCH_TYPES(pwelch_bench, NVBENCH_TYPE_AXES(pwelch_types))
+  .add_int64_power_of_two_axis("Signal Length", nvbench::range(16, 22, 6))
+  .add_int64_axis("Segment Length", {256, 1024});
+
+/* Ambiguity function of a single waveform, either the full delay-Doppler surface or one cut */
+void ambgfun_bench(nvbench::state &state)
+{
+  const index_t n = static_cast<index_t>(state.get_int64("Signal Length"));
+  const std::string cut_name = state.get_string("Cut");
+  const index_t lags = 2 * n - 1;
+  const index_t nfreq = static_cast<index_t>(std::pow(2, std::ceil(std::log2(static_cast<double>(lags)))));
+
+  AMBGFunCutType_t cut = AMBGFUN_CUT_TYPE_2D;
+  index_t rows = lags;
+  index_t cols = nfreq;
+  if (cut_name == "Delay") {
+    cut = AMBGFUN_CUT_TYPE_DELAY;
+    rows = 1;
+  }
+  else if (cut_name == "Doppler") {
+    cut = AMBGFUN_CUT_TYPE_DOPPLER;
+    rows = 1;
+    cols = lags;
+  }
+
+  auto x = make_tensor<cuda::std::complex<float>>({n}, MATX_DEVICE_MEMORY);
+  auto out = make_tensor<float>({rows, cols}, MATX_DEVICE_MEMORY);
+  (x = random<cuda::std::complex<float>>({n}, NORMAL)).run();
+
+  state.add_element_count(rows * cols, "Output Points");
+  state.add_global_memory_writes<float>(rows * cols);
+
+  (out = ambgfun(x, 1e3, cut, 1.0)).run();
+  cudaDeviceSynchronize();
+
+  state.exec([&](nvbench::launch &launch) {
+    (out = ambgfun(x, 1e3, cut, 1.0)).run(cudaExecutor{launch.get_stream()});
+  });
+}
+NVBENCH_BENCH(ambgfun_bench)
+  .add_int64_power_of_two_axis("Signal Length", nvbench::range(8, 12, 2))
+  .add_string_axis("Cut", {"2D", "Delay", "Doppler"});
+
+/* SAR backprojection of a linear aperture onto a square image, with the phase LUT optimization */
+using sar_bp_types = nvbench::type_list<float, double>;
+
+template <typename ValueType>
+void sar_bp_bench(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  using complex_t = cuda::std::complex<ValueType>;
+  using apc_t = std::conditional_t<std::is_same_v<ValueType, double>, double3, float3>;
+  const index_t image_size = static_cast<index_t>(state.get_int64("Image Size"));
+  const index_t num_pulses = static_cast<index_t>(state.get_int64("Pulses"));
+  const index_t num_range_bins = static_cast<index_t>(state.get_int64("Range Bins"));
+
+  const ValueType min_xy = -10.0;
+  const ValueType max_xy = 10.0;
+  auto pix_coords = linspace<ValueType>(min_xy, max_xy, image_size);
+  auto voxel_locations = zipvec(clone<2>(pix_coords, {image_size, matxKeepDim}),
+                                clone<2>(pix_coords, {matxKeepDim, image_size}),
+                                zeros<ValueType>({image_size, image_size}));
+
+  auto range_profiles = make_tensor<complex_t>({num_pulses, num_range_bins}, MATX_DEVICE_MEMORY);
+  auto range_to_mcp = make_tensor<ValueType>({num_pulses});
+  auto platform_positions = make_tensor<apc_t>({num_pulses});
+  auto image = make_tensor<complex_t>({image_size, image_size}, MATX_DEVICE_MEMORY);
+  (range_profiles = random<complex_t>({num_pulses, num_range_bins}, NORMAL)).run();
+
+  const ValueType plat_dx = (max_xy - min_xy) / static_cast<ValueType>(num_pulses);
+  const ValueType plat_y = -1000.0;
+  const ValueType plat_z = 1000.0;
+  for (index_t i = 0; i < num_pulses; i++) {
+    const ValueType plat_x = min_xy + static_cast<ValueType>(i) * plat_dx;
+    platform_positions(i) = apc_t{plat_x, plat_y, plat_z};
+    range_to_mcp(i) = std::sqrt(plat_x * plat_x + plat_y * plat_y + plat_z * plat_z);
+  }
+
+  SarBpParams params;
+  params.compute_type = std::is_same_v<ValueType, double> ? SarBpComputeType::Double : SarBpComputeType::Float;
+  params.features = SarBpFeature::PhaseLUTOptimization;
+  params.center_frequency = 10.0e9;
+  params.del_r = (max_xy - min_xy) / static_cast<ValueType>(num_range_bins);
+
+  auto zero_image = zeros<complex_t>({image_size, image_size});
+  state.add_element_count(image_size * image_size * num_pulses, "Pixel-Pulses");
+
+  (image = experimental::sar_bp(zero_image, range_profiles, platform_positions, voxel_locations, range_to_mcp, params)).run();
+  cudaDeviceSynchronize();
+
+  state.exec([&](nvbench::launch &launch) {
+    (image = experimental::sar_bp(zero_image, range_profiles, platform_positions, voxel_locations, range_to_mcp, params))
+        .run(cudaExecutor{launch.get_stream()});
+  });
+}
+NVBENCH_BENCH_TYPES(sar_bp_bench, NVBENCH_TYPE_AXES(sar_bp_types))
+  .add_int64_axis("Image Size", {256, 1024})
+  .add_int64_axis("Pulses", {128, 512})
+  .add_int64_axis("Range Bins", {1024});
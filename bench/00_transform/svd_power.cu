@@ -1,5 +1,6 @@
 #include "matx.h"
 #include <nvbench/nvbench.cuh>
+#include "peak_memory.h"
 #include "matx/core/nvtx.h"
 
 using namespace matx;
@@ -12,6 +13,7 @@ template <typename ValueType>
 void svdpi_batch(nvbench::state &state,
                             nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   using AType = ValueType;
   using SType = typename inner_op_type_t<AType>::type;
 
@@ -61,6 +63,7 @@ template <typename ValueType>
 void svdbpi_batch(nvbench::state &state,
                             nvbench::type_list<ValueType>)
 {
+  BenchPeakMemory peak{state};
   using AType = ValueType;
   using SType = typename inner_op_type_t<AType>::type;
 
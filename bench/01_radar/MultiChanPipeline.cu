@@ -0,0 +1,130 @@
+#include <nvbench/nvbench.cuh>
+#include "simple_radar_pipeline.h"
+#include "matx.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace matx;
+
+using radar_types = nvbench::type_list<cuda::std::complex<float>, cuda::std::complex<double>>;
+
+/**
+ * Full radar pipeline with one CPI in flight per stream, as in examples/simple_radar_pipeline.cu
+ *
+ * Each measurement starts every stream at once from the launch stream and waits for all of them, so
+ * the reported time is for Streams CPIs of Channels channels each. Per-CPI latency is timed with
+ * events on each stream and reported as p50/p99 summaries next to the pulse throughput.
+ */
+template <typename ValueType>
+void radar_pipeline_multi_stream(nvbench::state &state, nvbench::type_list<ValueType>)
+{
+  const index_t numPulses = static_cast<index_t>(state.get_int64("Pulses"));
+  const index_t numChannels = static_cast<index_t>(state.get_int64("Channels"));
+  const index_t numSamples = static_cast<index_t>(state.get_int64("Samples"));
+  const index_t waveformLength = static_cast<index_t>(state.get_int64("Waveform Length"));
+  const int numStreams = static_cast<int>(state.get_int64("Streams"));
+  const bool useGraphs = state.get_int64("Graphs") != 0;
+
+  std::vector<cudaStream_t> streams(numStreams);
+  std::vector<cudaEvent_t> stops(numStreams);
+  std::vector<cudaGraph> graphs(numStreams);
+  std::vector<std::unique_ptr<RadarPipeline<ValueType>>> pipelines;
+  cudaEvent_t start;
+  cudaEventCreate(&start);
+
+  for (int s = 0; s < numStreams; s++) {
+    cudaStreamCreateWithFlags(&streams[s], cudaStreamNonBlocking);
+    cudaEventCreate(&stops[s]);
+    pipelines.push_back(std::make_unique<RadarPipeline<ValueType>>(numPulses, numSamples, waveformLength,
+                                                                   numChannels, streams[s]));
+  }
+
+  auto run_pipeline = [&](int s) {
+    pipelines[s]->PulseCompression();
+    pipelines[s]->ThreePulseCanceller();
+    pipelines[s]->DopplerProcessing();
+    pipelines[s]->CFARDetections();
+  };
+
+  // Warm up plans and caches before any capture
+  for (int s = 0; s < numStreams; s++) {
+    run_pipeline(s);
+    pipelines[s]->sync();
+  }
+
+  if (useGraphs) {
+    for (int s = 0; s < numStreams; s++) {
+      cudaExecutor{streams[s]}.capture(graphs[s], [&]() { run_pipeline(s); }, false);
+    }
+  }
+
+  state.add_element_count(numPulses * numChannels * numStreams, "Pulses");
+  state.add_global_memory_reads<ValueType>(numPulses * numChannels * numSamples * numStreams, "Input");
+
+  std::vector<float> latencies_ms;
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::sync,
+    [&](nvbench::launch &launch, auto &timer) {
+      timer.start();
+      cudaEventRecord(start, launch.get_stream());
+      for (int s = 0; s < numStreams; s++) {
+        cudaStreamWaitEvent(streams[s], start);
+        if (useGraphs) {
+          graphs[s].launch(streams[s]);
+        }
+        else {
+          run_pipeline(s);
+        }
+        cudaEventRecord(stops[s], streams[s]);
+        cudaStreamWaitEvent(launch.get_stream(), stops[s]);
+      }
+      timer.stop();
+
+      for (int s = 0; s < numStreams; s++) {
+        float ms;
+        cudaEventSynchronize(stops[s]);
+        cudaEventElapsedTime(&ms, start, stops[s]);
+        latencies_ms.push_back(ms);
+      }
+    });
+
+  if (!latencies_ms.empty()) {
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    auto percentile = [&](double p) {
+      const size_t idx = std::min(latencies_ms.size() - 1,
+                                  static_cast<size_t>(p * static_cast<double>(latencies_ms.size())));
+      return static_cast<double>(latencies_ms[idx]) * 1e-3;
+    };
+
+    auto &p50 = state.add_summary("CPI Latency p50");
+    p50.set_string("hint", "duration");
+    p50.set_string("short_name", "p50 CPI");
+    p50.set_string("description", "Median time from the start of a CPI to its detections");
+    p50.set_float64("value", percentile(0.50));
+
+    auto &p99 = state.add_summary("CPI Latency p99");
+    p99.set_string("hint", "duration");
+    p99.set_string("short_name", "p99 CPI");
+    p99.set_string("description", "99th percentile time from the start of a CPI to its detections");
+    p99.set_float64("value", percentile(0.99));
+  }
+
+  for (int s = 0; s < numStreams; s++) {
+    pipelines[s]->sync();
+    cudaEventDestroy(stops[s]);
+  }
+  graphs.clear();
+  pipelines.clear();
+  for (int s = 0; s < numStreams; s++) {
+    cudaStreamDestroy(streams[s]);
+  }
+  cudaEventDestroy(start);
+}
+NVBENCH_BENCH_TYPES(radar_pipeline_multi_stream, NVBENCH_TYPE_AXES(radar_types))
+  .add_int64_axis("Pulses", {128})
+  .add_int64_axis("Channels", {4, 16})
+  .add_int64_axis("Samples", {9000})
+  .add_int64_axis("Waveform Length", {1000})
+  .add_int64_axis("Streams", {1, 2, 4})
+  .add_int64_axis("Graphs", {0, 1});
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+
+# BSD 3-Clause License
+#
+# Copyright (c) 2026, NVIDIA Corporation
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+Track matx_bench performance across commits.
+
+The run command runs matx_bench with nvbench JSON output and stores the result as
+<results>/<gpu>/<commit>.json. The compare command compares two result files and
+prints a report of every benchmark state whose GPU time moved by more than the noise
+threshold. Passing --baseline to run does both in one step:
+
+    bench_regression.py run --build-dir build --baseline results/NVIDIA_H100/abc1234.json
+
+A state only counts as a regression or improvement when its time changed by more than
+the larger of --threshold percent and --noise-mult times the relative standard
+deviation nvbench measured for it, so noisy benchmarks need a larger change to be
+reported.
+"""
+
+import argparse
+import json
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+# Summaries holding the mean GPU time and its relative deviation, in order of preference
+TIME_TAGS = ["nv/batch/time/gpu/mean", "nv/cold/time/gpu/mean"]
+NOISE_TAGS = {"nv/batch/time/gpu/mean": "nv/cold/time/gpu/stdev/relative",
+              "nv/cold/time/gpu/mean": "nv/cold/time/gpu/stdev/relative"}
+
+
+def summary_value(state, tag):
+    """Return the float value of a state's summary with the given tag, or None."""
+    for summ in state.get("summaries") or []:
+        if summ.get("tag") != tag:
+            continue
+        for item in summ.get("data", []):
+            if item.get("name") == "value":
+                return float(item["value"])
+    return None
+
+
+def load_results(path):
+    """Load an nvbench JSON file as {"<benchmark>/<state>": (seconds, relative noise)}."""
+    with open(path) as f:
+        data = json.load(f)
+
+    results = {}
+    for bench in data.get("benchmarks", []):
+        for state in bench.get("states", []):
+            if state.get("is_skipped"):
+                continue
+            for tag in TIME_TAGS:
+                seconds = summary_value(state, tag)
+                if seconds is not None:
+                    noise = summary_value(state, NOISE_TAGS[tag]) or 0.0
+                    results[f"{bench['name']}/{state['name']}"] = (seconds, noise)
+                    break
+    return results
+
+
+def gpu_name(path):
+    """Name of the first device in an nvbench JSON file, usable as a directory name."""
+    with open(path) as f:
+        devices = json.load(f).get("devices", [])
+    name = devices[0].get("name", "unknown") if devices else "unknown"
+    return re.sub(r"[^A-Za-z0-9_.-]+", "_", name)
+
+
+def git_commit(source_dir):
+    try:
+        return subprocess.run(["git", "-C", str(source_dir), "rev-parse", "--short", "HEAD"],
+                              capture_output=True, text=True, check=True).stdout.strip()
+    except (subprocess.CalledProcessError, FileNotFoundError):
+        return "unknown"
+
+
+def format_time(seconds):
+    if seconds >= 1.0:
+        return f"{seconds:.3f} s"
+    if seconds >= 1e-3:
+        return f"{seconds * 1e3:.3f} ms"
+    return f"{seconds * 1e6:.3f} us"
+
+
+def compare(baseline_path, current_path, threshold, noise_mult, out=sys.stdout):
+    """Print a markdown diff report and return the number of regressions."""
+    base = load_results(baseline_path)
+    cur = load_results(current_path)
+
+    regressions, improvements, unchanged = [], [], 0
+    for key in sorted(base.keys() & cur.keys()):
+        (b, b_noise), (c, c_noise) = base[key], cur[key]
+        if b <= 0.0:
+            continue
+        change = (c - b) / b
+        limit = max(threshold / 100.0, noise_mult * max(b_noise, c_noise))
+        row = (key, b, c, change, limit)
+        if change > limit:
+            regressions.append(row)
+        elif change < -limit:
+            improvements.append(row)
+        else:
+            unchanged += 1
+
+    print("# Benchmark comparison\n", file=out)
+    print(f"Baseline: `{baseline_path}`  ", file=out)
+    print(f"Current: `{current_path}`\n", file=out)
+    print(f"{len(regressions)} regressions, {len(improvements)} improvements, {unchanged} within noise, "
+          f"{len(base.keys() - cur.keys())} only in baseline, {len(cur.keys() - base.keys())} only in current\n",
+          file=out)
+
+    for title, rows in (("Regressions", regressions), ("Improvements", improvements)):
+        if not rows:
+            continue
+        print(f"## {title}\n", file=out)
+        print("| Benchmark | Baseline | Current | Change | Threshold |", file=out)
+        print("|---|---|---|---|---|", file=out)
+        for key, b, c, change, limit in sorted(rows, key=lambda r: -abs(r[3])):
+            print(f"| {key} | {format_time(b)} | {format_time(c)} | {change * 100:+.1f}% | "
+                  f"{limit * 100:.1f}% |", file=out)
+        print(file=out)
+
+    return len(regressions)
+
+
+def run(args):
+    exe = Path(args.build_dir) / "bench" / "matx_bench"
+    if not exe.exists():
+        print(f"Error: could not find matx_bench at {exe}")
+        return 1
+
+    results_dir = Path(args.results)
+    results_dir.mkdir(parents=True, exist_ok=True)
+    tmp = results_dir / "current.json"
+
+    cmd = [str(exe), "--json", str(tmp)]
+    for bench in args.benchmark or []:
+        cmd += ["--benchmark", bench]
+    cmd += args.nvbench_args
+    print("Running:", " ".join(cmd))
+    if subprocess.run(cmd).returncode != 0:
+        print("Error: matx_bench failed")
+        return 1
+
+    commit = args.commit or git_commit(args.source_dir)
+    dest = results_dir / gpu_name(tmp) / f"{commit}.json"
+    dest.parent.mkdir(parents=True, exist_ok=True)
+    tmp.replace(dest)
+    print(f"Stored results in {dest}")
+
+    if args.baseline:
+        return compare_and_report(args.baseline, dest, args)
+    return 0
+
+
+def compare_and_report(baseline, current, args):
+    if args.report:
+        with open(args.report, "w") as f:
+            regressions = compare(baseline, current, args.threshold, args.noise_mult, f)
+        print(f"Wrote report to {args.report}")
+    else:
+        regressions = compare(baseline, current, args.threshold, args.noise_mult)
+    return 1 if regressions and args.fail_on_regression else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    def add_compare_args(p):
+        p.add_argument("--threshold", type=float, default=5.0,
+                       help="Smallest change in percent reported as a regression or improvement (default 5)")
+        p.add_argument("--noise-mult", type=float, default=2.0,
+                       help="Multiple of the measured relative deviation a change must exceed (default 2)")
+        p.add_argument("--report", help="Write the markdown report to this file instead of stdout")
+        p.add_argument("--fail-on-regression", action="store_true", help="Exit with status 1 on any regression")
+
+    p_run = sub.add_parser("run", help="Run matx_bench and store the results")
+    p_run.add_argument("--build-dir", default="build", help="MatX build directory containing bench/matx_bench")
+    p_run.add_argument("--source-dir", default=str(Path(__file__).resolve().parents[2]),
+                       help="MatX source directory used to look up the commit")
+    p_run.add_argument("--results", default="bench_results", help="Directory to store results in")
+    p_run.add_argument("--commit", help="Name to store the results under instead of the current git commit")
+    p_run.add_argument("--benchmark", action="append", help="Only run this benchmark (may be repeated)")
+    p_run.add_argument("--baseline", help="Compare against this result file after running")
+    p_run.add_argument("nvbench_args", nargs=argparse.REMAINDER, help="Extra arguments passed to matx_bench after --")
+    add_compare_args(p_run)
+
+    p_cmp = sub.add_parser("compare", help="Compare two stored result files")
+    p_cmp.add_argument("baseline")
+    p_cmp.add_argument("current")
+    add_compare_args(p_cmp)
+
+    args = parser.parse_args()
+    if args.command == "run":
+        if args.nvbench_args and args.nvbench_args[0] == "--":
+            args.nvbench_args = args.nvbench_args[1:]
+        sys.exit(run(args))
+    sys.exit(compare_and_report(args.baseline, args.current, args))
+
+
+if __name__ == "__main__":
+    main()
@@ -159,6 +159,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
   auto output_tensor2 = make_tensor<dtype>({input_size});
   auto output_tensor3 = make_tensor<dtype>({input_size});
   auto output_tensor4 = make_tensor<dtype>({input_size});
+  auto output_fast = make_tensor<dtype>({input_size});
 
   (K_tensor = random<float>({input_size}, UNIFORM)).run();
   (S_tensor = random<float>({input_size}, UNIFORM)).run();
@@ -187,6 +188,23 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
   printf("Time without custom operator = %.2fms per iteration\n",
          time_ms / num_iterations);
 
+  // Same expression with the approximate exp/log/division intrinsics
+  auto VsqrtT = V_tensor * sqrt(T_tensor);
+  auto d1 = (log(S_tensor / K_tensor) + (r_tensor + 0.5f * V_tensor * V_tensor) * T_tensor) / VsqrtT;
+  auto d2 = d1 - VsqrtT;
+  auto bs_expr = S_tensor * normcdf(d1) - K_tensor * exp(-1.f * r_tensor * T_tensor) * normcdf(d2);
+
+  cudaEventRecord(start, stream);
+  for (uint32_t i = 0; i < num_iterations; i++) {
+    (output_fast = fast_math(bs_expr)).run(exec);
+  }
+  cudaEventRecord(stop, stream);
+  exec.sync();
+
+  cudaEventElapsedTime(&time_ms, start, stop);
+  printf("Time with fast_math() = %.2fms per iteration\n",
+         time_ms / num_iterations);
+
   cudaEventRecord(start, stream);
   // Time non-operator version
   for (uint32_t i = 0; i < num_iterations; i++) {
@@ -283,6 +301,12 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
     printf("Outputs do NOT match within %.1e tolerance!\n", tol);
   }
 
+  float fast_err = 0.f;
+  for (index_t i = 0; i < n; i++) {
+    fast_err = fmaxf(fast_err, fabsf(output_fast(i) - output_tensor(i)));
+  }
+  printf("fast_math() maximum absolute difference = %.2e\n", fast_err);
+
   cudaEventDestroy(start);
   cudaEventDestroy(stop);
   cudaStreamDestroy(stream);
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "matx.h"
+#include <cstdio>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace matx;
+
+/**
+ * Two-process pipeline sharing one device tensor through CUDA IPC
+ *
+ * The process forks before touching CUDA. The parent ("ingest") fills a tensor on the GPU, exports it, and
+ * sends the handle over a pipe. The child ("DSP") maps the same memory, waits on the shared event, and
+ * computes a reduction directly on the parent's buffer without any copy through host memory.
+ */
+
+constexpr index_t rows = 256;
+constexpr index_t cols = 4096;
+
+template <typename Obj>
+static bool write_all(int fd, const Obj &obj)
+{
+  return write(fd, &obj, sizeof(obj)) == static_cast<ssize_t>(sizeof(obj));
+}
+
+template <typename Obj>
+static bool read_all(int fd, Obj &obj)
+{
+  return read(fd, &obj, sizeof(obj)) == static_cast<ssize_t>(sizeof(obj));
+}
+
+static int consumer(int handle_fd, int done_fd)
+{
+  ipcTensorHandle<float, 2> handle;
+  if (!read_all(handle_fd, handle)) {
+    printf("consumer: failed to read handle\n");
+    return 1;
+  }
+
+  cudaExecutor exec{};
+  ipcTensorImport<float, 2> in{handle};
+  auto total = make_tensor<float>({});
+
+  // Zero-copy: the reduction reads the producer's allocation directly
+  in.Wait(exec);
+  (total = sum(in.Tensor())).run(exec);
+  exec.sync();
+
+  printf("consumer: sum of shared %lldx%lld tensor = %.1f (expected %.1f)\n",
+         static_cast<long long>(in.Tensor().Size(0)), static_cast<long long>(in.Tensor().Size(1)),
+         static_cast<double>(total()), static_cast<double>(rows * cols));
+
+  const char ok = 1;
+  return write_all(done_fd, ok) ? 0 : 1;
+}
+
+static int producer(int handle_fd, int done_fd)
+{
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  auto buf = make_tensor<float>({rows, cols}, MATX_DEVICE_MEMORY);
+  ipcTensorExport<float, 2> out{buf};
+
+  (buf = ones<float>({rows, cols})).run(exec);
+  out.Record(exec);
+  if (!write_all(handle_fd, out.Handle())) {
+    printf("producer: failed to send handle\n");
+    return 1;
+  }
+
+  // The buffer must stay allocated until the consumer is done with it
+  char ok = 0;
+  if (!read_all(done_fd, ok)) {
+    printf("producer: consumer did not finish\n");
+    return 1;
+  }
+
+  cudaStreamDestroy(stream);
+  return 0;
+}
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
+{
+  MATX_ENTER_HANDLER();
+
+  int handle_pipe[2];
+  int done_pipe[2];
+  if (pipe(handle_pipe) != 0 || pipe(done_pipe) != 0) {
+    printf("pipe failed\n");
+    return 1;
+  }
+
+  // Fork before any CUDA call so both processes create their own context
+  const pid_t pid = fork();
+  if (pid == 0) {
+    return consumer(handle_pipe[0], done_pipe[1]);
+  }
+
+  const int ret = producer(handle_pipe[1], done_pipe[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  return ret != 0 ? ret : WEXITSTATUS(status);
+
+  MATX_EXIT_HANDLER();
+}
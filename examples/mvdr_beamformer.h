@@ -66,13 +66,6 @@ public:
     make_tensor(cbfView, {num_beams, data_len});
     make_tensor(inVecView, {num_el, data_len});
 
-    make_tensor(ivsView, {num_el, snap_len});
-    make_tensor(ivshView, {snap_len, num_el});
-    make_tensor(covMatView, {num_el, num_el});
-    make_tensor(invCovMatView, {num_el, num_el});
-    make_tensor(abfBView, {num_el, num_beams});
-    make_tensor(abfAView, {num_beams, num_beams});
-    make_tensor(abfAInvView, {num_beams, num_beams});
     make_tensor(abfWeightsView, {num_el, num_beams});
   }
 
@@ -83,17 +76,11 @@ public:
    */
   void Prefetch(cudaStream_t stream)
   {
-    covMatView.PrefetchDevice(stream);
     vView.PrefetchDevice(stream);
     vhView.PrefetchDevice(stream);
     cbfView.PrefetchDevice(stream);
     inVecView.PrefetchDevice(stream);
-    ivsView.PrefetchDevice(stream);
-    ivshView.PrefetchDevice(stream);
-    invCovMatView.PrefetchDevice(stream);
-    abfBView.PrefetchDevice(stream);
-    abfAView.PrefetchDevice(stream);
-    abfAInvView.PrefetchDevice(stream);
+    abfWeightsView.PrefetchDevice(stream);
   }
 
   /**
@@ -103,29 +90,12 @@ public:
    */
   void Run(cudaExecutor exec)
   {
-    cudaStream_t stream = exec.getStream();
     (vhView = hermitianT(vView)).run(exec);
 
     (cbfView = matmul(vhView, inVecView)).run(exec);
 
-    matx::copy(ivsView, slice(inVecView, {0, 0}, {matxEnd, snap_len_}), stream);
-
-    (ivshView = hermitianT(ivsView)).run(exec);
-
-    (covMatView = matmul(ivsView, ivshView)).run(exec);
-
-    (covMatView = (covMatView * (1.0f / static_cast<float>(snap_len_))) +
-                   eye<complex>() * load_coeff_)
-        .run(exec);
-    inv_impl(invCovMatView, covMatView, stream);
-
-    // Find A and B to solve xA=B. Matlab uses A/B to solve for x, which is the
-    // same as x = BA^-1
-    (abfBView = matmul(invCovMatView, vView)).run(exec);
-    (abfAView = matmul(vhView, abfBView)).run(exec);
-
-    inv_impl(abfAInvView, abfAView, stream);
-    (abfWeightsView = matmul(abfBView, abfAInvView)).run(exec);
+    // The first snap_len samples are the training snapshots for the covariance
+    (abfWeightsView = mvdr(slice(inVecView, {0, 0}, {matxEnd, snap_len_}), vView, load_coeff_)).run(exec);
   }
 
   /**
@@ -150,37 +120,22 @@ public:
   auto GetV() { return vView; }
 
   /**
-   * @brief Get the covMatView object
+   * @brief Get the abfWeightsView object
    * 
    * @return tensor_t view 
    */
-  auto GetCovMatView() { return covMatView; }
-
-  /**
-   * @brief Get the invCovMatView object
-   * 
-   * @return tensor_t view 
-   */  
-  auto GetCovMatInvView() { return invCovMatView; }
+  auto GetWeights() { return abfWeightsView; }
 
 private:
   [[maybe_unused]] index_t num_beams_;
   [[maybe_unused]] index_t num_el_;
   [[maybe_unused]] index_t data_len_;
   index_t snap_len_;
-  cuda::std::complex<float> load_coeff_ = {0.1f, 0.f};
+  float load_coeff_ = 0.1f;
 
   tensor_t<complex, 2> vView;
   tensor_t<complex, 2> vhView;
   tensor_t<complex, 2> cbfView;
   tensor_t<complex, 2> inVecView;
-  tensor_t<complex, 2> ivsView;
-  tensor_t<complex, 2> ivshView;
-  tensor_t<complex, 2> covMatView;
-  tensor_t<complex, 2> invCovMatView;
   tensor_t<complex, 2> abfWeightsView;
-
-  tensor_t<complex, 2> abfAView;
-  tensor_t<complex, 2> abfBView;
-  tensor_t<complex, 2> abfAInvView;
 };
\ No newline at end of file
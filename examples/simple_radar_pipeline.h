@@ -284,19 +284,23 @@ public:
 
     auto x = inputView;
     // create waveform (assuming waveform is the same for every pulse)
-    // this allows us to precompute waveform in frequency domain
-    // Apply a Hamming window to the waveform to suppress sidelobes. Other
-    // windows could be used as well (e.g., Taylor windows). Ultimately, it is
-    // just an element-wise weighting by a pre-computed window function.
-    (waveformPart = waveformPart * hamming<0, waveformPart.Rank(), typename ComplexType::value_type>({waveformLength})).run(exec);
-
-    // compute L2 norm
-    (norms = sum(abs2(waveformPart))).run(exec);
-    (norms = sqrt(norms)).run(exec);
-
-    (waveformPart = waveformPart / norms).run(exec);
-    (waveformFull = fft(waveformPart, numSamplesRnd)).run(exec);
-    (waveformFull = conj(waveformFull)).run(exec);
+    // this allows us to precompute waveform in frequency domain once and
+    // reuse it for every CPI until the waveform is replaced.
+    if (!waveformReady) {
+      // Apply a Hamming window to the waveform to suppress sidelobes. Other
+      // windows could be used as well (e.g., Taylor windows). Ultimately, it is
+      // just an element-wise weighting by a pre-computed window function.
+      (waveformPart = waveformPart * hamming<0, waveformPart.Rank(), typename ComplexType::value_type>({waveformLength})).run(exec);
+
+      // compute L2 norm
+      (norms = sum(abs2(waveformPart))).run(exec);
+      (norms = sqrt(norms)).run(exec);
+
+      (waveformPart = waveformPart / norms).run(exec);
+      (waveformFull = fft(waveformPart, numSamplesRnd)).run(exec);
+      (waveformFull = conj(waveformFull)).run(exec);
+      waveformReady = true;
+    }
 
     (x = fft(x)).run(exec);
     (x = x * waveformT).run(exec);
@@ -436,6 +440,27 @@ public:
 #endif
   }
 
+  /**
+   * @brief Stage 4 - CFAR detector using the fused cfar() transform
+   *
+   * Produces the same detections as CFARDetections() with the same window (one
+   * guard cell and one/five training cells on each side in Doppler/range), but
+   * computes the power, background estimate and threshold test in a single
+   * kernel without materializing xPow, ba or normT.
+   */
+  void CFARDetectionsFused()
+  {
+    CFARParams params;
+    params.type = CFARType::CA;
+    params.guard_rows = 1;
+    params.guard_cols = 1;
+    params.train_rows = cfarMaskY / 2 - params.guard_rows;
+    params.train_cols = cfarMaskX / 2 - params.guard_cols;
+    params.pfa = pfa;
+
+    (dets = cfar(tpcView, params)).run(exec);
+  }
+
   /**
    * @brief Get the Input View object
    * 
@@ -448,7 +473,12 @@ public:
    * 
    * @return tensor_t view 
    */
-  auto GetwaveformView() { return waveformView; }
+  auto GetwaveformView() {
+    // The caller may write a new waveform, so its spectrum is rebuilt on the
+    // next call to PulseCompression()
+    waveformReady = false;
+    return waveformView;
+  }
 
   /**
    * @brief Get TPC view
@@ -483,6 +513,7 @@ private:
   index_t numSamples;
   index_t waveformLength;
   index_t numSamplesRnd;
+  bool waveformReady = false;
   index_t numPulsesRnd;
   index_t numCompressedSamples;
   index_t numChannels;
@@ -46,9 +46,8 @@ using namespace matx;
  * and time. Traditionally the signal power is plotted as the Z dimension using
  * color, and time/frequency are the X/Y axes. The time taken to run the
  * spectrogram is computed, and a simple scatter plot is output. This version
- * does uses CUDA graphs, and records the workload on the second iteration of
- * the intialization loop. The first iteration is used only for plan caching and
- * should not include any graph recording.
+ * uses CUDA graphs through cudaExecutor::capture(), which runs the workload once
+ * to populate the plan caches before recording it.
  */
 
 int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
@@ -56,8 +55,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
   MATX_ENTER_HANDLER();
 
   using complex = cuda::std::complex<float>;
-  cudaGraph_t graph;
-  cudaGraphExec_t instance;
+  cudaGraph graph;
 
   cudaStream_t stream;
   cudaStreamCreate(&stream);
@@ -99,52 +97,43 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv)
   // x = carrier + noise
   (x = carrier + noise).run(exec);
 
-  for (uint32_t i = 0; i < 2; i++) {
-    // Record graph on second loop to get rid of plan caching in the graph
-    if (i == 1) {
-      cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal);
-    }
+  // Capture the workload into a graph. The executor runs the workload once eagerly before capturing so
+  // that FFT plans are cached and no plan creation ends up inside the graph.
+  auto stackedMatrix = overlap(x, {nperseg}, {nstep});
+  // Get real part and transpose
+  [[maybe_unused]] auto Sxx = fftStackedMatrix.RealView().Permute({1, 0});
 
+  exec.capture(graph, [&]() {
     // DFT Sample Frequencies (rfftfreq)
     (freqs = (1.0f / (static_cast<float>(nfft) * 1.0f / fs)) *
                linspace(0.0f, static_cast<float>(nfft) / 2.0f, nfft / 2 + 1))
         .run(exec);
 
-    // Create overlapping matrix of segments.
-    auto stackedMatrix = overlap(x, {nperseg}, {nstep});
-    // FFT along rows
+    // FFT along rows of the overlapping segments
     (fftStackedMatrix = fft(stackedMatrix)).run(exec);
     // Absolute value
     (fftStackedMatrix = conj(fftStackedMatrix) * fftStackedMatrix)
         .run(exec);
-    // Get real part and transpose
-    [[maybe_unused]] auto Sxx = fftStackedMatrix.RealView().Permute({1, 0});
 
     // Spectral time axis
     (s_time = linspace(static_cast<float>(nperseg) / 2.0f,
                            static_cast<float>(N - nperseg) / 2.0f + 1.0f, (N - noverlap) / nstep) /
                 fs)
         .run(exec);
-
-    if (i == 1) {
-      cudaStreamEndCapture(stream, &graph);
-      cudaGraphInstantiate(&instance, graph, NULL, NULL, 0);
+  });
 
 #if MATX_ENABLE_VIZ
-      // Generate a spectrogram visualization using a contour plot
-      viz::contour(time, freqs, Sxx);
+  // Generate a spectrogram visualization using a contour plot
+  viz::contour(time, freqs, Sxx);
 #else
-      printf("Not outputting plot since visualizations disabled\n");
+  printf("Not outputting plot since visualizations disabled\n");
 #endif
-    }
-  }
-
 
   exec.sync();
   // Time graph execution of same kernels
   exec.start_timer();
   for (uint32_t i = 0; i < 10; i++) {
-    cudaGraphLaunch(instance, stream);
+    exec.launch(graph);
   }
   exec.stop_timer();
   exec.sync();
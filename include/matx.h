@@ -60,6 +60,15 @@
 #include "matx/generators/generators.h"
 #include "matx/operators/operators.h"
 #include "matx/transforms/transforms.h"
+#include "matx/file_io/ooc_tensor.h"
+#include "matx/core/sharded_tensor.h"
+#include "matx/executors/multi_gpu.h"
+#include "matx/core/rx_ring.h"
+#include "matx/core/ipc.h"
+#include "matx/core/compressed_tensor.h"
+#include "matx/transforms/pwelch_accumulator.h"
+#include "matx/transforms/sar_bp_accumulator.h"
+#include "matx/transforms/stft_stream.h"
 
 #include <cuda/std/complex>
 namespace matx {
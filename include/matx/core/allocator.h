@@ -31,11 +31,20 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 
+#include <array>
+#include <atomic>
 #include <cstdio>
-#include <shared_mutex>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 #ifndef __CUDA_CC__
 #include <driver_types.h>
 #include <cuda_runtime_api.h>
@@ -44,7 +53,10 @@
 #include "matx/core/error.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/log.h"
+#include "matx/core/oversubscribe.h"
+#include "matx/core/write_versions.h"
 #include <cuda/std/functional>
+#include <cuda/std/optional>
 #include <cuda/std/__algorithm/max.h>
 
 #pragma once
@@ -61,74 +73,579 @@ enum matxMemorySpace_t {
   MATX_HOST_MALLOC_MEMORY,  ///< Host-alloced memory (pageable) from malloc
   MATX_DEVICE_MEMORY,       ///< CUDA device memory from cudaMalloc
   MATX_ASYNC_DEVICE_MEMORY, ///< CUDA asynchronous device memory corresponding to a stream from cudaMallocAsync
+  MATX_HOST_NUMA_MEMORY,    ///< Host memory (pageable) whose pages are placed on the NUMA node of the thread that first writes them
+  MATX_SYSTEM_MEMORY,       ///< System-allocated memory from malloc accessed directly by the GPU on coherent systems such as Grace Hopper
   MATX_INVALID_MEMORY       ///< Sentinel value
 };
 
 namespace detail {
 struct matxMemoryStats_t {
-  size_t currentBytesAllocated;
-  size_t totalBytesAllocated;
-  size_t maxBytesAllocated;
-  matxMemoryStats_t()
-      : currentBytesAllocated(0), totalBytesAllocated(0), maxBytesAllocated(0)
-  {
-  }
+  std::atomic<size_t> currentBytesAllocated{0};
+  std::atomic<size_t> totalBytesAllocated{0};
+  std::atomic<size_t> maxBytesAllocated{0};
 };
 
 struct matxPointerAttr_t {
   size_t size;
   matxMemorySpace_t kind = MATX_INVALID_MEMORY;
   cudaStream_t stream;
+  bool pooled = false;
+  int device = 0;
+  bool scratch = false;
+  bool oversubscribed = false;
+};
+
+/**
+ * @brief Stream-ordered pool of asynchronous device allocations
+ *
+ * Allocations are rounded up to power-of-two size classes and freed blocks are kept on a
+ * free list keyed by device, stream, and size class. A block freed on a stream is only handed
+ * back out to an allocation on that same stream, so stream ordering guarantees the previous
+ * user of the block has finished without any host synchronization. Requests larger than the
+ * largest size class bypass the pool entirely.
+ *
+ * The pool is not thread-safe by itself; the owning MemTracker serializes access.
+ */
+class MemoryPool {
+  public:
+    static constexpr int MIN_BIN_SHIFT = 9;   // 512B smallest size class
+    static constexpr int MAX_BIN_SHIFT = 30;  // 1GB largest size class
+
+    static constexpr bool Poolable(size_t bytes) {
+      return bytes <= (size_t{1} << MAX_BIN_SHIFT);
+    }
+
+    static constexpr int BinIndex(size_t bytes) {
+      int shift = MIN_BIN_SHIFT;
+      while ((size_t{1} << shift) < bytes) {
+        shift++;
+      }
+      return shift - MIN_BIN_SHIFT;
+    }
+
+    static constexpr size_t BinBytes(int bin) {
+      return size_t{1} << (bin + MIN_BIN_SHIFT);
+    }
+
+    /**
+     * @brief Take a cached block for this device/stream/size class if one is available
+     *
+     * @return Cached pointer, or nullptr if the free list is empty
+     */
+    void *Get(size_t bytes, cudaStream_t stream, int device) {
+      auto it = free_lists_.find(Key{device, stream, BinIndex(bytes)});
+      if (it == free_lists_.end() || it->second.empty()) {
+        return nullptr;
+      }
+
+      void *ptr = it->second.back();
+      it->second.pop_back();
+      cached_bytes_ -= BinBytes(BinIndex(bytes));
+      return ptr;
+    }
+
+    /**
+     * @brief Return a block to the free list of the stream it was last used on
+     */
+    void Put(void *ptr, size_t bytes, cudaStream_t stream, int device) {
+      free_lists_[Key{device, stream, BinIndex(bytes)}].push_back(ptr);
+      cached_bytes_ += BinBytes(BinIndex(bytes));
+    }
+
+    /**
+     * @brief Release cached blocks back to CUDA
+     *
+     * @param stream Only release blocks cached on this stream. If nullopt, blocks on every stream
+     * are released with a synchronizing cudaFree, so streams that have since been destroyed are safe.
+     * @param device Only release blocks from this device, or every device if negative
+     * @return Number of bytes released
+     */
+    size_t Trim(const cuda::std::optional<cudaStream_t> &stream, int device) {
+      size_t released = 0;
+      int prev_device = 0;
+      cudaGetDevice(&prev_device);
+
+      for (auto it = free_lists_.begin(); it != free_lists_.end();) {
+        const auto &key = it->first;
+        if ((device >= 0 && key.device != device) || (stream.has_value() && key.stream != *stream)) {
+          ++it;
+          continue;
+        }
+
+        cudaSetDevice(key.device);
+        for (void *ptr : it->second) {
+          if (stream.has_value()) {
+            cudaFreeAsync(ptr, key.stream);
+          }
+          else {
+            cudaFree(ptr);
+          }
+          released += BinBytes(key.bin);
+        }
+
+        it = free_lists_.erase(it);
+      }
+
+      cudaSetDevice(prev_device);
+      cached_bytes_ -= released;
+      return released;
+    }
+
+    size_t CachedBytes() const { return cached_bytes_; }
+
+  private:
+    struct Key {
+      int device;
+      cudaStream_t stream;
+      int bin;
+
+      bool operator==(const Key &other) const {
+        return device == other.device && stream == other.stream && bin == other.bin;
+      }
+    };
+
+    struct KeyHash {
+      size_t operator()(const Key &key) const {
+        size_t h = std::hash<void*>{}(reinterpret_cast<void*>(key.stream));
+        h ^= std::hash<int>{}(key.device) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        h ^= std::hash<int>{}(key.bin) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+      }
+    };
+
+    std::unordered_map<Key, std::vector<void*>, KeyHash> free_lists_;
+    size_t cached_bytes_ = 0;
 };
+
+/**
+ * @brief Per-stream bump arena for transform temporaries
+ *
+ * Each device/stream pair owns a list of chunks carved out with a bump pointer. Frees only decrement a
+ * live count; once every allocation from a stream's arena has been freed the bump pointer rewinds to the
+ * start. As with the pool, all users of the memory are ordered on the same stream, so rewinding needs no
+ * host synchronization. If an iteration needed more than one chunk, the chunks are replaced by a single
+ * chunk covering the peak usage when the arena rewinds, so steady-state iterations make no calls into CUDA.
+ *
+ * The arena is not thread-safe by itself; the owning MemTracker serializes access.
+ */
+class ScratchArena {
+  public:
+    static constexpr size_t ALIGNMENT = 256;
+    static constexpr size_t MIN_CHUNK_BYTES = size_t{1} << 21;
+
+    /**
+     * @brief Carve an allocation out of the stream's current chunk, adding a chunk if it doesn't fit
+     */
+    void *Get(size_t bytes, cudaStream_t stream, int device, bool &grew) {
+      auto &arena = arenas_[Key{device, stream}];
+      grew = false;
+      const size_t aligned = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+      if (arena.chunks.empty() || arena.offset + aligned > arena.chunks.back().second) {
+        size_t chunk_bytes = cuda::std::max(aligned, MIN_CHUNK_BYTES);
+        if (!arena.chunks.empty()) {
+          chunk_bytes = cuda::std::max(chunk_bytes, 2 * arena.chunks.back().second);
+        }
+
+        void *chunk = nullptr;
+        if (cudaMallocAsync(&chunk, chunk_bytes, stream) != cudaSuccess) {
+          cudaGetLastError();
+          return nullptr;
+        }
+
+        MATX_LOG_DEBUG("Scratch arena grow: chunk={}, {} bytes, stream={}", chunk, chunk_bytes, reinterpret_cast<void*>(stream));
+        arena.chunks.emplace_back(chunk, chunk_bytes);
+        reserved_bytes_ += chunk_bytes;
+        arena.offset = 0;
+        grew = true;
+      }
+
+      void *ptr = static_cast<uint8_t *>(arena.chunks.back().first) + arena.offset;
+      arena.offset += aligned;
+      arena.used += aligned;
+      arena.peak = cuda::std::max(arena.peak, arena.used);
+      arena.live++;
+      return ptr;
+    }
+
+    /**
+     * @brief Release an allocation, rewinding the arena once nothing from it is live
+     */
+    void Put(cudaStream_t stream, int device) {
+      auto it = arenas_.find(Key{device, stream});
+      if (it == arenas_.end() || --it->second.live > 0) {
+        return;
+      }
+
+      auto &arena = it->second;
+      if (arena.chunks.size() > 1) {
+        // Coalesce into one chunk sized for the peak so the next iteration fits without growing
+        int prev_device = 0;
+        cudaGetDevice(&prev_device);
+        cudaSetDevice(device);
+        for (const auto &chunk : arena.chunks) {
+          cudaFreeAsync(chunk.first, stream);
+          reserved_bytes_ -= chunk.second;
+        }
+        arena.chunks.clear();
+
+        void *chunk = nullptr;
+        if (cudaMallocAsync(&chunk, arena.peak, stream) == cudaSuccess) {
+          arena.chunks.emplace_back(chunk, arena.peak);
+          reserved_bytes_ += arena.peak;
+        }
+        else {
+          cudaGetLastError();
+        }
+        cudaSetDevice(prev_device);
+      }
+
+      arena.offset = 0;
+      arena.used = 0;
+    }
+
+    /**
+     * @brief Release the chunks of arenas with no live allocations back to CUDA
+     *
+     * @param stream Only release this stream's arena. If nullopt, every idle arena is released with a
+     * synchronizing cudaFree.
+     * @param device Only release arenas on this device, or every device if negative
+     * @return Number of bytes released
+     */
+    size_t Trim(const cuda::std::optional<cudaStream_t> &stream, int device) {
+      size_t released = 0;
+      int prev_device = 0;
+      cudaGetDevice(&prev_device);
+
+      for (auto it = arenas_.begin(); it != arenas_.end();) {
+        const auto &key = it->first;
+        if ((device >= 0 && key.device != device) || (stream.has_value() && key.stream != *stream) ||
+            it->second.live > 0) {
+          ++it;
+          continue;
+        }
+
+        cudaSetDevice(key.device);
+        for (const auto &chunk : it->second.chunks) {
+          if (stream.has_value()) {
+            cudaFreeAsync(chunk.first, key.stream);
+          }
+          else {
+            cudaFree(chunk.first);
+          }
+          released += chunk.second;
+        }
+
+        it = arenas_.erase(it);
+      }
+
+      cudaSetDevice(prev_device);
+      reserved_bytes_ -= released;
+      return released;
+    }
+
+    size_t ReservedBytes() const { return reserved_bytes_; }
+
+  private:
+    struct Key {
+      int device;
+      cudaStream_t stream;
+
+      bool operator==(const Key &other) const {
+        return device == other.device && stream == other.stream;
+      }
+    };
+
+    struct KeyHash {
+      size_t operator()(const Key &key) const {
+        size_t h = std::hash<void*>{}(reinterpret_cast<void*>(key.stream));
+        h ^= std::hash<int>{}(key.device) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+      }
+    };
+
+    struct Arena {
+      std::vector<std::pair<void*, size_t>> chunks;
+      size_t offset = 0;
+      size_t used = 0;
+      size_t peak = 0;
+      size_t live = 0;
+    };
+
+    std::unordered_map<Key, Arena, KeyHash> arenas_;
+    size_t reserved_bytes_ = 0;
+};
+
+/**
+ * @brief Stream whose MATX_ASYNC_DEVICE_MEMORY allocations on the current thread are served by the scratch arena
+ */
+struct ScratchState {
+  bool active = false;
+  cudaStream_t stream = 0;
+};
+
+inline thread_local ScratchState scratch_state;
+
+/**
+ * @brief Route asynchronous device allocations on a stream to the scratch arena for the lifetime of the scope
+ *
+ * Transforms wrap the creation of temporaries that are freed before they return. Only the allocation needs to
+ * be inside the scope; the free is routed back to the arena wherever it happens. Memory that outlives the call
+ * (caches, outputs) must not be allocated inside the scope, since a single live allocation keeps the whole
+ * arena from rewinding. Constructing the scope with active=false suspends an enclosing scope.
+ */
+class ScratchScope {
+  public:
+    explicit ScratchScope(cudaStream_t stream, bool active = true) : prev_(scratch_state) {
+      scratch_state = ScratchState{active, stream};
+    }
+
+    ~ScratchScope() { scratch_state = prev_; }
+
+    ScratchScope(const ScratchScope &) = delete;
+    ScratchScope &operator=(const ScratchScope &) = delete;
+
+  private:
+    ScratchState prev_;
+};
+
+__MATX_INLINE__ bool ScratchArenaEnabledFromEnv() {
+  const char *env = std::getenv("MATX_SCRATCH_ARENA");
+  return env != nullptr && std::strcmp(env, "0") != 0;
+}
+
+__MATX_INLINE__ bool MemoryPoolEnabledFromEnv() {
+  const char *env = std::getenv("MATX_MEMORY_POOL");
+  return env != nullptr && std::strcmp(env, "0") != 0;
+}
 }
 
 
 inline detail::matxMemoryStats_t matxMemoryStats; ///< Statistics object
-inline std::shared_mutex memory_mtx; ///< Mutex protecting updates from map
 
+/**
+ * @brief What an AllocationTrace does when an allocation reaches the underlying CUDA or host allocator
+ */
+enum class AllocationTraceMode {
+  RECORD, ///< Only record the allocation
+  WARN,   ///< Record the allocation and log a warning
+  THROW,  ///< Record the allocation, free it, and throw
+};
+
+/**
+ * @brief One allocation made through matxAlloc while an AllocationTrace was active
+ */
+struct AllocationRecord {
+  size_t bytes;
+  matxMemorySpace_t space;
+  cudaStream_t stream;
+  bool cached;         ///< Served by the memory pool or scratch arena without calling the underlying allocator
+  std::string context; ///< Innermost user or API level NVTX range when allocated; empty if none was open
+};
+
+class AllocationTrace;
+
+namespace detail {
+inline thread_local AllocationTrace *active_allocation_trace = nullptr;
+}
+
+/**
+ * @brief Record every allocation made through matxAlloc on this thread while in scope
+ *
+ * Intended for proving that a steady-state loop doesn't allocate: run the loop until caches, pools, and
+ * arenas are warm, then wrap later iterations in a trace. Allocations served by the memory pool or scratch
+ * arena are recorded as cached; any other allocation calls into CUDA or malloc and is handled according to
+ * the trace mode. Each record carries the name of the innermost user or API level NVTX range, so NVTX must
+ * be enabled with MATX_NVTX_FLAGS for the operator names to be filled in. Traces nest, and an allocation
+ * is recorded by every enclosing trace. Allocations made internally by CUDA libraries without matxAlloc are
+ * not seen.
+ */
+class AllocationTrace {
+  public:
+    explicit AllocationTrace(AllocationTraceMode mode = AllocationTraceMode::RECORD)
+        : mode_(mode), prev_(detail::active_allocation_trace) {
+      detail::active_allocation_trace = this;
+    }
+
+    ~AllocationTrace() { detail::active_allocation_trace = prev_; }
+
+    AllocationTrace(const AllocationTrace &) = delete;
+    AllocationTrace &operator=(const AllocationTrace &) = delete;
+
+    /**
+     * @brief Allocations recorded so far, in order
+     */
+    const std::vector<AllocationRecord> &Records() const { return records_; }
+
+    /**
+     * @brief Number of recorded allocations that called the underlying allocator
+     */
+    size_t UncachedCount() const {
+      size_t count = 0;
+      for (const auto &rec : records_) {
+        count += rec.cached ? 0 : 1;
+      }
+      return count;
+    }
+
+    /**
+     * @brief Drop the records, such as between loop iterations
+     */
+    void Clear() { records_.clear(); }
+
+    /**
+     * @brief Print the recorded allocations to stdout
+     */
+    void Print() const {
+      printf("Allocation trace: %zu allocations, %zu uncached\n", records_.size(), UncachedCount());
+      for (const auto &rec : records_) {
+        printf("  %zu bytes, space=%d, stream=%p, %s, context=%s\n", rec.bytes, static_cast<int>(rec.space),
+               reinterpret_cast<void*>(rec.stream), rec.cached ? "cached" : "uncached",
+               rec.context.empty() ? "<none>" : rec.context.c_str());
+      }
+    }
+
+    /**
+     * @brief Record an allocation in this trace and every enclosing one
+     *
+     * @return True if any of the traces requires the allocation to fail
+     */
+    bool Record(const AllocationRecord &rec) {
+      records_.push_back(rec);
+      bool fail = false;
+      if (!rec.cached) {
+        if (mode_ == AllocationTraceMode::WARN) {
+          MATX_LOG_WARN("Traced allocation of {} bytes reached the allocator in {}", rec.bytes,
+                        rec.context.empty() ? "<none>" : rec.context);
+        }
+        fail = mode_ == AllocationTraceMode::THROW;
+      }
+
+      if (prev_ != nullptr) {
+        fail = prev_->Record(rec) || fail;
+      }
+      return fail;
+    }
+
+  private:
+    AllocationTraceMode mode_;
+    AllocationTrace *prev_;
+    std::vector<AllocationRecord> records_;
+};
+
+/**
+ * @brief Tracker for every allocation made through matxAlloc
+ *
+ * Live pointers are spread over NUM_SHARDS independently-locked maps keyed by pointer address so
+ * host threads allocating and freeing concurrently rarely contend on the same lock. Memory statistics
+ * are updated with atomics and remain exact. The underlying CUDA allocation and free calls are made
+ * outside of any shard lock.
+ */
 struct MemTracker {
-  std::unordered_map<void *, detail::matxPointerAttr_t> allocationMap;
+  static constexpr int NUM_SHARDS = 64;
+
+  struct alignas(64) Shard {
+    std::mutex mtx;
+    std::unordered_map<void *, detail::matxPointerAttr_t> allocationMap;
+  };
+
+  std::array<Shard, NUM_SHARDS> shards;
+  std::mutex pool_mtx; ///< Protects pool
+  detail::MemoryPool pool;
+  std::atomic<bool> pool_enabled{detail::MemoryPoolEnabledFromEnv()};
+  std::mutex arena_mtx; ///< Protects arena
+  detail::ScratchArena arena;
+  std::atomic<bool> arena_enabled{detail::ScratchArenaEnabledFromEnv()};
+  detail::OversubscribedHeap oversubscribed; ///< Backs MATX_DEVICE_MEMORY while oversubscription is enabled
+  std::atomic<bool> oversubscribe_enabled{detail::OversubscriptionEnabledFromEnv()};
+
+  Shard &get_shard(void *ptr) {
+    // Low bits carry little information since allocations are aligned
+    auto addr = reinterpret_cast<uintptr_t>(ptr);
+    addr = (addr >> 8) ^ (addr >> 20);
+    return shards[addr % NUM_SHARDS];
+  }
 
-  auto size() {
-    return allocationMap.size();
+  size_t size() {
+    size_t total = 0;
+    for (auto &shard : shards) {
+      [[maybe_unused]] std::lock_guard lck(shard.mtx);
+      total += shard.allocationMap.size();
+    }
+    return total;
   }
 
   void update_stream(void *ptr, cudaStream_t stream) {
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    auto iter = allocationMap.find(ptr);
-    if (iter == allocationMap.end()) {
+    auto &shard = get_shard(ptr);
+    [[maybe_unused]] std::lock_guard lck(shard.mtx);
+    auto iter = shard.allocationMap.find(ptr);
+    if (iter == shard.allocationMap.end()) {
       MATX_THROW(matxInvalidParameter, "Couldn't find pointer in allocation cache");
     }
 
     iter->second.stream = stream;
   }
 
-  // deallocate_internal assumes that the caller has already acquired the memory_mtx mutex.
+  static void record_allocation(size_t bytes) {
+    const size_t current = matxMemoryStats.currentBytesAllocated.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    matxMemoryStats.totalBytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+    size_t prev_max = matxMemoryStats.maxBytesAllocated.load(std::memory_order_relaxed);
+    while (prev_max < current &&
+           !matxMemoryStats.maxBytesAllocated.compare_exchange_weak(prev_max, current, std::memory_order_relaxed)) {
+    }
+  }
+
+  void insert(void *ptr, const detail::matxPointerAttr_t &attr) {
+    record_allocation(attr.size);
+    auto &shard = get_shard(ptr);
+    [[maybe_unused]] std::lock_guard lck(shard.mtx);
+    shard.allocationMap[ptr] = attr;
+  }
+
+  // release frees memory that has already been removed from its shard. No locks are held by the caller.
   template <typename StreamType>
-  auto deallocate_internal(void *ptr, [[maybe_unused]] StreamType st) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  void release(void *ptr, const detail::matxPointerAttr_t &attr, [[maybe_unused]] StreamType st) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
-    auto iter = allocationMap.find(ptr);
+    size_t bytes = attr.size;
+    const size_t remaining = matxMemoryStats.currentBytesAllocated.fetch_sub(bytes, std::memory_order_relaxed) - bytes;
 
-    if (iter == allocationMap.end()) {
-  #ifdef MATX_DISABLE_MEM_TRACK_CHECK
-      // This error can occur in situations where the user includes MatX in multiple translation units
-      // and a deallocation occurs in a different one than it was allocated. Allow the user to ignore
-      // these cases if they know the issue.
-      MATX_THROW(matxInvalidParameter, "Couldn't find pointer in allocation cache");
-  #else
-      return;      
-  #endif    
+    MATX_LOG_DEBUG("Deallocating memory: ptr={}, {} bytes, space={}, remaining={} bytes", 
+                   ptr, bytes, static_cast<int>(attr.kind), remaining);
+
+    if (attr.oversubscribed) {
+      oversubscribed.Free(ptr);
+      return;
     }
 
-    size_t bytes = iter->second.size;
+    if (attr.scratch) {
+      // Scratch memory is only reused on the stream it was allocated on, so the free stream is ignored
+      [[maybe_unused]] std::lock_guard lck(arena_mtx);
+      arena.Put(attr.stream, attr.device);
+      return;
+    }
 
-    MATX_LOG_DEBUG("Deallocating memory: ptr={}, {} bytes, space={}, remaining={} bytes", 
-                   ptr, bytes, static_cast<int>(iter->second.kind), matxMemoryStats.currentBytesAllocated - bytes);
+    if (attr.pooled) {
+      // Stream-ordered return to the pool. The block can be reused by the next allocation on the
+      // same stream since any pending work using it will complete first.
+      cudaStream_t free_stream = attr.stream;
+      if constexpr (!std::is_same_v<no_stream_t, StreamType>) {
+        free_stream = st.stream;
+      }
+      cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+      cudaStreamIsCapturing(free_stream, &capture_status);
+      if (capture_status != cudaStreamCaptureStatusNone) {
+        // A captured graph may still reference this block on every replay, so it can never be reused
+        MATX_LOG_WARN("Pooled pointer {} freed during graph capture; block is retained by the graph", ptr);
+        return;
+      }
 
-    matxMemoryStats.currentBytesAllocated -= bytes;
+      [[maybe_unused]] std::lock_guard lck(pool_mtx);
+      pool.Put(ptr, bytes, free_stream, attr.device);
+      return;
+    }
 
-    switch (iter->second.kind) {
+    switch (attr.kind) {
     case MATX_MANAGED_MEMORY:
       [[fallthrough]];
     case MATX_DEVICE_MEMORY:
@@ -138,11 +655,20 @@ struct MemTracker {
       cudaFreeHost(ptr);
       break;
     case MATX_HOST_MALLOC_MEMORY:
+      [[fallthrough]];
+    case MATX_SYSTEM_MEMORY:
       free(ptr);
       break;
+    case MATX_HOST_NUMA_MEMORY:
+#if defined(__linux__)
+      munmap(ptr, attr.size);
+#else
+      free(ptr);
+#endif
+      break;
     case MATX_ASYNC_DEVICE_MEMORY:
       if constexpr (std::is_same_v<no_stream_t, StreamType>) {
-        cudaFreeAsync(ptr, iter->second.stream);
+        cudaFreeAsync(ptr, attr.stream);
       }
       else {
         cudaFreeAsync(ptr, st.stream);
@@ -151,29 +677,103 @@ struct MemTracker {
     default:
       MATX_THROW(matxInvalidType, "Invalid memory type");
     }
+  }
+
+  template <typename StreamType>
+  void deallocate_internal(void *ptr, StreamType st) {
+    detail::matxPointerAttr_t attr;
+    {
+      auto &shard = get_shard(ptr);
+      [[maybe_unused]] std::lock_guard lck(shard.mtx);
+      auto iter = shard.allocationMap.find(ptr);
+
+      if (iter == shard.allocationMap.end()) {
+    #ifdef MATX_DISABLE_MEM_TRACK_CHECK
+        // This error can occur in situations where the user includes MatX in multiple translation units
+        // and a deallocation occurs in a different one than it was allocated. Allow the user to ignore
+        // these cases if they know the issue.
+        MATX_THROW(matxInvalidParameter, "Couldn't find pointer in allocation cache");
+    #else
+        return;      
+    #endif    
+      }
+
+      attr = iter->second;
+      shard.allocationMap.erase(iter);
+    }
 
-    allocationMap.erase(ptr);    
+    release(ptr, attr, st);
   }
 
   struct no_stream_t{};
   struct valid_stream_t { cudaStream_t stream; };
 
   auto deallocate(void *ptr) {
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
     deallocate_internal(ptr, no_stream_t{});
   }
 
   auto deallocate(void *ptr, cudaStream_t stream) {
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
     deallocate_internal(ptr, valid_stream_t{stream});
   }    
 
   void allocate(void **ptr, size_t bytes,
                       matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                       cudaStream_t stream = 0) {
+    allocate_impl(ptr, bytes, space, stream, pool_enabled.load(std::memory_order_relaxed));
+  }
+
+  void allocate_pooled(void **ptr, size_t bytes, cudaStream_t stream) {
+    allocate_impl(ptr, bytes, MATX_ASYNC_DEVICE_MEMORY, stream, true);
+  }
+
+  void set_pool_enabled(bool enable) {
+    pool_enabled.store(enable, std::memory_order_relaxed);
+  }
+
+  bool get_pool_enabled() const {
+    return pool_enabled.load(std::memory_order_relaxed);
+  }
+
+  size_t trim_pool(const cuda::std::optional<cudaStream_t> &stream, int device) {
+    [[maybe_unused]] std::lock_guard lck(pool_mtx);
+    return pool.Trim(stream, device);
+  }
+
+  size_t pool_cached_bytes() {
+    [[maybe_unused]] std::lock_guard lck(pool_mtx);
+    return pool.CachedBytes();
+  }
+
+  void set_arena_enabled(bool enable) {
+    arena_enabled.store(enable, std::memory_order_relaxed);
+  }
+
+  bool get_arena_enabled() const {
+    return arena_enabled.load(std::memory_order_relaxed);
+  }
+
+  size_t trim_arena(const cuda::std::optional<cudaStream_t> &stream, int device) {
+    [[maybe_unused]] std::lock_guard lck(arena_mtx);
+    return arena.Trim(stream, device);
+  }
+
+  size_t arena_reserved_bytes() {
+    [[maybe_unused]] std::lock_guard lck(arena_mtx);
+    return arena.ReservedBytes();
+  }
+
+  void set_oversubscribe_enabled(bool enable) {
+    oversubscribe_enabled.store(enable, std::memory_order_relaxed);
+  }
+
+  bool get_oversubscribe_enabled() const {
+    return oversubscribe_enabled.load(std::memory_order_relaxed);
+  }
+
+  void allocate_impl(void **ptr, size_t bytes, matxMemorySpace_t space, cudaStream_t stream, bool use_pool) {
     [[maybe_unused]] cudaError_t err = cudaSuccess;
     
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (ptr == nullptr) {
       MATX_THROW(matxInvalidParameter, "nullptr on allocate");
@@ -181,6 +781,42 @@ struct MemTracker {
 
     *ptr = nullptr;
 
+    if (space == MATX_ASYNC_DEVICE_MEMORY && detail::scratch_state.active && detail::scratch_state.stream == stream &&
+        arena_enabled.load(std::memory_order_relaxed)) {
+      // Captured graphs keep using their addresses on every replay, so captured allocations skip the arena
+      cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+      cudaStreamIsCapturing(stream, &capture_status);
+      bool grew = false;
+      if (capture_status == cudaStreamCaptureStatusNone && allocate_from_arena(ptr, bytes, stream, grew)) {
+        trace(*ptr, bytes, space, stream, !grew);
+        return;
+      }
+    }
+
+    if (use_pool && space == MATX_ASYNC_DEVICE_MEMORY && detail::MemoryPool::Poolable(bytes)) {
+      // Allocations made while a graph is being captured become graph-owned memory nodes and are
+      // only valid while the graph runs, so they must never be handed out again by the pool.
+      cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+      cudaStreamIsCapturing(stream, &capture_status);
+      if (capture_status == cudaStreamCaptureStatusNone) {
+        const bool hit = allocate_from_pool(ptr, bytes, stream);
+        trace(*ptr, bytes, space, stream, hit);
+        return;
+      }
+    }
+
+    // System memory is only usable from the device when it can access pageable memory directly
+    // (NVLink-C2C or HMM). Everywhere else managed memory gives the same programming model.
+    int system_device = -1;
+    if (space == MATX_SYSTEM_MEMORY) {
+      MATX_CUDA_CHECK(cudaGetDevice(&system_device));
+      int pageableMemoryAccess = 0;
+      MATX_CUDA_CHECK(cudaDeviceGetAttribute(&pageableMemoryAccess, cudaDevAttrPageableMemoryAccess, system_device));
+      if (pageableMemoryAccess == 0) {
+        space = MATX_MANAGED_MEMORY;
+      }
+    }
+
     // If requesting managed memory, check if the device supports concurrent managed access.
     // If not, fall back to pinned host memory. Jetsons are one system type where this is needed.
     if (space == MATX_MANAGED_MEMORY) {
@@ -195,6 +831,7 @@ struct MemTracker {
     
     MATX_LOG_DEBUG("Allocating memory: {} bytes, space={}, stream={}", bytes, static_cast<int>(space), reinterpret_cast<void*>(stream));
     
+    bool oversubscribed_alloc = false;
     switch (space) {
     case MATX_MANAGED_MEMORY:
       err = cudaMallocManaged(ptr, bytes);
@@ -205,7 +842,39 @@ struct MemTracker {
     case MATX_HOST_MALLOC_MEMORY:
       *ptr = malloc(bytes);
       break;
+    case MATX_SYSTEM_MEMORY:
+      *ptr = malloc(bytes);
+      if (*ptr != nullptr) {
+        // Map the pages for the device up front. Pages still start wherever they are first touched and
+        // are migrated by the hardware access counters rather than on every fault.
+#if CUDART_VERSION <= 12000
+        cudaMemAdvise(*ptr, bytes, cudaMemAdviseSetAccessedBy, system_device);
+#else
+        cudaMemLocation loc;
+        loc.id = system_device;
+        loc.type = cudaMemLocationTypeDevice;
+        cudaMemAdvise(*ptr, bytes, cudaMemAdviseSetAccessedBy, loc);
+#endif
+      }
+      break;
+    case MATX_HOST_NUMA_MEMORY:
+#if defined(__linux__)
+      // A fresh anonymous mapping is never touched by the allocator, unlike malloc which may hand out
+      // recycled or header-initialized pages, so placement is decided by the first write
+      *ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (*ptr == MAP_FAILED) {
+        *ptr = nullptr;
+      }
+#else
+      *ptr = malloc(bytes);
+#endif
+      break;
     case MATX_DEVICE_MEMORY:
+      if (get_oversubscribe_enabled()) {
+        oversubscribed.Allocate(ptr, bytes);
+        oversubscribed_alloc = true;
+        break;
+      }
       err = cudaMalloc(ptr, bytes);
       break;
     case MATX_ASYNC_DEVICE_MEMORY:
@@ -215,6 +884,12 @@ struct MemTracker {
       MATX_THROW(matxInvalidType, "Invalid memory kind when allocating!");
     };
 
+    // Other device allocations that run out of memory make room by evicting oversubscribed blocks and try again
+    while (err == cudaErrorMemoryAllocation && get_oversubscribe_enabled() && oversubscribed.EvictBytes(bytes)) {
+      cudaGetLastError();
+      err = space == MATX_DEVICE_MEMORY ? cudaMalloc(ptr, bytes) : cudaMallocAsync(ptr, bytes, stream);
+    }
+
     MATX_ASSERT_STR_EXP(err, cudaSuccess, matxOutOfMemory, 
       "Failed to allocate memory. May be an asynchronous error from another CUDA call");
 
@@ -224,12 +899,77 @@ struct MemTracker {
 
     MATX_LOG_DEBUG("Allocated memory: ptr={}, {} bytes, total_current={} bytes", *ptr, bytes, matxMemoryStats.currentBytesAllocated + bytes);
 
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    matxMemoryStats.currentBytesAllocated += bytes;
-    matxMemoryStats.totalBytesAllocated += bytes;
-    matxMemoryStats.maxBytesAllocated = cuda::std::max(
-        matxMemoryStats.maxBytesAllocated, matxMemoryStats.currentBytesAllocated);
-    allocationMap[*ptr] = {bytes, space, stream};
+    detail::matxPointerAttr_t attr{bytes, space, stream};
+    attr.oversubscribed = oversubscribed_alloc;
+    insert(*ptr, attr);
+    trace(*ptr, bytes, space, stream, false);
+  }
+
+  void trace(void *ptr, size_t bytes, matxMemorySpace_t space, cudaStream_t stream, bool cached) {
+    if (detail::active_allocation_trace == nullptr) {
+      return;
+    }
+
+    const char *context = nvtxCurrentRangeName;
+    if (detail::active_allocation_trace->Record({bytes, space, stream, cached, context == nullptr ? "" : context})) {
+      deallocate(ptr);
+      MATX_THROW(matxAssertError, "Allocation of " + std::to_string(bytes) + " bytes reached the allocator inside a THROW allocation trace" +
+                 (context == nullptr ? std::string{} : std::string{" in "} + context));
+    }
+  }
+
+  bool allocate_from_pool(void **ptr, size_t bytes, cudaStream_t stream) {
+    int device = 0;
+    bool hit = true;
+    MATX_CUDA_CHECK(cudaGetDevice(&device));
+
+    {
+      [[maybe_unused]] std::lock_guard lck(pool_mtx);
+      *ptr = pool.Get(bytes, stream, device);
+      if (*ptr == nullptr) {
+        const size_t bin_bytes = detail::MemoryPool::BinBytes(detail::MemoryPool::BinIndex(bytes));
+        [[maybe_unused]] cudaError_t err = cudaMallocAsync(ptr, bin_bytes, stream);
+        if (err != cudaSuccess) {
+          // Give back anything cached on this device and try once more before failing
+          cudaGetLastError();
+          MATX_LOG_DEBUG("Pool allocation of {} bytes failed; trimming pool on device {}", bin_bytes, device);
+          pool.Trim(cuda::std::nullopt, device);
+          err = cudaMallocAsync(ptr, bin_bytes, stream);
+        }
+
+        MATX_ASSERT_STR_EXP(err, cudaSuccess, matxOutOfMemory,
+          "Failed to allocate pooled memory. May be an asynchronous error from another CUDA call");
+        if (*ptr == nullptr) {
+          MATX_THROW(matxOutOfMemory, "Failed to allocate pooled memory");
+        }
+        MATX_LOG_DEBUG("Pool MISS: ptr={}, {} bytes (class {} bytes), stream={}", *ptr, bytes, bin_bytes, reinterpret_cast<void*>(stream));
+        hit = false;
+      }
+      else {
+        MATX_LOG_DEBUG("Pool HIT: ptr={}, {} bytes, stream={}", *ptr, bytes, reinterpret_cast<void*>(stream));
+      }
+    }
+
+    insert(*ptr, {bytes, MATX_ASYNC_DEVICE_MEMORY, stream, true, device});
+    return hit;
+  }
+
+  bool allocate_from_arena(void **ptr, size_t bytes, cudaStream_t stream, bool &grew) {
+    int device = 0;
+    MATX_CUDA_CHECK(cudaGetDevice(&device));
+
+    {
+      [[maybe_unused]] std::lock_guard lck(arena_mtx);
+      *ptr = arena.Get(bytes, stream, device, grew);
+    }
+
+    if (*ptr == nullptr) {
+      MATX_LOG_DEBUG("Scratch arena could not grow by {} bytes; using a regular allocation", bytes);
+      return false;
+    }
+
+    insert(*ptr, {bytes, MATX_ASYNC_DEVICE_MEMORY, stream, false, device, true});
+    return true;
   }
 
   bool is_allocated(void *ptr) {
@@ -237,10 +977,9 @@ struct MemTracker {
       return false;
     }
 
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    auto iter = allocationMap.find(ptr);
-
-    return iter != allocationMap.end();    
+    auto &shard = get_shard(ptr);
+    [[maybe_unused]] std::lock_guard lck(shard.mtx);
+    return shard.allocationMap.find(ptr) != shard.allocationMap.end();
   }
 
   matxMemorySpace_t get_pointer_kind(void *ptr) {
@@ -248,10 +987,11 @@ struct MemTracker {
       return MATX_INVALID_MEMORY;
     }
 
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    auto iter = allocationMap.find(ptr);
+    auto &shard = get_shard(ptr);
+    [[maybe_unused]] std::lock_guard lck(shard.mtx);
+    auto iter = shard.allocationMap.find(ptr);
 
-    if (iter != allocationMap.end()) {
+    if (iter != shard.allocationMap.end()) {
       return iter->second.kind;
     }
 
@@ -259,17 +999,25 @@ struct MemTracker {
   }
 
   void free_all() {
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    while (! allocationMap.empty()) {
-      auto it = allocationMap.begin();
-      const auto ptr = it->first;
-      deallocate_internal(ptr, no_stream_t{});
-      if (allocationMap.find(ptr) != allocationMap.end()) {
-        // deallocate_internal may have erased the pointer from the map
-        // If not, erase it here to avoid an infinite loop.
-        allocationMap.erase(ptr);
+    for (auto &shard : shards) {
+      std::unordered_map<void *, detail::matxPointerAttr_t> entries;
+      {
+        [[maybe_unused]] std::lock_guard lck(shard.mtx);
+        entries.swap(shard.allocationMap);
+      }
+
+      for (const auto &[ptr, attr] : entries) {
+        release(ptr, attr, no_stream_t{});
       }
     }
+
+    {
+      [[maybe_unused]] std::lock_guard lck(pool_mtx);
+      pool.Trim(cuda::std::nullopt, -1);
+    }
+
+    [[maybe_unused]] std::lock_guard lck(arena_mtx);
+    arena.Trim(cuda::std::nullopt, -1);
   }
 
   ~MemTracker() {
@@ -308,7 +1056,8 @@ __MATX_INLINE__ void FreeAllocations() {
  */
 __MATX_INLINE__ bool HostPrintable(matxMemorySpace_t mem)
 {
-  return (mem == MATX_MANAGED_MEMORY || mem == MATX_HOST_MEMORY || mem == MATX_HOST_MALLOC_MEMORY);
+  return (mem == MATX_MANAGED_MEMORY || mem == MATX_HOST_MEMORY || mem == MATX_HOST_MALLOC_MEMORY ||
+          mem == MATX_HOST_NUMA_MEMORY || mem == MATX_SYSTEM_MEMORY);
 }
 
 /**
@@ -322,7 +1071,7 @@ __MATX_INLINE__ bool HostPrintable(matxMemorySpace_t mem)
 __MATX_INLINE__ bool DevicePrintable(matxMemorySpace_t mem)
 {
   return (mem == MATX_MANAGED_MEMORY || mem == MATX_DEVICE_MEMORY ||
-          mem == MATX_ASYNC_DEVICE_MEMORY);
+          mem == MATX_ASYNC_DEVICE_MEMORY || mem == MATX_SYSTEM_MEMORY);
 }
 
 /**
@@ -334,12 +1083,22 @@ __MATX_INLINE__ bool DevicePrintable(matxMemorySpace_t mem)
  */
 __MATX_INLINE__ void matxGetMemoryStats(size_t *current, size_t *total, size_t *max)
 {
-  // std::shared_lock lck(memory_mtx);
   *current = matxMemoryStats.currentBytesAllocated;
   *total = matxMemoryStats.totalBytesAllocated;
   *max = matxMemoryStats.maxBytesAllocated;
 }
 
+/**
+ * @brief Reset the peak memory statistic to the current usage
+ *
+ * Lets the maximum reported by matxGetMemoryStats measure the peak of one section of a program,
+ * such as a single benchmark, instead of the peak since startup.
+ */
+__MATX_INLINE__ void matxResetPeakMemoryStats()
+{
+  matxMemoryStats.maxBytesAllocated = matxMemoryStats.currentBytesAllocated.load();
+}
+
 /**
  * @brief Check if a pointer was allocated
  * 
@@ -355,7 +1114,7 @@ __MATX_INLINE__ bool IsAllocated(void *ptr) {
  *
  * Returns the memory kind of the pointer (device, host, managed, etc) based on
  *a pointer address. This function should not be used in the data path since it
- *takes a mutex and possibly loops through a std::map. Since Views can modify
+ *takes a mutex and performs a hash map lookup. Since Views can modify
  *the address of the data pointer, the base pointer may not be what is passed in
  * to this function, and therefore would not be in the map. However, finding the
  *next lowest address that is in the map is a good enough approximation since we
@@ -397,15 +1156,20 @@ __MATX_INLINE__ void matxAlloc(void **ptr, size_t bytes,
                       matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                       cudaStream_t stream = 0)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   
-  return GetAllocMap().allocate(ptr, bytes, space, stream);
+  GetAllocMap().allocate(ptr, bytes, space, stream);
+
+  // Memory reused from an earlier allocation must not look unchanged to transform memoization
+  if (bytes > 0 && GetTransformMemoization()) {
+    detail::WriteVersionTracker::Get().Bump(*ptr, static_cast<char *>(*ptr) + bytes);
+  }
 }
 
 
 __MATX_INLINE__ void matxFree(void *ptr)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   
   return GetAllocMap().deallocate(ptr);
 }
@@ -413,7 +1177,7 @@ __MATX_INLINE__ void matxFree(void *ptr)
 
 __MATX_INLINE__ void matxFree(void *ptr, cudaStream_t stream)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   return GetAllocMap().deallocate(ptr, stream);
 }
 
@@ -424,10 +1188,177 @@ __MATX_INLINE__ void matxFree(void *ptr, cudaStream_t stream)
 */
 __MATX_INLINE__ void update_stream(void *ptr, cudaStream_t stream)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   GetAllocMap().update_stream(ptr, stream);
 }
 
+/**
+ * @brief Enable or disable the stream-ordered memory pool
+ *
+ * When enabled, every MATX_ASYNC_DEVICE_MEMORY allocation made through matxAlloc (including tensors
+ * created with make_tensor using that space) is served from per-device, per-stream size-class
+ * free lists instead of calling cudaMallocAsync/cudaFreeAsync directly. Freed blocks are only reused
+ * by later allocations on the same stream. The pool may also be enabled at startup by setting the
+ * MATX_MEMORY_POOL environment variable to a non-zero value. Disabling the pool does not release
+ * blocks that are already cached; use TrimMemoryPool() for that.
+ *
+ * @param enable True to enable pooling
+ */
+__MATX_INLINE__ void SetMemoryPoolEnabled(bool enable)
+{
+  GetAllocMap().set_pool_enabled(enable);
+}
+
+/**
+ * @brief Check whether the stream-ordered memory pool is enabled
+ *
+ * @return True if pooling is enabled
+ */
+__MATX_INLINE__ bool GetMemoryPoolEnabled()
+{
+  return GetAllocMap().get_pool_enabled();
+}
+
+/**
+ * @brief Release all cached pool blocks back to CUDA
+ *
+ * Blocks are freed with cudaFree, which synchronizes the device. Blocks currently held by tensors
+ * are unaffected.
+ *
+ * @param device Device to trim, or -1 for all devices
+ * @return Number of bytes released
+ */
+__MATX_INLINE__ size_t TrimMemoryPool(int device = -1)
+{
+  return GetAllocMap().trim_pool(cuda::std::nullopt, device);
+}
+
+/**
+ * @brief Release cached pool blocks belonging to a single stream
+ *
+ * Blocks are freed with cudaFreeAsync on the stream, so this does not synchronize. This should be called
+ * before destroying a stream that had pooled allocations.
+ *
+ * @param stream Stream whose cached blocks are released
+ * @param device Device to trim, or -1 for all devices
+ * @return Number of bytes released
+ */
+__MATX_INLINE__ size_t TrimMemoryPool(cudaStream_t stream, int device = -1)
+{
+  return GetAllocMap().trim_pool(stream, device);
+}
+
+/**
+ * @brief Get the number of bytes currently cached in the memory pool and not held by any allocation
+ *
+ * @return Cached bytes
+ */
+__MATX_INLINE__ size_t GetMemoryPoolCachedBytes()
+{
+  return GetAllocMap().pool_cached_bytes();
+}
+
+/**
+ * @brief Enable or disable the per-stream scratch arena for transform temporaries
+ *
+ * When enabled, temporaries that transforms such as percentile, pwelch, and FFT-based convolution create on a
+ * CUDA executor are carved out of a per-device, per-stream bump arena. The arena rewinds once every temporary
+ * from it has been freed, so repeated calls reuse the same memory without calling into CUDA. User tensors are
+ * never served by the arena. The arena may also be enabled at startup by setting the MATX_SCRATCH_ARENA
+ * environment variable to a non-zero value.
+ *
+ * @param enable True to enable the arena
+ */
+__MATX_INLINE__ void SetScratchArenaEnabled(bool enable)
+{
+  GetAllocMap().set_arena_enabled(enable);
+}
+
+/**
+ * @brief Check whether the scratch arena is enabled
+ *
+ * @return True if the arena is enabled
+ */
+__MATX_INLINE__ bool GetScratchArenaEnabled()
+{
+  return GetAllocMap().get_arena_enabled();
+}
+
+/**
+ * @brief Release the memory of every idle scratch arena back to CUDA
+ *
+ * Chunks are freed with cudaFree, which synchronizes the device. Arenas with live temporaries are unaffected.
+ *
+ * @param device Device to trim, or -1 for all devices
+ * @return Number of bytes released
+ */
+__MATX_INLINE__ size_t TrimScratchArena(int device = -1)
+{
+  return GetAllocMap().trim_arena(cuda::std::nullopt, device);
+}
+
+/**
+ * @brief Release the scratch arena memory belonging to a single stream
+ *
+ * Chunks are freed with cudaFreeAsync on the stream, so this does not synchronize. This should be called
+ * before destroying a stream that ran transforms with the arena enabled.
+ *
+ * @param stream Stream whose arena is released
+ * @param device Device to trim, or -1 for all devices
+ * @return Number of bytes released
+ */
+__MATX_INLINE__ size_t TrimScratchArena(cudaStream_t stream, int device = -1)
+{
+  return GetAllocMap().trim_arena(stream, device);
+}
+
+/**
+ * @brief Get the number of bytes reserved by scratch arenas, whether or not temporaries currently use them
+ *
+ * @return Reserved bytes
+ */
+__MATX_INLINE__ size_t GetScratchArenaReservedBytes()
+{
+  return GetAllocMap().arena_reserved_bytes();
+}
+
+/**
+ * @brief Enable or disable oversubscription of device memory
+ *
+ * When enabled, MATX_DEVICE_MEMORY allocations made through matxAlloc are backed by device memory that can be
+ * evicted to pinned host memory at the same address. Allocations that do not fit evict the least recently used
+ * blocks instead of failing, and run() on a CUDA executor faults the tensors of an expression back in on the
+ * executor's stream before launching it. Memory touched outside of run(), such as through Data() in a library call,
+ * is not faulted back in. Oversubscription may also be enabled at startup by setting the MATX_OVERSUBSCRIBE
+ * environment variable to a non-zero value. Only allocations made while it is enabled can be evicted.
+ *
+ * @param enable True to enable oversubscription
+ */
+__MATX_INLINE__ void SetOversubscriptionEnabled(bool enable)
+{
+  GetAllocMap().set_oversubscribe_enabled(enable);
+}
+
+/**
+ * @brief Check whether oversubscription of device memory is enabled
+ *
+ * @return True if oversubscription is enabled
+ */
+__MATX_INLINE__ bool GetOversubscriptionEnabled()
+{
+  return GetAllocMap().get_oversubscribe_enabled();
+}
+
+/**
+ * @brief Get the number of bytes of oversubscribed device memory currently evicted to host
+ *
+ * @return Evicted bytes
+ */
+__MATX_INLINE__ size_t GetOversubscribedSpilledBytes()
+{
+  return GetAllocMap().oversubscribed.SpilledBytes();
+}
+
 /**
  * @brief Allocator following the PMR interface using the internal MatX allocator/deallocator
  * 
@@ -461,11 +1392,50 @@ struct matx_allocator {
   }  
 };
 
+/**
+ * @brief Allocator serving stream-ordered device memory from the MatX memory pool
+ *
+ * Allocations always come from the pool regardless of SetMemoryPoolEnabled(). This can be passed to
+ * make_tensor or Storage like any other allocator object.
+ */
+struct matx_pool_allocator {
+  cudaStream_t stream_ = 0;
+
+  matx_pool_allocator() = default;
+  explicit matx_pool_allocator(cudaStream_t stream) : stream_(stream) {}
+
+  /**
+   * @brief Allocate memory of at least ``size`` bytes on the allocator's stream
+   * 
+   * @param size Size of allocation in bytes
+   * @return Pointer to allocated memory
+   */
+  __MATX_INLINE__ void* allocate(size_t size)
+  {
+    void *tmp;
+    GetAllocMap().allocate_pooled(&tmp, size, stream_);
+    return tmp;
+  }
+
+  /**
+   * @brief Return memory to the pool on the allocator's stream
+   * 
+   * @param ptr Pointer to allocated data
+   * @param size Size of previously-allocated memory in bytes
+   */
+  __MATX_INLINE__ void deallocate(void *ptr, [[maybe_unused]] size_t size)
+  {
+    matxFree(ptr, stream_);
+  }
+};
+
 __MATX_INLINE__ std::string SpaceString(matxMemorySpace_t space) {
   switch (space) {
     case MATX_MANAGED_MEMORY: return "CUDA managed memory";
     case MATX_HOST_MEMORY: return "CUDA host-pinned memory";
     case MATX_HOST_MALLOC_MEMORY: return "Host memory";
+    case MATX_HOST_NUMA_MEMORY: return "Host first-touch memory";
+    case MATX_SYSTEM_MEMORY: return "System memory";
     case MATX_DEVICE_MEMORY: return "CUDA device memory";
     case MATX_ASYNC_DEVICE_MEMORY: return "CUDA asynchronous device memory";
     default: return "Unknown memory";
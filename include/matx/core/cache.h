@@ -32,18 +32,23 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <optional>
 #include <any>
+#include <list>
 #include <shared_mutex>
 #include <unordered_map>
 #include <cuda/atomic>
 #include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <cstdlib>
 #include <memory>
 #include <cstring>
 #include <thread>
+#include <chrono>
 
 #include "matx/core/error.h"
 #include "matx/core/allocator.h"
@@ -119,7 +124,7 @@ struct CacheCommonParamsKeyHash {
 __attribute__ ((visibility ("default")))
 #endif
 inline cuda::std::atomic<CacheId> CacheIdCounter{0};
-inline std::recursive_mutex cache_mtx; ///< Mutex protecting updates from map
+inline std::recursive_mutex cache_mtx; ///< Mutex protecting the cache type registry
 inline std::recursive_mutex ltoir_mutex; ///< Mutex protecting LTOIR cache operations
 inline std::recursive_mutex stream_alloc_mutex; ///< Mutex protecting stream allocation cache operations
 
@@ -157,6 +162,61 @@ struct StreamAllocation {
   size_t size;
 };
 
+/**
+ * @brief Which threads may reuse a cache entry
+ *
+ * PER_THREAD entries are only found by the thread that created them. PER_DEVICE entries are
+ * shared by every thread on the device, which is only valid for plans that are not modified
+ * when executed and that take any workspace from the executing stream.
+ */
+enum class CacheSharing {
+  PER_THREAD,
+  PER_DEVICE
+};
+
+/**
+ * @brief Limits applied to a single transform cache type. A value of zero means unlimited.
+ */
+struct CacheLimits {
+  size_t max_bytes = 0;    ///< Maximum device/host bytes allocated by the cached entries
+  size_t max_entries = 0;  ///< Maximum number of cached entries
+};
+
+// Node in a cache type's LRU list. The erase function removes the entry from its parameter map,
+// which destroys the cached plan/handle and releases its memory. Recency is a tick shared with the
+// entry so that hits can refresh it while holding the cache type's lock in shared mode.
+struct CacheLRUNode {
+  size_t bytes;
+  std::function<void()> erase;
+  std::shared_ptr<std::atomic<uint64_t>> last_used;
+};
+
+// Value stored in a transform cache map: the cached object plus its recency tick
+template <typename T>
+struct CacheEntry {
+  T value;
+  std::shared_ptr<std::atomic<uint64_t>> last_used;
+};
+
+// Bookkeeping for a single cache type
+struct CacheTypeState {
+  std::list<CacheLRUNode> lru;  ///< Entries in insertion order; the victim is the smallest last_used
+  size_t bytes = 0;
+  std::atomic<size_t> hits{0};
+  size_t misses = 0;
+  size_t evictions = 0;
+  std::optional<CacheLimits> limits;  ///< Overrides the cache-wide default when set
+};
+
+// A single cache type: its parameter maps, its bookkeeping and the lock guarding both. Hits hold
+// the lock shared, so lookups from different threads do not serialize. Inserting, evicting and
+// clearing hold it exclusively.
+struct CacheSlot {
+  std::shared_mutex mtx;
+  std::any map;
+  CacheTypeState state;
+};
+
 /**
  * Generic caching object for caching parameters. This class is used for
  * creating handles/plans on-the-fly and caching them to remove the need for
@@ -177,28 +237,36 @@ public:
    */
   template <typename CacheType>
   void Clear(const CacheId &id) {
-    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(cache_mtx);
+    CacheSlot *slot = FindSlot(id);
+    MATX_ASSERT_STR(slot != nullptr, matxInvalidType, "Cache type not found");
 
-    auto el = cache.find(id);
-    MATX_ASSERT_STR(el != cache.end(), matxInvalidType, "Cache type not found");
+    [[maybe_unused]] std::unique_lock<std::shared_mutex> lock(slot->mtx);
+    MATX_ASSERT_STR(slot->map.has_value(), matxInvalidType, "Cache type not found");
 
     using CacheMap = std::unordered_map<CacheCommonParamsKey, CacheType, CacheCommonParamsKeyHash>;
-    std::any_cast<CacheMap&>(el->second).clear();
+    std::any_cast<CacheMap&>(slot->map).clear();
+    slot->state.lru.clear();
+    slot->state.bytes = 0;
   }
 
   void ClearAll() {
     // Clear all cache entries for all cache types
     {
-      [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(cache_mtx);
-      for (auto &[id, v]: cache) {
-        auto entry = CacheRegistry().find(id);
-        if (entry == CacheRegistry().end()) {
-          continue;
+      [[maybe_unused]] std::shared_lock<std::shared_mutex> slots_lock(slots_mtx);
+      for (auto &[id, slot]: slots) {
+        [[maybe_unused]] std::unique_lock<std::shared_mutex> lock(slot->mtx);
+        if (slot->map.has_value()) {
+          [[maybe_unused]] std::lock_guard<std::recursive_mutex> registry_lock(cache_mtx);
+          auto entry = CacheRegistry().find(id);
+          if (entry != CacheRegistry().end()) {
+            entry->second.free(slot->map);
+          }
+          slot->map.reset();
         }
-        auto &info = entry->second;
-        info.free(v);
+        // Keep counters and per-type limits across a clear; only the entries are gone
+        slot->state.lru.clear();
+        slot->state.bytes = 0;
       }
-      cache.clear();
     }
     {
       [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(stream_alloc_mutex);
@@ -212,28 +280,40 @@ public:
       }
       stream_alloc_cache.clear();
     }
-    {
-      [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(ltoir_mutex);
-      ltoir_cache.clear();
-    }
+    ClearLTOIRMemory();
+  }
+
+  /**
+   * Drops the in-memory copies of cached kernels. Files in the kernel cache directory are kept.
+   */
+  void ClearLTOIRMemory() {
+    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(ltoir_mutex);
+    ltoir_cache.clear();
   }
 
+  /**
+   * Find the entry for params in a cache type, creating it with mfun on a miss, and pass it to efun
+   *
+   * Hits only take the cache type's lock in shared mode, so threads looking up existing plans do
+   * not block each other. Misses are serialized with each other while the plan is built, which
+   * keeps the per-entry memory accounting meaningful, and then take the cache type's lock
+   * exclusively to insert the entry. No lock is held while efun runs, so efun may execute other
+   * cached transforms. Entries are shared pointers or reference-counted tensors, so a copy stays
+   * valid even if another thread evicts the entry while efun is running.
+   *
+   * With CacheSharing::PER_DEVICE the entry is keyed by device only. A thread that misses while
+   * another thread is building the same entry waits for it and reuses it instead of building a
+   * second copy.
+   */
   template <typename CacheType, typename InParams, typename MakeFun, typename ExecFun, typename Executor>
-  void LookupAndExec(const CacheId &id, const InParams &params, const MakeFun &mfun, const ExecFun &efun, [[maybe_unused]] const Executor &exec) {
-    // This mutex should eventually be finer-grained so each transform doesn't get blocked by others
-    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(cache_mtx);
+  void LookupAndExec(const CacheId &id, const InParams &params, const MakeFun &mfun, const ExecFun &efun,
+                     [[maybe_unused]] const Executor &exec, CacheSharing sharing = CacheSharing::PER_THREAD) {
     using CacheMap = std::unordered_map<CacheCommonParamsKey, CacheType, CacheCommonParamsKeyHash>;
+    using ValueType = decltype(mfun());
+    using EntryType = CacheEntry<ValueType>;
 
-    // Create named cache if it doesn't exist
     CacheCommonParamsKey key;
-    key.thread_id = std::this_thread::get_id();
-    
-    auto el = cache.find(id);
-    if (el == cache.end()) {
-      cache[id] = CacheMap{};
-    }
-
-    auto &cval = cache[id];
+    key.thread_id = sharing == CacheSharing::PER_THREAD ? std::this_thread::get_id() : std::thread::id{};
     if constexpr (is_cuda_executor_v<Executor>) {
       cudaGetDevice(&key.device_id);
     }
@@ -241,20 +321,157 @@ public:
       key.device_id = 0;
     }
 
-    auto &rmap = std::any_cast<CacheMap&>(cval);
-    auto &common_params_cache = rmap[key];
-    auto cache_el = common_params_cache.find(params);
-    if (cache_el == common_params_cache.end()) {
-      MATX_LOG_DEBUG("Cache MISS for transform: id={}, device={}, thread={}", 
+    CacheSlot &slot = GetSlot(id);
+
+    auto lookup = [&]() -> std::optional<ValueType> {
+      [[maybe_unused]] std::shared_lock<std::shared_mutex> lock(slot.mtx);
+      const auto *rmap = std::any_cast<CacheMap>(&slot.map);
+      if (rmap == nullptr) {
+        return std::nullopt;
+      }
+      const auto common_params_cache = rmap->find(key);
+      if (common_params_cache == rmap->end()) {
+        return std::nullopt;
+      }
+      const auto cache_el = common_params_cache->second.find(params);
+      if (cache_el == common_params_cache->second.end()) {
+        return std::nullopt;
+      }
+
+      MATX_LOG_DEBUG("Cache HIT for transform: id={}, device={}, thread={}", 
                      id, key.device_id, reinterpret_cast<void*>(std::hash<std::thread::id>{}(key.thread_id)));
-      std::any tmp = mfun();
-      common_params_cache.insert({params, tmp});
-      efun(std::any_cast<decltype(mfun())>(tmp));
+      const auto &entry = std::any_cast<const EntryType&>(cache_el->second);
+      entry.last_used->store(lru_tick.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+      slot.state.hits.fetch_add(1, std::memory_order_relaxed);
+      // Copy before executing since the entry may be evicted once the lock is released
+      return entry.value;
+    };
+
+    if (auto value = lookup(); value.has_value()) {
+      efun(*value);
+      return;
     }
-    else {
-      MATX_LOG_DEBUG("Cache HIT for transform: id={}, device={}, thread={}", 
+
+    auto value = [&]() -> ValueType {
+      // Recursive since building a plan may look up other cached transforms
+      [[maybe_unused]] std::lock_guard<std::recursive_mutex> build_lock(build_mtx);
+
+      // Another thread may have built a shared entry while this one waited for the build lock
+      if (sharing == CacheSharing::PER_DEVICE) {
+        if (auto built = lookup(); built.has_value()) {
+          return *built;
+        }
+      }
+
+      MATX_LOG_DEBUG("Cache MISS for transform: id={}, device={}, thread={}", 
                      id, key.device_id, reinterpret_cast<void*>(std::hash<std::thread::id>{}(key.thread_id)));
-      efun(std::any_cast<decltype(mfun())>(cache_el->second));
+
+      // The size of an entry is the memory allocated through MatX while creating it, which covers
+      // workspaces as well as any buffers owned by the plan
+      const size_t bytes_before = matxMemoryStats.currentBytesAllocated.load();
+      auto made = mfun();
+      const size_t bytes_after = matxMemoryStats.currentBytesAllocated.load();
+      const size_t bytes = bytes_after > bytes_before ? bytes_after - bytes_before : 0;
+
+      [[maybe_unused]] std::unique_lock<std::shared_mutex> lock(slot.mtx);
+      if (!slot.map.has_value()) {
+        slot.map = CacheMap{};
+      }
+
+      auto &rmap = std::any_cast<CacheMap&>(slot.map);
+      auto &common_params_cache = rmap[key];
+      auto &state = slot.state;
+      state.misses++;
+
+      auto last_used = std::make_shared<std::atomic<uint64_t>>(lru_tick.fetch_add(1, std::memory_order_relaxed));
+      if (common_params_cache.insert({params, std::any{EntryType{made, last_used}}}).second) {
+        state.lru.push_back(CacheLRUNode{bytes, [&common_params_cache, params]() {
+          common_params_cache.erase(params);
+        }, last_used});
+        state.bytes += bytes;
+        Evict(id, state);
+      }
+
+      return made;
+    }();
+
+    efun(value);
+  }
+
+  /**
+   * @brief Set the limits used by every cache type that does not have its own limits
+   *
+   * Entries over the new limits are evicted immediately.
+   *
+   * @param limits Default limits
+   */
+  void SetDefaultLimits(const CacheLimits &limits) {
+    default_max_bytes.store(limits.max_bytes);
+    default_max_entries.store(limits.max_entries);
+
+    [[maybe_unused]] std::shared_lock<std::shared_mutex> slots_lock(slots_mtx);
+    for (auto &[id, slot]: slots) {
+      [[maybe_unused]] std::unique_lock<std::shared_mutex> lock(slot->mtx);
+      Evict(id, slot->state);
+    }
+  }
+
+  /**
+   * @brief Get the limits used by cache types without their own limits
+   */
+  CacheLimits GetDefaultLimits() {
+    return CacheLimits{default_max_bytes.load(), default_max_entries.load()};
+  }
+
+  /**
+   * @brief Set the limits for a single cache type
+   *
+   * @param id Cache type ID from GetCacheIdFromType
+   * @param limits Limits for this cache type
+   */
+  void SetLimits(const CacheId &id, const CacheLimits &limits) {
+    CacheSlot &slot = GetSlot(id);
+    [[maybe_unused]] std::unique_lock<std::shared_mutex> lock(slot.mtx);
+    slot.state.limits = limits;
+    Evict(id, slot.state);
+  }
+
+  /**
+   * @brief Get hit/miss/eviction counters and current usage for a single cache type
+   *
+   * @param id Cache type ID from GetCacheIdFromType
+   * @param hits Number of lookups that found an existing entry
+   * @param misses Number of lookups that created a new entry
+   * @param evictions Number of entries evicted to stay within the limits
+   * @param entries Number of entries currently cached
+   * @param bytes Bytes currently held by cached entries
+   */
+  void GetStats(const CacheId &id, size_t *hits, size_t *misses, size_t *evictions, size_t *entries, size_t *bytes) {
+    *hits = *misses = *evictions = *entries = *bytes = 0;
+    CacheSlot *slot = FindSlot(id);
+    if (slot != nullptr) {
+      [[maybe_unused]] std::shared_lock<std::shared_mutex> lock(slot->mtx);
+      *hits = slot->state.hits.load();
+      *misses = slot->state.misses;
+      *evictions = slot->state.evictions;
+      *entries = slot->state.lru.size();
+      *bytes = slot->state.bytes;
+    }
+  }
+
+  /**
+   * @brief Get counters and usage summed over all cache types
+   */
+  void GetStats(size_t *hits, size_t *misses, size_t *evictions, size_t *entries, size_t *bytes) {
+    *hits = *misses = *evictions = *entries = *bytes = 0;
+    [[maybe_unused]] std::shared_lock<std::shared_mutex> slots_lock(slots_mtx);
+    for (const auto &[id, slot]: slots) {
+      [[maybe_unused]] std::shared_lock<std::shared_mutex> lock(slot->mtx);
+      *hits += slot->state.hits.load();
+      *misses += slot->state.misses;
+      *evictions += slot->state.evictions;
+      *entries += slot->state.lru.size();
+      *bytes += slot->state.bytes;
     }
   }
 
@@ -366,6 +583,78 @@ public:
     return cache_dir;
   }
 
+
+  /**
+   * @brief Write a file into the kernel cache directory atomically
+   *
+   * The contents are written to a temporary file that is then renamed over the destination, so
+   * concurrent processes sharing a cache directory never observe a partially-written file.
+   *
+   * @param filename Name of the file inside the cache directory
+   * @param data Bytes to write
+   * @param size Number of bytes
+   * @return true if the file was written
+   */
+  __MATX_INLINE__ bool WriteKernelCacheFile(const std::string& filename, const char* data, size_t size) {
+    std::string cache_dir = GetKernelCacheDirectory();
+    if (cache_dir.empty()) {
+      return false;
+    }
+
+    try {
+      std::filesystem::create_directories(cache_dir);
+      const auto final_path = std::filesystem::path(cache_dir) / filename;
+      auto tmp_path = final_path;
+      tmp_path += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) +
+                  "_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+
+      {
+        std::ofstream file(tmp_path, std::ios::binary);
+        if (!file.is_open()) {
+          MATX_LOG_WARN("Failed to open file for writing: {}", tmp_path.string());
+          return false;
+        }
+        file.write(data, static_cast<std::streamsize>(size));
+        if (!file) {
+          MATX_LOG_WARN("Failed to write cache file: {}", tmp_path.string());
+          return false;
+        }
+      }
+
+      std::filesystem::rename(tmp_path, final_path);
+      MATX_LOG_DEBUG("Stored {} bytes to disk cache: {}", size, final_path.string());
+      return true;
+    } catch (const std::exception& e) {
+      MATX_LOG_WARN("Failed to write to disk cache for {}: {}", filename, e.what());
+      return false;
+    }
+  }
+
+  /**
+   * @brief Read a text file from the kernel cache directory
+   *
+   * @param filename Name of the file inside the cache directory
+   * @return File contents, or empty string if the file does not exist
+   */
+  __MATX_INLINE__ std::string ReadKernelCacheFile(const std::string& filename) {
+    std::string cache_dir = GetKernelCacheDirectory();
+    if (cache_dir.empty()) {
+      return "";
+    }
+
+    try {
+      std::ifstream file(std::filesystem::path(cache_dir) / filename);
+      if (!file.is_open()) {
+        return "";
+      }
+      std::stringstream buffer;
+      buffer << file.rdbuf();
+      return buffer.str();
+    } catch (const std::exception& e) {
+      MATX_LOG_WARN("Failed to read disk cache file {}: {}", filename, e.what());
+      return "";
+    }
+  }
   
 
   /**
@@ -489,30 +778,9 @@ public:
       // Use RAII to manage ownership until all operations complete successfully
       std::unique_ptr<char, decltype(&free)> data_guard(data, &free);
       
-      // Write to disk first (before transferring ownership to map)
-      // This way if disk write throws, data_guard will clean up automatically
-      std::string cache_dir = GetKernelCacheDirectory();
-      if (!cache_dir.empty()) {
-        try {
-          // Create cache directory if it doesn't exist
-          std::filesystem::create_directories(cache_dir);
-          
-          // Write to disk
-          std::filesystem::path cache_file = std::filesystem::path(cache_dir) / filename;
-          std::ofstream file(cache_file, std::ios::binary);
-          if (file.is_open()) {
-            file.write(data, length);
-            file.close();
-            MATX_LOG_DEBUG("Stored {} bytes to disk cache: {}", length, cache_file.string());
-          } else {
-            MATX_LOG_WARN("Failed to open file for writing: {}", cache_file.string());
-          }
-          // Note: We don't fail if disk write fails, as in-memory cache is still valid
-        } catch (const std::exception& e) {
-          MATX_LOG_WARN("Failed to write to disk cache for {}: {}", filename, e.what());
-          // Ignore disk write failures - in-memory cache is still valid
-        }
-      }
+      // Write to disk first (before transferring ownership to map). Disk failures are not fatal
+      // since the in-memory cache is still valid.
+      WriteKernelCacheFile(filename, data, length);
       
       // Transfer ownership to LTOIRData only after disk operations complete
       ltoir_cache[filename] = LTOIRData{data_guard.release(), length};
@@ -538,27 +806,12 @@ public:
    * @return true if successfully stored, false otherwise
    */
   __MATX_INLINE__ bool StoreLTOIRMetadata(const std::string& filename, const std::string& metadata) {
-    std::string cache_dir = GetKernelCacheDirectory();
-    if (cache_dir.empty()) {
-      MATX_LOG_DEBUG("Cannot store metadata for {}: no cache directory", filename);
-      return false;
-    }
-    
-    try {
-      std::filesystem::create_directories(cache_dir);
-      std::filesystem::path meta_file = std::filesystem::path(cache_dir) / (filename + ".meta");
-      std::ofstream file(meta_file);
-      if (file.is_open()) {
-        file << metadata;
-        file.close();
-        MATX_LOG_DEBUG("Stored metadata for {}: {}", filename, metadata);
-        return true;
-      } else {
-        MATX_LOG_ERROR("Failed to open metadata file for writing: {}", meta_file.string());
-      }
-    } catch (const std::exception& e) {
-      MATX_LOG_ERROR("Failed to store metadata for {}: {}", filename, e.what());
+    if (WriteKernelCacheFile(filename + ".meta", metadata.data(), metadata.size())) {
+      MATX_LOG_DEBUG("Stored metadata for {}: {}", filename, metadata);
+      return true;
     }
+
+    MATX_LOG_DEBUG("Cannot store metadata for {}", filename);
     return false;
   }
 
@@ -633,29 +886,9 @@ public:
       ltoir_cache[filename] = LTOIRData{buffer, size};
       MATX_LOG_DEBUG("Stored {} bytes (copy) in memory cache for: {}", size, filename);
       
-      // Also store to disk for persistence
-      std::string cache_dir = GetKernelCacheDirectory();
-      if (!cache_dir.empty()) {
-        try {
-          // Create cache directory if it doesn't exist
-          std::filesystem::create_directories(cache_dir);
-          
-          // Write to disk
-          std::filesystem::path cache_file = std::filesystem::path(cache_dir) / filename;
-          std::ofstream file(cache_file, std::ios::binary);
-          if (file.is_open()) {
-            file.write(data, size);
-            file.close();
-            MATX_LOG_DEBUG("Stored {} bytes (copy) to disk cache: {}", size, cache_file.string());
-          } else {
-            MATX_LOG_WARN("Failed to open file for writing: {}", cache_file.string());
-          }
-          // Note: We don't fail if disk write fails, as in-memory cache is still valid
-        } catch (const std::exception& e) {
-          MATX_LOG_WARN("Failed to write to disk cache for {}: {}", filename, e.what());
-          // Ignore disk write failures - in-memory cache is still valid
-        }
-      }
+      // Also store to disk for persistence. Disk failures are not fatal since the in-memory
+      // cache is still valid.
+      WriteKernelCacheFile(filename, data, size);
       
       return true;
     } catch (const std::exception& e) {
@@ -712,9 +945,55 @@ public:
 
 
 private:
+  // Returns the slot of a cache type, or nullptr if it was never used
+  CacheSlot *FindSlot(const CacheId &id) {
+    [[maybe_unused]] std::shared_lock<std::shared_mutex> lock(slots_mtx);
+    auto el = slots.find(id);
+    return el == slots.end() ? nullptr : el->second.get();
+  }
+
+  // Returns the slot of a cache type, creating it on first use. Slots are never removed, so the
+  // reference stays valid after the slot table lock is released.
+  CacheSlot &GetSlot(const CacheId &id) {
+    if (CacheSlot *slot = FindSlot(id); slot != nullptr) {
+      return *slot;
+    }
+
+    [[maybe_unused]] std::unique_lock<std::shared_mutex> lock(slots_mtx);
+    auto &slot = slots[id];
+    if (!slot) {
+      slot = std::make_unique<CacheSlot>();
+    }
+    return *slot;
+  }
+
+  // Evict least-recently used entries of a cache type until it is within its limits. The most
+  // recently used entry is never evicted, so a single entry larger than the budget still works.
+  // Must be called with the cache type's lock held exclusively.
+  void Evict([[maybe_unused]] const CacheId &id, CacheTypeState &state) {
+    const auto limits = state.limits.has_value() ? *state.limits : GetDefaultLimits();
+    while (state.lru.size() > 1 &&
+           ((limits.max_bytes > 0 && state.bytes > limits.max_bytes) ||
+            (limits.max_entries > 0 && state.lru.size() > limits.max_entries))) {
+      auto victim = std::min_element(state.lru.begin(), state.lru.end(), [](const auto &a, const auto &b) {
+        return a.last_used->load(std::memory_order_relaxed) < b.last_used->load(std::memory_order_relaxed);
+      });
+      MATX_LOG_DEBUG("Cache EVICT for transform: id={}, bytes={}", id, victim->bytes);
+      state.bytes -= victim->bytes;
+      victim->erase();
+      state.lru.erase(victim);
+      state.evictions++;
+    }
+  }
+
   // Static cache for in-memory storage
   std::unordered_map<std::string, LTOIRData> ltoir_cache;
-  std::unordered_map<CacheId, std::any> cache;
+  std::shared_mutex slots_mtx;  ///< Guards the slot table; held shared for lookups of existing slots
+  std::unordered_map<CacheId, std::unique_ptr<CacheSlot>> slots;
+  std::recursive_mutex build_mtx;  ///< Serializes plan creation on cache misses
+  std::atomic<uint64_t> lru_tick{0};
+  std::atomic<size_t> default_max_bytes{0};
+  std::atomic<size_t> default_max_entries{0};
   std::unordered_map<CacheCommonParamsKey, std::unordered_map<cudaStream_t, StreamAllocation>, CacheCommonParamsKeyHash> stream_alloc_cache;
 };
 
@@ -756,6 +1035,37 @@ __MATX_INLINE__ void ClearCaches() {
   detail::GetCache().ClearAll();
 }
 
+/**
+ * @brief Bound the size of each transform cache
+ *
+ * MatX caches FFT plans, GEMM handles, and other transform state so that repeated calls with the
+ * same parameters do not recreate them. By default these caches are unbounded. Setting a limit
+ * makes each cache type evict its least-recently used entries, freeing their plans and workspaces,
+ * once it holds more than max_bytes of MatX-allocated memory or more than max_entries entries.
+ * A limit of zero means unlimited.
+ *
+ * @param max_bytes Maximum bytes held by each cache type
+ * @param max_entries Maximum number of entries in each cache type
+ */
+__attribute__ ((visibility ("default")))
+__MATX_INLINE__ void SetCacheLimits(size_t max_bytes, size_t max_entries = 0) {
+  detail::GetCache().SetDefaultLimits(detail::CacheLimits{max_bytes, max_entries});
+}
+
+/**
+ * @brief Get transform cache statistics summed over all cache types
+ *
+ * @param hits Number of lookups that reused a cached entry
+ * @param misses Number of lookups that created a new entry
+ * @param evictions Number of entries evicted to stay within the limits
+ * @param entries Number of entries currently cached
+ * @param bytes Bytes currently held by cached entries
+ */
+__attribute__ ((visibility ("default")))
+__MATX_INLINE__ void GetCacheStats(size_t *hits, size_t *misses, size_t *evictions, size_t *entries, size_t *bytes) {
+  detail::GetCache().GetStats(hits, misses, evictions, entries, bytes);
+}
+
 // Helper function to clear both MatX caches and allocations. This provides a single
 // function that can be called prior to program exit to support clean shutdown
 // (i.e., to avoid issues with the order of destruction of static objects and CUDA contexts).
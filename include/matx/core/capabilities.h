@@ -41,6 +41,9 @@
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__algorithm/max.h>
 #include <cuda/std/array>
+#include <cmath>
+#include <cstring>
+#include <format>
 #include <string>
 #include <set>
 
@@ -72,6 +75,13 @@ namespace detail {
     ALIASED_MEMORY, // Whether the operator's input and output pointers alias
     GLOBAL_KERNEL, // Kernel operates entirely on a global level per chunk of data. False when at least one operator works on a block level
     PASS_THROUGH_THREADS, // All threads must call operator() on nested operators; bounds checking done at tensor level
+    BYTES_ACCESSED, // Estimated bytes touched by one evaluation of the expression, from the tensors it references
+    FLOPS_PER_ELEMENT, // Estimated arithmetic operations per output element
+    INDEX_32BIT, // Whether every offset the expression computes fits in 32-bit index math
+    PREFETCH_MEMORY, // Prefetch the managed and system memory referenced by the expression to a device
+    STREAM_DEPENDENCIES, // Wait for, or record, the last stream to write the tensors referenced by the expression
+    WRITE_VERSIONS, // Read or bump the write versions of the tensors referenced by the expression
+    RESIDENT_MEMORY, // Fault evicted oversubscribed memory referenced by the expression back in to the device
     // Add more capabilities as needed
   };
 
@@ -85,21 +95,55 @@ namespace detail {
     MAX_QUERY,  // Result is the maximum of the capabilities of the operator and its children.
     STR_CAT_QUERY,  // Result is the concatenation of the capabilities of the operator and its children.
     RANGE_QUERY,  // Result is the range of the capabilities of the operator and its children.
+    SUM_QUERY,  // Result is the sum of the capabilities of the operator and its children.
   };
   
 
 #if !defined(__CUDACC_RTC__)
-  template <ElementsPerThread EPT, bool JIT>
+  template <ElementsPerThread EPT, bool JIT, typename IndexType = index_t>
   struct CapabilityParams {
     static constexpr ElementsPerThread ept = EPT;
     static constexpr bool jit = JIT;
     static constexpr int osize = 0;
     static constexpr int block_size = 0;
+    using index_type = IndexType; // Type used for index and offset math in the kernel
 
     // For JIT there will be other capabilties patched in with a string
   };  
 
   using DefaultCapabilities = CapabilityParams<ElementsPerThread::ONE, false>;  
+
+  // Index type of a capability set, falling back to index_t for capabilities without one (JIT)
+  template <typename CapType>
+  struct cap_index_type {
+    using type = index_t;
+  };
+
+  template <typename CapType>
+    requires requires { typename CapType::index_type; }
+  struct cap_index_type<CapType> {
+    using type = typename CapType::index_type;
+  };
+
+  template <typename CapType>
+  using cap_index_t = typename cap_index_type<CapType>::type;
+
+  // Capability set of the operators inside fast_math(). Single-precision transcendental and
+  // division operators see fast_math and switch to the approximate CUDA intrinsics.
+  template <typename CapType>
+  struct FastMathCapabilities : CapType {
+    static constexpr bool fast_math = true;
+  };
+
+  template <typename CapType>
+  struct cap_fast_math : cuda::std::false_type {};
+
+  template <typename CapType>
+    requires requires { CapType::fast_math; }
+  struct cap_fast_math<CapType> : cuda::std::bool_constant<CapType::fast_math> {};
+
+  template <typename CapType>
+  inline constexpr bool cap_fast_math_v = cap_fast_math<CapType>::value;
   
   // Concept to detect scoped enums
   template<typename T>
@@ -258,6 +302,138 @@ namespace detail {
     static constexpr bool and_identity = true;
   };    
 
+  template <>
+  struct capability_attributes<OperatorCapability::BYTES_ACCESSED> {
+    using type = uint64_t;
+    using input_type = VoidCapabilityType;
+    static constexpr uint64_t default_value = 0;
+  };
+
+  template <>
+  struct capability_attributes<OperatorCapability::FLOPS_PER_ELEMENT> {
+    using type = uint64_t;
+    using input_type = VoidCapabilityType;
+    static constexpr uint64_t default_value = 0;
+  };
+
+  template <>
+  struct capability_attributes<OperatorCapability::INDEX_32BIT> {
+    using type = bool;
+    using input_type = VoidCapabilityType;
+    static constexpr bool default_value = true; // Only tensors hold offsets that can exceed 32 bits
+    static constexpr bool or_identity = false;
+    static constexpr bool and_identity = true;
+  };
+
+  template <>
+  struct capability_attributes<OperatorCapability::PREFETCH_MEMORY> {
+    using type = bool;
+    using input_type = PrefetchQueryInput;
+    static constexpr bool default_value = false;
+    static constexpr bool or_identity = false;
+    static constexpr bool and_identity = true;
+  };
+
+  template <>
+  struct capability_attributes<OperatorCapability::STREAM_DEPENDENCIES> {
+    using type = bool;
+    using input_type = StreamDependencyQueryInput;
+    static constexpr bool default_value = false;
+    static constexpr bool or_identity = false;
+    static constexpr bool and_identity = true;
+  };
+
+  template <>
+  struct capability_attributes<OperatorCapability::WRITE_VERSIONS> {
+    using type = bool;
+    using input_type = WriteVersionQueryInput;
+    static constexpr bool default_value = false;
+    static constexpr bool or_identity = false;
+    static constexpr bool and_identity = true;
+  };
+
+  template <>
+  struct capability_attributes<OperatorCapability::RESIDENT_MEMORY> {
+    using type = bool;
+    using input_type = ResidencyQueryInput;
+    static constexpr bool default_value = false;
+    static constexpr bool or_identity = false;
+    static constexpr bool and_identity = true;
+  };
+
+
+#ifdef MATX_EN_JIT
+  // Set while a CUDAJITExecutor with scalar folding enabled builds and looks up the kernel for an expression
+  inline thread_local bool jit_fold_scalars = false;
+
+  class JITFoldScalarsScope {
+    public:
+      explicit JITFoldScalarsScope(bool enable) : prev_(jit_fold_scalars) { jit_fold_scalars = enable; }
+      ~JITFoldScalarsScope() { jit_fold_scalars = prev_; }
+
+    private:
+      bool prev_;
+  };
+
+  template <typename T>
+  inline constexpr bool is_jit_foldable_scalar_v = cuda::std::is_arithmetic_v<T> && !cuda::std::is_same_v<T, bool>;
+
+  template <typename T>
+  __MATX_INLINE__ bool jit_fold_scalar(const T &v) {
+    if constexpr (cuda::std::is_floating_point_v<T>) {
+      // Infinities and NaNs have no literal, so they stay runtime parameters
+      return jit_fold_scalars && std::isfinite(v);
+    }
+    else {
+      return jit_fold_scalars;
+    }
+  }
+
+  // The class name carries the exact bits of the value so distinct constants never share a kernel
+  template <typename T>
+  __MATX_INLINE__ uint64_t jit_scalar_bits(const T &v) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(T));
+    return bits;
+  }
+
+  template <typename T>
+  __MATX_INLINE__ std::string jit_scalar_class_name(const T &v) {
+    return std::format("JITScalar_{}_{:x}", type_to_string_c_name<T>(), jit_scalar_bits(v));
+  }
+
+  /**
+   * Source for a scalar baked into a JIT kernel as a constant
+   *
+   * The struct keeps a member of the scalar's type so the kernel parameters have the same layout as the
+   * runtime scalar the host passes, but every read returns the constant.
+   */
+  template <typename T>
+  __MATX_INLINE__ std::string jit_scalar_class_str(const T &v) {
+    std::string literal;
+    if constexpr (cuda::std::is_floating_point_v<T>) {
+      // Hexadecimal literals are exact
+      literal = std::format("{}0x{:a}", std::signbit(v) ? "-" : "", std::fabs(v));
+    }
+    else {
+      literal = std::format("0x{:x}ULL", jit_scalar_bits(v));
+    }
+
+    const auto type = type_to_string<T>();
+    return std::format("struct {} {{\n"
+        "  using value_type = {};\n"
+        "  using matxop = bool;\n"
+        "  value_type storage_;\n"
+        "  static constexpr value_type v_ = static_cast<value_type>({});\n"
+        "  template <typename CapType, typename... Is>\n"
+        "  __MATX_INLINE__ __MATX_DEVICE__ value_type operator()(Is...) const {{ return v_; }}\n"
+        "  __MATX_INLINE__ __MATX_DEVICE__ constexpr operator value_type() const {{ return v_; }}\n"
+        "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return 0; }}\n"
+        "  constexpr __MATX_INLINE__ __MATX_DEVICE__ index_t Size(int) const {{ return 0; }}\n"
+        "}};\n",
+        jit_scalar_class_name(v), type, literal);
+  }
+#endif
 
   template <OperatorCapability Cap, typename OperatorType, typename InType>
   __MATX_INLINE__ __MATX_HOST__ typename capability_attributes<Cap>::type
@@ -268,8 +444,26 @@ namespace detail {
     } else {
       // Default capabilities for non-MatX ops
       if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
+#ifdef MATX_EN_JIT
+        if constexpr (is_jit_foldable_scalar_v<OperatorType>) {
+          if (jit_fold_scalar(op)) {
+            return jit_scalar_class_name(op);
+          }
+        }
+#endif
         return detail::type_to_string<OperatorType>();
       }
+#ifdef MATX_EN_JIT
+      else if constexpr (Cap == OperatorCapability::JIT_CLASS_QUERY && is_jit_foldable_scalar_v<OperatorType>) {
+        if (jit_fold_scalar(op)) {
+          const auto name = jit_scalar_class_name(op);
+          if (in.find(name) == in.end()) {
+            in[name] = jit_scalar_class_str(op);
+          }
+        }
+        return true;
+      }
+#endif
       else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
         // If this is not a matx operator (like a constant or a lambda), we assume it supports JIT.
         return true;
@@ -324,6 +518,20 @@ namespace detail {
         return CapabilityQueryType::AND_QUERY; // The expression should generate LTOIR code if all its children generate it.
       case OperatorCapability::PASS_THROUGH_THREADS:
         return CapabilityQueryType::OR_QUERY; // If ANY operator needs pass-through, all threads must call operator()
+      case OperatorCapability::BYTES_ACCESSED:
+        return CapabilityQueryType::SUM_QUERY; // Every tensor in the expression is read or written
+      case OperatorCapability::FLOPS_PER_ELEMENT:
+        return CapabilityQueryType::SUM_QUERY; // Every arithmetic operator in the expression runs once per element
+      case OperatorCapability::INDEX_32BIT:
+        return CapabilityQueryType::AND_QUERY; // Every tensor in the expression must fit
+      case OperatorCapability::PREFETCH_MEMORY:
+        return CapabilityQueryType::OR_QUERY; // Every tensor in the expression is visited
+      case OperatorCapability::STREAM_DEPENDENCIES:
+        return CapabilityQueryType::OR_QUERY; // Every tensor in the expression is visited
+      case OperatorCapability::WRITE_VERSIONS:
+        return CapabilityQueryType::OR_QUERY; // Every tensor in the expression is visited
+      case OperatorCapability::RESIDENT_MEMORY:
+        return CapabilityQueryType::OR_QUERY; // Every tensor in the expression is visited
       default:
         // Default to OR_QUERY or handle as an error/assertion if a capability isn't mapped.
         return CapabilityQueryType::OR_QUERY; 
@@ -372,7 +580,11 @@ namespace detail {
         children_aggregated_val = capability_attributes<Cap>::default_value;
       }
     } else { // One or more children
-      if constexpr (std::is_same_v<CapType, bool>) {
+      if constexpr (std::is_same_v<CapType, uint64_t>) {
+          // Only SUM_QUERY is defined for counters
+          children_aggregated_val = 0;
+          ((children_aggregated_val += child_vals), ...);
+      } else if constexpr (std::is_same_v<CapType, bool>) {
           if (query_type == CapabilityQueryType::OR_QUERY) {
               children_aggregated_val = capability_attributes<Cap>::or_identity;
               ((children_aggregated_val = children_aggregated_val || child_vals), ...);     
@@ -443,7 +655,9 @@ namespace detail {
     }
 
     // Step 2: Combine self's capability with the children's combined result.
-    if constexpr (std::is_same_v<CapType, bool>) {
+    if constexpr (std::is_same_v<CapType, uint64_t>) {
+        return self_val + children_aggregated_val;
+    } else if constexpr (std::is_same_v<CapType, bool>) {
         // Optimize when identity values make the operation redundant
         if (query_type == CapabilityQueryType::OR_QUERY) {
             // self_val || or_identity
@@ -0,0 +1,264 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#if defined(MATX_EN_NVCOMP) || defined(DOXYGEN_ONLY)
+
+#include <cuda_runtime.h>
+#include <memory>
+
+#include <nvcomp/ans.hpp>
+#include <nvcomp/bitcomp.hpp>
+#include <nvcomp/lz4.hpp>
+#include <nvcomp/nvcompManagerFactory.hpp>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+
+namespace matx
+{
+
+/**
+ * @brief Compression algorithms available to compressed_tensor_t
+ */
+enum class CompressionAlgo {
+  LZ4,      ///< General-purpose byte-oriented compression
+  BITCOMP,  ///< Fast compression of numeric data, usually the best choice for sampled signals
+  ANS       ///< Entropy coding with the highest throughput for data with skewed byte distributions
+};
+
+/**
+ * @brief Tensor held compressed on the device with nvCOMP, optionally spilled to pinned host memory
+ *
+ * Compress() stores the contents of a contiguous tensor as a compressed buffer sized to the compressed data, so
+ * the uncompressed tensor can be released. Spill() moves the compressed buffer to pinned host memory to free device
+ * memory entirely, and Fetch() brings it back. Decompress() restores the tensor before it is used in an
+ * expression, fetching the data first if it was spilled.
+ *
+ * All work is issued on the executor's stream. Copies of a compressed_tensor_t share the compressed buffer.
+ *
+ * @tparam T Element type
+ * @tparam RANK Tensor rank
+ */
+template <typename T, int RANK>
+class compressed_tensor_t {
+  public:
+    using value_type = T;
+
+    compressed_tensor_t() = default;
+
+    /**
+     * @brief Compress a tensor
+     *
+     * @param t Contiguous tensor in device or managed memory
+     * @param exec CUDA executor whose stream the compression runs on
+     * @param algo Compression algorithm
+     * @param chunk_bytes Size of the independently compressed chunks nvCOMP splits the data into
+     * @returns Compressed tensor
+     */
+    template <typename TensorType, typename Executor>
+      requires is_cuda_executor_v<Executor>
+    static compressed_tensor_t Compress(const TensorType &t, const Executor &exec,
+                                        CompressionAlgo algo = CompressionAlgo::BITCOMP,
+                                        size_t chunk_bytes = 1 << 16) {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      static_assert(std::is_same_v<typename TensorType::value_type, T> && TensorType::Rank() == RANK,
+                    "compressed_tensor_t type and rank must match the tensor");
+      MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter, "Only contiguous tensors can be compressed");
+
+      const cudaStream_t stream = exec.getStream();
+      compressed_tensor_t c;
+      c.algo_ = algo;
+      for (int i = 0; i < RANK; i++) {
+        c.shape_[i] = t.Size(i);
+      }
+      c.bytes_ = static_cast<size_t>(t.TotalSize()) * sizeof(T);
+      if (c.bytes_ == 0) {
+        return c;
+      }
+
+      auto mgr = MakeManager(algo, chunk_bytes, stream);
+      auto config = mgr->configure_compression(c.bytes_);
+
+      // Compress into a worst-case buffer, then keep only what was used
+      auto scratch = make_tensor<uint8_t>({static_cast<index_t>(config.max_compressed_buffer_size)},
+                                          MATX_ASYNC_DEVICE_MEMORY, stream);
+      mgr->compress(reinterpret_cast<const uint8_t *>(t.Data()), scratch.Data(), config);
+      c.compressed_bytes_ = mgr->get_compressed_output_size(scratch.Data());
+
+      make_tensor(c.device_, {static_cast<index_t>(c.compressed_bytes_)}, MATX_DEVICE_MEMORY);
+      MATX_CUDA_CHECK(cudaMemcpyAsync(c.device_.Data(), scratch.Data(), c.compressed_bytes_,
+                                      cudaMemcpyDeviceToDevice, stream));
+      MATX_LOG_DEBUG("compressed_tensor_t: {} bytes compressed to {}", c.bytes_, c.compressed_bytes_);
+      return c;
+    }
+
+    /**
+     * @brief Decompress into a new tensor in device memory
+     *
+     * @param exec CUDA executor whose stream the decompression runs on
+     * @returns Decompressed tensor
+     */
+    template <typename Executor>
+      requires is_cuda_executor_v<Executor>
+    tensor_t<T, RANK> Decompress(const Executor &exec) {
+      auto t = make_tensor<T>(shape_, MATX_DEVICE_MEMORY);
+      DecompressInto(t, exec);
+      return t;
+    }
+
+    /**
+     * @brief Decompress into an existing tensor
+     *
+     * @param t Contiguous tensor with the compressed tensor's shape
+     * @param exec CUDA executor whose stream the decompression runs on
+     */
+    template <typename TensorType, typename Executor>
+      requires is_cuda_executor_v<Executor>
+    void DecompressInto(TensorType &t, const Executor &exec) {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter, "Decompression requires a contiguous tensor");
+      for (int i = 0; i < RANK; i++) {
+        MATX_ASSERT_STR(t.Size(i) == shape_[i], matxInvalidSize, "Decompression target has the wrong shape");
+      }
+      if (bytes_ == 0) {
+        return;
+      }
+
+      const cudaStream_t stream = exec.getStream();
+      if (IsSpilled()) {
+        Fetch(exec);
+      }
+
+      auto mgr = nvcomp::create_manager(device_.Data(), stream);
+      auto config = mgr->configure_decompression(device_.Data());
+      mgr->decompress(reinterpret_cast<uint8_t *>(t.Data()), device_.Data(), config);
+    }
+
+    /**
+     * @brief Move the compressed data to pinned host memory and free its device memory
+     *
+     * @param exec CUDA executor whose stream the copy runs on
+     */
+    template <typename Executor>
+      requires is_cuda_executor_v<Executor>
+    void Spill(const Executor &exec) {
+      if (IsSpilled() || compressed_bytes_ == 0) {
+        return;
+      }
+
+      const cudaStream_t stream = exec.getStream();
+      make_tensor(host_, {static_cast<index_t>(compressed_bytes_)}, MATX_HOST_MEMORY);
+      MATX_CUDA_CHECK(cudaMemcpyAsync(host_.Data(), device_.Data(), compressed_bytes_, cudaMemcpyDeviceToHost, stream));
+      MATX_CUDA_CHECK(cudaStreamSynchronize(stream));
+      device_ = tensor_t<uint8_t, 1>{};
+    }
+
+    /**
+     * @brief Bring spilled compressed data back to device memory
+     *
+     * @param exec CUDA executor whose stream the copy runs on
+     */
+    template <typename Executor>
+      requires is_cuda_executor_v<Executor>
+    void Fetch(const Executor &exec) {
+      if (!IsSpilled()) {
+        return;
+      }
+
+      const cudaStream_t stream = exec.getStream();
+      make_tensor(device_, {static_cast<index_t>(compressed_bytes_)}, MATX_DEVICE_MEMORY);
+      MATX_CUDA_CHECK(cudaMemcpyAsync(device_.Data(), host_.Data(), compressed_bytes_, cudaMemcpyHostToDevice, stream));
+      MATX_CUDA_CHECK(cudaStreamSynchronize(stream));
+      host_ = tensor_t<uint8_t, 1>{};
+    }
+
+    /**
+     * @brief Whether the compressed data currently lives in host memory
+     */
+    bool IsSpilled() const { return host_.Data() != nullptr; }
+
+    /**
+     * @brief Size of the uncompressed tensor in bytes
+     */
+    size_t Bytes() const { return bytes_; }
+
+    /**
+     * @brief Size of the compressed data in bytes
+     */
+    size_t CompressedBytes() const { return compressed_bytes_; }
+
+    /**
+     * @brief Uncompressed size divided by compressed size
+     */
+    double Ratio() const {
+      return compressed_bytes_ == 0 ? 1.0 : static_cast<double>(bytes_) / static_cast<double>(compressed_bytes_);
+    }
+
+    /**
+     * @brief Algorithm the data was compressed with
+     */
+    CompressionAlgo Algo() const { return algo_; }
+
+    /**
+     * @brief Size of a dimension of the uncompressed tensor
+     */
+    index_t Size(int dim) const { return shape_[dim]; }
+
+  private:
+    static std::unique_ptr<nvcomp::nvcompManagerBase> MakeManager(CompressionAlgo algo, size_t chunk_bytes,
+                                                                  cudaStream_t stream) {
+      switch (algo) {
+        case CompressionAlgo::LZ4:
+          return std::make_unique<nvcomp::LZ4Manager>(chunk_bytes, nvcompBatchedLZ4DefaultOpts, stream);
+        case CompressionAlgo::BITCOMP:
+          return std::make_unique<nvcomp::BitcompManager>(chunk_bytes, nvcompBatchedBitcompDefaultOpts, stream);
+        case CompressionAlgo::ANS:
+          return std::make_unique<nvcomp::ANSManager>(chunk_bytes, nvcompBatchedANSDefaultOpts, stream);
+      }
+      MATX_THROW(matxInvalidParameter, "Unknown compression algorithm");
+    }
+
+    CompressionAlgo algo_ = CompressionAlgo::BITCOMP;
+    cuda::std::array<index_t, RANK> shape_{};
+    size_t bytes_ = 0;
+    size_t compressed_bytes_ = 0;
+    tensor_t<uint8_t, 1> device_;
+    tensor_t<uint8_t, 1> host_;
+};
+
+} // namespace matx
+
+#endif
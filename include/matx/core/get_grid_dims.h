@@ -172,6 +172,49 @@ inline bool get_grid_dims(dim3 &blocks, dim3 &threads, const cuda::std::array<in
   return stride;
 }
 
+/**
+ * Shrink a grid to a persistent launch when it is much larger than the device can hold
+ *
+ * If the grid needs more than `waves` full waves of `max_resident_threads`, it is shrunk by
+ * halving its z, y and then x dimensions until it fits in a single wave. Each thread then
+ * processes several elements through a grid-stride loop instead of the device paying for
+ * launching and retiring many short-lived blocks.
+ *
+ * @param blocks Grid dimensions to shrink
+ * @param threads Block dimensions of the launch
+ * @param max_resident_threads Number of threads of the kernel that fit on the device at once
+ * @param waves Number of waves above which the grid is shrunk
+ * @return true if the grid was shrunk and a grid-stride kernel must be launched
+ */
+inline bool get_persistent_grid_dims(dim3 &blocks, const dim3 &threads, index_t max_resident_threads, index_t waves)
+{
+  const index_t block_threads = static_cast<index_t>(threads.x) * threads.y * threads.z;
+  const auto total_threads = [&]() {
+    return static_cast<index_t>(blocks.x) * blocks.y * blocks.z * block_threads;
+  };
+
+  if (total_threads() <= max_resident_threads * waves) {
+    return false;
+  }
+
+  while (total_threads() > max_resident_threads) {
+    if (blocks.z > 1) {
+      blocks.z = (blocks.z + 1) / 2;
+    }
+    else if (blocks.y > 1) {
+      blocks.y = (blocks.y + 1) / 2;
+    }
+    else if (blocks.x > 1) {
+      blocks.x = (blocks.x + 1) / 2;
+    }
+    else {
+      break;
+    }
+  }
+
+  return true;
+}
+
 // For JIT code we want to use a grid-stride loop always
 template <int RANK>
 inline bool get_grid_dims_block(dim3 &blocks, dim3 &threads, const cuda::std::array<index_t, RANK> &sizes, index_t ept, int groups_per_block,
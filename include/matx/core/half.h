@@ -39,6 +39,7 @@
 
 #include "cuda_bf16.h"
 #include "cuda_fp16.h"
+#include "cuda_fp8.h"
 #include "matx/core/defines.h"
 
 namespace matx {
@@ -47,40 +48,38 @@ namespace matx {
 namespace detail {
 
 /**
- * @brief Constexpr conversion from float to FP16 bits
- * 
+ * @brief Constexpr conversion from float to FP16 bits with round to nearest even
+ *
+ * Branches only select between values, so loops over arrays of halves vectorize on the host.
+ * Subnormal results are rounded by a float addition that aligns the mantissa at the bottom.
+ *
  * @param f Input float value
  * @return uint16_t FP16 bit representation
  */
 constexpr __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ uint16_t float_to_fp16_bits(float f) {
-  // Use bit_cast for constexpr context
+  constexpr uint32_t f32_inf = 255u << 23;
+  constexpr uint32_t f16_max = (127u + 16u) << 23;
+  constexpr uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
   uint32_t bits = cuda::std::bit_cast<uint32_t>(f);
-  
-  uint32_t sign = (bits >> 16) & 0x8000;
-  int32_t exponent = static_cast<int32_t>(((bits >> 23) & 0xff)) - 127 + 15;
-  uint32_t mantissa = (bits >> 13) & 0x3ff;
-  
-  // Handle special cases
-  if (exponent <= 0) {
+  const uint32_t sign = bits & 0x80000000u;
+  bits ^= sign;
+
+  uint32_t out;
+  if (bits >= f16_max) {
+    // Overflow to infinity, or NaN
+    out = bits > f32_inf ? 0x7e00u : 0x7c00u;
+  } else if (bits < (113u << 23)) {
     // Subnormal or zero
-    if (exponent < -10) {
-      // Too small, flush to zero
-      return static_cast<uint16_t>(sign);
-    }
-    // Subnormal
-    mantissa = (mantissa | 0x400) >> (1 - exponent);
-    return static_cast<uint16_t>(sign | mantissa);
-  } else if (exponent >= 0x1f) {
-    // Overflow to infinity or NaN
-    if (exponent == 0x1f + (127 - 15) && mantissa != 0) {
-      // NaN
-      return static_cast<uint16_t>(sign | 0x7e00 | (mantissa != 0 ? 0x200 : 0));
-    }
-    // Infinity
-    return static_cast<uint16_t>(sign | 0x7c00);
+    out = cuda::std::bit_cast<uint32_t>(cuda::std::bit_cast<float>(bits) + cuda::std::bit_cast<float>(denorm_magic)) -
+          denorm_magic;
+  } else {
+    const uint32_t mant_odd = (bits >> 13) & 1u;
+    bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu + mant_odd;
+    out = bits >> 13;
   }
-  
-  return static_cast<uint16_t>(sign | (static_cast<uint32_t>(exponent) << 10) | mantissa);
+
+  return static_cast<uint16_t>(out | (sign >> 16));
 }
 
 /**
@@ -93,7 +92,12 @@ constexpr __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ uint16_t float_to_bf16_b
   // BF16 is just the top 16 bits of a float32
   // With rounding to nearest even
   uint32_t bits = cuda::std::bit_cast<uint32_t>(f);
-  
+
+  // Rounding could carry a NaN payload into the exponent and turn it into infinity, so keep it quiet instead
+  if ((bits & 0x7fffffffu) > 0x7f800000u) {
+    return static_cast<uint16_t>((bits >> 16) | 0x40u);
+  }
+
   // Round to nearest even
   uint32_t rounding_bias = 0x00007FFF + ((bits >> 16) & 1);
   bits += rounding_bias;
@@ -102,6 +106,64 @@ constexpr __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ uint16_t float_to_bf16_b
   return result;
 }
 
+/**
+ * @brief Constexpr conversion from FP16 bits to float
+ *
+ * Exact for every input, including subnormals, infinities, and NaN
+ *
+ * @param h FP16 bit representation
+ * @return float Value as a float
+ */
+constexpr __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ float fp16_bits_to_float(uint16_t h) {
+  constexpr uint32_t shifted_exp = 0x7c00u << 13;
+  constexpr uint32_t magic = 113u << 23;
+
+  uint32_t bits = (static_cast<uint32_t>(h) & 0x7fffu) << 13;
+  const uint32_t exp = bits & shifted_exp;
+  bits += (127u - 15u) << 23;
+
+  if (exp == shifted_exp) {
+    // Infinity or NaN
+    bits += (128u - 16u) << 23;
+  } else if (exp == 0) {
+    // Zero or subnormal, renormalized with a float subtraction
+    bits += 1u << 23;
+    bits = cuda::std::bit_cast<uint32_t>(cuda::std::bit_cast<float>(bits) - cuda::std::bit_cast<float>(magic));
+  }
+
+  return cuda::std::bit_cast<float>(bits | ((static_cast<uint32_t>(h) & 0x8000u) << 16));
+}
+
+/**
+ * @brief Constexpr conversion from BF16 bits to float
+ *
+ * @param h BF16 bit representation
+ * @return float Value as a float
+ */
+constexpr __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ float bf16_bits_to_float(uint16_t h) {
+  return cuda::std::bit_cast<float>(static_cast<uint32_t>(h) << 16);
+}
+
+/**
+ * @brief Convert a half type to float on the host
+ *
+ * The host conversions in the CUDA headers handle each case with branches and loops that keep
+ * element-wise loops from vectorizing. These are plain integer and float operations instead, so the
+ * host executor's inner loop vectorizes with SSE/AVX or NEON/SVE.
+ *
+ * @tparam T The half type (__half or __nv_bfloat16)
+ * @param h Half-precision value
+ * @return float Value as a float
+ */
+template <typename T>
+constexpr __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ float half_to_float(T h) {
+  if constexpr (cuda::std::is_same_v<T, __half>) {
+    return fp16_bits_to_float(cuda::std::bit_cast<uint16_t>(h));
+  } else {
+    return bf16_bits_to_float(cuda::std::bit_cast<uint16_t>(h));
+  }
+}
+
 /**
  * @brief Helper to convert float to half type at compile time
  * 
@@ -224,7 +286,11 @@ template <typename T> struct alignas(sizeof(T)) matxHalf {
    */
   __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ operator float() const
   {
+#ifdef __CUDA_ARCH__
     return static_cast<float>(x);
+#else
+    return detail::half_to_float(x);
+#endif
   }
 
   /**
@@ -481,7 +547,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> operator-(const matxHa
 #ifdef __CUDA_ARCH__
   return {-l.x};
 #else
-  return {-static_cast<float>(l.x)};
+  return {-static_cast<float>(l)};
 #endif
 }
 
@@ -500,7 +566,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool operator==(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return lhs.x == rhs.x;
 #else
-  return static_cast<float>(lhs.x) == static_cast<float>(rhs.x);
+  return static_cast<float>(lhs) == static_cast<float>(rhs);
 #endif
 }
 
@@ -598,7 +664,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool operator>(const matxHalf<T> &
 #ifdef __CUDA_ARCH__
   return lhs.x > rhs.x;
 #else
-  return static_cast<float>(lhs.x) > static_cast<float>(rhs.x);
+  return static_cast<float>(lhs) > static_cast<float>(rhs);
 #endif
 }
 
@@ -617,7 +683,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool operator<(const matxHalf<T> &
 #ifdef __CUDA_ARCH__
   return lhs.x < rhs.x;
 #else
-  return static_cast<float>(lhs.x) < static_cast<float>(rhs.x);
+  return static_cast<float>(lhs) < static_cast<float>(rhs);
 #endif
 }
 
@@ -666,7 +732,7 @@ operator+(const matxHalf<T> &lhs, const matxHalf<T> &rhs)
 #ifdef __CUDA_ARCH__
   return lhs.x + rhs.x;
 #else
-  return static_cast<T>(static_cast<float>(lhs) + static_cast<float>(rhs));
+  return matxHalf<T>(static_cast<float>(lhs) + static_cast<float>(rhs));
 #endif
 }
 
@@ -685,7 +751,7 @@ operator-(const matxHalf<T> &lhs, const matxHalf<T> &rhs)
 #ifdef __CUDA_ARCH__
   return lhs.x - rhs.x;
 #else
-  return static_cast<T>(static_cast<float>(lhs) - static_cast<float>(rhs));
+  return matxHalf<T>(static_cast<float>(lhs) - static_cast<float>(rhs));
 #endif
 }
 
@@ -704,7 +770,7 @@ operator*(const matxHalf<T> &lhs, const matxHalf<T> &rhs)
 #ifdef __CUDA_ARCH__
   return lhs.x * rhs.x;
 #else
-  return static_cast<T>(static_cast<float>(lhs.x) * static_cast<float>(rhs.x));
+  return matxHalf<T>(static_cast<float>(lhs) * static_cast<float>(rhs));
 #endif
 }
 
@@ -723,7 +789,7 @@ operator/(const matxHalf<T> &lhs, const matxHalf<T> &rhs)
 #ifdef __CUDA_ARCH__
   return lhs.x / rhs.x;
 #else
-  return static_cast<T>(static_cast<float>(lhs.x) / static_cast<float>(rhs.x));
+  return matxHalf<T>(static_cast<float>(lhs) / static_cast<float>(rhs));
 #endif
 }
 
@@ -740,7 +806,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> abs(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return __habs(x.x);
 #else
-  return static_cast<T>(cuda::std::abs(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::abs(static_cast<float>(x)));
 #endif
 }
 
@@ -758,7 +824,7 @@ abs(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return __habs(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::abs(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::abs(static_cast<float>(x)));
 #endif
 }
 
@@ -775,7 +841,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> log(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hlog(x.x);
 #else
-  return static_cast<T>(cuda::std::log(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::log(static_cast<float>(x)));
 #endif
 }
 
@@ -792,7 +858,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> sqrt(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hsqrt(x.x);
 #else
-  return static_cast<T>(cuda::std::sqrt(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::sqrt(static_cast<float>(x)));
 #endif
 }
 
@@ -810,7 +876,7 @@ sqrt(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hsqrt(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::sqrt(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::sqrt(static_cast<float>(x)));
 #endif
 }
 
@@ -828,9 +894,9 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> rsqrt(const matxHalf<T
   return hrsqrt(x.x);
 #else
   #ifdef __CUDACC__
-    return static_cast<__nv_bfloat16>(::rsqrt(static_cast<float>(x.x)));
+    return matxHalf<T>(::rsqrt(static_cast<float>(x)));
   #else
-    return static_cast<__nv_bfloat16>(1.f / cuda::std::sqrt(static_cast<float>(x.x)));
+    return matxHalf<T>(1.f / cuda::std::sqrt(static_cast<float>(x)));
   #endif
 #endif
 }
@@ -850,9 +916,9 @@ rsqrt(const matxHalf<__nv_bfloat16> &x)
   return hrsqrt(x.x);
 #else
   #ifdef __CUDACC__
-    return static_cast<__nv_bfloat16>(::rsqrt(static_cast<float>(x.x)));
+    return matxHalf<__nv_bfloat16>(::rsqrt(static_cast<float>(x)));
   #else
-    return static_cast<__nv_bfloat16>(1.f / cuda::std::sqrt(static_cast<float>(x.x)));
+    return matxHalf<__nv_bfloat16>(1.f / cuda::std::sqrt(static_cast<float>(x)));
   #endif
 #endif
 }
@@ -870,7 +936,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ int isinf(const matxHalf<T> &x)
 #ifdef __CUDA_ARCH__
   return __hisinf(x.x);
 #else
-  return static_cast<int>(cuda::std::isinf(static_cast<float>(x.x)));
+  return static_cast<int>(cuda::std::isinf(static_cast<float>(x)));
 #endif
 }
 
@@ -887,7 +953,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ int isinf(const matxHalf<__nv_bflo
 #if __CUDA_ARCH__ >= 800
   return __hisinf(x.x);
 #else
-  return static_cast<int>(cuda::std::isinf(static_cast<float>(x.x)));
+  return static_cast<int>(cuda::std::isinf(static_cast<float>(x)));
 #endif
 }
 
@@ -905,7 +971,7 @@ log(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hlog(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::log(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::log(static_cast<float>(x)));
 #endif
 }
 
@@ -922,7 +988,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> log10(const matxHalf<T
 #ifdef __CUDA_ARCH__
   return hlog10(x.x);
 #else
-  return static_cast<T>(cuda::std::log10(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::log10(static_cast<float>(x)));
 #endif
 }
 
@@ -940,7 +1006,7 @@ log10(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hlog10(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::log10(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::log10(static_cast<float>(x)));
 #endif
 }
 
@@ -957,7 +1023,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> log2(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hlog2(x.x);
 #else
-  return static_cast<T>(cuda::std::log2(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::log2(static_cast<float>(x)));
 #endif
 }
 
@@ -975,7 +1041,7 @@ log2(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hlog2(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::log2(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::log2(static_cast<float>(x)));
 #endif
 }
 
@@ -992,7 +1058,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> exp(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hexp(x.x);
 #else
-  return static_cast<T>(cuda::std::exp(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::exp(static_cast<float>(x)));
 #endif
 }
 
@@ -1010,7 +1076,7 @@ exp(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hexp(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::exp(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::exp(static_cast<float>(x)));
 #endif
 }
 
@@ -1075,7 +1141,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> floor(const matxHalf<T
 #ifdef __CUDA_ARCH__
   return hfloor(x.x);
 #else
-  return static_cast<T>(cuda::std::floor(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::floor(static_cast<float>(x)));
 #endif
 }
 
@@ -1093,7 +1159,7 @@ floor(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hfloor(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::floor(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::floor(static_cast<float>(x)));
 #endif
 }
 
@@ -1110,7 +1176,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> ceil(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hceil(x.x);
 #else
-  return static_cast<T>(cuda::std::ceil(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::ceil(static_cast<float>(x)));
 #endif
 }
 
@@ -1128,7 +1194,7 @@ ceil(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hceil(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::ceil(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::ceil(static_cast<float>(x)));
 #endif
 }
 
@@ -1145,7 +1211,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> round(const matxHalf<T
 #ifdef __CUDA_ARCH__
   return hrint(x.x);
 #else
-  return static_cast<T>(cuda::std::round(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::round(static_cast<float>(x)));
 #endif
 }
 
@@ -1163,7 +1229,7 @@ round(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hrint(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::round(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::round(static_cast<float>(x)));
 #endif
 }
 
@@ -1225,7 +1291,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> sin(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hsin(x.x);
 #else
-  return static_cast<T>(cuda::std::sin(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::sin(static_cast<float>(x)));
 #endif
 }
 
@@ -1243,7 +1309,7 @@ sin(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hsin(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::sin(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::sin(static_cast<float>(x)));
 #endif
 }
 
@@ -1260,7 +1326,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> cos(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hcos(x.x);
 #else
-  return static_cast<T>(cuda::std::cos(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::cos(static_cast<float>(x)));
 #endif
 }
 
@@ -1278,7 +1344,7 @@ cos(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hcos(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::cos(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::cos(static_cast<float>(x)));
 #endif
 }
 
@@ -1430,6 +1496,8 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> tanh(const matxHalf<T>
 
 using matxFp16 = matxHalf<__half>; ///< Alias for fp16
 using matxBf16 = matxHalf<__nv_bfloat16>; ///< Alias for bf16
+using matxFp8E4M3 = __nv_fp8_e4m3; ///< Alias for fp8 with 4 exponent and 3 mantissa bits
+using matxFp8E5M2 = __nv_fp8_e5m2; ///< Alias for fp8 with 5 exponent and 2 mantissa bits
 
 }; // namespace matx
 
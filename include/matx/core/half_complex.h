@@ -592,7 +592,12 @@ template <typename T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalfComplex<T>
 operator+(const matxHalfComplex<T> &lhs, const matxHalfComplex<T> &rhs)
 {
+#ifdef __CUDA_ARCH__
   return {lhs.x + rhs.x, lhs.y + rhs.y};
+#else
+  return {static_cast<float>(lhs.x) + static_cast<float>(rhs.x),
+          static_cast<float>(lhs.y) + static_cast<float>(rhs.y)};
+#endif
 }
 
 /**
@@ -607,7 +612,12 @@ template <typename T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalfComplex<T>
 operator-(const matxHalfComplex<T> &lhs, const matxHalfComplex<T> &rhs)
 {
+#ifdef __CUDA_ARCH__
   return {lhs.x - rhs.x, lhs.y - rhs.y};
+#else
+  return {static_cast<float>(lhs.x) - static_cast<float>(rhs.x),
+          static_cast<float>(lhs.y) - static_cast<float>(rhs.y)};
+#endif
 }
 
 
@@ -623,7 +633,17 @@ template <typename T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalfComplex<T>
 operator*(const matxHalfComplex<T> &lhs, const matxHalfComplex<T> &rhs)
 {
+#ifdef __CUDA_ARCH__
   return {lhs.x * rhs.x - lhs.y * rhs.y, lhs.x * rhs.y + lhs.y * rhs.x};
+#else
+  // Accumulate in float and round once per component, which is both faster and more accurate than
+  // rounding each partial product to half
+  const float ar = static_cast<float>(lhs.x);
+  const float ai = static_cast<float>(lhs.y);
+  const float br = static_cast<float>(rhs.x);
+  const float bi = static_cast<float>(rhs.y);
+  return {ar * br - ai * bi, ar * bi + ai * br};
+#endif
 }
 
 /**
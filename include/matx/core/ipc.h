@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <memory>
+#include <type_traits>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/tensor.h"
+
+namespace matx
+{
+
+/**
+ * @brief Description of a device tensor that can be sent to another process on the same node
+ *
+ * The handle is trivially copyable, so it can be written to a pipe, socket, or shared memory as raw bytes. It
+ * refers to the allocation holding the tensor, the offset of the tensor's first element within it, the
+ * tensor's shape and strides, and an interprocess event used to order the consumer after the producer.
+ *
+ * @tparam T Element type
+ * @tparam RANK Tensor rank
+ */
+template <typename T, int RANK>
+struct ipcTensorHandle {
+  cudaIpcMemHandle_t mem;                 ///< Handle of the allocation holding the tensor
+  cudaIpcEventHandle_t event;             ///< Handle of the producer's completion event
+  size_t offset;                          ///< Byte offset of the first element from the start of the allocation
+  cuda::std::array<index_t, RANK> shape;  ///< Tensor shape
+  cuda::std::array<index_t, RANK> strides;///< Tensor strides in elements
+  int device;                             ///< Device of the allocation
+};
+
+/**
+ * @brief Producer side of a tensor shared with other processes through CUDA IPC
+ *
+ * Exports a view of a tensor in MATX_DEVICE_MEMORY so another process can map it with ipcTensorImport and read
+ * or write it in place. Memory from stream-ordered pools (MATX_ASYNC_DEVICE_MEMORY), managed memory, and host
+ * memory cannot be exported with this interface.
+ *
+ * The export keeps the tensor's storage alive, but the importing process does not: the exporter must outlive
+ * every importer's use of the memory. After issuing the work that produces the tensor, call Record() and only
+ * then notify the consumer, whose ipcTensorImport::Wait() orders its stream after the most recent Record().
+ *
+ * @tparam T Element type
+ * @tparam RANK Tensor rank
+ */
+template <typename T, int RANK>
+class ipcTensorExport {
+  public:
+    /**
+     * @brief Export a tensor
+     *
+     * @param t Tensor in device memory allocated with cudaMalloc
+     */
+    template <typename TensorType>
+      requires is_tensor<TensorType>
+    explicit ipcTensorExport(const TensorType &t) : tensor_(t) {
+      static_assert(std::is_same_v<typename TensorType::value_type, T> && TensorType::Rank() == RANK,
+                    "ipcTensorExport type and rank must match the tensor");
+
+      cudaPointerAttributes attr;
+      MATX_CUDA_CHECK(cudaPointerGetAttributes(&attr, t.Data()));
+      MATX_ASSERT_STR(attr.type == cudaMemoryTypeDevice, matxInvalidParameter,
+                      "Only device memory can be shared with CUDA IPC");
+
+      CUdeviceptr base;
+      size_t alloc_size;
+      const auto res = cuMemGetAddressRange(&base, &alloc_size, reinterpret_cast<CUdeviceptr>(t.Data()));
+      MATX_ASSERT_STR(res == CUDA_SUCCESS, matxCudaError, "Failed to find the allocation holding the tensor");
+
+      MATX_CUDA_CHECK(cudaIpcGetMemHandle(&handle_.mem, reinterpret_cast<void *>(base)));
+      MATX_CUDA_CHECK(cudaEventCreateWithFlags(&event_, cudaEventDisableTiming | cudaEventInterprocess));
+      MATX_CUDA_CHECK(cudaIpcGetEventHandle(&handle_.event, event_));
+
+      handle_.offset = static_cast<size_t>(reinterpret_cast<CUdeviceptr>(t.Data()) - base);
+      for (int i = 0; i < RANK; i++) {
+        handle_.shape[i] = t.Size(i);
+        handle_.strides[i] = t.Stride(i);
+      }
+      handle_.device = attr.device;
+      MATX_LOG_DEBUG("ipcTensorExport: ptr={} offset={} device={}", reinterpret_cast<void *>(t.Data()),
+                     handle_.offset, handle_.device);
+    }
+
+    ~ipcTensorExport() {
+      cudaEventDestroy(event_);
+    }
+
+    ipcTensorExport(const ipcTensorExport &) = delete;
+    ipcTensorExport &operator=(const ipcTensorExport &) = delete;
+
+    /**
+     * @brief Handle to send to the importing process
+     */
+    const ipcTensorHandle<T, RANK> &Handle() const { return handle_; }
+
+    /**
+     * @brief Mark the tensor ready once all work currently issued on the executor has finished
+     *
+     * @param exec CUDA executor that produced the tensor
+     */
+    template <typename Executor>
+      requires is_cuda_executor_v<Executor>
+    void Record(const Executor &exec) const {
+      MATX_CUDA_CHECK(cudaEventRecord(event_, exec.getStream()));
+    }
+
+  private:
+    tensor_t<T, RANK> tensor_;
+    ipcTensorHandle<T, RANK> handle_{};
+    cudaEvent_t event_ = nullptr;
+};
+
+/**
+ * @brief Consumer side of a tensor shared by another process through CUDA IPC
+ *
+ * Maps the exporter's allocation into this process and exposes the exported view as a regular tensor without
+ * copying. The mapping is released when the last copy of Tensor() is destroyed. The current device must be the
+ * device the tensor was exported from.
+ *
+ * @tparam T Element type
+ * @tparam RANK Tensor rank
+ */
+template <typename T, int RANK>
+class ipcTensorImport {
+  public:
+    /**
+     * @brief Map a tensor exported by another process
+     *
+     * @param handle Handle received from the exporting process
+     */
+    explicit ipcTensorImport(const ipcTensorHandle<T, RANK> &handle) {
+      int dev;
+      MATX_CUDA_CHECK(cudaGetDevice(&dev));
+      MATX_ASSERT_STR(dev == handle.device, matxInvalidParameter,
+                      "ipcTensorImport must be created on the device the tensor was exported from");
+
+      void *base = nullptr;
+      MATX_CUDA_CHECK(cudaIpcOpenMemHandle(&base, handle.mem, cudaIpcMemLazyEnablePeerAccess));
+      const auto res = cudaIpcOpenEventHandle(&event_, handle.event);
+      if (res != cudaSuccess) {
+        cudaIpcCloseMemHandle(base);
+        MATX_CUDA_CHECK(res);
+      }
+
+      auto mapping = std::shared_ptr<T>(static_cast<T *>(base), [](T *p) {
+        cudaIpcCloseMemHandle(static_cast<void *>(p));
+      });
+      T *ldata = reinterpret_cast<T *>(static_cast<uint8_t *>(base) + handle.offset);
+
+      // Elements spanned by the view, from its first element to its last
+      size_t span = 1;
+      for (int i = 0; i < RANK; i++) {
+        span += static_cast<size_t>((handle.shape[i] - 1) * handle.strides[i]);
+      }
+
+      auto shape = handle.shape;
+      auto strides = handle.strides;
+      DefaultDescriptor<RANK> desc{std::move(shape), std::move(strides)};
+      tensor_ = tensor_t<T, RANK>{make_storage_from_shared_ptr<T>(std::move(mapping), span), std::move(desc), ldata};
+    }
+
+    ~ipcTensorImport() {
+      cudaEventDestroy(event_);
+    }
+
+    ipcTensorImport(const ipcTensorImport &) = delete;
+    ipcTensorImport &operator=(const ipcTensorImport &) = delete;
+
+    /**
+     * @brief Imported tensor
+     */
+    tensor_t<T, RANK> &Tensor() { return tensor_; }
+    const tensor_t<T, RANK> &Tensor() const { return tensor_; }
+
+    /**
+     * @brief Make the executor wait until the producer's last Record() has completed
+     *
+     * @param exec CUDA executor reading the tensor
+     */
+    template <typename Executor>
+      requires is_cuda_executor_v<Executor>
+    void Wait(const Executor &exec) const {
+      MATX_CUDA_CHECK(cudaStreamWaitEvent(exec.getStream(), event_, 0));
+    }
+
+  private:
+    tensor_t<T, RANK> tensor_;
+    cudaEvent_t event_ = nullptr;
+};
+
+} // namespace matx
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef MATX_EN_JIT
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "matx/core/error.h"
+
+namespace matx {
+
+namespace detail {
+
+// 64-bit FNV-1a hash used to fingerprint JIT inputs and cached cubins
+inline uint64_t jit_fnv1a_hash(const char *data, size_t size, uint64_t hash = 14695981039346656037ULL) {
+  for (size_t i = 0; i < size; i++) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+inline std::string jit_hash_to_string(uint64_t hash) {
+  char hash_str[17];
+  snprintf(hash_str, sizeof(hash_str), "%016llx", static_cast<unsigned long long>(hash));
+  return std::string(hash_str);
+}
+
+// Prefix of the LTO-IR symbols that refer to user functions rather than to entries in the LTO-IR cache
+inline constexpr const char *jit_function_symbol_prefix = "matx_jit_function:";
+
+struct JITFunction {
+  std::vector<char> ltoir;
+  std::string hash;
+};
+
+inline std::mutex jit_function_mutex; ///< Mutex protecting the user function registry
+
+inline auto &JITFunctionRegistry() {
+  // Protected by jit_function_mutex
+  static std::unordered_map<std::string, std::shared_ptr<const JITFunction>> registry;
+  return registry;
+}
+
+/**
+ * Look up a registered user function
+ *
+ * The returned pointer stays valid if the function is registered again or unregistered while it is used.
+ *
+ * @param name Function name
+ * @return Registered function, or nullptr if there is none with that name
+ */
+inline std::shared_ptr<const JITFunction> GetJITFunction(const std::string &name) {
+  std::lock_guard<std::mutex> lock(jit_function_mutex);
+  const auto it = JITFunctionRegistry().find(name);
+  return it == JITFunctionRegistry().end() ? nullptr : it->second;
+}
+
+inline bool IsJITFunctionName(const std::string &name) {
+  if (name.empty() || (name[0] >= '0' && name[0] <= '9')) {
+    return false;
+  }
+  for (const char c : name) {
+    if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end namespace detail
+
+/**
+ * @brief Register a precompiled device function for use in JIT-compiled kernels
+ *
+ * The function must be compiled to LTO-IR, for example with nvcc -dlto -dc or NVRTC with -dlto, for an
+ * architecture the JIT executor can link against. It is declared with C linkage, so its symbol name is the
+ * plain function name. Once registered, apply_ltoir() calls it from expressions run on the CUDAJITExecutor,
+ * and nvJitLink optimizes it together with the rest of the fused kernel.
+ *
+ * Registering a name again replaces its LTO-IR. Kernels already compiled against the old code stay cached,
+ * and expressions built afterwards compile against the new code.
+ *
+ * @param name Name of the extern "C" device function
+ * @param ltoir LTO-IR of the function
+ * @param bytes Size of the LTO-IR in bytes
+ */
+inline void RegisterJITFunction(const std::string &name, const void *ltoir, size_t bytes) {
+  // The name is pasted into generated source, so it is checked in release builds too
+  if (!detail::IsJITFunctionName(name)) {
+    MATX_THROW(matxInvalidParameter, "JIT function name must be a C identifier: " + name);
+  }
+  if (ltoir == nullptr || bytes == 0) {
+    MATX_THROW(matxInvalidParameter, "LTO-IR of JIT function " + name + " is empty");
+  }
+
+  const char *data = static_cast<const char *>(ltoir);
+  auto fn = std::make_shared<detail::JITFunction>();
+  fn->ltoir.assign(data, data + bytes);
+  fn->hash = detail::jit_hash_to_string(detail::jit_fnv1a_hash(data, bytes));
+
+  std::lock_guard<std::mutex> lock(detail::jit_function_mutex);
+  detail::JITFunctionRegistry()[name] = std::move(fn);
+}
+
+/**
+ * @brief Register a precompiled device function from an LTO-IR file
+ *
+ * @param name Name of the extern "C" device function
+ * @param ltoir_path Path to a file holding the LTO-IR of the function
+ */
+inline void RegisterJITFunction(const std::string &name, const std::string &ltoir_path) {
+  std::ifstream file(ltoir_path, std::ios::binary);
+  if (!file) {
+    MATX_THROW(matxInvalidParameter, "Failed to open LTO-IR file " + ltoir_path);
+  }
+
+  const std::vector<char> ltoir{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  RegisterJITFunction(name, ltoir.data(), ltoir.size());
+}
+
+/**
+ * @brief Remove a registered device function
+ *
+ * @param name Name the function was registered with
+ * @return True if a function was removed
+ */
+inline bool UnregisterJITFunction(const std::string &name) {
+  std::lock_guard<std::mutex> lock(detail::jit_function_mutex);
+  return detail::JITFunctionRegistry().erase(name) > 0;
+}
+
+} // end namespace matx
+
+#endif
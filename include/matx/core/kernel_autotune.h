@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <any>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+#include "matx/core/cache.h"
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/executors/cuda.h"
+
+namespace matx {
+namespace detail {
+
+// Number of timed launches per candidate, after one untimed warmup launch
+static constexpr int KERNEL_AUTOTUNE_ITERS = 5;
+
+// Winning candidate per tuning key. The key describes the launch (kernel family, types and
+// shape) and the common cache key adds the device, so each GPU is tuned separately.
+using kernel_autotune_cache_t = std::unordered_map<std::string, std::any>;
+
+inline std::atomic<bool> &KernelAutotuneEnabled() {
+  static std::atomic<bool> enabled = []() {
+    const char *env = std::getenv("MATX_KERNEL_AUTOTUNE");
+    return env != nullptr && std::strcmp(env, "0") != 0;
+  }();
+  return enabled;
+}
+
+/**
+ * Pick the fastest of several interchangeable kernel launches, benchmarking once per key
+ *
+ * launch(i) must enqueue candidate i on the stream and return false if the candidate does not
+ * apply to this problem. Every candidate must write the same result to the same output, since the
+ * benchmark runs them on the caller's real buffers. The first call for a key synchronizes the
+ * stream while it times the candidates; later calls only look up the cached winner.
+ *
+ * @param key Description of the launch. Everything that can change the winner must be encoded.
+ * @param num_candidates Number of candidates
+ * @param launch Launch function for a candidate index
+ * @param stream CUDA stream to benchmark on
+ * @returns Index of the fastest candidate, or -1 if autotuning is disabled, the stream is being
+ * captured, or no candidate applies. The caller then falls back to its heuristic.
+ */
+template <typename LaunchFn>
+inline int KernelAutotuneSelect(const std::string &key, int num_candidates, const LaunchFn &launch,
+                                cudaStream_t stream)
+{
+  if (!KernelAutotuneEnabled().load()) {
+    return -1;
+  }
+
+  cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+  MATX_CUDA_CHECK(cudaStreamIsCapturing(stream, &capture_status));
+  if (capture_status != cudaStreamCaptureStatusNone) {
+    return -1;
+  }
+
+  int best = -1;
+  GetCache().LookupAndExec<kernel_autotune_cache_t>(
+    GetCacheIdFromType<kernel_autotune_cache_t>(),
+    key,
+    [&]() {
+      cudaEvent_t start, stop;
+      MATX_CUDA_CHECK(cudaEventCreate(&start));
+      MATX_CUDA_CHECK(cudaEventCreate(&stop));
+
+      int winner = -1;
+      float best_ms = std::numeric_limits<float>::max();
+      for (int i = 0; i < num_candidates; i++) {
+        // Warmup, which also skips candidates that do not apply
+        if (!launch(i)) {
+          continue;
+        }
+        MATX_CUDA_CHECK(cudaGetLastError());
+
+        MATX_CUDA_CHECK(cudaEventRecord(start, stream));
+        for (int iter = 0; iter < KERNEL_AUTOTUNE_ITERS; iter++) {
+          launch(i);
+        }
+        MATX_CUDA_CHECK(cudaEventRecord(stop, stream));
+        MATX_CUDA_CHECK(cudaEventSynchronize(stop));
+
+        float ms;
+        MATX_CUDA_CHECK(cudaEventElapsedTime(&ms, start, stop));
+        MATX_LOG_DEBUG("Kernel autotune {} candidate {}: {} ms", key, i, ms / KERNEL_AUTOTUNE_ITERS);
+        if (ms < best_ms) {
+          best_ms = ms;
+          winner = i;
+        }
+      }
+
+      cudaEventDestroy(start);
+      cudaEventDestroy(stop);
+      MATX_LOG_DEBUG("Kernel autotune {} selected candidate {}", key, winner);
+      return winner;
+    },
+    [&](int winner) {
+      best = winner;
+    },
+    cudaExecutor{stream});
+
+  return best;
+}
+
+} // end namespace detail
+
+/**
+ * Enable or disable kernel autotuning for transforms with several interchangeable kernels
+ *
+ * Transforms such as resample_poly and channelize_poly pick a kernel and block size with a fixed
+ * heuristic. When autotuning is enabled, the first call with a new shape on each device benchmarks
+ * the candidates instead and the fastest one is remembered in the MatX cache for the rest of the
+ * process. Autotuning can also be enabled by setting the environment variable
+ * MATX_KERNEL_AUTOTUNE=1. Calls made while the stream is captured into a CUDA graph use the
+ * heuristic.
+ *
+ * @param enable Whether to autotune
+ */
+__MATX_INLINE__ void SetKernelAutotune(bool enable) {
+  detail::KernelAutotuneEnabled().store(enable);
+}
+
+} // end namespace matx
@@ -44,8 +44,15 @@
 #define MATX_HAS_STD_FORMAT 0
 #endif
 
+// Lowest log level compiled in, using the values of LogLevel (0 = TRACE through 6 = OFF). Calls below it
+// are removed at compile time along with their arguments, so they cost nothing regardless of MATX_LOG_LEVEL.
+#ifndef MATX_LOG_COMPILE_LEVEL
+#define MATX_LOG_COMPILE_LEVEL 0
+#endif
+
 #if MATX_HAS_STD_FORMAT
 
+#include <atomic>
 #include <format>
 #include <source_location>
 #include <iostream>
@@ -195,6 +202,9 @@ inline std::string format_timestamp() {
  */
 class Logger {
 private:
+  // Copy of min_level_ for the logging macros, or -1 before the logger is created
+  static inline std::atomic<int> cached_level_{-1};
+
   LogLevel min_level_;
   std::unique_ptr<std::ostream> file_stream_;
   std::ostream* output_stream_;
@@ -235,6 +245,12 @@ private:
         }
       }
     }
+
+    publish_level();
+  }
+
+  void publish_level() {
+    cached_level_.store(static_cast<int>(min_level_), std::memory_order_relaxed);
   }
   
 public:
@@ -256,6 +272,21 @@ public:
   bool is_enabled(LogLevel level) const {
     return level >= min_level_ && min_level_ != LogLevel::OFF;
   }
+
+  /**
+   * @brief Check if a log level is enabled without going through the singleton
+   *
+   * Used by the logging macros, so a disabled call on a hot path costs one relaxed atomic load and a
+   * compare. The first call creates the logger to read the environment.
+   */
+  static bool enabled(LogLevel level) {
+    int min_level = cached_level_.load(std::memory_order_relaxed);
+    if (min_level < 0) {
+      min_level = static_cast<int>(instance().get_min_level());
+    }
+
+    return static_cast<int>(level) >= min_level && min_level != static_cast<int>(LogLevel::OFF);
+  }
   
   /**
    * @brief Log a message
@@ -316,6 +347,7 @@ public:
    */
   void set_min_level(LogLevel level) {
     min_level_ = level;
+    publish_level();
   }
   
   /**
@@ -332,6 +364,7 @@ public:
     } else {
       min_level_ = LogLevel::OFF;
     }
+    publish_level();
     
     // Re-read whether to show function names
     const char* func_env = std::getenv("MATX_LOG_FUNC");
@@ -374,12 +407,17 @@ public:
 /**
  * @brief Main logging macro with minimal overhead when disabled
  * 
+ * Levels below MATX_LOG_COMPILE_LEVEL are discarded at compile time. Otherwise the arguments are only
+ * evaluated and formatted when the level is enabled at runtime. The level must be a constant expression.
+ *
  * Usage: MATX_LOG(matx::detail::LogLevel::INFO, "Message: {}", value);
  */
 #define MATX_LOG(level, ...) \
   do { \
-    if (::matx::detail::Logger::instance().is_enabled(level)) { \
-      ::matx::detail::Logger::instance().log(level, std::source_location::current(), __VA_ARGS__); \
+    if constexpr (static_cast<int>(level) >= MATX_LOG_COMPILE_LEVEL) { \
+      if (::matx::detail::Logger::enabled(level)) { \
+        ::matx::detail::Logger::instance().log(level, std::source_location::current(), __VA_ARGS__); \
+      } \
     } \
   } while(0)
 
@@ -205,6 +205,38 @@ auto make_zero_tensor_csc(const index_t (&shape)[2],
        makeZeroStorage<POS>(shape[1] + 1, space)});
 }
 
+// Constructs a sparse matrix in BSR format with M x N blocks directly from
+// the values, the block row positions, and block column coordinates vectors.
+// The blocks should be sorted by block row, then block column. Duplicate
+// blocks should not occur. The values of each block are stored consecutively
+// in row-major order, or in column-major order for the BSRCol format.
+template <int M, int N, bool ROW = true, typename ValTensor, typename PosTensor,
+          typename CrdTensor>
+auto make_tensor_bsr(ValTensor &val, PosTensor &rowp, CrdTensor &col,
+                     const index_t (&shape)[2]) {
+  using VAL = typename ValTensor::value_type;
+  using CRD = typename CrdTensor::value_type;
+  using POS = typename PosTensor::value_type;
+  // Proper structure.
+  MATX_STATIC_ASSERT_STR(ValTensor::Rank() == 1 && PosTensor::Rank() == 1 &&
+                             CrdTensor::Rank() == 1,
+                         matxInvalidParameter, "data arrays should be rank-1");
+  MATX_ASSERT_STR(shape[0] % M == 0 && shape[1] % N == 0, matxInvalidParameter,
+                  "shape should be a multiple of the block size");
+  MATX_ASSERT_STR(rowp.Size(0) == shape[0] / M + 1, matxInvalidParameter,
+                  "block row positions array should have length #rows/M + 1");
+  MATX_ASSERT_STR(val.Size(0) == col.Size(0) * M * N, matxInvalidParameter,
+                  "data arrays should have consistent length (nse)");
+  // Construct BSR.
+  using BLK = std::conditional_t<ROW, BSR<M, N>, BSRCol<M, N>>;
+  return sparse_tensor_t<VAL, CRD, POS, BLK>(
+      shape, val.GetStorage(),
+      {makeEmptyStorage<CRD>(), col.GetStorage(), makeEmptyStorage<CRD>(),
+       makeEmptyStorage<CRD>()},
+      {makeEmptyStorage<POS>(), rowp.GetStorage(), makeEmptyStorage<POS>(),
+       makeEmptyStorage<POS>()});
+}
+
 // Constructs a sparse matrix in DIA format directly from the values and the
 // offset vectors. For an m x n matrix, this format uses a linearized storage
 // where each diagonal has m or n entries and is accessed by either index I or
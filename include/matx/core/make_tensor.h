@@ -52,7 +52,7 @@ template <typename T, int RANK>
 auto make_tensor( const index_t (&shape)[RANK],
                   matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                   cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   for (int i = 0; i < RANK; i++) {
@@ -78,7 +78,7 @@ auto make_tensor( const index_t (&shape)[RANK],
 template <typename T, typename ShapeType>
   requires (!is_matx_descriptor<ShapeType> && !std::is_array_v<remove_cvref_t<ShapeType>>)
 auto make_tensor(Storage<T> storage, ShapeType &&shape) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor<T,ShapeType>(storage, shape): ptr={}", reinterpret_cast<const void*>(storage.data()));
 
@@ -101,7 +101,7 @@ void make_tensor( TensorType &tensor,
                   const index_t (&shape)[TensorType::Rank()],
                   matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                   cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   for (int i = 0; i < TensorType::Rank(); i++) {
@@ -129,7 +129,7 @@ template <typename T, int RANK>
 auto make_tensor_p( const index_t (&shape)[RANK],
                     matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                     cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   for (int i = 0; i < RANK; i++) {
@@ -164,7 +164,7 @@ template <typename T, typename ShapeType>
 auto make_tensor( ShapeType &&shape,
                   matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                   cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor<T,ShapeType>(shape, space, stream): space={}, stream={}", 
                  static_cast<int>(space), reinterpret_cast<void*>(stream));
@@ -198,7 +198,7 @@ auto make_tensor( TensorType &tensor,
                   ShapeType &&shape,
                   matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                   cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor(tensor&, shape, space, stream): space={}, stream={}", 
                  static_cast<int>(space), reinterpret_cast<void*>(stream));
@@ -225,7 +225,7 @@ template <typename T, typename ShapeType>
 auto make_tensor_p( ShapeType &&shape,
                     matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                     cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor_p<T,ShapeType>(shape, space, stream): space={}, stream={}", 
                  static_cast<int>(space), reinterpret_cast<void*>(stream));
@@ -313,7 +313,7 @@ template <typename T, int RANK>
 auto make_tensor( T *data,
                   const index_t (&shape)[RANK],
                   bool owning = false) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   for (int i = 0; i < RANK; i++) {
@@ -345,7 +345,7 @@ template <typename TensorType>
 auto make_tensor( TensorType &tensor,
                   typename TensorType::value_type *data,
                   const index_t (&shape)[TensorType::Rank()]) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   for (int i = 0; i < TensorType::Rank(); i++) {
@@ -378,7 +378,7 @@ template <typename T, typename ShapeType>
 auto make_tensor( T *data,
                   ShapeType &&shape,
                   bool owning = false) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor<T,ShapeType>(data, shape, owning): ptr={}, owning={}", 
                  reinterpret_cast<void*>(data), owning);
@@ -406,7 +406,7 @@ template <typename TensorType>
 auto make_tensor( TensorType &tensor,
                   typename TensorType::value_type *data,
                   typename TensorType::shape_container &&shape) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor(tensor&, data, shape): ptr={}", reinterpret_cast<void*>(data));
   
@@ -452,6 +452,64 @@ auto make_tensor( TensorType &tensor,
   tensor.Shallow(tmp);
 }
 
+/**
+ * Create a tensor from existing host memory and page-lock it for asynchronous copies and device access
+ *
+ * Pageable host memory silently turns asynchronous copies into synchronous ones. This registers the memory with
+ * cudaHostRegister so copies to and from it are truly asynchronous and, with the default flags, kernels can read
+ * and write it directly over the bus. The registration is held by the tensor's storage and released with
+ * cudaHostUnregister when the last view of it is destroyed. The memory itself is never freed by MatX, so it must
+ * outlive every view. Memory that is already registered is wrapped without changing its registration.
+ *
+ * @param data
+ *   Pointer to host memory
+ * @param shape
+ *   Shape of tensor
+ * @param flags
+ *   Flags passed to cudaHostRegister
+ * @returns New tensor
+ **/
+template <typename T, int RANK>
+auto make_tensor_registered( T *data,
+                             const index_t (&shape)[RANK],
+                             unsigned int flags = cudaHostRegisterMapped | cudaHostRegisterPortable) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  MATX_LOG_DEBUG("make_tensor_registered<T,RANK>(data, shape, flags): ptr={}, flags={}",
+                 reinterpret_cast<void*>(data), flags);
+
+  DefaultDescriptor<RANK> desc{shape};
+  auto storage = make_registered_storage<T>(data, desc.TotalSize(), flags);
+  return tensor_t<T, RANK, decltype(desc)>{std::move(storage), std::move(desc)};
+}
+
+/**
+ * Create a tensor from existing host memory with a conforming shape type and page-lock it
+ *
+ * @param data
+ *   Pointer to host memory
+ * @param shape
+ *   Shape of tensor
+ * @param flags
+ *   Flags passed to cudaHostRegister
+ * @returns New tensor
+ **/
+template <typename T, typename ShapeType>
+  requires (!is_matx_descriptor<ShapeType> &&
+            !std::is_array_v<remove_cvref_t<ShapeType>> &&
+            is_tuple_c<remove_cvref_t<ShapeType>>)
+auto make_tensor_registered( T *data,
+                             ShapeType &&shape,
+                             unsigned int flags = cudaHostRegisterMapped | cudaHostRegisterPortable) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  MATX_LOG_DEBUG("make_tensor_registered<T,ShapeType>(data, shape, flags): ptr={}, flags={}",
+                 reinterpret_cast<void*>(data), flags);
+
+  constexpr int RANK = static_cast<int>(cuda::std::tuple_size<typename remove_cvref<ShapeType>::type>::value);
+  DefaultDescriptor<RANK> desc{std::forward<ShapeType>(shape)};
+  auto storage = make_registered_storage<T>(data, desc.TotalSize(), flags);
+  return tensor_t<T, RANK, decltype(desc)>{std::move(storage), std::move(desc)};
+}
+
 
 
 /**
@@ -472,7 +530,7 @@ template <typename T, typename ShapeType>
 auto make_tensor_p( T *const data,
                     ShapeType &&shape,
                     bool owning = false) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor_p<T,ShapeType>(data, shape, owning): ptr={}, owning={}", 
                  reinterpret_cast<const void*>(data), owning);
@@ -496,7 +554,7 @@ auto make_tensor_p( T *const data,
 template <typename T, int RANK, typename Allocator>
 auto make_tensor( const index_t (&shape)[RANK],
                   Allocator&& alloc) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   for (int i = 0; i < RANK; i++) {
@@ -525,7 +583,7 @@ template <typename T, typename ShapeType, typename Allocator>
             !std::is_array_v<remove_cvref_t<ShapeType>>)
 auto make_tensor( ShapeType &&shape,
                   Allocator&& alloc) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor<T,ShapeType,Allocator>(shape, alloc)");
 
@@ -550,7 +608,7 @@ template <typename TensorType, typename Allocator>
 void make_tensor( TensorType &tensor,
                   const index_t (&shape)[TensorType::Rank()],
                   Allocator&& alloc) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   for (int i = 0; i < TensorType::Rank(); i++) {
@@ -580,7 +638,7 @@ template <typename TensorType, typename ShapeType, typename Allocator>
 void make_tensor( TensorType &tensor,
                   ShapeType &&shape,
                   Allocator&& alloc) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor(tensor&, shape, alloc)");
 
@@ -605,7 +663,7 @@ template <typename T, typename D>
 auto make_tensor( T* const data,
                   D &&desc,
                   bool owning = false) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor<T,D>(data, desc, owning): ptr={}, owning={}", 
                  reinterpret_cast<const void*>(data), owning);
@@ -631,7 +689,7 @@ template <typename TensorType>
 auto make_tensor( TensorType &tensor,
                   typename TensorType::value_type* const data,
                   typename TensorType::desc_type &&desc) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor(tensor&, data, desc): ptr={}", reinterpret_cast<const void*>(data));
 
@@ -653,7 +711,7 @@ template <typename T, typename D>
 auto make_tensor( D &&desc,
                   matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                   cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor<T,D>(desc, space, stream): space={}, stream={}", 
                  static_cast<int>(space), reinterpret_cast<void*>(stream));
@@ -679,7 +737,7 @@ auto make_tensor( TensorType &&tensor,
                   typename TensorType::desc_type &&desc,
                   matxMemorySpace_t space = MATX_MANAGED_MEMORY,
                   cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_tensor(tensor&&, desc, space, stream): space={}, stream={}", 
                  static_cast<int>(space), reinterpret_cast<void*>(stream));
@@ -706,7 +764,7 @@ auto make_tensor( T *const data,
                   const index_t (&shape)[RANK],
                   const index_t (&strides)[RANK],
                   bool owning = false) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   std::string strides_str = "[";
@@ -744,7 +802,7 @@ auto make_tensor( TensorType &tensor,
                   typename TensorType::value_type *const data,
                   const index_t (&shape)[TensorType::Rank()],
                   const index_t (&strides)[TensorType::Rank()]) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   std::string shape_str = "[";
   std::string strides_str = "[";
@@ -769,7 +827,7 @@ auto make_tensor( TensorType &tensor,
  **/
 template <typename T, index_t I, index_t ...Is>
 auto make_static_tensor() {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   MATX_LOG_DEBUG("make_static_tensor<T,I,Is...>()");
 
@@ -778,23 +836,21 @@ auto make_static_tensor() {
   return tensor_t<T, desc.Rank(), decltype(desc)>{std::move(storage), std::move(desc)};
 }
 
-template <typename TensorType>
-  requires is_tensor<TensorType>
-auto make_tensor( TensorType &tensor,
-                  const DLManagedTensor dlp_tensor) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
-  
-  MATX_LOG_DEBUG("make_tensor(tensor&, DLManagedTensor): ptr={}", dlp_tensor.dl_tensor.data);
-
-  using T = typename TensorType::value_type;
-  const DLTensor &dt = dlp_tensor.dl_tensor;
+namespace detail {
 
-  // MatX doesn't track the memory type or device ID, so we don't need to copy it
-  MATX_ASSERT_STR_EXP(dt.ndim, TensorType::Rank(), matxInvalidDim, "DLPack rank doesn't match MatX rank!");
+/**
+ * Validate that a DLPack data type matches the MatX value type T
+ *
+ * @param dtype
+ *   DLPack data type of the incoming tensor
+ **/
+template <typename T>
+void CheckDLPackType(const DLDataType &dtype) {
+  MATX_ASSERT_STR(dtype.lanes == 1, matxInvalidType, "Vectorized DLPack types are not supported");
 
-  switch (dt.dtype.code) {
+  switch (dtype.code) {
     case kDLComplex: {
-      switch (dt.dtype.bits) {
+      switch (dtype.bits) {
         case 128: {
           [[maybe_unused]] constexpr bool same = std::is_same_v<T, cuda::std::complex<double>>;
           MATX_ASSERT_STR(same, matxInvalidType, "DLPack/MatX type mismatch");
@@ -817,7 +873,7 @@ auto make_tensor( TensorType &tensor,
     }
 
     case kDLFloat: {
-      switch (dt.dtype.bits) {
+      switch (dtype.bits) {
         case 64: {
           [[maybe_unused]] constexpr bool same = std::is_same_v<T, double>;
           MATX_ASSERT_STR(same, matxInvalidType, "DLPack/MatX type mismatch");
@@ -839,7 +895,7 @@ auto make_tensor( TensorType &tensor,
       break;
     }
     case kDLInt: {
-      switch (dt.dtype.bits) {
+      switch (dtype.bits) {
         case 64: {
           [[maybe_unused]] constexpr bool same = std::is_same_v<T, int64_t>;
           MATX_ASSERT_STR(same, matxInvalidType, "DLPack/MatX type mismatch");
@@ -866,7 +922,7 @@ auto make_tensor( TensorType &tensor,
       break;
     }
     case kDLUInt: {
-      switch (dt.dtype.bits) {
+      switch (dtype.bits) {
         case 64: {
           [[maybe_unused]] constexpr bool same = std::is_same_v<T, uint64_t>;
           MATX_ASSERT_STR(same, matxInvalidType, "DLPack/MatX type mismatch");
@@ -898,18 +954,164 @@ auto make_tensor( TensorType &tensor,
       break;
     }
   }
+}
 
-  index_t strides[TensorType::Rank()];
-  index_t shape[TensorType::Rank()];
+/**
+ * Validate a DLTensor against a MatX tensor type and extract its layout
+ *
+ * DLPack allows a null strides array to denote a compact row-major tensor, and the data pointer
+ * is offset by byte_offset before the first element. Both are folded in here so every importer
+ * sees the same explicit layout.
+ *
+ * @param dt
+ *   DLPack tensor
+ * @param shape
+ *   Shape of the MatX tensor
+ * @param strides
+ *   Strides of the MatX tensor in elements
+ * @returns Pointer to the first element
+ **/
+template <typename TensorType>
+typename TensorType::value_type *DLPackLayout(const DLTensor &dt,
+                                              index_t (&shape)[TensorType::Rank()],
+                                              index_t (&strides)[TensorType::Rank()]) {
+  using T = typename TensorType::value_type;
 
-  for (int r = 0; r < TensorType::Rank(); r++) {
-    strides[r] = dt.strides[r];
+  // MatX doesn't track the memory type or device ID, so we don't need to copy it
+  MATX_ASSERT_STR_EXP(dt.ndim, TensorType::Rank(), matxInvalidDim, "DLPack rank doesn't match MatX rank!");
+  CheckDLPackType<T>(dt.dtype);
+  MATX_ASSERT_STR(dt.byte_offset % sizeof(T) == 0, matxInvalidParameter, "DLPack byte offset is not a multiple of the element size");
+
+  index_t stride = 1;
+  for (int r = TensorType::Rank() - 1; r >= 0; r--) {
     shape[r]   = dt.shape[r];
+    strides[r] = dt.strides == nullptr ? stride : dt.strides[r];
+    stride    *= shape[r];
   }
 
-  auto tmp = make_tensor<typename TensorType::value_type, TensorType::Rank()>(
-          reinterpret_cast<typename TensorType::value_type*>(dt.data), shape, strides, false);
+  return reinterpret_cast<T*>(static_cast<uint8_t*>(dt.data) + dt.byte_offset);
+}
+
+/**
+ * Wrap a DLPack tensor in a MatX tensor that releases the producer's memory when the last
+ * reference to it goes away
+ *
+ * @param tensor
+ *   Tensor object to store newly-created tensor into
+ * @param dlp_tensor
+ *   DLPack managed tensor (legacy or versioned). Ownership is taken
+ **/
+template <typename TensorType, typename DLManaged>
+void DLPackImport(TensorType &tensor, DLManaged *dlp_tensor) {
+  using T = typename TensorType::value_type;
+  constexpr int RANK = TensorType::Rank();
+
+  index_t strides[RANK];
+  index_t shape[RANK];
+  T *data;
+
+  // The managed tensor is still ours if validation fails, so return it to the producer
+  try {
+    data = DLPackLayout<TensorType>(dlp_tensor->dl_tensor, shape, strides);
+  }
+  catch (...) {
+    if (dlp_tensor->deleter != nullptr) {
+      dlp_tensor->deleter(dlp_tensor);
+    }
+    throw;
+  }
+
+  DefaultDescriptor<RANK> desc{shape, strides};
+  auto ptr = std::shared_ptr<T>(data, [dlp_tensor](T*) {
+    if (dlp_tensor->deleter != nullptr) {
+      dlp_tensor->deleter(dlp_tensor);
+    }
+  });
+
+  auto tmp = tensor_t<T, RANK, decltype(desc)>{make_storage_from_shared_ptr<T>(ptr, desc.TotalSize()), std::move(desc), data};
+  tensor.Shallow(tmp);
+}
+
+} // namespace detail
+
+/**
+ * Create a non-owning tensor that views a DLPack tensor
+ *
+ * The DLPack tensor is not consumed; the producer must keep the memory alive for as long as the
+ * MatX tensor is used. Use the pointer overload to transfer ownership instead.
+ *
+ * @param tensor
+ *   Tensor object to store newly-created tensor into
+ * @param dlp_tensor
+ *   DLPack managed tensor
+ **/
+template <typename TensorType>
+  requires is_tensor<TensorType>
+auto make_tensor( TensorType &tensor,
+                  const DLManagedTensor dlp_tensor) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  
+  MATX_LOG_DEBUG("make_tensor(tensor&, DLManagedTensor): ptr={}", dlp_tensor.dl_tensor.data);
+
+  index_t strides[TensorType::Rank()];
+  index_t shape[TensorType::Rank()];
+  auto data = detail::DLPackLayout<TensorType>(dlp_tensor.dl_tensor, shape, strides);
+
+  auto tmp = make_tensor<typename TensorType::value_type, TensorType::Rank()>(data, shape, strides, false);
   tensor.Shallow(tmp);
 }
 
+/**
+ * Create a tensor that takes ownership of a DLPack tensor without copying
+ *
+ * The tensor aliases the producer's memory, including any byte offset and strides, and calls the
+ * DLPack deleter once the last MatX reference to the memory is released. This is the consumer side
+ * of tensor_t::ToDlPack() and of the capsules returned by `__dlpack__` in PyTorch, CuPy, and JAX.
+ * On any validation error the deleter is called before the exception propagates.
+ *
+ * @param tensor
+ *   Tensor object to store newly-created tensor into
+ * @param dlp_tensor
+ *   DLPack managed tensor. Ownership is transferred to tensor
+ **/
+template <typename TensorType>
+  requires is_tensor<TensorType>
+auto make_tensor( TensorType &tensor,
+                  DLManagedTensor *dlp_tensor) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  
+  MATX_LOG_DEBUG("make_tensor(tensor&, DLManagedTensor*): ptr={}", dlp_tensor->dl_tensor.data);
+
+  detail::DLPackImport(tensor, dlp_tensor);
+}
+
+/**
+ * Create a tensor that takes ownership of a versioned DLPack tensor without copying
+ *
+ * Same as the DLManagedTensor overload, but for DLPack 1.x producers. Tensors from a producer with
+ * an incompatible major version are rejected (and released) as required by the DLPack ABI.
+ *
+ * @param tensor
+ *   Tensor object to store newly-created tensor into
+ * @param dlp_tensor
+ *   Versioned DLPack managed tensor. Ownership is transferred to tensor
+ **/
+template <typename TensorType>
+  requires is_tensor<TensorType>
+auto make_tensor( TensorType &tensor,
+                  DLManagedTensorVersioned *dlp_tensor) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  
+  MATX_LOG_DEBUG("make_tensor(tensor&, DLManagedTensorVersioned*): ptr={}", dlp_tensor->dl_tensor.data);
+
+  if (dlp_tensor->version.major != DLPACK_MAJOR_VERSION) {
+    if (dlp_tensor->deleter != nullptr) {
+      dlp_tensor->deleter(dlp_tensor);
+    }
+    MATX_THROW(matxInvalidParameter, "Unsupported DLPack major version");
+  }
+
+  detail::DLPackImport(tensor, dlp_tensor);
+}
+
 } // namespace matx
@@ -37,10 +37,13 @@
 #include <cuda.h>
 
 #include <nvrtc.h>
+#include <array>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <unordered_map>
 #include <matx/core/cache.h>  
+#include "matx/core/jit_functions.h"
 #include <matx/core/log.h>
 
 #include "matx/executors/jit_kernel.h"
@@ -165,6 +168,37 @@ inline std::string get_jit_includes_path() {
     return (matx_root / "include" / "matx" / "core" / "jit_includes.h").string();
 }
 
+// Contents of jit_includes.h. The file only changes between builds, so it is read once per process
+inline const std::string &get_jit_includes_content() {
+  static const std::string content = read_file_contents(get_jit_includes_path());
+  return content;
+}
+
+// Tag identifying everything outside the operator type that affects the generated cubin: the CUDA
+// runtime and NVRTC versions, the target architecture, the MatX JIT headers, and the compute
+// capability of the current device. It is folded into every on-disk cache key so that entries
+// produced by a different toolkit, MatX version, or GPU are never loaded.
+inline std::string get_jit_cache_tag() {
+  static const std::string build_tag = [] {
+    int nvrtc_major = 0;
+    int nvrtc_minor = 0;
+    NVRTC_CHECK(nvrtcVersion(&nvrtc_major, &nvrtc_minor));
+    const auto &includes = get_jit_includes_content();
+    return std::string("cudart") + std::to_string(CUDART_VERSION) +
+           "_nvrtc" + std::to_string(nvrtc_major) + "." + std::to_string(nvrtc_minor) +
+           "_arch" + std::string(NVRTC_CUDA_ARCH) +
+           "_inc" + jit_hash_to_string(jit_fnv1a_hash(includes.data(), includes.size()));
+  }();
+
+  int device;
+  int cc_major;
+  int cc_minor;
+  CUDA_RT_CHECK(cudaGetDevice(&device));
+  CUDA_RT_CHECK(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
+  CUDA_RT_CHECK(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
+  return build_tag + "_sm" + std::to_string(cc_major) + std::to_string(cc_minor);
+}
+
 template <typename Op>
 std::string get_kernel_name([[maybe_unused]] const Op &op, bool stride, bool global_kernel, bool pass_through_threads = false) {
   if constexpr (Op::Rank() == 0) {
@@ -208,8 +242,55 @@ std::string get_kernel_name([[maybe_unused]] const Op &op, bool stride, bool glo
   return "MatXInvalidKernel";
 }
 
+/**
+ * @brief Find pointer slots of a JIT kernel parameter that hold the same device address
+ *
+ * An expression such as where(abs(x) > t, abs(x), 0) carries a separate copy of x's pointer for each use, so
+ * the compiler has to assume the copies differ and evaluates each abs(x) subtree on its own. Pointer-sized
+ * slots of the parameter that hold the same device address are found here. The kernel is then compiled
+ * assuming they are equal, which lets the compiler's common subexpression elimination compute identical
+ * subtrees once per element and keep the result in a register.
+ *
+ * @param storage JIT storage passed as the kernel parameter
+ * @return Pairs of byte offsets: a repeated slot and the first slot holding the same address
+ */
+template <typename Storage>
+std::vector<std::pair<size_t, size_t>> jit_aliased_pointer_slots(const Storage &storage) {
+  std::vector<std::pair<size_t, size_t>> aliases;
+  constexpr size_t num_slots = sizeof(Storage) / sizeof(void *);
+  if constexpr (num_slots > 1) {
+    std::array<uintptr_t, num_slots> slots;
+    memcpy(slots.data(), &storage, sizeof(slots));
+
+    std::unordered_map<uintptr_t, size_t> first_slot;
+    for (size_t i = 0; i < num_slots; i++) {
+      if (slots[i] == 0) {
+        continue;
+      }
+
+      const auto [it, inserted] = first_slot.try_emplace(slots[i], i);
+      if (inserted) {
+        continue;
+      }
+
+      // Only addresses the device can read are assumed equal; repeated scalars and padding are left alone
+      cudaPointerAttributes attr{};
+      if (cudaPointerGetAttributes(&attr, reinterpret_cast<const void *>(slots[i])) != cudaSuccess) {
+        cudaGetLastError();
+        continue;
+      }
+      if (attr.type == cudaMemoryTypeDevice || attr.type == cudaMemoryTypeManaged) {
+        aliases.emplace_back(i * sizeof(void *), it->second * sizeof(void *));
+      }
+    }
+  }
+
+  return aliases;
+}
+
 template <typename Op>
-std::string generate_capability_params_string([[maybe_unused]] const Op &op, ElementsPerThread EPT, bool JIT, int osize, int block_size, bool pass_through_threads = false) {
+std::string generate_capability_params_string([[maybe_unused]] const Op &op, ElementsPerThread EPT, bool JIT, int osize, int block_size, bool pass_through_threads = false,
+                                              const std::vector<std::pair<size_t, size_t>> &aliases = {}) {
   std::string ept_str;
   switch (EPT) {
     case ElementsPerThread::ONE:
@@ -238,6 +319,21 @@ std::string generate_capability_params_string([[maybe_unused]] const Op &op, Ele
   std::string jit_str = JIT ? "true" : "false";
 
   std::string pass_through_str = pass_through_threads ? "true" : "false";
+
+  // Kernels call this on entry so the compiler knows which pointers in the parameter are the same
+  std::string assume_str =
+         "template <typename Op>\n"
+         "__MATX_INLINE__ __MATX_DEVICE__ void JitAssumeAliasedPointers([[maybe_unused]] const Op &op) {\n";
+  if (!aliases.empty()) {
+    assume_str += "  if constexpr (!cuda::std::is_pointer_v<Op>) {\n"
+                  "    const char *base = reinterpret_cast<const char *>(&op);\n";
+    for (const auto &[slot, first] : aliases) {
+      assume_str += "    __builtin_assume(*reinterpret_cast<void *const *>(base + " + std::to_string(slot) +
+                    ") == *reinterpret_cast<void *const *>(base + " + std::to_string(first) + "));\n";
+    }
+    assume_str += "  }\n";
+  }
+  assume_str += "}\n";
   
   std::string final_str =  
          "namespace matx { namespace detail {\n"
@@ -249,7 +345,8 @@ std::string generate_capability_params_string([[maybe_unused]] const Op &op, Ele
          "  static constexpr int block_size = " + std::to_string(block_size) + ";\n"
          "  static constexpr bool pass_through_threads = " + pass_through_str + ";\n"
          "};\n"
-         "using CurrentCapabilities = CapabilityParams<" + ept_str + ", " + jit_str + ">;\n"
+         "using CurrentCapabilities = CapabilityParams<" + ept_str + ", " + jit_str + ">;\n" +
+         assume_str +
          "} }\n";
    
   return final_str;
@@ -304,30 +401,148 @@ inline std::string qualify_jit_type_names(const std::string& type_str) {
   return result;
 }
 
-template <typename Op, typename SizeArray>
-auto nvrtc_compile_and_run([[maybe_unused]] const std::string &name, Op op, const SizeArray &sa, dim3 &blocks, dim3 &threads, ElementsPerThread ept, bool stride, int dynamic_shmem_size, int osize, bool global_kernel, bool pass_through_threads = false) {
-  // Pure NVRTC implementation
-  // Cache both module and function to prevent resource leaks
-  // CUmodule must remain loaded for CUfunction to be valid
-  struct CachedKernel {
-    CUmodule module;
-    CUfunction function;
+/**
+ * @brief Compile a standalone device function that evaluates an operator to LTO-IR
+ *
+ * This is used for library callbacks, such as cuFFT LTO callbacks, that call into a MatX operator from
+ * inside a library kernel. The source may reference the operator's JIT type and
+ * matx::detail::CurrentCapabilities. Results are cached in memory by source and JIT classes.
+ *
+ * @param op Operator whose JIT classes the source uses
+ * @param source Device function source
+ * @return LTO-IR for the source
+ */
+template <typename Op>
+const std::vector<char> &nvrtc_get_device_function_ltoir(const Op &op, const std::string &source) {
+  static std::unordered_map<std::string, std::vector<char>> ltoir_cache;
+  static std::mutex ltoir_cache_mutex;
+
+  const auto all_jit_classes_string = get_all_jit_classes_string(op);
+  const auto capstr = generate_capability_params_string(op, ElementsPerThread::ONE, false, 1, 1);
+  const std::string cache_key = source + "|" + all_jit_classes_string;
+
+  {
+    std::lock_guard<std::mutex> lock(ltoir_cache_mutex);
+    auto it = ltoir_cache.find(cache_key);
+    if (it != ltoir_cache.end()) {
+      return it->second;
+    }
+  }
+
+  MATX_LOG_DEBUG("Compiling device function with NVRTC:\n{}", source);
+
+  const std::string &jit_includes_content = get_jit_includes_content();
+  const int numHeaders = 3;
+  const char* headers[numHeaders] = {
+    jit_includes_content.c_str(),
+    capstr.c_str(),
+    all_jit_classes_string.c_str()
   };
-  static std::unordered_map<std::string, CachedKernel> kernel_cache;
-  static std::mutex kernel_cache_mutex;
-  
+  const char* includeNames[numHeaders] = {
+    "matx/core/jit_includes.h",
+    "matx_generated_code_hdr",
+    "matx_class_strings"
+  };
+
+  nvrtcProgram prog;
+  NVRTC_CHECK(nvrtcCreateProgram(&prog, source.c_str(), "matx_device_function.cu",
+                                 numHeaders, headers, includeNames));
+
+  auto options = get_preprocessor_options();
+  options.push_back("-include=matx/core/jit_includes.h");
+  options.push_back("-include=matx_generated_code_hdr");
+  options.push_back("-include=matx_class_strings");
+  options.push_back("--relocatable-device-code=true");
+  options.push_back("-dlto");
+
+  std::vector<const char*> opts;
+  for (const auto& opt : options) {
+    opts.push_back(opt.c_str());
+  }
+  nvrtcResult compile_result = nvrtcCompileProgram(prog, static_cast<int>(opts.size()), opts.data());
+
+  size_t log_size;
+  NVRTC_CHECK(nvrtcGetProgramLogSize(prog, &log_size));
+  if (log_size > 1) {
+    std::vector<char> log(log_size);
+    NVRTC_CHECK(nvrtcGetProgramLog(prog, log.data()));
+    MATX_LOG_DEBUG("NVRTC Compilation log:\n{}", log.data());
+  }
+
+  if (compile_result != NVRTC_SUCCESS) {
+    nvrtcDestroyProgram(&prog);
+    MATX_THROW(matxInvalidParameter, "NVRTC compilation of device function failed");
+  }
+
+  size_t lto_size = 0;
+  NVRTC_CHECK(nvrtcGetLTOIRSize(prog, &lto_size));
+  std::vector<char> ltoir(lto_size);
+  NVRTC_CHECK(nvrtcGetLTOIR(prog, ltoir.data()));
+  NVRTC_CHECK(nvrtcDestroyProgram(&prog));
+
+  // Entries are never removed, so the reference stays valid after the lock is released
+  std::lock_guard<std::mutex> lock(ltoir_cache_mutex);
+  return ltoir_cache.try_emplace(cache_key, std::move(ltoir)).first->second;
+}
+
+// Loaded JIT kernels for every operator type. The module must stay loaded for the function to be valid.
+struct JITCachedKernel {
+  CUmodule module;
+  CUfunction function;
+};
+
+struct JITKernelCache {
+  std::unordered_map<std::string, JITCachedKernel> kernels;
+  std::mutex mutex;
+};
+
+inline JITKernelCache &GetJITKernelCache() {
+  static JITKernelCache cache;
+  return cache;
+}
+
+/**
+ * @brief Unload every JIT kernel held in memory
+ *
+ * Later launches reload kernels from the on-disk cache or recompile them. No kernel from the cache may
+ * still be running.
+ */
+inline void ClearJITKernelCache() {
+  auto &cache = GetJITKernelCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  for (auto &[key, kernel] : cache.kernels) {
+    cuModuleUnload(kernel.module);
+  }
+  cache.kernels.clear();
+}
+
+/**
+ * @brief Get the JIT kernel for an operator, compiling it with NVRTC if it is not already cached
+ *
+ * Lookups go through the in-process module cache, then the on-disk cubin cache, before compiling.
+ * This is safe to call from any thread that has the target device current.
+ */
+template <typename Op>
+CUfunction nvrtc_get_kernel(const Op &op, const dim3 &threads, ElementsPerThread ept, bool stride, int osize, bool global_kernel, bool pass_through_threads = false) {
+  auto &kernel_cache = GetJITKernelCache().kernels;
+  auto &kernel_cache_mutex = GetJITKernelCache().mutex;
+
   const auto all_jit_classes_string = get_all_jit_classes_string(op);
-  auto capstr = generate_capability_params_string(op, ept, false, osize, threads.x, pass_through_threads);
+  const auto aliases = jit_aliased_pointer_slots(op.ToJITStorage());
+  auto capstr = generate_capability_params_string(op, ept, false, osize, threads.x, pass_through_threads, aliases);
   const auto kernel_op_type = detail::get_operator_capability<OperatorCapability::JIT_TYPE_QUERY>(op);
   
   std::string kernel_name = get_kernel_name(op, stride, global_kernel, pass_through_threads);
   std::string cache_key = kernel_name + "_" + kernel_op_type;
+  // A kernel compiled with aliasing assumptions is only valid for launches with the same aliasing
+  for (const auto &[slot, first] : aliases) {
+    cache_key += "_A" + std::to_string(slot) + "=" + std::to_string(first);
+  }
 
   MATX_LOG_DEBUG("nvrtc_compile_and_run called with operator type: {}", typeid(op).name());
   
   CUfunction kernel_func;
   std::string lowered_name;
-  const auto cubin_filename = detail::GetCache().TypeStringToFilename(kernel_op_type);
   
   // Check if kernel is already compiled and cached in memory
   {
@@ -335,49 +550,65 @@ auto nvrtc_compile_and_run([[maybe_unused]] const std::string &name, Op op, cons
     auto it = kernel_cache.find(cache_key);
     if (it != kernel_cache.end()) {
       // Found in memory cache - use cached function (module is already loaded)
-      kernel_func = it->second.function;
-      goto launch_kernel;
+      return it->second.function;
     }
   }
   
   // Not in memory cache, check disk cache (outside lock to minimize critical section)
   {
+    // The on-disk key covers every input to the compilation, not only the operator type, so a stale
+    // or foreign cubin is never picked up
+    const auto cubin_filename = detail::GetCache().TypeStringToFilename(
+        kernel_op_type + "|" + kernel_name + "|" + capstr + "|" + all_jit_classes_string + "|" + get_jit_cache_tag());
     auto cached_cubin_ptr = detail::GetCache().GetLTOIRCachedBytes(cubin_filename);
     
     if (cached_cubin_ptr != nullptr) {
-      // Found cached cubin on disk, try to load metadata
-      lowered_name = detail::GetCache().GetLTOIRMetadata(cubin_filename);
+      // Found cached cubin on disk, try to load metadata. The metadata is the lowered kernel name
+      // followed by a hash of the cubin contents, which is checked before the module is loaded.
+      const auto metadata = detail::GetCache().GetLTOIRMetadata(cubin_filename);
+      const auto sep = metadata.find('\n');
+      const auto expected_hash = jit_hash_to_string(jit_fnv1a_hash(cached_cubin_ptr->data, cached_cubin_ptr->length));
       
-      if (!lowered_name.empty()) {
+      if (sep != std::string::npos && metadata.substr(sep + 1) == expected_hash) {
+        lowered_name = metadata.substr(0, sep);
         MATX_LOG_DEBUG("Loading cached kernel for type: {}", kernel_op_type);
         MATX_LOG_DEBUG("Cached lowered name: {}", lowered_name);
         
-        // Load the cached cubin into a CUDA module
+        // Load the cached cubin into a CUDA module. A cubin that fails to load is treated as a
+        // cache miss rather than an error.
         CUmodule module;
-        CUDA_CHECK(cuModuleLoadDataEx(&module, cached_cubin_ptr->data, 0, nullptr, nullptr));
-        
-        // Get kernel function using the cached lowered name
-        CUDA_CHECK(cuModuleGetFunction(&kernel_func, module, lowered_name.c_str()));
-        
-        // Cache both module and function to prevent resource leak
-        // Module must stay loaded for function to remain valid
-        {
-          std::lock_guard<std::mutex> lock(kernel_cache_mutex);
-          kernel_cache[cache_key] = CachedKernel{module, kernel_func};
+        bool loaded = cuModuleLoadDataEx(&module, cached_cubin_ptr->data, 0, nullptr, nullptr) == CUDA_SUCCESS;
+        if (loaded && cuModuleGetFunction(&kernel_func, module, lowered_name.c_str()) != CUDA_SUCCESS) {
+          cuModuleUnload(module);
+          loaded = false;
         }
-        
-        // Skip compilation since we loaded from cache
-        goto launch_kernel;
+
+        if (loaded) {
+          // Cache both module and function to prevent resource leak
+          // Module must stay loaded for function to remain valid
+          {
+            std::lock_guard<std::mutex> lock(kernel_cache_mutex);
+            auto [it, inserted] = kernel_cache.try_emplace(cache_key, JITCachedKernel{module, kernel_func});
+            if (!inserted) {
+              // Another thread loaded the same kernel first
+              cuModuleUnload(module);
+              kernel_func = it->second.function;
+            }
+          }
+          
+          // Skip compilation since we loaded from cache
+          return kernel_func;
+        }
+
+        MATX_LOG_WARN("Cached kernel {} could not be loaded, recompiling", cubin_filename);
       } else {
-        MATX_LOG_DEBUG("Found cached cubin but no metadata, recompiling");
+        MATX_LOG_DEBUG("Found cached cubin with missing or mismatched metadata, recompiling");
       }
     }
     
     MATX_LOG_DEBUG("Compiling kernel with NVRTC for type: {}", kernel_op_type);
     
-    // Read jit_includes.h content
-    std::string jit_includes_path = get_jit_includes_path();
-    std::string jit_includes_content = read_file_contents(jit_includes_path);
+    const std::string &jit_includes_content = get_jit_includes_content();
     //MATX_ASSERT_STR(jit_includes_content == "", matxInvalidParameter, "Failed to read jit_includes.h");
     
     // Construct the main kernel source that includes headers by name
@@ -482,6 +713,19 @@ auto nvrtc_compile_and_run([[maybe_unused]] const std::string &name, Op op, cons
 
     // First add all our LTO-IR from the operator
     for (const auto& lto : ltoir_query_input.ltoir_symbols) {
+      // User functions come from their own registry so that clearing the LTO-IR cache never drops them
+      if (lto.starts_with(detail::jit_function_symbol_prefix)) {
+        const auto fn_name = lto.substr(std::char_traits<char>::length(detail::jit_function_symbol_prefix));
+        const auto fn = detail::GetJITFunction(fn_name);
+        if (fn == nullptr) {
+          MATX_THROW(matxInvalidParameter, "JIT function not registered: " + fn_name);
+        }
+
+        MATX_LOG_TRACE("Adding LTOIR for user function {}, size={} bytes", fn_name, fn->ltoir.size());
+        NVJITLINK_CHECK(handle, nvJitLinkAddData(handle, NVJITLINK_INPUT_LTOIR, fn->ltoir.data(), fn->ltoir.size(), fn_name.c_str()));
+        continue;
+      }
+
       const auto ltoir_ptr = detail::GetCache().GetLTOIRCachedBytes(lto);
       if (ltoir_ptr == nullptr) {
         std::string error_msg = "LTOIR not found in cache: " + lto;
@@ -515,7 +759,8 @@ auto nvrtc_compile_and_run([[maybe_unused]] const std::string &name, Op op, cons
 
     // Store the entire linked kernel to the cache along with the lowered name
     detail::GetCache().StoreLTOIRCachedBytes(cubin_filename, static_cast<const char*>(cubin.data()), cubin_size);
-    detail::GetCache().StoreLTOIRMetadata(cubin_filename, lowered_name);
+    detail::GetCache().StoreLTOIRMetadata(cubin_filename,
+        lowered_name + "\n" + jit_hash_to_string(jit_fnv1a_hash(cubin.data(), cubin_size)));
 
     
     // Load LTO-IR into CUDA module
@@ -529,11 +774,22 @@ auto nvrtc_compile_and_run([[maybe_unused]] const std::string &name, Op op, cons
     // Module must stay loaded for function to remain valid
     {
       std::lock_guard<std::mutex> lock(kernel_cache_mutex);
-      kernel_cache[cache_key] = CachedKernel{module, kernel_func};
+      auto [it, inserted] = kernel_cache.try_emplace(cache_key, JITCachedKernel{module, kernel_func});
+      if (!inserted) {
+        // Another thread compiled the same kernel first
+        cuModuleUnload(module);
+        kernel_func = it->second.function;
+      }
     }
   }
-  
-launch_kernel:
+
+  return kernel_func;
+}
+
+template <typename Op, typename SizeArray>
+auto nvrtc_compile_and_run([[maybe_unused]] const std::string &name, Op op, const SizeArray &sa, dim3 &blocks, dim3 &threads, ElementsPerThread ept, bool stride, int dynamic_shmem_size, int osize, bool global_kernel, bool pass_through_threads = false) {
+  CUfunction kernel_func = nvrtc_get_kernel(op, threads, ept, stride, osize, global_kernel, pass_through_threads);
+
   // Get device attributes
   int device;
   CUDA_RT_CHECK(cudaGetDevice(&device));
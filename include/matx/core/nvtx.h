@@ -31,6 +31,7 @@
 /////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <mutex>
@@ -93,6 +94,19 @@ inline std::mutex                    nvtx_memory_mtx; ///< Mutex protecting upda
 inline matx_nvxtLogLevels globalNvtxLevel = matx_nvxtLogLevels::MATX_NVTX_LOG_API;
 inline nvtxDomainHandle_t matxDomain = nvtxDomainCreateA("MatX");
 
+/// Name of the innermost user or API level range open on this thread, or nullptr if there is none.
+/// Internal ranges don't change it, so it names the operator or transform doing the work.
+inline thread_local const char *nvtxCurrentRangeName = nullptr;
+
+/**
+ * @brief Range name registered with the MatX domain, kept alongside its text
+ */
+struct NvtxRegisteredName
+{
+  nvtxStringHandle_t handle;
+  std::string text;
+};
+
 //////  macros to ensure custom variable names for every call  ////////
 #define MATX_CONCAT(a, b) MATX_CONCAT_INNER(a, b)
 #define MATX_CONCAT_INNER(a, b) a ## b
@@ -103,12 +117,21 @@ inline nvtxDomainHandle_t matxDomain = nvtxDomainCreateA("MatX");
 
 ////////////             Enable NVTX Macros          /////////////////
 
+// Ranges above this level are compiled out entirely, so their messages are never built. Defaults to
+// keeping every level and filtering at runtime with setNVTXLogLevel().
+#ifndef MATX_NVTX_MAX_LEVEL
+  #define MATX_NVTX_MAX_LEVEL matx::MATX_NVTX_LOG_ALL
+#endif
+
 #ifdef MATX_NVTX_FLAGS
 
   ///\todo update to use C++20 runtime fucntion for actual call location
   /// https://en.cppreference.com/w/cpp/utility/source_location
-  #define MATX_NVTX_1( message ) matx::NvtxEvent MATX_UNIQUE_NAME(nvtxFlag_)( __FUNCTION__, message );
-  #define MATX_NVTX_2( message, nvtxLevel ) matx::NvtxEvent MATX_UNIQUE_NAME(nvtxFlag_)( __FUNCTION__, message, nvtxLevel );
+  // The message is only evaluated when the level is enabled
+  #define MATX_NVTX_1( message ) matx::NvtxEvent MATX_UNIQUE_NAME(nvtxFlag_) = \
+      matx::nvtxLevelEnabled<matx::MATX_NVTX_LOG_USER>() ? matx::NvtxEvent( __FUNCTION__, message ) : matx::NvtxEvent(0);
+  #define MATX_NVTX_2( message, nvtxLevel ) matx::NvtxEvent MATX_UNIQUE_NAME(nvtxFlag_) = \
+      matx::nvtxLevelEnabled<nvtxLevel>() ? matx::NvtxEvent( __FUNCTION__, message, nvtxLevel ) : matx::NvtxEvent(0);
 
   #define MATX_NVTX_X(x,A,B,FUNC, ...)  FUNC
 
@@ -118,6 +141,26 @@ inline nvtxDomainHandle_t matxDomain = nvtxDomainCreateA("MatX");
                                 MATX_NVTX_1(__VA_ARGS__)\
                                 )
 
+  // Cached variants for hot paths. The message is evaluated and registered with NVTX the first time
+  // the call site runs in each template instantiation, and later calls reuse the string handle, so
+  // the message should only depend on types such as get_type_str(). Sizes belong in the optional
+  // payload, an integer attached to the range such as the number of elements processed.
+  #define MATX_NVTX_CACHED_2( message, nvtxLevel ) MATX_NVTX_CACHED_3( message, nvtxLevel, 0 )
+  #define MATX_NVTX_CACHED_3( message, nvtxLevel, payload ) matx::NvtxEvent MATX_UNIQUE_NAME(nvtxFlag_) = \
+      matx::nvtxLevelEnabled<nvtxLevel>() ? \
+        matx::NvtxEvent( [&](const char *nvtxFunc) { \
+            static const matx::NvtxRegisteredName nvtxName = matx::nvtxRegisterName( message, nvtxFunc ); \
+            return &nvtxName; \
+          }(__FUNCTION__), nvtxLevel, static_cast<uint64_t>(payload) ) : \
+        matx::NvtxEvent(0);
+
+  #define MATX_NVTX_CACHED_X(x,A,B,C,FUNC, ...)  FUNC
+
+  #define MATX_NVTX_START_CACHED(...)  MATX_NVTX_CACHED_X(,##__VA_ARGS__,\
+                                       MATX_NVTX_CACHED_3(__VA_ARGS__),\
+                                       MATX_NVTX_CACHED_2(__VA_ARGS__),\
+                                       )
+
                            
   #define MATX_NVTX_RANGE_1( message ) matx::autoCreateNvtxEvent(__FUNCTION__, message );
   #define MATX_NVTX_RANGE_2( message, nvtxLevel ) matx::autoCreateNvtxEvent(__FUNCTION__, message, nvtxLevel );
@@ -150,6 +193,8 @@ inline nvtxDomainHandle_t matxDomain = nvtxDomainCreateA("MatX");
                                   MATX_NVTX_1(__VA_ARGS__)\
                                   )
 
+  #define MATX_NVTX_START_CACHED(...);
+
 
   #define MATX_NVTX_RANGE_1( message ) 0;
   #define MATX_NVTX_RANGE_2( message, nvtxLevel ) 0;
@@ -206,6 +251,45 @@ inline nvtxDomainHandle_t matxDomain = nvtxDomainCreateA("MatX");
   globalNvtxLevel = newNVTXLevel;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///
+///\brief Whether ranges of a level are recorded. Levels above MATX_NVTX_MAX_LEVEL
+///       are rejected at compile time so the range and its message are elided
+///
+////////////////////////////////////////////////////////////////////////////////
+template <matx_nvxtLogLevels nvtxLevel>
+inline bool nvtxLevelEnabled()
+{
+  if constexpr (static_cast<int>(nvtxLevel) > static_cast<int>(MATX_NVTX_MAX_LEVEL)) {
+    return false;
+  }
+  else {
+    return nvtxLevel <= globalNvtxLevel;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///
+///\brief Register a range name with the MatX domain. An empty message uses the
+///       calling function's name
+///
+////////////////////////////////////////////////////////////////////////////////
+[[maybe_unused]] static nvtxStringHandle_t nvtxRegisterString( const std::string &message, const char *functionName )
+{
+  return nvtxDomainRegisterStringA(matxDomain, message.empty() ? functionName : message.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///
+///\brief Register a range name and keep its text so it can be reported as the
+///       current range. An empty message uses the calling function's name
+///
+////////////////////////////////////////////////////////////////////////////////
+[[maybe_unused]] static NvtxRegisteredName nvtxRegisterName( const std::string &message, const char *functionName )
+{
+  return NvtxRegisteredName{nvtxRegisterString(message, functionName), message.empty() ? functionName : message};
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///
 ///\brief fucntion wrapping NVTX management for automatic creation/deletion
@@ -235,7 +319,7 @@ inline nvtxDomainHandle_t matxDomain = nvtxDomainCreateA("MatX");
 
   if( foundIter != nvtx_eventMap.end())
   {
-    nvtxRangeEnd(foundIter->second);
+    nvtxDomainRangeEnd(matxDomain, foundIter->second);
     nvtx_eventMap.erase( foundIter );
   }
 }
@@ -262,7 +346,7 @@ class NvtxEvent
 
   ///
   ////////////////////////////////////////////////////////////////////////////////
-  NvtxEvent( std::string functionName, std::string message="",  matx_nvxtLogLevels nvtxLevel = matx_nvxtLogLevels::MATX_NVTX_LOG_USER, int registerId = -1 )
+  NvtxEvent( const char *functionName, const std::string &message="",  matx_nvxtLogLevels nvtxLevel = matx_nvxtLogLevels::MATX_NVTX_LOG_USER, int registerId = -1 )
   {
     userHandle_ = -1;
     persistent_ = false;
@@ -272,34 +356,24 @@ class NvtxEvent
       return;
     }
     
-    uint32_t curColor = nvtxColors[ curColorIdx % nunNvtxColors];
-    curColorIdx++;
-
-    nvtxEventAttributes_t eventAttrib;
-
-    // default event info
-    eventAttrib.version     = NVTX_VERSION;
-    eventAttrib.size        = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
-    eventAttrib.colorType   = NVTX_COLOR_ARGB;
-    eventAttrib.messageType = NVTX_MESSAGE_TYPE_ASCII;
-
-    // set custom color
-    eventAttrib.color = curColor;
+    nvtxEventAttributes_t eventAttrib = DefaultAttributes();
 
     // set message, if no message provided use the calling funciton as name
+    eventAttrib.messageType = NVTX_MESSAGE_TYPE_ASCII;
     if( message != "" )
     {
       eventAttrib.message.ascii = message.c_str();
     }
     else
     {
-      eventAttrib.message.ascii =  functionName.c_str();
+      eventAttrib.message.ascii =  functionName;
     }
 
     persistent_ = false;
     
     // save the id
     rangeId_ = nvtxDomainRangeStartEx(matxDomain, &eventAttrib);
+    active_ = true;
     userHandle_ = registerId;
     
     // if register with global map
@@ -308,9 +382,44 @@ class NvtxEvent
       persistent_ = true;
       registerEvent( registerId, rangeId_ );
     }
+    else
+    {
+      // The message may be a temporary, so the function name stands in for it
+      EnterRange( functionName, nvtxLevel );
+    }
 
   }
 
+  ////////////////////////////////////////////////////////////////////////////////
+  ///
+  ///\brief ctor for a range named by a registered string, used by MATX_NVTX_START_CACHED
+  ///
+  ///\param name         registered name of the range; must outlive the event
+  ///\param nvtxLevel    level of NVTX events to use higher number reduces scope
+  ///\param payload      integer payload attached to the range, such as an element count
+  ///
+  ////////////////////////////////////////////////////////////////////////////////
+  NvtxEvent( const NvtxRegisteredName *name, matx_nvxtLogLevels nvtxLevel, uint64_t payload )
+  {
+    userHandle_ = -1;
+    persistent_ = false;
+
+    if( nvtxLevel > globalNvtxLevel )
+    {
+      return;
+    }
+
+    nvtxEventAttributes_t eventAttrib = DefaultAttributes();
+    eventAttrib.messageType = NVTX_MESSAGE_TYPE_REGISTERED;
+    eventAttrib.message.registered = name->handle;
+    eventAttrib.payloadType = NVTX_PAYLOAD_TYPE_UNSIGNED_INT64;
+    eventAttrib.payload.ullValue = payload;
+
+    rangeId_ = nvtxDomainRangeStartEx(matxDomain, &eventAttrib);
+    active_ = true;
+    EnterRange( name->text.c_str(), nvtxLevel );
+  }
+
   NvtxEvent( [[maybe_unused]] int invalidClass )
   {     
     userHandle_ = -1;
@@ -318,6 +427,9 @@ class NvtxEvent
     return;
   }
 
+  NvtxEvent(const NvtxEvent &) = delete;
+  NvtxEvent &operator=(const NvtxEvent &) = delete;
+
   ////////////////////////////////////////////////////////////////////////////////
   ///
   ///\brief dtor
@@ -325,7 +437,7 @@ class NvtxEvent
   ////////////////////////////////////////////////////////////////////////////////
   ~NvtxEvent( )
   {
-    if( !persistent_ )
+    if( active_ && !persistent_ )
     {  
       if(userHandle_ != -1)
       {
@@ -333,15 +445,51 @@ class NvtxEvent
       }
       else
       {
-        nvtxRangeEnd(rangeId_);
+        nvtxDomainRangeEnd(matxDomain, rangeId_);
       }
     }
-    
+
+    if( named_ )
+    {
+      nvtxCurrentRangeName = prevRangeName_;
+    }
   }
 
   nvtxRangeId_t  rangeId_ = 0;    // id of the nvtxRange 
   int            userHandle_; // user provided handle to this event
   bool           persistent_; // if the nvtx range lives beyond the life of the NvtxEvent Class's scope
+  bool           active_ = false; // if a range was started
+
+  private:
+
+  void EnterRange( const char *name, matx_nvxtLogLevels nvtxLevel )
+  {
+    if( nvtxLevel <= MATX_NVTX_LOG_API )
+    {
+      prevRangeName_ = nvtxCurrentRangeName;
+      nvtxCurrentRangeName = name;
+      named_ = true;
+    }
+  }
+
+  const char    *prevRangeName_ = nullptr; // current range name when this range started
+  bool           named_ = false;           // if this range set the current range name
+
+  static nvtxEventAttributes_t DefaultAttributes()
+  {
+    nvtxEventAttributes_t eventAttrib{};
+
+    // default event info
+    eventAttrib.version     = NVTX_VERSION;
+    eventAttrib.size        = NVTX_EVENT_ATTRIB_STRUCT_SIZE;
+    eventAttrib.colorType   = NVTX_COLOR_ARGB;
+
+    // set custom color
+    eventAttrib.color = nvtxColors[ curColorIdx % nunNvtxColors];
+    curColorIdx++;
+
+    return eventAttrib;
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -349,11 +497,11 @@ class NvtxEvent
 ///\brief Utility Function to create an NVTX range with a unique ID and return it
 ///
 ////////////////////////////////////////////////////////////////////////////////
-[[maybe_unused]] static int autoCreateNvtxEvent(std::string functionName, std::string message="",  matx_nvxtLogLevels nvtxLevel = matx_nvxtLogLevels::MATX_NVTX_LOG_USER)
+[[maybe_unused]] static int autoCreateNvtxEvent(const std::string &functionName, const std::string &message="",  matx_nvxtLogLevels nvtxLevel = matx_nvxtLogLevels::MATX_NVTX_LOG_USER)
 {
   int newID = matx::getNVTX_Range_ID();
   
-  [[maybe_unused]] matx::NvtxEvent MATX_UNIQUE_NAME(nvtxFlag_)( functionName, message, nvtxLevel, newID );
+  [[maybe_unused]] matx::NvtxEvent MATX_UNIQUE_NAME(nvtxFlag_)( functionName.c_str(), message, nvtxLevel, newID );
   
   return newID;
   
@@ -0,0 +1,401 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "matx/core/defines.h"
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+
+namespace matx {
+
+/**
+ * Aggregated profile of every run of one operator expression
+ *
+ * Entries are keyed by the operator's str(). Bytes and flops are estimates summed over all calls:
+ * bytes come from the sizes of the tensors referenced by the expression, and flops count one
+ * operation per element for every unary and binary operator in it.
+ */
+struct OpProfileEntry {
+  std::string name;                 ///< str() of the operator
+  uint64_t calls = 0;               ///< Number of runs
+  double total_ms = 0.0;            ///< Device time summed over all runs
+  double min_ms = std::numeric_limits<double>::max(); ///< Fastest run
+  double max_ms = 0.0;              ///< Slowest run
+  uint64_t bytes_read = 0;          ///< Estimated bytes read, summed over all runs
+  uint64_t bytes_written = 0;       ///< Estimated bytes written, summed over all runs
+  double flops = 0.0;               ///< Estimated flops, summed over all runs
+  dim3 grid{0, 0, 0};               ///< Grid of the last element-wise kernel launched by the run
+  dim3 block{0, 0, 0};              ///< Block of the last element-wise kernel launched by the run
+
+  /** Achieved bandwidth in GB/s */
+  double GBps() const {
+    return total_ms > 0.0 ? static_cast<double>(bytes_read + bytes_written) / (total_ms * 1e6) : 0.0;
+  }
+
+  /** Achieved GFLOP/s */
+  double GFlops() const {
+    return total_ms > 0.0 ? flops / (total_ms * 1e6) : 0.0;
+  }
+
+  /** Arithmetic intensity in flops per byte */
+  double Intensity() const {
+    const auto bytes = bytes_read + bytes_written;
+    return bytes > 0 ? flops / static_cast<double>(bytes) : 0.0;
+  }
+};
+
+namespace detail {
+
+/**
+ * Records device time, launch dimensions, bytes and flops of every run() on a CUDA executor
+ *
+ * Each run is bracketed by a pair of events on its stream, so profiling adds no synchronization
+ * until results are read or the number of unread runs reaches OP_PROFILER_MAX_PENDING. Runs
+ * issued while the stream is captured into a CUDA graph are not recorded.
+ */
+class OpProfiler {
+  public:
+    static constexpr size_t OP_PROFILER_MAX_PENDING = 4096;
+
+    static OpProfiler &Get() {
+      static OpProfiler profiler;
+      return profiler;
+    }
+
+    bool Enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    void SetEnabled(bool enable) { enabled_.store(enable); }
+
+    void SetPeak(double gbps, double gflops) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      peak_gbps_ = gbps;
+      peak_gflops_ = gflops;
+    }
+
+    /**
+     * Start timing a run on stream. Returns 0 when the run is not recorded.
+     */
+    uint64_t Begin(cudaStream_t stream) {
+      cudaStreamCaptureStatus status = cudaStreamCaptureStatusNone;
+      if (cudaStreamIsCapturing(stream, &status) != cudaSuccess || status != cudaStreamCaptureStatusNone) {
+        return 0;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      Pending p;
+      p.start = GetEvent();
+      p.stop = GetEvent();
+      MATX_CUDA_CHECK(cudaEventRecord(p.start, stream));
+      const uint64_t id = next_id_++;
+      inflight_.emplace(id, std::move(p));
+      Stack().push_back(id);
+      return id;
+    }
+
+    /**
+     * Attach launch dimensions to the innermost run in progress on this thread
+     */
+    void SetLaunch(const dim3 &grid, const dim3 &block) {
+      if (!Enabled() || Stack().empty()) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = inflight_.find(Stack().back());
+      if (it != inflight_.end()) {
+        it->second.grid = grid;
+        it->second.block = block;
+      }
+    }
+
+    /**
+     * Finish timing the run started by Begin()
+     */
+    void End(uint64_t id, std::string name, uint64_t bytes_read, uint64_t bytes_written, double flops,
+             cudaStream_t stream) {
+      if (id == 0) {
+        return;
+      }
+
+      bool flush = false;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto &stack = Stack();
+        if (!stack.empty() && stack.back() == id) {
+          stack.pop_back();
+        }
+
+        auto it = inflight_.find(id);
+        if (it == inflight_.end()) {
+          return;
+        }
+
+        auto p = std::move(it->second);
+        inflight_.erase(it);
+        MATX_CUDA_CHECK(cudaEventRecord(p.stop, stream));
+        p.name = std::move(name);
+        p.bytes_read = bytes_read;
+        p.bytes_written = bytes_written;
+        p.flops = flops;
+        completed_.push_back(std::move(p));
+        flush = completed_.size() >= OP_PROFILER_MAX_PENDING;
+      }
+
+      if (flush) {
+        Flush();
+      }
+    }
+
+    /**
+     * Wait for all completed runs and fold them into the per-operator entries
+     */
+    void Flush() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto &p : completed_) {
+        float ms = 0.0f;
+        MATX_CUDA_CHECK(cudaEventSynchronize(p.stop));
+        MATX_CUDA_CHECK(cudaEventElapsedTime(&ms, p.start, p.stop));
+
+        auto &e = entries_[p.name];
+        e.name = p.name;
+        e.calls++;
+        e.total_ms += ms;
+        e.min_ms = std::min(e.min_ms, static_cast<double>(ms));
+        e.max_ms = std::max(e.max_ms, static_cast<double>(ms));
+        e.bytes_read += p.bytes_read;
+        e.bytes_written += p.bytes_written;
+        e.flops += p.flops;
+        if (p.grid.x != 0) {
+          e.grid = p.grid;
+          e.block = p.block;
+        }
+
+        free_events_.push_back(p.start);
+        free_events_.push_back(p.stop);
+      }
+      completed_.clear();
+    }
+
+    std::vector<OpProfileEntry> Entries() {
+      Flush();
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<OpProfileEntry> out;
+      out.reserve(entries_.size());
+      for (const auto &[name, e] : entries_) {
+        out.push_back(e);
+      }
+
+      std::sort(out.begin(), out.end(), [](const auto &a, const auto &b) { return a.total_ms > b.total_ms; });
+      return out;
+    }
+
+    void Reset() {
+      Flush();
+      std::lock_guard<std::mutex> lock(mutex_);
+      entries_.clear();
+    }
+
+    /**
+     * Format the entries as a table sorted by total time, with bandwidth and flop rates relative to the
+     * device peaks. The peak bandwidth comes from the memory clock and bus width of the current device
+     * unless it was set with SetPeak(). The attainable rate of an entry is the roofline
+     * min(peak flops, intensity * peak bandwidth) when a peak flop rate was given.
+     */
+    std::string Report() {
+      const auto entries = Entries();
+
+      double peak_gbps, peak_gflops;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        peak_gbps = peak_gbps_;
+        peak_gflops = peak_gflops_;
+      }
+      if (peak_gbps <= 0.0) {
+        peak_gbps = DevicePeakGBps();
+      }
+
+      std::string out = std::format("MatX operator profile (peak {:.1f} GB/s", peak_gbps);
+      out += peak_gflops > 0.0 ? std::format(", {:.1f} GFLOP/s)\n", peak_gflops) : ")\n";
+      out += std::format("{:>8} {:>11} {:>10} {:>9} {:>7} {:>9} {:>7} {:>7} {:>16} {:>12}  {}\n",
+          "calls", "total ms", "avg us", "GB/s", "%BW", "GFLOP/s", "FLOP/B", "%roof", "grid", "block", "operator");
+
+      for (const auto &e : entries) {
+        const double gbps = e.GBps();
+        const double bw_pct = peak_gbps > 0.0 ? 100.0 * gbps / peak_gbps : 0.0;
+        std::string roof = "-";
+        if (peak_gflops > 0.0 && peak_gbps > 0.0) {
+          const double attainable = std::min(peak_gflops, e.Intensity() * peak_gbps);
+          if (attainable > 0.0) {
+            roof = std::format("{:.1f}", 100.0 * e.GFlops() / attainable);
+          }
+        }
+
+        out += std::format("{:>8} {:>11.3f} {:>10.2f} {:>9.1f} {:>7.1f} {:>9.1f} {:>7.2f} {:>7} {:>16} {:>12}  {}\n",
+            e.calls, e.total_ms, 1e3 * e.total_ms / static_cast<double>(e.calls), gbps, bw_pct, e.GFlops(),
+            e.Intensity(), roof,
+            std::format("{}x{}x{}", e.grid.x, e.grid.y, e.grid.z),
+            std::format("{}x{}x{}", e.block.x, e.block.y, e.block.z), e.name);
+      }
+
+      return out;
+    }
+
+  private:
+    struct Pending {
+      cudaEvent_t start;
+      cudaEvent_t stop;
+      std::string name;
+      uint64_t bytes_read = 0;
+      uint64_t bytes_written = 0;
+      double flops = 0.0;
+      dim3 grid{0, 0, 0};
+      dim3 block{0, 0, 0};
+    };
+
+    OpProfiler() {
+      const char *env = std::getenv("MATX_OP_PROFILE");
+      enabled_ = env != nullptr && std::strcmp(env, "0") != 0;
+    }
+
+    ~OpProfiler() {
+      // The CUDA context may already be torn down at exit, so errors are ignored here
+      for (auto &p : completed_) {
+        cudaEventDestroy(p.start);
+        cudaEventDestroy(p.stop);
+      }
+      for (auto &ev : free_events_) {
+        cudaEventDestroy(ev);
+      }
+    }
+
+    // Runs in progress on this thread, innermost last. Transforms issue nested runs.
+    static std::vector<uint64_t> &Stack() {
+      static thread_local std::vector<uint64_t> stack;
+      return stack;
+    }
+
+    cudaEvent_t GetEvent() {
+      if (!free_events_.empty()) {
+        auto ev = free_events_.back();
+        free_events_.pop_back();
+        return ev;
+      }
+
+      cudaEvent_t ev;
+      MATX_CUDA_CHECK(cudaEventCreate(&ev));
+      return ev;
+    }
+
+    static double DevicePeakGBps() {
+      int dev, clock_khz = 0, bus_bits = 0;
+      if (cudaGetDevice(&dev) != cudaSuccess ||
+          cudaDeviceGetAttribute(&clock_khz, cudaDevAttrMemoryClockRate, dev) != cudaSuccess ||
+          cudaDeviceGetAttribute(&bus_bits, cudaDevAttrGlobalMemoryBusWidth, dev) != cudaSuccess) {
+        return 0.0;
+      }
+
+      // Double data rate
+      return 2.0 * static_cast<double>(clock_khz) * 1e3 * (static_cast<double>(bus_bits) / 8.0) / 1e9;
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::mutex mutex_;
+    uint64_t next_id_ = 1;
+    std::unordered_map<uint64_t, Pending> inflight_;
+    std::vector<Pending> completed_;
+    std::vector<cudaEvent_t> free_events_;
+    std::unordered_map<std::string, OpProfileEntry> entries_;
+    double peak_gbps_ = 0.0;
+    double peak_gflops_ = 0.0;
+};
+
+} // end namespace detail
+
+/**
+ * Enable or disable per-operator profiling
+ *
+ * While enabled, every run() on a CUDA executor, including the runs transforms issue internally,
+ * records its device time, launch dimensions and estimated bytes and flops under the operator's
+ * str(). Profiling can also be enabled by setting the environment variable MATX_OP_PROFILE=1.
+ *
+ * @param enable Whether to profile
+ */
+__MATX_INLINE__ void SetOpProfiling(bool enable) {
+  detail::OpProfiler::Get().SetEnabled(enable);
+}
+
+/**
+ * Override the device peaks used by the profile report
+ *
+ * @param gbps Peak memory bandwidth in GB/s. 0 uses the value derived from the current device
+ * @param gflops Peak compute rate in GFLOP/s. 0 omits the roofline column
+ */
+__MATX_INLINE__ void SetOpProfilePeak(double gbps, double gflops = 0.0) {
+  detail::OpProfiler::Get().SetPeak(gbps, gflops);
+}
+
+/**
+ * Get the profile entries recorded so far, sorted by total time. Waits for outstanding runs.
+ */
+__MATX_INLINE__ std::vector<OpProfileEntry> GetOpProfile() {
+  return detail::OpProfiler::Get().Entries();
+}
+
+/**
+ * Get a roofline-style report of the profile recorded so far. Waits for outstanding runs.
+ */
+__MATX_INLINE__ std::string OpProfileReport() {
+  return detail::OpProfiler::Get().Report();
+}
+
+/**
+ * Clear the profile recorded so far
+ */
+__MATX_INLINE__ void ResetOpProfile() {
+  detail::OpProfiler::Get().Reset();
+}
+
+} // end namespace matx
@@ -56,7 +56,9 @@ typedef enum {
 
 typedef enum {
   MATX_C_METHOD_DIRECT,
-  MATX_C_METHOD_FFT
+  MATX_C_METHOD_FFT,
+  MATX_C_METHOD_TC,  // Lowered to a GEMM so it runs on tensor cores. Requires a filter shared by all batches
+  MATX_C_METHOD_AUTO // Picks direct, FFT, or TC from the filter length and batch size
 } matxConvCorrMethod_t;
 
   enum class PercentileMethod {
@@ -77,6 +79,63 @@ typedef enum {
  */
 typedef enum { SORT_DIR_ASC, SORT_DIR_DESC } SortDirection_t;
 
+/**
+ * @enum ScanFunc
+ *   Associative operator applied by scan()
+ */
+enum class ScanFunc {
+  SUM,   /**< Cumulative sum */
+  PROD,  /**< Cumulative product */
+  MIN,   /**< Running minimum */
+  MAX    /**< Running maximum */
+};
+
+/**
+ * @enum ScanType
+ *   Whether element i of a scan includes input element i
+ */
+enum class ScanType {
+  INCLUSIVE,  /**< Element i combines inputs 0 through i */
+  EXCLUSIVE   /**< Element i combines inputs 0 through i-1, and element 0 is the identity */
+};
+
+/**
+ * @enum UniqueMode
+ *   Output order of unique()
+ */
+enum class UniqueMode {
+  SORTED,    /**< Unique values in ascending order */
+  UNORDERED  /**< Unique values in any order. Uses a hash table on CUDA instead of sorting */
+};
+
+/**
+ * @enum GroupByOp
+ *   Reduction applied to the values of each group by groupby_reduce()
+ */
+enum class GroupByOp {
+  SUM,  /**< Sum of the values in each group */
+  MIN,  /**< Minimum of the values in each group */
+  MAX   /**< Maximum of the values in each group */
+};
+
+/**
+ * @enum SumAccuracy
+ *   Accumulation used by sum() and mean()
+ */
+enum class SumAccuracy {
+  DEFAULT,     /**< Accumulate in the input type */
+  COMPENSATED  /**< Accumulate float and complex<float> inputs as float-float pairs for near-double accuracy */
+};
+
+/**
+ * @enum PhaseAccuracy
+ *   Phase arithmetic used by chirp() and cchirp() on a uniform time base
+ */
+enum class PhaseAccuracy {
+  DEFAULT, /**< Compute the phase from the time value in the frequency type */
+  FLTFLT   /**< Compute the phase modulo one cycle from the sample index with float-float arithmetic for near-double accuracy */
+};
+
 /* Solver parameter enums */
 
 /**
@@ -87,6 +146,15 @@ typedef enum {
   MAT_INVERSE_ALGO_LU,
 } MatInverseAlgo_t;
 
+/**
+ * @enum CovFill
+ *   Part of a covariance matrix written by cov()
+ */
+enum class CovFill {
+  FULL,  /**< Write the whole Hermitian matrix */
+  UPPER  /**< Write the upper triangle and diagonal, and zero the lower triangle */
+};
+
 /**
  * @enum SolverFillMode
  *   Indicates which part (lower or upper) of the dense matrix was filled
@@ -97,6 +165,55 @@ enum class SolverFillMode {
   LOWER   /**< Use the lower part of the matrix */
 };
 
+/**
+ * @enum SolvePrecision
+ *   Arithmetic used by a dense solve()
+ */
+enum class SolvePrecision {
+  FULL,    /**< LU factorization and solve in the precision of the input */
+  REFINED  /**< TF32 LU factorization with iterative refinement to the input precision. Falls back to FULL if refinement does not converge */
+};
+
+/**
+ * @enum PinvMethod
+ *   Factorization used by pinv() and lstsq()
+ */
+enum class PinvMethod {
+  AUTO,     /**< QR for tall and square inputs of full column rank, SVD otherwise */
+  SVD,      /**< Singular value decomposition. Handles any rank */
+  QR,       /**< Economic QR, A^+ = R^-1 Q^H. Falls back to SVD when R shows A is rank deficient */
+  CHOLESKY  /**< Cholesky of A^H A. Cheapest, but only accurate for well-conditioned A. Falls back to QR otherwise */
+};
+
+/**
+ * @enum QRMethod
+ *   Algorithm used by qr_econ()
+ */
+enum class QRMethod {
+  AUTO,    /**< TSQR for matrices much taller than they are wide, GEQRF otherwise */
+  GEQRF,   /**< Householder QR of the whole matrix with cuSolver geqrf */
+  TSQR,    /**< Tall-skinny QR with a tree reduction of the R factors of row blocks */
+  CHOLQR2  /**< CholeskyQR2. Fastest for tall matrices, but only for well-conditioned inputs */
+};
+
+/**
+ * @enum ToeplitzSolveMethod
+ *   Algorithm used by toeplitz_solve()
+ */
+enum class ToeplitzSolveMethod {
+  LEVINSON, /**< Levinson recursion, O(n^2) per system with one thread block per system */
+  PCG       /**< Conjugate gradient with FFT products and a circulant preconditioner, O(n log n) per iteration */
+};
+
+/**
+ * @enum LogDetMethod
+ *   Factorization used by logdet() and solve_logdet()
+ */
+enum class LogDetMethod {
+  CHOLESKY, /**< Cholesky factorization. A must be Hermitian positive definite */
+  LU        /**< LU factorization with partial pivoting. Gives log|det(A)| for any nonsingular A */
+};
+
 /**
  * @enum EigenMode
  *   Specifies whether or not eigenvectors should be computed.
@@ -127,6 +244,20 @@ enum class SVDHostAlgo {
   DC   /**< Divide and Conquer method (corresponds to `gesdd`) */
 };
 
+/**
+ * @brief Controls for the batched Jacobi solvers used by eig() and svd() on CUDA
+ *
+ * Batches of matrices of up to 32x32 are decomposed with the Jacobi method in a
+ * single cuSolver call (`syevjBatched` or `gesvdjBatched`) rather than with the
+ * general-size solvers. Each matrix stops once it has converged to within tol, or
+ * after max_sweeps sweeps.
+ */
+struct JacobiParams {
+  bool enable = true;   /**< Use the Jacobi solver for eligible batches. If false, always use the general-size solver */
+  double tol = 1e-9;    /**< Convergence tolerance */
+  int max_sweeps = 15;  /**< Maximum number of Jacobi sweeps */
+};
+
 /**
   * @brief Padding mode
   *
@@ -205,6 +336,26 @@ namespace detail {
     void *end_ptr;
   };
 
+  struct PrefetchQueryInput {
+    int device;
+    void *stream; // cudaStream_t
+  };
+
+  struct StreamDependencyQueryInput {
+    void *stream; // cudaStream_t
+    bool record;  // Record the stream as the last writer instead of waiting for other writers
+  };
+
+  struct ResidencyQueryInput {
+    void *stream; // cudaStream_t
+  };
+
+  struct WriteVersionQueryInput {
+    bool bump;                   // Give the tensors new versions instead of reading their signatures
+    void *sig;                   // std::vector<uint64_t> of the addresses, layouts and versions of the tensors read
+    bool *volatile_values;       // Set by operators whose values change between runs without a write
+  };
+
 }
 
 };
\ No newline at end of file
@@ -35,6 +35,7 @@
 
 #include "matx/core/type_utils_both.h"
 #include <cuda/std/__algorithm/copy.h>
+#include <cuda/std/limits>
 #ifndef __CUDACC_RTC__
 
 namespace matx {
@@ -87,6 +88,74 @@ namespace matx {
       }
     }
 
+    // Frees a temporary from AllocateTempTensor and clears the pointer. A transform's inputs are released
+    // as soon as its own Exec has been enqueued, so PostRun may reach the same temporary again at the end
+    // of the statement, and must not free an address that has since been handed to another allocation.
+    template <typename T>
+    __MATX_HOST__ __MATX_INLINE__ void FreeTempTensor(T *&ptr) {
+      if (ptr != nullptr) {
+        matxFree(ptr);
+        ptr = nullptr;
+      }
+    }
+
+    enum class AliasKind {
+      NONE,    // Address ranges are disjoint
+      EXACT,   // Same pointer, type, shape, and strides
+      PARTIAL  // Any other overlap of the address ranges
+    };
+
+    /**
+     * @brief Classify how an output and an input tensor share memory
+     *
+     * Backends that run in place (cuFFT C2C, CUB's double-buffered radix sort) require the input and
+     * output to be the same view. Any other overlap means the input must be materialized before the
+     * output is written. Operators that are not tensor views never alias.
+     */
+    template <typename OutType, typename InType>
+    __MATX_INLINE__ AliasKind GetAliasKind([[maybe_unused]] const OutType &out, [[maybe_unused]] const InType &in) {
+      if constexpr (is_tensor_view_v<OutType> && is_tensor_view_v<InType>) {
+        if (out.Data() == nullptr || in.Data() == nullptr || out.TotalSize() == 0 || in.TotalSize() == 0) {
+          return AliasKind::NONE;
+        }
+
+        if constexpr (OutType::Rank() == InType::Rank() &&
+                      std::is_same_v<typename OutType::value_type, typename InType::value_type>) {
+          bool same = static_cast<const void*>(out.Data()) == static_cast<const void*>(in.Data());
+          for (int r = 0; r < OutType::Rank() && same; r++) {
+            same = out.Size(r) == in.Size(r) && out.Stride(r) == in.Stride(r);
+          }
+
+          if (same) {
+            return AliasKind::EXACT;
+          }
+        }
+
+        const auto byte_range = [](const auto &t) {
+          using value_type = typename remove_cvref_t<decltype(t)>::value_type;
+          auto lo = reinterpret_cast<uintptr_t>(t.Data());
+          auto hi = lo + sizeof(value_type);
+          for (int r = 0; r < remove_cvref_t<decltype(t)>::Rank(); r++) {
+            const auto extent = static_cast<intptr_t>(t.Size(r) - 1) * t.Stride(r) * static_cast<intptr_t>(sizeof(value_type));
+            if (extent < 0) {
+              lo += extent;
+            }
+            else {
+              hi += extent;
+            }
+          }
+          return cuda::std::array<uintptr_t, 2>{lo, hi};
+        };
+
+        const auto out_range = byte_range(out);
+        const auto in_range = byte_range(in);
+        return (out_range[0] < in_range[1] && in_range[0] < out_range[1]) ? AliasKind::PARTIAL : AliasKind::NONE;
+      }
+      else {
+        return AliasKind::NONE;
+      }
+    }
+
     template <typename Op, typename ValidFunc>
     __MATX_INLINE__ auto GetSupportedTensor(const Op &in, const ValidFunc &fn, matxMemorySpace_t space, cudaStream_t stream = 0) {
       if constexpr (is_matx_transform_op<Op>()) {
@@ -184,6 +253,19 @@ namespace matx {
 
       cuda::std::array<l_shape_type, RANK> indices;
 
+      if constexpr (is_static_shape_v<Op>) {
+        // Divide by compile-time constants so the loop unrolls without 64-bit multiply chains
+        using Desc = static_shape_desc_t<Op>;
+        using idx_t = cuda::std::conditional_t<(Desc::TotalSize() <= cuda::std::numeric_limits<int32_t>::max()), uint32_t, index_t>;
+        idx_t rem = static_cast<idx_t>(abs);
+        MATX_LOOP_UNROLL
+        for (int idx = RANK - 1; idx >= 0; idx--) {
+          indices[idx] = static_cast<l_shape_type>(rem % static_cast<idx_t>(Desc::Size(idx)));
+          rem /= static_cast<idx_t>(Desc::Size(idx));
+        }
+        return indices;
+      }
+
       for (int idx = 0; idx < RANK; idx++) {
         if (idx == RANK-1) {
           indices[RANK-1] = abs;
@@ -392,6 +474,30 @@ namespace matx {
       }
     }   
 
+    /**
+     * Read-only load at a data-dependent location, as done by gathers such as select() and remap()
+     *
+     * On the device, tensors of arithmetic types are read through the read-only data cache so scattered
+     * reads do not evict the rest of the kernel's working set from L1. Everything else is read with
+     * get_value.
+     */
+    template <typename CapType, typename T, typename IdxType, size_t N>
+    __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto gather_value(const T &op, const cuda::std::array<IdxType, N> &idx)
+    {
+      using value_type = typename remove_cvref_t<T>::value_type;
+      if constexpr (CapType::ept == ElementsPerThread::ONE && is_tensor_impl_v<T> && remove_cvref_t<T>::Rank() == N &&
+                    std::is_arithmetic_v<value_type> && !std::is_same_v<value_type, bool>) {
+#ifdef __CUDA_ARCH__
+        return __ldg(cuda::std::apply([&op](auto... args) { return op.GetPointer(args...); }, idx));
+#else
+        return static_cast<value_type>(get_value<CapType>(op, idx));
+#endif
+      }
+      else {
+        return get_value<CapType>(op, idx);
+      }
+    }
+
     // Returns an address of a pointer of type T aligned to new address
     template <typename T>
     constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T *AlignAddr(uint8_t *addr)
@@ -0,0 +1,321 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+
+namespace matx {
+
+namespace detail {
+
+__MATX_INLINE__ bool OversubscriptionEnabledFromEnv() {
+  const char *env = std::getenv("MATX_OVERSUBSCRIBE");
+  return env != nullptr && std::strcmp(env, "0") != 0;
+}
+
+/**
+ * Device memory that can be evicted to pinned host memory and faulted back in at the same address
+ *
+ * Serves MATX_DEVICE_MEMORY allocations while oversubscription is enabled. Every allocation reserves its own
+ * virtual address range and maps physical memory into it with the CUDA virtual memory management API, so tensors
+ * keep their pointers while the backing memory comes and goes. When physical memory runs out, the least recently
+ * used blocks are copied to host on the stream that last used them and unmapped until the request fits. run() on
+ * a CUDA executor faults the blocks of every tensor in an expression back in on the executor's stream before the
+ * expression is launched. Blocks used by the expression being launched are never chosen for eviction.
+ */
+class OversubscribedHeap {
+  public:
+    OversubscribedHeap() = default;
+    OversubscribedHeap(const OversubscribedHeap &) = delete;
+    OversubscribedHeap &operator=(const OversubscribedHeap &) = delete;
+
+    /**
+     * Allocate a block, evicting others if the device is out of memory
+     */
+    void Allocate(void **ptr, size_t bytes) {
+      int device;
+      MATX_CUDA_CHECK(cudaGetDevice(&device));
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      const size_t granularity = Granularity(device);
+      Block b;
+      b.bytes = (bytes + granularity - 1) / granularity * granularity;
+      b.device = device;
+
+      CUdeviceptr va;
+      if (cuMemAddressReserve(&va, b.bytes, 0, 0, 0) != CUDA_SUCCESS) {
+        MATX_THROW(matxOutOfMemory, "Failed to reserve address space for oversubscribed memory");
+      }
+
+      // A new block is not pinned to the current expression, so allocating many tensors between runs can still evict
+      b.last_use = ++clock_;
+      auto it = blocks_.emplace(static_cast<uintptr_t>(va), b).first;
+      if (!Map(it)) {
+        cuMemAddressFree(va, b.bytes);
+        blocks_.erase(it);
+        MATX_THROW(matxOutOfMemory, "Failed to allocate oversubscribed memory. Every block is in use by the current expression");
+      }
+
+      *ptr = reinterpret_cast<void *>(va);
+    }
+
+    /**
+     * Free a block returned by Allocate
+     */
+    void Free(void *ptr) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = blocks_.find(reinterpret_cast<uintptr_t>(ptr));
+      if (it == blocks_.end()) {
+        return;
+      }
+
+      auto &b = it->second;
+      if (b.resident) {
+        // Unmapping is not stream-ordered, so wait for outstanding work like cudaFree does
+        MATX_CUDA_CHECK(cudaDeviceSynchronize());
+        Unmap(it);
+      }
+      else {
+        spilled_bytes_ -= b.bytes;
+      }
+
+      if (b.host != nullptr) {
+        cudaFreeHost(b.host);
+      }
+      cuMemAddressFree(static_cast<CUdeviceptr>(it->first), b.bytes);
+      blocks_.erase(it);
+    }
+
+    /**
+     * Start launching a new expression. Blocks touched before this are eligible for eviction again.
+     */
+    void BeginRun() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      generation_++;
+    }
+
+    /**
+     * Fault every block overlapping [first, last) back in on stream and mark it as used by the current expression
+     */
+    void MakeResident(const void *first, const void *last, cudaStream_t stream) {
+      const auto lo = reinterpret_cast<uintptr_t>(first);
+      const auto hi = reinterpret_cast<uintptr_t>(last);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto it = FirstOverlap(lo); it != blocks_.end() && it->first < hi; ++it) {
+        auto &b = it->second;
+        if (it->first + b.bytes <= lo) {
+          continue;
+        }
+
+        Touch(b, stream);
+        if (b.resident) {
+          continue;
+        }
+
+        cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+        MATX_CUDA_CHECK(cudaStreamIsCapturing(stream, &capture_status));
+        MATX_ASSERT_STR(capture_status == cudaStreamCaptureStatusNone, matxInvalidParameter,
+          "Oversubscribed memory that was evicted to host cannot be faulted back in during stream capture");
+
+        if (!Map(it)) {
+          MATX_THROW(matxOutOfMemory, "Failed to fault oversubscribed memory back in. Every block is in use by the current expression");
+        }
+
+        MATX_CUDA_CHECK(cudaMemcpyAsync(reinterpret_cast<void *>(it->first), b.host, b.bytes, cudaMemcpyHostToDevice, stream));
+        spilled_bytes_ -= b.bytes;
+        MATX_LOG_DEBUG("Oversubscription: faulted {} bytes at {} back in", b.bytes, reinterpret_cast<void *>(it->first));
+      }
+    }
+
+    /**
+     * Evict least recently used blocks until at least bytes have been released
+     *
+     * @returns True if anything was evicted
+     */
+    bool EvictBytes(size_t bytes) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      size_t evicted = 0;
+      while (evicted < bytes) {
+        const size_t n = EvictOne(blocks_.end());
+        if (n == 0) {
+          break;
+        }
+        evicted += n;
+      }
+      return evicted > 0;
+    }
+
+    size_t SpilledBytes() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return spilled_bytes_;
+    }
+
+  private:
+    struct Block {
+      size_t bytes = 0;
+      int device = 0;
+      bool resident = false;
+      CUmemGenericAllocationHandle handle{};
+      void *host = nullptr;             // Pinned copy made by the first eviction and reused by later ones
+      cudaStream_t last_stream = nullptr;
+      uint64_t last_use = 0;
+      uint64_t generation = 0;
+    };
+    using BlockMap = std::map<uintptr_t, Block>;
+
+    static CUmemAllocationProp Properties(int device) {
+      CUmemAllocationProp prop{};
+      prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+      prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+      prop.location.id = device;
+      return prop;
+    }
+
+    static size_t Granularity(int device) {
+      const auto prop = Properties(device);
+      size_t granularity = 0;
+      if (cuMemGetAllocationGranularity(&granularity, &prop, CU_MEM_ALLOC_GRANULARITY_RECOMMENDED) != CUDA_SUCCESS) {
+        MATX_THROW(matxCudaError, "Failed to query the allocation granularity for oversubscribed memory");
+      }
+      return granularity;
+    }
+
+    void Touch(Block &b, cudaStream_t stream) {
+      b.last_use = ++clock_;
+      b.generation = generation_;
+      b.last_stream = stream;
+    }
+
+    // Back a block with physical memory, evicting others while the device is out of memory. Called with mutex_ held.
+    bool Map(BlockMap::iterator it) {
+      auto &b = it->second;
+      const auto prop = Properties(b.device);
+      CUmemGenericAllocationHandle handle;
+      while (true) {
+        const CUresult res = cuMemCreate(&handle, b.bytes, &prop, 0);
+        if (res == CUDA_SUCCESS) {
+          break;
+        }
+        if (res != CUDA_ERROR_OUT_OF_MEMORY) {
+          MATX_THROW(matxCudaError, "cuMemCreate failed for oversubscribed memory");
+        }
+        if (EvictOne(it) == 0) {
+          return false;
+        }
+      }
+
+      const auto va = static_cast<CUdeviceptr>(it->first);
+      CUmemAccessDesc access{};
+      access.location = prop.location;
+      access.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+      if (cuMemMap(va, b.bytes, 0, handle, 0) != CUDA_SUCCESS || cuMemSetAccess(va, b.bytes, &access, 1) != CUDA_SUCCESS) {
+        cuMemUnmap(va, b.bytes);
+        cuMemRelease(handle);
+        MATX_THROW(matxCudaError, "Failed to map oversubscribed memory");
+      }
+
+      b.handle = handle;
+      b.resident = true;
+      return true;
+    }
+
+    void Unmap(BlockMap::iterator it) {
+      auto &b = it->second;
+      cuMemUnmap(static_cast<CUdeviceptr>(it->first), b.bytes);
+      cuMemRelease(b.handle);
+      b.resident = false;
+    }
+
+    // Copy the least recently used block that is not part of the current expression to host and release its
+    // physical memory. Returns the bytes released, or 0 if no block can be evicted. Called with mutex_ held.
+    size_t EvictOne(BlockMap::iterator exclude) {
+      auto victim = blocks_.end();
+      for (auto it = blocks_.begin(); it != blocks_.end(); ++it) {
+        const auto &b = it->second;
+        if (it == exclude || !b.resident || b.generation == generation_) {
+          continue;
+        }
+        if (victim == blocks_.end() || b.last_use < victim->second.last_use) {
+          victim = it;
+        }
+      }
+
+      if (victim == blocks_.end()) {
+        return 0;
+      }
+
+      auto &b = victim->second;
+      if (b.host == nullptr && cudaMallocHost(&b.host, b.bytes) != cudaSuccess) {
+        b.host = nullptr;
+        MATX_THROW(matxOutOfMemory, "Failed to allocate pinned host memory to evict oversubscribed memory into");
+      }
+
+      // The copy is ordered after the last expression that used the block. The physical memory can only be
+      // released once the copy has finished.
+      MATX_CUDA_CHECK(cudaMemcpyAsync(b.host, reinterpret_cast<void *>(victim->first), b.bytes, cudaMemcpyDeviceToHost, b.last_stream));
+      MATX_CUDA_CHECK(cudaStreamSynchronize(b.last_stream));
+      Unmap(victim);
+      spilled_bytes_ += b.bytes;
+      MATX_LOG_DEBUG("Oversubscription: evicted {} bytes at {} to host", b.bytes, reinterpret_cast<void *>(victim->first));
+      return b.bytes;
+    }
+
+    BlockMap::iterator FirstOverlap(uintptr_t lo) {
+      auto it = blocks_.upper_bound(lo);
+      if (it != blocks_.begin() && std::prev(it)->first + std::prev(it)->second.bytes > lo) {
+        --it;
+      }
+      return it;
+    }
+
+    std::mutex mutex_;
+    BlockMap blocks_;
+    uint64_t clock_ = 0;
+    uint64_t generation_ = 1;
+    size_t spilled_bytes_ = 0;
+};
+
+} // namespace detail
+} // namespace matx
@@ -30,7 +30,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /////////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
 #include <cinttypes>
+#include <cstdio>
+#include <thread>
+#include <matx/core/allocator.h>
 #include <matx/core/type_utils.h>
 
 namespace matx {
@@ -45,7 +49,7 @@ namespace matx {
     template <typename T>
     __MATX_INLINE__ __MATX_HOST__ void PrintVal(FILE* fp, const T &val)
     {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
       using namespace std::literals::string_literals;
 
@@ -199,7 +203,7 @@ namespace matx {
     template <typename Op, typename ... Args>
     __MATX_HOST__ void InternalPrint(FILE* fp, const Op &op, Args ...dims)
     {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
       MATX_STATIC_ASSERT(Op::Rank() == sizeof...(Args), "Number of dimensions to print must match tensor rank");
       MATX_STATIC_ASSERT(Op::Rank() <= 4, "Printing is only supported on tensors of rank 4 or lower currently");
@@ -558,7 +562,7 @@ namespace matx {
       requires (((std::is_integral_v<Args>)&&...) &&
                 (Op::Rank() == 0 || sizeof...(Args) > 0))
     void PrintData(FILE* fp, const Op &op, Args... dims) {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     #ifdef __CUDACC__
       cudaDeviceSynchronize();
@@ -638,6 +642,77 @@ namespace matx {
       InternalPrint(fp, op, dims...);
     #endif
     }
+
+    /**
+     * Pinned host staging slots used by fprint_async()
+     *
+     * A slot is claimed on the calling thread when a print is enqueued and released by the host callback
+     * after its contents are formatted, so the callback never allocates, frees, or calls into CUDA. Slots
+     * only grow, and a caller blocks on the host when every slot is still waiting to be printed.
+     */
+    class AsyncPrintRing {
+    public:
+      static constexpr int SLOTS = 8;
+
+      static AsyncPrintRing &Get() {
+        static AsyncPrintRing ring;
+        return ring;
+      }
+
+      int Acquire(size_t bytes) {
+        for (;;) {
+          const int start = next_.load();
+          for (int i = 0; i < SLOTS; i++) {
+            const int s = (start + i) % SLOTS;
+            bool expected = false;
+            if (slots_[s].busy.compare_exchange_strong(expected, true)) {
+              next_.store((s + 1) % SLOTS);
+              if (slots_[s].bytes < bytes) {
+                if (slots_[s].ptr != nullptr) {
+                  matxFree(slots_[s].ptr);
+                }
+                matxAlloc(&slots_[s].ptr, bytes, MATX_HOST_MEMORY);
+                slots_[s].bytes = bytes;
+              }
+              return s;
+            }
+          }
+          std::this_thread::yield();
+        }
+      }
+
+      void *Data(int s) const { return slots_[s].ptr; }
+      void Release(int s) { slots_[s].busy.store(false); }
+
+    private:
+      struct Slot {
+        void *ptr = nullptr;
+        size_t bytes = 0;
+        std::atomic<bool> busy{false};
+      };
+
+      // Slots are intentionally never freed since the CUDA context may already be gone at exit
+      Slot slots_[SLOTS];
+      std::atomic<int> next_{0};
+    };
+
+    template <typename Staged, typename... Args>
+    struct AsyncPrintJob {
+      FILE *fp;
+      std::string header;
+      Staged staged;
+      int slot;
+      cuda::std::tuple<Args...> dims;
+    };
+
+    template <typename Job>
+    void CUDART_CB AsyncPrintCallback(void *data) {
+      auto job = static_cast<Job *>(data);
+      fputs(job->header.c_str(), job->fp);
+      cuda::std::apply([&](auto... dims) { InternalPrint(job->fp, job->staged, dims...); }, job->dims);
+      AsyncPrintRing::Get().Release(job->slot);
+      delete job;
+    }
   };
 
 
@@ -673,7 +748,7 @@ namespace matx {
   #endif
   void fprint(FILE* fp, const Op &op, Args... dims)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     detail::PrintShapeImpl(op, fp);
     detail::PrintData(fp, op, dims...);
@@ -768,6 +843,111 @@ namespace matx {
 
   #endif // not DOXYGEN_ONLY
 
+  /**
+   * @brief Print an operator's values to an output file stream without synchronizing the device
+   *
+   * The operator is evaluated on the executor's stream into a pinned host staging buffer, and the
+   * values are formatted by a host function enqueued on the same stream once the copy completes.
+   * Unlike fprint(), neither the device nor any other stream is synchronized, so debug output can be
+   * left enabled without serializing the pipeline. Output appears in stream order and is complete
+   * once the executor has been synchronized. The shape header is captured when the call is made,
+   * while the precision and format type are read when the values are formatted.
+   *
+   * @tparam Op Operator input type
+   * @tparam Executor CUDA executor type
+   * @tparam Args Integral argument types
+   * @param fp Output file stream
+   * @param op Operator input
+   * @param exec CUDA executor to order the print on
+   * @param dims Number of values to print for each dimension, with 0 printing the whole dimension
+   */
+  template <typename Op, typename Executor, typename... Args>
+    requires (((std::is_integral_v<Args>)&&...) &&
+              (Op::Rank() == 0 || sizeof...(Args) == Op::Rank()))
+  void fprint_async(FILE *fp, const Op &op, Executor &&exec, Args... dims)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    static_assert(is_cuda_executor_v<Executor>, "fprint_async() requires a CUDA executor");
+    static_assert(!is_sparse_tensor_v<Op>, "fprint_async() does not support sparse tensors");
+    using value_type = typename matx::remove_cvref_t<typename Op::value_type>;
+
+    char *header_buf = nullptr;
+    size_t header_len = 0;
+    FILE *header_fp = open_memstream(&header_buf, &header_len);
+    MATX_ASSERT_STR(header_fp != nullptr, matxInvalidParameter, "Failed to open print header stream");
+    detail::PrintShapeImpl(op, header_fp);
+    fclose(header_fp);
+    std::string header{header_buf, header_len};
+    free(header_buf);
+
+    auto &ring = detail::AsyncPrintRing::Get();
+    const auto shape = op.Shape();
+    const size_t bytes = static_cast<size_t>(cuda::std::accumulate(shape.begin(), shape.end(),
+                           static_cast<index_t>(1), cuda::std::multiplies<index_t>())) * sizeof(value_type);
+    const int slot = ring.Acquire(cuda::std::max(bytes, sizeof(value_type)));
+
+    auto staged = make_tensor<value_type>(static_cast<value_type *>(ring.Data(slot)), shape);
+    (staged = op).run(exec);
+
+    using Job = detail::AsyncPrintJob<decltype(staged), Args...>;
+    auto job = new Job{fp, std::move(header), staged, slot, cuda::std::make_tuple(dims...)};
+    MATX_CUDA_CHECK(cudaLaunchHostFunc(exec.getStream(), detail::AsyncPrintCallback<Job>, job));
+  }
+
+  /**
+   * @brief Print all of an operator's values to an output file stream without synchronizing the device
+   *
+   * See fprint_async() for details.
+   *
+   * @tparam Op Operator input type
+   * @tparam Executor CUDA executor type
+   * @param fp Output file stream
+   * @param op Operator input
+   * @param exec CUDA executor to order the print on
+   */
+  template <typename Op, typename Executor>
+    requires (Op::Rank() > 0)
+  void fprint_async(FILE *fp, const Op &op, Executor &&exec)
+  {
+    cuda::std::array<int, Op::Rank()> arr = {0};
+    cuda::std::apply([&](auto &&...args) { fprint_async(fp, op, exec, args...); }, arr);
+  }
+
+  /**
+   * @brief Print all of an operator's values to stdout without synchronizing the device
+   *
+   * See fprint_async() for details.
+   *
+   * @tparam Op Operator input type
+   * @tparam Executor CUDA executor type
+   * @param op Operator input
+   * @param exec CUDA executor to order the print on
+   */
+  template <typename Op, typename Executor>
+  void print_async(const Op &op, Executor &&exec)
+  {
+    fprint_async(stdout, op, exec);
+  }
+
+  /**
+   * @brief Print an operator's values to stdout without synchronizing the device
+   *
+   * See fprint_async() for details.
+   *
+   * @tparam Op Operator input type
+   * @tparam Executor CUDA executor type
+   * @tparam Args Integral argument types
+   * @param op Operator input
+   * @param exec CUDA executor to order the print on
+   * @param dims Number of values to print for each dimension, with 0 printing the whole dimension
+   */
+  template <typename Op, typename Executor, typename... Args>
+    requires (sizeof...(Args) > 0)
+  void print_async(const Op &op, Executor &&exec, Args... dims)
+  {
+    fprint_async(stdout, op, exec, dims...);
+  }
+
   /**
    * @brief Set the print() precision for floating point values
    *
@@ -42,6 +42,8 @@ MATX_IGNORE_WARNING_PUSH_GCC("-Wnull-dereference")
 MATX_IGNORE_WARNING_POP_GCC
 #include <optional>
 #include <filesystem>
+#include <memory>
+#include <tuple>
 
 namespace fs = std::filesystem;
 
@@ -90,6 +92,53 @@ template <typename T> struct TestFailResult {
   double thresh;
 };
 
+/**
+ * Pending device-to-host copy of a tensor into a numpy array, returned by
+ * MatXPybind::TensorViewToNumpyAsync
+ *
+ * The array is backed by pinned host memory and must not be read until the copy has completed. Only
+ * the stream the copy was enqueued on is waited on, so other streams on the device keep running.
+ */
+class MATX_PYBIND_VISIBILITY NumpyTransfer {
+public:
+  NumpyTransfer(pybind11::array array, cudaEvent_t event) :
+    array_(std::move(array)),
+    event_(event, [](cudaEvent_t e) { cudaEventDestroy(e); }) {}
+
+  /**
+   * Check whether the copy has completed without blocking
+   *
+   * @returns True if the array can be read
+   */
+  bool ready() const {
+    const auto ret = cudaEventQuery(event_.get());
+    if (ret == cudaErrorNotReady) {
+      return false;
+    }
+    MATX_CUDA_CHECK(ret);
+    return true;
+  }
+
+  /**
+   * Block until the copy has completed
+   */
+  void wait() const { MATX_CUDA_CHECK(cudaEventSynchronize(event_.get())); }
+
+  /**
+   * Block until the copy has completed and return the array
+   *
+   * @returns Numpy array holding the tensor's values
+   */
+  pybind11::array get() const {
+    wait();
+    return array_;
+  }
+
+private:
+  pybind11::array array_;
+  std::shared_ptr<CUevent_st> event_;
+};
+
 
 class MATX_PYBIND_VISIBILITY MatXPybind {
 public:
@@ -458,6 +507,12 @@ public:
       return ften;      
     }
     else {
+      // Device memory can't be wrapped directly, so stage it through pinned memory on the default stream
+      if (!HostPrintable(GetPointerKind(ten.Data()))) {
+        return pybind11::array_t<ntype, pybind11::array::c_style | pybind11::array::forcecast>(
+            TensorViewToNumpyAsync(ten).get());
+      }
+
       const auto tshape = ten.Shape();
       const auto tstrides = ten.Strides();
       std::vector<pybind11::ssize_t> shape{tshape.begin(), tshape.end()};
@@ -479,6 +534,155 @@ public:
     }
   }
 
+  /**
+   * Copy a tensor into a new numpy array asynchronously
+   *
+   * The copy is enqueued on `stream` into pinned host memory owned by the returned array, and
+   * completion is tracked with an event rather than a device-wide synchronization, so work on other
+   * streams and host-side Python code can overlap with the transfer. Call `get()` on the result to
+   * wait for the copy and retrieve the array.
+   *
+   * @param ten
+   *   Contiguous tensor in host or device memory
+   * @param stream
+   *   CUDA stream to order the copy on
+   * @returns NumpyTransfer tracking the copy
+   */
+  template <typename TensorType>
+  NumpyTransfer TensorViewToNumpyAsync(const TensorType &ten, cudaStream_t stream = 0) {
+    using tensor_type = typename TensorType::value_type;
+    using ntype = matx_convert_complex_type<tensor_type>;
+    static_assert(!is_matx_type_v<tensor_type>, "TensorViewToNumpyAsync does not support half-precision types. Use TensorViewToNumpy instead");
+    MATX_ASSERT_STR(ten.IsContiguous(), matxInvalidSize, "TensorViewToNumpyAsync requires a contiguous tensor");
+
+    const size_t bytes = static_cast<size_t>(ten.TotalSize()) * sizeof(tensor_type);
+    void *host = nullptr;
+    matxAlloc(&host, bytes, MATX_HOST_MEMORY);
+    auto owner = pybind11::capsule(host, [](void *p) { matxFree(p); });
+
+    const auto tshape = ten.Shape();
+    std::vector<pybind11::ssize_t> shape{tshape.begin(), tshape.end()};
+    auto arr = pybind11::array_t<ntype>(shape, static_cast<ntype *>(host), owner);
+
+    cudaEvent_t event;
+    MATX_CUDA_CHECK(cudaMemcpyAsync(host, ten.Data(), bytes, cudaMemcpyDefault, stream));
+    MATX_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    MATX_CUDA_CHECK(cudaEventRecord(event, stream));
+
+    return NumpyTransfer{std::move(arr), event};
+  }
+
+  /**
+   * Export a tensor to Python through the CUDA Array Interface without copying
+   *
+   * Returns an object exposing `__cuda_array_interface__` (version 3), which CuPy, Numba, and
+   * PyTorch can wrap directly with `cupy.asarray(obj)` and similar. The interface advertises
+   * `stream`, so the consumer orders its work after everything already enqueued there. The
+   * returned object holds a reference to the tensor's memory for as long as it is alive.
+   *
+   * @param ten
+   *   Tensor in device or managed memory
+   * @param stream
+   *   CUDA stream producing the tensor
+   * @returns Python object implementing the CUDA Array Interface
+   */
+  template <typename TensorType>
+  auto TensorViewToCudaArrayInterface(const TensorType &ten, cudaStream_t stream = 0) {
+    using tensor_type = typename TensorType::value_type;
+    constexpr int RANK = TensorType::Rank();
+    static_assert(!is_matx_type_v<tensor_type>, "TensorViewToCudaArrayInterface does not support half-precision types");
+
+    pybind11::list shape;
+    pybind11::list strides;
+    for (int i = 0; i < RANK; i++) {
+      shape.append(ten.Size(i));
+      strides.append(ten.Stride(i) * static_cast<index_t>(sizeof(tensor_type)));
+    }
+
+    pybind11::dict cai;
+    cai["shape"] = pybind11::tuple(shape);
+    cai["strides"] = pybind11::tuple(strides);
+    cai["typestr"] = GetNumpyDtype<tensor_type>().attr("str");
+    cai["data"] = pybind11::make_tuple(reinterpret_cast<uintptr_t>(ten.Data()), false);
+    cai["version"] = 3;
+    cai["stream"] = ArrayApiStream(stream);
+
+    // Keep a reference to the tensor's storage alive as long as the consumer holds the object
+    auto owner = pybind11::capsule(new TensorType(ten), [](void *p) { delete static_cast<TensorType *>(p); });
+    auto types = pybind11::module_::import("types");
+    return types.attr("SimpleNamespace")("__cuda_array_interface__"_a = cai, "_matx_owner"_a = owner);
+  }
+
+
+  /**
+   * Import a Python tensor into a MatX tensor without copying using the DLPack protocol
+   *
+   * obj may either implement `__dlpack__`/`__dlpack_device__` (PyTorch, CuPy, JAX, NumPy) or be a
+   * raw "dltensor" capsule. For CUDA producers `stream` is passed as the consumer stream so the
+   * producer orders its pending work before any MatX work enqueued on that stream, avoiding a
+   * device-wide synchronization. The capsule is marked as consumed and the MatX tensor calls the
+   * producer's deleter when the last reference is released.
+   *
+   * @param ten
+   *   Tensor to store the imported tensor into
+   * @param obj
+   *   Python object to import
+   * @param stream
+   *   CUDA stream the tensor will be consumed on
+   */
+  template <typename TensorType>
+  void DLPackToTensorView(TensorType &ten, const pybind11::object &obj, cudaStream_t stream = 0)
+  {
+    pybind11::object capsule = obj;
+    if (pybind11::hasattr(obj, "__dlpack__")) {
+      const auto dev = obj.attr("__dlpack_device__")().cast<std::tuple<int, int>>();
+      const auto dev_type = std::get<0>(dev);
+      if (dev_type == kDLCUDA || dev_type == kDLCUDAManaged) {
+        capsule = obj.attr("__dlpack__")(pybind11::arg("stream") = ArrayApiStream(stream));
+      }
+      else {
+        capsule = obj.attr("__dlpack__")();
+      }
+    }
+
+    PyObject *cap = capsule.ptr();
+    if (PyCapsule_IsValid(cap, "dltensor_versioned")) {
+      auto dlp = static_cast<DLManagedTensorVersioned *>(PyCapsule_GetPointer(cap, "dltensor_versioned"));
+      PyCapsule_SetName(cap, "used_dltensor_versioned");
+      make_tensor(ten, dlp);
+    }
+    else if (PyCapsule_IsValid(cap, "dltensor")) {
+      auto dlp = static_cast<DLManagedTensor *>(PyCapsule_GetPointer(cap, "dltensor"));
+      PyCapsule_SetName(cap, "used_dltensor");
+      make_tensor(ten, dlp);
+    }
+    else {
+      MATX_THROW(matxInvalidParameter, "Python object does not support DLPack or the capsule was already consumed");
+    }
+  }
+
+  /**
+   * Export a MatX tensor to Python as a DLPack capsule without copying
+   *
+   * The capsule can be passed to `torch.from_dlpack`, `cupy.from_dlpack`, and similar. The tensor's
+   * reference count is held until the consumer releases it. Any work producing the tensor must be
+   * complete or ordered before the consumer's stream, since a bare capsule carries no stream.
+   *
+   * @param ten
+   *   Tensor to export
+   * @returns Capsule named "dltensor"
+   */
+  template <typename TensorType>
+  auto TensorViewToDLPack(const TensorType &ten)
+  {
+    return pybind11::capsule(ten.ToDlPack(), "dltensor", +[](PyObject *cap) {
+      // Only free the tensor if the capsule was never consumed
+      if (PyCapsule_IsValid(cap, "dltensor")) {
+        auto dlp = static_cast<DLManagedTensor *>(PyCapsule_GetPointer(cap, "dltensor"));
+        dlp->deleter(dlp);
+      }
+    });
+  }
 
   template <typename TensorType,
             typename CT = matx_convert_cuda_complex_type<typename TensorType::value_type>>
@@ -530,6 +734,18 @@ public:
   }
 
 private:
+  // The array API and CUDA Array Interface reserve 1 for the legacy default stream and 2 for the
+  // per-thread default stream. 0 is ambiguous and disallowed for CUDA
+  static intptr_t ArrayApiStream(cudaStream_t stream) {
+    if (stream == 0) {
+      return 1;
+    }
+    if (stream == cudaStreamPerThread) {
+      return 2;
+    }
+    return reinterpret_cast<intptr_t>(stream);
+  }
+
   inline static pybind11::scoped_interpreter *gil = nullptr;
   pybind11::module_ mod;
   pybind11::object res_dict;
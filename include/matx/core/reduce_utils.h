@@ -33,7 +33,9 @@
 
 #pragma once
 
+#include <array>
 #include <source_location>
+#include <vector>
 #include "matx/core/iterator.h"
 #include "matx/core/type_utils.h"
 #include "matx/operators/collapse.h"
@@ -44,7 +46,9 @@ namespace matx {
   
   template <bool ConvertType, typename Func, typename OutputOp, typename InputOp, typename BeginIter, typename EndIter>
   __MATX_HOST__ __MATX_INLINE__ auto ReduceOutput(Func &&func, OutputOp &&out, InputOp &&in, BeginIter &&bi, EndIter &&ei) {
-    if constexpr (remove_cvref_t<decltype(out)>::Rank() <= 1 && is_tensor_view_v<OutputOp>) {
+    // A contiguous output holds one value per segment in segment order at any rank, so CUB can
+    // write through a raw pointer
+    if constexpr (is_tensor_view_v<OutputOp>) {
       if (out.IsContiguous()) {
         if constexpr(ConvertType) {   
           return func(  in, 
@@ -69,29 +73,33 @@ namespace matx {
   template <typename Func, typename OutputOp, typename InputOp, bool ConvertType = true>
   __MATX_HOST__ __MATX_INLINE__ auto ReduceInput(Func &&func, OutputOp &&out, InputOp &&in) {
     typename detail::base_type_t<InputOp> in_base = in;    
-    if constexpr (in_base.Rank() < 2 && is_tensor_view_v<InputOp>) {
+
+    // Collapse the right-most dimensions by the difference in ranks for the reduction dimension,
+    // then collapse the left size by the output rank to get the batch dimensions  
+    auto collapsed = matx::lcollapse<remove_cvref_t<decltype(out)>::Rank()>(rcollapse<remove_cvref_t<decltype(in)>::Rank() - 
+                                                                                      remove_cvref_t<decltype(out)>::Rank()>(in_base));
+
+    // Segments of a contiguous tensor are consecutive runs of memory at any rank. Passing the raw pointer
+    // instead of an iterator skips the per-element index math and lets CUB vectorize its loads.
+    if constexpr (is_tensor_view_v<InputOp>) {
       if (in_base.IsContiguous()) {
         if constexpr (ConvertType) {
           return ReduceOutput<ConvertType>( std::forward<Func>(func), 
                                             std::forward<OutputOp>(out), 
                                             reinterpret_cast<detail::convert_matx_type_t<typename remove_cvref_t<InputOp>::value_type> *>(in_base.Data()), 
-                                            BeginOffset{in_base}, 
-                                            EndOffset{in_base});
+                                            BeginOffset{collapsed}, 
+                                            EndOffset{collapsed});
         }
         else {
           return ReduceOutput<ConvertType>( std::forward<Func>(func), 
                                             std::forward<OutputOp>(out), 
                                             reinterpret_cast<typename remove_cvref_t<InputOp>::value_type *>(in_base.Data()), 
-                                            BeginOffset{in_base}, 
-                                            EndOffset{in_base});
+                                            BeginOffset{collapsed}, 
+                                            EndOffset{collapsed});
         }
       }
     }
 
-    // Collapse the right-most dimensions by the difference in ranks for the reduction dimension,
-    // then collapse the left size by the output rank to get the batch dimensions  
-    auto collapsed = matx::lcollapse<remove_cvref_t<decltype(out)>::Rank()>(rcollapse<remove_cvref_t<decltype(in)>::Rank() - 
-                                                                                      remove_cvref_t<decltype(out)>::Rank()>(in_base));
     const auto &iter = matx::RandomOperatorIterator<decltype(collapsed), ConvertType>{collapsed};
     return ReduceOutput<ConvertType>(std::forward<Func>(func), std::forward<OutputOp>(out), iter, BeginOffset{iter}, EndOffset{iter});   
   } 
@@ -100,5 +108,117 @@ namespace matx {
   __MATX_HOST__ __MATX_INLINE__ auto ReduceInputNoConvert(Func &&func, OutputOp &&out, InputOp &&in) {
     return ReduceInput<Func, OutputOp, InputOp, false>(std::forward<Func>(func), std::forward<OutputOp>(out), std::forward<InputOp>(in));
   }
+
+namespace detail {
+
+  // Independent accumulators per serial reduction. Splitting the dependency chain lets the compiler
+  // vectorize the loop without reassociating floating point math on its own.
+  static constexpr int HOST_REDUCE_LANES = 8;
+  // Smallest piece of one batch that is reduced on its own thread
+  static constexpr index_t HOST_REDUCE_MIN_CHUNK = 16384;
+
+  template <typename T, typename LoadFn, typename Op>
+  __MATX_HOST__ __MATX_INLINE__ T HostReduceSerial(index_t begin, index_t end, const T &init, const LoadFn &load, const Op &op) {
+    std::array<T, HOST_REDUCE_LANES> acc;
+    acc.fill(init);
+
+    index_t i = begin;
+    for (; i + HOST_REDUCE_LANES <= end; i += HOST_REDUCE_LANES) {
+      for (int l = 0; l < HOST_REDUCE_LANES; l++) {
+        acc[l] = op(acc[l], load(i + l));
+      }
+    }
+    for (; i < end; i++) {
+      acc[0] = op(acc[0], load(i));
+    }
+
+    for (int w = HOST_REDUCE_LANES / 2; w > 0; w /= 2) {
+      for (int l = 0; l < w; l++) {
+        acc[l] = op(acc[l], acc[l + w]);
+      }
+    }
+
+    return acc[0];
+  }
+
+  /**
+   * Reduce every batch of a host reduction across the executor's threads
+   *
+   * Batch b covers the elements [begin(b), end(b)), read with load(i). When there are at least as
+   * many batches as threads, whole batches are handed to threads. Otherwise each batch is cut into
+   * chunks of at least HOST_REDUCE_MIN_CHUNK elements that are reduced in parallel, and the partials
+   * are combined pairwise. op must be associative, and init(first) must return an identity of op or,
+   * for idempotent operations such as max, the element at index first. The combination order only
+   * depends on the shape and thread count, so results are reproducible.
+   *
+   * @returns One result per batch
+   */
+  template <typename T, typename Executor, typename BeginFn, typename EndFn, typename InitFn, typename LoadFn, typename Op>
+  __MATX_HOST__ std::vector<T> HostReduceBatches(const Executor &exec, index_t batches, const BeginFn &begin, const EndFn &end,
+                                                 const InitFn &init, const LoadFn &load, const Op &op) {
+    std::vector<T> out(static_cast<size_t>(batches));
+    const index_t nthreads = cuda::std::max(1, exec.GetNumThreads());
+
+    index_t longest = 0;
+    for (index_t b = 0; b < batches; b++) {
+      longest = cuda::std::max(longest, end(b) - begin(b));
+    }
+
+    index_t chunks = 1;
+    if (batches < nthreads) {
+      chunks = cuda::std::min((nthreads + batches - 1) / batches, (longest + HOST_REDUCE_MIN_CHUNK - 1) / HOST_REDUCE_MIN_CHUNK);
+      chunks = cuda::std::max(index_t{1}, chunks);
+    }
+
+    if (chunks == 1) {
+      exec.ParallelFor(batches, [&](index_t b) {
+        out[static_cast<size_t>(b)] = HostReduceSerial(begin(b), end(b), init(begin(b)), load, op);
+      });
+      return out;
+    }
+
+    std::vector<T> parts(static_cast<size_t>(batches * chunks));
+    exec.ParallelFor(batches * chunks, [&](index_t w) {
+      const index_t b = w / chunks;
+      const index_t c = w - b * chunks;
+      const index_t first = begin(b);
+      const index_t len = end(b) - first;
+      parts[static_cast<size_t>(w)] = HostReduceSerial(first + len * c / chunks, first + len * (c + 1) / chunks, init(first), load, op);
+    });
+
+    for (index_t b = 0; b < batches; b++) {
+      const size_t base = static_cast<size_t>(b * chunks);
+      for (size_t w = 1; w < static_cast<size_t>(chunks); w *= 2) {
+        for (size_t i = 0; i + w < static_cast<size_t>(chunks); i += 2 * w) {
+          parts[base + i] = op(parts[base + i], parts[base + i + w]);
+        }
+      }
+      out[static_cast<size_t>(b)] = parts[base];
+    }
+
+    return out;
+  }
+
+  /**
+   * Reduce the input handed to a ReduceInput callback on the executor's threads
+   *
+   * With a rank 0 output there is one batch covering all total elements of lin. Otherwise there is
+   * one batch per row of lin, covering [lbegin[b], lend[b]).
+   */
+  template <int OUT_RANK, typename T, typename Executor, typename Lin, typename LBegin, typename LEnd, typename InitFn, typename LoadFn, typename Op>
+  __MATX_HOST__ __MATX_INLINE__ std::vector<T> HostReduceRows(const Executor &exec, index_t total, const Lin &lin, const LBegin &lbegin,
+                                                              const LEnd &lend, const InitFn &init, const LoadFn &load, const Op &op) {
+    if constexpr (OUT_RANK == 0) {
+      return HostReduceBatches<T>(exec, 1, [](index_t) { return index_t{0}; }, [total](index_t) { return total; }, init, load, op);
+    }
+    else {
+      return HostReduceBatches<T>(exec, lin.Size(0),
+                                  [&](index_t b) { return static_cast<index_t>(lbegin[b]); },
+                                  [&](index_t b) { return static_cast<index_t>(lend[b]); },
+                                  init, load, op);
+    }
+  }
+
+} // end namespace detail
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <cstdint>
+
+#include "matx/core/error.h"
+#include "matx/core/make_tensor.h"
+#include "matx/executors/cuda.h"
+#include "matx/kernels/rx_ring.cuh"
+#include "matx/operators/base_operator.h"
+
+namespace matx
+{
+namespace detail {
+
+/**
+ * Read-only 1D view of the payload samples of consecutive packets in a receive ring
+ *
+ * Sample i comes from packet (first + i / spp) modulo the ring size, past its header, so the view is
+ * contiguous in sample order across packet boundaries and across the wrap of the ring.
+ */
+template <typename T>
+class RxRingSamplesOp : public BaseOp<RxRingSamplesOp<T>> {
+  public:
+    using matxop = bool;
+    using value_type = T;
+
+    RxRingSamplesOp(const uint8_t *ring, index_t slots, index_t slot_bytes, index_t header_bytes,
+                    index_t spp, index_t first, index_t count) :
+        ring_(ring), slots_(slots), slot_bytes_(slot_bytes), header_bytes_(header_bytes), spp_(spp),
+        first_(first), size_(count * spp) {}
+
+    __MATX_INLINE__ std::string str() const { return "rx_ring_samples"; }
+
+    template <typename CapType>
+    __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ T operator()(index_t i) const {
+      const index_t slot = (first_ + i / spp_) % slots_;
+      const T *payload = reinterpret_cast<const T *>(ring_ + slot * slot_bytes_ + header_bytes_);
+      return payload[i % spp_];
+    }
+
+    __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ T operator()(index_t i) const {
+      return this->operator()<DefaultCapabilities>(i);
+    }
+
+    static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank() { return 1; }
+
+    constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size([[maybe_unused]] int dim) const {
+      return size_;
+    }
+
+    template <OperatorCapability Cap, typename InType>
+    __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType &in) const {
+      if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+        return cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+      }
+      else {
+        return capability_attributes<Cap>::default_value;
+      }
+    }
+
+  private:
+    const uint8_t *ring_;
+    index_t slots_;
+    index_t slot_bytes_;
+    index_t header_bytes_;
+    index_t spp_;
+    index_t first_;
+    index_t size_;
+};
+
+} // namespace detail
+
+/**
+ * @brief Tensor views over a device-resident packet receive ring
+ *
+ * Describes a ring of fixed-size packet slots in GPU memory that a NIC fills directly, for example through
+ * GPUDirect RDMA or DOCA GPUNetIO, together with one 32-bit ready flag per slot in device memory. Each slot holds
+ * a header followed by a payload of samples of type T. The ring and flags are owned by the receive path; rxRing
+ * only wraps them.
+ *
+ * Payloads are consumed in place without any host round trip:
+ *
+ * - Wait() enqueues a kernel that spins until the flags of a range of packets are set by the receiver, so later
+ *   work on the executor only starts once the packets have landed.
+ * - Packets() is a strided 2D tensor of payloads with the headers skipped, for per-packet processing.
+ * - Samples() is a 1D operator reading the payloads as one contiguous signal across packet boundaries and the
+ *   wrap of the ring. It can be passed directly to streaming transforms such as StreamingResamplePoly.
+ * - Release() enqueues a kernel clearing the flags once the packets have been consumed.
+ *
+ * A flag must only be set once the payload of its slot is visible to the GPU. Packet numbers passed to the
+ * methods are absolute and wrap modulo the number of slots.
+ *
+ * @tparam T Sample type
+ */
+template <typename T>
+class rxRing {
+  public:
+    /**
+     * @brief Wrap a receive ring
+     *
+     * @param ring Device pointer to the first slot
+     * @param flags Device pointer to one ready flag per slot. Zero means empty
+     * @param slots Number of slots
+     * @param slot_bytes Bytes between the starts of consecutive slots
+     * @param header_bytes Bytes of header before the payload in each slot
+     * @param samples_per_packet Payload samples in each slot
+     */
+    rxRing(void *ring, uint32_t *flags, index_t slots, index_t slot_bytes, index_t header_bytes,
+           index_t samples_per_packet) :
+        ring_(static_cast<uint8_t *>(ring)), flags_(flags), slots_(slots), slot_bytes_(slot_bytes),
+        header_bytes_(header_bytes), spp_(samples_per_packet)
+    {
+      MATX_ASSERT_STR(slots > 0 && samples_per_packet > 0, matxInvalidSize, "rxRing: ring must not be empty");
+      MATX_ASSERT_STR(header_bytes >= 0 && header_bytes + samples_per_packet * static_cast<index_t>(sizeof(T)) <= slot_bytes,
+                      matxInvalidSize, "rxRing: header and payload must fit in a slot");
+      MATX_ASSERT_STR(slot_bytes % static_cast<index_t>(alignof(T)) == 0 && header_bytes % static_cast<index_t>(alignof(T)) == 0,
+                      matxInvalidParameter, "rxRing: slot and header sizes must keep the payload aligned");
+    }
+
+    /**
+     * @brief Number of slots in the ring
+     */
+    index_t Slots() const { return slots_; }
+
+    /**
+     * @brief Payload samples per packet
+     */
+    index_t SamplesPerPacket() const { return spp_; }
+
+    /**
+     * @brief Strided 2D view of the payloads of count packets, one packet per row
+     *
+     * The packets must not wrap around the end of the ring. Use Samples() for ranges that do.
+     *
+     * @param first Absolute number of the first packet
+     * @param count Number of packets
+     * @returns Tensor of shape {count, SamplesPerPacket()}
+     */
+    auto Packets(index_t first, index_t count) const {
+      const index_t slot = first % slots_;
+      MATX_ASSERT_STR(count > 0 && slot + count <= slots_, matxInvalidSize, "rxRing: packet range wraps the ring");
+      MATX_ASSERT_STR(slot_bytes_ % static_cast<index_t>(sizeof(T)) == 0, matxInvalidParameter,
+                      "rxRing: strided packet views need a slot size that is a multiple of the sample size");
+      T *base = reinterpret_cast<T *>(ring_ + slot * slot_bytes_ + header_bytes_);
+      return make_tensor<T>(base, {count, spp_}, {slot_bytes_ / static_cast<index_t>(sizeof(T)), 1});
+    }
+
+    /**
+     * @brief Contiguous 1D view of the payload samples of count packets
+     *
+     * @param first Absolute number of the first packet
+     * @param count Number of packets, at most Slots()
+     * @returns Read-only operator of count * SamplesPerPacket() samples
+     */
+    auto Samples(index_t first, index_t count) const {
+      MATX_ASSERT_STR(count > 0 && count <= slots_, matxInvalidSize, "rxRing: packet range is larger than the ring");
+      return detail::RxRingSamplesOp<T>(ring_, slots_, slot_bytes_, header_bytes_, spp_, first % slots_, count);
+    }
+
+    /**
+     * @brief Make later work on the executor wait until count packets have arrived
+     *
+     * @param first Absolute number of the first packet
+     * @param count Number of packets, at most Slots()
+     * @param exec CUDA executor
+     */
+    void Wait(index_t first, index_t count, const cudaExecutor &exec) const {
+      MATX_ASSERT_STR(count > 0 && count <= slots_, matxInvalidSize, "rxRing: packet range is larger than the ring");
+#ifdef __CUDACC__
+      const auto blocks = static_cast<unsigned int>((count + detail::RX_RING_THREADS - 1) / detail::RX_RING_THREADS);
+      detail::RxRingWaitKernel<<<blocks, detail::RX_RING_THREADS, 0, exec.getStream()>>>(flags_, slots_, first % slots_, count);
+      MATX_CUDA_CHECK_LAST_ERROR();
+#else
+      MATX_THROW(matxNotSupported, "rxRing requires compiling with nvcc");
+#endif
+    }
+
+    /**
+     * @brief Return count packets to the receiver once all earlier work on the executor has consumed them
+     *
+     * @param first Absolute number of the first packet
+     * @param count Number of packets, at most Slots()
+     * @param exec CUDA executor
+     */
+    void Release(index_t first, index_t count, const cudaExecutor &exec) const {
+      MATX_ASSERT_STR(count > 0 && count <= slots_, matxInvalidSize, "rxRing: packet range is larger than the ring");
+#ifdef __CUDACC__
+      const auto blocks = static_cast<unsigned int>((count + detail::RX_RING_THREADS - 1) / detail::RX_RING_THREADS);
+      detail::RxRingReleaseKernel<<<blocks, detail::RX_RING_THREADS, 0, exec.getStream()>>>(flags_, slots_, first % slots_, count);
+      MATX_CUDA_CHECK_LAST_ERROR();
+#else
+      MATX_THROW(matxNotSupported, "rxRing requires compiling with nvcc");
+#endif
+    }
+
+  private:
+    uint8_t *ring_;
+    uint32_t *flags_;
+    index_t slots_;
+    index_t slot_bytes_;
+    index_t header_bytes_;
+    index_t spp_;
+};
+
+} // namespace matx
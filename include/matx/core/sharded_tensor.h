@@ -0,0 +1,363 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda_runtime.h>
+#include <memory>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/executors/cuda.h"
+#include "matx/operators/operators.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * @brief Make a device current for the lifetime of the guard
+ */
+class ShardDeviceGuard {
+  public:
+    explicit ShardDeviceGuard(int dev)
+    {
+      MATX_CUDA_CHECK(cudaGetDevice(&prev_));
+      MATX_CUDA_CHECK(cudaSetDevice(dev));
+    }
+
+    ~ShardDeviceGuard() { cudaSetDevice(prev_); }
+
+    ShardDeviceGuard(const ShardDeviceGuard &) = delete;
+    ShardDeviceGuard &operator=(const ShardDeviceGuard &) = delete;
+
+  private:
+    int prev_;
+};
+
+/**
+ * @brief Per-device streams shared by all copies of a sharded tensor
+ */
+class ShardStreams {
+  public:
+    explicit ShardStreams(const std::vector<int> &devices) : devices_(devices)
+    {
+      for (const int dev : devices_) {
+        ShardDeviceGuard guard(dev);
+        cudaStream_t stream;
+        MATX_CUDA_CHECK(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+        streams_.push_back(stream);
+        execs_.emplace_back(stream);
+      }
+    }
+
+    ~ShardStreams()
+    {
+      for (size_t s = 0; s < streams_.size(); s++) {
+        ShardDeviceGuard guard(devices_[s]);
+        cudaStreamSynchronize(streams_[s]);
+        cudaStreamDestroy(streams_[s]);
+      }
+    }
+
+    ShardStreams(const ShardStreams &) = delete;
+    ShardStreams &operator=(const ShardStreams &) = delete;
+
+    int Device(int s) const { return devices_[s]; }
+    cudaExecutor &Executor(int s) { return execs_[s]; }
+
+  private:
+    std::vector<int> devices_;
+    std::vector<cudaStream_t> streams_;
+    std::vector<cudaExecutor> execs_;
+};
+
+}; // namespace detail
+
+/**
+ * @brief Tensor split along its first dimension across several GPUs
+ *
+ * Each shard is a regular device tensor allocated on its own GPU with its own
+ * stream. Rows are split as evenly as possible, with the first shards taking
+ * one extra row when the first dimension does not divide evenly. The sharded
+ * tensor is not an operator; element-wise work runs on each shard with
+ * for_each_shard, and sharded_sum/sharded_min/sharded_max reduce every shard
+ * on its device and combine the per-shard results on the host. Copies share
+ * the same shards and streams.
+ *
+ * @tparam T Data type
+ * @tparam RANK Rank of tensor
+ */
+template <typename T, int RANK>
+class sharded_tensor_t {
+  static_assert(RANK >= 1, "Sharded tensors must have rank 1 or higher");
+
+  public:
+    using value_type = T;
+    using shard_type = tensor_t<T, RANK>;
+
+    /**
+     * @brief Allocate a tensor split across devices
+     *
+     * @param shape Shape of the full tensor
+     * @param devices CUDA devices holding one shard each, in row order
+     */
+    sharded_tensor_t(const cuda::std::array<index_t, RANK> &shape, const std::vector<int> &devices)
+      : shape_(shape)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      MATX_ASSERT_STR(!devices.empty(), matxInvalidParameter, "Sharded tensors need at least one device");
+      MATX_ASSERT_STR(shape[0] >= static_cast<index_t>(devices.size()), matxInvalidSize,
+          "Sharded tensors need at least one row of the first dimension per device");
+
+      streams_ = std::make_shared<detail::ShardStreams>(devices);
+
+      const auto n = static_cast<index_t>(devices.size());
+      index_t first = 0;
+      for (index_t s = 0; s < n; s++) {
+        auto sshape = shape;
+        sshape[0] = shape[0] / n + (s < shape[0] % n ? 1 : 0);
+        offsets_.push_back(first);
+        first += sshape[0];
+
+        detail::ShardDeviceGuard guard(devices[s]);
+        shards_.push_back(make_tensor<T>(sshape, MATX_DEVICE_MEMORY));
+      }
+
+      MATX_LOG_DEBUG("Sharded tensor: rank={}, shards={}", RANK, n);
+    }
+
+    static constexpr int Rank() { return RANK; }
+
+    index_t Size(int dim) const { return shape_[dim]; }
+
+    int NumShards() const { return static_cast<int>(shards_.size()); }
+
+    /**
+     * @brief CUDA device holding shard s
+     */
+    int Device(int s) const { return streams_->Device(s); }
+
+    /**
+     * @brief Device tensor holding shard s
+     */
+    shard_type &Shard(int s) { return shards_[s]; }
+    const shard_type &Shard(int s) const { return shards_[s]; }
+
+    /**
+     * @brief Index of the first row of shard s in the full tensor
+     */
+    index_t ShardOffset(int s) const { return offsets_[s]; }
+
+    /**
+     * @brief Executor on shard s's stream
+     */
+    cudaExecutor &Executor(int s) const { return streams_->Executor(s); }
+
+    /**
+     * @brief Wait for the work on every shard's stream
+     */
+    void Sync() const
+    {
+      for (int s = 0; s < NumShards(); s++) {
+        detail::ShardDeviceGuard guard(Device(s));
+        Executor(s).sync();
+      }
+    }
+
+    /**
+     * @brief Copy a full contiguous tensor into the shards
+     *
+     * The copies are issued on every shard's stream concurrently and have
+     * finished when the call returns.
+     *
+     * @param in Contiguous tensor with the full shape, in host or device memory
+     */
+    template <typename TensorType>
+    void Scatter(const TensorType &in) const
+    {
+      Copy(const_cast<TensorType &>(in), true);
+    }
+
+    /**
+     * @brief Copy the shards into a full contiguous tensor
+     *
+     * @param out Contiguous tensor with the full shape, in host or device memory
+     */
+    template <typename TensorType>
+    void Gather(TensorType &out) const
+    {
+      Copy(out, false);
+    }
+
+  private:
+    template <typename TensorType>
+    void Copy(TensorType &t, bool to_shards) const
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+      static_assert(is_tensor_view_v<TensorType>, "Sharded tensors can only be copied to and from tensors");
+      static_assert(TensorType::Rank() == RANK, "Tensor rank must match the sharded tensor rank");
+      static_assert(std::is_same_v<typename TensorType::value_type, T>, "Tensor type must match the sharded tensor type");
+      MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter, "Sharded tensor copies need a contiguous tensor");
+      for (int r = 0; r < RANK; r++) {
+        MATX_ASSERT_STR(t.Size(r) == shape_[r], matxInvalidSize, "Tensor shape must match the sharded tensor shape");
+      }
+
+      for (int s = 0; s < NumShards(); s++) {
+        detail::ShardDeviceGuard guard(Device(s));
+        const auto &shard = shards_[s];
+        const index_t row = TotalSize(shard) / shard.Size(0);
+        T *full = t.Data() + offsets_[s] * row;
+        const size_t bytes = static_cast<size_t>(TotalSize(shard)) * sizeof(T);
+        MATX_CUDA_CHECK(cudaMemcpyAsync(to_shards ? shard.Data() : full, to_shards ? full : shard.Data(),
+                                        bytes, cudaMemcpyDefault, Executor(s).getStream()));
+      }
+      Sync();
+    }
+
+    cuda::std::array<index_t, RANK> shape_;
+    std::vector<shard_type> shards_;
+    std::vector<index_t> offsets_;
+    std::shared_ptr<detail::ShardStreams> streams_;
+};
+
+/**
+ * @brief Create a tensor split along its first dimension across devices
+ *
+ * @tparam T Data type
+ * @tparam RANK Rank of tensor
+ * @param shape Shape of the full tensor
+ * @param devices CUDA devices holding one shard each, in row order
+ * @returns Sharded tensor
+ */
+template <typename T, int RANK>
+auto make_sharded_tensor(const index_t (&shape)[RANK], const std::vector<int> &devices)
+{
+  cuda::std::array<index_t, RANK> s;
+  for (int r = 0; r < RANK; r++) {
+    s[r] = shape[r];
+  }
+  return sharded_tensor_t<T, RANK>(s, devices);
+}
+
+/**
+ * @brief Run a function on every shard of a sharded tensor
+ *
+ * fn is called as fn(s, shard, exec) with shard s's device current, where
+ * shard is the device tensor for that shard and exec the executor on its
+ * stream. Other sharded tensors with the same shape and devices share the
+ * same row split, so their Shard(s) can be used in the same expression. The
+ * work on all shards runs concurrently. for_each_shard does not wait for it;
+ * call Sync() on the sharded tensor before reading the results on the host.
+ *
+ * @param t Sharded tensor
+ * @param fn Function called for each shard
+ */
+template <typename T, int RANK, typename Func>
+void for_each_shard(const sharded_tensor_t<T, RANK> &t, Func &&fn)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  for (int s = 0; s < t.NumShards(); s++) {
+    detail::ShardDeviceGuard guard(t.Device(s));
+    fn(s, const_cast<typename sharded_tensor_t<T, RANK>::shard_type &>(t.Shard(s)), t.Executor(s));
+  }
+}
+
+namespace detail {
+
+template <typename Reduce, typename Combine, typename T, int RANK>
+T sharded_reduce(const sharded_tensor_t<T, RANK> &t, Reduce &&reduce, Combine &&combine)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  std::vector<tensor_t<T, 0>> partial;
+  for (int s = 0; s < t.NumShards(); s++) {
+    ShardDeviceGuard guard(t.Device(s));
+    partial.push_back(make_tensor<T>({}, MATX_HOST_MEMORY));
+    (partial.back() = reduce(t.Shard(s))).run(t.Executor(s));
+  }
+  t.Sync();
+
+  T result = partial[0]();
+  for (int s = 1; s < t.NumShards(); s++) {
+    result = combine(result, partial[s]());
+  }
+  return result;
+}
+
+}; // namespace detail
+
+/**
+ * @brief Sum of every element of a sharded tensor
+ *
+ * Each shard is summed on its own device, and the per-shard sums are added on
+ * the host.
+ *
+ * @param t Sharded tensor
+ * @returns Sum of all elements
+ */
+template <typename T, int RANK>
+T sharded_sum(const sharded_tensor_t<T, RANK> &t)
+{
+  return detail::sharded_reduce(t, [](const auto &shard) { return sum(shard); },
+                                [](const T &a, const T &b) { return a + b; });
+}
+
+/**
+ * @brief Minimum element of a sharded tensor
+ *
+ * @param t Sharded tensor
+ * @returns Smallest element
+ */
+template <typename T, int RANK>
+T sharded_min(const sharded_tensor_t<T, RANK> &t)
+{
+  return detail::sharded_reduce(t, [](const auto &shard) { return min(shard); },
+                                [](const T &a, const T &b) { return b < a ? b : a; });
+}
+
+/**
+ * @brief Maximum element of a sharded tensor
+ *
+ * @param t Sharded tensor
+ * @returns Largest element
+ */
+template <typename T, int RANK>
+T sharded_max(const sharded_tensor_t<T, RANK> &t)
+{
+  return detail::sharded_reduce(t, [](const auto &shard) { return max(shard); },
+                                [](const T &a, const T &b) { return a < b ? b : a; });
+}
+
+} // end namespace matx
@@ -35,6 +35,7 @@
 #include <string>
 
 #include "matx/core/sparse_tensor_format.h"
+#include "matx/core/tensor.h"
 #include "matx/core/tensor_impl.h"
 #include "matx/operators/base_operator.h"
 
@@ -166,6 +167,20 @@ public:
     return static_cast<index_t>(positions_[l].size());
   }
 
+  // Storage getters. The returned storage shares the underlying buffers,
+  // which allows constructing sparse tensors with the same nonzero pattern.
+  StorageV GetValStorage() const { return values_; }
+  StorageC GetCrdStorage(int l) const { return coordinates_[l]; }
+  StorageP GetPosStorage(int l) const { return positions_[l]; }
+
+  // A dense 1-dim view of the explicitly stored values (viz. nse elements),
+  // so that any element-wise operator can act on the values directly
+  // (e.g. (A.Values() = abs(A.Values())).run(exec);). Note that such an
+  // operation keeps the nonzero pattern, even if some values become zero.
+  __MATX_INLINE__ auto Values() const {
+    return make_tensor<VAL>(values_, cuda::std::array<index_t, 1>{Nse()});
+  }
+
 private:
   // Primary storage of sparse tensor (explicitly stored element values).
   StorageV values_;
@@ -211,6 +211,37 @@ public:
     return false;
   }
 
+  // Block sparse rows, with blocks stored row-wise (BSR) or column-wise
+  // (BSRCol), and their block dimensions.
+  static constexpr bool isBSR() { return isBlocked<true>(); }
+
+  static constexpr bool isBSRCol() { return isBlocked<false>(); }
+
+  static constexpr int blockRows() {
+    return cuda::std::tuple_element_t<0, LvlSpecs>::Expr::cj;
+  }
+
+  static constexpr int blockCols() {
+    return cuda::std::tuple_element_t<1, LvlSpecs>::Expr::cj;
+  }
+
+  template <bool ROW> static constexpr bool isBlocked() {
+    if constexpr (DIM == 2 && LVL == 4) {
+      using type0 = cuda::std::tuple_element_t<0, LvlSpecs>;
+      using type1 = cuda::std::tuple_element_t<1, LvlSpecs>;
+      using type2 = cuda::std::tuple_element_t<ROW ? 2 : 3, LvlSpecs>;
+      using type3 = cuda::std::tuple_element_t<ROW ? 3 : 2, LvlSpecs>;
+      return type0::Expr::op == LvlOp::Div && type0::Expr::di == 0 &&
+             type0::Type::isDense() && type1::Expr::op == LvlOp::Div &&
+             type1::Expr::di == 1 && type1::Type::isCompressed() &&
+             type2::Expr::op == LvlOp::Mod && type2::Expr::di == 0 &&
+             type2::Expr::cj == type0::Expr::cj && type2::Type::isDense() &&
+             type3::Expr::op == LvlOp::Mod && type3::Expr::di == 1 &&
+             type3::Expr::cj == type1::Expr::cj && type3::Type::isDense();
+    }
+    return false;
+  }
+
   static constexpr bool isBatchedDIAIUniform() {
     if constexpr (DIM == 3 && LVL == 3) {
       using type0 = cuda::std::tuple_element_t<0, LvlSpecs>;
@@ -211,5 +211,38 @@ namespace matx
     return Storage<T>(ptr, size);
   }
 
+  /**
+   * @brief Factory function to create storage that page-locks existing host memory
+   *
+   * The memory is registered with cudaHostRegister and unregistered when the last copy of the storage is
+   * destroyed. The memory itself is never freed. If the range is already registered, the storage does not
+   * take over the registration and leaves it in place.
+   */
+  template <typename T>
+  Storage<T> make_registered_storage(T* ptr, size_t size, unsigned int flags) {
+    if (size == 0) {
+      return Storage<T>(ptr, size);
+    }
+
+    const auto res = cudaHostRegister(static_cast<void *>(ptr), size * sizeof(T), flags);
+    if (res == cudaErrorHostMemoryAlreadyRegistered) {
+      cudaGetLastError(); // Clear the sticky error
+      MATX_LOG_DEBUG("make_registered_storage: ptr={} already registered", reinterpret_cast<void*>(ptr));
+      return Storage<T>(ptr, size);
+    }
+    MATX_CUDA_CHECK(res);
+
+    if (flags & cudaHostRegisterMapped) {
+      void *dev_ptr = nullptr;
+      MATX_CUDA_CHECK(cudaHostGetDevicePointer(&dev_ptr, static_cast<void *>(ptr), 0));
+      if (dev_ptr != static_cast<void *>(ptr)) {
+        cudaHostUnregister(static_cast<void *>(ptr));
+        MATX_THROW(matxNotSupported, "Registered host memory must be addressable from the device with the host pointer");
+      }
+    }
+
+    return Storage<T>(std::shared_ptr<T>(ptr, [](T *p) { cudaHostUnregister(static_cast<void *>(p)); }), size);
+  }
+
 
 };
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "matx/core/error.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Tracks the last stream to write each range of memory so readers on other streams can wait for it
+ *
+ * Used by run() on CUDA executors with dependency tracking enabled. After an expression is launched, an event is
+ * recorded on its stream for the memory covered by its outputs. Before the next expression is launched on a
+ * different stream, that stream waits on the events of every tracked range its tensors overlap. Only writes made
+ * through tracking executors are known, and a range is forgotten once it is completely overwritten.
+ */
+class StreamDependencyTracker {
+  public:
+    static StreamDependencyTracker &Get() {
+      static StreamDependencyTracker tracker;
+      return tracker;
+    }
+
+    ~StreamDependencyTracker() {
+      writers_.clear();
+      for (auto ev : free_events_) {
+        cudaEventDestroy(ev);
+      }
+    }
+
+    /**
+     * Make stream wait for the last writer of every tracked range overlapping [first, last)
+     */
+    void Wait(const void *first, const void *last, cudaStream_t stream) {
+      const auto lo = reinterpret_cast<uintptr_t>(first);
+      const auto hi = reinterpret_cast<uintptr_t>(last);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto it = FirstOverlap(lo); it != writers_.end() && it->first < hi; ++it) {
+        if (it->second.end > lo && it->second.stream != stream) {
+          MATX_CUDA_CHECK(cudaStreamWaitEvent(stream, it->second.event.get(), 0));
+        }
+      }
+    }
+
+    /**
+     * Record that the work issued so far on stream writes [first, last)
+     */
+    void Record(const void *first, const void *last, cudaStream_t stream) {
+      const auto lo = reinterpret_cast<uintptr_t>(first);
+      const auto hi = reinterpret_cast<uintptr_t>(last);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto event = MakeEvent();
+      MATX_CUDA_CHECK(cudaEventRecord(event.get(), stream));
+
+      // Older writers keep only the parts of their ranges outside the new one
+      auto it = FirstOverlap(lo);
+      while (it != writers_.end() && it->first < hi) {
+        if (it->second.end <= lo) {
+          ++it;
+          continue;
+        }
+
+        const auto start = it->first;
+        const Writer old = it->second;
+        it = writers_.erase(it);
+        if (start < lo) {
+          writers_.emplace(start, Writer{lo, old.stream, old.event});
+        }
+        if (old.end > hi) {
+          writers_.emplace(hi, Writer{old.end, old.stream, old.event});
+        }
+      }
+
+      writers_.emplace(lo, Writer{hi, stream, std::move(event)});
+    }
+
+    /**
+     * Forget every tracked write
+     */
+    void Clear() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      writers_.clear();
+    }
+
+  private:
+    struct Writer {
+      uintptr_t end;
+      cudaStream_t stream;
+      std::shared_ptr<CUevent_st> event; // Shared by the pieces of a range split by a later write
+    };
+
+    StreamDependencyTracker() = default;
+
+    // Events are reused once no range refers to them. Only called with mutex_ held.
+    std::shared_ptr<CUevent_st> MakeEvent() {
+      cudaEvent_t ev;
+      if (free_events_.empty()) {
+        MATX_CUDA_CHECK(cudaEventCreateWithFlags(&ev, cudaEventDisableTiming));
+      }
+      else {
+        ev = free_events_.back();
+        free_events_.pop_back();
+      }
+
+      return std::shared_ptr<CUevent_st>(ev, [this](cudaEvent_t e) { free_events_.push_back(e); });
+    }
+
+    std::map<uintptr_t, Writer>::iterator FirstOverlap(uintptr_t lo) {
+      auto it = writers_.upper_bound(lo);
+      if (it != writers_.begin() && std::prev(it)->second.end > lo) {
+        --it;
+      }
+      return it;
+    }
+
+    std::mutex mutex_;
+    std::vector<cudaEvent_t> free_events_;
+    std::map<uintptr_t, Writer> writers_;
+};
+
+} // namespace detail
+} // namespace matx
@@ -637,7 +637,7 @@ public:
   template <typename M = T, int R = RANK, typename Shape>
   __MATX_INLINE__ auto View(Shape &&shape)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     [[maybe_unused]] stride_type prod = cuda::std::accumulate(cuda::std::begin(shape), cuda::std::end(shape), static_cast<stride_type>(1), cuda::std::multiplies<stride_type>());
     // Ensure new shape's total size is not larger than the original
@@ -695,7 +695,7 @@ public:
   template <typename ShapeIntType, int NRANK>
   __MATX_INLINE__ auto View(const ShapeIntType (&shape)[NRANK])
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     // Change this to not rely on index_t
     cuda::std::array<index_t, NRANK> tshape;
@@ -737,7 +737,7 @@ public:
    */
   __MATX_INLINE__ void PrefetchDevice(cudaStream_t const stream) const noexcept
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     int dev;
     cudaGetDevice(&dev);
@@ -763,7 +763,7 @@ public:
    */
   __MATX_INLINE__ void PrefetchHost(cudaStream_t const stream) const noexcept
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   #if CUDART_VERSION <= 12000
     cudaMemPrefetchAsync(this->Data(), this->desc_.TotalSize() * sizeof(T), cudaCpuDeviceId,
@@ -787,7 +787,7 @@ public:
   template <typename U = T>
   __MATX_INLINE__ auto RealView() const noexcept
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     static_assert(is_complex_v<T>, "RealView() only works with complex types");
 
@@ -834,7 +834,7 @@ MATX_LOOP_UNROLL
   template <typename U = T>
   __MATX_INLINE__ auto ImagView() const noexcept
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     static_assert(is_complex_v<T>, "ImagView() only works with complex types");
 
@@ -876,7 +876,7 @@ MATX_LOOP_UNROLL
    */
   __MATX_INLINE__ auto Permute(const cuda::std::array<int32_t, RANK> &dims) const
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     auto new_desc = this->PermuteImpl(dims);
     return tensor_t<T, RANK, Desc>{storage_, std::move(new_desc), this->Data()};
@@ -915,7 +915,7 @@ MATX_LOOP_UNROLL
    */
   __MATX_INLINE__ auto PermuteMatrix() const
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     static_assert(RANK >= 2, "Only tensors of rank 2 and higher can be permuted.");
     int32_t tdims[RANK];
@@ -963,7 +963,7 @@ MATX_LOOP_UNROLL
   __MATX_HOST__ __MATX_INLINE__ void
   Reset(T *const data) noexcept
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     // For non-owning storage, we need to recreate the storage object
     storage_ = make_non_owning_storage<T>(data, this->desc_.TotalSize());
@@ -1081,7 +1081,7 @@ MATX_LOOP_UNROLL
   template <int N>
   __MATX_INLINE__ auto Clone(const cuda::std::array<index_t, N> &clones) const
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     auto new_desc = this->template CloneImpl<N>(clones);
     return tensor_t<T, N, decltype(new_desc)>{storage_, std::move(new_desc), this->Data()};
@@ -1117,7 +1117,7 @@ MATX_LOOP_UNROLL
   {
     static_assert(RANK == 0, "Single value in SetVals must be applied only to rank-0 tensor");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     MATX_ASSERT_STR(IsHostAccessiblePointer(), matxNotSupported, "SetVals only supports host-accessible pointers (managed, host-pinned, or ATS-mapped)");
     this->operator()() = val;
@@ -1141,7 +1141,7 @@ MATX_LOOP_UNROLL
       "Single initializer list on SetVals only for non-complex rank 1 tensor or complex rank 0 tensors");
     MATX_ASSERT_STR(IsHostAccessiblePointer(), matxNotSupported, "SetVals only supports host-accessible pointers (managed, host-pinned, or ATS-mapped)");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     for (size_t i = 0; i < vals.size(); i++) {
       if constexpr (is_cuda_complex_v<T>) {
@@ -1175,7 +1175,7 @@ MATX_LOOP_UNROLL
       "Double initializer list on SetVals only for non-complex rank 2 tensor or complex rank 1 tensors");
     MATX_ASSERT_STR(IsHostAccessiblePointer(), matxNotSupported, "SetVals only supports host-accessible pointers (managed, host-pinned, or ATS-mapped)");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     for (index_t i = 0; i < static_cast<index_t>(vals.size()); i++) {
       for (index_t j = 0; j < static_cast<index_t>((vals.begin() + i)->size()); j++) {
@@ -1215,7 +1215,7 @@ MATX_LOOP_UNROLL
       "Triple initializer list on SetVals only for non-complex rank 3 tensor or complex rank 2 tensors");
     MATX_ASSERT_STR(IsHostAccessiblePointer(), matxNotSupported, "SetVals only supports host-accessible pointers (managed, host-pinned, or ATS-mapped)");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     for (size_t i = 0; i < vals.size(); i++) {
       for (size_t j = 0; j < (vals.begin() + i)->size(); j++) {
@@ -1258,7 +1258,7 @@ MATX_LOOP_UNROLL
       "Quad initializer list on SetVals only for non-complex rank 4 tensor or complex rank 3 tensors");
     MATX_ASSERT_STR(IsHostAccessiblePointer(), matxNotSupported, "SetVals only supports host-accessible pointers (managed, host-pinned, or ATS-mapped)");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     for (size_t i = 0; i < vals.size(); i++) {
       for (size_t j = 0; j < (vals.begin() + i)->size(); j++) {
@@ -1311,7 +1311,7 @@ MATX_LOOP_UNROLL
           "Quintuple initializer list on SetVals only for complex rank 3 tensors");
     MATX_ASSERT_STR(IsHostAccessiblePointer(), matxNotSupported, "SetVals only supports host-accessible pointers (managed, host-pinned, or ATS-mapped)");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     for (size_t i = 0; i < vals.size(); i++) {
       for (size_t j = 0; j < (vals.begin() + i)->size(); j++) {
@@ -1421,7 +1421,7 @@ MATX_LOOP_UNROLL
   {
     static_assert(N <= RANK && RANK > 0, "Must slice to a rank the same or less than current rank.");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     return Slice<N, detail::NoStride>(firsts, ends, detail::NoStride{});
   }
@@ -1498,6 +1498,8 @@ MATX_LOOP_UNROLL
           t->device.device_id = dev_ord;
           break;
         case MATX_HOST_MALLOC_MEMORY:
+        case MATX_HOST_NUMA_MEMORY:
+        case MATX_SYSTEM_MEMORY:
           t->device.device_type = kDLCPU;
           break;
         default:
@@ -43,6 +43,8 @@
 #include "matx/core/tensor_utils.h"
 #include "matx/operators/set.h"
 #include "matx/core/sparse_tensor_format.h"
+#include "matx/core/stream_deps.h"
+#include "matx/core/write_versions.h"
 #include "matx/core/utils.h"
 //#include "matx_exec_kernel.h"
 #include "iterator.h"
@@ -871,7 +873,7 @@ MATX_IGNORE_WARNING_POP_GCC
     {
       static_assert(N <= RANK && RANK > 0, "Must slice to a rank the same or less than current rank.");
 
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
       cuda::std::array<typename Desc::shape_type, N> n = {};
       cuda::std::array<typename Desc::stride_type, N> s = {};
@@ -958,7 +960,7 @@ MATX_IGNORE_WARNING_POP_GCC
     {
       static_assert(N <= RANK && RANK > 0, "Must slice to a rank the same or less than current rank.");
 
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
       return Slice<N, detail::NoStride>(firsts, ends, detail::NoStride{});
     }
@@ -967,7 +969,7 @@ MATX_IGNORE_WARNING_POP_GCC
     template <int N>
     __MATX_INLINE__ auto CloneImpl(const cuda::std::array<index_t, N> &clones) const
     {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
       cuda::std::array<index_t, N> n;
       cuda::std::array<typename Desc::stride_type, N> s;
@@ -1003,7 +1005,7 @@ MATX_IGNORE_WARNING_POP_GCC
     template <int N>
     __MATX_INLINE__ auto Clone(const cuda::std::array<index_t, N> &clones) const
     {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
       auto new_desc = CloneImpl<N>(clones);
 
@@ -1012,7 +1014,7 @@ MATX_IGNORE_WARNING_POP_GCC
 
     __MATX_INLINE__ auto PermuteImpl(const cuda::std::array<int32_t, RANK> &dims) const
     {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
       static_assert(RANK >= 1, "Only tensors of rank 1 and higher can be permuted.");
       cuda::std::array<shape_type, RANK> n;
@@ -1047,7 +1049,7 @@ MATX_IGNORE_WARNING_POP_GCC
     {
       static_assert(RANK == 1, "Overlapped views only supported on 1D tensors.");
 
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
       cuda::std::array<typename Desc::shape_type, RANK+1> n;
       cuda::std::array<typename Desc::stride_type, RANK+1> s;
@@ -1057,21 +1059,23 @@ MATX_IGNORE_WARNING_POP_GCC
       typename Desc::stride_type window_size = *(windows.begin());
       typename Desc::stride_type stride_size = *(strides.begin());
 
-      MATX_ASSERT(stride_size < window_size, matxInvalidSize);
+      MATX_ASSERT(stride_size <= window_size, matxInvalidSize);
       MATX_ASSERT(stride_size > 0, matxInvalidSize);
+      MATX_ASSERT(window_size <= this->desc_.Size(0), matxInvalidSize);
 
       // Figure out the actual length of the signal we can use. It might be
       // shorter than the original tensor if the window/stride doesn't line up
       // properly to make a rectangular matrix.
       typename Desc::shape_type adj_el = this->desc_.Size(0) - window_size;
-      while ((adj_el % stride_size) != 0) {
-        adj_el--;
-      }
+      adj_el -= adj_el % stride_size;
 
+      // Windows step through the input in units of its own element stride, so
+      // strided 1D views (e.g. a column of a matrix) also overlap without a copy
+      // and the result can go straight to cuFFT as istride/idist.
       n[1] = window_size;
-      s[1] = 1;
+      s[1] = this->desc_.Stride(0);
       n[0] = adj_el / stride_size + 1;
-      s[0] = stride_size;
+      s[0] = stride_size * this->desc_.Stride(0);
 
       tensor_desc_t<decltype(n), decltype(s), RANK+1> new_desc{std::move(n), std::move(s)};
       return new_desc;
@@ -1222,39 +1226,41 @@ MATX_IGNORE_WARNING_POP_GCC
     }
 
     // Optimized offset calculation for ranks 1-4 with explicit stride multiplications
-    template <detail::ElementsPerThread EPT, typename... Is>
+    // OffsetT is int32_t when the executor has verified every offset of the view fits in 32 bits
+    template <detail::ElementsPerThread EPT, typename OffsetT = index_t, typename... Is>
     __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ stride_type GetOffsetOptimized(Is... indices) const {
 MATX_IGNORE_WARNING_PUSH_GCC("-Wmaybe-uninitialized")      
       constexpr size_t rank = sizeof...(Is);
-      constexpr int EPT_int = static_cast<int>(EPT);
-      const cuda::std::array<index_t, rank> idx{indices...};
+      constexpr OffsetT EPT_int = static_cast<OffsetT>(EPT);
+      const cuda::std::array<OffsetT, rank> idx{static_cast<OffsetT>(indices)...};
+      const auto st = [this](int i) { return static_cast<OffsetT>(this->desc_.Stride(i)); };
       
       if constexpr (rank == 1) {
         if constexpr (EPT != detail::ElementsPerThread::ONE) {
-          return idx[0] * (this->desc_.Stride(0) * EPT_int);
+          return idx[0] * (st(0) * EPT_int);
         } else {
-          return idx[0] * this->desc_.Stride(0);
+          return idx[0] * st(0);
         }
       }
       else if constexpr (rank == 2) {
         if constexpr (EPT != detail::ElementsPerThread::ONE) {
-          return idx[0] * this->desc_.Stride(0) + idx[1] * (this->desc_.Stride(1) * EPT_int);
+          return idx[0] * st(0) + idx[1] * (st(1) * EPT_int);
         } else {
-          return idx[0] * this->desc_.Stride(0) + idx[1] * this->desc_.Stride(1);
+          return idx[0] * st(0) + idx[1] * st(1);
         }
       }
       else if constexpr (rank == 3) {
         if constexpr (EPT != detail::ElementsPerThread::ONE) {
-          return idx[0] * this->desc_.Stride(0) + idx[1] * this->desc_.Stride(1) + idx[2] * (this->desc_.Stride(2) * EPT_int);
+          return idx[0] * st(0) + idx[1] * st(1) + idx[2] * (st(2) * EPT_int);
         } else {
-          return idx[0] * this->desc_.Stride(0) + idx[1] * this->desc_.Stride(1) + idx[2] * this->desc_.Stride(2);
+          return idx[0] * st(0) + idx[1] * st(1) + idx[2] * st(2);
         }
       }
       else if constexpr (rank == 4) {
         if constexpr (EPT != detail::ElementsPerThread::ONE) {
-          return idx[0] * this->desc_.Stride(0) + idx[1] * this->desc_.Stride(1) + idx[2] * this->desc_.Stride(2) + idx[3] * (this->desc_.Stride(3) * EPT_int);
+          return idx[0] * st(0) + idx[1] * st(1) + idx[2] * st(2) + idx[3] * (st(3) * EPT_int);
         } else {
-          return idx[0] * this->desc_.Stride(0) + idx[1] * this->desc_.Stride(1) + idx[2] * this->desc_.Stride(2) + idx[3] * this->desc_.Stride(3);
+          return idx[0] * st(0) + idx[1] * st(1) + idx[2] * st(2) + idx[3] * st(3);
         }
       }
       else {
@@ -1299,7 +1305,7 @@ MATX_IGNORE_WARNING_POP_GCC
         assert(data_.ldata_ != nullptr);
 #endif
         constexpr int EPT_int = static_cast<int>(CapType::ept);
-        const index_t offset = GetOffsetOptimized<CapType::ept>(indices...);
+        const index_t offset = GetOffsetOptimized<CapType::ept, detail::cap_index_t<CapType>>(indices...);
 
         if constexpr (CapType::ept == detail::ElementsPerThread::ONE) {
           return data_.ldata_[offset];
@@ -1329,7 +1335,7 @@ MATX_IGNORE_WARNING_POP_GCC
     {
       static_assert(sizeof...(Is) == M, "Number of indices of data_ptr must match rank of tensor");
       if constexpr (!is_sparse_data_v<TensorData>) {
-        const index_t offset = GetOffsetOptimized<CapType::ept>(indices...);
+        const index_t offset = GetOffsetOptimized<CapType::ept, detail::cap_index_t<CapType>>(indices...);
         return data_.ldata_ + offset;
       }
       else {
@@ -1363,7 +1369,7 @@ MATX_IGNORE_WARNING_POP_GCC
         assert(data_.ldata_ != nullptr);
 #endif
         constexpr int EPT_int = static_cast<int>(CapType::ept);
-        const index_t offset = GetOffsetOptimized<CapType::ept>(indices...);
+        const index_t offset = GetOffsetOptimized<CapType::ept, detail::cap_index_t<CapType>>(indices...);
 
         if constexpr (CapType::ept == detail::ElementsPerThread::ONE) {
           return data_.ldata_[offset];
@@ -1446,12 +1452,24 @@ MATX_IGNORE_WARNING_POP_GCC
           }
         }
 
-        // Maybe relax this constraint later, but for now the tensor has to be contiguous. This should prevent clones
-        // and strides from vectorizing.
-        if (!IsContiguous()) {
+        // JIT kernels may address the tensor as one flat buffer, so they need it to be contiguous. This should
+        // prevent clones and strides from vectorizing. The statically-compiled kernels only index through the
+        // strides, so a tensor with sliced or padded outer dimensions can still use vector loads as long as
+        // every row starts on a vector boundary. That is checked together with the alignment below.
+        const bool contiguous = IsContiguous();
+        if (in.jit && !contiguous) {
           return cuda::std::array<detail::ElementsPerThread, 2>{detail::ElementsPerThread::ONE, detail::ElementsPerThread::ONE};
         }
 
+        const auto rows_aligned = [&](int w) {
+          for (int d = 0; d < Rank() - 1; d++) {
+            if ((Stride(d) % w) != 0) {
+              return false;
+            }
+          }
+          return true;
+        };
+
         if constexpr (sizeof(T) != alignment_by_type<T>()) {
           // If the alignment of the type does not match sizeof(T), then the logic
           // below will not necessarily work. It would generally work if alignment_by_type<T>() < sizeof(T),
@@ -1463,6 +1481,7 @@ MATX_IGNORE_WARNING_POP_GCC
           int width = in.jit ? 32 : MAX_VEC_WIDTH_BYTES / sizeof(T); 
           while (width > 1) {
             if (((Lsize() % width) == 0) &&                                       // Last dim is a multiple of vector load size
+              (contiguous || rows_aligned(width)) &&                              // Every row starts on a vector boundary
               ((reinterpret_cast<uintptr_t>(data_.ldata_) % (sizeof(T) * width)) == 0)) {
               break;
             }
@@ -1557,6 +1576,168 @@ MATX_IGNORE_WARNING_POP_GCC
           return overlaps;
         }
       }
+      else if constexpr (Cap == OperatorCapability::BYTES_ACCESSED) {
+        if constexpr (is_sparse_data_v<TensorData>) {
+          return uint64_t{0};
+        }
+        else {
+          return static_cast<uint64_t>(TotalSize()) * sizeof(T);
+        }
+      }
+      else if constexpr (Cap == OperatorCapability::INDEX_32BIT) {
+        if constexpr (is_sparse_data_v<TensorData>) {
+          return false;
+        }
+        else {
+          // Largest offset reachable from the view, including negative strides
+          constexpr index_t max32 = cuda::std::numeric_limits<int32_t>::max();
+          index_t max_offset = 0;
+          for (int i = 0; i < Rank(); i++) {
+            const index_t stride = Stride(i) < 0 ? -Stride(i) : Stride(i);
+            if (Size(i) > max32 || (Size(i) > 1 && stride > max32 / (Size(i) - 1))) {
+              return false;
+            }
+            max_offset += (Size(i) - 1) * stride;
+            if (max_offset > max32) {
+              return false;
+            }
+          }
+          return true;
+        }
+      }
+      else if constexpr (Cap == OperatorCapability::PREFETCH_MEMORY) {
+        if constexpr (Rank() == 0 || is_sparse_data_v<TensorData>) {
+          return false;
+        }
+        else {
+          if (TotalSize() == 0) {
+            return false;
+          }
+
+          // Only the span covered by this view is moved, not the whole allocation
+          auto get_first = [this]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+            return &(const_cast<tensor_impl_t*>(this)->operator()(static_cast<index_t>(Is*0)...));
+          };
+          auto get_last = [this]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+            return &(const_cast<tensor_impl_t*>(this)->operator()(static_cast<index_t>(Size(Is)-1)...));
+          };
+          auto *first = const_cast<T*>(get_first(cuda::std::make_index_sequence<Rank()>{}));
+          auto *last = const_cast<T*>(get_last(cuda::std::make_index_sequence<Rank()>{}));
+          if (last < first) {
+            cuda::std::swap(first, last);
+          }
+
+          const auto kind = GetPointerKind(first);
+          if (kind != MATX_MANAGED_MEMORY && kind != MATX_SYSTEM_MEMORY) {
+            return false;
+          }
+
+          const size_t bytes = static_cast<size_t>(last - first + 1) * sizeof(T);
+          const auto stream = static_cast<cudaStream_t>(in.stream);
+  #if CUDART_VERSION <= 12000
+          cudaMemPrefetchAsync(first, bytes, in.device, stream);
+  #else
+          cudaMemLocation loc;
+          loc.id = in.device;
+          loc.type = cudaMemLocationTypeDevice;
+          cudaMemPrefetchAsync(first, bytes, loc, 0, stream);
+  #endif
+          return true;
+        }
+      }
+      else if constexpr (Cap == OperatorCapability::STREAM_DEPENDENCIES) {
+        if constexpr (Rank() == 0 || is_sparse_data_v<TensorData>) {
+          return false;
+        }
+        else {
+          if (TotalSize() == 0) {
+            return false;
+          }
+
+          auto get_first = [this]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+            return &(const_cast<tensor_impl_t*>(this)->operator()(static_cast<index_t>(Is*0)...));
+          };
+          auto get_last = [this]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+            return &(const_cast<tensor_impl_t*>(this)->operator()(static_cast<index_t>(Size(Is)-1)...));
+          };
+          auto *first = const_cast<T*>(get_first(cuda::std::make_index_sequence<Rank()>{}));
+          auto *last = const_cast<T*>(get_last(cuda::std::make_index_sequence<Rank()>{}));
+          if (last < first) {
+            cuda::std::swap(first, last);
+          }
+
+          const auto stream = static_cast<cudaStream_t>(in.stream);
+          if (in.record) {
+            StreamDependencyTracker::Get().Record(first, last + 1, stream);
+          }
+          else {
+            StreamDependencyTracker::Get().Wait(first, last + 1, stream);
+          }
+          return true;
+        }
+      }
+      else if constexpr (Cap == OperatorCapability::WRITE_VERSIONS) {
+        if constexpr (Rank() == 0 || is_sparse_data_v<TensorData>) {
+          return false;
+        }
+        else {
+          if (TotalSize() == 0) {
+            return false;
+          }
+
+          auto get_first = [this]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+            return &(const_cast<tensor_impl_t*>(this)->operator()(static_cast<index_t>(Is*0)...));
+          };
+          auto get_last = [this]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+            return &(const_cast<tensor_impl_t*>(this)->operator()(static_cast<index_t>(Size(Is)-1)...));
+          };
+          auto *first = const_cast<T*>(get_first(cuda::std::make_index_sequence<Rank()>{}));
+          auto *last = const_cast<T*>(get_last(cuda::std::make_index_sequence<Rank()>{}));
+          if (last < first) {
+            cuda::std::swap(first, last);
+          }
+
+          if (in.bump) {
+            WriteVersionTracker::Get().Bump(first, last + 1);
+          }
+          else {
+            // The layout tells apart views of the same memory, such as a matrix and its transpose
+            auto &sig = *static_cast<std::vector<uint64_t>*>(in.sig);
+            sig.push_back(reinterpret_cast<uintptr_t>(Data()));
+            for (int d = 0; d < Rank(); d++) {
+              sig.push_back(static_cast<uint64_t>(Size(d)));
+              sig.push_back(static_cast<uint64_t>(Stride(d)));
+            }
+            sig.push_back(WriteVersionTracker::Get().Version(first, last + 1));
+          }
+          return true;
+        }
+      }
+      else if constexpr (Cap == OperatorCapability::RESIDENT_MEMORY) {
+        if constexpr (Rank() == 0 || is_sparse_data_v<TensorData>) {
+          return false;
+        }
+        else {
+          if (TotalSize() == 0) {
+            return false;
+          }
+
+          auto get_first = [this]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+            return &(const_cast<tensor_impl_t*>(this)->operator()(static_cast<index_t>(Is*0)...));
+          };
+          auto get_last = [this]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+            return &(const_cast<tensor_impl_t*>(this)->operator()(static_cast<index_t>(Size(Is)-1)...));
+          };
+          auto *first = const_cast<T*>(get_first(cuda::std::make_index_sequence<Rank()>{}));
+          auto *last = const_cast<T*>(get_last(cuda::std::make_index_sequence<Rank()>{}));
+          if (last < first) {
+            cuda::std::swap(first, last);
+          }
+
+          GetAllocMap().oversubscribed.MakeResident(first, last + 1, static_cast<cudaStream_t>(in.stream));
+          return true;
+        }
+      }
       else {
         return detail::capability_attributes<Cap>::default_value;
       }
@@ -75,7 +75,7 @@ namespace matx
    */
   template <typename Op>
   index_t TotalSize(const Op &op) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     if constexpr (is_tensor_view_v<Op>) {
       return static_cast<size_t>(op.TotalSize());
@@ -99,7 +99,7 @@ namespace matx
    */
   template <typename Op>
   index_t LargestDimSize(const Op &op) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     index_t maxSize = op.Size(0);
 
     for (int i = 1; i < op.Rank(); i++)
@@ -262,7 +262,7 @@ namespace matx
   __MATX_INLINE__ auto
   TransposeCopy(typename TensorType::value_type *tp, const TensorType &a, const Executor &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     auto pa = transpose_matrix(a);
     auto tv = make_tensor(tp, pa.Shape());
@@ -222,6 +222,8 @@ typedef enum {
   MATX_TYPE_UINT16,
   MATX_TYPE_UINT32,
   MATX_TYPE_UINT64,
+  MATX_TYPE_FP8_E4M3,
+  MATX_TYPE_FP8_E5M2,
 
   MATX_TYPE_INVALID // Sentinel
 } MatXDataType_t;
@@ -260,6 +262,10 @@ template <typename T> constexpr MatXDataType_t TypeToInt()
     return MATX_TYPE_UINT32;
   if constexpr (std::is_same_v<T, uint64_t>)
     return MATX_TYPE_UINT64;
+  if constexpr (std::is_same_v<T, matxFp8E4M3>)
+    return MATX_TYPE_FP8_E4M3;
+  if constexpr (std::is_same_v<T, matxFp8E5M2>)
+    return MATX_TYPE_FP8_E5M2;
 
   return MATX_TYPE_INVALID;
 }
@@ -314,6 +320,12 @@ template <> struct IntToType<MATX_TYPE_UINT32> {
 template <> struct IntToType<MATX_TYPE_UINT64> {
   using value_type = uint64_t;
 };
+template <> struct IntToType<MATX_TYPE_FP8_E4M3> {
+  using value_type = matxFp8E4M3;
+};
+template <> struct IntToType<MATX_TYPE_FP8_E5M2> {
+  using value_type = matxFp8E5M2;
+};
 
 
 template <typename T> constexpr cudaDataType_t MatXTypeToCudaType()
@@ -348,6 +360,12 @@ template <typename T> constexpr cudaDataType_t MatXTypeToCudaType()
   if constexpr (std::is_same_v<T, matxBf16Complex>) {
     return CUDA_C_16BF;
   }
+  if constexpr (std::is_same_v<T, matxFp8E4M3>) {
+    return CUDA_R_8F_E4M3;
+  }
+  if constexpr (std::is_same_v<T, matxFp8E5M2>) {
+    return CUDA_R_8F_E5M2;
+  }
 
   return CUDA_C_32F;
 }
@@ -165,6 +165,18 @@ constexpr __MATX_HOST__ __MATX_DEVICE__ bool is_matx_transform_op()
   return requires { typename remove_cvref_t<T>::matx_transform_op; };
 }
 
+/**
+ * @brief Determine if an operator is a set of segments that can each be assigned directly into a slice of
+ * the output, such as concat() and stack()
+ *
+ * @tparam T Type to test
+ */
+template <typename T>
+constexpr __MATX_HOST__ __MATX_DEVICE__ bool is_matx_segmented_op()
+{
+  return requires { typename remove_cvref_t<T>::matx_segmented_op; };
+}
+
 /**
  * @brief Determine if a type has can_alias trait
  * 
@@ -217,6 +229,17 @@ constexpr __MATX_HOST__ __MATX_DEVICE__ bool is_matx_set_op()
   return requires { typename remove_cvref_t<T>::matx_setop; };
 }
 
+/**
+ * @brief Determine if a type is an operator whose first dimension is bounded by a count on the device
+ *
+ * @tparam T Type to test
+ */
+template <typename T>
+constexpr __MATX_HOST__ __MATX_DEVICE__ bool is_dynamic_extent_op()
+{
+  return requires { typename remove_cvref_t<T>::matx_dynamic_extent; };
+}
+
 
 
 /**
@@ -684,6 +707,43 @@ concept is_matx_static_descriptor = requires {
 template <typename T>
 inline constexpr bool is_matx_static_descriptor_v = requires { typename remove_cvref_t<T>::matx_static_descriptor; };
 
+namespace detail {
+template <typename T>
+struct static_shape_desc {
+  using type = void;
+};
+
+template <typename T>
+  requires requires { typename T::desc_type; }
+struct static_shape_desc<T> {
+  using type = cuda::std::conditional_t<is_matx_static_descriptor_v<typename T::desc_type>, typename T::desc_type, void>;
+};
+
+template <typename T>
+  requires requires { typename T::tensor_type; }
+struct static_shape_desc<T> {
+  using type = typename static_shape_desc<remove_cvref_t<typename T::tensor_type>>::type;
+};
+}
+
+/**
+ * @brief Static descriptor holding the compile-time shape of an operator, or void if the shape is only known
+ * at runtime. Tensors created with make_static_tensor have a static shape, as do assignments into them since
+ * the output sets the iteration space.
+ *
+ * @tparam T Operator type
+ */
+template <typename T>
+using static_shape_desc_t = typename detail::static_shape_desc<remove_cvref_t<T>>::type;
+
+/**
+ * @brief Determine if an operator's shape is known at compile time
+ *
+ * @tparam T Operator type
+ */
+template <typename T>
+inline constexpr bool is_static_shape_v = !cuda::std::is_void_v<static_shape_desc_t<T>>;
+
 
 namespace detail {
   
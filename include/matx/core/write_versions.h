@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "matx/core/defines.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Tracks a version for each range of memory, and the versions each memoized transform last ran with
+ *
+ * Versions come from a single counter, so a range written or allocated later always has a higher version than
+ * anything seen before at that address. Writes are those made by run() to the outputs of an assignment or mtie(),
+ * allocations through matxAlloc, and explicit calls to MarkModified(). Nothing is tracked while disabled.
+ */
+class WriteVersionTracker {
+  public:
+    static WriteVersionTracker &Get() {
+      static WriteVersionTracker tracker;
+      return tracker;
+    }
+
+    bool Enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    void SetEnabled(bool enable) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      enabled_.store(enable, std::memory_order_relaxed);
+
+      // Writes made while disabled were not seen, so nothing recorded before can be trusted afterwards
+      ranges_.clear();
+      transforms_.clear();
+    }
+
+    /**
+     * Give [first, last) a new version
+     */
+    void Bump(const void *first, const void *last) {
+      const auto lo = reinterpret_cast<uintptr_t>(first);
+      const auto hi = reinterpret_cast<uintptr_t>(last);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      // Older ranges keep only the parts outside the new one
+      auto it = FirstOverlap(lo);
+      while (it != ranges_.end() && it->first < hi) {
+        if (it->second.end <= lo) {
+          ++it;
+          continue;
+        }
+
+        const auto start = it->first;
+        const Range old = it->second;
+        it = ranges_.erase(it);
+        if (start < lo) {
+          ranges_.emplace(start, Range{lo, old.version});
+        }
+        if (old.end > hi) {
+          ranges_.emplace(hi, Range{old.end, old.version});
+        }
+      }
+
+      ranges_.emplace(lo, Range{hi, ++clock_});
+    }
+
+    /**
+     * Latest version of any part of [first, last), or zero if none of it was tracked
+     */
+    uint64_t Version(const void *first, const void *last) {
+      const auto lo = reinterpret_cast<uintptr_t>(first);
+      const auto hi = reinterpret_cast<uintptr_t>(last);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      uint64_t version = 0;
+      for (auto it = FirstOverlap(lo); it != ranges_.end() && it->first < hi; ++it) {
+        if (it->second.end > lo && it->second.version > version) {
+          version = it->second.version;
+        }
+      }
+      return version;
+    }
+
+    /**
+     * Whether the transform of type op last wrote an output with signature out from inputs with signature in
+     */
+    bool Unchanged(std::type_index op, const std::vector<uint64_t> &out, const std::vector<uint64_t> &in) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto it = transforms_.find({op, out.empty() ? 0 : out[0]});
+      return it != transforms_.end() && it->second.first == out && it->second.second == in;
+    }
+
+    /**
+     * Remember the signatures of a transform's output and inputs after it ran
+     */
+    void Store(std::type_index op, std::vector<uint64_t> out, std::vector<uint64_t> in) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const uint64_t key = out.empty() ? 0 : out[0];
+      transforms_[{op, key}] = {std::move(out), std::move(in)};
+    }
+
+  private:
+    struct Range {
+      uintptr_t end;
+      uint64_t version;
+    };
+
+    WriteVersionTracker() = default;
+
+    std::map<uintptr_t, Range>::iterator FirstOverlap(uintptr_t lo) {
+      auto it = ranges_.upper_bound(lo);
+      if (it != ranges_.begin() && std::prev(it)->second.end > lo) {
+        --it;
+      }
+      return it;
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::mutex mutex_;
+    uint64_t clock_ = 0;
+    std::map<uintptr_t, Range> ranges_;
+    // Keyed by transform type and the first address of its output
+    std::map<std::pair<std::type_index, uint64_t>, std::pair<std::vector<uint64_t>, std::vector<uint64_t>>> transforms_;
+};
+
+} // namespace detail
+
+/**
+ * @brief Enable or disable skipping transforms whose inputs are unchanged
+ *
+ * When enabled, run() of an assignment of a transform, such as inv() or fft(), into a tensor is skipped when the
+ * same transform last wrote that tensor from tensors that have not been written since, and the output itself has
+ * not been written since either. Writes are tracked for the outputs of run(), for memory allocated through
+ * matxAlloc, and for tensors passed to MarkModified(). Writes made any other way, such as element writes from the
+ * host or kernels and library calls using Data(), must be followed by MarkModified().
+ *
+ * Only tensors in the expression are compared. A transform over an expression containing random() always runs,
+ * but other non-tensor arguments, such as scalars or an FFT length, are assumed not to change between runs that
+ * write the same output. Enabling or disabling forgets every tracked write.
+ *
+ * @param enable True to enable memoization
+ */
+__MATX_INLINE__ void SetTransformMemoization(bool enable)
+{
+  detail::WriteVersionTracker::Get().SetEnabled(enable);
+}
+
+/**
+ * @brief Check whether transforms with unchanged inputs are skipped
+ *
+ * @return True if memoization is enabled
+ */
+__MATX_INLINE__ bool GetTransformMemoization()
+{
+  return detail::WriteVersionTracker::Get().Enabled();
+}
+
+} // namespace matx
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <memory>
+
+#include "matx/core/error.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/type_utils.h"
+
+namespace matx
+{
+
+/**
+ * @brief Scalar result of an asynchronous reduction that stays on the device until the host asks for it
+ *
+ * An async_scalar_t owns a rank-0 tensor used as the output of a reduction (sum, max, min, etc) and an
+ * event marking when the value is complete. Downstream operators consume Tensor() directly on the device,
+ * so no host round trip is needed between stages. The host can poll Ready() or block on Get(), which waits
+ * on the event only rather than synchronizing the whole stream.
+ *
+ * With MATX_HOST_MEMORY (the default) the value lives in mapped pinned memory that the reduction writes
+ * directly and the host reads without a copy. With MATX_DEVICE_MEMORY or MATX_ASYNC_DEVICE_MEMORY the
+ * value lives in device memory and Record() also enqueues a copy into a pinned shadow for the host.
+ *
+ * Copies of an async_scalar_t share the same value and event.
+ */
+template <typename T>
+class async_scalar_t {
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Construct an async scalar
+     *
+     * @param space Memory space of the scalar seen by device operators
+     * @param stream Stream used for stream-ordered allocations
+     */
+    explicit async_scalar_t(matxMemorySpace_t space = MATX_HOST_MEMORY, cudaStream_t stream = 0) :
+      state_(std::make_shared<State>(space, stream)) {}
+
+    /**
+     * @brief Rank-0 tensor holding the scalar on the device
+     *
+     * Use this as the output of a reduction and as an input to downstream operators.
+     */
+    tensor_t<T, 0> &Tensor() { return state_->value; }
+    const tensor_t<T, 0> &Tensor() const { return state_->value; }
+
+    /**
+     * @brief Mark the scalar complete once all work currently enqueued on stream has finished
+     *
+     * @param stream Stream the producing reduction was issued on
+     */
+    void Record(cudaStream_t stream) {
+      if (state_->value.Data() != state_->host.Data()) {
+        MATX_CUDA_CHECK(cudaMemcpyAsync(state_->host.Data(), state_->value.Data(), sizeof(T), cudaMemcpyDeviceToHost, stream));
+      }
+      MATX_CUDA_CHECK(cudaEventRecord(state_->event, stream));
+      state_->recorded = true;
+    }
+
+    /**
+     * @brief Mark the scalar complete once all work currently enqueued on the executor has finished
+     *
+     * @param exec CUDA executor the producing reduction was run on
+     */
+    template <typename Executor>
+      requires is_cuda_executor_v<Executor>
+    void Record(const Executor &exec) {
+      Record(exec.getStream());
+    }
+
+    /**
+     * @brief Run a reduction into this scalar and record its completion
+     *
+     * Equivalent to `(Tensor() = op).run(exec); Record(exec);`
+     *
+     * @param op Operator producing a rank-0 result
+     * @param exec CUDA executor
+     */
+    template <typename Op, typename Executor>
+      requires is_cuda_executor_v<Executor>
+    void Run(const Op &op, Executor &&exec) {
+      (state_->value = op).run(exec);
+      Record(exec);
+    }
+
+    /**
+     * @brief Make stream wait for the scalar without blocking the host
+     *
+     * Only needed when the scalar is consumed on a different stream than the one it was produced on.
+     *
+     * @param stream Stream to order after the scalar
+     */
+    void Wait(cudaStream_t stream) const {
+      MATX_ASSERT_STR(state_->recorded, matxInvalidParameter, "async_scalar_t used before Record()");
+      MATX_CUDA_CHECK(cudaStreamWaitEvent(stream, state_->event, 0));
+    }
+
+    /**
+     * @brief Non-blocking check for whether the value is available on the host
+     *
+     * @returns True if the recorded work has completed
+     */
+    bool Ready() const {
+      MATX_ASSERT_STR(state_->recorded, matxInvalidParameter, "async_scalar_t used before Record()");
+      const auto res = cudaEventQuery(state_->event);
+      if (res == cudaErrorNotReady) {
+        return false;
+      }
+      MATX_CUDA_CHECK(res);
+      return true;
+    }
+
+    /**
+     * @brief Get the value on the host, blocking only until the recorded work completes
+     *
+     * @returns Scalar value
+     */
+    T Get() const {
+      MATX_ASSERT_STR(state_->recorded, matxInvalidParameter, "async_scalar_t used before Record()");
+      MATX_CUDA_CHECK(cudaEventSynchronize(state_->event));
+      return *state_->host.Data();
+    }
+
+  private:
+    struct State {
+      State(matxMemorySpace_t space, cudaStream_t stream) {
+        MATX_ASSERT_STR(space == MATX_HOST_MEMORY || space == MATX_DEVICE_MEMORY || space == MATX_ASYNC_DEVICE_MEMORY,
+            matxInvalidParameter, "async_scalar_t must be in pinned host or device memory");
+
+        make_tensor(value, space, stream);
+        if (space == MATX_HOST_MEMORY) {
+          host.Shallow(value);
+        }
+        else {
+          make_tensor(host, MATX_HOST_MEMORY);
+        }
+        MATX_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+      }
+
+      ~State() {
+        cudaEventDestroy(event);
+      }
+
+      State(const State &) = delete;
+      State &operator=(const State &) = delete;
+
+      tensor_t<T, 0> value;
+      tensor_t<T, 0> host;
+      cudaEvent_t event = nullptr;
+      bool recorded = false;
+    };
+
+    std::shared_ptr<State> state_;
+};
+
+/**
+ * @brief Create an async scalar for the result of an asynchronous reduction
+ *
+ * @param space Memory space of the scalar seen by device operators
+ * @param stream Stream used for stream-ordered allocations
+ * @returns New async scalar
+ */
+template <typename T>
+auto make_async_scalar(matxMemorySpace_t space = MATX_HOST_MEMORY, cudaStream_t stream = 0) {
+  return async_scalar_t<T>{space, stream};
+}
+
+} // namespace matx
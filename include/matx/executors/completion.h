@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <cuda_runtime.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "matx/core/error.h"
+
+namespace matx
+{
+
+/**
+ * @brief Completion of the work enqueued on a stream up to a point, usable as a future or a coroutine awaitable
+ *
+ * A cudaCompletion is returned by cudaExecutor::record(). It becomes ready once every piece of work issued to
+ * the executor before record() was called has finished. Completion is signalled by a host function enqueued with
+ * cudaLaunchHostFunc, so no host thread polls or blocks per stream.
+ *
+ * Continuations added with then() and coroutines suspended on ``co_await`` are run on the CUDA runtime's callback
+ * thread when the completion fires, or immediately on the calling thread if it already has. Code running on the
+ * callback thread must not make CUDA API calls and should not block. When a coroutine needs to issue more GPU work
+ * after resuming, await via() instead so it is resumed by your own scheduler.
+ *
+ * Copies of a cudaCompletion refer to the same completion.
+ */
+class cudaCompletion {
+  public:
+    /**
+     * @brief Enqueue a completion marker on a stream
+     *
+     * @param stream Stream whose currently enqueued work is waited for
+     */
+    explicit cudaCompletion(cudaStream_t stream) : state_(std::make_shared<State>()) {
+      cudaStreamCaptureStatus status = cudaStreamCaptureStatusNone;
+      MATX_CUDA_CHECK(cudaStreamIsCapturing(stream, &status));
+      MATX_ASSERT_STR(status == cudaStreamCaptureStatusNone, matxInvalidParameter,
+          "Completions cannot be recorded while a stream is being captured");
+
+      auto *arg = new std::shared_ptr<State>(state_);
+      const auto res = cudaLaunchHostFunc(stream, &cudaCompletion::Fire, arg);
+      if (res != cudaSuccess) {
+        delete arg;
+        MATX_CUDA_CHECK(res);
+      }
+    }
+
+    /**
+     * @brief Non-blocking check for whether the recorded work has finished
+     */
+    bool ready() const {
+      std::scoped_lock lock(state_->mutex);
+      return state_->done;
+    }
+
+    /**
+     * @brief Block the calling thread until the recorded work has finished
+     *
+     * Unlike cudaExecutor::sync(), work enqueued on the stream after record() is not waited for.
+     */
+    void wait() const {
+      std::unique_lock lock(state_->mutex);
+      state_->cv.wait(lock, [this] { return state_->done; });
+    }
+
+    /**
+     * @brief Run a host callback once the recorded work has finished
+     *
+     * The callback runs on the CUDA callback thread, or immediately if the completion is already ready. It must
+     * not throw and must not call CUDA APIs.
+     *
+     * @param f Callable taking no arguments
+     */
+    template <typename Func>
+    void then(Func &&f) const {
+      std::unique_lock lock(state_->mutex);
+      if (state_->done) {
+        lock.unlock();
+        f();
+        return;
+      }
+      state_->continuations.emplace_back(std::forward<Func>(f));
+    }
+
+    /**
+     * @brief Awaitable that resumes the coroutine through a scheduler instead of the CUDA callback thread
+     *
+     * ``post`` is called on the CUDA callback thread with a function that resumes the coroutine. It should
+     * queue that function on an event loop or thread pool and return without running it.
+     *
+     * @param post Callable taking a ``std::function<void()>``
+     */
+    template <typename Post>
+    auto via(Post post) const {
+      struct Awaiter {
+        cudaCompletion completion;
+        Post post;
+
+        bool await_ready() const { return completion.ready(); }
+        void await_suspend(std::coroutine_handle<> h) {
+          completion.then([h, p = post]() mutable { p(std::function<void()>{[h] { h.resume(); }}); });
+        }
+        void await_resume() const noexcept {}
+      };
+
+      return Awaiter{*this, std::move(post)};
+    }
+
+    /// Coroutine interface: ``co_await completion`` suspends until the recorded work has finished
+    bool await_ready() const { return ready(); }
+    void await_suspend(std::coroutine_handle<> h) const { then([h] { h.resume(); }); }
+    void await_resume() const noexcept {}
+
+  private:
+    struct State {
+      std::mutex mutex;
+      std::condition_variable cv;
+      bool done = false;
+      std::vector<std::function<void()>> continuations;
+    };
+
+    static void CUDART_CB Fire(void *arg) {
+      std::unique_ptr<std::shared_ptr<State>> owner{static_cast<std::shared_ptr<State> *>(arg)};
+      auto &state = **owner;
+
+      std::vector<std::function<void()>> continuations;
+      {
+        std::scoped_lock lock(state.mutex);
+        state.done = true;
+        continuations.swap(state.continuations);
+      }
+      state.cv.notify_all();
+
+      for (auto &f : continuations) {
+        f();
+      }
+    }
+
+    std::shared_ptr<State> state_;
+};
+
+} // namespace matx
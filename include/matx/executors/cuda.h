@@ -68,6 +68,15 @@ namespace matx
       cudaExecutor(int stream, bool profiling = false) 
         : detail::CudaExecutorBase(stream, profiling) {}
 
+      /**
+       * @brief Construct a new cudaExecutor that creates and owns a stream with the given priority and SM partition
+       *
+       * @param params Stream priority and SM partition
+       * @param profiling Whether to enable profiling
+       */
+      cudaExecutor(const cudaExecutorParams &params, bool profiling = false)
+        : detail::CudaExecutorBase(params, profiling) {}
+
       /**
        * @brief Construct a new cudaExecutor object using the default stream
        * 
@@ -97,7 +106,32 @@ namespace matx
           cuda::std::array<index_t, Op::Rank()> sizes;
           for (int i = 0; i < Op::Rank(); i++) {
             sizes[i] = op.Size(i);
-          }   
+          }
+
+          // When the first dimension of the assigned expression is bounded by a count on the device, size the
+          // grid for the worst case and stride over it, stopping at the count
+          if constexpr (is_matx_set_op<Op>() && Op::Rank() > 0) {
+            using RhsType = remove_cvref_t<decltype(op.get_rhs())>;
+            if constexpr (is_dynamic_extent_op<RhsType>() && RhsType::Rank() == Op::Rank()) {
+              using CapType = detail::CapabilityParams<detail::ElementsPerThread::ONE, false>;
+              using CountType = typename RhsType::count_type;
+              const auto launch_params = detail::GetAOTLaunchParams(
+                  (const void*)detail::matxOpTDynamicKernel<CapType, Op, CountType>);
+              const index_t inner = cuda::std::accumulate(sizes.begin() + 1, sizes.end(), static_cast<index_t>(1), cuda::std::multiplies<index_t>());
+              const index_t total = sizes[0] * inner;
+              const index_t max_blocks = cuda::std::max(static_cast<index_t>(1),
+                  resident_threads(launch_params.max_resident_threads, launch_params.num_sms) * detail::AOT_PERSISTENT_WAVES / launch_params.block_size);
+
+              threads = launch_params.block_size;
+              blocks = static_cast<unsigned int>(cuda::std::min(cuda::std::max((total + launch_params.block_size - 1) / launch_params.block_size,
+                                                                               static_cast<index_t>(1)), max_blocks));
+              detail::OpProfiler::Get().SetLaunch(blocks, threads);
+              MATX_LOG_DEBUG("Launching dynamic extent CUDA kernel: rank={}, blocks={}, threads={}, stream={}",
+                             Op::Rank(), blocks.x, threads.x, reinterpret_cast<void*>(stream_));
+              detail::matxOpTDynamicKernel<CapType><<<blocks, threads, 0, stream_>>>(op, sizes, inner, op.get_rhs().CountData());
+              return;
+            }
+          }
 
           if constexpr (Op::Rank() <= 4) {
             // Create kernel provider for non-JIT using consolidated function
@@ -106,14 +140,51 @@ namespace matx
             // Find the best launch parameters
             auto [best_ept, shm_size, block_size, groups_per_block] = detail::find_best_launch_params(op, kernel_provider, 256, false);
 
+            // Use 32-bit index math when every tensor's offsets fit. The iteration space is held to half the
+            // 32-bit range so grid-stride increments cannot overflow
+            bool index_32bit = false;
+            if constexpr (sizeof(index_t) > sizeof(int32_t) && !is_static_shape_v<Op>) {
+              const index_t total = cuda::std::accumulate(sizes.begin(), sizes.end(), static_cast<index_t>(1), cuda::std::multiplies<index_t>());
+              index_32bit = total <= cuda::std::numeric_limits<int32_t>::max() / 2 &&
+                            detail::get_operator_capability<detail::OperatorCapability::INDEX_32BIT>(op);
+            }
+
             // Helper lambda to handle kernel dispatch. This is templated on the EPT
-            // type since that's what the kernels are templated on.
-            auto dispatch_kernel = [&]<detail::ElementsPerThread EPT>(auto&& kernel_handler) {
-              int max_tpb = 256;
+            // and index types since that's what the kernels are templated on.
+            auto dispatch_kernel = [&]<detail::ElementsPerThread EPT, typename IdxT>(auto&& kernel_handler) {
+              // Shapes known at compile time use a flattened kernel with constant index math
+              if constexpr (is_static_shape_v<Op> && Op::Rank() > 0) {
+                using CapType = detail::CapabilityParams<EPT, false>;
+                using Desc = static_shape_desc_t<Op>;
+                const auto launch_params = detail::GetAOTLaunchParams(
+                    (const void*)detail::matxOpTStaticKernel<CapType, Desc, Op>);
+                constexpr auto extents = detail::static_grid_extents<Desc, Op::Rank(), static_cast<index_t>(EPT)>();
+                constexpr index_t total = detail::static_grid_divisors<Desc, Op::Rank(), static_cast<index_t>(EPT)>()[0] * extents[0];
+                const index_t max_blocks = cuda::std::max(static_cast<index_t>(1),
+                    resident_threads(launch_params.max_resident_threads, launch_params.num_sms) * detail::AOT_PERSISTENT_WAVES / launch_params.block_size);
+
+                threads = launch_params.block_size;
+                blocks = static_cast<unsigned int>(cuda::std::min((total + launch_params.block_size - 1) / launch_params.block_size, max_blocks));
+                detail::OpProfiler::Get().SetLaunch(blocks, threads);
+
+                kernel_handler([&]() {
+                  detail::matxOpTStaticKernel<CapType, Desc><<<blocks, threads, 0, stream_>>>(op);
+                });
+                return;
+              }
 
-              bool stride = detail::get_grid_dims<Op::Rank()>(blocks, threads, sizes, static_cast<int>(EPT), max_tpb);
+              // Block size and persistent grid limits come from the occupancy of the kernel itself
+              // rather than a fixed block size, so they account for its register usage
+              const auto launch_params = detail::GetAOTLaunchParams(kernel_provider(EPT));
 
-              using CapType = detail::CapabilityParams<EPT, false>;
+              bool stride = detail::get_grid_dims<Op::Rank()>(blocks, threads, sizes, static_cast<int>(EPT), launch_params.block_size);
+              if constexpr (Op::Rank() > 0) {
+                stride = detail::get_persistent_grid_dims(blocks, threads, resident_threads(launch_params.max_resident_threads, launch_params.num_sms),
+                                                          detail::AOT_PERSISTENT_WAVES) || stride;
+              }
+
+              using CapType = detail::CapabilityParams<EPT, false, IdxT>;
+              detail::OpProfiler::Get().SetLaunch(blocks, threads);
               
               if constexpr (Op::Rank() == 0) {
                 kernel_handler([&]() {
@@ -121,40 +192,46 @@ namespace matx
                 });
               }
               else if constexpr (Op::Rank() == 1) {
-                kernel_handler([&]() {
-                  detail::matxOpT1Kernel<CapType><<<blocks, threads, 0, stream_>>>(op, sizes[0]);
-                });
+                if (stride) {
+                  kernel_handler([&]() {
+                    detail::matxOpT1StrideKernel<CapType><<<blocks, threads, 0, stream_>>>(op, static_cast<IdxT>(sizes[0]));
+                  });
+                } else {
+                  kernel_handler([&]() {
+                    detail::matxOpT1Kernel<CapType><<<blocks, threads, 0, stream_>>>(op, static_cast<IdxT>(sizes[0]));
+                  });
+                }
               }
               else if constexpr (Op::Rank() == 2) {
                 if (stride) {
                   kernel_handler([&]() {
-                    detail::matxOpT2StrideKernel<CapType><<<blocks, threads, 0, stream_>>>(op, sizes[0], sizes[1]);
+                    detail::matxOpT2StrideKernel<CapType><<<blocks, threads, 0, stream_>>>(op, static_cast<IdxT>(sizes[0]), static_cast<IdxT>(sizes[1]));
                   });
                 } else {
                   kernel_handler([&]() {
-                    detail::matxOpT2Kernel<CapType><<<blocks, threads, 0, stream_>>>(op, sizes[0], sizes[1]);
+                    detail::matxOpT2Kernel<CapType><<<blocks, threads, 0, stream_>>>(op, static_cast<IdxT>(sizes[0]), static_cast<IdxT>(sizes[1]));
                   });
                 }
               }
               else if constexpr (Op::Rank() == 3) {
                 if (stride) {
                   kernel_handler([&]() {
-                    detail::matxOpT3StrideKernel<CapType><<<blocks, threads, 0, stream_>>>(op, sizes[0], sizes[1], sizes[2]);
+                    detail::matxOpT3StrideKernel<CapType><<<blocks, threads, 0, stream_>>>(op, static_cast<IdxT>(sizes[0]), static_cast<IdxT>(sizes[1]), static_cast<IdxT>(sizes[2]));
                   });
                 } else {
                   kernel_handler([&]() {
-                    detail::matxOpT3Kernel<CapType><<<blocks, threads, 0, stream_>>>(op, sizes[0], sizes[1], sizes[2]);
+                    detail::matxOpT3Kernel<CapType><<<blocks, threads, 0, stream_>>>(op, static_cast<IdxT>(sizes[0]), static_cast<IdxT>(sizes[1]), static_cast<IdxT>(sizes[2]));
                   });
                 }
               }
               else if constexpr (Op::Rank() == 4) {
                 if (stride) {
                   kernel_handler([&]() {
-                    detail::matxOpT4StrideKernel<CapType><<<blocks, threads, 0, stream_>>>(op, sizes[0], sizes[1], sizes[2], sizes[3]);
+                    detail::matxOpT4StrideKernel<CapType><<<blocks, threads, 0, stream_>>>(op, static_cast<IdxT>(sizes[0]), static_cast<IdxT>(sizes[1]), static_cast<IdxT>(sizes[2]), static_cast<IdxT>(sizes[3]));
                   });
                 } else {
                   kernel_handler([&]() {
-                    detail::matxOpT4Kernel<CapType><<<blocks, threads, 0, stream_>>>(op, sizes[0], sizes[1], sizes[2], sizes[3]);
+                    detail::matxOpT4Kernel<CapType><<<blocks, threads, 0, stream_>>>(op, static_cast<IdxT>(sizes[0]), static_cast<IdxT>(sizes[1]), static_cast<IdxT>(sizes[2]), static_cast<IdxT>(sizes[3]));
                   });
                 }
               }
@@ -162,12 +239,21 @@ namespace matx
 
             // Helper lambda to launch kernel
             auto launch_kernel = [&]<detail::ElementsPerThread EPT>() {
-              dispatch_kernel.template operator()<EPT>([&](auto launch_func) {
-                MATX_LOG_DEBUG("Launching CUDA kernel: rank={}, blocks=({},{},{}), threads=({},{},{}), EPT={}, stream={}", 
+              auto handler = [&](auto launch_func) {
+                MATX_LOG_DEBUG("Launching CUDA kernel: rank={}, blocks=({},{},{}), threads=({},{},{}), EPT={}, 32-bit index={}, stream={}", 
                                Op::Rank(), blocks.x, blocks.y, blocks.z, threads.x, threads.y, threads.z, 
-                               static_cast<int>(EPT), reinterpret_cast<void*>(stream_));
+                               static_cast<int>(EPT), index_32bit, reinterpret_cast<void*>(stream_));
                 launch_func();
-              });
+              };
+
+              if constexpr (sizeof(index_t) > sizeof(int32_t) && !is_static_shape_v<Op>) {
+                if (index_32bit) {
+                  dispatch_kernel.template operator()<EPT, int32_t>(handler);
+                  return;
+                }
+              }
+
+              dispatch_kernel.template operator()<EPT, index_t>(handler);
             };
 
             // Launch the correct kernel based on the best EPT found
@@ -199,6 +285,7 @@ namespace matx
             const auto ept_bounds = detail::get_operator_capability<detail::OperatorCapability::ELEMENTS_PER_THREAD>(op, ept_type);              
             bool stride = detail::get_grid_dims<Op::Rank()>(blocks, threads, sizes, static_cast<int>(ept_bounds[1]), 1024);   
             index_t dims = cuda::std::accumulate(cuda::std::begin(sizes) + 1, cuda::std::end(sizes), 1, cuda::std::multiplies<index_t>());
+            detail::OpProfiler::Get().SetLaunch(blocks, threads);
             detail::matxOpTDKernel<<<blocks, threads, 0, stream_>>>(op, sizes, dims);
           }            
 #else
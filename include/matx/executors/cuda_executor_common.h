@@ -36,8 +36,17 @@
 #include "matx/core/defines.h"
 #include "matx/core/get_grid_dims.h"
 #include "matx/executors/kernel.h"
+#include "matx/executors/cuda_graph.h"
+#include "matx/executors/completion.h"
+#include "matx/executors/stream_resource.h"
 #include "matx/core/log.h"
+#include "matx/core/op_profiler.h"
 #include <cuda/std/array>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
 
 namespace matx
 {
@@ -74,6 +83,25 @@ namespace detail
         }
       }
 
+      /**
+       * @brief Construct a new CudaExecutorBase object owning a new stream
+       *
+       * The stream, and the green context when params.sm_count is set, are destroyed with the last copy of the
+       * executor.
+       *
+       * @param params Priority and SM partition of the stream
+       * @param profiling Whether to enable profiling
+       */
+      CudaExecutorBase(const cudaExecutorParams &params, bool profiling = false) :
+          owned_stream_(std::make_shared<ExecutorStreamResource>(params)), profiling_(profiling) {
+        stream_ = owned_stream_->stream;
+        sm_count_ = owned_stream_->sm_count;
+        if (profiling_) {
+          MATX_CUDA_CHECK(cudaEventCreate(&start_));
+          MATX_CUDA_CHECK(cudaEventCreate(&stop_));
+        }
+      }
+
       /**
        * @brief Construct a new CudaExecutorBase object using the default stream
        * 
@@ -103,6 +131,27 @@ namespace detail
        */
       void sync() { cudaStreamSynchronize(stream_); }
 
+      /**
+       * @brief Get a completion for all work issued to this executor so far
+       *
+       * The returned cudaCompletion can be polled with ready(), blocked on with wait(), or awaited from a
+       * coroutine with ``co_await``. Work issued after this call is not waited for.
+       *
+       * @returns Completion of the work currently enqueued on this executor's stream
+       */
+      cudaCompletion record() const { return cudaCompletion{stream_}; }
+
+      /**
+       * @brief Run a host callback once all work issued to this executor so far has finished
+       *
+       * The callback runs on the CUDA callback thread and must not throw or call CUDA APIs. Work issued to the
+       * stream afterwards does not start until the callback returns, so it should be short.
+       *
+       * @param f Callable taking no arguments
+       */
+      template <typename Func>
+      void then(Func &&f) const { record().then(std::forward<Func>(f)); }
+
       /**
        * @brief Start a timer for profiling workload
        */
@@ -133,11 +182,252 @@ namespace detail
         return time;
       }
 
+      /**
+       * @brief Capture all work issued to this executor inside a function into a CUDA graph
+       *
+       * Every run() call, transform, and library call (cuFFT, cuBLASLt, CUB, etc.) made on this
+       * executor's stream inside ``f`` is recorded into ``graph`` instead of being executed. The first
+       * capture instantiates the graph; later captures of the same sequence update it in place with
+       * cudaGraphExecUpdate, which is much cheaper than re-instantiating when only pointers or scalar
+       * parameters changed. Use launch() to replay the graph.
+       *
+       * Library plans and workspaces cannot be created during capture. When ``warmup`` is true and the
+       * graph has never been captured, ``f`` is first executed eagerly so all plans are cached before
+       * capture begins. Note that this executes the work in ``f`` once.
+       *
+       * Capture uses cudaStreamCaptureModeThreadLocal, so other host threads are unaffected. The executor
+       * must not use the legacy default stream.
+       *
+       * @param graph Graph to capture into
+       * @param f Function issuing work on this executor
+       * @param warmup Run ``f`` once before the first capture to populate plan caches
+       */
+      template <typename Func>
+      void capture(cudaGraph &graph, Func &&f, bool warmup = true) {
+        MATX_ASSERT_STR(stream_ != 0, matxInvalidParameter, "Graph capture requires a non-default stream");
+
+        if (warmup && !graph.is_instantiated()) {
+          f();
+        }
+
+        MATX_CUDA_CHECK(cudaStreamBeginCapture(stream_, cudaStreamCaptureModeThreadLocal));
+        try {
+          f();
+        }
+        catch (...) {
+          cudaGraph_t partial = nullptr;
+          cudaStreamEndCapture(stream_, &partial);
+          if (partial != nullptr) {
+            cudaGraphDestroy(partial);
+          }
+          throw;
+        }
+
+        cudaGraph_t captured = nullptr;
+        MATX_CUDA_CHECK(cudaStreamEndCapture(stream_, &captured));
+        graph.set_captured(captured);
+      }
+
+      /**
+       * @brief Launch a previously-captured graph on this executor's stream
+       *
+       * @param graph Graph to launch
+       */
+      void launch(const cudaGraph &graph) const {
+        graph.launch(stream_);
+      }
+
+      /**
+       * @brief Check if this executor's stream is currently being captured into a graph
+       */
+      bool is_capturing() const {
+        cudaStreamCaptureStatus status = cudaStreamCaptureStatusNone;
+        MATX_CUDA_CHECK(cudaStreamIsCapturing(stream_, &status));
+        return status == cudaStreamCaptureStatusActive;
+      }
+
+      /**
+       * @brief Check if device_while() can be used on this executor
+       *
+       * Device loops need CUDA 12.4 or newer, a stream other than the legacy default stream, and a stream
+       * that is not already being captured.
+       */
+      bool supports_device_while() const {
+#if defined(__CUDACC__) && CUDART_VERSION >= 12040
+        return stream_ != 0 && !is_capturing();
+#else
+        return false;
+#endif
+      }
+
+      /**
+       * @brief Repeat work on the device while a condition holds, without returning to the host
+       *
+       * The work issued to this executor inside ``body`` is captured into the body of a CUDA graph while
+       * node, and the graph is launched on this executor's stream. ``cond`` is evaluated by a single device
+       * thread before the first iteration and after every iteration, and the loop exits once it is false or
+       * ``max_iters`` iterations have run. The host never waits on the loop, so iterative algorithms can run
+       * to convergence with one launch and no round trips.
+       *
+       * ``body`` is captured rather than executed, with the same restrictions as capture(): plans and
+       * workspaces must already exist, so run the work once beforehand when it uses transforms. The body
+       * must also not allocate memory or synchronize with the host, since conditional graph bodies cannot
+       * contain memory allocation nodes. See supports_device_while() for the requirements on the executor.
+       *
+       * @param cond Rank-0 tensor or operator converted to bool
+       * @param body Function issuing work on this executor
+       * @param max_iters Maximum number of iterations
+       */
+      template <typename CondOp, typename Func>
+      void device_while([[maybe_unused]] const CondOp &cond, [[maybe_unused]] Func &&body, [[maybe_unused]] int max_iters) const {
+#if defined(__CUDACC__) && CUDART_VERSION >= 12040
+        static_assert(CondOp::Rank() == 0, "device_while() condition must be rank 0");
+        if (stream_ == 0) {
+          MATX_THROW(matxInvalidParameter, "device_while() requires a non-default stream");
+        }
+        if (is_capturing()) {
+          MATX_THROW(matxNotSupported, "device_while() cannot be called while the executor is being captured");
+        }
+        if (max_iters <= 0) {
+          return;
+        }
+
+        int *iter = nullptr;
+        cudaGraph_t graph = nullptr;
+        cudaGraphExec_t graph_exec = nullptr;
+        MATX_CUDA_CHECK(cudaMallocAsync(&iter, sizeof(int), stream_));
+        MATX_CUDA_CHECK(cudaGraphCreate(&graph, 0));
+
+        auto release = [&]() {
+          cudaStreamCaptureStatus status = cudaStreamCaptureStatusNone;
+          cudaStreamIsCapturing(stream_, &status);
+          if (status != cudaStreamCaptureStatusNone) {
+            cudaGraph_t partial = nullptr;
+            cudaStreamEndCapture(stream_, &partial);
+          }
+          if (graph_exec != nullptr) {
+            cudaGraphExecDestroy(graph_exec);
+          }
+          cudaGraphDestroy(graph);
+          cudaFreeAsync(iter, stream_);
+        };
+
+        try {
+          cudaGraphConditionalHandle handle;
+          MATX_CUDA_CHECK(cudaGraphConditionalHandleCreate(&handle, graph, 0, 0));
+
+          // The first evaluation of the condition also resets the iteration count
+          MATX_CUDA_CHECK(cudaStreamBeginCaptureToGraph(stream_, graph, nullptr, nullptr, 0, cudaStreamCaptureModeThreadLocal));
+          detail::matxDeviceWhileCondKernel<<<1, 1, 0, stream_>>>(cond, handle, iter, max_iters, true);
+          MATX_CUDA_CHECK(cudaStreamEndCapture(stream_, &graph));
+
+          cudaGraphNode_t init_node;
+          size_t num_nodes = 1;
+          MATX_CUDA_CHECK(cudaGraphGetNodes(graph, &init_node, &num_nodes));
+
+          cudaGraphNodeParams params = {};
+          params.type = cudaGraphNodeTypeConditional;
+          params.conditional.handle = handle;
+          params.conditional.type = cudaGraphCondTypeWhile;
+          params.conditional.size = 1;
+
+          cudaGraphNode_t loop_node;
+#if CUDART_VERSION >= 13000
+          MATX_CUDA_CHECK(cudaGraphAddNode(&loop_node, graph, &init_node, nullptr, 1, &params));
+#else
+          MATX_CUDA_CHECK(cudaGraphAddNode(&loop_node, graph, &init_node, 1, &params));
+#endif
+
+          // Capture the body on this stream so the plans cached for it are reused
+          cudaGraph_t loop_body = params.conditional.phGraph_out[0];
+          MATX_CUDA_CHECK(cudaStreamBeginCaptureToGraph(stream_, loop_body, nullptr, nullptr, 0, cudaStreamCaptureModeThreadLocal));
+          body();
+          detail::matxDeviceWhileCondKernel<<<1, 1, 0, stream_>>>(cond, handle, iter, max_iters, false);
+          MATX_CUDA_CHECK(cudaStreamEndCapture(stream_, &loop_body));
+
+          MATX_CUDA_CHECK(cudaGraphInstantiate(&graph_exec, graph, 0));
+          MATX_CUDA_CHECK(cudaGraphLaunch(graph_exec, stream_));
+          MATX_LOG_DEBUG("Launched device while loop: max_iters={}, stream={}", max_iters, reinterpret_cast<void*>(stream_));
+        }
+        catch (...) {
+          release();
+          throw;
+        }
+
+        // The executable graph may be destroyed while it is still running
+        release();
+#else
+        MATX_THROW(matxNotSupported, "device_while() requires compiling with nvcc against CUDA 12.4 or newer");
+#endif
+      }
+
+      /**
+       * @brief Prefetch the memory each expression touches before it is launched
+       *
+       * When enabled, run() walks the expression and issues cudaMemPrefetchAsync to the current device for
+       * every tensor in MATX_MANAGED_MEMORY or MATX_SYSTEM_MEMORY, covering only the range of the view used.
+       * Other memory spaces are skipped. Prefetches are not issued while the stream is being captured.
+       *
+       * @param enable Whether to prefetch
+       */
+      void set_prefetch(bool enable) { prefetch_ = enable; }
+
+      /**
+       * @brief Whether expressions prefetch their memory before launch
+       */
+      bool get_prefetch() const { return prefetch_; }
+
+      /**
+       * @brief Track which stream last wrote each tensor and wait for it automatically
+       *
+       * When enabled, run() makes this executor's stream wait for the last write to every tensor the expression
+       * references if that write was issued on a different stream, and records this stream as the writer of the
+       * expression's outputs once it is launched. Only writes made through executors with tracking enabled are
+       * known, and only assignments and mtie() outputs count as writes. Nothing is tracked while the stream is
+       * being captured.
+       *
+       * @param enable Whether to track dependencies
+       */
+      void set_track_dependencies(bool enable) { track_dependencies_ = enable; }
+
+      /**
+       * @brief Whether run() tracks cross-stream dependencies
+       */
+      bool get_track_dependencies() const { return track_dependencies_; }
+
+      /**
+       * @brief Number of SMs the executor's stream is limited to, or 0 if it can use the whole device
+       */
+      int get_sm_count() const { return sm_count_; }
+
+      /**
+       * @brief Priority of the executor's stream
+       */
+      int get_priority() const {
+        int priority = 0;
+        MATX_CUDA_CHECK(cudaStreamGetPriority(stream_, &priority));
+        return priority;
+      }
+
     protected:
+      /**
+       * @brief Threads of a kernel that can be resident at once on the SMs this executor may use
+       */
+      index_t resident_threads(index_t device_resident, int device_sms) const {
+        if (sm_count_ > 0 && sm_count_ < device_sms) {
+          return std::max(static_cast<index_t>(1), device_resident / device_sms * sm_count_);
+        }
+        return device_resident;
+      }
+
+      std::shared_ptr<ExecutorStreamResource> owned_stream_;
       cudaStream_t stream_;
       bool profiling_;
       cudaEvent_t start_;
       cudaEvent_t stop_;
+      bool prefetch_ = false;
+      bool track_dependencies_ = false;
+      int sm_count_ = 0;
   };
 
   /**
@@ -424,6 +714,72 @@ namespace detail
     return cuda::std::make_tuple(min_ept, shm_size, block_size, groups_per_block);
   }
 
+  /**
+   * Occupancy-derived launch limits for a statically-compiled element-wise kernel
+   *
+   * These only depend on the resources the kernel uses and on the device, so they are computed
+   * once per kernel and device with the CUDA occupancy API and cached. This replaces a fixed
+   * block size, which left register-heavy fused expressions with too few resident warps.
+   */
+  struct AOTLaunchParams {
+    int block_size;                    // Block size with the best occupancy, rounded down to a power of two
+    index_t max_resident_threads;      // Threads of this kernel that fit on the whole device at once
+    int num_sms;                       // SMs on the device
+  };
+
+  // Cache for AOT launch parameters, keyed by device and kernel function pointer
+  static std::map<std::pair<int, const void *>, AOTLaunchParams> aot_launch_params_cache;
+  static std::mutex aot_launch_params_mutex;
+
+  // Grids needing more than this many waves of resident threads are launched persistently
+  constexpr index_t AOT_PERSISTENT_WAVES = 4;
+
+  /**
+   * Get the cached occupancy-based launch parameters for a kernel
+   *
+   * @param kernel Kernel function pointer
+   * @return Launch parameters for the kernel on the current device
+   */
+  inline AOTLaunchParams GetAOTLaunchParams(const void *kernel) {
+    int dev;
+    MATX_CUDA_CHECK(cudaGetDevice(&dev));
+    const auto key = std::make_pair(dev, kernel);
+
+    {
+      std::lock_guard<std::mutex> lock(aot_launch_params_mutex);
+      const auto it = aot_launch_params_cache.find(key);
+      if (it != aot_launch_params_cache.end()) {
+        return it->second;
+      }
+    }
+
+    int min_grid_size = 0;
+    int occ_block_size = 0;
+    MATX_CUDA_CHECK(cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &occ_block_size, kernel, 0, 0));
+
+    // get_grid_dims grows block dimensions in powers of two, so the limit must be one as well
+    int block_size = 32;
+    while (block_size * 2 <= occ_block_size) {
+      block_size *= 2;
+    }
+
+    int blocks_per_sm = 0;
+    int num_sms = 0;
+    MATX_CUDA_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(&blocks_per_sm, kernel, block_size, 0));
+    MATX_CUDA_CHECK(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev));
+
+    AOTLaunchParams params;
+    params.block_size = block_size;
+    params.max_resident_threads = static_cast<index_t>(blocks_per_sm > 0 ? blocks_per_sm : 1) * block_size * num_sms;
+    params.num_sms = num_sms;
+    MATX_LOG_DEBUG("AOT launch params: occupancy block size {}, using {}, max resident threads {}",
+                   occ_block_size, params.block_size, params.max_resident_threads);
+
+    std::lock_guard<std::mutex> lock(aot_launch_params_mutex);
+    aot_launch_params_cache[key] = params;
+    return params;
+  }
+
 } // namespace detail
 } // namespace matx
 
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <utility>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+
+namespace matx
+{
+
+/**
+ * @brief Instantiated CUDA graph recorded from a sequence of MatX executions
+ *
+ * A cudaGraph is populated by cudaExecutor::capture() and replayed with cudaExecutor::launch(). When
+ * the same sequence is captured again (for example because tensor pointers changed), the existing
+ * executable graph is updated in place with cudaGraphExecUpdate instead of being re-instantiated. If
+ * the topology changed and the update is rejected, the graph is re-instantiated automatically.
+ */
+class cudaGraph {
+  public:
+    cudaGraph() = default;
+
+    ~cudaGraph() {
+      reset();
+    }
+
+    cudaGraph(const cudaGraph &) = delete;
+    cudaGraph &operator=(const cudaGraph &) = delete;
+
+    cudaGraph(cudaGraph &&other) noexcept
+      : graph_(std::exchange(other.graph_, nullptr)), exec_(std::exchange(other.exec_, nullptr)),
+        instantiations_(other.instantiations_), updates_(other.updates_) {}
+
+    cudaGraph &operator=(cudaGraph &&other) noexcept {
+      if (this != &other) {
+        reset();
+        graph_ = std::exchange(other.graph_, nullptr);
+        exec_ = std::exchange(other.exec_, nullptr);
+        instantiations_ = other.instantiations_;
+        updates_ = other.updates_;
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Check if the graph has been captured and instantiated
+     */
+    bool is_instantiated() const { return exec_ != nullptr; }
+
+    /**
+     * @brief Number of times the graph was fully instantiated
+     */
+    int num_instantiations() const { return instantiations_; }
+
+    /**
+     * @brief Number of times the graph was updated in place by a recapture
+     */
+    int num_updates() const { return updates_; }
+
+    /**
+     * @brief Get the underlying executable graph
+     */
+    cudaGraphExec_t get() const { return exec_; }
+
+    /**
+     * @brief Launch the graph on a stream
+     *
+     * @param stream Stream to launch on
+     */
+    void launch(cudaStream_t stream) const {
+      MATX_ASSERT_STR(exec_ != nullptr, matxInvalidParameter, "Cannot launch a graph that has not been captured");
+      MATX_CUDA_CHECK(cudaGraphLaunch(exec_, stream));
+    }
+
+    /**
+     * @brief Destroy the graph and its executable instance
+     */
+    void reset() {
+      if (exec_ != nullptr) {
+        cudaGraphExecDestroy(exec_);
+        exec_ = nullptr;
+      }
+      if (graph_ != nullptr) {
+        cudaGraphDestroy(graph_);
+        graph_ = nullptr;
+      }
+    }
+
+    /**
+     * @brief Take ownership of a newly-captured graph, updating the executable graph if possible
+     *
+     * @param captured Graph returned from cudaStreamEndCapture
+     */
+    void set_captured(cudaGraph_t captured) {
+      if (exec_ != nullptr) {
+        cudaGraphExecUpdateResultInfo info;
+        if (cudaGraphExecUpdate(exec_, captured, &info) == cudaSuccess) {
+          MATX_LOG_DEBUG("Updated CUDA graph in place");
+          cudaGraphDestroy(graph_);
+          graph_ = captured;
+          updates_++;
+          return;
+        }
+
+        // Clear the sticky error from the rejected update and fall back to a full instantiation
+        cudaGetLastError();
+        MATX_LOG_DEBUG("CUDA graph update rejected (result {}); re-instantiating", static_cast<int>(info.result));
+      }
+
+      reset();
+      graph_ = captured;
+      MATX_CUDA_CHECK(cudaGraphInstantiate(&exec_, graph_, 0));
+      instantiations_++;
+    }
+
+  private:
+    cudaGraph_t graph_ = nullptr;
+    cudaGraphExec_t exec_ = nullptr;
+    int instantiations_ = 0;
+    int updates_ = 0;
+};
+
+} // namespace matx
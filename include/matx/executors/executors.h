@@ -35,4 +35,8 @@
 #include "matx/executors/support.h"
 #include "matx/executors/cuda.h"
 #include "matx/executors/jit_cuda.h"
+#include "matx/executors/task_graph.h"
+#include "matx/executors/host_pipeline.h"
+#include "matx/executors/hybrid.h"
 #include "matx/executors/host.h"
+#include "matx/executors/async_scalar.h"
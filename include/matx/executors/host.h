@@ -32,10 +32,16 @@
 
 #pragma once
 #include <type_traits>
+#include <utility>
+#include <chrono>
+#include <memory>
+#include <vector>
 #include <cuda/std/array>
+#include <cuda/std/__algorithm/min.h>
 
 #include "matx/core/error.h"
 #include "matx/core/get_grid_dims.h"
+#include "matx/executors/host_thread_pool.h"
 #ifdef MATX_EN_OMP
 #include <omp.h>
 #endif
@@ -47,9 +53,59 @@ static constexpr int MAX_CPUS = 1024;
 // Include host_ prefix to avoid name collision with cpu_set_t from <sched.h> on Linux
 struct host_cpu_set_t {
   using set_type = uint64_t;
+  static constexpr int BITS_PER_SET = 8 * sizeof(set_type);
 
-  cuda::std::array<set_type, MAX_CPUS / (8 * sizeof(set_type))> bits_;
+  cuda::std::array<set_type, MAX_CPUS / BITS_PER_SET> bits_;
+
+  /**
+   * @brief Add a CPU to the set
+   *
+   * @param cpu CPU ID
+   */
+  void set(int cpu) {
+    MATX_ASSERT_STR(cpu >= 0 && cpu < MAX_CPUS, matxInvalidParameter, "CPU ID out of range");
+    bits_[cpu / BITS_PER_SET] |= set_type{1} << (cpu % BITS_PER_SET);
+  }
+
+  /**
+   * @brief Check if a CPU is in the set
+   *
+   * @param cpu CPU ID
+   * @return True if the CPU is in the set
+   */
+  bool is_set(int cpu) const {
+    return (bits_[cpu / BITS_PER_SET] >> (cpu % BITS_PER_SET)) & 1;
+  }
+
+  /**
+   * @brief Get the CPU IDs in the set in ascending order
+   */
+  std::vector<int> cpus() const {
+    std::vector<int> ids;
+    for (int cpu = 0; cpu < MAX_CPUS; cpu++) {
+      if (is_set(cpu)) {
+        ids.push_back(cpu);
+      }
+    }
+    return ids;
+  }
+};
+
+namespace detail {
+// Writes a value-initialized element at every index of a tensor, used to first-touch its pages
+template <typename TensorType>
+struct FirstTouchOp {
+  static constexpr int Rank() { return TensorType::Rank(); }
+  index_t Size(int dim) const { return t_.Size(dim); }
+
+  template <typename... Is>
+  void operator()(Is... indices) const {
+    t_(indices...) = typename TensorType::value_type{};
+  }
+
+  mutable TensorType t_;
 };
+} // namespace detail
 
 enum class ThreadsMode {
   SINGLE,
@@ -58,18 +114,40 @@ enum class ThreadsMode {
 };
 
 struct HostExecParams {
-  HostExecParams(int threads = 1) : threads_(threads) {}
-  HostExecParams(host_cpu_set_t cpu_set) : threads_(1), cpu_set_(cpu_set) {
-    MATX_ASSERT_STR(false, matxNotSupported, "CPU affinity not supported yet");
+  /**
+   * @brief Host executor parameters
+   *
+   * @param threads Number of threads
+   * @param persistent Use a persistent thread pool instead of OpenMP. The pool's workers stay alive
+   * across Exec calls, which removes the per-call fork cost that dominates for small tensors.
+   */
+  HostExecParams(int threads = 1, bool persistent = false) : threads_(threads), persistent_(persistent) {}
+
+  /**
+   * @brief Host executor parameters with CPU affinity
+   *
+   * A persistent thread pool is created with one worker pinned to each CPU in the set. Each worker
+   * always processes the same share of a given shape, so memory first-touched by the executor stays on
+   * the NUMA node of the worker that later reads and writes it.
+   *
+   * @param cpu_set CPUs to run on
+   */
+  HostExecParams(host_cpu_set_t cpu_set) : persistent_(true), cpu_set_(cpu_set) {
+    threads_ = static_cast<int>(cpu_set_.cpus().size());
+    MATX_ASSERT_STR(threads_ > 0, matxInvalidParameter, "CPU set must contain at least one CPU");
+    has_cpu_set_ = true;
   }
 
   int GetNumThreads() const { return threads_; }
+  bool IsPersistent() const { return persistent_; }
+  bool HasCpuSet() const { return has_cpu_set_; }
+  const host_cpu_set_t &GetCpuSet() const { return cpu_set_; }
 
   private:
     int threads_;
-MATX_IGNORE_WARNING_PUSH_CLANG("-Wunused-private-field")    
+    bool persistent_ = false;
+    bool has_cpu_set_ = false;
     host_cpu_set_t cpu_set_ {0};
-MATX_IGNORE_WARNING_POP_CLANG
 };
 
 /**
@@ -102,6 +180,18 @@ class HostExecutor {
     }
 
     HostExecutor(const HostExecParams &params) : params_(params) {
+      if (params_.IsPersistent()) {
+        std::vector<int> cpus;
+        if (params_.HasCpuSet()) {
+          cpus = params_.GetCpuSet().cpus();
+        }
+        else {
+          cpus.assign(params_.GetNumThreads(), -1);
+        }
+        pool_ = std::make_shared<detail::HostThreadPool>(cpus, params_.HasCpuSet());
+        return;
+      }
+
 #ifdef MATX_EN_OMP
       omp_set_num_threads(params_.GetNumThreads());
 #endif
@@ -141,6 +231,11 @@ class HostExecutor {
     /**
      * @brief Execute an operator
      *
+     * The outer dimensions are walked one row at a time and the innermost dimension is traversed
+     * contiguously, so the N-D index is only decomposed once per row and the inner loop is free for
+     * the compiler to vectorize. With multiple threads, rows are distributed across threads, and rows
+     * are additionally split into tiles when there are fewer rows than threads.
+     *
      * @tparam Op Operator type
      * @param op Operator to execute
      */
@@ -150,33 +245,95 @@ class HostExecutor {
         op();
       }
       else {
-        index_t size = TotalSize(op);
+        constexpr int RANK = Op::Rank();
+        const index_t inner = op.Size(RANK - 1);
+        if (inner == 0) {
+          return;
+        }
+
+        const index_t outer = TotalSize(op) / inner;
+        index_t tiles_per_row = 1;
+        const int nthreads = params_.GetNumThreads();
+        if (nthreads > 1 && outer < nthreads) {
+          tiles_per_row = cuda::std::min(inner, (static_cast<index_t>(nthreads) + outer - 1) / outer);
+        }
+        const index_t tile = (inner + tiles_per_row - 1) / tiles_per_row;
+        const index_t work = outer * tiles_per_row;
+
+        auto exec_tile = [&](index_t w) {
+          const index_t row = w / tiles_per_row;
+          const index_t begin = (w - row * tiles_per_row) * tile;
+          const index_t end = cuda::std::min(inner, begin + tile);
+          ExecRow(op, BlockToIdx(op, row, 1), begin, end, std::make_index_sequence<RANK - 1>{});
+        };
+
+        ParallelFor(work, exec_tile);
+      }
+    }
+
+    /**
+     * @brief Call f(i) for every i in [0, n) across the executor's threads and wait for completion
+     *
+     * Work runs on the persistent pool if there is one, otherwise on OpenMP threads. With a single
+     * thread the loop runs inline. f must not throw.
+     *
+     * @tparam F Function type
+     * @param n Number of work items
+     * @param f Function taking the work item index
+     */
+    template <typename F>
+    void ParallelFor(index_t n, const F &f) const {
+      if (pool_) {
+        pool_->ParallelFor(n, f);
+        return;
+      }
+
   #ifdef MATX_EN_OMP
-        if (params_.GetNumThreads() > 1) {
-          #pragma omp parallel for num_threads(params_.GetNumThreads())
-          for (index_t i = 0; i < size; i++) {
-            auto idx = GetIdxFromAbs(op, i);
-            cuda::std::apply([&](auto... args) {
-              return op(args...);
-            }, idx);
-          }
-        } else
+      if (params_.GetNumThreads() > 1) {
+        #pragma omp parallel for num_threads(params_.GetNumThreads()) schedule(static)
+        for (index_t w = 0; w < n; w++) {
+          f(w);
+        }
+      } else
   #endif
-        {
-          for (index_t i = 0; i < size; i++) {
-            auto idx = GetIdxFromAbs(op, i);
-            cuda::std::apply([&](auto... args) {
-              return op(args...);
-            }, idx);
-          }
+      {
+        for (index_t w = 0; w < n; w++) {
+          f(w);
         }
       }
     }
 
+    /**
+     * @brief Zero a tensor using the same partitioning as Exec
+     *
+     * Pages of MATX_HOST_NUMA_MEMORY are placed on the NUMA node of the thread that first writes them.
+     * Calling this right after allocation, with an executor built from a host_cpu_set_t, places each
+     * page on the node of the worker that will process it when operators of the same shape run on this
+     * executor.
+     *
+     * @tparam TensorType Tensor type
+     * @param t Tensor to zero
+     */
+    template <typename TensorType>
+    void FirstTouch(const TensorType &t) const {
+      Exec(detail::FirstTouchOp<TensorType>{t});
+    }
+
     int GetNumThreads() const { return params_.GetNumThreads(); }
 
     private:
+      /**
+       * @brief Execute a contiguous range of the innermost dimension with the outer indices fixed
+       */
+      template <typename Op, typename IdxType, size_t... Is>
+      static void ExecRow(const Op &op, const IdxType &idx, index_t begin, index_t end, std::index_sequence<Is...>) {
+        for (index_t j = begin; j < end; j++) {
+          op(idx[Is]..., j);
+        }
+      }
+
       HostExecParams params_;
+      std::shared_ptr<detail::HostThreadPool> pool_;
       std::chrono::time_point<std::chrono::high_resolution_clock> start_;
       std::chrono::time_point<std::chrono::high_resolution_clock> stop_;
 };
@@ -0,0 +1,264 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/make_tensor.h"
+#include "matx/executors/cuda.h"
+
+namespace matx
+{
+
+/**
+ * @brief Pipelines host input, device compute and host output over a ring of pinned buffers
+ *
+ * The pipeline owns ``depth`` slots, each with a pinned host input buffer, device input and output
+ * buffers and a pinned host output buffer. A submitted slot is copied to the device on a copy-in stream,
+ * processed by the compute function on a compute stream and copied back on a copy-out stream, with events
+ * ordering the three stages. With three or more slots the host-to-device copy of one iteration, the compute of
+ * the previous one and the device-to-host copy of the one before run concurrently.
+ *
+ * The producer and consumer sides are thread-safe with respect to each other, so one thread can fill inputs
+ * (for example a NIC ingest thread) while another consumes outputs:
+ *
+ * - Producer: AcquireInput() blocks until a slot is free, the host fills HostInput(slot), and Submit(slot)
+ *   issues the GPU work. Close() marks the end of the input.
+ * - Consumer: AcquireOutput() blocks until the oldest submitted slot has been copied back, the host reads
+ *   HostOutput(slot), and ReleaseOutput(slot) returns the slot to the producer. After Close() and once all
+ *   submitted slots are drained, AcquireOutput() returns -1.
+ *
+ * @tparam InType Input element type
+ * @tparam IN_RANK Input rank
+ * @tparam OutType Output element type
+ * @tparam OUT_RANK Output rank
+ */
+template <typename InType, int IN_RANK, typename OutType = InType, int OUT_RANK = IN_RANK>
+class hostDevicePipeline {
+  public:
+    using in_tensor = tensor_t<InType, IN_RANK>;
+    using out_tensor = tensor_t<OutType, OUT_RANK>;
+    using compute_fn = std::function<void(out_tensor &, const in_tensor &, cudaExecutor &)>;
+
+    /**
+     * @brief Construct a pipeline and allocate its buffers
+     *
+     * @param in_shape Shape of one input block
+     * @param out_shape Shape of one output block
+     * @param compute Function writing the device output of a slot from its device input. May run any MatX
+     *   expressions on the executor it is given
+     * @param depth Number of slots
+     */
+    hostDevicePipeline(const cuda::std::array<index_t, IN_RANK> &in_shape,
+                       const cuda::std::array<index_t, OUT_RANK> &out_shape,
+                       compute_fn compute, int depth = 3)
+      : compute_(std::move(compute))
+    {
+      MATX_ASSERT_STR(depth > 0, matxInvalidParameter, "hostDevicePipeline requires at least one slot");
+
+      MATX_CUDA_CHECK(cudaStreamCreateWithFlags(&h2d_stream_, cudaStreamNonBlocking));
+      MATX_CUDA_CHECK(cudaStreamCreateWithFlags(&compute_stream_, cudaStreamNonBlocking));
+      MATX_CUDA_CHECK(cudaStreamCreateWithFlags(&d2h_stream_, cudaStreamNonBlocking));
+
+      slots_.resize(static_cast<size_t>(depth));
+      for (int s = 0; s < depth; s++) {
+        auto &slot = slots_[static_cast<size_t>(s)];
+        make_tensor(slot.h_in, in_shape, MATX_HOST_MEMORY);
+        make_tensor(slot.d_in, in_shape, MATX_DEVICE_MEMORY);
+        make_tensor(slot.d_out, out_shape, MATX_DEVICE_MEMORY);
+        make_tensor(slot.h_out, out_shape, MATX_HOST_MEMORY);
+        MATX_CUDA_CHECK(cudaEventCreateWithFlags(&slot.h2d_done, cudaEventDisableTiming));
+        MATX_CUDA_CHECK(cudaEventCreateWithFlags(&slot.compute_done, cudaEventDisableTiming));
+        MATX_CUDA_CHECK(cudaEventCreateWithFlags(&slot.d2h_done, cudaEventDisableTiming));
+        free_.push_back(s);
+      }
+    }
+
+    ~hostDevicePipeline() {
+      cudaStreamSynchronize(h2d_stream_);
+      cudaStreamSynchronize(compute_stream_);
+      cudaStreamSynchronize(d2h_stream_);
+      for (auto &slot : slots_) {
+        cudaEventDestroy(slot.h2d_done);
+        cudaEventDestroy(slot.compute_done);
+        cudaEventDestroy(slot.d2h_done);
+      }
+      cudaStreamDestroy(h2d_stream_);
+      cudaStreamDestroy(compute_stream_);
+      cudaStreamDestroy(d2h_stream_);
+    }
+
+    hostDevicePipeline(const hostDevicePipeline &) = delete;
+    hostDevicePipeline &operator=(const hostDevicePipeline &) = delete;
+
+    /**
+     * @brief Reserve a free slot for the producer, blocking until one is available
+     *
+     * @return Slot index
+     */
+    int AcquireInput() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&]() { return !free_.empty(); });
+      const int slot = free_.front();
+      free_.pop_front();
+      return slot;
+    }
+
+    /**
+     * @brief Pinned host input buffer of a slot
+     *
+     * @param slot Slot returned from AcquireInput()
+     */
+    in_tensor &HostInput(int slot) { return slots_[static_cast<size_t>(slot)].h_in; }
+
+    /**
+     * @brief Issue the copy-in, compute and copy-out of a filled slot
+     *
+     * Returns once the work is queued. The host input buffer must not be modified until the slot is
+     * acquired again.
+     *
+     * @param slot Slot returned from AcquireInput()
+     */
+    void Submit(int slot) {
+      auto &s = slots_[static_cast<size_t>(slot)];
+
+      MATX_CUDA_CHECK(cudaMemcpyAsync(s.d_in.Data(), s.h_in.Data(), s.h_in.Bytes(),
+                                      cudaMemcpyHostToDevice, h2d_stream_));
+      MATX_CUDA_CHECK(cudaEventRecord(s.h2d_done, h2d_stream_));
+
+      MATX_CUDA_CHECK(cudaStreamWaitEvent(compute_stream_, s.h2d_done, 0));
+      cudaExecutor exec{compute_stream_};
+      compute_(s.d_out, s.d_in, exec);
+      MATX_CUDA_CHECK(cudaEventRecord(s.compute_done, compute_stream_));
+
+      MATX_CUDA_CHECK(cudaStreamWaitEvent(d2h_stream_, s.compute_done, 0));
+      MATX_CUDA_CHECK(cudaMemcpyAsync(s.h_out.Data(), s.d_out.Data(), s.d_out.Bytes(),
+                                      cudaMemcpyDeviceToHost, d2h_stream_));
+      MATX_CUDA_CHECK(cudaEventRecord(s.d2h_done, d2h_stream_));
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        submitted_.push_back(slot);
+      }
+      cv_.notify_all();
+    }
+
+    /**
+     * @brief Signal that no more slots will be submitted
+     */
+    void Close() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+      }
+      cv_.notify_all();
+    }
+
+    /**
+     * @brief Wait for the oldest submitted slot to be copied back to the host
+     *
+     * @return Slot index, or -1 once the pipeline is closed and every submitted slot has been returned
+     */
+    int AcquireOutput() {
+      int slot;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&]() { return !submitted_.empty() || closed_; });
+        if (submitted_.empty()) {
+          return -1;
+        }
+        slot = submitted_.front();
+        submitted_.pop_front();
+      }
+
+      MATX_CUDA_CHECK(cudaEventSynchronize(slots_[static_cast<size_t>(slot)].d2h_done));
+      return slot;
+    }
+
+    /**
+     * @brief Pinned host output buffer of a slot
+     *
+     * @param slot Slot returned from AcquireOutput()
+     */
+    const out_tensor &HostOutput(int slot) const { return slots_[static_cast<size_t>(slot)].h_out; }
+
+    /**
+     * @brief Return a consumed slot to the producer
+     *
+     * @param slot Slot returned from AcquireOutput()
+     */
+    void ReleaseOutput(int slot) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(slot);
+      }
+      cv_.notify_all();
+    }
+
+    /**
+     * @brief Number of slots in the pipeline
+     */
+    int Depth() const { return static_cast<int>(slots_.size()); }
+
+  private:
+    struct Slot {
+      in_tensor h_in;
+      in_tensor d_in;
+      out_tensor d_out;
+      out_tensor h_out;
+      cudaEvent_t h2d_done = nullptr;
+      cudaEvent_t compute_done = nullptr;
+      cudaEvent_t d2h_done = nullptr;
+    };
+
+    compute_fn compute_;
+    std::vector<Slot> slots_;
+    cudaStream_t h2d_stream_ = nullptr;
+    cudaStream_t compute_stream_ = nullptr;
+    cudaStream_t d2h_stream_ = nullptr;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<int> free_;
+    std::deque<int> submitted_;
+    bool closed_ = false;
+};
+
+} // namespace matx
@@ -0,0 +1,229 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "matx/core/defines.h"
+#include "matx/core/log.h"
+
+namespace matx
+{
+namespace detail
+{
+
+/**
+ * @brief Persistent pool of host worker threads
+ *
+ * Workers are created once and stay alive for the lifetime of the pool, so dispatching work does not
+ * pay for creating or forking threads. Each worker is optionally pinned to one CPU. Work is split
+ * into chunks that workers claim dynamically from a shared counter, so faster workers pick up the
+ * slack of slower ones. With static scheduling, worker k instead always gets the k-th contiguous
+ * range of work items, so the same worker touches the same memory on every call. Idle workers spin for a short time before blocking, which keeps dispatch
+ * latency low for back-to-back calls while not burning CPU when the pool is idle.
+ *
+ * One ParallelFor runs at a time; concurrent callers are serialized.
+ */
+class HostThreadPool {
+  public:
+    static constexpr int SPIN_ITERATIONS = 1 << 16;
+
+    /**
+     * @brief Construct a thread pool
+     *
+     * @param cpus CPU IDs to pin workers to. One worker is created per entry.
+     * @param static_schedule Give each worker a fixed contiguous range of work items
+     */
+    HostThreadPool(const std::vector<int> &cpus, bool static_schedule = false) : static_schedule_(static_schedule) {
+      workers_.reserve(cpus.size());
+      for (size_t i = 0; i < cpus.size(); i++) {
+        const int worker = static_cast<int>(i);
+        workers_.emplace_back([this, worker]() { WorkerLoop(worker); });
+        Pin(workers_.back(), cpus[i]);
+      }
+
+      MATX_LOG_DEBUG("Created host thread pool with {} workers", workers_.size());
+    }
+
+    ~HostThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stop_.store(true);
+        generation_.fetch_add(1);
+      }
+      cv_.notify_all();
+
+      for (auto &t : workers_) {
+        t.join();
+      }
+    }
+
+    HostThreadPool(const HostThreadPool &) = delete;
+    HostThreadPool &operator=(const HostThreadPool &) = delete;
+
+    int NumThreads() const { return static_cast<int>(workers_.size()); }
+
+    /**
+     * @brief Call f(i) for every i in [0, n) across the pool and wait for completion
+     *
+     * @param n Number of work items
+     * @param f Function taking the work item index
+     */
+    template <typename F>
+    void ParallelFor(index_t n, const F &f) {
+      if (n <= 0) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> dispatch_lock(dispatch_mtx_);
+
+      fn_ = [](const void *ctx, index_t begin, index_t end) {
+        const F &func = *static_cast<const F *>(ctx);
+        for (index_t i = begin; i < end; i++) {
+          func(i);
+        }
+      };
+      ctx_ = &f;
+      total_ = n;
+      chunk_ = cuda::std::max(index_t{1}, n / (static_cast<index_t>(workers_.size()) * 4));
+      next_.store(0, std::memory_order_relaxed);
+      finished_.store(0, std::memory_order_relaxed);
+
+      generation_.fetch_add(1);
+      if (sleepers_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        cv_.notify_all();
+      }
+
+      // Every worker checks in for this generation before the next one can start, so no worker can
+      // observe a partially-updated dispatch
+      const int num_workers = NumThreads();
+      int spins = 0;
+      while (finished_.load(std::memory_order_acquire) < num_workers) {
+        if (++spins % 64 == 0) {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+  private:
+    static void Pin([[maybe_unused]] std::thread &t, [[maybe_unused]] int cpu) {
+#if defined(__linux__)
+      if (cpu < 0) {
+        return;
+      }
+
+      cpu_set_t cs;
+      CPU_ZERO(&cs);
+      CPU_SET(cpu, &cs);
+      if (pthread_setaffinity_np(t.native_handle(), sizeof(cs), &cs) != 0) {
+        MATX_LOG_WARN("Failed to pin host worker thread to CPU {}", cpu);
+      }
+#endif
+    }
+
+    void WorkerLoop(int worker) {
+      uint64_t seen = 0;
+      while (true) {
+        int spins = 0;
+        while (generation_.load(std::memory_order_acquire) == seen && spins < SPIN_ITERATIONS) {
+          if (++spins % 64 == 0) {
+            std::this_thread::yield();
+          }
+        }
+
+        if (generation_.load(std::memory_order_acquire) == seen) {
+          std::unique_lock<std::mutex> lock(mtx_);
+          sleepers_.fetch_add(1);
+          cv_.wait(lock, [&]() { return generation_.load() != seen; });
+          sleepers_.fetch_sub(1);
+        }
+
+        seen = generation_.load(std::memory_order_acquire);
+        if (stop_.load()) {
+          return;
+        }
+
+        if (static_schedule_) {
+          const index_t num_workers = static_cast<index_t>(workers_.size());
+          const index_t begin = total_ * worker / num_workers;
+          const index_t end = total_ * (worker + 1) / num_workers;
+          if (begin < end) {
+            fn_(ctx_, begin, end);
+          }
+        }
+        else {
+          while (true) {
+            const index_t begin = next_.fetch_add(chunk_, std::memory_order_relaxed);
+            if (begin >= total_) {
+              break;
+            }
+
+            fn_(ctx_, begin, cuda::std::min(total_, begin + chunk_));
+          }
+        }
+
+        finished_.fetch_add(1, std::memory_order_release);
+      }
+    }
+
+    std::vector<std::thread> workers_;
+    bool static_schedule_ = false;
+    std::mutex dispatch_mtx_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::atomic<uint64_t> generation_{0};
+    std::atomic<int> sleepers_{0};
+    std::atomic<bool> stop_{false};
+    std::atomic<index_t> next_{0};
+    std::atomic<int> finished_{0};
+
+    void (*fn_)(const void *, index_t, index_t) = nullptr;
+    const void *ctx_ = nullptr;
+    index_t total_ = 0;
+    index_t chunk_ = 1;
+};
+
+} // namespace detail
+} // namespace matx
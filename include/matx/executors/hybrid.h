@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cuda_runtime.h>
+#include <utility>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/executors/cuda.h"
+#include "matx/executors/host.h"
+
+namespace matx
+{
+
+/**
+ * @brief Splits the batches of a workload between a CUDA executor and a host executor and runs both concurrently
+ *
+ * run() hands the first part of the batch range to the CUDA executor and the rest to the host executor through a
+ * user function that issues the work for one range on one executor. The function is usually a generic lambda
+ * slicing the outermost dimension of its inputs and outputs, so transforms with both host and device backends
+ * (fft, matmul, etc) can be run on either half:
+ *
+ * @code
+ * hybrid.run(batches, [&](index_t begin, index_t end, auto &exec) {
+ *   auto in_s = slice<2>(in, {begin, 0, 0}, {end, matxEnd, matxEnd});
+ *   auto out_s = slice<2>(out, {begin, 0, 0}, {end, matxEnd, matxEnd});
+ *   (out_s = fft(in_s)).run(exec);
+ * });
+ * @endcode
+ *
+ * The device part is issued first and runs asynchronously while the host part runs on the calling thread, then
+ * run() waits for both. Each side is timed and the fraction of batches given to the host is moved toward the
+ * measured ratio of host to total throughput, so the split adapts over repeated calls. Once the host share
+ * rounds to zero batches it is no longer measured, and the split stays on the device until set_host_fraction()
+ * is called.
+ *
+ * Every tensor touched by the function must be accessible from both the host and the device, for example
+ * MATX_MANAGED_MEMORY on a system with concurrent managed access or MATX_HOST_MEMORY.
+ *
+ * @tparam HostExec Host executor type
+ */
+template <typename HostExec = AllThreadsHostExecutor>
+class hybridBatchExecutor {
+  public:
+    /**
+     * @brief Construct a hybrid executor
+     *
+     * @param cuda_exec CUDA executor for the device part
+     * @param host_exec Host executor for the host part
+     * @param host_fraction Initial fraction of batches given to the host
+     */
+    hybridBatchExecutor(cudaExecutor cuda_exec = {}, HostExec host_exec = {}, double host_fraction = 0.1) :
+        cuda_exec_(std::move(cuda_exec)), host_exec_(std::move(host_exec)) {
+      set_host_fraction(host_fraction);
+      MATX_CUDA_CHECK(cudaEventCreate(&start_));
+      MATX_CUDA_CHECK(cudaEventCreate(&stop_));
+    }
+
+    ~hybridBatchExecutor() {
+      cudaEventDestroy(start_);
+      cudaEventDestroy(stop_);
+    }
+
+    hybridBatchExecutor(const hybridBatchExecutor &) = delete;
+    hybridBatchExecutor &operator=(const hybridBatchExecutor &) = delete;
+
+    /**
+     * @brief Run a batched workload split between the device and the host
+     *
+     * @param batches Number of batches
+     * @param f Callable invoked as ``f(begin, end, exec)`` for the batch range [begin, end) with either the CUDA
+     *   executor or the host executor. It is called at most once per executor
+     */
+    template <typename Func>
+    void run(index_t batches, Func &&f) {
+      MATX_ASSERT_STR(batches >= 0, matxInvalidSize, "Batch count must not be negative");
+
+      const index_t host_batches = std::min(batches,
+          static_cast<index_t>(std::floor(static_cast<double>(batches) * host_fraction_)));
+      const index_t device_batches = batches - host_batches;
+
+      if (device_batches > 0) {
+        MATX_CUDA_CHECK(cudaEventRecord(start_, cuda_exec_.getStream()));
+        f(index_t{0}, device_batches, cuda_exec_);
+        MATX_CUDA_CHECK(cudaEventRecord(stop_, cuda_exec_.getStream()));
+      }
+
+      double host_ms = 0.0;
+      if (host_batches > 0) {
+        const auto host_start = std::chrono::steady_clock::now();
+        f(device_batches, batches, host_exec_);
+        host_exec_.sync();
+        host_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - host_start).count();
+      }
+
+      float device_ms = 0.0f;
+      if (device_batches > 0) {
+        MATX_CUDA_CHECK(cudaEventSynchronize(stop_));
+        MATX_CUDA_CHECK(cudaEventElapsedTime(&device_ms, start_, stop_));
+      }
+
+      // Only a split where both sides did work says anything about their relative throughput
+      if (host_batches > 0 && device_batches > 0 && host_ms > 0.0 && device_ms > 0.0f) {
+        const double host_rate = static_cast<double>(host_batches) / host_ms;
+        const double device_rate = static_cast<double>(device_batches) / static_cast<double>(device_ms);
+        const double measured = host_rate / (host_rate + device_rate);
+        host_fraction_ = (1.0 - smoothing_) * host_fraction_ + smoothing_ * measured;
+        MATX_LOG_DEBUG("Hybrid split: host {} batches in {} ms, device {} batches in {} ms, host fraction now {}",
+                       host_batches, host_ms, device_batches, device_ms, host_fraction_);
+      }
+    }
+
+    /**
+     * @brief Fraction of batches the next run() gives to the host
+     */
+    double host_fraction() const { return host_fraction_; }
+
+    /**
+     * @brief Set the fraction of batches given to the host
+     *
+     * @param fraction Value in [0, 1]
+     */
+    void set_host_fraction(double fraction) {
+      MATX_ASSERT_STR(fraction >= 0.0 && fraction <= 1.0, matxInvalidParameter, "Host fraction must be in [0, 1]");
+      host_fraction_ = fraction;
+    }
+
+    /**
+     * @brief Weight given to each new measurement when updating the split
+     *
+     * 1 uses only the latest run, smaller values average over more runs.
+     *
+     * @param smoothing Value in (0, 1]
+     */
+    void set_smoothing(double smoothing) {
+      MATX_ASSERT_STR(smoothing > 0.0 && smoothing <= 1.0, matxInvalidParameter, "Smoothing must be in (0, 1]");
+      smoothing_ = smoothing;
+    }
+
+    /**
+     * @brief CUDA executor used for the device part
+     */
+    cudaExecutor &device_executor() { return cuda_exec_; }
+
+    /**
+     * @brief Host executor used for the host part
+     */
+    HostExec &host_executor() { return host_exec_; }
+
+  private:
+    cudaExecutor cuda_exec_;
+    HostExec host_exec_;
+    cudaEvent_t start_ = nullptr;
+    cudaEvent_t stop_ = nullptr;
+    double host_fraction_ = 0.1;
+    double smoothing_ = 0.5;
+};
+
+} // namespace matx
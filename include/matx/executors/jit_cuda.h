@@ -45,6 +45,13 @@
 #include <vector>
 #include <unordered_map>
 #include <mutex>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <thread>
 
 namespace matx
 {
@@ -88,6 +95,85 @@ namespace matx
     // Global cache for JIT launch parameters, keyed by operator type string from JIT_TYPE_QUERY
     static std::unordered_map<std::string, JITLaunchParams> jit_launch_params_cache;
     static std::mutex jit_launch_params_mutex;
+
+#ifdef MATX_EN_JIT
+    // Version of the on-disk launch parameter format. Bump when JITLaunchParams changes.
+    constexpr int JIT_LAUNCH_PARAMS_VERSION = 1;
+
+    inline std::string GetJITLaunchParamsFilename(const std::string &kernel_op_type) {
+      return GetCache().TypeStringToFilename(kernel_op_type + "|" + get_jit_cache_tag()) + ".params";
+    }
+
+    /**
+     * @brief Look up launch parameters for an operator type
+     *
+     * Checks the in-memory cache first, then the on-disk kernel cache. Parameters found on disk
+     * are promoted into the in-memory cache.
+     *
+     * @param kernel_op_type Operator type string from JIT_TYPE_QUERY
+     * @param params Filled in on a hit
+     * @return true if parameters were found
+     */
+    inline bool LookupJITLaunchParams(const std::string &kernel_op_type, JITLaunchParams &params) {
+      {
+        std::lock_guard<std::mutex> lock(jit_launch_params_mutex);
+        auto it = jit_launch_params_cache.find(kernel_op_type);
+        if (it != jit_launch_params_cache.end()) {
+          params = it->second;
+          return true;
+        }
+      }
+
+      const auto contents = GetCache().ReadKernelCacheFile(GetJITLaunchParamsFilename(kernel_op_type));
+      if (contents.empty()) {
+        return false;
+      }
+
+      std::istringstream in(contents);
+      int version, ept, stride, global_kernel, pass_through_threads;
+      in >> version >> ept >> params.shm_size >> params.block_size >> params.groups_per_block >> stride
+         >> params.blocks.x >> params.blocks.y >> params.blocks.z
+         >> params.threads.x >> params.threads.y >> params.threads.z
+         >> params.osize >> global_kernel >> pass_through_threads;
+      if (!in || version != JIT_LAUNCH_PARAMS_VERSION) {
+        MATX_LOG_DEBUG("Ignoring stale launch parameters on disk for: {}", kernel_op_type);
+        return false;
+      }
+
+      params.best_ept = static_cast<ElementsPerThread>(ept);
+      params.stride = stride != 0;
+      params.global_kernel = global_kernel != 0;
+      params.pass_through_threads = pass_through_threads != 0;
+      MATX_LOG_DEBUG("Loaded launch parameters from disk for: {}", kernel_op_type);
+
+      std::lock_guard<std::mutex> lock(jit_launch_params_mutex);
+      jit_launch_params_cache[kernel_op_type] = params;
+      return true;
+    }
+
+    /**
+     * @brief Store launch parameters for an operator type in memory and on disk
+     *
+     * @param kernel_op_type Operator type string from JIT_TYPE_QUERY
+     * @param params Parameters to store
+     */
+    inline void StoreJITLaunchParams(const std::string &kernel_op_type, const JITLaunchParams &params) {
+      {
+        std::lock_guard<std::mutex> lock(jit_launch_params_mutex);
+        jit_launch_params_cache[kernel_op_type] = params;
+      }
+
+      std::ostringstream out;
+      out << JIT_LAUNCH_PARAMS_VERSION << ' ' << static_cast<int>(params.best_ept) << ' ' << params.shm_size << ' '
+          << params.block_size << ' ' << params.groups_per_block << ' ' << static_cast<int>(params.stride) << ' '
+          << params.blocks.x << ' ' << params.blocks.y << ' ' << params.blocks.z << ' '
+          << params.threads.x << ' ' << params.threads.y << ' ' << params.threads.z << ' '
+          << params.osize << ' ' << static_cast<int>(params.global_kernel) << ' '
+          << static_cast<int>(params.pass_through_threads) << '\n';
+      const auto text = out.str();
+      GetCache().WriteKernelCacheFile(GetJITLaunchParamsFilename(kernel_op_type), text.data(), text.size());
+    }
+#endif
   }  // namespace detail
 
   /**
@@ -115,6 +201,15 @@ namespace matx
       CUDAJITExecutor(int stream, bool profiling = false) 
         : detail::CudaExecutorBase(stream, profiling) {}
 
+      /**
+       * @brief Construct a new CUDAJITExecutor that creates and owns a stream with the given priority and SM partition
+       *
+       * @param params Stream priority and SM partition
+       * @param profiling Whether to enable profiling
+       */
+      CUDAJITExecutor(const cudaExecutorParams &params, bool profiling = false)
+        : detail::CudaExecutorBase(params, profiling) {}
+
       /**
        * @brief Construct a new CUDAJITExecutor executor using the default stream
        * 
@@ -130,8 +225,109 @@ namespace matx
        **/
       template <typename Op>
         void Exec(const Op &op) const {
+          ExecImpl(op, true, fold_scalars_);
+        }
+
+      /**
+       * @brief Bake scalar constants in expressions into the generated kernels
+       *
+       * Sizes and strides of tensors are always compiled in as constants. With folding enabled, arithmetic
+       * scalars in an expression, such as the threshold and gain in where(x > 0.5f, x * 2.0f, 0.0f), are
+       * compiled in too instead of being passed as kernel parameters. The compiler can then simplify the
+       * arithmetic around them, but every distinct value compiles and caches its own kernel. Only enable this
+       * for expressions whose constants rarely change.
+       *
+       * @param enable True to fold scalars
+       */
+      void set_fold_scalars(bool enable) { fold_scalars_ = enable; }
+
+      /**
+       * @brief Check whether scalar constants are baked into the generated kernels
+       */
+      bool get_fold_scalars() const { return fold_scalars_; }
+
+      /**
+       * @brief Compile the kernels for a set of operators ahead of time
+       *
+       * Each operator is given exactly as it would be passed to run(), including its shapes, and is
+       * compiled on a background thread without being launched. Later calls to run() on an
+       * operator of the same type and shape find the kernel in the cache and skip NVRTC entirely.
+       * Operators are copied, so the caller does not need to keep them alive.
+       *
+       * @tparam Ops Operator types
+       * @param ops Operators to compile
+       * @return Future that becomes ready once every kernel is compiled. The first compilation
+       * error, if any, is rethrown from get().
+       */
+      template <typename... Ops>
+        std::shared_future<void> Precompile(const Ops &...ops) const {
+          std::vector<std::function<void()>> jobs;
+          jobs.reserve(sizeof...(Ops));
+          (jobs.emplace_back([op = ops, fold = fold_scalars_]() { ExecImpl(op, false, fold); }), ...);
+
+          int device;
+          MATX_CUDA_CHECK(cudaGetDevice(&device));
+
+          return std::async(std::launch::async, [jobs = std::move(jobs), device]() {
+            const size_t num_threads = std::max<size_t>(1,
+                std::min<size_t>(jobs.size(), std::thread::hardware_concurrency()));
+            std::atomic<size_t> next{0};
+            std::exception_ptr first_error;
+            std::mutex error_mtx;
+
+            auto record_error = [&]() {
+              std::lock_guard<std::mutex> lock(error_mtx);
+              if (!first_error) {
+                first_error = std::current_exception();
+              }
+            };
+
+            auto worker = [&]() {
+              try {
+                // Kernels are loaded into the context of the device that was current when
+                // Precompile was called
+                MATX_CUDA_CHECK(cudaSetDevice(device));
+              } catch (...) {
+                record_error();
+                return;
+              }
+
+              for (size_t i = next.fetch_add(1); i < jobs.size(); i = next.fetch_add(1)) {
+                try {
+                  jobs[i]();
+                } catch (...) {
+                  record_error();
+                }
+              }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for (size_t t = 0; t < num_threads; t++) {
+              threads.emplace_back(worker);
+            }
+            for (auto &t : threads) {
+              t.join();
+            }
+
+            if (first_error) {
+              std::rethrow_exception(first_error);
+            }
+          }).share();
+        }
+
+    private:
+      bool fold_scalars_ = false;
+
+      // Computes launch parameters and gets the compiled kernel for an operator. The kernel is only
+      // launched when launch is true, which lets Precompile share the same path as Exec.
+      template <typename Op>
+        static void ExecImpl(const Op &op, [[maybe_unused]] bool launch, [[maybe_unused]] bool fold_scalars) {
 #ifdef MATX_EN_JIT
 #ifdef __CUDACC__      
+          // Every type query below, including the kernel and launch parameter cache keys, sees the folded scalars
+          detail::JITFoldScalarsScope fold_scope{fold_scalars};
+
           dim3 threads = 1;
           dim3 blocks = 1;  
 
@@ -180,15 +376,7 @@ namespace matx
             
             // Check if we have cached launch parameters for this operator type
             detail::JITLaunchParams cached_params;
-            bool has_cached_params = false;
-            {
-              std::lock_guard<std::mutex> lock(detail::jit_launch_params_mutex);
-              auto it = detail::jit_launch_params_cache.find(kernel_op_type);
-              if (it != detail::jit_launch_params_cache.end()) {
-                cached_params = it->second;
-                has_cached_params = true;
-              }
-            }
+            bool has_cached_params = detail::LookupJITLaunchParams(kernel_op_type, cached_params);
 
             detail::ElementsPerThread best_ept;
             int shm_size, block_size, groups_per_block;
@@ -258,16 +446,18 @@ namespace matx
               params_to_cache.global_kernel = global_kernel;
               params_to_cache.pass_through_threads = pass_through_threads;
               
-              {
-                std::lock_guard<std::mutex> lock(detail::jit_launch_params_mutex);
-                detail::jit_launch_params_cache[kernel_op_type] = params_to_cache;
-              }
+              detail::StoreJITLaunchParams(kernel_op_type, params_to_cache);
             }
 
             MATX_LOG_DEBUG("Shm size {}, Stride {}, estimated EPT {}, blocks {}x{}x{} threads {}x{}x{}, pass_through_threads {}", 
                 shm_size, stride, static_cast<int>(best_ept), blocks.x, blocks.y, blocks.z, threads.x, threads.y, threads.z, pass_through_threads);
             const int osize = op.Rank() == 0 ? 1 : static_cast<int>(op.Size(op.Rank() - 1));
-            detail::nvrtc_compile_and_run("output.cu", op, sizes, blocks, threads, best_ept, stride, shm_size, osize, global_kernel, pass_through_threads);
+            if (launch) {
+              detail::OpProfiler::Get().SetLaunch(blocks, threads);
+              detail::nvrtc_compile_and_run("output.cu", op, sizes, blocks, threads, best_ept, stride, shm_size, osize, global_kernel, pass_through_threads);
+            } else {
+              detail::nvrtc_get_kernel(op, threads, best_ept, stride, osize, global_kernel, pass_through_threads);
+            }
           }
           else {
             // ND kernel support for ranks > 4 (JIT path)
@@ -276,15 +466,7 @@ namespace matx
             
             // Check if we have cached launch parameters for this operator type
             detail::JITLaunchParams cached_params;
-            bool has_cached_params = false;
-            {
-              std::lock_guard<std::mutex> lock(detail::jit_launch_params_mutex);
-              auto it = detail::jit_launch_params_cache.find(kernel_op_type);
-              if (it != detail::jit_launch_params_cache.end()) {
-                cached_params = it->second;
-                has_cached_params = true;
-              }
-            }
+            bool has_cached_params = detail::LookupJITLaunchParams(kernel_op_type, cached_params);
             
             detail::ElementsPerThread best_ept;
             bool stride;
@@ -317,10 +499,7 @@ namespace matx
               params_to_cache.osize = op.Rank() == 0 ? 1 : static_cast<int>(op.Size(op.Rank() - 1));
               params_to_cache.global_kernel = true;
               params_to_cache.pass_through_threads = pass_through_threads;
-              {
-                std::lock_guard<std::mutex> lock(detail::jit_launch_params_mutex);
-                detail::jit_launch_params_cache[kernel_op_type] = params_to_cache;
-              }
+              detail::StoreJITLaunchParams(kernel_op_type, params_to_cache);
             }
             
             MATX_LOG_DEBUG("Using ND kernel for rank > 4 with JIT and EPT {}", static_cast<int>(best_ept));            
@@ -331,7 +510,12 @@ namespace matx
                 stride, blocks.x, blocks.y, blocks.z, threads.x, threads.y, threads.z, dims);
             
             // Use ND kernel through JIT compilation
-            detail::nvrtc_compile_and_run("output.cu", op, sizes, blocks, threads, best_ept, stride, 0, osize, true);
+            if (launch) {
+              detail::OpProfiler::Get().SetLaunch(blocks, threads);
+              detail::nvrtc_compile_and_run("output.cu", op, sizes, blocks, threads, best_ept, stride, 0, osize, true);
+            } else {
+              detail::nvrtc_get_kernel(op, threads, best_ept, stride, osize, true);
+            }
           }
          
 #else
@@ -343,4 +527,20 @@ namespace matx
         }
   };
 
+#ifdef MATX_EN_JIT
+  /**
+   * @brief Drop every JIT kernel and launch parameter held in memory
+   *
+   * Kernels and launch parameters in the kernel cache directory are kept, so the next launch of each
+   * expression loads them from disk instead of compiling. To force a full recompile, also point
+   * MATX_CACHE_DIR at an empty directory. No JIT kernel may still be running.
+   */
+  inline void ClearJITMemoryCaches() {
+    detail::ClearJITKernelCache();
+    detail::GetCache().ClearLTOIRMemory();
+    std::lock_guard<std::mutex> lock(detail::jit_launch_params_mutex);
+    detail::jit_launch_params_cache.clear();
+  }
+#endif
+
 }; // namespace matx
@@ -41,6 +41,7 @@ namespace matx {\n\
   namespace detail {\n\
     template <class Op>\n\
     __global__ void matxOpT0KernelBlock(Op op) {\n\
+      JitAssumeAliasedPointers(op);\n\
       if constexpr (cuda::std::is_pointer_v<Op>) {\n\
         (*op).template operator()<CurrentCapabilities>();\n\
       } else {\n\
@@ -50,6 +51,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT1KernelBlock(Op op, matx::index_t size0) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;\n\
       if (idx * static_cast<index_t>(CurrentCapabilities::ept) < size0) {\n\
         if constexpr (cuda::std::is_pointer_v<Op>) {\n\
@@ -62,6 +64,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT2KernelBlock(Op op, matx::index_t size0, matx::index_t size1) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = threadIdx.x;\n\
       matx::index_t idy = static_cast<matx::index_t>(blockIdx.x)*blockDim.y + threadIdx.y;\n\
       if (idx * static_cast<matx::index_t>(CurrentCapabilities::ept) < size1 && idy < size0) {\n\
@@ -75,6 +78,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT2StrideKernelBlock(Op op, matx::index_t size0, matx::index_t size1) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = threadIdx.x;\n\
       for(matx::index_t idy = static_cast<matx::index_t>(blockIdx.x);\n\
         idy < size0;\n\
@@ -89,6 +93,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT3KernelBlock(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = threadIdx.x;\n\
       matx::index_t idy = static_cast<matx::index_t>(blockIdx.x) * blockDim.y + threadIdx.y;\n\
       matx::index_t idz = static_cast<matx::index_t>(blockIdx.y) * blockDim.z + threadIdx.z;\n\
@@ -103,6 +108,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT3StrideKernelBlock(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = threadIdx.x;\n\
       for(matx::index_t idz = static_cast<matx::index_t>(blockIdx.y) * blockDim.z + threadIdx.z;\n\
           idz < size0;\n\
@@ -123,6 +129,7 @@ namespace matx {\n\
     }\n\
     template <class Op>\n\
     __global__ void matxOpT4KernelBlock(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2, matx::index_t size3) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = threadIdx.x;\n\
       matx::index_t idy = blockIdx.x;\n\
       matx::index_t idz = blockIdx.y;\n\
@@ -138,6 +145,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT4StrideKernelBlock(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2, matx::index_t size3) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = threadIdx.x;\n\
       for(matx::index_t nmy = static_cast<matx::index_t>(blockIdx.x) * blockDim.y + threadIdx.y;\n\
           nmy < size1 * size2;\n\
@@ -162,6 +170,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT0Kernel(Op op) {\n\
+      JitAssumeAliasedPointers(op);\n\
       if constexpr (cuda::std::is_pointer_v<Op>) {\n\
         (*op).template operator()<CurrentCapabilities>();\n\
       }\n\
@@ -172,6 +181,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT1Kernel(Op op, matx::index_t size0) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = static_cast<matx::index_t>(blockIdx.x) * blockDim.x + threadIdx.x;\n\
       if (idx * static_cast<matx::index_t>(CurrentCapabilities::ept) < size0) {\n\
         if constexpr (cuda::std::is_pointer_v<Op>) {\n\
@@ -185,6 +195,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT2Kernel(Op op, matx::index_t size0, matx::index_t size1) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = static_cast<matx::index_t>(blockIdx.x) * blockDim.x + threadIdx.x;\n\
       matx::index_t idy = static_cast<matx::index_t>(blockIdx.y) * blockDim.y + threadIdx.y;\n\
       if (idx * static_cast<matx::index_t>(CurrentCapabilities::ept) < size1 && idy < size0) {\n\
@@ -199,6 +210,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT2StrideKernel(Op op, matx::index_t size0, matx::index_t size1) {\n\
+      JitAssumeAliasedPointers(op);\n\
       for(matx::index_t idy = static_cast<matx::index_t>(blockIdx.y) * blockDim.y + threadIdx.y;\n\
           idy < size0;\n\
           idy += blockDim.y * gridDim.y) {\n\
@@ -217,6 +229,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT3Kernel(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = static_cast<matx::index_t>(blockIdx.x) * blockDim.x + threadIdx.x;\n\
       matx::index_t idy = static_cast<matx::index_t>(blockIdx.y) * blockDim.y + threadIdx.y;\n\
       matx::index_t idz = static_cast<matx::index_t>(blockIdx.z) * blockDim.z + threadIdx.z;\n\
@@ -232,6 +245,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT3StrideKernel(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2) {\n\
+      JitAssumeAliasedPointers(op);\n\
       for(matx::index_t idz = static_cast<matx::index_t>(blockIdx.z) * blockDim.z + threadIdx.z;\n\
           idz < size0;\n\
           idz += blockDim.z * gridDim.z) {\n\
@@ -254,6 +268,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT4Kernel(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2, matx::index_t size3) {\n\
+      JitAssumeAliasedPointers(op);\n\
       matx::index_t idx = static_cast<matx::index_t>(blockIdx.x) * blockDim.x + threadIdx.x;\n\
       matx::index_t nmy = static_cast<matx::index_t>(blockIdx.y) * blockDim.y + threadIdx.y;\n\
       matx::index_t idy = nmy % size2;\n\
@@ -271,6 +286,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT4StrideKernel(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2, matx::index_t size3) {\n\
+      JitAssumeAliasedPointers(op);\n\
       for(matx::index_t nmy = static_cast<matx::index_t>(blockIdx.y) * blockDim.y + threadIdx.y;\n\
           nmy < size1 * size2;\n\
           nmy += blockDim.y * gridDim.y) {\n\
@@ -297,6 +313,7 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpTDKernel(Op op, const cuda::std::array<matx::index_t, Op::Rank()> sizes, matx::index_t mult) {\n\
+      JitAssumeAliasedPointers(op);\n\
       cuda::std::array<matx::index_t, Op::Rank()> indices;\n\
       static_assert(Op::Rank() >= 1, \"rank must exceed zero\");\n\
       matx::index_t x_abs = static_cast<matx::index_t>(blockIdx.x) * blockDim.x + threadIdx.x;\n\
@@ -324,40 +341,53 @@ namespace matx {\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT2KernelBlock2D(Op op, matx::index_t size0, matx::index_t size1) {\n\
-      int tid = threadIdx.x + threadIdx.y * blockDim.x + threadIdx.z * blockDim.x * blockDim.y;\n\
-      matx::index_t idx = tid % size1;\n\
-      matx::index_t idy = tid / size1;\n\
-      if constexpr (cuda::std::is_pointer_v<Op>) {\n\
-        (*op).template operator()<CurrentCapabilities>(idy, idx);\n\
-      } else {\n\
-        op.template operator()<CurrentCapabilities>(idy, idx);\n\
+      JitAssumeAliasedPointers(op);\n\
+      const int tid = threadIdx.x + threadIdx.y * blockDim.x + threadIdx.z * blockDim.x * blockDim.y;\n\
+      const int nthreads = blockDim.x * blockDim.y * blockDim.z;\n\
+      /* Every thread makes the same number of passes so block-level operators can synchronize */\n\
+      for (matx::index_t base = 0; base < size0 * size1; base += nthreads) {\n\
+        matx::index_t idx = (base + tid) % size1;\n\
+        matx::index_t idy = (base + tid) / size1;\n\
+        if constexpr (cuda::std::is_pointer_v<Op>) {\n\
+          (*op).template operator()<CurrentCapabilities>(idy, idx);\n\
+        } else {\n\
+          op.template operator()<CurrentCapabilities>(idy, idx);\n\
+        }\n\
       }\n\
     }\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT3KernelBlock2D(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2) {\n\
-      int tid = threadIdx.x + threadIdx.y * blockDim.x + threadIdx.z * blockDim.x * blockDim.y;\n\
-      matx::index_t idx = tid % size2;\n\
-      matx::index_t idy = tid / size2;\n\
+      JitAssumeAliasedPointers(op);\n\
+      const int tid = threadIdx.x + threadIdx.y * blockDim.x + threadIdx.z * blockDim.x * blockDim.y;\n\
+      const int nthreads = blockDim.x * blockDim.y * blockDim.z;\n\
       matx::index_t idz = blockIdx.x;\n\
-      if constexpr (cuda::std::is_pointer_v<Op>) {\n\
-        (*op).template operator()<CurrentCapabilities>(idz, idy, idx);\n\
-      } else {\n\
-        op.template operator()<CurrentCapabilities>(idz, idy, idx);\n\
+      for (matx::index_t base = 0; base < size1 * size2; base += nthreads) {\n\
+        matx::index_t idx = (base + tid) % size2;\n\
+        matx::index_t idy = (base + tid) / size2;\n\
+        if constexpr (cuda::std::is_pointer_v<Op>) {\n\
+          (*op).template operator()<CurrentCapabilities>(idz, idy, idx);\n\
+        } else {\n\
+          op.template operator()<CurrentCapabilities>(idz, idy, idx);\n\
+        }\n\
       }\n\
     }\n\
     \n\
     template <class Op>\n\
     __global__ void matxOpT4KernelBlock2D(Op op, matx::index_t size0, matx::index_t size1, matx::index_t size2, matx::index_t size3) {\n\
-      int tid = threadIdx.x + threadIdx.y * blockDim.x + threadIdx.z * blockDim.x * blockDim.y;\n\
-      matx::index_t idx = tid % size3;\n\
-      matx::index_t idy = tid / size3;\n\
+      JitAssumeAliasedPointers(op);\n\
+      const int tid = threadIdx.x + threadIdx.y * blockDim.x + threadIdx.z * blockDim.x * blockDim.y;\n\
+      const int nthreads = blockDim.x * blockDim.y * blockDim.z;\n\
       matx::index_t idz = blockIdx.x;\n\
       matx::index_t idw = blockIdx.y;\n\
-      if constexpr (cuda::std::is_pointer_v<Op>) {\n\
-        (*op).template operator()<CurrentCapabilities>(idw, idz, idy, idx);\n\
-      } else {\n\
-        op.template operator()<CurrentCapabilities>(idw, idz, idy, idx);\n\
+      for (matx::index_t base = 0; base < size2 * size3; base += nthreads) {\n\
+        matx::index_t idx = (base + tid) % size3;\n\
+        matx::index_t idy = (base + tid) / size3;\n\
+        if constexpr (cuda::std::is_pointer_v<Op>) {\n\
+          (*op).template operator()<CurrentCapabilities>(idw, idz, idy, idx);\n\
+        } else {\n\
+          op.template operator()<CurrentCapabilities>(idw, idz, idy, idx);\n\
+        }\n\
       }\n\
     }\n\
   }\n\
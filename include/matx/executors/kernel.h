@@ -31,6 +31,8 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #pragma once
+#include <cuda/std/array>
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 
 namespace matx {
@@ -49,9 +51,10 @@ __global__ void matxOpT0Kernel(Op op) {
 }
 
 template <typename CapType, class Op>
-__global__ void matxOpT1Kernel(Op op, index_t size0) {
-  index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
-  if (idx * static_cast<index_t>(CapType::ept) < size0) {
+__global__ void matxOpT1Kernel(Op op, typename CapType::index_type size0) {
+  using IdxT = typename CapType::index_type;
+  IdxT idx = static_cast<IdxT>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx * static_cast<IdxT>(CapType::ept) < size0) {
     if constexpr (cuda::std::is_pointer_v<Op>) {
       (*op).template operator()<CapType>(idx); 
     }
@@ -61,12 +64,27 @@ __global__ void matxOpT1Kernel(Op op, index_t size0) {
   }
 }
 
+template <typename CapType, class Op>
+__global__ void matxOpT1StrideKernel(Op op, typename CapType::index_type size0) {
+  using IdxT = typename CapType::index_type;
+  for(IdxT idx = static_cast<IdxT>(blockIdx.x) * blockDim.x + threadIdx.x;
+      idx * static_cast<IdxT>(CapType::ept) < size0;
+      idx += static_cast<IdxT>(blockDim.x) * gridDim.x) {
+    if constexpr (cuda::std::is_pointer_v<Op>) {
+      (*op).template operator()<CapType>(idx); 
+    }
+    else {
+      op.template operator()<CapType>(idx);
+    }
+  }
+}
 
 template <typename CapType, class Op>
-__global__ void matxOpT2Kernel(Op op, index_t size0, index_t size1) {
-  index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
-  index_t idy = static_cast<index_t>(blockIdx.y) * blockDim.y + threadIdx.y;
-  if (idx * static_cast<index_t>(CapType::ept) < size1 && idy < size0) {
+__global__ void matxOpT2Kernel(Op op, typename CapType::index_type size0, typename CapType::index_type size1) {
+  using IdxT = typename CapType::index_type;
+  IdxT idx = static_cast<IdxT>(blockIdx.x) * blockDim.x + threadIdx.x;
+  IdxT idy = static_cast<IdxT>(blockIdx.y) * blockDim.y + threadIdx.y;
+  if (idx * static_cast<IdxT>(CapType::ept) < size1 && idy < size0) {
     if constexpr (cuda::std::is_pointer_v<Op>) {
       (*op).template operator()<CapType>(idy, idx); 
     }
@@ -77,13 +95,14 @@ __global__ void matxOpT2Kernel(Op op, index_t size0, index_t size1) {
 }
 
 template <typename CapType, class Op>
-__global__ void matxOpT2StrideKernel(Op op, index_t size0, index_t size1) {
+__global__ void matxOpT2StrideKernel(Op op, typename CapType::index_type size0, typename CapType::index_type size1) {
+  using IdxT = typename CapType::index_type;
 
-  for(index_t idy = static_cast<index_t>(blockIdx.y) * blockDim.y + threadIdx.y;
+  for(IdxT idy = static_cast<IdxT>(blockIdx.y) * blockDim.y + threadIdx.y;
       idy < size0;
       idy += blockDim.y * gridDim.y) {
-    for(index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
-        idx * static_cast<index_t>(CapType::ept) < size1;
+    for(IdxT idx = static_cast<IdxT>(blockIdx.x) * blockDim.x + threadIdx.x;
+        idx * static_cast<IdxT>(CapType::ept) < size1;
         idx += blockDim.x * gridDim.x) {
       if constexpr (cuda::std::is_pointer_v<Op>) {
         (*op).template operator()<CapType>(idy, idx); 
@@ -96,11 +115,12 @@ __global__ void matxOpT2StrideKernel(Op op, index_t size0, index_t size1) {
 }
 
 template <typename CapType, class Op>
-__global__ void matxOpT3Kernel(Op op, index_t size0, index_t size1, index_t size2) {
-  index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
-  index_t idy = static_cast<index_t>(blockIdx.y) * blockDim.y + threadIdx.y;
-  index_t idz = static_cast<index_t>(blockIdx.z) * blockDim.z + threadIdx.z;
-  if (idx * static_cast<index_t>(CapType::ept) < size2 && idy < size1 && idz < size0) {
+__global__ void matxOpT3Kernel(Op op, typename CapType::index_type size0, typename CapType::index_type size1, typename CapType::index_type size2) {
+  using IdxT = typename CapType::index_type;
+  IdxT idx = static_cast<IdxT>(blockIdx.x) * blockDim.x + threadIdx.x;
+  IdxT idy = static_cast<IdxT>(blockIdx.y) * blockDim.y + threadIdx.y;
+  IdxT idz = static_cast<IdxT>(blockIdx.z) * blockDim.z + threadIdx.z;
+  if (idx * static_cast<IdxT>(CapType::ept) < size2 && idy < size1 && idz < size0) {
     if constexpr (cuda::std::is_pointer_v<Op>) {
       (*op).template operator()<CapType>(idz, idy, idx); 
     }
@@ -111,16 +131,17 @@ __global__ void matxOpT3Kernel(Op op, index_t size0, index_t size1, index_t size
 }
 
 template <typename CapType, class Op>
-__global__ void matxOpT3StrideKernel(Op op, index_t size0, index_t size1, index_t size2) {
+__global__ void matxOpT3StrideKernel(Op op, typename CapType::index_type size0, typename CapType::index_type size1, typename CapType::index_type size2) {
+  using IdxT = typename CapType::index_type;
 
-  for(index_t idz = static_cast<index_t>(blockIdx.z) * blockDim.z + threadIdx.z;
+  for(IdxT idz = static_cast<IdxT>(blockIdx.z) * blockDim.z + threadIdx.z;
       idz < size0;
       idz += blockDim.z * gridDim.z) {
-    for (index_t idy = static_cast<index_t>(blockIdx.y) * blockDim.y + threadIdx.y;
+    for (IdxT idy = static_cast<IdxT>(blockIdx.y) * blockDim.y + threadIdx.y;
         idy < size1;
         idy += blockDim.y * gridDim.y) {
-      for(index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
-          idx * static_cast<index_t>(CapType::ept) < size2;
+      for(IdxT idx = static_cast<IdxT>(blockIdx.x) * blockDim.x + threadIdx.x;
+          idx * static_cast<IdxT>(CapType::ept) < size2;
           idx += blockDim.x * gridDim.x) {
         if constexpr (cuda::std::is_pointer_v<Op>) {
           (*op).template operator()<CapType>(idz, idy, idx); 
@@ -134,13 +155,14 @@ __global__ void matxOpT3StrideKernel(Op op, index_t size0, index_t size1, index_
 }
 
 template <typename CapType, class Op>
-__global__ void matxOpT4Kernel(Op op, index_t size0, index_t size1, index_t size2, index_t size3) {
-  index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
-  index_t nmy = static_cast<index_t>(blockIdx.y) * blockDim.y + threadIdx.y;
-  index_t idy = nmy % size2;
-  index_t idz = nmy / size2;
-  index_t idw = static_cast<index_t>(blockIdx.z) * blockDim.z + threadIdx.z;
-  if (idx * static_cast<index_t>(CapType::ept) < size3 && idy < size2 && idz < size1 && idw < size0) {
+__global__ void matxOpT4Kernel(Op op, typename CapType::index_type size0, typename CapType::index_type size1, typename CapType::index_type size2, typename CapType::index_type size3) {
+  using IdxT = typename CapType::index_type;
+  IdxT idx = static_cast<IdxT>(blockIdx.x) * blockDim.x + threadIdx.x;
+  IdxT nmy = static_cast<IdxT>(blockIdx.y) * blockDim.y + threadIdx.y;
+  IdxT idy = nmy % size2;
+  IdxT idz = nmy / size2;
+  IdxT idw = static_cast<IdxT>(blockIdx.z) * blockDim.z + threadIdx.z;
+  if (idx * static_cast<IdxT>(CapType::ept) < size3 && idy < size2 && idz < size1 && idw < size0) {
     if constexpr (cuda::std::is_pointer_v<Op>) {
       (*op).template operator()<CapType>(idw, idz, idy, idx); 
     }
@@ -151,19 +173,20 @@ __global__ void matxOpT4Kernel(Op op, index_t size0, index_t size1, index_t size
 }
 
 template <typename CapType, class Op>
-__global__ void matxOpT4StrideKernel(Op op, index_t size0, index_t size1, index_t size2, index_t size3) {
+__global__ void matxOpT4StrideKernel(Op op, typename CapType::index_type size0, typename CapType::index_type size1, typename CapType::index_type size2, typename CapType::index_type size3) {
+  using IdxT = typename CapType::index_type;
 
-  for(index_t nmy = static_cast<index_t>(blockIdx.y) * blockDim.y + threadIdx.y;
+  for(IdxT nmy = static_cast<IdxT>(blockIdx.y) * blockDim.y + threadIdx.y;
       nmy < size1 * size2;
       nmy += blockDim.y * gridDim.y) {
-    index_t idy = nmy % size2;
-    index_t idz = nmy / size2;
+    IdxT idy = nmy % size2;
+    IdxT idz = nmy / size2;
     if(idy < size2 && idz < size1) {
-      for(index_t idw = static_cast<index_t>(blockIdx.z) * blockDim.z + threadIdx.z;
+      for(IdxT idw = static_cast<IdxT>(blockIdx.z) * blockDim.z + threadIdx.z;
           idw < size0;
           idw += blockDim.z * gridDim.z) {
-        for(index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
-            idx * static_cast<index_t>(CapType::ept) < size3;
+        for(IdxT idx = static_cast<IdxT>(blockIdx.x) * blockDim.x + threadIdx.x;
+            idx * static_cast<IdxT>(CapType::ept) < size3;
             idx += blockDim.x * gridDim.x) {
 
           if constexpr (cuda::std::is_pointer_v<Op>) {
@@ -178,6 +201,78 @@ __global__ void matxOpT4StrideKernel(Op op, index_t size0, index_t size1, index_
   }
 }
 
+/**
+ * @brief Launch an operator whose shape is known at compile time
+ *
+ * The grid is flattened into one dimension and the coordinates are recovered with divisions by
+ * compile-time constants, which the compiler turns into multiplies and shifts. When the shape fits in
+ * 32 bits the index math is done in 32 bits as well.
+ *
+ * @tparam CapType Capability parameters
+ * @tparam Desc Static descriptor of the operator's shape
+ * @tparam Op operator type
+ * @param op operator
+ */
+/**
+ * @brief Extents of the iteration space of a static-shape launch
+ *
+ * @tparam Desc Static descriptor of the operator's shape
+ * @tparam RANK Rank of the operator
+ * @tparam EPT Elements per thread
+ */
+template <typename Desc, int RANK, index_t EPT>
+constexpr __MATX_HOST__ __MATX_DEVICE__ cuda::std::array<index_t, RANK> static_grid_extents() {
+  // The innermost dimension covers EPT elements per thread
+  cuda::std::array<index_t, RANK> e{};
+  for (int i = 0; i < RANK; i++) {
+    e[i] = Desc::Size(i);
+  }
+  e[RANK - 1] = (e[RANK - 1] + EPT - 1) / EPT;
+  return e;
+}
+
+template <typename Desc, int RANK, index_t EPT>
+constexpr __MATX_HOST__ __MATX_DEVICE__ cuda::std::array<index_t, RANK> static_grid_divisors() {
+  const auto e = static_grid_extents<Desc, RANK, EPT>();
+  cuda::std::array<index_t, RANK> d{};
+  d[RANK - 1] = 1;
+  for (int i = RANK - 2; i >= 0; i--) {
+    d[i] = d[i + 1] * e[i + 1];
+  }
+  return d;
+}
+
+/**
+ * @brief Launch an operator whose shape is known at compile time
+ *
+ * The grid is flattened into one dimension and the coordinates are recovered with divisions by
+ * compile-time constants, which the compiler turns into multiplies and shifts. When the shape fits in
+ * 32 bits the index math is done in 32 bits as well.
+ *
+ * @tparam CapType Capability parameters
+ * @tparam Desc Static descriptor of the operator's shape
+ * @tparam Op operator type
+ * @param op operator
+ */
+template <typename CapType, typename Desc, class Op>
+__global__ void matxOpTStaticKernel(Op op) {
+  constexpr int RANK = Op::Rank();
+  constexpr index_t ept = static_cast<index_t>(CapType::ept);
+  constexpr auto extents = static_grid_extents<Desc, RANK, ept>();
+  constexpr auto divisors = static_grid_divisors<Desc, RANK, ept>();
+  constexpr index_t total = divisors[0] * extents[0];
+  using idx_t = cuda::std::conditional_t<(total <= cuda::std::numeric_limits<int32_t>::max()), uint32_t, index_t>;
+
+  for (idx_t abs = static_cast<idx_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+       abs < static_cast<idx_t>(total);
+       abs += static_cast<idx_t>(blockDim.x) * gridDim.x) {
+    [&]<size_t... I>(cuda::std::index_sequence<I...>) {
+      op.template operator()<CapType>(
+        static_cast<index_t>((abs / static_cast<idx_t>(divisors[I])) % static_cast<idx_t>(extents[I]))...);
+    }(cuda::std::make_index_sequence<RANK>{});
+  }
+}
+
 /**
  * @brief Launch an operator with rank N
  *
@@ -221,6 +316,68 @@ __global__ void matxOpTDKernel(Op op, const cuda::std::array<index_t, Op::Rank()
     }
   }
 }
+
+/**
+ * @brief Launch an operator whose first dimension is bounded by a count held on the device
+ *
+ * The grid is sized for the full shape of the operator, but the grid-stride loop stops at the count read
+ * from device memory times the product of the other dimensions. Threads past the count exit without
+ * evaluating the operator, so no host synchronization is needed to learn the valid extent.
+ *
+ * @tparam CapType Capability parameters
+ * @tparam Op operator type
+ * @tparam CountT Type of the count
+ * @param op operator
+ * @param sizes Worst-case sizes of each dimension
+ * @param inner Product of sizes of all but first dimension
+ * @param count Number of valid entries in the first dimension
+ */
+template <typename CapType, class Op, typename CountT>
+__global__ void matxOpTDynamicKernel(Op op, const cuda::std::array<index_t, Op::Rank()> sizes, index_t inner, const CountT *count) {
+  static_assert(Op::Rank() >= 1, "rank must exceed zero");
+
+  const index_t rows = cuda::std::min(cuda::std::max(static_cast<index_t>(*count), static_cast<index_t>(0)), sizes[0]);
+  const index_t total = rows * inner;
+
+  for (index_t abs = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+       abs < total;
+       abs += static_cast<index_t>(gridDim.x) * blockDim.x) {
+    cuda::std::array<index_t, Op::Rank()> indices;
+    index_t rem = abs;
+    MATX_LOOP_UNROLL
+    for (int r = Op::Rank() - 1; r > 0; r--) {
+      indices[r] = rem % sizes[r];
+      rem /= sizes[r];
+    }
+    indices[0] = rem;
+
+    cuda::std::apply([&](auto... args){
+      op.template operator()<CapType>(args...);
+    }, indices);
+  }
+}
+
+#if CUDART_VERSION >= 12040
+/**
+ * @brief Evaluate the condition of a device-side while loop and set the graph's conditional handle
+ *
+ * Runs as a single thread before the first iteration (reset) and at the end of every iteration body.
+ * The loop continues only while the condition holds and fewer than max_iters iterations have run.
+ *
+ * @tparam Op Rank-0 condition operator type
+ * @param cond Condition operator
+ * @param handle Conditional handle of the while node
+ * @param iter Device counter of completed iterations
+ * @param max_iters Maximum number of iterations
+ * @param reset Whether this is the evaluation before the first iteration
+ */
+template <class Op>
+__global__ void matxDeviceWhileCondKernel(Op cond, cudaGraphConditionalHandle handle, int *iter, int max_iters, bool reset) {
+  const int i = reset ? 0 : *iter + 1;
+  *iter = i;
+  cudaGraphSetConditional(handle, (i < max_iters && static_cast<bool>(cond())) ? 1u : 0u);
+}
+#endif
 #endif
 
 constexpr int CUDA_MAX_VAL_PARAM = 32764; ///< Parameter size limit for single kernel
@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <utility>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/sharded_tensor.h"
+#include "matx/executors/cuda.h"
+
+namespace matx
+{
+
+/**
+ * @brief Splits the batches of a workload across several GPUs and runs every part concurrently
+ *
+ * run() divides the batch range into one contiguous range per device, as evenly as possible with the first devices
+ * taking one extra batch, and calls a user function that issues the work for one range on that device's executor.
+ * The device is made current for each call, so tensors allocated inside the function land on it, and transforms
+ * build their plans in that device's plan cache. The function is usually a generic lambda slicing the outermost
+ * dimension of its inputs and outputs:
+ *
+ * @code
+ * multi.run(batches, [&](index_t begin, index_t end, auto &exec) {
+ *   auto in_s = multi.stage(slice<2>(in, {begin, 0}, {end, matxEnd}), exec);
+ *   auto out_s = slice<2>(out, {begin, 0}, {end, matxEnd});
+ *   (out_s = fft(in_s)).run(exec);
+ * });
+ * @endcode
+ *
+ * Every part is issued before any is waited on, so all devices run at once, and run() returns after all of them
+ * finish. Peer access is enabled between every pair of devices that supports it when the executor is constructed.
+ *
+ * Outputs written from several devices must be in managed memory or be separate per-device tensors. Work that
+ * produced the inputs on other streams must be complete before run() is called.
+ */
+class multiGpuExecutor {
+  public:
+    /**
+     * @brief Construct an executor over a list of devices
+     *
+     * Each device gets its own non-blocking stream.
+     *
+     * @param devices CUDA devices, one batch range each, in batch order
+     */
+    explicit multiGpuExecutor(const std::vector<int> &devices) : devices_(devices), streams_(devices) {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      MATX_ASSERT_STR(!devices.empty(), matxInvalidParameter, "Multi-GPU executor needs at least one device");
+
+      int count = 0;
+      MATX_CUDA_CHECK(cudaGetDeviceCount(&count));
+      num_ordinals_ = count;
+      peer_.assign(static_cast<size_t>(count) * static_cast<size_t>(count), false);
+      for (const int dev : devices_) {
+        MATX_ASSERT_STR(dev >= 0 && dev < count, matxInvalidParameter, "Invalid device in multi-GPU executor");
+        peer_[static_cast<size_t>(dev) * count + dev] = true;
+      }
+
+      for (const int dev : devices_) {
+        detail::ShardDeviceGuard guard(dev);
+        for (const int src : devices_) {
+          if (src == dev) {
+            continue;
+          }
+
+          int can_access = 0;
+          MATX_CUDA_CHECK(cudaDeviceCanAccessPeer(&can_access, dev, src));
+          if (can_access == 0) {
+            continue;
+          }
+
+          const auto err = cudaDeviceEnablePeerAccess(src, 0);
+          if (err == cudaErrorPeerAccessAlreadyEnabled) {
+            cudaGetLastError(); // Clear the sticky error left by the call
+          }
+          else {
+            MATX_CUDA_CHECK(err);
+          }
+          peer_[static_cast<size_t>(dev) * count + src] = true;
+        }
+      }
+
+      MATX_LOG_DEBUG("Multi-GPU executor over {} devices", devices_.size());
+    }
+
+    multiGpuExecutor(const multiGpuExecutor &) = delete;
+    multiGpuExecutor &operator=(const multiGpuExecutor &) = delete;
+
+    /**
+     * @brief Run a batched workload split across the devices
+     *
+     * @param batches Number of batches
+     * @param f Callable invoked as ``f(begin, end, exec)`` for the batch range [begin, end) with the device owning
+     *   the range current and ``exec`` the executor on its stream. It is called once for every device with a non-empty
+     *   range
+     */
+    template <typename Func>
+    void run(index_t batches, Func &&f) {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      MATX_ASSERT_STR(batches >= 0, matxInvalidSize, "Batch count must not be negative");
+
+      const auto n = static_cast<index_t>(devices_.size());
+      index_t begin = 0;
+      for (index_t d = 0; d < n && begin < batches; d++) {
+        const index_t end = begin + batches / n + (d < batches % n ? 1 : 0);
+        detail::ShardDeviceGuard guard(devices_[d]);
+        f(begin, end, streams_.Executor(static_cast<int>(d)));
+        begin = end;
+      }
+
+      sync();
+    }
+
+    /**
+     * @brief Make a contiguous tensor readable by the current device
+     *
+     * Called from the run() function, where the current device is the one owning the batch range. Tensors already in
+     * that device's memory, in the memory of a device with peer access to it, or in managed memory
+     * are returned as a view without copying. Anything else, such as host memory or device memory without a peer
+     * path, is copied into a new tensor on the device on the executor's stream. The copy is freed in stream order
+     * when the returned tensor is destroyed, so it can go out of scope before the work using it finishes.
+     *
+     * @param t Contiguous tensor, usually a batch range slice of a larger tensor
+     * @param exec Executor passed to the run() function
+     * @returns Tensor on or readable from the current device
+     */
+    template <typename TensorType>
+    auto stage(const TensorType &t, const cudaExecutor &exec) const {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      static_assert(is_tensor_view_v<TensorType>, "Only tensors can be staged to a device");
+      using T = typename TensorType::value_type;
+      constexpr int RANK = TensorType::Rank();
+      MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter, "Staged tensors must be contiguous");
+
+      cuda::std::array<index_t, RANK> shape;
+      for (int r = 0; r < RANK; r++) {
+        shape[r] = t.Size(r);
+      }
+
+      T *src = const_cast<T *>(t.Data());
+      if (Readable(src)) {
+        return make_tensor<T>(src, shape);
+      }
+
+      auto local = make_tensor<T>(shape, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+      MATX_CUDA_CHECK(cudaMemcpyAsync(local.Data(), src, static_cast<size_t>(TotalSize(t)) * sizeof(T),
+                                      cudaMemcpyDefault, exec.getStream()));
+      return local;
+    }
+
+    /**
+     * @brief Wait for the work on every device's stream
+     */
+    void sync() {
+      for (size_t d = 0; d < devices_.size(); d++) {
+        detail::ShardDeviceGuard guard(devices_[d]);
+        streams_.Executor(static_cast<int>(d)).sync();
+      }
+    }
+
+    /**
+     * @brief Number of devices
+     */
+    int num_devices() const { return static_cast<int>(devices_.size()); }
+
+    /**
+     * @brief CUDA device of the d-th batch range
+     */
+    int device(int d) const { return devices_[d]; }
+
+    /**
+     * @brief Executor on the stream of the d-th device
+     */
+    cudaExecutor &executor(int d) { return streams_.Executor(d); }
+
+  private:
+    bool Readable(void *ptr) const {
+      cudaPointerAttributes attr;
+      MATX_CUDA_CHECK(cudaPointerGetAttributes(&attr, ptr));
+      if (attr.type == cudaMemoryTypeManaged) {
+        return true;
+      }
+      if (attr.type != cudaMemoryTypeDevice || attr.device < 0 || attr.device >= num_ordinals_) {
+        return false;
+      }
+
+      int dev;
+      MATX_CUDA_CHECK(cudaGetDevice(&dev));
+      return peer_[static_cast<size_t>(dev) * num_ordinals_ + attr.device];
+    }
+
+    std::vector<int> devices_;
+    detail::ShardStreams streams_;
+    std::vector<bool> peer_;
+    int num_ordinals_ = 0;
+};
+
+} // namespace matx
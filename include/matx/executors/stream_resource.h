@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <string>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+
+// Macro for checking CUDA driver API calls
+#define MATX_CU_CHECK(call)                                                     \
+  do {                                                                          \
+    const CUresult res_ = (call);                                               \
+    if (res_ != CUDA_SUCCESS) {                                                 \
+      const char *err_str_ = nullptr;                                           \
+      cuGetErrorString(res_, &err_str_);                                        \
+      MATX_THROW(matx::matxCudaError, err_str_ ? err_str_ : "CUDA driver error"); \
+    }                                                                           \
+  } while (0)
+
+namespace matx
+{
+
+/**
+ * @brief Parameters for a cudaExecutor that creates and owns its own stream
+ *
+ * ``priority`` uses CUDA's convention where lower numbers are more urgent, and is clamped to the range the
+ * device supports (see cudaDeviceGetStreamPriorityRange). Pending blocks of kernels on a higher priority stream
+ * are scheduled before those of lower priority streams, but running blocks are not preempted.
+ *
+ * A positive ``sm_count`` places the stream in a CUDA green context limited to that many SMs, rounded up to the
+ * device's partition granularity. Green contexts only restrict the work issued to them, so to keep bulk work off
+ * a latency-critical partition, run the bulk work on an executor created with the same ``sm_count`` and
+ * ``remaining`` set, which gets the SMs not given to the partition. Green contexts require CUDA 12.5 or newer.
+ */
+struct cudaExecutorParams {
+  int priority = 0;        ///< Stream priority. Lower numbers are higher priority
+  int sm_count = 0;        ///< SMs in the partition, or 0 for the whole device
+  bool remaining = false;  ///< Use the SMs left over after splitting off sm_count instead of the partition itself
+};
+
+namespace detail {
+
+/**
+ * Stream, and optionally green context, owned by an executor. Shared between copies of the executor and
+ * destroyed with the last one.
+ */
+struct ExecutorStreamResource {
+  explicit ExecutorStreamResource(const cudaExecutorParams &params) {
+    int least = 0;
+    int greatest = 0;
+    MATX_CUDA_CHECK(cudaDeviceGetStreamPriorityRange(&least, &greatest));
+    priority = std::clamp(params.priority, greatest, least);
+
+    if (params.sm_count <= 0) {
+      MATX_ASSERT_STR(!params.remaining, matxInvalidParameter, "remaining requires a positive sm_count");
+      MATX_CUDA_CHECK(cudaStreamCreateWithPriority(&stream, cudaStreamNonBlocking, priority));
+      return;
+    }
+
+#if CUDA_VERSION >= 12050
+    int dev;
+    MATX_CUDA_CHECK(cudaGetDevice(&dev));
+    MATX_CUDA_CHECK(cudaFree(nullptr)); // Initialize the driver and primary context
+    CUdevice cu_dev;
+    MATX_CU_CHECK(cuDeviceGet(&cu_dev, dev));
+
+    CUdevResource device_sms;
+    MATX_CU_CHECK(cuDeviceGetDevResource(cu_dev, &device_sms, CU_DEV_RESOURCE_TYPE_SM));
+    MATX_ASSERT_STR(static_cast<unsigned int>(params.sm_count) < device_sms.sm.smCount, matxInvalidParameter,
+        "SM partition must be smaller than the device (" + std::to_string(device_sms.sm.smCount) + " SMs)");
+
+    CUdevResource partition;
+    CUdevResource rest;
+    unsigned int groups = 1;
+    MATX_CU_CHECK(cuDevSmResourceSplitByCount(&partition, &groups, &device_sms, &rest, 0,
+        static_cast<unsigned int>(params.sm_count)));
+    const CUdevResource &used = params.remaining ? rest : partition;
+    MATX_ASSERT_STR(used.sm.smCount > 0, matxInvalidParameter, "No SMs remain after splitting off the partition");
+
+    CUdevResourceDesc desc;
+    MATX_CU_CHECK(cuDevResourceGenerateDesc(&desc, const_cast<CUdevResource *>(&used), 1));
+    MATX_CU_CHECK(cuGreenCtxCreate(&green_ctx, desc, cu_dev, CU_GREEN_CTX_DEFAULT_STREAM));
+
+    CUstream cu_stream;
+    const auto res = cuGreenCtxStreamCreate(&cu_stream, green_ctx, CU_STREAM_NON_BLOCKING, priority);
+    if (res != CUDA_SUCCESS) {
+      cuGreenCtxDestroy(green_ctx);
+      MATX_CU_CHECK(res);
+    }
+
+    stream = static_cast<cudaStream_t>(cu_stream);
+    sm_count = static_cast<int>(used.sm.smCount);
+    MATX_LOG_DEBUG("Created green context stream with {} SMs and priority {}", sm_count, priority);
+#else
+    MATX_THROW(matxNotSupported, "SM partitions require CUDA 12.5 or newer");
+#endif
+  }
+
+  ~ExecutorStreamResource() {
+    cudaStreamDestroy(stream);
+#if CUDA_VERSION >= 12050
+    if (green_ctx != nullptr) {
+      cuGreenCtxDestroy(green_ctx);
+    }
+#endif
+  }
+
+  ExecutorStreamResource(const ExecutorStreamResource &) = delete;
+  ExecutorStreamResource &operator=(const ExecutorStreamResource &) = delete;
+
+  cudaStream_t stream = nullptr;
+  int priority = 0;
+  int sm_count = 0;
+#if CUDA_VERSION >= 12050
+  CUgreenCtx green_ctx = nullptr;
+#endif
+};
+
+} // namespace detail
+} // namespace matx
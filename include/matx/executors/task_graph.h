@@ -0,0 +1,333 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/cuda.h"
+#include "matx/executors/cuda_graph.h"
+
+namespace matx
+{
+
+namespace detail {
+  /**
+   * @brief Byte range of memory touched by a tensor, used for hazard detection in a taskGraph
+   *
+   * The range spans every element the view can address, so strided or permuted views are handled
+   * conservatively: two views of the same buffer are treated as dependent if their ranges overlap,
+   * even if the elements they address are interleaved.
+   */
+  struct TaskBuffer {
+    uintptr_t begin = 0;
+    uintptr_t end = 0;
+
+    TaskBuffer() = default;
+
+    template <typename TensorType>
+      requires is_tensor_view_v<TensorType>
+    TaskBuffer(const TensorType &t) {
+      using value_type = typename TensorType::value_type;
+      const auto base = reinterpret_cast<intptr_t>(t.Data());
+      intptr_t lo = 0;
+      intptr_t hi = 0;
+      for (int r = 0; r < TensorType::Rank(); r++) {
+        if (t.Size(r) == 0) {
+          return;
+        }
+
+        const auto extent = static_cast<intptr_t>((t.Size(r) - 1) * t.Stride(r));
+        if (extent < 0) {
+          lo += extent;
+        }
+        else {
+          hi += extent;
+        }
+      }
+
+      begin = static_cast<uintptr_t>(base + lo * static_cast<intptr_t>(sizeof(value_type)));
+      end   = static_cast<uintptr_t>(base + (hi + 1) * static_cast<intptr_t>(sizeof(value_type)));
+    }
+
+    bool overlaps(const TaskBuffer &other) const {
+      return begin < other.end && other.begin < end;
+    }
+  };
+
+  inline bool any_overlap(const std::vector<TaskBuffer> &a, const std::vector<TaskBuffer> &b) {
+    for (const auto &x : a) {
+      for (const auto &y : b) {
+        if (x.overlaps(y)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+}
+
+/**
+ * @brief Schedules independent MatX work across a pool of CUDA streams
+ *
+ * Tasks are added in program order together with the tensors they read and write. Each new task
+ * depends on every earlier task it has a read-after-write, write-after-read or write-after-write
+ * hazard with. Independent tasks are spread over the stream pool, and dependencies between tasks
+ * on different streams are enforced with events. A task with a single dependency that is the last
+ * task on its stream continues on that stream so no event is needed.
+ *
+ * run() orders all tasks after the work already issued to the executor's stream and makes the
+ * executor's stream wait for every task, so a taskGraph can be dropped into an existing sequence of
+ * run() calls. The graph can be run any number of times. The same schedule can also be captured
+ * into a cudaGraph for replay with a single launch.
+ */
+class taskGraph {
+  public:
+    /**
+     * @brief Construct a task graph with its own pool of streams
+     *
+     * @param num_streams Number of streams in the pool
+     */
+    explicit taskGraph(int num_streams = 4) {
+      MATX_ASSERT_STR(num_streams > 0, matxInvalidParameter, "taskGraph requires at least one stream");
+
+      streams_.resize(static_cast<size_t>(num_streams));
+      join_events_.resize(static_cast<size_t>(num_streams));
+      for (int s = 0; s < num_streams; s++) {
+        MATX_CUDA_CHECK(cudaStreamCreateWithFlags(&streams_[s], cudaStreamNonBlocking));
+        MATX_CUDA_CHECK(cudaEventCreateWithFlags(&join_events_[s], cudaEventDisableTiming));
+      }
+      MATX_CUDA_CHECK(cudaEventCreateWithFlags(&fork_event_, cudaEventDisableTiming));
+    }
+
+    ~taskGraph() {
+      clear();
+      cudaEventDestroy(fork_event_);
+      for (size_t s = 0; s < streams_.size(); s++) {
+        cudaEventDestroy(join_events_[s]);
+        cudaStreamDestroy(streams_[s]);
+      }
+    }
+
+    taskGraph(const taskGraph &) = delete;
+    taskGraph &operator=(const taskGraph &) = delete;
+
+    /**
+     * @brief Add a task to the graph
+     *
+     * The task is either a MatX expression such as ``(y = fft(x))``, which is run on the stream the task is
+     * assigned to, or a callable taking a ``cudaExecutor&`` for tasks made of several statements. Every tensor
+     * the task reads or writes must be listed, since hazards are only inferred from the declared tensors.
+     *
+     * @tparam Task Expression or callable type
+     * @param task Expression or callable
+     * @param reads Tensors read by the task
+     * @param writes Tensors written by the task
+     * @return Index of the task
+     */
+    template <typename Task>
+    int add(Task &&task, std::initializer_list<detail::TaskBuffer> reads, std::initializer_list<detail::TaskBuffer> writes) {
+      Node node;
+      if constexpr (is_matx_op<remove_cvref_t<Task>>()) {
+        node.fn = [op = remove_cvref_t<Task>(std::forward<Task>(task))](cudaExecutor &ex) mutable {
+          op.run(ex);
+        };
+      }
+      else {
+        static_assert(std::is_invocable_v<Task &, cudaExecutor &>, "Task must be a MatX expression or a callable taking cudaExecutor&");
+        node.fn = std::forward<Task>(task);
+      }
+      node.reads = reads;
+      node.writes = writes;
+
+      for (int p = 0; p < static_cast<int>(nodes_.size()); p++) {
+        const auto &prev = nodes_[p];
+        if (detail::any_overlap(node.writes, prev.reads) ||
+            detail::any_overlap(node.writes, prev.writes) ||
+            detail::any_overlap(node.reads, prev.writes)) {
+          node.deps.push_back(p);
+        }
+      }
+
+      node.stream = AssignStream(node.deps);
+      last_on_stream_[static_cast<size_t>(node.stream)] = static_cast<int>(nodes_.size());
+      MATX_CUDA_CHECK(cudaEventCreateWithFlags(&node.done, cudaEventDisableTiming));
+
+      MATX_LOG_DEBUG("taskGraph: task {} on stream {} with {} dependencies", nodes_.size(), node.stream, node.deps.size());
+      nodes_.push_back(std::move(node));
+      return static_cast<int>(nodes_.size()) - 1;
+    }
+
+    /**
+     * @brief Issue all tasks, ordered after the work already on an executor's stream
+     *
+     * @param exec Executor whose stream the graph forks from and joins back into
+     */
+    void run(const cudaExecutor &exec) {
+      const cudaStream_t main = exec.getStream();
+      MATX_CUDA_CHECK(cudaEventRecord(fork_event_, main));
+      for (size_t s = 0; s < streams_.size(); s++) {
+        if (StreamUsed(static_cast<int>(s))) {
+          MATX_CUDA_CHECK(cudaStreamWaitEvent(streams_[s], fork_event_, 0));
+        }
+      }
+
+      for (auto &node : nodes_) {
+        const cudaStream_t stream = streams_[static_cast<size_t>(node.stream)];
+        for (const int d : node.deps) {
+          if (nodes_[static_cast<size_t>(d)].stream != node.stream) {
+            MATX_CUDA_CHECK(cudaStreamWaitEvent(stream, nodes_[static_cast<size_t>(d)].done, 0));
+          }
+        }
+
+        cudaExecutor ex{stream};
+        node.fn(ex);
+        MATX_CUDA_CHECK(cudaEventRecord(node.done, stream));
+      }
+
+      for (size_t s = 0; s < streams_.size(); s++) {
+        if (StreamUsed(static_cast<int>(s))) {
+          MATX_CUDA_CHECK(cudaEventRecord(join_events_[s], streams_[s]));
+          MATX_CUDA_CHECK(cudaStreamWaitEvent(main, join_events_[s], 0));
+        }
+      }
+    }
+
+    /**
+     * @brief Capture all tasks into a CUDA graph through the executor's stream
+     *
+     * The pool streams join the capture through the fork event, so the captured graph keeps the same
+     * parallelism as run(). Replay it with ``exec.launch(graph)``.
+     *
+     * @param exec Executor to capture on. Must not use the default stream
+     * @param graph Graph to capture into
+     * @param warmup Run the tasks once before the first capture to populate plan caches
+     */
+    void capture(cudaExecutor &exec, cudaGraph &graph, bool warmup = true) {
+      exec.capture(graph, [&]() { run(exec); }, warmup);
+    }
+
+    /**
+     * @brief Remove all tasks from the graph. The stream pool is kept
+     */
+    void clear() {
+      for (auto &node : nodes_) {
+        cudaEventDestroy(node.done);
+      }
+      nodes_.clear();
+      last_on_stream_.clear();
+      next_stream_ = 0;
+    }
+
+    /**
+     * @brief Number of tasks in the graph
+     */
+    int num_tasks() const { return static_cast<int>(nodes_.size()); }
+
+    /**
+     * @brief Number of streams in the pool
+     */
+    int num_streams() const { return static_cast<int>(streams_.size()); }
+
+    /**
+     * @brief Index of the pool stream a task was assigned to
+     *
+     * @param task Task index returned from add()
+     */
+    int stream_of(int task) const { return nodes_[static_cast<size_t>(task)].stream; }
+
+    /**
+     * @brief Indices of the earlier tasks a task depends on
+     *
+     * @param task Task index returned from add()
+     */
+    const std::vector<int> &dependencies(int task) const { return nodes_[static_cast<size_t>(task)].deps; }
+
+  private:
+    struct Node {
+      std::function<void(cudaExecutor &)> fn;
+      std::vector<detail::TaskBuffer> reads;
+      std::vector<detail::TaskBuffer> writes;
+      std::vector<int> deps;
+      int stream = 0;
+      cudaEvent_t done = nullptr;
+    };
+
+    int AssignStream(const std::vector<int> &deps) {
+      last_on_stream_.resize(streams_.size(), -1);
+
+      // Continue on the stream of the most recent dependency if nothing else was queued behind it
+      if (!deps.empty()) {
+        const int d = *std::max_element(deps.begin(), deps.end());
+        const int s = nodes_[static_cast<size_t>(d)].stream;
+        if (last_on_stream_[static_cast<size_t>(s)] == d) {
+          return s;
+        }
+      }
+
+      // Otherwise prefer an idle stream, falling back to round robin over the pool
+      for (size_t i = 0; i < streams_.size(); i++) {
+        const int s = (next_stream_ + static_cast<int>(i)) % static_cast<int>(streams_.size());
+        if (last_on_stream_[static_cast<size_t>(s)] < 0) {
+          next_stream_ = (s + 1) % static_cast<int>(streams_.size());
+          return s;
+        }
+      }
+
+      const int s = next_stream_;
+      next_stream_ = (next_stream_ + 1) % static_cast<int>(streams_.size());
+      return s;
+    }
+
+    bool StreamUsed(int s) const {
+      return static_cast<size_t>(s) < last_on_stream_.size() && last_on_stream_[static_cast<size_t>(s)] >= 0;
+    }
+
+    std::vector<cudaStream_t> streams_;
+    std::vector<cudaEvent_t> join_events_;
+    cudaEvent_t fork_event_ = nullptr;
+    std::vector<Node> nodes_;
+    std::vector<int> last_on_stream_;
+    int next_stream_ = 0;
+};
+
+} // namespace matx
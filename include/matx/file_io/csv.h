@@ -0,0 +1,526 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "matx/core/allocator.h"
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/operator_utils.h"
+#include "matx/core/type_utils.h"
+#include "matx/file_io/npy.h"
+
+namespace matx {
+namespace detail {
+
+/**
+ * Minimum number of bytes of CSV text given to each parsing or formatting
+ * thread. Smaller files are handled by fewer threads.
+ */
+static constexpr size_t CSV_BYTES_PER_THREAD = 1 << 20;
+
+/**
+ * @brief Run f(i) for i in [0, n) on n threads, rethrowing the first exception
+ */
+template <typename Func>
+void CsvParallel(size_t n, const Func &f)
+{
+  if (n == 1) {
+    f(size_t{0});
+    return;
+  }
+
+  std::exception_ptr first_error;
+  std::mutex error_mtx;
+  std::vector<std::thread> threads;
+  threads.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    threads.emplace_back([&, i]() {
+      try {
+        f(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mtx);
+        if (!first_error) {
+          first_error = std::current_exception();
+        }
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  if (first_error) {
+    std::rethrow_exception(first_error);
+  }
+}
+
+/**
+ * @brief Byte range of CSV text, split into lines
+ *
+ * A line belongs to the chunk its first byte falls in, so each thread can
+ * find its lines independently of the others.
+ */
+struct CsvText {
+  const char *begin;
+  const char *end;
+
+  const char *FirstLineAtOrAfter(const char *p) const {
+    if (p == begin) {
+      return p;
+    }
+    const auto nl = static_cast<const char *>(memchr(p - 1, '\n', static_cast<size_t>(end - (p - 1))));
+    return nl == nullptr ? end : nl + 1;
+  }
+
+  /**
+   * @brief Find the first data line of the text
+   *
+   * @return False if there are no data lines
+   */
+  bool FirstDataLine(const char *&line_begin, const char *&line_end) const {
+    for (const char *p = begin; p < end;) {
+      const auto nl = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+      line_end = nl == nullptr ? end : nl;
+      if (line_end > p && line_end[-1] == '\r') {
+        line_end--;
+      }
+      if (line_end > p && *p != '#') {
+        line_begin = p;
+        return true;
+      }
+      p = nl == nullptr ? end : nl + 1;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Call f(line_begin, line_end) for every data line starting in [chunk_begin, chunk_end)
+   *
+   * Empty lines and lines starting with '#' are skipped, and a trailing '\r' is removed.
+   */
+  template <typename Func>
+  void ForEachLine(const char *chunk_begin, const char *chunk_end, Func &&f) const {
+    for (const char *p = FirstLineAtOrAfter(chunk_begin); p < chunk_end && p < end;) {
+      const auto nl = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+      const char *line_end = nl == nullptr ? end : nl;
+      const char *next = nl == nullptr ? end : nl + 1;
+      if (line_end > p && line_end[-1] == '\r') {
+        line_end--;
+      }
+      if (line_end > p && *p != '#') {
+        f(p, line_end);
+      }
+      p = next;
+    }
+  }
+};
+
+__MATX_INLINE__ const char *CsvSkipSpace(const char *p, const char *end) {
+  while (p < end && (*p == ' ' || *p == '\t')) {
+    p++;
+  }
+  return p;
+}
+
+/**
+ * @brief Parse a real number, allowing an explicit leading '+'
+ */
+template <typename T>
+__MATX_INLINE__ const char *CsvParseReal(const char *p, const char *end, T &v) {
+  if (p < end && *p == '+') {
+    p++;
+  }
+
+  if constexpr (cuda::std::is_same_v<T, bool>) {
+    int i;
+    const auto r = std::from_chars(p, end, i);
+    v = i != 0;
+    return r.ec == std::errc{} ? r.ptr : nullptr;
+  }
+  else if constexpr (is_matx_half_v<T>) {
+    float f;
+    const auto r = std::from_chars(p, end, f);
+    v = T{f};
+    return r.ec == std::errc{} ? r.ptr : nullptr;
+  }
+  else {
+    const auto r = std::from_chars(p, end, v);
+    return r.ec == std::errc{} ? r.ptr : nullptr;
+  }
+}
+
+/**
+ * @brief Parse one field into T
+ *
+ * Complex values use numpy's notation, such as 1.5-2j, optionally in
+ * parentheses. i is accepted in place of j.
+ *
+ * @return True if the whole field was consumed
+ */
+template <typename T>
+__MATX_INLINE__ bool CsvParseField(const char *p, const char *end, T &v) {
+  p = CsvSkipSpace(p, end);
+  while (end > p && (end[-1] == ' ' || end[-1] == '\t')) {
+    end--;
+  }
+
+  if constexpr (is_complex_v<T>) {
+    using vt = typename T::value_type;
+    if (p < end && *p == '(' && end[-1] == ')') {
+      p++;
+      end--;
+    }
+
+    vt re{0}, im{0};
+    const char *q = CsvParseReal(p, end, re);
+    if (q == nullptr) {
+      return false;
+    }
+    if (q < end && (*q == 'j' || *q == 'i')) {
+      // Purely imaginary
+      v = T{vt{0}, re};
+      return q + 1 == end;
+    }
+    if (q < end) {
+      q = CsvParseReal(q, end, im);
+      if (q == nullptr || q + 1 != end || (*q != 'j' && *q != 'i')) {
+        return false;
+      }
+    }
+    v = T{re, im};
+    return true;
+  }
+  else {
+    const char *q = CsvParseReal(p, end, v);
+    return q == end;
+  }
+}
+
+/**
+ * @brief Format one value the way CsvParseField reads it back
+ *
+ * Floating point values use the shortest representation that round-trips.
+ */
+template <typename T>
+__MATX_INLINE__ void CsvFormatField(std::string &out, const T &v) {
+  if constexpr (is_complex_v<T>) {
+    CsvFormatField(out, v.real());
+    if (!std::signbit(static_cast<float>(v.imag()))) {
+      out += '+';
+    }
+    CsvFormatField(out, v.imag());
+    out += 'j';
+  }
+  else if constexpr (cuda::std::is_same_v<T, bool>) {
+    out += v ? '1' : '0';
+  }
+  else if constexpr (is_matx_half_v<T>) {
+    CsvFormatField(out, static_cast<float>(v));
+  }
+  else {
+    char buf[128];
+    const auto r = std::to_chars(buf, buf + sizeof(buf), v);
+    out.append(buf, r.ptr);
+  }
+}
+
+}; // namespace detail
+
+namespace io {
+
+/**
+ * @brief Read a CSV file into a tensor view
+ *
+ * The file is mapped and split into one chunk per thread. Each thread counts
+ * the rows in its chunk, then parses them straight into their final position
+ * once the row offsets are known. Lines are scanned with memchr, and numbers
+ * are parsed with std::from_chars. Empty lines and lines starting with '#' are
+ * skipped. Complex values use numpy's notation, such as 1.5-2j. Tensors in
+ * host-accessible memory are filled in place. Device tensors are filled from
+ * a pinned host buffer with an asynchronous copy on the given stream.
+ * Currently 1D and 2D tensors are supported only.
+ *
+ * For a 2D tensor, rows of the file map to the first dimension and columns to
+ * the second. A 1D tensor can be read from a file with a single row or a
+ * single column.
+ *
+ * @tparam TensorType
+ *   Data type of tensor
+ * @param t
+ *   Tensor to read data into
+ * @param fname
+ *   File path of .csv file
+ * @param delimiter
+ *   Delimiter to use for CSV file
+ * @param skip_header
+ *   Skip the header row of the CSV file, default as `true`.
+ * @param stream
+ *   CUDA stream used when the tensor is in device memory
+ **/
+template <typename TensorType>
+void read_csv(TensorType &t, const std::string fname,
+             const std::string delimiter, bool skip_header = true, cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T = typename TensorType::value_type;
+  constexpr int RANK = TensorType::Rank();
+
+  if constexpr (RANK != 1 && RANK != 2) {
+    MATX_THROW(matxInvalidDim,
+               "CSV reading limited to tensors of rank 1 and 2");
+  }
+  else {
+    MATX_ASSERT_STR(!delimiter.empty(), matxInvalidParameter, "CSV delimiter cannot be empty");
+
+    detail::NpyMappedFile map(fname);
+    detail::CsvText text{reinterpret_cast<const char *>(map.Data()),
+                         reinterpret_cast<const char *>(map.Data()) + map.Size()};
+    if (skip_header) {
+      const auto nl = static_cast<const char *>(memchr(text.begin, '\n', map.Size()));
+      text.begin = nl == nullptr ? text.end : nl + 1;
+    }
+
+    const size_t bytes = static_cast<size_t>(text.end - text.begin);
+    const size_t num_threads = std::clamp<size_t>(bytes / detail::CSV_BYTES_PER_THREAD, 1,
+                                                  std::max(1u, std::thread::hardware_concurrency()));
+    const auto chunk_begin = [&](size_t i) { return text.begin + bytes * i / num_threads; };
+
+    // Pass 1: rows per chunk
+    std::vector<index_t> chunk_rows(num_threads + 1, 0);
+    detail::CsvParallel(num_threads, [&](size_t i) {
+      index_t n = 0;
+      text.ForEachLine(chunk_begin(i), chunk_begin(i + 1), [&](const char *, const char *) { n++; });
+      chunk_rows[i + 1] = n;
+    });
+    for (size_t i = 0; i < num_threads; i++) {
+      chunk_rows[i + 1] += chunk_rows[i];
+    }
+    const index_t rows = chunk_rows[num_threads];
+
+    // Columns come from the first data line
+    index_t cols = 0;
+    const char *b = nullptr;
+    const char *e = nullptr;
+    if (text.FirstDataLine(b, e)) {
+      cols = 1;
+      for (const char *p = b; (p = std::search(p, e, delimiter.begin(), delimiter.end())) != e; p += delimiter.size()) {
+        cols++;
+      }
+    }
+
+    bool shape_ok;
+    if constexpr (RANK == 2) {
+      shape_ok = rows == t.Size(0) && cols == t.Size(1);
+    }
+    else {
+      shape_ok = (rows == 1 || cols == 1) && rows * cols == t.Size(0);
+    }
+    if (!shape_ok) {
+      const std::string errorMessage = "CSV file [" + fname + "] has " + std::to_string(rows) + " rows and " +
+          std::to_string(cols) + " columns, which does not match the tensor";
+      MATX_THROW(matxInvalidSize, errorMessage.c_str());
+    }
+
+    const auto kind = GetPointerKind(t.Data());
+    const bool host = kind == MATX_INVALID_MEMORY || HostPrintable(kind);
+    T *dst = t.Data();
+    if (!host || !t.IsContiguous()) {
+      matxAlloc(reinterpret_cast<void **>(&dst), static_cast<size_t>(rows * cols) * sizeof(T), MATX_HOST_MEMORY);
+    }
+
+    // Pass 2: parse each chunk into its rows
+    std::atomic<index_t> bad_row{-1};
+    detail::CsvParallel(num_threads, [&](size_t i) {
+      index_t r = chunk_rows[i];
+      text.ForEachLine(chunk_begin(i), chunk_begin(i + 1), [&](const char *b, const char *e) {
+        T *row = dst + r * cols;
+        index_t c = 0;
+        const char *p = b;
+        bool ok = true;
+        bool at_end = false;
+        while (ok && c < cols && !at_end) {
+          const char *f_end = delimiter.size() == 1 ?
+              static_cast<const char *>(memchr(p, delimiter[0], static_cast<size_t>(e - p))) :
+              std::search(p, e, delimiter.begin(), delimiter.end());
+          at_end = f_end == nullptr || f_end == e;
+          if (at_end) {
+            f_end = e;
+          }
+          ok = detail::CsvParseField(p, f_end, row[c++]);
+          p = at_end ? e : f_end + delimiter.size();
+        }
+        if (!ok || c != cols || !at_end) {
+          index_t expected = -1;
+          bad_row.compare_exchange_strong(expected, r);
+        }
+        r++;
+      });
+    });
+
+    const index_t bad = bad_row.load();
+    if (bad >= 0) {
+      if (dst != t.Data()) {
+        matxFree(dst);
+      }
+      const std::string errorMessage = "Failed to parse data row " + std::to_string(bad) + " of [" + fname + "]";
+      MATX_THROW(matxIOError, errorMessage.c_str());
+    }
+
+    if (dst == t.Data()) {
+      return;
+    }
+
+    if (host) {
+      for (index_t i = 0; i < rows * cols; i++) {
+        t(matx::detail::GetIdxFromAbs(t, i)) = dst[i];
+      }
+    }
+    else {
+      MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter,
+          "read_csv into device memory requires a contiguous tensor");
+      MATX_CUDA_CHECK(cudaMemcpyAsync(t.Data(), dst, static_cast<size_t>(rows * cols) * sizeof(T),
+                                      cudaMemcpyHostToDevice, stream));
+      MATX_CUDA_CHECK(cudaStreamSynchronize(stream));
+    }
+    matxFree(dst);
+  }
+}
+
+/**
+ * Write a CSV file from a tensor view
+ *
+ * Rows are formatted in parallel with std::to_chars, using the shortest
+ * representation that reads back to the same value, and written in order.
+ * Complex values are written in numpy's notation, such as 1.5-2j. Device
+ * tensors are copied to the host first. Currently 1D and 2D tensors are
+ * supported only; 1D tensors are written as a single column.
+ *
+ * @tparam TensorType
+ *   Data type of tensor
+ * @param t
+ *   Tensor to write data from
+ * @param fname
+ *   File path of .csv file
+ * @param delimiter
+ *   Delimiter to use for CSV file
+ **/
+template <typename TensorType>
+void write_csv(const TensorType &t, const std::string fname,
+              const std::string delimiter)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  MATX_STATIC_ASSERT_STR(is_tensor_view_v<TensorType>, matxInvalidType, "write_csv requires a tensor");
+  using T = typename TensorType::value_type;
+  constexpr int RANK = TensorType::Rank();
+
+  if constexpr (RANK != 1 && RANK != 2) {
+    MATX_THROW(matxInvalidDim,
+               "CSV writing limited to tensors of rank 1 and 2");
+  }
+  else {
+    const index_t rows = t.Size(0);
+    const index_t cols = RANK == 2 ? t.Size(RANK - 1) : 1;
+    const size_t total = static_cast<size_t>(rows * cols);
+
+    // Gather into a contiguous host buffer
+    std::vector<T> host_copy;
+    const T *src = t.Data();
+    const auto kind = GetPointerKind(const_cast<T *>(t.Data()));
+    if (kind == MATX_INVALID_MEMORY || HostPrintable(kind)) {
+      if (!t.IsContiguous()) {
+        host_copy.resize(total);
+        for (size_t i = 0; i < total; i++) {
+          host_copy[i] = t(matx::detail::GetIdxFromAbs(t, static_cast<index_t>(i)));
+        }
+        src = host_copy.data();
+      }
+    }
+    else {
+      MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter,
+          "write_csv from device memory requires a contiguous tensor");
+      host_copy.resize(total);
+      MATX_CUDA_CHECK(cudaMemcpy(host_copy.data(), t.Data(), total * sizeof(T), cudaMemcpyDeviceToHost));
+      src = host_copy.data();
+    }
+
+    // Roughly 24 characters per value
+    const size_t num_threads = std::clamp<size_t>(total * 24 / detail::CSV_BYTES_PER_THREAD, 1,
+                                                  std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::string> parts(num_threads);
+    detail::CsvParallel(num_threads, [&](size_t i) {
+      const index_t r0 = rows * static_cast<index_t>(i) / static_cast<index_t>(num_threads);
+      const index_t r1 = rows * static_cast<index_t>(i + 1) / static_cast<index_t>(num_threads);
+      auto &out = parts[i];
+      out.reserve(static_cast<size_t>((r1 - r0) * cols) * 24);
+      for (index_t r = r0; r < r1; r++) {
+        for (index_t c = 0; c < cols; c++) {
+          if (c > 0) {
+            out += delimiter;
+          }
+          detail::CsvFormatField(out, src[r * cols + c]);
+        }
+        out += '\n';
+      }
+    });
+
+    FILE *fp = fopen(fname.c_str(), "wb");
+    if (fp == nullptr) {
+      const std::string errorMessage = "Failed to open [" + fname + "] for writing";
+      MATX_THROW(matxIOError, errorMessage.c_str());
+    }
+    bool ok = true;
+    for (const auto &part : parts) {
+      ok = ok && fwrite(part.data(), 1, part.size(), fp) == part.size();
+    }
+    ok = (fclose(fp) == 0) && ok;
+    if (!ok) {
+      const std::string errorMessage = "Failed to write [" + fname + "]";
+      MATX_THROW(matxIOError, errorMessage.c_str());
+    }
+  }
+}
+
+}; // namespace io
+}; // namespace matx
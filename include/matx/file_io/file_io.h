@@ -46,7 +46,11 @@
 #include "matx/core/pybind.h"
 #include "matx/core/tensor.h"
 
+#include "csv.h"
+#include "npy.h"
+#include "gds.h"
 #include "tiff.h"
+#include "hdf5.h"
 
 #if defined(MATX_ENABLE_FILEIO) || defined(DOXYGEN_ONLY)
 
@@ -116,87 +120,6 @@ using namespace pybind11::literals;
 // }
 
 
-/**
- * @brief Read a CSV file into a tensor view
- *
- * CSVs are currently read in using the Python interpreter through pybind11.
- * This has a startup performance hit, but CSV reading is intended to be a
- * slow-path function, so this is not a critical component to speed up. Currently
- * 1D and 2D tensors are supported only.
- *
- * @tparam TensorType
- *   Data type of tensor
- * @param t
- *   Tensor to read data into
- * @param fname
- *   File path of .csv file
- * @param delimiter
- *   Delimiter to use for CSV file
- * @param skip_header
- *   Skip the header row of the CSV file, default as `true`.
- **/
-template <typename TensorType>
-void read_csv(TensorType &t, const std::string fname,
-             const std::string delimiter, bool skip_header = true)
-{
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
-
-  if (TensorType::Rank() != 1 && TensorType::Rank() != 2) {
-    MATX_THROW(matxInvalidDim,
-               "CSV reading limited to tensors of rank 1 and 2");
-  }
-
-
-  if (!std::filesystem::exists(fname)) {
-    const std::string errorMessage = "Failed to read [" + fname + "], Does not Exist";
-    MATX_THROW(matxIOError, errorMessage.c_str());
-  }
-
-  auto pb = std::make_unique<detail::MatXPybind>();
-
-  auto np = pybind11::module_::import("numpy");
-  auto obj = np.attr("genfromtxt")("fname"_a = fname.c_str(), "delimiter"_a = delimiter,
-                                   "skip_header"_a = skip_header,
-                                   "dtype"_a = detail::MatXPybind::GetNumpyDtype<typename TensorType::value_type>());
-  pb->NumpyToTensorView(t, obj);
-}
-
-/**
- * Write a CSV file from a tensor view
- *
- * CSVs are currently written using the Python interpreter through pybind11.
- * This has a startup performance hit, but CSV writing is intended to be a
- * slow-path function, so this is not a critical component to speed up. Currently
- * 1D and 2D tensors are supported only.
- *
- * @tparam TensorType
- *   Data type of tensor
- * @param t
- *   Tensor to write data from
- * @param fname
- *   File path of .csv file
- * @param delimiter
- *   Delimiter to use for CSV file
- **/
-template <typename TensorType>
-void write_csv(const TensorType &t, const std::string fname,
-              const std::string delimiter)
-{
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
-
-  if (TensorType::Rank() != 1 && TensorType::Rank() != 2) {
-    MATX_THROW(matxInvalidDim,
-               "CSV reading limited to tensors of rank 1 and 2");
-  }
-
-
-  auto pb = std::make_unique<detail::MatXPybind>();
-  auto np = pybind11::module_::import("numpy");
-
-  auto np_ten = pb->TensorViewToNumpy(t);
-  auto obj = np.attr("savetxt")(fname, np_ten, "delimiter"_a = delimiter);
-}
-
 /**
  * @brief Read a MAT file into a tensor view
  *
@@ -226,7 +149,7 @@ void read_mat(TensorType &t, const std::string fname,
   }
 
 
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
 
   auto pb = std::make_unique<detail::MatXPybind>();
@@ -264,7 +187,7 @@ auto read_mat(const std::string fname,
     MATX_THROW(matxIOError, errorMessage.c_str());
   }
 
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   auto pb = std::make_unique<detail::MatXPybind>();
 
@@ -293,7 +216,7 @@ template <typename TensorType>
 void write_mat(const TensorType &t, const std::string fname,
               const std::string var)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   auto pb = std::make_unique<detail::MatXPybind>();
   auto np = pybind11::module_::import("numpy");
@@ -306,61 +229,6 @@ void write_mat(const TensorType &t, const std::string fname,
   auto obj = sp.attr("savemat")("file_name"_a = fname, "mdict"_a = td);
 }
 
-/**
- * @brief Read a NPY file into a tensor view
- *
- * NPY files are a simple binary format for storing arrays of numbers.
- *
- * @tparam TensorType
- *   Data type of tensor
- * @param t
- *   Tensor to read data into
- * @param fname
- *   File name of .npy file
- */
-template <typename TensorType>
-void read_npy(TensorType &t, const std::string& fname)
-{
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
-
-  if (!std::filesystem::exists(fname)) {
-    const std::string errorMessage = "Failed to read [" + fname + "], Does not Exist";
-    MATX_THROW(matxIOError, errorMessage.c_str());
-  }
-
-  auto pb = std::make_unique<detail::MatXPybind>();
-
-  auto np = pybind11::module_::import("numpy");
-  auto obj = np.attr("load")("file"_a = fname);
-
-  pb->NumpyToTensorView(t, obj);
-}
-
-/**
- * @brief Write a NPY file from a tensor view
- *
- * NPY files are a simple binary format for storing arrays of numbers.
- *
- * @tparam TensorType
- *   Data type of tensor
- * @param t
- *   Tensor to write data from
- * @param fname
- *   File name of .npy file
- */
-template <typename TensorType>
-void write_npy(const TensorType &t, const std::string& fname)
-{
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
-
-  auto pb = std::make_unique<detail::MatXPybind>();
-  auto np = pybind11::module_::import("numpy");
-
-  auto np_ten = pb->TensorViewToNumpy(t);
-
-  np.attr("save")("file"_a = fname, "arr"_a = np_ten);
-}
-
 }; // namespace io
 }; // namespace matx
 
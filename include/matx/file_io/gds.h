@@ -0,0 +1,572 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef MATX_EN_CUFILE
+#include <cufile.h>
+#endif
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/nvtx.h"
+#include "matx/file_io/npy.h"
+
+namespace matx {
+namespace detail {
+
+#ifdef MATX_EN_CUFILE
+/**
+ * @brief Open the cuFile driver once per process
+ *
+ * @return True if GPUDirect Storage can be used
+ */
+__MATX_INLINE__ bool CuFileDriverReady()
+{
+  static const bool ready = [] {
+    const CUfileError_t st = cuFileDriverOpen();
+    if (st.err != CU_FILE_SUCCESS) {
+      MATX_LOG_WARN("cuFileDriverOpen failed ({}); file I/O falls back to pinned bounce buffers",
+                    static_cast<int>(st.err));
+      return false;
+    }
+    return true;
+  }();
+
+  return ready;
+}
+#endif
+
+__MATX_INLINE__ bool IsDeviceOnlyPointer(const void *ptr)
+{
+  cudaPointerAttributes attr;
+  if (cudaPointerGetAttributes(&attr, ptr) != cudaSuccess) {
+    // Unregistered host memory on older drivers reports an error; clear it
+    cudaGetLastError();
+    return false;
+  }
+
+  return attr.type == cudaMemoryTypeDevice;
+}
+
+/**
+ * @brief pread/pwrite until all bytes are transferred
+ */
+__MATX_INLINE__ bool FullFileIO(int fd, void *buf, size_t bytes, off_t offset, bool write)
+{
+  auto p = static_cast<uint8_t *>(buf);
+  while (bytes > 0) {
+    const ssize_t n = write ? pwrite(fd, p, bytes, offset) : pread(fd, p, bytes, offset);
+    if (n <= 0) {
+      return false;
+    }
+    p += n;
+    bytes -= static_cast<size_t>(n);
+    offset += n;
+  }
+
+  return true;
+}
+
+/**
+ * @brief One read or write submitted to a gdsBatch
+ *
+ * cuFile's stream API reads the size and offsets, and writes the byte count,
+ * when the stream reaches the operation, so these fields must stay at a fixed
+ * address until the stream has been synchronized.
+ */
+struct GdsOp {
+  std::string fname;
+  bool write = false;
+  int fd = -1;        ///< Buffered descriptor used for host memory and the bounce path
+  int direct_fd = -1; ///< O_DIRECT descriptor registered with cuFile
+#ifdef MATX_EN_CUFILE
+  CUfileHandle_t handle = nullptr;
+#endif
+  size_t size = 0;
+  off_t file_offset = 0;
+  off_t buf_offset = 0;
+  ssize_t bytes = 0;
+};
+
+}; // namespace detail
+
+namespace io {
+
+/**
+ * @brief Returns true if reads and writes into device memory go through GPUDirect Storage
+ *
+ * This requires building with MATX_EN_CUFILE and a working cuFile driver. When it
+ * returns false, gdsBatch and the raw file functions stage device transfers
+ * through pinned host buffers instead.
+ */
+__MATX_INLINE__ bool gds_available()
+{
+#ifdef MATX_EN_CUFILE
+  return detail::CuFileDriverReady();
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief A set of file reads and writes ordered on a CUDA stream
+ *
+ * Each Read or Write is enqueued on the stream, so it runs after work already
+ * submitted there and before anything submitted afterwards. When GPUDirect
+ * Storage is available, transfers into or out of device memory are submitted
+ * with cuFile's stream API and do not block the host. Otherwise, and for
+ * filesystems that do not support O_DIRECT, they are staged through a pair of
+ * pinned host buffers. Tensors in host or managed memory are read and written
+ * directly after synchronizing the stream.
+ *
+ * Wait() must be called, or the batch destroyed, before the tensors or files
+ * are used from the host. Wait() reports short reads and writes.
+ */
+class gdsBatch {
+  public:
+    /**
+     * @brief Construct a batch
+     *
+     * @param stream CUDA stream the transfers are ordered on
+     */
+    explicit gdsBatch(cudaStream_t stream = 0) : stream_(stream) {}
+
+    ~gdsBatch()
+    {
+      cudaStreamSynchronize(stream_);
+      Release();
+      for (int b = 0; b < 2; b++) {
+        if (staging_[b] != nullptr) {
+          cudaEventDestroy(done_[b]);
+          matxFree(staging_[b]);
+        }
+      }
+    }
+
+    gdsBatch(const gdsBatch &) = delete;
+    gdsBatch &operator=(const gdsBatch &) = delete;
+
+    /**
+     * @brief Enqueue a read of raw bytes from a file into a tensor
+     *
+     * @tparam TensorType Type of tensor
+     * @param t Contiguous tensor to fill. Its size determines how many bytes are read
+     * @param fname File to read
+     * @param file_offset Byte offset in the file to start reading from
+     */
+    template <typename TensorType>
+    void Read(TensorType &t, const std::string &fname, size_t file_offset = 0)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      Submit(t.Data(), static_cast<size_t>(t.TotalSize()) * sizeof(typename TensorType::value_type),
+             t.IsContiguous(), fname, file_offset, false);
+    }
+
+    /**
+     * @brief Enqueue a write of a tensor's raw bytes to a file
+     *
+     * @tparam TensorType Type of tensor
+     * @param t Contiguous tensor to write
+     * @param fname File to write. It is created if needed, and truncated if file_offset is 0
+     * @param file_offset Byte offset in the file to start writing at
+     */
+    template <typename TensorType>
+    void Write(const TensorType &t, const std::string &fname, size_t file_offset = 0)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      Submit(const_cast<void *>(static_cast<const void *>(t.Data())),
+             static_cast<size_t>(t.TotalSize()) * sizeof(typename TensorType::value_type),
+             t.IsContiguous(), fname, file_offset, true);
+    }
+
+    /**
+     * @brief Enqueue a read of a NPY file into a tensor
+     *
+     * The header is parsed on the host. If the file's dtype matches the tensor
+     * the payload is read like Read(); otherwise the stream is synchronized and
+     * the file is converted with read_npy.
+     *
+     * @tparam TensorType Type of tensor
+     * @param t Tensor with the same shape as the array in the file
+     * @param fname File to read
+     */
+    template <typename TensorType>
+    void ReadNpy(TensorType &t, const std::string &fname)
+    {
+      using T = typename TensorType::value_type;
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+      const auto hdr = ReadNpyHeader(fname);
+      matx::detail::NpyCheckLayout(t, hdr, fname);
+      if (cuda::std::is_same_v<matx::detail::npy_storage_t<T>, T> &&
+          hdr.descr == matx::detail::NpyDescrOf<matx::detail::npy_storage_t<T>>() && t.IsContiguous()) {
+        Read(t, fname, hdr.data_offset);
+      }
+      else {
+        MATX_CUDA_CHECK(cudaStreamSynchronize(stream_));
+        read_npy(t, fname, stream_);
+      }
+    }
+
+    /**
+     * @brief Enqueue a write of a tensor to a NPY file
+     *
+     * The header is written from the host immediately and the payload is
+     * written like Write(). Types numpy cannot store natively are converted
+     * synchronously with write_npy.
+     *
+     * @tparam TensorType Type of tensor
+     * @param t Tensor to write
+     * @param fname File to write
+     */
+    template <typename TensorType>
+    void WriteNpy(const TensorType &t, const std::string &fname)
+    {
+      using T = typename TensorType::value_type;
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+      if (!cuda::std::is_same_v<matx::detail::npy_storage_t<T>, T> || !t.IsContiguous()) {
+        MATX_CUDA_CHECK(cudaStreamSynchronize(stream_));
+        write_npy(t, fname, stream_);
+        return;
+      }
+
+      std::string header = matx::detail::NpyMakeHeader(t);
+      const int fd = open(fname.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      const bool ok = fd >= 0 && matx::detail::FullFileIO(fd, header.data(), header.size(), 0, true);
+      if (fd >= 0) {
+        close(fd);
+      }
+      if (!ok) {
+        const std::string errorMessage = "Failed to write [" + fname + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      Write(t, fname, header.size());
+    }
+
+    /**
+     * @brief Wait for every enqueued transfer to finish
+     *
+     * Synchronizes the stream, closes the files, and throws if any transfer
+     * moved fewer bytes than requested.
+     */
+    void Wait()
+    {
+      MATX_CUDA_CHECK(cudaStreamSynchronize(stream_));
+
+      std::string failed;
+      for (const auto &op : ops_) {
+        if (op.bytes != static_cast<ssize_t>(op.size)) {
+          failed = op.fname;
+        }
+      }
+
+      Release();
+      if (!failed.empty()) {
+        const std::string errorMessage = "Incomplete transfer for [" + failed + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+    }
+
+    /**
+     * @brief Number of transfers submitted since the last Wait()
+     */
+    size_t Size() const { return ops_.size(); }
+
+    /**
+     * @brief Number of transfers since the last Wait() that went through GPUDirect Storage
+     */
+    size_t NumDirect() const
+    {
+      size_t n = 0;
+      for (const auto &op : ops_) {
+        n += op.direct_fd >= 0 ? 1 : 0;
+      }
+      return n;
+    }
+
+  private:
+    matx::detail::NpyHeader ReadNpyHeader(const std::string &fname)
+    {
+      const int fd = open(fname.c_str(), O_RDONLY);
+      if (fd < 0) {
+        const std::string errorMessage = "Failed to read [" + fname + "], Does not Exist";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      struct stat st;
+      fstat(fd, &st);
+      const size_t file_size = static_cast<size_t>(st.st_size);
+
+      // Most headers fit in the first page; longer ones are re-read once their length is known
+      std::vector<uint8_t> buf(std::min<size_t>(file_size, 4096));
+      bool ok = matx::detail::FullFileIO(fd, buf.data(), buf.size(), 0, false);
+      if (ok && buf.size() >= 12) {
+        const size_t need = buf[6] == 1 ? size_t{10} + matx::detail::NpyLoadLE<uint16_t>(buf.data() + 8)
+                                        : size_t{12} + matx::detail::NpyLoadLE<uint32_t>(buf.data() + 8);
+        if (need > buf.size() && need <= file_size) {
+          buf.resize(need);
+          ok = matx::detail::FullFileIO(fd, buf.data(), buf.size(), 0, false);
+        }
+      }
+      close(fd);
+
+      if (!ok) {
+        const std::string errorMessage = "Failed to read [" + fname + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      return matx::detail::ParseNpyHeader(buf.data(), file_size, fname);
+    }
+
+    void Submit(void *ptr, size_t bytes, bool contiguous, const std::string &fname,
+                size_t file_offset, bool write)
+    {
+      MATX_ASSERT_STR(contiguous, matxInvalidParameter, "gdsBatch transfers require a contiguous tensor");
+
+      auto &op = ops_.emplace_back();
+      op.fname = fname;
+      op.write = write;
+      op.size = bytes;
+      op.file_offset = static_cast<off_t>(file_offset);
+
+      const int flags = write ? (O_WRONLY | O_CREAT | (file_offset == 0 ? O_TRUNC : 0)) : O_RDONLY;
+      op.fd = open(fname.c_str(), flags, 0644);
+      if (op.fd < 0) {
+        ops_.pop_back();
+        const std::string errorMessage = "Failed to open [" + fname + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      if (!write) {
+        struct stat st;
+        if (fstat(op.fd, &st) != 0 || static_cast<size_t>(st.st_size) < file_offset + bytes) {
+          close(op.fd);
+          ops_.pop_back();
+          const std::string errorMessage = "File [" + fname + "] is shorter than the requested read";
+          MATX_THROW(matxIOError, errorMessage.c_str());
+        }
+      }
+
+      if (!matx::detail::IsDeviceOnlyPointer(ptr)) {
+        // Earlier work on the stream may still be producing or consuming the buffer
+        MATX_CUDA_CHECK(cudaStreamSynchronize(stream_));
+        if (matx::detail::FullFileIO(op.fd, ptr, bytes, op.file_offset, write)) {
+          op.bytes = static_cast<ssize_t>(bytes);
+        }
+        return;
+      }
+
+      if (SubmitDirect(op, ptr)) {
+        return;
+      }
+
+      if (write) {
+        BounceWrite(op, static_cast<const uint8_t *>(ptr));
+      }
+      else {
+        BounceRead(op, static_cast<uint8_t *>(ptr));
+      }
+    }
+
+    bool SubmitDirect([[maybe_unused]] matx::detail::GdsOp &op, [[maybe_unused]] void *ptr)
+    {
+#ifdef MATX_EN_CUFILE
+      if (!matx::detail::CuFileDriverReady()) {
+        return false;
+      }
+
+      op.direct_fd = open(op.fname.c_str(), (op.write ? O_WRONLY : O_RDONLY) | O_DIRECT);
+      if (op.direct_fd < 0) {
+        return false;
+      }
+
+      CUfileDescr_t descr{};
+      descr.handle.fd = op.direct_fd;
+      descr.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+      CUfileError_t st = cuFileHandleRegister(&op.handle, &descr);
+      if (st.err == CU_FILE_SUCCESS) {
+        st = op.write ? cuFileWriteAsync(op.handle, ptr, &op.size, &op.file_offset, &op.buf_offset, &op.bytes, stream_)
+                      : cuFileReadAsync(op.handle, ptr, &op.size, &op.file_offset, &op.buf_offset, &op.bytes, stream_);
+        if (st.err == CU_FILE_SUCCESS) {
+          return true;
+        }
+        cuFileHandleDeregister(op.handle);
+        op.handle = nullptr;
+      }
+
+      MATX_LOG_DEBUG("cuFile could not be used for {} ({}); using bounce buffers", op.fname, static_cast<int>(st.err));
+      close(op.direct_fd);
+      op.direct_fd = -1;
+#endif
+      return false;
+    }
+
+    void EnsureStaging()
+    {
+      if (staging_[0] != nullptr) {
+        return;
+      }
+
+      for (int b = 0; b < 2; b++) {
+        matxAlloc(reinterpret_cast<void **>(&staging_[b]), matx::detail::NPY_STAGING_BYTES, MATX_HOST_MEMORY);
+        MATX_CUDA_CHECK(cudaEventCreateWithFlags(&done_[b], cudaEventDisableTiming));
+      }
+    }
+
+    void BounceRead(matx::detail::GdsOp &op, uint8_t *dst)
+    {
+      EnsureStaging();
+
+      constexpr size_t chunk = matx::detail::NPY_STAGING_BYTES;
+      for (size_t first = 0; first < op.size; first += chunk, cur_ ^= 1) {
+        const size_t count = std::min(chunk, op.size - first);
+        MATX_CUDA_CHECK(cudaEventSynchronize(done_[cur_]));
+        if (!matx::detail::FullFileIO(op.fd, staging_[cur_], count, op.file_offset + static_cast<off_t>(first), false)) {
+          return;
+        }
+        MATX_CUDA_CHECK(cudaMemcpyAsync(dst + first, staging_[cur_], count, cudaMemcpyHostToDevice, stream_));
+        MATX_CUDA_CHECK(cudaEventRecord(done_[cur_], stream_));
+      }
+
+      op.bytes = static_cast<ssize_t>(op.size);
+    }
+
+    void BounceWrite(matx::detail::GdsOp &op, const uint8_t *src)
+    {
+      EnsureStaging();
+
+      // Copy chunk k+1 to the host while chunk k is written to the file
+      constexpr size_t chunk = matx::detail::NPY_STAGING_BYTES;
+      const auto copy_chunk = [&](size_t first, int b) {
+        const size_t count = std::min(chunk, op.size - first);
+        MATX_CUDA_CHECK(cudaMemcpyAsync(staging_[b], src + first, count, cudaMemcpyDeviceToHost, stream_));
+        MATX_CUDA_CHECK(cudaEventRecord(done_[b], stream_));
+      };
+
+      if (op.size > 0) {
+        copy_chunk(0, cur_);
+      }
+      for (size_t first = 0; first < op.size; first += chunk, cur_ ^= 1) {
+        const size_t count = std::min(chunk, op.size - first);
+        if (first + chunk < op.size) {
+          copy_chunk(first + chunk, cur_ ^ 1);
+        }
+        MATX_CUDA_CHECK(cudaEventSynchronize(done_[cur_]));
+        if (!matx::detail::FullFileIO(op.fd, staging_[cur_], count, op.file_offset + static_cast<off_t>(first), true)) {
+          MATX_CUDA_CHECK(cudaStreamSynchronize(stream_));
+          return;
+        }
+      }
+
+      op.bytes = static_cast<ssize_t>(op.size);
+    }
+
+    void Release()
+    {
+      for (auto &op : ops_) {
+#ifdef MATX_EN_CUFILE
+        if (op.handle != nullptr) {
+          cuFileHandleDeregister(op.handle);
+        }
+#endif
+        if (op.direct_fd >= 0) {
+          close(op.direct_fd);
+        }
+        if (op.fd >= 0) {
+          close(op.fd);
+        }
+      }
+      ops_.clear();
+    }
+
+    cudaStream_t stream_;
+    std::deque<matx::detail::GdsOp> ops_;
+    uint8_t *staging_[2] = {nullptr, nullptr};
+    cudaEvent_t done_[2];
+    int cur_ = 0;
+};
+
+/**
+ * @brief Read raw bytes from a file into a tensor
+ *
+ * Uses GPUDirect Storage for device tensors when available (see gds_available)
+ * and pinned bounce buffers otherwise. Returns once the data is in the tensor.
+ *
+ * @tparam TensorType Type of tensor
+ * @param t Contiguous tensor to fill. Its size determines how many bytes are read
+ * @param fname File to read
+ * @param file_offset Byte offset in the file to start reading from
+ * @param stream CUDA stream to order the read on
+ */
+template <typename TensorType>
+void read_raw(TensorType &t, const std::string &fname, size_t file_offset = 0, cudaStream_t stream = 0)
+{
+  gdsBatch batch(stream);
+  batch.Read(t, fname, file_offset);
+  batch.Wait();
+}
+
+/**
+ * @brief Write a tensor's raw bytes to a file
+ *
+ * Uses GPUDirect Storage for device tensors when available (see gds_available)
+ * and pinned bounce buffers otherwise. Returns once the data is in the file.
+ *
+ * @tparam TensorType Type of tensor
+ * @param t Contiguous tensor to write
+ * @param fname File to write. It is created if needed, and truncated if file_offset is 0
+ * @param file_offset Byte offset in the file to start writing at
+ * @param stream CUDA stream to order the write on
+ */
+template <typename TensorType>
+void write_raw(const TensorType &t, const std::string &fname, size_t file_offset = 0, cudaStream_t stream = 0)
+{
+  gdsBatch batch(stream);
+  batch.Write(t, fname, file_offset);
+  batch.Wait();
+}
+
+}; // namespace io
+}; // namespace matx
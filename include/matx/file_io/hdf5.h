@@ -0,0 +1,564 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#if defined(MATX_EN_HDF5) || defined(DOXYGEN_ONLY)
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <hdf5.h>
+#include <zlib.h>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/executors/host_thread_pool.h"
+#include "matx/file_io/gds.h"
+
+#define MATX_CHECK_HDF5(call, msg)                                     \
+  do {                                                                 \
+    if ((call) < 0) {                                                  \
+      MATX_THROW(matx::matxIOError, std::string("HDF5: ") + (msg));    \
+    }                                                                  \
+  } while (0)
+
+namespace matx {
+namespace detail {
+
+/**
+ * @brief Closes an HDF5 identifier when it goes out of scope
+ */
+class H5Id {
+  public:
+    H5Id() = default;
+    H5Id(hid_t id, herr_t (*close)(hid_t)) : id_(id), close_(close) {}
+    ~H5Id() { reset(); }
+    H5Id(const H5Id &) = delete;
+    H5Id &operator=(const H5Id &) = delete;
+    H5Id(H5Id &&o) noexcept : id_(o.id_), close_(o.close_) { o.id_ = H5I_INVALID_HID; }
+    H5Id &operator=(H5Id &&o) noexcept {
+      if (this != &o) {
+        reset();
+        id_ = o.id_;
+        close_ = o.close_;
+        o.id_ = H5I_INVALID_HID;
+      }
+      return *this;
+    }
+
+    void reset() {
+      if (id_ >= 0 && close_ != nullptr) {
+        close_(id_);
+      }
+      id_ = H5I_INVALID_HID;
+    }
+
+    operator hid_t() const { return id_; }
+    bool valid() const { return id_ >= 0; }
+
+  private:
+    hid_t id_ = H5I_INVALID_HID;
+    herr_t (*close_)(hid_t) = nullptr;
+};
+
+/**
+ * @brief HDF5 memory type for a MatX element type
+ *
+ * Complex types map to a compound of "real" and "imag" members, the layout MATLAB uses in v7.3 MAT-files.
+ */
+template <typename T>
+H5Id Hdf5MemType()
+{
+  const auto native = [](hid_t t) { return H5Id(H5Tcopy(t), H5Tclose); };
+  if constexpr (std::is_same_v<T, float>) { return native(H5T_NATIVE_FLOAT); }
+  else if constexpr (std::is_same_v<T, double>) { return native(H5T_NATIVE_DOUBLE); }
+  else if constexpr (std::is_same_v<T, int8_t>) { return native(H5T_NATIVE_INT8); }
+  else if constexpr (std::is_same_v<T, uint8_t>) { return native(H5T_NATIVE_UINT8); }
+  else if constexpr (std::is_same_v<T, int16_t>) { return native(H5T_NATIVE_INT16); }
+  else if constexpr (std::is_same_v<T, uint16_t>) { return native(H5T_NATIVE_UINT16); }
+  else if constexpr (std::is_same_v<T, int32_t>) { return native(H5T_NATIVE_INT32); }
+  else if constexpr (std::is_same_v<T, uint32_t>) { return native(H5T_NATIVE_UINT32); }
+  else if constexpr (std::is_same_v<T, int64_t>) { return native(H5T_NATIVE_INT64); }
+  else if constexpr (std::is_same_v<T, uint64_t>) { return native(H5T_NATIVE_UINT64); }
+  else if constexpr (is_complex_v<T>) {
+    using R = typename T::value_type;
+    static_assert(std::is_same_v<R, float> || std::is_same_v<R, double>, "Unsupported complex type for HDF5");
+    H5Id t(H5Tcreate(H5T_COMPOUND, sizeof(T)), H5Tclose);
+    const hid_t r = std::is_same_v<R, float> ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE;
+    H5Tinsert(t, "real", 0, r);
+    H5Tinsert(t, "imag", sizeof(R), r);
+    return t;
+  }
+  else {
+    static_assert(!sizeof(T), "Unsupported element type for HDF5");
+  }
+}
+
+/**
+ * @brief Undo the HDF5 shuffle filter, which groups byte k of every element together
+ */
+inline void Hdf5Unshuffle(const uint8_t *in, uint8_t *out, size_t bytes, size_t elem_size)
+{
+  const size_t n = bytes / elem_size;
+  for (size_t b = 0; b < elem_size; b++) {
+    for (size_t i = 0; i < n; i++) {
+      out[i * elem_size + b] = in[b * n + i];
+    }
+  }
+  // Trailing bytes that do not form a whole element are stored unshuffled
+  std::memcpy(out + n * elem_size, in + n * elem_size, bytes - n * elem_size);
+}
+
+} // namespace detail
+
+namespace io {
+
+/**
+ * @brief Native reader for HDF5 files, including MATLAB v7.3 MAT-files
+ *
+ * Reads whole datasets or hyperslabs directly into tensors in host, pinned, managed, or device memory without
+ * Python. Chunked datasets whose file type matches the tensor and whose filters are limited to deflate and shuffle
+ * take a parallel path: raw chunks are read with H5Dread_chunk, which is serialized since HDF5 is not assumed to
+ * be thread-safe, and decompressed and scattered into the destination on a pool of host threads. Other datasets
+ * are read with a single H5Dread of the hyperslab, which also converts between types.
+ *
+ * Tensors must be contiguous. Tensors in device memory are filled through a pinned staging buffer and a copy on
+ * the stream passed to the read, which is synchronized before returning.
+ *
+ * MATLAB stores arrays column-major, so a MATLAB variable of size [a b c] is an HDF5 dataset of shape {c, b, a}.
+ * Dataset shapes here are always HDF5's. Complex values are read from compounds with "real" and "imag" members.
+ */
+class hdf5File {
+  public:
+    /**
+     * @brief Open a file for reading
+     *
+     * @param fname File name
+     * @param threads Host threads used to decompress chunks. 0 uses the hardware concurrency
+     */
+    explicit hdf5File(const std::string &fname, int threads = 0) {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      file_ = detail::H5Id(H5Fopen(fname.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT), H5Fclose);
+      MATX_ASSERT_STR(file_.valid(), matxIOError, "Failed to open HDF5 file " + fname);
+
+      if (threads <= 0) {
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+      }
+      threads_ = threads;
+      if (threads_ > 1) {
+        pool_ = std::make_unique<detail::HostThreadPool>(std::vector<int>(static_cast<size_t>(threads_), -1));
+      }
+    }
+
+    /**
+     * @brief Shape of a dataset
+     *
+     * @param dataset Path of the dataset in the file
+     * @returns Size of each dimension in HDF5 order
+     */
+    std::vector<index_t> Shape(const std::string &dataset) const {
+      auto dset = Open(dataset);
+      detail::H5Id space(H5Dget_space(dset), H5Sclose);
+      const int rank = H5Sget_simple_extent_ndims(space);
+      MATX_ASSERT_STR(rank >= 0, matxIOError, "Failed to get the rank of " + dataset);
+      std::vector<hsize_t> dims(static_cast<size_t>(rank));
+      H5Sget_simple_extent_dims(space, dims.data(), nullptr);
+      return std::vector<index_t>(dims.begin(), dims.end());
+    }
+
+    /**
+     * @brief Read a hyperslab of a dataset into a tensor
+     *
+     * The hyperslab has the tensor's shape and starts at ``start`` in the dataset. With an empty ``start`` the
+     * read begins at the origin, so a tensor with the dataset's shape reads the whole dataset.
+     *
+     * @param t Destination tensor with the same rank as the dataset
+     * @param dataset Path of the dataset in the file
+     * @param start First index of the hyperslab in each dimension
+     * @param stream Stream used to copy into device memory
+     */
+    template <typename TensorType>
+    void Read(TensorType &t, const std::string &dataset, const std::vector<index_t> &start = {},
+              cudaStream_t stream = 0) {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      using T = typename TensorType::value_type;
+      constexpr int RANK = TensorType::Rank();
+
+      auto dset = Open(dataset);
+      detail::H5Id fspace(H5Dget_space(dset), H5Sclose);
+      MATX_ASSERT_STR(H5Sget_simple_extent_ndims(fspace) == RANK, matxInvalidDim,
+                      "Tensor rank does not match the rank of " + dataset);
+
+      std::vector<hsize_t> dims(RANK), off(RANK, 0), count(RANK);
+      H5Sget_simple_extent_dims(fspace, dims.data(), nullptr);
+      MATX_ASSERT_STR(start.empty() || start.size() == static_cast<size_t>(RANK), matxInvalidDim,
+                      "Hyperslab start must have one entry per dimension");
+      for (int d = 0; d < RANK; d++) {
+        off[d] = start.empty() ? 0 : static_cast<hsize_t>(start[d]);
+        count[d] = static_cast<hsize_t>(t.Size(d));
+        MATX_ASSERT_STR(off[d] + count[d] <= dims[d], matxInvalidSize, "Hyperslab exceeds the extent of " + dataset);
+      }
+      if (t.TotalSize() == 0) {
+        return;
+      }
+
+      // Host-accessible tensors are filled in place. Device tensors go through pinned staging
+      MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter, "HDF5 reads require a contiguous tensor");
+      const bool device = detail::IsDeviceOnlyPointer(t.Data());
+      tensor_t<T, 1> staging;
+      T *dst = t.Data();
+      if (device) {
+        make_tensor(staging, {t.TotalSize()}, MATX_HOST_MEMORY);
+        dst = staging.Data();
+      }
+
+      auto memtype = detail::Hdf5MemType<T>();
+      if (!ReadChunksParallel(dset, memtype, dims, off, count, reinterpret_cast<uint8_t *>(dst), sizeof(T))) {
+        detail::H5Id mspace(H5Screate_simple(RANK, count.data(), nullptr), H5Sclose);
+        MATX_CHECK_HDF5(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, off.data(), nullptr, count.data(), nullptr),
+                        "failed to select hyperslab");
+        MATX_CHECK_HDF5(H5Dread(dset, memtype, mspace, fspace, H5P_DEFAULT, dst), "failed to read " + dataset);
+      }
+
+      if (device) {
+        MATX_CUDA_CHECK(cudaMemcpyAsync(t.Data(), dst, t.TotalSize() * sizeof(T), cudaMemcpyHostToDevice, stream));
+        MATX_CUDA_CHECK(cudaStreamSynchronize(stream));
+      }
+    }
+
+  private:
+    detail::H5Id Open(const std::string &dataset) const {
+      detail::H5Id dset(H5Dopen2(file_, dataset.c_str(), H5P_DEFAULT), H5Dclose);
+      MATX_ASSERT_STR(dset.valid(), matxIOError, "Failed to open HDF5 dataset " + dataset);
+      return dset;
+    }
+
+    /**
+     * Read a hyperslab chunk by chunk, decompressing on the thread pool. Returns false without reading anything
+     * if the dataset is not eligible, in which case the caller falls back to H5Dread.
+     */
+    bool ReadChunksParallel(hid_t dset, hid_t memtype, const std::vector<hsize_t> &dims,
+                            const std::vector<hsize_t> &off, const std::vector<hsize_t> &count,
+                            uint8_t *dst, size_t elem_size) {
+      const int rank = static_cast<int>(dims.size());
+      if (rank == 0) {
+        return false;
+      }
+
+      detail::H5Id dcpl(H5Dget_create_plist(dset), H5Pclose);
+      if (H5Pget_layout(dcpl) != H5D_CHUNKED) {
+        return false;
+      }
+
+      // Raw chunks hold the file type, so it must match the memory type exactly
+      detail::H5Id ftype(H5Dget_type(dset), H5Tclose);
+      if (H5Tequal(ftype, memtype) <= 0) {
+        return false;
+      }
+
+      std::vector<H5Z_filter_t> filters;
+      const int nfilters = H5Pget_nfilters(dcpl);
+      for (int i = 0; i < nfilters; i++) {
+        unsigned int flags;
+        size_t cd_nelmts = 0;
+        unsigned int config;
+        const H5Z_filter_t f = H5Pget_filter2(dcpl, static_cast<unsigned>(i), &flags, &cd_nelmts, nullptr, 0,
+                                              nullptr, &config);
+        if (f != H5Z_FILTER_DEFLATE && f != H5Z_FILTER_SHUFFLE) {
+          return false;
+        }
+        filters.push_back(f);
+      }
+
+      std::vector<hsize_t> chunk(static_cast<size_t>(rank));
+      H5Pget_chunk(dcpl, rank, chunk.data());
+      size_t chunk_elems = 1;
+      for (auto c : chunk) {
+        chunk_elems *= c;
+      }
+      const size_t chunk_bytes = chunk_elems * elem_size;
+
+      // Chunk grid coordinates covering the hyperslab
+      std::vector<hsize_t> first(rank), last(rank);
+      size_t num_chunks = 1;
+      for (int d = 0; d < rank; d++) {
+        first[d] = off[d] / chunk[d];
+        last[d] = (off[d] + count[d] - 1) / chunk[d];
+        num_chunks *= last[d] - first[d] + 1;
+      }
+
+      struct RawChunk {
+        std::vector<hsize_t> origin;
+        std::vector<uint8_t> data;
+        uint32_t mask = 0;
+      };
+
+      // Bound the raw bytes held at once to a few chunks per thread
+      const size_t batch = static_cast<size_t>(threads_) * 4;
+      std::vector<RawChunk> raw(batch);
+      std::vector<hsize_t> grid(first);
+
+      for (size_t base = 0; base < num_chunks; base += batch) {
+        const size_t n = std::min(batch, num_chunks - base);
+        for (size_t c = 0; c < n; c++) {
+          auto &rc = raw[c];
+          rc.origin.resize(static_cast<size_t>(rank));
+          for (int d = 0; d < rank; d++) {
+            rc.origin[d] = grid[d] * chunk[d];
+          }
+
+          hsize_t stored = 0;
+          MATX_CHECK_HDF5(H5Dget_chunk_storage_size(dset, rc.origin.data(), &stored), "failed to get chunk size");
+          if (stored == 0) {
+            // Never written: leave data empty and fill with zeros below
+            rc.data.clear();
+          }
+          else {
+            rc.data.resize(stored);
+            MATX_CHECK_HDF5(H5Dread_chunk(dset, H5P_DEFAULT, rc.origin.data(), &rc.mask, rc.data.data()),
+                            "failed to read chunk");
+          }
+
+          // Advance to the next chunk in row-major order
+          for (int d = rank - 1; d >= 0; d--) {
+            if (++grid[d] <= last[d]) {
+              break;
+            }
+            grid[d] = first[d];
+          }
+        }
+
+        // Workers cannot throw across the pool, so failures are collected and reported here
+        std::atomic<bool> failed{false};
+        auto decode = [&](index_t c) {
+          if (!DecodeChunk(raw[static_cast<size_t>(c)], filters, chunk, chunk_bytes, elem_size, off, count, dst)) {
+            failed = true;
+          }
+        };
+        if (pool_ && n > 1) {
+          pool_->ParallelFor(static_cast<index_t>(n), decode);
+        }
+        else {
+          for (size_t c = 0; c < n; c++) {
+            decode(static_cast<index_t>(c));
+          }
+        }
+        MATX_ASSERT_STR(!failed.load(), matxIOError, "HDF5: failed to decode a chunk");
+      }
+
+      return true;
+    }
+
+    template <typename RawChunk>
+    static bool DecodeChunk(const RawChunk &rc, const std::vector<H5Z_filter_t> &filters,
+                            const std::vector<hsize_t> &chunk, size_t chunk_bytes, size_t elem_size,
+                            const std::vector<hsize_t> &off, const std::vector<hsize_t> &count, uint8_t *dst) {
+      const int rank = static_cast<int>(chunk.size());
+
+      // Undo the filters in reverse pipeline order, skipping those the chunk's mask says were not applied
+      std::vector<uint8_t> buf;
+      std::vector<uint8_t> tmp;
+      if (rc.data.empty()) {
+        buf.assign(chunk_bytes, 0);
+      }
+      else {
+        buf = rc.data;
+        for (int i = static_cast<int>(filters.size()) - 1; i >= 0; i--) {
+          if (rc.mask & (1u << i)) {
+            continue;
+          }
+          tmp.resize(chunk_bytes);
+          if (filters[static_cast<size_t>(i)] == H5Z_FILTER_DEFLATE) {
+            uLongf out_len = static_cast<uLongf>(chunk_bytes);
+            if (uncompress(tmp.data(), &out_len, buf.data(), static_cast<uLong>(buf.size())) != Z_OK) {
+              return false;
+            }
+            tmp.resize(out_len);
+          }
+          else {
+            detail::Hdf5Unshuffle(buf.data(), tmp.data(), buf.size(), elem_size);
+            tmp.resize(buf.size());
+          }
+          buf.swap(tmp);
+        }
+        if (buf.size() < chunk_bytes) {
+          return false;
+        }
+      }
+
+      // Intersection of the chunk with the hyperslab, relative to both
+      std::vector<hsize_t> lo(rank), hi(rank);
+      for (int d = 0; d < rank; d++) {
+        lo[d] = std::max(rc.origin[d], off[d]);
+        hi[d] = std::min(rc.origin[d] + chunk[d], off[d] + count[d]);
+      }
+
+      // Copy contiguous runs along the last dimension
+      const size_t run = (hi[rank - 1] - lo[rank - 1]) * elem_size;
+      std::vector<hsize_t> idx(lo);
+      while (true) {
+        size_t src = 0;
+        size_t dst_off = 0;
+        for (int d = 0; d < rank; d++) {
+          src = src * chunk[d] + (idx[d] - rc.origin[d]);
+          dst_off = dst_off * count[d] + (idx[d] - off[d]);
+        }
+        std::memcpy(dst + dst_off * elem_size, buf.data() + src * elem_size, run);
+
+        int d = rank - 2;
+        for (; d >= 0; d--) {
+          if (++idx[d] < hi[d]) {
+            break;
+          }
+          idx[d] = lo[d];
+        }
+        if (d < 0) {
+          break;
+        }
+      }
+
+      return true;
+    }
+
+    detail::H5Id file_;
+    int threads_ = 1;
+    std::unique_ptr<detail::HostThreadPool> pool_;
+};
+
+/**
+ * @brief Stream a large dataset in blocks along its first dimension
+ *
+ * Each call to Next() reads the following rows of the dataset into the block tensor given at construction,
+ * which can live in pinned or device memory and is reused for every block. The last block may be partial.
+ *
+ * @tparam T Element type
+ * @tparam RANK Dataset rank
+ */
+template <typename T, int RANK>
+class hdf5BlockReader {
+  public:
+    /**
+     * @brief Set up a block reader
+     *
+     * @param file Open file, which must outlive the reader
+     * @param dataset Path of the dataset
+     * @param block Tensor receiving each block. Its shape is the block shape, with the dataset's extent in every
+     *   dimension but the first
+     * @param stream Stream used to copy into device memory
+     */
+    hdf5BlockReader(hdf5File &file, const std::string &dataset, tensor_t<T, RANK> block, cudaStream_t stream = 0) :
+        file_(file), dataset_(dataset), block_(block), stream_(stream) {
+      static_assert(RANK > 0, "hdf5BlockReader requires a dataset of rank 1 or higher");
+      MATX_ASSERT_STR(block_.IsContiguous(), matxInvalidParameter, "hdf5BlockReader requires a contiguous block");
+      const auto shape = file_.Shape(dataset_);
+      MATX_ASSERT_STR(shape.size() == static_cast<size_t>(RANK), matxInvalidDim, "Block rank does not match the dataset");
+      for (int d = 1; d < RANK; d++) {
+        MATX_ASSERT_STR(shape[d] == block_.Size(d), matxInvalidSize, "Block must span the dataset in all but the first dimension");
+      }
+      rows_ = shape[0];
+    }
+
+    /**
+     * @brief Read the next block
+     *
+     * @returns Number of rows read into the start of the block, or 0 once the dataset is exhausted
+     */
+    index_t Next() {
+      if (pos_ >= rows_) {
+        return 0;
+      }
+
+      const index_t n = std::min(block_.Size(0), rows_ - pos_);
+      std::vector<index_t> start(RANK, 0);
+      start[0] = pos_;
+
+      cuda::std::array<index_t, RANK> shape;
+      for (int d = 0; d < RANK; d++) {
+        shape[d] = block_.Size(d);
+      }
+      shape[0] = n;
+      auto view = make_tensor<T>(block_.Data(), shape);
+      file_.Read(view, dataset_, start, stream_);
+
+      pos_ += n;
+      return n;
+    }
+
+    /**
+     * @brief Tensor holding the current block
+     */
+    tensor_t<T, RANK> &Block() { return block_; }
+
+    /**
+     * @brief Restart from the first row
+     */
+    void Reset() { pos_ = 0; }
+
+  private:
+    hdf5File &file_;
+    std::string dataset_;
+    tensor_t<T, RANK> block_;
+    cudaStream_t stream_;
+    index_t rows_ = 0;
+    index_t pos_ = 0;
+};
+
+/**
+ * @brief Read a variable from a MATLAB v7.3 MAT-file into a tensor
+ *
+ * v7.3 MAT-files are HDF5 files with one dataset per variable, which this reads natively rather than through
+ * SciPy (which cannot open them). The tensor's shape is the reverse of the MATLAB size of the variable.
+ *
+ * @param t Destination tensor
+ * @param fname File name
+ * @param var Variable name
+ * @param stream Stream used to copy into device memory
+ */
+template <typename TensorType>
+void read_mat73(TensorType &t, const std::string &fname, const std::string &var, cudaStream_t stream = 0)
+{
+  hdf5File f(fname);
+  f.Read(t, "/" + var, {}, stream);
+}
+
+} // namespace io
+} // namespace matx
+
+#endif
@@ -0,0 +1,852 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "matx/core/allocator.h"
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/operator_utils.h"
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+/**
+ * Size of each pinned staging buffer used when moving NPY payloads between
+ * a mapped file and device memory. Two buffers are used so the host-side copy
+ * of one chunk overlaps the DMA of the previous one.
+ */
+static constexpr size_t NPY_STAGING_BYTES = 8 * 1024 * 1024;
+
+/**
+ * @brief NPY descriptor string for a type stored natively in a .npy file
+ *
+ * Only little-endian layouts are described since that is the byte order of
+ * every platform MatX runs on.
+ */
+template <typename T>
+constexpr const char *NpyDescrOf()
+{
+  if constexpr (cuda::std::is_same_v<T, bool>) {
+    return "|b1";
+  }
+  else if constexpr (cuda::std::is_integral_v<T> && cuda::std::is_signed_v<T>) {
+    static_assert(sizeof(T) <= 8);
+    return sizeof(T) == 1 ? "|i1" : sizeof(T) == 2 ? "<i2" : sizeof(T) == 4 ? "<i4" : "<i8";
+  }
+  else if constexpr (cuda::std::is_integral_v<T>) {
+    static_assert(sizeof(T) <= 8);
+    return sizeof(T) == 1 ? "|u1" : sizeof(T) == 2 ? "<u2" : sizeof(T) == 4 ? "<u4" : "<u8";
+  }
+  else if constexpr (cuda::std::is_same_v<T, matxFp16>) {
+    return "<f2";
+  }
+  else if constexpr (cuda::std::is_same_v<T, float>) {
+    return "<f4";
+  }
+  else if constexpr (cuda::std::is_same_v<T, double>) {
+    return "<f8";
+  }
+  else if constexpr (cuda::std::is_same_v<T, cuda::std::complex<float>>) {
+    return "<c8";
+  }
+  else {
+    static_assert(cuda::std::is_same_v<T, cuda::std::complex<double>>, "Type has no NPY representation");
+    return "<c16";
+  }
+}
+
+/**
+ * @brief Type used to store T in a .npy file
+ *
+ * numpy has no bfloat16 or complex half type, so those are widened to the
+ * nearest single-precision type on write.
+ */
+template <typename T> struct npy_storage { using type = T; };
+template <> struct npy_storage<matxBf16> { using type = float; };
+template <> struct npy_storage<matxFp16Complex> { using type = cuda::std::complex<float>; };
+template <> struct npy_storage<matxBf16Complex> { using type = cuda::std::complex<float>; };
+template <typename T> using npy_storage_t = typename npy_storage<cuda::std::remove_cv_t<T>>::type;
+
+/**
+ * @brief Parsed NPY header
+ */
+struct NpyHeader {
+  std::string descr;
+  bool fortran_order = false;
+  std::vector<index_t> shape;
+  size_t data_offset = 0; ///< Offset of the payload from the start of the NPY stream
+  size_t item_size = 0;
+
+  size_t TotalSize() const {
+    size_t n = 1;
+    for (const auto s : shape) {
+      n *= static_cast<size_t>(s);
+    }
+    return n;
+  }
+};
+
+/**
+ * @brief Read-only view of a file mapped into the address space
+ *
+ * The mapping is private and writable, so tensors wrapping it can be modified
+ * in place without the changes reaching the file.
+ */
+class NpyMappedFile {
+  public:
+    explicit NpyMappedFile(const std::string &fname) {
+      if (!std::filesystem::exists(fname)) {
+        const std::string errorMessage = "Failed to read [" + fname + "], Does not Exist";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      fd_ = open(fname.c_str(), O_RDONLY);
+      if (fd_ < 0) {
+        const std::string errorMessage = "Failed to open [" + fname + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      struct stat st;
+      if (fstat(fd_, &st) != 0 || st.st_size == 0) {
+        close(fd_);
+        const std::string errorMessage = "Failed to read [" + fname + "], empty or unreadable file";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      size_ = static_cast<size_t>(st.st_size);
+      void *p = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd_, 0);
+      if (p == MAP_FAILED) {
+        close(fd_);
+        const std::string errorMessage = "Failed to mmap [" + fname + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      data_ = static_cast<uint8_t *>(p);
+    }
+
+    ~NpyMappedFile() {
+      munmap(data_, size_);
+      close(fd_);
+    }
+
+    NpyMappedFile(const NpyMappedFile &) = delete;
+    NpyMappedFile &operator=(const NpyMappedFile &) = delete;
+
+    uint8_t *Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+  private:
+    int fd_ = -1;
+    uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+};
+
+template <typename U>
+__MATX_INLINE__ U NpyLoadLE(const uint8_t *p) {
+  U v;
+  memcpy(&v, p, sizeof(U));
+  return v;
+}
+
+__MATX_INLINE__ size_t NpyDescrItemSize(const std::string &descr) {
+  return static_cast<size_t>(std::stoul(descr.substr(2)));
+}
+
+/**
+ * @brief Locate the value of a key in an NPY header dictionary
+ *
+ * @return Position of the first character after the key's colon, or npos
+ */
+__MATX_INLINE__ size_t NpyFindKey(const std::string &dict, const std::string &key) {
+  for (const char q : {'\'', '"'}) {
+    const std::string quoted = std::string(1, q) + key + std::string(1, q);
+    auto pos = dict.find(quoted);
+    if (pos != std::string::npos) {
+      pos = dict.find(':', pos + quoted.size());
+      return pos == std::string::npos ? pos : pos + 1;
+    }
+  }
+
+  return std::string::npos;
+}
+
+/**
+ * @brief Parse the NPY header at the start of a byte range
+ *
+ * @param p Start of the NPY stream
+ * @param len Bytes available starting at p
+ * @param fname Name used in error messages
+ */
+__MATX_INLINE__ NpyHeader ParseNpyHeader(const uint8_t *p, size_t len, const std::string &fname)
+{
+  static constexpr uint8_t magic[] = {0x93, 'N', 'U', 'M', 'P', 'Y'};
+  const std::string errorPrefix = "Failed to parse NPY header in [" + fname + "]: ";
+
+  if (len < 10 || memcmp(p, magic, sizeof(magic)) != 0) {
+    MATX_THROW(matxIOError, (errorPrefix + "bad magic").c_str());
+  }
+
+  const uint8_t major = p[6];
+  size_t header_len;
+  size_t prefix;
+  if (major == 1) {
+    header_len = NpyLoadLE<uint16_t>(p + 8);
+    prefix = 10;
+  }
+  else if (major == 2 || major == 3) {
+    if (len < 12) {
+      MATX_THROW(matxIOError, (errorPrefix + "truncated header").c_str());
+    }
+    header_len = NpyLoadLE<uint32_t>(p + 8);
+    prefix = 12;
+  }
+  else {
+    MATX_THROW(matxIOError, (errorPrefix + "unsupported version " + std::to_string(major)).c_str());
+  }
+
+  if (prefix + header_len > len) {
+    MATX_THROW(matxIOError, (errorPrefix + "truncated header").c_str());
+  }
+
+  NpyHeader hdr;
+  hdr.data_offset = prefix + header_len;
+  const std::string dict(reinterpret_cast<const char *>(p + prefix), header_len);
+
+  // descr
+  auto pos = NpyFindKey(dict, "descr");
+  if (pos == std::string::npos) {
+    MATX_THROW(matxIOError, (errorPrefix + "missing descr").c_str());
+  }
+  const auto q0 = dict.find_first_of("'\"", pos);
+  const auto q1 = q0 == std::string::npos ? q0 : dict.find(dict[q0], q0 + 1);
+  if (q1 == std::string::npos) {
+    MATX_THROW(matxIOError, (errorPrefix + "descr is not a simple type string").c_str());
+  }
+  hdr.descr = dict.substr(q0 + 1, q1 - q0 - 1);
+  if (hdr.descr.size() < 3) {
+    MATX_THROW(matxIOError, (errorPrefix + "invalid descr " + hdr.descr).c_str());
+  }
+  if (hdr.descr[0] == '=') {
+    hdr.descr[0] = '<';
+  }
+  if (hdr.descr[0] == '>' && hdr.descr.substr(2) != "1") {
+    MATX_THROW(matxNotSupported, (errorPrefix + "big-endian data is not supported").c_str());
+  }
+  hdr.item_size = NpyDescrItemSize(hdr.descr);
+
+  // fortran_order
+  pos = NpyFindKey(dict, "fortran_order");
+  if (pos == std::string::npos) {
+    MATX_THROW(matxIOError, (errorPrefix + "missing fortran_order").c_str());
+  }
+  hdr.fortran_order = dict.compare(dict.find_first_not_of(' ', pos), 4, "True") == 0;
+
+  // shape
+  pos = NpyFindKey(dict, "shape");
+  const auto s0 = pos == std::string::npos ? pos : dict.find('(', pos);
+  const auto s1 = s0 == std::string::npos ? s0 : dict.find(')', s0);
+  if (s1 == std::string::npos) {
+    MATX_THROW(matxIOError, (errorPrefix + "missing shape").c_str());
+  }
+  const std::string shape = dict.substr(s0 + 1, s1 - s0 - 1);
+  size_t i = 0;
+  while (i < shape.size()) {
+    const auto d = shape.find_first_of("0123456789", i);
+    if (d == std::string::npos) {
+      break;
+    }
+    size_t used;
+    hdr.shape.push_back(static_cast<index_t>(std::stoll(shape.substr(d), &used)));
+    i = d + used;
+  }
+
+  if (hdr.data_offset + hdr.TotalSize() * hdr.item_size > len) {
+    MATX_THROW(matxIOError, (errorPrefix + "payload is shorter than its shape").c_str());
+  }
+
+  return hdr;
+}
+
+/**
+ * @brief Find the byte range of a stored member inside an NPZ (zip) archive
+ *
+ * np.savez writes uncompressed members, optionally with zip64 extensions for
+ * large arrays. Deflated members from np.savez_compressed are rejected since
+ * they cannot be mapped.
+ *
+ * @param base Start of the mapped archive
+ * @param size Size of the archive in bytes
+ * @param key Array name, with or without the .npy suffix
+ * @param fname Name used in error messages
+ * @return Pair of member offset and member size in bytes
+ */
+__MATX_INLINE__ std::pair<size_t, size_t> NpzFindMember(const uint8_t *base, size_t size,
+                                                        const std::string &key, const std::string &fname)
+{
+  const std::string errorPrefix = "Failed to read NPZ [" + fname + "]: ";
+  const std::string member = (key.size() > 4 && key.compare(key.size() - 4, 4, ".npy") == 0) ? key : key + ".npy";
+
+  // End of central directory record is at most 64KB + 22 bytes from the end
+  if (size < 22) {
+    MATX_THROW(matxIOError, (errorPrefix + "not a zip archive").c_str());
+  }
+  size_t eocd = size - 22;
+  const size_t eocd_min = size > 65557 ? size - 65557 : 0;
+  while (NpyLoadLE<uint32_t>(base + eocd) != 0x06054b50) {
+    if (eocd == eocd_min) {
+      MATX_THROW(matxIOError, (errorPrefix + "not a zip archive").c_str());
+    }
+    eocd--;
+  }
+
+  uint64_t entries = NpyLoadLE<uint16_t>(base + eocd + 10);
+  uint64_t cd_offset = NpyLoadLE<uint32_t>(base + eocd + 16);
+  if ((entries == 0xFFFF || cd_offset == 0xFFFFFFFF) && eocd >= 20 &&
+      NpyLoadLE<uint32_t>(base + eocd - 20) == 0x07064b50) {
+    const uint64_t z64 = NpyLoadLE<uint64_t>(base + eocd - 20 + 8);
+    if (z64 + 56 > size || NpyLoadLE<uint32_t>(base + z64) != 0x06064b50) {
+      MATX_THROW(matxIOError, (errorPrefix + "corrupt zip64 directory").c_str());
+    }
+    entries = NpyLoadLE<uint64_t>(base + z64 + 32);
+    cd_offset = NpyLoadLE<uint64_t>(base + z64 + 48);
+  }
+
+  size_t p = static_cast<size_t>(cd_offset);
+  for (uint64_t e = 0; e < entries; e++) {
+    if (p + 46 > size || NpyLoadLE<uint32_t>(base + p) != 0x02014b50) {
+      MATX_THROW(matxIOError, (errorPrefix + "corrupt central directory").c_str());
+    }
+
+    const uint16_t method = NpyLoadLE<uint16_t>(base + p + 10);
+    uint64_t comp_size = NpyLoadLE<uint32_t>(base + p + 20);
+    uint64_t uncomp_size = NpyLoadLE<uint32_t>(base + p + 24);
+    const uint16_t name_len = NpyLoadLE<uint16_t>(base + p + 28);
+    const uint16_t extra_len = NpyLoadLE<uint16_t>(base + p + 30);
+    const uint16_t comment_len = NpyLoadLE<uint16_t>(base + p + 32);
+    uint64_t local_offset = NpyLoadLE<uint32_t>(base + p + 42);
+    const std::string name(reinterpret_cast<const char *>(base + p + 46), name_len);
+
+    if (name == member) {
+      // zip64 extra field holds whichever of the 32-bit fields overflowed, in order
+      size_t x = p + 46 + name_len;
+      const size_t x_end = x + extra_len;
+      while (x + 4 <= x_end) {
+        const uint16_t id = NpyLoadLE<uint16_t>(base + x);
+        const uint16_t len = NpyLoadLE<uint16_t>(base + x + 2);
+        if (id == 0x0001) {
+          size_t f = x + 4;
+          if (uncomp_size == 0xFFFFFFFF) { uncomp_size = NpyLoadLE<uint64_t>(base + f); f += 8; }
+          if (comp_size == 0xFFFFFFFF) { comp_size = NpyLoadLE<uint64_t>(base + f); f += 8; }
+          if (local_offset == 0xFFFFFFFF) { local_offset = NpyLoadLE<uint64_t>(base + f); }
+        }
+        x += 4 + len;
+      }
+
+      if (method != 0 || comp_size != uncomp_size) {
+        MATX_THROW(matxNotSupported, (errorPrefix + "member " + member +
+            " is compressed; only np.savez (stored) archives are supported").c_str());
+      }
+
+      const size_t lh = static_cast<size_t>(local_offset);
+      if (lh + 30 > size || NpyLoadLE<uint32_t>(base + lh) != 0x04034b50) {
+        MATX_THROW(matxIOError, (errorPrefix + "corrupt local header for " + member).c_str());
+      }
+      const size_t data = lh + 30 + NpyLoadLE<uint16_t>(base + lh + 26) + NpyLoadLE<uint16_t>(base + lh + 28);
+      if (data + uncomp_size > size) {
+        MATX_THROW(matxIOError, (errorPrefix + "member " + member + " is truncated").c_str());
+      }
+
+      return {data, static_cast<size_t>(uncomp_size)};
+    }
+
+    p += 46 + name_len + extra_len + comment_len;
+  }
+
+  MATX_THROW(matxIOError, (errorPrefix + "no member named " + member).c_str());
+  return {0, 0};
+}
+
+template <typename T, typename S>
+__MATX_INLINE__ T NpyScalarCast(const S &s) {
+  if constexpr (is_matx_half_v<S>) {
+    return NpyScalarCast<T>(static_cast<float>(s));
+  }
+  else if constexpr (is_matx_half_v<T>) {
+    return T{static_cast<float>(s)};
+  }
+  else {
+    return static_cast<T>(s);
+  }
+}
+
+template <typename T, typename S>
+__MATX_INLINE__ T NpyCast(const S &s) {
+  if constexpr (is_complex_v<T>) {
+    using vt = typename T::value_type;
+    if constexpr (is_complex_v<S>) {
+      return T{NpyScalarCast<vt>(s.real()), NpyScalarCast<vt>(s.imag())};
+    }
+    else {
+      return T{NpyScalarCast<vt>(s), NpyScalarCast<vt>(0.0f)};
+    }
+  }
+  else if constexpr (is_complex_v<S>) {
+    // Rejected before conversion starts; see NpyConvert
+    return T{};
+  }
+  else {
+    return NpyScalarCast<T>(s);
+  }
+}
+
+/**
+ * @brief Call f with a value-initialized object of the C++ type matching an NPY descriptor
+ */
+template <typename Func>
+__MATX_INLINE__ void NpyDispatch(const std::string &descr, Func &&f) {
+  const std::string d = descr.substr(1);
+  if (d == "b1") f(bool{});
+  else if (d == "i1") f(int8_t{});
+  else if (d == "u1") f(uint8_t{});
+  else if (d == "i2") f(int16_t{});
+  else if (d == "u2") f(uint16_t{});
+  else if (d == "i4") f(int32_t{});
+  else if (d == "u4") f(uint32_t{});
+  else if (d == "i8") f(int64_t{});
+  else if (d == "u8") f(uint64_t{});
+  else if (d == "f2") f(matxFp16{});
+  else if (d == "f4") f(float{});
+  else if (d == "f8") f(double{});
+  else if (d == "c8") f(cuda::std::complex<float>{});
+  else if (d == "c16") f(cuda::std::complex<double>{});
+  else {
+    MATX_THROW(matxNotSupported, ("Unsupported NPY dtype " + descr).c_str());
+  }
+}
+
+/**
+ * @brief Convert count elements of an NPY payload into T, starting at element first
+ */
+template <typename T>
+__MATX_INLINE__ void NpyConvert(T *dst, const uint8_t *payload, const std::string &descr,
+                                size_t first, size_t count) {
+  if (descr == NpyDescrOf<npy_storage_t<T>>() && cuda::std::is_same_v<npy_storage_t<T>, T>) {
+    memcpy(dst, payload + first * sizeof(T), count * sizeof(T));
+    return;
+  }
+
+  NpyDispatch(descr, [&](auto tag) {
+    using S = decltype(tag);
+    if constexpr (is_complex_v<S> && !is_complex_v<T>) {
+      MATX_THROW(matxInvalidType, ("Cannot read complex NPY dtype " + descr + " into a real tensor").c_str());
+    }
+    else {
+      const uint8_t *src = payload + first * sizeof(S);
+      for (size_t i = 0; i < count; i++) {
+        S s;
+        memcpy(&s, src + i * sizeof(S), sizeof(S));
+        dst[i] = NpyCast<T>(s);
+      }
+    }
+  });
+}
+
+/**
+ * @brief Check that an NPY payload can be read into a tensor of the given shape
+ */
+template <typename TensorType>
+void NpyCheckLayout(const TensorType &t, const NpyHeader &hdr, const std::string &fname)
+{
+  constexpr int RANK = TensorType::Rank();
+
+  if (hdr.fortran_order && hdr.shape.size() > 1) {
+    MATX_THROW(matxNotSupported, ("Fortran-ordered NPY files are not supported: " + fname).c_str());
+  }
+
+  bool shape_ok = static_cast<int>(hdr.shape.size()) == RANK;
+  for (int r = 0; shape_ok && r < RANK; r++) {
+    shape_ok = hdr.shape[static_cast<size_t>(r)] == t.Size(r);
+  }
+  if (!shape_ok) {
+    MATX_THROW(matxInvalidSize, ("Shape of NPY file " + fname + " does not match the output tensor").c_str());
+  }
+}
+
+/**
+ * @brief Copy an NPY payload into a tensor
+ *
+ * Host-accessible tensors are filled directly from the mapping. Device tensors
+ * are filled through a pair of pinned staging buffers on the given stream.
+ */
+template <typename TensorType>
+void NpyPayloadToTensor(TensorType &t, const uint8_t *payload, const NpyHeader &hdr,
+                        const std::string &fname, cudaStream_t stream)
+{
+  using T = typename TensorType::value_type;
+
+  NpyCheckLayout(t, hdr, fname);
+
+  const size_t total = hdr.TotalSize();
+  const auto kind = GetPointerKind(t.Data());
+
+  if (kind == MATX_INVALID_MEMORY || HostPrintable(kind)) {
+    if (t.IsContiguous()) {
+      NpyConvert(t.Data(), payload, hdr.descr, 0, total);
+    }
+    else {
+      for (size_t i = 0; i < total; i++) {
+        T v;
+        NpyConvert(&v, payload, hdr.descr, i, 1);
+        t(matx::detail::GetIdxFromAbs(t, static_cast<index_t>(i))) = v;
+      }
+    }
+    return;
+  }
+
+  MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter,
+      "read_npy into device memory requires a contiguous tensor");
+
+  const size_t chunk = NPY_STAGING_BYTES / sizeof(T);
+  T *staging[2];
+  cudaEvent_t done[2];
+  for (int b = 0; b < 2; b++) {
+    matxAlloc(reinterpret_cast<void **>(&staging[b]), chunk * sizeof(T), MATX_HOST_MEMORY);
+    MATX_CUDA_CHECK(cudaEventCreateWithFlags(&done[b], cudaEventDisableTiming));
+  }
+
+  int b = 0;
+  for (size_t first = 0; first < total; first += chunk, b ^= 1) {
+    const size_t count = std::min(chunk, total - first);
+    MATX_CUDA_CHECK(cudaEventSynchronize(done[b]));
+    NpyConvert(staging[b], payload, hdr.descr, first, count);
+    MATX_CUDA_CHECK(cudaMemcpyAsync(t.Data() + first, staging[b], count * sizeof(T),
+                                    cudaMemcpyHostToDevice, stream));
+    MATX_CUDA_CHECK(cudaEventRecord(done[b], stream));
+  }
+
+  MATX_CUDA_CHECK(cudaStreamSynchronize(stream));
+  for (int s = 0; s < 2; s++) {
+    MATX_CUDA_CHECK(cudaEventDestroy(done[s]));
+    matxFree(staging[s]);
+  }
+}
+
+/**
+ * @brief Build the NPY header (magic, version, length and dictionary) for a tensor
+ *
+ * The header is padded so the payload starts on a 64-byte boundary, as numpy does.
+ */
+template <typename TensorType>
+std::string NpyMakeHeader(const TensorType &t)
+{
+  using S = npy_storage_t<typename TensorType::value_type>;
+  constexpr int RANK = TensorType::Rank();
+
+  std::string dict = std::string("{'descr': '") + NpyDescrOf<S>() +
+                     "', 'fortran_order': False, 'shape': (";
+  for (int r = 0; r < RANK; r++) {
+    dict += std::to_string(t.Size(r)) + ((RANK == 1 || r < RANK - 1) ? "," : "");
+    if (r < RANK - 1) {
+      dict += " ";
+    }
+  }
+  dict += "), }";
+
+  const bool v1 = dict.size() + 64 < 65536;
+  const size_t prefix = v1 ? 10 : 12;
+  dict.append(63 - (prefix + dict.size()) % 64, ' ');
+  dict += '\n';
+
+  std::string header("\x93NUMPY", 6);
+  header += static_cast<char>(v1 ? 1 : 2);
+  header += '\0';
+  const auto hl = static_cast<uint32_t>(dict.size());
+  header.append(reinterpret_cast<const char *>(&hl), v1 ? 2 : 4);
+  return header + dict;
+}
+
+/**
+ * @brief Wrap an NPY payload inside a mapping as a host tensor without copying
+ */
+template <typename T, int RANK>
+auto NpyWrapMapping(std::shared_ptr<NpyMappedFile> map, size_t offset, const NpyHeader &hdr,
+                    const std::string &fname)
+{
+  if (hdr.descr != NpyDescrOf<T>()) {
+    MATX_THROW(matxInvalidType, ("NPY dtype " + hdr.descr + " in " + fname +
+        " does not match the requested type " + NpyDescrOf<T>()).c_str());
+  }
+  if (hdr.fortran_order && hdr.shape.size() > 1) {
+    MATX_THROW(matxNotSupported, ("Fortran-ordered NPY files are not supported: " + fname).c_str());
+  }
+  if (static_cast<int>(hdr.shape.size()) != RANK) {
+    MATX_THROW(matxInvalidDim, ("Rank of NPY file " + fname + " does not match the requested rank").c_str());
+  }
+
+  cuda::std::array<index_t, RANK> shape;
+  for (int r = 0; r < RANK; r++) {
+    shape[r] = hdr.shape[static_cast<size_t>(r)];
+  }
+
+  // Members of an NPZ archive are not padded, so their payload may be
+  // misaligned for T. Those are copied out instead of wrapped.
+  uint8_t *base = map->Data() + offset + hdr.data_offset;
+  if (reinterpret_cast<uintptr_t>(base) % alignof(T) != 0) {
+    auto t = make_tensor<T>(shape, MATX_HOST_MALLOC_MEMORY);
+    memcpy(t.Data(), base, hdr.TotalSize() * sizeof(T));
+    return t;
+  }
+
+  // The tensor keeps the mapping alive for as long as any view of it exists
+  std::shared_ptr<T> ptr(reinterpret_cast<T *>(base), [map](T *) {});
+  return make_tensor<T>(make_storage_from_shared_ptr(ptr, hdr.TotalSize()), shape);
+}
+
+}; // namespace detail
+
+namespace io {
+
+/**
+ * @brief Map a NPY file into memory and wrap it as a host tensor
+ *
+ * No data is copied: the returned tensor points directly at the file contents
+ * through a private mapping, so pages are read on first touch and writes to the
+ * tensor are not written back to the file. The dtype stored in the file must
+ * match T exactly.
+ *
+ * @tparam T
+ *   Data type of tensor
+ * @tparam RANK
+ *   Rank of tensor
+ * @param fname
+ *   File name of .npy file
+ * @returns Host tensor backed by the mapped file
+ */
+template <typename T, int RANK>
+auto read_npy_mmap(const std::string &fname)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+  auto map = std::make_shared<detail::NpyMappedFile>(fname);
+  const auto hdr = detail::ParseNpyHeader(map->Data(), map->Size(), fname);
+  return detail::NpyWrapMapping<T, RANK>(std::move(map), 0, hdr, fname);
+}
+
+/**
+ * @brief Read a NPY file into a tensor view
+ *
+ * NPY files are a simple binary format for storing arrays of numbers. The
+ * header is parsed natively and the payload is mapped from disk, then converted
+ * to the tensor's type if the file's dtype differs. Tensors in host-accessible
+ * memory are filled directly from the mapping, while device tensors are filled
+ * through pinned staging buffers on the given stream. The shape of the file
+ * must match the shape of the tensor.
+ *
+ * @tparam TensorType
+ *   Data type of tensor
+ * @param t
+ *   Tensor to read data into
+ * @param fname
+ *   File name of .npy file
+ * @param stream
+ *   CUDA stream used when the tensor is in device memory
+ */
+template <typename TensorType>
+void read_npy(TensorType &t, const std::string& fname, cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+  detail::NpyMappedFile map(fname);
+  const auto hdr = detail::ParseNpyHeader(map.Data(), map.Size(), fname);
+  detail::NpyPayloadToTensor(t, map.Data() + hdr.data_offset, hdr, fname, stream);
+}
+
+/**
+ * @brief Map one array of a NPZ archive into memory and wrap it as a host tensor
+ *
+ * Works like read_npy_mmap on a member of an archive written by np.savez.
+ * Members whose payload is not aligned for T are copied into host memory
+ * instead of wrapped. Compressed archives from np.savez_compressed cannot be
+ * mapped and throw.
+ *
+ * @tparam T
+ *   Data type of tensor
+ * @tparam RANK
+ *   Rank of tensor
+ * @param fname
+ *   File name of .npz file
+ * @param key
+ *   Name of the array inside the archive
+ * @returns Host tensor backed by the mapped file
+ */
+template <typename T, int RANK>
+auto read_npz_mmap(const std::string &fname, const std::string &key)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+  auto map = std::make_shared<detail::NpyMappedFile>(fname);
+  const auto [offset, size] = detail::NpzFindMember(map->Data(), map->Size(), key, fname);
+  const auto hdr = detail::ParseNpyHeader(map->Data() + offset, size, fname);
+  return detail::NpyWrapMapping<T, RANK>(std::move(map), offset, hdr, fname);
+}
+
+/**
+ * @brief Read one array of a NPZ archive into a tensor view
+ *
+ * Works like read_npy on a member of an archive written by np.savez.
+ *
+ * @tparam TensorType
+ *   Data type of tensor
+ * @param t
+ *   Tensor to read data into
+ * @param fname
+ *   File name of .npz file
+ * @param key
+ *   Name of the array inside the archive
+ * @param stream
+ *   CUDA stream used when the tensor is in device memory
+ */
+template <typename TensorType>
+void read_npz(TensorType &t, const std::string &fname, const std::string &key, cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+  detail::NpyMappedFile map(fname);
+  const auto [offset, size] = detail::NpzFindMember(map.Data(), map.Size(), key, fname);
+  const auto hdr = detail::ParseNpyHeader(map.Data() + offset, size, fname);
+  detail::NpyPayloadToTensor(t, map.Data() + offset + hdr.data_offset, hdr, fname, stream);
+}
+
+/**
+ * @brief Write a NPY file from a tensor view
+ *
+ * NPY files are a simple binary format for storing arrays of numbers. The file
+ * is written natively in NPY format 1.0 (2.0 for very large headers). Types
+ * numpy cannot represent are widened: bfloat16 is stored as float32 and half
+ * precision complex types as complex64. Device tensors are copied out through
+ * pinned staging buffers on the given stream.
+ *
+ * @tparam TensorType
+ *   Data type of tensor
+ * @param t
+ *   Tensor to write data from
+ * @param fname
+ *   File name of .npy file
+ * @param stream
+ *   CUDA stream used when the tensor is in device memory
+ */
+template <typename TensorType>
+void write_npy(const TensorType &t, const std::string& fname, cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  MATX_STATIC_ASSERT_STR(is_tensor_view_v<TensorType>, matxInvalidType, "write_npy requires a tensor");
+
+  using T = typename TensorType::value_type;
+  using S = detail::npy_storage_t<T>;
+
+  FILE *fp = fopen(fname.c_str(), "wb");
+  if (fp == nullptr) {
+    const std::string errorMessage = "Failed to open [" + fname + "] for writing";
+    MATX_THROW(matxIOError, errorMessage.c_str());
+  }
+
+  const std::string header = detail::NpyMakeHeader(t);
+  bool ok = fwrite(header.data(), 1, header.size(), fp) == header.size();
+
+  const size_t total = static_cast<size_t>(t.TotalSize());
+  const auto kind = GetPointerKind(const_cast<T *>(t.Data()));
+
+  if (kind == MATX_INVALID_MEMORY || HostPrintable(kind)) {
+    if (t.IsContiguous() && cuda::std::is_same_v<S, T>) {
+      ok = ok && fwrite(t.Data(), sizeof(T), total, fp) == total;
+    }
+    else {
+      for (size_t i = 0; ok && i < total; i++) {
+        const S v = detail::NpyCast<S>(T{t(matx::detail::GetIdxFromAbs(t, static_cast<index_t>(i)))});
+        ok = fwrite(&v, sizeof(S), 1, fp) == 1;
+      }
+    }
+  }
+  else {
+    MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter,
+        "write_npy from device memory requires a contiguous tensor");
+
+    const size_t chunk = detail::NPY_STAGING_BYTES / sizeof(T);
+    T *staging;
+    std::vector<S> widened;
+    matxAlloc(reinterpret_cast<void **>(&staging), chunk * sizeof(T), MATX_HOST_MEMORY);
+    for (size_t first = 0; ok && first < total; first += chunk) {
+      const size_t count = std::min(chunk, total - first);
+      MATX_CUDA_CHECK(cudaMemcpyAsync(staging, t.Data() + first, count * sizeof(T),
+                                      cudaMemcpyDeviceToHost, stream));
+      MATX_CUDA_CHECK(cudaStreamSynchronize(stream));
+      if constexpr (cuda::std::is_same_v<S, T>) {
+        ok = fwrite(staging, sizeof(T), count, fp) == count;
+      }
+      else {
+        widened.resize(count);
+        for (size_t i = 0; i < count; i++) {
+          widened[i] = detail::NpyCast<S>(staging[i]);
+        }
+        ok = fwrite(widened.data(), sizeof(S), count, fp) == count;
+      }
+    }
+    matxFree(staging);
+  }
+
+  ok = (fclose(fp) == 0) && ok;
+  if (!ok) {
+    const std::string errorMessage = "Failed to write [" + fname + "]";
+    MATX_THROW(matxIOError, errorMessage.c_str());
+  }
+}
+
+}; // namespace io
+}; // namespace matx
@@ -0,0 +1,543 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "matx/core/error.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/executors/cuda.h"
+#include "matx/operators/operators.h"
+
+namespace matx {
+
+/**
+ * @brief How an out-of-core tensor's backing file is opened
+ */
+enum class oocMode {
+  READ,       ///< Existing file, read only
+  READ_WRITE, ///< Existing file, writes go back to the file
+  CREATE      ///< File is created or extended to fit the tensor
+};
+
+namespace detail {
+
+/**
+ * Target size of one tile when the caller does not choose the number of rows.
+ * Two input tiles (and two output tiles for transforms) are resident on the
+ * device and in pinned memory at once.
+ */
+static constexpr size_t OOC_DEFAULT_TILE_BYTES = 64 * 1024 * 1024;
+
+/**
+ * @brief Shared mapping of a tensor's backing file
+ */
+class OocMapping {
+  public:
+    OocMapping(const std::string &fname, size_t offset, size_t bytes, oocMode mode)
+      : fname_(fname), offset_(offset), bytes_(bytes)
+    {
+      const int flags = mode == oocMode::READ ? O_RDONLY : (mode == oocMode::CREATE ? O_RDWR | O_CREAT : O_RDWR);
+      fd_ = open(fname.c_str(), flags, 0644);
+      if (fd_ < 0) {
+        const std::string errorMessage = "Failed to open [" + fname + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      struct stat st;
+      fstat(fd_, &st);
+      if (static_cast<size_t>(st.st_size) < offset + bytes) {
+        if (mode != oocMode::CREATE || ftruncate(fd_, static_cast<off_t>(offset + bytes)) != 0) {
+          close(fd_);
+          const std::string errorMessage = "File [" + fname + "] is smaller than the tensor it backs";
+          MATX_THROW(matxIOError, errorMessage.c_str());
+        }
+      }
+
+      const int prot = mode == oocMode::READ ? PROT_READ : PROT_READ | PROT_WRITE;
+      void *p = mmap(nullptr, offset + bytes, prot, MAP_SHARED, fd_, 0);
+      if (p == MAP_FAILED) {
+        close(fd_);
+        const std::string errorMessage = "Failed to mmap [" + fname + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+
+      base_ = static_cast<uint8_t *>(p);
+      madvise(base_, offset + bytes, MADV_SEQUENTIAL);
+    }
+
+    ~OocMapping()
+    {
+      munmap(base_, offset_ + bytes_);
+      close(fd_);
+    }
+
+    OocMapping(const OocMapping &) = delete;
+    OocMapping &operator=(const OocMapping &) = delete;
+
+    uint8_t *Data() const { return base_ + offset_; }
+
+    /**
+     * @brief Ask the kernel to start reading a byte range of the payload
+     */
+    void Prefetch(size_t first, size_t bytes) const
+    {
+      const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      const size_t start = (offset_ + first) / page * page;
+      const size_t end = std::min(offset_ + bytes_, offset_ + first + bytes);
+      if (end > start) {
+        madvise(base_ + start, end - start, MADV_WILLNEED);
+      }
+    }
+
+    void Flush() const
+    {
+      if (msync(base_, offset_ + bytes_, MS_SYNC) != 0) {
+        const std::string errorMessage = "Failed to flush [" + fname_ + "]";
+        MATX_THROW(matxIOError, errorMessage.c_str());
+      }
+    }
+
+  private:
+    std::string fname_;
+    int fd_ = -1;
+    uint8_t *base_ = nullptr;
+    size_t offset_;
+    size_t bytes_;
+};
+
+}; // namespace detail
+
+/**
+ * @brief Tensor backed by a memory-mapped file that may be larger than device memory
+ *
+ * The data is stored row-major in the file starting at a byte offset. The
+ * tensor is not an operator and cannot be used in expressions directly.
+ * Instead, ooc_for_each and ooc_transform stream it through the device in
+ * tiles along the first dimension, and Tile() gives a zero-copy host view of
+ * any range of rows. Copies share the same mapping.
+ *
+ * @tparam T Data type
+ * @tparam RANK Rank of tensor
+ */
+template <typename T, int RANK>
+class ooc_tensor_t {
+  static_assert(RANK >= 1, "Out-of-core tensors must have rank 1 or higher");
+
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Map a file as a tensor
+     *
+     * @param fname Backing file
+     * @param shape Shape of tensor
+     * @param mode How the file is opened
+     * @param offset Byte offset of the first element in the file
+     */
+    ooc_tensor_t(const std::string &fname, const cuda::std::array<index_t, RANK> &shape,
+                 oocMode mode = oocMode::READ, size_t offset = 0)
+      : shape_(shape), mode_(mode)
+    {
+      MATX_ASSERT_STR(offset % alignof(T) == 0, matxInvalidParameter,
+          "Out-of-core tensor offset must be aligned to the element type");
+      map_ = std::make_shared<detail::OocMapping>(fname, offset, static_cast<size_t>(TotalSize()) * sizeof(T), mode);
+    }
+
+    static constexpr int Rank() { return RANK; }
+
+    index_t Size(int dim) const { return shape_[dim]; }
+
+    index_t TotalSize() const
+    {
+      index_t n = 1;
+      for (int r = 0; r < RANK; r++) {
+        n *= shape_[r];
+      }
+      return n;
+    }
+
+    /**
+     * @brief Number of elements in one index of the first dimension
+     */
+    index_t RowSize() const { return TotalSize() / shape_[0]; }
+
+    /**
+     * @brief Host pointer to the start of the mapped data
+     */
+    T *Data() const { return reinterpret_cast<T *>(map_->Data()); }
+
+    oocMode Mode() const { return mode_; }
+
+    /**
+     * @brief Zero-copy host view of rows [first, first + rows) of the first dimension
+     *
+     * Pages are read from the file on first access. The view keeps the mapping
+     * alive.
+     */
+    auto Tile(index_t first, index_t rows) const
+    {
+      MATX_ASSERT_STR(first >= 0 && rows >= 0 && first + rows <= shape_[0], matxInvalidSize,
+          "Tile is outside the out-of-core tensor");
+
+      auto shape = shape_;
+      shape[0] = rows;
+      auto map = map_;
+      std::shared_ptr<T> ptr(Data() + first * RowSize(), [map](T *) {});
+      return make_tensor<T>(make_storage_from_shared_ptr(ptr, static_cast<size_t>(rows * RowSize())), shape);
+    }
+
+    /**
+     * @brief Hint that rows [first, first + rows) will be read soon
+     */
+    void Prefetch(index_t first, index_t rows) const
+    {
+      const auto row_bytes = static_cast<size_t>(RowSize()) * sizeof(T);
+      map_->Prefetch(static_cast<size_t>(first) * row_bytes, static_cast<size_t>(rows) * row_bytes);
+    }
+
+    /**
+     * @brief Write modified pages back to the file
+     */
+    void Flush() const { map_->Flush(); }
+
+  private:
+    cuda::std::array<index_t, RANK> shape_;
+    oocMode mode_;
+    std::shared_ptr<detail::OocMapping> map_;
+};
+
+/**
+ * @brief Create an out-of-core tensor backed by a file
+ *
+ * @tparam T Data type
+ * @tparam RANK Rank of tensor
+ * @param fname Backing file
+ * @param shape Shape of tensor
+ * @param mode How the file is opened
+ * @param offset Byte offset of the first element in the file
+ * @returns Out-of-core tensor
+ */
+template <typename T, int RANK>
+auto make_ooc_tensor(const std::string &fname, const index_t (&shape)[RANK],
+                     oocMode mode = oocMode::READ, size_t offset = 0)
+{
+  cuda::std::array<index_t, RANK> s;
+  for (int r = 0; r < RANK; r++) {
+    s[r] = shape[r];
+  }
+  return ooc_tensor_t<T, RANK>(fname, s, mode, offset);
+}
+
+namespace detail {
+
+template <typename T, int RANK>
+index_t OocTileRows(const ooc_tensor_t<T, RANK> &t, index_t tile_rows)
+{
+  if (tile_rows > 0) {
+    return std::min(tile_rows, t.Size(0));
+  }
+
+  const auto row_bytes = static_cast<size_t>(t.RowSize()) * sizeof(T);
+  return std::clamp(static_cast<index_t>(OOC_DEFAULT_TILE_BYTES / std::max<size_t>(row_bytes, 1)),
+                    index_t{1}, t.Size(0));
+}
+
+template <typename T, int RANK>
+auto OocTileShape(const ooc_tensor_t<T, RANK> &t, index_t rows)
+{
+  cuda::std::array<index_t, RANK> shape;
+  shape[0] = rows;
+  for (int r = 1; r < RANK; r++) {
+    shape[r] = t.Size(r);
+  }
+  return shape;
+}
+
+/**
+ * @brief Stream an out-of-core tensor through the device one tile at a time
+ *
+ * Each tile is copied from the mapping into one of two pinned buffers and then
+ * to one of two device buffers on the executor's stream. The host copy of tile
+ * k+1, and the kernel's read-ahead of tile k+2, overlap the device work on tile
+ * k. When out is not null, the device output tile is copied back through a
+ * second pair of pinned buffers and written into out's mapping once the copy
+ * has finished.
+ */
+template <typename InT, int IN_RANK, typename OutT, int OUT_RANK, typename Func>
+void OocRun(const ooc_tensor_t<InT, IN_RANK> &in, const ooc_tensor_t<OutT, OUT_RANK> *out,
+            Func &&fn, const cudaExecutor &exec, index_t tile_rows)
+{
+  const cudaStream_t stream = exec.getStream();
+  const index_t rows_total = in.Size(0);
+  if (rows_total == 0) {
+    return;
+  }
+  tile_rows = OocTileRows(in, tile_rows);
+
+  const size_t in_tile_bytes = static_cast<size_t>(tile_rows * in.RowSize()) * sizeof(InT);
+  const size_t out_tile_bytes = out == nullptr ? 0 : static_cast<size_t>(tile_rows * out->RowSize()) * sizeof(OutT);
+
+  void *h_in[2], *d_in[2], *h_out[2] = {nullptr, nullptr}, *d_out[2] = {nullptr, nullptr};
+  cudaEvent_t in_done[2], out_done[2];
+  index_t pending_first[2] = {-1, -1};
+  index_t pending_rows[2] = {0, 0};
+  for (int b = 0; b < 2; b++) {
+    matxAlloc(&h_in[b], in_tile_bytes, MATX_HOST_MEMORY);
+    matxAlloc(&d_in[b], in_tile_bytes, MATX_DEVICE_MEMORY);
+    MATX_CUDA_CHECK(cudaEventCreateWithFlags(&in_done[b], cudaEventDisableTiming));
+    MATX_CUDA_CHECK(cudaEventCreateWithFlags(&out_done[b], cudaEventDisableTiming));
+    if (out != nullptr) {
+      matxAlloc(&h_out[b], out_tile_bytes, MATX_HOST_MEMORY);
+      matxAlloc(&d_out[b], out_tile_bytes, MATX_DEVICE_MEMORY);
+    }
+  }
+
+  // Copy a finished output tile from pinned memory into the output mapping
+  const auto drain = [&](int b) {
+    if (pending_first[b] < 0) {
+      return;
+    }
+    MATX_CUDA_CHECK(cudaEventSynchronize(out_done[b]));
+    const size_t row_bytes = static_cast<size_t>(out->RowSize()) * sizeof(OutT);
+    memcpy(reinterpret_cast<uint8_t *>(out->Data()) + static_cast<size_t>(pending_first[b]) * row_bytes,
+           h_out[b], static_cast<size_t>(pending_rows[b]) * row_bytes);
+    pending_first[b] = -1;
+  };
+
+  const size_t in_row_bytes = static_cast<size_t>(in.RowSize()) * sizeof(InT);
+  in.Prefetch(0, tile_rows);
+  int b = 0;
+  for (index_t first = 0; first < rows_total; first += tile_rows, b ^= 1) {
+    const index_t rows = std::min(tile_rows, rows_total - first);
+    if (first + rows < rows_total) {
+      in.Prefetch(first + rows, std::min(tile_rows, rows_total - first - rows));
+    }
+
+    // Pinned slot b is free once the upload of tile k-2 has finished
+    MATX_CUDA_CHECK(cudaEventSynchronize(in_done[b]));
+    memcpy(h_in[b], reinterpret_cast<const uint8_t *>(in.Data()) + static_cast<size_t>(first) * in_row_bytes,
+           static_cast<size_t>(rows) * in_row_bytes);
+    MATX_CUDA_CHECK(cudaMemcpyAsync(d_in[b], h_in[b], static_cast<size_t>(rows) * in_row_bytes,
+                                    cudaMemcpyHostToDevice, stream));
+    MATX_CUDA_CHECK(cudaEventRecord(in_done[b], stream));
+
+    auto in_tile = make_tensor<InT>(static_cast<InT *>(d_in[b]), OocTileShape(in, rows));
+    if (out == nullptr) {
+      fn(in_tile, first);
+    }
+    else {
+      auto out_tile = make_tensor<OutT>(static_cast<OutT *>(d_out[b]), OocTileShape(*out, rows));
+      fn(out_tile, in_tile);
+
+      drain(b);
+      const size_t out_row_bytes = static_cast<size_t>(out->RowSize()) * sizeof(OutT);
+      MATX_CUDA_CHECK(cudaMemcpyAsync(h_out[b], d_out[b], static_cast<size_t>(rows) * out_row_bytes,
+                                      cudaMemcpyDeviceToHost, stream));
+      MATX_CUDA_CHECK(cudaEventRecord(out_done[b], stream));
+      pending_first[b] = first;
+      pending_rows[b] = rows;
+    }
+  }
+
+  MATX_CUDA_CHECK(cudaStreamSynchronize(stream));
+  for (int s = 0; s < 2; s++) {
+    if (out != nullptr) {
+      drain(s);
+      matxFree(h_out[s]);
+      matxFree(d_out[s]);
+    }
+    matxFree(h_in[s]);
+    matxFree(d_in[s]);
+    MATX_CUDA_CHECK(cudaEventDestroy(in_done[s]));
+    MATX_CUDA_CHECK(cudaEventDestroy(out_done[s]));
+  }
+}
+
+}; // namespace detail
+
+/**
+ * @brief Run a function on every tile of an out-of-core tensor in device memory
+ *
+ * fn is called as fn(tile, first_row), where tile is a device tensor holding
+ * rows [first_row, first_row + tile.Size(0)) of the first dimension. Work that
+ * fn submits to exec is ordered before the tile's buffer is reused, so fn
+ * should not block. ooc_for_each returns after all work has finished.
+ *
+ * @param in Out-of-core input tensor
+ * @param fn Function called for each tile
+ * @param exec CUDA executor
+ * @param tile_rows Rows of the first dimension per tile, or 0 to size tiles automatically
+ */
+template <typename T, int RANK, typename Func>
+void ooc_for_each(const ooc_tensor_t<T, RANK> &in, Func &&fn, const cudaExecutor &exec, index_t tile_rows = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  detail::OocRun(in, static_cast<const ooc_tensor_t<T, RANK> *>(nullptr), std::forward<Func>(fn), exec, tile_rows);
+}
+
+/**
+ * @brief Stream an out-of-core tensor through a device computation into another
+ *
+ * fn is called as fn(out_tile, in_tile) with device tensors covering the same
+ * rows of the first dimension, and should write out_tile using exec. Output
+ * tiles are copied back into out's file as they finish. The first dimension of
+ * out and in must match.
+ *
+ * @param out Out-of-core output tensor, opened writable
+ * @param in Out-of-core input tensor
+ * @param fn Function producing an output tile from an input tile
+ * @param exec CUDA executor
+ * @param tile_rows Rows of the first dimension per tile, or 0 to size tiles automatically
+ */
+template <typename OutT, int OUT_RANK, typename InT, int IN_RANK, typename Func>
+void ooc_transform(const ooc_tensor_t<OutT, OUT_RANK> &out, const ooc_tensor_t<InT, IN_RANK> &in,
+                   Func &&fn, const cudaExecutor &exec, index_t tile_rows = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  MATX_ASSERT_STR(out.Size(0) == in.Size(0), matxInvalidSize,
+      "ooc_transform requires the same first dimension on input and output");
+  MATX_ASSERT_STR(out.Mode() != oocMode::READ, matxInvalidParameter,
+      "ooc_transform output must be opened writable");
+  detail::OocRun(in, &out, std::forward<Func>(fn), exec, tile_rows);
+}
+
+/**
+ * @brief Sum all elements of an out-of-core tensor
+ *
+ * @param out Rank-0 tensor that receives the sum
+ * @param in Out-of-core input tensor
+ * @param exec CUDA executor
+ * @param tile_rows Rows of the first dimension per tile, or 0 to size tiles automatically
+ */
+template <typename OutType, typename T, int RANK>
+void ooc_sum(OutType &out, const ooc_tensor_t<T, RANK> &in, const cudaExecutor &exec, index_t tile_rows = 0)
+{
+  auto partial = make_tensor<typename OutType::value_type>({}, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  ooc_for_each(in, [&](const auto &tile, index_t first) {
+    if (first == 0) {
+      (out = sum(tile)).run(exec);
+    }
+    else {
+      (partial = sum(tile)).run(exec);
+      (out = out + partial).run(exec);
+    }
+  }, exec, tile_rows);
+}
+
+/**
+ * @brief Find the maximum element of an out-of-core tensor
+ *
+ * @param out Rank-0 tensor that receives the maximum
+ * @param in Out-of-core input tensor
+ * @param exec CUDA executor
+ * @param tile_rows Rows of the first dimension per tile, or 0 to size tiles automatically
+ */
+template <typename OutType, typename T, int RANK>
+void ooc_max(OutType &out, const ooc_tensor_t<T, RANK> &in, const cudaExecutor &exec, index_t tile_rows = 0)
+{
+  auto partial = make_tensor<typename OutType::value_type>({}, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  ooc_for_each(in, [&](const auto &tile, index_t first) {
+    if (first == 0) {
+      (out = max(tile)).run(exec);
+    }
+    else {
+      (partial = max(tile)).run(exec);
+      (out = max(out, partial)).run(exec);
+    }
+  }, exec, tile_rows);
+}
+
+/**
+ * @brief Histogram of all elements of an out-of-core tensor
+ *
+ * Bins are evenly spaced between lower and upper, with out.Size(0) bins.
+ *
+ * @param out Rank-1 tensor of bin counts
+ * @param in Out-of-core input tensor
+ * @param lower Lower edge of the first bin
+ * @param upper Upper edge of the last bin
+ * @param exec CUDA executor
+ * @param tile_rows Rows of the first dimension per tile, or 0 to size tiles automatically
+ */
+template <typename OutType, typename T, int RANK>
+void ooc_hist(OutType &out, const ooc_tensor_t<T, RANK> &in, T lower, T upper,
+              const cudaExecutor &exec, index_t tile_rows = 0)
+{
+  static_assert(OutType::Rank() == 1, "ooc_hist output must be rank 1");
+  const int levels = static_cast<int>(out.Size(0)) + 1;
+  auto partial = make_tensor<typename OutType::value_type>({out.Size(0)}, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  ooc_for_each(in, [&](const auto &tile, index_t first) {
+    auto flat = make_tensor<T>(tile.Data(), {tile.TotalSize()});
+    if (first == 0) {
+      (out = hist(flat, lower, upper, levels)).run(exec);
+    }
+    else {
+      (partial = hist(flat, lower, upper, levels)).run(exec);
+      (out = out + partial).run(exec);
+    }
+  }, exec, tile_rows);
+}
+
+/**
+ * @brief FFT along the last dimension of an out-of-core tensor, batched over the first
+ *
+ * The output follows the sizing rules of fft, so a real input produces n/2+1
+ * complex values in the last dimension.
+ *
+ * @param out Out-of-core complex output tensor, opened writable
+ * @param in Out-of-core input tensor of rank 2 or higher
+ * @param exec CUDA executor
+ * @param tile_rows Rows of the first dimension per tile, or 0 to size tiles automatically
+ */
+template <typename OutT, typename InT, int RANK>
+void ooc_fft(const ooc_tensor_t<OutT, RANK> &out, const ooc_tensor_t<InT, RANK> &in,
+             const cudaExecutor &exec, index_t tile_rows = 0)
+{
+  static_assert(RANK >= 2, "ooc_fft tiles along the first dimension, so the input must be rank 2 or higher");
+  ooc_transform(out, in, [&](auto &out_tile, const auto &in_tile) {
+    (out_tile = fft(in_tile)).run(exec);
+  }, exec, tile_rows);
+}
+
+}; // namespace matx
@@ -34,6 +34,7 @@
 
 #ifdef MATX_ENABLE_NVTIFF
 
+#include <string>
 #include <vector>
 #include <nvtiff.h>
 #define MATX_CHECK_NVTIFF(call) do {                                                             \
@@ -56,8 +57,11 @@ namespace matx {
           events.resize(NUM_DECODERS_);
           tiff_streams.resize(NUM_DECODERS_);
           decoders.resize(NUM_DECODERS_);
+          decode_streams.resize(NUM_DECODERS_);
+          MATX_CUDA_CHECK(cudaEventCreateWithFlags(&fork_event, cudaEventDisableTiming));
           for (int k=0; k<NUM_DECODERS_; k++)
           {
+            MATX_CUDA_CHECK(cudaStreamCreateWithFlags(&decode_streams[k], cudaStreamNonBlocking));
             MATX_CUDA_CHECK(cudaEventCreate(&events[k]));
             MATX_CUDA_CHECK(cudaEventRecord(events[k],stream_));
             MATX_CHECK_NVTIFF(nvtiffStreamCreate(&tiff_streams[k]));
@@ -72,7 +76,9 @@ namespace matx {
             nvtiffDecoderDestroy(decoders[k],stream_);
             nvtiffStreamDestroy(tiff_streams[k]);
             cudaEventDestroy(events[k]);
+            cudaStreamDestroy(decode_streams[k]);
           }
+          cudaEventDestroy(fork_event);
         }
 
         template<typename T>
@@ -95,6 +101,64 @@ namespace matx {
           }
         }
 
+        /**
+         * @brief Decode a batch of images into the slices of a rank-3 tensor
+         *
+         * Image k is decoded into t[k]. Images are spread round robin across the
+         * decoder pool and each decoder runs on its own stream, so decodes run
+         * concurrently and the host parses the next file while earlier images
+         * are still being decoded. The decode streams are forked from and joined
+         * back into the stream passed to the constructor, so work submitted there
+         * afterwards sees the decoded images. All images must have the same size.
+         *
+         * @param filenames File to read each image from
+         * @param image_ids Index of the image within each file
+         * @param t Output tensor. It is allocated with shape {N, height, width}
+         */
+        template<typename T>
+        void load_batch(const std::vector<std::string> &filenames, const std::vector<uint32_t> &image_ids, T& t)
+        {
+          MATX_ASSERT_STR(filenames.size() == image_ids.size() && !filenames.empty(), matxInvalidParameter,
+                          "load_batch needs one image ID per file");
+
+          MATX_CUDA_CHECK(cudaEventRecord(fork_event, stream_));
+          for (int k=0; k<NUM_DECODERS_; k++)
+          {
+            MATX_CUDA_CHECK(cudaStreamWaitEvent(decode_streams[k], fork_event, 0));
+          }
+
+          uint32_t height = 0;
+          uint32_t width = 0;
+          for (size_t n=0; n<filenames.size(); n++)
+          {
+            const int d = static_cast<int>(n % static_cast<size_t>(NUM_DECODERS_));
+            nvtiffImageInfo_t image_info;
+
+            // The previous decode on this decoder must finish before its stream is re-parsed.
+            // Parsing on the host overlaps with the decodes still running on the other decoders
+            MATX_CUDA_CHECK(cudaEventSynchronize(events[d]));
+            MATX_CHECK_NVTIFF(nvtiffStreamParseFromFile(filenames[n].c_str(), tiff_streams[d]));
+            MATX_CHECK_NVTIFF(nvtiffStreamGetImageInfo(tiff_streams[d], image_ids[n], &image_info));
+            if (n == 0) {
+              height = image_info.image_height;
+              width = image_info.image_width;
+              make_tensor(t, {static_cast<index_t>(filenames.size()), static_cast<index_t>(height), static_cast<index_t>(width)});
+            }
+            else if (image_info.image_height != height || image_info.image_width != width) {
+              MATX_THROW(matxInvalidSize, "All images in a TIFF batch must have the same size");
+            }
+
+            uint8_t* data[1] {reinterpret_cast<uint8_t*>(t.Data() + static_cast<index_t>(n) * height * width)};
+            MATX_CHECK_NVTIFF(nvtiffDecodeRange(tiff_streams[d], decoders[d], image_ids[n], 1, data, decode_streams[d]));
+            MATX_CUDA_CHECK(cudaEventRecord(events[d], decode_streams[d]));
+          }
+
+          for (int k=0; k<NUM_DECODERS_; k++)
+          {
+            MATX_CUDA_CHECK(cudaStreamWaitEvent(stream_, events[k], 0));
+          }
+        }
+
         void load_toptr(const char* filename, uint32_t image_id, uint8_t* t_data)
         {
           MATX_CUDA_CHECK(cudaEventSynchronize(events[decoder_idx]));
@@ -136,6 +200,8 @@ namespace matx {
         std::vector<cudaEvent_t> events;
         std::vector<nvtiffStream_t> tiff_streams;
         std::vector<nvtiffDecoder_t> decoders;
+        std::vector<cudaStream_t> decode_streams;
+        cudaEvent_t fork_event;
     };
 
   }
@@ -34,6 +34,8 @@
 
 #include "matx/generators/linspace.h"
 #include "matx/core/log.h"
+#include "matx/core/operator_options.h"
+#include "matx/kernels/fltflt.h"
 
 namespace matx
 {
@@ -47,6 +49,39 @@ namespace matx
   };
 
   namespace detail {
+    /**
+     * Drop the integer part of a float-float value, leaving a fraction of a cycle
+     */
+    __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ fltflt chirp_wrap(fltflt x) {
+      return fltflt_add(fltflt{x.hi - cuda::std::floor(x.hi)}, fltflt{x.lo});
+    }
+
+    /**
+     * Fraction of a cycle of a linear chirp at sample n
+     *
+     * lin and quad are the linear and quadratic phase terms per sample in cycles, already reduced modulo one. Since n
+     * is an integer, the integer part can be dropped after every multiply by n, so the error stays near the float-float
+     * rounding of the products however long the chirp is.
+     */
+    __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float chirp_cycle_fraction(fltflt lin, fltflt quad, index_t n) {
+      const float n_hi = static_cast<float>(n);
+      const fltflt nf{n_hi, static_cast<float>(n - static_cast<index_t>(n_hi))};
+      const fltflt quad_n = chirp_wrap(fltflt_mul(quad, nf));
+      const fltflt phase = chirp_wrap(fltflt_add(chirp_wrap(fltflt_mul(lin, nf)), chirp_wrap(fltflt_mul(quad_n, nf))));
+      return phase.hi + phase.lo;
+    }
+
+    /**
+     * Linear and quadratic phase terms per sample, in cycles modulo one, of a linear chirp sampled num times over [0, last]
+     */
+    template <typename TimeType, typename FreqType>
+    __MATX_INLINE__ cuda::std::array<fltflt, 2> chirp_phase_terms(index_t num, TimeType last, FreqType f0, TimeType t1, FreqType f1) {
+      const double dt = num > 1 ? static_cast<double>(last) / static_cast<double>(num - 1) : 0.0;
+      const double lin = static_cast<double>(f0) * dt;
+      const double quad = 0.5 * (static_cast<double>(f1) - static_cast<double>(f0)) / static_cast<double>(t1) * dt * dt;
+      return {fltflt{lin - std::floor(lin)}, fltflt{quad - std::floor(quad)}};
+    }
+
     template <typename SpaceOp, typename FreqType> 
       class Chirp : public BaseOp<Chirp<SpaceOp, FreqType>> {
         using space_type = typename SpaceOp::value_type;
@@ -58,6 +93,9 @@ namespace matx
         FreqType f1_;
         space_type t1_;
         ChirpMethod method_;
+        PhaseAccuracy accuracy_;
+        fltflt lin_;
+        fltflt quad_;
 
         public:
         using value_type = FreqType;
@@ -110,12 +148,17 @@ namespace matx
 
         __MATX_INLINE__ std::string str() const { return "chirp"; }
 
-        inline __MATX_HOST__ __MATX_DEVICE__ Chirp(SpaceOp sop, FreqType f0, space_type t1, FreqType f1, ChirpMethod method) : 
+        inline __MATX_HOST__ __MATX_DEVICE__ Chirp(SpaceOp sop, FreqType f0, space_type t1, FreqType f1, ChirpMethod method,
+                                                   PhaseAccuracy accuracy = PhaseAccuracy::DEFAULT,
+                                                   fltflt lin = fltflt{0.0f}, fltflt quad = fltflt{0.0f}) : 
           sop_(sop),
           f0_(f0),
           f1_(f1),          
           t1_(t1),
-          method_(method)
+          method_(method),
+          accuracy_(accuracy),
+          lin_(lin),
+          quad_(quad)
         {
 #ifndef __CUDA_ARCH__
           MATX_LOG_TRACE("Chirp constructor: f0={}, f1={}, t1={}", f0, f1, t1);
@@ -134,7 +177,8 @@ namespace matx
           }
           else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
 #ifdef MATX_EN_JIT
-            return true;
+            // The float-float helpers are not part of the JIT headers
+            return accuracy_ == PhaseAccuracy::DEFAULT;
 #else
             return false;
 #endif
@@ -168,6 +212,9 @@ namespace matx
         {
           return detail::ApplyGeneratorVecFunc<CapType, FreqType>([this](index_t idx) { 
             if (method_ == ChirpMethod::CHIRP_METHOD_LINEAR) {
+              if (accuracy_ == PhaseAccuracy::FLTFLT) {
+                return static_cast<double>(cuda::std::cos(2.0f * static_cast<float>(M_PI) * chirp_cycle_fraction(lin_, quad_, idx)));
+              }
               return cuda::std::cos(2.0f * M_PI * (f0_ * sop_(idx) + 0.5f * ((f1_ - f0_) / t1_) * sop_(idx) * sop_(idx)));
             }
 
@@ -198,6 +245,9 @@ namespace matx
         FreqType f1_;
         space_type t1_;
         ChirpMethod method_;
+        PhaseAccuracy accuracy_;
+        fltflt lin_;
+        fltflt quad_;
 
         public:
         using value_type = cuda::std::complex<FreqType>;
@@ -252,12 +302,17 @@ namespace matx
         
 	__MATX_INLINE__ std::string str() const { return "cchirp"; }
         
-	inline __MATX_HOST__ __MATX_DEVICE__ ComplexChirp(SpaceOp sop, FreqType f0, space_type t1, FreqType f1, ChirpMethod method) : 
+	inline __MATX_HOST__ __MATX_DEVICE__ ComplexChirp(SpaceOp sop, FreqType f0, space_type t1, FreqType f1, ChirpMethod method,
+                                                          PhaseAccuracy accuracy = PhaseAccuracy::DEFAULT,
+                                                          fltflt lin = fltflt{0.0f}, fltflt quad = fltflt{0.0f}) : 
           sop_(sop),
           f0_(f0),
           f1_(f1),
           t1_(t1),          
-          method_(method)
+          method_(method),
+          accuracy_(accuracy),
+          lin_(lin),
+          quad_(quad)
         {
 #ifndef __CUDA_ARCH__
           MATX_LOG_TRACE("ComplexChirp constructor: f0={}, f1={}, t1={}", f0, f1, t1);
@@ -276,7 +331,8 @@ namespace matx
           }
           else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
 #ifdef MATX_EN_JIT
-            return true;
+            // The float-float helpers are not part of the JIT headers
+            return accuracy_ == PhaseAccuracy::DEFAULT;
 #else
             return false;
 #endif
@@ -310,6 +366,10 @@ namespace matx
         {
           return detail::ApplyGeneratorVecFunc<CapType, value_type>([this](index_t idx) { 
             if (method_ == ChirpMethod::CHIRP_METHOD_LINEAR) {
+              if (accuracy_ == PhaseAccuracy::FLTFLT) {
+                const float angle = 2.0f * static_cast<float>(M_PI) * chirp_cycle_fraction(lin_, quad_, idx);
+                return cuda::std::complex<FreqType>{static_cast<FreqType>(cuda::std::cos(angle)), static_cast<FreqType>(cuda::std::sin(angle))};
+              }
               FreqType real = cuda::std::cos(2.0f * M_PI * (f0_ * sop_(idx) + 0.5f * ((f1_ - f0_) / t1_) * sop_(idx) * sop_(idx)));
               FreqType imag = -cuda::std::cos(2.0f * M_PI * (f0_ * sop_(idx) + 0.5f * ((f1_ - f0_) / t1_) * sop_(idx) * sop_(idx) + 90.0/360.0));
               return cuda::std::complex<FreqType>{real, imag};
@@ -419,14 +479,24 @@ namespace matx
    *   Frequency (Hz) at time t1
    * @param method
    *   Method to use to generate the chirp
+   * @param accuracy
+   *   PhaseAccuracy::FLTFLT computes the phase of a float chirp from the sample index modulo one cycle with
+   *   float-float arithmetic, keeping near-double phase accuracy for very long chirps at close to float speed. Not
+   *   supported by the JIT executor
    *
    * @returns The chirp operator
    */
   template <typename TimeType, typename FreqType>
-    inline auto chirp(index_t num, TimeType last, FreqType f0, TimeType t1, FreqType f1, ChirpMethod method = ChirpMethod::CHIRP_METHOD_LINEAR)
+    inline auto chirp(index_t num, TimeType last, FreqType f0, TimeType t1, FreqType f1, ChirpMethod method = ChirpMethod::CHIRP_METHOD_LINEAR,
+                      PhaseAccuracy accuracy = PhaseAccuracy::DEFAULT)
     {
+      MATX_ASSERT_STR(method == ChirpMethod::CHIRP_METHOD_LINEAR, matxInvalidType, "Only linear chirps are supported")
+      MATX_ASSERT_STR(accuracy == PhaseAccuracy::DEFAULT || std::is_same_v<FreqType, float>, matxInvalidType,
+          "Float-float chirp phase requires a float frequency type")
+
       auto space = linspace((TimeType)0, last, num);
-      return chirp(space, f0, t1, f1, method);
+      const auto terms = detail::chirp_phase_terms(num, last, f0, t1, f1);
+      return detail::Chirp<decltype(space), FreqType>(space, f0, t1, f1, method, accuracy, terms[0], terms[1]);
     }
     
     
@@ -455,14 +525,24 @@ namespace matx
    *   Frequency (Hz) at time t1
    * @param method
    *   Method to use to generate the chirp
+   * @param accuracy
+   *   PhaseAccuracy::FLTFLT computes the phase of a float chirp from the sample index modulo one cycle with
+   *   float-float arithmetic, keeping near-double phase accuracy for very long chirps at close to float speed. Not
+   *   supported by the JIT executor
    *
    * @returns The chirp operator
    */
   template <typename TimeType, typename FreqType>
-    inline auto cchirp(index_t num, TimeType last, FreqType f0, TimeType t1, FreqType f1, ChirpMethod method = ChirpMethod::CHIRP_METHOD_LINEAR)
+    inline auto cchirp(index_t num, TimeType last, FreqType f0, TimeType t1, FreqType f1, ChirpMethod method = ChirpMethod::CHIRP_METHOD_LINEAR,
+                      PhaseAccuracy accuracy = PhaseAccuracy::DEFAULT)
     {
+      MATX_ASSERT_STR(method == ChirpMethod::CHIRP_METHOD_LINEAR, matxInvalidType, "Only linear chirps are supported")
+      MATX_ASSERT_STR(accuracy == PhaseAccuracy::DEFAULT || std::is_same_v<FreqType, float>, matxInvalidType,
+          "Float-float chirp phase requires a float frequency type")
+
       auto space = linspace((TimeType)0, last, num);
-      return cchirp(space, f0, t1, f1, method);
+      const auto terms = detail::chirp_phase_terms(num, last, f0, t1, f1);
+      return detail::ComplexChirp<decltype(space), FreqType>(space, f0, t1, f1, method, accuracy, terms[0], terms[1]);
     }
 
 
@@ -45,6 +45,8 @@
 #include "matx/generators/meshgrid.h"
 #include "matx/generators/ones.h"
 #include "matx/generators/random.h"
+#include "matx/generators/random_stateless.h"
 #include "matx/generators/range.h"
 #include "matx/generators/zeros.h"
+#include "matx/generators/window_table.h"
 #include "matx/generators/fftfreq.h"
@@ -292,6 +292,13 @@ namespace detail {
         else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
           return false;
         }  
+        else if constexpr (Cap == OperatorCapability::WRITE_VERSIONS) {
+          // New values are drawn on every run
+          if (!in.bump) {
+            *in.volatile_values = true;
+          }
+          return false;
+        }
         else {        
           auto self_has_cap = capability_attributes<Cap>::default_value;
           return self_has_cap;
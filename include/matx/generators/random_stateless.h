@@ -0,0 +1,506 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/generators/random.h"
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+#include <type_traits>
+
+namespace matx {
+
+namespace detail {
+
+  /**
+   * @brief Philox 4x32 counter-based generator with 10 rounds
+   *
+   * Maps a 128-bit counter and 64-bit key to four independent 32-bit words. The
+   * same counter and key always give the same output on host and device, so no
+   * per-element state has to be stored.
+   */
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ cuda::std::array<uint32_t, 4>
+  philox4x32_10(cuda::std::array<uint32_t, 4> ctr, uint64_t key)
+  {
+    constexpr uint32_t M0 = 0xD2511F53u;
+    constexpr uint32_t M1 = 0xCD9E8D57u;
+    constexpr uint32_t W0 = 0x9E3779B9u;
+    constexpr uint32_t W1 = 0xBB67AE85u;
+
+    uint32_t k0 = static_cast<uint32_t>(key);
+    uint32_t k1 = static_cast<uint32_t>(key >> 32);
+
+    MATX_LOOP_UNROLL
+    for (int r = 0; r < 10; r++) {
+      const uint64_t p0 = static_cast<uint64_t>(M0) * ctr[0];
+      const uint64_t p1 = static_cast<uint64_t>(M1) * ctr[2];
+      ctr = {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ k0, static_cast<uint32_t>(p1),
+             static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ k1, static_cast<uint32_t>(p0)};
+      k0 += W0;
+      k1 += W1;
+    }
+
+    return ctr;
+  }
+
+  // Uniform in (0, 1] so the result can be passed to log() directly
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float philox_uniform_float(uint32_t x)
+  {
+    return (static_cast<float>(x >> 8) + 1.0f) * 5.9604644775390625e-08f; // 2^-24
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ double philox_uniform_double(uint32_t hi, uint32_t lo)
+  {
+    const uint64_t bits = (static_cast<uint64_t>(hi) << 21) ^ (lo >> 11);
+    return (static_cast<double>(bits) + 1.0) * 1.1102230246251565e-16; // 2^-53
+  }
+
+  // Box-Muller transform of two uniforms in (0, 1] into two standard normals
+  template <typename T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ cuda::std::array<T, 2> philox_box_muller(T u0, T u1)
+  {
+    constexpr T two_pi = static_cast<T>(6.283185307179586476925286766559);
+    const T r = cuda::std::sqrt(static_cast<T>(-2) * cuda::std::log(u0));
+    const T theta = two_pi * u1;
+    return {r * cuda::std::cos(theta), r * cuda::std::sin(theta)};
+  }
+
+  // Number of values of type T taken from the four words of one Philox block
+  template <typename T>
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ int philox_values_per_block()
+  {
+    if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
+      return 1;
+    }
+    else if constexpr (sizeof(T) == 8) {
+      return 2;
+    }
+    else {
+      return 4;
+    }
+  }
+
+  // Value j of a Philox block. Normal values come in Box-Muller pairs from adjacent words.
+  template <typename T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T philox_value(const cuda::std::array<uint32_t, 4> &w, int j, Distribution_t dist)
+  {
+    if constexpr (std::is_same_v<T, float>) {
+      if (dist == UNIFORM) {
+        return philox_uniform_float(w[j]);
+      }
+      const int p = j & ~1;
+      return philox_box_muller(philox_uniform_float(w[p]), philox_uniform_float(w[p + 1]))[j & 1];
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+      if (dist == UNIFORM) {
+        return philox_uniform_double(w[2 * j], w[2 * j + 1]);
+      }
+      return philox_box_muller(philox_uniform_double(w[0], w[1]), philox_uniform_double(w[2], w[3]))[j];
+    }
+    else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+      const float u0 = philox_uniform_float(w[2 * j]);
+      const float u1 = philox_uniform_float(w[2 * j + 1]);
+      if (dist == UNIFORM) {
+        return {u0, u1};
+      }
+      const auto n = philox_box_muller(u0, u1);
+      return {n[0], n[1]};
+    }
+    else {
+      const double u0 = philox_uniform_double(w[0], w[1]);
+      const double u1 = philox_uniform_double(w[2], w[3]);
+      if (dist == UNIFORM) {
+        return {u0, u1};
+      }
+      const auto n = philox_box_muller(u0, u1);
+      return {n[0], n[1]};
+    }
+  }
+
+  // All values of a Philox block, evaluating each Box-Muller pair once
+  template <typename T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void philox_block(const cuda::std::array<uint32_t, 4> &w, Distribution_t dist, T *out)
+  {
+    if constexpr (std::is_same_v<T, float>) {
+      if (dist == NORMAL) {
+        const auto n0 = philox_box_muller(philox_uniform_float(w[0]), philox_uniform_float(w[1]));
+        const auto n1 = philox_box_muller(philox_uniform_float(w[2]), philox_uniform_float(w[3]));
+        out[0] = n0[0];
+        out[1] = n0[1];
+        out[2] = n1[0];
+        out[3] = n1[1];
+        return;
+      }
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+      if (dist == NORMAL) {
+        const auto n = philox_box_muller(philox_uniform_double(w[0], w[1]), philox_uniform_double(w[2], w[3]));
+        out[0] = n[0];
+        out[1] = n[1];
+        return;
+      }
+    }
+
+    MATX_LOOP_UNROLL
+    for (int j = 0; j < philox_values_per_block<T>(); j++) {
+      out[j] = philox_value<T>(w, j, dist);
+    }
+  }
+
+  // Integer j of a Philox block in [min, max) using a multiply-high instead of a floating point scale
+  template <typename T>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ T philox_integer(const cuda::std::array<uint32_t, 4> &w, int j, T min, T max)
+  {
+    if constexpr (sizeof(T) == 4) {
+      const uint32_t range = static_cast<uint32_t>(max) - static_cast<uint32_t>(min);
+      const uint32_t off = static_cast<uint32_t>((static_cast<uint64_t>(w[j]) * range) >> 32);
+      return static_cast<T>(static_cast<uint32_t>(min) + off);
+    }
+    else {
+      const uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+      const uint64_t r = (static_cast<uint64_t>(w[2 * j]) << 32) | w[2 * j + 1];
+#ifdef __CUDA_ARCH__
+      const uint64_t off = __umul64hi(r, range);
+#else
+      const uint64_t r_lo = r & 0xFFFFFFFFull, r_hi = r >> 32;
+      const uint64_t g_lo = range & 0xFFFFFFFFull, g_hi = range >> 32;
+      const uint64_t mid = r_hi * g_lo + ((r_lo * g_lo) >> 32);
+      const uint64_t off = r_hi * g_hi + (mid >> 32) + ((r_lo * g_hi + (mid & 0xFFFFFFFFull)) >> 32);
+#endif
+      return static_cast<T>(static_cast<uint64_t>(min) + off);
+    }
+  }
+
+  template <typename T, typename ShapeType>
+  class StatelessRandomOp : public BaseOp<StatelessRandomOp<T, ShapeType>> {
+    private:
+      using inner_t = typename inner_op_type_t<T>::type;
+      static constexpr int RANK = cuda::std::tuple_size<ShapeType>{};
+      static constexpr bool is_float_type = std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                                            std::is_same_v<T, cuda::std::complex<float>> ||
+                                            std::is_same_v<T, cuda::std::complex<double>>;
+      cuda::std::array<index_t, RANK> shape_;
+      cuda::std::array<index_t, RANK> strides_;
+      uint64_t seed_;
+      uint64_t offset_;
+
+      union{
+        randFloatParams<inner_t> fParams_;
+        randIntParams<inner_t>   iParams_;
+      };
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t LinearIndex(int ept, Is... indices) const
+      {
+        if constexpr (RANK == 0) {
+          return 0;
+        }
+        else {
+          const cuda::std::array<index_t, RANK> idx{static_cast<index_t>(indices)...};
+          index_t lin = idx[RANK - 1] * ept;
+          MATX_LOOP_UNROLL
+          for (int i = 0; i < RANK - 1; i++) {
+            lin += idx[i] * strides_[i];
+          }
+          return lin;
+        }
+      }
+
+      __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ cuda::std::array<uint32_t, 4> Block(uint64_t block) const
+      {
+        return philox4x32_10({static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32),
+                              static_cast<uint32_t>(offset_), static_cast<uint32_t>(offset_ >> 32)}, seed_);
+      }
+
+    public:
+      using value_type = T;
+      using matxop = bool;
+
+      __MATX_INLINE__ std::string str() const { return "random_stateless"; }
+
+      StatelessRandomOp() = delete;
+
+      // base constructor, should never be called directly
+      __MATX_INLINE__ StatelessRandomOp(ShapeType &&s, uint64_t seed, uint64_t offset) : seed_(seed), offset_(offset)
+      {
+        if constexpr (RANK >= 1) {
+          strides_[RANK-1] = 1;
+        }
+
+        MATX_LOOP_UNROLL
+        for (int i = 0; i < RANK; ++i)
+        {
+          shape_[i] = s[i];
+        }
+
+        MATX_LOOP_UNROLL
+        for (int i = RANK - 2; i >= 0; i--) {
+          strides_[i] = strides_[i+1] * s[i+1];
+        }
+
+        MATX_LOG_TRACE("StatelessRandomOp constructor: rank={}, seed={}, offset={}", RANK, seed, offset);
+      }
+
+      __MATX_INLINE__ StatelessRandomOp(ShapeType &&s, uint64_t seed, uint64_t offset, randFloatParams<inner_t> params) :
+          StatelessRandomOp(std::forward<ShapeType>(s), seed, offset)
+      {
+          fParams_ = params;
+      }
+
+      __MATX_INLINE__ StatelessRandomOp(ShapeType &&s, uint64_t seed, uint64_t offset, randIntParams<inner_t> params) :
+          StatelessRandomOp(std::forward<ShapeType>(s), seed, offset)
+      {
+          iParams_ = params;
+      }
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+          return false;
+        }
+        else {
+          auto self_has_cap = capability_attributes<Cap>::default_value;
+          return self_has_cap;
+        }
+      }
+
+      /**
+       * Retrieve a value from a random view
+       *
+       * Each value is a pure function of the seed, the offset and its linear index,
+       * so any element can be evaluated in any order or on any executor. One Philox
+       * block holds several consecutive values; with multiple elements per thread a
+       * single evaluation of the generator fills all of them.
+       *
+       * @tparam Is Index type
+       * @param indices Index values
+       */
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ auto operator()(Is... indices) const
+      {
+        constexpr int EPT = static_cast<int>(CapType::ept);
+        constexpr int VPB = philox_values_per_block<T>();
+        Vector<T, EPT> val;
+        const uint64_t base = static_cast<uint64_t>(LinearIndex(EPT, indices...));
+
+        if constexpr (EPT >= VPB) {
+          // Every Philox block is consumed whole, so the generator runs once per VPB values
+          if (base % VPB == 0) {
+            MATX_LOOP_UNROLL
+            for (int b = 0; b < EPT / VPB; ++b) {
+              const auto w = Block((base / VPB) + b);
+              if constexpr (is_float_type) {
+                philox_block<T>(w, fParams_.dist_, &val.data[b * VPB]);
+                MATX_LOOP_UNROLL
+                for (int j = 0; j < VPB; ++j) {
+                  val.data[b * VPB + j] = fParams_.alpha_ * val.data[b * VPB + j] + fParams_.beta_;
+                }
+              }
+              else {
+                MATX_LOOP_UNROLL
+                for (int j = 0; j < VPB; ++j) {
+                  val.data[b * VPB + j] = philox_integer<T>(w, j, iParams_.min_, iParams_.max_);
+                }
+              }
+            }
+
+            if constexpr (CapType::ept == ElementsPerThread::ONE) {
+              return val.data[0];
+            }
+            else {
+              return val;
+            }
+          }
+        }
+
+        MATX_LOOP_UNROLL
+        for (int i = 0; i < EPT; ++i) {
+          const uint64_t lin = base + i;
+          const auto w = Block(lin / VPB);
+          const int j = static_cast<int>(lin % VPB);
+          if constexpr (is_float_type) {
+            val.data[i] = fParams_.alpha_ * philox_value<T>(w, j, fParams_.dist_) + fParams_.beta_;
+          }
+          else {
+            val.data[i] = philox_integer<T>(w, j, iParams_.min_, iParams_.max_);
+          }
+        }
+
+        if constexpr (CapType::ept == ElementsPerThread::ONE) {
+          return val.data[0];
+        }
+        else {
+          return val;
+        }
+      }
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ auto operator()(Is... indices) const
+      {
+        return this->operator()<DefaultCapabilities>(indices...);
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ auto Size(int dim) const
+      {
+        return shape_[dim];
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank() { return RANK; }
+    };
+  }
+
+  /**
+   * @brief Return a stateless random number operator with a specified shape.
+   *
+   * Unlike random(), no generator state is allocated or initialized. Every value is
+   * computed from the seed, the offset and its linear index with the Philox 4x32-10
+   * counter-based generator, so the operator fuses into any expression and gives the
+   * same sequence on every executor. Using a different offset with the same seed
+   * gives an independent stream.
+   *
+   * Supported Types: float, double, complex<float>, complex<double>
+   *
+   * @tparam ShapeType Shape type
+   * @tparam T Type of output
+   * @tparam LowerType Either T or the inner type of T if T is complex
+   * @param s Shape of operator
+   * @param dist Distribution (either NORMAL or UNIFORM)
+   * @param seed Random number seed
+   * @param offset Stream offset added to the generator counter
+   * @param alpha Value to multiply by each number
+   * @param beta Value to add to each number
+   * @return Random number operator
+   */
+  template <typename T, typename ShapeType, typename LowerType = typename inner_op_type_t<T>::type>
+    requires (!cuda::std::is_array_v<remove_cvref_t<ShapeType>>)
+  __MATX_INLINE__ auto random_stateless(ShapeType &&s, Distribution_t dist, uint64_t seed = 0, uint64_t offset = 0,
+                                        LowerType alpha = 1, LowerType beta = 0)
+  {
+    static_assert(
+                  std::is_same_v<T, float> ||
+                  std::is_same_v<T, double> ||
+                  std::is_same_v<T, cuda::std::complex<float>> ||
+                  std::is_same_v<T, cuda::std::complex<double>>,
+                  "random_stateless only supports floating point or complex floating point data types"
+                 );
+
+    using shape_strip_t = remove_cvref_t<ShapeType>;
+    matx::detail::randFloatParams<LowerType> params{dist, alpha, beta};
+
+    return detail::StatelessRandomOp<T, shape_strip_t>(std::forward<shape_strip_t>(s), seed, offset, params);
+  }
+
+  /**
+   * @brief Return a stateless random number operator with a specified shape.
+   *
+   * Supported Types: float, double, complex<float>, complex<double>
+   *
+   * @tparam RANK Rank of operator
+   * @tparam T Type of output
+   * @tparam LowerType Either T or the inner type of T if T is complex
+   * @param s Array of dimensions
+   * @param dist Distribution (either NORMAL or UNIFORM)
+   * @param seed Random number seed
+   * @param offset Stream offset added to the generator counter
+   * @param alpha Value to multiply by each number
+   * @param beta Value to add to each number
+   * @return Random number operator
+   */
+  template <typename T, int RANK, typename LowerType = typename inner_op_type_t<T>::type>
+  __MATX_INLINE__ auto random_stateless(const index_t (&s)[RANK], Distribution_t dist, uint64_t seed = 0, uint64_t offset = 0,
+                                        LowerType alpha = 1, LowerType beta = 0)
+  {
+    auto sarray = detail::to_array(s);
+    return random_stateless<T, decltype(sarray)>(std::move(sarray), dist, seed, offset, alpha, beta);
+  }
+
+  /**
+   * @brief Return a stateless random integer operator with a specified shape.
+   *
+   * Values are uniform in [min, max) and are computed from the seed, the offset
+   * and the linear index like random_stateless().
+   *
+   *  Supported types: uint32_t, int32_t, uint64_t, int64_t
+   *
+   * @tparam ShapeType Shape type
+   * @tparam T Type of output
+   * @tparam LowerType Either T or the inner type of T if T is complex
+   * @param s Shape of operator
+   * @param seed Random number seed
+   * @param offset Stream offset added to the generator counter
+   * @param min min of generation range
+   * @param max max of generation range
+   * @return Random number operator
+   */
+  template <typename T, typename ShapeType, typename LowerType = typename inner_op_type_t<T>::type>
+    requires (!cuda::std::is_array_v<remove_cvref_t<ShapeType>>)
+  __MATX_INLINE__ auto randomi_stateless(ShapeType &&s, uint64_t seed = 0, uint64_t offset = 0, LowerType min = 0, LowerType max = 100)
+  {
+    static_assert(
+                  std::is_same_v<T, uint32_t> ||
+                  std::is_same_v<T,  int32_t> ||
+                  std::is_same_v<T, uint64_t> ||
+                  std::is_same_v<T,  int64_t> ,
+                  "randomi_stateless only supports signed and unsigned integral types"
+                 );
+
+    using shape_strip_t = remove_cvref_t<ShapeType>;
+    matx::detail::randIntParams<T> params{min, max};
+
+    return detail::StatelessRandomOp<T, shape_strip_t>(std::forward<shape_strip_t>(s), seed, offset, params);
+  }
+
+  /**
+   * @brief Return a stateless random integer operator with a specified shape.
+   *
+   *  Supported types: uint32_t, int32_t, uint64_t, int64_t
+   *
+   * @tparam RANK Rank of operator
+   * @tparam T Type of output
+   * @tparam LowerType Either T or the inner type of T if T is complex
+   * @param s Array of dimensions
+   * @param seed Random number seed
+   * @param offset Stream offset added to the generator counter
+   * @param min min of generation range
+   * @param max max of generation range
+   * @return Random number operator
+   */
+  template <typename T, int RANK, typename LowerType = typename inner_op_type_t<T>::type>
+  __MATX_INLINE__ auto randomi_stateless(const index_t (&s)[RANK], uint64_t seed = 0, uint64_t offset = 0, LowerType min = 0, LowerType max = 100)
+  {
+    auto sarray = detail::to_array(s);
+    return randomi_stateless<T, decltype(sarray)>(std::move(sarray), seed, offset, min, max);
+  }
+
+} // end namespace matx
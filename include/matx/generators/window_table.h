@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <any>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "matx/core/cache.h"
+#include "matx/core/error.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/type_utils.h"
+
+namespace matx
+{
+  /**
+   * Window functions that can be pre-tabulated with window_table()
+   */
+  enum class WindowType {
+    HANNING,
+    HAMMING,
+    BLACKMAN,
+    FLATTOP,
+    BARTLETT
+  };
+
+  namespace detail {
+    // The value type is part of the key type so each dtype gets its own cache id
+    template <typename T>
+    struct WindowTableParams_t {
+      WindowType type;
+      index_t size;
+      bool device;
+
+      bool operator==(const WindowTableParams_t &rhs) const {
+        return type == rhs.type && size == rhs.size && device == rhs.device;
+      }
+    };
+
+    template <typename T>
+    struct WindowTableParamsKeyHash {
+      std::size_t operator()(const WindowTableParams_t<T> &k) const noexcept
+      {
+        return std::hash<index_t>()(k.size) ^ (std::hash<int>()(static_cast<int>(k.type)) << 1) ^
+               (std::hash<bool>()(k.device) << 2);
+      }
+    };
+
+    template <typename T>
+    using window_table_cache_t = std::unordered_map<WindowTableParams_t<T>, std::any, WindowTableParamsKeyHash<T>>;
+
+    // Same definitions as the window generators, evaluated in double precision on the host
+    inline double window_value(WindowType type, index_t i, index_t size)
+    {
+      const double x = static_cast<double>(i) / static_cast<double>(size - 1);
+      switch (type) {
+        case WindowType::HANNING:
+          return 0.5 * (1.0 - std::cos(2.0 * M_PI * x));
+        case WindowType::HAMMING:
+          return 0.54 - 0.46 * std::cos(2.0 * M_PI * x);
+        case WindowType::BLACKMAN:
+          return 0.42 - 0.5 * std::cos(2.0 * M_PI * x) + 0.08 * std::cos(4.0 * M_PI * x);
+        case WindowType::FLATTOP:
+          return 0.21557895 - 0.41663158 * std::cos(2.0 * M_PI * x) + 0.277263158 * std::cos(4.0 * M_PI * x) -
+                 0.083578947 * std::cos(6.0 * M_PI * x) + 0.006947368 * std::cos(8.0 * M_PI * x);
+        case WindowType::BARTLETT:
+          return 1.0 - std::abs(2.0 * x - 1.0);
+        default:
+          MATX_THROW(matxInvalidParameter, "Unknown window type");
+      }
+    }
+
+    template <typename T, typename Executor>
+    auto make_window_table(WindowType type, index_t size, const Executor &exec)
+    {
+      std::vector<T> host(static_cast<size_t>(size));
+      for (index_t i = 0; i < size; i++) {
+        if constexpr (is_matx_half_v<T>) {
+          host[static_cast<size_t>(i)] = static_cast<T>(static_cast<float>(window_value(type, i, size)));
+        }
+        else {
+          host[static_cast<size_t>(i)] = static_cast<T>(window_value(type, i, size));
+        }
+      }
+
+      if constexpr (is_cuda_executor_v<Executor>) {
+        auto table = make_tensor<T>({size}, MATX_DEVICE_MEMORY);
+        cudaMemcpyAsync(table.Data(), host.data(), host.size() * sizeof(T), cudaMemcpyHostToDevice, exec.getStream());
+        // The staging vector is released on return
+        cudaStreamSynchronize(exec.getStream());
+        return table;
+      }
+      else {
+        auto table = make_tensor<T>({size}, MATX_HOST_MALLOC_MEMORY);
+        std::copy(host.begin(), host.end(), table.Data());
+        return table;
+      }
+    }
+  } // end namespace detail
+
+  /**
+   * Returns a pre-tabulated window of length size
+   *
+   * The window is evaluated once in double precision, converted to T and kept in the
+   * transform cache keyed by window type, length and value type. Later calls with the
+   * same key return the cached tensor without launching any work, so operators that
+   * apply the same window on every iteration, such as repeated STFT frames or pwelch
+   * segments, read it as a small L2-resident table instead of evaluating cos() for
+   * every element. Half-precision types are supported.
+   *
+   * The returned tensor shares storage with the cache entry and must not be written.
+   *
+   * @tparam T
+   *   Data type of the window
+   * @tparam Executor
+   *   Executor type. CUDA executors cache the window in device memory, host executors
+   *   in host memory
+   *
+   * @param type
+   *   Window function
+   * @param size
+   *   Window length
+   * @param exec
+   *   Executor used to upload the window on a cache miss
+   *
+   * @returns
+   *   1D tensor of length size holding the window
+   */
+  template <typename T = float, typename Executor = cudaExecutor>
+  auto window_table(WindowType type, index_t size, const Executor &exec = Executor{})
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_ASSERT_STR(size > 1, matxInvalidSize, "window_table: window length must be greater than one");
+
+    using cache_t = detail::window_table_cache_t<T>;
+    const detail::WindowTableParams_t<T> params{type, size, is_cuda_executor_v<Executor>};
+    tensor_t<T, 1> table;
+
+    detail::GetCache().LookupAndExec<cache_t>(
+      detail::GetCacheIdFromType<cache_t>(),
+      params,
+      [&]() {
+        return detail::make_window_table<T>(type, size, exec);
+      },
+      [&](const tensor_t<T, 1> &cached) {
+        table.Shallow(cached);
+      },
+      exec
+    );
+
+    return table;
+  }
+} // end namespace matx
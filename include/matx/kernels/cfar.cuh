@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+// Access an element of a CFAR input or output through its (batch, row, column)
+// coordinates. The window slides over the last two dimensions (the last one only
+// for rank-1 operators) and all leading dimensions are flattened into the batch.
+template <typename Op>
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ decltype(auto) cfar_access(Op &op, index_t b, index_t r, index_t c) {
+  constexpr int RANK = remove_cvref_t<Op>::Rank();
+  if constexpr (RANK == 1) {
+    return op(c);
+  }
+  else if constexpr (RANK == 2) {
+    return op(r, c);
+  }
+  else {
+    cuda::std::array<index_t, RANK> idx;
+    idx[RANK - 1] = c;
+    idx[RANK - 2] = r;
+    for (int d = RANK - 3; d >= 0; d--) {
+      idx[d] = b % op.Size(d);
+      b /= op.Size(d);
+    }
+    return cuda::std::apply([&](auto... i) -> decltype(auto) { return op(i...); }, idx);
+  }
+}
+
+// Square-law power of a sample. Real inputs are taken to be powers already.
+template <typename P, typename T>
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ P cfar_power(const T &v) {
+  if constexpr (is_complex_v<T>) {
+    return static_cast<P>(v.real()) * static_cast<P>(v.real()) + static_cast<P>(v.imag()) * static_cast<P>(v.imag());
+  }
+  else {
+    return static_cast<P>(v);
+  }
+}
+
+// Number of training cells in a window that lies entirely inside the input
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ index_t cfar_max_cells(const CFARParams &p) {
+  const index_t hr = p.guard_rows + p.train_rows;
+  const index_t hc = p.guard_cols + p.train_cols;
+  return (2 * hr + 1) * (2 * hc + 1) - (2 * p.guard_rows + 1) * (2 * p.guard_cols + 1);
+}
+
+// Order statistic used by OS-CFAR for a window with n valid training cells. Windows
+// clipped by the edge of the input scale the requested rank by the fraction of
+// cells left.
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ index_t cfar_os_rank(const CFARParams &p, index_t n) {
+  const index_t nmax = cfar_max_cells(p);
+  const index_t k = p.os_rank > 0 ? p.os_rank : (3 * nmax + 3) / 4;
+  const index_t ks = (k * n + nmax / 2) / nmax;
+  return ks < 1 ? 1 : (ks > n ? n : ks);
+}
+
+/**
+ * Evaluate the CFAR test for one cell under test (CUT)
+ *
+ * load(dr, dc, v) returns false when the cell at the given offset from the CUT is
+ * outside the input, and otherwise stores its power in v. Cells outside the input
+ * do not count towards the training cells, so windows shrink at the edges. alpha
+ * holds the threshold factor indexed by the number of valid training cells.
+ */
+template <typename P, typename Loader>
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool cfar_cell(const Loader &load, P cut, const CFARParams &p,
+                                                             const P *alpha) {
+  const index_t hr = p.guard_rows + p.train_rows;
+  const index_t hc = p.guard_cols + p.train_cols;
+  const index_t wc = 2 * hc + 1;
+  const index_t cells = (2 * hr + 1) * wc;
+
+  // Walks the training cells of the window in row-major order
+  auto training = [&](index_t t, index_t &dr, index_t &dc, P &v) {
+    dr = t / wc - hr;
+    dc = t % wc - hc;
+    if (dr >= -p.guard_rows && dr <= p.guard_rows && dc >= -p.guard_cols && dc <= p.guard_cols) {
+      return false;
+    }
+    return load(dr, dc, v);
+  };
+
+  index_t dr, dc;
+  P v;
+  if (p.type == CFARType::OS) {
+    index_t n = 0;
+    for (index_t t = 0; t < cells; t++) {
+      n += training(t, dr, dc, v) ? 1 : 0;
+    }
+    if (n == 0) {
+      return false;
+    }
+
+    // k-th smallest training cell by counting the cells below each candidate
+    const index_t k = cfar_os_rank(p, n);
+    P est = 0;
+    for (index_t t = 0; t < cells; t++) {
+      if (!training(t, dr, dc, v)) {
+        continue;
+      }
+
+      index_t lt = 0;
+      index_t le = 0;
+      P u;
+      for (index_t s = 0; s < cells; s++) {
+        if (training(s, dr, dc, u)) {
+          lt += (u < v) ? 1 : 0;
+          le += (u <= v) ? 1 : 0;
+        }
+      }
+      if (lt < k && k <= le) {
+        est = v;
+        break;
+      }
+    }
+
+    return cut > alpha[n] * est;
+  }
+
+  // CA/GO/SO only need sums. The window is split into a leading and lagging half
+  // along the last dimension, with the CUT's own column split by row.
+  P lead = 0;
+  P lag = 0;
+  index_t n_lead = 0;
+  index_t n_lag = 0;
+  for (index_t t = 0; t < cells; t++) {
+    if (!training(t, dr, dc, v)) {
+      continue;
+    }
+    if (dc < 0 || (dc == 0 && dr < 0)) {
+      lead += v;
+      n_lead++;
+    }
+    else {
+      lag += v;
+      n_lag++;
+    }
+  }
+
+  const index_t n = n_lead + n_lag;
+  if (n == 0) {
+    return false;
+  }
+
+  if (p.type == CFARType::CA) {
+    return cut > alpha[n] * ((lead + lag) / static_cast<P>(n));
+  }
+
+  // With one half clipped away by the edge, GO and SO reduce to CA on the other half
+  if (n_lead == 0 || n_lag == 0) {
+    const P m = static_cast<P>(n);
+    const P a = m * (cuda::std::pow(static_cast<P>(p.pfa), static_cast<P>(-1) / m) - static_cast<P>(1));
+    return cut > a * ((lead + lag) / m);
+  }
+
+  const P mean_lead = lead / static_cast<P>(n_lead);
+  const P mean_lag = lag / static_cast<P>(n_lag);
+  const P est = (p.type == CFARType::GO) ? cuda::std::max(mean_lead, mean_lag) : cuda::std::min(mean_lead, mean_lag);
+  return cut > alpha[n] * est;
+}
+
+#ifdef __CUDACC__
+
+// Tiled CFAR detector. Each block stages the power of a tile_r x blockDim.x tile of
+// cells plus the halo covered by the training window in shared memory, then tests
+// every cell of the tile against the window read from shared memory. Batches are
+// spread over the z dimension of the grid.
+template <typename P, typename OutType, typename InType>
+__global__ void cfar_kernel(OutType out, InType in, index_t batches, index_t rows, index_t cols,
+                            index_t tile_r, CFARParams params, const P *alpha) {
+  extern __shared__ __align__(16) char smem[];
+  P *tile = reinterpret_cast<P *>(smem);
+
+  const index_t hr = params.guard_rows + params.train_rows;
+  const index_t hc = params.guard_cols + params.train_cols;
+  const index_t tile_c = blockDim.x;
+  const index_t sr = tile_r + 2 * hr;
+  const index_t sc = tile_c + 2 * hc;
+  const index_t r0 = static_cast<index_t>(blockIdx.y) * tile_r;
+  const index_t c0 = static_cast<index_t>(blockIdx.x) * tile_c;
+  const index_t tid = threadIdx.y * blockDim.x + threadIdx.x;
+  const index_t nthreads = blockDim.x * blockDim.y;
+
+  for (index_t b = blockIdx.z; b < batches; b += gridDim.z) {
+    for (index_t e = tid; e < sr * sc; e += nthreads) {
+      const index_t r = r0 - hr + e / sc;
+      const index_t c = c0 - hc + e % sc;
+      tile[e] = (r >= 0 && r < rows && c >= 0 && c < cols) ? cfar_power<P>(cfar_access(in, b, r, c)) : P(0);
+    }
+    __syncthreads();
+
+    const index_t c = c0 + threadIdx.x;
+    for (index_t tr = threadIdx.y; tr < tile_r; tr += blockDim.y) {
+      const index_t r = r0 + tr;
+      if (r >= rows || c >= cols) {
+        continue;
+      }
+
+      const P *center = tile + (tr + hr) * sc + threadIdx.x + hc;
+      auto load = [&](index_t dr, index_t dc, P &v) {
+        if (r + dr < 0 || r + dr >= rows || c + dc < 0 || c + dc >= cols) {
+          return false;
+        }
+        v = center[dr * sc + dc];
+        return true;
+      };
+
+      const bool det = cfar_cell(load, *center, params, alpha);
+      cfar_access(out, b, r, c) = static_cast<typename OutType::value_type>(det ? 1 : 0);
+    }
+    __syncthreads();
+  }
+}
+
+#endif
+
+} // end namespace detail
+} // end namespace matx
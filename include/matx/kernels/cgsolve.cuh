@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+#include "matx/core/operator_utils.h"
+
+namespace matx {
+
+// Threads per block of the fused CG kernels
+constexpr int CGSOLVE_THREADS = 256;
+// Upper bound on blocks cooperating on one system. Each block writes one partial dot product that every
+// block of the consuming kernel sums itself, which avoids atomics and keeps the sums deterministic.
+constexpr int CGSOLVE_MAX_PARTIALS = 32;
+
+#ifdef __CUDACC__
+
+namespace detail {
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ double CgToDouble(const T &v) {
+  if constexpr (is_matx_half_v<T>) {
+    return static_cast<double>(static_cast<float>(v));
+  }
+  else {
+    return static_cast<double>(v);
+  }
+}
+
+// A system is converged once ||r|| < tol, or |r.r| < tol^2. tol2 <= 0 disables the check
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ bool CgConverged(const T &rr, double tol2) {
+  if (tol2 <= 0.0) {
+    return false;
+  }
+
+  if constexpr (is_complex_v<T>) {
+    const double re = CgToDouble(rr.real());
+    const double im = CgToDouble(rr.imag());
+    return re * re + im * im < tol2 * tol2;
+  }
+  else {
+    const double v = CgToDouble(rr);
+    return v < tol2 && -v < tol2;
+  }
+}
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ T CgBlockSum(T v) {
+  __shared__ alignas(T) unsigned char smem_raw[CGSOLVE_THREADS * sizeof(T)];
+  T *smem = reinterpret_cast<T *>(smem_raw);
+
+  smem[threadIdx.x] = v;
+  __syncthreads();
+  for (int s = CGSOLVE_THREADS / 2; s > 0; s >>= 1) {
+    if (static_cast<int>(threadIdx.x) < s) {
+      smem[threadIdx.x] = smem[threadIdx.x] + smem[threadIdx.x + s];
+    }
+    __syncthreads();
+  }
+
+  const T res = smem[0];
+  __syncthreads();
+  return res;
+}
+
+// Final reduction of the per-block partial sums of one system. Every block computes it in the same order
+// so all blocks agree on the step sizes
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ T CgSumPartials(const T *part, int num) {
+  T s = part[0];
+  for (int k = 1; k < num; k++) {
+    s = s + part[k];
+  }
+  return s;
+}
+
+// pAp = p.Ap for every unconverged system
+template <typename T>
+__global__ void CgDotKernel(const T *p, const T *Ap, const T *rr, T *pAp_part,
+                            index_t n, index_t nb, double tol2) {
+  for (index_t b = blockIdx.y; b < nb; b += gridDim.y) {
+    if (CgConverged(rr[b], tol2)) {
+      continue;
+    }
+
+    T acc = T(0);
+    for (index_t i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x) {
+      acc = acc + p[b * n + i] * Ap[b * n + i];
+    }
+
+    acc = CgBlockSum(acc);
+    if (threadIdx.x == 0) {
+      pAp_part[b * gridDim.x + blockIdx.x] = acc;
+    }
+  }
+}
+
+// x += alpha * p and r -= alpha * Ap with alpha = r.r / p.Ap, accumulating the new r.r in the same pass.
+// A zero p.Ap means the system converged exactly, so it is left untouched
+template <typename T, typename XType>
+__global__ void CgUpdateKernel(XType x, const T *p, const T *Ap, T *r, const T *rr,
+                               const T *pAp_part, T *rr_part, index_t n, index_t nb, double tol2) {
+  for (index_t b = blockIdx.y; b < nb; b += gridDim.y) {
+    if (CgConverged(rr[b], tol2)) {
+      continue;
+    }
+
+    const T pAp = CgSumPartials(pAp_part + b * gridDim.x, gridDim.x);
+    const bool update = pAp != T(0);
+    const T alpha = update ? rr[b] / pAp : T(0);
+
+    T acc = T(0);
+    for (index_t i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x) {
+      const index_t e = b * n + i;
+      T ri = r[e];
+      if (update) {
+        auto &xe = x(GetIdxFromAbs(x, e));
+        xe = xe + alpha * p[e];
+        ri = ri - alpha * Ap[e];
+        r[e] = ri;
+      }
+      acc = acc + ri * ri;
+    }
+
+    acc = CgBlockSum(acc);
+    if (threadIdx.x == 0) {
+      rr_part[b * gridDim.x + blockIdx.x] = acc;
+    }
+  }
+}
+
+// p = r + beta * p with beta = r.r(new) / r.r(old). The new r.r is published for the next iteration in
+// rr_next, and systems still above tolerance are counted into active when it is non-null
+template <typename T>
+__global__ void CgDirectionKernel(T *p, const T *r, const T *rr_cur, T *rr_next, const T *pAp_part,
+                                  const T *rr_part, int *active, index_t n, index_t nb, double tol2) {
+  const bool leader = blockIdx.x == 0 && threadIdx.x == 0;
+
+  for (index_t b = blockIdx.y; b < nb; b += gridDim.y) {
+    const T rr_old = rr_cur[b];
+    if (CgConverged(rr_old, tol2)) {
+      if (leader) {
+        rr_next[b] = rr_old;
+      }
+      continue;
+    }
+
+    const T rr_new = CgSumPartials(rr_part + b * gridDim.x, gridDim.x);
+    if (leader) {
+      rr_next[b] = rr_new;
+      if (active != nullptr && !CgConverged(rr_new, tol2)) {
+        atomicAdd(active, 1);
+      }
+    }
+
+    const T pAp = CgSumPartials(pAp_part + b * gridDim.x, gridDim.x);
+    if (pAp == T(0)) {
+      continue;
+    }
+
+    const T beta = rr_new / rr_old;
+    for (index_t i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x) {
+      const index_t e = b * n + i;
+      p[e] = r[e] + beta * p[e];
+    }
+  }
+}
+
+} // namespace detail
+
+#endif
+
+} // namespace matx
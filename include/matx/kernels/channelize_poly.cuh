@@ -82,9 +82,12 @@ __MATX_DEVICE__ __MATX_INLINE__ auto channelize_cast_input(InputT v)
 }
 } // namespace detail
 
+// In all of the channelizer kernels below, output element t of each channel is computed from the
+// input as if it were element t + elem_offset. Streaming channelizers prepend filter history to the
+// input and use elem_offset to skip the outputs that were already produced from that history.
 template <int THREADS, typename OutType, typename InType, typename FilterType, typename AccumType>
 __launch_bounds__(THREADS)
-__global__ void ChannelizePoly1D(OutType output, InType input, FilterType filter)
+__global__ void ChannelizePoly1D(OutType output, InType input, FilterType filter, index_t elem_offset)
 {
     using output_t = typename OutType::value_type;
     using input_t = typename InType::value_type;
@@ -143,13 +146,14 @@ __global__ void ChannelizePoly1D(OutType output, InType input, FilterType filter
 
     if (filter_phase_len <= SMEM_MAX_FILTER_TAPS) {
         for (index_t t = first_out_elem+tid; t <= last_out_elem; t += THREADS) {
-            const index_t first_ind = cuda::std::max(static_cast<index_t>(0), t - filter_phase_len + 1);
+            const index_t tin = t + elem_offset;
+            const index_t first_ind = cuda::std::max(static_cast<index_t>(0), tin - filter_phase_len + 1);
             accum_t accum {};
             const filter_t *h = smem_filter;
             // index_t in MatX should be signed (32 or 64 bit), so j-- below will not underflow
             static_assert(std::is_signed_v<index_t>, "assumed signed index_t, but it is unsigned");
-            indims[InRank-1] = t * num_channels + (num_channels - 1 - channel);
-            index_t j_start = t;
+            indims[InRank-1] = tin * num_channels + (num_channels - 1 - channel);
+            index_t j_start = tin;
             if (indims[InRank-1] >= input_len) {
                 j_start--;
                 indims[InRank-1] -= num_channels;
@@ -175,18 +179,19 @@ __global__ void ChannelizePoly1D(OutType output, InType input, FilterType filter
         }
     } else {
         for (index_t t = first_out_elem+tid; t <= last_out_elem; t += THREADS) {
-            index_t first_ind = cuda::std::max(static_cast<index_t>(0), t - filter_phase_len + 1);
+            const index_t tin = t + elem_offset;
+            index_t first_ind = cuda::std::max(static_cast<index_t>(0), tin - filter_phase_len + 1);
             // If we use the last filter tap for this phase (which is the first index because
             // the filter is flipped), then it may be a padded zero. If so, increment first_ind
             // by 1 to avoid using the zero. This prevents a bounds-check in the inner loop.
-            if (first_ind == (t - filter_phase_len + 1)) {
+            if (first_ind == (tin - filter_phase_len + 1)) {
                 const bool h_is_padded = ((filter_phase_len-1) * num_channels + channel) >= filter_full_len;
                 if (h_is_padded) {
                     first_ind++;
                 }
             }
-            indims[InRank-1] = t * num_channels + (num_channels - 1 - channel);
-            index_t j_start = t;
+            indims[InRank-1] = tin * num_channels + (num_channels - 1 - channel);
+            index_t j_start = tin;
             index_t h_ind { channel };
             // If the last signal element is a zero-pad value, then skip it to prevent needing
             // per-access bounds checking in the inner loop.
@@ -219,7 +224,8 @@ __global__ void ChannelizePoly1D(OutType output, InType input, FilterType filter
 // This kernel works in cases where the full filter (with potentially some zero padding) and
 // the inputs required to compute elems_per_channel_per_cta outputs all fit into shared memory.
 template <typename OutType, typename InType, typename FilterType, typename AccumType>
-__global__ void ChannelizePoly1D_Smem(OutType output, InType input, FilterType filter, index_t elems_per_channel_per_cta)
+__global__ void ChannelizePoly1D_Smem(OutType output, InType input, FilterType filter, index_t elems_per_channel_per_cta,
+                                      index_t elem_offset)
 {
     using output_t = typename OutType::value_type;
     using input_t = typename InType::value_type;
@@ -280,7 +286,7 @@ __global__ void ChannelizePoly1D_Smem(OutType output, InType input, FilterType f
     outdims[ChannelRank] = chan;
 
     for (int32_t t = ty; t < filter_phase_len-1; t += by) {
-        const index_t out_sample_ind = start_elem - (filter_phase_len-1) + t;
+        const index_t out_sample_ind = start_elem + elem_offset - (filter_phase_len-1) + t;
         const int32_t smem_ind = t * num_channels + chan;
         const index_t input_ind = out_sample_ind * num_channels + chan;
         if (input_ind >= 0 && input_ind < input_len) {
@@ -306,7 +312,7 @@ __global__ void ChannelizePoly1D_Smem(OutType output, InType input, FilterType f
         const index_t next_last_elem = cuda::std::min(next_start_elem + static_cast<index_t>(by) - 1, last_elem);
         const int32_t out_samples_this_iter = static_cast<int32_t>(next_last_elem - next_start_elem + 1);
         if (ty < out_samples_this_iter) {
-            indims[InRank-1] = (next_start_elem + ty) * num_channels + chan;
+            indims[InRank-1] = (next_start_elem + elem_offset + ty) * num_channels + chan;
             const int32_t smem_ind = cached_input_ind_tail * num_channels + chan;
             if (indims[InRank-1] < input_len) {
                 cuda::std::apply([smem_input, smem_ind, &input](auto &&...args) {
@@ -367,7 +373,7 @@ __global__ void ChannelizePoly1D_Smem(OutType output, InType input, FilterType f
 
 template <int THREADS, int NUM_CHAN, typename OutType, typename InType, typename FilterType, typename AccumType>
 __launch_bounds__(THREADS)
-__global__ void ChannelizePoly1D_FusedChan(OutType output, InType input, FilterType filter)
+__global__ void ChannelizePoly1D_FusedChan(OutType output, InType input, FilterType filter, index_t elem_offset)
 {
     using output_t = typename OutType::value_type;
     using input_t = typename InType::value_type;
@@ -430,9 +436,10 @@ __global__ void ChannelizePoly1D_FusedChan(OutType output, InType input, FilterT
         for (int i = 0; i < NUM_CHAN; i++) {
             accum[i] = static_cast<filtering_accum_t>(0);
         }
-        index_t first_ind = cuda::std::max(static_cast<index_t>(0), t - filter_phase_len + 1);
-        indims[InRank-1] = t * NUM_CHAN + NUM_CHAN - 1;
-        index_t j_start = t;
+        const index_t tin = t + elem_offset;
+        index_t first_ind = cuda::std::max(static_cast<index_t>(0), tin - filter_phase_len + 1);
+        indims[InRank-1] = tin * NUM_CHAN + NUM_CHAN - 1;
+        index_t j_start = tin;
         index_t h_ind { 0 };
         index_t niter = j_start - first_ind + 1;
         // For the last signal element, we need bounds-checking because we may need to zero-pad the signal.
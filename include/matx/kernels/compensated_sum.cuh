@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/kernels/fltflt.h"
+#include <cuda/std/__algorithm/min.h>
+
+namespace matx {
+namespace detail {
+
+constexpr int COMP_SUM_THREADS = 256;
+// Columns each block of the first pass covers before its partial is written
+constexpr index_t COMP_SUM_COLS_PER_BLOCK = 64 * 1024;
+
+/**
+ * Running float-float sum of float or complex<float> values
+ *
+ * Every addition carries the rounding error of the float sum in the low word, so a sum of n terms has
+ * an error close to that of a double accumulation instead of growing with n as a float one does.
+ */
+template <typename T>
+struct CompensatedSum {
+  // No member initializers so the type stays trivial and can be placed in shared memory
+  fltflt re;
+  fltflt im;
+
+  static __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ CompensatedSum Zero()
+  {
+    CompensatedSum s;
+    s.re = fltflt{0.0f, 0.0f};
+    s.im = fltflt{0.0f, 0.0f};
+    return s;
+  }
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ void Add(const T &v)
+  {
+    if constexpr (is_complex_v<T>) {
+      re = fltflt_add(re, static_cast<float>(v.real()));
+      im = fltflt_add(im, static_cast<float>(v.imag()));
+    }
+    else {
+      re = fltflt_add(re, static_cast<float>(v));
+    }
+  }
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ void Add(const CompensatedSum &o)
+  {
+    re = fltflt_add(re, o.re);
+    if constexpr (is_complex_v<T>) {
+      im = fltflt_add(im, o.im);
+    }
+  }
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T Value(float scale = 1.0f) const
+  {
+    if constexpr (is_complex_v<T>) {
+      return T{fltflt_to_float(fltflt_mul(re, scale)), fltflt_to_float(fltflt_mul(im, scale))};
+    }
+    else {
+      return static_cast<T>(fltflt_to_float(fltflt_mul(re, scale)));
+    }
+  }
+};
+
+/** Types the compensated sum applies to. Other types use the regular reduction. */
+template <typename T>
+inline constexpr bool is_compensated_sum_type_v =
+    std::is_same_v<T, float> || std::is_same_v<T, cuda::std::complex<float>>;
+
+#ifdef __CUDACC__
+template <int THREADS, typename T>
+__MATX_DEVICE__ __MATX_INLINE__ CompensatedSum<T> CompensatedBlockReduce(CompensatedSum<T> part)
+{
+  __shared__ CompensatedSum<T> parts[THREADS];
+  parts[threadIdx.x] = part;
+  __syncthreads();
+
+  MATX_LOOP_UNROLL
+  for (int s = THREADS / 2; s > 0; s /= 2) {
+    if (static_cast<int>(threadIdx.x) < s) {
+      parts[threadIdx.x].Add(parts[threadIdx.x + s]);
+    }
+    __syncthreads();
+  }
+
+  const CompensatedSum<T> total = parts[0];
+  // The buffer is reused by the next row
+  __syncthreads();
+  return total;
+}
+
+/**
+ * First pass of the compensated sum
+ *
+ * The input is viewed as rows x cols in its own row-major order, where the reduced dimensions are the
+ * trailing ones. Block (x, y) sums columns [x * cols_per_block, (x + 1) * cols_per_block) of rows y,
+ * y + gridDim.y, ... and writes one partial per row and block.
+ */
+template <int THREADS, typename T, typename InType>
+__global__ void compensated_sum_partial_kernel(CompensatedSum<T> *partials, InType in,
+                                               cuda::std::array<index_t, InType::Rank()> shape,
+                                               index_t rows, index_t cols, index_t cols_per_block)
+{
+  constexpr int RANK = InType::Rank();
+  const index_t c_begin = static_cast<index_t>(blockIdx.x) * cols_per_block;
+  const index_t c_end = cuda::std::min(cols, c_begin + cols_per_block);
+
+  for (index_t row = blockIdx.y; row < rows; row += gridDim.y) {
+    auto part = CompensatedSum<T>::Zero();
+    for (index_t c = c_begin + threadIdx.x; c < c_end; c += THREADS) {
+      cuda::std::array<index_t, RANK> idx;
+      index_t abs = row * cols + c;
+      MATX_LOOP_UNROLL
+      for (int r = RANK - 1; r >= 0; r--) {
+        idx[r] = abs % shape[r];
+        abs /= shape[r];
+      }
+      part.Add(static_cast<T>(cuda::std::apply([&](auto... i) { return in(i...); }, idx)));
+    }
+
+    part = CompensatedBlockReduce<THREADS>(part);
+    if (threadIdx.x == 0) {
+      partials[row * gridDim.x + blockIdx.x] = part;
+    }
+  }
+}
+
+/**
+ * Second pass of the compensated sum. Each block combines the partials of one row and writes the
+ * row's sum, multiplied by scale, to the output.
+ */
+template <int THREADS, typename T, typename OutType>
+__global__ void compensated_sum_final_kernel(OutType out, const CompensatedSum<T> *partials,
+                                             cuda::std::array<index_t, OutType::Rank() == 0 ? 1 : OutType::Rank()> shape,
+                                             index_t rows, index_t num_partials, float scale)
+{
+  constexpr int RANK = OutType::Rank();
+
+  for (index_t row = blockIdx.x; row < rows; row += gridDim.x) {
+    auto part = CompensatedSum<T>::Zero();
+    for (index_t p = threadIdx.x; p < num_partials; p += THREADS) {
+      part.Add(partials[row * num_partials + p]);
+    }
+
+    part = CompensatedBlockReduce<THREADS>(part);
+    if (threadIdx.x == 0) {
+      using out_t = typename OutType::value_type;
+      if constexpr (RANK == 0) {
+        out() = static_cast<out_t>(part.Value(scale));
+      }
+      else {
+        cuda::std::array<index_t, RANK> idx;
+        index_t abs = row;
+        MATX_LOOP_UNROLL
+        for (int r = RANK - 1; r >= 0; r--) {
+          idx[r] = abs % shape[r];
+          abs /= shape[r];
+        }
+        cuda::std::apply([&](auto... i) -> decltype(auto) { return out(i...); }, idx) =
+            static_cast<out_t>(part.Value(scale));
+      }
+    }
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
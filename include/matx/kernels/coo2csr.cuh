@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __CUDACC__
+
+#include <cuda.h>
+
+namespace matx {
+
+// Kernel that builds the column coordinates and row positions of an m x n CSR
+// matrix from nse unique linearized keys (row * n + col) in sorted order.
+// Since the keys are sorted, the position of row r is the first entry with a
+// row >= r. Thread k writes the positions of all rows in between the rows of
+// entries k-1 and k, so every position is written exactly once, without the
+// need for atomics. Thread nse closes all remaining (empty) rows.
+template <typename CRD, typename POS>
+__global__ void coo2csr_assemble_kernel(const uint64_t *keys, uint64_t nse,
+                                        uint64_t m, uint64_t n, CRD *crd,
+                                        POS *pos) {
+  const uint64_t k = static_cast<uint64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (k <= nse) {
+    const uint64_t lo = k == 0 ? 0 : keys[k - 1] / n + 1;
+    const uint64_t hi = k == nse ? m : keys[k] / n;
+    for (uint64_t r = lo; r <= hi; r++) {
+      pos[r] = static_cast<POS>(k);
+    }
+    if (k < nse) {
+      crd[k] = static_cast<CRD>(keys[k] % n);
+    }
+  }
+}
+
+} // namespace matx
+
+#endif
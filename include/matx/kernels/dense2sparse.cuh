@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __CUDACC__
+
+#include <cub/cub.cuh>
+
+namespace matx {
+
+constexpr int DENSE2SPARSE_THREADS = 256;
+constexpr index_t DENSE2SPARSE_MAX_BLOCKS = 65536;
+
+// Kernel that counts the nonzeros of each line of a row-major m x n matrix,
+// where a line is a row for CSR and a column for CSC. Each block reduces one
+// line at a time. The count past the last line is zeroed, so that an exclusive
+// scan over all lines + 1 counts yields the positions, including the total.
+template <bool BY_COL, typename T>
+__global__ void dense2sparse_count_kernel(const T *a, index_t m, index_t n,
+                                          index_t *counts) {
+  using BlockReduce = cub::BlockReduce<index_t, DENSE2SPARSE_THREADS>;
+  __shared__ typename BlockReduce::TempStorage temp;
+
+  const index_t lines = BY_COL ? n : m;
+  const index_t len = BY_COL ? m : n;
+  const index_t stride = BY_COL ? n : 1;
+  for (index_t line = blockIdx.x; line < lines; line += gridDim.x) {
+    const T *p = BY_COL ? a + line : a + line * n;
+    index_t cnt = 0;
+    for (index_t k = threadIdx.x; k < len; k += blockDim.x) {
+      cnt += p[k * stride] != T(0) ? 1 : 0;
+    }
+    cnt = BlockReduce(temp).Sum(cnt);
+    if (threadIdx.x == 0) {
+      counts[line] = cnt;
+    }
+    __syncthreads();
+  }
+  if (blockIdx.x == 0 && threadIdx.x == 0) {
+    counts[lines] = 0;
+  }
+}
+
+// Kernel that writes the values and coordinates of each line at the offsets
+// from the scan of the counts. The entries of a line are ranked with a block
+// scan, chunk by chunk, so they keep their order. Entries past the capacity
+// are dropped, and the positions are clamped to the capacity so the output
+// always describes a valid matrix.
+template <bool BY_COL, typename T, typename CRD, typename POS>
+__global__ void dense2sparse_fill_kernel(const T *a, index_t m, index_t n,
+                                         const index_t *offsets,
+                                         index_t capacity, T *val, CRD *crd,
+                                         POS *pos) {
+  using BlockScan = cub::BlockScan<index_t, DENSE2SPARSE_THREADS>;
+  __shared__ typename BlockScan::TempStorage temp;
+
+  const index_t lines = BY_COL ? n : m;
+  const index_t len = BY_COL ? m : n;
+  const index_t stride = BY_COL ? n : 1;
+  for (index_t line = blockIdx.x; line < lines; line += gridDim.x) {
+    const T *p = BY_COL ? a + line : a + line * n;
+    index_t base = offsets[line];
+    if (threadIdx.x == 0) {
+      pos[line] = static_cast<POS>(base < capacity ? base : capacity);
+    }
+    for (index_t k0 = 0; k0 < len; k0 += blockDim.x) {
+      const index_t k = k0 + threadIdx.x;
+      const T v = k < len ? p[k * stride] : T(0);
+      const index_t flag = (k < len && v != T(0)) ? 1 : 0;
+      index_t rank, total;
+      BlockScan(temp).ExclusiveSum(flag, rank, total);
+      const index_t dst = base + rank;
+      if (flag && dst < capacity) {
+        val[dst] = v;
+        crd[dst] = static_cast<CRD>(k);
+      }
+      base += total;
+      __syncthreads();
+    }
+  }
+  if (blockIdx.x == 0 && threadIdx.x == 0) {
+    const index_t nnz = offsets[lines];
+    pos[lines] = static_cast<POS>(nnz < capacity ? nnz : capacity);
+  }
+}
+
+} // namespace matx
+
+#endif
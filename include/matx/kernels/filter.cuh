@@ -106,13 +106,25 @@ MATX_LOOP_UNROLL
       threadIdx.x;
 
   // Copy signal input. If we're a thread that needs to share data with other
-  // blocks for the map step, store that value as well
-  if (tid < len) {
+  // blocks for the map step, store that value as well. Values past the end of
+  // the signal in the last chunk are zero-filled so they can't feed garbage
+  // into the recursion of the valid samples
 MATX_LOOP_UNROLL
-    for (index_t r = 0; r < RECURSIVE_VALS_PER_THREAD; r++) {
+  for (index_t r = 0; r < RECURSIVE_VALS_PER_THREAD; r++) {
+    if (tid + BLOCK_SIZE_RECURSIVE * r < len) {
       vals[r] = d_in(static_cast<index_t>(blockIdx.y), static_cast<index_t>(tid + BLOCK_SIZE_RECURSIVE * r));
     }
+    else {
+      if constexpr (is_cuda_complex_v<InType>) {
+        vals[r] = make_cuFloatComplex(0.0, 0.0);
+      }
+      else {
+        vals[r] = 0;
+      }
+    }
+  }
 
+  if (tid < len) {
     if (lane > WARP_SIZE - num_non_recursive) {
 MATX_LOOP_UNROLL
       for (index_t r = 0; r < RECURSIVE_VALS_PER_THREAD; r++) {
@@ -134,7 +146,8 @@ MATX_LOOP_UNROLL
       }
       else {
         s_exch[threadIdx.x] =
-            d_in(static_cast<index_t>(blockIdx.y), static_cast<index_t>(chunk_id * blockDim.x - threadIdx.x - 1));
+            d_in(static_cast<index_t>(blockIdx.y),
+                 static_cast<index_t>(chunk_id) * RECURSIVE_CHUNK_SIZE - threadIdx.x - 1);
       }
     }
   }
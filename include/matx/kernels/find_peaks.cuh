@@ -0,0 +1,335 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+#ifdef __CUDACC__
+#include <cub/block/block_scan.cuh>
+#endif
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+// Peak tests shared by the CUDA kernels and the host path. Rows are the
+// outer dimension of a rank 2 input, and a rank 1 input is a single row.
+template <typename InType>
+struct FindPeaksEval {
+  using value_type = typename InType::value_type;
+  using compute_type = cuda::std::conditional_t<cuda::std::is_integral_v<value_type>, double, promote_half_t<value_type>>;
+
+  InType in;
+  index_t n;
+  compute_type height;
+  compute_type threshold;
+  index_t distance;
+  compute_type prominence;
+  index_t wlen;
+  compute_type rel_height;
+  bool props;
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ compute_type Load(index_t row, index_t i) const {
+    if constexpr (InType::Rank() == 1) {
+      return static_cast<compute_type>(in(i));
+    }
+    else {
+      return static_cast<compute_type>(in(row, i));
+    }
+  }
+
+  // Height and neighbour threshold test of a sample v between l and r
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool IsPeak(compute_type l, compute_type v, compute_type r) const {
+    return v >= height && !(l > v - threshold) && !(r > v - threshold);
+  }
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool Candidate(index_t row, index_t i) const {
+    if (i <= 0 || i >= n - 1) {
+      return false;
+    }
+    return IsPeak(Load(row, i - 1), Load(row, i), Load(row, i + 1));
+  }
+
+  // A candidate is suppressed by any other candidate closer than distance
+  // that is higher, or equally high and earlier
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool Suppressed(index_t row, index_t i, compute_type v) const {
+    for (index_t j = 1; j < distance; j++) {
+      if (Candidate(row, i - j) && Load(row, i - j) >= v) {
+        return true;
+      }
+      if (Candidate(row, i + j) && Load(row, i + j) > v) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Prominence and width of the peak at i
+   *
+   * The prominence is the height of the peak above the higher of the lowest
+   * points on each side before a higher sample, searched within wlen samples
+   * centred on the peak when wlen is above 1. The width is measured between
+   * the linearly interpolated crossings of v - rel_height * prominence,
+   * bounded by those lowest points.
+   */
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ void Props(index_t row, index_t i, compute_type v,
+                                                           compute_type &prom, compute_type &width) const {
+    index_t lo = 0;
+    index_t hi = n - 1;
+    if (wlen > 1) {
+      lo = cuda::std::max(lo, i - wlen / 2);
+      hi = cuda::std::min(hi, i + wlen / 2);
+    }
+
+    compute_type left_min = v;
+    index_t left_base = i;
+    for (index_t j = i - 1; j >= lo; j--) {
+      const compute_type x = Load(row, j);
+      if (x > v) {
+        break;
+      }
+      if (x < left_min) {
+        left_min = x;
+        left_base = j;
+      }
+    }
+
+    compute_type right_min = v;
+    index_t right_base = i;
+    for (index_t j = i + 1; j <= hi; j++) {
+      const compute_type x = Load(row, j);
+      if (x > v) {
+        break;
+      }
+      if (x < right_min) {
+        right_min = x;
+        right_base = j;
+      }
+    }
+
+    prom = v - cuda::std::max(left_min, right_min);
+
+    const compute_type ref = v - prom * rel_height;
+    index_t j = i;
+    while (j > left_base && Load(row, j) > ref) {
+      j--;
+    }
+    compute_type left_ip = static_cast<compute_type>(j);
+    if (Load(row, j) < ref) {
+      left_ip += (ref - Load(row, j)) / (Load(row, j + 1) - Load(row, j));
+    }
+
+    j = i;
+    while (j < right_base && Load(row, j) > ref) {
+      j++;
+    }
+    compute_type right_ip = static_cast<compute_type>(j);
+    if (Load(row, j) < ref) {
+      right_ip -= (ref - Load(row, j)) / (Load(row, j - 1) - Load(row, j));
+    }
+
+    width = right_ip - left_ip;
+  }
+
+  // Final decision for the peak at i, reading the input directly
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool Evaluate(index_t row, index_t i,
+                                                              compute_type &prom, compute_type &width) const {
+    prom = 0;
+    width = 0;
+    if (!Candidate(row, i)) {
+      return false;
+    }
+
+    const compute_type v = Load(row, i);
+    if (Suppressed(row, i, v)) {
+      return false;
+    }
+
+    if (props) {
+      Props(row, i, v, prom, width);
+      return prom >= prominence;
+    }
+    return true;
+  }
+};
+
+// Writes the k-th peak of a row into the output operators
+template <bool PROPS, typename IdxType, typename NumType, typename PromType, typename WidthType>
+struct FindPeaksStore {
+  IdxType idx;
+  NumType num;
+  PromType prom;
+  WidthType width;
+
+  template <typename Op>
+  static __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ decltype(auto) At(const Op &op, index_t row, index_t k) {
+    if constexpr (Op::Rank() == 1) {
+      return op(k);
+    }
+    else {
+      return op(row, k);
+    }
+  }
+
+  template <typename CType>
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ void Peak(index_t row, index_t k, index_t i,
+                                                          [[maybe_unused]] CType p, [[maybe_unused]] CType w) const {
+    At(idx, row, k) = i;
+    if constexpr (PROPS) {
+      At(prom, row, k) = static_cast<typename PromType::value_type>(p);
+      At(width, row, k) = static_cast<typename WidthType::value_type>(w);
+    }
+  }
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ void Count(index_t row, index_t found) const {
+    if constexpr (NumType::Rank() == 0) {
+      num() = static_cast<int>(found);
+    }
+    else {
+      num(row) = static_cast<int>(found);
+    }
+  }
+};
+
+#ifdef __CUDACC__
+/**
+ * Detect peaks in THREADS-wide tiles of every row
+ *
+ * Each block stages its tile and a halo of distance - 1 samples (plus one
+ * more for the neighbour test) in shared memory, flags the candidates of the
+ * whole span, and suppresses each of its own candidates against the flags in
+ * the halo. Surviving peaks get their prominence and width from global
+ * memory when props is set. The keep flag of every sample is written to mask
+ * for a single compaction pass afterwards.
+ */
+template <int THREADS, typename Eval>
+__global__ void find_peaks_detect_kernel(Eval eval, uint8_t *mask, typename Eval::compute_type *prom,
+                                         typename Eval::compute_type *width, index_t tiles_per_row)
+{
+  using compute_type = typename Eval::compute_type;
+  extern __shared__ __align__(16) char find_peaks_smem[];
+
+  const index_t halo = eval.distance - 1;
+  const index_t span = THREADS + 2 * halo;
+  compute_type *s_vals = reinterpret_cast<compute_type *>(find_peaks_smem);
+  uint8_t *s_cand = reinterpret_cast<uint8_t *>(s_vals + span + 2);
+
+  const int tid = static_cast<int>(threadIdx.x);
+  const index_t row = blockIdx.x / tiles_per_row;
+  const index_t base = (blockIdx.x % tiles_per_row) * THREADS;
+  const index_t n = eval.n;
+
+  for (index_t k = tid; k < span + 2; k += THREADS) {
+    const index_t p = base - halo - 1 + k;
+    s_vals[k] = (p >= 0 && p < n) ? eval.Load(row, p) : compute_type(0);
+  }
+  __syncthreads();
+
+  for (index_t k = tid; k < span; k += THREADS) {
+    const index_t p = base - halo + k;
+    s_cand[k] = p > 0 && p < n - 1 && eval.IsPeak(s_vals[k], s_vals[k + 1], s_vals[k + 2]);
+  }
+  __syncthreads();
+
+  const index_t i = base + tid;
+  if (i >= n) {
+    return;
+  }
+
+  const index_t k = halo + tid;
+  const compute_type v = s_vals[k + 1];
+  bool keep = s_cand[k];
+  for (index_t j = 1; keep && j <= halo; j++) {
+    if ((s_cand[k - j] && s_vals[k - j + 1] >= v) || (s_cand[k + j] && s_vals[k + j + 1] > v)) {
+      keep = false;
+    }
+  }
+
+  compute_type p = 0;
+  compute_type w = 0;
+  if (keep && eval.props) {
+    eval.Props(row, i, v, p, w);
+    keep = p >= eval.prominence;
+  }
+
+  mask[row * n + i] = keep;
+  if (eval.props) {
+    prom[row * n + i] = p;
+    width[row * n + i] = w;
+  }
+}
+
+/**
+ * Compact the peaks flagged in mask into the outputs, one block per row
+ *
+ * The row is walked in THREADS-wide chunks with a block-wide exclusive sum of
+ * the flags giving each peak its output slot, so the peaks of a row stay in
+ * ascending order.
+ */
+template <int THREADS, typename CType, typename Store>
+__global__ void find_peaks_compact_kernel(const uint8_t *mask, const CType *prom, const CType *width,
+                                          Store store, index_t n)
+{
+  using BlockScan = cub::BlockScan<int, THREADS>;
+  __shared__ typename BlockScan::TempStorage temp;
+
+  const index_t row = blockIdx.x;
+  const int tid = static_cast<int>(threadIdx.x);
+  index_t found = 0;
+
+  for (index_t base = 0; base < n; base += THREADS) {
+    const index_t i = base + tid;
+    const index_t off = row * n + i;
+    const int flag = i < n ? mask[off] : 0;
+
+    int slot;
+    int total;
+    BlockScan(temp).ExclusiveSum(flag, slot, total);
+    if (flag) {
+      store.Peak(row, found + slot, i, prom != nullptr ? prom[off] : CType(0),
+                 width != nullptr ? width[off] : CType(0));
+    }
+
+    found += total;
+    __syncthreads();
+  }
+
+  if (tid == 0) {
+    store.Count(row, found);
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+#include "matx/kernels/segmented.cuh"
+
+namespace matx {
+namespace detail {
+
+// Bit pattern of a key for hashing. Zeros of either sign hash the same since
+// they compare equal.
+template <typename T>
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ uint64_t hash_key_bits(T k) {
+  if constexpr (cuda::std::is_floating_point_v<T>) {
+    if (k == T(0)) {
+      return 0;
+    }
+  }
+
+  if constexpr (sizeof(T) == 8) {
+    uint64_t u;
+    memcpy(&u, &k, sizeof(T));
+    return u;
+  }
+  else if constexpr (sizeof(T) == 4) {
+    uint32_t u;
+    memcpy(&u, &k, sizeof(T));
+    return u;
+  }
+  else if constexpr (sizeof(T) == 2) {
+    uint16_t u;
+    memcpy(&u, &k, sizeof(T));
+    return u;
+  }
+  else {
+    uint8_t u;
+    memcpy(&u, &k, sizeof(T));
+    return u;
+  }
+}
+
+// 64-bit finalizer from MurmurHash3
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ uint64_t hash_mix(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+#ifdef __CUDACC__
+/**
+ * Insert key i into an open-addressing table with linear probing
+ *
+ * Slots hold the index of the first key inserted into them, or -1 when empty,
+ * so keys of any comparable type can be stored and no key value is reserved
+ * as a sentinel. Returns the slot of the key, and sets inserted when this call
+ * claimed the slot.
+ */
+template <typename KeyIter>
+__device__ __MATX_INLINE__ unsigned int hash_insert(int *table, unsigned int mask, const KeyIter &keys, index_t i,
+                                                    bool &inserted)
+{
+  const auto k = keys[i];
+  unsigned int h = static_cast<unsigned int>(hash_mix(hash_key_bits(k))) & mask;
+  while (true) {
+    const int prev = atomicCAS(&table[h], -1, static_cast<int>(i));
+    if (prev == -1) {
+      inserted = true;
+      return h;
+    }
+    if (keys[prev] == k) {
+      inserted = false;
+      return h;
+    }
+    h = (h + 1) & mask;
+  }
+}
+
+// Atomically combine v into *addr with op
+template <typename T, typename Op>
+__device__ __MATX_INLINE__ void hash_atomic_combine(T *addr, T v, Op op)
+{
+  constexpr bool native_add = cuda::std::is_same_v<Op, SegmentedSumOp<T>> &&
+    (cuda::std::is_same_v<T, float> || cuda::std::is_same_v<T, double> || cuda::std::is_same_v<T, int> ||
+     cuda::std::is_same_v<T, unsigned int> || cuda::std::is_same_v<T, unsigned long long>);
+
+  if constexpr (native_add) {
+    atomicAdd(addr, v);
+  }
+  else {
+    using U = cuda::std::conditional_t<sizeof(T) == 4, unsigned int, unsigned long long>;
+    U *uaddr = reinterpret_cast<U *>(addr);
+    U old = *uaddr;
+    U assumed;
+    do {
+      assumed = old;
+      T cur;
+      memcpy(&cur, &assumed, sizeof(T));
+      const T next = op(cur, v);
+      U unext;
+      memcpy(&unext, &next, sizeof(T));
+      if (unext == assumed) {
+        break;
+      }
+      old = atomicCAS(uaddr, assumed, unext);
+    } while (assumed != old);
+  }
+}
+
+/**
+ * Unordered unique: every key that claims a table slot appends itself to the
+ * output
+ */
+template <typename KeyIter, typename T>
+__global__ void hash_unique_kernel(KeyIter keys, index_t n, int *table, unsigned int mask, T *out,
+                                   index_t out_size, int *count)
+{
+  const index_t i = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i >= n) {
+    return;
+  }
+
+  bool inserted;
+  hash_insert(table, mask, keys, i, inserted);
+  if (inserted) {
+    const int pos = atomicAdd(count, 1);
+    if (pos < out_size) {
+      out[pos] = keys[i];
+    }
+  }
+}
+
+/**
+ * First pass of groupby_reduce(): build the table, assign each new key a
+ * group, and initialize that group's outputs. slot_of records the table slot
+ * of every key for the second pass.
+ */
+template <typename KeyIter, typename K, typename V>
+__global__ void hash_groupby_insert_kernel(KeyIter keys, index_t n, int *table, unsigned int mask,
+                                           unsigned int *slot_of, int *slot_group, K *keys_out, V *vals_out,
+                                           int *counts_out, index_t out_size, int *num_groups, V init)
+{
+  const index_t i = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i >= n) {
+    return;
+  }
+
+  bool inserted;
+  const unsigned int h = hash_insert(table, mask, keys, i, inserted);
+  slot_of[i] = h;
+  if (inserted) {
+    const int g = atomicAdd(num_groups, 1);
+    slot_group[h] = g;
+    if (g < out_size) {
+      keys_out[g] = keys[i];
+      vals_out[g] = init;
+      counts_out[g] = 0;
+    }
+  }
+}
+
+/**
+ * Second pass of groupby_reduce(): fold every value into its group
+ */
+template <typename ValIter, typename V, typename Op>
+__global__ void hash_groupby_reduce_kernel(ValIter values, index_t n, const unsigned int *slot_of,
+                                           const int *slot_group, V *vals_out, int *counts_out,
+                                           index_t out_size, Op op)
+{
+  const index_t i = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i >= n) {
+    return;
+  }
+
+  const int g = slot_group[slot_of[i]];
+  if (g < out_size) {
+    hash_atomic_combine(&vals_out[g], static_cast<V>(values[i]), op);
+    atomicAdd(&counts_out[g], 1);
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+template <typename InType>
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ auto hist_load(const InType &in, index_t row, index_t i) {
+  if constexpr (InType::Rank() == 1) {
+    return in(i);
+  }
+  else {
+    return in(row, i);
+  }
+}
+
+// Evenly spaced bins over [lower, upper). Returns -1 for samples outside the
+// range, including NaN.
+template <typename T>
+struct HistEvenBins {
+  using compute_type = cuda::std::conditional_t<cuda::std::is_integral_v<T>, double, promote_half_t<T>>;
+  compute_type lower;
+  compute_type upper;
+  int bins;
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ int operator()(T s) const {
+    const compute_type v = static_cast<compute_type>(s);
+    if (!(v >= lower && v < upper)) {
+      return -1;
+    }
+
+    const int b = static_cast<int>((v - lower) * static_cast<compute_type>(bins) / (upper - lower));
+    return b < bins ? b : bins - 1;
+  }
+};
+
+// Bins between consecutive entries of a sorted edge array, with bin i holding
+// samples in [edges[i], edges[i+1]).
+template <typename T, typename EdgeType>
+struct HistRangeBins {
+  EdgeType edges;
+  int bins;
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ int operator()(T s) const {
+    if (!(s >= edges(0) && s < edges(bins))) {
+      return -1;
+    }
+
+    int lo = 0;
+    int hi = bins;
+    while (hi - lo > 1) {
+      const int mid = (lo + hi) / 2;
+      if (s < edges(mid)) {
+        hi = mid;
+      }
+      else {
+        lo = mid;
+      }
+    }
+    return lo;
+  }
+};
+
+// Maps sample i of a row to a bin of a 1D histogram
+template <typename InType, typename Bins>
+struct HistBinner1D {
+  InType in;
+  Bins bins;
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ int operator()(index_t row, index_t i) const {
+    return bins(hist_load(in, row, i));
+  }
+};
+
+// Maps sample i of a row of x and y to a bin of a joint histogram. Bins are
+// laid out row-major with the x bin as the slower index.
+template <typename XType, typename YType, typename XBins, typename YBins>
+struct HistBinner2D {
+  XType x;
+  YType y;
+  XBins xbins;
+  YBins ybins;
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ int operator()(index_t row, index_t i) const {
+    const int bx = xbins(hist_load(x, row, i));
+    if (bx < 0) {
+      return -1;
+    }
+
+    const int by = ybins(hist_load(y, row, i));
+    if (by < 0) {
+      return -1;
+    }
+
+    return bx * ybins.bins + by;
+  }
+};
+
+#ifdef __CUDACC__
+/**
+ * Batched histogram with shared-memory privatization
+ *
+ * Each row of n samples is split across blocks_per_row blocks, and row r owns
+ * bins [r * bins, (r + 1) * bins) of out, which must be zeroed beforehand.
+ * When smem is set every block counts into its own shared memory copy of the
+ * row's histogram and adds it to global memory once at the end, so atomics on
+ * popular bins stay on chip. Otherwise the block counts into global memory
+ * directly, which is used when the bins do not fit in shared memory.
+ */
+template <int THREADS, typename Binner>
+__global__ void hist_kernel(Binner binner, int *out, index_t n, int bins, int blocks_per_row, bool smem)
+{
+  extern __shared__ int s_hist[];
+
+  const index_t row = blockIdx.x / blocks_per_row;
+  const index_t part = blockIdx.x % blocks_per_row;
+  const int tid = static_cast<int>(threadIdx.x);
+
+  int *row_out = out + row * bins;
+  int *h = smem ? s_hist : row_out;
+
+  if (smem) {
+    for (int i = tid; i < bins; i += THREADS) {
+      s_hist[i] = 0;
+    }
+    __syncthreads();
+  }
+
+  for (index_t i = part * THREADS + tid; i < n; i += static_cast<index_t>(blocks_per_row) * THREADS) {
+    const int b = binner(row, i);
+    if (b >= 0) {
+      atomicAdd(&h[b], 1);
+    }
+  }
+
+  if (smem) {
+    __syncthreads();
+    for (int i = tid; i < bins; i += THREADS) {
+      if (s_hist[i] != 0) {
+        atomicAdd(&row_out[i], s_hist[i]);
+      }
+    }
+  }
+}
+
+#endif
+
+} // end namespace detail
+} // end namespace matx
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+#include "matx/kernels/cgsolve.cuh"
+
+namespace matx {
+
+#ifdef __CUDACC__
+
+namespace detail {
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ T KrylovConj(const T &v) {
+  if constexpr (is_complex_v<T>) {
+    return cuda::std::conj(v);
+  }
+  else {
+    return v;
+  }
+}
+
+// Inner product term conj(a) * b
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ T KrylovDotTerm(const T &a, const T &b) {
+  return KrylovConj(a) * b;
+}
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ auto KrylovAbs(const T &v) {
+  return cuda::std::abs(v);
+}
+
+// A residual norm squared below tol^2 freezes the iterate. tol2 <= 0 or a null rr never freezes
+template <typename R>
+__MATX_DEVICE__ __MATX_INLINE__ bool KrylovConverged(const R *rr, double tol2) {
+  return rr != nullptr && tol2 > 0.0 && static_cast<double>(*rr) < tol2;
+}
+
+// Inverse of the diagonal of A, or 1 where the diagonal is zero. Works for dense and sparse A through
+// element access
+template <typename T, typename AType>
+__global__ void KrylovDiagInvKernel(T *dinv, AType A, index_t n) {
+  const index_t i = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i < n) {
+    const T d = static_cast<T>(A(i, i));
+    dinv[i] = d != T(0) ? T(1) / d : T(1);
+  }
+}
+
+// out = num / den, or 0 once converged or at breakdown
+template <typename T, typename R>
+__global__ void KrylovRatioKernel(T *out, const T *num, const T *den, const R *rr, double tol2) {
+  *out = (KrylovConverged(rr, tol2) || *den == T(0)) ? T(0) : *num / *den;
+}
+
+// BiCGStab direction coefficient beta = (rho_new / rho) * (alpha / omega)
+template <typename T, typename R>
+__global__ void KrylovBiCGStabBetaKernel(T *beta, const T *rho_new, const T *rho, const T *alpha,
+                                         const T *omega, const R *rr, double tol2) {
+  const bool breakdown = *rho == T(0) || *omega == T(0);
+  *beta = (KrylovConverged(rr, tol2) || breakdown) ? T(0) : (*rho_new / *rho) * (*alpha / *omega);
+}
+
+// Pipelined CG: gamma = (r,u), delta = (w,u) and rr = (r,r) in a single pass
+template <typename T>
+__global__ void KrylovPipeDotsKernel(const T *r, const T *u, const T *w, T *part, index_t n) {
+  T gamma = T(0);
+  T delta = T(0);
+  T rr = T(0);
+  for (index_t i = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x) {
+    gamma = gamma + KrylovDotTerm(r[i], u[i]);
+    delta = delta + KrylovDotTerm(w[i], u[i]);
+    rr = rr + KrylovDotTerm(r[i], r[i]);
+  }
+
+  gamma = CgBlockSum(gamma);
+  delta = CgBlockSum(delta);
+  rr = CgBlockSum(rr);
+  if (threadIdx.x == 0) {
+    part[blockIdx.x] = gamma;
+    part[gridDim.x + blockIdx.x] = delta;
+    part[2 * gridDim.x + blockIdx.x] = rr;
+  }
+}
+
+// Pipelined CG step sizes. coef holds {alpha, beta, gamma_old, alpha_old}, and rr receives ||r||^2
+template <typename T, typename R>
+__global__ void KrylovPipeCoeffKernel(T *coef, R *rr, const T *part, int nparts, bool first, double tol2) {
+  const T gamma = CgSumPartials(part, nparts);
+  const T delta = CgSumPartials(part + nparts, nparts);
+  *rr = static_cast<R>(KrylovAbs(CgSumPartials(part + 2 * nparts, nparts)));
+
+  T alpha = T(0);
+  T beta = T(0);
+  if (!KrylovConverged(rr, tol2)) {
+    if (first) {
+      alpha = delta != T(0) ? gamma / delta : T(0);
+    }
+    else {
+      beta = coef[2] != T(0) ? gamma / coef[2] : T(0);
+      const T den = coef[3] != T(0) ? delta - beta * gamma / coef[3] : T(0);
+      alpha = den != T(0) ? gamma / den : T(0);
+    }
+  }
+
+  coef[0] = alpha;
+  coef[1] = beta;
+  coef[2] = gamma;
+  coef[3] = alpha;
+}
+
+// Pipelined CG vector recurrences, fused into one pass
+template <typename T, typename XType>
+__global__ void KrylovPipeUpdateKernel(XType x, T *r, T *u, T *w, T *z, T *q, T *s, T *p,
+                                       const T *m, const T *nv, const T *coef, index_t n) {
+  const T alpha = coef[0];
+  const T beta = coef[1];
+  for (index_t i = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x) {
+    const T zi = nv[i] + beta * z[i];
+    const T qi = m[i] + beta * q[i];
+    const T si = w[i] + beta * s[i];
+    const T pi = u[i] + beta * p[i];
+    z[i] = zi;
+    q[i] = qi;
+    s[i] = si;
+    p[i] = pi;
+    x(i) = x(i) + alpha * pi;
+    r[i] = r[i] - alpha * si;
+    u[i] = u[i] - alpha * qi;
+    w[i] = w[i] - alpha * zi;
+  }
+}
+
+// GMRES: start a cycle with g = {||r||, 0, ...} and inv = 1 / ||r||
+template <typename T, typename R>
+__global__ void KrylovGmresStartKernel(T *g, T *inv, const R *rn2, int len) {
+  const R beta = cuda::std::sqrt(*rn2);
+  g[0] = T(beta);
+  for (int i = 1; i < len; i++) {
+    g[i] = T(0);
+  }
+  *inv = beta > R(0) ? T(R(1) / beta) : T(0);
+}
+
+// GMRES: h(j+1, j) = ||w|| and inv = 1 / ||w||. A zero norm is a happy breakdown and leaves v(j+1) zero
+template <typename T, typename R>
+__global__ void KrylovArnoldiNormKernel(T *hj1, T *inv, const R *wn2) {
+  const R nrm = cuda::std::sqrt(*wn2);
+  *hj1 = T(nrm);
+  *inv = nrm > R(0) ? T(R(1) / nrm) : T(0);
+}
+
+// GMRES: copy Arnoldi column j into H, apply the previous Givens rotations, and build a new one that
+// annihilates H(j+1, j). The residual norm squared of the least-squares problem lands in resid2
+template <typename T, typename R>
+__global__ void KrylovGivensKernel(T *H, index_t ldh, T *cs, T *sn, T *g, const T *hj, int j, R *resid2) {
+  for (int i = 0; i <= j + 1; i++) {
+    H[i * ldh + j] = hj[i];
+  }
+
+  for (int i = 0; i < j; i++) {
+    const T a = H[i * ldh + j];
+    const T b = H[(i + 1) * ldh + j];
+    H[i * ldh + j] = cs[i] * a + sn[i] * b;
+    H[(i + 1) * ldh + j] = -KrylovConj(sn[i]) * a + cs[i] * b;
+  }
+
+  const T a = H[j * ldh + j];
+  const T b = H[(j + 1) * ldh + j];
+  const R abs_a = KrylovAbs(a);
+  const R denom = cuda::std::sqrt(abs_a * abs_a + KrylovAbs(b) * KrylovAbs(b));
+  T c, s;
+  if (denom == R(0)) {
+    c = T(1);
+    s = T(0);
+  }
+  else if (abs_a == R(0)) {
+    c = T(0);
+    s = T(1);
+  }
+  else {
+    c = T(abs_a / denom);
+    s = (a / T(abs_a)) * KrylovConj(b) / T(denom);
+  }
+
+  cs[j] = c;
+  sn[j] = s;
+  H[j * ldh + j] = c * a + s * b;
+  H[(j + 1) * ldh + j] = T(0);
+  g[j + 1] = -KrylovConj(s) * g[j];
+  g[j] = c * g[j];
+  *resid2 = KrylovAbs(g[j + 1]) * KrylovAbs(g[j + 1]);
+}
+
+// GMRES: solve the k x k upper triangular system H y = g. Zero pivots (only left after breakdown)
+// contribute nothing
+template <typename T>
+__global__ void KrylovBackSubKernel(const T *H, index_t ldh, const T *g, T *y, int k) {
+  for (int i = k - 1; i >= 0; i--) {
+    T acc = g[i];
+    for (int l = i + 1; l < k; l++) {
+      acc = acc - H[i * ldh + l] * y[l];
+    }
+    const T d = H[i * ldh + i];
+    y[i] = d != T(0) ? acc / d : T(0);
+  }
+}
+
+} // namespace detail
+
+#endif
+
+} // namespace matx
@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __CUDACC__
+
+#include <cuda.h>
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Plane sets written when splitting an interleaved complex matrix
+ */
+enum class ComplexSplitMode_t {
+  REAL_IMAG_SUM,  ///< re, im, re + im (3M operands)
+  REAL_IMAG,      ///< re, im (4M A operand)
+  REAL_IMAG_REAL, ///< re, im, re (4M B operand, so [im, re] is also a contiguous pair)
+};
+
+/**
+ * Split a complex matrix operator into contiguous row-major real planes
+ *
+ * Each thread reads one complex element once and writes every plane it feeds, so the
+ * interleaved-to-planar conversion and the 3M operand sum share a single read of the input.
+ * The input is any operator, which also absorbs transposed or otherwise strided views.
+ */
+template <ComplexSplitMode_t MODE, typename PlaneT, typename InOp>
+__global__ void complex_split_planes_kernel(PlaneT *planes, InOp in, index_t rows, index_t cols)
+{
+  const index_t c = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  const index_t r = static_cast<index_t>(blockIdx.y) * blockDim.y + threadIdx.y;
+  if (r >= rows || c >= cols) {
+    return;
+  }
+
+  const index_t plane = rows * cols;
+  const index_t i = r * cols + c;
+  const auto v = in(r, c);
+  const float re = static_cast<float>(v.real());
+  const float im = static_cast<float>(v.imag());
+
+  planes[i] = static_cast<PlaneT>(re);
+  planes[plane + i] = static_cast<PlaneT>(im);
+  if constexpr (MODE == ComplexSplitMode_t::REAL_IMAG_SUM) {
+    planes[2 * plane + i] = static_cast<PlaneT>(re + im);
+  }
+  else if constexpr (MODE == ComplexSplitMode_t::REAL_IMAG_REAL) {
+    planes[2 * plane + i] = static_cast<PlaneT>(re);
+  }
+}
+
+/**
+ * Combine real GEMM products back into an interleaved complex output
+ *
+ * For 3M the planes are [ArBr, AiBi, (Ar+Ai)(Br+Bi)], giving re = p0 - p1 and
+ * im = p2 - p0 - p1. For 4M they are [ArBr, AiBi, ArBi, AiBr], giving re = p0 - p1 and
+ * im = p2 + p3.
+ */
+template <bool IS_3M, typename OutOp>
+__global__ void complex_combine_planes_kernel(OutOp out, const float *planes, index_t rows, index_t cols,
+                                              float alpha, float beta)
+{
+  using T = typename OutOp::value_type;
+  const index_t c = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  const index_t r = static_cast<index_t>(blockIdx.y) * blockDim.y + threadIdx.y;
+  if (r >= rows || c >= cols) {
+    return;
+  }
+
+  const index_t plane = rows * cols;
+  const index_t i = r * cols + c;
+  const float p0 = planes[i];
+  const float p1 = planes[plane + i];
+  float re = p0 - p1;
+  float im;
+  if constexpr (IS_3M) {
+    im = planes[2 * plane + i] - p0 - p1;
+  }
+  else {
+    im = planes[2 * plane + i] + planes[3 * plane + i];
+  }
+
+  re *= alpha;
+  im *= alpha;
+  if (beta != 0.0f) {
+    const T prev = out(r, c);
+    re += beta * static_cast<float>(prev.real());
+    im += beta * static_cast<float>(prev.imag());
+  }
+
+  out(r, c) = T{re, im};
+}
+
+} // end namespace detail
+
+} // end namespace matx
+
+#endif
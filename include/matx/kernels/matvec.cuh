@@ -39,37 +39,128 @@
 
 namespace matx {
 
-// Kernel that performs SpMV for an m x n DIA-I matrix.
-template <typename VAL, typename CRD>
-__global__ void diai_spmv_kernel(VAL *A, CRD *diags, uint64_t numDiags, VAL *B,
-                                 VAL *C, uint64_t m, uint64_t n) {
-  uint64_t i = blockIdx.x * blockDim.x + threadIdx.x;
-  if (i < m) {
+// Kernel that performs SpMV for an m x n DIA-I or DIA-J matrix, or for a
+// uniform batch of such matrices (one batch per grid row). Each block handles
+// a tile of consecutive rows and first stages the window of B that is touched
+// by all diagonals of that tile in shared memory, so that B is read from global
+// memory only once per block rather than once per diagonal. Bands that are too
+// wide for the shared memory window read B directly from global memory.
+template <bool DIAI, typename VAL, typename CRD>
+__global__ void dia_spmv_kernel(const VAL *A, const CRD *diags,
+                                uint64_t numDiags, const VAL *B, VAL *C,
+                                uint64_t m, uint64_t n, uint64_t window) {
+  extern __shared__ __align__(16) char smem[];
+  VAL *tile = reinterpret_cast<VAL *>(smem);
+  __shared__ int64_t lo, hi;
+
+  const int64_t M = static_cast<int64_t>(m);
+  const int64_t N = static_cast<int64_t>(n);
+  const int64_t i0 = static_cast<int64_t>(blockIdx.x) * blockDim.x;
+  const int64_t i = i0 + threadIdx.x;
+
+  // Values of a uniform batch are stored diagonal-major across all batches.
+  const uint64_t batch = blockIdx.y;
+  const uint64_t ld = gridDim.y * (DIAI ? m : n);
+  const VAL *Ab = A + batch * (DIAI ? m : n);
+  const VAL *Bb = B + batch * n;
+
+  // Find the band of the diagonals.
+  if (threadIdx.x == 0) {
+    int64_t l = 0, h = 0;
+    for (uint64_t d = 0; d < numDiags; d++) {
+      const int64_t o = diags[d];
+      l = d == 0 || o < l ? o : l;
+      h = d == 0 || o > h ? o : h;
+    }
+    lo = l;
+    hi = h;
+  }
+  __syncthreads();
+
+  // Stage the window [js, je) of B used by the rows of this tile.
+  const int64_t iEnd = i0 + blockDim.x < M ? i0 + blockDim.x : M;
+  const int64_t js = i0 + lo > 0 ? i0 + lo : 0;
+  const int64_t je = iEnd + hi < N ? iEnd + hi : N;
+  const bool tiled = je - js <= static_cast<int64_t>(window);
+  if (tiled) {
+    for (int64_t j = js + threadIdx.x; j < je; j += blockDim.x) {
+      tile[j - js] = Bb[j];
+    }
+  }
+  __syncthreads();
+
+  if (i < M) {
     VAL acc = 0.0;
     for (uint64_t d = 0; d < numDiags; d++) {
-      int64_t j = i + diags[d]; // signed
-      if (0 <= j && j < static_cast<int64_t>(n)) {
-        acc += A[d * m + i] * B[j];
+      const int64_t j = i + diags[d]; // signed
+      if (0 <= j && j < N) {
+        const VAL a = DIAI ? Ab[d * ld + i] : Ab[d * ld + j];
+        acc += a * (tiled ? tile[j - js] : Bb[j]);
       }
     }
-    C[i] = acc;
+    C[batch * m + i] = acc;
   }
 }
 
-// Kernel that performs SpMV for an m x n DIA-J matrix.
-template <typename VAL, typename CRD>
-__global__ void diaj_spmv_kernel(VAL *A, CRD *diags, uint64_t numDiags, VAL *B,
-                                 VAL *C, uint64_t m, uint64_t n) {
-  uint64_t i = blockIdx.x * blockDim.x + threadIdx.x;
-  if (i < m) {
-    VAL acc = 0.0;
-    for (uint64_t d = 0; d < numDiags; d++) {
-      int64_t j = i + diags[d]; // signed
-      if (0 <= j && j < static_cast<int64_t>(n)) {
-        acc += A[d * n + j] * B[j];
+// Batched matvec for tiny matrices: C[b] = alpha * A[b] * B[b] + beta * C[b], with
+// A of shape (batches, m, n). Each block stages mats_per_block consecutive matrices
+// and their vectors in shared memory with coalesced loads, then one thread computes
+// each output row. M and N are the matrix sizes when known at compile time (zero
+// otherwise) so the inner loops unroll. Rows are padded to an odd stride in shared
+// memory so that threads reading different rows avoid bank conflicts.
+template <int M, int N, typename T, typename CType, typename AType, typename BType>
+__global__ void small_batched_matvec_kernel(CType C, AType A, BType B, index_t batches,
+                                            index_t m_rt, index_t n_rt, index_t mats_per_block,
+                                            T alpha, T beta) {
+  extern __shared__ __align__(16) char smem[];
+  const index_t m = M > 0 ? M : m_rt;
+  const index_t n = N > 0 ? N : n_rt;
+  const index_t ld = (n % 2 == 0) ? n + 1 : n;
+  T *sa = reinterpret_cast<T *>(smem);
+  T *sb = sa + mats_per_block * m * ld;
+
+  const index_t first = static_cast<index_t>(blockIdx.x) * mats_per_block;
+  const index_t mats = first + mats_per_block <= batches ? mats_per_block : batches - first;
+
+  for (index_t e = threadIdx.x; e < mats * m * n; e += blockDim.x) {
+    const index_t bb = e / (m * n);
+    const index_t rem = e - bb * m * n;
+    const index_t i = rem / n;
+    const index_t j = rem - i * n;
+    sa[bb * m * ld + i * ld + j] = A(first + bb, i, j);
+  }
+
+  for (index_t e = threadIdx.x; e < mats * n; e += blockDim.x) {
+    const index_t bb = e / n;
+    sb[e] = B(first + bb, e - bb * n);
+  }
+  __syncthreads();
+
+  for (index_t e = threadIdx.x; e < mats * m; e += blockDim.x) {
+    const index_t bb = e / m;
+    const index_t i = e - bb * m;
+    const T *row = sa + bb * m * ld + i * ld;
+    const T *vec = sb + bb * n;
+
+    T acc{};
+    if constexpr (N > 0) {
+#pragma unroll
+      for (int j = 0; j < N; j++) {
+        acc += row[j] * vec[j];
+      }
+    }
+    else {
+      for (index_t j = 0; j < n; j++) {
+        acc += row[j] * vec[j];
       }
     }
-    C[i] = acc;
+
+    if (beta == T(0)) {
+      C(first + bb, i) = alpha * acc;
+    }
+    else {
+      C(first + bb, i) = alpha * acc + beta * C(first + bb, i);
+    }
   }
 }
 
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+template <typename Op>
+__MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ decltype(auto) mvdr_at(const Op &op, index_t batch, index_t i, index_t j) {
+  if constexpr (Op::Rank() == 2) {
+    return op(i, j);
+  }
+  else {
+    return op(batch, i, j);
+  }
+}
+
+#ifdef __CUDACC__
+// Set each contiguous m x m matrix of r to load times the identity
+template <typename T, typename RealType>
+__global__ void mvdr_diag_load_kernel(T *r, index_t m, index_t total, RealType load)
+{
+  const index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx < total) {
+    r[idx] = (idx % (m * m)) % (m + 1) == 0 ? T(load) : T(0);
+  }
+}
+
+/**
+ * Normalize the MVDR weights of one beam per block
+ *
+ * z holds conj(R^-1 v) for every beam as a contiguous row of m elements. The
+ * block reduces the distortionless response v^H R^-1 v, which is real for a
+ * positive-definite R, and writes w = R^-1 v / (v^H R^-1 v).
+ */
+template <int THREADS, typename T, typename VType, typename WType>
+__global__ void mvdr_normalize_kernel(const T *z, VType v, WType w, index_t m, index_t beams)
+{
+  using real_type = typename T::value_type;
+  __shared__ real_type partial[THREADS];
+
+  const index_t batch = blockIdx.x / beams;
+  const index_t beam = blockIdx.x % beams;
+  const T *zb = z + static_cast<index_t>(blockIdx.x) * m;
+  const int tid = static_cast<int>(threadIdx.x);
+
+  real_type acc = 0;
+  for (index_t i = tid; i < m; i += THREADS) {
+    acc += (static_cast<T>(mvdr_at(v, batch, i, beam)) * zb[i]).real();
+  }
+  partial[tid] = acc;
+  __syncthreads();
+
+  for (int s = THREADS / 2; s > 0; s >>= 1) {
+    if (tid < s) {
+      partial[tid] += partial[tid + s];
+    }
+    __syncthreads();
+  }
+
+  const real_type d = partial[0];
+  for (index_t i = tid; i < m; i += THREADS) {
+    mvdr_at(w, batch, i, beam) = cuda::std::conj(zb[i]) / d;
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
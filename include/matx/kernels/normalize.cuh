@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+// Largest set of rows, in bytes, a block keeps in shared memory so the input is only read once
+constexpr size_t ROW_NORM_MAX_CACHED_BYTES = 32 * 1024;
+constexpr int ROW_NORM_THREADS = 256;
+// Rows up to this length are handled by a single warp, and longer rows by a whole block
+constexpr index_t ROW_NORM_WARP_MAX_COLS = 1024;
+
+enum class RowNormKind {
+  MAX,
+  L1,
+  L2,
+  LP
+};
+
+#ifdef __CUDACC__
+template <typename AccT>
+__MATX_DEVICE__ __MATX_INLINE__ AccT RowNormCombine(RowNormKind kind, AccT a, AccT b)
+{
+  return kind == RowNormKind::MAX ? cuda::std::max(a, b) : a + b;
+}
+
+/**
+ * Norm or normalization of each row of an operator in a single launch
+ *
+ * Rows are taken over the permuted shape, where the normalized dimension comes last. Each row is handled
+ * by GROUP threads, either one warp or the whole block, which accumulate max |x|, sum |x|, sum x^2 or
+ * sum |x|^p over the row and reduce it with warp shuffles. With NORMALIZE the group then writes x / norm
+ * for every element of the row, reading it from shared memory when CACHE_ROW is set and from the input
+ * again otherwise. Without NORMALIZE the norm itself is written to the output, which drops the last
+ * dimension.
+ */
+template <int THREADS, int GROUP, bool CACHE_ROW, bool NORMALIZE, typename AccT, typename OutType, typename InType, int RANK>
+__global__ void row_norm_kernel(OutType out, InType in, cuda::std::array<int, RANK> perm,
+                                cuda::std::array<index_t, RANK> pshape, index_t rows, index_t cols,
+                                RowNormKind kind, AccT p)
+{
+  extern __shared__ char row_norm_smem[];
+  __shared__ AccT warp_parts[THREADS / 32];
+
+  constexpr int GROUPS = THREADS / GROUP;
+  const int group = static_cast<int>(threadIdx.x) / GROUP;
+  const int lane = static_cast<int>(threadIdx.x) % GROUP;
+  const index_t row = static_cast<index_t>(blockIdx.x) * GROUPS + group;
+  const bool active = row < rows;
+  AccT *row_cache = reinterpret_cast<AccT *>(row_norm_smem) + group * cols;
+
+  auto index_of = [&](index_t c) {
+    cuda::std::array<index_t, RANK> idx;
+    index_t abs = row * cols + c;
+    MATX_LOOP_UNROLL
+    for (int r = RANK - 1; r >= 0; r--) {
+      idx[perm[r]] = abs % pshape[r];
+      abs /= pshape[r];
+    }
+    return idx;
+  };
+
+  auto load = [&](const cuda::std::array<index_t, RANK> &idx) {
+    return static_cast<AccT>(cuda::std::apply([&](auto... i) { return in(i...); }, idx));
+  };
+
+  AccT part = AccT(0);
+  if (active) {
+    for (index_t c = lane; c < cols; c += GROUP) {
+      const AccT x = load(index_of(c));
+      if constexpr (CACHE_ROW) {
+        row_cache[c] = x;
+      }
+      const AccT a = cuda::std::abs(x);
+      switch (kind) {
+        case RowNormKind::MAX: part = cuda::std::max(part, a); break;
+        case RowNormKind::L1:  part += a; break;
+        case RowNormKind::L2:  part += x * x; break;
+        default:               part += cuda::std::pow(a, p); break;
+      }
+    }
+  }
+
+  for (int o = 16; o > 0; o /= 2) {
+    part = RowNormCombine(kind, part, __shfl_down_sync(0xffffffff, part, o));
+  }
+  if constexpr (GROUP == 32) {
+    part = __shfl_sync(0xffffffff, part, 0);
+  }
+  else {
+    if (threadIdx.x % 32 == 0) {
+      warp_parts[threadIdx.x / 32] = part;
+    }
+    __syncthreads();
+    part = warp_parts[0];
+    MATX_LOOP_UNROLL
+    for (int w = 1; w < THREADS / 32; w++) {
+      part = RowNormCombine(kind, part, warp_parts[w]);
+    }
+  }
+
+  if (!active) {
+    return;
+  }
+
+  AccT norm = part;
+  if (kind == RowNormKind::L2) {
+    norm = cuda::std::sqrt(part);
+  }
+  else if (kind == RowNormKind::LP) {
+    norm = cuda::std::pow(part, AccT(1) / p);
+  }
+
+  using out_t = typename OutType::value_type;
+  if constexpr (NORMALIZE) {
+    // Each lane only reads back the elements it cached itself, so no barrier is needed
+    for (index_t c = lane; c < cols; c += GROUP) {
+      const auto idx = index_of(c);
+      AccT x;
+      if constexpr (CACHE_ROW) {
+        x = row_cache[c];
+      }
+      else {
+        x = load(idx);
+      }
+      cuda::std::apply([&](auto... i) -> decltype(auto) { return out(i...); }, idx) = static_cast<out_t>(x / norm);
+    }
+  }
+  else if (lane == 0) {
+    // The norm-only path is launched with the identity permutation, so the row index is the leading indices
+    const auto idx = index_of(0);
+    cuda::std::array<index_t, RANK - 1> oidx;
+    MATX_LOOP_UNROLL
+    for (int r = 0; r < RANK - 1; r++) {
+      oidx[r] = idx[r];
+    }
+    cuda::std::apply([&](auto... i) -> decltype(auto) { return out(i...); }, oidx) = static_cast<out_t>(norm);
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
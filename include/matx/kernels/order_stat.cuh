@@ -0,0 +1,363 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#ifdef __CUDACC__
+
+#include <cuda.h>
+#include <cuda_fp16.h>
+#include <cuda_bf16.h>
+#include <cuda/std/bit>
+#include <cuda/std/limits>
+
+#include "matx/core/half.h"
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+// Raw bits of floating point values, including the MatX half types
+template <typename T>
+__device__ __forceinline__ auto order_stat_bits(T v) {
+  if constexpr (std::is_same_v<T, matxFp16>) {
+    return static_cast<uint16_t>(__half_as_ushort(v.x));
+  }
+  else if constexpr (std::is_same_v<T, matxBf16>) {
+    return static_cast<uint16_t>(__bfloat16_as_ushort(v.x));
+  }
+  else {
+    using K = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    return cuda::std::bit_cast<K>(v);
+  }
+}
+
+template <typename T, typename K>
+__device__ __forceinline__ T order_stat_from_bits(K u) {
+  if constexpr (std::is_same_v<T, matxFp16>) {
+    T r;
+    r.x = __ushort_as_half(u);
+    return r;
+  }
+  else if constexpr (std::is_same_v<T, matxBf16>) {
+    T r;
+    r.x = __ushort_as_bfloat16(u);
+    return r;
+  }
+  else {
+    return cuda::std::bit_cast<T>(u);
+  }
+}
+
+// Order-preserving mapping of a value onto an unsigned key. Comparing two keys
+// as unsigned integers gives the same result as comparing the original values.
+template <typename T>
+__device__ __forceinline__ auto order_stat_to_key(T v) {
+  if constexpr (std::is_floating_point_v<T> || is_matx_half_v<T>) {
+    using K = decltype(order_stat_bits(v));
+    constexpr K sign = static_cast<K>(K(1) << (sizeof(K) * 8 - 1));
+    const K u = order_stat_bits(v);
+    return (u & sign) ? static_cast<K>(~u) : static_cast<K>(u | sign);
+  }
+  else if constexpr (std::is_signed_v<T>) {
+    using K = std::make_unsigned_t<T>;
+    constexpr K sign = static_cast<K>(K(1) << (sizeof(K) * 8 - 1));
+    return static_cast<K>(static_cast<K>(v) ^ sign);
+  }
+  else {
+    return v;
+  }
+}
+
+template <typename T, typename K>
+__device__ __forceinline__ T order_stat_from_key(K k) {
+  if constexpr (std::is_floating_point_v<T> || is_matx_half_v<T>) {
+    constexpr K sign = static_cast<K>(K(1) << (sizeof(K) * 8 - 1));
+    return order_stat_from_bits<T>((k & sign) ? static_cast<K>(k ^ sign) : static_cast<K>(~k));
+  }
+  else if constexpr (std::is_signed_v<T>) {
+    constexpr K sign = static_cast<K>(K(1) << (sizeof(K) * 8 - 1));
+    return static_cast<T>(static_cast<K>(k ^ sign));
+  }
+  else {
+    return k;
+  }
+}
+
+template <typename T>
+using order_stat_key_t = decltype(order_stat_to_key(cuda::std::declval<T>()));
+
+// Key of element i of row b. With DESCENDING the key order is reversed so the
+// same ascending selection finds the largest values.
+template <bool DESCENDING, typename T, typename InType>
+__device__ __forceinline__ auto order_stat_key_at(const InType &in, index_t b, index_t i) {
+  T v;
+  if constexpr (InType::Rank() == 1) {
+    v = static_cast<T>(in(i));
+  }
+  else {
+    v = static_cast<T>(in(b, i));
+  }
+
+  const auto key = order_stat_to_key(v);
+  if constexpr (DESCENDING) {
+    return static_cast<decltype(key)>(~key);
+  }
+  else {
+    return key;
+  }
+}
+
+/**
+ * Block-wide radix select of the key with rank k in row b
+ *
+ * Each pass histograms the next 8 bits of the keys that still match the prefix
+ * found so far and narrows the prefix to the bin holding rank k, so the row is
+ * read once per key byte and no workspace beyond shared memory is needed. On
+ * return every thread holds the selected key, the number of keys equal to it,
+ * and the rank of the selection among those equal keys.
+ */
+template <int THREADS, bool DESCENDING, typename T, typename InType, typename K>
+__device__ void order_stat_block_select(const InType &in, index_t b, index_t n, index_t k,
+                                        K &key, index_t &rank_in_eq, index_t &num_eq)
+{
+  constexpr int BINS = 256;
+  constexpr int PASSES = static_cast<int>(sizeof(K));
+
+  __shared__ unsigned int hist[BINS];
+  __shared__ K s_prefix;
+  __shared__ index_t s_k;
+  __shared__ index_t s_eq;
+
+  const int tid = static_cast<int>(threadIdx.x);
+
+  K prefix = 0;
+  K mask = 0;
+  index_t kk = k;
+
+  for (int pass = 0; pass < PASSES; pass++) {
+    const int shift = (PASSES - 1 - pass) * 8;
+
+    for (int i = tid; i < BINS; i += THREADS) {
+      hist[i] = 0;
+    }
+    __syncthreads();
+
+    for (index_t i = tid; i < n; i += THREADS) {
+      const K ikey = order_stat_key_at<DESCENDING, T>(in, b, i);
+      if ((ikey & mask) == prefix) {
+        atomicAdd(&hist[(ikey >> shift) & 0xff], 1u);
+      }
+    }
+    __syncthreads();
+
+    if (tid == 0) {
+      index_t below = 0;
+      int bin = 0;
+      for (; bin < BINS - 1; bin++) {
+        if (below + hist[bin] > kk) {
+          break;
+        }
+        below += hist[bin];
+      }
+
+      s_k = kk - below;
+      s_eq = hist[bin];
+      s_prefix = static_cast<K>(prefix | (static_cast<K>(bin) << shift));
+    }
+    __syncthreads();
+
+    prefix = s_prefix;
+    kk = s_k;
+    mask = static_cast<K>(mask | (static_cast<K>(0xff) << shift));
+    num_eq = s_eq;
+    __syncthreads();
+  }
+
+  key = prefix;
+  rank_in_eq = kk;
+}
+
+/**
+ * Radix select of the k-th smallest value of each row
+ *
+ * One block handles one row of length n. If hi is not null the (k+1)-th
+ * smallest value is also written, which costs at most one more read of the
+ * row. The input is only read, so rows are never reordered.
+ */
+template <int THREADS, typename T, typename InType>
+__global__ void order_stat_kernel(InType in, T *lo, T *hi, index_t n, index_t k)
+{
+  using K = order_stat_key_t<T>;
+
+  __shared__ unsigned long long s_next;
+
+  const index_t b = blockIdx.x;
+  const int tid = static_cast<int>(threadIdx.x);
+
+  K prefix;
+  index_t kk;
+  index_t num_eq;
+  order_stat_block_select<THREADS, false, T>(in, b, n, k, prefix, kk, num_eq);
+
+  const T value = order_stat_from_key<T>(prefix);
+  if (tid == 0) {
+    lo[b] = value;
+  }
+
+  if (hi == nullptr) {
+    return;
+  }
+
+  // The next value is the same as the k-th one unless rank k was the last
+  // copy of it, in which case it is the smallest key above the prefix
+  if (kk + 1 < num_eq || k + 1 >= n) {
+    if (tid == 0) {
+      hi[b] = value;
+    }
+    return;
+  }
+
+  if (tid == 0) {
+    s_next = ~0ULL;
+  }
+  __syncthreads();
+
+  for (index_t i = tid; i < n; i += THREADS) {
+    const K key = order_stat_key_at<false, T>(in, b, i);
+    if (key > prefix) {
+      atomicMin(&s_next, static_cast<unsigned long long>(key));
+    }
+  }
+  __syncthreads();
+
+  if (tid == 0) {
+    hi[b] = order_stat_from_key<T>(static_cast<K>(s_next));
+  }
+}
+
+/**
+ * Top-k selection of each row
+ *
+ * One block handles one row of length n. The key with rank k-1 (in descending
+ * order when DESCENDING) is found with order_stat_block_select, then a single
+ * pass gathers every key that orders before it plus as many copies of it as
+ * needed into shared memory, and a bitonic sort of those k entries orders the
+ * output. Dynamic shared memory must hold P keys and P indices, where P is k
+ * rounded up to a power of two. Which copies of a tied boundary value are kept
+ * is unspecified.
+ */
+template <int THREADS, bool DESCENDING, typename T, typename InType, typename OutT>
+__global__ void topk_kernel(InType in, OutT *vals, index_t *idx, index_t n, index_t k, int P)
+{
+  using K = order_stat_key_t<T>;
+
+  extern __shared__ __align__(alignof(index_t)) unsigned char topk_smem[];
+  index_t *s_idx = reinterpret_cast<index_t *>(topk_smem);
+  K *s_key = reinterpret_cast<K *>(s_idx + P);
+
+  __shared__ index_t s_less;
+  __shared__ index_t s_taken;
+
+  const index_t b = blockIdx.x;
+  const int tid = static_cast<int>(threadIdx.x);
+
+  K pivot;
+  index_t kk;
+  index_t num_eq;
+  order_stat_block_select<THREADS, DESCENDING, T>(in, b, n, k - 1, pivot, kk, num_eq);
+
+  // Entries [0, num_less) take keys strictly before the pivot, the remaining
+  // kk + 1 slots take copies of the pivot itself
+  const index_t num_less = k - 1 - kk;
+
+  for (int i = tid; i < P; i += THREADS) {
+    s_key[i] = static_cast<K>(~K(0));
+    s_idx[i] = cuda::std::numeric_limits<index_t>::max();
+  }
+  if (tid == 0) {
+    s_less = 0;
+    s_taken = 0;
+  }
+  __syncthreads();
+
+  for (index_t i = tid; i < n; i += THREADS) {
+    const K key = order_stat_key_at<DESCENDING, T>(in, b, i);
+    if (key < pivot) {
+      const index_t slot = atomicAdd(reinterpret_cast<unsigned long long *>(&s_less), 1ULL);
+      s_key[slot] = key;
+      s_idx[slot] = i;
+    }
+    else if (key == pivot) {
+      const index_t slot = atomicAdd(reinterpret_cast<unsigned long long *>(&s_taken), 1ULL);
+      if (slot <= kk) {
+        s_key[num_less + slot] = key;
+        s_idx[num_less + slot] = i;
+      }
+    }
+  }
+  __syncthreads();
+
+  // Bitonic sort by (key, index) so the output is ordered and ties list the
+  // lowest index first
+  for (int size = 2; size <= P; size *= 2) {
+    for (int stride = size / 2; stride > 0; stride /= 2) {
+      for (int i = tid; i < P; i += THREADS) {
+        const int j = i ^ stride;
+        if (j > i) {
+          const bool up = (i & size) == 0;
+          const bool greater = s_key[i] > s_key[j] || (s_key[i] == s_key[j] && s_idx[i] > s_idx[j]);
+          if (greater == up) {
+            const K tk = s_key[i];
+            s_key[i] = s_key[j];
+            s_key[j] = tk;
+            const index_t ti = s_idx[i];
+            s_idx[i] = s_idx[j];
+            s_idx[j] = ti;
+          }
+        }
+      }
+      __syncthreads();
+    }
+  }
+
+  for (index_t i = tid; i < k; i += THREADS) {
+    const K key = DESCENDING ? static_cast<K>(~s_key[i]) : s_key[i];
+    vals[b * k + i] = static_cast<OutT>(order_stat_from_key<T>(key));
+    idx[b * k + i] = s_idx[i];
+  }
+}
+
+} // end namespace detail
+} // end namespace matx
+
+#endif
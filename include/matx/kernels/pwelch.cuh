@@ -44,23 +44,58 @@ namespace matx {
   namespace detail {
 
 #ifdef __CUDACC__
-    template<PwelchOutputScaleMode OUTPUT_SCALE_MODE, typename T_IN, typename T_OUT, typename fsType>
-    __global__ void pwelch_kernel(const T_IN t_in, T_OUT t_out, fsType fs)
+    /**
+     * Add |X|^2 of every segment's spectrum into acc
+     *
+     * Blocks are PWELCH_ACC_COLS frequency bins wide and PWELCH_ACC_ROWS segments tall, and the
+     * grid's y dimension splits the segments further. Each thread sums its bin over a strided set
+     * of segments, the block reduces those partial sums in shared memory, and one atomic per bin
+     * and block adds the result to acc. Reads of a segment's spectrum stay coalesced, and short
+     * spectra with many segments still fill the GPU.
+     */
+    constexpr int PWELCH_ACC_COLS = 32;
+    constexpr int PWELCH_ACC_ROWS = 8;
+
+    template<typename T_IN, typename AccType>
+    __global__ void pwelch_accumulate_kernel(const T_IN t_in, AccType *acc)
+    {
+      __shared__ AccType partial[PWELCH_ACC_ROWS][PWELCH_ACC_COLS];
+
+      const index_t batches = t_in.Size(0);
+      const index_t nfft = t_in.Size(1);
+      const index_t col = static_cast<index_t>(blockIdx.x) * PWELCH_ACC_COLS + threadIdx.x;
+
+      AccType pxx = 0;
+      if (col < nfft) {
+        for (index_t batch = static_cast<index_t>(blockIdx.y) * PWELCH_ACC_ROWS + threadIdx.y; batch < batches;
+             batch += static_cast<index_t>(gridDim.y) * PWELCH_ACC_ROWS) {
+          pxx += static_cast<AccType>(cuda::std::norm(t_in(batch, col)));
+        }
+      }
+
+      partial[threadIdx.y][threadIdx.x] = pxx;
+      __syncthreads();
+
+      if (threadIdx.y == 0 && col < nfft) {
+        #pragma unroll
+        for (int r = 1; r < PWELCH_ACC_ROWS; r++) {
+          pxx += partial[r][threadIdx.x];
+        }
+        atomicAdd(&acc[col], pxx);
+      }
+    }
+
+    template<PwelchOutputScaleMode OUTPUT_SCALE_MODE, typename AccType, typename T_OUT, typename fsType>
+    __global__ void pwelch_finalize_kernel(const AccType *acc, T_OUT t_out, index_t batches, fsType fs)
     {
       const index_t tid = blockIdx.x * blockDim.x + threadIdx.x;
-      const index_t batches = t_in.Shape()[0];
-      const index_t nfft = t_in.Shape()[1];
+      const index_t nfft = t_out.Size(0);
 
       if (tid < nfft)
       {
-        typename T_OUT::value_type pxx = 0;
+        typename T_OUT::value_type pxx = static_cast<typename T_OUT::value_type>(acc[tid]);
         constexpr typename T_OUT::value_type ten = 10;
 
-        for (index_t batch = 0; batch < batches; batch++)
-        {
-          pxx += cuda::std::norm(t_in(batch, tid));
-        }
-
         if constexpr (OUTPUT_SCALE_MODE == PwelchOutputScaleMode_Spectrum) {
           t_out(tid) = pxx / batches;
         }
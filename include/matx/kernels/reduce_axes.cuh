@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include <cub/block/block_reduce.cuh>
+#include <cub/warp/warp_reduce.cuh>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/array>
+#include <cuda/std/limits>
+
+namespace matx {
+namespace detail {
+
+constexpr int REDUCE_AXES_THREADS = 256;
+// Threads of a column block that read the same output. The rest of the block spans consecutive outputs.
+constexpr int REDUCE_AXES_COL_SPLIT = 8;
+// Rows up to this long are reduced by a single thread each
+constexpr index_t REDUCE_ROWS_THREAD_MAX = 8;
+// Rows up to this long are reduced by a warp each, and longer rows by a whole block
+constexpr index_t REDUCE_ROWS_WARP_MAX = 4096;
+
+/**
+ * Kept and reduced dimensions of a strided input, with strides in elements
+ *
+ * Outputs are numbered row-major over the kept dimensions and reduced elements row-major over the
+ * reduced dimensions, so the last dimension of each list is the one consecutive threads step along.
+ */
+template <int KEEP, int RED>
+struct ReduceAxesLayout {
+  cuda::std::array<index_t, KEEP> keep_sizes;
+  cuda::std::array<index_t, KEEP> keep_strides;
+  cuda::std::array<index_t, RED> red_sizes;
+  cuda::std::array<index_t, RED> red_strides;
+
+  template <int N>
+  static __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ index_t Offset(index_t i, const cuda::std::array<index_t, N> &sizes,
+                                                                      const cuda::std::array<index_t, N> &strides)
+  {
+    index_t off = 0;
+    MATX_LOOP_UNROLL
+    for (int d = N - 1; d >= 0; d--) {
+      off += (i % sizes[d]) * strides[d];
+      i /= sizes[d];
+    }
+    return off;
+  }
+
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ index_t KeepOffset(index_t o) const { return Offset<KEEP>(o, keep_sizes, keep_strides); }
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ index_t RedOffset(index_t r) const { return Offset<RED>(r, red_sizes, red_strides); }
+};
+
+/**
+ * Row reduction with a reduction operator such as reduceOpSum, writing one value per row
+ */
+template <typename Op, typename OutT>
+struct ReduceRowsValuePolicy {
+  using acc_type = OutT;
+  // Rows can be read in any order since only the value is kept
+  static constexpr bool reorderable = true;
+
+  OutT *out;
+
+  __MATX_DEVICE__ __MATX_INLINE__ OutT Init() const { return Op{}.Init(); }
+
+  template <typename InT>
+  __MATX_DEVICE__ __MATX_INLINE__ OutT Load(const InT &v, index_t, index_t) const { return static_cast<OutT>(v); }
+
+  __MATX_DEVICE__ __MATX_INLINE__ OutT Combine(const OutT &a, const OutT &b) const { return Op{}(a, b); }
+
+  __MATX_DEVICE__ __MATX_INLINE__ void Store(index_t o, const OutT &acc) const { out[o] = acc; }
+};
+
+template <typename T>
+struct ReduceRowsArg {
+  T val;
+  index_t idx;
+};
+
+/**
+ * Row argmax or argmin, writing the extreme value and its index counted over the whole input
+ *
+ * Ties go to the lower index, so the result does not depend on how a row is split across threads.
+ */
+template <typename T, bool MAX>
+struct ReduceRowsArgPolicy {
+  using acc_type = ReduceRowsArg<T>;
+  // The index of an element is its position in the row, so rows are read in order
+  static constexpr bool reorderable = false;
+
+  T *out;
+  index_t *idx_out;
+  index_t row_len;
+
+  __MATX_DEVICE__ __MATX_INLINE__ acc_type Init() const
+  {
+    return acc_type{MAX ? cuda::std::numeric_limits<T>::lowest() : cuda::std::numeric_limits<T>::max(), -1};
+  }
+
+  template <typename InT>
+  __MATX_DEVICE__ __MATX_INLINE__ acc_type Load(const InT &v, index_t o, index_t r) const
+  {
+    return acc_type{static_cast<T>(v), o * row_len + r};
+  }
+
+  __MATX_DEVICE__ __MATX_INLINE__ acc_type Combine(const acc_type &a, const acc_type &b) const
+  {
+    if (a.idx < 0) {
+      return b;
+    }
+    if (b.idx < 0) {
+      return a;
+    }
+
+    const bool b_better = MAX ? (b.val > a.val) : (b.val < a.val);
+    if (b_better || (!(MAX ? (a.val > b.val) : (a.val < b.val)) && b.idx < a.idx)) {
+      return b;
+    }
+    return a;
+  }
+
+  __MATX_DEVICE__ __MATX_INLINE__ void Store(index_t o, const acc_type &acc) const
+  {
+    out[o] = acc.val;
+    idx_out[o] = acc.idx;
+  }
+};
+
+template <typename T>
+struct ReduceRowsMoments {
+  index_t n;
+  T mean;
+  T m2;
+};
+
+/**
+ * Row variance in one pass with Welford's update, writing m2 / (n - ddof)
+ *
+ * Partial results of different threads are merged with Chan's formula, so the variance is as accurate as
+ * the two-pass mean and sum of squares it replaces.
+ */
+template <typename T>
+struct ReduceRowsVarPolicy {
+  using acc_type = ReduceRowsMoments<T>;
+  static constexpr bool reorderable = true;
+
+  T *out;
+  int ddof;
+
+  __MATX_DEVICE__ __MATX_INLINE__ acc_type Init() const { return acc_type{0, T(0), T(0)}; }
+
+  template <typename InT>
+  __MATX_DEVICE__ __MATX_INLINE__ acc_type Load(const InT &v, index_t, index_t) const
+  {
+    return acc_type{1, static_cast<T>(v), T(0)};
+  }
+
+  __MATX_DEVICE__ __MATX_INLINE__ acc_type Combine(const acc_type &a, const acc_type &b) const
+  {
+    if (a.n == 0) {
+      return b;
+    }
+    if (b.n == 0) {
+      return a;
+    }
+
+    const index_t n = a.n + b.n;
+    const T delta = b.mean - a.mean;
+    const T wb = static_cast<T>(b.n) / static_cast<T>(n);
+    return acc_type{n, a.mean + delta * wb, a.m2 + b.m2 + delta * delta * static_cast<T>(a.n) * wb};
+  }
+
+  __MATX_DEVICE__ __MATX_INLINE__ void Store(index_t o, const acc_type &acc) const
+  {
+    out[o] = acc.m2 / static_cast<T>(acc.n - ddof);
+  }
+};
+
+// Const call wrapper for CUB collectives over a policy's accumulator
+template <typename Policy>
+struct ReduceRowsCombine {
+  Policy policy;
+
+  __MATX_DEVICE__ __MATX_INLINE__ typename Policy::acc_type operator()(const typename Policy::acc_type &a,
+                                                                       const typename Policy::acc_type &b) const
+  {
+    return policy.Combine(a, b);
+  }
+};
+
+#ifdef __CUDACC__
+/**
+ * Reduce outputs whose innermost kept dimension is the unit-stride one
+ *
+ * Threads along x take consecutive outputs, so every load of a warp is coalesced across the kept axis.
+ * The threads along y split the reduction of each output, and blockIdx.y selects a chunk of the
+ * reduction when one pass would not fill the GPU. Chunk c of output o is written to out[c * outputs + o].
+ */
+template <typename OutT, typename InT, typename Op, int KEEP, int RED>
+__global__ void reduce_axes_column_kernel(OutT *out, const InT *in, ReduceAxesLayout<KEEP, RED> layout,
+                                          index_t outputs, index_t reduced, index_t chunk)
+{
+  constexpr int COLS = REDUCE_AXES_THREADS / REDUCE_AXES_COL_SPLIT;
+  // Raw storage keeps types with constructors, such as complex, legal in shared memory
+  __shared__ __align__(alignof(OutT)) unsigned char smem[REDUCE_AXES_THREADS * sizeof(OutT)];
+  OutT *parts = reinterpret_cast<OutT *>(smem);
+
+  Op op;
+  const index_t o = static_cast<index_t>(blockIdx.x) * COLS + threadIdx.x;
+  const index_t r_begin = static_cast<index_t>(blockIdx.y) * chunk;
+  const index_t r_end = cuda::std::min(r_begin + chunk, reduced);
+
+  OutT acc = op.Init();
+  if (o < outputs) {
+    const InT *base = in + layout.KeepOffset(o);
+    for (index_t r = r_begin + threadIdx.y; r < r_end; r += REDUCE_AXES_COL_SPLIT) {
+      acc = op(acc, static_cast<OutT>(base[layout.RedOffset(r)]));
+    }
+  }
+
+  parts[threadIdx.y * COLS + threadIdx.x] = acc;
+  __syncthreads();
+
+  if (threadIdx.y == 0 && o < outputs) {
+    MATX_LOOP_UNROLL
+    for (int s = 1; s < REDUCE_AXES_COL_SPLIT; s++) {
+      acc = op(acc, parts[s * COLS + threadIdx.x]);
+    }
+    out[static_cast<index_t>(blockIdx.y) * outputs + o] = acc;
+  }
+}
+
+/**
+ * Reduce rows whose unit-stride dimension is reduced
+ *
+ * Each row is reduced by a group of GROUP threads: a single thread for very short rows, a warp, or the
+ * whole block for long rows. A group steps along the unit-stride dimension, so its loads are coalesced,
+ * and with one thread per row consecutive threads read consecutive short rows.
+ */
+template <int GROUP, typename Policy, typename InT, int KEEP, int RED>
+__global__ void reduce_rows_kernel(Policy policy, const InT *in, ReduceAxesLayout<KEEP, RED> layout,
+                                   index_t outputs, index_t reduced)
+{
+  using acc_type = typename Policy::acc_type;
+  constexpr int GROUPS = REDUCE_AXES_THREADS / GROUP;
+  const int lane = static_cast<int>(threadIdx.x) % GROUP;
+  const int group = static_cast<int>(threadIdx.x) / GROUP;
+  const index_t o = static_cast<index_t>(blockIdx.x) * GROUPS + group;
+
+  acc_type acc = policy.Init();
+  if (o < outputs) {
+    const InT *base = in + layout.KeepOffset(o);
+    for (index_t r = lane; r < reduced; r += GROUP) {
+      acc = policy.Combine(acc, policy.Load(base[layout.RedOffset(r)], o, r));
+    }
+  }
+
+  // Every thread takes part in the collective, including those past the last row
+  if constexpr (GROUP == REDUCE_AXES_THREADS) {
+    using BlockReduce = cub::BlockReduce<acc_type, REDUCE_AXES_THREADS>;
+    __shared__ typename BlockReduce::TempStorage temp;
+    acc = BlockReduce(temp).Reduce(acc, ReduceRowsCombine<Policy>{policy});
+  }
+  else if constexpr (GROUP > 1) {
+    using WarpReduce = cub::WarpReduce<acc_type, GROUP>;
+    __shared__ typename WarpReduce::TempStorage temp[GROUPS];
+    acc = WarpReduce(temp[group]).Reduce(acc, ReduceRowsCombine<Policy>{policy});
+  }
+
+  if (lane == 0 && o < outputs) {
+    policy.Store(o, acc);
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
@@ -253,10 +253,13 @@ __device__ inline void ResamplePoly1D_LoadFilter(typename FilterType::value_type
     __syncthreads();    
 }
 
+// up_phase is the index in the upsampled input on which output(0) is centered. It is zero for a
+// standalone call and non-zero when streaming, where input(0) is the oldest retained history
+// sample rather than the first sample of the signal. Both ElemBlock and WarpCentric accept it.
 template <int THREADS, typename OutType, typename InType, typename FilterType, typename index_t>
 __launch_bounds__(MATX_RESAMPLE_POLY_MAX_NUM_THREADS)
 __global__ void ResamplePoly1D_ElemBlock(OutType output, InType input, FilterType filter,
-                    index_t up, index_t down, index_t elems_per_thread)
+                    index_t up, index_t down, index_t elems_per_thread, index_t up_phase)
 {
     using output_t = typename OutType::value_type;
     using input_t = typename InType::value_type;
@@ -307,7 +310,7 @@ __global__ void ResamplePoly1D_ElemBlock(OutType output, InType input, FilterTyp
     const index_t last_ind = cuda::std::min(output_len - 1, start_ind + (elems_per_thread-1) * THREADS);
     if (load_filter_to_smem) {
         for (index_t out_ind = start_ind; out_ind <= last_ind; out_ind += THREADS) {
-            const index_t up_ind = out_ind * down;
+            const index_t up_ind = out_ind * down + up_phase;
             const index_t up_start = cuda::std::max(static_cast<index_t>(0), up_ind - filter_len_half);
             const index_t up_end = cuda::std::min(max_input_ind * up, up_ind + filter_len_half);
             const index_t x_start = (up_start + up - 1) / up;
@@ -334,7 +337,7 @@ __global__ void ResamplePoly1D_ElemBlock(OutType output, InType input, FilterTyp
         }
     } else {
         for (index_t out_ind = start_ind; out_ind <= last_ind; out_ind += THREADS) {
-            const index_t up_ind = out_ind * down;
+            const index_t up_ind = out_ind * down + up_phase;
             const index_t up_start = cuda::std::max(static_cast<index_t>(0), up_ind - filter_len_half);
             const index_t up_end = cuda::std::min(max_input_ind * up, up_ind + filter_len_half);
             const index_t x_start = (up_start + up - 1) / up;
@@ -368,7 +371,7 @@ __global__ void ResamplePoly1D_ElemBlock(OutType output, InType input, FilterTyp
 template <int THREADS, typename OutType, typename InType, typename FilterType, typename index_t>
 __launch_bounds__(MATX_RESAMPLE_POLY_MAX_NUM_THREADS)
 __global__ void ResamplePoly1D_WarpCentric(OutType output, InType input, FilterType filter,
-                    index_t up, index_t down, index_t elems_per_warp)
+                    index_t up, index_t down, index_t elems_per_warp, index_t up_phase)
 {
     using output_t = typename OutType::value_type;
     using input_t = typename InType::value_type;
@@ -414,7 +417,7 @@ __global__ void ResamplePoly1D_WarpCentric(OutType output, InType input, FilterT
     const index_t last_ind = cuda::std::min(output_len - 1, start_ind + elems_per_warp * NUM_WARPS - 1);
     if (load_filter_to_smem) {
         for (index_t out_ind = start_ind+warp_id; out_ind <= last_ind; out_ind += NUM_WARPS) {
-            const index_t up_ind = out_ind * down;
+            const index_t up_ind = out_ind * down + up_phase;
             const index_t up_start = cuda::std::max(static_cast<index_t>(0), up_ind - filter_len_half);
             const index_t up_end = cuda::std::min(max_input_ind * up, up_ind + filter_len_half);
             const index_t x_start = (up_start + up - 1) / up;
@@ -450,7 +453,7 @@ __global__ void ResamplePoly1D_WarpCentric(OutType output, InType input, FilterT
         }
     } else {
         for (index_t out_ind = start_ind+warp_id; out_ind <= last_ind; out_ind += NUM_WARPS) {
-            const index_t up_ind = out_ind * down;
+            const index_t up_ind = out_ind * down + up_phase;
             const index_t up_start = cuda::std::max(static_cast<index_t>(0), up_ind - filter_len_half);
             const index_t up_end = cuda::std::min(max_input_ind * up, up_ind + filter_len_half);
             const index_t x_start = (up_start + up - 1) / up;
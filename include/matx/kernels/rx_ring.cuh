@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+constexpr int RX_RING_THREADS = 128;
+
+#ifdef __CUDACC__
+/**
+ * Spin until the receive flags of count packets starting at ring slot first are set
+ *
+ * Each thread watches one slot. Flags are written by the receiver (a NIC through GPUDirect RDMA or a
+ * receive kernel) after the payload is visible, so once a flag is seen the system-scope fence orders the
+ * payload reads of every later kernel on the stream after it.
+ */
+__global__ void RxRingWaitKernel(const uint32_t *flags, index_t slots, index_t first, index_t count)
+{
+  const index_t i = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i < count) {
+    const volatile uint32_t *flag = flags + (first + i) % slots;
+    while (*flag == 0) {
+#if __CUDA_ARCH__ >= 700
+      __nanosleep(100);
+#endif
+    }
+  }
+  __threadfence_system();
+}
+
+/**
+ * Clear the receive flags of count packets starting at ring slot first so the receiver can reuse them
+ */
+__global__ void RxRingReleaseKernel(uint32_t *flags, index_t slots, index_t first, index_t count)
+{
+  const index_t i = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  __threadfence_system();
+  if (i < count) {
+    reinterpret_cast<volatile uint32_t *>(flags)[(first + i) % slots] = 0;
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
@@ -131,7 +131,7 @@ using strict_compute_param_t = typename std::conditional<ComputeType == SarBpCom
 template <SarBpComputeType ComputeType>
 using loose_compute_param_t = typename std::conditional<ComputeType == SarBpComputeType::Double, double, float>::type;
 
-template <SarBpComputeType ComputeType, typename OutImageType, typename InitialImageType, typename RangeProfilesType, typename PlatPosType, typename VoxLocType, typename RangeToMcpType, bool PhaseLUT>
+template <SarBpComputeType ComputeType, typename OutImageType, typename InitialImageType, typename RangeProfilesType, typename PlatPosType, typename VoxLocType, typename RangeToMcpType, bool PhaseLUT, bool FltFltAccum = false>
 __launch_bounds__(16*16)
 __global__ void SarBp(OutImageType output, const InitialImageType initial_image, const __grid_constant__ RangeProfilesType range_profiles, const __grid_constant__ PlatPosType platform_positions, const __grid_constant__ VoxLocType voxel_locations, const __grid_constant__ RangeToMcpType range_to_mcp,
                       strict_compute_param_t<ComputeType> dr_inv,
@@ -146,6 +146,7 @@ __global__ void SarBp(OutImageType output, const InitialImageType initial_image,
     static_assert(is_complex_v<typename OutImageType::value_type>, "Output image must be complex");
     static_assert(is_complex_v<typename InitialImageType::value_type>, "Initial image must be complex");
     static_assert(is_complex_v<typename RangeProfilesType::value_type>, "Range profiles must be complex");
+    static_assert(!FltFltAccum || ComputeType == SarBpComputeType::FloatFloat, "Float-float accumulation requires the FloatFloat compute type");
 
     static_assert(
         (is_matx_op<RangeToMcpType>() && (RangeToMcpType::Rank() == 0 || RangeToMcpType::Rank() == 1) && (std::is_same_v<typename RangeToMcpType::value_type, float> || std::is_same_v<typename RangeToMcpType::value_type, double>)) ||
@@ -231,6 +232,9 @@ __global__ void SarBp(OutImageType output, const InitialImageType initial_image,
     [[maybe_unused]] const int tid = threadIdx.x + threadIdx.y * blockDim.x;
 
     loose_complex_compute_t accum{};
+    // Only used when FltFltAccum is set
+    [[maybe_unused]] fltflt accum_re{0.0f};
+    [[maybe_unused]] fltflt accum_im{0.0f};
     const loose_compute_t bin_offset = static_cast<loose_compute_t>(0.5) * static_cast<loose_compute_t>(num_range_bins-1);
     const loose_compute_t max_bin_f = static_cast<loose_compute_t>(num_range_bins) - static_cast<loose_compute_t>(2.0);
     const int num_pulse_blocks = (num_pulses + PULSE_BLOCK_SIZE - 1) / PULSE_BLOCK_SIZE;
@@ -294,15 +298,29 @@ __global__ void SarBp(OutImageType output, const InitialImageType initial_image,
 
             const loose_complex_compute_t ref_phase = get_reference_phase(diffR, bin_floor_int, w);
 
-            accum += sample * ref_phase;
+            if constexpr (FltFltAccum) {
+                const loose_complex_compute_t contrib = sample * ref_phase;
+                accum_re = fltflt_add(accum_re, contrib.real());
+                accum_im = fltflt_add(accum_im, contrib.imag());
+            } else {
+                accum += sample * ref_phase;
+            }
         }
     }
 }
 
     if (is_valid) {
         initial_image_t initial_image_voxel = initial_image.operator()(iy, ix);
-        const image_t voxel_contribution {
-            initial_image_voxel.real() + accum.real(), initial_image_voxel.imag() + accum.imag() };
+        image_t voxel_contribution;
+        if constexpr (FltFltAccum) {
+            using image_inner_t = typename image_t::value_type;
+            voxel_contribution = image_t{
+                static_cast<image_inner_t>(static_cast<double>(initial_image_voxel.real()) + fltflt_to_double(accum_re)),
+                static_cast<image_inner_t>(static_cast<double>(initial_image_voxel.imag()) + fltflt_to_double(accum_im)) };
+        } else {
+            voxel_contribution = image_t{
+                initial_image_voxel.real() + accum.real(), initial_image_voxel.imag() + accum.imag() };
+        }
         cuda::std::apply([voxel_contribution, &output](auto &&...args) {
             output.operator()(args...) = voxel_contribution;
         }, cuda::std::make_tuple(iy, ix));
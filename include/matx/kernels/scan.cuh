@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+#ifdef __CUDACC__
+#include <cub/block/block_scan.cuh>
+#endif
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+// Associative operators for scan(). Init() is the identity of the operator.
+template <typename T>
+struct ScanSumOp {
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T operator()(const T &a, const T &b) const { return a + b; }
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T Init() const { return T(0); }
+};
+
+template <typename T>
+struct ScanProdOp {
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T operator()(const T &a, const T &b) const { return a * b; }
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T Init() const { return T(1); }
+};
+
+template <typename T>
+struct ScanMinOp {
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T operator()(const T &a, const T &b) const { return b < a ? b : a; }
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T Init() const { return cuda::std::numeric_limits<T>::max(); }
+};
+
+template <typename T>
+struct ScanMaxOp {
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T operator()(const T &a, const T &b) const { return a < b ? b : a; }
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T Init() const { return cuda::std::numeric_limits<T>::lowest(); }
+};
+
+#ifdef __CUDACC__
+// Flags published by each tile of scan_lookback_kernel
+static constexpr int SCAN_TILE_INVALID = 0;
+static constexpr int SCAN_TILE_AGGREGATE = 1;
+static constexpr int SCAN_TILE_PREFIX = 2;
+
+// Read a value published by another block, bypassing L1
+template <typename T>
+__device__ __MATX_INLINE__ T scan_load_cg(const T *p)
+{
+  static_assert(sizeof(T) % sizeof(unsigned int) == 0, "Look-back scan values must be a multiple of 4 bytes");
+  T v;
+  unsigned int *dst = reinterpret_cast<unsigned int *>(&v);
+  const unsigned int *src = reinterpret_cast<const unsigned int *>(p);
+  for (size_t w = 0; w < sizeof(T) / sizeof(unsigned int); w++) {
+    dst[w] = __ldcg(src + w);
+  }
+  return v;
+}
+
+/**
+ * Single-pass scan of contiguous lines with decoupled look-back
+ *
+ * Every line of len elements is split into tiles of THREADS * ITEMS, and all
+ * tiles of all lines are processed by one launch. Tiles take ids from a global
+ * counter so a tile's predecessors have always started. Each tile publishes
+ * its aggregate as soon as it is known, then walks back over its
+ * predecessors' aggregates until it finds one with an inclusive prefix, and
+ * publishes its own inclusive prefix. The first tile of every line starts a
+ * new prefix, so the look-back never crosses lines.
+ */
+template <int THREADS, int ITEMS, typename T, typename InIter, typename Op>
+__global__ void scan_lookback_kernel(InIter in, T *out, index_t len, index_t tiles_per_line, int *flags,
+                                     T *aggs, T *prefixes, unsigned int *tile_counter, Op op, bool exclusive)
+{
+  constexpr int TILE = THREADS * ITEMS;
+  using BlockScan = cub::BlockScan<T, THREADS>;
+
+  // Raw storage since T may have a non-trivial constructor
+  __shared__ typename BlockScan::TempStorage temp;
+  __shared__ alignas(T) unsigned char s_raw[(TILE + 1) * sizeof(T)];
+  __shared__ index_t s_tile;
+  T *s_vals = reinterpret_cast<T *>(s_raw);
+  T &s_prefix = s_vals[TILE];
+
+  const int tid = static_cast<int>(threadIdx.x);
+  if (tid == 0) {
+    s_tile = static_cast<index_t>(atomicAdd(tile_counter, 1u));
+  }
+  __syncthreads();
+
+  const index_t tile = s_tile;
+  const index_t line = tile / tiles_per_line;
+  const index_t t = tile % tiles_per_line;
+  const index_t base = t * TILE;
+  const index_t line_off = line * len;
+  const T identity = op.Init();
+
+  // Coalesced load through shared memory, then each thread scans ITEMS
+  // consecutive values
+  for (int j = 0; j < ITEMS; j++) {
+    const index_t pos = base + j * THREADS + tid;
+    s_vals[j * THREADS + tid] = pos < len ? static_cast<T>(in[line_off + pos]) : identity;
+  }
+  __syncthreads();
+
+  T items[ITEMS];
+  T thread_agg = identity;
+  for (int j = 0; j < ITEMS; j++) {
+    items[j] = s_vals[tid * ITEMS + j];
+    thread_agg = op(thread_agg, items[j]);
+  }
+
+  T thread_prefix;
+  T block_agg;
+  BlockScan(temp).ExclusiveScan(thread_agg, thread_prefix, identity, op, block_agg);
+
+  if (tid == 0) {
+    volatile int *vflags = flags;
+    if (t == 0) {
+      prefixes[tile] = block_agg;
+      __threadfence();
+      vflags[tile] = SCAN_TILE_PREFIX;
+      s_prefix = identity;
+    }
+    else {
+      aggs[tile] = block_agg;
+      __threadfence();
+      vflags[tile] = SCAN_TILE_AGGREGATE;
+
+      T excl = identity;
+      index_t p = tile - 1;
+      while (true) {
+        int f;
+        while ((f = vflags[p]) == SCAN_TILE_INVALID) { }
+        __threadfence();
+        if (f == SCAN_TILE_PREFIX) {
+          excl = op(scan_load_cg(&prefixes[p]), excl);
+          break;
+        }
+        excl = op(scan_load_cg(&aggs[p]), excl);
+        p--;
+      }
+
+      prefixes[tile] = op(excl, block_agg);
+      __threadfence();
+      vflags[tile] = SCAN_TILE_PREFIX;
+      s_prefix = excl;
+    }
+  }
+  __syncthreads();
+
+  T run = op(s_prefix, thread_prefix);
+  for (int j = 0; j < ITEMS; j++) {
+    if (exclusive) {
+      s_vals[tid * ITEMS + j] = run;
+      run = op(run, items[j]);
+    }
+    else {
+      run = op(run, items[j]);
+      s_vals[tid * ITEMS + j] = run;
+    }
+  }
+  __syncthreads();
+
+  for (int j = 0; j < ITEMS; j++) {
+    const index_t pos = base + j * THREADS + tid;
+    if (pos < len) {
+      out[line_off + pos] = s_vals[j * THREADS + tid];
+    }
+  }
+}
+
+/**
+ * Scan along a strided axis
+ *
+ * The input is viewed as [outer, len, inner] with the scan over the middle
+ * dimension. Each thread scans one (outer, inner) line sequentially, so
+ * neighbouring threads read neighbouring elements and loads stay coalesced
+ * without transposing the input.
+ */
+template <typename T, typename InIter, typename Op>
+__global__ void scan_strided_kernel(InIter in, T *out, index_t outer, index_t len, index_t inner, Op op,
+                                    bool exclusive)
+{
+  const index_t idx = static_cast<index_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (idx >= outer * inner) {
+    return;
+  }
+
+  const index_t o = idx / inner;
+  const index_t i = idx % inner;
+  index_t off = o * len * inner + i;
+
+  T run = op.Init();
+  for (index_t l = 0; l < len; l++, off += inner) {
+    const T v = static_cast<T>(in[off]);
+    if (exclusive) {
+      out[off] = run;
+      run = op(run, v);
+    }
+    else {
+      run = op(run, v);
+      out[off] = run;
+    }
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+#ifdef __CUDACC__
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ void scatter_atomic_add(T *addr, T v)
+{
+  if constexpr (is_complex_v<T>) {
+    using scalar_type = typename T::value_type;
+    atomicAdd(reinterpret_cast<scalar_type *>(addr), v.real());
+    atomicAdd(reinterpret_cast<scalar_type *>(addr) + 1, v.imag());
+  }
+  else if constexpr (std::is_integral_v<T> && sizeof(T) == 8) {
+    // Two's complement addition is the same for signed and unsigned 64-bit values
+    atomicAdd(reinterpret_cast<unsigned long long *>(addr), static_cast<unsigned long long>(v));
+  }
+  else {
+    atomicAdd(addr, v);
+  }
+}
+
+/**
+ * Scatter-add with warp-aggregated atomics
+ *
+ * Each thread adds vals(i) into out(idx(i)). Lanes of a warp with the same destination are found with
+ * __match_any_sync, and the lowest of them sums the group's values from shared memory and issues a single
+ * atomic. Clustered or sorted indices therefore cost one atomic per distinct destination per warp instead
+ * of one per element. Indices outside [0, out_size) are skipped.
+ */
+template <int THREADS, typename OutType, typename ValType, typename IdxType>
+__global__ void scatter_add_kernel(OutType out, ValType vals, IdxType idx, index_t n, index_t out_size)
+{
+  using out_t = typename OutType::value_type;
+  __shared__ alignas(out_t) unsigned char warp_smem[THREADS * sizeof(out_t)];
+  out_t *warp_vals = reinterpret_cast<out_t *>(warp_smem);
+
+  const index_t i = static_cast<index_t>(blockIdx.x) * THREADS + threadIdx.x;
+  const int lane = static_cast<int>(threadIdx.x % 32);
+
+  long long key = -1;
+  out_t v{};
+  if (i < n) {
+    key = static_cast<long long>(idx(i));
+    v = static_cast<out_t>(vals(i));
+  }
+  if (key >= out_size) {
+    key = -1;
+  }
+
+  const unsigned peers = __match_any_sync(0xffffffff, key);
+  warp_vals[threadIdx.x] = v;
+  __syncwarp();
+
+  if (key >= 0 && lane == __ffs(peers) - 1) {
+    const int base = static_cast<int>(threadIdx.x) - lane;
+    out_t sum = v;
+    for (unsigned rest = peers & (peers - 1); rest != 0; rest &= rest - 1) {
+      sum += warp_vals[base + __ffs(rest) - 1];
+    }
+    scatter_atomic_add(&out(static_cast<index_t>(key)), sum);
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
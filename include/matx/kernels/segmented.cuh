@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+// Reduction functors for the segmented reductions. Init() is the value of an
+// empty segment.
+template <typename T>
+struct SegmentedSumOp {
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T operator()(const T &a, const T &b) const { return a + b; }
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T Init() const { return T(0); }
+};
+
+template <typename T>
+struct SegmentedMinOp {
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T operator()(const T &a, const T &b) const { return b < a ? b : a; }
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T Init() const { return cuda::std::numeric_limits<T>::max(); }
+};
+
+template <typename T>
+struct SegmentedMaxOp {
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T operator()(const T &a, const T &b) const { return a < b ? b : a; }
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ T Init() const { return cuda::std::numeric_limits<T>::lowest(); }
+};
+
+#ifdef __CUDACC__
+/**
+ * Segmented reduction with one warp per segment
+ *
+ * Segment s covers [offsets(s), offsets(s+1)) of the rank 1 input. This is
+ * used instead of cub::DeviceSegmentedReduce when segments are short, where
+ * a block per segment would leave most of its threads idle.
+ */
+template <int THREADS, typename T, typename InType, typename OffsetType, typename Op>
+__global__ void segmented_reduce_warp_kernel(T *out, InType in, OffsetType offsets, index_t num_segments, Op op)
+{
+  constexpr int WARPS = THREADS / 32;
+  const index_t seg = static_cast<index_t>(blockIdx.x) * WARPS + threadIdx.x / 32;
+  const int lane = threadIdx.x % 32;
+
+  if (seg >= num_segments) {
+    return;
+  }
+
+  const index_t begin = static_cast<index_t>(offsets(seg));
+  const index_t end = static_cast<index_t>(offsets(seg + 1));
+
+  T v = op.Init();
+  for (index_t i = begin + lane; i < end; i += 32) {
+    v = op(v, static_cast<T>(in(i)));
+  }
+
+  for (int o = 16; o > 0; o /= 2) {
+    v = op(v, __shfl_down_sync(0xffffffff, v, o));
+  }
+
+  if (lane == 0) {
+    out[seg] = v;
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
@@ -0,0 +1,282 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifdef __CUDACC__
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/scalar_internal.h"
+
+namespace matx {
+
+// Warp-wide search for the row with the largest pivot magnitude. Lanes that do
+// not hold a pivot candidate pass a negative magnitude. On return, all lanes
+// hold the same row and magnitude, ties resolving to the lowest row.
+template <typename R>
+__device__ __forceinline__ int small_solver_pivot(R mag, R &best) {
+  int p = static_cast<int>(threadIdx.x % 32);
+  for (int off = 16; off > 0; off /= 2) {
+    const R omag = __shfl_xor_sync(0xffffffff, mag, off);
+    const int op = __shfl_xor_sync(0xffffffff, p, off);
+    if (omag > mag || (omag == mag && op < p)) {
+      mag = omag;
+      p = op;
+    }
+  }
+  best = mag;
+  return p;
+}
+
+// Kernel that inverts a batch of contiguous n x n matrices (n <= 32) with one
+// warp per matrix. Each warp runs Gauss-Jordan elimination with partial
+// pivoting on the augmented matrix [A | I] in shared memory, so that A is read
+// from and A^-1 written to global memory exactly once. Lane c owns the columns
+// c, c + 32, ... of the augmented matrix, and the elimination factors of each
+// step are staged in shared memory. A singular matrix sets info to the 1-based
+// step of the zero pivot. A and Ainv may alias.
+template <typename T>
+__global__ void small_inv_kernel(const T *A, T *Ainv, int *info,
+                                 index_t batches, int n) {
+  using R = typename inner_op_type_t<T>::type;
+  extern __shared__ __align__(16) unsigned char small_solver_smem[];
+  const int lane = static_cast<int>(threadIdx.x % 32);
+  const int warp = static_cast<int>(threadIdx.x / 32);
+  const index_t b = static_cast<index_t>(blockIdx.x) * (blockDim.x / 32) + warp;
+  if (b >= batches) {
+    return;
+  }
+
+  const int ld = 2 * n;
+  T *M = reinterpret_cast<T *>(small_solver_smem) + warp * (ld * n + n);
+  T *f = M + ld * n;
+  const T *Ab = A + b * n * n;
+  for (int idx = lane; idx < n * n; idx += 32) {
+    const int i = idx / n;
+    const int j = idx % n;
+    M[i * ld + j] = Ab[idx];
+    M[i * ld + n + j] = (i == j) ? T(1) : T(0);
+  }
+  __syncwarp();
+
+  for (int k = 0; k < n; k++) {
+    R best;
+    const int p = small_solver_pivot(
+        (lane >= k && lane < n) ? detail::scalar_internal_abs2(M[lane * ld + k]) : R(-1),
+        best);
+    if (best == R(0)) {
+      if (lane == 0) {
+        info[b] = k + 1;
+      }
+      return;
+    }
+
+    // Columns left of k are unit vectors by now, so only the rest is touched
+    if (p != k) {
+      for (int c = k + lane; c < ld; c += 32) {
+        const T tmp = M[k * ld + c];
+        M[k * ld + c] = M[p * ld + c];
+        M[p * ld + c] = tmp;
+      }
+      __syncwarp();
+    }
+
+    const T piv = M[k * ld + k];
+    __syncwarp();
+    for (int c = k + lane; c < ld; c += 32) {
+      M[k * ld + c] /= piv;
+    }
+    __syncwarp();
+    if (lane < n) {
+      f[lane] = M[lane * ld + k];
+    }
+    __syncwarp();
+    for (int c = k + lane; c < ld; c += 32) {
+      const T rk = M[k * ld + c];
+      for (int i = 0; i < n; i++) {
+        if (i != k) {
+          M[i * ld + c] -= f[i] * rk;
+        }
+      }
+    }
+    __syncwarp();
+  }
+
+  T *Ob = Ainv + b * n * n;
+  for (int idx = lane; idx < n * n; idx += 32) {
+    Ob[idx] = M[(idx / n) * ld + n + idx % n];
+  }
+  if (lane == 0) {
+    info[b] = 0;
+  }
+}
+
+// Kernel that computes the Cholesky factorization of a batch of contiguous
+// n x n Hermitian positive-definite matrices (n <= 32) in place, with one warp
+// per matrix. The lower factor L (A = L L^H) is computed column by column in
+// shared memory from the lower triangle of A. When upper is set, the factor
+// U = L^H is read from and written to the upper triangle instead. As with
+// cuSolver, the other triangle is left untouched. A matrix that is not positive
+// definite sets info to the order of the failing leading minor.
+template <typename T>
+__global__ void small_chol_kernel(T *A, int *info, index_t batches, int n,
+                                  bool upper) {
+  using R = typename inner_op_type_t<T>::type;
+  extern __shared__ __align__(16) unsigned char small_solver_smem[];
+  const int lane = static_cast<int>(threadIdx.x % 32);
+  const int warp = static_cast<int>(threadIdx.x / 32);
+  const index_t b = static_cast<index_t>(blockIdx.x) * (blockDim.x / 32) + warp;
+  if (b >= batches) {
+    return;
+  }
+
+  T *L = reinterpret_cast<T *>(small_solver_smem) + warp * n * n;
+  T *Ab = A + b * n * n;
+  for (int idx = lane; idx < n * n; idx += 32) {
+    const int i = idx / n;
+    const int j = idx % n;
+    if (j <= i) {
+      L[idx] = upper ? detail::scalar_internal_conj(Ab[j * n + i]) : Ab[idx];
+    }
+  }
+  __syncwarp();
+
+  for (int k = 0; k < n; k++) {
+    const R d = detail::scalar_internal_real(L[k * n + k]);
+    if (!(d > R(0))) {
+      if (lane == 0) {
+        info[b] = k + 1;
+      }
+      return;
+    }
+    const R s = cuda::std::sqrt(d);
+    __syncwarp();
+    if (lane >= k && lane < n) {
+      L[lane * n + k] = (lane == k) ? T(s) : L[lane * n + k] / s;
+    }
+    __syncwarp();
+    for (int j = k + 1 + lane; j < n; j += 32) {
+      const T ljk = detail::scalar_internal_conj(L[j * n + k]);
+      for (int i = j; i < n; i++) {
+        L[i * n + j] -= L[i * n + k] * ljk;
+      }
+    }
+    __syncwarp();
+  }
+
+  for (int idx = lane; idx < n * n; idx += 32) {
+    const int i = idx / n;
+    const int j = idx % n;
+    if (j <= i) {
+      if (upper) {
+        Ab[j * n + i] = detail::scalar_internal_conj(L[idx]);
+      } else {
+        Ab[idx] = L[idx];
+      }
+    }
+  }
+  if (lane == 0) {
+    info[b] = 0;
+  }
+}
+
+// Kernel that computes the determinants of a batch of contiguous n x n matrices
+// (n <= 32) with one warp per matrix. Each warp runs an LU factorization with
+// partial pivoting in shared memory and accumulates the product of the pivots,
+// flipping the sign for every row swap. Singular matrices yield zero.
+template <typename T>
+__global__ void small_det_kernel(const T *A, T *det, index_t batches, int n) {
+  using R = typename inner_op_type_t<T>::type;
+  extern __shared__ __align__(16) unsigned char small_solver_smem[];
+  const int lane = static_cast<int>(threadIdx.x % 32);
+  const int warp = static_cast<int>(threadIdx.x / 32);
+  const index_t b = static_cast<index_t>(blockIdx.x) * (blockDim.x / 32) + warp;
+  if (b >= batches) {
+    return;
+  }
+
+  T *M = reinterpret_cast<T *>(small_solver_smem) + warp * (n * n + n);
+  T *f = M + n * n;
+  const T *Ab = A + b * n * n;
+  for (int idx = lane; idx < n * n; idx += 32) {
+    M[idx] = Ab[idx];
+  }
+  __syncwarp();
+
+  T d = T(1);
+  bool neg = false;
+  for (int k = 0; k < n; k++) {
+    R best;
+    const int p = small_solver_pivot(
+        (lane >= k && lane < n) ? detail::scalar_internal_abs2(M[lane * n + k]) : R(-1),
+        best);
+    if (best == R(0)) {
+      d = T(0);
+      break;
+    }
+
+    if (p != k) {
+      for (int c = k + lane; c < n; c += 32) {
+        const T tmp = M[k * n + c];
+        M[k * n + c] = M[p * n + c];
+        M[p * n + c] = tmp;
+      }
+      neg = !neg;
+      __syncwarp();
+    }
+
+    const T piv = M[k * n + k];
+    d *= piv;
+    if (lane > k && lane < n) {
+      f[lane] = M[lane * n + k] / piv;
+    }
+    __syncwarp();
+    for (int c = k + 1 + lane; c < n; c += 32) {
+      const T rk = M[k * n + c];
+      for (int i = k + 1; i < n; i++) {
+        M[i * n + c] -= f[i] * rk;
+      }
+    }
+    __syncwarp();
+  }
+
+  if (lane == 0) {
+    det[b] = neg ? -d : d;
+  }
+}
+
+} // namespace matx
+
+#endif
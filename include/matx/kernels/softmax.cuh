@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+namespace detail {
+
+// Largest row, in bytes of the accumulation type, kept in shared memory so the input is only read once
+constexpr size_t SOFTMAX_MAX_CACHED_ROW_BYTES = 32 * 1024;
+constexpr int SOFTMAX_THREADS = 256;
+
+// Mask used when softmax is called without one
+struct SoftmaxNoMask {
+  template <typename... Is>
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool operator()(Is...) const { return true; }
+};
+
+#ifdef __CUDACC__
+// Running maximum and sum of exp(x - max) over part of a row. An empty state has sum zero.
+template <typename T>
+struct SoftmaxState {
+  T max;
+  T sum;
+};
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ SoftmaxState<T> SoftmaxMerge(const SoftmaxState<T> &a, const SoftmaxState<T> &b)
+{
+  if (b.sum == T(0)) {
+    return a;
+  }
+  if (a.sum == T(0)) {
+    return b;
+  }
+  const T m = cuda::std::max(a.max, b.max);
+  return {m, a.sum * cuda::std::exp(a.max - m) + b.sum * cuda::std::exp(b.max - m)};
+}
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ SoftmaxState<T> SoftmaxWarpReduce(SoftmaxState<T> s)
+{
+  for (int o = 16; o > 0; o /= 2) {
+    const SoftmaxState<T> other{__shfl_down_sync(0xffffffff, s.max, o), __shfl_down_sync(0xffffffff, s.sum, o)};
+    s = SoftmaxMerge(s, other);
+  }
+  return s;
+}
+
+/**
+ * Online softmax with one block per row
+ *
+ * Rows are taken over the permuted shape, where the softmax dimensions come last. Each thread keeps a
+ * running max and sum over its strided elements, rescaling the sum whenever the max grows, and the block
+ * merges the per-thread states. The output pass then reads the row again, or reads it from shared memory
+ * when CACHE_ROW is set, and writes exp(x - max) / sum. Elements where the mask is false do not contribute
+ * and are written as zero, as is every element of a fully masked row.
+ */
+template <int THREADS, bool CACHE_ROW, typename AccT, typename OutType, typename InType, typename MaskType, int RANK>
+__global__ void softmax_online_kernel(OutType out, InType in, MaskType mask, cuda::std::array<int, RANK> perm,
+                                      cuda::std::array<index_t, RANK> pshape, index_t cols)
+{
+  extern __shared__ char softmax_smem[];
+  __shared__ SoftmaxState<AccT> warp_states[THREADS / 32];
+  AccT *row_cache = reinterpret_cast<AccT *>(softmax_smem);
+
+  const index_t row = static_cast<index_t>(blockIdx.x);
+  const AccT neg_inf = -cuda::std::numeric_limits<AccT>::infinity();
+
+  auto index_of = [&](index_t c) {
+    cuda::std::array<index_t, RANK> idx;
+    index_t abs = row * cols + c;
+    MATX_LOOP_UNROLL
+    for (int r = RANK - 1; r >= 0; r--) {
+      idx[perm[r]] = abs % pshape[r];
+      abs /= pshape[r];
+    }
+    return idx;
+  };
+
+  auto load = [&](const cuda::std::array<index_t, RANK> &idx) {
+    if constexpr (!std::is_same_v<MaskType, SoftmaxNoMask>) {
+      if (!static_cast<bool>(cuda::std::apply([&](auto... i) { return mask(i...); }, idx))) {
+        return neg_inf;
+      }
+    }
+    return static_cast<AccT>(cuda::std::apply([&](auto... i) { return in(i...); }, idx));
+  };
+
+  SoftmaxState<AccT> st{neg_inf, AccT(0)};
+  for (index_t c = threadIdx.x; c < cols; c += THREADS) {
+    const AccT x = load(index_of(c));
+    if constexpr (CACHE_ROW) {
+      row_cache[c] = x;
+    }
+    if (x == neg_inf) {
+      continue;
+    }
+    if (x > st.max) {
+      st.sum = st.sum * cuda::std::exp(st.max - x) + AccT(1);
+      st.max = x;
+    }
+    else {
+      st.sum += cuda::std::exp(x - st.max);
+    }
+  }
+
+  st = SoftmaxWarpReduce(st);
+  if (threadIdx.x % 32 == 0) {
+    warp_states[threadIdx.x / 32] = st;
+  }
+  __syncthreads();
+  if (threadIdx.x < 32) {
+    st = threadIdx.x < THREADS / 32 ? warp_states[threadIdx.x] : SoftmaxState<AccT>{neg_inf, AccT(0)};
+    st = SoftmaxWarpReduce(st);
+    if (threadIdx.x == 0) {
+      warp_states[0] = st;
+    }
+  }
+  __syncthreads();
+  st = warp_states[0];
+
+  using out_t = typename OutType::value_type;
+  const AccT inv_sum = st.sum > AccT(0) ? AccT(1) / st.sum : AccT(0);
+  for (index_t c = threadIdx.x; c < cols; c += THREADS) {
+    const auto idx = index_of(c);
+    AccT x;
+    if constexpr (CACHE_ROW) {
+      x = row_cache[c];
+    }
+    else {
+      x = load(idx);
+    }
+    const AccT y = x == neg_inf ? AccT(0) : cuda::std::exp(x - st.max) * inv_sum;
+    cuda::std::apply([&](auto... i) -> decltype(auto) { return out(i...); }, idx) = static_cast<out_t>(y);
+  }
+}
+#endif
+
+} // end namespace detail
+} // end namespace matx
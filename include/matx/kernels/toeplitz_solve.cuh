@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cuda.h>
+
+#include "matx/core/type_utils.h"
+
+namespace matx {
+
+// Threads cooperating on one Levinson recursion
+constexpr int LEVINSON_THREADS = 256;
+
+#ifdef __CUDACC__
+
+namespace detail {
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ T LevinsonConj(const T &v) {
+  if constexpr (is_complex_v<T>) {
+    return cuda::std::conj(v);
+  }
+  else {
+    return v;
+  }
+}
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ auto LevinsonAbs2(const T &v) {
+  if constexpr (is_complex_v<T>) {
+    return v.real() * v.real() + v.imag() * v.imag();
+  }
+  else {
+    return v * v;
+  }
+}
+
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ auto LevinsonReal(const T &v) {
+  if constexpr (is_complex_v<T>) {
+    return v.real();
+  }
+  else {
+    return v;
+  }
+}
+
+// Sums a pair of values over the block. Every thread gets both results.
+template <typename T>
+__MATX_DEVICE__ __MATX_INLINE__ void LevinsonBlockSum2(T &a, T &b) {
+  __shared__ alignas(T) unsigned char smem_raw[2 * LEVINSON_THREADS * sizeof(T)];
+  T *sa = reinterpret_cast<T *>(smem_raw);
+  T *sb = sa + LEVINSON_THREADS;
+
+  sa[threadIdx.x] = a;
+  sb[threadIdx.x] = b;
+  __syncthreads();
+  for (int s = LEVINSON_THREADS / 2; s > 0; s >>= 1) {
+    if (static_cast<int>(threadIdx.x) < s) {
+      sa[threadIdx.x] = sa[threadIdx.x] + sa[threadIdx.x + s];
+      sb[threadIdx.x] = sb[threadIdx.x] + sb[threadIdx.x + s];
+    }
+    __syncthreads();
+  }
+
+  a = sa[0];
+  b = sb[0];
+  __syncthreads();
+}
+
+/**
+ * Levinson recursion for Hermitian Toeplitz systems T x = b, one block per system
+ *
+ * t holds the first column of each T and b the right-hand sides, both nb x n and contiguous. After
+ * step k, x solves the leading (k+1) x (k+1) system and y the Yule-Walker system T_k y = -t[1..k].
+ * Growing both by one row costs two length-k dot products and two length-k updates, which the
+ * block shares, so a solve is O(n^2) work and O(n) steps. y is scratch of the same shape as x.
+ * The recursion requires every leading principal minor of T to be nonsingular, which holds for
+ * positive definite T.
+ */
+template <typename T>
+__global__ void LevinsonKernel(const T *t, const T *b, T *x, T *y, index_t n, index_t nb) {
+  using real_type = typename inner_op_type_t<T>::type;
+  const index_t tid = threadIdx.x;
+
+  for (index_t sys = blockIdx.x; sys < nb; sys += gridDim.x) {
+    const T *ts = t + sys * n;
+    const T *bs = b + sys * n;
+    T *xs = x + sys * n;
+    T *ys = y + sys * n;
+
+    // Work with T scaled to a unit diagonal. The solution is unchanged when b is scaled too.
+    const real_type inv_t0 = real_type(1) / LevinsonReal(ts[0]);
+    real_type beta = real_type(1);
+    if (tid == 0) {
+      xs[0] = bs[0] * inv_t0;
+      if (n > 1) {
+        ys[0] = -ts[1] * inv_t0;
+      }
+    }
+    if (n > 1) {
+      beta = real_type(1) - LevinsonAbs2(ts[1] * inv_t0);
+    }
+    __syncthreads();
+
+    for (index_t k = 1; k < n; k++) {
+      // t[1..k] against x and y in reverse order
+      T dx = T(0);
+      T dy = T(0);
+      for (index_t i = tid; i < k; i += LEVINSON_THREADS) {
+        const T ti = ts[i + 1] * inv_t0;
+        dx = dx + ti * xs[k - 1 - i];
+        dy = dy + ti * ys[k - 1 - i];
+      }
+      LevinsonBlockSum2(dx, dy);
+
+      const T mu = (bs[k] * inv_t0 - dx) / beta;
+      for (index_t i = tid; i < k; i += LEVINSON_THREADS) {
+        xs[i] = xs[i] + mu * LevinsonConj(ys[k - 1 - i]);
+      }
+      if (tid == 0) {
+        xs[k] = mu;
+      }
+
+      if (k < n - 1) {
+        const T alpha = -(ts[k + 1] * inv_t0 + dy) / beta;
+        // The x update above reads the old y
+        __syncthreads();
+
+        // y[i] and y[k - 1 - i] depend on each other, so one thread updates both
+        for (index_t i = tid; i < (k + 1) / 2; i += LEVINSON_THREADS) {
+          const index_t j = k - 1 - i;
+          const T yi = ys[i];
+          const T yj = ys[j];
+          ys[i] = yi + alpha * LevinsonConj(yj);
+          if (j != i) {
+            ys[j] = yj + alpha * LevinsonConj(yi);
+          }
+        }
+        if (tid == 0) {
+          ys[k] = alpha;
+        }
+        beta = beta * (real_type(1) - LevinsonAbs2(alpha));
+      }
+      __syncthreads();
+    }
+  }
+}
+
+} // end namespace detail
+
+#endif
+
+} // end namespace matx
@@ -85,6 +85,73 @@ __global__ void transpose_kernel_oop(OutputTensor out,
     }
   }
 }
+
+/**
+ * Tiled copy between two strided views whose unit-stride dimensions differ
+ *
+ * One block moves a TILE_DIM x TILE_DIM tile spanning dimension a (unit stride
+ * in the output) and dimension b (unit stride in the input) through shared
+ * memory, so both the reads and the writes are coalesced. The tile is padded by
+ * one element per row to avoid bank conflicts on the transposed access. All
+ * remaining dimensions are flattened into blockIdx.z.
+ */
+template <int RANK>
+struct PermuteTileParams {
+  cuda::std::array<index_t, RANK> size;
+  cuda::std::array<index_t, RANK> in_stride;
+  cuda::std::array<index_t, RANK> out_stride;
+  cuda::std::array<int, RANK> other;
+  int nother;
+  int a;
+  int b;
+  index_t batches;
+};
+
+template <typename T, int RANK>
+__global__ void permute_tiled_kernel(T *out, const T *in, PermuteTileParams<RANK> p)
+{
+  extern __shared__ float
+      tile[]; // Need to swap complex types also, so cast when needed
+  T *shm_tile = reinterpret_cast<T *>(&tile[0]);
+
+  const index_t a0 = static_cast<index_t>(blockIdx.y) * TILE_DIM;
+  const index_t b0 = static_cast<index_t>(blockIdx.x) * TILE_DIM;
+  const index_t na = p.size[p.a];
+  const index_t nb = p.size[p.b];
+
+  for (index_t z = blockIdx.z; z < p.batches; z += gridDim.z) {
+    index_t in_off = 0;
+    index_t out_off = 0;
+    index_t rem = z;
+    for (int i = p.nother - 1; i >= 0; i--) {
+      const int d = p.other[i];
+      const index_t idx = rem % p.size[d];
+      rem /= p.size[d];
+      in_off += idx * p.in_stride[d];
+      out_off += idx * p.out_stride[d];
+    }
+
+    for (int j = threadIdx.y; j < static_cast<int>(TILE_DIM); j += blockDim.y) {
+      const index_t a = a0 + j;
+      const index_t b = b0 + threadIdx.x;
+      if (a < na && b < nb) {
+        shm_tile[j * (TILE_DIM + 1) + threadIdx.x] = in[in_off + a * p.in_stride[p.a] + b];
+      }
+    }
+
+    __syncthreads();
+
+    for (int j = threadIdx.y; j < static_cast<int>(TILE_DIM); j += blockDim.y) {
+      const index_t a = a0 + threadIdx.x;
+      const index_t b = b0 + j;
+      if (a < na && b < nb) {
+        out[out_off + a + b * p.out_stride[p.b]] = shm_tile[threadIdx.x * (TILE_DIM + 1) + j];
+      }
+    }
+
+    __syncthreads();
+  }
+}
 #endif
 
 }; // namespace matx
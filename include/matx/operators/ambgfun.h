@@ -162,10 +162,122 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpX>()) {
+            x_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpY>()) {
+            y_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
         }
 
         template <typename ShapeType, typename Executor>
         __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::FreeTempTensor(ptr);
+        }
+    };
+
+    template <typename OpX, typename OpY>
+    class AmbgFunBatchedOp : public BaseOp<AmbgFunBatchedOp<OpX, OpY>>
+    {
+      private:
+        typename detail::base_type_t<OpX> x_;
+        typename detail::base_type_t<OpY> y_;
+        index_t doppler_start_;
+        cuda::std::array<index_t, 3> out_dims_;
+        mutable detail::tensor_impl_t<float, 3> tmp_out_;
+        mutable float *ptr = nullptr;
+
+      public:
+        using matxop = bool;
+        using value_type = float;
+        using matx_transform_op = bool;
+        using ambgfun_xform_op = bool;
+
+        __MATX_INLINE__ std::string str() const {
+          return "ambgfun_batched(" + get_type_str(x_) + "," + get_type_str(y_) + ")";
+        }
+
+        __MATX_INLINE__ AmbgFunBatchedOp(const OpX &x, const OpY &y, index_t doppler_start, index_t num_doppler) :
+              x_(x), y_(y), doppler_start_(doppler_start) {
+          MATX_LOG_TRACE("{} constructor: doppler_start={}, num_doppler={}", str(), doppler_start, num_doppler);
+          static_assert(OpX::Rank() == 2, "Inputs to ambgfun_batched must be rank 2");
+          static_assert(OpY::Rank() == 2, "Inputs to ambgfun_batched must be rank 2");
+          out_dims_[0] = x_.Size(0);
+          out_dims_[1] = 2 * x_.Size(1) - 1;
+          out_dims_[2] = num_doppler;
+        }
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return tmp_out_.template operator()<CapType>(indices...);
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return tmp_out_.template operator()<DefaultCapabilities>(indices...);
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+          auto self_has_cap = capability_attributes<Cap>::default_value;
+          return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(x_, in), detail::get_operator_capability<Cap>(y_, in));
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return 3;
+        }
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+        {
+          return out_dims_[dim];
+        }
+
+        __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+        template <typename Out, typename Executor>
+        void Exec(Out &&out, Executor &&ex) const {
+          static_assert(is_cuda_executor_v<Executor>, "ambgfun_batched() only supports the CUDA executor currently");
+          static_assert(cuda::std::tuple_element_t<0, remove_cvref_t<Out>>::Rank() == 3, "Output tensor of ambgfun_batched must be 3D");
+          ambgfun_batched_impl(cuda::std::get<0>(out), x_, y_, doppler_start_, ex);
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpX>()) {
+            x_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpY>()) {
+            y_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+          Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpX>()) {
             x_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
@@ -174,8 +286,14 @@ namespace matx
           if constexpr (is_matx_op<OpY>()) {
             y_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
+        }
 
-          matxFree(ptr); 
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::FreeTempTensor(ptr);
         }
     };
   }
@@ -216,7 +334,7 @@ __MATX_INLINE__ auto ambgfun(const XTensor &x,
                     const YTensor &y, double fs, AMBGFunCutType_t cut,
                     float cut_val = 0.0)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   return detail::AmbgFunOp(x, y, fs, cut, cut_val);
 }
 
@@ -248,10 +366,46 @@ template <typename XTensor>
 __MATX_INLINE__ auto ambgfun(const XTensor &x,
                     double fs, AMBGFunCutType_t cut, float cut_val = 0.0)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   detail::EmptyY nil;
   return detail::AmbgFunOp(x, nil, fs, cut, cut_val);
 }
 
+/**
+ * Batched cross-ambiguity function over a Doppler window
+ *
+ * Computes the cross-ambiguity magnitude of many signal pairs at once, keeping only a band of
+ * Doppler bins. Row b of x and y is one reference/surveillance pair, and both must be the same
+ * length N. The surface of each pair matches the 2D cut of ambgfun() restricted to the selected
+ * Doppler columns, except that both signals are normalized to unit energy. All pairs share one
+ * batched FFT plan, and the lag products are fused into the FFT's loads when cuFFT LTO callbacks
+ * are enabled.
+ *
+ * @tparam XTensor
+ *   x matrix type
+ * @tparam YTensor
+ *   y matrix type
+ * @param x
+ *   Reference signals, one per row
+ * @param y
+ *   Surveillance signals, one per row
+ * @param doppler_start
+ *   First Doppler bin to keep, counted on the fftshifted axis of length
+ * 2^ceil(log2(2N - 1)) where the center bin is zero Doppler
+ * @param num_doppler
+ *   Number of Doppler bins to keep
+ * @returns
+ *   3D output of shape batches x (2N - 1) x num_doppler holding the delay vs Doppler surface of
+ * each pair
+ *
+ */
+template <typename XTensor, typename YTensor>
+__MATX_INLINE__ auto ambgfun_batched(const XTensor &x, const YTensor &y,
+                    index_t doppler_start, index_t num_doppler)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  return detail::AmbgFunBatchedOp(x, y, doppler_start, num_doppler);
+}
+
 }
@@ -46,7 +46,7 @@ namespace detail {
   class AnyOp : public BaseOp<AnyOp<OpA, ORank>>
   {
     private:
-      OpA a_;
+      typename detail::base_type_t<OpA> a_;
       cuda::std::array<index_t, ORank> out_dims_;
       mutable detail::tensor_impl_t<typename remove_cvref_t<OpA>::value_type, ORank> tmp_out_;
       mutable typename remove_cvref_t<OpA>::value_type *ptr = nullptr;
@@ -116,16 +116,23 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr); 
+        detail::FreeTempTensor(ptr);
       }          
 
       constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
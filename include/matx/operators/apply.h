@@ -45,6 +45,42 @@ namespace matx
    * the size is also taken from the first input operator.
    */
   namespace detail {
+    // Functions with both a scalar and a vector signature opt into the vector one with this member type.
+    // Otherwise a generic scalar function would be instantiated with arrays just to probe for it.
+    template <typename Func, typename = void>
+    struct has_matx_vector_func : cuda::std::false_type {};
+    template <typename Func>
+    struct has_matx_vector_func<Func, cuda::std::void_t<typename Func::matx_vector_func>> : cuda::std::true_type {};
+
+    // Whether func takes N values of every input at once as cuda::std::array<T, N>
+    template <int N, typename Func, typename... Ts>
+    constexpr bool apply_has_vector_func()
+    {
+      if constexpr (has_matx_vector_func<Func>::value || !cuda::std::is_invocable_v<const Func &, Ts...>) {
+        return cuda::std::is_invocable_v<const Func &, const cuda::std::array<Ts, N> &...>;
+      }
+      else {
+        return false;
+      }
+    }
+
+    template <int N, typename Func, typename... Ts>
+    inline constexpr bool apply_has_vector_func_v = apply_has_vector_func<N, Func, Ts...>();
+
+    // Element type of func, from its scalar signature or else from its vector one with N = 1
+    template <typename Func, typename... Ts>
+    constexpr auto apply_result_type()
+    {
+      if constexpr (cuda::std::is_invocable_v<const Func &, Ts...>) {
+        return cuda::std::type_identity<cuda::std::invoke_result_t<const Func &, Ts...>>{};
+      }
+      else {
+        static_assert(apply_has_vector_func_v<1, Func, Ts...>,
+                      "apply() function must accept the input values or cuda::std::arrays of them");
+        return cuda::std::type_identity<typename cuda::std::invoke_result_t<const Func &, const cuda::std::array<Ts, 1> &...>::value_type>{};
+      }
+    }
+
     template <typename Func, typename... Ops>
     class ApplyOp : public BaseOp<ApplyOp<Func, Ops...>>
     {
@@ -53,7 +89,7 @@ namespace matx
         
         // Deduce value_type from the lambda function's return type
         using first_op_type = cuda::std::tuple_element_t<0, cuda::std::tuple<Ops...>>;
-        using value_type = decltype(cuda::std::declval<Func>()(cuda::std::declval<typename Ops::value_type>()...));
+        using value_type = typename decltype(apply_result_type<Func, typename Ops::value_type...>())::type;
         using self_type = ApplyOp<Func, Ops...>;
 
         __MATX_INLINE__ std::string str() const { return "apply()"; }
@@ -139,18 +175,38 @@ namespace matx
             // Each operator returns a vector, so call operator() once per operator to get the vectors
             auto op_results = cuda::std::make_tuple(cuda::std::get<Is>(ops_).template operator()<CapType>(indices...)...);
             
-            // Deduce the result type by calling func_ on scalar elements
-            using result_element_type = decltype(func_(cuda::std::get<Is>(op_results).data[0]...));
-            Vector<result_element_type, static_cast<int>(CapType::ept)> result;
-            
-            // Unroll loop to call func_ on each element of the vectors
-            MATX_LOOP_UNROLL
-            for (int i = 0; i < static_cast<int>(CapType::ept); i++) {
-              result.data[i] = func_(cuda::std::get<Is>(op_results).data[i]...);
+            constexpr int N = static_cast<int>(CapType::ept);
+            Vector<value_type, N> result;
+
+            if constexpr (apply_has_vector_func_v<N, Func, typename Ops::value_type...>) {
+              // A vector-aware function takes all N values of each input in one call
+              static_assert(cuda::std::is_same_v<cuda::std::remove_cvref_t<decltype(func_(cuda::std::get<Is>(op_results).data...))>,
+                                                 cuda::std::array<value_type, N>>,
+                            "apply() vector function must return a cuda::std::array with one value per input value");
+              result.data = func_(cuda::std::get<Is>(op_results).data...);
+            }
+            else {
+              // Unroll loop to call func_ on each element of the vectors
+              MATX_LOOP_UNROLL
+              for (int i = 0; i < N; i++) {
+                result.data[i] = call_scalar(cuda::std::get<Is>(op_results).data[i]...);
+              }
             }
             return result;
           } else {
-            return func_(cuda::std::get<Is>(ops_).template operator()<CapType>(indices...)...);
+            return call_scalar(cuda::std::get<Is>(ops_).template operator()<CapType>(indices...)...);
+          }
+        }
+
+        // Call func_ on one value of each input, through its vector signature when it has no scalar one
+        template <typename... Vals>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ value_type call_scalar(const Vals &...vals) const
+        {
+          if constexpr (cuda::std::is_invocable_v<const Func &, const Vals &...>) {
+            return func_(vals...);
+          }
+          else {
+            return func_(cuda::std::array<typename Ops::value_type, 1>{vals}...)[0];
           }
         }
 
@@ -190,6 +246,11 @@ namespace matx
    * 
    * @param func Lambda function or functor to apply. Can be __host__, __device__, or both.
    *             The function signature should accept value_type from each input operator.
+   *             It may instead, or also, accept a const cuda::std::array<value_type, N>& from each
+   *             input operator for any N and return a cuda::std::array of N results. When the
+   *             executor processes several elements per thread, that signature is called once
+   *             with all of them. A functor with both signatures must declare a member type
+   *             matx_vector_func for the vector one to be used.
    *             Note: Using __host__ __device__ lambdas requires the --extended-lambda compiler flag.
    *             For complex scenarios, consider using functors instead of lambdas.
    * @param ops Input operators (one or more)
@@ -218,6 +279,20 @@ namespace matx
    * auto t_out = make_tensor<float>({10});
    * (t_out = apply(SquareFunctor{}, t_in)).run();
    * @endcode
+   *
+   * Example using a vector-aware functor:
+   * @code
+   * struct ScaleFunctor {
+   *   template<size_t N>
+   *   __host__ __device__ auto operator()(const cuda::std::array<float, N> &x) const {
+   *     cuda::std::array<float, N> y;
+   *     for (size_t i = 0; i < N; i++) { y[i] = 2.0f * x[i]; }
+   *     return y;
+   *   }
+   * };
+   *
+   * (t_out = apply(ScaleFunctor{}, t_in)).run();
+   * @endcode
    */
   template <typename Func, typename... Ops>
   auto __MATX_INLINE__ apply(Func func, const Ops&... ops)
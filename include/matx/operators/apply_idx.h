@@ -34,6 +34,7 @@
 
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
+#include "matx/operators/apply.h"
 #include <format>
 
 namespace matx
@@ -46,6 +47,62 @@ namespace matx
    * the size is also taken from the first input operator.
    */
   namespace detail {
+    // Whether func has a vector signature taking cuda::std::integral_constant<int, N> before the indices.
+    // As with apply(), a function that also has a scalar signature opts in with a matx_vector_func member type.
+    template <int N, typename Func, int RANK, typename... Ops>
+    constexpr bool apply_idx_has_vector_func()
+    {
+      if constexpr (has_matx_vector_func<Func>::value ||
+                    !cuda::std::is_invocable_v<const Func &, cuda::std::array<index_t, RANK>, const Ops &...>) {
+        return cuda::std::is_invocable_v<const Func &, cuda::std::integral_constant<int, N>, cuda::std::array<index_t, RANK>, const Ops &...>;
+      }
+      else {
+        return false;
+      }
+    }
+
+    template <int N, typename Func, int RANK, typename... Ops>
+    inline constexpr bool apply_idx_has_vector_func_v = apply_idx_has_vector_func<N, Func, RANK, Ops...>();
+
+    // Element type of func, from its scalar signature or else from its vector one with N = 1
+    template <typename Func, int RANK, typename... Ops>
+    constexpr auto apply_idx_result_type()
+    {
+      if constexpr (cuda::std::is_invocable_v<const Func &, cuda::std::array<index_t, RANK>, const Ops &...>) {
+        return cuda::std::type_identity<cuda::std::invoke_result_t<const Func &, cuda::std::array<index_t, RANK>, const Ops &...>>{};
+      }
+      else {
+        static_assert(apply_idx_has_vector_func_v<1, Func, RANK, Ops...>,
+                      "apply_idx() function must accept the indices and operators, optionally after an integral_constant width");
+        return cuda::std::type_identity<typename cuda::std::invoke_result_t<const Func &, cuda::std::integral_constant<int, 1>,
+                                                                            cuda::std::array<index_t, RANK>, const Ops &...>::value_type>{};
+      }
+    }
+
+    // Largest elements per thread the vector signature of func supports at every width up to it
+    template <typename Func, int RANK, typename... Ops>
+    constexpr ElementsPerThread apply_idx_max_ept()
+    {
+      if constexpr (!apply_idx_has_vector_func_v<2, Func, RANK, Ops...>) {
+        return ElementsPerThread::ONE;
+      }
+      else if constexpr (!apply_idx_has_vector_func_v<4, Func, RANK, Ops...>) {
+        return ElementsPerThread::TWO;
+      }
+      else if constexpr (!apply_idx_has_vector_func_v<8, Func, RANK, Ops...>) {
+        return ElementsPerThread::FOUR;
+      }
+      else if constexpr (!apply_idx_has_vector_func_v<16, Func, RANK, Ops...>) {
+        return ElementsPerThread::EIGHT;
+      }
+      else if constexpr (!apply_idx_has_vector_func_v<32, Func, RANK, Ops...>) {
+        return ElementsPerThread::SIXTEEN;
+      }
+      else {
+        return ElementsPerThread::THIRTY_TWO;
+      }
+    }
+
     template <typename Func, typename... Ops>
     class ApplyIdxOp : public BaseOp<ApplyIdxOp<Func, Ops...>>
     {
@@ -55,9 +112,7 @@ namespace matx
         // Deduce value_type from the lambda function's return type
         using first_op_type = cuda::std::tuple_element_t<0, cuda::std::tuple<Ops...>>;
         static constexpr int RANK = first_op_type::Rank();
-        using value_type = decltype(cuda::std::declval<Func>()(
-            cuda::std::declval<cuda::std::array<index_t, RANK>>(),
-            cuda::std::declval<Ops>()...));
+        using value_type = typename decltype(apply_idx_result_type<Func, RANK, typename detail::base_type_t<Ops>...>())::type;
         using self_type = ApplyIdxOp<Func, Ops...>;
 
         __MATX_INLINE__ std::string str() const { return "apply_idx()"; }
@@ -97,7 +152,10 @@ namespace matx
             return false;
           }
           else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
-            const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+            // A scalar function is called once per element with the element's indices, which only works
+            // one element per thread. A vector-aware function is given the width it must produce.
+            const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE,
+                apply_idx_max_ept<Func, RANK, typename detail::base_type_t<Ops>...>()};
             return 
                 combine_capabilities<Cap>(my_cap, get_combined_ops_capability<Cap>(in, ops_));
           } else {
@@ -143,35 +201,52 @@ namespace matx
         __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) apply_impl(
             cuda::std::index_sequence<Is...>, Indices... indices) const
         {
+          cuda::std::array<index_t, sizeof...(Indices)> idx_array{static_cast<index_t>(indices)...};
           if constexpr (CapType::ept == ElementsPerThread::ONE) {
             // Scalar case: single element access
-            cuda::std::array<index_t, sizeof...(Indices)> idx_array{static_cast<index_t>(indices)...};
-            return func_(idx_array, cuda::std::get<Is>(ops_)...);
+            return call_scalar(idx_array, cuda::std::index_sequence<Is...>{});
           } else {
-            // Vector case: multiple elements per thread
-            // Deduce the result element type by calling func_ once
-            // Note that this path is disabled for now since apply_idx can't swizzle with vectors
-            cuda::std::array<index_t, sizeof...(Indices)> idx_array{static_cast<index_t>(indices)...};
-            using result_element_type = decltype(func_(idx_array, cuda::std::get<Is>(ops_)...));
-            Vector<result_element_type, static_cast<int>(CapType::ept)> result;
+            // Vector case: EPT consecutive elements along the last dimension. The kernel indexes the last
+            // dimension in vectors, so it is scaled back to elements here.
+            constexpr int N = static_cast<int>(CapType::ept);
+            if constexpr (sizeof...(Indices) > 0) {
+              idx_array[sizeof...(Indices) - 1] *= N;
+            }
 
-            // Adjust the last index to the EPT value. The user's lambda function does not know whether we're
-            // using vectorization or not so we need to adjust the index ourselves.
-            idx_array[sizeof...(Indices) - 1] *= static_cast<int>(CapType::ept);
-            
-            // Unroll loop to call func_ on each element of the vector
-            // For multi-dimensional indices, only the last index varies
-            MATX_LOOP_UNROLL
-            for (int i = 0; i < static_cast<int>(CapType::ept); i++) {
-              result.data[i] = func_(idx_array, cuda::std::get<Is>(ops_)...);
-              if constexpr (sizeof...(Indices) > 0) {
-                idx_array[sizeof...(Indices) - 1]++;
+            Vector<value_type, N> result;
+            if constexpr (apply_idx_has_vector_func_v<N, Func, RANK, typename detail::base_type_t<Ops>...>) {
+              static_assert(cuda::std::is_same_v<cuda::std::remove_cvref_t<decltype(func_(cuda::std::integral_constant<int, N>{}, idx_array, cuda::std::get<Is>(ops_)...))>,
+                                                 cuda::std::array<value_type, N>>,
+                            "apply_idx() vector function must return a cuda::std::array with one value per element");
+              result.data = func_(cuda::std::integral_constant<int, N>{}, idx_array, cuda::std::get<Is>(ops_)...);
+            }
+            else {
+              // Only instantiated by the executor; the capability query never selects this width
+              MATX_LOOP_UNROLL
+              for (int i = 0; i < N; i++) {
+                result.data[i] = call_scalar(idx_array, cuda::std::index_sequence<Is...>{});
+                if constexpr (sizeof...(Indices) > 0) {
+                  idx_array[sizeof...(Indices) - 1]++;
+                }
               }
             }
             return result;
           }
         }
 
+        // Call func_ for the single element at idx_array, through its vector signature when it has no scalar one
+        template <typename IdxArray, size_t... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ value_type call_scalar(const IdxArray &idx_array,
+                                                                             cuda::std::index_sequence<Is...>) const
+        {
+          if constexpr (cuda::std::is_invocable_v<const Func &, const IdxArray &, decltype(cuda::std::get<Is>(ops_))...>) {
+            return func_(idx_array, cuda::std::get<Is>(ops_)...);
+          }
+          else {
+            return func_(cuda::std::integral_constant<int, 1>{}, idx_array, cuda::std::get<Is>(ops_)...)[0];
+          }
+        }
+
         // Helper to call PreRun on all operators
         template <typename ShapeType, typename Executor, size_t... Is>
         __MATX_INLINE__ void pre_run_impl(ShapeType &&shape, Executor &&ex, 
@@ -218,7 +293,11 @@ namespace matx
    * 
    * @param func Lambda function or functor to apply. Can be __host__, __device__, or both.
    *             The function signature should accept a cuda::std::array<index_t, RANK> followed
-   *             by the input operators themselves (not their values).
+   *             by the input operators themselves (not their values). A function that also, or
+   *             instead, accepts a leading cuda::std::integral_constant<int, N> lets the executor
+   *             process N elements per thread: it returns a cuda::std::array of the N results
+   *             along the last dimension starting at the given indices. A functor with both
+   *             signatures must declare a member type matx_vector_func for the vector one to be used.
    *             Note: Inline __device__ lambdas work in regular code (e.g., main()) but NOT in
    *             Google Test fixtures due to private method restrictions. Use functors for tests.
    *             Requires --extended-lambda compiler flag.
@@ -254,6 +333,19 @@ namespace matx
    * auto t_out = make_tensor<float>({10});
    * (t_out = apply_idx(StencilFunctor{}, t_in)).run();
    * @endcode
+   *
+   * Example using a vector-aware functor:
+   * @code
+   * struct RampFunctor {
+   *   template<int N, typename Op>
+   *   __host__ __device__ auto operator()(cuda::std::integral_constant<int, N>, cuda::std::array<index_t, 1> idx, const Op& op) const {
+   *     cuda::std::array<float, N> out;
+   *     for (int i = 0; i < N; i++) { out[i] = op(idx[0] + i) * static_cast<float>(idx[0] + i); }
+   *     return out;
+   *   }
+   * };
+   * (t_out = apply_idx(RampFunctor{}, t_in)).run();
+   * @endcode
    */
   template <typename Func, typename... Ops>
   auto __MATX_INLINE__ apply_idx(Func func, const Ops&... ops)
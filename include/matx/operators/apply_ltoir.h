@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/core/utils.h"
+#include "matx/core/jit_functions.h"
+#include "matx/operators/base_operator.h"
+#include <format>
+
+namespace matx
+{
+  /**
+   * ApplyLTOIROp calls a registered LTO-IR device function on the values of one or more operators. The
+   * call is only resolved when the JIT executor links the fused kernel, so the operator can only run on
+   * the CUDAJITExecutor. Rank and sizes are taken from the first input operator.
+   */
+  namespace detail {
+    template <typename Ret, typename... Ops>
+    class ApplyLTOIROp : public BaseOp<ApplyLTOIROp<Ret, Ops...>>
+    {
+      using first_op_type = cuda::std::tuple_element_t<0, cuda::std::tuple<Ops...>>;
+      static constexpr int RANK = first_op_type::Rank();
+
+      public:
+        using matxop = bool;
+        using value_type = Ret;
+        using self_type = ApplyLTOIROp<Ret, Ops...>;
+
+        __MATX_INLINE__ std::string str() const { return "apply_ltoir(" + name_ + ")"; }
+
+        __MATX_INLINE__ ApplyLTOIROp(const std::string &name, const Ops&... ops) : name_(name), ops_(detail::base_type_t<Ops>(ops)...)
+        {
+          MATX_LOG_TRACE("{} constructor: num_ops={}", str(), sizeof...(Ops));
+          static_assert(sizeof...(Ops) > 0, "apply_ltoir requires at least one input operator");
+          static_assert((... && (RANK == Ops::Rank())), "apply_ltoir operators must have the same rank");
+
+#ifdef MATX_EN_JIT
+          // The hash of the registered code is part of the kernel name, so registering new code under the
+          // same name compiles a new kernel instead of reusing one linked against the old code
+          const auto fn = detail::GetJITFunction(name_);
+          if (fn == nullptr) {
+            MATX_THROW(matxInvalidParameter, "apply_ltoir: no JIT function registered as " + name_);
+          }
+          hash_ = fn->hash;
+#endif
+
+          for (int i = 0; i < RANK; i++) {
+            sizes_[i] = cuda::std::get<0>(ops_).Size(i);
+          }
+        }
+
+#ifdef MATX_EN_JIT
+        struct JIT_Storage {
+          cuda::std::tuple<typename detail::inner_storage_or_self_t<detail::base_type_t<Ops>>...> ops_;
+        };
+
+        JIT_Storage ToJITStorage() const {
+          return JIT_Storage{cuda::std::apply([](const auto&... ops) {
+            return cuda::std::make_tuple(detail::to_jit_storage(ops)...);
+          }, ops_)};
+        }
+
+        __MATX_INLINE__ std::string get_jit_class_name() const {
+          std::string sizes;
+          for (int i = 0; i < RANK; i++) {
+            sizes += "_" + std::to_string(sizes_[i]);
+          }
+          return std::format("JITApplyLTOIR_{}_{}{}", name_, hash_, sizes);
+        }
+
+        template <int I = 0>
+        __MATX_INLINE__ std::string get_jit_type_params() const {
+          VoidCapabilityType void_type{};
+          auto type_name = detail::get_operator_capability<OperatorCapability::JIT_TYPE_QUERY>(cuda::std::get<I>(ops_), void_type);
+          if constexpr (I < sizeof...(Ops) - 1) {
+            return type_name + "," + get_jit_type_params<I+1>();
+          } else {
+            return type_name;
+          }
+        }
+
+        template <size_t... Is>
+        __MATX_INLINE__ auto get_jit_op_str_impl(cuda::std::index_sequence<Is...>) const {
+          const std::string func_name = get_jit_class_name();
+          const std::string type_list = ((std::format("typename T{}", Is) + std::string(Is + 1 < sizeof...(Ops) ? ", " : "")) + ...);
+          const std::string storage_types = ((std::format("typename detail::inner_storage_or_self_t<detail::base_type_t<T{}>>", Is) +
+                std::string(Is + 1 < sizeof...(Ops) ? ", " : "")) + ...);
+          const std::string params = ((detail::type_to_string<typename Ops::value_type>() +
+                std::string(Is + 1 < sizeof...(Ops) ? ", " : "")) + ...);
+          const std::string args = ((std::format("get_value<CapType>(cuda::std::get<{}>(ops_), is...)", Is) +
+                std::string(Is + 1 < sizeof...(Ops) ? ", " : "")) + ...);
+
+          cuda::std::array<index_t, RANK> out_dims_;
+          for (int i = 0; i < RANK; i++) {
+            out_dims_[i] = Size(i);
+          }
+
+          // The declaration is repeated by every expression using the function. Identical extern "C"
+          // declarations are allowed, and nvJitLink resolves them all to the registered definition.
+          return cuda::std::make_tuple(
+            func_name,
+            std::format("extern \"C\" __device__ {} {}({});\n"
+                "template <{}> struct {} {{\n"
+                "  using value_type = {};\n"
+                "  using matxop = bool;\n"
+                "  constexpr static int RANK_ = {};\n"
+                "  constexpr static cuda::std::array<index_t, RANK_> sizes_ = {{ {} }};\n"
+                "  cuda::std::tuple<{}> ops_;\n"
+                "  template <typename CapType, typename... Is>\n"
+                "  __MATX_INLINE__ __MATX_DEVICE__ auto operator()(Is... is) const {{\n"
+                "    if constexpr (CapType::ept == ElementsPerThread::ONE) {{\n"
+                "      return {}({});\n"
+                "    }} else {{\n"
+                "      return Vector<value_type, static_cast<index_t>(CapType::ept)>{{}};\n"
+                "    }}\n"
+                "  }}\n"
+                "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return RANK_; }}\n"
+                "  constexpr __MATX_INLINE__ __MATX_DEVICE__ index_t Size(int dim) const {{\n"
+                "    return sizes_[dim];\n"
+                "  }}\n"
+                "}};\n",
+                detail::type_to_string<Ret>(), name_, params,
+                type_list, func_name, detail::type_to_string<Ret>(), RANK, detail::array_to_string(out_dims_),
+                storage_types, name_, args)
+          );
+        }
+
+        __MATX_INLINE__ auto get_jit_op_str() const {
+          return get_jit_op_str_impl(cuda::std::index_sequence_for<Ops...>{});
+        }
+#endif
+
+        // The device function only exists once nvJitLink links the JIT kernel, so there is nothing to call here
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ value_type operator()([[maybe_unused]] Is... indices) const
+        {
+#ifdef __CUDA_ARCH__
+          __trap();
+#endif
+          return value_type{};
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ value_type operator()(Is... indices) const
+        {
+          return this->operator()<DefaultCapabilities>(indices...);
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType &in) const {
+          if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
+#ifdef MATX_EN_JIT
+            return get_jit_class_name() + "<" + get_jit_type_params<0>() + ">";
+#else
+            return "";
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+#ifdef MATX_EN_JIT
+            return combine_capabilities<Cap>(true, get_combined_ops_capability<Cap>(in, ops_));
+#else
+            return false;
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::JIT_CLASS_QUERY) {
+#ifdef MATX_EN_JIT
+            const auto [key, value] = get_jit_op_str();
+            if (in.find(key) == in.end()) {
+              in[key] = value;
+            }
+
+            cuda::std::apply([&in](const auto&... ops) {
+              (detail::get_operator_capability<Cap>(ops, in), ...);
+            }, ops_);
+
+            return true;
+#else
+            return false;
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::GENERATE_LTOIR) {
+#ifdef MATX_EN_JIT
+            in.ltoir_symbols.insert(detail::jit_function_symbol_prefix + name_);
+#endif
+            return combine_capabilities<Cap>(true, get_combined_ops_capability<Cap>(in, ops_));
+          }
+          else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+            // The device function takes one value per operator
+            const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+            return combine_capabilities<Cap>(my_cap, get_combined_ops_capability<Cap>(in, ops_));
+          }
+          else {
+            auto self_has_cap = capability_attributes<Cap>::default_value;
+            return combine_capabilities<Cap>(self_has_cap, get_combined_ops_capability<Cap>(in, ops_));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          // The JIT executor never calls PreRun, so any executor that does cannot link the device function
+          static_assert(is_jit_cuda_executor_t<Executor>(), "apply_ltoir() can only be run on the CUDAJITExecutor");
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return RANK;
+        }
+
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ auto Size(int dim) const noexcept
+        {
+          return sizes_[dim];
+        }
+
+      private:
+        std::string name_;
+        std::string hash_;
+        cuda::std::tuple<typename detail::base_type_t<Ops>...> ops_;
+        cuda::std::array<index_t, RANK> sizes_;
+    };
+  }
+
+  /**
+   * @brief Call a registered LTO-IR device function on one or more operators
+   *
+   * The function must first be registered with RegisterJITFunction(). It is declared in the generated
+   * kernel as extern "C" __device__ Ret name(Ops::value_type...), so its parameters must match the value
+   * types of the operators, in order and by value. nvJitLink links the function into the fused kernel,
+   * which lets it be inlined and optimized with the rest of the expression.
+   *
+   * The resulting operator can only be run on the CUDAJITExecutor. Its rank and sizes match the first
+   * input operator, and every input must have the same rank.
+   *
+   * @tparam Ret Return type of the device function
+   * @tparam Ops Input operator types
+   *
+   * @param name Name the function was registered with
+   * @param ops Input operators
+   *
+   * @return ApplyLTOIROp operator that calls the function element-wise
+   */
+  template <typename Ret, typename... Ops>
+  auto __MATX_INLINE__ apply_ltoir(const std::string &name, const Ops&... ops)
+  {
+    return detail::ApplyLTOIROp<Ret, Ops...>(name, ops...);
+  }
+
+} // end namespace matx
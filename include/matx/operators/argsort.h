@@ -121,16 +121,23 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }      
 
   };
@@ -140,8 +147,8 @@ namespace detail {
  * Argsort rows of an operator
  *
  * Generates indices that would sort the rows of an operator.
- * Currently supported types are float, double, ints, and long ints (both signed
- * and unsigned). For a 1D operator, a linear sort is performed. For 2D and above
+ * Currently supported types are float, double, half, bfloat16, ints, and long ints
+ * (both signed and unsigned), and complex types, which are ordered by magnitude. For a 1D operator, a linear sort is performed. For 2D and above
  * each row of the inner dimensions are batched and sorted separately.
  *
  * @note Temporary memory may be used during the sorting process, and about 4N will
@@ -39,6 +39,9 @@
 #include "matx/core/capabilities.h"
 #include "matx/core/error.h"
 #include "matx/core/log.h"
+#include "matx/core/op_profiler.h"
+#include "matx/core/write_versions.h"
+#include "matx/transforms/permute_copy.h"
 
 namespace matx
 {
@@ -76,6 +79,98 @@ namespace matx
       }
     }
 
+    /**
+     * @brief Prefetch the managed and system memory referenced by an operator to the current device
+     *
+     * @param op Operator to walk
+     * @param stream Stream to prefetch on
+     */
+    template <typename Op>
+    __MATX_INLINE__ __MATX_HOST__ void prefetch_operator(const Op &op, cudaStream_t stream) {
+      PrefetchQueryInput in{0, static_cast<void*>(stream)};
+      MATX_CUDA_CHECK(cudaGetDevice(&in.device));
+      get_operator_capability<OperatorCapability::PREFETCH_MEMORY>(op, in);
+    }
+
+    /**
+     * @brief Fault the evicted oversubscribed memory referenced by an operator back in to the device
+     *
+     * @param op Operator to walk
+     * @param stream Stream the memory is copied back in on and that will run the operator
+     */
+    template <typename Op>
+    __MATX_INLINE__ __MATX_HOST__ void make_operator_resident(const Op &op, cudaStream_t stream) {
+      GetAllocMap().oversubscribed.BeginRun();
+      ResidencyQueryInput in{static_cast<void*>(stream)};
+      get_operator_capability<OperatorCapability::RESIDENT_MEMORY>(op, in);
+    }
+
+    /**
+     * @brief Make a stream wait for the last writers, on other streams, of the tensors an operator references
+     *
+     * @param op Operator to walk
+     * @param stream Stream that will run the operator
+     */
+    template <typename Op>
+    __MATX_INLINE__ __MATX_HOST__ void wait_operator_dependencies(const Op &op, cudaStream_t stream) {
+      StreamDependencyQueryInput in{static_cast<void*>(stream), false};
+      get_operator_capability<OperatorCapability::STREAM_DEPENDENCIES>(op, in);
+    }
+
+    /**
+     * @brief Record a stream as the last writer of the outputs of an assignment or mtie()
+     *
+     * @param op Operator that was launched
+     * @param stream Stream it was launched on
+     */
+    template <typename Op>
+    __MATX_INLINE__ __MATX_HOST__ void record_operator_writes(Op &op, cudaStream_t stream) {
+      StreamDependencyQueryInput in{static_cast<void*>(stream), true};
+      if constexpr (is_mtie<Op>()) {
+        constexpr size_t tuple_size = cuda::std::tuple_size_v<decltype(op.ts_)>;
+        [&]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+          (get_operator_capability<OperatorCapability::STREAM_DEPENDENCIES>(cuda::std::get<Is>(op.ts_), in), ...);
+        }(cuda::std::make_index_sequence<tuple_size - 1>{});
+      }
+      else if constexpr (is_matx_set_op<Op>()) {
+        get_operator_capability<OperatorCapability::STREAM_DEPENDENCIES>(op.get_lhs(), in);
+      }
+    }
+
+    /**
+     * @brief Give the outputs of an assignment or mtie() new write versions
+     *
+     * @param op Operator that was run
+     */
+    template <typename Op>
+    __MATX_INLINE__ __MATX_HOST__ void bump_operator_write_versions(Op &op) {
+      WriteVersionQueryInput in{true, nullptr, nullptr};
+      if constexpr (is_mtie<Op>()) {
+        constexpr size_t tuple_size = cuda::std::tuple_size_v<decltype(op.ts_)>;
+        [&]<size_t... Is>(cuda::std::index_sequence<Is...>) {
+          (get_operator_capability<OperatorCapability::WRITE_VERSIONS>(cuda::std::get<Is>(op.ts_), in), ...);
+        }(cuda::std::make_index_sequence<tuple_size - 1>{});
+      }
+      else if constexpr (is_matx_set_op<Op>()) {
+        get_operator_capability<OperatorCapability::WRITE_VERSIONS>(op.get_lhs(), in);
+      }
+    }
+
+    /**
+     * @brief Append the addresses, layouts and write versions of the tensors an operator references
+     *
+     * @param op Operator to walk
+     * @param sig Signature to append to
+     * @return false if the operator's values can change without any of its tensors being written
+     */
+    template <typename Op>
+    __MATX_INLINE__ __MATX_HOST__ bool read_operator_write_versions(const Op &op, std::vector<uint64_t> &sig) {
+      bool volatile_values = false;
+      WriteVersionQueryInput in{false, static_cast<void*>(&sig), &volatile_values};
+      get_operator_capability<OperatorCapability::WRITE_VERSIONS>(op, in);
+      return !volatile_values;
+    }
+
     /**
      * @brief Check if RHS operator aliases with LHS memory range
      * 
@@ -137,8 +232,78 @@ namespace matx
       }
 #endif      
     }
+
+    /**
+     * @brief Records one run() with the operator profiler when profiling is enabled
+     *
+     * Bytes written are those of the left-hand side of an assignment, and every other tensor in the
+     * expression counts as read. Flops are the expression's flops per element times its size.
+     *
+     * @tparam Op Operator type
+     * @tparam Executor Executor type
+     */
+    template <typename Op, typename Executor>
+    class OpProfileScope {
+      public:
+        OpProfileScope(Op &op, [[maybe_unused]] const Executor &ex) : op_(op) {
+          if constexpr (is_cuda_executor_v<Executor>) {
+            if (OpProfiler::Get().Enabled()) {
+              stream_ = ex.getStream();
+              id_ = OpProfiler::Get().Begin(stream_);
+            }
+          }
+        }
+
+        ~OpProfileScope() {
+          if (id_ == 0) {
+            return;
+          }
+
+          // Profiling must never turn a failed run into a terminate
+          try {
+            const uint64_t total = get_operator_capability<OperatorCapability::BYTES_ACCESSED>(op_);
+            uint64_t written = 0;
+            if constexpr (is_matx_set_op<Op>()) {
+              written = cuda::std::min(total, get_operator_capability<OperatorCapability::BYTES_ACCESSED>(op_.get_lhs()));
+            }
+
+            double elements = 1.0;
+            for (int r = 0; r < Op::Rank(); r++) {
+              elements *= static_cast<double>(op_.Size(r));
+            }
+            const double flops = static_cast<double>(get_operator_capability<OperatorCapability::FLOPS_PER_ELEMENT>(op_)) * elements;
+
+            OpProfiler::Get().End(id_, op_.str(), total - written, written, flops, stream_);
+          }
+          catch (...) {
+            MATX_LOG_WARN("Failed to record operator profile");
+          }
+        }
+
+      private:
+        Op &op_;
+        cudaStream_t stream_ = 0;
+        uint64_t id_ = 0;
+    };
   } // namespace detail
 
+  /**
+   * @brief Mark the tensors referenced by an operator as written
+   *
+   * Only needed with transform memoization enabled, after writing tensors other than through run(), such as
+   * element writes from the host or library calls on Data(). Transforms that read them run again on their next run().
+   *
+   * @tparam Op Operator type
+   * @param op Tensor or operator whose tensors were written
+   */
+  template <typename Op>
+  __MATX_INLINE__ __MATX_HOST__ void MarkModified(const Op &op) {
+    if (GetTransformMemoization()) {
+      detail::WriteVersionQueryInput in{true, nullptr, nullptr};
+      detail::get_operator_capability<detail::OperatorCapability::WRITE_VERSIONS>(op, in);
+    }
+  }
+
   /**
    * @brief Provides a base class with functions common to all operators
    * 
@@ -174,10 +339,30 @@ namespace matx
          */
         template <typename Ex>
         __MATX_INLINE__ void run (Ex &&ex) {
-          MATX_NVTX_START(static_cast<T *>(this)->str(), matx::MATX_NVTX_LOG_API)
+          MATX_NVTX_START_CACHED(static_cast<T *>(this)->str(), matx::MATX_NVTX_LOG_API, static_cast<T *>(this)->TotalSize())
           static_assert(is_executor_t<Ex>(), "Ex must be a MatX executor type");
 
           auto tp = static_cast<T *>(this);
+          detail::OpProfileScope<T, remove_cvref_t<Ex>> profile_scope(*tp, ex);
+
+          [[maybe_unused]] bool track_dependencies = false;
+          if constexpr (is_cuda_executor_v<Ex>) {
+            if (GetOversubscriptionEnabled()) {
+              detail::make_operator_resident(*tp, ex.getStream());
+            }
+
+            if (ex.get_prefetch() && !ex.is_capturing()) {
+              detail::prefetch_operator(*tp, ex.getStream());
+            }
+
+            track_dependencies = ex.get_track_dependencies() && !ex.is_capturing();
+            if (track_dependencies) {
+              detail::wait_operator_dependencies(*tp, ex.getStream());
+            }
+          }
+
+          [[maybe_unused]] bool memoize = false;
+          [[maybe_unused]] std::vector<uint64_t> memo_in;
 
           // For JIT CUDA executors, we don't need to run PreRun/PostRun since there's no async allocation.
           if constexpr (is_jit_cuda_executor_t<Ex>()) {
@@ -195,8 +380,30 @@ namespace matx
                 MATX_THROW(matxInvalidParameter, "Possible aliased memory detected: LHS and RHS memory ranges overlap");
               }
 
+              // With memoization on, a transform that last wrote this output from the same unchanged inputs is skipped
+              if (GetTransformMemoization()) {
+                memoize = detail::read_operator_write_versions(tp->get_rhs(), memo_in);
+                if (memoize) {
+                  std::vector<uint64_t> memo_out;
+                  detail::read_operator_write_versions(tp->get_lhs(), memo_out);
+                  if (detail::WriteVersionTracker::Get().Unchanged(std::type_index(typeid(T)), memo_out, memo_in)) {
+                    MATX_LOG_DEBUG("Skipping {}: inputs unchanged since it last wrote its output", tp->str());
+                    return;
+                  }
+                }
+              }
+
               tp->TransformExec(tp->Shape(), ex);
             }
+            else if constexpr (is_matx_segmented_op<typename T::op_type>() && is_tensor_view_v<typename T::tensor_type>) {
+              // concat() and stack() into a tensor are lowered to one assignment per input, so each input is
+              // written straight into its slice of the output without branching on every element
+              if (detail::check_aliased_memory(tp->get_lhs(), tp->get_rhs(), true)) {
+                MATX_THROW(matxInvalidParameter, "Possible aliased memory detected: LHS and RHS memory ranges overlap");
+              }
+
+              tp->get_rhs().AssignSegments(tp->get_lhs(), ex);
+            }
             else if constexpr (is_tensor_view_v<typename T::tensor_type> && is_tensor_view_v<typename T::op_type> && is_cuda_executor_v<Ex>) {
               // If we are doing a tensor to tensor assignment we should prefer cudaMemcpyAsync instead of a kernel
               if (detail::check_aliased_memory(tp->get_lhs(), tp->get_rhs(), true)) {
@@ -213,6 +420,10 @@ namespace matx
                                 cudaMemcpyDefault,
                                 ex.getStream());
               }
+              else if (detail::permute_copy_tiled(tp->get_lhs(), tp->get_rhs(), ex.getStream())) {
+                MATX_LOG_TRACE("Copying {} bytes from {} to {} using tiled permute kernel",
+                  tp->get_lhs().Bytes(), reinterpret_cast<void*>(tp->get_rhs().Data()), reinterpret_cast<void*>(tp->get_lhs().Data()));
+              }
               else {
                 MATX_LOG_TRACE("Copying {} bytes from {} to {} using kernel",
                   tp->get_lhs().Bytes(), reinterpret_cast<void*>(tp->get_rhs().Data()), reinterpret_cast<void*>(tp->get_lhs().Data()));
@@ -249,6 +460,23 @@ namespace matx
               tp->PostRun(tp->Shape(), ex);
             }
           }  
+
+          if constexpr (is_cuda_executor_v<Ex>) {
+            if (track_dependencies) {
+              detail::record_operator_writes(*tp, ex.getStream());
+            }
+          }
+
+          if (GetTransformMemoization()) {
+            detail::bump_operator_write_versions(*tp);
+            if constexpr (is_matx_set_op<T>()) {
+              if (memoize) {
+                std::vector<uint64_t> memo_out;
+                detail::read_operator_write_versions(tp->get_lhs(), memo_out);
+                detail::WriteVersionTracker::Get().Store(std::type_index(typeid(T)), std::move(memo_out), std::move(memo_in));
+              }
+            }
+          }
         }
 
         /**
@@ -258,7 +486,7 @@ namespace matx
          */
         __MATX_INLINE__ void run(cudaStream_t stream = 0)
         {
-          MATX_NVTX_START(detail::get_type_str(*static_cast<T *>(this)), matx::MATX_NVTX_LOG_API)
+          MATX_NVTX_START_CACHED(static_cast<T *>(this)->str(), matx::MATX_NVTX_LOG_API, static_cast<T *>(this)->TotalSize())
           run(cudaExecutor{stream, false});
         }
 
@@ -270,7 +498,7 @@ namespace matx
          */
         __MATX_INLINE__ void run(cudaEvent_t ev, cudaStream_t stream = 0)
         {
-          MATX_NVTX_START(static_cast<T *>(this)->str(), matx::MATX_NVTX_LOG_API)
+          MATX_NVTX_START_CACHED(static_cast<T *>(this)->str(), matx::MATX_NVTX_LOG_API, static_cast<T *>(this)->TotalSize())
 
           run(cudaExecutor{stream, false});
           cudaEventRecord(ev, stream);
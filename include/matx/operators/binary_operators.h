@@ -137,7 +137,12 @@ namespace matx
         const auto i1 = get_value<CapType>(lhs, indices...);
         const auto i2 = get_value<CapType>(rhs, indices...);
 
-        return op_.template operator()<CapType>(i1, i2);
+        if constexpr (cap_fast_math_v<CapType>) {
+          return scalar_fast_math<CapType>(op_, i1, i2);
+        }
+        else {
+          return op_.template operator()<CapType>(i1, i2);
+        }
       }
 
       template <typename... Is>
@@ -243,6 +248,11 @@ namespace matx
           return false;
 #endif
         }    
+        else if constexpr (Cap == OperatorCapability::FLOPS_PER_ELEMENT) {
+          return combine_capabilities<Cap>(uint64_t{1},
+                                        detail::get_operator_capability<Cap>(in1_, in),
+                                        detail::get_operator_capability<Cap>(in2_, in));
+        }
         else if constexpr (Cap == OperatorCapability::DYN_SHM_SIZE) {
           // The dynamic shmem size is the sum of the dynamic shmem sizes of the two operands.
           return 
@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+
+namespace matx {
+
+/**
+ * @brief Method used by cfar() to estimate the background power around a cell
+ */
+enum class CFARType {
+  CA, //!< Cell averaging. Mean of all training cells.
+  GO, //!< Greatest of. Larger of the means of the leading and lagging halves of the window.
+  SO, //!< Smallest of. Smaller of the means of the leading and lagging halves of the window.
+  OS  //!< Ordered statistic. The os_rank-th smallest training cell.
+};
+
+/**
+ * @brief Parameters of a CFAR detector
+ *
+ * The window around each cell under test has guard_rows/guard_cols guard cells and
+ * train_rows/train_cols training cells on each side, in the second-to-last and last
+ * dimensions respectively.
+ */
+struct CFARParams {
+  CFARType type{CFARType::CA}; //!< Background estimator
+  index_t guard_rows{0}; //!< Guard cells above and below the cell under test. Ignored for rank-1 inputs.
+  index_t guard_cols{0}; //!< Guard cells left and right of the cell under test
+  index_t train_rows{0}; //!< Training cells beyond the guard cells above and below. Ignored for rank-1 inputs.
+  index_t train_cols{0}; //!< Training cells beyond the guard cells left and right
+  double pfa{1e-5}; //!< Desired probability of false alarm
+  index_t os_rank{0}; //!< Order statistic for OS-CFAR. 0 selects 3/4 of the training cells.
+};
+
+}
+
+#include "matx/transforms/cfar.h"
+
+namespace matx {
+
+namespace detail {
+  template<typename OpA>
+  class CFAROp : public BaseOp<CFAROp<OpA>>
+  {
+    private:
+      typename detail::base_type_t<OpA> a_;
+      CFARParams params_;
+      cuda::std::array<index_t, OpA::Rank()> out_dims_;
+      mutable detail::tensor_impl_t<int, OpA::Rank()> tmp_out_;
+      mutable int *ptr = nullptr;
+
+    public:
+      using matxop = bool;
+      using value_type = int;
+      using matx_transform_op = bool;
+      using cfar_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "cfar(" + get_type_str(a_) + ")"; }
+      __MATX_INLINE__ CFAROp(const OpA &a, const CFARParams &params) : a_(a), params_(params) {
+        for (int r = 0; r < OpA::Rank(); r++) {
+          out_dims_[r] = a_.Size(r);
+        }
+      }
+
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+      template <ElementsPerThread EPT, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return tmp_out_.template operator()<EPT>(indices...);
+      }
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return this->operator()<detail::ElementsPerThread::ONE>(indices...);
+      }
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in));
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        if constexpr (cuda::std::tuple_size_v<remove_cvref_t<Out>> == 1) {
+          cfar_impl(cuda::std::get<0>(out), a_, params_, ex);
+        }
+        else {
+          static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 3,
+                        "Must use a single output or mtie with 2 outputs on cfar(). ie: (mtie(idx, num_found) = cfar(A, params))");
+          static_assert(remove_cvref_t<decltype(cuda::std::get<0>(out))>::Rank() == 1,
+                        "Detection index output must be a 1D tensor");
+          static_assert(remove_cvref_t<decltype(cuda::std::get<1>(out))>::Rank() == 0,
+                        "Num detections output must be a scalar tensor");
+          cfar_detections_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, params_, ex);
+        }
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return OpA::Rank();
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+  };
+}
+
+/**
+ * Constant false alarm rate (CFAR) detector
+ *
+ * Computes the power of each cell, estimates the background from the training cells
+ * around it and compares the power against a threshold that keeps the false alarm rate
+ * at params.pfa. Power, window statistics and the threshold test run in a single tiled
+ * kernel with the window halo staged in shared memory, so no power, background or
+ * normalization tensors are materialized. Complex inputs are square-law detected and
+ * real inputs are treated as powers. The window slides over the last two dimensions
+ * (only the last for rank-1 inputs) and all leading dimensions are batched. Training
+ * cells falling outside the input are dropped and the threshold is adjusted for the
+ * number of cells left.
+ *
+ * Assigned to a single tensor, cfar() writes a 0/1 detection mask of the input shape.
+ * Assigned to mtie(idx, num_found), the mask is compacted on the device and idx receives
+ * the sorted linear indices of the detections, with num_found holding their count.
+ *
+ * @tparam OpA
+ *   Input operator type
+ * @param a
+ *   Input samples. Must be float, double or complex of those.
+ * @param params
+ *   Detector parameters
+ * @returns Operator producing the CFAR detections
+ */
+template <typename OpA>
+__MATX_INLINE__ auto cfar(const OpA &a, const CFARParams &params)
+{
+  static_assert(OpA::Rank() >= 1, "Input to cfar() must be at least rank 1");
+  static_assert(detail::is_fp32_inner_type_v<typename OpA::value_type> || detail::is_fp64_inner_type_v<typename OpA::value_type>,
+                "cfar() only supports float, double and complex inputs");
+  return detail::CFAROp<OpA>(a, params);
+}
+
+}
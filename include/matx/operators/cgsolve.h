@@ -48,8 +48,9 @@ namespace matx
         typename detail::base_type_t<OpB> b_;
         double tol_;
         int max_iters_;
-        cuda::std::array<index_t, 2> out_dims_;
-        mutable detail::tensor_impl_t<typename OpA::value_type, 2> tmp_out_;
+        int check_interval_;
+        cuda::std::array<index_t, remove_cvref_t<OpB>::Rank()> out_dims_;
+        mutable detail::tensor_impl_t<typename OpA::value_type, remove_cvref_t<OpB>::Rank()> tmp_out_;
         mutable typename OpA::value_type *ptr = nullptr;
         mutable bool prerun_done_ = false;               
 
@@ -63,9 +64,9 @@ namespace matx
           return "cgsolve(" + get_type_str(a_) + "," + get_type_str(b_)  + ")";
         }
 
-        __MATX_INLINE__ CGSolveOp(const OpA &A, const OpB &B, double tol, int max_iters) : 
-              a_(A), b_(B), tol_(tol), max_iters_(max_iters) {
-          MATX_LOG_TRACE("{} constructor: tol={}, max_iters={}", str(), tol, max_iters);
+        __MATX_INLINE__ CGSolveOp(const OpA &A, const OpB &B, double tol, int max_iters, int check_interval) : 
+              a_(A), b_(B), tol_(tol), max_iters_(max_iters), check_interval_(check_interval) {
+          MATX_LOG_TRACE("{} constructor: tol={}, max_iters={}, check_interval={}", str(), tol, max_iters, check_interval);
           for (int r = 0; r < Rank(); r++) {
             out_dims_[r] = b_.Size(r);
           }
@@ -108,7 +109,7 @@ namespace matx
         template <typename Out, typename Executor>
         void Exec(Out &&out, Executor &&ex)  const{
           static_assert(is_cuda_executor_v<Executor>, "cgsolve() only supports the CUDA executor currently");
-          cgsolve_impl(cuda::std::get<0>(out), a_, b_, tol_, max_iters_, ex.getStream());
+          cgsolve_impl(cuda::std::get<0>(out), a_, b_, tol_, max_iters_, ex.getStream(), check_interval_);
         }
 
         template <typename ShapeType, typename Executor>
@@ -136,20 +137,27 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-          }     
+          }
 
           if constexpr (is_matx_op<OpB>()) {
             b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-          } 
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr); 
+          detail::FreeTempTensor(ptr);
         }           
     };
   }
@@ -166,14 +174,19 @@ namespace matx
    *   tolerance to solve to  
    * @param max_iters
    *   max iterations for solve
+   * @param check_interval
+   *   iterations between host checks for early termination. Larger values remove host
+   *   synchronization from more iterations at the cost of up to two intervals of extra
+   *   (no-op) iterations once every system has converged. 0 loops on the device in a CUDA
+   *   graph while node with no host checks, on executors that support device_while()
    *
    */
   template <typename AType, typename BType>
-    __MATX_INLINE__ auto cgsolve(const AType &A, const BType &B, double tol=1e-6, int max_iters=4)
+    __MATX_INLINE__ auto cgsolve(const AType &A, const BType &B, double tol=1e-6, int max_iters=4, int check_interval=1)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     
-    return detail::CGSolveOp(A, B, tol, max_iters);
+    return detail::CGSolveOp(A, B, tol, max_iters, check_interval);
   }
 
 }
@@ -59,7 +59,7 @@ namespace detail {
       using out_t = get_property_or<PropOutput, default_out_t, CurrentProps...>::type;
       static_assert(is_complex_v<out_t>, "Output type of channelize_poly must be complex");
       typename detail::base_type_t<OpA> a_;
-      FilterType f_;
+      typename detail::base_type_t<FilterType> f_;
       index_t num_channels_;
       index_t decimation_factor_;
       cuda::std::array<index_t, OpA::Rank() + 1> out_dims_;
@@ -123,7 +123,7 @@ namespace detail {
         // default accumulator type is the output's inner type. The outputs of channelize_poly are always complex
         // due to the IFFT, but the filtering that is applied prior to the IFFT can be either real or complex.
         using accum_type = get_property_or<PropAccum, typename inner_op_type_t<value_type>::type, CurrentProps...>::type;
-        channelize_poly_impl<decltype(cuda::std::get<0>(out)), decltype(a_), FilterType, accum_type>(
+        channelize_poly_impl<decltype(cuda::std::get<0>(out)), decltype(a_), decltype(f_), accum_type>(
           cuda::std::get<0>(out), a_, f_, num_channels_, decimation_factor_, ex.getStream());
       }
 
@@ -152,20 +152,27 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-        }     
+        }
 
         if constexpr (is_matx_op<FilterType>()) {
           f_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-        } 
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }
 
       constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
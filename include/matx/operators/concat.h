@@ -60,6 +60,7 @@ namespace matx
       public:
       using matxop = bool;
       using matxoplvalue = bool;
+      using matx_segmented_op = bool;
 
       // Scalar type of operation
       using value_type = first_value_type;
@@ -428,6 +429,27 @@ namespace matx
         return set(*this, rhs);
       }
 
+      // Assign each input into its own slice of out along the concatenation axis. Inputs that are tensors
+      // become plain copies, and expressions and transforms are evaluated directly into the output.
+      template <int I = 0, typename Out, typename Executor>
+      __MATX_INLINE__ void AssignSegments(Out &out, Executor &&ex, index_t offset = 0) const
+      {
+        if constexpr (I < sizeof...(Ts)) {
+          const auto &op = cuda::std::get<I>(ops_);
+          cuda::std::array<index_t, RANK> firsts{};
+          cuda::std::array<index_t, RANK> ends;
+          for (int d = 0; d < RANK; d++) {
+            ends[d] = out.Size(d);
+          }
+          firsts[axis_] = offset;
+          ends[axis_] = offset + op.Size(axis_);
+
+          auto out_seg = out.Slice(firsts, ends);
+          set(out_seg, op).run(ex);
+          AssignSegments<I + 1>(out, ex, ends[axis_]);
+        }
+      }
+
       template <int I, typename ShapeType, typename Executor>
       __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
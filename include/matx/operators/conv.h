@@ -38,6 +38,8 @@
 #include "matx/operators/base_operator.h"
 
 #include "matx/transforms/conv.h"
+#include "matx/transforms/conv_spectrum.h"
+#include "matx/transforms/conv_streaming.h"
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__algorithm/max.h>
 
@@ -77,7 +79,7 @@ namespace matx
               a_(A), b_(B), mode_(mode), method_(method), perm_(perm) {
           MATX_LOG_TRACE("{} constructor: mode={}, method={}", str(), static_cast<int>(mode), static_cast<int>(method));
           MATX_ASSERT_STR((!is_matx_type_v<typename OpA::value_type> && !is_matx_type_v<typename OpB::value_type>) || 
-                          method == MATX_C_METHOD_DIRECT, 
+                          method != MATX_C_METHOD_FFT, 
             matxInvalidType, "FFT convolutions do not support half precision float currently");
 
           index_t min_axis;
@@ -132,7 +134,7 @@ namespace matx
             }
           }
 
-          MATX_ASSERT_STR(method == MATX_C_METHOD_FFT || min_axis <= MAX_MIN_DIMENSION_DIRECT, 
+          MATX_ASSERT_STR(method != MATX_C_METHOD_DIRECT || min_axis <= MAX_MIN_DIMENSION_DIRECT, 
                           matxInvalidSize, "Dimension too large for direct convolution. "
                           "Please switch to FFT convolution using MATX_C_METHOD_FFT");
         }
@@ -213,20 +215,27 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-          }     
+          }
 
           if constexpr (is_matx_op<OpB>()) {
             b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-          } 
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr);
         }
     };
   }
@@ -239,7 +248,7 @@ namespace matx
  * @param i1 First input operator
  * @param i2 Second input operator
  * @param mode Convolution mode (FULL, SAME, or VALID)
- * @param method Convolution method (direct or FFT). Only complex inputs are supported for FFT currently
+ * @param method Convolution method (direct, FFT, TC, or automatic). Only complex inputs are supported for FFT currently
  */
 template <typename In1Type, typename In2Type>
 __MATX_INLINE__ auto conv1d(const In1Type &i1, const In2Type &i2,
@@ -258,7 +267,7 @@ __MATX_INLINE__ auto conv1d(const In1Type &i1, const In2Type &i2,
  * @param i2 Second input operator
  * @param axis the axis to perform convolution
  * @param mode Convolution mode (FULL, SAME, or VALID)
- * @param method Convolution method (direct or FFT). Only complex inputs are supported for FFT currently
+ * @param method Convolution method (direct, FFT, TC, or automatic). Only complex inputs are supported for FFT currently
  */
 template <typename In1Type, typename In2Type>
 __MATX_INLINE__ auto conv1d(const In1Type &i1, const In2Type &i2,
@@ -284,8 +293,8 @@ namespace detail {
       using out_t = std::conditional_t<is_complex_v<typename OpA::value_type>, 
             typename OpA::value_type, typename OpB::value_type>;
       constexpr static int max_rank = cuda::std::max(OpA::Rank(), OpB::Rank());
-      OpA a_;
-      OpB b_;
+      typename detail::base_type_t<OpA> a_;
+      typename detail::base_type_t<OpB> b_;
       matxConvCorrMode_t mode_;
       PermDims perm_;
       cuda::std::array<index_t, max_rank> out_dims_;
@@ -431,24 +440,180 @@ namespace detail {
         detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
 
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-        }     
+        }
 
         if constexpr (is_matx_op<OpB>()) {
           b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-        } 
+        }
+      }
 
-        matxFree(ptr);
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
       }     
     };
   }
 
+namespace detail {
+  template <typename OpA, typename OpCol, typename OpRow>
+  class Conv2DSeparableOp : public BaseOp<Conv2DSeparableOp<OpA, OpCol, OpRow>>
+  {
+    private:
+      using out_t = std::conditional_t<is_complex_v<typename OpA::value_type>,
+            typename OpA::value_type, typename OpRow::value_type>;
+      constexpr static int rank = OpA::Rank();
+      typename detail::base_type_t<OpA> a_;
+      typename detail::base_type_t<OpCol> col_;
+      typename detail::base_type_t<OpRow> row_;
+      matxConvCorrMode_t mode_;
+      cuda::std::array<index_t, rank> out_dims_;
+      mutable ::matx::detail::tensor_impl_t<out_t, rank> tmp_out_;
+      mutable out_t *ptr = nullptr;
+
+    public:
+      using matxop = bool;
+      using value_type = out_t;
+      using matx_transform_op = bool;
+      using conv_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const {
+        return "conv2d_separable(" + get_type_str(a_) + "," + get_type_str(col_) + "," + get_type_str(row_) + ")";
+      }
+
+      __MATX_INLINE__ Conv2DSeparableOp(const OpA &A, const OpCol &col, const OpRow &row, matxConvCorrMode_t mode) :
+            a_(A), col_(col), row_(row), mode_(mode) {
+        MATX_LOG_TRACE("{} constructor: mode={}", str(), static_cast<int>(mode));
+        for (int r = 0; r < rank; r++) {
+          out_dims_[r] = a_.Size(r);
+        }
+
+        const index_t flen[2] = {col_.Size(0), row_.Size(0)};
+        for (int d = 0; d < 2; d++) {
+          const int r = rank - 2 + d;
+          const auto max_axis = cuda::std::max(a_.Size(r), flen[d]);
+          const auto min_axis = cuda::std::min(a_.Size(r), flen[d]);
+          if (mode_ == MATX_C_MODE_FULL) {
+            out_dims_[r] = max_axis + min_axis - 1;
+          }
+          else if (mode_ == MATX_C_MODE_SAME) {
+            out_dims_[r] = max_axis;
+          }
+          else if (mode_ == MATX_C_MODE_VALID) {
+            out_dims_[r] = max_axis - min_axis + 1;
+          }
+        }
+      }
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        return tmp_out_(indices...);
+      }
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        return this->operator()<DefaultCapabilities>(indices...);
+      }
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+          const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+          return combine_capabilities<Cap>(my_cap,
+                                           detail::get_operator_capability<Cap>(a_, in),
+                                           detail::get_operator_capability<Cap>(col_, in),
+                                           detail::get_operator_capability<Cap>(row_, in));
+        }
+
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap,
+                                         detail::get_operator_capability<Cap>(a_, in),
+                                         detail::get_operator_capability<Cap>(col_, in),
+                                         detail::get_operator_capability<Cap>(row_, in));
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return rank;
+      }
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(is_cuda_executor_v<Executor>, "conv2d_separable() only supports the CUDA executor currently");
+        conv2d_separable_impl(cuda::std::get<0>(out), a_, col_, row_, mode_, ex.getStream());
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        if constexpr (is_matx_op<OpCol>()) {
+          col_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        if constexpr (is_matx_op<OpRow>()) {
+          row_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        if constexpr (is_matx_op<OpCol>()) {
+          col_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        if constexpr (is_matx_op<OpRow>()) {
+          row_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+    };
+  }
+
 /**
  * @brief 2D convolution
  * 
@@ -488,4 +653,26 @@ __MATX_INLINE__ auto conv2d(const In1Type &i1, const In2Type &i2,
   return detail::Conv2DOp(in1, in2, mode, perm);
 }
 
+
+/**
+ * @brief 2D convolution with a separable filter
+ *
+ * Equivalent to conv2d() with the filter outer(h_col, h_row), but computed as a row pass followed by
+ * a column pass. Use this whenever the 2D filter is known to be rank 1, such as box, Gaussian, and
+ * Sobel kernels, to reduce the work per output from Ky * Kx to Ky + Kx.
+ *
+ * @tparam InType Type of input
+ * @tparam ColFilterType Type of the column filter
+ * @tparam RowFilterType Type of the row filter
+ * @param in Input operator
+ * @param h_col Rank-1 filter applied along the second-to-last dimension
+ * @param h_row Rank-1 filter applied along the last dimension
+ * @param mode Convolution mode
+ */
+template <typename InType, typename ColFilterType, typename RowFilterType>
+__MATX_INLINE__ auto conv2d_separable(const InType &in, const ColFilterType &h_col, const RowFilterType &h_row,
+                   matxConvCorrMode_t mode) {
+  return detail::Conv2DSeparableOp(in, h_col, h_row, mode);
+}
+
 }
@@ -46,6 +46,7 @@ namespace matx
       private:
         typename detail::base_type_t<OpA> a_;
         cuda::std::array<index_t, OpA::Rank()> out_dims_;
+        CovFill fill_;
         mutable detail::tensor_impl_t<typename remove_cvref_t<OpA>::value_type, OpA::Rank()> tmp_out_;
         mutable typename remove_cvref_t<OpA>::value_type *ptr = nullptr;
         mutable bool prerun_done_ = false; 
@@ -60,8 +61,8 @@ namespace matx
           return "cov(" + get_type_str(a_) + ")";
         }
 
-        __MATX_INLINE__ CovOp(const OpA &A) : 
-              a_(A) {
+        __MATX_INLINE__ CovOp(const OpA &A, CovFill fill = CovFill::FULL) : 
+              a_(A), fill_(fill) {
           MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
           for (int r = 0; r < Rank(); r++) {
             out_dims_[r] = a_.Size(r);
@@ -100,7 +101,7 @@ namespace matx
         template <typename Out, typename Executor>
         void Exec(Out &&out, Executor &&ex) const {
           static_assert(is_cuda_executor_v<Executor>, "cov() only supports the CUDA executor currently");
-          cov_impl(cuda::std::get<0>(out), a_, ex);
+          cov_impl(cuda::std::get<0>(out), a_, ex, fill_);
         }
 
         template <typename ShapeType, typename Executor>
@@ -124,16 +125,23 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr);
         }          
     };
   }
@@ -157,9 +165,33 @@ namespace matx
   template <typename AType>
     __MATX_INLINE__ auto cov(const AType &a)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     
     return detail::CovOp(a);
   }
 
+/**
+ * Compute a covariance matrix, optionally writing only its upper triangle
+ *
+ * The covariance is Hermitian, so only one triangle is computed. With
+ * CovFill::UPPER the lower triangle is zeroed instead of mirrored, for
+ * consumers that only read the upper triangle, such as chol() with
+ * SolverFillMode::UPPER.
+ *
+ * @tparam AType
+ *    Data type of A operator
+ *
+ * @param a
+ *   Covariance operator input view
+ * @param fill
+ *   Part of the covariance matrix to write
+ */
+  template <typename AType>
+    __MATX_INLINE__ auto cov(const AType &a, CovFill fill)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+    return detail::CovOp(a, fill);
+  }
+
 }
@@ -37,6 +37,7 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/cub.h"
+#include "matx/operators/scan.h"
 #ifdef MATX_EN_JIT
   #include "matx/transforms/cub_device.h"
 #endif
@@ -189,16 +190,23 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
 
-        matxFree(ptr);
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
       }        
 
   };
@@ -221,4 +229,23 @@ __MATX_INLINE__ auto cumsum(const InputOperator &a) {
   return detail::CumSumOp(a);
 }
 
+/**
+ * Compute a cumulative sum along any dimension of a tensor
+ *
+ * Equivalent to scan(a, dim). The sum runs along dimension dim without
+ * permuting the input, and all other dimensions are batched.
+ *
+ * @tparam InputOperator
+ *   Input operator type
+ * @param a
+ *   Input operator
+ * @param dim
+ *   Dimension to sum along
+ * @returns operator with cumulative sum
+ */
+template <typename InputOperator>
+__MATX_INLINE__ auto cumsum(const InputOperator &a, int dim) {
+  return scan(a, dim);
+}
+
 }
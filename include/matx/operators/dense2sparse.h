@@ -44,6 +44,7 @@ template <typename OpA>
 class Dense2SparseOp : public BaseOp<Dense2SparseOp<OpA>> {
 private:
   typename detail::base_type_t<OpA> a_;
+  index_t capacity_;
 
 public:
   using matxop = bool;
@@ -51,8 +52,10 @@ public:
   using tosparse_xform_op = bool;
   using value_type = typename OpA::value_type;
 
-  __MATX_INLINE__ Dense2SparseOp(const OpA &a) : a_(a) {
-    MATX_LOG_TRACE("{} constructor: rank={}", str(), OpA::Rank());
+  __MATX_INLINE__ Dense2SparseOp(const OpA &a, index_t capacity = 0)
+      : a_(a), capacity_(capacity) {
+    MATX_LOG_TRACE("{} constructor: rank={}, capacity={}", str(), OpA::Rank(),
+                   capacity);
   }
 
   __MATX_INLINE__ std::string str() const {
@@ -82,7 +85,11 @@ public:
     } else {
       // NOTE: sparse assignment O = dense2sparse(A) takes direct reference!
       if constexpr (is_sparse_tensor_v<Out>) {
-        dense2sparse_impl(out, a_, ex);
+        if (capacity_ > 0) {
+          dense2sparse_capacity_impl(out, a_, capacity_, ex);
+        } else {
+          dense2sparse_impl(out, a_, ex);
+        }
       } else {
         MATX_THROW(matxNotSupported,
                    "Cannot use dense2sparse for dense output");
@@ -109,4 +116,35 @@ template <typename OpA> __MATX_INLINE__ auto dense2sparse(const OpA &A) {
   return detail::Dense2SparseOp(A);
 }
 
+/**
+ * Convert a dense matrix into a CSR or CSC matrix with room for a given
+ * number of entries, without synchronizing the stream.
+ *
+ * The nonzeros are counted and placed on the device, so the conversion never
+ * waits on the host and can be captured into a CUDA graph. The value and
+ * coordinate buffers of the output hold capacity entries. They are reused
+ * when they already have that size, and are otherwise allocated from the
+ * stream-ordered pool. Nse() of the output is the capacity, and the number of
+ * valid entries is the last position. Nonzeros past the capacity are dropped,
+ * so m * n is always sufficient.
+ *
+ * @tparam OpA
+ *    Data type of A tensor
+ *
+ * @param A
+ *   Dense input matrix
+ *
+ * @param capacity
+ *   Upper bound on the number of nonzeros
+ *
+ * @return
+ *   Sparse output tensor
+ */
+template <typename OpA>
+__MATX_INLINE__ auto dense2sparse(const OpA &A, index_t capacity) {
+  MATX_ASSERT_STR(capacity > 0, matxInvalidParameter,
+                  "dense2sparse: capacity must be positive");
+  return detail::Dense2SparseOp(A, capacity);
+}
+
 } // end namespace matx
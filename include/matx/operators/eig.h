@@ -52,6 +52,8 @@ namespace detail {
       typename detail::base_type_t<OpA> a_;
       EigenMode jobz_;
       SolverFillMode uplo_;
+      JacobiParams jacobi_;
+      index_t k_;
 
     public:
       using matxop = bool;
@@ -60,7 +62,8 @@ namespace detail {
       using eig_xform_op = bool;
 
       __MATX_INLINE__ std::string str() const { return "eig()"; }
-      __MATX_INLINE__ EigOp(const OpA &a, EigenMode jobz, SolverFillMode uplo) : a_(a), jobz_(jobz), uplo_(uplo) {
+      __MATX_INLINE__ EigOp(const OpA &a, EigenMode jobz, SolverFillMode uplo, const JacobiParams &jacobi, index_t k = 0) :
+          a_(a), jobz_(jobz), uplo_(uplo), jacobi_(jacobi), k_(k) {
         MATX_LOG_TRACE("{} constructor: jobz={}, uplo={}", str(), static_cast<int>(jobz), static_cast<int>(uplo));
       };
 
@@ -78,7 +81,16 @@ namespace detail {
       void Exec(Out &&out, Executor &&ex) const {
         static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 3, "Must use mtie with 2 outputs on eig(). ie: (mtie(O, w) = eig(A))");     
 
-        eig_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, ex, jobz_, uplo_);
+        if constexpr (is_cuda_executor_v<Executor>) {
+          if (k_ > 0) {
+            eig_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, k_, ex, jobz_, uplo_);
+          } else {
+            eig_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, ex, jobz_, uplo_, jacobi_);
+          }
+        } else {
+          MATX_ASSERT_STR(k_ == 0, matxNotSupported, "eig() with a number of eigenpairs is only supported on CUDA executors");
+          eig_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, ex, jobz_, uplo_);
+        }
       }
 
       static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
@@ -119,6 +131,9 @@ namespace detail {
  *   Whether to compute eigenvectors.
  * @param uplo
  *   Part of matrix to fill
+ * @param jacobi
+ *   For CUDA executors, controls the batched Jacobi solver that is used for batches
+ *   of matrices of up to 32x32. Ignored for host executors.
  * 
  * @return 
  *   Operator that produces eigenvectors and eigenvalues tensors. Regardless of jobz,
@@ -131,8 +146,42 @@ namespace detail {
 template<typename OpA>
 __MATX_INLINE__ auto eig(const OpA &a,
                           EigenMode jobz = EigenMode::VECTOR, 
+                          SolverFillMode uplo  = SolverFillMode::UPPER,
+                          const JacobiParams &jacobi = {}) {
+  return detail::EigOp(a, jobz, uplo, jacobi);
+}
+
+/**
+ * Computes the k largest eigenvalues, and optionally their eigenvectors, of a Hermitian
+ * or real symmetric matrix.
+ *
+ * This is much cheaper than a full decomposition when k is small relative to n, as in
+ * subspace methods that only need the dominant eigenpairs. Only CUDA executors are
+ * supported. If rank > 2, operations are batched.
+ *
+ * @tparam OpA
+ *   Data type of input a tensor or operator
+ *
+ * @param a
+ *   Input Hermitian/symmetric tensor or operator of shape `... x n x n`
+ * @param k
+ *   Number of eigenpairs, between 1 and n
+ * @param jobz
+ *   Whether to compute eigenvectors.
+ * @param uplo
+ *   Part of matrix to fill
+ *
+ * @return
+ *   Operator that produces eigenvectors and eigenvalues tensors.
+ *   - **Eigenvectors** - The eigenvectors tensor of shape `... x n x k` where each column
+ *       contains a normalized eigenvector. Not written when jobz is EigenMode::NO_VECTOR.
+ *   - **Eigenvalues** - The k largest eigenvalues of shape `... x k` in ascending order.
+ */
+template<typename OpA>
+__MATX_INLINE__ auto eig(const OpA &a, index_t k,
+                          EigenMode jobz = EigenMode::VECTOR,
                           SolverFillMode uplo  = SolverFillMode::UPPER) {
-  return detail::EigOp(a, jobz, uplo);
+  return detail::EigOp(a, jobz, uplo, JacobiParams{}, k);
 }
 
 }
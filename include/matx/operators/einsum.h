@@ -37,6 +37,7 @@
 #include "matx/core/nvtx.h"
 #include "matx/core/operator_utils.h"
 #include "matx/transforms/einsum.h"
+#include "matx/transforms/einsum_host.h"
 
 namespace matx
 {
@@ -68,11 +69,19 @@ namespace detail {
 
       template <typename Out, typename Executor>
       void Exec(Out &&out, Executor &&ex) const {
-        static_assert(is_cuda_executor_v<Executor>, "einsum() only supports the CUDA executor currently");   
+        static_assert(is_cuda_executor_v<Executor> || is_host_executor_v<Executor>,
+                      "einsum() only supports the CUDA and host executors currently");
 
-        cuda::std::apply([&](auto... args) {
-          ::matx::cutensor::einsum_impl(cuda::std::get<0>(out), subscripts_, ex, args...);
-        }, a_);
+        if constexpr (is_host_executor_v<Executor>) {
+          cuda::std::apply([&](auto... args) {
+            ::matx::einsum_impl(cuda::std::get<0>(out), subscripts_, ex, args...);
+          }, a_);
+        }
+        else {
+          cuda::std::apply([&](auto... args) {
+            ::matx::cutensor::einsum_impl(cuda::std::get<0>(out), subscripts_, ex, args...);
+          }, a_);
+        }
       }
 
       static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
@@ -142,7 +151,9 @@ namespace cutensor {
    * 
    * Ellipses are not supported yet, but a variadic list of tensors for contraction is supported. The output
    * operator '->' is required in MatX currently, and serves to provide error checking on the output tensor size.
-   *  
+   *
+   * On host executors, contractions are run as batched CBLAS GEMMs and require host MatMul support. Only
+   * float, double and their complex types are supported there, with every operand of the output's type.
    * 
    * @tparam InT Types of input operators
    * @param subscripts String containing Einstein notation of operation to perform
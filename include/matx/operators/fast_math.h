@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+
+namespace matx {
+namespace detail {
+template <typename OpA>
+class FastMathOp : public BaseOp<FastMathOp<OpA>> {
+public:
+  using matxop = bool;
+  using value_type = typename OpA::value_type;
+
+  __MATX_INLINE__ FastMathOp(const OpA &op) : op_(op) {
+    MATX_LOOP_UNROLL
+    for (int i = 0; i < Rank(); i++) {
+      sizes_[i] = op_.Size(i);
+    }
+  }
+
+  __MATX_INLINE__ std::string str() const { return "fast_math(" + op_.str() + ")"; }
+
+  template <typename CapType, typename... Is>
+  __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+    return get_value<FastMathCapabilities<CapType>>(op_, indices...);
+  }
+
+  template <typename... Is>
+  __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+    return this->operator()<DefaultCapabilities>(indices...);
+  }
+
+  static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank() {
+    return OpA::Rank();
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const {
+    return sizes_[dim];
+  }
+
+  template <typename ShapeType, typename Executor>
+  __MATX_INLINE__ void PreRun(ShapeType &&shape, Executor &&ex) const noexcept {
+    if constexpr (is_matx_op<OpA>()) {
+      op_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    }
+  }
+
+  template <typename ShapeType, typename Executor>
+  __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept {
+    if constexpr (is_matx_op<OpA>()) {
+      op_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    }
+  }
+
+  // The intrinsics are scalar, so the expression runs one element per thread. JIT is not
+  // supported since the JIT operator strings have no fast-math path.
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType &in) const {
+    if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+      const auto my_cap =
+          cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+      return combine_capabilities<Cap>(my_cap, detail::get_operator_capability<Cap>(op_, in));
+    }
+    else {
+      auto self_has_cap = capability_attributes<Cap>::default_value;
+      return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(op_, in));
+    }
+  }
+
+private:
+  typename detail::base_type_t<OpA> op_;
+  cuda::std::array<index_t, Rank()> sizes_;
+};
+} // namespace detail
+
+/**
+ * @brief Evaluate an expression with approximate single-precision math.
+ *
+ * Inside the wrapped expression, float exp, log, log2, log10, sin, cos, tan, expj,
+ * division, and pow use the CUDA intrinsics (__expf, __logf, __sinf, __fdividef, ...)
+ * instead of the accurate device functions. Other types and operators are unchanged,
+ * as are transforms such as fft() or matmul() nested in the expression. On the host
+ * the accurate functions are used. See the fast_math documentation for error bounds.
+ *
+ * @tparam Op Input operator/tensor type
+ * @param op Expression to evaluate with fast math
+ */
+template <typename Op>
+__MATX_INLINE__ auto fast_math(const Op &op) {
+  return detail::FastMathOp<Op>(op);
+}
+
+} // namespace matx
@@ -41,6 +41,7 @@
 #include "matx/core/log.h"
 
 #include "matx/transforms/fft/fft_cuda.h"
+#include "matx/transforms/fft/fft_cufftxt.h"
 #ifdef MATX_EN_CPU_FFT
   #include "matx/transforms/fft/fft_fftw.h"
 #endif  
@@ -54,6 +55,186 @@
 namespace matx
 {
   namespace detail {
+    /**
+     * Multiplies the last dimension of an operator by exp(sign * 2*pi*i * n * shift / n_fft)
+     *
+     * Applied to the input of an n_fft-point transform with exponent sign `sign`, this cyclically shifts the
+     * transform's output by `shift` bins. It lets fftshift()/ifftshift() of an FFT be folded into the FFT's
+     * input, where it is fused into the load instead of running a separate pass over a temporary. When the
+     * shift is half the transform length, the phase reduces to (-1)^n.
+     */
+    template <typename OpA>
+    class FFTShiftModulateOp : public BaseOp<FFTShiftModulateOp<OpA>>
+    {
+      private:
+        typename detail::base_type_t<OpA> a_;
+        index_t n_fft_;
+        index_t shift_;
+        int sign_;
+
+      public:
+        using matxop = bool;
+        using value_type = typename OpA::value_type;
+
+#ifdef MATX_EN_JIT
+        struct JIT_Storage {
+          typename detail::inner_storage_or_self_t<detail::base_type_t<OpA>> a_;
+        };
+
+        JIT_Storage ToJITStorage() const {
+          return JIT_Storage{detail::to_jit_storage(a_)};
+        }
+
+        __MATX_INLINE__ std::string get_jit_class_name() const {
+          std::string dims;
+          for (int i = 0; i < Rank(); i++) {
+            dims += (i == 0 ? "" : "x") + std::to_string(Size(i));
+          }
+          return std::format("JITFFTShiftModulate_{}_{}_{}_{}", n_fft_, shift_, sign_ < 0 ? "fwd" : "inv", dims);
+        }
+
+        __MATX_INLINE__ auto get_jit_op_str() const {
+          std::string func_name = get_jit_class_name();
+          cuda::std::array<index_t, Rank()> out_dims_;
+          for (int i = 0; i < Rank(); ++i) {
+            out_dims_[i] = Size(i);
+          }
+
+          return cuda::std::make_tuple(
+            func_name,
+            std::format("template <typename T> struct {} {{\n"
+                "  using value_type = typename T::value_type;\n"
+                "  using matxop = bool;\n"
+                "  constexpr static int Rank_ = {};\n"
+                "  constexpr static cuda::std::array<index_t, Rank_> out_dims_ = {{ {} }};\n"
+                "  constexpr static index_t n_fft_ = {};\n"
+                "  constexpr static index_t shift_ = {};\n"
+                "  constexpr static int sign_ = {};\n"
+                "  typename detail::inner_storage_or_self_t<detail::base_type_t<T>> a_;\n"
+                "  template <typename CapType, typename... Is>\n"
+                "  __MATX_INLINE__ __MATX_DEVICE__ decltype(auto) operator()(Is... indices) const\n"
+                "  {{\n"
+                "    if constexpr (CapType::ept == ElementsPerThread::ONE) {{\n"
+                "      cuda::std::array idx{{indices...}};\n"
+                "      const value_type v = get_value<CapType>(a_, idx);\n"
+                "      const index_t n = idx[Rank_ - 1];\n"
+                "      if constexpr (2 * shift_ == n_fft_) {{\n"
+                "        return (n & 1) ? -v : v;\n"
+                "      }} else {{\n"
+                "        using s_type = typename value_type::value_type;\n"
+                "        const s_type ang = static_cast<s_type>(sign_ * 6.283185307179586) * static_cast<s_type>((n * shift_) % n_fft_) / static_cast<s_type>(n_fft_);\n"
+                "        return v * value_type{{cuda::std::cos(ang), cuda::std::sin(ang)}};\n"
+                "      }}\n"
+                "    }} else {{\n"
+                "      return Vector<value_type, static_cast<index_t>(CapType::ept)>{{}};\n"
+                "    }}\n"
+                "  }}\n"
+                "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return Rank_; }}\n"
+                "  constexpr __MATX_INLINE__ __MATX_DEVICE__ auto Size(int dim) const {{ return out_dims_[dim]; }}\n"
+                "}};\n",
+                func_name, Rank(), detail::array_to_string(out_dims_), n_fft_, shift_, sign_)
+          );
+        }
+#endif
+
+        __MATX_INLINE__ std::string str() const { return "fftshift_modulate(" + get_type_str(a_) + ")"; }
+
+        __MATX_INLINE__ FFTShiftModulateOp(const OpA &a, index_t n_fft, index_t shift, int sign) :
+          a_(a), n_fft_(n_fft), shift_(shift), sign_(sign) {
+          MATX_LOG_TRACE("{} constructor: n_fft={}, shift={}, sign={}", str(), n_fft, shift, sign);
+        }
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(Is... indices) const
+        {
+          if constexpr (CapType::ept == ElementsPerThread::ONE) {
+            cuda::std::array idx{indices...};
+            const value_type v = get_value<CapType>(a_, idx);
+            const index_t n = idx[Rank() - 1];
+            if (2 * shift_ == n_fft_) {
+              return (n & 1) ? -v : v;
+            }
+            using s_type = typename value_type::value_type;
+            const s_type ang = static_cast<s_type>(sign_ * 6.283185307179586) *
+                               static_cast<s_type>((n * shift_) % n_fft_) / static_cast<s_type>(n_fft_);
+            return v * value_type{cuda::std::cos(ang), cuda::std::sin(ang)};
+          } else {
+            return Vector<value_type, static_cast<index_t>(CapType::ept)>{};
+          }
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return this->operator()<DefaultCapabilities>(indices...);
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+          if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
+#ifdef MATX_EN_JIT
+            const auto op_jit_name = detail::get_operator_capability<Cap>(a_, in);
+            return std::format("{}<{}>", get_jit_class_name(), op_jit_name);
+#else
+            return "";
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+#ifdef MATX_EN_JIT
+            return combine_capabilities<Cap>(true, detail::get_operator_capability<Cap>(a_, in));
+#else
+            return false;
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::JIT_CLASS_QUERY) {
+#ifdef MATX_EN_JIT
+            const auto [key, value] = get_jit_op_str();
+            if (in.find(key) == in.end()) {
+              in[key] = value;
+            }
+            detail::get_operator_capability<Cap>(a_, in);
+            return true;
+#else
+            return false;
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+            const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+            return combine_capabilities<Cap>(my_cap, detail::get_operator_capability<Cap>(a_, in));
+          }
+          else {
+            auto self_has_cap = capability_attributes<Cap>::default_value;
+            return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in));
+          }
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return detail::get_rank<OpA>();
+        }
+
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ auto Size(int dim) const noexcept
+        {
+          return a_.Size(dim);
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpA>()) {
+            a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpA>()) {
+            a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+    };
+
     template <typename OpA, typename PermDims, FFTDirection Direction, FFTType Type>
     class FFTOp : public BaseOp<FFTOp<OpA, PermDims, Direction, Type>>
     {
@@ -93,6 +274,22 @@ namespace matx
           return JIT_Storage{detail::to_jit_storage(a_)};
         }
 #endif             
+
+        /**
+         * Returns an FFT whose output is this one's cyclically shifted by `shift` bins along the
+         * transform dimension. The shift is applied as a phase ramp on the input, so fftshift/ifftshift
+         * of an FFT costs no extra pass or temporary. Only available for unpermuted complex-to-complex
+         * transforms.
+         */
+        __MATX_INLINE__ auto FoldOutputShift(index_t shift) const
+          requires (std::is_same_v<PermDims, no_permute_t> && Type == FFTType::C2C &&
+                    is_complex_v<input_type> && !is_complex_half_v<input_type>)
+        {
+          constexpr int sign = Direction == FFTDirection::FORWARD ? -1 : 1;
+          const index_t n_fft = out_dims_[Rank() - 1];
+          auto mod = FFTShiftModulateOp<base_type_t<OpA>>(a_, n_fft, shift % n_fft, sign);
+          return FFTOp<decltype(mod), no_permute_t, Direction, Type>(mod, fft_size_, no_permute_t{}, norm_);
+        }
         
         __MATX_INLINE__ std::string str() const { 
           if constexpr (Direction == detail::FFTDirection::FORWARD) {
@@ -475,16 +672,23 @@ namespace matx
           detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);         
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr); 
+          detail::FreeTempTensor(ptr);
         }
     };
   }
@@ -826,16 +1030,23 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr);           
+          detail::FreeTempTensor(ptr);
         }    
     };    
   }
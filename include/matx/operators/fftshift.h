@@ -227,10 +227,20 @@ namespace matx
    *   Type of View/Op
    * @param t
    *   View/Op to shift
+   * When applied directly to an unpermuted complex-to-complex fft() or ifft(),
+   * the shift is folded into the transform as a phase ramp on its input
+   * instead of being applied to the transform's output.
    *
    */
   template <typename T1>
-    auto fftshift1D(const T1 &t) { return detail::FFTShift1DOp<T1>(t); }
+    auto fftshift1D(const T1 &t) {
+      if constexpr (requires { t.FoldOutputShift(index_t{}); }) {
+        return t.FoldOutputShift((t.Size(T1::Rank() - 1) + 1) / 2);
+      }
+      else {
+        return detail::FFTShift1DOp<T1>(t);
+      }
+    }
 
 
   namespace detail {
@@ -613,6 +623,9 @@ namespace matx
    * positive frequencies. Note that ifftshift is the same as fftshift if the
    * length of the signal is even.
    *
+   * As with fftshift1D, applying it directly to an unpermuted complex-to-complex
+   * fft() or ifft() folds the shift into the transform's input.
+   *
    * @tparam T1
    *   Type of View/Op
    * @param t
@@ -620,7 +633,14 @@ namespace matx
    *
    */
   template <typename T1>
-    auto ifftshift1D(T1 t) { return detail::IFFTShift1DOp<T1>(t); }
+    auto ifftshift1D(T1 t) {
+      if constexpr (requires { t.FoldOutputShift(index_t{}); }) {
+        return t.FoldOutputShift(t.Size(T1::Rank() - 1) / 2);
+      }
+      else {
+        return detail::IFFTShift1DOp<T1>(t);
+      }
+    }
 
   namespace detail {
     template <typename T1>
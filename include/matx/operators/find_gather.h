@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND argmin EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR argmin DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON argmin THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN argmin WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/find_gather.h"
+
+namespace matx {
+
+
+
+namespace detail {
+  template<typename OpA, typename SelectType, typename... Extras>
+  class FindGatherOp : public BaseOp<FindGatherOp<OpA, SelectType, Extras...>>
+  {
+    private:
+      typename detail::base_type_t<OpA> a_;
+      SelectType sel_;
+      cuda::std::tuple<typename detail::base_type_t<Extras>...> extras_;
+
+      template <typename Out, typename Executor, size_t... I>
+      void ExecImpl(Out &&out, Executor &&ex, cuda::std::index_sequence<I...>) const {
+        auto outs = cuda::std::forward_as_tuple(cuda::std::get<0>(out), cuda::std::get<I + 2>(out)...);
+        auto ins = cuda::std::forward_as_tuple(a_, cuda::std::get<I>(extras_)...);
+        find_gather_impl(cuda::std::get<1>(out), cuda::std::get<sizeof...(Extras) + 2>(out), outs, a_, sel_, ins, ex);
+      }
+
+    public:
+      using matxop = bool;
+      using value_type = typename OpA::value_type;
+      using matx_transform_op = bool;
+      using find_gather_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "find_gather()"; }
+      __MATX_INLINE__ FindGatherOp(const OpA &a, SelectType sel, const Extras &...extras) :
+          a_(a), sel_(sel), extras_(extras...) {
+        MATX_LOG_TRACE("{} constructor: extras={}", str(), sizeof...(Extras));
+      };
+
+      // This should never be called
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const = delete;
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return cuda::std::apply([&](const auto &...extra) {
+          return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in),
+                                           detail::get_operator_capability<Cap>(extra, in)...);
+        }, extras_);
+      }
+
+      // Size is not relevant in find_gather() since there are multiple return values and it
+      // is not allowed to be called in larger expressions
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size([[maybe_unused]] int dim) const
+      {
+        return 0;
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return 1;
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == sizeof...(Extras) + 4,
+          "Must use mtie with one output per extra operator plus 3 on find_gather(). ie: (mtie(Vals, Idx, Extra0, ..., num_found) = find_gather(A, sel, extra0, ...))");
+
+        ExecImpl(std::forward<Out>(out), std::forward<Executor>(ex), cuda::std::make_index_sequence<sizeof...(Extras)>{});
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        cuda::std::apply([&](const auto &...extra) {
+          ([&]() {
+            if constexpr (is_matx_op<remove_cvref_t<decltype(extra)>>()) {
+              extra.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+            }
+          }(), ...);
+        }, extras_);
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        cuda::std::apply([&](const auto &...extra) {
+          ([&]() {
+            if constexpr (is_matx_op<remove_cvref_t<decltype(extra)>>()) {
+              extra.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+            }
+          }(), ...);
+        }, extras_);
+      }
+  };
+}
+
+/**
+ * Reduce values, indices and extra operators that meet a certain criteria
+ *
+ * Finds all indices of values meeting the criteria specified in SelectOp, and saves out the value of the
+ * input, the index, and the value of every extra operator at that index in a single stream compaction.
+ * This replaces a find_idx() followed by one select() per associated operator, so outputs sharing the
+ * same mask are compacted in one pass over the input. The number of entries found is written to a
+ * rank-0 tensor on the device. Output tensors must be large enough to hold every selected entry. To be
+ * safe, they can be the same size as the input.
+ *
+ * @tparam OpA
+ *   Input type
+ * @tparam SelectType
+ *   Type of select functor
+ * @tparam Extras
+ *   Types of the extra operators to gather
+ * @param a
+ *   Input operator the select functor is applied to
+ * @param sel
+ *   Select functor
+ * @param extras
+ *   Operators with the same size as a, gathered at each selected index
+ * @returns The selected values, their indices, one output per extra operator, and the number found
+ */
+template<typename OpA, typename SelectType, typename... Extras>
+__MATX_INLINE__ auto find_gather(const OpA &a, SelectType sel, const Extras &...extras) {
+  return detail::FindGatherOp<OpA, SelectType, Extras...>(a, sel, extras...);
+}
+
+}
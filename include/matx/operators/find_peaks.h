@@ -48,8 +48,7 @@ namespace detail {
   {
     private:
       typename detail::base_type_t<OpA> a_;
-      typename remove_cvref_t<OpA>::value_type height_;
-      typename remove_cvref_t<OpA>::value_type threshold_;
+      FindPeaksParams params_;
 
     public:
       using matxop = bool;
@@ -58,10 +57,9 @@ namespace detail {
       using find_peaks_xform_op = bool;
 
       __MATX_INLINE__ std::string str() const { return "find_peaks(" + get_type_str(a_) + ")"; }
-      __MATX_INLINE__ FindPeaksOp(const OpA &a, value_type height, 
-                                                value_type threshold) : 
-                                                a_(a), height_(height), threshold_(threshold) { 
-        MATX_LOG_TRACE("{} constructor: height={}, threshold={}", str(), height, threshold);
+      __MATX_INLINE__ FindPeaksOp(const OpA &a, const FindPeaksParams &params) : a_(a), params_(params) {
+        MATX_LOG_TRACE("{} constructor: height={}, threshold={}, distance={}, prominence={}", str(),
+          params.height, params.threshold, params.distance, params.prominence);
       }
 
       template <typename... Is>
@@ -75,13 +73,20 @@ namespace detail {
 
       template <typename Out, typename Executor>
       void Exec(Out &&out, Executor &&ex) const {
-        static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 3, "Must use mtie with 2 outputs on find_peaks(). ie: (mtie(O, num_found) = find_peaks(A, height, threshold))");     
-        static_assert(remove_cvref_t<decltype(cuda::std::get<1>(out))>::Rank() == 0 &&
-                      std::is_same_v<typename remove_cvref_t<decltype(cuda::std::get<1>(out))>::value_type, int>, 
-                      "Num elements output must be a scalar integer tensor");
+        constexpr auto outs = cuda::std::tuple_size_v<remove_cvref_t<Out>>;
+        static_assert(outs == 3 || outs == 5, "Must use mtie with 2 or 4 outputs on find_peaks(). ie: (mtie(O, num_found) = find_peaks(A, height, threshold))");
+        static_assert(std::is_same_v<typename remove_cvref_t<decltype(cuda::std::get<1>(out))>::value_type, int>,
+                      "Num elements output must be an integer tensor");
         static_assert(std::is_same_v<typename remove_cvref_t<decltype(cuda::std::get<0>(out))>::value_type, index_t>, 
-                      "Peak indices output must be a 1D matx::index_t tensor");
-        find_peaks_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, height_, threshold_, ex);
+                      "Peak indices output must be a matx::index_t tensor");
+        if constexpr (outs == 5) {
+          find_peaks_impl<true>(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), cuda::std::get<3>(out),
+            a_, params_, ex);
+        }
+        else {
+          find_peaks_impl<false>(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<0>(out), cuda::std::get<0>(out),
+            a_, params_, ex);
+        }
       }
 
       static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
@@ -129,11 +134,9 @@ namespace detail {
  *
  * @tparam InType
  *   Input data type
- * @tparam D
- *   Number of right-most dimensions to reduce over
  *
  * @param in
- *   Input data to reduce
+ *   Input data to search
  * @param height
  *   Height threshold for peak detection. Values below this threshold are not considered peaks.
  * @param threshold
@@ -146,7 +149,38 @@ __MATX_INLINE__ auto find_peaks(const InType &in,
                                  typename InType::value_type threshold)
 {
   static_assert(InType::Rank() == 1, "Input to find_peaks() must be rank 1");
-  return detail::FindPeaksOp<decltype(in)>(in, height, threshold);
+  FindPeaksParams params;
+  params.height = static_cast<double>(height);
+  params.threshold = static_cast<double>(threshold);
+  return detail::FindPeaksOp<decltype(in)>(in, params);
+}
+
+/**
+ * Compute a batched peak search with distance and prominence filtering
+ *
+ * Searches every row of a rank 2 input, or a single rank 1 input. Candidates pass the height and threshold tests of the
+ * three-argument form. A candidate closer than `distance` samples to a higher candidate, or to an equally high earlier
+ * one, is removed, and the remaining peaks must reach the requested prominence.
+ *
+ * With `mtie(idx, num_found)` the indices of the peaks of row `r` are written in ascending order to `idx(r, :)` and the
+ * count to `num_found(r)`. With `mtie(idx, num_found, prom, width)` the prominence of each peak and its width at
+ * `rel_height` of the prominence are written alongside. For a rank 1 input the row index is dropped and `num_found`
+ * is rank 0. The last dimension of the outputs must be large enough to hold all peaks of a row.
+ *
+ * @tparam InType
+ *   Input data type
+ *
+ * @param in
+ *   Input data to search
+ * @param params
+ *   Peak search parameters
+ * @returns Operator with the peak search computed
+ */
+template <typename InType>
+__MATX_INLINE__ auto find_peaks(const InType &in, const FindPeaksParams &params)
+{
+  static_assert(InType::Rank() == 1 || InType::Rank() == 2, "Input to find_peaks() must be rank 1 or 2");
+  return detail::FindPeaksOp<decltype(in)>(in, params);
 }
 
 }
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+
+namespace matx
+{
+  /**
+   * First-n operator
+   *
+   * Bounds the first dimension of an operator by a count held in a device tensor, such as the number of
+   * elements found by find(), find_idx() or unique(). The shape of the operator is unchanged, so it is
+   * the worst case, and values are passed through unmodified.
+   */
+  namespace detail {
+    template <typename T1, typename CountOp>
+      class FirstNOp : public BaseOp<FirstNOp<T1, CountOp>>
+    {
+      private:
+        mutable typename detail::base_type_t<T1> op_;
+        typename detail::base_type_t<CountOp> count_;
+
+      public:
+        using matxop = bool;
+        using matx_dynamic_extent = bool;
+        using value_type = typename T1::value_type;
+        using count_type = typename CountOp::value_type;
+
+        __MATX_INLINE__ std::string str() const { return "first_n(" + get_type_str(op_) + ")"; }
+
+        __MATX_INLINE__ FirstNOp(const T1 &op, const CountOp &count) : op_(op), count_(count) {
+          static_assert(Rank() > 0, "first_n() requires an operator of rank 1 or higher");
+          static_assert(CountOp::Rank() == 0, "first_n() count must be a rank-0 tensor");
+          static_assert(cuda::std::is_integral_v<count_type>, "first_n() count must be an integral type");
+          MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
+        }
+
+        /**
+         * @brief Pointer to the count bounding the first dimension
+         */
+        __MATX_INLINE__ __MATX_HOST__ const count_type *CountData() const noexcept {
+          return count_.Data();
+        }
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return get_value<CapType>(op_, indices...);
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return this->operator()<DefaultCapabilities>(indices...);
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return detail::get_rank<T1>();
+        }
+
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+        {
+          return op_.Size(dim);
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<T1>()) {
+            op_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<T1>()) {
+            op_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+          if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+            return false;
+          }
+          else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+            // The bounded launch evaluates one element per thread
+            const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+            return combine_capabilities<Cap>(my_cap, detail::get_operator_capability<Cap>(op_, in));
+          }
+          else if constexpr (Cap == OperatorCapability::DYN_SHM_SIZE) {
+            return detail::get_operator_capability<Cap>(op_, in);
+          }
+          else if constexpr (Cap == OperatorCapability::PREFETCH_MEMORY ||
+                             Cap == OperatorCapability::STREAM_DEPENDENCIES ||
+                             Cap == OperatorCapability::WRITE_VERSIONS ||
+                             Cap == OperatorCapability::RESIDENT_MEMORY) {
+            // The count is read on the device as well
+            return combine_capabilities<Cap>(detail::get_operator_capability<Cap>(op_, in),
+                                             detail::get_operator_capability<Cap>(count_, in));
+          }
+          else {
+            auto self_has_cap = capability_attributes<Cap>::default_value;
+            return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(op_, in));
+          }
+        }
+    };
+  }
+
+  /**
+   * @brief Bound the first dimension of an operator by a count on the device
+   *
+   * Transforms such as find(), find_idx() and unique() write a worst-case sized output and the number of
+   * valid entries to a rank-0 device tensor. Assigning first_n() of an expression over such an output
+   * launches a grid-stride kernel sized for the worst case that reads the count on the device and stops
+   * once it is reached, so neither a host synchronization nor work on the invalid tail is needed.
+   * Entries of the output past the count are not written.
+   *
+   * The bound is applied only when first_n() is the whole right-hand side of an assignment on the CUDA
+   * executor. Elsewhere, including the host executors and inside larger expressions, the operator passes
+   * values through over its full worst-case shape. The JIT executor does not support it.
+   *
+   * @tparam T1 Type of operator or view
+   * @tparam CountOp Type of the count tensor
+   * @param t Operator or view whose first dimension is bounded
+   * @param count Rank-0 integral tensor holding the number of valid entries in the first dimension
+   *
+   * @returns Operator with the same shape and values as the input
+   */
+  template <typename T1, typename CountOp>
+    __MATX_INLINE__ auto first_n(const T1 &t, const CountOp &count) {
+      return detail::FirstNOp<T1, CountOp>(t, count);
+    }
+} // end namespace matx
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND argmin EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR argmin DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON argmin THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN argmin WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/groupby.h"
+
+namespace matx {
+
+
+
+namespace detail {
+  template<typename OpK, typename OpV>
+  class GroupByReduceOp : public BaseOp<GroupByReduceOp<OpK, OpV>>
+  {
+    private:
+      typename detail::base_type_t<OpK> keys_;
+      typename detail::base_type_t<OpV> values_;
+      GroupByOp op_;
+
+    public:
+      using matxop = bool;
+      using value_type = typename remove_cvref_t<OpV>::value_type;
+      using matx_transform_op = bool;
+      using groupby_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "groupby_reduce(" + get_type_str(keys_) + ")"; }
+      __MATX_INLINE__ GroupByReduceOp(const OpK &keys, const OpV &values, GroupByOp op) :
+          keys_(keys), values_(values), op_(op) {
+        MATX_LOG_TRACE("{} constructor: op={}", str(), static_cast<int>(op));
+      };
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const = delete;
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(keys_, in),
+                                         detail::get_operator_capability<Cap>(values_, in));
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 5, "Must use mtie with 4 outputs on groupby_reduce(). ie: (mtie(Keys, Vals, Counts, NumGroups) = groupby_reduce(K, V, op))");
+        groupby_reduce_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), cuda::std::get<3>(out),
+                            keys_, values_, op_, ex);
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return 1;
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpK>()) {
+          keys_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpV>()) {
+          values_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpK>()) {
+          keys_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpV>()) {
+          values_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      // Size is not relevant in groupby_reduce() since there are multiple return values and it
+      // is not allowed to be called in larger expressions
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size([[maybe_unused]] int dim) const
+      {
+        return 0;
+      }
+  };
+}
+
+/**
+ * Group values by key and reduce each group
+ *
+ * Every distinct key in keys forms a group, and the values at the same
+ * positions are reduced with op. The outputs hold the key, the reduced value,
+ * and the number of values of each group, plus the total number of groups.
+ * Outputs must be large enough to hold every group. To be safe, they can be
+ * the same size as the input. On the CUDA executor the groups are built with
+ * a device hash table and appear in no particular order.
+ *
+ * @tparam KeyOperator
+ *   Keys type
+ * @tparam ValueOperator
+ *   Values type
+ * @param keys
+ *   Key of each value
+ * @param values
+ *   Values to reduce, with the same size as keys
+ * @param op
+ *   Reduction to apply to each group
+ * @returns Four operators: the group keys, the reduced values, the counts, and the number of groups
+ */
+template <typename KeyOperator, typename ValueOperator>
+__MATX_INLINE__ auto groupby_reduce(const KeyOperator &keys, const ValueOperator &values,
+                                    GroupByOp op = GroupByOp::SUM) {
+  return detail::GroupByReduceOp(keys, values, op);
+}
+
+}
@@ -36,6 +36,7 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/cub.h"
+#include "matx/transforms/hist.h"
 
 namespace matx {
 
@@ -128,18 +129,257 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }        
   };
+
+  template<typename OpA, typename OpE>
+  class HistRangeOp : public BaseOp<HistRangeOp<OpA, OpE>>
+  {
+    private:
+      typename detail::base_type_t<OpA> a_;
+      typename detail::base_type_t<OpE> edges_;
+      cuda::std::array<index_t, OpA::Rank()> out_dims_;
+      mutable detail::tensor_impl_t<int, OpA::Rank()> tmp_out_;
+      mutable int *ptr = nullptr;
+      mutable bool prerun_done_ = false;
+
+    public:
+      using matxop = bool;
+      using value_type = int;
+      using matx_transform_op = bool;
+      using hist_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "hist()"; }
+      __MATX_INLINE__ HistRangeOp(const OpA &a, const OpE &edges) : a_(a), edges_(edges) {
+        MATX_LOG_TRACE("{} constructor: num_edges={}", str(), edges.Size(0));
+        for (int r = 0; r < Rank(); r++) {
+          out_dims_[r] = a_.Size(r);
+        }
+
+        out_dims_[out_dims_.size() - 1] = edges_.Size(0) - 1;
+      }
+
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return tmp_out_.template operator()<CapType>(indices...);
+      };
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return this->operator()<DefaultCapabilities>(indices...);
+      };
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in),
+                                         detail::get_operator_capability<Cap>(edges_, in));
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return OpA::Rank();
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(is_cuda_executor_v<Executor>, "hist() only supports the CUDA executor currently");
+
+        hist_range_impl(cuda::std::get<0>(out), a_, edges_, ex.getStream());
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpE>()) {
+          edges_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if (prerun_done_) {
+          return;
+        }
+
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        prerun_done_ = true;
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpE>()) {
+          edges_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+  };
+
+  template<typename OpX, typename OpY>
+  class Hist2DOp : public BaseOp<Hist2DOp<OpX, OpY>>
+  {
+    private:
+      typename detail::base_type_t<OpX> x_;
+      typename detail::base_type_t<OpY> y_;
+      typename OpX::value_type xlower_;
+      typename OpX::value_type xupper_;
+      int xlevels_;
+      typename OpY::value_type ylower_;
+      typename OpY::value_type yupper_;
+      int ylevels_;
+      cuda::std::array<index_t, OpX::Rank() + 1> out_dims_;
+      mutable detail::tensor_impl_t<int, OpX::Rank() + 1> tmp_out_;
+      mutable int *ptr = nullptr;
+      mutable bool prerun_done_ = false;
+
+    public:
+      using matxop = bool;
+      using value_type = int;
+      using matx_transform_op = bool;
+      using hist_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "hist2d()"; }
+      __MATX_INLINE__ Hist2DOp(const OpX &x, const OpY &y,
+                               typename OpX::value_type xlower, typename OpX::value_type xupper, int xlevels,
+                               typename OpY::value_type ylower, typename OpY::value_type yupper, int ylevels) :
+          x_(x), y_(y), xlower_(xlower), xupper_(xupper), xlevels_(xlevels),
+          ylower_(ylower), yupper_(yupper), ylevels_(ylevels) {
+        MATX_LOG_TRACE("{} constructor: xlevels={}, ylevels={}", str(), xlevels, ylevels);
+        for (int r = 0; r < OpX::Rank() - 1; r++) {
+          out_dims_[r] = x_.Size(r);
+        }
+
+        out_dims_[Rank() - 2] = xlevels_ - 1;
+        out_dims_[Rank() - 1] = ylevels_ - 1;
+      }
+
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return tmp_out_.template operator()<CapType>(indices...);
+      };
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return this->operator()<DefaultCapabilities>(indices...);
+      };
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(x_, in),
+                                         detail::get_operator_capability<Cap>(y_, in));
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return OpX::Rank() + 1;
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(is_cuda_executor_v<Executor>, "hist2d() only supports the CUDA executor currently");
+
+        hist2d_impl(cuda::std::get<0>(out), x_, y_, xlower_, xupper_, xlevels_, ylower_, yupper_, ylevels_,
+                    ex.getStream());
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpX>()) {
+          x_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpY>()) {
+          y_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if (prerun_done_) {
+          return;
+        }
+
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        prerun_done_ = true;
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpX>()) {
+          x_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpY>()) {
+          y_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+  };
 }
 
 /**
@@ -171,4 +411,68 @@ __MATX_INLINE__ auto hist(const InputOperator &a,
   return detail::HistOp(a, lower, upper, num_levels);
 }
 
+/**
+ * Compute a histogram with arbitrary bin edges of rows in a tensor
+ *
+ * Bin i counts the samples of a row in [edges(i), edges(i+1)), equivalent to
+ * CUB's HistogramRange. edges must be sorted in increasing order, and the
+ * output has edges.Size(0) - 1 bins in its last dimension. All other input
+ * dimensions are batched and computed in a single launch.
+ *
+ * @tparam InputOperator
+ *   Type of histogram input
+ * @tparam EdgeOperator
+ *   Type of the bin edges
+ * @param a
+ *   Input operator
+ * @param edges
+ *   Rank 1 operator of sorted bin edges
+ */
+template <typename InputOperator, typename EdgeOperator>
+__MATX_INLINE__ auto hist(const InputOperator &a, const EdgeOperator &edges) {
+  static_assert(EdgeOperator::Rank() == 1, "hist() bin edges must be rank 1");
+  return detail::HistRangeOp(a, edges);
+}
+
+/**
+ * Compute a joint 2D histogram of rows in two tensors
+ *
+ * Counts the pairs (x, y) of matching samples in each row into evenly spaced
+ * bins, with xlevels - 1 bins over [xlower, xupper) and ylevels - 1 bins over
+ * [ylower, yupper). The output has the batch dimensions of the inputs followed
+ * by the x bins and the y bins. Pairs where either sample is out of range are
+ * not counted.
+ *
+ * @tparam XOperator
+ *   Type of the first input
+ * @tparam YOperator
+ *   Type of the second input
+ * @param x
+ *   First input operator
+ * @param y
+ *   Second input operator, with the same shape as x
+ * @param xlower
+ *   Lower limit of x
+ * @param xupper
+ *   Upper limit of x
+ * @param xlevels
+ *   Number of x levels
+ * @param ylower
+ *   Lower limit of y
+ * @param yupper
+ *   Upper limit of y
+ * @param ylevels
+ *   Number of y levels
+ */
+template <typename XOperator, typename YOperator>
+__MATX_INLINE__ auto hist2d(const XOperator &x, const YOperator &y,
+          const typename XOperator::value_type xlower,
+          const typename XOperator::value_type xupper,
+          int xlevels,
+          const typename YOperator::value_type ylower,
+          const typename YOperator::value_type yupper,
+          int ylevels) {
+  return detail::Hist2DOp(x, y, xlower, xupper, xlevels, ylower, yupper, ylevels);
+}
+
 }
@@ -39,19 +39,22 @@
 namespace matx
 {
   namespace detail {
-    template <typename T1>
-      class ComplexInterleavedOp : public BaseOp<ComplexInterleavedOp<T1>>
+    template <typename T>
+    using interleaved_complex_t = std::conditional_t<is_matx_half_v<T>, matxHalfComplex<T>, cuda::std::complex<T>>;
+
+    template <typename T1, typename ComplexType = interleaved_complex_t<typename T1::value_type>>
+      class ComplexInterleavedOp : public BaseOp<ComplexInterleavedOp<T1, ComplexType>>
     {
       private:
+        using scalar_type = typename ComplexType::value_type;
+
         mutable typename detail::base_type_t<T1> op_;
+        scalar_type scale_;
 
       public:
         using matxop = bool;
-        using value_type = typename T1::value_type;
-
-        using complex_type = std::conditional_t<is_matx_half_v<value_type>,
-              matxHalfComplex<value_type>,
-              cuda::std::complex<value_type>>;
+        using value_type = ComplexType;
+        using complex_type = ComplexType;
 
 #ifdef MATX_EN_JIT
         struct JIT_Storage {
@@ -63,11 +66,18 @@ namespace matx
         }
 
         __MATX_INLINE__ std::string get_jit_class_name() const {
-          return "JITInterleaved";
+          std::string dims;
+          for (int i = 0; i < Rank(); i++) {
+            dims += (i == 0 ? "" : "x") + std::to_string(Size(i));
+          }
+          // The scale is baked in as a constant, so its exact bits are part of the name
+          return std::format("JITInterleaved_scale{:x}_{}", detail::jit_scalar_bits(static_cast<double>(scale_)), dims);
         }
 
         __MATX_INLINE__ auto get_jit_op_str() const {
           std::string func_name = get_jit_class_name();
+          const double scale = static_cast<double>(scale_);
+          const std::string scale_literal = std::format("{}0x{:a}", std::signbit(scale) ? "-" : "", std::fabs(scale));
           cuda::std::array<index_t, Rank()> out_dims_;
           for (int i = 0; i < Rank(); ++i) {
             out_dims_[i] = Size(i);
@@ -75,9 +85,10 @@ namespace matx
           
           return cuda::std::make_tuple(
             func_name,
-            std::format("template <typename T> struct {} {{\n"
-                "  using value_type = typename T::value_type;\n"
-                "  using complex_type = cuda::std::complex<value_type>;\n"
+            std::format("template <typename T, typename ComplexType> struct {} {{\n"
+                "  using value_type = ComplexType;\n"
+                "  using complex_type = ComplexType;\n"
+                "  using scalar_type = typename ComplexType::value_type;\n"
                 "  using matxop = bool;\n"
                 "  constexpr static int Rank_ = {};\n"
                 "  constexpr static cuda::std::array<index_t, Rank_> out_dims_ = {{ {} }};\n"
@@ -86,31 +97,28 @@ namespace matx
                 "  __MATX_INLINE__ __MATX_DEVICE__ auto operator()(Is... indices) const\n"
                 "  {{\n"
                 "    if constexpr (CapType::ept == ElementsPerThread::ONE) {{\n"
-                "      auto real = get_value<DefaultCapabilities>(op_, indices...);\n"
+                "      const scalar_type scale = static_cast<scalar_type>({});\n"
+                "      const auto real = static_cast<scalar_type>(get_value<DefaultCapabilities>(op_, indices...));\n"
                 "      constexpr size_t rank_idx = (Rank_ == 1) ? 0 : (Rank_ - 2);\n"
                 "      cuda::std::array idx{{indices...}};\n"
-                "      idx[rank_idx] += out_dims_[rank_idx] / 2;\n"
-                "      auto imag = get_value<DefaultCapabilities>(op_, idx);\n"
-                "      return complex_type{{real, imag}};\n"
+                "      idx[rank_idx] += out_dims_[rank_idx];\n"
+                "      const auto imag = static_cast<scalar_type>(get_value<DefaultCapabilities>(op_, idx));\n"
+                "      return complex_type{{static_cast<scalar_type>(real * scale), static_cast<scalar_type>(imag * scale)}};\n"
                 "    }} else {{\n"
                 "      return Vector<value_type, static_cast<index_t>(CapType::ept)>{{}};\n"
                 "    }}\n"
                 "  }}\n"
                 "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return Rank_; }}\n"
-                "  constexpr __MATX_INLINE__ __MATX_DEVICE__ auto Size(int dim) const\n"
-                "  {{\n"
-                "    if constexpr (Rank_ <= 1) return out_dims_[dim];\n"
-                "    return (dim == Rank_ - 2) ? out_dims_[dim] : out_dims_[dim];\n"
-                "  }}\n"
+                "  constexpr __MATX_INLINE__ __MATX_DEVICE__ auto Size(int dim) const {{ return out_dims_[dim]; }}\n"
                 "}};\n",
-                func_name, Rank(), detail::array_to_string(out_dims_))
+                func_name, Rank(), detail::array_to_string(out_dims_), scale_literal)
           );
         }
 #endif
 
         __MATX_INLINE__ std::string str() const { return "interleaved(" + op_.str() + ")"; }
 
-        __MATX_INLINE__ ComplexInterleavedOp(const T1 &op) : op_(op) {
+        __MATX_INLINE__ ComplexInterleavedOp(const T1 &op, scalar_type scale = scalar_type(1)) : op_(op), scale_(scale) {
           MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
           static_assert(!is_complex_v<extract_value_type_t<T1>>, "Complex interleaved op only works on scalar input types");
           static_assert(Rank() > 0);
@@ -121,14 +129,16 @@ namespace matx
         __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(Is... indices) const 
         {
           if constexpr (CapType::ept == ElementsPerThread::ONE) {
-            auto real = get_value<DefaultCapabilities>(op_, indices...);
+            // Converting to the output precision before scaling lets integer samples be normalized
+            // in the same read
+            const auto real = static_cast<scalar_type>(get_value<DefaultCapabilities>(op_, indices...));
 
             constexpr size_t rank_idx = (Rank() == 1) ? 0 : (Rank() - 2);
             cuda::std::array idx{indices...};
             idx[rank_idx] += op_.Size(rank_idx) / 2;
 
-            auto imag = get_value<DefaultCapabilities>(op_, idx);
-            return complex_type{real, imag};
+            const auto imag = static_cast<scalar_type>(get_value<DefaultCapabilities>(op_, idx));
+            return complex_type{static_cast<scalar_type>(real * scale_), static_cast<scalar_type>(imag * scale_)};
           } else {
             return Vector<value_type, static_cast<index_t>(CapType::ept)>{};
           }
@@ -177,7 +187,7 @@ namespace matx
           if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
 #ifdef MATX_EN_JIT
             const auto op_jit_name = detail::get_operator_capability<Cap>(op_, in);
-            return std::format("{}<{}>", get_jit_class_name(), op_jit_name);
+            return std::format("{}<{},{}>", get_jit_class_name(), op_jit_name, detail::type_to_string<ComplexType>());
 #else
             return "";
 #endif
@@ -244,4 +254,31 @@ namespace matx
       static_assert(!is_complex_v<extract_value_type_t<T1>>, "Input to interleaved operator must be real-valued");
       return detail::ComplexInterleavedOp<T1>(t);
     }
+
+  /**
+   * Convert a planar complex input to interleaved complex values of a given type, scaling each component
+   *
+   * This is the same layout shift as interleaved(t), but each real and imaginary sample is converted to
+   * the scalar type of ComplexType and multiplied by scale as it's read. Raw planar samples, such as int16
+   * I/Q from an ADC, can then be passed straight to a transform like fft() or channelize_poly() as
+   * normalized complex floats. The conversion happens in the transform's input stage (a cuFFT load callback
+   * or the channelizer's filter kernel) instead of in a separate pass over a temporary.
+   *
+   * @tparam ComplexType
+   *   Complex type of the output, such as cuda::std::complex<float>
+   * @tparam T1
+   *   Type of View/Op
+   * @param t
+   *   View/Op to shift
+   * @param scale
+   *   Factor each converted component is multiplied by
+   *
+   */
+  template <typename ComplexType, typename T1>
+    auto interleaved(const T1 &t, typename inner_op_type_t<ComplexType>::type scale)
+    {
+      static_assert(!is_complex_v<extract_value_type_t<T1>>, "Input to interleaved operator must be real-valued");
+      static_assert(is_complex_v<ComplexType> || is_complex_half_v<ComplexType>, "Output type of interleaved must be complex");
+      return detail::ComplexInterleavedOp<T1, ComplexType>(t, scale);
+    }
 } // end namespace matx
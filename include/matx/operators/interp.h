@@ -52,6 +52,19 @@ namespace matx {
     SPLINE   ///< Cubic spline interpolation, using not-a-knot boundary conditions
   };
 
+  /**
+   * @brief Interval search strategy enumeration
+   *
+   * Specifies how the interval containing each query point is located in the sample points. The
+   * faster strategies rely on properties of the inputs that are not checked at runtime; if those
+   * properties do not hold the results are undefined.
+   */
+  enum class InterpSearch {
+    BINARY,  ///< Independent binary search over all sample points for every query
+    SORTED,  ///< Query points are sorted in ascending order along the interpolation dimension
+    UNIFORM  ///< Sample points are uniformly spaced, so the interval is computed directly
+  };
+
   namespace detail {
     template <class O, class OpX, class OpV>
     class InterpSplineTridiagonalFillOp : public BaseOp<InterpSplineTridiagonalFillOp<O, OpX, OpV>> {
@@ -60,8 +73,8 @@ namespace matx {
 
     private:
       O dl_, d_, du_, b_;
-      OpX x_;
-      OpV v_;
+      typename detail::base_type_t<OpX> x_;
+      typename detail::base_type_t<OpV> v_;
       using x_val_type = typename OpX::value_type;
       using v_val_type = typename OpV::value_type;
 
@@ -181,6 +194,93 @@ namespace matx {
     };
 
 
+    // Number of consecutive query points sharing one precomputed search window for InterpSearch::SORTED
+    constexpr index_t INTERP_SORTED_TILE = 256;
+
+    template <class O, class OpX, class OpXQ>
+    class InterpSortedTileFillOp : public BaseOp<InterpSortedTileFillOp<O, OpX, OpXQ>> {
+      // custom operator that finds the sample interval of the first query point in each tile of
+      // sorted query points. Entry t holds the largest i with x(i) <= xq(t * INTERP_SORTED_TILE),
+      // clamped to [0, n-1], and the extra entry at the end holds n-1.
+
+    private:
+      O t_;
+      typename detail::base_type_t<OpX> x_;
+      typename detail::base_type_t<OpXQ> xq_;
+      using x_val_type = typename OpX::value_type;
+
+      constexpr static int RANK = O::Rank();
+      constexpr static int AXIS = RANK - 1;
+      constexpr static int AXIS_X = OpX::Rank() - 1;
+      constexpr static int AXIS_XQ = OpXQ::Rank() - 1;
+
+    public:
+      using matxop = bool;
+
+      InterpSortedTileFillOp(const O& t, const OpX& x, const OpXQ& xq) : t_(t), x_(x), xq_(xq) {}
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        if constexpr (CapType::ept == ElementsPerThread::ONE) {
+          cuda::std::array idx{indices...};
+          const index_t n = x_.Size(AXIS_X);
+          const index_t tile = idx[AXIS];
+
+          if (tile == t_.Size(AXIS) - 1) {
+            t_(indices...) = n - 1;
+            return;
+          }
+
+          cuda::std::array idx_q{idx};
+          idx_q[AXIS] = tile * INTERP_SORTED_TILE;
+          const x_val_type x_query = get_value<CapType>(xq_, idx_q);
+
+          cuda::std::array idx_low{idx};
+          cuda::std::array idx_high{idx};
+          cuda::std::array idx_mid{idx};
+          idx_low[AXIS] = 0;
+          idx_high[AXIS] = n - 1;
+
+          if (x_query < get_value<CapType>(x_, idx_low)) {
+            t_(indices...) = 0;
+          } else if (x_query >= get_value<CapType>(x_, idx_high)) {
+            t_(indices...) = n - 1;
+          } else {
+            while (idx_high[AXIS] - idx_low[AXIS] > 1) {
+              idx_mid[AXIS] = (idx_low[AXIS] + idx_high[AXIS]) / 2;
+              if (x_query < get_value<CapType>(x_, idx_mid)) {
+                idx_high[AXIS] = idx_mid[AXIS];
+              } else {
+                idx_low[AXIS] = idx_mid[AXIS];
+              }
+            }
+            t_(indices...) = idx_low[AXIS];
+          }
+        }
+      }
+
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ void operator()(index_t idx) const
+      {
+        return operator()<DefaultCapabilities>(idx);
+      }
+
+      template <detail::OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType&) const {
+        if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+          const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+          return my_cap;
+        } else {
+          auto self_has_cap = detail::capability_attributes<Cap>::default_value;
+          return self_has_cap;
+        }
+      }
+
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ index_t Size(uint32_t i) const  { return t_.Size(i); }
+      static inline constexpr __host__ __device__ int32_t Rank() { return O::Rank(); }
+    };
+
+
 // NOTE: We force a size of ONE on the vector regardless of the size passed in. This is ok since this is
 // the only path it can take at runtime, but it will get compiler errors without that until this function
 // is updated for vectors
@@ -196,9 +296,12 @@ namespace matx {
       typename detail::base_type_t<OpV> v_;    // Values at sample points
       typename detail::base_type_t<OpXQ> xq_;  // Query points
       InterpMethod method_;                    // Interpolation method
+      InterpSearch search_;                    // Interval search strategy
 
       mutable detail::tensor_impl_t<value_type, OpV::Rank()> m_; // Derivatives at sample points (spline only)
       mutable value_type *ptr_m_ = nullptr;
+      mutable detail::tensor_impl_t<index_t, OpXQ::Rank()> tiles_; // Search window per query tile (sorted search only)
+      mutable index_t *ptr_tiles_ = nullptr;
 
       constexpr static int RANK = OpXQ::Rank();
       constexpr static int AXIS = RANK - 1;
@@ -240,6 +343,21 @@ namespace matx {
           return cuda::std::make_tuple(idx_high, idx_high);
         }
 
+        // Narrow the initial window when the search strategy allows it. Both windows are guaranteed
+        // to contain the interval of an in-range query point, so the bisection below is unchanged.
+        if (search_ == InterpSearch::UNIFORM) {
+          const index_t n = x_.Size(AXIS_X);
+          const index_t guess = static_cast<index_t>((x_query - x_low) / (x_high - x_low) * static_cast<domain_type>(n - 1));
+          idx_low[AXIS] = cuda::std::max(guess - 1, index_t{0});
+          idx_high[AXIS] = cuda::std::min(guess + 2, n - 1);
+        } else if (search_ == InterpSearch::SORTED) {
+          cuda::std::array idx_tile{idx};
+          idx_tile[AXIS] = idx[AXIS] / INTERP_SORTED_TILE;
+          idx_low[AXIS] = get_value<CapType>(tiles_, idx_tile);
+          idx_tile[AXIS]++;
+          idx_high[AXIS] = cuda::std::min(get_value<CapType>(tiles_, idx_tile) + 1, x_.Size(AXIS_X) - 1);
+        }
+
         // Find the interval containing the query point
         while (idx_high[AXIS] - idx_low[AXIS] > 1) {
           idx_mid[AXIS] = (idx_low[AXIS] + idx_high[AXIS]) / 2;
@@ -391,13 +509,15 @@ namespace matx {
     public:
       __MATX_INLINE__ std::string str() const { return "interp1()"; }
 
-      __MATX_INLINE__ Interp1Op(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = InterpMethod::LINEAR) :
+      __MATX_INLINE__ Interp1Op(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = InterpMethod::LINEAR,
+                                InterpSearch search = InterpSearch::BINARY) :
         x_(x),
         v_(v),
         xq_(xq),
-        method_(method)
+        method_(method),
+        search_(search)
       {
-        MATX_LOG_TRACE("{} constructor: method={}", str(), static_cast<int>(method));
+        MATX_LOG_TRACE("{} constructor: method={} search={}", str(), static_cast<int>(method), static_cast<int>(search));
         if (x_.Size(x_.Rank() - 1) != v_.Size(v_.Rank() - 1)) {
           MATX_THROW(matxInvalidSize, "interp1: sample points and values must have the same size in the last dimension");
         }
@@ -470,6 +590,17 @@ namespace matx {
 
           matxFree(ptr_tridiag_);
         }
+
+        // One search window per tile of sorted query points, plus an end sentinel
+        if (search_ == InterpSearch::SORTED) {
+          cuda::std::array<index_t, RANK> tiles_shape;
+          for (int i = 0; i < RANK; i++) {
+            tiles_shape[i] = xq_.Size(i);
+          }
+          tiles_shape[AXIS] = (xq_.Size(AXIS) + INTERP_SORTED_TILE - 1) / INTERP_SORTED_TILE + 1;
+          detail::AllocateTempTensor(tiles_, std::forward<Executor>(ex), tiles_shape, &ptr_tiles_);
+          InterpSortedTileFillOp(tiles_, x_, xq_).run(std::forward<Executor>(ex));
+        }
       }
 
       template <typename ShapeType, typename Executor>
@@ -478,6 +609,9 @@ namespace matx {
         if (method_ == InterpMethod::SPLINE) {
           matxFree(ptr_m_);
         }
+        if (search_ == InterpSearch::SORTED) {
+          detail::FreeTempTensor(ptr_tiles_);
+        }
       }
 
 
@@ -536,14 +670,18 @@ namespace matx {
  *   Query points where to interpolate. All dimensions except the last must be of compatible size with x and v (e.g. x and v can be vectors, and xq can be a matrix).
  * @param method
  *   Interpolation method (LINEAR, NEAREST, NEXT, PREV, SPLINE)
+ * @param search
+ *   Interval search strategy (BINARY, SORTED, UNIFORM). SORTED requires the query points to be sorted in
+ *   ascending order along the last dimension, and UNIFORM requires uniformly spaced sample points.
  * @returns Operator that interpolates values at query points, with the same dimensions as xq.
  */
 template <typename OpX, typename OpV, typename OpXQ>
-auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = InterpMethod::LINEAR) {
+auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = InterpMethod::LINEAR,
+             InterpSearch search = InterpSearch::BINARY) {
   static_assert(OpX::Rank() >= 1, "interp: sample points must be at least 1D");
   static_assert(OpV::Rank() >= OpX::Rank(), "interp: sample values must have at least the same rank as sample points");
   static_assert(OpXQ::Rank() >= OpV::Rank(), "interp: query points must have at least the same rank as sample values");
-  return detail::Interp1Op(x, v, xq, method);
+  return detail::Interp1Op(x, v, xq, method, search);
 }
 
 
@@ -568,10 +706,14 @@ auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = I
  *   Dimension (of xq) along which to interpolate.
  * @param method
  *   Interpolation method (LINEAR, NEAREST, NEXT, PREV, SPLINE)
+ * @param search
+ *   Interval search strategy (BINARY, SORTED, UNIFORM). SORTED requires the query points to be sorted in
+ *   ascending order along the specified dimension, and UNIFORM requires uniformly spaced sample points.
  * @returns Operator that interpolates values at query points, with the same dimensions as xq.
  */
 template <typename OpX, typename OpV, typename OpXQ>
-auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, const int (&axis)[1],InterpMethod method = InterpMethod::LINEAR) {
+auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, const int (&axis)[1], InterpMethod method = InterpMethod::LINEAR,
+             InterpSearch search = InterpSearch::BINARY) {
   static_assert(OpX::Rank() >= 1, "interp: sample points must be at least 1D");
   static_assert(OpV::Rank() >= OpX::Rank(), "interp: sample values must have at least the same rank as sample points");
   static_assert(OpXQ::Rank() >= OpV::Rank(), "interp: query points must have at least the same rank as sample values");
@@ -586,6 +728,6 @@ auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, const int (&axis)[1],In
   auto pxq = permute(xq, xq_perm);
   auto inv_perm = detail::invPermute<OpXQ::Rank()>(xq_perm);
 
-  return permute(detail::Interp1Op(px, pv, pxq, method), inv_perm);
+  return permute(detail::Interp1Op(px, pv, pxq, method, search), inv_perm);
 }
 } // namespace matx
@@ -55,6 +55,7 @@ namespace matx
 
       public:
         using matxop = bool;
+        using kron_op = bool;
         using value_type = typename T1::value_type;
 
 #ifdef MATX_EN_JIT
@@ -118,6 +119,10 @@ namespace matx
           static_assert(RankGTE(Rank(), 2), "Kronecker product must be used on tensors with rank 2 or higher");
         }        
 
+        // Factors of the product, used to lower matmul(kron(a, b), x) without forming the product
+        __MATX_INLINE__ const auto &Left() const noexcept { return op1_; }
+        __MATX_INLINE__ const auto &Right() const noexcept { return op2_; }
+
         template <typename CapType, typename... Is>
         __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
         {
@@ -232,6 +237,9 @@ namespace matx
           }
         }
     };
+
+    template <typename T>
+    inline constexpr bool is_kron_op_v = requires { typename remove_cvref_t<T>::kron_op; };
   }
 
   /**
@@ -241,6 +249,10 @@ namespace matx
    * matrix a. The resulting matrix has the number of rows and columns equal to
    * the product of the rows and columns of matrices a and b, respectively.
    *
+   * When a rank-2 product is the left operand of matmul, the product is never
+   * formed. With each column of x reshaped to an N x Q matrix X, the result is
+   * computed from the factors as a * X * b^T using two GEMMs.
+   *
    * @tparam T1
    *   Type of first input
    * @tparam T2
@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/krylov.h"
+
+namespace matx
+{
+  namespace detail {
+    enum class KrylovMethod {
+      PCG,
+      PIPELINED_CG,
+      BICGSTAB,
+      GMRES,
+    };
+
+    template <typename OpA, typename OpB>
+    class KrylovSolveOp : public BaseOp<KrylovSolveOp<OpA, OpB>>
+    {
+      private:
+        typename detail::base_type_t<OpA> a_;
+        typename detail::base_type_t<OpB> b_;
+        KrylovMethod method_;
+        KrylovPrecond precond_;
+        int restart_;
+        double tol_;
+        int max_iters_;
+        int check_interval_;
+        cuda::std::array<index_t, remove_cvref_t<OpB>::Rank()> out_dims_;
+        mutable detail::tensor_impl_t<typename OpA::value_type, remove_cvref_t<OpB>::Rank()> tmp_out_;
+        mutable typename OpA::value_type *ptr = nullptr;
+        mutable bool prerun_done_ = false;
+
+      public:
+        using matxop = bool;
+        using value_type = typename OpA::value_type;
+        using matx_transform_op = bool;
+        using krylov_xform_op = bool;
+
+        __MATX_INLINE__ std::string str() const {
+          const char *names[] = {"pcgsolve", "pipelined_cgsolve", "bicgstabsolve", "gmressolve"};
+          return std::string(names[static_cast<int>(method_)]) + "(" + get_type_str(a_) + "," + get_type_str(b_) + ")";
+        }
+
+        __MATX_INLINE__ KrylovSolveOp(const OpA &A, const OpB &B, KrylovMethod method, KrylovPrecond precond,
+                                      int restart, double tol, int max_iters, int check_interval) :
+              a_(A), b_(B), method_(method), precond_(precond), restart_(restart), tol_(tol),
+              max_iters_(max_iters), check_interval_(check_interval) {
+          MATX_LOG_TRACE("{} constructor: precond={}, restart={}, tol={}, max_iters={}, check_interval={}",
+                         str(), static_cast<int>(precond), restart, tol, max_iters, check_interval);
+          for (int r = 0; r < Rank(); r++) {
+            out_dims_[r] = b_.Size(r);
+          }
+        }
+
+        __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return tmp_out_.template operator()<CapType>(indices...);
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return this->operator()<DefaultCapabilities>(indices...);
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType &in) const {
+          auto self_has_cap = capability_attributes<Cap>::default_value;
+          return combine_capabilities<Cap>(
+            self_has_cap,
+            detail::get_operator_capability<Cap>(a_, in),
+            detail::get_operator_capability<Cap>(b_, in)
+          );
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return remove_cvref_t<OpB>::Rank();
+        }
+
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+        {
+          return out_dims_[dim];
+        }
+
+        template <typename Out, typename Executor>
+        void Exec(Out &&out, Executor &&ex) const {
+          static_assert(is_cuda_executor_v<Executor>, "Krylov solvers only support the CUDA executor currently");
+          auto &x = cuda::std::get<0>(out);
+          const auto stream = ex.getStream();
+          switch (method_) {
+            case KrylovMethod::PCG:
+              pcgsolve_impl(x, a_, b_, precond_, tol_, max_iters_, stream, check_interval_);
+              break;
+            case KrylovMethod::PIPELINED_CG:
+              pipelined_cgsolve_impl(x, a_, b_, precond_, tol_, max_iters_, stream, check_interval_);
+              break;
+            case KrylovMethod::BICGSTAB:
+              bicgstabsolve_impl(x, a_, b_, precond_, tol_, max_iters_, stream, check_interval_);
+              break;
+            case KrylovMethod::GMRES:
+              gmressolve_impl(x, a_, b_, restart_, precond_, tol_, max_iters_, stream, check_interval_);
+              break;
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpA>()) {
+            a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpB>()) {
+            b_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if (prerun_done_) {
+            return;
+          }
+
+          InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+          prerun_done_ = true;
+          Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpA>()) {
+            a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpB>()) {
+            b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::FreeTempTensor(ptr);
+        }
+    };
+  }
+
+
+  /**
+   * Preconditioned conjugate gradient solve of a Hermitian positive definite system
+   *
+   * The output tensor holds the initial guess on entry. A may be dense or sparse.
+   *
+   * @param A
+   *   Matrix A
+   * @param B
+   *   Right-hand side vector
+   * @param precond
+   *   preconditioner. ILU0 and IC0 require a CSR matrix with 32-bit indices
+   * @param tol
+   *   residual norm to solve to
+   * @param max_iters
+   *   max iterations for solve
+   * @param check_interval
+   *   iterations between host checks for early termination
+   *
+   */
+  template <typename AType, typename BType>
+  __MATX_INLINE__ auto pcgsolve(const AType &A, const BType &B, KrylovPrecond precond,
+                                double tol = 1e-6, int max_iters = 100, int check_interval = 1)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+    return detail::KrylovSolveOp(A, B, detail::KrylovMethod::PCG, precond, 0, tol, max_iters, check_interval);
+  }
+
+  /**
+   * Pipelined preconditioned conjugate gradient solve of a Hermitian positive definite system
+   *
+   * Mathematically equivalent to pcgsolve, but performs a single fused reduction per iteration that
+   * overlaps with the preconditioner and matvec. Preferable when reductions dominate, such as on
+   * many GPUs or for small per-GPU problems.
+   *
+   * @param A
+   *   Matrix A
+   * @param B
+   *   Right-hand side vector
+   * @param precond
+   *   preconditioner
+   * @param tol
+   *   residual norm to solve to
+   * @param max_iters
+   *   max iterations for solve
+   * @param check_interval
+   *   iterations between host checks for early termination
+   *
+   */
+  template <typename AType, typename BType>
+  __MATX_INLINE__ auto pipelined_cgsolve(const AType &A, const BType &B, KrylovPrecond precond = KrylovPrecond::NONE,
+                                         double tol = 1e-6, int max_iters = 100, int check_interval = 1)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+    return detail::KrylovSolveOp(A, B, detail::KrylovMethod::PIPELINED_CG, precond, 0, tol, max_iters, check_interval);
+  }
+
+  /**
+   * Right-preconditioned BiCGStab solve of a general square system
+   *
+   * @param A
+   *   Matrix A
+   * @param B
+   *   Right-hand side vector
+   * @param precond
+   *   preconditioner
+   * @param tol
+   *   residual norm to solve to
+   * @param max_iters
+   *   max iterations for solve
+   * @param check_interval
+   *   iterations between host checks for early termination
+   *
+   */
+  template <typename AType, typename BType>
+  __MATX_INLINE__ auto bicgstabsolve(const AType &A, const BType &B, KrylovPrecond precond = KrylovPrecond::NONE,
+                                     double tol = 1e-6, int max_iters = 100, int check_interval = 1)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+    return detail::KrylovSolveOp(A, B, detail::KrylovMethod::BICGSTAB, precond, 0, tol, max_iters, check_interval);
+  }
+
+  /**
+   * Restarted, right-preconditioned GMRES solve of a general square system
+   *
+   * @param A
+   *   Matrix A
+   * @param B
+   *   Right-hand side vector
+   * @param restart
+   *   Krylov subspace dimension before restarting
+   * @param precond
+   *   preconditioner
+   * @param tol
+   *   residual norm to solve to
+   * @param max_iters
+   *   max total iterations for solve
+   * @param check_interval
+   *   iterations between host checks for early termination
+   *
+   */
+  template <typename AType, typename BType>
+  __MATX_INLINE__ auto gmressolve(const AType &A, const BType &B, int restart = 30,
+                                  KrylovPrecond precond = KrylovPrecond::NONE,
+                                  double tol = 1e-6, int max_iters = 100, int check_interval = 1)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+    return detail::KrylovSolveOp(A, B, detail::KrylovMethod::GMRES, precond, restart, tol, max_iters, check_interval);
+  }
+
+}
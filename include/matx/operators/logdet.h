@@ -0,0 +1,258 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/logdet.h"
+
+namespace matx {
+namespace detail {
+  template<typename OpA>
+  class LogDetOp : public BaseOp<LogDetOp<OpA>>
+  {
+    private:
+      using real_type = typename inner_op_type_t<typename remove_cvref_t<OpA>::value_type>::type;
+
+      typename detail::base_type_t<OpA> a_;
+      LogDetMethod method_;
+      cuda::std::array<index_t, OpA::Rank() - 2> out_dims_;
+      mutable detail::tensor_impl_t<real_type, OpA::Rank() - 2> tmp_out_;
+      mutable real_type *ptr = nullptr;
+      mutable bool prerun_done_ = false;
+
+    public:
+      using matxop = bool;
+      using value_type = real_type;
+      using matx_transform_op = bool;
+      using logdet_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "logdet()"; }
+      __MATX_INLINE__ LogDetOp(const OpA &a, LogDetMethod method) : a_(a), method_(method) {
+        MATX_LOG_TRACE("{} constructor: rank={}, method={}", str(), Rank(), static_cast<int>(method));
+        for (int r = 0; r < Rank(); r++) {
+          out_dims_[r] = a_.Size(r);
+        }
+      }
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        return tmp_out_.template operator()<CapType>(indices...);
+      }
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        return this->operator()<DefaultCapabilities>(indices...);
+      }
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in));
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        logdet_impl(cuda::std::get<0>(out), a_, ex, method_);
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return OpA::Rank() - 2;
+      }
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if (prerun_done_) {
+          return;
+        }
+
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        prerun_done_ = true;
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+  };
+
+  template<typename OpA, typename OpB>
+  class SolveLogDetOp : public BaseOp<SolveLogDetOp<OpA, OpB>>
+  {
+    private:
+      typename detail::base_type_t<OpA> a_;
+      typename detail::base_type_t<OpB> b_;
+      LogDetMethod method_;
+
+    public:
+      using matxop = bool;
+      using value_type = typename OpA::value_type;
+      using matx_transform_op = bool;
+      using solve_logdet_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "solve_logdet()"; }
+      __MATX_INLINE__ SolveLogDetOp(const OpA &a, const OpB &b, LogDetMethod method) : a_(a), b_(b), method_(method) {
+        MATX_LOG_TRACE("{} constructor: method={}", str(), static_cast<int>(method));
+      }
+
+      // This should never be called
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const = delete;
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in),
+                                         detail::get_operator_capability<Cap>(b_, in));
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(is_cuda_executor_v<Executor>, "solve_logdet() only supports the CUDA executor currently");
+        static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 3, "Must use mtie with 2 outputs on solve_logdet(). ie: (mtie(X, ld) = solve_logdet(A, B))");
+
+        solve_logdet_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, b_, ex, method_);
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return OpB::Rank();
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpB>()) {
+          b_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      // Size is not relevant in solve_logdet() since there are multiple return values and it
+      // is not allowed to be called in larger expressions
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return b_.Size(dim);
+      }
+  };
+}
+
+/**
+ * Computes the log-determinant of a matrix from the diagonal of its factorization.
+ *
+ * Unlike log(det(A)), the result stays finite when the determinant itself would overflow
+ * or underflow. With LogDetMethod::CHOLESKY the input must be Hermitian positive definite
+ * and the result is log(det(A)). With LogDetMethod::LU the result is log|det(A)|.
+ *
+ * If rank > 2, operations are batched.
+ *
+ * @tparam OpA
+ *   Data type of input a tensor or operator
+ *
+ * @param a
+ *   Input square tensor or operator of shape `... x n x n`
+ * @param method
+ *   Factorization to use
+ *
+ * @return
+ *   Operator that produces the real log-determinant of shape `...`
+ */
+template<typename OpA>
+__MATX_INLINE__ auto logdet(const OpA &a, LogDetMethod method = LogDetMethod::CHOLESKY) {
+  return detail::LogDetOp(a, method);
+}
+
+/**
+ * Solves A X^T = B^T and computes the log-determinant of A with a single factorization.
+ *
+ * This is the pair needed by a Gaussian log-likelihood. As with solve(), each right-hand
+ * side is one row of B. Only CUDA executors are supported.
+ *
+ * @tparam OpA
+ *   Data type of input a tensor or operator
+ * @tparam OpB
+ *   Data type of input b tensor or operator
+ *
+ * @param a
+ *   Rank-2 square matrix A
+ * @param b
+ *   Rank-1 right-hand side, or rank-2 with one right-hand side per row
+ * @param method
+ *   Factorization to use
+ *
+ * @return
+ *   Operator that produces the solution, of the shape of B, and the rank-0 real
+ *   log-determinant. Use with `mtie()`.
+ */
+template<typename OpA, typename OpB>
+__MATX_INLINE__ auto solve_logdet(const OpA &a, const OpB &b, LogDetMethod method = LogDetMethod::CHOLESKY) {
+  return detail::SolveLogDetOp(a, b, method);
+}
+
+}
@@ -0,0 +1,203 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/operators/pinv.h"
+#include "matx/transforms/pinv.h"
+
+namespace matx {
+namespace detail {
+
+template <typename OpA, typename OpB>
+class LstsqOp : public BaseOp<LstsqOp<OpA, OpB>> {
+private:
+  typename detail::base_type_t<OpA> a_;
+  typename detail::base_type_t<OpB> b_;
+  float rcond_;
+  PinvMethod method_;
+
+  static constexpr int out_rank = OpB::Rank();
+  cuda::std::array<index_t, out_rank> out_dims_;
+  mutable ::matx::detail::tensor_impl_t<typename OpA::value_type, out_rank> tmp_out_;
+  mutable typename OpA::value_type *ptr = nullptr;
+  mutable bool prerun_done_ = false;
+
+public:
+  using matxop = bool;
+  using matx_transform_op = bool;
+  using lstsq_xform_op = bool;
+  using value_type = typename OpA::value_type;
+
+  __MATX_INLINE__ LstsqOp(const OpA &a, const OpB &b, float rcond, PinvMethod method)
+      : a_(a), b_(b), rcond_(rcond), method_(method) {
+    MATX_LOG_TRACE("{} constructor: rank={}, method={}", str(), Rank(), static_cast<int>(method));
+    for (int r = 0, rank = Rank(); r < rank; r++) {
+      out_dims_[r] = b_.Size(r);
+    }
+    out_dims_[Rank() - 1] = a_.Size(OpA::Rank() - 1);
+  }
+
+  __MATX_INLINE__ std::string str() const {
+    return "lstsq(" + get_type_str(a_) + "," + get_type_str(b_) + ")";
+  }
+
+  __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+  template <typename CapType, typename... Is>
+  __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto)
+  operator()(Is... indices) const {
+    return tmp_out_.template operator()<CapType>(indices...);
+  }
+
+  template <typename... Is>
+  __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto)
+  operator()(Is... indices) const {
+    return this->operator()<DefaultCapabilities>(indices...);
+  }
+
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType &in) const {
+    auto self_has_cap = capability_attributes<Cap>::default_value;
+    return combine_capabilities<Cap>(self_has_cap,
+                                       detail::get_operator_capability<Cap>(a_, in),
+                                       detail::get_operator_capability<Cap>(b_, in));
+  }
+
+  static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t
+  Rank() {
+    return remove_cvref_t<OpB>::Rank();
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t
+  Size(int dim) const {
+    return out_dims_[dim];
+  }
+
+  template <typename Out, typename Executor>
+  void Exec([[maybe_unused]] Out &&out, [[maybe_unused]] Executor &&ex) const {
+    if constexpr (is_cuda_non_jit_executor_v<Executor>) {
+      lstsq_impl(cuda::std::get<0>(out), a_, b_, ex, rcond_, method_);
+    } else {
+      MATX_THROW(matxNotSupported, "lstsq() currently only supports CUDA executors");
+    }
+  }
+
+  template <typename ShapeType, typename Executor>
+  __MATX_INLINE__ void
+  InnerPreRun([[maybe_unused]] ShapeType &&shape,
+              [[maybe_unused]] Executor &&ex) const noexcept {
+    if constexpr (is_matx_op<OpA>()) {
+      a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    }
+    if constexpr (is_matx_op<OpB>()) {
+      b_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    }
+  }
+
+  template <typename ShapeType, typename Executor>
+  __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape,
+                              [[maybe_unused]] Executor &&ex) const noexcept {
+    if (prerun_done_) {
+      return;
+    }
+
+    InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_,
+                               &ptr);
+    prerun_done_ = true;
+    Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+    InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+  }
+
+  template <typename ShapeType, typename Executor>
+  __MATX_INLINE__ void
+  InnerPostRun([[maybe_unused]] ShapeType &&shape,
+               [[maybe_unused]] Executor &&ex) const noexcept {
+    if constexpr (is_matx_op<OpA>()) {
+      a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    }
+    if constexpr (is_matx_op<OpB>()) {
+      b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    }
+  }
+
+  template <typename ShapeType, typename Executor>
+  __MATX_INLINE__ void PostRun([[maybe_unused]] ShapeType &&shape,
+                               [[maybe_unused]] Executor &&ex) const noexcept {
+    InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    detail::FreeTempTensor(ptr);
+  }
+};
+
+} // end namespace detail
+
+/**
+ * Running X = lstsq(A, B) finds the X minimizing the residual of
+ * A X^T = B^T for a tall or square dense matrix A, without forming
+ * the pseudo-inverse. As with solve(), each right-hand side and
+ * solution is one row of B and X.
+ *
+ * With PinvMethod::AUTO or PinvMethod::QR, A is factored with QR and
+ * R x = Q^H b is solved by back substitution. PinvMethod::CHOLESKY
+ * solves the normal equations A^H A x = A^H b, which is cheapest but
+ * loses accuracy with cond(A)^2. Cholesky falls back to QR when A is
+ * too badly conditioned, and QR falls back to the SVD, which gives the
+ * minimum-norm solution, when A is rank deficient.
+ *
+ * @tparam OpA
+ *    Data type of A tensor
+ * @tparam OpB
+ *    Data type of B tensor
+ *
+ * @param A
+ *   Rank-2 m x n matrix with m >= n
+ * @param B
+ *   Rank-1 right-hand side of size m, or rank-2 with one right-hand side per row
+ * @param method
+ *   Factorization to use
+ * @param rcond
+ *   Cutoff for small singular values, relative to the largest
+ *
+ * @return
+ *   Operator that produces X, of size n or nrhs x n
+ */
+template <typename OpA, typename OpB>
+__MATX_INLINE__ auto lstsq(const OpA &A, const OpB &B, PinvMethod method = PinvMethod::AUTO,
+                           float rcond = get_default_rcond<typename OpA::value_type>()) {
+  return detail::LstsqOp(A, B, rcond, method);
+}
+
+} // end namespace matx
@@ -35,9 +35,12 @@
 
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
+#include "matx/operators/kronecker.h"
 #include "matx/core/operator_options.h"
 #include "matx/core/log.h"
 #include "matx/transforms/matmul/matmul_cuda.h"
+#include "matx/transforms/matmul/matmul_grouped.h"
+#include "matx/transforms/matmul/matmul_kron.h"
 #include "matx/transforms/matmul/matmul_cusparse.h"
 #ifdef MATX_EN_CPU_MATMUL
   #include "matx/transforms/matmul/matmul_cblas.h"
@@ -51,8 +54,8 @@
 namespace matx
 {
   namespace detail {
-    template <typename OpA, typename OpB, typename PermDims>
-    class MatMulOp : public BaseOp<MatMulOp<OpA, OpB, PermDims>>
+    template <typename OpA, typename OpB, typename PermDims, typename BiasOp = matmul_no_bias_t>
+    class MatMulOp : public BaseOp<MatMulOp<OpA, OpB, PermDims, BiasOp>>
     {
       private:
         typename detail::base_type_t<OpA> a_;
@@ -60,6 +63,8 @@ namespace matx
         float alpha_;
         float beta_;
         PermDims perm_; 
+        MatMulEpilogue_t epilogue_ = MatMulEpilogue_t::NONE;
+        typename detail::base_type_t<BiasOp> bias_;
         static constexpr int out_rank = cuda::std::max(OpA::Rank(), OpB::Rank());
         cuda::std::array<index_t, out_rank> out_dims_;
         // This should be tensor_impl_t, but need to work around issues with temp types returned in matmul
@@ -75,6 +80,7 @@ namespace matx
         using value_type = typename OpA::value_type;
         using matx_transform_op = bool;
         using matmul_xform_op = bool;
+        using tosparse_xform_op = bool; // sparse x sparse into a sparse output
 
         __MATX_INLINE__ std::string str() const { 
             return "matmul(" + get_type_str(a_) + "," + get_type_str(b_) + ")";
@@ -130,7 +136,7 @@ namespace matx
                  "  template <typename CapType, typename... Is>\n" +
                  "  __MATX_INLINE__ __MATX_DEVICE__ decltype(auto) operator()(Is... indices) const\n" +
                  "  {\n" +
-                 "    " + dx_gemm_helper_.GetFuncStr(gemm_func_name, alpha_, beta_) + "\n" +
+                 "    " + dx_gemm_helper_.GetFuncStr(gemm_func_name, alpha_, beta_, Rank(), OpA::Rank(), OpB::Rank()) + "\n" +
                  "  }\n" +
                  "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank()\n" +
                  "  {\n" +
@@ -192,6 +198,13 @@ namespace matx
 #endif
         }
 
+        __MATX_INLINE__ MatMulOp(const OpA &a, const OpB &b, float alpha, float beta, PermDims perm,
+                                 MatMulEpilogue_t epilogue, const BiasOp &bias) :
+              MatMulOp(a, b, alpha, beta, perm) {
+          epilogue_ = epilogue;
+          bias_ = bias;
+        }
+
         template <typename CapType, typename... Is>
         __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
         {
@@ -231,7 +244,9 @@ namespace matx
           }
           else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
             bool supported = dx_gemm_helper_.template CheckJITSizeAndTypeRequirements<OpA, OpB>() && 
-                             dx_gemm_helper_.IsSupported();
+                             dx_gemm_helper_.IsSupported() && epilogue_ == MatMulEpilogue_t::NONE &&
+                             std::is_same_v<PermDims, no_permute_t> && Rank() <= 4 &&
+                             OpA::Rank() >= 2 && OpB::Rank() >= 2;
 
             auto result = combine_capabilities<Cap>(supported, 
                                                     detail::get_operator_capability<Cap>(a_, in),
@@ -344,21 +359,45 @@ namespace matx
 
         template <typename Out, typename Executor>
         void Exec(Out &&out, Executor &&ex) const {
-          // Perform SpMM or otherwise GEMM.
-          static_assert(!is_sparse_tensor_v<OpB>, "sparse rhs not implemented");
-          if constexpr (is_sparse_tensor_v<OpA>) {
+          // Perform SpGEMM, SpMM, or otherwise GEMM.
+          if constexpr (is_sparse_tensor_v<remove_cvref_t<Out>>) {
+            // NOTE: sparse assignment C = matmul(A, B) takes direct reference!
+            static_assert(is_sparse_tensor_v<OpA> && is_sparse_tensor_v<OpB>,
+                          "a sparse matmul output requires sparse A and B");
+            static_assert(is_cuda_executor_v<Executor>, "SpGEMM only supports the CUDA executor");
+            MATX_ASSERT_STR(epilogue_ == MatMulEpilogue_t::NONE, matxNotSupported,
+                            "SpGEMM does not support epilogues");
+            sparse_spgemm_impl(out, a_, b_, ex, alpha_, beta_);
+          }
+          else if constexpr (is_sparse_tensor_v<OpB>) {
+            static_assert(!is_sparse_tensor_v<OpB>, "sparse rhs with dense output not implemented");
+          }
+          else if constexpr (is_sparse_tensor_v<OpA>) {
             if constexpr (!std::is_same_v<PermDims, no_permute_t>) {
               sparse_matmul_impl(permute(cuda::std::get<0>(out), perm_), a_, b_, ex, alpha_, beta_);
             }
             else {
               sparse_matmul_impl(cuda::std::get<0>(out), a_, b_, ex, alpha_, beta_);
             }
+            apply_matmul_epilogue(cuda::std::get<0>(out), bias_, epilogue_, ex);
           }
           else if constexpr (!std::is_same_v<PermDims, no_permute_t>) {
+            // The bias is indexed by output row, so permuted outputs apply the epilogue separately
             matmul_impl(permute(cuda::std::get<0>(out), perm_), a_, b_, ex, alpha_, beta_);
+            auto out_perm = permute(cuda::std::get<0>(out), perm_);
+            apply_matmul_epilogue(out_perm, bias_, epilogue_, ex);
+          }
+          else if constexpr (is_kron_op_v<OpA> && OpA::Rank() == 2 && OpB::Rank() == 2) {
+            // Multiply by the factors instead of materializing the Kronecker product
+            kron_matmul_impl(cuda::std::get<0>(out), a_.Left(), a_.Right(), b_, ex, alpha_, beta_);
+            apply_matmul_epilogue(cuda::std::get<0>(out), bias_, epilogue_, ex);
+          }
+          else if constexpr (is_cuda_executor_v<Executor>) {
+            matmul_impl(cuda::std::get<0>(out), a_, b_, ex, alpha_, beta_, epilogue_, bias_);
           }
           else {
             matmul_impl(cuda::std::get<0>(out), a_, b_, ex, alpha_, beta_);
+            apply_matmul_epilogue(cuda::std::get<0>(out), bias_, epilogue_, ex);
           }
         }
 
@@ -372,6 +411,10 @@ namespace matx
           if constexpr (is_matx_op<OpB>()) {
             b_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }           
+
+          if constexpr (is_matx_op<BiasOp>()) {
+            bias_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
         }      
 
         template <typename ShapeType, typename Executor>
@@ -387,10 +430,11 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
@@ -400,7 +444,17 @@ namespace matx
             b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
 
-          matxFree(ptr);         
+          if constexpr (is_matx_op<BiasOp>()) {
+            bias_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::FreeTempTensor(ptr);
         }
     };
   }
@@ -476,4 +530,72 @@ namespace matx
 
     return detail::MatMulOp(in1, in2, alpha, beta, perm);
   }  
+
+  /**
+   * Run a GEMM followed by an element-wise epilogue
+   *
+   * Computes `epilogue(alpha * A * B + beta * C + bias)`. With the cuBLASLt provider the
+   * epilogue is fused into the GEMM kernel when the type and layout allow it, which avoids a
+   * second pass over C. The bias must then be a contiguous tensor of the output type; any other
+   * bias operator, or a provider without epilogue support, falls back to a separate pass.
+   *
+   * @tparam OpA
+   *    Data type of A tensor or operator
+   * @tparam OpB
+   *    Data type of B tensor or operator
+   * @tparam BiasOp
+   *    Data type of the bias tensor or operator
+   *
+   * @param A
+   *   A Tensor or Operator of shape `... x m x k`
+   * @param B
+   *   B Tensor or Operator of shape `... x k x n`
+   * @param epilogue
+   *   Epilogue to apply to the output
+   * @param bias
+   *   Rank-1 bias of length `m`, broadcast across the columns of C
+   * @param alpha
+   *   Scalar multiplier to apply to operator A
+   * @param beta
+   *   Scalar multiplier to apply to operator C on input
+   * 
+   * @return 
+   *   Operator that produces the output tensor C of shape `... x m x n`
+   */
+  template<typename OpA, typename OpB, typename BiasOp>
+  __MATX_INLINE__ auto matmul(const OpA &A, const OpB &B, MatMulEpilogue_t epilogue, const BiasOp &bias,
+                              float alpha = 1.0, float beta = 0.0) {
+    MATX_STATIC_ASSERT(BiasOp::Rank() == 1, "matmul: bias must be rank 1");
+    return detail::MatMulOp(A, B, alpha, beta, detail::no_permute_t{}, epilogue, bias);
+  }
+
+  /**
+   * Run a GEMM followed by an element-wise epilogue without a bias
+   *
+   * @tparam OpA
+   *    Data type of A tensor or operator
+   * @tparam OpB
+   *    Data type of B tensor or operator
+   *
+   * @param A
+   *   A Tensor or Operator of shape `... x m x k`
+   * @param B
+   *   B Tensor or Operator of shape `... x k x n`
+   * @param epilogue
+   *   Epilogue to apply to the output. Must not be one of the bias epilogues.
+   * @param alpha
+   *   Scalar multiplier to apply to operator A
+   * @param beta
+   *   Scalar multiplier to apply to operator C on input
+   * 
+   * @return 
+   *   Operator that produces the output tensor C of shape `... x m x n`
+   */
+  template<typename OpA, typename OpB>
+  __MATX_INLINE__ auto matmul(const OpA &A, const OpB &B, MatMulEpilogue_t epilogue,
+                              float alpha = 1.0, float beta = 0.0) {
+    MATX_ASSERT_STR(!detail::MatMulEpilogueHasBias(epilogue), matxInvalidParameter,
+        "matmul: bias epilogue requires a bias operator");
+    return detail::MatMulOp(A, B, alpha, beta, detail::no_permute_t{}, epilogue, detail::matmul_no_bias_t{});
+  }
 }
@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND argmin EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR argmin DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON argmin THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN argmin WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/matmul/matmul_scaled.h"
+
+namespace matx
+{
+  namespace detail {
+    template <typename OpA, typename OpB, typename ScaleA, typename ScaleB, typename OutType, bool AMAX>
+    class MatMulScaledOp : public BaseOp<MatMulScaledOp<OpA, OpB, ScaleA, ScaleB, OutType, AMAX>>
+    {
+      private:
+        typename detail::base_type_t<OpA> a_;
+        typename detail::base_type_t<OpB> b_;
+        typename detail::base_type_t<ScaleA> scale_a_;
+        typename detail::base_type_t<ScaleB> scale_b_;
+        cuda::std::array<index_t, 2> out_dims_;
+        mutable detail::tensor_impl_t<OutType, 2> tmp_out_;
+        mutable OutType *ptr = nullptr;
+        mutable bool prerun_done_ = false;
+
+      public:
+        using matxop = bool;
+        using value_type = OutType;
+        using matx_transform_op = bool;
+        using matmul_scaled_xform_op = bool;
+
+        __MATX_INLINE__ std::string str() const {
+          return "matmul_scaled(" + get_type_str(a_) + "," + get_type_str(b_) + ")";
+        }
+
+        __MATX_INLINE__ MatMulScaledOp(const OpA &a, const OpB &b, const ScaleA &scale_a, const ScaleB &scale_b) :
+              a_(a), b_(b), scale_a_(scale_a), scale_b_(scale_b) {
+          MATX_LOG_TRACE("{} constructor", str());
+          out_dims_[0] = a_.Size(0);
+          out_dims_[1] = b_.Size(1);
+        }
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          static_assert(!AMAX, "matmul_scaled_amax() has multiple outputs and cannot be used in an expression");
+          return tmp_out_.template operator()<CapType>(indices...);
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return this->operator()<DefaultCapabilities>(indices...);
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+          if constexpr (Cap == OperatorCapability::ALIASED_MEMORY) {
+            auto in_copy = in;
+            in_copy.permutes_input_output = true;
+            return combine_capabilities<Cap>(detail::get_operator_capability<Cap>(a_, in_copy),
+                                             detail::get_operator_capability<Cap>(b_, in_copy),
+                                             detail::get_operator_capability<Cap>(scale_a_, in_copy),
+                                             detail::get_operator_capability<Cap>(scale_b_, in_copy));
+          }
+          else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+            return false;
+          }
+          else if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
+            return "";
+          }
+          else {
+            auto self_has_cap = capability_attributes<Cap>::default_value;
+            return combine_capabilities<Cap>(self_has_cap,
+                                             detail::get_operator_capability<Cap>(a_, in),
+                                             detail::get_operator_capability<Cap>(b_, in),
+                                             detail::get_operator_capability<Cap>(scale_a_, in),
+                                             detail::get_operator_capability<Cap>(scale_b_, in));
+          }
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return 2;
+        }
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+        {
+          return out_dims_[dim];
+        }
+
+        __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+        template <typename Out, typename Executor>
+        void Exec(Out &&out, Executor &&ex) const {
+          static_assert(is_cuda_executor_v<Executor>, "matmul_scaled() only supports the CUDA executor");
+          if constexpr (AMAX) {
+            static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 3,
+                "Must use mtie with 2 outputs on matmul_scaled_amax(). ie: (mtie(C, amax) = matmul_scaled_amax(A, B, sa, sb))");
+            static_assert(remove_cvref_t<decltype(cuda::std::get<1>(out))>::Rank() == 0, "amax output must be rank 0");
+          }
+
+          auto c = cuda::std::get<0>(out);
+          matmul_scaled_impl(c, a_, b_, scale_a_, scale_b_, ex);
+
+          if constexpr (AMAX) {
+            // amax of the scaled output is what the next layer needs to pick its FP8 scale
+            auto amax = cuda::std::get<1>(out);
+            (amax = matx::max(matx::abs(as_type<float>(c)))).run(ex);
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpA>()) {
+            a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpB>()) {
+            b_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<ScaleA>()) {
+            scale_a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<ScaleB>()) {
+            scale_b_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if (prerun_done_) {
+            return;
+          }
+
+          InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          // With mtie the outputs are supplied directly, so there is nothing to stage
+          if constexpr (!AMAX) {
+            detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+            prerun_done_ = true;
+            Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+            InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpA>()) {
+            a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpB>()) {
+            b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<ScaleA>()) {
+            scale_a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<ScaleB>()) {
+            scale_b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          if constexpr (!AMAX) {
+            detail::FreeTempTensor(ptr);
+          }
+        }
+    };
+  }
+
+
+  /**
+   * Run an FP8 or INT8 GEMM with scale factors
+   *
+   * Computes `C(i,j) = scale_a(i) * scale_b(j) * sum_k A(i,k) * B(k,j)`. A and B must both be FP8
+   * (matxFp8E4M3/matxFp8E5M2, not both E5M2) or both int8. Scales are rank 0 for per-tensor
+   * scaling, or rank 1 for per-channel scaling with one value per row of A or per column of B.
+   * Accumulation is in fp32 for FP8 and int32 for INT8. Per-tensor FP8 scales are applied inside
+   * cuBLASLt; per-channel scales and INT8 apply the scales in one pass after the GEMM.
+   *
+   * B is read in place when it is column-major, such as the transpose of an `n x k` weight
+   * tensor. Other layouts are transposed into a temporary first.
+   *
+   * @tparam OutType
+   *    Output type. Defaults to float.
+   * @tparam OpA
+   *    Data type of A tensor or operator
+   * @tparam OpB
+   *    Data type of B tensor or operator
+   * @tparam ScaleA
+   *    Data type of A's scale
+   * @tparam ScaleB
+   *    Data type of B's scale
+   *
+   * @param A
+   *   A Tensor or Operator of shape `m x k`
+   * @param B
+   *   B Tensor or Operator of shape `k x n`
+   * @param scale_a
+   *   Rank-0 or length-`m` scale for A
+   * @param scale_b
+   *   Rank-0 or length-`n` scale for B
+   *
+   * @return
+   *   Operator that produces the output tensor C of shape `m x n`
+   */
+  template<typename OutType = float, typename OpA, typename OpB, typename ScaleA, typename ScaleB>
+  __MATX_INLINE__ auto matmul_scaled(const OpA &A, const OpB &B, const ScaleA &scale_a, const ScaleB &scale_b) {
+    return detail::MatMulScaledOp<OpA, OpB, ScaleA, ScaleB, OutType, false>(A, B, scale_a, scale_b);
+  }
+
+  /**
+   * Run an FP8 or INT8 GEMM with scale factors and report the output's absolute maximum
+   *
+   * Same as matmul_scaled(), but also writes `max(abs(C))` to a rank-0 output, which is what
+   * delayed-scaling FP8 pipelines use to choose the next scale factor. Must be used with mtie:
+   * `(mtie(C, amax) = matmul_scaled_amax(A, B, scale_a, scale_b)).run(exec)`.
+   *
+   * @tparam OutType
+   *    Output type. Defaults to float.
+   * @tparam OpA
+   *    Data type of A tensor or operator
+   * @tparam OpB
+   *    Data type of B tensor or operator
+   * @tparam ScaleA
+   *    Data type of A's scale
+   * @tparam ScaleB
+   *    Data type of B's scale
+   *
+   * @param A
+   *   A Tensor or Operator of shape `m x k`
+   * @param B
+   *   B Tensor or Operator of shape `k x n`
+   * @param scale_a
+   *   Rank-0 or length-`m` scale for A
+   * @param scale_b
+   *   Rank-0 or length-`n` scale for B
+   *
+   * @return
+   *   Operator producing C of shape `m x n` and its absolute maximum
+   */
+  template<typename OutType = float, typename OpA, typename OpB, typename ScaleA, typename ScaleB>
+  __MATX_INLINE__ auto matmul_scaled_amax(const OpA &A, const OpB &B, const ScaleA &scale_a, const ScaleB &scale_b) {
+    return detail::MatMulScaledOp<OpA, OpB, ScaleA, ScaleB, OutType, true>(A, B, scale_a, scale_b);
+  }
+}
@@ -71,6 +71,12 @@ namespace matx
           for (int r = 0; r < Rank(); r++) {
             out_dims_[r] = a_.Size(r);
           }
+          // A uniform batch of sparse matrices yields stacked vectors.
+          if constexpr (is_sparse_tensor_v<OpA>) {
+            if constexpr (remove_cvref_t<OpA>::Format::isBatchedDIAIUniform()) {
+              out_dims_[0] = a_.Size(0) * a_.Size(1);
+            }
+          }
         }
 
         template <typename CapType, typename... Is>
@@ -140,20 +146,27 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-          }     
+          }
 
           if constexpr (is_matx_op<OpB>()) {
             b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-          } 
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr);
         }           
     };
   }
@@ -189,7 +202,7 @@ namespace matx
   __MATX_INLINE__ auto matvec(const OpA &A, const OpB &B,
               float alpha = 1.0, float beta = 0.0)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     return detail::MatVecOp(A, B, alpha, beta);
   }
 
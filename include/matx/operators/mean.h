@@ -50,7 +50,8 @@ namespace detail {
       cuda::std::array<index_t, ORank> out_dims_;
       mutable detail::tensor_impl_t<typename remove_cvref_t<OpA>::value_type, ORank> tmp_out_;
       mutable typename remove_cvref_t<OpA>::value_type *ptr = nullptr;
-      mutable bool prerun_done_ = false;     
+      mutable bool prerun_done_ = false;
+      SumAccuracy accuracy_;
 
     public:
       using matxop = bool;
@@ -59,7 +60,7 @@ namespace detail {
       using mean_xform_op = bool;
 
       __MATX_INLINE__ std::string str() const { return "mean(" + get_type_str(a_) + ")"; }
-      __MATX_INLINE__ MeanOp(const OpA &a) : a_(a) { 
+      __MATX_INLINE__ MeanOp(const OpA &a, SumAccuracy accuracy = SumAccuracy::DEFAULT) : a_(a), accuracy_(accuracy) { 
         MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
         for (int r = 0; r < ORank; r++) {
           out_dims_[r] = a_.Size(r);
@@ -86,7 +87,7 @@ namespace detail {
 
       template <typename Out, typename Executor>
       void Exec(Out &&out, Executor &&ex) const {
-        mean_impl(cuda::std::get<0>(out), a_, ex);
+        mean_impl(cuda::std::get<0>(out), a_, ex, accuracy_);
       }
 
       static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
@@ -115,16 +116,23 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }             
 
       constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
@@ -187,4 +195,51 @@ __MATX_INLINE__ auto mean(const InType &in)
   return detail::MeanOp<decltype(in), 0>(in);
 }
 
+/**
+ * Calculate the mean of values in an operator along axes with a chosen accumulation
+ *
+ * With SumAccuracy::COMPENSATED, float and complex<float> inputs are summed as float-float pairs
+ * and divided by the count before rounding back to float. Other input types ignore the setting.
+ *
+ * @tparam InType
+ *   Input data type
+ * @tparam D
+ *   Num of dimensions to reduce over
+ *
+ * @param in
+ *   Input data to reduce
+ * @param dims
+ *   Array containing dimensions to reduce over
+ * @param accuracy
+ *   Accumulation to use
+ * @returns Operator with reduced values of mean-reduce computed
+ */
+template <typename InType, int D>
+__MATX_INLINE__ auto mean(const InType &in, const int (&dims)[D], SumAccuracy accuracy)
+{
+  static_assert(D < InType::Rank(), "reduction dimensions must be <= Rank of input");
+  auto perm = detail::getPermuteDims<InType::Rank()>(dims);
+  auto permop = permute(in, perm);
+
+  return detail::MeanOp<decltype(permop), InType::Rank() - D>(permop, accuracy);
+}
+
+/**
+ * Calculate the mean of all values in an operator with a chosen accumulation
+ *
+ * @tparam InType
+ *   Input data type
+ *
+ * @param in
+ *   Input data to reduce
+ * @param accuracy
+ *   Accumulation to use
+ * @returns Operator with reduced values of mean-reduce computed
+ */
+template <typename InType>
+__MATX_INLINE__ auto mean(const InType &in, SumAccuracy accuracy)
+{
+  return detail::MeanOp<decltype(in), 0>(in, accuracy);
+}
+
 }
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/mvdr.h"
+
+namespace matx
+{
+
+namespace detail {
+  template<typename OpX, typename OpV>
+  class MvdrOp : public BaseOp<MvdrOp<OpX, OpV>>
+  {
+    private:
+      using out_t = typename remove_cvref_t<OpX>::value_type;
+      using load_t = typename detail::inner_op_type_t<out_t>::type;
+      static constexpr int RANK = OpX::Rank();
+
+      typename detail::base_type_t<OpX> x_;
+      typename detail::base_type_t<OpV> v_;
+      load_t load_;
+      cuda::std::array<index_t, RANK> out_dims_;
+      mutable detail::tensor_impl_t<out_t, RANK> tmp_out_;
+      mutable out_t *ptr = nullptr;
+
+    public:
+      using matxop = bool;
+      using value_type = out_t;
+      using matx_transform_op = bool;
+      using mvdr_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "mvdr(" + get_type_str(x_) + "," + get_type_str(v_) + ")"; }
+      __MATX_INLINE__ MvdrOp(const OpX &x, const OpV &v, load_t load) : x_(x), v_(v), load_(load) {
+        MATX_LOG_TRACE("{} constructor: load={}", str(), load);
+        for (int r = 0; r < RANK - 1; r++) {
+          out_dims_[r] = x_.Size(r);
+        }
+        out_dims_[RANK - 1] = v_.Size(OpV::Rank() - 1);
+      }
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        return tmp_out_.template operator()<CapType>(indices...);
+      }
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        return tmp_out_.template operator()<DefaultCapabilities>(indices...);
+      }
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(x_, in), detail::get_operator_capability<Cap>(v_, in));
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return RANK;
+      }
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(is_cuda_executor_v<Executor>, "mvdr() only supports the CUDA executor currently");
+        mvdr_impl(cuda::std::get<0>(out), x_, v_, load_, ex);
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpX>()) {
+          x_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        if constexpr (is_matx_op<OpV>()) {
+          v_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpX>()) {
+          x_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        if constexpr (is_matx_op<OpV>()) {
+          v_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+  };
+}
+
+/**
+ * Minimum variance distortionless response (MVDR) beamforming weights
+ *
+ * Computes `w = R^-1 v / (v^H R^-1 v)` for every beam, where `R = x x^H / K + load * I` is the diagonally loaded
+ * sample covariance of K snapshots. The covariance is built with a Hermitian rank-k update, which takes half the
+ * flops of a full matrix product, and is factored with a batched Cholesky decomposition instead of being inverted.
+ * If the inputs are rank 3, the outer dimension is a batch of independent problems.
+ *
+ * @tparam OpX
+ *   Type of snapshot operator
+ * @tparam OpV
+ *   Type of steering vector operator
+ *
+ * @param x
+ *   Snapshots of shape `[batch] x elements x snapshots`. Only complex float and complex double are supported.
+ * @param v
+ *   Steering vectors of shape `[batch] x elements x beams`. A rank 2 operator is shared by every batch.
+ * @param load
+ *   Diagonal loading added to the sample covariance
+ *
+ * @return
+ *   Operator that produces the weights of shape `[batch] x elements x beams`
+ */
+template<typename OpX, typename OpV>
+__MATX_INLINE__ auto mvdr(const OpX &x, const OpV &v,
+                          typename detail::inner_op_type_t<typename OpX::value_type>::type load) {
+  static_assert(OpX::Rank() == 2 || OpX::Rank() == 3, "mvdr() snapshots must be rank 2 or 3");
+  return detail::MvdrOp<OpX, OpV>(x, v, load);
+}
+
+}
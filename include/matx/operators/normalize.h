@@ -141,16 +141,23 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             op_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr);
         }
     };
   } // end namespace detail
@@ -167,7 +174,7 @@ namespace matx
    */
   template<int DIM=-1, typename OpA>
   __MATX_INLINE__ auto normalize(const OpA &op, const NORMALIZE_RANGE normalize_method) {
-    MATX_NVTX_START("normalize(" + get_type_str(op) + ")", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("normalize(" + get_type_str(op) + ")", matx::MATX_NVTX_LOG_API)
     return detail::NormalizeOp<OpA, DIM>(op, normalize_method);
   }
 
@@ -184,7 +191,7 @@ namespace matx
    */
   template<int DIM=-1, typename OpA>
   __MATX_INLINE__ auto normalize(const OpA &op, const NORMALIZE_RANGE normalize_method, const float p) {
-    MATX_NVTX_START("normalize(" + get_type_str(op) + ")", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("normalize(" + get_type_str(op) + ")", matx::MATX_NVTX_LOG_API)
     return detail::NormalizeOp<OpA, DIM>(op, normalize_method, p);
   }
 
@@ -202,7 +209,7 @@ namespace matx
    */
   template<int DIM=-1, typename OpA>
   __MATX_INLINE__ auto normalize(const OpA &op, const NORMALIZE_RANGE normalize_method, const float a, const float b) {
-    MATX_NVTX_START("normalize(" + get_type_str(op) + ")", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("normalize(" + get_type_str(op) + ")", matx::MATX_NVTX_LOG_API)
     return detail::NormalizeOp<OpA, DIM>(op, normalize_method, a, b);
   }
 }
\ No newline at end of file
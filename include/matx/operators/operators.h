@@ -42,6 +42,7 @@
 #include "matx/operators/concat.h"
 #include "matx/operators/constval.h"
 #include "matx/operators/cast.h"
+#include "matx/operators/cfar.h"
 #include "matx/operators/channelize_poly.h"
 #include "matx/operators/chol.h"
 #include "matx/operators/clone.h"
@@ -52,6 +53,7 @@
 #include "matx/operators/cov.h"
 #include "matx/operators/cross.h"
 #include "matx/operators/cumsum.h"
+#include "matx/operators/scan.h"
 #include "matx/operators/dense2sparse.h"
 #include "matx/operators/diag.h"
 #include "matx/operators/dct.h"
@@ -60,10 +62,13 @@
 #include "matx/operators/einsum.h"
 #include "matx/operators/find.h"
 #include "matx/operators/find_idx.h"
+#include "matx/operators/find_gather.h"
+#include "matx/operators/fast_math.h"
 #include "matx/operators/fft.h"
 #include "matx/operators/fftshift.h"
 #include "matx/operators/filter.h"
 #include "matx/operators/find_peaks.h"
+#include "matx/operators/first_n.h"
 #include "matx/operators/flatten.h"
 #include "matx/operators/frexp.h"
 #include "matx/operators/hermitian.h"
@@ -76,16 +81,21 @@
 #include "matx/operators/isclose.h"
 #include "matx/operators/inverse.h"
 #include "matx/operators/kronecker.h"
+#include "matx/operators/krylov.h"
 #include "matx/operators/legendre.h"
+#include "matx/operators/logdet.h"
 #include "matx/operators/lu.h"
 #include "matx/operators/matmul.h"
+#include "matx/operators/matmul_scaled.h"
 #include "matx/operators/matvec.h"
+#include "matx/operators/mvdr.h"
 #include "matx/operators/norm.h"
 #include "matx/operators/normalize.h"
 #include "matx/operators/outer.h"
 #include "matx/operators/overlap.h"
 #include "matx/operators/pad.h"
 #include "matx/operators/percentile.h"
+#include "matx/operators/lstsq.h"
 #include "matx/operators/pinv.h"
 #include "matx/operators/permute.h"
 #include "matx/operators/planar.h"
@@ -99,6 +109,7 @@
 #include "matx/operators/reshape.h"
 #include "matx/operators/reverse.h"
 #include "matx/operators/sar_bp.h"
+#include "matx/operators/scatter_add.h"
 #include "matx/operators/select.h"
 #include "matx/operators/self.h"
 #include "matx/operators/set.h"
@@ -107,19 +118,23 @@
 #include "matx/operators/slice.h"
 #include "matx/operators/sparse2dense.h"
 #include "matx/operators/sparse2sparse.h"
+#include "matx/operators/sparse_elementwise.h"
 #include "matx/operators/solve.h"
 #include "matx/operators/sort.h"
 #include "matx/operators/sph2cart.h"
 #include "matx/operators/stack.h"
 #include "matx/operators/stdd.h"
+#include "matx/operators/stft.h"
 #include "matx/operators/svd.h"
 #include "matx/operators/toeplitz.h"
+#include "matx/operators/toeplitz_solve.h"
 #include "matx/operators/trace.h"
 #include "matx/operators/transpose.h"
 #include "matx/operators/unique.h"
 #include "matx/operators/unwrap.h"
 #include "matx/operators/updownsample.h"
 #include "matx/operators/var.h"
+#include "matx/operators/stats.h"
 #include "matx/operators/zipvec.h"
 
 #include "matx/operators/softmax.h"
@@ -136,4 +151,8 @@
 #include "matx/operators/any.h"
 #include "matx/operators/apply.h"
 #include "matx/operators/apply_idx.h"
+#include "matx/operators/apply_ltoir.h"
 #include "matx/operators/argsort.h"
+#include "matx/operators/topk.h"
+#include "matx/operators/segmented.h"
+#include "matx/operators/groupby.h"
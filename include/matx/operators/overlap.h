@@ -258,6 +258,10 @@ namespace matx
    * divide evenly into the existing column dimension, the view may chop off the
    * end of the data to make the tensor rectangular.
    *
+   * When op is a tensor, including a strided 1D view, the result is itself a
+   * tensor whose rows alias the input's memory, so transforms such as fft()
+   * read the frames in place rather than copying them.
+   *
    * @tparam OpType
    *   Type of operator input
    * @tparam N
@@ -63,7 +63,7 @@ namespace detail {
       __MATX_INLINE__ PercentileOp(const OpA &a, unsigned char q, PercentileMethod method) : a_(a), q_(q), method_(method) {
         MATX_LOG_TRACE("{} constructor: q={}, method={}", str(), static_cast<int>(q), static_cast<int>(method));
         for (int r = 0; r < ORank; r++) {
-          out_dims_[r]    = (r == ORank - 1) ? 1 : a_.Size(r);
+          out_dims_[r] = a_.Size(r);
         }
       }
 
@@ -121,24 +121,32 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }             
   };
 }
 
 /**
- * Compute product of numbers along axes
+ * Compute a percentile along axes
  *
- * Returns a tensor representing the product of all items in the reduction
+ * Returns a tensor with the q-th percentile of each row of the input. Reducing
+ * a rank 2 input over its last dimension is supported.
  *
  * @tparam InType
  *   Input data type
@@ -153,7 +161,7 @@ namespace detail {
  *   Array containing dimensions to compute over
  * @param method
  *   Method of interpolation
- * @returns Operator with reduced values of prod-reduce computed
+ * @returns Operator with reduced values of percentile computed
  */
 template <typename InType, int D>
 __MATX_INLINE__ auto percentile(const InType &in, unsigned char q, const int (&dims)[D], PercentileMethod method = PercentileMethod::LINEAR)
@@ -167,9 +175,9 @@ __MATX_INLINE__ auto percentile(const InType &in, unsigned char q, const int (&d
 }
 
 /**
- * Compute product of numbers
+ * Compute a percentile
  *
- * Returns a tensor representing the product of all items in the reduction
+ * Returns a scalar with the q-th percentile of all items in the input
  *
  * @tparam InType
  *   Input data type
@@ -180,7 +188,7 @@ __MATX_INLINE__ auto percentile(const InType &in, unsigned char q, const int (&d
  *   Percentile to compute (between 0-100)
  * @param method
  *   Method of interpolation
- * @returns Operator with reduced values of prod-reduce computed
+ * @returns Operator with reduced values of percentile computed
  */
 template <typename InType>
 __MATX_INLINE__ auto percentile(const InType &in, unsigned char q, PercentileMethod method = PercentileMethod::LINEAR)
@@ -46,6 +46,7 @@ namespace detail {
     private:
       typename detail::base_type_t<OpA> a_;
       float rcond_;
+      PinvMethod method_;
       cuda::std::array<index_t, OpA::Rank()> out_dims_;
       mutable detail::tensor_impl_t<typename remove_cvref_t<OpA>::value_type, OpA::Rank()> tmp_out_;
       mutable typename remove_cvref_t<OpA>::value_type *ptr = nullptr;
@@ -58,8 +59,9 @@ namespace detail {
       using pinv_xform_op = bool;
 
       __MATX_INLINE__ std::string str() const { return "pinv()"; }
-      __MATX_INLINE__ PinvOp(const OpA &a, float rcond) : a_(a), rcond_(rcond) {
-        MATX_LOG_TRACE("{} constructor: rcond={}", str(), rcond);
+      __MATX_INLINE__ PinvOp(const OpA &a, float rcond, PinvMethod method = PinvMethod::AUTO) :
+          a_(a), rcond_(rcond), method_(method) {
+        MATX_LOG_TRACE("{} constructor: rcond={}, method={}", str(), rcond, static_cast<int>(method));
         for (int r = 0; r < Rank(); r++) {
           if (r >= Rank() - 2) {
             out_dims_[r] = (r == Rank() - 1) ? a_.Size(Rank() - 2) : a_.Size(Rank() - 1);
@@ -102,7 +104,7 @@ namespace detail {
 
       template <typename Out, typename Executor>
       void Exec(Out &&out, Executor &&ex) const {
-        pinv_impl(cuda::std::get<0>(out), a_, ex, rcond_);
+        pinv_impl(cuda::std::get<0>(out), a_, ex, rcond_, method_);
       }
 
       template <typename ShapeType, typename Executor>
@@ -126,16 +128,23 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }
   };
 }
@@ -158,6 +167,10 @@ __MATX_INLINE__ constexpr float get_default_rcond() {
  * Perfom a generalized inverse of a matrix using its singular-value decomposition (SVD).
  * It automatically removes small singular values for stability.
  * 
+ * On the CUDA executor, tall and square matrices are first factored with QR, and the
+ * pseudo-inverse is R^-1 Q^H when the diagonal of R shows A has full column rank. Use
+ * the overload taking a PinvMethod to force the SVD or to use the Cholesky factor of A^H A.
+ *
  * If rank > 2, operations are batched.
  * 
  * @tparam OpA
@@ -179,4 +192,32 @@ __MATX_INLINE__ auto pinv(const OpA &a, float rcond = get_default_rcond<typename
   return detail::PinvOp(a, rcond);
 }
 
+/**
+ * Pseudo-inverse of a matrix with a choice of factorization
+ *
+ * PinvMethod::QR and PinvMethod::CHOLESKY need at least as many rows as columns. Both check the
+ * diagonal of their triangular factor: Cholesky falls back to QR when A is too badly conditioned
+ * for the normal equations, and QR falls back to the SVD when A is rank deficient. Only the SVD
+ * is available on host and JIT executors.
+ *
+ * If rank > 2, operations are batched.
+ *
+ * @tparam OpA
+ *   Tensor or operator type of input A
+ *
+ * @param a
+ *   Input tensor or operator of shape `... x m x n`
+ * @param method
+ *   Factorization to use
+ * @param rcond
+ *   Cutoff for small singular values, relative to the largest
+ *
+ * @return
+ *   Operator that produces a tensor of size `... x n x m` representing the pseudo-inverse of the input
+ */
+template<typename OpA>
+__MATX_INLINE__ auto pinv(const OpA &a, PinvMethod method, float rcond = get_default_rcond<typename OpA::value_type>()) {
+  return detail::PinvOp(a, rcond, method);
+}
+
 }
\ No newline at end of file
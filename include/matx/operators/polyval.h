@@ -70,33 +70,39 @@ namespace matx
 
         __MATX_INLINE__ auto get_jit_op_str() const {
           std::string func_name = get_jit_class_name();
-          
+          cuda::std::array<index_t, Rank()> out_dims_;
+          for (int i = 0; i < Rank(); ++i) {
+            out_dims_[i] = Size(i);
+          }
+
           return cuda::std::make_tuple(
             func_name,
             std::format("template <typename Op, typename Coeffs> struct {} {{\n"
                 "  using value_type = typename Op::value_type;\n"
                 "  using matxop = bool;\n"
                 "  constexpr static index_t ncoeffs_ = {};\n"
-                "  constexpr static index_t size_ = {};\n"
+                "  constexpr static int Rank_ = {};\n"
+                "  constexpr static cuda::std::array<index_t, Rank_> out_dims_ = {{ {} }};\n"
                 "  typename detail::inner_storage_or_self_t<detail::base_type_t<Op>> op_;\n"
                 "  typename detail::inner_storage_or_self_t<Coeffs> coeffs_;\n"
-                "  template <typename CapType>\n"
-                "  __MATX_INLINE__ __MATX_DEVICE__ auto operator()(index_t idx) const\n"
+                "  template <typename CapType, typename... Is>\n"
+                "  __MATX_INLINE__ __MATX_DEVICE__ auto operator()(Is... indices) const\n"
                 "  {{\n"
                 "    if constexpr (CapType::ept == ElementsPerThread::ONE) {{\n"
+                "      const value_type x = get_value<CapType>(op_, indices...);\n"
                 "      value_type ttl{{get_value<CapType>(coeffs_, 0)}};\n"
                 "      for(int i = 1; i < ncoeffs_; i++) {{\n"
-                "        ttl = ttl * get_value<CapType>(op_, idx) + get_value<CapType>(coeffs_, i);\n"
+                "        ttl = ttl * x + get_value<CapType>(coeffs_, i);\n"
                 "      }}\n"
                 "      return ttl;\n"
                 "    }} else {{\n"
                 "      return Vector<value_type, static_cast<index_t>(CapType::ept)>{{}};\n"
                 "    }}\n"
                 "  }}\n"
-                "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return 1; }}\n"
-                "  constexpr __MATX_INLINE__ __MATX_DEVICE__ index_t Size([[maybe_unused]] int dim) const {{ return size_; }}\n"
+                "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return Rank_; }}\n"
+                "  constexpr __MATX_INLINE__ __MATX_DEVICE__ index_t Size(int dim) const {{ return out_dims_[dim]; }}\n"
                 "}};\n",
-                func_name, coeffs_.Size(0), op_.Size(0))
+                func_name, coeffs_.Size(0), Rank(), detail::array_to_string(out_dims_))
           );
         }
 #endif
@@ -105,17 +111,17 @@ namespace matx
         __MATX_INLINE__ PolyvalOp(const Op &op, const Coeffs &coeffs) : op_(op), coeffs_(coeffs) {
           MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
           MATX_STATIC_ASSERT_STR(Coeffs::Rank() == 1, matxInvalidDim, "Coefficient must be rank 1");
-          MATX_STATIC_ASSERT_STR(Op::Rank() == 1, matxInvalidDim, "Input operator must be rank 1");
         };
 
-        template <typename CapType>
-        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(index_t idx) const
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(Is... indices) const
         {
           if constexpr (CapType::ept == ElementsPerThread::ONE) {
             // Horner's method for computing polynomial
+            const value_type x = get_value<CapType>(op_, indices...);
             value_type ttl{get_value<CapType>(coeffs_, 0)};
             for(int i = 1; i < coeffs_.Size(0); i++) {
-                ttl = ttl * get_value<CapType>(op_, idx) + get_value<CapType>(coeffs_, i);
+                ttl = ttl * x + get_value<CapType>(coeffs_, i);
             }
 
             return ttl;
@@ -124,19 +130,20 @@ namespace matx
           }
         }
 
-        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(index_t idx) const
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(Is... indices) const
         {
-          return this->operator()<DefaultCapabilities>(idx);
+          return this->operator()<DefaultCapabilities>(indices...);
         }
 
         static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
         {
-          return 1;
+          return Op::Rank();
         }
 
-        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size([[maybe_unused]] int dim) const
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
         {
-          return op_.Size(0);
+          return op_.Size(dim);
         }
 
         template <typename ShapeType, typename Executor>
@@ -207,13 +214,221 @@ namespace matx
           }
         }
     };
+
+    // Lowest coefficient count evaluated with second-order Horner instead of plain Horner
+    constexpr size_t POLYVAL_SPLIT_MIN_COEFFS = 6;
+
+    /**
+     * Evaluate a polynomial with a compile-time number of coefficients, highest degree first
+     *
+     * The loop is fully unrolled and the coefficients stay in registers. Short polynomials use Horner's
+     * method. Longer ones use second-order Horner, which evaluates the even and odd powers as two
+     * independent chains in x^2, halving the length of the dependent multiply-add chain.
+     */
+    template <typename V, typename C, size_t N>
+    __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ V polyval_fixed(const cuda::std::array<C, N> &c, V x)
+    {
+      if constexpr (N == 0) {
+        return V(0);
+      }
+      else if constexpr (N < POLYVAL_SPLIT_MIN_COEFFS) {
+        V t = static_cast<V>(c[0]);
+        MATX_LOOP_UNROLL
+        for (size_t k = 1; k < N; k++) {
+          t = t * x + static_cast<V>(c[k]);
+        }
+        return t;
+      }
+      else {
+        const V x2 = x * x;
+        V a = static_cast<V>(c[0]);
+        V b = static_cast<V>(c[1]);
+        MATX_LOOP_UNROLL
+        for (size_t k = 2; k < N; k += 2) {
+          a = a * x2 + static_cast<V>(c[k]);
+          if (k + 1 < N) {
+            b = b * x2 + static_cast<V>(c[k + 1]);
+          }
+        }
+        // a holds the terms whose power has the same parity as N - 1
+        if constexpr (N % 2 == 0) {
+          return a * x + b;
+        }
+        else {
+          return b * x + a;
+        }
+      }
+    }
+
+    template <typename Op, typename C, size_t N>
+    class PolyvalFixedOp : public BaseOp<PolyvalFixedOp<Op, C, N>>
+    {
+      private:
+        mutable typename detail::base_type_t<Op> op_;
+        cuda::std::array<C, N> coeffs_;
+
+      public:
+        using matxop = bool;
+        using value_type = typename Op::value_type;
+
+#ifdef MATX_EN_JIT
+        struct JIT_Storage {
+          typename detail::inner_storage_or_self_t<detail::base_type_t<Op>> op_;
+          cuda::std::array<C, N> coeffs_;
+        };
+
+        JIT_Storage ToJITStorage() const {
+          return JIT_Storage{detail::to_jit_storage(op_), coeffs_};
+        }
+
+        __MATX_INLINE__ std::string get_jit_class_name() const {
+          return std::format("JITPolyvalFixed_ncoeffs{}", N);
+        }
+
+        __MATX_INLINE__ auto get_jit_op_str() const {
+          std::string func_name = get_jit_class_name();
+          cuda::std::array<index_t, Rank()> out_dims_;
+          for (int i = 0; i < Rank(); ++i) {
+            out_dims_[i] = Size(i);
+          }
+
+          return cuda::std::make_tuple(
+            func_name,
+            std::format("template <typename Op> struct {} {{\n"
+                "  using value_type = typename Op::value_type;\n"
+                "  using matxop = bool;\n"
+                "  constexpr static int Rank_ = {};\n"
+                "  constexpr static size_t N_ = {};\n"
+                "  constexpr static cuda::std::array<index_t, Rank_> out_dims_ = {{ {} }};\n"
+                "  typename detail::inner_storage_or_self_t<detail::base_type_t<Op>> op_;\n"
+                "  cuda::std::array<{}, N_> coeffs_;\n"
+                "  template <typename CapType, typename... Is>\n"
+                "  __MATX_INLINE__ __MATX_DEVICE__ auto operator()(Is... indices) const\n"
+                "  {{\n"
+                "    if constexpr (CapType::ept == ElementsPerThread::ONE) {{\n"
+                "      const value_type x = get_value<CapType>(op_, indices...);\n"
+                "      if constexpr (N_ < {}) {{\n"
+                "        value_type t = static_cast<value_type>(coeffs_[0]);\n"
+                "        MATX_LOOP_UNROLL\n"
+                "        for (size_t k = 1; k < N_; k++) {{ t = t * x + static_cast<value_type>(coeffs_[k]); }}\n"
+                "        return t;\n"
+                "      }} else {{\n"
+                "        const value_type x2 = x * x;\n"
+                "        value_type a = static_cast<value_type>(coeffs_[0]);\n"
+                "        value_type b = static_cast<value_type>(coeffs_[1]);\n"
+                "        MATX_LOOP_UNROLL\n"
+                "        for (size_t k = 2; k < N_; k += 2) {{\n"
+                "          a = a * x2 + static_cast<value_type>(coeffs_[k]);\n"
+                "          if (k + 1 < N_) {{ b = b * x2 + static_cast<value_type>(coeffs_[k + 1]); }}\n"
+                "        }}\n"
+                "        if constexpr (N_ % 2 == 0) {{ return a * x + b; }} else {{ return b * x + a; }}\n"
+                "      }}\n"
+                "    }} else {{\n"
+                "      return Vector<value_type, static_cast<index_t>(CapType::ept)>{{}};\n"
+                "    }}\n"
+                "  }}\n"
+                "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return Rank_; }}\n"
+                "  constexpr __MATX_INLINE__ __MATX_DEVICE__ index_t Size(int dim) const {{ return out_dims_[dim]; }}\n"
+                "}};\n",
+                func_name, Rank(), N, detail::array_to_string(out_dims_), type_to_string<C>(), POLYVAL_SPLIT_MIN_COEFFS)
+          );
+        }
+#endif
+
+        __MATX_INLINE__ std::string str() const { return "polyval()"; }
+        __MATX_INLINE__ PolyvalFixedOp(const Op &op, const cuda::std::array<C, N> &coeffs) : op_(op), coeffs_(coeffs) {
+          MATX_LOG_TRACE("{} constructor: rank={}, ncoeffs={}", str(), Rank(), N);
+          static_assert(N > 0, "polyval() needs at least one coefficient");
+        };
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(Is... indices) const
+        {
+          if constexpr (CapType::ept == ElementsPerThread::ONE) {
+            return polyval_fixed(coeffs_, static_cast<value_type>(get_value<CapType>(op_, indices...)));
+          } else {
+            return Vector<value_type, static_cast<index_t>(CapType::ept)>{};
+          }
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(Is... indices) const
+        {
+          return this->operator()<DefaultCapabilities>(indices...);
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return Op::Rank();
+        }
+
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+        {
+          return op_.Size(dim);
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<Op>()) {
+            op_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<Op>()) {
+            op_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+          if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
+#ifdef MATX_EN_JIT
+            const auto op_jit_name = detail::get_operator_capability<Cap>(op_, in);
+            return std::format("{}<{}>", get_jit_class_name(), op_jit_name);
+#else
+            return "";
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+#ifdef MATX_EN_JIT
+            return combine_capabilities<Cap>(type_to_string<C>() != "unknown", detail::get_operator_capability<Cap>(op_, in));
+#else
+            return false;
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::JIT_CLASS_QUERY) {
+#ifdef MATX_EN_JIT
+            const auto [key, value] = get_jit_op_str();
+            if (in.find(key) == in.end()) {
+              in[key] = value;
+            }
+            detail::get_operator_capability<Cap>(op_, in);
+            return true;
+#else
+            return false;
+#endif
+          }
+          else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+            const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+            return combine_capabilities<Cap>(my_cap, detail::get_operator_capability<Cap>(op_, in));
+          } else {
+            auto self_has_cap = capability_attributes<Cap>::default_value;
+            return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(op_, in));
+          }
+        }
+    };
   }
 
 
   /**
    * @brief Evaluate a polynomial
    * 
-   * Currently only allows 1D input and coefficients
+   * Coefficients are a 1D operator ordered from the highest degree down, as in numpy.polyval. The input can
+   * have any rank, and the same coefficients are applied to every element.
    * 
    * @tparam Op Type of input values to evaluate
    * @tparam Coeffs Type of coefficients
@@ -225,4 +440,45 @@ namespace matx
   __MATX_INLINE__ auto polyval(const Op &op, const Coeffs &coeffs) {
     return detail::PolyvalOp(op, coeffs);
   }
+
+  /**
+   * @brief Evaluate a polynomial with a fixed number of coefficients
+   *
+   * The coefficient count is a compile-time constant, so evaluation is fully unrolled and the coefficients
+   * are passed by value with the kernel instead of being read from memory for every element. Polynomials
+   * with six or more coefficients use second-order Horner evaluation for more instruction-level
+   * parallelism. Coefficients are ordered from the highest degree down.
+   *
+   * @tparam Op Type of input values to evaluate
+   * @tparam C Type of coefficients
+   * @tparam N Number of coefficients
+   * @param op Input values to evaluate
+   * @param coeffs Coefficient values
+   * @return polyval operator
+   */
+  template <typename Op, typename C, size_t N>
+  __MATX_INLINE__ auto polyval(const Op &op, const cuda::std::array<C, N> &coeffs) {
+    return detail::PolyvalFixedOp<Op, C, N>(op, coeffs);
+  }
+
+  /**
+   * @brief Evaluate a polynomial with a fixed number of coefficients given as a braced list
+   *
+   * Same as the cuda::std::array overload, for calls such as polyval(x, {1.0f, -2.0f, 0.5f}).
+   *
+   * @tparam Op Type of input values to evaluate
+   * @tparam C Type of coefficients
+   * @tparam N Number of coefficients
+   * @param op Input values to evaluate
+   * @param coeffs Coefficient values
+   * @return polyval operator
+   */
+  template <typename Op, typename C, size_t N>
+  __MATX_INLINE__ auto polyval(const Op &op, const C (&coeffs)[N]) {
+    cuda::std::array<C, N> arr;
+    for (size_t i = 0; i < N; i++) {
+      arr[i] = coeffs[i];
+    }
+    return detail::PolyvalFixedOp<Op, C, N>(op, arr);
+  }
 } // end namespace matx
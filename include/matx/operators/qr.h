@@ -36,6 +36,7 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/qr/qr_cuda.h"
+#include "matx/transforms/qr/qr_tall.h"
 #ifdef MATX_EN_CPU_SOLVER
   #include "matx/transforms/qr/qr_lapack.h"
 #endif
@@ -206,6 +207,7 @@ namespace detail {
   {
     private:
       typename detail::base_type_t<OpA> a_;
+      QRMethod method_;
 
     public:
       using matxop = bool;
@@ -214,7 +216,7 @@ namespace detail {
       using qr_solver_xform_op = bool;
 
       __MATX_INLINE__ std::string str() const { return "qr_econ()"; }
-      __MATX_INLINE__ EconQROp(const OpA &a) : a_(a) { }    
+      __MATX_INLINE__ EconQROp(const OpA &a, QRMethod method = QRMethod::GEQRF) : a_(a), method_(method) { }    
 
       // This should never be called
       template <typename... Is>
@@ -230,7 +232,7 @@ namespace detail {
       void Exec(Out &&out, Executor &&ex) {
         static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 3, "Must use mtie with 2 outputs on qr_econ(). ie: (mtie(Q, R) = qr_econ(A))");     
 
-        qr_econ_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, ex);
+        qr_econ_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, ex, method_);
       }
 
       static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
@@ -277,4 +279,31 @@ __MATX_INLINE__ auto qr_econ(const OpA &a) {
   return detail::EconQROp(a);
 }
 
+/**
+ * Perform an economic QR decomposition on a matrix with a chosen algorithm.
+ *
+ * TSQR splits a tall matrix into row blocks, factors them in one batch, and reduces their R
+ * factors in a tree, which keeps all SMs busy when m is much larger than n. CHOLQR2 performs two
+ * rounds of Cholesky QR using only GEMMs and small factorizations; it is the fastest option for
+ * tall matrices but loses accuracy or fails when A is ill-conditioned. Both require a rank-2 input
+ * with m >= n. AUTO selects TSQR when m >= 16n and GEQRF otherwise.
+ *
+ * @tparam OpA
+ *   Data type of input a tensor or operator
+ *
+ * @param a
+ *   Input tensor or operator of shape `... x m x n`
+ * @param method
+ *   Algorithm to use
+ *
+ * @return
+ *   Operator that produces QR outputs.
+ *   - **Q** - Of shape `... x m x min(m, n)`, the reduced orthonormal basis for the span of A.
+ *   - **R** - Upper triangular matrix of shape  `... x min(m, n) x n`.
+ */
+template<typename OpA>
+__MATX_INLINE__ auto qr_econ(const OpA &a, QRMethod method) {
+  return detail::EconQROp(a, method);
+}
+
 }
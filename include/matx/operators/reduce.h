@@ -134,16 +134,23 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr);
         }               
     };
   }
@@ -207,7 +214,7 @@ __MATX_INLINE__ auto reduce(const InType &in, ReduceOp op, bool init = true)
 template <typename InType, int D, typename ReduceOp>
 __MATX_INLINE__ auto reduce(const InType &in, const int (&dims)[D], ReduceOp op, bool init = true)
 {
-  MATX_NVTX_START("reduce(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("reduce(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   
   static_assert(D < InType::Rank(), "reduce dimensions must be <= Rank of input");
 
@@ -147,7 +147,18 @@ namespace matx
         template <typename CapType, typename... Is>
         __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
         {
-          return get_impl<CapType>(cuda::std::as_const(op_), idx_, indices...);
+          if constexpr (CapType::ept == ElementsPerThread::ONE) {
+            cuda::std::array ind{static_cast<index_t>(indices)...};
+            if constexpr (IdxType::Rank() == 0) {
+              ind[DIM] = get_value<CapType>(idx_);
+            } else {
+              ind[DIM] = get_value<CapType>(idx_, ind[DIM]);
+            }
+            return detail::gather_value<CapType>(op_, ind);
+          }
+          else {
+            return get_impl<CapType>(cuda::std::as_const(op_), idx_, indices...);
+          }
         }
 
         template <typename... Is>
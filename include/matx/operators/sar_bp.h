@@ -70,6 +70,10 @@ enum class SarBpFeature : uint32_t {
   be combined with an incremental phase calculation within a single range bin that is computed using the lower-precision
   intrinsic sine/cosine functions. This optimization will utilize a small amount of device memory as a workspace
   buffer. This optimization is typically only useful for the \p Mixed and \p FloatFloat compute types. */
+  FloatFloatAccumulation = 0x2, /**< Accumulate the per-pulse contributions to each pixel as float-float values rather
+  than fp32. Interpolation is still performed in fp32, so this pairs well with half-precision range profiles
+  (matxFp16Complex or matxBf16Complex), which halve the bytes read per range profile gather while the float-float
+  accumulator preserves the precision of the image sum over many pulses. Requires the \p FloatFloat compute type. */
 };
 
 // Enable bitmask operations for SarBpFeature
@@ -117,11 +121,11 @@ namespace detail {
     private:
       using out_t = typename detail::base_type_t<ImageType>;
       SarBpParams params_;
-      ImageType initial_image_;
-      RangeProfilesType range_profiles_;
-      PlatPosType platform_positions_;
-      VoxLocType voxel_locations_;
-      RangeToMcpType range_to_mcp_;
+      typename detail::base_type_t<ImageType> initial_image_;
+      typename detail::base_type_t<RangeProfilesType> range_profiles_;
+      typename detail::base_type_t<PlatPosType> platform_positions_;
+      typename detail::base_type_t<VoxLocType> voxel_locations_;
+      typename detail::base_type_t<RangeToMcpType> range_to_mcp_;
       cuda::std::array<index_t, RangeProfilesType::Rank()> out_dims_;
       mutable detail::tensor_impl_t<out_t, RangeProfilesType::Rank()> tmp_out_;
       mutable out_t *ptr = nullptr;
@@ -201,24 +205,31 @@ namespace detail {
         detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
 
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<ImageType>()) {
           initial_image_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-        }     
+        }
 
         if constexpr (is_matx_op<RangeProfilesType>()) {
           range_profiles_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-        } 
+        }
 
         if constexpr (is_matx_op<PlatPosType>()) {
           platform_positions_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }        
 
       constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
@@ -502,6 +502,109 @@ MATX_BINARY_OP_GEN_OPERATOR(bitand, And, &);
 MATX_BINARY_OP_GEN_OPERATOR(bitor, Or, |);
 MATX_BINARY_OP_GEN_OPERATOR(bitxor, Xor, ^);
 
+#if !defined(__CUDACC_RTC__)
+// Operator functions evaluated inside fast_math(). The generic version keeps the accurate
+// operator. The single-precision overloads below use the CUDA approximate intrinsics on the
+// device and fall back to the accurate functions on the host.
+template <typename CapType, typename Op, typename... Vs>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ decltype(auto) scalar_fast_math(const Op &op, Vs... vs) {
+  return op.template operator()<CapType>(vs...);
+}
+
+template <typename CapType, typename T>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const ExpOp<T> &, float v1) {
+#ifdef __CUDA_ARCH__
+  return __expf(v1);
+#else
+  return scalar_internal_exp(v1);
+#endif
+}
+
+template <typename CapType, typename T>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const LogOp<T> &, float v1) {
+#ifdef __CUDA_ARCH__
+  return __logf(v1);
+#else
+  return scalar_internal_log(v1);
+#endif
+}
+
+template <typename CapType, typename T>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const Log2Op<T> &, float v1) {
+#ifdef __CUDA_ARCH__
+  return __log2f(v1);
+#else
+  return scalar_internal_log2(v1);
+#endif
+}
+
+template <typename CapType, typename T>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const Log10Op<T> &, float v1) {
+#ifdef __CUDA_ARCH__
+  return __log10f(v1);
+#else
+  return scalar_internal_log10(v1);
+#endif
+}
+
+template <typename CapType, typename T>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const SinOp<T> &, float v1) {
+#ifdef __CUDA_ARCH__
+  return __sinf(v1);
+#else
+  return scalar_internal_sin(v1);
+#endif
+}
+
+template <typename CapType, typename T>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const CosOp<T> &, float v1) {
+#ifdef __CUDA_ARCH__
+  return __cosf(v1);
+#else
+  return scalar_internal_cos(v1);
+#endif
+}
+
+template <typename CapType, typename T>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const TanOp<T> &, float v1) {
+#ifdef __CUDA_ARCH__
+  return __tanf(v1);
+#else
+  return scalar_internal_tan(v1);
+#endif
+}
+
+template <typename CapType, typename T>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ cuda::std::complex<float> scalar_fast_math(const ExpjOp<T> &, float v1) {
+#ifdef __CUDA_ARCH__
+  float sinx, cosx;
+  __sincosf(v1, &sinx, &cosx);
+  return cuda::std::complex<float>{cosx, sinx};
+#else
+  return scalar_internal_expj(v1);
+#endif
+}
+
+template <typename CapType, typename T1, typename T2>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const DivOp<T1, T2> &, float v1, float v2) {
+#ifdef __CUDA_ARCH__
+  return __fdividef(v1, v2);
+#else
+  return v1 / v2;
+#endif
+}
+
+template <typename CapType, typename T1, typename T2>
+static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float scalar_fast_math(const PowOp<T1, T2> &, float v1, float v2) {
+#ifdef __CUDA_ARCH__
+  return __powf(v1, v2);
+#else
+  return scalar_internal_pow(v1, v2);
+#endif
+}
+#endif
+
+
 
 } // end namespace detail
 } // end namespace matx
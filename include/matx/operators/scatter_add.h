@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/scatter_add.h"
+
+namespace matx {
+
+namespace detail {
+  template<typename ValOp, typename IdxOp>
+  class ScatterAddOp : public BaseOp<ScatterAddOp<ValOp, IdxOp>>
+  {
+    private:
+      using out_t = typename ValOp::value_type;
+      typename detail::base_type_t<ValOp> vals_;
+      typename detail::base_type_t<IdxOp> idx_;
+      cuda::std::array<index_t, 1> out_dims_;
+      mutable detail::tensor_impl_t<out_t, 1> tmp_out_;
+      mutable out_t *ptr = nullptr;
+      mutable bool prerun_done_ = false;
+
+    public:
+      using matxop = bool;
+      using value_type = out_t;
+      using matx_transform_op = bool;
+      using scatter_add_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "scatter_add(" + get_type_str(vals_) + ")"; }
+      __MATX_INLINE__ ScatterAddOp(const ValOp &vals, const IdxOp &idx, index_t size) : vals_(vals), idx_(idx) {
+        MATX_LOG_TRACE("{} constructor: size={}", str(), size);
+        out_dims_[0] = size;
+      }
+
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return tmp_out_.template operator()<CapType>(indices...);
+      };
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return this->operator()<DefaultCapabilities>(indices...);
+      };
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(vals_, in),
+                                         detail::get_operator_capability<Cap>(idx_, in));
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return 1;
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        scatter_add_impl(cuda::std::get<0>(out), vals_, idx_, ex);
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<ValOp>()) {
+          vals_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<IdxOp>()) {
+          idx_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if (prerun_done_) {
+          return;
+        }
+
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        prerun_done_ = true;
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<ValOp>()) {
+          vals_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<IdxOp>()) {
+          idx_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+  };
+}
+
+/**
+ * Sum values into the locations given by an index operator
+ *
+ * Returns a rank 1 operator of length size where element j is the sum of every vals(i) with idx(i) == j,
+ * or zero if there are none. Indices outside [0, size) are skipped. This is the inverse of a gather with
+ * select(): repeated indices accumulate instead of overwriting each other. On the device, values with the
+ * same destination are combined within a warp before a single atomic add, so sorted or clustered indices
+ * are much cheaper than random ones.
+ *
+ * @tparam ValOp Type of the values
+ * @tparam IdxOp Type of the index operator
+ * @param vals Rank 1 values to add
+ * @param idx Rank 1 integral destination indices, the same length as vals
+ * @param size Length of the output
+ * @returns Operator with the summed values
+ */
+template <typename ValOp, typename IdxOp>
+__MATX_INLINE__ auto scatter_add(const ValOp &vals, const IdxOp &idx, index_t size)
+{
+  static_assert(ValOp::Rank() == 1 && IdxOp::Rank() == 1, "scatter_add() values and indices must be rank 1");
+  return detail::ScatterAddOp<ValOp, IdxOp>(vals, idx, size);
+}
+
+} // end namespace matx
@@ -0,0 +1,386 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND argmin EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR argmin DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON argmin THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN argmin WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/segmented.h"
+
+namespace matx {
+
+
+
+namespace detail {
+  template<typename OpA, typename OpO, bool ARGSORT>
+  class SegmentedSortOp : public BaseOp<SegmentedSortOp<OpA, OpO, ARGSORT>>
+  {
+    public:
+      using matxop = bool;
+      using value_type = cuda::std::conditional_t<ARGSORT, index_t, typename OpA::value_type>;
+      using matx_transform_op = bool;
+      using sort_xform_op = bool;
+
+    private:
+      typename detail::base_type_t<OpA> a_;
+      typename detail::base_type_t<OpO> offsets_;
+      SortDirection_t dir_;
+      cuda::std::array<index_t, 1> out_dims_;
+      mutable detail::tensor_impl_t<value_type, 1> tmp_out_;
+      mutable value_type *ptr = nullptr;
+      mutable bool prerun_done_ = false;
+
+    public:
+      __MATX_INLINE__ std::string str() const {
+        return std::string(ARGSORT ? "segmented_argsort(" : "segmented_sort(") + get_type_str(a_) + ")";
+      }
+      __MATX_INLINE__ SegmentedSortOp(const OpA &a, const OpO &offsets, const SortDirection_t dir) :
+          a_(a), offsets_(offsets), dir_(dir) {
+        static_assert(OpA::Rank() == 1, "Segmented sort input must be rank 1");
+        MATX_LOG_TRACE("{} constructor: segments={}, dir={}", str(), offsets.Size(0) - 1, static_cast<int>(dir));
+        out_dims_[0] = a_.Size(0);
+      }
+
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return tmp_out_.template operator()<CapType>(indices...);
+      };
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return this->operator()<DefaultCapabilities>(indices...);
+      }
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in),
+                                         detail::get_operator_capability<Cap>(offsets_, in));
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return 1;
+      }
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        if constexpr (ARGSORT) {
+          segmented_argsort_impl(cuda::std::get<0>(out), a_, offsets_, dir_, ex);
+        }
+        else {
+          segmented_sort_impl(cuda::std::get<0>(out), a_, offsets_, dir_, ex);
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpO>()) {
+          offsets_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if (prerun_done_) {
+          return;
+        }
+
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        prerun_done_ = true;
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpO>()) {
+          offsets_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+  };
+
+  template<typename OpA, typename OpO, typename ReduceOp>
+  class SegmentedReduceOp : public BaseOp<SegmentedReduceOp<OpA, OpO, ReduceOp>>
+  {
+    public:
+      using matxop = bool;
+      using value_type = typename OpA::value_type;
+      using matx_transform_op = bool;
+      using segmented_xform_op = bool;
+
+    private:
+      typename detail::base_type_t<OpA> a_;
+      typename detail::base_type_t<OpO> offsets_;
+      std::string name_;
+      cuda::std::array<index_t, 1> out_dims_;
+      mutable detail::tensor_impl_t<value_type, 1> tmp_out_;
+      mutable value_type *ptr = nullptr;
+      mutable bool prerun_done_ = false;
+
+    public:
+      __MATX_INLINE__ std::string str() const { return name_ + "(" + get_type_str(a_) + ")"; }
+      __MATX_INLINE__ SegmentedReduceOp(const OpA &a, const OpO &offsets, const std::string &name) :
+          a_(a), offsets_(offsets), name_(name) {
+        static_assert(OpA::Rank() == 1, "Segmented reduction input must be rank 1");
+        MATX_LOG_TRACE("{} constructor: segments={}", str(), offsets.Size(0) - 1);
+        out_dims_[0] = offsets_.Size(0) - 1;
+      }
+
+      __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+      template <typename CapType, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return tmp_out_.template operator()<CapType>(indices...);
+      };
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const {
+        return this->operator()<DefaultCapabilities>(indices...);
+      }
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in),
+                                         detail::get_operator_capability<Cap>(offsets_, in));
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return 1;
+      }
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return out_dims_[dim];
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        segmented_reduce_impl(cuda::std::get<0>(out), a_, offsets_, ReduceOp{}, ex);
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpO>()) {
+          offsets_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if (prerun_done_) {
+          return;
+        }
+
+        InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+        prerun_done_ = true;
+        Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpO>()) {
+          offsets_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+        detail::FreeTempTensor(ptr);
+      }
+  };
+}
+
+/**
+ * Sort every segment of a ragged rank 1 operator
+ *
+ * Segment s covers elements [offsets(s), offsets(s+1)) of the input, like the
+ * positions array of a CSR matrix, so a batch of variable-length lists can be
+ * sorted without padding them into a rectangular tensor. Segments of all sizes
+ * are sorted in one call, with short segments handled by warp and block level
+ * sorts.
+ *
+ * @tparam InputOperator
+ *   Input type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @param a
+ *   Rank 1 input operator
+ * @param offsets
+ *   Rank 1 operator of segment offsets, with one more entry than segments
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @returns Operator with sorted segments
+ */
+template <typename InputOperator, typename OffsetOperator>
+__MATX_INLINE__ auto segmented_sort(const InputOperator &a, const OffsetOperator &offsets,
+                                    const SortDirection_t dir = SORT_DIR_ASC) {
+  return detail::SegmentedSortOp<InputOperator, OffsetOperator, false>(a, offsets, dir);
+}
+
+/**
+ * Argsort every segment of a ragged rank 1 operator
+ *
+ * Generates the indices that sort each segment [offsets(s), offsets(s+1)) of
+ * the input. Indices are positions in the whole input, so they can be used to
+ * gather from the input directly.
+ *
+ * @tparam InputOperator
+ *   Input type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @param a
+ *   Rank 1 input operator
+ * @param offsets
+ *   Rank 1 operator of segment offsets, with one more entry than segments
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @returns Operator containing indices that would sort each segment
+ */
+template <typename InputOperator, typename OffsetOperator>
+__MATX_INLINE__ auto segmented_argsort(const InputOperator &a, const OffsetOperator &offsets,
+                                       const SortDirection_t dir = SORT_DIR_ASC) {
+  return detail::SegmentedSortOp<InputOperator, OffsetOperator, true>(a, offsets, dir);
+}
+
+/**
+ * Sum every segment of a ragged rank 1 operator
+ *
+ * Segment s covers elements [offsets(s), offsets(s+1)) of the input. Empty
+ * segments sum to zero.
+ *
+ * @tparam InputOperator
+ *   Input type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @param a
+ *   Rank 1 input operator
+ * @param offsets
+ *   Rank 1 operator of segment offsets, with one more entry than segments
+ * @returns Operator with one sum per segment
+ */
+template <typename InputOperator, typename OffsetOperator>
+__MATX_INLINE__ auto segmented_sum(const InputOperator &a, const OffsetOperator &offsets) {
+  using T = typename InputOperator::value_type;
+  return detail::SegmentedReduceOp<InputOperator, OffsetOperator, detail::SegmentedSumOp<T>>(a, offsets, "segmented_sum");
+}
+
+/**
+ * Find the minimum of every segment of a ragged rank 1 operator
+ *
+ * Segment s covers elements [offsets(s), offsets(s+1)) of the input. Empty
+ * segments produce the largest value of the type.
+ *
+ * @tparam InputOperator
+ *   Input type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @param a
+ *   Rank 1 input operator
+ * @param offsets
+ *   Rank 1 operator of segment offsets, with one more entry than segments
+ * @returns Operator with one minimum per segment
+ */
+template <typename InputOperator, typename OffsetOperator>
+__MATX_INLINE__ auto segmented_min(const InputOperator &a, const OffsetOperator &offsets) {
+  using T = typename InputOperator::value_type;
+  static_assert(!is_complex_v<T>, "segmented_min() does not support complex types");
+  return detail::SegmentedReduceOp<InputOperator, OffsetOperator, detail::SegmentedMinOp<T>>(a, offsets, "segmented_min");
+}
+
+/**
+ * Find the maximum of every segment of a ragged rank 1 operator
+ *
+ * Segment s covers elements [offsets(s), offsets(s+1)) of the input. Empty
+ * segments produce the lowest value of the type.
+ *
+ * @tparam InputOperator
+ *   Input type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @param a
+ *   Rank 1 input operator
+ * @param offsets
+ *   Rank 1 operator of segment offsets, with one more entry than segments
+ * @returns Operator with one maximum per segment
+ */
+template <typename InputOperator, typename OffsetOperator>
+__MATX_INLINE__ auto segmented_max(const InputOperator &a, const OffsetOperator &offsets) {
+  using T = typename InputOperator::value_type;
+  static_assert(!is_complex_v<T>, "segmented_max() does not support complex types");
+  return detail::SegmentedReduceOp<InputOperator, OffsetOperator, detail::SegmentedMaxOp<T>>(a, offsets, "segmented_max");
+}
+
+}
@@ -124,7 +124,12 @@ namespace matx
         __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... is) const 
         {
           static_assert(sizeof...(Is) == 1, "select() operator must be called with exactly one index");
-          return get_impl<CapType>(cuda::std::as_const(op_), idx_, is...);
+          if constexpr (CapType::ept == ElementsPerThread::ONE) {
+            return detail::gather_value<CapType>(op_, detail::GetIdxFromAbs(op_, get_value<CapType>(idx_, is...)));
+          }
+          else {
+            return get_impl<CapType>(cuda::std::as_const(op_), idx_, is...);
+          }
         }
 
         template <typename... Is>
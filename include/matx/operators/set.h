@@ -87,6 +87,10 @@ public:
     return op_;
   }
 
+  const auto &get_rhs() const {
+    return op_;
+  }
+
   /**
    * Constructor to assign an operator to a view
    *
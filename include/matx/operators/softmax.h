@@ -36,16 +36,18 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/conv.h"
+#include "matx/kernels/softmax.cuh"
 
 namespace matx
 {
   namespace detail {
-    template <typename OpA, typename PermDims>
-    class SoftmaxOp : public BaseOp<SoftmaxOp<OpA, PermDims>>
+    template <typename OpA, typename PermDims, typename MaskType = SoftmaxNoMask>
+    class SoftmaxOp : public BaseOp<SoftmaxOp<OpA, PermDims, MaskType>>
     {
       private:
         typename detail::base_type_t<OpA> a_;
         PermDims perm_;
+        typename detail::base_type_t<MaskType> mask_;
         cuda::std::array<index_t, OpA::Rank()> out_dims_;
         mutable detail::tensor_impl_t<typename remove_cvref_t<OpA>::value_type, OpA::Rank()> tmp_out_;
         mutable typename remove_cvref_t<OpA>::value_type *ptr = nullptr;
@@ -61,8 +63,8 @@ namespace matx
           return "softmax(" + get_type_str(a_) + ")";
         }
 
-        __MATX_INLINE__ SoftmaxOp(const OpA &A, PermDims perm) : 
-              a_(A), perm_(perm) {
+        __MATX_INLINE__ SoftmaxOp(const OpA &A, PermDims perm, const MaskType &mask = {}) : 
+              a_(A), perm_(perm), mask_(mask) {
           MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
           for (int r = 0; r < OpA::Rank(); r++) {
             out_dims_[r] = a_.Size(r);
@@ -101,7 +103,15 @@ namespace matx
         void Exec(Out &&out, Executor &&ex) const {
           static_assert(is_cuda_executor_v<Executor>, "softmax() only supports the CUDA executor currently");
 
-          if constexpr (!std::is_same_v<PermDims, no_permute_t>) {
+          if constexpr (!std::is_same_v<MaskType, SoftmaxNoMask>) {
+            if constexpr (!std::is_same_v<PermDims, no_permute_t>) {
+              softmax_masked_impl(cuda::std::get<0>(out), a_, mask_, perm_, ex.getStream());
+            }
+            else {
+              softmax_masked_impl(cuda::std::get<0>(out), a_, mask_, ex.getStream());
+            }
+          }
+          else if constexpr (!std::is_same_v<PermDims, no_permute_t>) {
             softmax_impl(cuda::std::get<0>(out), a_, perm_, ex.getStream());
           }
           else {
@@ -114,7 +124,10 @@ namespace matx
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
-          }         
+          }
+          if constexpr (is_matx_op<MaskType>()) {
+            mask_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
         }      
 
         template <typename ShapeType, typename Executor>
@@ -130,16 +143,26 @@ namespace matx
 
           prerun_done_ = true;
           Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
         template <typename ShapeType, typename Executor>
-        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
         {
           if constexpr (is_matx_op<OpA>()) {
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
+          if constexpr (is_matx_op<MaskType>()) {
+            mask_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr);
         }   
     };
   }
@@ -192,7 +215,7 @@ template <typename InType, int D>
 __MATX_INLINE__ auto softmax(const InType &in, const int (&dims)[D])
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("softmax(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("softmax(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   
   static_assert(D < InType::Rank(), "softmax dimensions must be <= Rank of input");
 
@@ -202,4 +225,55 @@ __MATX_INLINE__ auto softmax(const InType &in, const int (&dims)[D])
 
 
 
+/**
+ * Calculate the softmax of values in a tensor treated as a flat vector, excluding masked elements
+ *
+ * Elements where the mask is false do not contribute to the max or the sum of exponentials and
+ * are written as zero, as in attention with padding or causal masks. If every element is masked
+ * the output is all zeros. The input must be real.
+ *
+ * @tparam InType
+ *   Input data type
+ * @tparam MaskType
+ *   Mask operator type
+ *
+ * @param in
+ *   Input data to compute the softmax
+ * @param mask
+ *   Operator with the same shape as the input that is true for elements to include
+ */
+template <typename InType, typename MaskType, std::enable_if_t<is_matx_op<MaskType>(), bool> = true>
+__MATX_INLINE__ auto softmax(const InType &in, const MaskType &mask)
+{
+  return detail::SoftmaxOp(in, detail::no_permute_t{}, mask);
+}
+
+/**
+ * Calculate the softmax of values in a tensor over the given dimensions, excluding masked elements
+ *
+ * Elements where the mask is false do not contribute to the max or the sum of exponentials and
+ * are written as zero. A row with every element masked is written as all zeros. The input must
+ * be real.
+ *
+ * @tparam InType
+ *   Input data type
+ * @tparam MaskType
+ *   Mask operator type
+ * @tparam D
+ *   Rank of dimension array
+ *
+ * @param in
+ *   Input data to compute the softmax
+ * @param mask
+ *   Operator with the same shape as the input that is true for elements to include
+ * @param dims
+ *   C-style array containing the dimensions to sum over
+ */
+template <typename InType, typename MaskType, int D>
+__MATX_INLINE__ auto softmax(const InType &in, const MaskType &mask, const int (&dims)[D])
+{
+  static_assert(D < InType::Rank(), "softmax dimensions must be <= Rank of input");
+  return detail::SoftmaxOp(in, detail::to_array(dims), mask);
+}
+
 }
@@ -35,6 +35,7 @@
 
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
+#include "matx/transforms/solve/solve_cuda.h"
 #include "matx/transforms/solve/solve_cusparse.h"
 #ifdef MATX_EN_CUDSS
 #include "matx/transforms/solve/solve_cudss.h"
@@ -48,6 +49,8 @@ class SolveOp : public BaseOp<SolveOp<OpA, OpB>> {
 private:
   typename detail::base_type_t<OpA> a_;
   typename detail::base_type_t<OpB> b_;
+  bool refactor_;
+  SolvePrecision precision_;
 
   static constexpr int out_rank = OpB::Rank();
   cuda::std::array<index_t, out_rank> out_dims_;
@@ -61,8 +64,10 @@ public:
   using solve_xform_op = bool;
   using value_type = typename OpA::value_type;
 
-  __MATX_INLINE__ SolveOp(const OpA &a, const OpB &b) : a_(a), b_(b) {
-    MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
+  __MATX_INLINE__ SolveOp(const OpA &a, const OpB &b, bool refactor,
+                          SolvePrecision precision = SolvePrecision::FULL)
+      : a_(a), b_(b), refactor_(refactor), precision_(precision) {
+    MATX_LOG_TRACE("{} constructor: rank={}, refactor={}", str(), Rank(), refactor);
     for (int r = 0, rank = Rank(); r < rank; r++) {
       out_dims_[r] = b_.Size(r);
     }
@@ -115,14 +120,18 @@ public:
         sparse_batched_dia_solve_impl(cuda::std::get<0>(out), a_, b_, ex);
       } else {
 #ifdef MATX_EN_CUDSS
-        sparse_solve_impl(cuda::std::get<0>(out), a_, b_, ex);
+        sparse_solve_impl(cuda::std::get<0>(out), a_, b_, ex, refactor_);
 #else
         MATX_THROW(matxNotSupported, "Sparse direct solver requires cuDSS");
 #endif
       }
     } else {
-      MATX_THROW(matxNotSupported,
-                 "Direct solver currently only supports sparse system");
+      if constexpr (is_cuda_executor_v<Executor>) {
+        dense_solve_impl(cuda::std::get<0>(out), a_, b_, ex, precision_);
+      } else {
+        MATX_THROW(matxNotSupported,
+                   "Dense direct solve currently only supports CUDA executors");
+      }
     }
   }
 
@@ -130,8 +139,9 @@ public:
   __MATX_INLINE__ void
   InnerPreRun([[maybe_unused]] ShapeType &&shape,
               [[maybe_unused]] Executor &&ex) const noexcept {
-    static_assert(is_sparse_tensor_v<OpA>,
-                  "Direct solver currently only supports sparse system");
+    if constexpr (!is_sparse_tensor_v<OpA> && is_matx_op<OpA>()) {
+      a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    }
     if constexpr (is_matx_op<OpB>()) {
       b_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
     }
@@ -149,17 +159,26 @@ public:
                                &ptr);
     prerun_done_ = true;
     Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+    InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
   }
 
   template <typename ShapeType, typename Executor>
-  __MATX_INLINE__ void PostRun([[maybe_unused]] ShapeType &&shape,
-                               [[maybe_unused]] Executor &&ex) const noexcept {
-    static_assert(is_sparse_tensor_v<OpA>,
-                  "Direct solver currently only supports sparse system");
+  __MATX_INLINE__ void
+  InnerPostRun([[maybe_unused]] ShapeType &&shape,
+               [[maybe_unused]] Executor &&ex) const noexcept {
+    if constexpr (!is_sparse_tensor_v<OpA> && is_matx_op<OpA>()) {
+      a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    }
     if constexpr (is_matx_op<OpB>()) {
       b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
     }
-    matxFree(ptr);
+  }
+
+  template <typename ShapeType, typename Executor>
+  __MATX_INLINE__ void PostRun([[maybe_unused]] ShapeType &&shape,
+                               [[maybe_unused]] Executor &&ex) const noexcept {
+    InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+    detail::FreeTempTensor(ptr);
   }
 };
 
@@ -174,6 +193,11 @@ public:
  * operation is only implemented for solving a linear system
  * with a very **sparse** matrix A in CSR or DIA format.
  *
+ * For CSR, the cuDSS analysis is cached per sparsity pattern (the
+ * position and coordinate buffers of A). Later solves with the same
+ * pattern only refactorize the new values, and with refactor set to
+ * false they reuse the previous factorization for new right-hand sides.
+ *
  * @tparam OpA
  *    Data type of A tensor (sparse)
  * @tparam OpB
@@ -183,13 +207,49 @@ public:
  *   A Sparse tensor with system coefficients
  * @param B
  *   B Dense tensor of known values
+ * @param refactor
+ *   Recompute the numeric factorization of a cached CSR analysis. Pass
+ *   false when the values of A have not changed since the last solve
+ *
+ * @return
+ *   Operator that produces the output tensor X with the solution
+ */
+template <typename OpA, typename OpB>
+__MATX_INLINE__ auto solve(const OpA &A, const OpB &B, bool refactor = true) {
+  return detail::SolveOp(A, B, refactor);
+}
+
+/**
+ * Running X = solve(A, B, precision) solves the system A X^T = B^T
+ * for a **dense** square matrix A. As with the sparse solve, each
+ * right-hand side and solution is one row of B and X.
+ *
+ * With SolvePrecision::FULL, A is LU factored and the system solved in
+ * the precision of A. With SolvePrecision::REFINED, A is factored in TF32
+ * on the tensor cores and the solution is refined to the precision of A,
+ * which is several times faster for well-conditioned systems. When the
+ * refinement does not converge, the system is solved again in full
+ * precision, so the result is always a full-precision solution.
+ *
+ * @tparam OpA
+ *    Data type of A tensor (dense)
+ * @tparam OpB
+ *    Data type of B tensor
+ *
+ * @param A
+ *   Rank-2 square dense matrix of system coefficients
+ * @param B
+ *   Rank-1 right-hand side, or rank-2 with one right-hand side per row
+ * @param precision
+ *   Arithmetic used by the solve
  *
  * @return
  *   Operator that produces the output tensor X with the solution
  */
 template <typename OpA, typename OpB>
-__MATX_INLINE__ auto solve(const OpA &A, const OpB &B) {
-  return detail::SolveOp(A, B);
+__MATX_INLINE__ auto solve(const OpA &A, const OpB &B, SolvePrecision precision) {
+  static_assert(!is_sparse_tensor_v<OpA>, "solve with a precision requires a dense A");
+  return detail::SolveOp(A, B, true, precision);
 }
 
 } // end namespace matx
@@ -63,6 +63,7 @@ namespace detail {
       using value_type = typename OpA::value_type;
       using matx_transform_op = bool;
       using sort_xform_op = bool;
+      using can_alias = bool; // Sorting the same view in place is detected by sort_impl
 
       __MATX_INLINE__ std::string str() const { return "sort()"; }
       __MATX_INLINE__ SortOp(const OpA &a, SortDirection_t dir) : a_(a), dir_(dir) { 
@@ -193,16 +194,23 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }      
   };
 }
@@ -211,7 +219,8 @@ namespace detail {
  * Sort rows of an operator
  *
  * Sort rows of an operator using a radix sort. Currently supported types are
- * float, double, ints, and long ints (both signed and unsigned). For a 1D
+ * float, double, half, bfloat16, ints, and long ints (both signed and unsigned),
+ * and complex types, which are ordered by magnitude. For a 1D
  * operator, a linear sort is performed. For 2D and above each row of the inner
  * dimensions are batched and sorted separately.
  *
@@ -139,7 +139,7 @@ public:
                                [[maybe_unused]] Executor &&ex) const noexcept {
     static_assert(is_sparse_tensor_v<OpA>,
                   "Cannot use sparse2dense on dense input");
-    matxFree(ptr);
+    detail::FreeTempTensor(ptr);
   }
 };
 
@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/add/add_cusparse.h"
+
+namespace matx {
+namespace detail {
+
+template <typename OpA, typename Func>
+class SparseMapOp : public BaseOp<SparseMapOp<OpA, Func>> {
+private:
+  typename detail::base_type_t<OpA> a_;
+  Func func_;
+
+public:
+  using matxop = bool;
+  using matx_transform_op = bool;
+  using tosparse_xform_op = bool;
+  using value_type = typename remove_cvref_t<decltype(cuda::std::declval<Func>()(
+      cuda::std::declval<OpA>().Values()))>::value_type;
+
+  __MATX_INLINE__ SparseMapOp(const OpA &a, Func func) : a_(a), func_(func) {
+    MATX_LOG_TRACE("{} constructor: rank={}", str(), OpA::Rank());
+  }
+
+  __MATX_INLINE__ std::string str() const {
+    return "sparse_map(" + get_type_str(a_) + ")";
+  }
+
+  static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t
+  Rank() {
+    return remove_cvref_t<OpA>::Rank();
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t
+  Size(int dim) const {
+    return a_.Size(dim);
+  }
+
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType &in) const {
+    auto self_has_cap = capability_attributes<Cap>::default_value;
+    return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in));
+  }
+
+  template <typename Out, typename Executor>
+  void Exec(Out &out, Executor &&ex) const {
+    // NOTE: sparse assignment O = sparse_map(A, f) takes direct reference!
+    using otype = remove_cvref_t<Out>;
+    using atype = remove_cvref_t<OpA>;
+    static_assert(is_sparse_tensor_v<atype> && is_sparse_tensor_v<otype>,
+                  "sparse_map requires sparse input and output");
+    static_assert(std::is_same_v<typename otype::Format, typename atype::Format> &&
+                      std::is_same_v<typename otype::crd_type, typename atype::crd_type> &&
+                      std::is_same_v<typename otype::pos_type, typename atype::pos_type>,
+                  "sparse_map output must have the format of the input");
+    static_assert(std::is_same_v<typename otype::val_type, value_type>,
+                  "sparse_map output has wrong value type");
+    for (int r = 0; r < Rank(); r++) {
+      MATX_ASSERT(out.Size(r) == a_.Size(r), matxInvalidSize);
+    }
+    cudaStream_t stream = 0;
+    if constexpr (is_cuda_executor_v<Executor>) {
+      stream = ex.getStream();
+    }
+    // Unless mapping in-place, the output shares the nonzero pattern of the
+    // input and receives a new values buffer.
+    if (static_cast<void *>(out.Data()) != static_cast<void *>(a_.Data())) {
+      for (int l = 0; l < atype::LVL; l++) {
+        out.SetCrd(l, a_.GetCrdStorage(l));
+        out.SetPos(l, a_.GetPosStorage(l));
+      }
+      matxMemorySpace_t space = GetPointerKind(a_.Data());
+      out.SetVal(make_owning_storage<value_type>(
+          static_cast<size_t>(a_.Nse()), space, stream));
+      out.SetSparseDataImpl();
+    }
+    auto vals = out.Values();
+    (vals = func_(a_.Values())).run(std::forward<Executor>(ex));
+  }
+};
+
+template <typename OpA, typename OpB>
+class SparseAddOp : public BaseOp<SparseAddOp<OpA, OpB>> {
+private:
+  typename detail::base_type_t<OpA> a_;
+  typename detail::base_type_t<OpB> b_;
+  float alpha_;
+  float beta_;
+
+public:
+  using matxop = bool;
+  using matx_transform_op = bool;
+  using tosparse_xform_op = bool;
+  using value_type = typename OpA::value_type;
+
+  __MATX_INLINE__ SparseAddOp(const OpA &a, const OpB &b, float alpha,
+                              float beta)
+      : a_(a), b_(b), alpha_(alpha), beta_(beta) {
+    MATX_LOG_TRACE("{} constructor: alpha={}, beta={}", str(), alpha, beta);
+  }
+
+  __MATX_INLINE__ std::string str() const {
+    return "sparse_add(" + get_type_str(a_) + "," + get_type_str(b_) + ")";
+  }
+
+  static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t
+  Rank() {
+    return remove_cvref_t<OpA>::Rank();
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t
+  Size(int dim) const {
+    return a_.Size(dim);
+  }
+
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType &in) const {
+    auto self_has_cap = capability_attributes<Cap>::default_value;
+    return combine_capabilities<Cap>(self_has_cap,
+                                     detail::get_operator_capability<Cap>(a_, in),
+                                     detail::get_operator_capability<Cap>(b_, in));
+  }
+
+  template <typename Out, typename Executor>
+  void Exec([[maybe_unused]] Out &&out, [[maybe_unused]] Executor &&ex) const {
+    static_assert(is_cuda_executor_v<Executor>,
+                  "sparse_add currently only supports the CUDA executor");
+    if constexpr (is_sparse_tensor_v<OpA> && is_sparse_tensor_v<OpB> &&
+                  is_sparse_tensor_v<Out>) {
+      // NOTE: sparse assignment O = sparse_add(A, B) takes direct reference!
+      sparse_add_impl(out, a_, b_, ex, alpha_, beta_);
+    } else {
+      MATX_THROW(matxNotSupported,
+                 "Cannot use sparse_add on dense operands");
+    }
+  }
+};
+
+} // end namespace detail
+
+/**
+ * Apply element-wise operators to the explicitly stored values of a sparse
+ * tensor, without densifying it. The function receives a dense 1-dim view
+ * of the stored values of A and returns an operator over them. The output
+ * shares the nonzero pattern of A (or is A itself for an in-place update)
+ * and receives the computed values, so that the sparsity format is kept.
+ * Since only the stored values are visited, the function should map zero
+ * to zero to preserve the meaning of the implicit zeros.
+ *
+ * @tparam OpA
+ *    Data type of A tensor
+ * @tparam Func
+ *    Type of the function
+ *
+ * @param A
+ *   Sparse input tensor
+ * @param func
+ *   Function mapping the values view to an element-wise operator
+ *
+ * @return
+ *   Sparse output tensor
+ */
+template <typename OpA, typename Func>
+__MATX_INLINE__ auto sparse_map(const OpA &A, Func func) {
+  return detail::SparseMapOp(A, func);
+}
+
+/**
+ * Add two sparse tensors C = alpha * A + beta * B. The nonzero pattern of
+ * the output is the union of the nonzero patterns of A and B.
+ *
+ * Currently only CSR tensors with 32-bit indices are supported. The output
+ * must have allocated row positions (e.g. from make_zero_tensor_csr).
+ *
+ * @tparam OpA
+ *    Data type of A tensor
+ * @tparam OpB
+ *    Data type of B tensor
+ *
+ * @param A
+ *   Sparse input tensor
+ * @param B
+ *   Sparse input tensor
+ * @param alpha
+ *   Scalar multiplier for A
+ * @param beta
+ *   Scalar multiplier for B
+ *
+ * @return
+ *   Sparse output tensor
+ */
+template <typename OpA, typename OpB>
+__MATX_INLINE__ auto sparse_add(const OpA &A, const OpB &B, float alpha = 1.0,
+                                float beta = 1.0) {
+  return detail::SparseAddOp(A, B, alpha, beta);
+}
+
+} // end namespace matx
@@ -59,6 +59,7 @@ namespace matx
       public:
       using matxop = bool;
       using matxoplvalue = bool;
+      using matx_segmented_op = bool;
 
       // Scalar type of operation
       using value_type = first_value_type;
@@ -348,6 +349,26 @@ namespace matx
         return set(*this, rhs); 
       }
 
+      // Assign each input into its own slice of out, dropping the stacked dimension. Inputs that are tensors
+      // become plain copies, and expressions and transforms are evaluated directly into the output.
+      template <int I = 0, typename Out, typename Executor>
+      __MATX_INLINE__ void AssignSegments(Out &out, Executor &&ex) const
+      {
+        if constexpr (I < sizeof...(Ts)) {
+          cuda::std::array<index_t, RANK + 1> firsts{};
+          cuda::std::array<index_t, RANK + 1> ends;
+          for (int d = 0; d < RANK + 1; d++) {
+            ends[d] = out.Size(d);
+          }
+          firsts[axis_] = I;
+          ends[axis_] = matxDropDim;
+
+          auto out_seg = out.template Slice<RANK>(firsts, ends);
+          set(out_seg, cuda::std::get<I>(ops_)).run(ex);
+          AssignSegments<I + 1>(out, ex);
+        }
+      }
+
       template <OperatorCapability Cap, typename InType>
       __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
         if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
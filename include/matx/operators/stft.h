@@ -0,0 +1,335 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/stft.h"
+
+namespace matx
+{
+  namespace detail {
+    template <typename OpX, typename OpW>
+    class StftOp : public BaseOp<StftOp<OpX, OpW>>
+    {
+      private:
+        using out_t = stft_complex_t<typename OpX::value_type>;
+        static constexpr int RANK = OpX::Rank() + 1;
+
+        typename detail::base_type_t<OpX> x_;
+        typename detail::base_type_t<OpW> w_;
+        index_t nfft_;
+        index_t hop_;
+        cuda::std::array<index_t, RANK> out_dims_;
+        mutable detail::tensor_impl_t<out_t, RANK> tmp_out_;
+        mutable out_t *ptr = nullptr;
+
+      public:
+        using matxop = bool;
+        using value_type = out_t;
+        using matx_transform_op = bool;
+        using stft_xform_op = bool;
+
+        __MATX_INLINE__ std::string str() const {
+          return "stft(" + get_type_str(x_) + "," + get_type_str(w_) + ")";
+        }
+
+        __MATX_INLINE__ StftOp(const OpX &x, const OpW &w, index_t nfft, index_t hop) :
+              x_(x), w_(w), nfft_(nfft), hop_(hop) {
+          MATX_LOG_TRACE("{} constructor: nfft={}, hop={}", str(), nfft, hop);
+          static_assert(OpW::Rank() == 1, "stft() window must be rank 1");
+          for (int r = 0; r < RANK - 2; r++) {
+            out_dims_[r] = x_.Size(r);
+          }
+          out_dims_[RANK - 2] = stft_num_frames(x_.Size(RANK - 2), w_.Size(0), hop);
+          out_dims_[RANK - 1] = nfft;
+        }
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return tmp_out_.template operator()<CapType>(indices...);
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return tmp_out_.template operator()<DefaultCapabilities>(indices...);
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+          auto self_has_cap = capability_attributes<Cap>::default_value;
+          return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(x_, in), detail::get_operator_capability<Cap>(w_, in));
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return RANK;
+        }
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+        {
+          return out_dims_[dim];
+        }
+
+        __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+        template <typename Out, typename Executor>
+        void Exec(Out &&out, Executor &&ex) const {
+          static_assert(is_cuda_executor_v<Executor>, "stft() only supports the CUDA executor currently");
+          stft_impl(cuda::std::get<0>(out), x_, w_, nfft_, hop_, ex);
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpX>()) {
+            x_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpW>()) {
+            w_.PreRun(Shape(w_), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+          Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpX>()) {
+            x_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpW>()) {
+            w_.PostRun(Shape(w_), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::FreeTempTensor(ptr);
+        }
+    };
+
+    template <typename OpS, typename OpW>
+    class IstftOp : public BaseOp<IstftOp<OpS, OpW>>
+    {
+      private:
+        using out_t = typename OpS::value_type;
+        static constexpr int RANK = OpS::Rank() - 1;
+
+        typename detail::base_type_t<OpS> s_;
+        typename detail::base_type_t<OpW> w_;
+        index_t hop_;
+        cuda::std::array<index_t, RANK> out_dims_;
+        mutable detail::tensor_impl_t<out_t, RANK> tmp_out_;
+        mutable out_t *ptr = nullptr;
+
+      public:
+        using matxop = bool;
+        using value_type = out_t;
+        using matx_transform_op = bool;
+        using istft_xform_op = bool;
+
+        __MATX_INLINE__ std::string str() const {
+          return "istft(" + get_type_str(s_) + "," + get_type_str(w_) + ")";
+        }
+
+        __MATX_INLINE__ IstftOp(const OpS &s, const OpW &w, index_t hop) :
+              s_(s), w_(w), hop_(hop) {
+          MATX_LOG_TRACE("{} constructor: hop={}", str(), hop);
+          static_assert(OpS::Rank() >= 2, "istft() input must be at least rank 2");
+          static_assert(OpW::Rank() == 1, "istft() window must be rank 1");
+          for (int r = 0; r < RANK - 1; r++) {
+            out_dims_[r] = s_.Size(r);
+          }
+          out_dims_[RANK - 1] = (s_.Size(RANK - 1) - 1) * hop + w_.Size(0);
+        }
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return tmp_out_.template operator()<CapType>(indices...);
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return tmp_out_.template operator()<DefaultCapabilities>(indices...);
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+          auto self_has_cap = capability_attributes<Cap>::default_value;
+          return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(s_, in), detail::get_operator_capability<Cap>(w_, in));
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return RANK;
+        }
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+        {
+          return out_dims_[dim];
+        }
+
+        __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+        template <typename Out, typename Executor>
+        void Exec(Out &&out, Executor &&ex) const {
+          static_assert(is_cuda_executor_v<Executor>, "istft() only supports the CUDA executor currently");
+          istft_impl(cuda::std::get<0>(out), s_, w_, hop_, ex);
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpS>()) {
+            s_.PreRun(Shape(s_), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpW>()) {
+            w_.PreRun(Shape(w_), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+          Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpS>()) {
+            s_.PostRun(Shape(s_), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpW>()) {
+            w_.PostRun(Shape(w_), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::FreeTempTensor(ptr);
+        }
+    };
+  }
+
+/**
+ * Short-time Fourier transform
+ *
+ * Splits the last dimension of x into frames of w.Size(0) samples, hop samples apart, multiplies
+ * each frame by the window, zero-pads it to nfft and takes its FFT. Leading dimensions of x are
+ * independent channels. Only frames that lie entirely inside x are produced, so there are
+ * (N - w.Size(0)) / hop + 1 of them. Real inputs are promoted to complex and all nfft bins are
+ * returned. The frames are never materialized when cuFFT LTO callbacks are enabled; they are
+ * computed as the FFT loads them.
+ *
+ * @tparam XOp Input signal type
+ * @tparam WOp Window type
+ * @param x Input signal, with time in the last dimension
+ * @param nfft FFT size of each frame
+ * @param hop Number of samples between the starts of consecutive frames
+ * @param w Window of at most nfft samples
+ * @returns Operator of shape (..., frames, nfft) holding the spectrum of each frame
+ */
+template <typename XOp, typename WOp>
+__MATX_INLINE__ auto stft(const XOp &x, index_t nfft, index_t hop, const WOp &w)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  return detail::StftOp(x, w, nfft, hop);
+}
+
+/**
+ * Short-time Fourier transform with a rectangular window of nfft samples
+ *
+ * @tparam XOp Input signal type
+ * @param x Input signal, with time in the last dimension
+ * @param nfft FFT size and frame length
+ * @param hop Number of samples between the starts of consecutive frames
+ * @returns Operator of shape (..., frames, nfft) holding the spectrum of each frame
+ */
+template <typename XOp>
+__MATX_INLINE__ auto stft(const XOp &x, index_t nfft, index_t hop)
+{
+  using real_type = typename detail::inner_op_type_t<typename XOp::value_type>::type;
+  return stft(x, nfft, hop, ones<real_type>({nfft}));
+}
+
+/**
+ * Inverse short-time Fourier transform
+ *
+ * Inverts stft() by taking the inverse FFT of every frame and combining the frames with a weighted
+ * overlap-add normalized by the summed squared window. The signal is recovered exactly wherever at
+ * least one frame with a nonzero window sample covers it.
+ *
+ * @tparam SOp Input spectra type
+ * @tparam WOp Window type
+ * @param s Spectra of shape (..., frames, nfft) as produced by stft()
+ * @param hop Number of samples between the starts of consecutive frames
+ * @param w Real window used by the forward transform
+ * @returns Operator of shape (..., (frames - 1) * hop + w.Size(0)) holding the complex signal
+ */
+template <typename SOp, typename WOp>
+__MATX_INLINE__ auto istft(const SOp &s, index_t hop, const WOp &w)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  return detail::IstftOp(s, w, hop);
+}
+
+}
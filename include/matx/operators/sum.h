@@ -52,6 +52,7 @@ namespace detail {
       mutable ::matx::detail::tensor_impl_t<typename remove_cvref_t<OpA>::value_type, ORank> tmp_out_;
       mutable typename remove_cvref_t<OpA>::value_type *ptr = nullptr;
       mutable bool prerun_done_ = false;
+      SumAccuracy accuracy_;
 
     public:
       using matxop = bool;
@@ -62,7 +63,7 @@ namespace detail {
       static_assert(ORank < InRank, "SumOp output rank must be less than input rank");
 
       __MATX_INLINE__ std::string str() const { return "sum(" + get_type_str(a_) + ")"; }
-      __MATX_INLINE__ SumOp(const OpA &a) : a_(a) { 
+      __MATX_INLINE__ SumOp(const OpA &a, SumAccuracy accuracy = SumAccuracy::DEFAULT) : a_(a), accuracy_(accuracy) { 
         MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
         for (int r = 0; r < ORank; r++) {
           out_dims_[r] = a_.Size(r);
@@ -153,7 +154,7 @@ namespace detail {
 
       template <typename Out, typename Executor>
       void Exec(Out &&out, Executor &&ex) const {
-        sum_impl(cuda::std::get<0>(out), a_, ex);
+        sum_impl(cuda::std::get<0>(out), a_, ex, accuracy_);
       }
 
       static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
@@ -182,16 +183,23 @@ namespace detail {
 
         prerun_done_ = true;
         Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
       }
 
       template <typename ShapeType, typename Executor>
-      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
       {
         if constexpr (is_matx_op<OpA>()) {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr);
       }
 
       constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
@@ -252,4 +260,56 @@ __MATX_INLINE__ auto sum(const InType &in)
   return detail::SumOp<decltype(in), InType::Rank() - D>(in);
 }
 
+/**
+ * Compute sum of input along axes with a chosen accumulation
+ *
+ * With SumAccuracy::COMPENSATED, float and complex<float> inputs are accumulated as float-float
+ * pairs. The result is close to what a double accumulation gives while the input is still read as
+ * float. Other input types ignore the setting.
+ *
+ * @tparam InType
+ *   Input data type
+ * @tparam D
+ *   Num of dimensions to reduce over
+ *
+ * @param in
+ *   Input data to reduce
+ * @param dims
+ *   Array containing dimensions to reduce over
+ * @param accuracy
+ *   Accumulation to use
+ * @returns Operator with reduced values of sum-reduce computed
+ */
+template <typename InType, int D>
+__MATX_INLINE__ auto sum(const InType &in, const int (&dims)[D], SumAccuracy accuracy)
+{
+  static_assert(D <= InType::Rank(), "reduction dimensions must be <= Rank of input");
+  auto perm = detail::getPermuteDims<InType::Rank()>(dims);
+  auto permop = permute(in, perm);
+
+  return detail::SumOp<decltype(permop), InType::Rank() - D>(permop, accuracy);
+}
+
+/**
+ * Compute sum of all elements of the input with a chosen accumulation
+ *
+ * @tparam InType
+ *   Input data type
+ *
+ * @param in
+ *   Input data to reduce
+ * @param accuracy
+ *   Accumulation to use
+ * @returns Operator with reduced values of sum-reduce computed
+ */
+#ifdef DOXYGEN_ONLY
+template <typename InType>
+#else
+template <typename InType, int D = InType::Rank()>
+#endif
+__MATX_INLINE__ auto sum(const InType &in, SumAccuracy accuracy)
+{
+  return detail::SumOp<decltype(in), InType::Rank() - D>(in, accuracy);
+}
+
 }
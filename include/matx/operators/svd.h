@@ -50,6 +50,7 @@ namespace detail {
       typename detail::base_type_t<OpA> a_;
       SVDMode jobz_;
       SVDHostAlgo algo_;
+      JacobiParams jacobi_;
 
     public:
       using matxop = bool;
@@ -58,7 +59,8 @@ namespace detail {
       using svd_xform_op = bool;
 
       __MATX_INLINE__ std::string str() const { return "svd(" + get_type_str(a_) + ")"; }
-      __MATX_INLINE__ SVDOp(const OpA &a, const SVDMode jobz, const SVDHostAlgo algo) : a_(a), jobz_(jobz), algo_(algo) {
+      __MATX_INLINE__ SVDOp(const OpA &a, const SVDMode jobz, const SVDHostAlgo algo, const JacobiParams &jacobi) :
+          a_(a), jobz_(jobz), algo_(algo), jacobi_(jacobi) {
         MATX_LOG_TRACE("{} constructor: jobz={}, algo={}", str(), static_cast<int>(jobz), static_cast<int>(algo));
       };
 
@@ -83,7 +85,7 @@ namespace detail {
       void Exec(Out &&out, Executor &&ex) const {
         static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 4, "Must use mtie with 3 outputs on svd(). ie: (mtie(U, S, VT) = svd(A))");
         if constexpr (is_cuda_executor_v<Executor>) {
-          svd_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), a_, ex, jobz_);
+          svd_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), a_, ex, jobz_, jacobi_);
         } else {
           svd_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), a_, ex, jobz_, algo_);
         }
@@ -133,6 +135,9 @@ namespace detail {
  *   requires \f$ O(\min(M,N) ^ 2) \f$ memory as compared to \f$ O(\max(M,N)) \f$ for
  *   `gesvd`, and it can have poorer accuracy in some cases.
  *   Ignored for CUDA SVD calls.
+ * @param jacobi
+ *   For CUDA SVD calls, controls the batched Jacobi solver that is used for batches
+ *   of matrices of up to 32x32. Ignored for Host SVD calls.
  * 
  * @return 
  *   Operator that produces *U*, *S*, and *VT* tensors. Regardless of jobz, all 3 tensors
@@ -147,8 +152,9 @@ namespace detail {
  */
 template<typename OpA>
 __MATX_INLINE__ auto svd(const OpA &a, const SVDMode jobz = SVDMode::ALL,
-                        const SVDHostAlgo algo = SVDHostAlgo::DC) {
-  return detail::SVDOp(a, jobz, algo);
+                        const SVDHostAlgo algo = SVDHostAlgo::DC,
+                        const JacobiParams &jacobi = {}) {
+  return detail::SVDOp(a, jobz, algo, jacobi);
 }
 
 
@@ -334,4 +340,107 @@ __MATX_INLINE__ auto svdbpi(const AType &A, int max_iters=10, float tol=0.0f) {
   return detail::SVDBPIOp(A, max_iters, tol);
 }
 
+
+namespace detail {
+  template<typename OpA>
+  class RSVDOp : public BaseOp<RSVDOp<OpA>>
+  {
+    private:
+      typename detail::base_type_t<OpA> a_;
+      index_t k_;
+      index_t oversample_;
+      int power_iters_;
+
+    public:
+      using matxop = bool;
+      using value_type = typename OpA::value_type;
+      using matx_transform_op = bool;
+      using svd_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "rsvd(" + get_type_str(a_) + ")"; }
+      __MATX_INLINE__ RSVDOp(const OpA &a, index_t k, index_t oversample, int power_iters) :
+          a_(a), k_(k), oversample_(oversample), power_iters_(power_iters)
+      {
+        MATX_LOG_TRACE("{} constructor: k={}, oversample={}, power_iters={}", str(), k, oversample, power_iters);
+      }
+
+      // This should never be called
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const = delete;
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+          const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+          return combine_capabilities<Cap>(my_cap, detail::get_operator_capability<Cap>(a_, in));
+        }
+        else {
+          auto self_has_cap = capability_attributes<Cap>::default_value;
+          return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in));
+        }
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(is_cuda_executor_v<Executor>, "rsvd() only supports the CUDA executor currently");
+        static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 4, "Must use mtie with 3 outputs on rsvd(). ie: (mtie(U, S, VT) = rsvd(A, k))");
+
+        rsvd_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), a_, k_, oversample_, power_iters_, ex);
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return matxNoRank;
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size([[maybe_unused]] int dim) const
+      {
+        return 0;
+      }
+  };
+}
+
+/**
+ * Perform a randomized truncated SVD, computing the k leading singular values and
+ * vectors of A.
+ *
+ * The range of A is sampled with a random Gaussian matrix of k + oversample columns,
+ * refined with power iterations and orthonormalized with an economic QR. The SVD of
+ * the small projected matrix then yields the result. This requires far fewer flops
+ * than a full SVD when k is much smaller than min(m, n), such as for low-rank
+ * approximations of tall matrices. The accuracy depends on the decay of the singular
+ * values; more power iterations improve it for slowly decaying spectra.
+ *
+ * If rank > 2, operations are batched.
+ *
+ * @tparam AType
+ *   Tensor or operator type of the A input
+ *
+ * @param A
+ *   Input tensor or operator of shape `... x m x n`
+ * @param k
+ *   Number of singular values and vectors to compute
+ * @param oversample
+ *   Number of additional random samples. The sample size is capped at min(m, n).
+ * @param power_iters
+ *   Number of power iterations
+ *
+ * @return
+ *   Operator that produces *U* of shape `... x m x k`, *S* of shape `... x k` with the
+ *   singular values in descending order, and *VT* of shape `... x k x n`. It must be
+ *   used with `mtie()`.
+ */
+template<typename AType>
+__MATX_INLINE__ auto rsvd(const AType &A, index_t k, index_t oversample = 10, int power_iters = 2) {
+  return detail::RSVDOp(A, k, oversample, power_iters);
+}
+
 }
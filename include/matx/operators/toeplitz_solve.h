@@ -0,0 +1,203 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/toeplitz_solve.h"
+
+namespace matx
+{
+  namespace detail {
+    template <typename OpT, typename OpB>
+    class ToeplitzSolveOp : public BaseOp<ToeplitzSolveOp<OpT, OpB>>
+    {
+      private:
+        typename detail::base_type_t<OpT> t_;
+        typename detail::base_type_t<OpB> b_;
+        ToeplitzSolveMethod method_;
+        double tol_;
+        int max_iters_;
+        cuda::std::array<index_t, remove_cvref_t<OpB>::Rank()> out_dims_;
+        mutable detail::tensor_impl_t<typename OpB::value_type, remove_cvref_t<OpB>::Rank()> tmp_out_;
+        mutable typename OpB::value_type *ptr = nullptr;
+        mutable bool prerun_done_ = false;
+
+      public:
+        using matxop = bool;
+        using value_type = typename OpB::value_type;
+        using matx_transform_op = bool;
+        using toeplitz_solve_xform_op = bool;
+
+        __MATX_INLINE__ std::string str() const {
+          return "toeplitz_solve(" + get_type_str(t_) + "," + get_type_str(b_)  + ")";
+        }
+
+        __MATX_INLINE__ ToeplitzSolveOp(const OpT &t, const OpB &b, ToeplitzSolveMethod method, double tol, int max_iters) :
+              t_(t), b_(b), method_(method), tol_(tol), max_iters_(max_iters) {
+          MATX_LOG_TRACE("{} constructor: method={}, tol={}, max_iters={}", str(), static_cast<int>(method), tol, max_iters);
+          for (int r = 0; r < Rank(); r++) {
+            out_dims_[r] = b_.Size(r);
+          }
+        }
+
+        __MATX_HOST__ __MATX_INLINE__ auto Data() const noexcept { return ptr; }
+
+        template <typename CapType, typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return tmp_out_.template operator()<CapType>(indices...);
+        }
+
+        template <typename... Is>
+        __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+        {
+          return this->operator()<DefaultCapabilities>(indices...);
+        }
+
+        template <OperatorCapability Cap, typename InType>
+        __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType &in) const {
+          auto self_has_cap = capability_attributes<Cap>::default_value;
+          return combine_capabilities<Cap>(
+            self_has_cap,
+            detail::get_operator_capability<Cap>(t_, in),
+            detail::get_operator_capability<Cap>(b_, in)
+          );
+        }
+
+        static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+        {
+          return remove_cvref_t<OpB>::Rank();
+        }
+
+        constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+        {
+          return out_dims_[dim];
+        }
+
+        template <typename Out, typename Executor>
+        void Exec(Out &&out, Executor &&ex) const {
+          static_assert(is_cuda_executor_v<Executor>, "toeplitz_solve() only supports the CUDA executor currently");
+          toeplitz_solve_impl(cuda::std::get<0>(out), t_, b_, method_, tol_, max_iters_, ex);
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPreRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpT>()) {
+            t_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpB>()) {
+            b_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          if (prerun_done_) {
+            return;
+          }
+
+          InnerPreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::AllocateTempTensor(tmp_out_, std::forward<Executor>(ex), out_dims_, &ptr);
+
+          prerun_done_ = true;
+          Exec(cuda::std::make_tuple(tmp_out_), std::forward<Executor>(ex));
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void InnerPostRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const noexcept
+        {
+          if constexpr (is_matx_op<OpT>()) {
+            t_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+
+          if constexpr (is_matx_op<OpB>()) {
+            b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+          }
+        }
+
+        template <typename ShapeType, typename Executor>
+        __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept
+        {
+          InnerPostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+
+          detail::FreeTempTensor(ptr);
+        }
+    };
+  }
+
+
+  /**
+   * Solve Hermitian Toeplitz systems T x = b given only the first column of T
+   *
+   * The first row of T is the conjugate of its first column, so T is never formed. Every innermost
+   * row of b is one right-hand side, and its solution is the matching row of the output.
+   *
+   * ToeplitzSolveMethod::LEVINSON runs the Levinson recursion in O(n^2) per system, with one thread
+   * block per system. It requires every leading principal submatrix of T to be nonsingular, which
+   * holds when T is positive definite, as for autocorrelation matrices.
+   *
+   * ToeplitzSolveMethod::PCG runs conjugate gradient using FFTs for the products with T and a circulant
+   * preconditioner, at O(n log n) per iteration. It requires T to be positive definite and is the
+   * faster choice for large n.
+   *
+   * @param t
+   *   First column of T, with t(0) real and positive. Rank 1 to share one matrix across every
+   *   system, or the rank of b with one column per system
+   * @param b
+   *   Right-hand sides
+   * @param method
+   *   Solver to use
+   * @param tol
+   *   Relative residual norm at which PCG stops. Unused by Levinson.
+   * @param max_iters
+   *   Maximum number of PCG iterations. Unused by Levinson.
+   *
+   */
+  template <typename TType, typename BType>
+    __MATX_INLINE__ auto toeplitz_solve(const TType &t, const BType &b,
+                                        ToeplitzSolveMethod method = ToeplitzSolveMethod::LEVINSON,
+                                        double tol = 1e-6, int max_iters = 100)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+    return detail::ToeplitzSolveOp(t, b, method, tol, max_iters);
+  }
+
+}
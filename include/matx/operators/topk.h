@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COpBRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND argmin EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COpBRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR argmin DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON argmin THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN argmin WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/type_utils.h"
+#include "matx/operators/base_operator.h"
+#include "matx/transforms/topk.h"
+
+namespace matx {
+
+
+
+namespace detail {
+  template<typename OpA>
+  class TopKOp : public BaseOp<TopKOp<OpA>>
+  {
+    private:
+      typename detail::base_type_t<OpA> a_;
+      index_t k_;
+      SortDirection_t dir_;
+
+    public:
+      using matxop = bool;
+      using value_type = typename remove_cvref_t<OpA>::value_type;
+      using matx_transform_op = bool;
+      using topk_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "topk(" + get_type_str(a_) + ")"; }
+      __MATX_INLINE__ TopKOp(const OpA &a, index_t k, SortDirection_t dir) : a_(a), k_(k), dir_(dir) {
+        MATX_LOG_TRACE("{} constructor: k={}, dir={}", str(), k, static_cast<int>(dir));
+      };
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const = delete;
+
+      template <OperatorCapability Cap, typename InType>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+        auto self_has_cap = capability_attributes<Cap>::default_value;
+        return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_, in));
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) const {
+        static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 3, "Must use mtie with 2 outputs on topk(). ie: (mtie(Vals, Idx) = topk(A, k))");
+        topk_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, k_, dir_, ex);
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return remove_cvref_t<OpA>::Rank();
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, Executor &&ex) const noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size([[maybe_unused]] int dim) const
+      {
+        return 0;
+      }
+
+  };
+}
+
+/**
+ * Find the k largest (or smallest) values of each row and their indices
+ *
+ * Rows are the last dimension of the input and all other dimensions are
+ * batched. Both outputs have the shape of the input with the last dimension
+ * replaced by k, and are ordered by value with ties listed by lowest index.
+ * Which copies of a value tied at the k-th position are kept is unspecified.
+ * Indices are relative to the start of each row. Rows are not sorted: a radix
+ * select finds the k-th value, and only the k selected entries are sorted.
+ * Real types including fp16 and bf16 are supported, with k up to 1024.
+ *
+ * @tparam InType
+ *   Input data type
+ *
+ * @param in
+ *   Input data
+ * @param k
+ *   Number of values to select from each row
+ * @param dir
+ *   SORT_DIR_DESC (default) for the largest values, SORT_DIR_ASC for the smallest
+ * @returns Operator producing the selected values and indices
+ */
+template <typename InType>
+__MATX_INLINE__ auto topk(const InType &in, index_t k, SortDirection_t dir = SORT_DIR_DESC)
+{
+  return detail::TopKOp<decltype(in)>(in, k, dir);
+}
+
+}
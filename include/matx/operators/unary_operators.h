@@ -104,7 +104,12 @@ namespace matx
     __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
     {
       auto i1 = get_value<CapType>(in1_, indices...);
-      return op_.template operator()<CapType>(i1);
+      if constexpr (cap_fast_math_v<CapType>) {
+        return scalar_fast_math<CapType>(op_, i1);
+      }
+      else {
+        return op_.template operator()<CapType>(i1);
+      }
     }
 
     template <typename... Is>
@@ -189,6 +194,9 @@ namespace matx
         return false;
 #endif
       }
+      else if constexpr (Cap == OperatorCapability::FLOPS_PER_ELEMENT) {
+        return combine_capabilities<Cap>(uint64_t{1}, detail::get_operator_capability<Cap>(in1_, in));
+      }
       else if constexpr (Cap == OperatorCapability::DYN_SHM_SIZE) {
         return detail::get_operator_capability<Cap>(in1_, in);
       }
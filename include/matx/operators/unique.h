@@ -36,6 +36,7 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/cub.h"
+#include "matx/transforms/groupby.h"
 
 namespace matx {
 
@@ -47,6 +48,7 @@ namespace detail {
   {
     private:
       typename detail::base_type_t<OpA> a_;
+      UniqueMode mode_;
 
     public:
       using matxop = bool;
@@ -55,8 +57,8 @@ namespace detail {
       using unique_xform_op = bool;
 
       __MATX_INLINE__ std::string str() const { return "unique()"; }
-      __MATX_INLINE__ UniqueOp(const OpA &a) : a_(a) {
-        MATX_LOG_TRACE("{} constructor: rank={}", str(), Rank());
+      __MATX_INLINE__ UniqueOp(const OpA &a, UniqueMode mode) : a_(a), mode_(mode) {
+        MATX_LOG_TRACE("{} constructor: rank={}, mode={}", str(), Rank(), static_cast<int>(mode));
       };
 
       // This should never be called
@@ -85,6 +87,14 @@ namespace detail {
       void Exec(Out &&out, Executor &&ex) const {
         static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 3, "Must use mtie with 2 outputs on unique(). ie: (mtie(O, num_found) = unique(A))");     
 
+        if constexpr (is_cuda_executor_v<Executor>) {
+          if (mode_ == UniqueMode::UNORDERED) {
+            unique_unordered_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, ex);
+            return;
+          }
+        }
+
+        // Sorted output is also a valid unordered result
         unique_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), a_, ex);
       }
 
@@ -113,15 +123,22 @@ namespace detail {
  * hold unique entries. To be safe, this can be the same size as the input, but if something is known about
  * the data to indicate not as many entries are needed, the output can be smaller.
  *
+ * With UniqueMode::UNORDERED the CUDA executor skips sorting the input and
+ * instead inserts every value into a device hash table, returning the unique
+ * values in an arbitrary order. This is much faster for large inputs when the
+ * order does not matter.
+ *
  * @tparam InputOperator
  *   Input type
  * @param a
  *   Input tensor
+ * @param mode
+ *   Whether the output must be sorted
  * @returns Two operators, the first representing the unique items, and the second representing how many items were found
  */
 template<typename OpA>
-__MATX_INLINE__ auto unique(const OpA &a) {
-  return detail::UniqueOp(a);
+__MATX_INLINE__ auto unique(const OpA &a, UniqueMode mode = UniqueMode::SORTED) {
+  return detail::UniqueOp(a, mode);
 }
 
 }
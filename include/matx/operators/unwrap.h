@@ -34,17 +34,24 @@
 
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
+#include "matx/operators/binary_operators.h"
 #include "matx/operators/scalar_internal.h"
+#include "matx/operators/scan.h"
 
 namespace matx {
 namespace detail {
+/**
+ * Per-sample phase correction of unwrap(). Element i along the axis is the
+ * multiple of the period removed from the jump between samples i-1 and i, so
+ * the running sum of this operator along the axis is the total correction.
+ */
 template <typename OpA, typename MathType>
-class UnwrapOp : public BaseOp<UnwrapOp<OpA, MathType>> {
+class UnwrapCorrectionOp : public BaseOp<UnwrapCorrectionOp<OpA, MathType>> {
 public:
   using matxop = bool;
   using value_type = typename OpA::value_type;
 
-  __MATX_INLINE__ UnwrapOp(const OpA &op, int axis, MathType discont, MathType period)
+  __MATX_INLINE__ UnwrapCorrectionOp(const OpA &op, int axis, MathType discont, MathType period)
       : op_(op), discont_(discont), period_(period), half_period_(period / static_cast<MathType>(2)) {
     static_assert(cuda::std::is_floating_point_v<MathType>,
                   "unwrap() requires a floating-point input");
@@ -78,80 +85,41 @@ public:
     }
   }
 
-  __MATX_INLINE__ std::string str() const { return "unwrap(" + op_.str() + ")"; }
+  __MATX_INLINE__ std::string str() const { return "unwrap_correction(" + op_.str() + ")"; }
+
+  __MATX_INLINE__ __MATX_HOST__ int Axis() const { return axis_; }
 
   template <typename CapType, typename... Is>
   __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto operator()(Is... indices) const {
     if constexpr (Rank() == 0) {
-      return get_value<CapType>(op_);
+      return static_cast<value_type>(0);
     }
     else {
-      constexpr index_t EPT = static_cast<index_t>(CapType::ept);
-      auto get_lane_scalar = [](const auto &v, index_t lane) {
-        if constexpr (CapType::ept == ElementsPerThread::ONE) {
-          (void)lane;
-          return static_cast<MathType>(v);
-        }
-        else {
-          return static_cast<MathType>(v.data[lane]);
-        }
-      };
-
       cuda::std::array<index_t, Rank()> idx{indices...};
-      const index_t out_idx = idx[axis_];
-      const auto cur = get_value<CapType>(op_, idx);
-      cuda::std::array<MathType, static_cast<size_t>(EPT)> correction{};
-
-      if (out_idx != 0) {
-        cuda::std::array<index_t, Rank()> seq_idx = idx;
-        seq_idx[axis_] = 0;
-        auto prev = get_value<CapType>(op_, seq_idx);
-        const MathType neg_half_period = -half_period_;
-
-        for (index_t i = 1; i <= out_idx; i++) {
-          seq_idx[axis_] = i;
-          const auto next = get_value<CapType>(op_, seq_idx);
-
-          MATX_LOOP_UNROLL
-          for (index_t lane = 0; lane < EPT; lane++) {
-            const MathType next_s = get_lane_scalar(next, lane);
-            const MathType prev_s = get_lane_scalar(prev, lane);
-            const MathType delta = next_s - prev_s;
-
-            MathType delta_mod =
-                static_cast<MathType>(scalar_internal_fmod(delta + half_period_, period_));
-            if (delta_mod < static_cast<MathType>(0)) {
-              delta_mod += period_;
-            }
-            delta_mod -= half_period_;
-
-            if (delta_mod == neg_half_period && delta > static_cast<MathType>(0)) {
-              delta_mod = half_period_;
-            }
-
-            MathType phase_correction = delta_mod - delta;
-            if (cuda::std::abs(delta) < discont_) {
-              phase_correction = static_cast<MathType>(0);
-            }
-
-            correction[static_cast<size_t>(lane)] += phase_correction;
-          }
-          prev = next;
-        }
+      if (idx[axis_] == 0) {
+        return static_cast<value_type>(0);
+      }
+
+      const MathType cur = static_cast<MathType>(get_value<CapType>(op_, idx));
+      idx[axis_]--;
+      const MathType prev = static_cast<MathType>(get_value<CapType>(op_, idx));
+      const MathType delta = cur - prev;
+
+      MathType delta_mod =
+          static_cast<MathType>(scalar_internal_fmod(delta + half_period_, period_));
+      if (delta_mod < static_cast<MathType>(0)) {
+        delta_mod += period_;
       }
+      delta_mod -= half_period_;
 
-      if constexpr (CapType::ept == ElementsPerThread::ONE) {
-        return static_cast<value_type>(get_lane_scalar(cur, 0) + correction[0]);
+      if (delta_mod == -half_period_ && delta > static_cast<MathType>(0)) {
+        delta_mod = half_period_;
       }
-      else {
-        Vector<value_type, EPT> out{};
-        MATX_LOOP_UNROLL
-        for (index_t lane = 0; lane < EPT; lane++) {
-          out.data[lane] = static_cast<value_type>(
-              get_lane_scalar(cur, lane) + correction[static_cast<size_t>(lane)]);
-        }
-        return out;
+
+      if (cuda::std::abs(delta) < discont_) {
+        return static_cast<value_type>(0);
       }
+      return static_cast<value_type>(delta_mod - delta);
     }
   }
 
@@ -209,7 +177,10 @@ private:
  * @brief Unwrap phase angles by correcting jumps greater than a discontinuity.
  *
  * This implementation follows NumPy's `unwrap` behavior, including support
- * for custom period and discont values.
+ * for custom period and discont values. The correction for each jump only
+ * depends on two adjacent samples, and the unwrapped output is the input plus
+ * an inclusive scan of those corrections along the axis. Long axes therefore
+ * run on the parallel look-back scan rather than a sequential walk.
  *
  * @tparam Op Input operator/tensor type
  * @param op Input operator
@@ -226,14 +197,20 @@ __MATX_INLINE__ auto unwrap(
     detail::value_promote_t<typename Op::value_type> period =
         static_cast<detail::value_promote_t<typename Op::value_type>>(
             cuda::std::numbers::pi_v<detail::value_promote_t<typename Op::value_type>> * 2)) {
-  MATX_NVTX_START("unwrap(" + get_type_str(op) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("unwrap(" + get_type_str(op) + ")", matx::MATX_NVTX_LOG_API)
   using math_type = detail::value_promote_t<typename Op::value_type>;
   const math_type period_in = static_cast<math_type>(period);
   const math_type default_discont = period_in / static_cast<math_type>(2);
   const math_type discont_in =
       (discont < static_cast<math_type>(0)) ? default_discont
                                             : static_cast<math_type>(discont);
-  return detail::UnwrapOp<Op, math_type>(op, axis, discont_in, period_in);
+  const auto correction = detail::UnwrapCorrectionOp<Op, math_type>(op, axis, discont_in, period_in);
+  if constexpr (Op::Rank() == 0) {
+    return op + correction;
+  }
+  else {
+    return op + scan(correction, correction.Axis());
+  }
 }
 
 } // namespace matx
@@ -0,0 +1,329 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cusparse.h>
+
+#include <algorithm>
+
+#include "matx/core/cache.h"
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/transforms/convert/dense2sparse_cusparse.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Parameters needed to execute a cuSPARSE sparse + sparse addition.
+ */
+struct SparseAddParams_t {
+  MatXDataType_t dtype;
+  cudaStream_t stream;
+  index_t nseA;
+  index_t nseB;
+  index_t m;
+  index_t n;
+  // The sparsity patterns of A and B determine the pattern of C. The output
+  // is identified by its row positions, since its coordinates and values are
+  // (re)allocated when the plan is created.
+  void *ptrA2;
+  void *ptrA4;
+  void *ptrB2;
+  void *ptrB4;
+  void *ptrC2;
+};
+
+/**
+ * Sparse + sparse addition plan based on the cuSPARSE csrgeam2 API
+ *
+ * Creating the plan computes the union of the sparsity patterns of A and B,
+ * and allocates the coordinates and values of C for it. Executing the plan
+ * computes C = alpha * A + beta * B for the current values of A and B.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+class SparseAddHandle_t {
+public:
+  using TC = typename TensorTypeC::value_type;
+  using VAL = typename TensorTypeC::val_type;
+  using CRD = typename TensorTypeC::crd_type;
+  using T = std::conditional_t<
+      std::is_same_v<TC, cuda::std::complex<double>>, cuDoubleComplex,
+      std::conditional_t<std::is_same_v<TC, cuda::std::complex<float>>,
+                         cuFloatComplex, TC>>;
+
+  SparseAddHandle_t(TensorTypeC &c, const TensorTypeA &a, const TensorTypeB &b,
+                    cudaStream_t stream) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    params_ = GetAddParams(c, a, b, stream);
+
+    [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+    ret = cusparseSetStream(handle_, stream);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+    ret = cusparseCreateMatDescr(&descr_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+    cusparseSetMatType(descr_, CUSPARSE_MATRIX_TYPE_GENERAL);
+    cusparseSetMatIndexBase(descr_, CUSPARSE_INDEX_BASE_ZERO);
+
+    // Workspace, queried with unit scalars (only the structure matters).
+    const T one = Unit();
+    ret = Geam(&one, a, &one, b, c, true);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+    matxAlloc(&buffer_, std::max(bufferSize_, size_t{1}),
+              MATX_ASYNC_DEVICE_MEMORY, stream);
+
+    // Pattern union, which determines the nnz of C.
+    int nnz = 0;
+    ret = cusparseXcsrgeam2Nnz(
+        handle_, M(), N(), descr_, NseA(), a.POSData(1), a.CRDData(1), descr_,
+        NseB(), b.POSData(1), b.CRDData(1), descr_, c.POSData(1), &nnz,
+        buffer_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+
+    // Allocate the output in the memory space of its row positions.
+    matxMemorySpace_t space = GetPointerKind(params_.ptrC2);
+    c.SetVal(makeDefaultNonOwningStorage<VAL>(nnz, space, stream));
+    c.SetCrd(1, makeDefaultNonOwningStorage<CRD>(nnz, space, stream));
+    c.SetSparseDataImpl();
+  }
+
+  ~SparseAddHandle_t() {
+    matxFree(buffer_, params_.stream);
+    cusparseDestroyMatDescr(descr_);
+    cusparseDestroy(handle_);
+  }
+
+  static detail::SparseAddParams_t GetAddParams(TensorTypeC &c,
+                                                const TensorTypeA &a,
+                                                const TensorTypeB &b,
+                                                cudaStream_t stream) {
+    detail::SparseAddParams_t params;
+    params.dtype = TypeToInt<VAL>();
+    params.stream = stream;
+    params.nseA = a.Nse();
+    params.nseB = b.Nse();
+    params.m = a.Size(0);
+    params.n = a.Size(1);
+    params.ptrA2 = a.POSData(1);
+    params.ptrA4 = a.CRDData(1);
+    params.ptrB2 = b.POSData(1);
+    params.ptrB4 = b.CRDData(1);
+    params.ptrC2 = c.POSData(1);
+    return params;
+  }
+
+  // Numeric phase, using the current values of A and B.
+  __MATX_INLINE__ void Exec(TensorTypeC &c, const TensorTypeA &a,
+                            const TensorTypeB &b, float alpha, float beta) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
+    const T salpha = Scalar(alpha);
+    const T sbeta = Scalar(beta);
+    [[maybe_unused]] cusparseStatus_t ret = Geam(&salpha, a, &sbeta, b, c, false);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+  }
+
+private:
+  int M() const { return static_cast<int>(params_.m); }
+  int N() const { return static_cast<int>(params_.n); }
+  int NseA() const { return static_cast<int>(params_.nseA); }
+  int NseB() const { return static_cast<int>(params_.nseB); }
+
+  static T Scalar(float s) {
+    if constexpr (std::is_same_v<T, cuFloatComplex>) {
+      return make_cuFloatComplex(s, 0.0f);
+    } else if constexpr (std::is_same_v<T, cuDoubleComplex>) {
+      return make_cuDoubleComplex(s, 0.0);
+    } else {
+      return static_cast<T>(s);
+    }
+  }
+
+  static T Unit() { return Scalar(1.0f); }
+
+  // Dispatches to the typed csrgeam2 routine, or to its workspace query.
+  cusparseStatus_t Geam(const T *alpha, const TensorTypeA &a, const T *beta,
+                        const TensorTypeB &b, TensorTypeC &c, bool query) {
+    const T *va = reinterpret_cast<const T *>(a.Data());
+    const T *vb = reinterpret_cast<const T *>(b.Data());
+    T *vc = reinterpret_cast<T *>(c.Data());
+    const int *pa = a.POSData(1);
+    const int *ca = a.CRDData(1);
+    const int *pb = b.POSData(1);
+    const int *cb = b.CRDData(1);
+    int *pc = c.POSData(1);
+    int *cc = c.CRDData(1);
+    if constexpr (std::is_same_v<T, float>) {
+      return query ? cusparseScsrgeam2_bufferSizeExt(
+                         handle_, M(), N(), alpha, descr_, NseA(), va, pa, ca,
+                         beta, descr_, NseB(), vb, pb, cb, descr_, vc, pc, cc,
+                         &bufferSize_)
+                   : cusparseScsrgeam2(handle_, M(), N(), alpha, descr_,
+                                       NseA(), va, pa, ca, beta, descr_,
+                                       NseB(), vb, pb, cb, descr_, vc, pc, cc,
+                                       buffer_);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return query ? cusparseDcsrgeam2_bufferSizeExt(
+                         handle_, M(), N(), alpha, descr_, NseA(), va, pa, ca,
+                         beta, descr_, NseB(), vb, pb, cb, descr_, vc, pc, cc,
+                         &bufferSize_)
+                   : cusparseDcsrgeam2(handle_, M(), N(), alpha, descr_,
+                                       NseA(), va, pa, ca, beta, descr_,
+                                       NseB(), vb, pb, cb, descr_, vc, pc, cc,
+                                       buffer_);
+    } else if constexpr (std::is_same_v<T, cuFloatComplex>) {
+      return query ? cusparseCcsrgeam2_bufferSizeExt(
+                         handle_, M(), N(), alpha, descr_, NseA(), va, pa, ca,
+                         beta, descr_, NseB(), vb, pb, cb, descr_, vc, pc, cc,
+                         &bufferSize_)
+                   : cusparseCcsrgeam2(handle_, M(), N(), alpha, descr_,
+                                       NseA(), va, pa, ca, beta, descr_,
+                                       NseB(), vb, pb, cb, descr_, vc, pc, cc,
+                                       buffer_);
+    } else {
+      return query ? cusparseZcsrgeam2_bufferSizeExt(
+                         handle_, M(), N(), alpha, descr_, NseA(), va, pa, ca,
+                         beta, descr_, NseB(), vb, pb, cb, descr_, vc, pc, cc,
+                         &bufferSize_)
+                   : cusparseZcsrgeam2(handle_, M(), N(), alpha, descr_,
+                                       NseA(), va, pa, ca, beta, descr_,
+                                       NseB(), vb, pb, cb, descr_, vc, pc, cc,
+                                       buffer_);
+    }
+  }
+
+  cusparseHandle_t handle_ = nullptr;
+  cusparseMatDescr_t descr_ = nullptr;
+  size_t bufferSize_ = 0;
+  void *buffer_ = nullptr;
+  detail::SparseAddParams_t params_;
+};
+
+/**
+ * Crude hash on sparse addition to get a reasonably good delta for
+ * collisions. This doesn't need to be perfect, but fast enough to not slow
+ * down lookups, and different enough so the common parameters change.
+ */
+struct SparseAddParamsKeyHash {
+  std::size_t operator()(const SparseAddParams_t &k) const noexcept {
+    return std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA2)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrB2)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrC2)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.stream));
+  }
+};
+
+/**
+ * Test sparse addition parameters for equality. Unlike the hash, all
+ * parameters must match exactly to ensure the hashed plan can be reused.
+ */
+struct SparseAddParamsKeyEq {
+  bool operator()(const SparseAddParams_t &l,
+                  const SparseAddParams_t &t) const noexcept {
+    return l.dtype == t.dtype && l.stream == t.stream && l.nseA == t.nseA &&
+           l.nseB == t.nseB && l.m == t.m && l.n == t.n &&
+           l.ptrA2 == t.ptrA2 && l.ptrA4 == t.ptrA4 && l.ptrB2 == t.ptrB2 &&
+           l.ptrB4 == t.ptrB4 && l.ptrC2 == t.ptrC2;
+  }
+};
+
+using sparse_add_cache_t =
+    std::unordered_map<SparseAddParams_t, std::any, SparseAddParamsKeyHash,
+                       SparseAddParamsKeyEq>;
+
+} // end namespace detail
+
+/**
+ * Sparse + sparse addition C = alpha * A + beta * B with CSR operands
+ *
+ * The output C must be a CSR tensor whose row positions are allocated
+ * (e.g. from make_zero_tensor_csr). Its coordinates and values are
+ * allocated for the union of the sparsity patterns of A and B.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+void sparse_add_impl(TensorTypeC &c, const TensorTypeA &a,
+                     const TensorTypeB &b, const cudaExecutor &exec,
+                     float alpha = 1.0, float beta = 1.0) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  const auto stream = exec.getStream();
+
+  using TA = typename TensorTypeA::value_type;
+  using TB = typename TensorTypeB::value_type;
+  using TC = typename TensorTypeC::value_type;
+
+  // Restrictions.
+  static_assert(TensorTypeA::Rank() == 2 && TensorTypeB::Rank() == 2 &&
+                    TensorTypeC::Rank() == 2,
+                "tensors must have rank-2");
+  static_assert(TensorTypeA::Format::isCSR() && TensorTypeB::Format::isCSR() &&
+                    TensorTypeC::Format::isCSR(),
+                "sparse addition currently only supports CSR");
+  static_assert(std::is_same_v<TC, TA> && std::is_same_v<TC, TB>,
+                "tensors must have the same data type");
+  static_assert(std::is_same_v<TC, float> || std::is_same_v<TC, double> ||
+                    std::is_same_v<TC, cuda::std::complex<float>> ||
+                    std::is_same_v<TC, cuda::std::complex<double>>,
+                "unsupported data type");
+  static_assert(std::is_same_v<typename TensorTypeA::pos_type, int32_t> &&
+                    std::is_same_v<typename TensorTypeA::crd_type, int32_t> &&
+                    std::is_same_v<typename TensorTypeB::pos_type, int32_t> &&
+                    std::is_same_v<typename TensorTypeB::crd_type, int32_t> &&
+                    std::is_same_v<typename TensorTypeC::pos_type, int32_t> &&
+                    std::is_same_v<typename TensorTypeC::crd_type, int32_t>,
+                "unsupported index type");
+  MATX_ASSERT(a.Size(0) == b.Size(0) && a.Size(1) == b.Size(1) &&
+                  a.Size(0) == c.Size(0) && a.Size(1) == c.Size(1),
+              matxInvalidSize);
+  MATX_ASSERT_STR(c.POSData(1) != nullptr, matxInvalidParameter,
+                  "sparse addition output needs allocated row positions");
+
+  // Get parameters required by these tensors (for caching).
+  using cache_val_type =
+      detail::SparseAddHandle_t<TensorTypeC, TensorTypeA, TensorTypeB>;
+  auto params = cache_val_type::GetAddParams(c, a, b, stream);
+
+  // Lookup and cache.
+  auto cache_id = detail::GetCacheIdFromType<detail::sparse_add_cache_t>();
+  MATX_LOG_DEBUG("Sparse add transform: cache_id={}", cache_id);
+  detail::GetCache().LookupAndExec<detail::sparse_add_cache_t>(
+      cache_id, params,
+      [&]() { return std::make_shared<cache_val_type>(c, a, b, stream); },
+      [&](std::shared_ptr<cache_val_type> cache_type) {
+        cache_type->Exec(c, a, b, alpha, beta);
+      },
+      exec);
+}
+
+} // end namespace matx
@@ -204,13 +204,163 @@ public:
   }
 };
 
+/**
+ * Lag products of a batch of normalized signal pairs, zero-padded to the Doppler FFT size
+ *
+ * Element (b, d, n) is y(b, n) * conj(x(b, n - (N - 1) + d)) for n < N, and zero where either index
+ * falls outside the signals or n is in the padding. An inverse FFT along the last dimension gives
+ * the Doppler spectrum of delay d for pair b. Because it's an element-wise operator, it can be fed
+ * straight into cuFFT's loads so the products are never written to memory.
+ */
+template <typename XOp, typename YOp>
+class AmbgLagProductOp : public BaseOp<AmbgLagProductOp<XOp, YOp>> {
+private:
+  typename detail::base_type_t<XOp> x_;
+  typename detail::base_type_t<YOp> y_;
+  index_t nfreq_;
+
+public:
+  using matxop = bool;
+  using value_type = typename XOp::value_type;
+
+#ifdef MATX_EN_JIT
+  struct JIT_Storage {
+    typename detail::inner_storage_or_self_t<detail::base_type_t<XOp>> x_;
+    typename detail::inner_storage_or_self_t<detail::base_type_t<YOp>> y_;
+  };
+
+  JIT_Storage ToJITStorage() const {
+    return JIT_Storage{detail::to_jit_storage(x_), detail::to_jit_storage(y_)};
+  }
+
+  __MATX_INLINE__ std::string get_jit_class_name() const {
+    return std::format("JITAmbgLagProduct_b{}_n{}_f{}", Size(0), x_.Size(1), nfreq_);
+  }
+
+  __MATX_INLINE__ auto get_jit_op_str() const {
+    const std::string func_name = get_jit_class_name();
+    return cuda::std::make_tuple(
+      func_name,
+      std::format("template <typename XT, typename YT> struct {} {{\n"
+          "  using value_type = typename XT::value_type;\n"
+          "  using matxop = bool;\n"
+          "  constexpr static index_t batches_ = {};\n"
+          "  constexpr static index_t n_ = {};\n"
+          "  constexpr static index_t nfreq_ = {};\n"
+          "  typename detail::inner_storage_or_self_t<detail::base_type_t<XT>> x_;\n"
+          "  typename detail::inner_storage_or_self_t<detail::base_type_t<YT>> y_;\n"
+          "  template <typename CapType>\n"
+          "  __MATX_INLINE__ __MATX_DEVICE__ value_type operator()(index_t b, index_t d, index_t n) const\n"
+          "  {{\n"
+          "    const index_t xcol = n - (n_ - 1) + d;\n"
+          "    if (n < n_ && xcol >= 0 && xcol < n_) {{\n"
+          "      return y_.template operator()<CapType>(b, n) * cuda::std::conj(x_.template operator()<CapType>(b, xcol));\n"
+          "    }}\n"
+          "    return value_type{{0, 0}};\n"
+          "  }}\n"
+          "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return 3; }}\n"
+          "  constexpr __MATX_INLINE__ __MATX_DEVICE__ index_t Size(int dim) const\n"
+          "  {{\n"
+          "    return dim == 0 ? batches_ : (dim == 1 ? 2 * n_ - 1 : nfreq_);\n"
+          "  }}\n"
+          "}};\n",
+          func_name, Size(0), x_.Size(1), nfreq_)
+    );
+  }
+#endif
+
+  __MATX_INLINE__ std::string str() const { return "ambg_lag_product(" + get_type_str(x_) + "," + get_type_str(y_) + ")"; }
+
+  AmbgLagProductOp(const XOp &x, const YOp &y, index_t nfreq) : x_(x), y_(y), nfreq_(nfreq)
+  {
+  }
+
+  template <typename CapType>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(index_t b, index_t d, index_t n) const
+  {
+    if constexpr (CapType::ept == ElementsPerThread::ONE) {
+      const index_t len = x_.Size(1);
+      const index_t xcol = n - (len - 1) + d;
+      if (n < len && xcol >= 0 && xcol < len) {
+        return y_.template operator()<CapType>(b, n) * cuda::std::conj(x_.template operator()<CapType>(b, xcol));
+      }
+      return value_type{0, 0};
+    }
+    else {
+      return value_type{0, 0};
+    }
+  }
+
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(index_t b, index_t d, index_t n) const
+  {
+    return this->template operator()<DefaultCapabilities>(b, d, n);
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const noexcept
+  {
+    return dim == 0 ? x_.Size(0) : (dim == 1 ? 2 * x_.Size(1) - 1 : nfreq_);
+  }
+
+  static inline constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+  {
+    return 3;
+  }
+
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+    if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
+#ifdef MATX_EN_JIT
+      const auto x_jit_name = detail::get_operator_capability<Cap>(x_, in);
+      const auto y_jit_name = detail::get_operator_capability<Cap>(y_, in);
+      return std::format("{}<{},{}>", get_jit_class_name(), x_jit_name, y_jit_name);
+#else
+      return "";
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+#ifdef MATX_EN_JIT
+      return combine_capabilities<Cap>(true,
+          detail::get_operator_capability<Cap>(x_, in),
+          detail::get_operator_capability<Cap>(y_, in));
+#else
+      return false;
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::JIT_CLASS_QUERY) {
+#ifdef MATX_EN_JIT
+      const auto [key, value] = get_jit_op_str();
+      if (in.find(key) == in.end()) {
+        in[key] = value;
+      }
+      detail::get_operator_capability<Cap>(x_, in);
+      detail::get_operator_capability<Cap>(y_, in);
+      return true;
+#else
+      return false;
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+      const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+      return combine_capabilities<Cap>(my_cap,
+          detail::get_operator_capability<Cap>(x_, in),
+          detail::get_operator_capability<Cap>(y_, in));
+    }
+    else {
+      auto self_has_cap = capability_attributes<Cap>::default_value;
+      return combine_capabilities<Cap>(self_has_cap,
+          detail::get_operator_capability<Cap>(x_, in),
+          detail::get_operator_capability<Cap>(y_, in));
+    }
+  }
+};
+
 template <typename AMFTensor, typename XTensor, typename YTensor>
 void ambgfun_impl(AMFTensor &amf, XTensor &x,
                      YTensor &y,
                      [[maybe_unused]] double fs, ::matx::AMBGFunCutType_t cut,
                      [[maybe_unused]] float cut_val, cudaStream_t stream = 0)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   
   constexpr int RANK = XTensor::Rank();
   using T1 = typename XTensor::value_type;
@@ -322,6 +472,78 @@ void ambgfun_impl(AMFTensor &amf, XTensor &x,
   }
 }
 
+
+/**
+ * Batched cross-ambiguity surfaces restricted to a band of Doppler bins
+ *
+ * Each row of x and y is a reference/surveillance pair of length N. Row b of amf holds the
+ * (2N - 1) x num_doppler magnitude surface of pair b, where the Doppler columns are bins
+ * [doppler_start, doppler_start + num_doppler) of the fftshifted axis used by the 2D cut of
+ * ambgfun(). Both signals are normalized to unit energy.
+ *
+ * Pairs are processed in chunks so a single batched cuFFT plan covers many pairs at once. The lag
+ * products are fused into cuFFT's loads when LTO callbacks are available, and otherwise written
+ * in place into the spectrum buffer, so the only full-size intermediate is one chunk of spectra.
+ */
+template <typename AMFTensor, typename XOp, typename YOp>
+void ambgfun_batched_impl(AMFTensor &amf, const XOp &x, const YOp &y, index_t doppler_start, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  using T1 = typename XOp::value_type;
+  MATX_STATIC_ASSERT_STR(is_cuda_complex_v<T1>, matxInvalidType, "ambgfun_batched: inputs must be complex float");
+  MATX_STATIC_ASSERT_STR(XOp::Rank() == 2 && YOp::Rank() == 2, matxInvalidDim, "ambgfun_batched: inputs must be 2D");
+  MATX_STATIC_ASSERT_STR(AMFTensor::Rank() == 3, matxInvalidDim, "ambgfun_batched: output must be 3D");
+
+  const auto stream = exec.getStream();
+  const index_t batches = x.Size(0);
+  const index_t len = x.Size(1);
+  const index_t lags = 2 * len - 1;
+  const index_t nfreq = static_cast<index_t>(
+      powf(2.0, static_cast<float>(std::ceil(std::log2(lags)))));
+  const index_t num_doppler = amf.Size(2);
+
+  MATX_ASSERT_STR(y.Size(0) == batches && y.Size(1) == len, matxInvalidSize,
+      "ambgfun_batched: x and y must have the same shape");
+  MATX_ASSERT_STR(amf.Size(0) == batches && amf.Size(1) == lags, matxInvalidSize,
+      "ambgfun_batched: output must be batches x (2N - 1) x num_doppler");
+  MATX_ASSERT_STR(doppler_start >= 0 && num_doppler > 0 && doppler_start + num_doppler <= nfreq, matxInvalidParameter,
+      "ambgfun_batched: Doppler window must lie within the Doppler FFT size");
+
+  auto xn = make_tensor<T1>({batches, len}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto yn = make_tensor<T1>({batches, len}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto norm = make_tensor<float>({batches}, MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  (norm = sqrt(sum(abs2(x), {1}))).run(exec);
+  (xn = x / clone<2>(norm, {matxKeepDim, len})).run(exec);
+  (norm = sqrt(sum(abs2(y), {1}))).run(exec);
+  (yn = y / clone<2>(norm, {matxKeepDim, len})).run(exec);
+
+  // Bound the spectrum buffer so very large batches don't exhaust device memory
+  constexpr size_t max_chunk_bytes = size_t{1} << 30;
+  const size_t pair_bytes = static_cast<size_t>(lags) * static_cast<size_t>(nfreq) * sizeof(T1);
+  const index_t chunk = std::max<index_t>(1, std::min<index_t>(batches, static_cast<index_t>(max_chunk_bytes / pair_bytes)));
+
+  auto spectra = make_tensor<T1>({chunk, lags, nfreq}, MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  for (index_t b0 = 0; b0 < batches; b0 += chunk) {
+    const index_t b1 = std::min(batches, b0 + chunk);
+    auto xs = slice<2>(xn, {b0, 0}, {b1, matxEnd});
+    auto ys = slice<2>(yn, {b0, 0}, {b1, matxEnd});
+    auto spec = slice<3>(spectra, {0, 0, 0}, {b1 - b0, matxEnd, matxEnd});
+    auto lag = AmbgLagProductOp(xs, ys, nfreq);
+
+    if (!fft_load_callback_impl(spec, lag, 0, FFTNorm::BACKWARD, FFTDirection::BACKWARD, exec)) {
+      (spec = lag).run(exec);
+      ifft_impl(spec, spec, 0, FFTNorm::BACKWARD, exec);
+    }
+
+    auto amf_chunk = slice<3>(amf, {b0, 0, 0}, {b1, matxEnd, matxEnd});
+    auto window = slice<3>(fftshift1D(spec), {0, 0, doppler_start}, {matxEnd, matxEnd, doppler_start + num_doppler});
+    (amf_chunk = static_cast<float>(nfreq) * abs(window)).run(exec);
+  }
+}
+
 }
 
 }; // namespace matx
@@ -0,0 +1,364 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "matx/core/allocator.h"
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/cuda.h"
+#include "matx/executors/host.h"
+#include "matx/kernels/cfar.cuh"
+#include "matx/transforms/cub.h"
+
+namespace matx {
+
+namespace detail {
+
+template <typename T>
+using cfar_power_t = typename inner_op_type_t<T>::type;
+
+// Probability of false alarm of a detector with threshold factor alpha and n training
+// cells, assuming exponentially distributed (square-law detected Gaussian) clutter
+inline double cfar_pfa(const CFARParams &p, index_t n, double alpha) {
+  const double dn = static_cast<double>(n);
+  switch (p.type) {
+    case CFARType::CA:
+      return std::pow(1.0 + alpha / dn, -dn);
+    case CFARType::OS: {
+      const index_t k = cfar_os_rank(p, n);
+      double pfa = 1.0;
+      for (index_t i = 0; i < k; i++) {
+        pfa *= (dn - static_cast<double>(i)) / (dn - static_cast<double>(i) + alpha);
+      }
+      return pfa;
+    }
+    default: {
+      // GO and SO on two halves of m cells each, with alpha applied to the mean of a half
+      const index_t m = std::max(index_t{1}, n / 2);
+      const double dm = static_cast<double>(m);
+      const double t = alpha / dm;
+      double s = 0.0;
+      for (index_t j = 0; j < m; j++) {
+        const double dj = static_cast<double>(j);
+        s += std::exp(std::lgamma(dm + dj) - std::lgamma(dj + 1.0) - std::lgamma(dm) - (dm + dj) * std::log(2.0 + t));
+      }
+      return p.type == CFARType::SO ? 2.0 * s : 2.0 * std::pow(1.0 + t, -dm) - 2.0 * s;
+    }
+  }
+}
+
+/**
+ * Threshold factor for every possible number of training cells
+ *
+ * Entry n holds the factor that gives the requested false alarm rate with n valid
+ * training cells. CA uses the closed form, and the other detectors are solved by
+ * bisection since their false alarm rate falls monotonically with alpha.
+ */
+template <typename P>
+std::vector<P> cfar_alpha_table(const CFARParams &p) {
+  const index_t nmax = cfar_max_cells(p);
+  std::vector<P> alpha(static_cast<size_t>(nmax + 1), P(0));
+  for (index_t n = 1; n <= nmax; n++) {
+    if (p.type == CFARType::CA) {
+      const double dn = static_cast<double>(n);
+      alpha[n] = static_cast<P>(dn * (std::pow(p.pfa, -1.0 / dn) - 1.0));
+      continue;
+    }
+
+    double lo = 0.0;
+    double hi = 1.0;
+    while (cfar_pfa(p, n, hi) > p.pfa && hi < 1e30) {
+      hi *= 2.0;
+    }
+    for (int it = 0; it < 100; it++) {
+      const double mid = 0.5 * (lo + hi);
+      if (cfar_pfa(p, n, mid) > p.pfa) {
+        lo = mid;
+      }
+      else {
+        hi = mid;
+      }
+    }
+    alpha[n] = static_cast<P>(hi);
+  }
+
+  return alpha;
+}
+
+// The window only slides along the last dimension of rank-1 inputs
+template <typename InType>
+CFARParams cfar_check_params(const InType &, CFARParams p) {
+  if constexpr (InType::Rank() == 1) {
+    p.guard_rows = 0;
+    p.train_rows = 0;
+  }
+
+  MATX_ASSERT_STR(p.guard_rows >= 0 && p.guard_cols >= 0 && p.train_rows >= 0 && p.train_cols >= 0,
+                  matxInvalidParameter, "cfar: guard and training sizes must not be negative");
+  MATX_ASSERT_STR(cfar_max_cells(p) > 0, matxInvalidParameter, "cfar: window has no training cells");
+  MATX_ASSERT_STR(p.pfa > 0.0 && p.pfa < 1.0, matxInvalidParameter, "cfar: pfa must be in (0, 1)");
+  MATX_ASSERT_STR(p.type != CFARType::OS || p.os_rank <= cfar_max_cells(p), matxInvalidParameter,
+                  "cfar: os_rank must not exceed the number of training cells");
+  return p;
+}
+
+template <typename Op>
+cuda::std::array<index_t, 3> cfar_dims(const Op &op) {
+  constexpr int RANK = Op::Rank();
+  index_t batches = 1;
+  for (int d = 0; d < RANK - 2; d++) {
+    batches *= op.Size(d);
+  }
+  return {batches, RANK >= 2 ? op.Size(RANK - 2) : 1, op.Size(RANK - 1)};
+}
+
+template <typename Op>
+cuda::std::array<index_t, Op::Rank()> cfar_shape(const Op &op) {
+  cuda::std::array<index_t, Op::Rank()> shape;
+  for (int d = 0; d < Op::Rank(); d++) {
+    shape[d] = op.Size(d);
+  }
+  return shape;
+}
+
+template <typename OutType, typename InType>
+void cfar_launch(OutType &out, const InType &in, const CFARParams &p, cudaStream_t stream) {
+#ifdef __CUDACC__
+  using P = cfar_power_t<typename InType::value_type>;
+  constexpr int tile_c = 32;
+  constexpr int block_r = 8;
+  constexpr size_t max_smem = 48 * 1024;
+
+  const auto [batches, rows, cols] = cfar_dims(in);
+  if (batches * rows * cols == 0) {
+    return;
+  }
+
+  const index_t hr = p.guard_rows + p.train_rows;
+  const index_t hc = p.guard_cols + p.train_cols;
+  auto smem_bytes = [&](index_t tr) {
+    return static_cast<size_t>((tr + 2 * hr) * (tile_c + 2 * hc)) * sizeof(P);
+  };
+
+  // Fewer rows per tile when the halo is large, down to one row per thread row
+  index_t tile_r = 2 * block_r;
+  while (tile_r > 1 && smem_bytes(tile_r) > max_smem) {
+    tile_r /= 2;
+  }
+  MATX_ASSERT_STR(smem_bytes(tile_r) <= max_smem, matxInvalidParameter,
+                  "cfar: training window is too large for the shared memory tile");
+
+  const auto alpha_host = cfar_alpha_table<P>(p);
+  P *alpha = nullptr;
+  matxAlloc(reinterpret_cast<void **>(&alpha), alpha_host.size() * sizeof(P), MATX_ASYNC_DEVICE_MEMORY, stream);
+  MATX_CUDA_CHECK(cudaMemcpyAsync(alpha, alpha_host.data(), alpha_host.size() * sizeof(P),
+                                  cudaMemcpyHostToDevice, stream));
+
+  const dim3 block(tile_c, block_r);
+  const dim3 grid(static_cast<unsigned int>((cols + tile_c - 1) / tile_c),
+                  static_cast<unsigned int>((rows + tile_r - 1) / tile_r),
+                  static_cast<unsigned int>(std::min(batches, index_t{65535})));
+
+  typename base_type_t<OutType> out_base = out;
+  const typename base_type_t<InType> in_base = in;
+  cfar_kernel<P><<<grid, block, smem_bytes(tile_r), stream>>>(out_base, in_base, batches, rows, cols,
+                                                                tile_r, p, alpha);
+  MATX_CUDA_CHECK_LAST_ERROR();
+
+  matxFree(alpha, stream);
+#endif
+}
+
+} // end namespace detail
+
+/**
+ * CFAR detection mask
+ *
+ * Writes 1 to every cell of out whose power exceeds the adaptive threshold set by the
+ * training cells around it, and 0 elsewhere. Power, the window statistics and the
+ * threshold test are computed in one tiled kernel.
+ *
+ * @tparam OutType
+ *   Output type
+ * @tparam InType
+ *   Input type
+ * @param out
+ *   Detection mask with the same shape as the input
+ * @param in
+ *   Input samples
+ * @param params
+ *   Detector parameters
+ * @param exec
+ *   CUDA executor
+ */
+template <typename OutType, typename InType>
+void cfar_impl(OutType &out, const InType &in, const CFARParams &params, const cudaExecutor &exec) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  static_assert(OutType::Rank() == InType::Rank(), "cfar: output rank must match the input rank");
+  for (int d = 0; d < InType::Rank(); d++) {
+    MATX_ASSERT_STR(out.Size(d) == in.Size(d), matxInvalidSize, "cfar: output shape must match the input shape");
+  }
+
+  const auto p = detail::cfar_check_params(in, params);
+  detail::cfar_launch(out, in, p, exec.getStream());
+}
+
+/**
+ * CFAR detection mask
+ *
+ * @tparam OutType
+ *   Output type
+ * @tparam InType
+ *   Input type
+ * @param out
+ *   Detection mask with the same shape as the input
+ * @param in
+ *   Input samples
+ * @param params
+ *   Detector parameters
+ * @param exec
+ *   Host executor
+ */
+template <typename OutType, typename InType, ThreadsMode MODE>
+void cfar_impl(OutType &out, const InType &in, const CFARParams &params, [[maybe_unused]] const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  static_assert(OutType::Rank() == InType::Rank(), "cfar: output rank must match the input rank");
+  using P = detail::cfar_power_t<typename InType::value_type>;
+
+  const auto p = detail::cfar_check_params(in, params);
+  const auto alpha = detail::cfar_alpha_table<P>(p);
+  const auto [batches, rows, cols] = detail::cfar_dims(in);
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t c = 0; c < cols; c++) {
+        auto load = [&](index_t dr, index_t dc, P &v) {
+          if (r + dr < 0 || r + dr >= rows || c + dc < 0 || c + dc >= cols) {
+            return false;
+          }
+          v = detail::cfar_power<P>(detail::cfar_access(in, b, r + dr, c + dc));
+          return true;
+        };
+
+        const bool det = detail::cfar_cell(load, detail::cfar_power<P>(detail::cfar_access(in, b, r, c)), p, alpha.data());
+        detail::cfar_access(out, b, r, c) = static_cast<typename OutType::value_type>(det ? 1 : 0);
+      }
+    }
+  }
+}
+
+/**
+ * CFAR detections compacted to a list of indices
+ *
+ * Runs the tiled CFAR kernel into a temporary mask and compacts it with the same
+ * stream compaction find_idx() uses, so detections come out as sorted linear indices
+ * into the input without a separate mask tensor.
+ *
+ * @tparam IdxType
+ *   Index output type
+ * @tparam CountType
+ *   Output count type
+ * @tparam InType
+ *   Input type
+ * @param idx_out
+ *   Linear indices of the detections. Must be large enough to hold every detection.
+ * @param num_found
+ *   Number of detections
+ * @param in
+ *   Input samples
+ * @param params
+ *   Detector parameters
+ * @param exec
+ *   CUDA executor
+ */
+template <typename IdxType, typename CountType, typename InType>
+void cfar_detections_impl(IdxType &idx_out, CountType &num_found, const InType &in, const CFARParams &params,
+                          const cudaExecutor &exec) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  const auto p = detail::cfar_check_params(in, params);
+  cudaStream_t stream = exec.getStream();
+
+  uint8_t *mask_ptr = nullptr;
+  matxAlloc(reinterpret_cast<void **>(&mask_ptr), TotalSize(in) * sizeof(uint8_t), MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto mask = make_tensor<uint8_t>(mask_ptr, detail::cfar_shape(in));
+
+  detail::cfar_launch(mask, in, p, stream);
+  find_idx_impl(idx_out, num_found, mask, NEQ<uint8_t>{0}, exec);
+
+  matxFree(mask_ptr, stream);
+}
+
+/**
+ * CFAR detections compacted to a list of indices
+ *
+ * @tparam IdxType
+ *   Index output type
+ * @tparam CountType
+ *   Output count type
+ * @tparam InType
+ *   Input type
+ * @param idx_out
+ *   Linear indices of the detections. Must be large enough to hold every detection.
+ * @param num_found
+ *   Number of detections
+ * @param in
+ *   Input samples
+ * @param params
+ *   Detector parameters
+ * @param exec
+ *   Host executor
+ */
+template <typename IdxType, typename CountType, typename InType, ThreadsMode MODE>
+void cfar_detections_impl(IdxType &idx_out, CountType &num_found, const InType &in, const CFARParams &params,
+                          const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  std::vector<uint8_t> mask_host(static_cast<size_t>(TotalSize(in)));
+  auto mask = make_tensor<uint8_t>(mask_host.data(), detail::cfar_shape(in));
+  cfar_impl(mask, in, params, exec);
+
+  index_t cnt = 0;
+  for (index_t i = 0; i < static_cast<index_t>(mask_host.size()); i++) {
+    if (mask_host[i] != 0) {
+      idx_out(cnt++) = static_cast<typename IdxType::value_type>(i);
+    }
+  }
+
+  num_found() = static_cast<typename CountType::value_type>(cnt);
+}
+
+} // end namespace matx
@@ -35,15 +35,21 @@
 #include "matx/transforms/reduce.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/type_utils.h"
-#include "matx/operators/all.h"
-#include "matx/operators/if.h"
-#include "matx/operators/clone.h"
+#include "matx/executors/async_scalar.h"
+#include "matx/kernels/cgsolve.cuh"
+#include <cuda/std/__algorithm/min.h>
 
 namespace matx
 {
   /**
    * Performs a complex gradient solve on a square matrix.  
    *
+   * Each iteration is one matvec (cuBLAS for dense A, cuSPARSE for sparse A) followed by three fused
+   * kernels: p.Ap, the x/r update with r.r accumulated in the same pass, and the search direction
+   * update. Convergence is tracked per system on the device, and converged systems in a batch are
+   * frozen. The host only reads the number of unconverged systems every check_interval iterations,
+   * and waits on the value recorded at the previous check so the read overlaps queued work.
+   *
    * @param X
    *   Tensor To Solve out
    * @param A
@@ -56,136 +62,120 @@ namespace matx
    *   max iterations for solve
    * @param stream
    *   cuda Stream to execute on
+   * @param check_interval
+   *   iterations between host checks for early termination. 0 loops on the device with a CUDA graph while
+   *   node until every system converged, without host checks, when the stream supports it
    *
    */
   template <typename XType, typename AType, typename BType>
-    __MATX_INLINE__ void cgsolve_impl(XType X, AType A, BType B, double tol=1e-6, int max_iters=4, cudaStream_t stream=0)
+    __MATX_INLINE__ void cgsolve_impl(XType X, AType A, BType B, double tol=1e-6, int max_iters=4, cudaStream_t stream=0,
+                                      int check_interval=1)
     {
       using value_type = typename XType::value_type;
       const int VRANK = XType::Rank();
       const int SRANK = XType::Rank() - 1;
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
       // TODO clone A,b if necessary.  x cannot be cloned
       
       MATX_ASSERT_STR(A.Rank() -1 == X.Rank(), matxInvalidDim, "cgsolve:  A rank must be one larger than X rank");
       MATX_ASSERT_STR(X.Rank() == B.Rank(), matxInvalidDim, "cgsole: X rank and B rank must match");
-
-      cudaStream_t d2h;
-      cudaEvent_t event;
-      
-
-      if(tol>0.0f) {
-        cudaStreamCreateWithFlags(&d2h,cudaStreamNonBlocking);
-        cudaEventCreate(&event);
-      }
-
-      int converged_host = false;
+      MATX_ASSERT_STR(check_interval >= 0, matxInvalidParameter, "cgsolve: check_interval must not be negative");
 
       // Construct 3 temporary vectors
-      auto r0 = make_tensor<value_type>(X.Shape(),  MATX_ASYNC_DEVICE_MEMORY, stream);
+      auto r = make_tensor<value_type>(X.Shape(),  MATX_ASYNC_DEVICE_MEMORY, stream);
       auto p = make_tensor<value_type>(X.Shape(),  MATX_ASYNC_DEVICE_MEMORY, stream);
       auto Ap = make_tensor<value_type>(X.Shape(),  MATX_ASYNC_DEVICE_MEMORY, stream);
-  
-      // create aliases to reuse memory
-      auto r1 = r0;
-      
+
       // Drop last dim of X
       cuda::std::array<index_t, SRANK> scalar_shape;
       for(int i = 0 ; i < SRANK; i++) {
         scalar_shape[i] = X.Size(i);
       }
 
-      // Construct temporary scalars
-      auto r0r0 = make_tensor<value_type>(scalar_shape, MATX_ASYNC_DEVICE_MEMORY, stream);
-      auto r1r1 = make_tensor<value_type>(scalar_shape, MATX_ASYNC_DEVICE_MEMORY, stream);
-      auto pAp = make_tensor<value_type>(scalar_shape, MATX_ASYNC_DEVICE_MEMORY, stream);
-      auto norm = make_tensor<value_type>(scalar_shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+      const index_t n = X.Size(VRANK - 1);
+      const index_t nb = TotalSize(X) / n;
+      const int nparts = static_cast<int>(cuda::std::min(
+          (n + CGSOLVE_THREADS - 1) / CGSOLVE_THREADS, static_cast<index_t>(CGSOLVE_MAX_PARTIALS)));
 
-      auto converged = make_tensor<int>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+      // r.r for the current and next iteration, and the per-block partial dot products
+      auto rr0 = make_tensor<value_type>(scalar_shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+      auto rr1 = make_tensor<value_type>(scalar_shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+      auto pAp_part = make_tensor<value_type>({nb * nparts}, MATX_ASYNC_DEVICE_MEMORY, stream);
+      auto rr_part = make_tensor<value_type>({nb * nparts}, MATX_ASYNC_DEVICE_MEMORY, stream);
 
-      // create aliases to reuse memory
-      //auto b = a;
-      
-      // batched scalars will need to be cloned back to vector to make math work below
-      // auto cloning clones along the left most dims and we need right most
-      cuda::std::array<index_t, VRANK> clone_shape;
-      for(int i = 0 ; i < SRANK; i++) {
-        clone_shape[i] = matxKeepDim;
-      }
-      clone_shape[SRANK] = X.Size(SRANK);
+      // Number of unconverged systems, polled by the host without a stream sync
+      auto active = make_async_scalar<int>(MATX_ASYNC_DEVICE_MEMORY, stream);
+      bool pending = false;
+
+      const double tol2 = tol > 0.0 ? tol * tol : -1.0;
 
-      auto r0r0c = clone<VRANK>(r0r0, clone_shape);
-      auto r1r1c = clone<VRANK>(r1r1, clone_shape);
-      auto pApc = clone<VRANK>(pAp, clone_shape);
-    
       // A*X
       (Ap = matvec(A, X)).run(stream);
-      // r0 = B - A*X   
-      // p = r0 
-      (p = r0 = B - Ap).run(stream);  
-      
-      (r0r0 = sum(r0*r0)).run(stream);
+      // r = B - A*X   
+      // p = r 
+      (p = r = B - Ap).run(stream);  
       
-      if(tol>0.0f) {
-        (converged = matx::all(as_int(sqrt(r0r0) < tol))).run(stream);
-      
-        cudaEventRecord(event, stream);
-        cudaStreamWaitEvent(d2h, event);
-      }
+      (rr0 = sum(r*r)).run(stream);
+
+#ifdef __CUDACC__
+      const dim3 grid(nparts, static_cast<unsigned>(cuda::std::min(nb, static_cast<index_t>(65535))));
+
+      auto iterate = [&](int i, bool check) {
+        auto &rr_cur = (i & 1) ? rr1 : rr0;
+        auto &rr_next = (i & 1) ? rr0 : rr1;
 
-      int i;
-      for (i = 0 ; i < max_iters; i++) {
         // Ap = matvec(A, p) 
         (Ap = matvec(A, p)).run(stream);
 
-        // pAp = dot(p,Ap)  
-        (pAp = sum(p*Ap)).run(stream);
-        
-        // if pAp is zero then we have exactly numerically converged.
-        // However, this is batched so we may iterate more.  Iterating
-        // further will result in NANs so we will guard with IFs.
-
-        // Fuse these into 1 kernel with comma op
-        // r1 = r0 - a * Ap 
-        // x = x + a * p
-        auto updateOp = ( r1 = r0 - (r0r0c/pApc) * Ap,
-             X = X + (r0r0c/pApc) * p);
-
-        (IF( pApc != value_type(0), updateOp)).run(stream);
-        
-        // r1r1 = dot(r1, r1)
-        (r1r1 = sum(r1*r1)).run(stream);
-        
-        if(tol>0.0f) {
-          // copy convergence criteria to host.  
-          // This is in unpinned memory and cannot on most systems run asynchronously.  
-          // We do this here to hide the copy/sync behind prior launch latency/execution.
-          cudaMemcpyAsync(&converged_host, converged.Data(), sizeof(int), cudaMemcpyDeviceToHost, d2h);
-          cudaStreamSynchronize(d2h);
-
-          if(converged_host == true) {
-            break;
-          }
+        detail::CgDotKernel<<<grid, CGSOLVE_THREADS, 0, stream>>>(
+            p.Data(), Ap.Data(), rr_cur.Data(), pAp_part.Data(), n, nb, tol2);
+        detail::CgUpdateKernel<<<grid, CGSOLVE_THREADS, 0, stream>>>(
+            X, p.Data(), Ap.Data(), r.Data(), rr_cur.Data(), pAp_part.Data(), rr_part.Data(), n, nb, tol2);
 
-          (converged = matx::all(as_int(sqrt(r1r1) < tol))).run(stream);
-        
-          cudaEventRecord(event, stream);
-          cudaStreamWaitEvent(d2h, event);
+        if (check) {
+          MATX_CUDA_CHECK(cudaMemsetAsync(active.Tensor().Data(), 0, sizeof(int), stream));
         }
-        
-        // p = r1 + b * p 
-        auto updateP = ( p = r1 + (r1r1c/r0r0c) * p);
-        (IF( pApc != value_type(0), updateP)).run(stream);
-
-        // Advance residual
-        swap(r0r0, r1r1);  
-        swap(r0r0c, r1r1c);
+
+        detail::CgDirectionKernel<<<grid, CGSOLVE_THREADS, 0, stream>>>(
+            p.Data(), r.Data(), rr_cur.Data(), rr_next.Data(), pAp_part.Data(), rr_part.Data(),
+            check ? active.Tensor().Data() : nullptr, n, nb, tol2);
+      };
+
+      const cudaExecutor exec{stream};
+      if (check_interval == 0 && tol > 0.0 && max_iters >= 2 && exec.supports_device_while()) {
+        // The first pair of iterations runs eagerly and creates the matvec plan. The rest loop on the device
+        // two iterations at a time, so r.r keeps alternating between the same buffers, until every system
+        // converged
+        iterate(0, true);
+        iterate(1, true);
+        exec.device_while(active.Tensor() > 0, [&]() {
+          iterate(0, true);
+          iterate(1, true);
+        }, (max_iters - 2) / 2);
+
+        if (max_iters & 1) {
+          iterate(max_iters - 1, true);
+        }
+        return;
       }
 
-      if(tol>0.0f) {
-        cudaEventDestroy(event);
-        cudaStreamDestroy(d2h);
+      const int interval = check_interval > 0 ? check_interval : 1;
+      for (int i = 0 ; i < max_iters; i++) {
+        const bool check = tol > 0.0 && (i + 1) % interval == 0;
+        iterate(i, check);
+
+        if (check) {
+          // Converged systems are frozen on the device, so acting on the previous check is safe and lets
+          // this iteration's kernels run while the host waits
+          if (pending && active.Get() == 0) {
+            break;
+          }
+
+          active.Record(stream);
+          pending = true;
+        }
       }
+#endif
     }
   
 } // end namespace matx
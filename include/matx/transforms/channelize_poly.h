@@ -34,12 +34,18 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
+#include <vector>
 
 #include "matx/core/error.h"
+#include "matx/core/kernel_autotune.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/tensor.h"
 #include "matx/kernels/channelize_poly.cuh"
+#include "matx/core/make_tensor.h"
+#include "matx/operators/concat.h"
 #include "matx/operators/fft.h"
 #include "matx/operators/slice.h"
 #include <cuda/std/__algorithm/max.h>
@@ -60,10 +66,10 @@ constexpr index_t MATX_CHANNELIZE_POLY1D_FULL_SMEM_KERNEL_NOUT_PER_ITER = 4;
 
 template <typename OutType, typename InType, typename FilterType, typename AccumType>
 inline void matxChannelizePoly1DInternal(OutType o, const InType &i,
-                                     const FilterType &filter, cudaStream_t stream)
+                                     const FilterType &filter, index_t elem_offset, cudaStream_t stream)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   const index_t num_channels = o.Size(OutType::Rank()-1);
   const index_t nout_per_channel = o.Size(OutType::Rank()-2);
@@ -75,7 +81,7 @@ inline void matxChannelizePoly1DInternal(OutType o, const InType &i,
     (nout_per_channel + ELTS_PER_THREAD - 1) / ELTS_PER_THREAD);
   dim3 grid(elem_blocks, static_cast<int>(num_channels), num_batches);
   ChannelizePoly1D<THREADS, OutType, InType, FilterType, AccumType><<<grid, THREADS, 0, stream>>>(
-      o, i, filter);
+      o, i, filter, elem_offset);
 #endif
 }
 
@@ -116,10 +122,11 @@ inline size_t matxChannelizePoly1DInternal_ShouldUseSmemKernel(const OutType &ou
 }
 
 template <typename OutType, typename InType, typename FilterType, typename AccumType>
-inline void matxChannelizePoly1DInternal_Smem(OutType o, const InType &i, const FilterType &filter, cudaStream_t stream)
+inline void matxChannelizePoly1DInternal_Smem(OutType o, const InType &i, const FilterType &filter,
+                                              index_t elem_offset, cudaStream_t stream)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   const index_t num_channels = o.Size(OutType::Rank()-1);
   const index_t nout_per_channel = o.Size(OutType::Rank()-2);
@@ -133,16 +140,44 @@ inline void matxChannelizePoly1DInternal_Smem(OutType o, const InType &i, const
   dim3 grid(num_blocks, 1, num_batches);
   const size_t smem_size = matxChannelizePoly1DInternal_SmemSizeBytes(o, i, filter);
   ChannelizePoly1D_Smem<OutType, InType, FilterType, AccumType><<<grid, block, smem_size, stream>>>(
-      o, i, filter, elem_per_block);
+      o, i, filter, elem_per_block, elem_offset);
 #endif
 }
 
+// Filter into o with the shared-memory kernel when it fits and the general kernel otherwise. When
+// kernel autotuning is enabled and both kernels apply, the faster one for this shape is used.
+template <typename OutType, typename InType, typename FilterType, typename AccumType>
+inline void matxChannelizePoly1DInternal_Filter(OutType o, const InType &i, const FilterType &filter,
+                                                index_t elem_offset, cudaStream_t stream)
+{
+  if (!matxChannelizePoly1DInternal_ShouldUseSmemKernel(o, i, filter)) {
+    matxChannelizePoly1DInternal<OutType, InType, FilterType, AccumType>(o, i, filter, elem_offset, stream);
+    return;
+  }
+
+  auto launch = [&](int c) -> bool {
+    if (c == 0) {
+      matxChannelizePoly1DInternal_Smem<OutType, InType, FilterType, AccumType>(o, i, filter, elem_offset, stream);
+    } else {
+      matxChannelizePoly1DInternal<OutType, InType, FilterType, AccumType>(o, i, filter, elem_offset, stream);
+    }
+    return true;
+  };
+
+  const std::string key = "channelize_poly_" + std::string(typeid(OutType).name()) + "_" +
+    typeid(InType).name() + "_" + typeid(FilterType).name() + "_" + typeid(AccumType).name() + "_" +
+    std::to_string(TotalSize(o)) + "_" + std::to_string(o.Size(OutType::Rank()-2)) + "_" +
+    std::to_string(o.Size(OutType::Rank()-1)) + "_" + std::to_string(filter.Size(FilterType::Rank()-1));
+  const int tuned = KernelAutotuneSelect(key, 2, launch, stream);
+  launch(tuned >= 0 ? tuned : 0);
+}
+
 template <typename OutType, typename InType, typename FilterType, typename AccumType>
 inline void matxChannelizePoly1DInternal_FusedChan(OutType o, const InType &i,
-                                     const FilterType &filter, cudaStream_t stream)
+                                     const FilterType &filter, index_t elem_offset, cudaStream_t stream)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   const index_t num_channels = o.Size(OutType::Rank()-1);
   const index_t nout_per_channel = o.Size(OutType::Rank()-2);
@@ -155,19 +190,19 @@ inline void matxChannelizePoly1DInternal_FusedChan(OutType o, const InType &i,
   dim3 grid(elem_blocks, 1, num_batches);
   switch (num_channels) {
     case 2:
-      ChannelizePoly1D_FusedChan<THREADS, 2, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter);
+      ChannelizePoly1D_FusedChan<THREADS, 2, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter, elem_offset);
       break;
     case 3:
-      ChannelizePoly1D_FusedChan<THREADS, 3, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter);
+      ChannelizePoly1D_FusedChan<THREADS, 3, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter, elem_offset);
       break;
     case 4:
-      ChannelizePoly1D_FusedChan<THREADS, 4, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter);
+      ChannelizePoly1D_FusedChan<THREADS, 4, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter, elem_offset);
       break;
     case 5:
-      ChannelizePoly1D_FusedChan<THREADS, 5, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter);
+      ChannelizePoly1D_FusedChan<THREADS, 5, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter, elem_offset);
       break;
     case 6:
-      ChannelizePoly1D_FusedChan<THREADS, 6, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter);
+      ChannelizePoly1D_FusedChan<THREADS, 6, OutType, InType, FilterType, AccumType><<<grid,THREADS,0,stream>>>(o, i, filter, elem_offset);
       break;
     default:
       MATX_THROW(matxInvalidDim, "channelize_poly: channel count not support with fused kernel");
@@ -179,7 +214,7 @@ template <typename DataType>
 inline void matxChannelizePoly1DUnpackInternal(DataType inout, cudaStream_t stream)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   constexpr int THREADS = 128;
   const index_t num_elem_per_channel = inout.Size(DataType::Rank()-2);
   const index_t num_channels = inout.Size(DataType::Rank()-1);
@@ -214,11 +249,14 @@ inline void matxChannelizePoly1DUnpackInternal(DataType inout, cudaStream_t stre
  * be less than num_channels, which corresponds to an oversampled case with overlapping channels, but
  * this implementation does not yet support oversampled cases.
  * @param stream CUDA stream on which to run the kernel(s)
+ * @param elem_offset Number of leading outputs per channel to skip. The input then includes
+ * elem_offset * num_channels samples of history ahead of the samples being channelized.
  */
 template <typename OutType, typename InType, typename FilterType, typename AccumType>
 inline void channelize_poly_impl(OutType out, const InType &in, const FilterType &f,
-                   index_t num_channels, [[maybe_unused]] index_t decimation_factor, cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+                   index_t num_channels, [[maybe_unused]] index_t decimation_factor, cudaStream_t stream = 0,
+                   index_t elem_offset = 0) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   using OutputOp = std::remove_cv_t<std::remove_reference_t<OutType>>;
   using InputOp = std::remove_cv_t<std::remove_reference_t<InType>>;
   using FilterOp = std::remove_cv_t<std::remove_reference_t<FilterType>>;
@@ -250,7 +288,9 @@ inline void channelize_poly_impl(OutType out, const InType &in, const FilterType
     MATX_ASSERT_STR(out.Size(i) == in.Size(i), matxInvalidDim, "channelize_poly: input/output must have matched batch sizes");
   }
 
-  [[maybe_unused]] const index_t num_elem_per_channel = (in.Size(IN_RANK-1) + num_channels - 1) / num_channels;
+  MATX_ASSERT_STR(elem_offset >= 0, matxInvalidParameter, "channelize_poly: elem_offset must be non-negative");
+  [[maybe_unused]] const index_t num_elem_per_channel =
+    (in.Size(IN_RANK-1) + num_channels - 1) / num_channels - elem_offset;
 
   MATX_ASSERT_STR(out.Size(OUT_RANK-1) == num_channels, matxInvalidDim,
     "channelize_poly: output size OUT_RANK-1 mismatch");
@@ -261,7 +301,7 @@ inline void channelize_poly_impl(OutType out, const InType &in, const FilterType
   // and we will use an R2C transform. Otherwise, we will use a C2C transform.
   if constexpr (! is_complex_v<input_t> && ! is_complex_half_v<input_t> && ! is_complex_v<filter_t> && ! is_complex_half_v<filter_t>) {
     if (num_channels <= detail::MATX_CHANNELIZE_POLY1D_FUSED_CHAN_KERNEL_THRESHOLD) {
-      matxChannelizePoly1DInternal_FusedChan<OutputOp, InputOp, FilterOp, AccumType>(out, in, f, stream);
+      matxChannelizePoly1DInternal_FusedChan<OutputOp, InputOp, FilterOp, AccumType>(out, in, f, elem_offset, stream);
     } else {
       index_t start_dims[OUT_RANK], stop_dims[OUT_RANK];
       std::fill_n(start_dims, OUT_RANK, 0);
@@ -300,11 +340,7 @@ inline void channelize_poly_impl(OutType out, const InType &in, const FilterType
         }
       }();
 
-      if (matxChannelizePoly1DInternal_ShouldUseSmemKernel(out, in, f)) {
-        matxChannelizePoly1DInternal_Smem<decltype(fft_in_slice), InputOp, FilterOp, AccumType>(fft_in_slice, in, f, stream);
-      } else {
-        matxChannelizePoly1DInternal<decltype(fft_in_slice), InputOp, FilterOp, AccumType>(fft_in_slice, in, f, stream);
-      }
+      matxChannelizePoly1DInternal_Filter<decltype(fft_in_slice), InputOp, FilterOp, AccumType>(fft_in_slice, in, f, elem_offset, stream);
       stop_dims[OUT_RANK-1] = (num_channels/2) + 1;
       auto out_packed = slice<OUT_RANK>(out, start_dims, stop_dims);
       (out_packed = fft(fft_in_slice, num_channels)).run(stream);
@@ -312,17 +348,197 @@ inline void channelize_poly_impl(OutType out, const InType &in, const FilterType
     }
   } else {
     if (num_channels <= detail::MATX_CHANNELIZE_POLY1D_FUSED_CHAN_KERNEL_THRESHOLD) {
-      matxChannelizePoly1DInternal_FusedChan<OutputOp, InputOp, FilterOp, AccumType>(out, in, f, stream);
+      matxChannelizePoly1DInternal_FusedChan<OutputOp, InputOp, FilterOp, AccumType>(out, in, f, elem_offset, stream);
     } else {
-      if (matxChannelizePoly1DInternal_ShouldUseSmemKernel(out, in, f)) {
-        matxChannelizePoly1DInternal_Smem<OutputOp, InputOp, FilterOp, AccumType>(out, in, f, stream);
-      } else {
-        matxChannelizePoly1DInternal<OutputOp, InputOp, FilterOp, AccumType>(out, in, f, stream);
-      }
+      matxChannelizePoly1DInternal_Filter<OutputOp, InputOp, FilterOp, AccumType>(out, in, f, elem_offset, stream);
       // Specify FORWARD here to prevent any normalization after the ifft. We do not
       // want any extra scaling on the output values.
       (out = ifft(out, num_channels, FFTNorm::FORWARD)).run(stream);
     }
   }
 }
+
+/**
+ * @brief Stateful 1D polyphase channelizer for an unbounded input stream
+ *
+ * Each call to Process() channelizes the next block of block_len input samples, where block_len is a
+ * multiple of num_channels, and writes block_len / num_channels outputs per channel into the next slot
+ * of a fixed ring of output buffers. The last (filter_phase_len - 1) * num_channels input samples are
+ * kept on the device between calls, so the slots hold exactly the output of one channelize_poly()
+ * call over the concatenated stream. The kernels read the history through a concatenated view of the
+ * history and the new block and skip the outputs that were already produced from it, so neither the
+ * input copy nor the FFT batch grows with the filter length.
+ *
+ * Slots are handed to a consumer without host synchronization. Acquire() makes a consumer stream
+ * wait until a slot has been written and Release() marks the slot as free once the work queued on
+ * the consumer stream so far is done. Process() waits on that release before overwriting a slot, so
+ * the producer can run up to num_slots blocks ahead of the consumer.
+ *
+ * @tparam InT Input type of the signal
+ * @tparam FilterT Type of the filter taps
+ * @tparam OutT Complex output type
+ */
+template <typename InT, typename FilterT = InT,
+          typename OutT = cuda::std::common_type_t<detail::complex_from_scalar_t<InT>, detail::complex_from_scalar_t<FilterT>>>
+class StreamingChannelizePoly {
+public:
+  using accum_type = typename inner_op_type_t<OutT>::type;
+
+  /**
+   * @brief Create a streaming channelizer
+   *
+   * @param filter Rank-1 filter taps
+   * @param num_channels Number of channels. The decimation factor is equal to the channel count.
+   * @param block_len Number of input samples passed to every Process() call
+   * @param num_slots Number of output buffers in the ring
+   * @param stream CUDA stream on which the producer runs
+   */
+  template <typename FilterOp>
+  StreamingChannelizePoly(const FilterOp &filter, index_t num_channels, index_t block_len,
+                          index_t num_slots = 2, cudaStream_t stream = 0) :
+      stream_(stream), num_channels_(num_channels), block_len_(block_len)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_STATIC_ASSERT_STR(FilterOp::Rank() == 1, matxInvalidDim, "channelize_poly: currently only support 1D filters");
+    MATX_ASSERT_STR(num_channels_ > 1, matxInvalidParameter,
+      "channelize_poly: num_channels must be greater than 1");
+    MATX_ASSERT_STR(block_len_ > 0 && block_len_ % num_channels_ == 0, matxInvalidSize,
+      "channelize_poly: streaming block length must be a positive multiple of num_channels");
+    MATX_ASSERT_STR(num_slots > 0, matxInvalidParameter, "channelize_poly: num_slots must be positive");
+
+    const index_t filter_len = filter.Size(0);
+    hist_len_ = ((filter_len + num_channels_ - 1) / num_channels_ - 1) * num_channels_;
+
+    make_tensor(filter_, {filter_len}, MATX_DEVICE_MEMORY, stream_);
+    (filter_ = filter).run(stream_);
+    if (hist_len_ > 0) {
+      for (auto &buf : hist_) {
+        make_tensor(buf, {hist_len_}, MATX_DEVICE_MEMORY, stream_);
+      }
+    }
+    make_tensor(ring_, {num_slots, block_len_ / num_channels_, num_channels_}, MATX_DEVICE_MEMORY, stream_);
+
+    ready_.resize(static_cast<size_t>(num_slots));
+    released_.resize(static_cast<size_t>(num_slots));
+    for (size_t i = 0; i < ready_.size(); i++) {
+      MATX_CUDA_CHECK(cudaEventCreateWithFlags(&ready_[i], cudaEventDisableTiming));
+      MATX_CUDA_CHECK(cudaEventCreateWithFlags(&released_[i], cudaEventDisableTiming));
+    }
+    Reset();
+  }
+
+  StreamingChannelizePoly(const StreamingChannelizePoly &) = delete;
+  StreamingChannelizePoly &operator=(const StreamingChannelizePoly &) = delete;
+
+  ~StreamingChannelizePoly()
+  {
+    for (auto &e : ready_) {
+      cudaEventDestroy(e);
+    }
+    for (auto &e : released_) {
+      cudaEventDestroy(e);
+    }
+  }
+
+  /**
+   * @brief Clear the filter history so the next block starts a new stream
+   */
+  void Reset()
+  {
+    if (hist_len_ > 0) {
+      for (auto &buf : hist_) {
+        (buf = static_cast<InT>(0)).run(stream_);
+      }
+    }
+    cur_ = 0;
+  }
+
+  /**
+   * @brief Channelize the next block of the stream
+   *
+   * @param in Next block_len input samples
+   * @returns Index of the ring slot holding the output
+   */
+  template <typename InType>
+  index_t Process(const InType &in)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_STATIC_ASSERT_STR(InType::Rank() == 1, matxInvalidDim, "channelize_poly: streaming input must be rank 1");
+    MATX_ASSERT_STR(in.Size(0) == block_len_, matxInvalidSize,
+      "channelize_poly: streaming input must be exactly one block");
+
+    const index_t slot = head_;
+    MATX_CUDA_CHECK(cudaStreamWaitEvent(stream_, released_[static_cast<size_t>(slot)], 0));
+
+    auto out = Slot(slot);
+    if (hist_len_ > 0) {
+      auto &hist = hist_[cur_];
+      auto signal = concat(0, hist, in);
+      channelize_poly_impl<decltype(out), decltype(signal), decltype(filter_), accum_type>(
+        out, signal, filter_, num_channels_, num_channels_, stream_, hist_len_ / num_channels_);
+      (hist_[cur_ ^ 1] = slice(signal, {block_len_}, {block_len_ + hist_len_})).run(stream_);
+      cur_ ^= 1;
+    }
+    else {
+      channelize_poly_impl<decltype(out), InType, decltype(filter_), accum_type>(
+        out, in, filter_, num_channels_, num_channels_, stream_);
+    }
+
+    MATX_CUDA_CHECK(cudaEventRecord(ready_[static_cast<size_t>(slot)], stream_));
+    head_ = (head_ + 1) % NumSlots();
+    return slot;
+  }
+
+  /**
+   * @brief Make a consumer stream wait until a slot has been written
+   *
+   * @param slot Slot index returned by Process()
+   * @param consumer Stream that reads the slot
+   */
+  void Acquire(index_t slot, cudaStream_t consumer) const
+  {
+    MATX_CUDA_CHECK(cudaStreamWaitEvent(consumer, ready_[static_cast<size_t>(slot)], 0));
+  }
+
+  /**
+   * @brief Return a slot to the producer once the work queued so far on the consumer stream is done
+   *
+   * @param slot Slot index returned by Process()
+   * @param consumer Stream that read the slot
+   */
+  void Release(index_t slot, cudaStream_t consumer)
+  {
+    MATX_CUDA_CHECK(cudaEventRecord(released_[static_cast<size_t>(slot)], consumer));
+  }
+
+  /**
+   * @brief View of one ring slot, shaped [block_len / num_channels, num_channels]
+   *
+   * @param slot Slot index
+   * @returns Tensor view of the slot
+   */
+  auto Slot(index_t slot) const
+  {
+    return slice<2>(ring_, {slot, 0, 0}, {matxDropDim, matxEnd, matxEnd});
+  }
+
+  /** Number of slots in the output ring */
+  index_t NumSlots() const { return ring_.Size(0); }
+
+  /** Number of input samples per block */
+  index_t BlockSize() const { return block_len_; }
+
+private:
+  cudaStream_t stream_;
+  index_t num_channels_;
+  index_t block_len_;
+  index_t hist_len_;
+  index_t head_ = 0;
+  int cur_ = 0;
+  tensor_t<FilterT, 1> filter_;
+  tensor_t<InT, 1> hist_[2];
+  tensor_t<OutT, 3> ring_;
+  std::vector<cudaEvent_t> ready_;
+  std::vector<cudaEvent_t> released_;
+};
 } // end namespace matx
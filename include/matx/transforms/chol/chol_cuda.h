@@ -40,6 +40,7 @@
 #include "matx/core/tensor.h"
 #include "matx/core/cache.h"
 #include "matx/transforms/solver_common.h"
+#include "matx/transforms/solver_small.h"
 
 #include <cstdio>
 #include <numeric>
@@ -94,7 +95,7 @@ public:
                           const cudaExecutor &exec,
                           cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK == remove_cvref_t<ATensor>::Rank(), matxInvalidDim,  "Cholesky input/output tensor ranks must match");
@@ -137,7 +138,7 @@ public:
   void Exec(OutputTensor &out, const ATensor &a,
             const cudaExecutor &exec, cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize, "Input to Cholesky must be a square matrix");
 
@@ -261,7 +262,7 @@ void chol_impl(OutputTensor &&out, const ATensor &a,
           const cudaExecutor &exec,
           SolverFillMode uplo = SolverFillMode::UPPER)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     
   using OutputTensor_t = remove_cvref_t<OutputTensor>;
   using T1 = typename OutputTensor_t::value_type;
@@ -281,6 +282,7 @@ void chol_impl(OutputTensor &&out, const ATensor &a,
   // compute the factorization without additional transposes. If we do not
   // have contiguous input and output tensors, then we create a temporary
   // contiguous tensor for use with cuSolver.
+  const SolverFillMode row_major_uplo = uplo;
   uplo = (uplo == SolverFillMode::UPPER) ? SolverFillMode::LOWER : SolverFillMode::UPPER;
 
   T1 *out_ptr = nullptr;
@@ -302,20 +304,40 @@ void chol_impl(OutputTensor &&out, const ATensor &a,
   // Get parameters required by these tensors
   auto params = detail::matxDnCholCUDAPlan_t<OutputTensor, decltype(tmp_out)>::GetCholParams(tmp_out, uplo_cusolver, exec);
 
-  using cache_val_type = detail::matxDnCholCUDAPlan_t<OutputTensor, decltype(tmp_out)>;
-  auto cache_id = detail::GetCacheIdFromType<detail::chol_cuda_cache_t>();
-  MATX_LOG_DEBUG("Cholesky transform: cache_id={}", cache_id);
-  detail::GetCache().LookupAndExec<detail::chol_cuda_cache_t>(
-    cache_id,
-    params,
-    [&]() {
-      return std::make_shared<cache_val_type>(tmp_out, exec, uplo_cusolver);
-    },
-    [&](std::shared_ptr<cache_val_type> ctype) {
-      ctype->Exec(tmp_out, tmp_out, exec, uplo_cusolver);
-    },
-    exec
-  );
+  if (detail::UseSmallSolver<T1>(params.n, params.batch_size)) {
+    // Batches of small matrices are factored with one warp per matrix in a single launch rather
+    // than with one cuSolver call per matrix. This kernel works on the row-major layout directly.
+    const auto stream = exec.getStream();
+    int *d_info = nullptr;
+    matxAlloc((void **)&d_info, params.batch_size * sizeof(int), MATX_ASYNC_DEVICE_MEMORY, stream);
+    detail::small_chol_impl(tmp_out.Data(), d_info, params.n, params.batch_size, row_major_uplo, stream);
+
+    std::vector<int> h_info(params.batch_size);
+    cudaMemcpyAsync(h_info.data(), d_info, sizeof(int) * params.batch_size, cudaMemcpyDeviceToHost, stream);
+    cudaStreamSynchronize(stream);
+    matxFree(d_info);
+
+    for (const auto& info : h_info) {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        (std::to_string(info) + "-th leading minor is not positive definite").c_str());
+    }
+  }
+  else {
+    using cache_val_type = detail::matxDnCholCUDAPlan_t<OutputTensor, decltype(tmp_out)>;
+    auto cache_id = detail::GetCacheIdFromType<detail::chol_cuda_cache_t>();
+    MATX_LOG_DEBUG("Cholesky transform: cache_id={}", cache_id);
+    detail::GetCache().LookupAndExec<detail::chol_cuda_cache_t>(
+      cache_id,
+      params,
+      [&]() {
+        return std::make_shared<cache_val_type>(tmp_out, exec, uplo_cusolver);
+      },
+      [&](std::shared_ptr<cache_val_type> ctype) {
+        ctype->Exec(tmp_out, tmp_out, exec, uplo_cusolver);
+      },
+      exec
+    );
+  }
 
   if (!allContiguous) {
     matx::copy(out, tmp_out, exec);
@@ -93,7 +93,7 @@ public:
   matxDnCholHostPlan_t(const ATensor &a,
                          const char uplo = 'U')
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK == remove_cvref_t<ATensor>::Rank(), matxInvalidDim,  "Cholesky input/output tensor ranks must match");
@@ -122,7 +122,7 @@ public:
   void Exec(OutputTensor &out, const ATensor &a,
             const HostExecutor<MODE> &exec, const char uplo = 'U')
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize, "Input to Cholesky must be a square matrix");
 
@@ -137,20 +137,20 @@ public:
       (out = a).run(exec);
     }
 
-    lapack_int_t info;
-
-    for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
+    const lapack_int_t info = this->ExecBatches(exec, [&](size_t i, void *, void *, void *) {
+      lapack_int_t batch_info;
       potrf_dispatch(&uplo, &params.n,
                      reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
-                     &params.n, &info);
-
-      if (info < 0) {
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
-          ("Parameter " + std::to_string(-info) + " had an illegal value in LAPACK potrf").c_str());
-      } else {
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError, 
-          (std::to_string(info) + "-th leading minor is not positive definite in LAPACK potrf").c_str());
-      }
+                     &params.n, &batch_info);
+      return batch_info;
+    });
+
+    if (info < 0) {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        ("Parameter " + std::to_string(-info) + " had an illegal value in LAPACK potrf").c_str());
+    } else {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, 
+        (std::to_string(info) + "-th leading minor is not positive definite in LAPACK potrf").c_str());
     }
   }
 
@@ -218,7 +218,7 @@ void chol_impl([[maybe_unused]] OutputTensor &&out,
                [[maybe_unused]] const HostExecutor<MODE> &exec,
                [[maybe_unused]] SolverFillMode uplo = SolverFillMode::UPPER)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   MATX_ASSERT_STR(MATX_EN_CPU_SOLVER, matxInvalidExecutor,
     "Trying to run a host Solver executor but host Solver support is not configured");
 #if MATX_EN_CPU_SOLVER
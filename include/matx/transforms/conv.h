@@ -33,11 +33,15 @@
 
 #pragma once
 
+#include <cmath>
 #include <cstdint>
 #include <cstdio>
+#include <limits>
+#include <string>
 #include <type_traits>
 
 #include "matx/core/error.h"
+#include "matx/core/kernel_autotune.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/tensor.h"
 #include "matx/operators/clone.h"
@@ -48,12 +52,303 @@
 namespace matx {
 namespace detail {
 
+// Filters up to this length use overlap-save with small batched FFTs instead of one FFT of the whole signal
+static constexpr index_t FFT_CONV_OLS_MAX_FILTER = 4096;
+// Smallest overlap-save block. Shorter blocks waste most of each FFT on the discarded overlap.
+static constexpr index_t FFT_CONV_OLS_MIN_BLOCK = 1024;
+
+// Outputs produced per row of the GEMM used by the TC method. Each output costs P + M - 1 multiplies
+// instead of M, which tensor cores more than make up for once M is in the TC range.
+static constexpr index_t CONV1D_TC_BLOCK = 128;
+// Longest filter MATX_C_METHOD_AUTO will convolve directly
+static constexpr index_t CONV1D_DIRECT_MAX_FILTER = 1024;
+
+// Cost model for MATX_C_METHOD_AUTO, in units of one multiply-accumulate of the direct kernel. The
+// constants were fit to measured crossovers on Ampere and Hopper GPUs with single precision inputs:
+// the TC method overtakes direct near 64 taps and FFT overtakes the TC method near 1024 taps, and
+// small batches favor the methods that launch fewer kernels.
+static constexpr double CONV1D_COST_DIRECT_MAC = 1.0;
+static constexpr double CONV1D_COST_TC_MAC = 0.33;
+static constexpr double CONV1D_COST_FFT_BUTTERFLY = 8.5;
+static constexpr double CONV1D_COST_LAUNCH = 1.0e7;
+static constexpr double CONV1D_LAUNCHES_DIRECT = 1;
+static constexpr double CONV1D_LAUNCHES_FFT = 4;
+static constexpr double CONV1D_LAUNCHES_TC = 8;
+
+/**
+ * Convolution of a batch of signals with one shared filter, lowered to a GEMM
+ *
+ * The full output is cut into blocks of P = CONV1D_TC_BLOCK samples. Output block j of a signal only
+ * depends on the P + M - 1 padded input samples starting at j*P, and equals T times that window, where
+ * T is the P x (P + M - 1) Toeplitz matrix holding the reversed filter on each row. Stacking every
+ * window of every batch as a row gives a single GEMM with the transposed T, which cuBLAS runs on tensor
+ * cores for half precision, TF32, and complex types alike.
+ */
+template <typename OutputType, typename InType, typename FilterType, typename Executor>
+inline void matxTCConv1DInternal(OutputType &o, const InType &i,
+                                 const FilterType &filter, matxConvCorrMode_t mode,
+                                 const Executor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  static_assert(FilterType::Rank() == 1, "GEMM convolution requires a filter shared by all batches");
+  static_assert(OutputType::Rank() == InType::Rank(), "GEMM convolution output must have the rank of the signal");
+  using value_type = typename OutputType::value_type;
+  constexpr int RANK = InType::Rank();
+
+  const index_t sig_len = i.Size(RANK - 1);
+  const index_t filter_size = filter.Size(0);
+  const index_t full_size = sig_len + filter_size - 1;
+  const index_t block = CONV1D_TC_BLOCK;
+  const index_t window = block + filter_size - 1;
+  const index_t num_blocks = (full_size + block - 1) / block;
+  const index_t padded_len = num_blocks * block + filter_size - 1;
+  const index_t batches = TotalSize(i) / sig_len;
+
+  auto allocate_tensor = [&](auto shape) {
+    if constexpr (is_cuda_executor_v<Executor>) {
+      detail::ScratchScope scratch{exec.getStream()};
+      return make_tensor<value_type>(shape, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+    } else {
+      return make_tensor<value_type>(shape, MATX_HOST_MALLOC_MEMORY);
+    }
+  };
+
+  // Toeplitz matrix with the reversed filter starting at the diagonal of each row
+  auto row = allocate_tensor(cuda::std::array<index_t, 1>{window});
+  auto col = allocate_tensor(cuda::std::array<index_t, 1>{block});
+  (row = zeros<value_type>({window})).run(exec);
+  (col = zeros<value_type>({block})).run(exec);
+  (slice(row, {0}, {filter_size}) = as_type<value_type>(reverse<0>(filter))).run(exec);
+  (slice(col, {0}, {1}) = slice(row, {0}, {1})).run(exec);
+  auto toep = allocate_tensor(cuda::std::array<index_t, 2>{block, window});
+  (toep = toeplitz(col, row)).run(exec);
+
+  // Every signal with M - 1 leading zeros and enough trailing zeros to fill the last block
+  cuda::std::array<index_t, RANK> padded_shape;
+  index_t sig_start[RANK];
+  index_t sig_end[RANK];
+  for (int r = 0; r < RANK; r++) {
+    padded_shape[r] = i.Size(r);
+    sig_start[r] = 0;
+    sig_end[r] = matxEnd;
+  }
+  padded_shape[RANK - 1] = padded_len;
+  sig_start[RANK - 1] = filter_size - 1;
+  sig_end[RANK - 1] = filter_size - 1 + sig_len;
+
+  auto padded = allocate_tensor(padded_shape);
+  (padded = zeros<value_type>(padded_shape)).run(exec);
+  (slice(padded, sig_start, sig_end) = as_type<value_type>(i)).run(exec);
+
+  // Overlapping windows are a strided view of the padded signals, copied into GEMM rows
+  auto windows = allocate_tensor(cuda::std::array<index_t, 2>{batches * num_blocks, window});
+  auto window_view = make_tensor(padded.Data(), {batches, num_blocks, window}, {padded_len, block, index_t{1}});
+  (windows.View({batches, num_blocks, window}) = window_view).run(exec);
+
+  auto blocks = allocate_tensor(cuda::std::array<index_t, 2>{batches * num_blocks, block});
+  (blocks = matmul(windows, transpose_matrix(toep))).run(exec);
+
+  cuda::std::array<index_t, RANK> full_shape = padded_shape;
+  full_shape[RANK - 1] = num_blocks * block;
+  auto full = blocks.View(full_shape);
+
+  index_t out_start[RANK];
+  index_t out_end[RANK];
+  for (int r = 0; r < RANK; r++) {
+    out_start[r] = 0;
+    out_end[r] = matxEnd;
+  }
+  out_end[RANK - 1] = full_size;
+  if (mode == MATX_C_MODE_SAME) {
+    out_start[RANK - 1] = (filter_size & 1) ? (filter_size - 1) / 2 : filter_size / 2 - 1;
+    out_end[RANK - 1] = full_size - filter_size / 2;
+  }
+  else if (mode == MATX_C_MODE_VALID) {
+    out_start[RANK - 1] = filter_size - 1;
+    out_end[RANK - 1] = full_size - filter_size + 1;
+  }
+
+  (o = slice(full, out_start, out_end)).run(exec);
+}
+
+/**
+ * Pick the 1D convolution method for MATX_C_METHOD_AUTO from a cost model
+ *
+ * The shorter input is treated as the filter. Each applicable method gets an estimated cost from
+ * its arithmetic and the number of kernels it launches, and the cheapest one wins. The TC method
+ * only applies to filters shared by every batch, the FFT method does not support half precision
+ * types, and direct convolution is limited to filters of CONV1D_DIRECT_MAX_FILTER taps.
+ */
+template <typename Executor, typename In1Type, typename In2Type>
+inline matxConvCorrMethod_t SelectConv1DMethod(const In1Type &i1, const In2Type &i2)
+{
+  const index_t len1 = i1.Size(In1Type::Rank() - 1);
+  const index_t len2 = i2.Size(In2Type::Rank() - 1);
+  const bool i2_filter = len2 <= len1;
+  const index_t sig_len = i2_filter ? len1 : len2;
+  const index_t filter_len = i2_filter ? len2 : len1;
+  const bool shared_filter = i2_filter ? In2Type::Rank() == 1 : In1Type::Rank() == 1;
+  const double batches = static_cast<double>(cuda::std::max(TotalSize(i1) / len1, TotalSize(i2) / len2));
+  constexpr bool is_half = is_matx_type_v<typename In1Type::value_type> || is_matx_type_v<typename In2Type::value_type>;
+
+  const double m = static_cast<double>(filter_len);
+  const double full = static_cast<double>(sig_len + filter_len - 1);
+
+  const double direct_cost = batches * full * m * CONV1D_COST_DIRECT_MAC +
+                             CONV1D_LAUNCHES_DIRECT * CONV1D_COST_LAUNCH;
+
+  const double tc_cost = batches * full * static_cast<double>(CONV1D_TC_BLOCK + filter_len - 1) * CONV1D_COST_TC_MAC +
+                         CONV1D_LAUNCHES_TC * CONV1D_COST_LAUNCH;
+
+  // Short filters on signals of at most two dimensions use overlap-save, which pays for two FFTs of
+  // the block per block - filter + 1 outputs of each batch. Everything else uses one forward and one
+  // inverse FFT of the full length per batch.
+  double fft_cost;
+  if (cuda::std::max(In1Type::Rank(), In2Type::Rank()) <= 2 && filter_len <= FFT_CONV_OLS_MAX_FILTER) {
+    index_t block = FFT_CONV_OLS_MIN_BLOCK;
+    while (block < 2 * filter_len) {
+      block *= 2;
+    }
+    const double b = static_cast<double>(block);
+    fft_cost = batches * full * 2.0 * b * std::log2(b) / (b - m + 1.0) * CONV1D_COST_FFT_BUTTERFLY;
+  }
+  else {
+    fft_cost = batches * 2.0 * full * std::log2(full) * CONV1D_COST_FFT_BUTTERFLY;
+  }
+  fft_cost += CONV1D_LAUNCHES_FFT * CONV1D_COST_LAUNCH;
+
+  matxConvCorrMethod_t best = MATX_C_METHOD_FFT;
+  double best_cost = is_half ? std::numeric_limits<double>::max() : fft_cost;
+  if constexpr (CheckDirect1DConvSupport<Executor>()) {
+    if (filter_len <= CONV1D_DIRECT_MAX_FILTER && direct_cost < best_cost) {
+      best = MATX_C_METHOD_DIRECT;
+      best_cost = direct_cost;
+    }
+  }
+  if (shared_filter && tc_cost < best_cost) {
+    best = MATX_C_METHOD_TC;
+    best_cost = tc_cost;
+  }
+
+  MATX_LOG_DEBUG("conv1d cost model: direct={} fft={} tc={} selected {}", direct_cost, fft_cost, tc_cost,
+                 static_cast<int>(best));
+  return best;
+}
+
+/**
+ * Overlap-save FFT convolution of long signals with short filters
+ *
+ * The zero-padded signals are viewed as overlapping blocks of L samples with a hop of S = L - M + 1
+ * (no copy), and each block goes through fft -> multiply by the filter spectrum -> ifft in a single
+ * statement. The first M - 1 samples of each block are discarded. The FFTs are L points instead of
+ * N + M - 1, so they stay in the sizes cuFFTDx can fuse when the statement is JIT compiled, and the
+ * temporaries are sized by the batch of blocks rather than padded to a single large transform. A 2D
+ * signal is a batch of rows, each filtered by the matching row of the filter, so per-channel filters
+ * run through the same batched FFTs as a shared one.
+ */
+template <typename OutputType, typename InType, typename FilterType, typename Executor>
+inline void matxFFTConv1DOverlapSaveInternal(OutputType &o, const InType &i,
+                                     const FilterType &filter, matxConvCorrMode_t mode,
+                                     index_t block_size, const Executor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using complex_type = complex_from_scalar_t<typename InType::value_type>;
+  constexpr int RANK = InType::Rank();
+  static_assert(RANK <= 2 && FilterType::Rank() == RANK, "Overlap-save convolution requires 1D inputs or 2D batches");
+
+  const index_t sig_len = i.Size(RANK - 1);
+  const index_t filter_size = filter.Size(RANK - 1);
+  const index_t full_size = sig_len + filter_size - 1;
+  const index_t hop = block_size - filter_size + 1;
+  const index_t num_blocks = (full_size + hop - 1) / hop;
+  const index_t padded_len = (num_blocks - 1) * hop + block_size;
+  const index_t batches = (RANK == 1) ? 1 : i.Size(0);
+
+  auto allocate_tensor = [&](auto shape) {
+    if constexpr (is_cuda_executor_v<Executor>) {
+      detail::ScratchScope scratch{exec.getStream()};
+      return make_tensor<complex_type>(shape, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+    } else {
+      return make_tensor<complex_type>(shape, MATX_HOST_MALLOC_MEMORY);
+    }
+  };
+
+  // A 1D input is a batch of one
+  auto batched = [](const auto &op) {
+    if constexpr (RANK == 1) {
+      return clone<2>(op, {1, matxKeepDim});
+    }
+    else {
+      return op;
+    }
+  };
+
+  // Signals with M - 1 leading zeros and enough trailing zeros to fill the last block
+  auto padded = allocate_tensor(cuda::std::array<index_t, 2>{batches, padded_len});
+  (padded = zeros<complex_type>({batches, padded_len})).run(exec);
+  (slice(padded, {0, filter_size - 1}, {matxEnd, filter_size - 1 + sig_len}) = as_type<complex_type>(batched(i))).run(exec);
+  auto blocks = make_tensor(padded.Data(), {batches, num_blocks, block_size}, {padded_len, hop, index_t{1}});
+
+  auto spectrum = allocate_tensor(cuda::std::array<index_t, 2>{batches, block_size});
+  (spectrum = fft(as_type<complex_type>(batched(filter)), block_size)).run(exec);
+
+  auto full = allocate_tensor(cuda::std::array<index_t, 3>{batches, num_blocks, hop});
+  (full = slice(ifft(fft(blocks) * clone<3>(spectrum, {matxKeepDim, num_blocks, matxKeepDim})),
+                {0, 0, filter_size - 1}, {matxEnd, matxEnd, matxEnd})).run(exec);
+
+  index_t start = 0;
+  index_t end = full_size;
+  if (mode == MATX_C_MODE_SAME) {
+    start = (filter_size & 1) ? (filter_size - 1) / 2 : filter_size / 2 - 1;
+    end = full_size - filter_size / 2;
+  }
+  else if (mode == MATX_C_MODE_VALID) {
+    start = filter_size - 1;
+    end = full_size - filter_size + 1;
+  }
+
+  auto out_full = [&]() {
+    if constexpr (RANK == 1) {
+      return slice(full.View({num_blocks * hop}), {start}, {end});
+    }
+    else {
+      return slice(full.View({batches, num_blocks * hop}), {0, start}, {matxEnd, end});
+    }
+  }();
+
+  if constexpr (is_complex_v<typename InType::value_type> || is_complex_v<typename FilterType::value_type>) {
+    (o = out_full).run(exec);
+  }
+  else {
+    (o = real(out_full)).run(exec);
+  }
+}
+
 template <typename OutputType, typename InType, typename FilterType, typename Executor>
 inline void matxFFTConv1DInternal(OutputType &o, const InType &i,
                                      const FilterType &filter, matxConvCorrMode_t mode,
                                      const Executor &exec)
 {
   const index_t padded_size = i.Size(InType::Rank() - 1) + filter.Size(InType::Rank() - 1) - 1;
+
+  // Long signals with short filters use overlap-save, whether the filter is shared or one per row.
+  // The block is the smallest power of two at least twice the filter length, so at least half of
+  // every FFT is output.
+  if constexpr (InType::Rank() <= 2) {
+    const index_t filt_len = filter.Size(FilterType::Rank() - 1);
+    if (filt_len <= FFT_CONV_OLS_MAX_FILTER) {
+      index_t block_size = FFT_CONV_OLS_MIN_BLOCK;
+      while (block_size < 2 * filt_len) {
+        block_size *= 2;
+      }
+
+      if (i.Size(InType::Rank() - 1) >= 4 * block_size) {
+        matxFFTConv1DOverlapSaveInternal(o, i, filter, mode, block_size, exec);
+        return;
+      }
+    }
+  }
+
   auto in_shape_padded = Shape(i);
   in_shape_padded[InType::Rank() - 1] = padded_size;
   const auto filter_size = filter.Size(FilterType::Rank() - 1);
@@ -71,6 +366,7 @@ inline void matxFFTConv1DInternal(OutputType &o, const InType &i,
   matx::tensor_t<complex_from_scalar_t<typename InType::scalar_type>, InType::Rank()> sifft;
 
   if constexpr (is_cuda_executor_v<Executor>) {
+    detail::ScratchScope scratch{exec.getStream()};
     make_tensor(s1, in_shape_padded, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
     make_tensor(s2, in_shape_padded, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
     make_tensor(sifft, in_shape_padded, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
@@ -83,6 +379,7 @@ inline void matxFFTConv1DInternal(OutputType &o, const InType &i,
 #else
   auto allocate_tensor = [&](auto shape) {
     if constexpr (is_cuda_executor_v<Executor>) {
+      detail::ScratchScope scratch{exec.getStream()};
       return make_tensor<complex_from_scalar_t<typename InType::value_type>>(shape, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
     } else {
       return make_tensor<complex_from_scalar_t<typename InType::value_type>>(shape, MATX_HOST_MALLOC_MEMORY);
@@ -185,7 +482,7 @@ inline void matxDirectConv1DInternal(OutputType &o, const InType &i,
       matxInvalidSize, "Output size for SAME convolution incorrect");
 
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   const auto stream = exec.getStream();
 
@@ -229,7 +526,7 @@ void matxDirectConv2DInternal(OutputType &o, In1Type &in1,
                               In2Type &in2, matxConvCorrMode_t mode,
                               cudaStream_t stream)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   MATX_STATIC_ASSERT(OutputType::Rank() == In1Type::Rank(), matxInvalidDim);
   MATX_STATIC_ASSERT(OutputType::Rank() == In2Type::Rank(), matxInvalidDim);
@@ -262,10 +559,16 @@ template <typename OutputType, typename In1Type, typename In2Type, typename Exec
 inline void conv1d_impl_internal(OutputType &o, const In1Type &i1, const In2Type &i2,
                    matxConvCorrMode_t mode, matxConvCorrMethod_t method, const Executor &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   static_assert(In1Type::Rank() == In2Type::Rank());
 
+  // A filter with as many dimensions as the signal holds one filter per batch
+  for (int r = 0; r < In1Type::Rank() - 1; r++) {
+    MATX_ASSERT_STR(i1.Size(r) == i2.Size(r), matxInvalidSize,
+      "conv1d: batch dimensions of a batched filter must match the signal");
+  }
+
   if (mode == MATX_C_MODE_SAME) {
     MATX_ASSERT_STR(o.Size(OutputType::Rank() - 1) == cuda::std::max(i1.Size(i1.Rank()-1), i2.Size(i2.Rank()-1)), matxInvalidSize,
       "Output size for SAME mode convolution must match largest input size");
@@ -326,7 +629,64 @@ inline void conv1d_impl_internal(OutputType &o, const In1Type &i1, const In2Type
 template <typename OutputType, typename In1Type, typename In2Type, typename Executor>
 inline void conv1d_impl(OutputType o, const In1Type &i1, const In2Type &i2,
                    matxConvCorrMode_t mode, matxConvCorrMethod_t method, const Executor &exec) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+  if (method == MATX_C_METHOD_AUTO) {
+    // With autotuning enabled, the first call for each shape times every method that applies and
+    // the winner is cached per device. Otherwise, or while capturing a graph, the cost model decides.
+    if constexpr (is_cuda_executor_v<Executor>) {
+      constexpr matxConvCorrMethod_t candidates[] = {MATX_C_METHOD_DIRECT, MATX_C_METHOD_FFT, MATX_C_METHOD_TC};
+      constexpr bool is_half = is_matx_type_v<typename In1Type::value_type> || is_matx_type_v<typename In2Type::value_type>;
+      const index_t len1 = i1.Size(In1Type::Rank() - 1);
+      const index_t len2 = i2.Size(In2Type::Rank() - 1);
+      const bool shared_filter = len2 <= len1 ? In2Type::Rank() == 1 : In1Type::Rank() == 1;
+
+      auto launch = [&](int c) -> bool {
+        const matxConvCorrMethod_t candidate = candidates[c];
+        if (candidate == MATX_C_METHOD_DIRECT &&
+            (!detail::CheckDirect1DConvSupport<Executor>() || cuda::std::min(len1, len2) > detail::CONV1D_DIRECT_MAX_FILTER)) {
+          return false;
+        }
+        if ((candidate == MATX_C_METHOD_FFT && is_half) || (candidate == MATX_C_METHOD_TC && !shared_filter)) {
+          return false;
+        }
+        conv1d_impl(o, i1, i2, mode, candidate, exec);
+        return true;
+      };
+
+      const std::string key = "conv1d_" + std::string(typeid(OutputType).name()) + "_" +
+        typeid(In1Type).name() + "_" + typeid(In2Type).name() + "_" +
+        std::to_string(TotalSize(i1)) + "_" + std::to_string(len1) + "_" +
+        std::to_string(TotalSize(i2)) + "_" + std::to_string(len2) + "_" + std::to_string(static_cast<int>(mode));
+      const int tuned = detail::KernelAutotuneSelect(key, 3, launch, exec.getStream());
+      method = tuned >= 0 ? candidates[tuned] : detail::SelectConv1DMethod<Executor>(i1, i2);
+    }
+    else {
+      method = detail::SelectConv1DMethod<Executor>(i1, i2);
+    }
+    MATX_LOG_DEBUG("conv1d: automatic method selected {}", static_cast<int>(method));
+  }
+
+  if (method == MATX_C_METHOD_TC) {
+    // The GEMM lowering needs the shorter input to be a single filter shared by every batch
+    const bool i2_filter = i2.Size(In2Type::Rank() - 1) <= i1.Size(In1Type::Rank() - 1);
+    if constexpr (In2Type::Rank() == 1) {
+      if (i2_filter) {
+        detail::matxTCConv1DInternal(o, i1, i2, mode, exec);
+        return;
+      }
+    }
+    if constexpr (In1Type::Rank() == 1) {
+      if (!i2_filter) {
+        detail::matxTCConv1DInternal(o, i2, i1, mode, exec);
+        return;
+      }
+    }
+
+    MATX_LOG_DEBUG("conv1d: filter is batched, falling back from the TC method");
+    constexpr bool is_half = is_matx_type_v<typename In1Type::value_type> || is_matx_type_v<typename In2Type::value_type>;
+    method = is_half ? MATX_C_METHOD_DIRECT : MATX_C_METHOD_FFT;
+  }
 
   if constexpr ( In1Type::Rank() >  In2Type::Rank() ) {
     // broadcast i2 path.  clone i2 across batches
@@ -407,7 +767,7 @@ template <typename OutputType, typename In1Type, typename In2Type>
 inline void conv2d_impl(OutputType o, const In1Type in1, const In2Type in2,
                    matxConvCorrMode_t mode, cudaStream_t stream = 0)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   constexpr int Rank1 = In1Type::Rank();
   constexpr int Rank2 = In2Type::Rank();
 
@@ -440,4 +800,55 @@ inline void conv2d_impl(OutputType o, const In1Type in1, const In2Type in2,
   }
 }
 
+/**
+ * @brief 2D convolution with a separable filter
+ *
+ * The filter is the outer product of h_col, applied along the second-to-last dimension, and h_row,
+ * applied along the last dimension. The result is the same as conv2d() with the full 2D filter, but
+ * it is computed as two direct 1D passes, so each output costs Ky + Kx multiplies instead of Ky * Kx.
+ * The row pass writes a temporary with the output's column count and the column pass reads it
+ * through a transposed view.
+ *
+ * @tparam OutputType Type of output
+ * @tparam InType Type of input
+ * @tparam ColFilterType Type of the column filter
+ * @tparam RowFilterType Type of the row filter
+ * @param o Output tensor
+ * @param in Input operator
+ * @param h_col Rank-1 filter applied down each column
+ * @param h_row Rank-1 filter applied along each row
+ * @param mode Convolution mode
+ * @param stream CUDA stream
+ */
+template <typename OutputType, typename InType, typename ColFilterType, typename RowFilterType>
+inline void conv2d_separable_impl(OutputType o, const InType &in, const ColFilterType &h_col,
+                   const RowFilterType &h_row, matxConvCorrMode_t mode, cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  constexpr int Rank = InType::Rank();
+
+  MATX_STATIC_ASSERT_STR(Rank >= 2, matxInvalidDim, "conv2d_separable: input must be at least rank 2");
+  MATX_STATIC_ASSERT_STR(OutputType::Rank() == Rank, matxInvalidDim, "conv2d_separable: output and input ranks must match");
+  MATX_STATIC_ASSERT_STR(ColFilterType::Rank() == 1 && RowFilterType::Rank() == 1, matxInvalidDim,
+    "conv2d_separable: filters must be rank 1");
+
+  // Rows first: the intermediate has the input's rows and the output's columns
+  auto shape = in.Shape();
+  shape[Rank-1] = o.Size(Rank-1);
+  auto tmp = [&]() {
+    detail::ScratchScope scratch{stream};
+    return make_tensor<typename OutputType::value_type>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  }();
+  conv1d_impl(tmp, in, h_row, mode, MATX_C_METHOD_DIRECT, cudaExecutor{stream});
+
+  // Then columns, by making the column dimension the fastest-changing one
+  cuda::std::array<int32_t, Rank> perm;
+  for (int i = 0; i < Rank; i++) {
+    perm[i] = i;
+  }
+  perm[Rank-2] = Rank-1;
+  perm[Rank-1] = Rank-2;
+  conv1d_impl(permute(o, perm), permute(tmp, perm), h_col, mode, MATX_C_METHOD_DIRECT, cudaExecutor{stream});
+}
+
 } // end namespace matx
@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <type_traits>
+
+#include "matx/core/error.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/type_utils.h"
+#include "matx/operators/clone.h"
+#include "matx/operators/reverse.h"
+
+namespace matx {
+
+/**
+ * Precomputed frequency-domain filter for repeated 1D convolution or correlation
+ *
+ * Matched filtering and similar pipelines convolve every new block of data with the same filter.
+ * The FFT convolution path transforms both inputs on every call; this object transforms the
+ * filter once when it is created and keeps the spectrum resident, so each call to Apply() only
+ * runs the forward FFT of the signal, the multiply and the inverse FFT. The output matches
+ * conv1d(), or corr() when created with correlate set, for the same mode.
+ *
+ * The FFT length is the smallest power of two of at least signal_size + M - 1 points, where M is
+ * the filter length. Signals may be batched in any number of leading dimensions, and every batch
+ * shares the same filter. The spectrum must be rebuilt if the filter taps change.
+ *
+ * @tparam FilterT Type of the filter taps
+ * @tparam Executor Executor type
+ */
+template <typename FilterT, typename Executor = cudaExecutor>
+class ConvFilterSpectrum {
+public:
+  using complex_type = detail::complex_from_scalar_t<FilterT>;
+
+  /**
+   * Transform a filter for later calls to Apply()
+   *
+   * @param filter Rank-1 filter taps
+   * @param signal_size Length of the innermost dimension of every signal passed to Apply()
+   * @param correlate Apply correlation instead of convolution
+   * @param exec Executor to run on. The object keeps a copy.
+   */
+  template <typename FilterOp>
+  ConvFilterSpectrum(const FilterOp &filter, index_t signal_size, bool correlate = false,
+                     const Executor &exec = Executor{}) :
+      exec_(exec), signal_size_(signal_size), filter_size_(filter.Size(0)), correlate_(correlate)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_STATIC_ASSERT_STR(FilterOp::Rank() == 1, matxInvalidDim, "ConvFilterSpectrum filter must be rank 1");
+    MATX_ASSERT_STR(signal_size_ > 0 && filter_size_ > 0, matxInvalidSize,
+        "ConvFilterSpectrum requires a non-empty filter and signal");
+
+    fft_size_ = 1;
+    while (fft_size_ < signal_size_ + filter_size_ - 1) {
+      fft_size_ *= 2;
+    }
+
+    if constexpr (is_cuda_executor_v<Executor>) {
+      make_tensor(spectrum_, {fft_size_}, MATX_DEVICE_MEMORY);
+    }
+    else {
+      make_tensor(spectrum_, {fft_size_}, MATX_HOST_MALLOC_MEMORY);
+    }
+
+    if (correlate_) {
+      (spectrum_ = fft(as_type<complex_type>(reverse<0>(conj(filter))), fft_size_)).run(exec_);
+    }
+    else {
+      (spectrum_ = fft(as_type<complex_type>(filter), fft_size_)).run(exec_);
+    }
+  }
+
+  /**
+   * Filter a signal with the stored spectrum
+   *
+   * @param out Output. The innermost dimension is sized as conv1d() would size it for mode.
+   * @param in Input signal with signal_size samples in the innermost dimension
+   * @param mode Convolution mode
+   */
+  template <typename OutType, typename InType>
+  void Apply(OutType &out, const InType &in, matxConvCorrMode_t mode = MATX_C_MODE_FULL)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    constexpr int RANK = InType::Rank();
+    MATX_STATIC_ASSERT_STR(RANK >= 1 && OutType::Rank() == RANK, matxInvalidDim,
+        "ConvFilterSpectrum input and output must have the same rank");
+    MATX_ASSERT_STR(in.Size(RANK - 1) == signal_size_, matxInvalidSize,
+        "ConvFilterSpectrum input length does not match the length it was created for");
+
+    const index_t full_size = signal_size_ + filter_size_ - 1;
+    index_t start = 0;
+    index_t end = full_size;
+    if (mode == MATX_C_MODE_SAME) {
+      start = (filter_size_ & 1) ? (filter_size_ - 1) / 2 : filter_size_ / 2 - 1;
+      end = start + signal_size_;
+    }
+    else if (mode == MATX_C_MODE_VALID) {
+      MATX_ASSERT_STR(signal_size_ >= filter_size_, matxInvalidSize,
+          "VALID mode requires a signal at least as long as the filter");
+      start = filter_size_ - 1;
+      end = signal_size_;
+    }
+    MATX_ASSERT_STR(out.Size(RANK - 1) == end - start, matxInvalidSize,
+        "ConvFilterSpectrum output length does not match the mode");
+
+    index_t clone_shape[RANK];
+    index_t slice_start[RANK];
+    index_t slice_end[RANK];
+    for (int d = 0; d < RANK - 1; d++) {
+      clone_shape[d] = in.Size(d);
+      slice_start[d] = 0;
+      slice_end[d] = matxEnd;
+    }
+    clone_shape[RANK - 1] = matxKeepDim;
+    slice_start[RANK - 1] = start;
+    slice_end[RANK - 1] = end;
+
+    auto y = slice(ifft(fft(as_type<complex_type>(in), fft_size_) * clone<RANK>(spectrum_, clone_shape)),
+                   slice_start, slice_end);
+    if constexpr (is_complex_v<typename InType::value_type> || is_complex_v<FilterT>) {
+      (out = y).run(exec_);
+    }
+    else {
+      (out = real(y)).run(exec_);
+    }
+  }
+
+  /** Signal length the spectrum was created for */
+  index_t SignalSize() const { return signal_size_; }
+
+  /** Number of filter taps */
+  index_t FilterSize() const { return filter_size_; }
+
+  /** FFT length of the stored spectrum */
+  index_t FFTSize() const { return fft_size_; }
+
+  /** True if Apply() correlates instead of convolves */
+  bool Correlate() const { return correlate_; }
+
+  /** Stored filter spectrum */
+  const tensor_t<complex_type, 1> &Spectrum() const { return spectrum_; }
+
+private:
+  Executor exec_;
+  index_t signal_size_;
+  index_t filter_size_;
+  index_t fft_size_;
+  bool correlate_;
+  tensor_t<complex_type, 1> spectrum_;
+};
+
+} // end namespace matx
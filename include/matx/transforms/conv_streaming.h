@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <type_traits>
+
+#include "matx/core/error.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/type_utils.h"
+#include "matx/operators/clone.h"
+
+namespace matx {
+
+/**
+ * Stateful 1D convolution of an unbounded signal processed in fixed-size chunks
+ *
+ * Each call to Process() takes the next chunk of the signal and writes the matching chunk of the
+ * causal filter output, y[n] = sum_k h[k] x[n - k]. Consecutive chunks produce exactly the output of
+ * one FULL convolution over the concatenated signal, without the caller managing filter state.
+ *
+ * Overlap-save is used with an FFT of L >= chunk_size + M - 1 points, where M is the filter
+ * length. The filter spectrum and two work buffers of L points stay resident for the lifetime of
+ * the object. The buffers alternate between chunks: the last M - 1 input samples of one chunk are
+ * copied into the head of the other buffer, so the history never has to be shifted in place. All
+ * work is queued on the executor's stream and the FFT plans come from the regular plan cache.
+ *
+ * @tparam T Input type of the signal
+ * @tparam FilterT Type of the filter taps
+ * @tparam Executor Executor type
+ */
+template <typename T, typename FilterT = T, typename Executor = cudaExecutor>
+class StreamingConv1D {
+public:
+  using complex_type = detail::complex_from_scalar_t<T>;
+  using value_type = std::conditional_t<is_complex_v<T> || is_complex_v<FilterT>, complex_type, T>;
+
+  /**
+   * Create a streaming convolver
+   *
+   * @param filter Rank-1 filter taps
+   * @param chunk_size Number of samples passed to every Process() call
+   * @param exec Executor to run on. The convolver keeps a copy.
+   */
+  template <typename FilterOp>
+  StreamingConv1D(const FilterOp &filter, index_t chunk_size, const Executor &exec = Executor{}) :
+      exec_(exec), chunk_size_(chunk_size), filter_size_(filter.Size(0))
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_STATIC_ASSERT_STR(FilterOp::Rank() == 1, matxInvalidDim, "StreamingConv1D filter must be rank 1");
+    MATX_ASSERT_STR(chunk_size_ > 0 && filter_size_ > 0, matxInvalidSize,
+        "StreamingConv1D requires a non-empty filter and chunk size");
+
+    fft_size_ = 1;
+    while (fft_size_ < chunk_size_ + filter_size_ - 1) {
+      fft_size_ *= 2;
+    }
+
+    Allocate(spectrum_);
+    (spectrum_ = fft(as_type<complex_type>(filter), fft_size_)).run(exec_);
+
+    for (auto &buf : work_) {
+      Allocate(buf);
+    }
+    Reset();
+  }
+
+  /**
+   * Clear the signal history so the next chunk starts a new signal
+   */
+  void Reset()
+  {
+    for (auto &buf : work_) {
+      (buf = zeros<complex_type>({fft_size_})).run(exec_);
+    }
+    cur_ = 0;
+  }
+
+  /**
+   * Convolve the next chunk of the signal
+   *
+   * @param out Output of length chunk_size
+   * @param in Input of length chunk_size
+   */
+  template <typename OutType, typename InType>
+  void Process(OutType &out, const InType &in)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_STATIC_ASSERT_STR(OutType::Rank() == 1 && InType::Rank() == 1, matxInvalidDim,
+        "StreamingConv1D only processes rank 1 chunks");
+    MATX_ASSERT_STR(in.Size(0) == chunk_size_ && out.Size(0) == chunk_size_, matxInvalidSize,
+        "StreamingConv1D input and output must be exactly one chunk");
+
+    auto &work = work_[cur_];
+    auto &next = work_[cur_ ^ 1];
+    const index_t hist = filter_size_ - 1;
+
+    // work = [history (M - 1) | chunk | zeros]
+    (slice(work, {hist}, {hist + chunk_size_}) = as_type<complex_type>(in)).run(exec_);
+
+    // Every output past the history is free of circular wrap since the tail of the buffer is zero
+    auto y = slice(ifft(fft(work) * spectrum_), {hist}, {hist + chunk_size_});
+    if constexpr (is_complex_v<value_type>) {
+      (out = y).run(exec_);
+    }
+    else {
+      (out = real(y)).run(exec_);
+    }
+
+    if (hist > 0) {
+      (slice(next, {0}, {hist}) = slice(work, {chunk_size_}, {chunk_size_ + hist})).run(exec_);
+    }
+    cur_ ^= 1;
+  }
+
+  /** Samples per chunk */
+  index_t ChunkSize() const { return chunk_size_; }
+
+  /** Number of filter taps */
+  index_t FilterSize() const { return filter_size_; }
+
+  /** FFT length used for each chunk */
+  index_t FFTSize() const { return fft_size_; }
+
+private:
+  using buffer_type = tensor_t<complex_type, 1>;
+
+  void Allocate(buffer_type &buf)
+  {
+    if constexpr (is_cuda_executor_v<Executor>) {
+      make_tensor(buf, {fft_size_}, MATX_DEVICE_MEMORY);
+    }
+    else {
+      make_tensor(buf, {fft_size_}, MATX_HOST_MALLOC_MEMORY);
+    }
+  }
+
+  Executor exec_;
+  index_t chunk_size_;
+  index_t filter_size_;
+  index_t fft_size_;
+  buffer_type spectrum_;
+  buffer_type work_[2];
+  int cur_ = 0;
+};
+
+} // end namespace matx
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/make_sparse_tensor.h"
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/kernels/coo2csr.cuh"
+#include "matx/operators/cast.h"
+#include "matx/transforms/cub.h"
+
+namespace matx {
+namespace experimental {
+
+#ifdef __CUDACC__
+
+// Assembles a sparse matrix in CSR format on the device from COO triplets
+// that may appear in any order and may contain duplicates, as produced by
+// e.g. finite element assembly. Duplicate entries are summed. The triplets
+// are sorted by row, then column, with a single radix sort on linearized
+// keys, after which a reduce-by-key sums the duplicates and the positions
+// are built from the sorted unique keys. All work is enqueued on the stream
+// of the executor. The call synchronizes that stream once, to size the
+// output buffers for the number of unique entries. The output buffers reside
+// in the memory space of the input values, and positions use the index type
+// of the coordinates.
+template <typename ValTensor, typename CrdTensor>
+auto make_tensor_csr_from_coo(ValTensor &val, CrdTensor &row, CrdTensor &col,
+                              const index_t (&shape)[2],
+                              const cudaExecutor &exec) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using VAL = typename ValTensor::value_type;
+  using CRD = typename CrdTensor::value_type;
+  using POS = CRD;
+  // Proper structure.
+  MATX_STATIC_ASSERT_STR(ValTensor::Rank() == 1 && CrdTensor::Rank() == 1,
+                         matxInvalidParameter, "data arrays should be rank-1");
+  MATX_ASSERT_STR(val.Size(0) == row.Size(0) && val.Size(0) == col.Size(0),
+                  matxInvalidParameter,
+                  "data arrays should have consistent length (nse)");
+  MATX_ASSERT_STR(val.IsContiguous(), matxInvalidParameter,
+                  "values array should be contiguous");
+
+  const cudaStream_t stream = exec.getStream();
+  const index_t nnz = val.Size(0);
+  const uint64_t m = static_cast<uint64_t>(shape[0]);
+  const uint64_t n = static_cast<uint64_t>(shape[1]);
+  const matxMemorySpace_t space = GetPointerKind(val.Data());
+
+  // Sort the triplets by (row, col) and sum the duplicates.
+  index_t nse = 0;
+  auto ukeys = make_tensor<uint64_t>({nnz}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto uvals = make_tensor<VAL>({nnz}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  if (nnz > 0) {
+    auto keys = make_tensor<uint64_t>({nnz}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    auto skeys = make_tensor<uint64_t>({nnz}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    auto svals = make_tensor<VAL>({nnz}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    auto nruns = make_tensor<index_t>({1}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    (keys = as_uint64(row) * n + as_uint64(col)).run(exec);
+    detail::sort_pairs_impl_inner(svals, val, skeys, keys, SORT_DIR_ASC, exec);
+
+    void *d_temp = nullptr;
+    size_t temp_storage_bytes = 0;
+    cub::DeviceReduce::ReduceByKey(d_temp, temp_storage_bytes, skeys.Data(),
+                                   ukeys.Data(), svals.Data(), uvals.Data(),
+                                   nruns.Data(), cuda::std::plus<>{}, nnz,
+                                   stream);
+    matxAlloc(&d_temp, temp_storage_bytes, MATX_ASYNC_DEVICE_MEMORY, stream);
+    cub::DeviceReduce::ReduceByKey(d_temp, temp_storage_bytes, skeys.Data(),
+                                   ukeys.Data(), svals.Data(), uvals.Data(),
+                                   nruns.Data(), cuda::std::plus<>{}, nnz,
+                                   stream);
+    matxFree(d_temp, stream);
+    MATX_CUDA_CHECK(cudaMemcpyAsync(&nse, nruns.Data(), sizeof(index_t),
+                                    cudaMemcpyDeviceToHost, stream));
+    MATX_CUDA_CHECK(cudaStreamSynchronize(stream));
+  }
+
+  // Build the CSR buffers for the unique entries.
+  Storage<VAL> vals(static_cast<size_t>(nse), space, stream);
+  Storage<CRD> crd(static_cast<size_t>(nse), space, stream);
+  Storage<POS> pos(static_cast<size_t>(m + 1), space, stream);
+  if (nse > 0) {
+    MATX_CUDA_CHECK(cudaMemcpyAsync(vals.data(), uvals.Data(),
+                                    static_cast<size_t>(nse) * sizeof(VAL),
+                                    cudaMemcpyDefault, stream));
+  }
+  const uint32_t THREADS = 256;
+  const uint32_t BLOCKS = static_cast<uint32_t>(
+      (static_cast<uint64_t>(nse) + THREADS) / THREADS);
+  coo2csr_assemble_kernel<<<BLOCKS, THREADS, 0, stream>>>(
+      ukeys.Data(), static_cast<uint64_t>(nse), m, n, crd.data(), pos.data());
+
+  // Construct CSR.
+  return sparse_tensor_t<VAL, CRD, POS, CSR>(
+      shape, std::move(vals), {makeEmptyStorage<CRD>(), std::move(crd)},
+      {makeEmptyStorage<POS>(), std::move(pos)});
+}
+
+#endif
+
+} // end namespace experimental
+} // end namespace matx
@@ -41,6 +41,7 @@
 #include "matx/core/cache.h"
 #include "matx/core/sparse_tensor.h"
 #include "matx/core/tensor.h"
+#include "matx/kernels/dense2sparse.cuh"
 
 namespace matx {
 
@@ -91,7 +92,7 @@ public:
    */
   Dense2SparseHandle_t(TensorTypeO &o, const TensorTypeA &a,
                        cudaStream_t stream) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     params_ = GetConvParams(o, a, stream);
 
     [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
@@ -208,7 +209,7 @@ public:
 
   __MATX_INLINE__ void Exec([[maybe_unused]] TensorTypeO &o,
                             [[maybe_unused]] const TensorTypeA &a) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
     const cusparseDenseToSparseAlg_t algo = CUSPARSE_DENSETOSPARSE_ALG_DEFAULT;
     [[maybe_unused]] cusparseStatus_t ret =
         cusparseDenseToSparse_convert(handle_, matA_, matO_, algo, workspace_);
@@ -274,7 +275,7 @@ __MATX_INLINE__ auto getD2SSupportedTensor(const Op &in, cudaStream_t stream) {
 template <typename OutputTensorType, typename InputTensorType>
 void dense2sparse_impl(OutputTensorType &o, const InputTensorType &A,
                        const cudaExecutor &exec) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   // Transform into supported form.
@@ -321,4 +322,89 @@ void dense2sparse_impl(OutputTensorType &o, const InputTensorType &A,
       exec);
 }
 
+// Converts a dense matrix into a CSR or CSC matrix with room for at most
+// capacity entries, without synchronizing the stream. The nonzeros of each
+// row (CSR) or column (CSC) are counted on the device, the positions are an
+// exclusive scan of the counts, and a second pass writes the entries. Value
+// and coordinate buffers are reused when they already hold capacity entries,
+// and are otherwise allocated stream-ordered, as are all temporaries, so the
+// conversion can be captured into a CUDA graph. Nse() of the output is the
+// capacity; the number of valid entries is the last position. Entries past the
+// capacity are dropped.
+template <typename OutputTensorType, typename InputTensorType>
+void dense2sparse_capacity_impl([[maybe_unused]] OutputTensorType &o, [[maybe_unused]] const InputTensorType &A,
+                                [[maybe_unused]] index_t capacity, [[maybe_unused]] const cudaExecutor &exec) {
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using otype = OutputTensorType;
+  using VAL = typename otype::val_type;
+  using POS = typename otype::pos_type;
+  using CRD = typename otype::crd_type;
+
+  if constexpr (!otype::Format::isCSR() && !otype::Format::isCSC()) {
+    MATX_THROW(matxNotSupported,
+               "dense2sparse with a capacity only supports CSR/CSC");
+  } else {
+    const auto stream = exec.getStream();
+
+    // Transform into supported form.
+    auto a = detail::getD2SSupportedTensor(A, stream);
+    if (!is_matx_transform_op<InputTensorType>() && !a.isSameView(A)) {
+      (a = A).run(stream);
+    }
+
+    using atype = decltype(a);
+    static_assert(atype::Rank() == 2 && otype::Rank() == 2,
+                  "dense2sparse with a capacity requires matrices");
+    static_assert(std::is_same_v<typename atype::value_type, VAL>,
+                  "tensors must have the same data type");
+    MATX_ASSERT(a.Stride(1) == 1, matxInvalidParameter);
+
+    constexpr bool BY_COL = otype::Format::isCSC();
+    const index_t m = a.Size(0);
+    const index_t n = a.Size(1);
+    const index_t lines = BY_COL ? n : m;
+    MATX_ASSERT_STR(capacity > 0, matxInvalidParameter,
+                    "dense2sparse: capacity must be positive");
+    MATX_ASSERT_STR(o.posSize(1) == lines + 1, matxInvalidSize,
+                    "dense2sparse: output needs one position per row (CSR) or column (CSC), plus one");
+
+    // Device buffers come from the stream-ordered pool.
+    if (o.Nse() != capacity) {
+      matxMemorySpace_t space = GetPointerKind(o.POSData(1));
+      if (space == MATX_DEVICE_MEMORY) {
+        space = MATX_ASYNC_DEVICE_MEMORY;
+      }
+      o.SetVal(Storage<VAL>(static_cast<size_t>(capacity), space, stream));
+      o.SetCrd(1, Storage<CRD>(static_cast<size_t>(capacity), space, stream));
+      o.SetSparseDataImpl();
+    }
+
+    auto counts = make_tensor<index_t>({lines + 1}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    auto offsets = make_tensor<index_t>({lines + 1}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    const uint32_t blocks = static_cast<uint32_t>(
+        cuda::std::max(static_cast<index_t>(1),
+                       cuda::std::min(lines, DENSE2SPARSE_MAX_BLOCKS)));
+
+    dense2sparse_count_kernel<BY_COL><<<blocks, DENSE2SPARSE_THREADS, 0, stream>>>(
+        a.Data(), m, n, counts.Data());
+
+    void *d_temp = nullptr;
+    size_t temp_storage_bytes = 0;
+    cub::DeviceScan::ExclusiveSum(d_temp, temp_storage_bytes, counts.Data(),
+                                  offsets.Data(), lines + 1, stream);
+    matxAlloc(&d_temp, temp_storage_bytes, MATX_ASYNC_DEVICE_MEMORY, stream);
+    cub::DeviceScan::ExclusiveSum(d_temp, temp_storage_bytes, counts.Data(),
+                                  offsets.Data(), lines + 1, stream);
+    matxFree(d_temp, stream);
+
+    dense2sparse_fill_kernel<BY_COL><<<blocks, DENSE2SPARSE_THREADS, 0, stream>>>(
+        a.Data(), m, n, offsets.Data(), capacity, o.Data(), o.CRDData(1),
+        o.POSData(1));
+  }
+#else
+  MATX_THROW(matxNotSupported, "dense2sparse with a capacity requires compiling with nvcc");
+#endif
+}
+
 } // end namespace matx
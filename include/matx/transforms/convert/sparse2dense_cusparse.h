@@ -77,7 +77,7 @@ public:
    */
   Sparse2DenseHandle_t(TensorTypeO &o, const TensorTypeA &a,
                        cudaStream_t stream) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     params_ = GetConvParams(o, a, stream);
 
     [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
@@ -159,7 +159,7 @@ public:
 
   __MATX_INLINE__ void Exec([[maybe_unused]] TensorTypeO &o,
                             [[maybe_unused]] const TensorTypeA &a) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
     const cusparseSparseToDenseAlg_t algo = CUSPARSE_SPARSETODENSE_ALG_DEFAULT;
     [[maybe_unused]] cusparseStatus_t ret =
         cusparseSparseToDense(handle_, matA_, matO_, algo, workspace_);
@@ -224,7 +224,7 @@ __MATX_INLINE__ auto getS2DSupportedTensor(const Op &in, cudaStream_t stream) {
 template <typename OutputTensorType, typename InputTensorType>
 void sparse2dense_impl(OutputTensorType &O, const InputTensorType &a,
                        const cudaExecutor &exec) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   // Transform into supported form.
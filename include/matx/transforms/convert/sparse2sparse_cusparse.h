@@ -89,7 +89,7 @@ public:
    */
   Sparse2SparseHandle_t(TensorTypeO &o, const TensorTypeA &a,
                         cudaStream_t stream) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     params_ = GetConvParams(o, a, stream);
 
     [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
@@ -143,7 +143,7 @@ public:
 
   __MATX_INLINE__ void Exec([[maybe_unused]] TensorTypeO &o,
                             [[maybe_unused]] const TensorTypeA &a) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
     const cusparseIndexBase_t base = CUSPARSE_INDEX_BASE_ZERO;
     // Legacy API takes specific types only.
     CRD *crd = reinterpret_cast<CRD *>(params_.ptrA2);
@@ -200,7 +200,7 @@ using sparse2sparse_cache_t =
 template <typename OutputTensorType, typename InputTensorType>
 void sparse2sparse_impl(OutputTensorType &o, const InputTensorType &a,
                         const cudaExecutor &exec) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   using atype = InputTensorType;
@@ -64,7 +64,7 @@ namespace matx
     __MATX_INLINE__ void copy(OutputTensor &out, const InputTensor &in,
         Executor exec)
     {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
       for (int i = 0; i < OutputTensor::Rank(); i++)
       {
         MATX_ASSERT(out.Size(i) == in.Size(i), matxInvalidSize);
@@ -82,7 +82,7 @@ namespace matx
     __MATX_INLINE__ void copy(OutputTensor &out, const InputTensor &in,
         cudaStream_t stream = 0)
     {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
       matx::copy(out, in, cudaExecutor(stream));
     };
 
@@ -106,7 +106,7 @@ namespace matx
 #endif  
   __MATX_INLINE__ Tensor copy(const Tensor &in, Executor exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     auto out = make_tensor<typename Tensor::value_type>(in.Shape());
     matx::copy(out, in, exec);
     return out;
@@ -115,7 +115,7 @@ namespace matx
   template <typename Tensor>
   __MATX_INLINE__ Tensor copy(const Tensor &in, cudaStream_t stream = 0)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     return matx::copy(in, cudaExecutor(stream));
   };
 } // end namespace matx
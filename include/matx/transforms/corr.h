@@ -62,7 +62,7 @@ __MATX_INLINE__ void corr_impl(OutputTensor o, const In1Type i1, const In2Type i
           matxConvCorrMode_t mode, matxConvCorrMethod_t method,
           const Executor &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   
   auto i2r = reverse<In2Type::Rank()-1>(conj(i2));
   conv1d_impl(o, i1, i2r, mode, method, exec);
@@ -33,13 +33,19 @@
 
 #pragma once
 
+#include <cublas_v2.h>
+
 #include <cstdio>
 #include <numeric>
+#include <vector>
 
 #include "matx/core/error.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/tensor.h"
+#include "matx/operators/if.h"
+#include "matx/operators/index.h"
 #include "matx/transforms/matmul/matmul_cuda.h"
+#include "matx/transforms/solver_common.h"
 #include "matx/transforms/transpose.h"
 
 namespace matx {
@@ -54,6 +60,11 @@ struct CovParams_t {
   cudaStream_t stream;
 };
 
+template <typename T>
+constexpr bool cov_rank_k_type_v = std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                                   std::is_same_v<T, cuda::std::complex<float>> ||
+                                   std::is_same_v<T, cuda::std::complex<double>>;
+
 template <typename TensorTypeC, typename TensorTypeA> class matxCovHandle_t {
 public:
   static constexpr int RANK = TensorTypeA::Rank();
@@ -82,7 +93,7 @@ public:
     MATX_ASSERT(c.Size(RANK - 1) == c.Size(RANK - 2), matxInvalidSize);
     MATX_ASSERT(a.Size(RANK - 1) == c.Size(RANK - 1), matxInvalidSize);
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Ensure batch dimensions are equal
     for (int i = 2; i < RANK - 2; i++) {
@@ -92,22 +103,39 @@ public:
     // This must come before the things below to properly set class parameters
     params_ = GetCovParams(c, a, stream);
 
-    make_tensor(onesM, {a.Size(RANK - 2), a.Size(RANK - 2)}, MATX_ASYNC_DEVICE_MEMORY, stream);
-    make_tensor(means, a.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
+    // One row of column means per batch
+    cuda::std::array<index_t, RANK> mean_shape = a.Shape();
+    mean_shape[RANK - 2] = 1;
+
+    make_tensor(onesV, {1, a.Size(RANK - 2)}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    make_tensor(means, mean_shape, MATX_ASYNC_DEVICE_MEMORY, stream);
     make_tensor(devs, a.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
 
-    // Transposed view of deviations
-    cuda::std::array<index_t, RANK> tmp;
-    for (int i = 0; i < RANK-2; i++) {
-      tmp[i] = a.Size(i);
+    if constexpr (cov_rank_k_type_v<T1>) {
+      [[maybe_unused]] cublasStatus_t ret = cublasCreate(&blas_handle_);
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxCudaError);
     }
-    tmp[RANK-2] = a.Size(RANK-1);
-    tmp[RANK-1] = a.Size(RANK-2);
+    else {
+      // Transposed view of deviations
+      cuda::std::array<index_t, RANK> tmp;
+      for (int i = 0; i < RANK-2; i++) {
+        tmp[i] = a.Size(i);
+      }
+      tmp[RANK-2] = a.Size(RANK-1);
+      tmp[RANK-1] = a.Size(RANK-2);
 
-    make_tensor(devsT, tmp, MATX_ASYNC_DEVICE_MEMORY, stream);
+      make_tensor(devsT, tmp, MATX_ASYNC_DEVICE_MEMORY, stream);
+    }
 
-    // Populate our ones matrix
-    (onesM = ones()).run(stream);
+    // Populate our ones vector
+    (onesV = ones()).run(stream);
+  }
+
+  ~matxCovHandle_t()
+  {
+    if (blas_handle_ != nullptr) {
+      cublasDestroy(blas_handle_);
+    }
   }
 
   static CovParams_t GetCovParams([[maybe_unused]] TensorTypeC &c, const TensorTypeA &a, cudaStream_t stream = 0)
@@ -128,6 +156,11 @@ public:
  * matrix where the diagonals are the variances, and off-diagonals are
  * covariances.
  *
+ * For float, double and their complex types the deviations are multiplied with
+ * a rank-k update (syrk/herk), which only computes one triangle. The other
+ * triangle is then mirrored or zeroed depending on fill. Other types use a
+ * general matrix multiply.
+ *
  * Passing a tensor of rank > 2 acts as batching dimensions
  *
  *
@@ -139,44 +172,129 @@ public:
  *   Input tensor A
  * @param exec
  *   CUDA executor
+ * @param fill
+ *   Whether to write the full matrix or only its upper triangle
  *
  */
   inline void Exec(TensorTypeC &c, const TensorTypeA &a,
-                   const cudaExecutor &exec)
+                   const cudaExecutor &exec, CovFill fill = CovFill::FULL)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     const auto stream = exec.getStream();
+    const index_t n = a.Size(RANK - 2);
 
-    // Calculate a matrix of means
-    matmul_impl(means, onesM, a, exec,
-                 1.0f / static_cast<float>(a.Size(RANK - 2)));
+    // Calculate the column means with a single row of ones
+    matmul_impl(means, onesV, a, exec, 1.0f / static_cast<float>(n));
 
-    // Subtract the means from the observations to get the deviations
-    (devs = a - means).run(stream);
+    // Subtract the means, broadcast over the observations, to get the deviations
+    cuda::std::array<index_t, RANK - 1> row_shape;
+    cuda::std::array<index_t, RANK> clone_shape;
+    for (int i = 0; i < RANK - 2; i++) {
+      row_shape[i] = a.Size(i);
+      clone_shape[i] = matxKeepDim;
+    }
+    row_shape[RANK - 2] = a.Size(RANK - 1);
+    clone_shape[RANK - 2] = n;
+    clone_shape[RANK - 1] = matxKeepDim;
+    auto mean_rows = make_tensor<T1>(means.Data(), row_shape);
+    (devs = a - clone<RANK>(mean_rows, clone_shape)).run(stream);
 
-    if constexpr (is_complex_v<T1>) {
-      // This step is not really necessary since BLAS can do it for us, but
-      // until we have a way to detect a Hermitian property on a matrix, we need
-      // to have this in a temporary variable. Note that we use the Python
-      // convention of E[XX'] instead of MATLAB's E[X'X]. Both are "correct",
-      // but we need to match python output
-      (devsT = hermitianT(devs)).run(stream);
+    if constexpr (cov_rank_k_type_v<T1>) {
+      RankKUpdate(c, fill, exec);
     }
     else {
-      (devsT = transpose_matrix(devs)).run(stream);
-    }
+      if constexpr (is_complex_v<T1>) {
+        // This step is not really necessary since BLAS can do it for us, but
+        // until we have a way to detect a Hermitian property on a matrix, we need
+        // to have this in a temporary variable. Note that we use the Python
+        // convention of E[XX'] instead of MATLAB's E[X'X]. Both are "correct",
+        // but we need to match python output
+        (devsT = hermitianT(devs)).run(stream);
+      }
+      else {
+        (devsT = transpose_matrix(devs)).run(stream);
+      }
+
+      // Multiply by itself and scale by N-1 for the final covariance
+      matmul_impl(c, devsT, devs, exec,
+                  1.0f / static_cast<float>(n - 1));
 
-    // Multiply by itself and scale by N-1 for the final covariance
-    matmul_impl(c, devsT, devs, exec,
-                1.0f / static_cast<float>(a.Size(RANK - 2) - 1));
+      if (fill == CovFill::UPPER) {
+        (IF(index(RANK - 2) > index(RANK - 1), c = T1(0))).run(exec);
+      }
+    }
   }
 
   private:
+    /**
+     * cuBLAS is column-major, so the row-major N x M deviations are seen as an
+     * M x N matrix D, and D D^H in column-major order is conj(devs)^T devs in
+     * row-major order. The lower triangle of the column-major result is the
+     * upper triangle of the row-major one.
+     */
+    void RankKUpdate(TensorTypeC &c, CovFill fill, const cudaExecutor &exec)
+    {
+      using real_type = typename inner_op_type_t<T1>::type;
+      const auto stream = exec.getStream();
+      const int m = static_cast<int>(devs.Size(RANK - 1));
+      const int k = static_cast<int>(devs.Size(RANK - 2));
+
+      const auto support_func = [&]() {
+        return c.Stride(RANK - 1) == 1 && c.Stride(RANK - 2) >= c.Size(RANK - 1);
+      };
+      auto c_new = GetSupportedTensor(c, support_func, MATX_ASYNC_DEVICE_MEMORY, stream);
+      const int ldc = static_cast<int>(c_new.Stride(RANK - 2));
+
+      std::vector<T1 *> dev_ptrs;
+      std::vector<T1 *> c_ptrs;
+      SetBatchPointers<BatchType::MATRIX>(devs, dev_ptrs);
+      SetBatchPointers<BatchType::MATRIX>(c_new, c_ptrs);
+
+      cublasSetStream(blas_handle_, stream);
+      const real_type alpha = real_type(1) / static_cast<real_type>(k - 1);
+      const real_type beta = 0;
+      [[maybe_unused]] cublasStatus_t ret = CUBLAS_STATUS_SUCCESS;
+      for (size_t b = 0; b < dev_ptrs.size(); b++) {
+        if constexpr (std::is_same_v<T1, float>) {
+          ret = cublasSsyrk(blas_handle_, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, m, k, &alpha,
+                            dev_ptrs[b], m, &beta, c_ptrs[b], ldc);
+        }
+        else if constexpr (std::is_same_v<T1, double>) {
+          ret = cublasDsyrk(blas_handle_, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, m, k, &alpha,
+                            dev_ptrs[b], m, &beta, c_ptrs[b], ldc);
+        }
+        else if constexpr (std::is_same_v<T1, cuda::std::complex<float>>) {
+          ret = cublasCherk(blas_handle_, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, m, k, &alpha,
+                            reinterpret_cast<const cuComplex *>(dev_ptrs[b]), m, &beta,
+                            reinterpret_cast<cuComplex *>(c_ptrs[b]), ldc);
+        }
+        else {
+          ret = cublasZherk(blas_handle_, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_N, m, k, &alpha,
+                            reinterpret_cast<const cuDoubleComplex *>(dev_ptrs[b]), m, &beta,
+                            reinterpret_cast<cuDoubleComplex *>(c_ptrs[b]), ldc);
+        }
+        MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxCudaError);
+      }
+
+      // The lower triangle is only ever read from the upper one, so this is safe in place
+      if (fill == CovFill::FULL) {
+        (IF(index(RANK - 2) > index(RANK - 1), c_new = conj(transpose_matrix(c_new)))).run(exec);
+      }
+      else {
+        (IF(index(RANK - 2) > index(RANK - 1), c_new = T1(0))).run(exec);
+      }
+
+      if (!c_new.isSameView(c)) {
+        (c = c_new).run(exec);
+      }
+    }
+
     // Member variables
-    matx::tensor_t<T1, 2> onesM;
+    matx::tensor_t<T1, 2> onesV;
     matx::tensor_t<T1, RANK> means;
     matx::tensor_t<T1, RANK> devs;
     matx::tensor_t<T1, RANK> devsT;
+    cublasHandle_t blas_handle_ = nullptr;
     CovParams_t params_;
 };
 
@@ -228,12 +346,14 @@ using cov_cache_t = std::unordered_map<CovParams_t, std::any, CovParamsKeyHash,
  *   Covariance matrix input view
  * @param exec
  *   CUDA executor
+ * @param fill
+ *   Whether to write the full matrix or only its upper triangle
  */
 template <typename TensorTypeC, typename TensorTypeA>
 void cov_impl(TensorTypeC &c, const TensorTypeA &a,
-         const cudaExecutor &exec)
+         const cudaExecutor &exec, CovFill fill = CovFill::FULL)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
   
   // Get parameters required by these tensors
@@ -249,7 +369,7 @@ void cov_impl(TensorTypeC &c, const TensorTypeA &a,
       return std::make_shared<cache_val_type>(c, a);
     },
     [&](std::shared_ptr<cache_val_type> ctype) {
-      ctype->Exec(c, a, exec);
+      ctype->Exec(c, a, exec, fill);
     },
     exec
   );
@@ -33,9 +33,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <cstdio>
 #include <numeric>
+#include <vector>
 
 #ifdef __CUDACC__
 #include <cub/cub.cuh>
@@ -48,7 +50,11 @@
 #include "matx/core/iterator.h"
 #include "matx/core/operator_utils.h"
 #include "matx/core/type_utils_both.h"
+#include "matx/operators/cast.h"
+#include "matx/operators/unary_operators.h"
 #include "matx/transforms/cccl_iterators.h"
+#include "matx/transforms/hist.h"
+#include "matx/transforms/scan.h"
 
 
 namespace matx {
@@ -73,6 +79,7 @@ typedef enum {
   CUB_OP_UNIQUE,
   CUB_OP_SINGLE_ARG_REDUCE,
   CUB_OP_DUAL_ARG_REDUCE,
+  CUB_OP_STATS_REDUCE,
 } CUBOperation_t;
 
 struct CubParams_t {
@@ -112,6 +119,47 @@ struct UniqueParams_t {
 
 struct EmptyParams_t {};
 
+/**
+ * Sort keys as CUB's radix sorts see them. matxFp16 and matxBf16 have the layout of __half and
+ * __nv_bfloat16, which CUB sorts natively in half the passes of a 32-bit key.
+ */
+template <typename T>
+__MATX_INLINE__ auto cub_sort_keys(T *p)
+{
+  using key_type = convert_matx_type_t<cuda::std::remove_cv_t<T>>;
+  if constexpr (cuda::std::is_const_v<T>) {
+    return reinterpret_cast<const key_type *>(p);
+  }
+  else {
+    return reinterpret_cast<key_type *>(p);
+  }
+}
+
+/**
+ * Keys a sort ranks its input by. Complex values are ordered by magnitude, which ranks the same as
+ * |z|^2 and needs no square root. Half precision complex is widened first so |z|^2 can't overflow.
+ */
+template <typename Op>
+__MATX_INLINE__ auto sort_keys_op(const Op &a)
+{
+  using value_type = typename Op::value_type;
+  if constexpr (is_complex_half_v<value_type>) {
+    return abs2(as_complex_float(a));
+  }
+  else if constexpr (is_complex_v<value_type>) {
+    return abs2(a);
+  }
+  else {
+    return a;
+  }
+}
+
+template <typename Op>
+using sort_key_t = typename decltype(sort_keys_op(cuda::std::declval<const Op &>()))::value_type;
+
+template <typename T>
+inline constexpr bool sort_by_magnitude_v = is_complex_v<T> || is_complex_half_v<T>;
+
 
 
 template <typename OutputTensor, typename InputOperator, CUBOperation_t op, typename CParams = EmptyParams_t>
@@ -151,7 +199,7 @@ public:
       }
     }
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if constexpr (op == CUB_OP_RADIX_SORT) {
       ExecSort(a_out, a, cparams_.dir, stream);
@@ -241,7 +289,7 @@ public:
   template <typename Func>
   void RunBatches(OutputTensor &a_out, const InputOperator &a, const Func &f, int batch_offset)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     using shape_type = index_t;
     size_t total_iter = 1;
@@ -320,7 +368,7 @@ public:
                            const T1 upper, int num_levels, const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     const tensor_impl_t<typename InputOperator::value_type, InputOperator::Rank(), typename InputOperator::desc_type> base = a;
     if (RANK == 1 || d_temp == nullptr) {
@@ -374,7 +422,7 @@ public:
                                const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (RANK == 1 || d_temp == nullptr) {
       if constexpr (is_tensor_view_v<InputOperator>) {
@@ -454,7 +502,7 @@ public:
     {
       cub::DeviceSegmentedSort::SortKeys(
           d_temp, temp_storage_bytes,
-          a.Data(), a_out.Data(),
+          cub_sort_keys(a.Data()), cub_sort_keys(a_out.Data()),
           num_items,
           num_segments,
           BeginOffset{a}, EndOffset{a}, stream);
@@ -463,7 +511,7 @@ public:
     {
       cub::DeviceSegmentedSort::SortKeysDescending(
           d_temp, temp_storage_bytes,
-          a.Data(), a_out.Data(),
+          cub_sort_keys(a.Data()), cub_sort_keys(a_out.Data()),
           num_items,
           num_segments,
           BeginOffset{a}, EndOffset{a}, stream);
@@ -503,7 +551,7 @@ inline void ExecSort(OutputTensor &a_out,
     MATX_THROW(matxInvalidType, "Tensor must be contiguous in memory for sorting");
   }
 
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
 #if (CUB_MAJOR_VERSION == 1 && CUB_MINOR_VERSION  >  14) || (CUB_MAJOR_VERSION > 1)
   // use optimized segmented sort if:
@@ -532,13 +580,13 @@ inline void ExecSort(OutputTensor &a_out,
       if (dir == SORT_DIR_ASC)
       {
         cub::DeviceRadixSort::SortKeys(
-            d_temp, temp_storage_bytes, a.Data(), a_out.Data(),
+            d_temp, temp_storage_bytes, cub_sort_keys(a.Data()), cub_sort_keys(a_out.Data()),
             static_cast<int>(a.Size(RANK-1)), 0, sizeof(T1) * 8, stream);
       }
       else
       {
         cub::DeviceRadixSort::SortKeysDescending(
-            d_temp, temp_storage_bytes, a.Data(), a_out.Data(),
+            d_temp, temp_storage_bytes, cub_sort_keys(a.Data()), cub_sort_keys(a_out.Data()),
             static_cast<int>(a.Size(RANK-1)), 0, sizeof(T1) * 8, stream);
       }
     }
@@ -551,7 +599,7 @@ inline void ExecSort(OutputTensor &a_out,
       if (dir == SORT_DIR_ASC)
       {
         cub::DeviceSegmentedRadixSort::SortKeys(
-          d_temp, temp_storage_bytes, a.Data(), a_out.Data(),
+          d_temp, temp_storage_bytes, cub_sort_keys(a.Data()), cub_sort_keys(a_out.Data()),
           static_cast<int>(a.Size(RANK-1)*a.Size(RANK-2)),
           static_cast<int>(a.Size(RANK - 2)),
           BeginOffset{a}, EndOffset{a}, 0, sizeof(T1) * 8, stream);
@@ -559,7 +607,7 @@ inline void ExecSort(OutputTensor &a_out,
       else
       {
         cub::DeviceSegmentedRadixSort::SortKeysDescending(
-            d_temp, temp_storage_bytes, a.Data(), a_out.Data(),
+            d_temp, temp_storage_bytes, cub_sort_keys(a.Data()), cub_sort_keys(a_out.Data()),
             static_cast<int>(a.Size(RANK-1)*a.Size(RANK-2)), static_cast<int>(a.Size(RANK - 2)),
             BeginOffset{a}, EndOffset{a}, 0, sizeof(T1) * 8, stream);
       }
@@ -593,7 +641,7 @@ inline void ExecSort(OutputTensor &a_out,
           auto ap = cuda::std::apply([&a](auto... param) { return a.GetPointer(param...); }, idx);
           auto aop = cuda::std::apply([&a_out](auto... param) { return a_out.GetPointer(param...); }, idx);
 
-          f(ap, aop);
+          f(cub_sort_keys(ap), cub_sort_keys(aop));
 
           // Update all but the last batch_offset indices
           UpdateIndices<InputOperator, shape_type, InputOperator::Rank()>(a, idx, batch_offset);
@@ -611,7 +659,7 @@ inline void ExecSort(OutputTensor &a_out,
           auto ap = cuda::std::apply([&a](auto... param) { return a.GetPointer(param...); }, idx);
           auto aop = cuda::std::apply([&a_out](auto... param) { return a_out.GetPointer(param...); }, idx);
 
-          f(ap, aop);
+          f(cub_sort_keys(ap), cub_sort_keys(aop));
 
           // Update all but the last batch_offset indices
           UpdateIndices<InputOperator, shape_type, InputOperator::Rank()>(a, idx, batch_offset);
@@ -646,7 +694,7 @@ inline void ExecSort(OutputTensor &a_out,
                        const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     typename detail::base_type_t<InputOperator> in_base = a;
     typename detail::base_type_t<OutputTensor> out_base = a_out;
@@ -717,7 +765,7 @@ inline void ExecSort(OutputTensor &a_out,
                        const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     typename detail::base_type_t<InputOperator> in_base = a;
     typename detail::base_type_t<OutputTensor> out_base = a_out;
@@ -783,7 +831,7 @@ inline void ExecSort(OutputTensor &a_out,
                        const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     typename detail::base_type_t<InputOperator> in_base = a;
     typename detail::base_type_t<OutputTensor> out_base = a_out;
 
@@ -829,7 +877,7 @@ inline void ExecSort(OutputTensor &a_out,
                        const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     typename detail::base_type_t<InputOperator> in_base = a;
     typename detail::base_type_t<OutputTensor> out_base = a_out;
 
@@ -875,7 +923,7 @@ inline void ExecSort(OutputTensor &a_out,
                        const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if constexpr (is_tensor_view_v<InputOperator>) {
       const tensor_impl_t<typename InputOperator::value_type, InputOperator::Rank(), typename InputOperator::desc_type> base = a;
@@ -953,7 +1001,7 @@ inline void ExecSort(OutputTensor &a_out,
                        const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (!has_index_cmp_op_v<decltype(cparams_.op)>) {
       if constexpr (is_tensor_view_v<InputOperator>) {
@@ -1030,7 +1078,7 @@ inline void ExecSort(OutputTensor &a_out,
                        const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
       if constexpr (is_tensor_view_v<InputOperator>) {
         const tensor_impl_t<typename InputOperator::value_type, InputOperator::Rank(), typename InputOperator::desc_type> base = a;
@@ -1163,8 +1211,62 @@ struct CustomArgMinMaxCmp
     return result;
   }
 };
+
+/**
+ * Combines two partial (count, mean, M2, min, max) tuples using the pairwise
+ * Welford update (Chan et al.). Each input element enters the reduction as
+ * (1, x, 0, x, x), so the same functor is used for both the per-element and
+ * the partial-result steps.
+ */
+struct CustomStatsCmp
+{
+  template <typename T>
+  __MATX_DEVICE__ __MATX_HOST__ __MATX_INLINE__ T operator()(const T &a, const T &b) const {
+    using value_type = remove_cvref_t<decltype(cuda::std::get<1>(a))>;
+
+    const auto na = cuda::std::get<0>(a);
+    const auto nb = cuda::std::get<0>(b);
+    if (na == 0) {
+      return b;
+    }
+    if (nb == 0) {
+      return a;
+    }
+
+    T result;
+    const auto n = na + nb;
+    const value_type delta = cuda::std::get<1>(b) - cuda::std::get<1>(a);
+    const value_type wb = static_cast<value_type>(nb) / static_cast<value_type>(n);
+
+    cuda::std::get<0>(result) = n;
+    cuda::std::get<1>(result) = cuda::std::get<1>(a) + delta * wb;
+    cuda::std::get<2>(result) = cuda::std::get<2>(a) + cuda::std::get<2>(b) +
+                                delta * delta * static_cast<value_type>(na) * wb;
+    cuda::std::get<3>(result) = cuda::std::get<3>(b) < cuda::std::get<3>(a) ? cuda::std::get<3>(b) : cuda::std::get<3>(a);
+    cuda::std::get<4>(result) = cuda::std::get<4>(a) < cuda::std::get<4>(b) ? cuda::std::get<4>(b) : cuda::std::get<4>(a);
+
+    return result;
+  }
+};
 #endif
 
+/**
+ * Call f with the input iterator CUB reads an operator through. Contiguous tensors are passed as raw
+ * pointers, which skips the index math of the operator on every load and lets CUB vectorize them.
+ */
+template <typename Op, typename Func>
+__MATX_INLINE__ void WithCubInputIterator(const Op &a, Func &&f)
+{
+  if constexpr (is_tensor_view_v<Op>) {
+    if (a.IsContiguous()) {
+      f(a.Data());
+      return;
+    }
+  }
+
+  f(matx::RandomOperatorThrustIterator{a});
+}
+
 template <typename OutputTensor, typename TensorIndexType, typename InputOperator, typename CParams = EmptyParams_t>
 class matxCubSingleArgPlan_t {
   using T1 = typename InputOperator::value_type;
@@ -1174,7 +1276,7 @@ public:
     cparams_(cparams)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (op == CUB_OP_SINGLE_ARG_REDUCE) {
       ExecArgReduce(a_out, aidx_out, a, stream);
@@ -1243,46 +1345,47 @@ public:
                             const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
-
-    const auto a_iter = matx::RandomOperatorThrustIterator{a};
-    const auto zipped_input = detail::make_zip_iterator(detail::make_counting_iterator<matx::index_t>(0), a_iter);
-    const auto zipped_output = detail::make_zip_iterator(aidx_out.Data(), a_out.Data());
-
-    if constexpr (OutputTensor::Rank() > 0) {
-      const int BATCHES = static_cast<int>(TotalSize(a_out));
-      const int N = static_cast<int>(TotalSize(a)) / BATCHES;
-
-      const auto r0 = matx::range<0>({BATCHES},0,N);
-      const auto r0_iter = matx::RandomOperatorIterator{r0};
-      const auto r1 = matx::range<0>({BATCHES},N,N);
-      const auto r1_iter = matx::RandomOperatorIterator{r1};
-
-      cub::DeviceSegmentedReduce::Reduce(
-        d_temp,
-        temp_storage_bytes,
-        zipped_input,
-        zipped_output,
-        BATCHES,
-        r0_iter,
-        r1_iter,
-        cparams_.reduce_op,
-        cparams_.init,
-        stream);
-    }
-    else {
-      const int N = static_cast<int>(TotalSize(a));
-
-      cub::DeviceReduce::Reduce(
-        d_temp,
-        temp_storage_bytes,
-        zipped_input,
-        zipped_output,
-        N,
-        cparams_.reduce_op,
-        cparams_.init,
-        stream);
-    }
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    detail::WithCubInputIterator(a, [&](const auto &a_iter) {
+      const auto zipped_input = detail::make_zip_iterator(detail::make_counting_iterator<matx::index_t>(0), a_iter);
+      const auto zipped_output = detail::make_zip_iterator(aidx_out.Data(), a_out.Data());
+
+      if constexpr (OutputTensor::Rank() > 0) {
+        const int BATCHES = static_cast<int>(TotalSize(a_out));
+        const int N = static_cast<int>(TotalSize(a)) / BATCHES;
+
+        const auto r0 = matx::range<0>({BATCHES},0,N);
+        const auto r0_iter = matx::RandomOperatorIterator{r0};
+        const auto r1 = matx::range<0>({BATCHES},N,N);
+        const auto r1_iter = matx::RandomOperatorIterator{r1};
+
+        cub::DeviceSegmentedReduce::Reduce(
+          d_temp,
+          temp_storage_bytes,
+          zipped_input,
+          zipped_output,
+          BATCHES,
+          r0_iter,
+          r1_iter,
+          cparams_.reduce_op,
+          cparams_.init,
+          stream);
+      }
+      else {
+        const int N = static_cast<int>(TotalSize(a));
+
+        cub::DeviceReduce::Reduce(
+          d_temp,
+          temp_storage_bytes,
+          zipped_input,
+          zipped_output,
+          N,
+          cparams_.reduce_op,
+          cparams_.init,
+          stream);
+      }
+    });
 #endif
   }
 
@@ -1324,7 +1427,7 @@ public:
     cparams_(cparams)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (op == CUB_OP_DUAL_ARG_REDUCE) {
       ExecDualArgReduce(a1_out, aidx1_out, a2_out, aidx2_out, a, stream);
@@ -1401,52 +1504,205 @@ public:
                                 const cudaStream_t stream)
   {
 #ifdef __CUDACC__
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    detail::WithCubInputIterator(a, [&](const auto &a_iter) {
+      const auto zipped_input = detail::make_zip_iterator(detail::make_counting_iterator<matx::index_t>(0),
+                                                          a_iter,
+                                                          detail::make_counting_iterator<matx::index_t>(0),
+                                                          a_iter);
+      const auto zipped_output = detail::make_zip_iterator(aidx1_out.Data(), a1_out.Data(), aidx2_out.Data(), a2_out.Data());
+
+      if constexpr (OutputTensor::Rank() > 0) {
+        const int BATCHES = static_cast<int>(TotalSize(a1_out));
+        const int N = static_cast<int>(TotalSize(a)) / BATCHES;
+
+        const auto r0 = matx::range<0>({BATCHES},0,N);
+        const auto r0_iter = matx::RandomOperatorIterator{r0};
+        const auto r1 = matx::range<0>({BATCHES},N,N);
+        const auto r1_iter = matx::RandomOperatorIterator{r1};
+
+        cub::DeviceSegmentedReduce::Reduce(
+          d_temp,
+          temp_storage_bytes,
+          zipped_input,
+          zipped_output,
+          BATCHES,
+          r0_iter,
+          r1_iter,
+          cparams_.reduce_op,
+          cparams_.init,
+          stream);
+      }
+      else {
+        const int N = static_cast<int>(TotalSize(a));
+
+        cub::DeviceReduce::Reduce(
+          d_temp,
+          temp_storage_bytes,
+          zipped_input,
+          zipped_output,
+          N,
+          cparams_.reduce_op,
+          cparams_.init,
+          stream);
+      }
+    });
+#endif
+  }
 
-    const auto a_iter = matx::RandomOperatorThrustIterator{a};
-    const auto zipped_input = detail::make_zip_iterator(detail::make_counting_iterator<matx::index_t>(0),
-                                                        a_iter,
-                                                        detail::make_counting_iterator<matx::index_t>(0),
-                                                        a_iter);
-    const auto zipped_output = detail::make_zip_iterator(aidx1_out.Data(), a1_out.Data(), aidx2_out.Data(), a2_out.Data());
 
-    if constexpr (OutputTensor::Rank() > 0) {
-      const int BATCHES = static_cast<int>(TotalSize(a1_out));
-      const int N = static_cast<int>(TotalSize(a)) / BATCHES;
+  /**
+   * Destructor
+   *
+   * Destroys any helper data used for provider type and any workspace memory
+   * created
+   *
+   */
+  ~matxCubDualArgPlan_t()
+  {
+    matxFree(d_temp, cudaStreamDefault);
+  }
 
-      const auto r0 = matx::range<0>({BATCHES},0,N);
-      const auto r0_iter = matx::RandomOperatorIterator{r0};
-      const auto r1 = matx::range<0>({BATCHES},N,N);
-      const auto r1_iter = matx::RandomOperatorIterator{r1};
+private:
+  // Member variables
+  cublasStatus_t ret = CUBLAS_STATUS_SUCCESS;
 
-      cub::DeviceSegmentedReduce::Reduce(
-        d_temp,
-        temp_storage_bytes,
-        zipped_input,
-        zipped_output,
-        BATCHES,
-        r0_iter,
-        r1_iter,
-        cparams_.reduce_op,
-        cparams_.init,
-        stream);
+  cudaStream_t stream_;
+  CParams cparams_; ///< Parameters specific to the operation type
+  uint8_t *d_temp = nullptr;
+  size_t temp_storage_bytes = 0;
+};
+
+
+template <typename OutputTensor, typename CountTensor, typename InputOperator, typename CParams = EmptyParams_t>
+class matxCubStatsPlan_t {
+  using T1 = typename InputOperator::value_type;
+
+public:
+  matxCubStatsPlan_t(CountTensor &count_out,
+                     OutputTensor &mean_out,
+                     OutputTensor &m2_out,
+                     OutputTensor &min_out,
+                     OutputTensor &max_out,
+                     const InputOperator &a,
+                     const CParams &cparams,
+                     const cudaStream_t stream = 0) :
+    cparams_(cparams)
+  {
+#ifdef __CUDACC__
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    ExecStatsReduce(count_out, mean_out, m2_out, min_out, max_out, a, stream);
+
+    // Allocate any workspace needed by underly CUB algorithm
+    matxAlloc((void **)&d_temp, temp_storage_bytes, MATX_ASYNC_DEVICE_MEMORY,
+              stream);
+#endif
+  }
+
+  static auto GetCubParams(OutputTensor &mean_out,
+                           const InputOperator &a,
+                           cudaStream_t stream)
+  {
+    CubParams_t params;
+
+    for (int r = 0; r < InputOperator::Rank(); r++) {
+      params.size.push_back(a.Size(r));
     }
-    else {
-      const int N = static_cast<int>(TotalSize(a));
 
-      cub::DeviceReduce::Reduce(
-        d_temp,
-        temp_storage_bytes,
-        zipped_input,
-        zipped_output,
-        N,
-        cparams_.reduce_op,
-        cparams_.init,
-        stream);
+    params.op = CUB_OP_STATS_REDUCE;
+    if constexpr (OutputTensor::Rank() > 0) {
+      params.batches = TotalSize(mean_out);
     }
-#endif
+    else {
+      params.batches = 1;
+    }
+    params.dtype = TypeToInt<T1>();
+    params.stream = stream;
+
+    return params;
   }
 
+  /**
+   * Execute a single-pass count/mean/M2/min/max reduction on a tensor
+   *
+   * @note Views being passed must be in row-major order
+   *
+   * @param count_out
+   *   Output element count tensor
+   * @param mean_out
+   *   Output mean tensor
+   * @param m2_out
+   *   Output sum of squared deviations from the mean
+   * @param min_out
+   *   Output minimum tensor
+   * @param max_out
+   *   Output maximum tensor
+   * @param a
+   *   Input tensor
+   * @param stream
+   *   CUDA stream
+   *
+   */
+  inline void ExecStatsReduce(CountTensor &count_out,
+                              OutputTensor &mean_out,
+                              OutputTensor &m2_out,
+                              OutputTensor &min_out,
+                              OutputTensor &max_out,
+                              const InputOperator &a,
+                              const cudaStream_t stream)
+  {
+#ifdef __CUDACC__
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    const index_t total = TotalSize(a);
+    detail::WithCubInputIterator(a, [&](const auto &a_iter) {
+      const auto ones_op = matx::ones<typename CountTensor::value_type>({total});
+      const auto zeros_op = matx::zeros<T1>({total});
+      const auto zipped_input = detail::make_zip_iterator(matx::RandomOperatorIterator{ones_op},
+                                                          a_iter,
+                                                          matx::RandomOperatorIterator{zeros_op},
+                                                          a_iter,
+                                                          a_iter);
+      const auto zipped_output = detail::make_zip_iterator(count_out.Data(), mean_out.Data(), m2_out.Data(),
+                                                           min_out.Data(), max_out.Data());
+
+      if constexpr (OutputTensor::Rank() > 0) {
+        const int BATCHES = static_cast<int>(TotalSize(mean_out));
+        const int N = static_cast<int>(total) / BATCHES;
+
+        const auto r0 = matx::range<0>({BATCHES},0,N);
+        const auto r0_iter = matx::RandomOperatorIterator{r0};
+        const auto r1 = matx::range<0>({BATCHES},N,N);
+        const auto r1_iter = matx::RandomOperatorIterator{r1};
+
+        cub::DeviceSegmentedReduce::Reduce(
+          d_temp,
+          temp_storage_bytes,
+          zipped_input,
+          zipped_output,
+          BATCHES,
+          r0_iter,
+          r1_iter,
+          cparams_.reduce_op,
+          cparams_.init,
+          stream);
+      }
+      else {
+        cub::DeviceReduce::Reduce(
+          d_temp,
+          temp_storage_bytes,
+          zipped_input,
+          zipped_output,
+          static_cast<int>(total),
+          cparams_.reduce_op,
+          cparams_.init,
+          stream);
+      }
+    });
+#endif
+  }
 
   /**
    * Destructor
@@ -1455,16 +1711,12 @@ public:
    * created
    *
    */
-  ~matxCubDualArgPlan_t()
+  ~matxCubStatsPlan_t()
   {
     matxFree(d_temp, cudaStreamDefault);
   }
 
 private:
-  // Member variables
-  cublasStatus_t ret = CUBLAS_STATUS_SUCCESS;
-
-  cudaStream_t stream_;
   CParams cparams_; ///< Parameters specific to the operation type
   uint8_t *d_temp = nullptr;
   size_t temp_storage_bytes = 0;
@@ -1527,7 +1779,7 @@ void sort_impl_inner(OutputTensor &a_out, const InputOperator &a,
           const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   cudaStream_t stream = exec.getStream();
 
@@ -1562,6 +1814,51 @@ void sort_impl_inner(OutputTensor &a_out, const InputOperator &a,
 }
 
 
+/**
+ * Sort a contiguous 1D tensor in place. CUB's radix sort does not allow its input and output
+ * ranges to overlap, so the double-buffered variant is used with a single alternate buffer.
+ * That buffer replaces the copy of the keys CUB would otherwise keep in its temporary storage.
+ */
+template <typename OutputTensor>
+void sort_in_place_impl(OutputTensor &a_out, const SortDirection_t dir,
+          const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  using T1 = typename OutputTensor::value_type;
+  cudaStream_t stream = exec.getStream();
+  const auto num_items = static_cast<int>(a_out.Size(0));
+
+  T1 *alt = nullptr;
+  matxAlloc((void **)&alt, num_items * sizeof(T1), MATX_ASYNC_DEVICE_MEMORY, stream);
+  cub::DoubleBuffer<convert_matx_type_t<T1>> keys(cub_sort_keys(a_out.Data()), cub_sort_keys(alt));
+
+  void *d_temp = nullptr;
+  size_t temp_storage_bytes = 0;
+  const auto run_sort = [&]() {
+    if (dir == SORT_DIR_ASC) {
+      cub::DeviceRadixSort::SortKeys(d_temp, temp_storage_bytes, keys, num_items, 0, sizeof(T1) * 8, stream);
+    }
+    else {
+      cub::DeviceRadixSort::SortKeysDescending(d_temp, temp_storage_bytes, keys, num_items, 0, sizeof(T1) * 8, stream);
+    }
+  };
+
+  // First call to get size
+  run_sort();
+  matxAlloc((void **)&d_temp, temp_storage_bytes, MATX_ASYNC_DEVICE_MEMORY, stream);
+  run_sort();
+
+  if (keys.Current() != cub_sort_keys(a_out.Data())) {
+    cudaMemcpyAsync(a_out.Data(), keys.Current(), num_items * sizeof(T1), cudaMemcpyDeviceToDevice, stream);
+  }
+
+  matxFree(d_temp, stream);
+  matxFree(alt, stream);
+#endif
+}
+
 /**
  * Inner function for the public argsort_impl(). argsort_impl() allocates a temporary
  * tensor that is contiguous, and can be mutated.
@@ -1573,7 +1870,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
           const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   static constexpr int RANK = OutputIndexTensor::Rank();
   using T1 = typename InputKeyTensor::value_type;
@@ -1586,7 +1883,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
     if (dir == SORT_DIR_ASC) {
       // First call to get size
       cub::DeviceRadixSort::SortPairs(d_temp, temp_storage_bytes,
-                                a_in.Data(), a_out.Data(),
+                                cub_sort_keys(a_in.Data()), cub_sort_keys(a_out.Data()),
                                 idx_in.Data(), idx_out.Data(),
                                 a_in.Size(0), 0, sizeof(T1) * 8, stream);
       matxAlloc((void **)&d_temp, temp_storage_bytes, MATX_ASYNC_DEVICE_MEMORY,
@@ -1594,7 +1891,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
 
       // Run sort
       cub::DeviceRadixSort::SortPairs(d_temp, temp_storage_bytes,
-                                a_in.Data(), a_out.Data(),
+                                cub_sort_keys(a_in.Data()), cub_sort_keys(a_out.Data()),
                                 idx_in.Data(), idx_out.Data(),
                                      a_in.Size(0), 0, sizeof(T1) * 8, stream);
 
@@ -1602,7 +1899,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
     }
     else {
       cub::DeviceRadixSort::SortPairsDescending(d_temp, temp_storage_bytes,
-                                a_in.Data(), a_out.Data(),
+                                cub_sort_keys(a_in.Data()), cub_sort_keys(a_out.Data()),
                                 idx_in.Data(), idx_out.Data(),
                                      a_in.Size(0), 0, sizeof(T1) * 8, stream);
 
@@ -1612,7 +1909,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
 
       // Run sort
       cub::DeviceRadixSort::SortPairsDescending(d_temp, temp_storage_bytes,
-                                a_in.Data(), a_out.Data(),
+                                cub_sort_keys(a_in.Data()), cub_sort_keys(a_out.Data()),
                                 idx_in.Data(), idx_out.Data(),
                                      a_in.Size(0), 0, sizeof(T1) * 8, stream);
 
@@ -1641,7 +1938,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
       {
         cub::DeviceSegmentedSort::SortPairs(
             d_temp, temp_storage_bytes,
-            a_in.Data(), a_out.Data(),
+            cub_sort_keys(a_in.Data()), cub_sort_keys(a_out.Data()),
             idx_in.Data(), idx_out.Data(),
             num_items,
             num_segments,
@@ -1652,7 +1949,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
 
         cub::DeviceSegmentedSort::SortPairs(
             d_temp, temp_storage_bytes,
-            a_in.Data(), a_out.Data(),
+            cub_sort_keys(a_in.Data()), cub_sort_keys(a_out.Data()),
             idx_in.Data(), idx_out.Data(),
             num_items,
             num_segments,
@@ -1664,7 +1961,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
       {
         cub::DeviceSegmentedSort::SortPairsDescending(
             d_temp, temp_storage_bytes,
-            a_in.Data(), a_out.Data(),
+            cub_sort_keys(a_in.Data()), cub_sort_keys(a_out.Data()),
             idx_in.Data(), idx_out.Data(),
             num_items,
             num_segments,
@@ -1675,7 +1972,7 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
 
         cub::DeviceSegmentedSort::SortPairsDescending(
             d_temp, temp_storage_bytes,
-            a_in.Data(), a_out.Data(),
+            cub_sort_keys(a_in.Data()), cub_sort_keys(a_out.Data()),
             idx_in.Data(), idx_out.Data(),
             num_items,
             num_segments,
@@ -1688,6 +1985,58 @@ void sort_pairs_impl_inner(OutputIndexTensor &idx_out, const InputIndexTensor &i
 }
 
 
+/**
+ * Sort complex values by magnitude. The |z|^2 keys are computed in one pass over the input and the
+ * values ride through the radix sort as its payload, so the sorted output needs no gather afterwards.
+ * CUB's radix passes read their keys from memory, so the keys can't be derived inside the passes.
+ */
+template <typename OutputTensor, typename InputOperator>
+void sort_by_magnitude_impl(OutputTensor &a_out, const InputOperator &a,
+          const SortDirection_t dir,
+          const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  using a_type = typename InputOperator::value_type;
+  using key_type = sort_key_t<InputOperator>;
+  constexpr int RANK = InputOperator::Rank();
+  const cudaStream_t stream = exec.getStream();
+  const index_t total = TotalSize(a);
+
+  // The values are read from contiguous memory that must not overlap the output
+  a_type *vals_ptr = nullptr;
+  tensor_impl_t<a_type, RANK> vals_in;
+  bool copied = true;
+  if constexpr (is_tensor_view_v<InputOperator>) {
+    if (a.IsContiguous() && GetAliasKind(a_out, a) == AliasKind::NONE) {
+      make_tensor(vals_in, a.Data(), a.Shape());
+      copied = false;
+    }
+  }
+  if (copied) {
+    matxAlloc((void**)&vals_ptr, total * sizeof(a_type), MATX_ASYNC_DEVICE_MEMORY, stream);
+    make_tensor(vals_in, vals_ptr, a.Shape());
+    (vals_in = a).run(exec);
+  }
+
+  key_type *keys_ptr = nullptr;
+  matxAlloc((void**)&keys_ptr, 2 * total * sizeof(key_type), MATX_ASYNC_DEVICE_MEMORY, stream);
+  tensor_impl_t<key_type, RANK> keys_in;
+  tensor_impl_t<key_type, RANK> keys_out;
+  make_tensor(keys_in, keys_ptr, a.Shape());
+  make_tensor(keys_out, keys_ptr + total, a.Shape());
+  (keys_in = sort_keys_op(vals_in)).run(exec);
+
+  sort_pairs_impl_inner(a_out, vals_in, keys_out, keys_in, dir, exec);
+
+  matxFree(keys_ptr, stream);
+  if (copied) {
+    matxFree(vals_ptr, stream);
+  }
+#endif
+}
+
 template <typename Op>
 __MATX_INLINE__ auto getCubArgReduceSupportedTensor( const Op &in, cudaStream_t stream) {
   // This would be better as a templated lambda, but we don't have those in C++17 yet
@@ -1728,7 +2077,7 @@ void cub_reduce(OutputTensor &a_out, const InputOperator &a, typename InputOpera
           const cudaStream_t stream = 0)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   // Get parameters required by these tensors
   using param_type = typename detail::ReduceParams_t<ReduceOp, typename InputOperator::value_type>;
   auto reduce_params = param_type{ReduceOp{}, init};
@@ -1784,7 +2133,7 @@ void cub_sum(OutputTensor &a_out, const InputOperator &a,
 {
 
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
 #ifndef MATX_DISABLE_CUB_CACHE
   auto params =
@@ -1831,7 +2180,7 @@ void cub_min(OutputTensor &a_out, const InputOperator &a,
           const cudaStream_t stream = 0)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
 #ifndef MATX_DISABLE_CUB_CACHE
   auto params =
@@ -1880,7 +2229,7 @@ void cub_max(OutputTensor &a_out, const InputOperator &a,
           const cudaStream_t stream = 0)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 #ifndef MATX_DISABLE_CUB_CACHE
   auto params =
       detail::matxCubPlan_t<OutputTensor,
@@ -1935,7 +2284,7 @@ void cub_argreduce(OutputTensor &a_out, TensorIndexType &aidx_out, const InputOp
           const cudaStream_t stream = 0)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   // converts operators to tensors (if necessary)
   auto a_out_supported = getCubArgReduceSupportedTensor(a_out, stream);
@@ -2019,7 +2368,7 @@ void cub_dualargreduce(OutputTensor &a1_out,
                        const cudaStream_t stream = 0)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   using cache_val_type = detail::matxCubDualArgPlan_t<OutputTensor, TensorIndexType, InputOperator, CParams>;
 
@@ -2046,11 +2395,79 @@ void cub_dualargreduce(OutputTensor &a1_out,
 }
 
 
+/**
+ * Reduce the count, mean, sum of squared deviations, minimum and maximum of
+ * an operator in a single pass
+ *
+ * @tparam OutputTensor
+ *   Output tensor type
+ * @tparam CountTensor
+ *   Output count tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam CParams
+ *   Custom reduction parameters type
+ * @param count_out
+ *   Output element count tensor
+ * @param mean_out
+ *   Output mean tensor
+ * @param m2_out
+ *   Output sum of squared deviations from the mean
+ * @param min_out
+ *   Output minimum tensor
+ * @param max_out
+ *   Output maximum tensor
+ * @param a
+ *   Input tensor
+ * @param reduce_params
+ *   Reduction configuration parameters
+ * @param stream
+ *   CUDA stream
+ */
+template <typename OutputTensor, typename CountTensor, typename InputOperator, typename CParams>
+void cub_stats(CountTensor &count_out,
+               OutputTensor &mean_out,
+               OutputTensor &m2_out,
+               OutputTensor &min_out,
+               OutputTensor &max_out,
+               const InputOperator &a,
+               const CParams& reduce_params,
+               const cudaStream_t stream = 0)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+  using cache_val_type = detail::matxCubStatsPlan_t<OutputTensor, CountTensor, InputOperator, CParams>;
+
+  #ifndef MATX_DISABLE_CUB_CACHE
+    auto params = cache_val_type::GetCubParams(mean_out, a, stream);
+
+    auto cache_id = detail::GetCacheIdFromType<detail::cub_cache_t>();
+    MATX_LOG_DEBUG("CUB stats reduce transform: cache_id={}", cache_id);
+    detail::GetCache().LookupAndExec<detail::cub_cache_t>(
+        cache_id,
+        params,
+        [&]() {
+          return std::make_shared<cache_val_type>(count_out, mean_out, m2_out, min_out, max_out, a, reduce_params, stream);
+        },
+        [&](std::shared_ptr<cache_val_type> ctype) {
+          ctype->ExecStatsReduce(count_out, mean_out, m2_out, min_out, max_out, a, stream);
+        }
+      );
+  #else
+    auto tmp = cache_val_type{count_out, mean_out, m2_out, min_out, max_out, a, reduce_params, stream};
+    tmp.ExecStatsReduce(count_out, mean_out, m2_out, min_out, max_out, a, stream);
+  #endif
+#endif
+}
+
+
 /**
  * Sort rows of a tensor
  *
  * Sort rows of a tensor using a radix sort. Currently supported types are
- * float, double, ints, and long ints (both signed and unsigned). For a 1D
+ * float, double, half, bfloat16, ints, and long ints (both signed and unsigned),
+ * and complex types, which are ordered by magnitude. For a 1D
  * tensor, a linear sort is performed. For 2D and above each row of the inner
  * dimensions are batched and sorted separately. There is currently a
  * restriction that the tensor must have contiguous data in both rows and
@@ -2078,33 +2495,50 @@ void sort_impl(OutputTensor &a_out, const InputOperator &a,
           const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   using a_type = typename InputOperator::value_type;
-  a_type *out_ptr = nullptr;
-  detail::tensor_impl_t<a_type, InputOperator::Rank()> tmp_in;
+  if constexpr (detail::sort_by_magnitude_v<a_type>) {
+    detail::sort_by_magnitude_impl(a_out, a, dir, exec);
+  }
+  else {
+    a_type *out_ptr = nullptr;
+    detail::tensor_impl_t<a_type, InputOperator::Rank()> tmp_in;
+
+    // sorting currently requires a contiguous tensor view, so allocate a temporary
+    // tensor to copy the input if necessary. CUB cannot read and write the same keys,
+    // so an input sharing memory with the output is sorted in place when it is the
+    // same 1D view, and copied otherwise.
+    bool done = false;
+    if constexpr (is_tensor_view_v<InputOperator>) {
+      if (a.IsContiguous()) {
+        const auto alias = detail::GetAliasKind(a_out, a);
+        if constexpr (InputOperator::Rank() == 1) {
+          if (alias == detail::AliasKind::EXACT) {
+            detail::sort_in_place_impl(a_out, dir, exec);
+            return;
+          }
+        }
 
-  // sorting currently requires a contiguous tensor view, so allocate a temporary
-  // tensor to copy the input if necessary.
-  bool done = false;
-  if constexpr (is_tensor_view_v<InputOperator>) {
-    if (a.IsContiguous()) {
-      make_tensor(tmp_in, a.Data(), a.Shape());
-      done = true;
+        if (alias == detail::AliasKind::NONE) {
+          make_tensor(tmp_in, a.Data(), a.Shape());
+          done = true;
+        }
+      }
     }
-  }
 
-  if (!done) {
-    matxAlloc((void**)&out_ptr, TotalSize(a) * sizeof(a_type), MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
-    make_tensor(tmp_in, out_ptr, a.Shape());
-    (tmp_in = a).run(exec);
-  }
+    if (!done) {
+      matxAlloc((void**)&out_ptr, TotalSize(a) * sizeof(a_type), MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+      make_tensor(tmp_in, out_ptr, a.Shape());
+      (tmp_in = a).run(exec);
+    }
 
-  detail::sort_impl_inner(a_out, tmp_in, dir, exec);
+    detail::sort_impl_inner(a_out, tmp_in, dir, exec);
 
-  if (!done) {
-    // We need to free the temporary memory allocated above if we had to make a copy
-    matxFree(out_ptr, exec.getStream());
+    if (!done) {
+      // We need to free the temporary memory allocated above if we had to make a copy
+      matxFree(out_ptr, exec.getStream());
+    }
   }
 #endif
 }
@@ -2115,7 +2549,8 @@ void sort_impl(OutputTensor &a_out, const InputOperator &a,
  * Sort rows of a tensor
  *
  * Sort rows of a tensor using a radix sort. Currently supported types are
- * float, double, ints, and long ints (both signed and unsigned). For a 1D
+ * float, double, half, bfloat16, ints, and long ints (both signed and unsigned),
+ * and complex types, which are ordered by magnitude. For a 1D
  * tensor, a linear sort is performed. For 2D and above each row of the inner
  * dimensions are batched and sorted separately. There is currently a
  * restriction that the tensor must have contiguous data in both rows and
@@ -2143,11 +2578,12 @@ void argsort_impl(OutputTensor &idx_out, const InputOperator &a,
           const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   static constexpr int RANK = OutputTensor::Rank();
 
-  using a_type = typename InputOperator::value_type;
+  // Complex inputs are ranked by |z|^2 keys, which are computed into the temporary
+  using a_type = detail::sort_key_t<InputOperator>;
   a_type *a_ptr = nullptr;
   a_type *a_out_ptr = nullptr;
   index_t *idx_in_ptr = nullptr;
@@ -2158,7 +2594,7 @@ void argsort_impl(OutputTensor &idx_out, const InputOperator &a,
   // sorting currently requires a contiguous tensor view, so allocate a temporary
   // tensor to copy the input if necessary.
   bool use_a = false;
-  if constexpr (is_tensor_view_v<InputOperator>) {
+  if constexpr (is_tensor_view_v<InputOperator> && !detail::sort_by_magnitude_v<typename InputOperator::value_type>) {
     if (a.IsContiguous()) {
       make_tensor(tmp_a, a.Data(), a.Shape());
       use_a = true;
@@ -2167,7 +2603,7 @@ void argsort_impl(OutputTensor &idx_out, const InputOperator &a,
   if (!use_a) {
     matxAlloc((void**)&a_ptr, TotalSize(a) * sizeof(a_type), MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
     make_tensor(tmp_a, a_ptr, a.Shape());
-    (tmp_a = a).run(exec);
+    (tmp_a = detail::sort_keys_op(a)).run(exec);
   }
 
   // also requires a temporary for output values and input indices
@@ -2189,40 +2625,150 @@ void argsort_impl(OutputTensor &idx_out, const InputOperator &a,
 #endif
 }
 
+namespace detail {
+
+// Smallest piece of a row that is sorted on its own thread before merging
+static constexpr index_t HOST_SORT_MIN_CHUNK = 32768;
+
+// Value a host sort ranks by, matching the |z|^2 keys the CUDA sorts use for complex types
+template <typename T>
+__MATX_INLINE__ auto host_sort_key(const T &v)
+{
+  if constexpr (is_complex_half_v<T>) {
+    const float re = static_cast<float>(v.real());
+    const float im = static_cast<float>(v.imag());
+    return re * re + im * im;
+  }
+  else if constexpr (is_complex_v<T>) {
+    return v.real() * v.real() + v.imag() * v.imag();
+  }
+  else {
+    return v;
+  }
+}
+
+/**
+ * Sort rows of a host buffer across the executor's threads
+ *
+ * Row b holds the len elements starting at first + b*len and is ordered with make_comp(b). With at least
+ * as many rows as threads each row is sorted by one thread. Otherwise rows are cut into chunks that are
+ * sorted in parallel and then merged pairwise, with the merges of each level also run in parallel.
+ */
+template <typename Executor, typename Iter, typename MakeComp>
+void HostSortRows(const Executor &exec, Iter first, index_t rows, index_t len, const MakeComp &make_comp)
+{
+  const index_t nthreads = cuda::std::max(1, exec.GetNumThreads());
+  index_t chunks = 1;
+  if (rows < nthreads) {
+    chunks = cuda::std::min((nthreads + rows - 1) / rows, len / HOST_SORT_MIN_CHUNK);
+  }
+
+  if (chunks <= 1) {
+    exec.ParallelFor(rows, [&](index_t b) {
+      std::sort(first + b*len, first + (b+1)*len, make_comp(b));
+    });
+    return;
+  }
+
+  auto chunk_start = [&](index_t c) { return len * cuda::std::min(c, chunks) / chunks; };
+
+  exec.ParallelFor(rows * chunks, [&](index_t w) {
+    const index_t b = w / chunks;
+    const index_t c = w - b * chunks;
+    std::sort(first + b*len + chunk_start(c), first + b*len + chunk_start(c + 1), make_comp(b));
+  });
+
+  for (index_t width = 1; width < chunks; width *= 2) {
+    const index_t pairs = (chunks + 2*width - 1) / (2*width);
+    exec.ParallelFor(rows * pairs, [&](index_t w) {
+      const index_t b = w / pairs;
+      const index_t c = (w - b * pairs) * 2 * width;
+      const index_t mid = chunk_start(c + width);
+      const index_t hi = chunk_start(c + 2*width);
+      if (mid < hi) {
+        std::inplace_merge(first + b*len + chunk_start(c), first + b*len + mid, first + b*len + hi, make_comp(b));
+      }
+    });
+  }
+}
+
+// Smallest number of elements each thread scans during a host compaction
+static constexpr index_t HOST_COMPACT_MIN_CHUNK = 16384;
+
+/**
+ * Stable stream compaction across the executor's threads
+ *
+ * The n elements are split into one chunk per thread. The first pass counts the elements in each chunk
+ * for which pred(i) is true, an exclusive scan of the counts gives each chunk its first output position,
+ * and the second pass calls emit(pos, i) for every selected element. Selected elements keep their
+ * input order.
+ *
+ * @returns Number of selected elements
+ */
+template <typename Executor, typename Pred, typename Emit>
+index_t HostCompact(const Executor &exec, index_t n, const Pred &pred, const Emit &emit)
+{
+  const index_t nthreads = cuda::std::max(1, exec.GetNumThreads());
+  const index_t chunks = cuda::std::max(index_t{1}, cuda::std::min(nthreads, n / HOST_COMPACT_MIN_CHUNK));
+  auto chunk_start = [&](index_t c) { return n * c / chunks; };
+
+  std::vector<index_t> offsets(static_cast<size_t>(chunks) + 1, 0);
+  exec.ParallelFor(chunks, [&](index_t c) {
+    index_t cnt = 0;
+    for (index_t i = chunk_start(c); i < chunk_start(c + 1); i++) {
+      cnt += pred(i) ? 1 : 0;
+    }
+    offsets[static_cast<size_t>(c) + 1] = cnt;
+  });
+
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  exec.ParallelFor(chunks, [&](index_t c) {
+    index_t pos = offsets[static_cast<size_t>(c)];
+    for (index_t i = chunk_start(c); i < chunk_start(c + 1); i++) {
+      if (pred(i)) {
+        emit(pos++, i);
+      }
+    }
+  });
+
+  return offsets.back();
+}
+
+} // namespace detail
+
 template <typename OutputTensor, typename InputOperator, ThreadsMode MODE>
 void argsort_impl(OutputTensor &idx_out, const InputOperator &a,
           const SortDirection_t dir,
           [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   static constexpr int RANK = OutputTensor::Rank();
   (idx_out = range<RANK-1>(idx_out.Shape(), 0, 1)).run(exec);
   typename detail::base_type_t<OutputTensor>  out_base = idx_out;
   auto lout = matx::RandomOperatorOutputIterator{out_base};
 
+  // Each comparator reads the keys of its own row through the input operator, so the
+  // index rows can be sorted and merged independently
   if constexpr (RANK == 1) {
     if (dir == SORT_DIR_ASC) {
-      std::sort(
-          lout, lout + idx_out.Size(0),
-          [&a](index_t i, index_t j) { return a(i) < a(j); });
+      detail::HostSortRows(exec, lout, 1, idx_out.Size(0),
+          [&a](index_t) { return [&a](index_t i, index_t j) { return detail::host_sort_key(a(i)) < detail::host_sort_key(a(j)); }; });
     }
     else {
-      std::sort(
-          lout, lout + idx_out.Size(0),
-          [&a](index_t i, index_t j) { return a(i) > a(j); });
+      detail::HostSortRows(exec, lout, 1, idx_out.Size(0),
+          [&a](index_t) { return [&a](index_t i, index_t j) { return detail::host_sort_key(a(i)) > detail::host_sort_key(a(j)); }; });
     }
   }
   else if constexpr (RANK == 2) {
-    for (index_t b = 0; b < lout.Size(0); b++) {
-      if (dir == SORT_DIR_ASC) {
-        std::sort( lout + b*a.Size(1), lout + (b+1)*a.Size(1),
-                  [&a, b](index_t i, index_t j) { return a(b,i) < a(b,j); });
-      }
-      else {
-        std::sort( lout + b*a.Size(1), lout + (b+1)*a.Size(1),
-                  [&a, b](index_t i, index_t j) { return a(b,i) > a(b,j); });
-      }
+    if (dir == SORT_DIR_ASC) {
+      detail::HostSortRows(exec, lout, a.Size(0), a.Size(1),
+          [&a](index_t b) { return [&a, b](index_t i, index_t j) { return detail::host_sort_key(a(b,i)) < detail::host_sort_key(a(b,j)); }; });
+    }
+    else {
+      detail::HostSortRows(exec, lout, a.Size(0), a.Size(1),
+          [&a](index_t b) { return [&a, b](index_t i, index_t j) { return detail::host_sort_key(a(b,i)) > detail::host_sort_key(a(b,j)); }; });
     }
   }
   else {
@@ -2235,44 +2781,47 @@ void sort_impl(OutputTensor &a_out, const InputOperator &a,
           const SortDirection_t dir,
           [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+  const auto alias = detail::GetAliasKind(a_out, a);
+  if (alias == detail::AliasKind::PARTIAL) {
+    // Copying into the output would overwrite unread input, so stage an input that only partly overlaps it
+    auto tmp_in = make_tensor<typename InputOperator::value_type>(a.Shape(), MATX_HOST_MALLOC_MEMORY);
+    (tmp_in = a).run(exec);
+    sort_impl(a_out, tmp_in, dir, exec);
+    return;
+  }
+
+  // Rows are copied to the output and sorted there, which also covers an output that is the input
+  if (alias != detail::AliasKind::EXACT) {
+    (a_out = a).run(exec);
+  }
 
-  typename detail::base_type_t<InputOperator> in_base = a;
   typename detail::base_type_t<OutputTensor>  out_base = a_out;
-  auto lin  = matx::RandomOperatorIterator{in_base};
   auto lout = matx::RandomOperatorOutputIterator{out_base};
+  const index_t len = a_out.Size(OutputTensor::Rank() - 1);
+  const index_t rows = len == 0 ? 0 : TotalSize(a_out) / len;
 
-  if constexpr (InputOperator::Rank() == 1) {
+  using value_type = typename InputOperator::value_type;
+  if constexpr (detail::sort_by_magnitude_v<value_type>) {
     if (dir == SORT_DIR_ASC) {
-      std::partial_sort_copy( lin,
-                              lin  + a.Size(0),
-                              lout,
-                              lout + a_out.Size(0));
+      detail::HostSortRows(exec, lout, rows, len, [](index_t) {
+        return [](const value_type &x, const value_type &y) { return detail::host_sort_key(x) < detail::host_sort_key(y); };
+      });
     }
     else {
-      std::partial_sort_copy( lin,
-                              lin  + a.Size(0),
-                              lout,
-                              lout + a_out.Size(0),
-                              std::greater<typename InputOperator::value_type>());
+      detail::HostSortRows(exec, lout, rows, len, [](index_t) {
+        return [](const value_type &x, const value_type &y) { return detail::host_sort_key(x) > detail::host_sort_key(y); };
+      });
     }
   }
+  else if (dir == SORT_DIR_ASC) {
+    detail::HostSortRows(exec, lout, rows, len,
+        [](index_t) { return std::less<value_type>(); });
+  }
   else {
-    for (index_t b = 0; b < lout.Size(0); b++) {
-      if (dir == SORT_DIR_ASC) {
-        std::partial_sort_copy( lin  + b*a.Size(1),
-                                lin  + (b+1)*a.Size(1),
-                                lout + b*a.Size(1),
-                                lout + (b+1)*a.Size(1));
-      }
-      else {
-        std::partial_sort_copy( lin  + b*a.Size(1),
-                                lin  + (b+1)*a.Size(1),
-                                lout + b*a.Size(1),
-                                lout + (b+1)*a.Size(1),
-                                std::greater<typename InputOperator::value_type>());
-      }
-    }
+    detail::HostSortRows(exec, lout, rows, len,
+        [](index_t) { return std::greater<value_type>(); });
   }
 }
 
@@ -2298,10 +2847,18 @@ void cumsum_impl(OutputTensor &a_out, const InputOperator &a,
             const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   cudaStream_t stream = exec.getStream();
 
+  // Batched rows are scanned in one launch instead of one CUB call per row
+  if constexpr (OutputTensor::Rank() > 1) {
+    if (a_out.IsContiguous()) {
+      scan_impl(a_out, a, OutputTensor::Rank() - 1, ScanFunc::SUM, ScanType::INCLUSIVE, exec);
+      return;
+    }
+  }
+
 #ifndef MATX_DISABLE_CUB_CACHE
   // Get parameters required by these tensors
   auto params =
@@ -2334,7 +2891,7 @@ void cumsum_impl(OutputTensor &a_out, const InputOperator &a,
             [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   typename detail::base_type_t<InputOperator> in_base = a;
   typename detail::base_type_t<OutputTensor>  out_base = a_out;
   auto lin  = matx::RandomOperatorIterator{in_base};
@@ -2353,7 +2910,7 @@ void cumsum_impl(OutputTensor &a_out, const InputOperator &a,
     }
   }
   else {
-    MATX_ASSERT_STR(false, matxInvalidParameter, "Only 1 and 2D cumulative sums supported on host");
+    scan_impl(a_out, a, OutputTensor::Rank() - 1, ScanFunc::SUM, ScanType::INCLUSIVE, exec);
   }
 
 
@@ -2396,7 +2953,16 @@ void hist_impl(OutputTensor &a_out, const InputOperator &a,
 {
   static_assert(std::is_same_v<typename OutputTensor::value_type, int>, "Output histogram operator must use int type");
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+  // Batched inputs are binned in one launch with privatized shared memory
+  // histograms instead of one CUB call per row
+  if constexpr (InputOperator::Rank() > 1) {
+    if (a_out.IsContiguous()) {
+      detail::hist_even_batched_impl(a_out, a, lower, upper, num_levels, stream);
+      return;
+    }
+  }
 
   detail::HistEvenParams_t<typename InputOperator::value_type> hp{lower, upper, num_levels};
 #ifndef MATX_DISABLE_CUB_CACHE
@@ -2537,7 +3103,7 @@ void find_impl(OutputTensor &a_out, CountTensor &num_found, const InputOperator
 #ifdef __CUDACC__
   static_assert(CountTensor::Rank() == 0, "Num found output tensor rank must be 0");
 
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   auto cparams = detail::SelectParams_t<SelectType, CountTensor>{sel, num_found};
   cudaStream_t stream = exec.getStream();
 
@@ -2606,21 +3172,25 @@ template <typename SelectType, typename CountTensor, typename OutputTensor, type
 void find_impl(OutputTensor &a_out, CountTensor &num_found, const InputOperator &a, SelectType sel, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
   static_assert(CountTensor::Rank() == 0, "Num found output tensor rank must be 0");
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   if (a.Size(a.Rank() - 1) == 0) {
     num_found() = 0;
     return;
   }
 
-  int cnt = 0;
-  auto it = std::find_if(cbegin(a), cend(a), sel);
-  while (it != cend(a)) {
-    a_out(cnt++) = *it;
-    it = std::find_if(++it, cend(a), sel);
-  }
+  // Selected values are written in input order. Any beyond the size of the output are dropped.
+  const auto lin = cbegin(a);
+  const index_t out_size = a_out.Size(0);
+  const index_t cnt = detail::HostCompact(exec, TotalSize(a),
+      [&](index_t i) { return static_cast<bool>(sel(lin[i])); },
+      [&](index_t pos, index_t i) {
+        if (pos < out_size) {
+          a_out(pos) = lin[i];
+        }
+      });
 
-  num_found() = cnt;
+  num_found() = static_cast<int>(cnt);
 }
 
 
@@ -2657,7 +3227,7 @@ void find_idx_impl(OutputTensor &a_out, CountTensor &num_found, const InputOpera
 {
 #ifdef __CUDACC__
   static_assert(CountTensor::Rank() == 0, "Num found output tensor rank must be 0");
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   cudaStream_t stream = exec.getStream();
   auto cparams = detail::SelectParams_t<SelectType, CountTensor>{sel, num_found};
@@ -2727,21 +3297,25 @@ template <typename SelectType, typename CountTensor, typename OutputTensor, type
 void find_idx_impl(OutputTensor &a_out, CountTensor &num_found, const InputOperator &a, SelectType sel, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
   static_assert(CountTensor::Rank() == 0, "Num found output tensor rank must be 0");
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   if (a.Size(a.Rank() - 1) == 0) {
     num_found() = 0;
     return;
   }
 
-  int cnt = 0;
-  auto it = std::find_if(cbegin(a), cend(a), sel);
-  while (it != cend(a)) {
-    a_out(cnt++) = static_cast<int>(it - cbegin(a));
-    it = std::find_if(++it, cend(a), sel);
-  }
+  // Selected indexs are written in input order. Any beyond the size of the output are dropped.
+  const auto lin = cbegin(a);
+  const index_t out_size = a_out.Size(0);
+  const index_t cnt = detail::HostCompact(exec, TotalSize(a),
+      [&](index_t i) { return static_cast<bool>(sel(lin[i])); },
+      [&](index_t pos, index_t i) {
+        if (pos < out_size) {
+          a_out(pos) = static_cast<int>(i);
+        }
+      });
 
-  num_found() = cnt;
+  num_found() = static_cast<int>(cnt);
 }
 
 
@@ -2772,7 +3346,7 @@ void unique_impl(OutputTensor &a_out, CountTensor &num_found, const InputOperato
 {
 #ifdef __CUDACC__
   static_assert(CountTensor::Rank() == 0, "Num found output tensor rank must be 0");
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   cudaStream_t stream = exec.getStream();
 
@@ -2842,16 +3416,30 @@ void unique_impl(OutputTensor &a_out, CountTensor &num_found, const InputOperato
 {
 #ifdef __CUDACC__
   static_assert(CountTensor::Rank() == 0, "Num found output tensor rank must be 0");
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   if (a.Size(a.Rank() - 1) == 0) {
     num_found() = 0;
     return;
   }
 
-  std::partial_sort_copy(cbegin(a), cend(a), begin(a_out), end(a_out));
-  auto last = std::unique(begin(a_out), end(a_out));
-  num_found() = static_cast<int>(last - begin(a_out));
+  // Sort a copy of the whole input so the output only has to hold the unique values
+  using value_type = typename InputOperator::value_type;
+  typename detail::base_type_t<InputOperator> in_base = a;
+  typename detail::base_type_t<OutputTensor>  out_base = a_out;
+  auto lin  = matx::RandomOperatorIterator<decltype(in_base), false>{in_base};
+  auto lout = matx::RandomOperatorOutputIterator<decltype(out_base), false>{out_base};
+
+  const index_t n = TotalSize(a);
+  auto tmp = make_tensor<value_type>({n}, MATX_HOST_MALLOC_MEMORY);
+  value_type *vals = tmp.Data();
+  exec.ParallelFor(n, [&](index_t i) { vals[i] = lin[i]; });
+  detail::HostSortRows(exec, vals, 1, n, [](index_t) { return std::less<value_type>(); });
+
+  const auto count = static_cast<index_t>(std::unique(vals, vals + n) - vals);
+  const index_t stored = cuda::std::min(count, TotalSize(a_out));
+  exec.ParallelFor(stored, [&](index_t i) { lout[i] = vals[i]; });
+  num_found() = static_cast<int>(count);
 #endif
 }
 }; // namespace matx
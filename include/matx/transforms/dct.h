@@ -0,0 +1,404 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/core/type_utils.h"
+#include "matx/transforms/fft/fft_cuda.h"
+
+namespace matx {
+
+/**
+ * DCT variants supported by dct() and dct2d(). The definitions match scipy.fft.dct
+ */
+enum class DCTType {
+  II,  ///< Forward DCT
+  III, ///< Inverse of DCT-II, up to a scale of 2N when unnormalized
+  IV   ///< Symmetric DCT used by the MDCT. Requires an even length
+};
+
+namespace detail {
+
+/**
+ * Element-wise stages wrapped around the N-point real FFT of Makhoul's method
+ */
+enum class DctStage {
+  DCT2_REORDER, ///< Even samples ascending followed by odd samples descending
+  DCT2_POST,    ///< Hermitian extension of the half spectrum and the 2*exp(-j*pi*k/(2N)) twiddle
+  DCT3_PRE,     ///< Half spectrum whose inverse real FFT is the reordered DCT-III
+  DCT3_REORDER, ///< Undoes DCT2_REORDER
+  DCT4_POST     ///< Post-twiddle and unpacking of the N/2-point complex FFT of a DCT-IV
+};
+
+/**
+ * One of the DctStage element-wise steps along the last dimension of in
+ *
+ * n is the DCT length. All stages produce n elements except DCT3_PRE, which produces the n/2+1 bins
+ * an inverse real FFT of length n consumes.
+ */
+template <DctStage S, typename InOp>
+class DctStageOp : public BaseOp<DctStageOp<S, InOp>> {
+private:
+  typename detail::base_type_t<InOp> in_;
+  index_t n_;
+  bool ortho_;
+
+  using in_value_type = typename InOp::value_type;
+  using scalar_type = cuda::std::conditional_t<is_complex_v<in_value_type>,
+      typename inner_op_type_t<in_value_type>::type, in_value_type>;
+
+public:
+  using matxop = bool;
+  using value_type = cuda::std::conditional_t<S == DctStage::DCT3_PRE, cuda::std::complex<scalar_type>, scalar_type>;
+
+  __MATX_INLINE__ std::string str() const { return "dct_stage(" + get_type_str(in_) + ")"; }
+
+  DctStageOp(const InOp &in, index_t n, bool ortho) : in_(in), n_(n), ortho_(ortho)
+  {
+  }
+
+  template <typename CapType, typename... Is>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(Is... indices) const
+  {
+    if constexpr (CapType::ept == ElementsPerThread::ONE) {
+      cuda::std::array<index_t, Rank()> idx{indices...};
+      const index_t k = idx[Rank() - 1];
+      const scalar_type pi = static_cast<scalar_type>(M_PI);
+      const scalar_type n = static_cast<scalar_type>(n_);
+
+      if constexpr (S == DctStage::DCT2_REORDER) {
+        idx[Rank() - 1] = k < (n_ + 1) / 2 ? 2 * k : 2 * (n_ - 1 - k) + 1;
+        return static_cast<value_type>(get_value<CapType>(in_, idx));
+      }
+      else if constexpr (S == DctStage::DCT2_POST) {
+        // Bins past n/2 come from the conjugate symmetric half the real FFT didn't store
+        idx[Rank() - 1] = k <= n_ / 2 ? k : n_ - k;
+        const auto v = get_value<CapType>(in_, idx);
+        const scalar_type vi = k <= n_ / 2 ? v.imag() : -v.imag();
+        const scalar_type theta = pi * static_cast<scalar_type>(k) / (2 * n);
+        scalar_type y = 2 * (v.real() * cuda::std::cos(theta) + vi * cuda::std::sin(theta));
+        if (ortho_) {
+          y *= cuda::std::sqrt(static_cast<scalar_type>(1) / ((k == 0 ? 4 : 2) * n));
+        }
+        return y;
+      }
+      else if constexpr (S == DctStage::DCT3_PRE) {
+        // V_k = exp(j*pi*k/(2N)) * (a_k - j*a_{N-k}) with a_N = 0
+        const scalar_type a = static_cast<scalar_type>(get_value<CapType>(in_, idx)) *
+            (ortho_ ? cuda::std::sqrt(static_cast<scalar_type>(1) / ((k == 0 ? 1 : 2) * n)) : static_cast<scalar_type>(1));
+        scalar_type b = 0;
+        if (k > 0) {
+          idx[Rank() - 1] = n_ - k;
+          b = static_cast<scalar_type>(get_value<CapType>(in_, idx)) *
+              (ortho_ ? cuda::std::sqrt(static_cast<scalar_type>(1) / (2 * n)) : static_cast<scalar_type>(1));
+        }
+        const scalar_type theta = pi * static_cast<scalar_type>(k) / (2 * n);
+        const scalar_type c = cuda::std::cos(theta);
+        const scalar_type s = cuda::std::sin(theta);
+        return value_type{a * c + b * s, a * s - b * c};
+      }
+      else if constexpr (S == DctStage::DCT3_REORDER) {
+        idx[Rank() - 1] = (k % 2 == 0) ? k / 2 : n_ - 1 - (k - 1) / 2;
+        return static_cast<value_type>(get_value<CapType>(in_, idx));
+      }
+      else {
+        // Even outputs are the real parts of the twiddled spectrum in ascending order and odd outputs
+        // the negated imaginary parts in descending order
+        const index_t b = (k % 2 == 0) ? k / 2 : (n_ - 1 - k) / 2;
+        idx[Rank() - 1] = b;
+        const auto z = get_value<CapType>(in_, idx);
+        const scalar_type theta = pi * static_cast<scalar_type>(b) / n;
+        const scalar_type c = cuda::std::cos(theta);
+        const scalar_type s = cuda::std::sin(theta);
+        scalar_type y = (k % 2 == 0) ? 2 * (z.real() * c + z.imag() * s) : -2 * (z.imag() * c - z.real() * s);
+        if (ortho_) {
+          y *= cuda::std::sqrt(static_cast<scalar_type>(1) / (2 * n));
+        }
+        return y;
+      }
+    }
+    else {
+      return value_type{0};
+    }
+  }
+
+  template <typename... Is>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(Is... indices) const
+  {
+    return this->template operator()<DefaultCapabilities>(indices...);
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const noexcept
+  {
+    if (dim == Rank() - 1) {
+      return S == DctStage::DCT3_PRE ? n_ / 2 + 1 : n_;
+    }
+    return in_.Size(dim);
+  }
+
+  static inline constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+  {
+    return InOp::Rank();
+  }
+
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+    if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+      return false;
+    }
+    else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+      const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+      return combine_capabilities<Cap>(my_cap, detail::get_operator_capability<Cap>(in_, in));
+    }
+    else {
+      auto self_has_cap = capability_attributes<Cap>::default_value;
+      return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(in_, in));
+    }
+  }
+};
+
+/**
+ * Packs a length N real sequence into the N/2 complex samples whose FFT gives a DCT-IV
+ *
+ * z_n = (x_{2n} + j*x_{N-1-2n}) * exp(-j*pi*(4n+1)/(4N)). The operator is JIT compiled into cuFFT's
+ * load callback when LTO callbacks are available, so the packed sequence is never stored.
+ */
+template <typename InOp>
+class Dct4PreOp : public BaseOp<Dct4PreOp<InOp>> {
+private:
+  typename detail::base_type_t<InOp> in_;
+  index_t n_;
+
+  using scalar_type = typename InOp::value_type;
+
+public:
+  using matxop = bool;
+  using value_type = cuda::std::complex<scalar_type>;
+
+#ifdef MATX_EN_JIT
+  struct JIT_Storage {
+    typename detail::inner_storage_or_self_t<detail::base_type_t<InOp>> in_;
+  };
+
+  JIT_Storage ToJITStorage() const {
+    return JIT_Storage{detail::to_jit_storage(in_)};
+  }
+
+  __MATX_INLINE__ std::string get_jit_class_name() const {
+    return std::format("JITDct4Pre_r{}_n{}", Rank(), n_);
+  }
+
+  __MATX_INLINE__ auto get_jit_op_str() const {
+    const std::string func_name = get_jit_class_name();
+    cuda::std::array<index_t, Rank()> out_dims_;
+    for (int i = 0; i < Rank(); ++i) {
+      out_dims_[i] = Size(i);
+    }
+
+    return cuda::std::make_tuple(
+      func_name,
+      std::format("template <typename InT> struct {} {{\n"
+          "  using value_type = {};\n"
+          "  using scalar_type = {};\n"
+          "  using matxop = bool;\n"
+          "  constexpr static int Rank_ = {};\n"
+          "  constexpr static index_t n_ = {};\n"
+          "  constexpr static cuda::std::array<index_t, Rank_> out_dims_ = {{ {} }};\n"
+          "  typename detail::inner_storage_or_self_t<detail::base_type_t<InT>> in_;\n"
+          "  template <typename CapType, typename... Is>\n"
+          "  __MATX_INLINE__ __MATX_DEVICE__ value_type operator()(Is... indices) const\n"
+          "  {{\n"
+          "    cuda::std::array<index_t, Rank_> idx{{indices...}};\n"
+          "    const index_t m = idx[Rank_ - 1];\n"
+          "    idx[Rank_ - 1] = 2 * m;\n"
+          "    const scalar_type a = static_cast<scalar_type>(get_value<CapType>(in_, idx));\n"
+          "    idx[Rank_ - 1] = n_ - 1 - 2 * m;\n"
+          "    const scalar_type b = static_cast<scalar_type>(get_value<CapType>(in_, idx));\n"
+          "    const scalar_type theta = -static_cast<scalar_type>(M_PI) * static_cast<scalar_type>(4 * m + 1) / static_cast<scalar_type>(4 * n_);\n"
+          "    const scalar_type c = cuda::std::cos(theta);\n"
+          "    const scalar_type s = cuda::std::sin(theta);\n"
+          "    return value_type{{a * c - b * s, a * s + b * c}};\n"
+          "  }}\n"
+          "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return Rank_; }}\n"
+          "  constexpr __MATX_INLINE__ __MATX_DEVICE__ index_t Size(int dim) const {{ return out_dims_[dim]; }}\n"
+          "}};\n",
+          func_name, detail::type_to_string<value_type>(), detail::type_to_string<scalar_type>(), Rank(), n_,
+          detail::array_to_string(out_dims_))
+    );
+  }
+#endif
+
+  __MATX_INLINE__ std::string str() const { return "dct4_pre(" + get_type_str(in_) + ")"; }
+
+  Dct4PreOp(const InOp &in, index_t n) : in_(in), n_(n)
+  {
+  }
+
+  template <typename CapType, typename... Is>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(Is... indices) const
+  {
+    if constexpr (CapType::ept == ElementsPerThread::ONE) {
+      cuda::std::array<index_t, Rank()> idx{indices...};
+      const index_t m = idx[Rank() - 1];
+      idx[Rank() - 1] = 2 * m;
+      const scalar_type a = static_cast<scalar_type>(get_value<CapType>(in_, idx));
+      idx[Rank() - 1] = n_ - 1 - 2 * m;
+      const scalar_type b = static_cast<scalar_type>(get_value<CapType>(in_, idx));
+      const scalar_type theta = -static_cast<scalar_type>(M_PI) * static_cast<scalar_type>(4 * m + 1) / static_cast<scalar_type>(4 * n_);
+      const scalar_type c = cuda::std::cos(theta);
+      const scalar_type s = cuda::std::sin(theta);
+      return value_type{a * c - b * s, a * s + b * c};
+    }
+    else {
+      return value_type{0};
+    }
+  }
+
+  template <typename... Is>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(Is... indices) const
+  {
+    return this->template operator()<DefaultCapabilities>(indices...);
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const noexcept
+  {
+    return dim == Rank() - 1 ? n_ / 2 : in_.Size(dim);
+  }
+
+  static inline constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+  {
+    return InOp::Rank();
+  }
+
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+    if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
+#ifdef MATX_EN_JIT
+      const auto in_jit_name = detail::get_operator_capability<Cap>(in_, in);
+      return std::format("{}<{}>", get_jit_class_name(), in_jit_name);
+#else
+      return "";
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+#ifdef MATX_EN_JIT
+      return combine_capabilities<Cap>(true, detail::get_operator_capability<Cap>(in_, in));
+#else
+      return false;
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::JIT_CLASS_QUERY) {
+#ifdef MATX_EN_JIT
+      const auto [key, value] = get_jit_op_str();
+      if (in.find(key) == in.end()) {
+        in[key] = value;
+      }
+      detail::get_operator_capability<Cap>(in_, in);
+      return true;
+#else
+      return false;
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+      const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+      return combine_capabilities<Cap>(my_cap, detail::get_operator_capability<Cap>(in_, in));
+    }
+    else {
+      auto self_has_cap = capability_attributes<Cap>::default_value;
+      return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(in_, in));
+    }
+  }
+};
+
+/**
+ * DCT of in along its last dimension into out
+ *
+ * Uses the N-point reordering of Makhoul's method instead of transforming a 2N-point mirrored
+ * sequence. DCT-II is a real FFT of the reordered input followed by a twiddle, DCT-III runs the same
+ * steps backwards through an inverse real FFT, and DCT-IV is an N/2-point complex FFT whose
+ * pre-twiddle is fused into cuFFT's loads when LTO callbacks are available.
+ */
+template <typename OutputTensor, typename InputOp>
+void dct_impl(OutputTensor out, const InputOp &in, DCTType type, FFTNorm norm, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using value_type = typename InputOp::value_type;
+  using complex_type = cuda::std::complex<value_type>;
+  constexpr int RANK = InputOp::Rank();
+  MATX_STATIC_ASSERT_STR((std::is_same_v<value_type, float> || std::is_same_v<value_type, double>), matxInvalidType,
+      "dct: input must be float or double");
+  MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == RANK, matxInvalidDim, "dct: input and output ranks must match");
+  MATX_ASSERT_STR(norm == FFTNorm::BACKWARD || norm == FFTNorm::ORTHO, matxInvalidParameter,
+      "dct: only BACKWARD (unnormalized) and ORTHO normalization are supported");
+
+  const index_t n = in.Size(RANK - 1);
+  const bool ortho = norm == FFTNorm::ORTHO;
+  const auto stream = exec.getStream();
+  MATX_ASSERT_STR(n > 0, matxInvalidSize, "dct: transform length must be positive");
+
+  cuda::std::array<index_t, RANK> shape;
+  for (int r = 0; r < RANK; r++) {
+    shape[r] = in.Size(r);
+  }
+
+  if (type == DCTType::II) {
+    shape[RANK - 1] = n / 2 + 1;
+    auto spec = make_tensor<complex_type>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+    fft_impl(spec, DctStageOp<DctStage::DCT2_REORDER, InputOp>(in, n, ortho), 0, FFTNorm::BACKWARD, exec);
+    (out = DctStageOp<DctStage::DCT2_POST, decltype(spec)>(spec, n, ortho)).run(exec);
+  }
+  else if (type == DCTType::III) {
+    auto v = make_tensor<value_type>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+    // FORWARD normalization leaves the inverse transform unscaled
+    ifft_impl(v, DctStageOp<DctStage::DCT3_PRE, InputOp>(in, n, ortho), 0, FFTNorm::FORWARD, exec);
+    (out = DctStageOp<DctStage::DCT3_REORDER, decltype(v)>(v, n, ortho)).run(exec);
+  }
+  else {
+    MATX_ASSERT_STR(n % 2 == 0, matxInvalidSize, "dct: DCT-IV requires an even transform length");
+    shape[RANK - 1] = n / 2;
+    auto z = make_tensor<complex_type>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+    auto pre = Dct4PreOp(in, n);
+    if (!fft_load_callback_impl(z, pre, 0, FFTNorm::BACKWARD, FFTDirection::FORWARD, exec)) {
+      (z = pre).run(exec);
+      fft_impl(z, z, 0, FFTNorm::BACKWARD, exec);
+    }
+    (out = DctStageOp<DctStage::DCT4_POST, decltype(z)>(z, n, ortho)).run(exec);
+  }
+}
+
+} // end namespace detail
+} // end namespace matx
@@ -39,6 +39,7 @@
 #include "matx/executors/host.h"
 #include "matx/executors/support.h"
 #include "matx/transforms/lu/lu_cuda.h"
+#include "matx/transforms/solver_small.h"
 #ifdef MATX_EN_CPU_SOLVER
   #include "matx/transforms/lu/lu_lapack.h"
 #endif
@@ -71,7 +72,7 @@ template <typename OutputTensor, typename InputTensor, typename Executor>
 void det_impl(OutputTensor &out, const InputTensor &a,
          const Executor &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   MATX_ASSERT_STR(!(is_host_executor_v<Executor> && !MATX_EN_CPU_SOLVER), matxInvalidExecutor,
     "Trying to run a host Solver executor but host Solver support is not configured");
 
@@ -80,6 +81,34 @@ void det_impl(OutputTensor &out, const InputTensor &a,
   using value_type = typename OutputTensor::value_type;
   using piv_value_type = std::conditional_t<is_cuda_executor_v<Executor>, int64_t, lapack_int_t>;
 
+  // Batches of small matrices are reduced with one warp per matrix, which avoids both the
+  // batched LU factorization and the separate pivot and diagonal reductions below.
+  if constexpr (is_cuda_executor_v<Executor> && RANK > 2) {
+    const index_t n = a.Size(RANK - 1);
+    const size_t batches = static_cast<size_t>(out.TotalSize());
+    if (n == a.Size(RANK - 2) && detail::UseSmallSolver<value_type>(n, batches)) {
+      const auto stream = exec.getStream();
+      tensor_t<value_type, RANK> ac;
+      tensor_t<value_type, RANK - 2> dc;
+      const value_type *a_ptr = nullptr;
+      if constexpr (is_tensor_view_v<InputTensor> &&
+                    std::is_same_v<typename InputTensor::value_type, value_type>) {
+        if (a.IsContiguous()) {
+          a_ptr = a.Data();
+        }
+      }
+      if (a_ptr == nullptr) {
+        make_tensor(ac, a.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
+        (ac = a).run(exec);
+        a_ptr = ac.Data();
+      }
+      make_tensor(dc, out.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
+      detail::small_det_impl(dc.Data(), a_ptr, n, batches, stream);
+      (out = dc).run(exec);
+      return;
+    }
+  }
+
   // Get parameters required by these tensors
   cuda::std::array<index_t, RANK - 1> s;
 
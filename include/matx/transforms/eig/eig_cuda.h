@@ -48,6 +48,24 @@ namespace matx {
 
 namespace detail {
 
+enum class EigMethod {
+  SYEVD,
+  SYEVJ_BATCHED,
+};
+
+template <typename ATensor>
+static __MATX_INLINE__ EigMethod GetCUDAEigMethod(const ATensor &a, const JacobiParams &jacobi = {}) {
+  static constexpr int RANK = ATensor::Rank();
+
+  // Batches of small matrices converge in a few Jacobi sweeps, and syevjBatched handles the
+  // whole batch in one call rather than going through the general-size solver
+  if (RANK > 2 && jacobi.enable && a.Size(RANK - 1) <= 32 && GetNumBatches(a) > 1) {
+    return EigMethod::SYEVJ_BATCHED;
+  }
+
+  return EigMethod::SYEVD;
+}
+
 /**
  * Parameters needed to execute eigenvalue decomposition. We distinguish
  * unique factorizations mostly by the data pointer in A.
@@ -61,6 +79,7 @@ struct DnEigCUDAParams_t {
   void *W;
   size_t batch_size;
   MatXDataType_t dtype;
+  EigMethod method;
   cudaExecutor exec;
 };
 
@@ -90,6 +109,8 @@ public:
    *   Eigenvalues of A
    * @param a
    *   Input tensor view
+   * @param method
+   *   Solver used for the decomposition
    * @param jobz
    *   CUSOLVER_EIG_MODE_VECTOR to compute eigenvectors or
    * CUSOLVER_EIG_MODE_NOVECTOR to not compute
@@ -99,11 +120,12 @@ public:
    */
   matxDnEigCUDAPlan_t(WTensor &w,
                         const ATensor &a,
+                        EigMethod method,
                         const cudaExecutor &exec,
                         cusolverEigMode_t jobz = CUSOLVER_EIG_MODE_VECTOR,
                         cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK == ATensor::Rank(), matxInvalidDim, "Output and A tensor ranks must match for eigen solver");
@@ -116,6 +138,16 @@ public:
     MATX_STATIC_ASSERT_STR((std::is_same_v<typename inner_op_type_t<T1>::type, T2>), matxInvalidType, "Out and W inner types must match");
 
     params = GetEigParams(w, a, jobz, uplo, exec);
+    params.method = method;
+
+    if (params.method == EigMethod::SYEVJ_BATCHED) {
+      [[maybe_unused]] cusolverStatus_t ret = cusolverDnCreateSyevjInfo(&batch_params);
+      MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError, "Failure in cusolverDnCreateSyevjInfo");
+      this->GetWorkspaceSize();
+      this->AllocateWorkspace(params.batch_size, true, exec);
+      return;
+    }
+
     this->GetWorkspaceSize();
 #if CUSOLVER_VERSION > 11701 || (CUSOLVER_VERSION == 11701 && CUSOLVER_VER_BUILD >= 2)    
     this->AllocateWorkspace(params.batch_size, true, exec);
@@ -126,6 +158,42 @@ public:
 
   void GetWorkspaceSize() override
   {
+    if (params.method == EigMethod::SYEVJ_BATCHED) {
+      [[maybe_unused]] cusolverStatus_t ret;
+      int i_dspace = 0;
+      const int n = static_cast<int>(params.n);
+      const int batches = static_cast<int>(params.batch_size);
+
+      if constexpr (std::is_same_v<float, T1>) {
+        ret = cusolverDnSsyevjBatched_bufferSize(this->handle, CUSOLVER_EIG_MODE_VECTOR, params.uplo, n,
+                reinterpret_cast<const float *>(params.A), n, reinterpret_cast<const float *>(params.W),
+                &i_dspace, batch_params, batches);
+      }
+      else if constexpr (std::is_same_v<double, T1>) {
+        ret = cusolverDnDsyevjBatched_bufferSize(this->handle, CUSOLVER_EIG_MODE_VECTOR, params.uplo, n,
+                reinterpret_cast<const double *>(params.A), n, reinterpret_cast<const double *>(params.W),
+                &i_dspace, batch_params, batches);
+      }
+      else if constexpr (std::is_same_v<cuda::std::complex<float>, T1>) {
+        ret = cusolverDnCheevjBatched_bufferSize(this->handle, CUSOLVER_EIG_MODE_VECTOR, params.uplo, n,
+                reinterpret_cast<const cuComplex *>(params.A), n, reinterpret_cast<const float *>(params.W),
+                &i_dspace, batch_params, batches);
+      }
+      else if constexpr (std::is_same_v<cuda::std::complex<double>, T1>) {
+        ret = cusolverDnZheevjBatched_bufferSize(this->handle, CUSOLVER_EIG_MODE_VECTOR, params.uplo, n,
+                reinterpret_cast<const cuDoubleComplex *>(params.A), n, reinterpret_cast<const double *>(params.W),
+                &i_dspace, batch_params, batches);
+      }
+      else {
+        MATX_THROW(matxInvalidType, "Invalid data type passed to eig()");
+      }
+
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+      this->dspace = sizeof(T1) * i_dspace;
+      this->hspace = 0;
+      return;
+    }
+
 #if CUSOLVER_VERSION > 11701 || (CUSOLVER_VERSION == 11701 && CUSOLVER_VER_BUILD >=2)
     // Use vector mode for a larger workspace size that works for both modes
     [[maybe_unused]] cusolverStatus_t ret = cusolverDnXsyevBatched_bufferSize(
@@ -162,6 +230,7 @@ public:
     params.exec = exec;    
 
     params.dtype = TypeToInt<T1>();
+    params.method = EigMethod::SYEVD;
 
     return params;
   }
@@ -170,9 +239,10 @@ public:
             const ATensor &a,
             const cudaExecutor &exec,
             cusolverEigMode_t jobz = CUSOLVER_EIG_MODE_VECTOR,
-            cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER)
+            cublasFillMode_t uplo = CUBLAS_FILL_MODE_UPPER,
+            const JacobiParams &jacobi = {})
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize, "Input to eigen must be a square matrix");
 
@@ -191,6 +261,11 @@ public:
     const auto stream = exec.getStream();
     cusolverDnSetStream(this->handle, stream);
 
+    if (params.method == EigMethod::SYEVJ_BATCHED) {
+      ExecJacobi(out, w, stream, jobz, uplo, jacobi);
+      return;
+    }
+
 #if CUSOLVER_VERSION > 11701 || ( CUSOLVER_VERSION == 11701 && CUSOLVER_VER_BUILD >=2)   
     [[maybe_unused]] auto ret = cusolverDnXsyevBatched(
         this->handle, this->dn_params, jobz, uplo, params.n, MatXTypeToCudaType<T1>(),
@@ -248,10 +323,71 @@ public:
    * created
    *
    */
-  ~matxDnEigCUDAPlan_t() {}
+  ~matxDnEigCUDAPlan_t()
+  {
+    if (batch_params != nullptr) {
+      cusolverDnDestroySyevjInfo(batch_params);
+    }
+  }
 
 private:
+  void ExecJacobi(OutputTensor &out, WTensor &w, cudaStream_t stream,
+                  cusolverEigMode_t jobz, cublasFillMode_t uplo, const JacobiParams &jacobi)
+  {
+    [[maybe_unused]] cusolverStatus_t ret;
+
+    // The convergence controls are cheap to set and not part of the plan, so they are applied per call
+    ret = cusolverDnXsyevjSetTolerance(batch_params, jacobi.tol);
+    MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError, "Failure in cusolverDnXsyevjSetTolerance");
+
+    ret = cusolverDnXsyevjSetMaxSweeps(batch_params, jacobi.max_sweeps);
+    MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError, "Failure in cusolverDnXsyevjSetMaxSweeps");
+
+    const int n = static_cast<int>(params.n);
+    const int lwork = static_cast<int>(this->dspace / sizeof(T1));
+    const int batches = static_cast<int>(params.batch_size);
+
+    if constexpr (std::is_same_v<float, T1>) {
+      ret = cusolverDnSsyevjBatched(this->handle, jobz, uplo, n, reinterpret_cast<float *>(out.Data()), n,
+              reinterpret_cast<float *>(w.Data()), reinterpret_cast<float *>(this->d_workspace), lwork,
+              this->d_info, batch_params, batches);
+    }
+    else if constexpr (std::is_same_v<double, T1>) {
+      ret = cusolverDnDsyevjBatched(this->handle, jobz, uplo, n, reinterpret_cast<double *>(out.Data()), n,
+              reinterpret_cast<double *>(w.Data()), reinterpret_cast<double *>(this->d_workspace), lwork,
+              this->d_info, batch_params, batches);
+    }
+    else if constexpr (std::is_same_v<cuda::std::complex<float>, T1>) {
+      ret = cusolverDnCheevjBatched(this->handle, jobz, uplo, n, reinterpret_cast<cuComplex *>(out.Data()), n,
+              reinterpret_cast<float *>(w.Data()), reinterpret_cast<cuComplex *>(this->d_workspace), lwork,
+              this->d_info, batch_params, batches);
+    }
+    else if constexpr (std::is_same_v<cuda::std::complex<double>, T1>) {
+      ret = cusolverDnZheevjBatched(this->handle, jobz, uplo, n, reinterpret_cast<cuDoubleComplex *>(out.Data()), n,
+              reinterpret_cast<double *>(w.Data()), reinterpret_cast<cuDoubleComplex *>(this->d_workspace), lwork,
+              this->d_info, batch_params, batches);
+    }
+
+    MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError,
+      ("cusolverDn syevjBatched failed with error " + std::to_string(ret)).c_str());
+
+    std::vector<int> h_info(params.batch_size);
+    cudaMemcpyAsync(h_info.data(), this->d_info, sizeof(int) * params.batch_size, cudaMemcpyDeviceToHost, stream);
+    cudaStreamSynchronize(stream);
+
+    for (const auto& info : h_info) {
+      if (info < 0) {
+        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+          ("Parameter " + std::to_string(-info) + " had an illegal value in cuSolver syevjBatched").c_str());
+      } else {
+        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+          ("cuSolver syevjBatched did not converge within " + std::to_string(jacobi.max_sweeps) + " sweeps").c_str());
+      }
+    }
+  }
+
   std::vector<T2 *> batch_w_ptrs;
+  syevjInfo_t batch_params = nullptr;
   DnEigCUDAParams_t params;
 };
 
@@ -274,12 +410,130 @@ struct DnEigCUDAParamsKeyHash {
 struct DnEigCUDAParamsKeyEq {
   bool operator()(const DnEigCUDAParams_t &l, const DnEigCUDAParams_t &t) const noexcept
   {
-    return l.n == t.n && l.batch_size == t.batch_size && l.dtype == t.dtype && l.exec.getStream() == t.exec.getStream();
+    return l.n == t.n && l.batch_size == t.batch_size && l.dtype == t.dtype && l.method == t.method &&
+           l.exec.getStream() == t.exec.getStream();
   }
 };
 
 using eig_cuda_cache_t = std::unordered_map<DnEigCUDAParams_t, std::any, DnEigCUDAParamsKeyHash, DnEigCUDAParamsKeyEq>;
 
+/**
+ * Parameters needed to compute the largest eigenpairs of a Hermitian matrix
+ */
+struct DnEigRangeCUDAParams_t {
+  int64_t n;
+  int64_t k;
+  size_t batch_size;
+  cusolverEigMode_t jobz;
+  cublasFillMode_t uplo;
+  MatXDataType_t dtype;
+  cudaExecutor exec;
+};
+
+/**
+ * Plan computing the k largest eigenvalues, and optionally their eigenvectors, of square Hermitian
+ * matrices with cusolverDnXsyevdx over the index range [n - k + 1, n]
+ *
+ * The matrices passed to Exec() are column-major. As with syevd the input is reduced to tridiagonal
+ * form in O(n^3), but only k eigenvalues are found by bisection and only k eigenvectors are
+ * back-transformed, which is where most of the cost of a full decomposition goes when k << n.
+ * There is no batched syevdx, so batches are solved one after another with a shared workspace.
+ */
+template <typename T1>
+class matxDnEigRangeCUDAPlan_t : matxDnCUDASolver_t {
+public:
+  using T2 = typename inner_op_type_t<T1>::type;
+
+  matxDnEigRangeCUDAPlan_t(const DnEigRangeCUDAParams_t &p) : params(p)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_STATIC_ASSERT_STR(!is_half_v<T1>, matxInvalidType, "Eigen solver does not support half precision");
+
+    this->GetWorkspaceSize();
+    this->AllocateWorkspace(params.batch_size, true, params.exec);
+  }
+
+  void GetWorkspaceSize() override
+  {
+    T2 vl{0};
+    T2 vu{0};
+    int64_t meig = 0;
+    [[maybe_unused]] cusolverStatus_t ret = cusolverDnXsyevdx_bufferSize(
+        this->handle, this->dn_params, CUSOLVER_EIG_MODE_VECTOR, CUSOLVER_EIG_RANGE_I, params.uplo,
+        params.n, MatXTypeToCudaType<T1>(), nullptr, params.n, &vl, &vu, params.n - params.k + 1,
+        params.n, &meig, MatXTypeToCudaType<T2>(), nullptr, MatXTypeToCudaType<T1>(),
+        &this->dspace, &this->hspace);
+    MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+  }
+
+  /**
+   * Compute the eigenpairs. On return the first k columns of each matrix in a hold the eigenvectors
+   * and the first k entries of each row of w hold the eigenvalues in ascending order.
+   *
+   * @param a Column-major n x n matrices, overwritten
+   * @param w Batch of n eigenvalue slots per matrix
+   * @param exec CUDA executor
+   */
+  void Exec(T1 *a, T2 *w, const cudaExecutor &exec)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    const auto stream = exec.getStream();
+    cusolverDnSetStream(this->handle, stream);
+
+    T2 vl{0};
+    T2 vu{0};
+    for (size_t i = 0; i < params.batch_size; i++) {
+      int64_t meig = 0;
+      [[maybe_unused]] auto ret = cusolverDnXsyevdx(
+          this->handle, this->dn_params, params.jobz, CUSOLVER_EIG_RANGE_I, params.uplo, params.n,
+          MatXTypeToCudaType<T1>(), a + i * params.n * params.n, params.n, &vl, &vu,
+          params.n - params.k + 1, params.n, &meig, MatXTypeToCudaType<T2>(), w + i * params.n,
+          MatXTypeToCudaType<T1>(), this->d_workspace, this->dspace, this->h_workspace, this->hspace,
+          this->d_info + i);
+
+      MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError,
+        ("cusolverDnXsyevdx failed with error " + std::to_string(ret)).c_str());
+    }
+
+    std::vector<int> h_info(params.batch_size);
+    cudaMemcpyAsync(h_info.data(), this->d_info, sizeof(int) * params.batch_size, cudaMemcpyDeviceToHost, stream);
+    cudaStreamSynchronize(stream);
+
+    for (const auto& info : h_info) {
+      if (info < 0) {
+        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+          ("Parameter " + std::to_string(-info) + " had an illegal value in cuSolver Xsyevdx").c_str());
+      } else {
+        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+            (std::to_string(info) + " off-diagonal elements of an intermediate tridiagonal form did not converge to zero in cuSolver Xsyevdx").c_str());
+      }
+    }
+  }
+
+private:
+  DnEigRangeCUDAParams_t params;
+};
+
+struct DnEigRangeCUDAParamsKeyHash {
+  std::size_t operator()(const DnEigRangeCUDAParams_t &k) const noexcept
+  {
+    return (std::hash<uint64_t>()(k.n)) + (std::hash<uint64_t>()(k.k)) + (std::hash<uint64_t>()(k.batch_size)) +
+           (std::hash<uint64_t>()((uint64_t)(k.exec.getStream())));
+  }
+};
+
+struct DnEigRangeCUDAParamsKeyEq {
+  bool operator()(const DnEigRangeCUDAParams_t &l, const DnEigRangeCUDAParams_t &t) const noexcept
+  {
+    return l.n == t.n && l.k == t.k && l.batch_size == t.batch_size && l.jobz == t.jobz && l.uplo == t.uplo &&
+           l.dtype == t.dtype && l.exec.getStream() == t.exec.getStream();
+  }
+};
+
+using eig_range_cuda_cache_t =
+    std::unordered_map<DnEigRangeCUDAParams_t, std::any, DnEigRangeCUDAParamsKeyHash, DnEigRangeCUDAParamsKeyEq>;
+
 } // end namespace detail
 
 
@@ -311,14 +565,17 @@ using eig_cuda_cache_t = std::unordered_map<DnEigCUDAParams_t, std::any, DnEigCU
  *   EigenMode::NO_VECTOR to not compute
  * @param uplo
  *   Where to store data in A
+ * @param jacobi
+ *   Controls for the batched Jacobi solver used for batches of small matrices
  */
 template <typename OutputTensor, typename WTensor, typename ATensor>
 void eig_impl(OutputTensor &&out, WTensor &&w,
          const ATensor &a, const cudaExecutor &exec,
          EigenMode jobz = EigenMode::VECTOR,
-         SolverFillMode uplo = SolverFillMode::UPPER)
+         SolverFillMode uplo = SolverFillMode::UPPER,
+         const JacobiParams &jacobi = {})
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   using T1 = typename remove_cvref_t<OutputTensor>::value_type;
 
   auto w_new = OpToTensor(w, exec);
@@ -345,6 +602,8 @@ void eig_impl(OutputTensor &&out, WTensor &&w,
   // Get parameters required by these tensors
   auto params = detail::matxDnEigCUDAPlan_t<OutputTensor, decltype(w_new), decltype(a_new)>::
       GetEigParams(w_new, tv, jobz_cusolver, uplo_cusolver, exec);
+  const auto method = detail::GetCUDAEigMethod(tv, jacobi);
+  params.method = method;
 
   // Get cache or new eigen plan if it doesn't exist
   using cache_val_type = detail::matxDnEigCUDAPlan_t<OutputTensor, decltype(w_new), decltype(a_new)>;
@@ -354,10 +613,10 @@ void eig_impl(OutputTensor &&out, WTensor &&w,
     cache_id,
     params,
     [&]() {
-      return std::make_shared<cache_val_type>(w_new, tv, exec, jobz_cusolver, uplo_cusolver);
+      return std::make_shared<cache_val_type>(w_new, tv, method, exec, jobz_cusolver, uplo_cusolver);
     },
     [&](std::shared_ptr<cache_val_type> ctype) {
-      ctype->Exec(tv, w_new, tv, exec, jobz_cusolver, uplo_cusolver);
+      ctype->Exec(tv, w_new, tv, exec, jobz_cusolver, uplo_cusolver, jacobi);
     },
     exec
   );
@@ -367,4 +626,114 @@ void eig_impl(OutputTensor &&out, WTensor &&w,
   matxFree(tp);
 }
 
+/**
+ * Compute the k largest eigenvalues, and optionally their eigenvectors, of a Hermitian or real
+ * symmetric matrix
+ *
+ * @tparam OutputTensor
+ *   Eigenvector output type
+ * @tparam WTensor
+ *   Eigenvalue output type
+ * @tparam ATensor
+ *   Type of A
+ *
+ * @param out
+ *   Eigenvectors of shape `... x n x k`, one per column
+ * @param w
+ *   Eigenvalues of shape `... x k` in ascending order
+ * @param a
+ *   Input matrix A of shape `... x n x n`
+ * @param k
+ *   Number of eigenpairs
+ * @param exec
+ *   CUDA executor
+ * @param jobz
+ *   EigenMode::VECTOR to compute eigenvectors or
+ *   EigenMode::NO_VECTOR to not compute
+ * @param uplo
+ *   Where to store data in A
+ */
+template <typename OutputTensor, typename WTensor, typename ATensor>
+void eig_impl(OutputTensor &&out, WTensor &&w,
+         const ATensor &a, index_t k, const cudaExecutor &exec,
+         EigenMode jobz = EigenMode::VECTOR,
+         SolverFillMode uplo = SolverFillMode::UPPER)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T1 = typename remove_cvref_t<OutputTensor>::value_type;
+  using T2 = typename remove_cvref_t<WTensor>::value_type;
+  constexpr int RANK = ATensor::Rank();
+  MATX_STATIC_ASSERT_STR(RANK >= 2, matxInvalidDim, "Input to eigen must be rank 2 or higher");
+  MATX_STATIC_ASSERT_STR(remove_cvref_t<WTensor>::Rank() == RANK - 1, matxInvalidDim,
+                         "W tensor must be one rank lower than A for eigen solver");
+
+  const index_t n = a.Size(RANK - 1);
+  MATX_ASSERT_STR(a.Size(RANK - 2) == n, matxInvalidSize, "Input to eigen must be a square matrix");
+  MATX_ASSERT_STR(k > 0 && k <= n, matxInvalidSize, "Number of eigenpairs must be between 1 and the matrix size");
+  MATX_ASSERT_STR(w.Size(RANK - 2) == k, matxInvalidSize, "Eigenvalue output must have k entries per matrix");
+  if (jobz == EigenMode::VECTOR) {
+    MATX_ASSERT_STR(out.Size(RANK - 2) == n && out.Size(RANK - 1) == k, matxInvalidSize,
+                    "Eigenvector output must be n x k");
+  }
+
+  auto a_new = OpToTensor(a, exec);
+  if(!is_matx_transform_op<ATensor>() && !a_new.isSameView(a)) {
+    (a_new = a).run(exec);
+  }
+
+  // cuSolver is column-major, and syevdx returns all n eigenvalue slots even though only k are filled
+  T1 *tp;
+  matxAlloc(reinterpret_cast<void **>(&tp), a_new.Bytes(), MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  auto tv = TransposeCopy(tp, a_new, exec);
+
+  cuda::std::array<index_t, RANK - 1> w_shape;
+  for (int i = 0; i < RANK - 2; i++) {
+    w_shape[i] = a.Size(i);
+  }
+  w_shape[RANK - 2] = n;
+  auto w_all = [&]() {
+    detail::ScratchScope scratch{exec.getStream()};
+    return make_tensor<T2>(w_shape, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  }();
+
+  detail::DnEigRangeCUDAParams_t params;
+  params.n = n;
+  params.k = k;
+  params.batch_size = detail::GetNumBatches(tv);
+  params.jobz = (jobz == EigenMode::VECTOR) ? CUSOLVER_EIG_MODE_VECTOR : CUSOLVER_EIG_MODE_NOVECTOR;
+  params.uplo = (uplo == SolverFillMode::UPPER) ? CUBLAS_FILL_MODE_UPPER : CUBLAS_FILL_MODE_LOWER;
+  params.dtype = TypeToInt<T1>();
+  params.exec = exec;
+
+  using cache_val_type = detail::matxDnEigRangeCUDAPlan_t<T1>;
+  auto cache_id = detail::GetCacheIdFromType<detail::eig_range_cuda_cache_t>();
+  MATX_LOG_DEBUG("Partial eigenvalue transform: cache_id={}, k={}", cache_id, k);
+  detail::GetCache().LookupAndExec<detail::eig_range_cuda_cache_t>(
+    cache_id,
+    params,
+    [&]() {
+      return std::make_shared<cache_val_type>(params);
+    },
+    [&](std::shared_ptr<cache_val_type> ctype) {
+      ctype->Exec(tv.Data(), w_all.Data(), exec);
+    },
+    exec
+  );
+
+  cuda::std::array<index_t, RANK - 1> w_begin{};
+  cuda::std::array<index_t, RANK - 1> w_end;
+  w_end.fill(matxEnd);
+  w_end[RANK - 2] = k;
+  matx::copy(w, w_all.Slice(w_begin, w_end), exec);
+
+  if (jobz == EigenMode::VECTOR) {
+    cuda::std::array<index_t, RANK> v_begin{};
+    cuda::std::array<index_t, RANK> v_end;
+    v_end.fill(matxEnd);
+    v_end[RANK - 1] = k;
+    matx::copy(out, tv.PermuteMatrix().Slice(v_begin, v_end), exec);
+  }
+  matxFree(tp);
+}
+
 } // end namespace matx
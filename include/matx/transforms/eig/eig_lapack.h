@@ -101,7 +101,7 @@ public:
                         const char jobz = 'V',
                         const char uplo = 'U')
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK == ATensor::Rank(), matxInvalidDim, "Output and A tensor ranks must match for eigen solver");
@@ -177,7 +177,7 @@ public:
             const char jobz = 'V',
             const char uplo = 'U')
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize, "Input to eigen must be a square matrix");
 
@@ -196,18 +196,19 @@ public:
       (out = a).run(exec);
     }
 
-    lapack_int_t info;
-    for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
+    const lapack_int_t info = this->ExecBatches(exec, [&](size_t i, void *ws, void *rws, void *iws) {
+      lapack_int_t batch_info;
       syevd_dispatch(&jobz, &uplo, &params.n,
                       reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
                       &params.n, reinterpret_cast<T2*>(this->batch_w_ptrs[i]),
-                      reinterpret_cast<T1*>(this->work), &this->lwork,
-                      reinterpret_cast<T2*>(this->rwork), &this->lrwork,
-                      reinterpret_cast<lapack_int_t*>(this->iwork), &this->liwork, &info);
+                      reinterpret_cast<T1*>(ws), &this->lwork,
+                      reinterpret_cast<T2*>(rws), &this->lrwork,
+                      reinterpret_cast<lapack_int_t*>(iws), &this->liwork, &batch_info);
+      return batch_info;
+    });
 
-      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
-          (std::to_string(info) + " off-diagonal elements of an intermediate tridiagonal form did not converge to zero in LAPACK syevd").c_str());
-    }
+    MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        (std::to_string(info) + " off-diagonal elements of an intermediate tridiagonal form did not converge to zero in LAPACK syevd").c_str());
   }
 
   /**
@@ -314,7 +315,7 @@ void eig_impl([[maybe_unused]] OutputTensor &&out,
               [[maybe_unused]] EigenMode jobz = EigenMode::VECTOR,
               [[maybe_unused]] SolverFillMode uplo = SolverFillMode::UPPER)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   MATX_ASSERT_STR(MATX_EN_CPU_SOLVER, matxInvalidExecutor,
     "Trying to run a host Solver executor but host Solver support is not configured");
 #if MATX_EN_CPU_SOLVER
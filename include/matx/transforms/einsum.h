@@ -34,6 +34,7 @@
 #pragma once
 
 #ifdef MATX_EN_CUTENSOR
+#include <algorithm>
 #include <cstdio>
 #include <numeric>
 #include "error.h"
@@ -64,7 +65,7 @@ struct EinsumParams_t {
   cuda::std::array<int32_t, sizeof...(InT)> nmodes_;
   uint32_t alignment_out_;
   uint32_t alignments_in_[sizeof...(InT)];
-  int64_t num_slices_;
+  int64_t num_slices_ = 0; // Filled in by the path optimizer; not part of the cache key
 
   std::string subs;
   MatXDataType_t dtype;
@@ -97,7 +98,7 @@ public:
   matxEinsumHandle_t(OutputTensor &out, const std::string &subscripts, cudaStream_t stream, const InT&... tensors)
   {
     [[maybe_unused]] cutensornetStatus_t status;
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     size_t i;
     params_ = GetEinsumParams(out, subscripts, tensors...);
@@ -314,7 +315,7 @@ public:
    * @return true if tokenized successfully, or false otherwise
    */
   static bool ParseEinsum(const std::string &str, std::vector<std::string> &out) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Find output separator
     auto iout = str.find("->");
@@ -343,7 +344,7 @@ public:
 
   static EinsumParams_t<InT...> GetEinsumParams(OutputTensor &out, const std::string &subscripts, const InT&... tensors)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     EinsumParams_t<InT...> params;
     std::vector<std::string> tokens;
@@ -431,7 +432,7 @@ public:
 
   inline void Exec(OutputTensor &out, cudaStream_t stream, const InT... tensors)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     [[maybe_unused]] cutensornetStatus_t status;
 
     cutensornetSliceGroup_t sliceGroup{};
@@ -492,6 +493,181 @@ public:
     int64_t tensorIds_[sizeof...(InT)];
 };
 
+/**
+ * @brief Returns true if a value type can use the direct cuTENSOR contraction path
+ */
+template <typename T>
+constexpr bool EinsumDirectTypeSupported() {
+  return std::is_same_v<T, float> || std::is_same_v<T, double> ||
+         std::is_same_v<T, cuda::std::complex<float>> || std::is_same_v<T, cuda::std::complex<double>>;
+}
+
+/**
+ * @brief Checks whether an einsum can be issued as a single cuTENSOR contraction
+ *
+ * cuTENSOR's contraction handles two operands where every mode is either shared by
+ * both inputs (contracted), present in one input and the output (free), or present in
+ * all three (batched). Traces, single-operand reductions and 0D outputs are left to
+ * cuTensorNet.
+ *
+ * @param params Einsum parameters
+ * @return true if the direct path can be used
+ */
+template <typename... InT>
+bool EinsumDirectEligible(const EinsumParams_t<InT...> &params) {
+  if constexpr (sizeof...(InT) != 2) {
+    return false;
+  }
+  else {
+    for (const auto &m : params.modes_) {
+      if (m.size() == 0) {
+        return false;
+      }
+
+      // Repeated modes within one operand (diagonals/traces) are not contractions
+      for (size_t i = 0; i < m.size(); i++) {
+        if (std::count(m.begin(), m.end(), m[i]) != 1) {
+          return false;
+        }
+      }
+    }
+
+    for (const auto &m : params.modes_) {
+      for (const auto mode : m) {
+        int uses = 0;
+        for (const auto &other : params.modes_) {
+          uses += std::find(other.begin(), other.end(), mode) != other.end() ? 1 : 0;
+        }
+
+        if (uses < 2) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+}
+
+/**
+ * @brief Direct cuTENSOR plan for two-operand contractions
+ *
+ * Two-operand contractions have only one possible path, so the cuTensorNet path search
+ * is skipped entirely and a cuTENSOR contraction plan is created once and cached.
+ */
+template <typename OutputTensor, typename TensorA, typename TensorB>
+class matxEinsumDirectHandle_t {
+public:
+  using value_type = typename OutputTensor::value_type;
+
+  matxEinsumDirectHandle_t(OutputTensor &out, const std::string &subscripts, cudaStream_t stream,
+                           const TensorA &a, const TensorB &b)
+  {
+    [[maybe_unused]] cutensorStatus_t status;
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    params_ = matxEinsumHandle_t<OutputTensor, TensorA, TensorB>::GetEinsumParams(out, subscripts, a, b);
+
+    status = cutensorCreate(&handle_);
+    MATX_ASSERT_STR(status == CUTENSOR_STATUS_SUCCESS, matxcuTensorError,
+      "Failed to create cuTENSOR handle");
+
+    const auto dtype = static_cast<cutensorDataType_t>(MatXTypeToCudaType<value_type>());
+    for (size_t i = 0; i < 3; i++) {
+      const uint32_t alignment = i < 2 ? params_.alignments_in_[i] : params_.alignment_out_;
+      status = cutensorCreateTensorDescriptor(handle_,
+                                              &desc_[i],
+                                              static_cast<uint32_t>(params_.modes_[i].size()),
+                                              params_.extents_[i].data(),
+                                              params_.strides_[i].data(),
+                                              dtype,
+                                              alignment);
+      MATX_ASSERT_STR(status == CUTENSOR_STATUS_SUCCESS, matxcuTensorError,
+        "Failed to create cuTENSOR tensor descriptor");
+    }
+
+    cutensorComputeDescriptor_t compute_desc;
+    if constexpr (std::is_same_v<value_type, double> || std::is_same_v<value_type, cuda::std::complex<double>>) {
+      compute_desc = CUTENSOR_COMPUTE_DESC_64F;
+    }
+    else {
+      compute_desc = CUTENSOR_COMPUTE_DESC_32F;
+    }
+
+    // The output doubles as C with beta = 0
+    status = cutensorCreateContraction(handle_, &op_,
+                                       desc_[0], params_.modes_[0].data(), CUTENSOR_OP_IDENTITY,
+                                       desc_[1], params_.modes_[1].data(), CUTENSOR_OP_IDENTITY,
+                                       desc_[2], params_.modes_[2].data(), CUTENSOR_OP_IDENTITY,
+                                       desc_[2], params_.modes_[2].data(),
+                                       compute_desc);
+    MATX_ASSERT_STR(status == CUTENSOR_STATUS_SUCCESS, matxcuTensorError,
+      "Failed to create cuTENSOR contraction");
+
+    status = cutensorCreatePlanPreference(handle_, &pref_, CUTENSOR_ALGO_DEFAULT, CUTENSOR_JIT_MODE_NONE);
+    MATX_ASSERT_STR(status == CUTENSOR_STATUS_SUCCESS, matxcuTensorError,
+      "Failed to create cuTENSOR plan preference");
+
+    uint64_t estimated_size = 0;
+    status = cutensorEstimateWorkspaceSize(handle_, op_, pref_, CUTENSOR_WORKSPACE_DEFAULT, &estimated_size);
+    MATX_ASSERT_STR(status == CUTENSOR_STATUS_SUCCESS, matxcuTensorError,
+      "Failed to estimate cuTENSOR workspace size");
+
+    status = cutensorCreatePlan(handle_, &plan_, op_, pref_, estimated_size);
+    MATX_ASSERT_STR(status == CUTENSOR_STATUS_SUCCESS, matxcuTensorError,
+      "Failed to create cuTENSOR contraction plan");
+
+    status = cutensorPlanGetAttribute(handle_, plan_, CUTENSOR_PLAN_REQUIRED_WORKSPACE,
+                                      &workSize_, sizeof(workSize_));
+    MATX_ASSERT_STR(status == CUTENSOR_STATUS_SUCCESS, matxcuTensorError,
+      "Failed to get cuTENSOR plan workspace size");
+
+    if (workSize_ > 0) {
+      matxAlloc(&workspace_, workSize_, MATX_ASYNC_DEVICE_MEMORY, stream);
+    }
+  }
+
+  ~matxEinsumDirectHandle_t()
+  {
+    if (workspace_ != nullptr) {
+      matxFree(workspace_, cudaStreamDefault);
+    }
+
+    cutensorDestroyPlan(plan_);
+    cutensorDestroyPlanPreference(pref_);
+    cutensorDestroyOperationDescriptor(op_);
+    for (auto &d : desc_) {
+      cutensorDestroyTensorDescriptor(d);
+    }
+    cutensorDestroy(handle_);
+  }
+
+  inline void Exec(OutputTensor &out, cudaStream_t stream, const TensorA &a, const TensorB &b)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    [[maybe_unused]] cutensorStatus_t status;
+
+    const value_type alpha{1};
+    const value_type beta{0};
+    status = cutensorContract(handle_, plan_,
+                              &alpha, a.Data(), b.Data(),
+                              &beta, out.Data(), out.Data(),
+                              workspace_, workSize_, stream);
+    MATX_ASSERT_STR_EXP(status, CUTENSOR_STATUS_SUCCESS,
+      matxcuTensorError, "cutensorContract failed");
+  }
+
+  private:
+    cutensorHandle_t handle_;
+    cutensorTensorDescriptor_t desc_[3];
+    cutensorOperationDescriptor_t op_;
+    cutensorPlanPreference_t pref_;
+    cutensorPlan_t plan_;
+    uint64_t workSize_ = 0;
+    void *workspace_ = nullptr;
+    EinsumParams_t<TensorA, TensorB> params_;
+};
+
 template <typename... InT>
 bool operator==(const EinsumParams_t<InT...> &l, const EinsumParams_t<InT...> &r) {
   return l.modes_ == r.modes_ &&
@@ -500,7 +676,6 @@ bool operator==(const EinsumParams_t<InT...> &l, const EinsumParams_t<InT...> &r
           l.nmodes_ == r.nmodes_ &&
           l.alignment_out_ == r.alignment_out_ &&
           std::equal(std::begin(l.alignments_in_), std::end(l.alignments_in_), std::begin(r.alignments_in_)) &&
-          l.num_slices_ == r.num_slices_ &&
           l.subs == r.subs &&
           l.dtype == r.dtype &&
           l.stream == r.stream;
@@ -510,12 +685,33 @@ template <typename... InT>
 struct EinsumParamsKeyHash {
   std::size_t operator()(const EinsumParams_t<InT...> &k) const noexcept
   {
-    return std::hash<std::string>()(k.subs) +
-           std::hash<uint64_t>()((size_t)k.stream);
+    // Recurring contractions often reuse one subscript string with several shapes, so
+    // mix the extents in to keep those plans in separate buckets
+    size_t h = std::hash<std::string>()(k.subs) +
+               std::hash<uint64_t>()((size_t)k.stream);
+    for (const auto &e : k.extents_) {
+      for (const auto v : e) {
+        h = h * 31 + std::hash<int64_t>()(v);
+      }
+    }
+
+    return h;
   }
 };
 
 
+/**
+ * Hash for the direct cuTENSOR plan cache. Kept as a separate type so direct plans get
+ * their own cache ID and never alias cuTensorNet plans for the same parameters.
+ */
+template <typename... InT>
+struct EinsumDirectParamsKeyHash {
+  std::size_t operator()(const EinsumParams_t<InT...> &k) const noexcept
+  {
+    return EinsumParamsKeyHash<InT...>()(k);
+  }
+};
+
 template <typename... InT>
 struct EinsumParamsKeyEq {
   bool operator()(const EinsumParams_t<InT...> &l, const EinsumParams_t<InT...> &t) const noexcept
@@ -557,7 +753,7 @@ namespace cutensor {
   void einsum_impl([[maybe_unused]] OutputType &out, [[maybe_unused]] const std::string &subscripts, [[maybe_unused]] const cudaExecutor &exec, [[maybe_unused]] InT... tensors)
   {
 #ifdef MATX_EN_CUTENSOR
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     const auto stream = exec.getStream();
     auto out_n = detail::cutensor::getEinsumSupportedTensor(out, stream);
@@ -585,6 +781,42 @@ namespace cutensor {
 
     params.stream = stream;
 
+    // Two-operand contractions have a single possible path, so go straight to a cached
+    // cuTENSOR plan and skip the cuTensorNet path search
+    if constexpr (sizeof...(InT) == 2 &&
+        detail::cutensor::EinsumDirectTypeSupported<typename decltype(out_n)::value_type>() &&
+        (std::is_same_v<typename decltype(out_n)::value_type, typename InT::value_type> && ...)) {
+      if (detail::cutensor::EinsumDirectEligible(params)) {
+        using einsum_direct_cache_t = std::unordered_map<
+          detail::cutensor::EinsumParams_t<decltype(detail::cutensor::getEinsumSupportedTensor(tensors, stream))...>,
+          std::any,
+          detail::cutensor::EinsumDirectParamsKeyHash<decltype(detail::cutensor::getEinsumSupportedTensor(tensors, stream))...>,
+          detail::cutensor::EinsumParamsKeyEq<decltype(detail::cutensor::getEinsumSupportedTensor(tensors, stream))...>
+        >;
+        using direct_val_type = matx::detail::cutensor::matxEinsumDirectHandle_t<decltype(out_n),
+                decltype(detail::cutensor::getEinsumSupportedTensor(tensors, stream))...>;
+
+        auto direct_id = detail::GetCacheIdFromType<einsum_direct_cache_t>();
+        MATX_LOG_DEBUG("Einsum direct contraction: cache_id={}", direct_id);
+        detail::GetCache().LookupAndExec<einsum_direct_cache_t>(
+            direct_id,
+            params,
+            [&]() {
+                return cuda::std::apply([&](auto&&... args) {
+                    return std::make_shared<direct_val_type>(out_n, subscripts, stream, args...);
+                }, in_t);
+            },
+            [&](std::shared_ptr<direct_val_type> ctype) {
+                cuda::std::apply([&](auto&&... args) {
+                    ctype->Exec(out_n, stream, args...);
+                }, in_t);
+            },
+            exec
+        );
+        return;
+      }
+    }
+
     auto cache_id = detail::GetCacheIdFromType<einsum_cache_t>();
     MATX_LOG_DEBUG("Einsum transform: cache_id={}", cache_id);
     detail::GetCache().LookupAndExec<einsum_cache_t>(
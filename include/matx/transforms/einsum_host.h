@@ -0,0 +1,482 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/operator_utils.h"
+#include "matx/executors/host.h"
+#include "matx/executors/support.h"
+#include "matx/transforms/einsum_path.h"
+#ifdef MATX_EN_CPU_MATMUL
+  #include "matx/transforms/matmul/matmul_cblas.h"
+#endif
+
+namespace matx {
+namespace detail {
+
+/**
+ * Dense row-major operand of a host einsum. Intermediates change rank from one contraction
+ * to the next, so modes and extents are kept at runtime.
+ */
+template <typename T>
+struct EinsumHostOperand {
+  std::vector<int32_t> modes;
+  std::vector<index_t> extents;
+  std::vector<T> storage; // Empty when data points into a contiguous input tensor
+  const T *data = nullptr;
+};
+
+inline index_t EinsumHostTotalSize(const std::vector<index_t> &extents) {
+  return std::accumulate(extents.begin(), extents.end(), static_cast<index_t>(1), std::multiplies<index_t>());
+}
+
+inline std::vector<index_t> EinsumHostStrides(const std::vector<index_t> &extents) {
+  std::vector<index_t> strides(extents.size());
+  index_t s = 1;
+  for (int d = static_cast<int>(extents.size()) - 1; d >= 0; d--) {
+    strides[d] = s;
+    s *= extents[d];
+  }
+
+  return strides;
+}
+
+inline bool EinsumHostContains(const std::vector<int32_t> &v, int32_t m) {
+  return std::find(v.begin(), v.end(), m) != v.end();
+}
+
+/**
+ * @brief Fills a dense row-major output from strided reads of src, summing over the reduced modes
+ *
+ * Both permutes and diagonals are a choice of strides: a mode repeated in the source reads with
+ * the sum of the strides of its copies.
+ */
+template <typename T, typename Executor>
+void EinsumHostRemap(T *dst, const std::vector<index_t> &extents, const std::vector<index_t> &strides,
+                     const std::vector<index_t> &red_extents, const std::vector<index_t> &red_strides,
+                     const T *src, const Executor &exec) {
+  const int rank = static_cast<int>(extents.size());
+  const int red_rank = static_cast<int>(red_extents.size());
+  const index_t inner = rank > 0 ? extents[rank - 1] : 1;
+  const index_t inner_stride = rank > 0 ? strides[rank - 1] : 0;
+  const index_t total = EinsumHostTotalSize(extents);
+  const index_t red_total = EinsumHostTotalSize(red_extents);
+  if (total == 0) {
+    return;
+  }
+
+  exec.ParallelFor(total / inner, [&](index_t row) {
+    index_t offset = 0;
+    index_t rem = row;
+    for (int d = rank - 2; d >= 0; d--) {
+      offset += (rem % extents[d]) * strides[d];
+      rem /= extents[d];
+    }
+
+    for (index_t j = 0; j < inner; j++) {
+      const T *s = src + offset + j * inner_stride;
+      if (red_rank == 0) {
+        dst[row * inner + j] = *s;
+        continue;
+      }
+
+      T acc = T(0);
+      for (index_t r = 0; r < red_total; r++) {
+        index_t roff = 0;
+        index_t rrem = r;
+        for (int d = red_rank - 1; d >= 0; d--) {
+          roff += (rrem % red_extents[d]) * red_strides[d];
+          rrem /= red_extents[d];
+        }
+        acc += s[roff];
+      }
+      dst[row * inner + j] = acc;
+    }
+  });
+}
+
+/**
+ * @brief Rearranges an operand into the given modes
+ *
+ * Repeated modes of the operand become their diagonal, and modes missing from the new list are
+ * summed over. The operand is returned untouched if it already has exactly these modes.
+ */
+template <typename T, typename Executor>
+EinsumHostOperand<T> EinsumHostPermuteReduce(EinsumHostOperand<T> &&in, const std::vector<int32_t> &modes,
+                                             const Executor &exec) {
+  if (in.modes == modes) {
+    return std::move(in);
+  }
+
+  const auto src_strides = EinsumHostStrides(in.extents);
+  const auto mode_extent = [&](int32_t m) {
+    return in.extents[std::find(in.modes.begin(), in.modes.end(), m) - in.modes.begin()];
+  };
+  const auto mode_stride = [&](int32_t m) {
+    index_t s = 0;
+    for (size_t i = 0; i < in.modes.size(); i++) {
+      s += in.modes[i] == m ? src_strides[i] : 0;
+    }
+    return s;
+  };
+
+  EinsumHostOperand<T> res;
+  std::vector<index_t> strides;
+  res.modes = modes;
+  for (const auto m : modes) {
+    res.extents.push_back(mode_extent(m));
+    strides.push_back(mode_stride(m));
+  }
+
+  std::vector<index_t> red_extents;
+  std::vector<index_t> red_strides;
+  for (size_t i = 0; i < in.modes.size(); i++) {
+    const auto m = in.modes[i];
+    if (std::find(in.modes.begin(), in.modes.end(), m) - in.modes.begin() == static_cast<std::ptrdiff_t>(i) &&
+        !EinsumHostContains(modes, m)) {
+      red_extents.push_back(in.extents[i]);
+      red_strides.push_back(mode_stride(m));
+    }
+  }
+
+  res.storage.resize(EinsumHostTotalSize(res.extents));
+  res.data = res.storage.data();
+  EinsumHostRemap(res.storage.data(), res.extents, strides, red_extents, red_strides, in.data, exec);
+  return res;
+}
+
+#if MATX_EN_CPU_MATMUL
+template <typename T>
+void EinsumHostGemm(bool transa, bool transb, cblas_int_t m, cblas_int_t n, cblas_int_t k,
+                    const T *a, const T *b, T *c) {
+  const auto opa = transa ? CblasTrans : CblasNoTrans;
+  const auto opb = transb ? CblasTrans : CblasNoTrans;
+  const cblas_int_t lda = transa ? m : k;
+  const cblas_int_t ldb = transb ? k : n;
+
+  if constexpr (std::is_same_v<T, float>) {
+    cblas_sgemm(CblasRowMajor, opa, opb, m, n, k, 1.0f, a, lda, b, ldb, 0.0f, c, n);
+  } else if constexpr (std::is_same_v<T, double>) {
+    cblas_dgemm(CblasRowMajor, opa, opb, m, n, k, 1.0, a, lda, b, ldb, 0.0, c, n);
+  } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+    const T alpha{1.0f, 0.0f};
+    const T beta{0.0f, 0.0f};
+    cblas_cgemm(CblasRowMajor, opa, opb, m, n, k, (const void *)&alpha, (const void *)a, lda,
+                (const void *)b, ldb, (const void *)&beta, (void *)c, n);
+  } else if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
+    const T alpha{1.0, 0.0};
+    const T beta{0.0, 0.0};
+    cblas_zgemm(CblasRowMajor, opa, opb, m, n, k, (const void *)&alpha, (const void *)a, lda,
+                (const void *)b, ldb, (const void *)&beta, (void *)c, n);
+  }
+}
+
+/**
+ * @brief Runs one GEMM per batch of dense row-major operands
+ *
+ * With at least as many batches as threads, every thread runs whole single-threaded GEMMs.
+ * Otherwise the batches run in order and the BLAS library threads each GEMM.
+ */
+template <typename T, ThreadsMode MODE>
+void EinsumHostBatchedGemm(bool transa, bool transb, index_t batches, index_t m, index_t n, index_t k,
+                           const T *a, const T *b, T *c, const HostExecutor<MODE> &exec) {
+  const int nthreads = exec.GetNumThreads();
+  const bool batch_parallel = nthreads > 1 && batches >= nthreads;
+  [[maybe_unused]] const int blas_threads = batch_parallel ? 1 : nthreads;
+
+#ifdef MATX_EN_OPENBLAS
+  openblas_set_num_threads(blas_threads);
+#elif defined(MATX_EN_BLIS)
+  bli_thread_set_num_threads(blas_threads);
+#endif
+
+  const auto run_batch = [&](index_t i) {
+#ifdef MATX_EN_NVPL
+    nvpl_blas_set_num_threads_local(blas_threads);
+#endif
+    EinsumHostGemm(transa, transb, static_cast<cblas_int_t>(m), static_cast<cblas_int_t>(n),
+                   static_cast<cblas_int_t>(k), a + i * m * k, b + i * k * n, c + i * m * n);
+  };
+
+  if (batch_parallel) {
+    exec.ParallelFor(batches, run_batch);
+  }
+  else {
+    for (index_t i = 0; i < batches; i++) {
+      run_batch(i);
+    }
+  }
+}
+#endif
+
+/**
+ * @brief Contracts two operands with a batched GEMM after permuting them (TTGT)
+ *
+ * Modes in both operands are batched if they are kept and contracted otherwise. A is arranged as
+ * (batch, free A, contracted) and B as (batch, contracted, free B), and an operand already holding
+ * the transposed order of its last two groups is passed to the GEMM as transposed instead of being
+ * copied. The result has modes (batch, free A, free B).
+ */
+template <typename T, ThreadsMode MODE>
+EinsumHostOperand<T> EinsumHostContract(EinsumHostOperand<T> &&a, EinsumHostOperand<T> &&b,
+                                        const std::vector<int32_t> &keep, const HostExecutor<MODE> &exec) {
+#if MATX_EN_CPU_MATMUL
+  std::vector<int32_t> batch, contracted, free_a, free_b;
+  for (const auto m : a.modes) {
+    if (!EinsumHostContains(b.modes, m)) {
+      free_a.push_back(m);
+    }
+    else if (EinsumHostContains(keep, m)) {
+      batch.push_back(m);
+    }
+    else {
+      contracted.push_back(m);
+    }
+  }
+  for (const auto m : b.modes) {
+    if (!EinsumHostContains(a.modes, m)) {
+      free_b.push_back(m);
+    }
+  }
+
+  const auto concat = [](std::vector<int32_t> x, const std::vector<int32_t> &y, const std::vector<int32_t> &z) {
+    x.insert(x.end(), y.begin(), y.end());
+    x.insert(x.end(), z.begin(), z.end());
+    return x;
+  };
+
+  bool transa = false;
+  if (a.modes == concat(batch, contracted, free_a) && a.modes != concat(batch, free_a, contracted)) {
+    transa = true;
+  }
+  else {
+    a = EinsumHostPermuteReduce(std::move(a), concat(batch, free_a, contracted), exec);
+  }
+
+  bool transb = false;
+  if (b.modes == concat(batch, free_b, contracted) && b.modes != concat(batch, contracted, free_b)) {
+    transb = true;
+  }
+  else {
+    b = EinsumHostPermuteReduce(std::move(b), concat(batch, contracted, free_b), exec);
+  }
+
+  const auto group_size = [&](const EinsumHostOperand<T> &op, const std::vector<int32_t> &group) {
+    index_t s = 1;
+    for (const auto m : group) {
+      s *= op.extents[std::find(op.modes.begin(), op.modes.end(), m) - op.modes.begin()];
+    }
+    return s;
+  };
+
+  const index_t batches = group_size(a, batch);
+  const index_t m = group_size(a, free_a);
+  const index_t n = group_size(b, free_b);
+  const index_t k = group_size(a, contracted);
+
+  EinsumHostOperand<T> res;
+  res.modes = concat(batch, free_a, free_b);
+  for (const auto mode : res.modes) {
+    const auto &src = EinsumHostContains(a.modes, mode) ? a : b;
+    res.extents.push_back(src.extents[std::find(src.modes.begin(), src.modes.end(), mode) - src.modes.begin()]);
+  }
+  res.storage.resize(batches * m * n);
+  res.data = res.storage.data();
+
+  if (k == 0) {
+    std::fill(res.storage.begin(), res.storage.end(), T(0));
+  }
+  else if (batches * m * n > 0) {
+    EinsumHostBatchedGemm(transa, transb, batches, m, n, k, a.data, b.data, res.storage.data(), exec);
+  }
+
+  return res;
+#else
+  MATX_THROW(matxInvalidExecutor, "Host einsum contractions require host MatMul support, but it is not configured");
+  return EinsumHostOperand<T>{};
+#endif
+}
+
+} // end namespace detail
+
+/**
+ * @brief Evaluates the Einstein summation on the operands with a host executor
+ *
+ * Each input is first reduced to the modes used elsewhere, which also takes the diagonal of any
+ * repeated mode. Pairs of operands are then contracted in the order chosen by a greedy search over
+ * the number of multiply-adds, each as a batched CBLAS GEMM after permuting the operands (TTGT).
+ * Batched GEMMs are spread across the executor's threads when there are enough batches to occupy
+ * them. Single-operand permutes, sums and traces do not need host MatMul support.
+ *
+ * @tparam OutputType Output tensor type
+ * @tparam MODE Threading policy
+ * @tparam InT Types of input operators
+ * @param out Output tensor
+ * @param subscripts String containing Einstein notation of operation to perform
+ * @param exec Host executor
+ * @param tensors List of input operators
+ */
+template <typename OutputType, ThreadsMode MODE, typename... InT>
+void einsum_impl(OutputType &out, const std::string &subscripts, const HostExecutor<MODE> &exec, InT... tensors)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T = typename OutputType::value_type;
+
+  MATX_STATIC_ASSERT_STR((std::is_same_v<T, typename InT::value_type> && ...), matxInvalidType,
+      "Host einsum requires all inputs to have the type of the output");
+  MATX_STATIC_ASSERT_STR((std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                          std::is_same_v<T, cuda::std::complex<float>> || std::is_same_v<T, cuda::std::complex<double>>),
+      matxInvalidType, "Host einsum supports float, double and their complex types");
+
+  std::vector<std::string> tokens;
+  MATX_ASSERT_STR(detail::EinsumSplitSubscripts(subscripts, tokens), matxInvalidParameter,
+      "einsum() requires an output separator '->'");
+  MATX_ASSERT_STR(tokens.size() - 1 == sizeof...(InT), matxInvalidDim,
+      "Number of subscript groups in Einstein notation must match the number of operators (input and output)");
+
+  std::vector<detail::EinsumHostOperand<T>> ops;
+  const auto load = [&](const auto &op) {
+    using op_type = remove_cvref_t<decltype(op)>;
+    constexpr int RANK = op_type::Rank();
+    const auto &tok = tokens[ops.size()];
+    MATX_ASSERT_STR(tok.length() == static_cast<size_t>(RANK), matxInvalidDim,
+        "Tensor rank must match number of einsum subscripts");
+
+    detail::EinsumHostOperand<T> o;
+    for (int d = 0; d < RANK; d++) {
+      o.modes.push_back(static_cast<int32_t>(tok[d]));
+      o.extents.push_back(op.Size(d));
+    }
+
+    bool in_place = false;
+    if constexpr (is_tensor_view_v<op_type>) {
+      in_place = op.IsContiguous();
+      o.data = op.Data();
+    }
+
+    if (!in_place) {
+      o.storage.resize(TotalSize(op));
+      o.data = o.storage.data();
+      if constexpr (RANK == 0) {
+        o.storage[0] = op();
+      }
+      else {
+        auto t = make_tensor<T>(o.storage.data(), Shape(op));
+        (t = op).run(exec);
+      }
+    }
+
+    ops.push_back(std::move(o));
+  };
+  (load(tensors), ...);
+
+  std::vector<int32_t> out_modes;
+  for (const char c : tokens.back()) {
+    const auto m = static_cast<int32_t>(c);
+    MATX_ASSERT_STR(!detail::EinsumHostContains(out_modes, m), matxInvalidParameter,
+        "Host einsum does not support repeated output modes");
+    out_modes.push_back(m);
+  }
+  MATX_ASSERT_STR(out_modes.size() == static_cast<size_t>(OutputType::Rank()), matxInvalidDim,
+      "Output rank must match number of einsum output subscripts");
+
+  std::unordered_map<int32_t, int64_t> extents;
+  for (const auto &o : ops) {
+    for (size_t i = 0; i < o.modes.size(); i++) {
+      const auto it = extents.find(o.modes[i]);
+      MATX_ASSERT_STR(it == extents.end() || it->second == o.extents[i], matxInvalidSize,
+          "Every use of an einsum mode must have the same size");
+      extents[o.modes[i]] = o.extents[i];
+    }
+  }
+  for (int d = 0; d < OutputType::Rank(); d++) {
+    MATX_ASSERT_STR(extents.count(out_modes[d]) && extents[out_modes[d]] == out.Size(d), matxInvalidSize,
+        "Output mode sizes must match the input mode sizes");
+  }
+
+  // Modes still needed by the output or by any operand other than the excluded ones
+  const auto kept_modes = [&](const std::vector<size_t> &exclude) {
+    std::vector<int32_t> keep = out_modes;
+    for (size_t o = 0; o < ops.size(); o++) {
+      if (std::find(exclude.begin(), exclude.end(), o) == exclude.end()) {
+        keep.insert(keep.end(), ops[o].modes.begin(), ops[o].modes.end());
+      }
+    }
+    return keep;
+  };
+
+  // Traces, diagonals and modes used by one operand only are removed before any contraction
+  for (size_t o = 0; o < ops.size(); o++) {
+    const auto keep = kept_modes({o});
+    std::vector<int32_t> modes;
+    for (const auto m : ops[o].modes) {
+      if (detail::EinsumHostContains(keep, m) && !detail::EinsumHostContains(modes, m)) {
+        modes.push_back(m);
+      }
+    }
+    ops[o] = detail::EinsumHostPermuteReduce(std::move(ops[o]), modes, exec);
+  }
+
+  std::vector<std::vector<int32_t>> modes;
+  for (const auto &o : ops) {
+    modes.push_back(o.modes);
+  }
+
+  for (const auto &[i, j] : detail::EinsumGreedyPath(modes, out_modes, extents)) {
+    const auto keep = kept_modes({static_cast<size_t>(i), static_cast<size_t>(j)});
+    auto res = detail::EinsumHostContract(std::move(ops[i]), std::move(ops[j]), keep, exec);
+    ops.erase(ops.begin() + j);
+    ops.erase(ops.begin() + i);
+    ops.push_back(std::move(res));
+  }
+
+  auto res = detail::EinsumHostPermuteReduce(std::move(ops[0]), out_modes, exec);
+  if constexpr (OutputType::Rank() == 0) {
+    out() = res.data[0];
+  }
+  else {
+    auto t = make_tensor<T>(const_cast<T *>(res.data), Shape(out));
+    (out = t).run(exec);
+  }
+}
+
+} // end namespace matx
@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace matx {
+namespace detail {
+
+/**
+ * @brief Splits an einsum string into the subscripts of each input followed by those of the output
+ *
+ * Whitespace is ignored, and an empty output group denotes a 0D output.
+ *
+ * @param str einsum string
+ * @param out Subscript groups
+ * @return true if the string has an output separator, or false otherwise
+ */
+inline bool EinsumSplitSubscripts(const std::string &str, std::vector<std::string> &out) {
+  std::string s;
+  std::copy_if(str.begin(), str.end(), std::back_inserter(s), [](char c) { return c != ' '; });
+
+  const auto iout = s.find("->");
+  if (iout == std::string::npos) {
+    return false;
+  }
+
+  size_t start = 0;
+  while (true) {
+    const auto sep = s.find(',', start);
+    if (sep == std::string::npos || sep > iout) {
+      out.push_back(s.substr(start, iout - start));
+      break;
+    }
+
+    out.push_back(s.substr(start, sep - start));
+    start = sep + 1;
+  }
+
+  out.push_back(s.substr(iout + 2));
+  return true;
+}
+
+/**
+ * @brief Chooses a pairwise contraction order for an einsum with a greedy search
+ *
+ * Each step contracts the pair of operands needing the fewest multiply-adds, breaking ties by the
+ * size of the intermediate. Pairs sharing no modes are outer products and are only taken when no
+ * other pair is left. Modes of each intermediate are the modes of the pair still used by the output
+ * or a remaining operand. The search only uses modes and extents, so it is independent of the
+ * backend running the contractions.
+ *
+ * @param modes Modes of each input operand
+ * @param out_modes Modes of the output
+ * @param extents Extent of every mode
+ * @return Positions of the pair contracted at each step in the current operand list. Both are removed
+ *   from the list and their result is appended to the end, as in the path format of opt_einsum and
+ *   cuTensorNet.
+ */
+inline std::vector<std::pair<int, int>> EinsumGreedyPath(std::vector<std::vector<int32_t>> modes,
+                                                         const std::vector<int32_t> &out_modes,
+                                                         const std::unordered_map<int32_t, int64_t> &extents) {
+  std::vector<std::pair<int, int>> path;
+
+  const auto contains = [](const std::vector<int32_t> &v, int32_t m) {
+    return std::find(v.begin(), v.end(), m) != v.end();
+  };
+
+  while (modes.size() > 1) {
+    const int n = static_cast<int>(modes.size());
+    std::pair<int, int> best{0, 1};
+    std::vector<int32_t> best_modes;
+    bool found = false;
+    bool best_shared = false;
+    double best_cost = 0.0;
+    double best_size = 0.0;
+
+    for (int i = 0; i < n; i++) {
+      for (int j = i + 1; j < n; j++) {
+        std::vector<int32_t> pair_modes = modes[i];
+        bool shared = false;
+        for (const auto m : modes[j]) {
+          if (contains(modes[i], m)) {
+            shared = true;
+          }
+          else {
+            pair_modes.push_back(m);
+          }
+        }
+
+        double cost = 1.0;
+        double size = 1.0;
+        std::vector<int32_t> res_modes;
+        for (const auto m : pair_modes) {
+          const double e = static_cast<double>(extents.at(m));
+          cost *= e;
+
+          bool keep = contains(out_modes, m);
+          for (int o = 0; o < n && !keep; o++) {
+            keep = o != i && o != j && contains(modes[o], m);
+          }
+
+          if (keep) {
+            res_modes.push_back(m);
+            size *= e;
+          }
+        }
+
+        const bool better = !found ||
+                            (shared != best_shared ? shared :
+                             cost != best_cost ? cost < best_cost : size < best_size);
+        if (better) {
+          found = true;
+          best = {i, j};
+          best_modes = std::move(res_modes);
+          best_shared = shared;
+          best_cost = cost;
+          best_size = size;
+        }
+      }
+    }
+
+    path.push_back(best);
+    modes.erase(modes.begin() + best.second);
+    modes.erase(modes.begin() + best.first);
+    modes.push_back(std::move(best_modes));
+  }
+
+  return path;
+}
+
+} // end namespace detail
+} // end namespace matx
@@ -41,7 +41,7 @@ namespace detail {
                       const InputTensor &i, index_t fft_size,
                       [[maybe_unused]] const Executor &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     
     using index_type = typename OutputTensor::shape_type;
     using T1    = typename OutputTensor::value_type;
@@ -47,6 +47,14 @@
 #include <functional>
 #include <optional>
 #include <mutex>
+#include <string>
+#include <vector>
+
+// cuFFT 11.3 added LTO callbacks, which let the JIT compile an operator straight into the FFT's loads
+#if defined(MATX_EN_JIT) && defined(CUFFT_VERSION) && CUFFT_VERSION >= 11300
+  #define MATX_EN_CUFFT_LTO_CALLBACKS
+  #include "matx/core/nvrtc_helper.h"
+#endif
 
   #define MATX_CUFFT_ASSERT_STR_EXP(a, expected) \
   {                                    \
@@ -98,6 +106,28 @@ struct FftCUDAParams_t {
   cudaDataType exec_type;
   int fft_rank;
   cudaStream_t stream = 0;
+  // Source of a fused load callback, or empty if the input is read from memory
+  std::string load_callback;
+};
+
+/**
+ * LTO load callback fused into a cuFFT plan
+ */
+struct FFTLoadCallback {
+  std::string key;                    // Identifies the callback in the plan cache
+  std::string symbol;                 // Name of the device function in the LTO-IR
+  const std::vector<char> *ltoir;     // Compiled callback
+  size_t info_size;                   // Size of the caller info block passed to the callback
+};
+
+/**
+ * Caller info for a load callback: the logical input shape followed by the operator's JIT storage.
+ * The JIT-side struct in the callback source has the same layout.
+ */
+template <int RANK, typename Storage>
+struct FFTLoadCallbackInfo {
+  index_t sizes[RANK];
+  Storage op;
 };
 
 /* Base class for FFTs. This should not be used directly. */
@@ -126,8 +156,7 @@ public:
   void inline Forward(OutTensorType &o,
                       const InTensorType &i, cudaStream_t stream, FFTNorm norm = FFTNorm::BACKWARD)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
-    cufftSetStream(this->plan_, stream);
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Normalize input if necessary
     using s_type = typename detail::value_promote_t<typename InTensorType::value_type>;
@@ -138,7 +167,7 @@ public:
       factor = static_cast<s_type>(params_.n[0] * params_.n[1]);
     }
 
-    Exec(o, i, CUFFT_FORWARD);
+    Exec(o, i, CUFFT_FORWARD, stream);
 
     if (norm == FFTNorm::ORTHO) {
       (o *= static_cast<s_type>(1.0 / std::sqrt(factor))).run(stream);
@@ -165,9 +194,8 @@ public:
   void inline Inverse(OutTensorType &o,
                       const InTensorType &i, cudaStream_t stream, FFTNorm norm = FFTNorm::BACKWARD)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
-    cufftSetStream(this->plan_, stream);
-    Exec(o, i, CUFFT_INVERSE);
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    Exec(o, i, CUFFT_INVERSE, stream);
 
     // cuFFT doesn't scale IFFT the same as MATLAB/Python. Scale it here to
     // match
@@ -187,10 +215,28 @@ public:
 
   }
 
+  /**
+   * Update the caller info read by the plan's load callback. The copy is ordered in the stream
+   * before the next execution.
+   *
+   * @param info
+   *   Host copy of the caller info
+   * @param size
+   *   Size of the caller info in bytes
+   * @param stream
+   *   CUDA stream
+   **/
+  void inline SetLoadCallbackInfo(const void *info, size_t size, cudaStream_t stream)
+  {
+    MATX_ASSERT_STR(load_cb_info_ != nullptr && size == load_cb_info_size_, matxInvalidParameter,
+        "FFT plan was not created with a load callback of this size");
+    MATX_CUDA_CHECK(cudaMemcpyAsync(load_cb_info_, info, size, cudaMemcpyHostToDevice, stream));
+  }
+
   static FftCUDAParams_t GetFFTParams(OutTensorType &o,
                           const InTensorType &i, int fft_rank)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     FftCUDAParams_t params;
 
     // Default to default stream, but caller will generally overwrite this
@@ -278,16 +324,19 @@ public:
 protected:
   matxCUDAFFTPlan_t(){};
 
-  virtual void Exec(OutTensorType &o, const InTensorType &i, int dir) = 0;
+  virtual void Exec(OutTensorType &o, const InTensorType &i, int dir, cudaStream_t stream) = 0;
 
-  inline void InternalExec(const void *idata, void *odata, int dir)
+  inline void InternalExec(const void *idata, void *odata, int dir, cudaStream_t stream)
   {
-    // We reuse plans across streams if the plan is identical. This mutex prevents the plan from colliding across streams.
+    // Plans are shared across threads and streams. The stream and work area are plan state in
+    // cuFFT, so they are set together with the launch while holding the plan's mutex, and the
+    // work area is always the workspace of the stream the FFT runs on.
     std::lock_guard<std::mutex> lock(mutex_);
     [[maybe_unused]] cufftResult res;
-    auto workspace = GetCache().GetStreamAlloc(params_.stream, this->workspaceSize);
+    auto workspace = GetCache().GetStreamAlloc(stream, this->workspaceSize);
     MATX_ASSERT_STR(workspace != nullptr, matxCudaError, "Failed to get workspace for stream");
 
+    cufftSetStream(this->plan_, stream);
     cufftSetWorkArea(this->plan_, workspace);
     res = cufftXtExec(this->plan_, (void *)idata, (void *)odata, dir);
     MATX_CUFFT_ASSERT_STR_EXP(res, CUFFT_SUCCESS);
@@ -323,10 +372,15 @@ protected:
 
   virtual ~matxCUDAFFTPlan_t() {
     cufftDestroy(this->plan_);
+    if (load_cb_info_ != nullptr) {
+      matxFree(load_cb_info_);
+    }
   }
 
   cufftHandle plan_;
   FftCUDAParams_t params_;
+  void *load_cb_info_ = nullptr;
+  size_t load_cb_info_size_ = 0;
   void *workspace_;
   size_t workspaceSize;  
   int fftrank_ = 0;
@@ -367,13 +421,13 @@ public:
  *   Output view
  * @param i
  *   Input view
- * @param stream
- *   CUDA stream in which device memory allocations may be made
+ * @param load_cb
+ *   Optional LTO callback that produces the input instead of reading it from memory
  *
  * */
-matxCUDAFFTPlan1D_t(OutTensorType &o, const InTensorType &i)
+matxCUDAFFTPlan1D_t(OutTensorType &o, const InTensorType &i, [[maybe_unused]] const FFTLoadCallback *load_cb = nullptr)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   int dev;
   cudaGetDevice(&dev);
@@ -415,6 +469,25 @@ matxCUDAFFTPlan1D_t(OutTensorType &o, const InTensorType &i)
   cufftSetAutoAllocation(this->plan_, false);
 
   [[maybe_unused]] cufftResult error;
+
+#ifdef MATX_EN_CUFFT_LTO_CALLBACKS
+  // Callbacks must be attached before the plan is made
+  if constexpr (is_complex_v<T2> && !is_complex_half_v<T2>) {
+    if (load_cb != nullptr) {
+      constexpr auto cb_type = std::is_same_v<typename T2::value_type, double> ? CUFFT_CB_LD_COMPLEX_DOUBLE : CUFFT_CB_LD_COMPLEX;
+      this->params_.load_callback = load_cb->key;
+      this->load_cb_info_size_ = load_cb->info_size;
+      matxAlloc(&this->load_cb_info_, load_cb->info_size, MATX_DEVICE_MEMORY);
+      error = cufftXtSetJITCallback(this->plan_, load_cb->symbol.c_str(), load_cb->ltoir->data(),
+                                    load_cb->ltoir->size(), cb_type, &this->load_cb_info_);
+      MATX_CUFFT_ASSERT_STR_EXP(error, CUFFT_SUCCESS);
+    }
+  }
+  else {
+    MATX_ASSERT_STR(load_cb == nullptr, matxInvalidType, "FFT load callbacks require single or double precision complex input");
+  }
+#endif
+
   error = cufftXtGetSizeMany(this->plan_, 1, this->params_.n, this->params_.inembed,
                       this->params_.istride, this->params_.idist,
                       this->params_.input_type, this->params_.onembed,
@@ -436,13 +509,13 @@ matxCUDAFFTPlan1D_t(OutTensorType &o, const InTensorType &i)
 
 private:
 virtual void inline Exec(OutTensorType &o, const InTensorType &i,
-                         int dir) override
+                         int dir, cudaStream_t stream) override
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   if (OutTensorType::Rank() == this->params_.batch_dims + 1) {
     this->InternalExec(static_cast<const void *>(i.Data()),
-                      static_cast<void *>(o.Data()), dir);
+                      static_cast<void *>(o.Data()), dir, stream);
   }
   else {
     using shape_type = typename InTensorType::desc_type::shape_type;
@@ -453,7 +526,7 @@ virtual void inline Exec(OutTensorType &o, const InTensorType &i,
     for (size_t iter = 0; iter < total_iter; iter++) {
       auto ip = cuda::std::apply([&i](auto... param) { return i.GetPointer(param...); }, idx);
       auto op = cuda::std::apply([&o](auto... param) { return o.GetPointer(param...); }, idx);
-      this->InternalExec(static_cast<const void *>(ip), static_cast<void *>(op), dir);
+      this->InternalExec(static_cast<const void *>(ip), static_cast<void *>(op), dir, stream);
 
       // Update all but the last 2 indices
       UpdateIndices<InTensorType, shape_type, InTensorType::Rank()>(i, idx, this->params_.batch_dims + 1);
@@ -506,7 +579,7 @@ public:
   {
     static_assert(RANK >= 2, "2D FFTs require a rank-2 tensor or higher");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     int dev;
     cudaGetDevice(&dev);
@@ -577,15 +650,15 @@ private:
    *   Direction of FFT
    **/
   virtual void inline Exec(OutTensorType &o, const InTensorType &i,
-                           int dir) override
+                           int dir, cudaStream_t stream) override
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     static_assert(RANK >= 2);
 
     if constexpr (RANK <= 3) {
       this->InternalExec(static_cast<const void *>(i.Data()),
-                         static_cast<void *>(o.Data()), dir);
+                         static_cast<void *>(o.Data()), dir, stream);
     }
     else  {
       using shape_type = typename InTensorType::desc_type::shape_type;
@@ -598,7 +671,7 @@ private:
         auto ip = cuda::std::apply([&i](auto... param) { return i.GetPointer(param...); }, idx);
         auto op = cuda::std::apply([&o](auto... param) { return o.GetPointer(param...); }, idx);
 
-        this->InternalExec(static_cast<const void *>(ip), static_cast<void *>(op), dir);
+        this->InternalExec(static_cast<const void *>(ip), static_cast<void *>(op), dir, stream);
 
         // Update all but the last 2 indices
         UpdateIndices<InTensorType, shape_type, InTensorType::Rank()>(i, idx, batch_offset);
@@ -638,26 +711,34 @@ struct FftCUDAParamsKeyEq {
            l.idist == t.idist && l.odist == t.odist &&
            l.transform_type == t.transform_type &&
            l.input_type == t.input_type && l.output_type == t.output_type &&
-           l.exec_type == t.exec_type && l.irank == t.irank && l.orank == t.orank ;
+           l.exec_type == t.exec_type && l.irank == t.irank && l.orank == t.orank &&
+           // A callback's caller info is per plan, so callback plans are not shared across streams
+           l.load_callback == t.load_callback && (l.load_callback.empty() || l.stream == t.stream);
   }
 };
 
 using fft_cuda_cache_t = std::unordered_map<FftCUDAParams_t, std::any, FftCUDAParamsKeyHash, FftCUDAParamsKeyEq>;
 
-template <typename Op>
-__MATX_INLINE__ auto getCufft1DSupportedTensor( const Op &in, cudaStream_t stream) {
+// When alias_out is given, an input that overlaps it without being the same view is copied first.
+// cuFFT only runs in place when the input and output layouts match exactly.
+template <typename Op, typename AliasOp = Op>
+__MATX_INLINE__ auto getCufft1DSupportedTensor( const Op &in, cudaStream_t stream, const AliasOp *alias_out = nullptr) {
   // This would be better as a templated lambda, but we don't have those in C++17 yet
-  const auto support_func = []() {
-    return true;
+  const auto support_func = [&]() {
+    return alias_out == nullptr || GetAliasKind(*alias_out, in) != AliasKind::PARTIAL;
   };
   
   return GetSupportedTensor(in, support_func, MATX_ASYNC_DEVICE_MEMORY, stream);
 }
 
-template <typename Op>
-__MATX_INLINE__ auto getCufft2DSupportedTensor( const Op &in, cudaStream_t stream) {
+template <typename Op, typename AliasOp = Op>
+__MATX_INLINE__ auto getCufft2DSupportedTensor( const Op &in, cudaStream_t stream, const AliasOp *alias_out = nullptr) {
   // This would be better as a templated lambda, but we don't have those in C++17 yet
   const auto support_func = [&]() {
+    if (alias_out != nullptr && GetAliasKind(*alias_out, in) == AliasKind::PARTIAL) {
+      return false;
+    }
+
     if constexpr (is_tensor_view_v<Op>) {
       if ( in.Stride(Op::Rank()-2) != in.Stride(Op::Rank()-1) * in.Size(Op::Rank()-1)) {
         return false;
@@ -677,6 +758,128 @@ __MATX_INLINE__ auto getCufft2DSupportedTensor( const Op &in, cudaStream_t strea
 }
 
 
+/**
+ * Run a 1D C2C FFT with the input operator fused into cuFFT's loads through an LTO callback
+ *
+ * This avoids materializing operator inputs such as fft(window * x). It's only used for
+ * single and double precision C2C transforms where no padding or truncation is needed, the output is
+ * a contiguous tensor, and the input operator can be JIT compiled into a global kernel.
+ *
+ * @return true if the FFT was run, false if the caller must use the regular path
+ */
+template <typename OutputTensor, typename InputOp>
+__MATX_INLINE__ bool fft_load_callback_impl([[maybe_unused]] OutputTensor &o, [[maybe_unused]] const InputOp &i,
+         [[maybe_unused]] index_t fft_size, [[maybe_unused]] FFTNorm norm,
+         [[maybe_unused]] FFTDirection dir, [[maybe_unused]] const cudaExecutor &exec)
+{
+#ifdef MATX_EN_CUFFT_LTO_CALLBACKS
+  using value_type = typename OutputTensor::value_type;
+  constexpr int RANK = InputOp::Rank();
+
+  if constexpr (is_tensor_view_v<InputOp> || !is_tensor_view_v<OutputTensor> ||
+                !is_complex_v<value_type> || is_complex_half_v<value_type> ||
+                !std::is_same_v<value_type, typename InputOp::value_type>) {
+    return false;
+  }
+  else {
+    if ((fft_size != 0 && fft_size != i.Size(RANK - 1)) || !o.IsContiguous()) {
+      return false;
+    }
+    for (int r = 0; r < RANK; r++) {
+      if (o.Size(r) != i.Size(r)) {
+        return false;
+      }
+    }
+    if (!get_operator_capability<OperatorCapability::SUPPORTS_JIT>(i) ||
+        !get_operator_capability<OperatorCapability::GLOBAL_KERNEL>(i) ||
+        get_operator_capability<OperatorCapability::PASS_THROUGH_THREADS>(i)) {
+      return false;
+    }
+
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    const auto stream = exec.getStream();
+
+    using scalar_type = typename value_type::value_type;
+    const std::string vec_type = std::is_same_v<scalar_type, double> ? "double2" : "float2";
+    const std::string scalar_name = std::is_same_v<scalar_type, double> ? "double" : "float";
+    const auto op_type = qualify_jit_type_names(get_operator_capability<OperatorCapability::JIT_TYPE_QUERY>(i));
+
+    std::string indices;
+    for (int r = 0; r < RANK; r++) {
+      indices += (r == 0 ? "idx[" : ", idx[") + std::to_string(r) + "]";
+    }
+
+    // cuFFT passes the element offset into the contiguous batched input, which is unravelled into
+    // the operator's indices
+    const std::string symbol = "matx_fft_load_callback";
+    const std::string source =
+        "struct MatXFFTLoadCallbackInfo {\n"
+        "  matx::index_t sizes[" + std::to_string(RANK) + "];\n"
+        "  " + op_type + " op;\n"
+        "};\n"
+        "extern \"C\" __device__ " + vec_type + " " + symbol + "(void *, unsigned long long offset, void *info, void *) {\n"
+        "  const auto &cb = *static_cast<const MatXFFTLoadCallbackInfo *>(info);\n"
+        "  matx::index_t idx[" + std::to_string(RANK) + "];\n"
+        "  matx::index_t rem = static_cast<matx::index_t>(offset);\n"
+        "  for (int r = " + std::to_string(RANK - 1) + "; r >= 0; r--) {\n"
+        "    idx[r] = rem % cb.sizes[r];\n"
+        "    rem /= cb.sizes[r];\n"
+        "  }\n"
+        "  const auto v = cb.op.template operator()<matx::detail::CurrentCapabilities>(" + indices + ");\n"
+        "  return " + vec_type + "{static_cast<" + scalar_name + ">(v.real()), static_cast<" + scalar_name + ">(v.imag())};\n"
+        "}\n";
+
+    auto storage = detail::to_jit_storage(i);
+    using info_type = FFTLoadCallbackInfo<RANK, remove_cvref_t<decltype(storage)>>;
+    info_type info{{}, storage};
+    for (int r = 0; r < RANK; r++) {
+      info.sizes[r] = i.Size(r);
+    }
+
+    try {
+      const auto &ltoir = nvrtc_get_device_function_ltoir(i, source);
+      const std::string key = source + get_all_jit_classes_string(i);
+      const FFTLoadCallback load_cb{key, symbol, &ltoir, sizeof(info_type)};
+
+      // The output doubles as the nominal input of an in-place plan. cuFFT never reads it since the
+      // callback supplies every input element.
+      auto params = detail::matxCUDAFFTPlan_t<OutputTensor, OutputTensor>::GetFFTParams(o, o, 1);
+      params.stream = stream;
+      params.load_callback = key;
+
+      using cache_val_type = detail::matxCUDAFFTPlan1D_t<OutputTensor, OutputTensor>;
+      auto cache_id = detail::GetCacheIdFromType<detail::fft_cuda_cache_t>();
+      MATX_LOG_DEBUG("FFT1D transform with load callback: cache_id={}", cache_id);
+      detail::GetCache().LookupAndExec<detail::fft_cuda_cache_t>(
+        cache_id,
+        params,
+        [&]() {
+          return std::make_shared<cache_val_type>(o, o, &load_cb);
+        },
+        [&](std::shared_ptr<cache_val_type> ctype) {
+          ctype->SetLoadCallbackInfo(&info, sizeof(info), stream);
+          if (dir == FFTDirection::FORWARD) {
+            ctype->Forward(o, o, stream, norm);
+          }
+          else {
+            ctype->Inverse(o, o, stream, norm);
+          }
+        },
+        exec
+      );
+    }
+    catch (const matxException &e) {
+      MATX_LOG_WARN("Could not fuse FFT input through a cuFFT load callback, materializing it instead: {}", e.what());
+      return false;
+    }
+
+    return true;
+  }
+#else
+  return false;
+#endif
+}
+
 template <typename OutputTensor, typename InputTensor>
 __MATX_INLINE__ void fft_impl(OutputTensor o, const InputTensor i,
          index_t fft_size, FFTNorm norm, const cudaExecutor &exec)
@@ -684,12 +887,16 @@ __MATX_INLINE__ void fft_impl(OutputTensor o, const InputTensor i,
   MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == InputTensor::Rank(), matxInvalidDim,
     "Input and output tensor ranks must match");
 
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   const auto stream = exec.getStream();
 
+  if (fft_load_callback_impl(o, i, fft_size, norm, FFTDirection::FORWARD, exec)) {
+    return;
+  }
+
   // converts operators to tensors
   auto out = getCufft1DSupportedTensor(o, stream);
-  auto in_t = getCufft1DSupportedTensor(i, stream);
+  auto in_t = getCufft1DSupportedTensor(i, stream, &o);
 
   if(!in_t.isSameView(i)) {
     (in_t = i).run(stream);
@@ -703,7 +910,8 @@ __MATX_INLINE__ void fft_impl(OutputTensor o, const InputTensor i,
 
   // Get parameters required by these tensors
   auto params = detail::matxCUDAFFTPlan_t<decltype(out), decltype(in)>::GetFFTParams(out, in, 1);
-  params.stream = stream;
+  // The stream is not part of the key. Plans pick up the stream and its workspace on every
+  // execution, so one plan serves every thread and stream on the device.
 
   using cache_val_type = detail::matxCUDAFFTPlan1D_t<decltype(out), decltype(in)>;
   auto cache_id = detail::GetCacheIdFromType<detail::fft_cuda_cache_t>();
@@ -717,7 +925,8 @@ __MATX_INLINE__ void fft_impl(OutputTensor o, const InputTensor i,
     [&](std::shared_ptr<cache_val_type> ctype) {
       ctype->Forward(out, in, stream, norm);
     },
-    exec
+    exec,
+    detail::CacheSharing::PER_DEVICE
   );
 
   if(!out.isSameView(o)) {
@@ -733,13 +942,17 @@ __MATX_INLINE__ void ifft_impl(OutputTensor o, const InputTensor i,
   MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == InputTensor::Rank(), matxInvalidDim,
     "Input and output tensor ranks must match");
 
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   const auto stream = exec.getStream();
 
+  if (fft_load_callback_impl(o, i, fft_size, norm, FFTDirection::BACKWARD, exec)) {
+    return;
+  }
+
   // converts operators to tensors
   auto out = getCufft1DSupportedTensor(o, stream);
-  auto in_t = getCufft1DSupportedTensor(i, stream);
+  auto in_t = getCufft1DSupportedTensor(i, stream, &o);
 
   if(!in_t.isSameView(i)) {
    (in_t = i).run(stream);
@@ -751,7 +964,6 @@ __MATX_INLINE__ void ifft_impl(OutputTensor o, const InputTensor i,
 
   // Get parameters required by these tensors
   auto params = detail::matxCUDAFFTPlan_t<decltype(out), decltype(in)>::GetFFTParams(out, in, 1);
-  params.stream = stream;
 
   using cache_val_type = detail::matxCUDAFFTPlan1D_t<decltype(out), decltype(in)>;
   auto cache_id = detail::GetCacheIdFromType<detail::fft_cuda_cache_t>();
@@ -765,7 +977,8 @@ __MATX_INLINE__ void ifft_impl(OutputTensor o, const InputTensor i,
     [&](std::shared_ptr<cache_val_type> ctype) {
       ctype->Inverse(out, in, stream, norm);
     },
-    exec
+    exec,
+    detail::CacheSharing::PER_DEVICE
   );
 
   if(!out.isSameView(o)) {
@@ -781,12 +994,12 @@ __MATX_INLINE__ void fft2_impl(OutputTensor o, const InputTensor i, FFTNorm norm
   MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == InputTensor::Rank(), matxInvalidDim,
     "Input and output tensor ranks must match");
 
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   const auto stream = exec.getStream();
 
   auto out = detail::getCufft2DSupportedTensor(o, stream);
-  auto in = detail::getCufft2DSupportedTensor(i, stream);
+  auto in = detail::getCufft2DSupportedTensor(i, stream, &o);
 
   if(!in.isSameView(i)) {
     (in = i).run(stream);
@@ -794,7 +1007,6 @@ __MATX_INLINE__ void fft2_impl(OutputTensor o, const InputTensor i, FFTNorm norm
 
   // Get parameters required by these tensors
   auto params = detail::matxCUDAFFTPlan_t<decltype(out), decltype(in)>::GetFFTParams(out, in, 2);
-  params.stream = stream;
 
   using cache_val_type = detail::matxCUDAFFTPlan2D_t<decltype(out), decltype(in)>;
   auto cache_id = detail::GetCacheIdFromType<detail::fft_cuda_cache_t>();
@@ -808,7 +1020,8 @@ __MATX_INLINE__ void fft2_impl(OutputTensor o, const InputTensor i, FFTNorm norm
     [&](std::shared_ptr<cache_val_type> ctype) {
       ctype->Forward(out, in, stream, norm);
     },
-    exec
+    exec,
+    detail::CacheSharing::PER_DEVICE
   );
 
   if(!out.isSameView(o)) {
@@ -824,12 +1037,12 @@ __MATX_INLINE__ void ifft2_impl(OutputTensor o, const InputTensor i, FFTNorm nor
   MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == InputTensor::Rank(), matxInvalidDim,
     "Input and output operator ranks must match");
 
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   const auto stream = exec.getStream();
 
   auto out = detail::getCufft2DSupportedTensor(o, stream);
-  auto in = detail::getCufft2DSupportedTensor(i, stream);
+  auto in = detail::getCufft2DSupportedTensor(i, stream, &o);
 
   if(!in.isSameView(i)) {
     (in = i).run(stream);
@@ -837,7 +1050,6 @@ __MATX_INLINE__ void ifft2_impl(OutputTensor o, const InputTensor i, FFTNorm nor
 
     // Get parameters required by these tensors
   auto params = detail::matxCUDAFFTPlan_t<decltype(out), decltype(in)>::GetFFTParams(out, in, 2);
-  params.stream = stream;
 
   // Get cache or new FFT plan if it doesn't exist
   using cache_val_type = detail::matxCUDAFFTPlan2D_t<decltype(out), decltype(in)>;
@@ -852,7 +1064,8 @@ __MATX_INLINE__ void ifft2_impl(OutputTensor o, const InputTensor i, FFTNorm nor
     [&](std::shared_ptr<cache_val_type> ctype) {
       ctype->Inverse(out, in, stream, norm);
     },
-    exec
+    exec,
+    detail::CacheSharing::PER_DEVICE
   );
 
   if(!out.isSameView(o)) {
@@ -0,0 +1,331 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cufft.h>
+#include <cufftXt.h>
+
+#include "matx/core/error.h"
+#include "matx/core/make_tensor.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/operator_options.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/cuda.h"
+#include "matx/transforms/fft/fft_cuda.h"
+#include <cmath>
+#include <vector>
+
+namespace matx {
+
+/**
+ * Multi-GPU 2D/3D FFT plan backed by cufftXt
+ *
+ * The plan owns a cufftXt descriptor that splits the signal into slabs across
+ * the given devices, so a signal that does not fit in a single GPU's memory
+ * can be transformed without being staged through one device. The data stays
+ * resident on the devices between Forward() and Inverse() calls, and the
+ * transposes between the per-slab FFTs are done by cuFFT inside the plan.
+ *
+ * After Forward() the device data is in cuFFT's shuffled slab order; Store()
+ * always writes the natural order, and Inverse() accepts either order.
+ *
+ * @tparam T Complex data type (cuda::std::complex<float> or cuda::std::complex<double>)
+ * @tparam RANK Rank of the transform (2 or 3)
+ */
+template <typename T, int RANK>
+class matxMultiGPUFFTPlan_t {
+  static_assert(RANK == 2 || RANK == 3, "Multi-GPU FFTs support 2D and 3D transforms only");
+  static_assert(std::is_same_v<T, cuda::std::complex<float>> || std::is_same_v<T, cuda::std::complex<double>>,
+                "Multi-GPU FFTs support single and double precision complex types only");
+
+public:
+  /**
+   * Construct a multi-GPU FFT plan and allocate its distributed storage
+   *
+   * @param shape Signal shape, slowest-changing dimension first
+   * @param devices CUDA devices to split the signal across. At least two are required
+   */
+  matxMultiGPUFFTPlan_t(const cuda::std::array<index_t, RANK> &shape, const std::vector<int> &devices) :
+      shape_(shape), devices_(devices)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_ASSERT_STR(devices_.size() >= 2, matxInvalidParameter, "Multi-GPU FFTs need at least two devices");
+
+    constexpr cufftType type = std::is_same_v<T, cuda::std::complex<float>> ? CUFFT_C2C : CUFFT_Z2Z;
+    std::vector<size_t> work_size(devices_.size());
+
+    MATX_CUFFT_ASSERT_STR_EXP(cufftCreate(&plan_), CUFFT_SUCCESS);
+    MATX_CUFFT_ASSERT_STR_EXP(cufftXtSetGPUs(plan_, static_cast<int>(devices_.size()), devices_.data()), CUFFT_SUCCESS);
+    if constexpr (RANK == 2) {
+      MATX_CUFFT_ASSERT_STR_EXP(cufftMakePlan2d(plan_, static_cast<int>(shape_[0]), static_cast<int>(shape_[1]),
+                                                type, work_size.data()), CUFFT_SUCCESS);
+    }
+    else {
+      MATX_CUFFT_ASSERT_STR_EXP(cufftMakePlan3d(plan_, static_cast<int>(shape_[0]), static_cast<int>(shape_[1]),
+                                                static_cast<int>(shape_[2]), type, work_size.data()), CUFFT_SUCCESS);
+    }
+
+    MATX_CUFFT_ASSERT_STR_EXP(cufftXtMalloc(plan_, &desc_, CUFFT_XT_FORMAT_INPLACE), CUFFT_SUCCESS);
+
+    MATX_LOG_DEBUG("Multi-GPU FFT plan: rank={}, devices={}", RANK, devices_.size());
+  }
+
+  matxMultiGPUFFTPlan_t(const matxMultiGPUFFTPlan_t &) = delete;
+  matxMultiGPUFFTPlan_t &operator=(const matxMultiGPUFFTPlan_t &) = delete;
+
+  ~matxMultiGPUFFTPlan_t()
+  {
+    if (desc_ != nullptr) {
+      cufftXtFree(desc_);
+    }
+    cufftDestroy(plan_);
+  }
+
+  /**
+   * Distribute a host-accessible tensor across the devices
+   *
+   * @param in Contiguous tensor with the plan's shape
+   */
+  template <typename InType>
+  void Load(const InType &in)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    CheckTensor(in);
+    MATX_CUFFT_ASSERT_STR_EXP(cufftXtMemcpy(plan_, desc_, const_cast<T *>(in.Data()), CUFFT_COPY_HOST_TO_DEVICE),
+                              CUFFT_SUCCESS);
+    shuffled_ = false;
+  }
+
+  /**
+   * Gather the distributed data into a host-accessible tensor in natural order
+   *
+   * @param out Contiguous tensor with the plan's shape
+   */
+  template <typename OutType>
+  void Store(OutType &out)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    CheckTensor(out);
+    MATX_CUFFT_ASSERT_STR_EXP(cufftXtMemcpy(plan_, out.Data(), desc_, CUFFT_COPY_DEVICE_TO_HOST), CUFFT_SUCCESS);
+  }
+
+  /**
+   * Run the forward transform in place on the distributed data
+   *
+   * @param norm Normalization mode
+   */
+  void Forward(FFTNorm norm = FFTNorm::BACKWARD)
+  {
+    Exec(CUFFT_FORWARD);
+    shuffled_ = true;
+    if (norm != FFTNorm::BACKWARD) {
+      Scale(norm == FFTNorm::ORTHO ? 1.0 / std::sqrt(static_cast<double>(Size())) : 1.0 / static_cast<double>(Size()));
+    }
+  }
+
+  /**
+   * Run the inverse transform in place on the distributed data
+   *
+   * @param norm Normalization mode
+   */
+  void Inverse(FFTNorm norm = FFTNorm::BACKWARD)
+  {
+    Exec(CUFFT_INVERSE);
+    shuffled_ = false;
+    if (norm != FFTNorm::FORWARD) {
+      Scale(norm == FFTNorm::ORTHO ? 1.0 / std::sqrt(static_cast<double>(Size())) : 1.0 / static_cast<double>(Size()));
+    }
+  }
+
+  /**
+   * @return True if the device data is in cuFFT's shuffled slab order
+   */
+  bool IsShuffled() const { return shuffled_; }
+
+  /**
+   * @return Number of devices the data is split across
+   */
+  int NumDevices() const { return static_cast<int>(devices_.size()); }
+
+  /**
+   * @return Total number of elements in the signal
+   */
+  index_t Size() const
+  {
+    index_t n = 1;
+    for (const auto s : shape_) {
+      n *= s;
+    }
+    return n;
+  }
+
+private:
+  template <typename TensorType>
+  void CheckTensor(const TensorType &t) const
+  {
+    static_assert(is_tensor_view_v<TensorType>, "Multi-GPU FFTs can only load and store tensors");
+    static_assert(TensorType::Rank() == RANK, "Tensor rank must match the multi-GPU FFT plan rank");
+    static_assert(std::is_same_v<typename TensorType::value_type, T>, "Tensor type must match the multi-GPU FFT plan type");
+    MATX_ASSERT_STR(t.IsContiguous(), matxInvalidParameter, "Multi-GPU FFT tensors must be contiguous");
+    for (int i = 0; i < RANK; i++) {
+      MATX_ASSERT_STR(t.Size(i) == shape_[i], matxInvalidSize, "Tensor shape must match the multi-GPU FFT plan shape");
+    }
+  }
+
+  void Exec(int direction)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_CUFFT_ASSERT_STR_EXP(cufftXtExecDescriptor(plan_, desc_, desc_, direction), CUFFT_SUCCESS);
+  }
+
+  // Scale each device's slab in place. Element order does not matter for a uniform scale.
+  void Scale([[maybe_unused]] double scale)
+  {
+#ifdef __CUDACC__
+    int prev_dev;
+    MATX_CUDA_CHECK(cudaGetDevice(&prev_dev));
+    for (int i = 0; i < desc_->descriptor->nGPUs; i++) {
+      MATX_CUDA_CHECK(cudaSetDevice(desc_->descriptor->GPUs[i]));
+      MATX_CUDA_CHECK(cudaDeviceSynchronize());
+      auto slab = make_tensor<T>(static_cast<T *>(desc_->descriptor->data[i]),
+                                 {static_cast<index_t>(desc_->descriptor->size[i] / sizeof(T))});
+      (slab = slab * static_cast<typename T::value_type>(scale)).run(cudaExecutor{0});
+    }
+    for (int i = 0; i < desc_->descriptor->nGPUs; i++) {
+      MATX_CUDA_CHECK(cudaSetDevice(desc_->descriptor->GPUs[i]));
+      MATX_CUDA_CHECK(cudaDeviceSynchronize());
+    }
+    MATX_CUDA_CHECK(cudaSetDevice(prev_dev));
+#endif
+  }
+
+  cufftHandle plan_;
+  cudaLibXtDesc *desc_ = nullptr;
+  cuda::std::array<index_t, RANK> shape_;
+  std::vector<int> devices_;
+  bool shuffled_ = false;
+};
+
+namespace detail {
+
+template <bool FORWARD, typename OutputTensor, typename InputTensor>
+void fft_mgpu_impl(OutputTensor &out, const InputTensor &in, const std::vector<int> &devices, FFTNorm norm)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  constexpr int RANK = InputTensor::Rank();
+  static_assert(OutputTensor::Rank() == RANK, "Multi-GPU FFT input and output ranks must match");
+
+  cuda::std::array<index_t, RANK> shape;
+  for (int i = 0; i < RANK; i++) {
+    shape[i] = in.Size(i);
+  }
+
+  matxMultiGPUFFTPlan_t<typename InputTensor::value_type, RANK> plan(shape, devices);
+  plan.Load(in);
+  if constexpr (FORWARD) {
+    plan.Forward(norm);
+  }
+  else {
+    plan.Inverse(norm);
+  }
+  plan.Store(out);
+}
+
+} // end namespace detail
+
+/**
+ * Run a 2D FFT split across several GPUs
+ *
+ * The input and output are host-accessible tensors (host, pinned or managed
+ * memory) that may be larger than a single GPU's memory. Each call builds a
+ * new plan; construct a matxMultiGPUFFTPlan_t directly to reuse the plan and
+ * keep the data on the devices between transforms.
+ *
+ * @param out Output tensor
+ * @param in Input tensor
+ * @param devices CUDA devices to split the transform across
+ * @param norm Normalization mode
+ */
+template <typename OutputTensor, typename InputTensor>
+void fft2_mgpu(OutputTensor &out, const InputTensor &in, const std::vector<int> &devices, FFTNorm norm = FFTNorm::BACKWARD)
+{
+  static_assert(InputTensor::Rank() == 2, "fft2_mgpu() requires rank 2 tensors");
+  detail::fft_mgpu_impl<true>(out, in, devices, norm);
+}
+
+/**
+ * Run a 2D inverse FFT split across several GPUs
+ *
+ * @param out Output tensor
+ * @param in Input tensor
+ * @param devices CUDA devices to split the transform across
+ * @param norm Normalization mode
+ */
+template <typename OutputTensor, typename InputTensor>
+void ifft2_mgpu(OutputTensor &out, const InputTensor &in, const std::vector<int> &devices, FFTNorm norm = FFTNorm::BACKWARD)
+{
+  static_assert(InputTensor::Rank() == 2, "ifft2_mgpu() requires rank 2 tensors");
+  detail::fft_mgpu_impl<false>(out, in, devices, norm);
+}
+
+/**
+ * Run a 3D FFT split across several GPUs
+ *
+ * @param out Output tensor
+ * @param in Input tensor
+ * @param devices CUDA devices to split the transform across
+ * @param norm Normalization mode
+ */
+template <typename OutputTensor, typename InputTensor>
+void fft3_mgpu(OutputTensor &out, const InputTensor &in, const std::vector<int> &devices, FFTNorm norm = FFTNorm::BACKWARD)
+{
+  static_assert(InputTensor::Rank() == 3, "fft3_mgpu() requires rank 3 tensors");
+  detail::fft_mgpu_impl<true>(out, in, devices, norm);
+}
+
+/**
+ * Run a 3D inverse FFT split across several GPUs
+ *
+ * @param out Output tensor
+ * @param in Input tensor
+ * @param devices CUDA devices to split the transform across
+ * @param norm Normalization mode
+ */
+template <typename OutputTensor, typename InputTensor>
+void ifft3_mgpu(OutputTensor &out, const InputTensor &in, const std::vector<int> &devices, FFTNorm norm = FFTNorm::BACKWARD)
+{
+  static_assert(InputTensor::Rank() == 3, "ifft3_mgpu() requires rank 3 tensors");
+  detail::fft_mgpu_impl<false>(out, in, devices, norm);
+}
+
+} // end namespace matx
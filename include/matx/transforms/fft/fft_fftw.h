@@ -50,15 +50,47 @@
 #ifdef MATX_EN_OMP
 #include <omp.h>
 #endif
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <string>
 #include <cuda/atomic>
 
 namespace matx {
 
+/**
+ * Planner used when creating host FFT plans
+ */
+enum class HostFFTPlanner {
+  ESTIMATE, ///< Pick a plan from heuristics without running any transforms (default)
+  MEASURE,  ///< Time a set of candidate plans and keep the fastest
+  PATIENT,  ///< Time a larger set of candidate plans. Slower to plan than MEASURE
+};
+
 namespace detail {
 
+// Host FFT plans are cached per alignment of the input and output, since FFTW requires a cached
+// plan to be executed on arrays with the same SIMD alignment as the ones it was planned on
+static constexpr uintptr_t FFTW_PLAN_ALIGNMENT = 64;
+
+inline cuda::std::atomic<HostFFTPlanner> &HostFFTPlannerSetting() {
+  static cuda::std::atomic<HostFFTPlanner> planner = []() {
+    const char *env = std::getenv("MATX_FFTW_PLANNER");
+    if (env != nullptr && std::strcmp(env, "measure") == 0) {
+      return HostFFTPlanner::MEASURE;
+    }
+    if (env != nullptr && std::strcmp(env, "patient") == 0) {
+      return HostFFTPlanner::PATIENT;
+    }
+    return HostFFTPlanner::ESTIMATE;
+  }();
+  return planner;
+}
+
 /**
  * Parameters needed to execute an FFT/IFFT in FFTW
  */
@@ -76,6 +108,10 @@ struct FftFFTWParams_t {
   bool is_fp32;
   bool in_place;
   detail::FFTDirection dir;
+  int nthreads = 1; // FFTW bakes the thread count into the plan
+  HostFFTPlanner planner = HostFFTPlanner::ESTIMATE;
+  int in_align = 0;
+  int out_align = 0;
 };
 
   template <typename OutTensorType, typename InTensorType>
@@ -83,7 +119,7 @@ struct FftFFTWParams_t {
                           const InTensorType &i, int fft_rank,
                           detail::FFTDirection dir)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     FftFFTWParams_t params;
     constexpr auto RANK = OutTensorType::Rank();
     using T1    = typename OutTensorType::value_type;
@@ -149,6 +185,9 @@ struct FftFFTWParams_t {
     }
 
     params.is_fp32 = is_fp32_inner_type_v<typename OutTensorType::value_type>;
+    params.planner = HostFFTPlannerSetting().load();
+    params.in_align = static_cast<int>(reinterpret_cast<uintptr_t>(i.Data()) % FFTW_PLAN_ALIGNMENT);
+    params.out_align = static_cast<int>(reinterpret_cast<uintptr_t>(o.Data()) % FFTW_PLAN_ALIGNMENT);
     if constexpr (std::is_same_v<typename OutTensorType::value_type,
                                 typename InTensorType::value_type>) {
       params.in_place = o.Data() == i.Data();
@@ -227,7 +266,9 @@ struct FftFFTWParamsKeyHash {
            (std::hash<uint64_t>()(k.fft_rank)) +
            (std::hash<uint64_t>()(k.batch)) + (std::hash<uint64_t>()(k.istride)) +
            (std::hash<uint64_t>()(static_cast<uint64_t>(k.dir))) +
-           (std::hash<uint64_t>()(static_cast<uint64_t>(k.is_fp32)));
+           (std::hash<uint64_t>()(static_cast<uint64_t>(k.is_fp32))) +
+           (std::hash<uint64_t>()(static_cast<uint64_t>(k.nthreads))) +
+           (std::hash<uint64_t>()(static_cast<uint64_t>(k.planner)));
   }
 };
 
@@ -245,7 +286,9 @@ struct FftFFTWParamsKeyEq {
            l.istride == t.istride && l.ostride == t.ostride &&
            l.idist == t.idist && l.odist == t.odist &&
            l.transform_type == t.transform_type &&
-           l.irank == t.irank && l.orank == t.orank ;
+           l.irank == t.irank && l.orank == t.orank &&
+           l.nthreads == t.nthreads && l.planner == t.planner &&
+           l.in_align == t.in_align && l.out_align == t.out_align;
   }
 };
 
@@ -264,6 +307,9 @@ public:
       [[maybe_unused]] int ret = fftwf_init_threads();
       MATX_ASSERT_STR(ret != 0, matxAssertError, "fftwf_init_threads() failed");
       init_fp32_ = true;
+      if (!WisdomFile().empty()) {
+        ImportWisdomF(WisdomFile());
+      }
     }
   }
 
@@ -272,6 +318,9 @@ public:
       [[maybe_unused]] int ret = fftw_init_threads();
       MATX_ASSERT_STR(ret != 0, matxAssertError, "fftw_init_threads() failed");
       init_fp64_ = true;
+      if (!WisdomFile().empty()) {
+        ImportWisdomD(WisdomFile());
+      }
     }
   }
 
@@ -280,6 +329,10 @@ public:
   static void DecrementPlanCount() {
     active_plans_--;
     if (active_plans_ == 0) {
+      // Cleaning up forgets all accumulated wisdom, so save it first
+      if (!WisdomFile().empty()) {
+        ExportWisdom(WisdomFile());
+      }
       if (init_fp32_) {
           fftwf_cleanup_threads();
           fftwf_cleanup();
@@ -293,7 +346,56 @@ public:
     }
   }
 
+  static bool ImportWisdom(const std::string &path) {
+    InitFFTWF();
+    InitFFTW();
+    const bool f32 = ImportWisdomF(path);
+    const bool f64 = ImportWisdomD(path);
+    return f32 || f64;
+  }
+
+  // Only precisions that are initialized hold any wisdom. Exporting the others would overwrite
+  // their files with empty wisdom.
+  static bool ExportWisdom([[maybe_unused]] const std::string &path) {
+    bool ok = init_fp32_ || init_fp64_;
+#ifdef MATX_EN_X86_FFTW
+    if (init_fp32_) {
+      ok = fftwf_export_wisdom_to_filename((path + ".f32").c_str()) != 0 && ok;
+    }
+    if (init_fp64_) {
+      ok = fftw_export_wisdom_to_filename((path + ".f64").c_str()) != 0 && ok;
+    }
+#else
+    ok = false;
+#endif
+    return ok;
+  }
+
+  static std::string &WisdomFile() {
+    static std::string path = []() {
+      const char *env = std::getenv("MATX_FFTW_WISDOM");
+      return env != nullptr ? std::string{env} : std::string{};
+    }();
+    return path;
+  }
+
 private:
+  static bool ImportWisdomF([[maybe_unused]] const std::string &path) {
+#ifdef MATX_EN_X86_FFTW
+    return fftwf_import_wisdom_from_filename((path + ".f32").c_str()) != 0;
+#else
+    return false;
+#endif
+  }
+
+  static bool ImportWisdomD([[maybe_unused]] const std::string &path) {
+#ifdef MATX_EN_X86_FFTW
+    return fftw_import_wisdom_from_filename((path + ".f64").c_str()) != 0;
+#else
+    return false;
+#endif
+  }
+
   static inline cuda::std::atomic<int> active_plans_ = 0;
   static inline cuda::std::atomic<bool> init_fp32_ = false;
   static inline cuda::std::atomic<bool> init_fp64_ = false;
@@ -323,6 +425,28 @@ public:
     auto fft_dir = (params_.dir == detail::FFTDirection::FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
     auto in_ptr = i.Data();
     auto out_ptr = o.Data();
+    unsigned flags = FFTW_ESTIMATE;
+    void *scratch = nullptr;
+
+    // Measuring planners run transforms on the arrays they are given, which would overwrite the
+    // caller's input. Plan on scratch arrays with the same alignment and layout instead.
+    if (params_.planner != HostFFTPlanner::ESTIMATE) {
+      flags = (params_.planner == HostFFTPlanner::MEASURE) ? FFTW_MEASURE : FFTW_PATIENT;
+
+      const size_t in_bytes = ViewExtent(i) * sizeof(typename InTensorType::value_type);
+      const size_t out_bytes = ViewExtent(o) * sizeof(out_value_type);
+      const bool same_ptr = static_cast<const void *>(in_ptr) == static_cast<const void *>(out_ptr);
+      const size_t in_span = RoundUp(static_cast<size_t>(params_.in_align) + in_bytes);
+      const size_t total = same_ptr ? RoundUp(static_cast<size_t>(params_.in_align) + cuda::std::max(in_bytes, out_bytes))
+                                    : in_span + RoundUp(static_cast<size_t>(params_.out_align) + out_bytes);
+      scratch = std::aligned_alloc(FFTW_PLAN_ALIGNMENT, total);
+      MATX_ASSERT_STR(scratch != nullptr, matxOutOfMemory, "Failed to allocate FFTW planning scratch");
+
+      auto base = static_cast<uint8_t *>(scratch);
+      in_ptr = reinterpret_cast<decltype(in_ptr)>(base + params_.in_align);
+      out_ptr = reinterpret_cast<decltype(out_ptr)>(same_ptr ? base + params_.in_align
+                                                             : base + in_span + params_.out_align);
+    }
 
     if constexpr (is_fp32_) {
       FFTWPlanManager::InitFFTWF();
@@ -340,7 +464,7 @@ public:
                                     params_.ostride,
                                     params_.odist,
                                     fft_dir,
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
       else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::C2R) {
         plan_  = fftwf_plan_many_dft_c2r( params_.fft_rank,
@@ -354,7 +478,7 @@ public:
                                     params_.onembed,
                                     params_.ostride,
                                     params_.odist,
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
       else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::R2C) {
         plan_  = fftwf_plan_many_dft_r2c( params_.fft_rank,
@@ -368,7 +492,7 @@ public:
                                     params_.onembed,
                                     params_.ostride,
                                     params_.odist,
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
     }
     else {
@@ -389,7 +513,7 @@ public:
                                     params_.ostride,
                                     params_.odist,
                                     fft_dir,
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
       else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::C2R && 
                          std::is_same_v<typename InTensorType::value_type, cuda::std::complex<double>> &&
@@ -405,7 +529,7 @@ public:
                                     params_.onembed,
                                     params_.ostride,
                                     params_.odist,
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
       else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::R2C && 
                          std::is_same_v<typename InTensorType::value_type, double> &&
@@ -421,9 +545,10 @@ public:
                                     params_.onembed,
                                     params_.ostride,
                                     params_.odist,
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
     }
+    std::free(scratch);
     MATX_ASSERT_STR(plan_ != nullptr, matxAssertError, "fftw plan creation failed");
 
     FFTWPlanManager::IncrementPlanCount();
@@ -498,15 +623,34 @@ public:
 private:
   static constexpr bool is_fp32_ = is_fp32_inner_type_v<out_value_type>;
 
+  // Number of elements between the first and last element of a view, inclusive
+  template <typename Op>
+  static size_t ViewExtent(const Op &op) {
+    size_t extent = 1;
+    for (int r = 0; r < Op::Rank(); r++) {
+      extent += static_cast<size_t>(op.Size(r) - 1) * static_cast<size_t>(op.Stride(r));
+    }
+    return extent;
+  }
+
+  static size_t RoundUp(size_t bytes) {
+    return (bytes + FFTW_PLAN_ALIGNMENT - 1) / FFTW_PLAN_ALIGNMENT * FFTW_PLAN_ALIGNMENT;
+  }
+
   FftFFTWParams_t params_;
   plan_type plan_;
 };
 #endif
 
-  template <typename Op>
-  __MATX_INLINE__ auto getFFTW1DSupportedTensor(const Op &in) {
+  // When alias_out is given, an input that overlaps it without being the same view is copied first
+  template <typename Op, typename AliasOp = Op>
+  __MATX_INLINE__ auto getFFTW1DSupportedTensor(const Op &in, const AliasOp *alias_out = nullptr) {
     // This would be better as a templated lambda, but we don't have those in C++17 yet
     const auto support_func = [&]() {
+      if (alias_out != nullptr && GetAliasKind(*alias_out, in) == AliasKind::PARTIAL) {
+        return false;
+      }
+
       if constexpr (is_tensor_view_v<Op>) {
         if constexpr (Op::Rank() >= 2) {
           if (in.Stride(Op::Rank() - 2) != in.Stride(Op::Rank() - 1) * in.Size(Op::Rank() - 1)) {
@@ -530,10 +674,14 @@ private:
   }
 
 
-  template <typename Op>
-  __MATX_INLINE__ auto getFFTW2DSupportedTensor( const Op &in) {
+  template <typename Op, typename AliasOp = Op>
+  __MATX_INLINE__ auto getFFTW2DSupportedTensor(const Op &in, const AliasOp *alias_out = nullptr) {
     // This would be better as a templated lambda, but we don't have those in C++17 yet
     const auto support_func = [&]() {
+      if (alias_out != nullptr && GetAliasKind(*alias_out, in) == AliasKind::PARTIAL) {
+        return false;
+      }
+
       if constexpr (is_tensor_view_v<Op>) {
         if ( in.Stride(Op::Rank()-2) != in.Stride(Op::Rank()-1) * in.Size(Op::Rank()-1)) {
           return false;
@@ -583,13 +731,13 @@ private:
     MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == InputTensor::Rank(), matxInvalidDim,
       "Input and output tensor ranks must match");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(TotalSize(i) < std::numeric_limits<int>::max(), matxInvalidSize, "Dimensions too large for host FFT currently");
 
     // converts operators to tensors
     auto out = getFFTW1DSupportedTensor(o);
-    auto in_t = getFFTW1DSupportedTensor(i);
+    auto in_t = getFFTW1DSupportedTensor(i, &o);
 
     if(!in_t.isSameView(i)) {
       (in_t = i).run(exec);
@@ -599,6 +747,7 @@ private:
 
     // Get parameters required by these tensors
     auto params = GetFFTParams(out, in, 1, dir);
+    params.nthreads = exec.GetNumThreads();
 
     fft_exec(out, in, params, dir, exec);
 
@@ -639,11 +788,11 @@ private:
       "Input and output tensor ranks must match");
     MATX_ASSERT_STR(TotalSize(i) < std::numeric_limits<int>::max(), matxInvalidSize, "Dimensions too large for host FFT currently");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // converts operators to tensors
     auto out = getFFTW2DSupportedTensor(o);
-    auto in = getFFTW2DSupportedTensor(i);
+    auto in = getFFTW2DSupportedTensor(i, &o);
 
     if(!in.isSameView(i)) {
       (in = i).run(exec);
@@ -651,6 +800,7 @@ private:
 
     // Get parameters required by these tensors
     auto params = GetFFTParams(out, in, 2, dir);
+    params.nthreads = exec.GetNumThreads();
 
     fft_exec(out, in, params, dir, exec);
 
@@ -693,7 +843,7 @@ private:
                             is_fp64_inner_type_v<typename InputTensor::value_type>), matxInvalidType,
                             "Host FFTs only support single or double precision floats");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(MATX_EN_CPU_FFT, matxInvalidExecutor, "Trying to run a host FFT executor but host FFT support is not configured");
 
@@ -711,7 +861,7 @@ private:
                             is_fp64_inner_type_v<typename InputTensor::value_type>), matxInvalidType,
                             "Host FFTs only support single or double precision floats");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(MATX_EN_CPU_FFT, matxInvalidExecutor, "Trying to run a host FFT executor but host FFT support is not configured");
 
@@ -731,7 +881,7 @@ private:
                             is_fp64_inner_type_v<typename InputTensor::value_type>), matxInvalidType,
                             "Host FFTs only support single or double precision floats");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(MATX_EN_CPU_FFT, matxInvalidExecutor, "Trying to run a host FFT executor but host FFT support is not configured");
 
@@ -749,7 +899,7 @@ private:
                             is_fp64_inner_type_v<typename InputTensor::value_type>), matxInvalidType,
                             "Host FFTs only support single or double precision floats");
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     MATX_ASSERT_STR(MATX_EN_CPU_FFT, matxInvalidExecutor, "Trying to run a host FFT executor but host FFT support is not configured");
 
@@ -758,6 +908,71 @@ private:
 
 } // end namespace detail
 
+/**
+ * Set the planner used for host FFT plans created after this call
+ *
+ * Measured plans take much longer to create than estimated ones but usually run faster. Plans are
+ * cached per planner, so changing the planner does not affect plans that were already created. The
+ * planner can also be chosen by setting the environment variable MATX_FFTW_PLANNER to "estimate",
+ * "measure", or "patient". Measuring planners never touch the caller's data.
+ *
+ * @param planner Planner to use
+ */
+__MATX_INLINE__ void SetHostFFTPlanner(HostFFTPlanner planner) {
+  detail::HostFFTPlannerSetting().store(planner);
+}
+
+/**
+ * Persist FFTW wisdom in a file across runs
+ *
+ * Wisdom is imported from the file now and exported back to it when the last host FFT plan is
+ * destroyed, such as by ClearCaches() or at process exit. With wisdom available, creating a
+ * measured plan for a shape that was measured in an earlier run is as fast as creating an
+ * estimated one. Single and double precision wisdom are kept in path.f32 and path.f64. The file can
+ * also be set with the environment variable MATX_FFTW_WISDOM. Wisdom files are only supported with
+ * x86 FFTW.
+ *
+ * @param path Path prefix of the wisdom files. An empty path stops persisting wisdom.
+ * @returns True if wisdom for either precision was imported
+ */
+__MATX_INLINE__ bool SetHostFFTWisdomFile([[maybe_unused]] const std::string &path) {
+#if MATX_EN_CPU_FFT
+  detail::FFTWPlanManager::WisdomFile() = path;
+  return !path.empty() && detail::FFTWPlanManager::ImportWisdom(path);
+#else
+  return false;
+#endif
+}
+
+/**
+ * Import FFTW wisdom from a file
+ *
+ * @param path Path prefix of the wisdom files, as used by SetHostFFTWisdomFile
+ * @returns True if wisdom for either precision was imported
+ */
+__MATX_INLINE__ bool ImportHostFFTWisdom([[maybe_unused]] const std::string &path) {
+#if MATX_EN_CPU_FFT
+  return detail::FFTWPlanManager::ImportWisdom(path);
+#else
+  return false;
+#endif
+}
 
+/**
+ * Export the current FFTW wisdom to a file
+ *
+ * Only precisions that have live plans or imported wisdom are written, so this must be called
+ * before the plans are destroyed.
+ *
+ * @param path Path prefix of the wisdom files, as used by SetHostFFTWisdomFile
+ * @returns True if wisdom was written for every precision that had any
+ */
+__MATX_INLINE__ bool ExportHostFFTWisdom([[maybe_unused]] const std::string &path) {
+#if MATX_EN_CPU_FFT
+  return detail::FFTWPlanManager::ExportWisdom(path);
+#else
+  return false;
+#endif
+}
 
 }; // end namespace matx
\ No newline at end of file
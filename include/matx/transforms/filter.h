@@ -58,7 +58,7 @@ public:
                const filter_tensor &h_nonrec)
       : h_nonr_copy(h_nonrec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // o may be unused. We use the (void) idiom rather than [[maybe_unused]] due to
     // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=81429
@@ -96,6 +96,12 @@ public:
       static_assert(RANK == 4);
     }
 
+    // Every chunk of every batch gets its own status flag and carries for the
+    // decoupled look-back, including a partial chunk at the end of the signal
+    num_chunks = (sig_len + RECURSIVE_CHUNK_SIZE - 1) / RECURSIVE_CHUNK_SIZE;
+    MATX_ASSERT_STR(batches <= static_cast<index_t>(MAX_BATCHES), matxInvalidSize,
+      "Recursive filter supports at most MAX_BATCHES batches");
+
     Alloc(h_nonrec, h_rec);
   }
 
@@ -118,14 +124,12 @@ public:
                 sizeof(FilterType) * num_recursive * CORR_COLS,
                 MATX_DEVICE_MEMORY);
       matxAlloc((void **)&d_status,
-                sizeof(int) * (sig_len / RECURSIVE_CHUNK_SIZE + 1) * batches);
+                sizeof(int) * num_chunks * batches, MATX_DEVICE_MEMORY);
       matxAlloc((void **)&d_full_carries,
-                sizeof(*d_full_carries) * num_recursive *
-                    (sig_len / RECURSIVE_CHUNK_SIZE) * batches,
+                sizeof(*d_full_carries) * num_recursive * num_chunks * batches,
                 MATX_DEVICE_MEMORY);
       matxAlloc((void **)&d_part_carries,
-                sizeof(*d_part_carries) * num_recursive *
-                    (sig_len / RECURSIVE_CHUNK_SIZE) * batches,
+                sizeof(*d_part_carries) * num_recursive * num_chunks * batches,
                 MATX_DEVICE_MEMORY);
       matxAlloc((void **)&d_last_carries,
                 sizeof(*d_last_carries) * num_recursive, MATX_DEVICE_MEMORY);
@@ -160,15 +164,15 @@ public:
 #ifndef __CUDACC__
     MATX_THROW(matxNotSupported, "convolution not supported on host");
 #else
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (num_recursive > 0) {
-      auto grid =
-          dim3(static_cast<int>(
-                   (sig_len +
-                    (BLOCK_SIZE_RECURSIVE * RECURSIVE_VALS_PER_THREAD - 1)) /
-                   BLOCK_SIZE_RECURSIVE / RECURSIVE_VALS_PER_THREAD),
-               static_cast<int>(batches));
+      // The look-back spins on the status flags of preceding chunks, so they
+      // must be cleared on the launch stream before every run. Flags left over
+      // from a previous run would make a chunk pick up stale carries.
+      ClearStatus(exec.getStream());
+
+      auto grid = dim3(static_cast<int>(num_chunks), static_cast<int>(batches));
       // Fix this to support different R/N types later
       RecursiveFilter<num_recursive, num_non_recursive,
                       OutType, InType, FilterType>
@@ -186,28 +190,30 @@ public:
   }
 
 private:
+  void ClearStatus(cudaStream_t stream)
+  {
+    MATX_CUDA_CHECK(cudaMemsetAsync((void *)d_status, 0,
+                                    sizeof(int) * num_chunks * batches, stream));
+  }
+
   void ClearState()
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (num_recursive > 0) {
-      MATX_CUDA_CHECK(cudaMemset(
-          (void *)d_status, 0,
-          sizeof(int) * (sig_len / RECURSIVE_CHUNK_SIZE + 1) * batches));
+      ClearStatus(0);
       MATX_CUDA_CHECK(cudaMemset(d_full_carries, 0,
                                  sizeof(*d_full_carries) * num_recursive *
-                                     (sig_len / RECURSIVE_CHUNK_SIZE) *
-                                     batches));
+                                     num_chunks * batches));
       MATX_CUDA_CHECK(cudaMemset(d_part_carries, 0,
                                  sizeof(*d_part_carries) * num_recursive *
-                                     (sig_len / RECURSIVE_CHUNK_SIZE) *
-                                     batches));
+                                     num_chunks * batches));
     }
   }
 
   void ComputeCorrectionFactors(const FilterType *coeffs)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     FilterType *out = reinterpret_cast<FilterType *>(
         malloc(sizeof(FilterType) * num_recursive * CORR_COLS));
     FilterType *last = reinterpret_cast<FilterType *>(
@@ -291,6 +297,7 @@ private:
   FilterType *d_last_carries = nullptr;
   index_t batches;
   index_t sig_len;
+  index_t num_chunks;
 };
 
 /**
@@ -301,6 +308,8 @@ struct FilterParams_t {
   std::vector<std::any> nonrec;
   MatXDataType_t dtype; // Input type
   MatXDataType_t ftype; // Filter type
+  index_t sig_len;      // Length of each signal
+  index_t batches;      // Number of signals
   size_t hash;
 };
 
@@ -324,22 +333,13 @@ struct FilterParamsKeyEq {
   bool operator()(const FilterParams_t &l, const FilterParams_t &t) const
       noexcept
   {
-    if (l.dtype == t.dtype && l.ftype == t.ftype &&
-        l.rec.size() == t.rec.size() && l.nonrec.size() == t.nonrec.size()) {
-      // // Now check the coefficients match
-      // for (size_t i = 0; i < l.rec.size(); i++) {
-      //   if (MatXAnyCmp(l.rec[i], t.rec[i], l.ftype) == false) {
-      //     return false;
-      //   }
-      // }
-      // for (size_t i = 0; i < l.nonrec.size(); i++) {
-      //   if (MatXAnyCmp(l.nonrec[i], t.nonrec[i], l.ftype) == false) {
-      //     return false;
-      //   }
-      // }
-    }
-
-    return true;
+    // The plan owns the correction factors and the per-chunk look-back
+    // buffers, so it can only be reused for the same coefficients and the same
+    // signal shape. The coefficients are compared through their hash.
+    return l.dtype == t.dtype && l.ftype == t.ftype &&
+           l.rec.size() == t.rec.size() && l.nonrec.size() == t.nonrec.size() &&
+           l.sig_len == t.sig_len && l.batches == t.batches &&
+           l.hash == t.hash;
   }
 };
 
@@ -392,7 +392,7 @@ auto matxMakeFilter(OutType &o, const InType &i,
                            const cuda::std::array<FilterType, NR> &h_rec,
                            const cuda::std::array<FilterType, NNR> &h_nonrec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   auto rec_v = make_tensor<FilterType>({static_cast<index_t>(h_rec.size())});
   auto nonrec_v = make_tensor<FilterType>({static_cast<index_t>(h_nonrec.size())});
@@ -458,7 +458,7 @@ void filter_impl([[maybe_unused]] OutType &o, [[maybe_unused]] const InType &i,
             [[maybe_unused]] const cuda::std::array<FilterType, NR> h_rec,
             [[maybe_unused]] const cuda::std::array<FilterType, NNR> h_nonrec, [[maybe_unused]] const cudaExecutor &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   // Get parameters required by these tensors
   auto params = detail::FilterParams_t();
@@ -474,6 +474,11 @@ void filter_impl([[maybe_unused]] OutType &o, [[maybe_unused]] const InType &i,
 
   params.dtype = detail::TypeToInt<typename InType::value_type>();
   params.ftype = detail::TypeToInt<FilterType>(); // Update when we support different types
+  params.sig_len = i.Size(InType::Rank() - 1);
+  params.batches = 1;
+  for (int r = 0; r < InType::Rank() - 1; r++) {
+    params.batches *= i.Size(r);
+  }
   params.hash = rhash + nrhash;
 
   using cache_val_type = detail::matxFilter_t<NR, NNR, OutType, InType, FilterType>;
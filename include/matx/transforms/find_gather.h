@@ -0,0 +1,331 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "matx/core/allocator.h"
+#include "matx/core/error.h"
+#include "matx/core/iterator.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/cuda.h"
+#include "matx/executors/host.h"
+#ifdef __CUDACC__
+#include <cub/cub.cuh>
+#endif
+
+namespace matx {
+
+namespace detail {
+
+template <typename Op>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ decltype(auto) find_gather_load(const Op &op, index_t idx)
+{
+  if constexpr (Op::Rank() == 0) {
+    return op.operator()();
+  }
+  else {
+    auto arrs = GetIdxFromAbs(op, idx);
+    return cuda::std::apply([&](auto &&...args) { return op.operator()(args...); }, arrs);
+  }
+}
+
+/**
+ * @brief Selection predicate on a linear index
+ *
+ * Index-based select functors are called with the index directly, and all other
+ * functors are called with the value of the input at that index.
+ */
+template <typename InputOp, typename SelectType>
+struct FindGatherSelectOp
+{
+  __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool operator()(index_t idx) const
+  {
+    if constexpr (has_index_cmp_op_v<SelectType>) {
+      return sel(idx);
+    }
+    else {
+      return sel(find_gather_load(in, idx));
+    }
+  }
+
+  InputOp in;
+  SelectType sel;
+};
+
+/**
+ * @brief Output iterator that scatters every selected index to several outputs
+ *
+ * Assigning a linear index to element k writes the index itself to the index
+ * output, and the value of each gathered operator at that index to the matching
+ * value output. This lets a single stream compaction fill all outputs at once
+ * instead of compacting the indices and gathering each operator afterwards.
+ *
+ * @tparam IdxOut Index output type
+ * @tparam OutTuple Tuple of value output types
+ * @tparam InTuple Tuple of gathered operator types, one per value output
+ */
+template <typename IdxOut, typename OutTuple, typename InTuple>
+struct FindGatherOutputIterator {
+  using self_type = FindGatherOutputIterator<IdxOut, OutTuple, InTuple>;
+  using value_type = index_t;
+  using pointer = void;
+  using iterator_category = cuda::std::random_access_iterator_tag;
+  using difference_type = index_t;
+
+  struct Proxy {
+    __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ const Proxy &operator=(index_t idx) const
+    {
+      it_.idx_out_(k_) = static_cast<typename IdxOut::value_type>(idx);
+      it_.Scatter(k_, idx, cuda::std::make_index_sequence<cuda::std::tuple_size_v<OutTuple>>{});
+      return *this;
+    }
+
+    const self_type &it_;
+    index_t k_;
+  };
+
+  using reference = Proxy;
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ FindGatherOutputIterator(const IdxOut &idx_out, const OutTuple &outs,
+                                                                         const InTuple &ins, index_t offset = 0) :
+      idx_out_(idx_out), outs_(outs), ins_(ins), offset_(offset) {}
+
+  template <size_t... I>
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void Scatter(index_t k, index_t idx, cuda::std::index_sequence<I...>) const
+  {
+    ((cuda::std::get<I>(outs_)(k) =
+        static_cast<typename remove_cvref_t<cuda::std::tuple_element_t<I, OutTuple>>::value_type>(
+          find_gather_load(cuda::std::get<I>(ins_), idx))), ...);
+  }
+
+  [[nodiscard]] __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ reference operator*() const
+  {
+    return Proxy{*this, offset_};
+  }
+
+  [[nodiscard]] __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ reference operator[](difference_type offset) const
+  {
+    return Proxy{*this, offset_ + offset};
+  }
+
+  [[nodiscard]] __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ self_type operator+(difference_type offset) const
+  {
+    return self_type{idx_out_, outs_, ins_, offset_ + offset};
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ self_type& operator+=(difference_type offset)
+  {
+    offset_ += offset;
+    return *this;
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ self_type& operator++()
+  {
+    offset_++;
+    return *this;
+  }
+
+  __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ self_type operator++(int)
+  {
+    self_type retval = *this;
+    offset_++;
+    return retval;
+  }
+
+  mutable IdxOut idx_out_;
+  mutable OutTuple outs_;
+  InTuple ins_;
+  index_t offset_;
+};
+
+template <typename IdxTensor, typename CountTensor, typename InputOperator, typename OutTuple, typename InTuple>
+__MATX_INLINE__ void find_gather_check(const IdxTensor &idx_out, const CountTensor &, const InputOperator &a,
+                                       const OutTuple &outs, const InTuple &ins)
+{
+  static_assert(CountTensor::Rank() == 0, "Num found output tensor rank must be 0");
+  static_assert(IdxTensor::Rank() == 1, "find_gather() index output must be rank 1");
+  static_assert(cuda::std::tuple_size_v<OutTuple> == cuda::std::tuple_size_v<InTuple>,
+    "find_gather() needs one value output per gathered operator");
+
+  const index_t cap = idx_out.Size(0);
+  cuda::std::apply([&](const auto &...out) {
+    static_assert((... && (remove_cvref_t<decltype(out)>::Rank() == 1)), "find_gather() value outputs must be rank 1");
+    [[maybe_unused]] const bool sizes_match = (... && (out.Size(0) == cap));
+    MATX_ASSERT_STR(sizes_match, matxInvalidSize,
+      "find_gather() value outputs must be the same size as the index output");
+  }, outs);
+  cuda::std::apply([&](const auto &...in) {
+    [[maybe_unused]] const bool sizes_match = (... && (TotalSize(in) == TotalSize(a)));
+    MATX_ASSERT_STR(sizes_match, matxInvalidSize,
+      "find_gather() operators must have the same size as the input");
+  }, ins);
+}
+
+template <typename IdxTensor, typename OutTuple, typename InTuple>
+__MATX_INLINE__ auto make_find_gather_iterator(IdxTensor &idx_out, const OutTuple &outs, const InTuple &ins)
+{
+  auto outs_base = cuda::std::apply([](const auto &...out) {
+    return cuda::std::make_tuple(base_type_t<remove_cvref_t<decltype(out)>>{out}...);
+  }, outs);
+  auto ins_base = cuda::std::apply([](const auto &...in) {
+    return cuda::std::make_tuple(base_type_t<remove_cvref_t<decltype(in)>>{in}...);
+  }, ins);
+
+  return FindGatherOutputIterator<base_type_t<IdxTensor>, decltype(outs_base), decltype(ins_base)>{
+      base_type_t<IdxTensor>{idx_out}, outs_base, ins_base};
+}
+
+} // end namespace detail
+
+/**
+ * Compact several operators with a single selection pass
+ *
+ * Finds all indices of the input meeting the criteria of the select functor, and
+ * writes out the index together with the value of every operator in ins at that
+ * index. The first operator in ins is typically the input itself. All outputs are
+ * filled by one stream compaction over the input, so a mask shared by several
+ * operators is only evaluated once. Outputs must be large enough to hold every
+ * selected entry.
+ *
+ * @tparam IdxTensor
+ *   Index output type
+ * @tparam CountTensor
+ *   Output items type
+ * @tparam InputOperator
+ *   Input type
+ * @tparam SelectType
+ *   Type of select functor
+ * @tparam OutTuple
+ *   Tuple of value output types
+ * @tparam InTuple
+ *   Tuple of gathered operator types
+ * @param idx_out
+ *   Indices of the selected entries
+ * @param num_found
+ *   Number of items found meeting criteria
+ * @param outs
+ *   Value outputs, one per gathered operator
+ * @param a
+ *   Input the select functor is applied to
+ * @param sel
+ *   Select functor
+ * @param ins
+ *   Operators gathered at each selected index
+ * @param exec
+ *   CUDA executor
+ */
+template <typename IdxTensor, typename CountTensor, typename InputOperator, typename SelectType,
+          typename OutTuple, typename InTuple>
+void find_gather_impl(IdxTensor &idx_out, CountTensor &num_found, const OutTuple &outs,
+                      const InputOperator &a, SelectType sel, const InTuple &ins,
+                      [[maybe_unused]] const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  detail::find_gather_check(idx_out, num_found, a, outs, ins);
+
+  cudaStream_t stream = exec.getStream();
+  const index_t n = TotalSize(a);
+  if (n == 0) {
+    MATX_CUDA_CHECK(cudaMemsetAsync(num_found.Data(), 0, sizeof(typename CountTensor::value_type), stream));
+    return;
+  }
+
+  auto out_it = detail::make_find_gather_iterator(idx_out, outs, ins);
+  auto pred = detail::FindGatherSelectOp<detail::base_type_t<InputOperator>, SelectType>{a, sel};
+
+  size_t temp_storage_bytes = 0;
+  cub::DeviceSelect::If(nullptr, temp_storage_bytes, detail::counting_iterator<index_t>(0), out_it,
+                        num_found.Data(), static_cast<int>(n), pred, stream);
+  void *d_temp = nullptr;
+  matxAlloc(&d_temp, temp_storage_bytes, MATX_ASYNC_DEVICE_MEMORY, stream);
+  cub::DeviceSelect::If(d_temp, temp_storage_bytes, detail::counting_iterator<index_t>(0), out_it,
+                        num_found.Data(), static_cast<int>(n), pred, stream);
+  matxFree(d_temp, stream);
+#endif
+}
+
+/**
+ * Compact several operators with a single selection pass
+ *
+ * @tparam IdxTensor
+ *   Index output type
+ * @tparam CountTensor
+ *   Output items type
+ * @tparam InputOperator
+ *   Input type
+ * @tparam SelectType
+ *   Type of select functor
+ * @tparam OutTuple
+ *   Tuple of value output types
+ * @tparam InTuple
+ *   Tuple of gathered operator types
+ * @param idx_out
+ *   Indices of the selected entries
+ * @param num_found
+ *   Number of items found meeting criteria
+ * @param outs
+ *   Value outputs, one per gathered operator
+ * @param a
+ *   Input the select functor is applied to
+ * @param sel
+ *   Select functor
+ * @param ins
+ *   Operators gathered at each selected index
+ * @param exec
+ *   Host executor
+ */
+template <typename IdxTensor, typename CountTensor, typename InputOperator, typename SelectType,
+          typename OutTuple, typename InTuple, ThreadsMode MODE>
+void find_gather_impl(IdxTensor &idx_out, CountTensor &num_found, const OutTuple &outs,
+                      const InputOperator &a, SelectType sel, const InTuple &ins,
+                      [[maybe_unused]] const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  detail::find_gather_check(idx_out, num_found, a, outs, ins);
+
+  auto out_it = detail::make_find_gather_iterator(idx_out, outs, ins);
+  auto pred = detail::FindGatherSelectOp<detail::base_type_t<InputOperator>, SelectType>{a, sel};
+
+  const index_t n = TotalSize(a);
+  index_t cnt = 0;
+  for (index_t i = 0; i < n; i++) {
+    if (pred(i)) {
+      out_it[cnt++] = i;
+    }
+  }
+
+  num_found() = static_cast<typename CountTensor::value_type>(cnt);
+}
+
+} // end namespace matx
@@ -32,16 +32,29 @@
 
 #pragma once
 
-#include <cuda/std/__algorithm/copy_if.h>
+#include <vector>
 
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/operators/permute.h"
 #include "matx/executors/cuda.h"
 #include "matx/executors/host.h"
-#include "matx/transforms/cccl_iterators.h"
+#include "matx/kernels/find_peaks.cuh"
 
 namespace matx {
+
+/**
+ * @brief Parameters of a peak search
+ */
+struct FindPeaksParams {
+  double height{-cuda::std::numeric_limits<double>::infinity()}; //!< Minimum height of a peak
+  double threshold{0.0}; //!< Minimum vertical distance of a peak above both of its neighbours
+  index_t distance{1}; //!< Minimum distance in samples between peaks. Lower peaks closer than this to a higher one are removed
+  double prominence{0.0}; //!< Minimum prominence of a peak. Zero disables the test
+  index_t wlen{0}; //!< Window in samples centred on each peak for the prominence search. Zero searches the whole row
+  double rel_height{0.5}; //!< Height relative to the prominence at which peak widths are measured
+};
+
 namespace detail {
 template <typename Op>
 struct PeakSearchCmpOp {
@@ -80,63 +93,199 @@ struct PeakSearchCmpOp {
   }
 };
 
+
+template <typename Eval>
+struct FindPeaksMaskOp {
+  using compute_type = typename Eval::compute_type;
+  Eval eval;
+  uint8_t *mask;
+  compute_type *prom;
+  compute_type *width;
+  index_t rows;
+
+  static constexpr int32_t Rank() { return 2; }
+  index_t Size(int dim) const { return dim == 0 ? rows : eval.n; }
+
+  void operator()(index_t row, index_t i) const {
+    const index_t off = row * eval.n + i;
+    mask[off] = eval.Evaluate(row, i, prom[off], width[off]);
+  }
+};
+
+template <typename CType, typename Store>
+struct FindPeaksCompactOp {
+  const uint8_t *mask;
+  const CType *prom;
+  const CType *width;
+  Store store;
+  index_t rows;
+  index_t n;
+
+  static constexpr int32_t Rank() { return 1; }
+  index_t Size(int) const { return rows; }
+
+  void operator()(index_t row) const {
+    index_t found = 0;
+    for (index_t i = 0; i < n; i++) {
+      const index_t off = row * n + i;
+      if (mask[off]) {
+        store.Peak(row, found++, i, prom[off], width[off]);
+      }
+    }
+    store.Count(row, found);
+  }
+};
+
+template <typename InType>
+__MATX_INLINE__ auto find_peaks_eval(const InType &in, const FindPeaksParams &params, bool props)
+{
+  using eval_type = FindPeaksEval<InType>;
+  using compute_type = typename eval_type::compute_type;
+
+  MATX_ASSERT_STR(params.distance >= 1, matxInvalidParameter, "find_peaks() distance must be at least 1");
+  MATX_ASSERT_STR(params.wlen >= 0, matxInvalidParameter, "find_peaks() wlen must not be negative");
+  MATX_ASSERT_STR(params.rel_height >= 0, matxInvalidParameter, "find_peaks() rel_height must not be negative");
+
+  return eval_type{in, in.Size(InType::Rank() - 1),
+    static_cast<compute_type>(params.height), static_cast<compute_type>(params.threshold), params.distance,
+    static_cast<compute_type>(params.prominence), params.wlen, static_cast<compute_type>(params.rel_height),
+    props || params.prominence > 0};
+}
+
+template <typename OutIdxType, typename NumFoundType, typename InType>
+__MATX_INLINE__ void find_peaks_check_outputs(const OutIdxType &out_idxs, const NumFoundType &num_found, const InType &in)
+{
+  static_assert(InType::Rank() == 1 || InType::Rank() == 2, "Input to find_peaks() must be rank 1 or 2");
+  static_assert(OutIdxType::Rank() == InType::Rank(), "find_peaks() index output must have the rank of the input");
+  static_assert(NumFoundType::Rank() == InType::Rank() - 1, "find_peaks() count output must have one rank less than the input");
+  if constexpr (InType::Rank() == 2) {
+    MATX_ASSERT_STR(out_idxs.Size(0) == in.Size(0) && num_found.Size(0) == in.Size(0), matxInvalidSize,
+      "find_peaks() outputs must have one row per input row");
+  }
+}
+
 /**
- * Find the peaks in an operator
+ * Find the peaks in every row of an operator
+ *
+ * Peaks are local maxima passing the height and threshold tests. Candidates
+ * closer than distance to a higher candidate, or to an equally high earlier
+ * one, are suppressed, and the survivors must have at least the requested
+ * prominence. The prominence and width of every peak are written when PROPS
+ * is set.
  *
+ * On CUDA, each block stages a tile of a row and a halo of distance samples in
+ * shared memory to find and suppress candidates, and a single compaction pass
+ * per row writes the peaks in ascending order. Rank 1 inputs without distance,
+ * prominence or width use a single select over the input instead. On the host
+ * the rows and tiles are spread over the executor's threads.
  *
- * @tparam OutIdxType
- *   Output index type
- * @tparam NumFoundType
- *   Output number found type
- * @tparam InType
- *   Input data type
- * @tparam RANK
- *   Rank of output tensor
+ * @tparam PROPS
+ *   Write prominences and widths
  *
  * @param out_idxs
- *   Destination for peak indices
+ *   Destination for peak indices, with a row per input row
  * @param num_found
- *   Destination for number of peaks found
+ *   Destination for number of peaks found in each row
+ * @param prom
+ *   Destination for peak prominences when PROPS is set
+ * @param width
+ *   Destination for peak widths when PROPS is set
  * @param in
  *   Input data to find peaks in
- * @param height
- *   Height threshold. Each peak must be greater than this value.
- * @param threshold
- *   Threshold for peak detection. The neighboring values must be greater or equal to this distance from the peak (using immediate neighbors)
+ * @param params
+ *   Peak search parameters
  * @param exec
  *   Executor
  */
- template <typename OutIdxType, typename NumFoundType, typename InType>
- void __MATX_INLINE__ find_peaks_impl(OutIdxType &out_idxs, NumFoundType &num_found, const InType &in,
-                                       typename InType::value_type height,
-                                       typename InType::value_type threshold,
-                                       const cudaExecutor &exec)
- {
-    MATX_NVTX_START("find_peaks_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
-
-    find_idx_impl(out_idxs, num_found, in, PeakSearchCmpOp{in, height, threshold}, exec);
- }
-
- template <typename OutIdxType, typename NumFoundType, typename InType, ThreadsMode MODE>
- void __MATX_INLINE__ find_peaks_impl(OutIdxType &out_idxs, NumFoundType &num_found, const InType &in,
-                                       typename InType::value_type height,
-                                       typename InType::value_type threshold,
-                                       [[maybe_unused]] const HostExecutor<MODE> &exec)
- {
-    MATX_NVTX_START("find_peaks_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
-
-    static_assert(MODE == ThreadsMode::SINGLE, "find_peaks() only supports a single threaded host executor");
-
-    // Use thrust to find the number of peaks
-    const auto end_iter = cuda::std::copy_if(
-      detail::make_counting_iterator(static_cast<matx::index_t>(0)),
-      detail::make_counting_iterator(TotalSize(in)),
-      out_idxs.Data(),
-      PeakSearchCmpOp{in, height, threshold}
-    );
-
-    num_found() = static_cast<int>(end_iter - out_idxs.Data());
- }
+template <bool PROPS, typename OutIdxType, typename NumFoundType, typename PromType, typename WidthType, typename InType>
+void find_peaks_impl(OutIdxType &out_idxs, NumFoundType &num_found, [[maybe_unused]] PromType &prom,
+                     [[maybe_unused]] WidthType &width, const InType &in, const FindPeaksParams &params,
+                     const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("find_peaks_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  using value_type = typename InType::value_type;
+  constexpr int THREADS = 256;
+
+  detail::find_peaks_check_outputs(out_idxs, num_found, in);
+  const auto eval = detail::find_peaks_eval(in, params, PROPS);
+  using compute_type = typename decltype(eval)::compute_type;
+
+  if constexpr (InType::Rank() == 1 && !PROPS && !cuda::std::is_integral_v<value_type>) {
+    if (params.distance == 1 && !eval.props) {
+      find_idx_impl(out_idxs, num_found, in, detail::PeakSearchCmpOp{in,
+        static_cast<value_type>(params.height), static_cast<value_type>(params.threshold)}, exec);
+      return;
+    }
+  }
+
+  const cudaStream_t stream = exec.getStream();
+  const index_t rows = InType::Rank() == 2 ? in.Size(0) : 1;
+  const index_t n = eval.n;
+  if (rows == 0) {
+    return;
+  }
+  if (n == 0) {
+    (num_found = 0).run(exec);
+    return;
+  }
+
+  const index_t tiles = (n + THREADS - 1) / THREADS;
+  MATX_ASSERT_STR(rows * tiles <= std::numeric_limits<int>::max(), matxInvalidSize, "Input too large for find_peaks()");
+
+  const index_t span = THREADS + 2 * (params.distance - 1);
+  const size_t shm = static_cast<size_t>(span + 2) * sizeof(compute_type) + static_cast<size_t>(span);
+  MATX_ASSERT_STR(shm <= 48 * 1024, matxInvalidParameter, "find_peaks() distance is too large for the shared memory tile");
+
+  uint8_t *mask;
+  compute_type *prom_tmp = nullptr;
+  compute_type *width_tmp = nullptr;
+  matxAlloc(reinterpret_cast<void **>(&mask), rows * n * sizeof(uint8_t), MATX_ASYNC_DEVICE_MEMORY, stream);
+  if (eval.props) {
+    matxAlloc(reinterpret_cast<void **>(&prom_tmp), rows * n * sizeof(compute_type), MATX_ASYNC_DEVICE_MEMORY, stream);
+    matxAlloc(reinterpret_cast<void **>(&width_tmp), rows * n * sizeof(compute_type), MATX_ASYNC_DEVICE_MEMORY, stream);
+  }
+
+  detail::find_peaks_detect_kernel<THREADS><<<static_cast<unsigned int>(rows * tiles), THREADS, shm, stream>>>(
+      eval, mask, prom_tmp, width_tmp, tiles);
+
+  detail::FindPeaksStore<PROPS, OutIdxType, NumFoundType, PromType, WidthType> store{out_idxs, num_found, prom, width};
+  detail::find_peaks_compact_kernel<THREADS><<<static_cast<unsigned int>(rows), THREADS, 0, stream>>>(
+      mask, PROPS ? prom_tmp : nullptr, PROPS ? width_tmp : nullptr, store, n);
+
+  matxFree(mask, stream);
+  if (eval.props) {
+    matxFree(prom_tmp, stream);
+    matxFree(width_tmp, stream);
+  }
+#endif
+}
+
+template <bool PROPS, typename OutIdxType, typename NumFoundType, typename PromType, typename WidthType, typename InType, ThreadsMode MODE>
+void find_peaks_impl(OutIdxType &out_idxs, NumFoundType &num_found, PromType &prom, WidthType &width,
+                     const InType &in, const FindPeaksParams &params, const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START_CACHED("find_peaks_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+
+  detail::find_peaks_check_outputs(out_idxs, num_found, in);
+  const auto eval = detail::find_peaks_eval(in, params, PROPS);
+  using eval_type = remove_cvref_t<decltype(eval)>;
+  using compute_type = typename eval_type::compute_type;
+
+  const index_t rows = InType::Rank() == 2 ? in.Size(0) : 1;
+  const index_t n = eval.n;
+  std::vector<uint8_t> mask(static_cast<size_t>(rows * n));
+  std::vector<compute_type> prom_tmp(static_cast<size_t>(rows * n));
+  std::vector<compute_type> width_tmp(static_cast<size_t>(rows * n));
+
+  // Each sample is tested independently, so the executor spreads rows and
+  // tiles of long rows over its threads
+  exec.Exec(detail::FindPeaksMaskOp<eval_type>{eval, mask.data(), prom_tmp.data(), width_tmp.data(), rows});
+
+  using store_type = detail::FindPeaksStore<PROPS, OutIdxType, NumFoundType, PromType, WidthType>;
+  exec.Exec(detail::FindPeaksCompactOp<compute_type, store_type>{mask.data(), prom_tmp.data(), width_tmp.data(),
+    store_type{out_idxs, num_found, prom, width}, rows, n});
+}
 
 }
 }
@@ -0,0 +1,323 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <limits>
+#include <unordered_map>
+
+#include "matx/core/error.h"
+#include "matx/core/iterator.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/operator_options.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/cuda.h"
+#include "matx/executors/host.h"
+#include "matx/kernels/hash_table.cuh"
+
+namespace matx {
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool hash_key_supported_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+// Open-addressing table sized to at most half full
+__MATX_INLINE__ unsigned int hash_table_size(index_t n)
+{
+  MATX_ASSERT_STR(n <= (std::numeric_limits<int>::max() >> 2), matxInvalidSize,
+    "Hash-based unique and groupby_reduce are limited to 2^29 keys");
+  unsigned int cap = 64;
+  while (cap < 2 * n) {
+    cap *= 2;
+  }
+  return cap;
+}
+
+template <typename Op, typename Func>
+__MATX_INLINE__ void groupby_dispatch(GroupByOp op, Func &&f)
+{
+  using T = typename Op::value_type;
+  switch (op) {
+    case GroupByOp::SUM: f(SegmentedSumOp<T>{}); break;
+    case GroupByOp::MIN: f(SegmentedMinOp<T>{}); break;
+    case GroupByOp::MAX: f(SegmentedMaxOp<T>{}); break;
+    default: MATX_THROW(matxInvalidParameter, "Unknown groupby_reduce() operation");
+  }
+}
+
+} // end namespace detail
+
+/**
+ * Reduce to unique values in no particular order
+ *
+ * Keys are inserted into an open-addressing hash table on the device in a
+ * single pass, and every key that claims a new slot is appended to the
+ * output. This avoids the sort that unique_impl needs, at the cost of an
+ * arbitrary output order. num_found is the total number of unique values, and
+ * only the first a_out.Size(0) of them are written.
+ *
+ * @tparam OutputTensor
+ *   Output type
+ * @tparam CountTensor
+ *   Output count type
+ * @tparam InputOperator
+ *   Input type
+ * @param a_out
+ *   Unique values
+ * @param num_found
+ *   Number of unique values
+ * @param a
+ *   Input operator
+ * @param exec
+ *   CUDA executor
+ */
+template <typename OutputTensor, typename CountTensor, typename InputOperator>
+void unique_unordered_impl(OutputTensor &a_out, CountTensor &num_found, const InputOperator &a,
+                           const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("unique_unordered_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename InputOperator::value_type;
+  static_assert(CountTensor::Rank() == 0, "Num found output tensor rank must be 0");
+  static_assert(std::is_same_v<typename CountTensor::value_type, int>, "Num found output tensor must be int");
+  static_assert(OutputTensor::Rank() == 1, "Unique output must be rank 1");
+  MATX_STATIC_ASSERT_STR(detail::hash_key_supported_v<T>, matxInvalidType,
+    "Unordered unique requires an arithmetic key type");
+  MATX_ASSERT_STR(a_out.IsContiguous(), matxInvalidParameter, "Unique output must be contiguous");
+
+  cudaStream_t stream = exec.getStream();
+  const index_t n = TotalSize(a);
+  MATX_CUDA_CHECK(cudaMemsetAsync(num_found.Data(), 0, sizeof(int), stream));
+  if (n == 0) {
+    return;
+  }
+
+  const unsigned int cap = detail::hash_table_size(n);
+  int *table = nullptr;
+  matxAlloc((void **)&table, cap * sizeof(int), MATX_ASYNC_DEVICE_MEMORY, stream);
+  MATX_CUDA_CHECK(cudaMemsetAsync(table, 0xFF, cap * sizeof(int), stream));
+
+  constexpr int THREADS = 256;
+  const auto blocks = static_cast<unsigned int>((n + THREADS - 1) / THREADS);
+  detail::hash_unique_kernel<<<blocks, THREADS, 0, stream>>>(
+    RandomOperatorIterator{a}, n, table, cap - 1, a_out.Data(), a_out.Size(0), num_found.Data());
+
+  matxFree(table, stream);
+#endif
+}
+
+/**
+ * Group values by key and reduce each group
+ *
+ * Keys are inserted into an open-addressing hash table on the device. The
+ * first pass assigns every distinct key a group. The second pass folds each
+ * value into its group with atomics. Groups appear in no particular order.
+ * num_groups is the total number of groups, and only the first
+ * keys_out.Size(0) of them are written.
+ *
+ * @tparam KeysOutTensor
+ *   Output keys type
+ * @tparam ValsOutTensor
+ *   Output values type
+ * @tparam CountsOutTensor
+ *   Output counts type
+ * @tparam NumTensor
+ *   Output group count type
+ * @tparam KeyOperator
+ *   Input keys type
+ * @tparam ValueOperator
+ *   Input values type
+ * @param keys_out
+ *   Key of each group
+ * @param vals_out
+ *   Reduced values of each group
+ * @param counts_out
+ *   Number of values in each group
+ * @param num_groups
+ *   Number of groups
+ * @param keys
+ *   Input keys
+ * @param values
+ *   Input values, with the same size as keys
+ * @param op
+ *   Reduction to apply to each group
+ * @param exec
+ *   CUDA executor
+ */
+template <typename KeysOutTensor, typename ValsOutTensor, typename CountsOutTensor, typename NumTensor,
+          typename KeyOperator, typename ValueOperator>
+void groupby_reduce_impl(KeysOutTensor &keys_out, ValsOutTensor &vals_out, CountsOutTensor &counts_out,
+                         NumTensor &num_groups, const KeyOperator &keys, const ValueOperator &values,
+                         GroupByOp op, const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("groupby_reduce_impl(" + get_type_str(keys) + ")", matx::MATX_NVTX_LOG_API)
+  using K = typename KeyOperator::value_type;
+  using V = typename ValsOutTensor::value_type;
+  static_assert(NumTensor::Rank() == 0, "Number of groups output tensor rank must be 0");
+  static_assert(std::is_same_v<typename NumTensor::value_type, int>, "Number of groups output tensor must be int");
+  static_assert(std::is_same_v<typename CountsOutTensor::value_type, int>, "groupby_reduce() counts must be int");
+  MATX_STATIC_ASSERT_STR(detail::hash_key_supported_v<K>, matxInvalidType,
+    "groupby_reduce() requires an arithmetic key type");
+  MATX_STATIC_ASSERT_STR(std::is_arithmetic_v<V> && (sizeof(V) == 4 || sizeof(V) == 8), matxInvalidType,
+    "groupby_reduce() requires 32 or 64-bit arithmetic values");
+  MATX_ASSERT_STR(TotalSize(keys) == TotalSize(values), matxInvalidSize,
+    "groupby_reduce() keys and values must have the same size");
+  MATX_ASSERT_STR(keys_out.Size(0) == vals_out.Size(0) && keys_out.Size(0) == counts_out.Size(0), matxInvalidSize,
+    "groupby_reduce() outputs must have the same size");
+  MATX_ASSERT_STR(keys_out.IsContiguous() && vals_out.IsContiguous() && counts_out.IsContiguous(),
+    matxInvalidParameter, "groupby_reduce() outputs must be contiguous");
+
+  cudaStream_t stream = exec.getStream();
+  const index_t n = TotalSize(keys);
+  MATX_CUDA_CHECK(cudaMemsetAsync(num_groups.Data(), 0, sizeof(int), stream));
+  if (n == 0) {
+    return;
+  }
+
+  const unsigned int cap = detail::hash_table_size(n);
+  int *table = nullptr;
+  int *slot_group = nullptr;
+  unsigned int *slot_of = nullptr;
+  matxAlloc((void **)&table, cap * sizeof(int), MATX_ASYNC_DEVICE_MEMORY, stream);
+  matxAlloc((void **)&slot_group, cap * sizeof(int), MATX_ASYNC_DEVICE_MEMORY, stream);
+  matxAlloc((void **)&slot_of, n * sizeof(unsigned int), MATX_ASYNC_DEVICE_MEMORY, stream);
+  MATX_CUDA_CHECK(cudaMemsetAsync(table, 0xFF, cap * sizeof(int), stream));
+
+  constexpr int THREADS = 256;
+  const auto blocks = static_cast<unsigned int>((n + THREADS - 1) / THREADS);
+  const index_t out_size = keys_out.Size(0);
+
+  detail::groupby_dispatch<ValsOutTensor>(op, [&](auto reduce_op) {
+    detail::hash_groupby_insert_kernel<<<blocks, THREADS, 0, stream>>>(
+      RandomOperatorIterator{keys}, n, table, cap - 1, slot_of, slot_group, keys_out.Data(), vals_out.Data(),
+      counts_out.Data(), out_size, num_groups.Data(), reduce_op.Init());
+    detail::hash_groupby_reduce_kernel<<<blocks, THREADS, 0, stream>>>(
+      RandomOperatorIterator{values}, n, slot_of, slot_group, vals_out.Data(), counts_out.Data(), out_size,
+      reduce_op);
+  });
+
+  matxFree(table, stream);
+  matxFree(slot_group, stream);
+  matxFree(slot_of, stream);
+#endif
+}
+
+/**
+ * Group values by key and reduce each group
+ *
+ * Groups are written in the order their keys first appear in the input.
+ *
+ * @tparam KeysOutTensor
+ *   Output keys type
+ * @tparam ValsOutTensor
+ *   Output values type
+ * @tparam CountsOutTensor
+ *   Output counts type
+ * @tparam NumTensor
+ *   Output group count type
+ * @tparam KeyOperator
+ *   Input keys type
+ * @tparam ValueOperator
+ *   Input values type
+ * @tparam MODE
+ *   Host executor threads mode
+ * @param keys_out
+ *   Key of each group
+ * @param vals_out
+ *   Reduced values of each group
+ * @param counts_out
+ *   Number of values in each group
+ * @param num_groups
+ *   Number of groups
+ * @param keys
+ *   Input keys
+ * @param values
+ *   Input values, with the same size as keys
+ * @param op
+ *   Reduction to apply to each group
+ * @param exec
+ *   Host executor
+ */
+template <typename KeysOutTensor, typename ValsOutTensor, typename CountsOutTensor, typename NumTensor,
+          typename KeyOperator, typename ValueOperator, ThreadsMode MODE>
+void groupby_reduce_impl(KeysOutTensor &keys_out, ValsOutTensor &vals_out, CountsOutTensor &counts_out,
+                         NumTensor &num_groups, const KeyOperator &keys, const ValueOperator &values,
+                         GroupByOp op, [[maybe_unused]] const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START_CACHED("groupby_reduce_impl(" + get_type_str(keys) + ")", matx::MATX_NVTX_LOG_API)
+  using K = typename KeyOperator::value_type;
+  using V = typename ValsOutTensor::value_type;
+  static_assert(NumTensor::Rank() == 0, "Number of groups output tensor rank must be 0");
+  MATX_STATIC_ASSERT_STR(detail::hash_key_supported_v<K>, matxInvalidType,
+    "groupby_reduce() requires an arithmetic key type");
+  MATX_ASSERT_STR(TotalSize(keys) == TotalSize(values), matxInvalidSize,
+    "groupby_reduce() keys and values must have the same size");
+  MATX_ASSERT_STR(keys_out.Size(0) == vals_out.Size(0) && keys_out.Size(0) == counts_out.Size(0), matxInvalidSize,
+    "groupby_reduce() outputs must have the same size");
+
+  const index_t n = TotalSize(keys);
+  const index_t out_size = keys_out.Size(0);
+  const auto kit = RandomOperatorIterator{keys};
+  const auto vit = RandomOperatorIterator{values};
+
+  detail::groupby_dispatch<ValsOutTensor>(op, [&](auto reduce_op) {
+    std::unordered_map<K, index_t> groups;
+    for (index_t i = 0; i < n; i++) {
+      const K k = kit[i];
+      auto it = groups.find(k);
+      index_t g;
+      if (it == groups.end()) {
+        g = static_cast<index_t>(groups.size());
+        groups.emplace(k, g);
+        if (g < out_size) {
+          keys_out(g) = k;
+          vals_out(g) = reduce_op.Init();
+          counts_out(g) = 0;
+        }
+      }
+      else {
+        g = it->second;
+      }
+
+      if (g < out_size) {
+        vals_out(g) = reduce_op(vals_out(g), static_cast<V>(vit[i]));
+        counts_out(g) = counts_out(g) + 1;
+      }
+    }
+
+    num_groups() = static_cast<typename NumTensor::value_type>(groups.size());
+  });
+}
+
+} // end namespace matx
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/type_utils.h"
+#include "matx/operators/collapse.h"
+#include "matx/kernels/hist.cuh"
+
+namespace matx {
+
+namespace detail {
+
+// Largest number of int bins a block keeps a private shared memory copy of.
+// Larger histograms are counted directly in global memory.
+static constexpr int HIST_SMEM_MAX_BINS = (48 * 1024) / sizeof(int);
+
+/**
+ * Zero the contiguous histograms in out and launch hist_kernel over rows x n
+ * samples. Each row is split across enough blocks to keep roughly 2048 samples
+ * per block, so large rows are spread over the device and large batches of
+ * small rows still take one launch.
+ */
+template <typename Binner>
+void hist_launch([[maybe_unused]] const Binner &binner, [[maybe_unused]] int *out, [[maybe_unused]] index_t rows,
+                 [[maybe_unused]] index_t n, [[maybe_unused]] int bins, [[maybe_unused]] cudaStream_t stream)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  constexpr int THREADS = 256;
+
+  if (rows == 0 || bins == 0) {
+    return;
+  }
+
+  MATX_CUDA_CHECK(cudaMemsetAsync(out, 0, static_cast<size_t>(rows) * bins * sizeof(int), stream));
+
+  if (n == 0) {
+    return;
+  }
+
+  const int blocks_per_row = static_cast<int>(std::clamp<index_t>((n + THREADS * 8 - 1) / (THREADS * 8), 1, 256));
+  const index_t blocks = rows * blocks_per_row;
+  MATX_ASSERT_STR(blocks <= std::numeric_limits<int>::max(), matxInvalidSize, "Too many rows for hist()");
+
+  const bool smem = bins <= HIST_SMEM_MAX_BINS;
+  const size_t shm = smem ? static_cast<size_t>(bins) * sizeof(int) : 0;
+
+  hist_kernel<THREADS><<<static_cast<unsigned int>(blocks), THREADS, shm, stream>>>(
+      binner, out, n, bins, blocks_per_row, smem);
+#endif
+}
+
+template <typename OutputTensor, typename InputOperator>
+__MATX_INLINE__ void hist_check_output(const OutputTensor &a_out, const InputOperator &a, int rank_extra)
+{
+  static_assert(std::is_same_v<typename OutputTensor::value_type, int>, "Output histogram operator must use int type");
+  MATX_ASSERT_STR(a_out.IsContiguous(), matxInvalidParameter, "hist() output must be contiguous");
+  for (int r = 0; r < InputOperator::Rank() - 1; r++) {
+    MATX_ASSERT_STR(a_out.Size(r) == a.Size(r), matxInvalidSize,
+      "hist() output batch dimensions must match the input");
+  }
+  MATX_ASSERT_STR(OutputTensor::Rank() == InputOperator::Rank() + rank_extra, matxInvalidDim,
+    "hist() output has the wrong rank");
+}
+
+/**
+ * Evenly spaced histogram of every row of a batched input in one launch
+ */
+template <typename OutputTensor, typename InputOperator>
+void hist_even_batched_impl(OutputTensor &a_out, const InputOperator &a,
+                            const typename InputOperator::value_type lower,
+                            const typename InputOperator::value_type upper,
+                            int num_levels, cudaStream_t stream)
+{
+  using T = typename InputOperator::value_type;
+  using compute_type = typename HistEvenBins<T>::compute_type;
+  hist_check_output(a_out, a, 0);
+
+  const int bins = num_levels - 1;
+  MATX_ASSERT_STR(a_out.Size(OutputTensor::Rank() - 1) == bins, matxInvalidSize,
+    "hist() output must have num_levels - 1 bins in the last dimension");
+
+  const auto rows = lcollapse<InputOperator::Rank() - 1>(a);
+  const index_t n = a.Size(InputOperator::Rank() - 1);
+  const index_t nrows = n == 0 ? 0 : TotalSize(a) / n;
+
+  HistBinner1D<remove_cvref_t<decltype(rows)>, HistEvenBins<T>> binner{
+    rows, {static_cast<compute_type>(lower), static_cast<compute_type>(upper), bins}};
+  hist_launch(binner, a_out.Data(), nrows, n, bins, stream);
+}
+
+} // end namespace detail
+
+/**
+ * Compute a histogram with arbitrary bin edges of every row of a tensor
+ *
+ * Bin i of a row counts the samples in [edges(i), edges(i+1)), where edges is
+ * a sorted rank 1 operator with one more entry than there are bins. Samples
+ * outside [edges(0), edges(num_edges - 1)) are not counted. All rows are
+ * computed in a single launch.
+ *
+ * @tparam OutputTensor
+ *   Output histogram type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam EdgeOperator
+ *   Bin edge operator type
+ * @param a_out
+ *   Output histogram. Must be int, contiguous, and match the input in all but
+ *   the last dimension, which is the number of bins
+ * @param a
+ *   Input operator
+ * @param edges
+ *   Sorted bin edges
+ * @param stream
+ *   CUDA stream
+ */
+template <typename OutputTensor, typename InputOperator, typename EdgeOperator>
+void hist_range_impl(OutputTensor &a_out, const InputOperator &a, const EdgeOperator &edges,
+                     const cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  static_assert(EdgeOperator::Rank() == 1, "hist() bin edges must be rank 1");
+  detail::hist_check_output(a_out, a, 0);
+
+  const int bins = static_cast<int>(edges.Size(0)) - 1;
+  MATX_ASSERT_STR(bins >= 1, matxInvalidSize, "hist() needs at least two bin edges");
+  MATX_ASSERT_STR(a_out.Size(OutputTensor::Rank() - 1) == bins, matxInvalidSize,
+    "hist() output must have one fewer bin than there are edges");
+
+  const auto rows = lcollapse<InputOperator::Rank() - 1>(a);
+  const index_t n = a.Size(InputOperator::Rank() - 1);
+  const index_t nrows = n == 0 ? 0 : TotalSize(a) / n;
+
+  using edge_type = typename detail::base_type_t<EdgeOperator>;
+  detail::HistBinner1D<remove_cvref_t<decltype(rows)>, detail::HistRangeBins<typename InputOperator::value_type, edge_type>> binner{
+    rows, {edges, bins}};
+  detail::hist_launch(binner, a_out.Data(), nrows, n, bins, stream);
+}
+
+/**
+ * Compute a joint 2D histogram of every row of two tensors
+ *
+ * Sample i of each row of x and y falls into output bin (bx, by), where bx and
+ * by are the evenly spaced bins of x and y. Pairs where either sample is out
+ * of range are not counted. All rows are computed in a single launch.
+ *
+ * @tparam OutputTensor
+ *   Output histogram type
+ * @tparam XOperator
+ *   First input operator type
+ * @tparam YOperator
+ *   Second input operator type
+ * @param a_out
+ *   Output histogram. Must be int and contiguous, with one more dimension than
+ *   the inputs, and with the last two sizes the number of x and y bins
+ * @param x
+ *   First input
+ * @param y
+ *   Second input with the same shape as x
+ * @param xlower
+ *   Lower limit of x
+ * @param xupper
+ *   Upper limit of x
+ * @param xlevels
+ *   Number of x levels
+ * @param ylower
+ *   Lower limit of y
+ * @param yupper
+ *   Upper limit of y
+ * @param ylevels
+ *   Number of y levels
+ * @param stream
+ *   CUDA stream
+ */
+template <typename OutputTensor, typename XOperator, typename YOperator>
+void hist2d_impl(OutputTensor &a_out, const XOperator &x, const YOperator &y,
+                 const typename XOperator::value_type xlower, const typename XOperator::value_type xupper, int xlevels,
+                 const typename YOperator::value_type ylower, const typename YOperator::value_type yupper, int ylevels,
+                 const cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  static_assert(XOperator::Rank() == YOperator::Rank(), "hist2d() inputs must have the same rank");
+  using TX = typename XOperator::value_type;
+  using TY = typename YOperator::value_type;
+  detail::hist_check_output(a_out, x, 1);
+
+  for (int r = 0; r < XOperator::Rank(); r++) {
+    MATX_ASSERT_STR(x.Size(r) == y.Size(r), matxInvalidSize, "hist2d() inputs must have the same shape");
+  }
+
+  const int xbins = xlevels - 1;
+  const int ybins = ylevels - 1;
+  MATX_ASSERT_STR(a_out.Size(OutputTensor::Rank() - 2) == xbins && a_out.Size(OutputTensor::Rank() - 1) == ybins,
+    matxInvalidSize, "hist2d() output must have xlevels - 1 by ylevels - 1 bins in the last two dimensions");
+  MATX_ASSERT_STR(static_cast<index_t>(xbins) * ybins <= std::numeric_limits<int>::max(), matxInvalidSize,
+    "hist2d() has too many bins");
+
+  const auto xrows = lcollapse<XOperator::Rank() - 1>(x);
+  const auto yrows = lcollapse<YOperator::Rank() - 1>(y);
+  const index_t n = x.Size(XOperator::Rank() - 1);
+  const index_t nrows = n == 0 ? 0 : TotalSize(x) / n;
+
+  using xbins_type = detail::HistEvenBins<TX>;
+  using ybins_type = detail::HistEvenBins<TY>;
+  detail::HistBinner2D<remove_cvref_t<decltype(xrows)>, remove_cvref_t<decltype(yrows)>, xbins_type, ybins_type> binner{
+    xrows, yrows,
+    {static_cast<typename xbins_type::compute_type>(xlower), static_cast<typename xbins_type::compute_type>(xupper), xbins},
+    {static_cast<typename ybins_type::compute_type>(ylower), static_cast<typename ybins_type::compute_type>(yupper), ybins}};
+  detail::hist_launch(binner, a_out.Data(), nrows, n, xbins * ybins, stream);
+}
+
+} // end namespace matx
@@ -36,6 +36,7 @@
 #include "matx/core/error.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/tensor.h"
+#include "matx/transforms/solver_small.h"
 #include <cstdio>
 #include <numeric>
 
@@ -62,7 +63,8 @@ struct InverseParams_t {
 enum class MatInverseLUBackend {
   cuBLASGetRf,
   cuBLASMatInv,
-  cuSolverGetRfRs
+  cuSolverGetRfRs,
+  SmallBatched
 };
 
 template <typename TensorTypeAInv, typename TensorTypeA, MatInverseAlgo_t ALGO = MAT_INVERSE_ALGO_LU>
@@ -103,7 +105,7 @@ public:
   {
     static_assert(RANK >= 2);
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Ok to remove since we're just passing a list of RO pointers
     //using a_nc = typename std::remove_const<decltype(a)>(a);
@@ -118,11 +120,15 @@ public:
     params = GetInverseParams(a_inv, a, stream);
 
     if constexpr (ALGO == MAT_INVERSE_ALGO_LU) {
-      // If we're doing a single batch, use cuSolver since it's faster than cuBLAS. Otherwise if we're operating on a small
-      // matrix, use the cuBLAS Inv API. If neither of those works, fall back to the regular cuBlasGetRf path
+      // If we're doing a single batch, use cuSolver since it's faster than cuBLAS. Batches of small matrices with a
+      // contiguous output are inverted in shared memory with one warp per matrix. Otherwise if we're operating on a
+      // small matrix, use the cuBLAS Inv API. If neither of those works, fall back to the regular cuBlasGetRf path
       if (params.batch_size == 1) {
         backend = MatInverseLUBackend::cuSolverGetRfRs;
       }
+      else if (UseSmallSolver<T1>(params.n, params.batch_size) && a_inv.IsContiguous()) {
+        backend = MatInverseLUBackend::SmallBatched;
+      }
       else {
         backend = (a.Size(TensorTypeA::Rank()-1) <= BATCHED_SINGLE_CALL_INV_THRESHOLD) ? 
                           MatInverseLUBackend::cuBLASMatInv : 
@@ -333,7 +339,7 @@ public:
    */
   inline void Exec([[maybe_unused]] TensorTypeAInv &a_inv, const TensorTypeA &a, cudaStream_t stream)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (backend == MatInverseLUBackend::cuBLASGetRf || backend == MatInverseLUBackend::cuBLASMatInv) {
       cublasSetStream(cublas_handle, stream);
@@ -455,6 +461,25 @@ public:
           }
         }         
       }
+      else if (backend == MatInverseLUBackend::SmallBatched) {
+        const T1 *in_ptr = nullptr;
+        if (UseInputWorkBuffer(a)) {
+          in_ptr = a_workbuf.Data();
+        } else {
+          if constexpr (is_tensor_view_v<TensorTypeA>) {
+            in_ptr = a.Data();
+          }
+        }
+        small_inv_impl(a_inv.Data(), in_ptr, d_info, params.n, params.batch_size, stream);
+
+        cudaMemcpyAsync(h_info, d_info, sizeof(int) * params.batch_size, cudaMemcpyDeviceToHost, stream);
+        cudaStreamSynchronize(stream);
+        for (size_t i = 0; i < params.batch_size; i++) {
+          if (h_info[i] != 0) {
+            MATX_THROW(matxLUError, "inverse failed");
+          }
+        }
+      }
       else if (backend == MatInverseLUBackend::cuSolverGetRfRs) {
         MATX_ASSERT_STR(params.batch_size == 1, matxInvalidParameter, "cuSolverGetRfRs backend only used for single batches");
 
@@ -585,7 +610,7 @@ template <typename TensorTypeAInv, typename TensorTypeA, MatInverseAlgo_t ALGO =
 void inv_impl(TensorTypeAInv &a_inv, const TensorTypeA &a,
               const cudaExecutor &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   static_assert(TensorTypeAInv::Rank() == TensorTypeA::Rank(), "Input and output ranks must match");
   const auto stream = exec.getStream();
 
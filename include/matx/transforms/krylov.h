@@ -0,0 +1,756 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <cusparse.h>
+#include <cuda/std/__algorithm/min.h>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/async_scalar.h"
+#include "matx/kernels/krylov.cuh"
+#include "matx/transforms/reduce.h"
+
+namespace matx
+{
+
+/**
+ * Preconditioner used by the Krylov solvers
+ */
+enum class KrylovPrecond {
+  NONE,   ///< No preconditioning
+  JACOBI, ///< Inverse of the diagonal of A. Dense or any sparse format
+  ILU0,   ///< Incomplete LU with zero fill-in. CSR with 32-bit indices
+  IC0,    ///< Incomplete Cholesky with zero fill-in for Hermitian positive definite A. CSR with 32-bit indices
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_krylov_type_v = std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                                         std::is_same_v<T, cuda::std::complex<float>> ||
+                                         std::is_same_v<T, cuda::std::complex<double>>;
+
+/**
+ * Applies z = M^-1 r for one of the supported preconditioners
+ *
+ * ILU0 and IC0 factor a copy of the values of A with the cuSPARSE csrilu02/csric02 routines and apply the
+ * triangular factors with cusparseSpSV. The factorization is redone for every solve.
+ */
+template <typename T, typename AType>
+class KrylovPreconditioner {
+  public:
+    KrylovPreconditioner(const AType &A, KrylovPrecond kind, index_t n, cudaStream_t stream) :
+      kind_(kind), n_(n), stream_(stream) {
+      if (kind_ == KrylovPrecond::JACOBI) {
+        make_tensor(dinv_, {n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+#ifdef __CUDACC__
+        const int threads = 256;
+        const auto blocks = static_cast<unsigned>((n + threads - 1) / threads);
+        KrylovDiagInvKernel<<<blocks, threads, 0, stream>>>(dinv_.Data(), A, n);
+#endif
+      }
+      else if (kind_ == KrylovPrecond::ILU0 || kind_ == KrylovPrecond::IC0) {
+        if constexpr (is_sparse_tensor_v<AType>) {
+          if constexpr (AType::Format::isCSR() && sizeof(typename AType::pos_type) == 4 &&
+                        sizeof(typename AType::crd_type) == 4) {
+            SetupIncomplete(A);
+          }
+          else {
+            MATX_THROW(matxNotSupported, "ILU0/IC0 preconditioners require a CSR matrix with 32-bit indices");
+          }
+        }
+        else {
+          MATX_THROW(matxNotSupported, "ILU0/IC0 preconditioners require a sparse CSR matrix");
+        }
+      }
+    }
+
+    ~KrylovPreconditioner() {
+      if (spsv_lower_ != nullptr) {
+        cusparseSpSV_destroyDescr(spsv_lower_);
+        cusparseSpSV_destroyDescr(spsv_upper_);
+        cusparseDestroySpMat(mat_lower_);
+        cusparseDestroySpMat(mat_upper_);
+        cusparseDestroyDnVec(vec_in_);
+        cusparseDestroyDnVec(vec_tmp_);
+        cusparseDestroyDnVec(vec_out_);
+        matxFree(buf_lower_, stream_);
+        matxFree(buf_upper_, stream_);
+      }
+      if (handle_ != nullptr) {
+        cusparseDestroy(handle_);
+      }
+    }
+
+    KrylovPreconditioner(const KrylovPreconditioner &) = delete;
+    KrylovPreconditioner &operator=(const KrylovPreconditioner &) = delete;
+
+    /**
+     * z = M^-1 r. z and r are distinct contiguous device vectors
+     */
+    void Apply(tensor_t<T, 1> &z, const tensor_t<T, 1> &r) {
+      switch (kind_) {
+        case KrylovPrecond::NONE:
+          (z = r).run(stream_);
+          break;
+        case KrylovPrecond::JACOBI:
+          (z = r * dinv_).run(stream_);
+          break;
+        default: {
+          const auto op_upper = kind_ == KrylovPrecond::IC0 ? TransposeOp() : CUSPARSE_OPERATION_NON_TRANSPOSE;
+          const auto dt = MatXTypeToCudaType<T>();
+          [[maybe_unused]] cusparseStatus_t ret = cusparseDnVecSetValues(vec_in_, const_cast<T *>(r.Data()));
+          MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+          ret = cusparseDnVecSetValues(vec_out_, z.Data());
+          MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+          ret = cusparseSpSV_solve(handle_, CUSPARSE_OPERATION_NON_TRANSPOSE, &one_, mat_lower_, vec_in_, vec_tmp_,
+                                   dt, CUSPARSE_SPSV_ALG_DEFAULT, spsv_lower_);
+          MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+          ret = cusparseSpSV_solve(handle_, op_upper, &one_, mat_upper_, vec_tmp_, vec_out_,
+                                   dt, CUSPARSE_SPSV_ALG_DEFAULT, spsv_upper_);
+          MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+          break;
+        }
+      }
+    }
+
+  private:
+    static constexpr cusparseOperation_t TransposeOp() {
+      return is_complex_v<T> ? CUSPARSE_OPERATION_CONJUGATE_TRANSPOSE : CUSPARSE_OPERATION_TRANSPOSE;
+    }
+
+    void SetupIncomplete(const AType &A) {
+      using CT = std::conditional_t<std::is_same_v<T, cuda::std::complex<double>>, cuDoubleComplex,
+                 std::conditional_t<std::is_same_v<T, cuda::std::complex<float>>, cuFloatComplex, T>>;
+
+      const int m = static_cast<int>(n_);
+      const int nnz = static_cast<int>(A.Nse());
+      int *row_ptr = reinterpret_cast<int *>(A.POSData(1));
+      int *col_ind = reinterpret_cast<int *>(A.CRDData(1));
+
+      // The factorization is in place, so work on a copy of the values
+      make_tensor(vals_, {A.Nse()}, MATX_ASYNC_DEVICE_MEMORY, stream_);
+      make_tensor(tmp_, {n_}, MATX_ASYNC_DEVICE_MEMORY, stream_);
+      MATX_CUDA_CHECK(cudaMemcpyAsync(vals_.Data(), A.Data(), A.Nse() * sizeof(T), cudaMemcpyDeviceToDevice, stream_));
+      CT *vals = reinterpret_cast<CT *>(vals_.Data());
+
+      [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+      ret = cusparseSetStream(handle_, stream_);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+
+      cusparseMatDescr_t descr;
+      ret = cusparseCreateMatDescr(&descr);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+      cusparseSetMatIndexBase(descr, CUSPARSE_INDEX_BASE_ZERO);
+      cusparseSetMatType(descr, CUSPARSE_MATRIX_TYPE_GENERAL);
+
+      int buf_size = 0;
+      void *buf = nullptr;
+      int zero_pivot = -1;
+      const auto policy = CUSPARSE_SOLVE_POLICY_USE_LEVEL;
+
+      if (kind_ == KrylovPrecond::ILU0) {
+        csrilu02Info_t info;
+        ret = cusparseCreateCsrilu02Info(&info);
+        MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+        if constexpr (std::is_same_v<T, float>) {
+          ret = cusparseScsrilu02_bufferSize(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, &buf_size);
+        } else if constexpr (std::is_same_v<T, double>) {
+          ret = cusparseDcsrilu02_bufferSize(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, &buf_size);
+        } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+          ret = cusparseCcsrilu02_bufferSize(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, &buf_size);
+        } else {
+          ret = cusparseZcsrilu02_bufferSize(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, &buf_size);
+        }
+        MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+        matxAlloc(&buf, buf_size, MATX_ASYNC_DEVICE_MEMORY, stream_);
+
+        if constexpr (std::is_same_v<T, float>) {
+          ret = cusparseScsrilu02_analysis(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else if constexpr (std::is_same_v<T, double>) {
+          ret = cusparseDcsrilu02_analysis(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+          ret = cusparseCcsrilu02_analysis(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else {
+          ret = cusparseZcsrilu02_analysis(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        }
+        MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+
+        if constexpr (std::is_same_v<T, float>) {
+          ret = cusparseScsrilu02(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else if constexpr (std::is_same_v<T, double>) {
+          ret = cusparseDcsrilu02(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+          ret = cusparseCcsrilu02(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else {
+          ret = cusparseZcsrilu02(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        }
+        MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+
+        // Blocks until the factorization completes
+        const auto piv = cusparseXcsrilu02_zeroPivot(handle_, info, &zero_pivot);
+        cusparseDestroyCsrilu02Info(info);
+        matxFree(buf, stream_);
+        MATX_ASSERT_STR(piv != CUSPARSE_STATUS_ZERO_PIVOT, matxSolverError, "ILU0 factorization hit a zero pivot");
+      }
+      else {
+        csric02Info_t info;
+        ret = cusparseCreateCsric02Info(&info);
+        MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+        if constexpr (std::is_same_v<T, float>) {
+          ret = cusparseScsric02_bufferSize(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, &buf_size);
+        } else if constexpr (std::is_same_v<T, double>) {
+          ret = cusparseDcsric02_bufferSize(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, &buf_size);
+        } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+          ret = cusparseCcsric02_bufferSize(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, &buf_size);
+        } else {
+          ret = cusparseZcsric02_bufferSize(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, &buf_size);
+        }
+        MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+        matxAlloc(&buf, buf_size, MATX_ASYNC_DEVICE_MEMORY, stream_);
+
+        if constexpr (std::is_same_v<T, float>) {
+          ret = cusparseScsric02_analysis(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else if constexpr (std::is_same_v<T, double>) {
+          ret = cusparseDcsric02_analysis(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+          ret = cusparseCcsric02_analysis(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else {
+          ret = cusparseZcsric02_analysis(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        }
+        MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+
+        if constexpr (std::is_same_v<T, float>) {
+          ret = cusparseScsric02(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else if constexpr (std::is_same_v<T, double>) {
+          ret = cusparseDcsric02(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+          ret = cusparseCcsric02(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        } else {
+          ret = cusparseZcsric02(handle_, m, nnz, descr, vals, row_ptr, col_ind, info, policy, buf);
+        }
+        MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+
+        // Blocks until the factorization completes
+        const auto piv = cusparseXcsric02_zeroPivot(handle_, info, &zero_pivot);
+        cusparseDestroyCsric02Info(info);
+        matxFree(buf, stream_);
+        MATX_ASSERT_STR(piv != CUSPARSE_STATUS_ZERO_PIVOT, matxSolverError, "IC0 factorization hit a zero pivot");
+      }
+      cusparseDestroyMatDescr(descr);
+
+      // Both factors share the CSR arrays. ILU0 stores a unit-diagonal L below an upper U, while IC0 stores
+      // L in the lower triangle and applies L^H for the second solve
+      const auto dt = MatXTypeToCudaType<T>();
+      const auto it = CUSPARSE_INDEX_32I;
+      ret = cusparseCreateCsr(&mat_lower_, n_, n_, A.Nse(), row_ptr, col_ind, vals_.Data(), it, it, CUSPARSE_INDEX_BASE_ZERO, dt);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+      ret = cusparseCreateCsr(&mat_upper_, n_, n_, A.Nse(), row_ptr, col_ind, vals_.Data(), it, it, CUSPARSE_INDEX_BASE_ZERO, dt);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+
+      cusparseFillMode_t lower = CUSPARSE_FILL_MODE_LOWER;
+      cusparseFillMode_t upper = kind_ == KrylovPrecond::IC0 ? CUSPARSE_FILL_MODE_LOWER : CUSPARSE_FILL_MODE_UPPER;
+      cusparseDiagType_t lower_diag = kind_ == KrylovPrecond::IC0 ? CUSPARSE_DIAG_TYPE_NON_UNIT : CUSPARSE_DIAG_TYPE_UNIT;
+      cusparseDiagType_t upper_diag = CUSPARSE_DIAG_TYPE_NON_UNIT;
+      cusparseSpMatSetAttribute(mat_lower_, CUSPARSE_SPMAT_FILL_MODE, &lower, sizeof(lower));
+      cusparseSpMatSetAttribute(mat_lower_, CUSPARSE_SPMAT_DIAG_TYPE, &lower_diag, sizeof(lower_diag));
+      cusparseSpMatSetAttribute(mat_upper_, CUSPARSE_SPMAT_FILL_MODE, &upper, sizeof(upper));
+      cusparseSpMatSetAttribute(mat_upper_, CUSPARSE_SPMAT_DIAG_TYPE, &upper_diag, sizeof(upper_diag));
+
+      // Placeholder vectors for the analysis. Apply() rebinds the input and output
+      ret = cusparseCreateDnVec(&vec_in_, n_, tmp_.Data(), dt);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+      ret = cusparseCreateDnVec(&vec_tmp_, n_, tmp_.Data(), dt);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+      ret = cusparseCreateDnVec(&vec_out_, n_, tmp_.Data(), dt);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+
+      one_ = T(1);
+      const auto op_upper = kind_ == KrylovPrecond::IC0 ? TransposeOp() : CUSPARSE_OPERATION_NON_TRANSPOSE;
+      const auto alg = CUSPARSE_SPSV_ALG_DEFAULT;
+      size_t size_lower = 0;
+      size_t size_upper = 0;
+      cusparseSpSV_createDescr(&spsv_lower_);
+      cusparseSpSV_createDescr(&spsv_upper_);
+      ret = cusparseSpSV_bufferSize(handle_, CUSPARSE_OPERATION_NON_TRANSPOSE, &one_, mat_lower_, vec_in_, vec_tmp_,
+                                    dt, alg, spsv_lower_, &size_lower);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+      ret = cusparseSpSV_bufferSize(handle_, op_upper, &one_, mat_upper_, vec_tmp_, vec_out_,
+                                    dt, alg, spsv_upper_, &size_upper);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+      matxAlloc(&buf_lower_, std::max(size_lower, size_t{1}), MATX_ASYNC_DEVICE_MEMORY, stream_);
+      matxAlloc(&buf_upper_, std::max(size_upper, size_t{1}), MATX_ASYNC_DEVICE_MEMORY, stream_);
+      ret = cusparseSpSV_analysis(handle_, CUSPARSE_OPERATION_NON_TRANSPOSE, &one_, mat_lower_, vec_in_, vec_tmp_,
+                                  dt, alg, spsv_lower_, buf_lower_);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+      ret = cusparseSpSV_analysis(handle_, op_upper, &one_, mat_upper_, vec_tmp_, vec_out_,
+                                  dt, alg, spsv_upper_, buf_upper_);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxSolverError);
+    }
+
+    KrylovPrecond kind_;
+    index_t n_;
+    cudaStream_t stream_;
+    tensor_t<T, 1> dinv_;
+    tensor_t<T, 1> vals_;
+    tensor_t<T, 1> tmp_;
+    T one_{};
+    cusparseHandle_t handle_ = nullptr;
+    cusparseSpMatDescr_t mat_lower_ = nullptr;
+    cusparseSpMatDescr_t mat_upper_ = nullptr;
+    cusparseSpSVDescr_t spsv_lower_ = nullptr;
+    cusparseSpSVDescr_t spsv_upper_ = nullptr;
+    cusparseDnVecDescr_t vec_in_ = nullptr;
+    cusparseDnVecDescr_t vec_tmp_ = nullptr;
+    cusparseDnVecDescr_t vec_out_ = nullptr;
+    void *buf_lower_ = nullptr;
+    void *buf_upper_ = nullptr;
+};
+
+/**
+ * Host side of the convergence check shared by the Krylov solvers
+ *
+ * Every check_interval iterations the device counts whether ||r||^2 is still above tol^2 into an
+ * async_scalar_t. The host acts on the value recorded at the previous check, which has almost always
+ * completed by then, so it rarely waits on the device. The solvers freeze the iterate once converged,
+ * so the extra iterations this lag allows are harmless.
+ */
+class KrylovMonitor {
+  public:
+    KrylovMonitor(double tol, int check_interval, cudaStream_t stream) :
+      tol2_(tol > 0.0 ? tol * tol : -1.0), interval_(check_interval), stream_(stream),
+      active_(make_async_scalar<int>(MATX_ASYNC_DEVICE_MEMORY, stream)) {
+      MATX_ASSERT_STR(check_interval > 0, matxInvalidParameter, "check_interval must be positive");
+    }
+
+    double Tol2() const { return tol2_; }
+
+    template <typename RR>
+    bool Done(int iter, const RR &rr) {
+      if (tol2_ <= 0.0 || (iter + 1) % interval_ != 0) {
+        return false;
+      }
+
+      (active_.Tensor() = as_int(rr >= tol2_)).run(stream_);
+      if (pending_ && active_.Get() == 0) {
+        return true;
+      }
+
+      active_.Record(stream_);
+      pending_ = true;
+      return false;
+    }
+
+  private:
+    double tol2_;
+    int interval_;
+    cudaStream_t stream_;
+    async_scalar_t<int> active_;
+    bool pending_ = false;
+};
+
+template <typename Out, typename AOp, typename BOp>
+__MATX_INLINE__ void KrylovDot(Out &out, const AOp &a, const BOp &b, cudaStream_t stream) {
+  if constexpr (is_complex_v<typename AOp::value_type>) {
+    (out = sum(conj(a) * b)).run(stream);
+  }
+  else {
+    (out = sum(a * b)).run(stream);
+  }
+}
+
+template <typename XType, typename AType, typename BType>
+__MATX_INLINE__ void KrylovCheckArgs(const XType &X, const AType &A, const BType &B) {
+  using value_type = typename XType::value_type;
+  static_assert(XType::Rank() == 1 && BType::Rank() == 1 && AType::Rank() == 2,
+                "Krylov solvers require a rank-2 A and rank-1 X and B");
+  static_assert(is_krylov_type_v<value_type>, "Krylov solvers support float, double, and their complex types");
+  MATX_ASSERT_STR(A.Size(0) == A.Size(1) && A.Size(1) == X.Size(0) && X.Size(0) == B.Size(0), matxInvalidSize,
+                  "Krylov solvers require a square A matching the sizes of X and B");
+}
+
+} // namespace detail
+
+/**
+ * Preconditioned conjugate gradient solve of a Hermitian positive definite system
+ *
+ * X holds the initial guess on entry and the solution on exit. A may be dense or any sparse format
+ * supported by matvec.
+ *
+ * @param X Solution vector
+ * @param A Matrix
+ * @param B Right-hand side
+ * @param precond Preconditioner
+ * @param tol Residual norm to solve to. Values <= 0 always run max_iters
+ * @param max_iters Maximum iterations
+ * @param stream CUDA stream
+ * @param check_interval Iterations between host checks for early termination
+ */
+template <typename XType, typename AType, typename BType>
+__MATX_INLINE__ void pcgsolve_impl(XType X, const AType &A, const BType &B, KrylovPrecond precond,
+                                   double tol, int max_iters, cudaStream_t stream, int check_interval = 1)
+{
+  using T = typename XType::value_type;
+  using R = typename inner_op_type_t<T>::type;
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  detail::KrylovCheckArgs(X, A, B);
+
+  const index_t n = X.Size(0);
+  detail::KrylovPreconditioner<T, AType> M(A, precond, n, stream);
+  detail::KrylovMonitor monitor(tol, check_interval, stream);
+
+  auto r = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto z = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto p = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto Ap = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rz = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rz_new = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto pAp = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto alpha = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto beta = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rr = make_tensor<R>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  (Ap = matvec(A, X)).run(stream);
+  (r = B - Ap).run(stream);
+  (rr = sum(abs2(r))).run(stream);
+  M.Apply(z, r);
+  (p = z).run(stream);
+  detail::KrylovDot(rz, r, z, stream);
+
+#ifdef __CUDACC__
+  const double tol2 = monitor.Tol2();
+  for (int i = 0; i < max_iters; i++) {
+    (Ap = matvec(A, p)).run(stream);
+    detail::KrylovDot(pAp, p, Ap, stream);
+    detail::KrylovRatioKernel<<<1, 1, 0, stream>>>(alpha.Data(), rz.Data(), pAp.Data(), rr.Data(), tol2);
+
+    auto alpha_c = clone<1>(alpha, {n});
+    (X = X + alpha_c * p, r = r - alpha_c * Ap).run(stream);
+    (rr = sum(abs2(r))).run(stream);
+
+    M.Apply(z, r);
+    detail::KrylovDot(rz_new, r, z, stream);
+    detail::KrylovRatioKernel<<<1, 1, 0, stream>>>(beta.Data(), rz_new.Data(), rz.Data(), rr.Data(), tol2);
+    (p = z + clone<1>(beta, {n}) * p).run(stream);
+    swap(rz, rz_new);
+
+    if (monitor.Done(i, rr)) {
+      break;
+    }
+  }
+#endif
+}
+
+/**
+ * Pipelined preconditioned conjugate gradient solve of a Hermitian positive definite system
+ *
+ * Ghysels and Vanroose's pipelined CG. The three inner products of an iteration are computed in one fused
+ * reduction on a side stream while the preconditioner and matvec of the same iteration run on stream, so
+ * each iteration has a single global reduction that overlaps with the matvec.
+ *
+ * @param X Solution vector, holding the initial guess on entry
+ * @param A Matrix
+ * @param B Right-hand side
+ * @param precond Preconditioner
+ * @param tol Residual norm to solve to. Values <= 0 always run max_iters
+ * @param max_iters Maximum iterations
+ * @param stream CUDA stream
+ * @param check_interval Iterations between host checks for early termination
+ */
+template <typename XType, typename AType, typename BType>
+__MATX_INLINE__ void pipelined_cgsolve_impl(XType X, const AType &A, const BType &B, KrylovPrecond precond,
+                                            double tol, int max_iters, cudaStream_t stream, int check_interval = 1)
+{
+  using T = typename XType::value_type;
+  using R = typename inner_op_type_t<T>::type;
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  detail::KrylovCheckArgs(X, A, B);
+
+  const index_t n = X.Size(0);
+  detail::KrylovPreconditioner<T, AType> M(A, precond, n, stream);
+  detail::KrylovMonitor monitor(tol, check_interval, stream);
+
+  const int nparts = static_cast<int>(cuda::std::min(
+      (n + CGSOLVE_THREADS - 1) / CGSOLVE_THREADS, static_cast<index_t>(CGSOLVE_MAX_PARTIALS)));
+
+  auto r = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto u = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto w = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto m = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto nv = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto z = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto q = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto s = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto p = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto part = make_tensor<T>({3 * nparts}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto coef = make_tensor<T>({4}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rr = make_tensor<R>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  (w = matvec(A, X)).run(stream);
+  (r = B - w).run(stream);
+  M.Apply(u, r);
+  (w = matvec(A, u)).run(stream);
+  (z = zeros(), q = zeros(), s = zeros(), p = zeros()).run(stream);
+
+#ifdef __CUDACC__
+  cudaStream_t side;
+  cudaEvent_t fork, join;
+  MATX_CUDA_CHECK(cudaStreamCreateWithFlags(&side, cudaStreamNonBlocking));
+  MATX_CUDA_CHECK(cudaEventCreateWithFlags(&fork, cudaEventDisableTiming));
+  MATX_CUDA_CHECK(cudaEventCreateWithFlags(&join, cudaEventDisableTiming));
+
+  const double tol2 = monitor.Tol2();
+  for (int i = 0; i < max_iters; i++) {
+    // gamma, delta and ||r||^2 in one reduction, overlapped with m = M w and n = A m
+    MATX_CUDA_CHECK(cudaEventRecord(fork, stream));
+    MATX_CUDA_CHECK(cudaStreamWaitEvent(side, fork, 0));
+    detail::KrylovPipeDotsKernel<<<nparts, CGSOLVE_THREADS, 0, side>>>(r.Data(), u.Data(), w.Data(), part.Data(), n);
+    MATX_CUDA_CHECK(cudaEventRecord(join, side));
+
+    M.Apply(m, w);
+    (nv = matvec(A, m)).run(stream);
+
+    MATX_CUDA_CHECK(cudaStreamWaitEvent(stream, join, 0));
+    detail::KrylovPipeCoeffKernel<<<1, 1, 0, stream>>>(coef.Data(), rr.Data(), part.Data(), nparts, i == 0, tol2);
+    detail::KrylovPipeUpdateKernel<<<nparts, CGSOLVE_THREADS, 0, stream>>>(
+        X, r.Data(), u.Data(), w.Data(), z.Data(), q.Data(), s.Data(), p.Data(), m.Data(), nv.Data(), coef.Data(), n);
+
+    if (monitor.Done(i, rr)) {
+      break;
+    }
+  }
+
+  cudaEventDestroy(fork);
+  cudaEventDestroy(join);
+  cudaStreamDestroy(side);
+#endif
+}
+
+/**
+ * Preconditioned BiCGStab solve of a general square system
+ *
+ * Right-preconditioned stabilized bi-conjugate gradient. Each iteration does two matvecs and two
+ * preconditioner applications.
+ *
+ * @param X Solution vector, holding the initial guess on entry
+ * @param A Matrix
+ * @param B Right-hand side
+ * @param precond Preconditioner
+ * @param tol Residual norm to solve to. Values <= 0 always run max_iters
+ * @param max_iters Maximum iterations
+ * @param stream CUDA stream
+ * @param check_interval Iterations between host checks for early termination
+ */
+template <typename XType, typename AType, typename BType>
+__MATX_INLINE__ void bicgstabsolve_impl(XType X, const AType &A, const BType &B, KrylovPrecond precond,
+                                        double tol, int max_iters, cudaStream_t stream, int check_interval = 1)
+{
+  using T = typename XType::value_type;
+  using R = typename inner_op_type_t<T>::type;
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  detail::KrylovCheckArgs(X, A, B);
+
+  const index_t n = X.Size(0);
+  detail::KrylovPreconditioner<T, AType> M(A, precond, n, stream);
+  detail::KrylovMonitor monitor(tol, check_interval, stream);
+
+  auto r = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rhat = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto p = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto v = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto phat = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto s = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto shat = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto t = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rho = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rho_new = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto alpha = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto omega = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto beta = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto num = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto den = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rr = make_tensor<R>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  (v = matvec(A, X)).run(stream);
+  (r = B - v, rhat = B - v).run(stream);
+  (p = zeros(), v = zeros()).run(stream);
+  (rho = ones(), alpha = ones(), omega = ones()).run(stream);
+  (rr = sum(abs2(r))).run(stream);
+
+#ifdef __CUDACC__
+  const double tol2 = monitor.Tol2();
+  for (int i = 0; i < max_iters; i++) {
+    detail::KrylovDot(rho_new, rhat, r, stream);
+    detail::KrylovBiCGStabBetaKernel<<<1, 1, 0, stream>>>(
+        beta.Data(), rho_new.Data(), rho.Data(), alpha.Data(), omega.Data(), rr.Data(), tol2);
+    (p = r + clone<1>(beta, {n}) * (p - clone<1>(omega, {n}) * v)).run(stream);
+
+    M.Apply(phat, p);
+    (v = matvec(A, phat)).run(stream);
+    detail::KrylovDot(den, rhat, v, stream);
+    detail::KrylovRatioKernel<<<1, 1, 0, stream>>>(alpha.Data(), rho_new.Data(), den.Data(), rr.Data(), tol2);
+    (s = r - clone<1>(alpha, {n}) * v).run(stream);
+
+    M.Apply(shat, s);
+    (t = matvec(A, shat)).run(stream);
+    detail::KrylovDot(num, t, s, stream);
+    detail::KrylovDot(den, t, t, stream);
+    detail::KrylovRatioKernel<<<1, 1, 0, stream>>>(omega.Data(), num.Data(), den.Data(), rr.Data(), tol2);
+
+    auto omega_c = clone<1>(omega, {n});
+    (X = X + clone<1>(alpha, {n}) * phat + omega_c * shat, r = s - omega_c * t).run(stream);
+    (rr = sum(abs2(r))).run(stream);
+    swap(rho, rho_new);
+
+    if (monitor.Done(i, rr)) {
+      break;
+    }
+  }
+#endif
+}
+
+/**
+ * Restarted GMRES solve of a general square system
+ *
+ * Right-preconditioned GMRES(restart) with classical Gram-Schmidt applied twice for the Arnoldi basis.
+ * The Hessenberg least-squares problem is updated with Givens rotations on the device, so the residual
+ * estimate is available every iteration without a host round trip.
+ *
+ * @param X Solution vector, holding the initial guess on entry
+ * @param A Matrix
+ * @param B Right-hand side
+ * @param restart Krylov subspace size before restarting
+ * @param precond Preconditioner
+ * @param tol Residual norm to solve to. Values <= 0 always run max_iters
+ * @param max_iters Maximum total iterations
+ * @param stream CUDA stream
+ * @param check_interval Iterations between host checks for early termination
+ */
+template <typename XType, typename AType, typename BType>
+__MATX_INLINE__ void gmressolve_impl(XType X, const AType &A, const BType &B, int restart, KrylovPrecond precond,
+                                     double tol, int max_iters, cudaStream_t stream, int check_interval = 1)
+{
+  using T = typename XType::value_type;
+  using R = typename inner_op_type_t<T>::type;
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  detail::KrylovCheckArgs(X, A, B);
+  MATX_ASSERT_STR(restart > 0, matxInvalidParameter, "gmres: restart must be positive");
+
+  const index_t n = X.Size(0);
+  const index_t mr = restart;
+  detail::KrylovPreconditioner<T, AType> M(A, precond, n, stream);
+  detail::KrylovMonitor monitor(tol, check_interval, stream);
+
+  auto V = make_tensor<T>({mr + 1, n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto H = make_tensor<T>({mr + 1, mr}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto hj = make_tensor<T>({mr + 1}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto h2 = make_tensor<T>({mr + 1}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto cs = make_tensor<T>({mr}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto sn = make_tensor<T>({mr}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto g = make_tensor<T>({mr + 1}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto y = make_tensor<T>({mr}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto w = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto tmp = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto inv = make_tensor<T>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto nrm2 = make_tensor<R>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto rr = make_tensor<R>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+
+#ifdef __CUDACC__
+  int iter = 0;
+  bool done = false;
+  while (!done && iter < max_iters) {
+    // r = B - A*X, v0 = r / ||r||
+    (w = matvec(A, X)).run(stream);
+    (w = B - w).run(stream);
+    (nrm2 = sum(abs2(w))).run(stream);
+    detail::KrylovGmresStartKernel<<<1, 1, 0, stream>>>(g.Data(), inv.Data(), nrm2.Data(), static_cast<int>(mr + 1));
+    auto v0 = slice<1>(V, {0, 0}, {matxDropDim, matxEnd});
+    (v0 = w * clone<1>(inv, {n})).run(stream);
+
+    int k = 0;
+    for (int j = 0; j < restart && iter < max_iters; j++, iter++) {
+      auto vj = slice<1>(V, {j, 0}, {matxDropDim, matxEnd});
+      M.Apply(tmp, make_tensor<T>(vj.Data(), {n}));
+      (w = matvec(A, tmp)).run(stream);
+
+      // Classical Gram-Schmidt, twice
+      auto Vj = slice(V, {0, 0}, {j + 1, matxEnd});
+      auto hv = slice(hj, {0}, {j + 1});
+      auto h2v = slice(h2, {0}, {j + 1});
+      if constexpr (is_complex_v<T>) {
+        (hv = sum(conj(Vj) * clone<2>(w, {j + 1, matxKeepDim}), {1})).run(stream);
+      }
+      else {
+        (hv = sum(Vj * clone<2>(w, {j + 1, matxKeepDim}), {1})).run(stream);
+      }
+      (w = w - sum(Vj * clone<2>(hv, {matxKeepDim, n}), {0})).run(stream);
+      if constexpr (is_complex_v<T>) {
+        (h2v = sum(conj(Vj) * clone<2>(w, {j + 1, matxKeepDim}), {1})).run(stream);
+      }
+      else {
+        (h2v = sum(Vj * clone<2>(w, {j + 1, matxKeepDim}), {1})).run(stream);
+      }
+      (w = w - sum(Vj * clone<2>(h2v, {matxKeepDim, n}), {0}), hv = hv + h2v).run(stream);
+
+      (nrm2 = sum(abs2(w))).run(stream);
+      detail::KrylovArnoldiNormKernel<<<1, 1, 0, stream>>>(hj.Data() + j + 1, inv.Data(), nrm2.Data());
+      auto vj1 = slice<1>(V, {j + 1, 0}, {matxDropDim, matxEnd});
+      (vj1 = w * clone<1>(inv, {n})).run(stream);
+
+      detail::KrylovGivensKernel<<<1, 1, 0, stream>>>(H.Data(), mr, cs.Data(), sn.Data(), g.Data(), hj.Data(), j, rr.Data());
+      k = j + 1;
+
+      if (monitor.Done(iter, rr)) {
+        done = true;
+        iter++;
+        break;
+      }
+    }
+
+    // X += M^-1 (V y)
+    detail::KrylovBackSubKernel<<<1, 1, 0, stream>>>(H.Data(), mr, g.Data(), y.Data(), k);
+    auto Vk = slice(V, {0, 0}, {k, matxEnd});
+    auto yk = slice(y, {0}, {k});
+    (w = sum(Vk * clone<2>(yk, {matxKeepDim, n}), {0})).run(stream);
+    M.Apply(tmp, w);
+    (X = X + tmp).run(stream);
+  }
+#endif
+}
+
+} // end namespace matx
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/executors/support.h"
+#include "matx/operators/diag.h"
+#include "matx/operators/sum.h"
+#include "matx/operators/unary_operators.h"
+#include "matx/transforms/chol/chol_cuda.h"
+#include "matx/transforms/lu/lu_cuda.h"
+#include "matx/transforms/solve/solve_cuda.h"
+#ifdef MATX_EN_CPU_SOLVER
+  #include "matx/transforms/chol/chol_lapack.h"
+  #include "matx/transforms/lu/lu_lapack.h"
+#endif
+
+namespace matx {
+
+namespace detail {
+
+// log(det(A)) from the diagonal of a Cholesky factor, or log|det(A)| from the diagonal of U
+template <typename OutputTensor, typename FactorTensor, typename Executor>
+void logdet_from_factor(OutputTensor &out, const FactorTensor &factor, LogDetMethod method, const Executor &exec)
+{
+  using real_type = typename OutputTensor::value_type;
+  constexpr int RANK = FactorTensor::Rank();
+  if (method == LogDetMethod::CHOLESKY) {
+    (out = real_type(2) * sum(log(real(diag(factor))), {RANK - 2})).run(exec);
+  }
+  else {
+    (out = sum(log(abs(diag(factor))), {RANK - 2})).run(exec);
+  }
+}
+
+} // end namespace detail
+
+/**
+ * Compute the log-determinant of a matrix
+ *
+ * The log of the determinant is the sum of the logs of the diagonal of the factor, which
+ * does not overflow or underflow the way the product in det() does for large matrices.
+ *
+ * @param out
+ *   Output tensor of real type with the batch shape of a
+ * @param a
+ *   Input matrix A
+ * @param exec
+ *   Executor
+ * @param method
+ *   Factorization to use
+ */
+template <typename OutputTensor, typename InputTensor, typename Executor>
+void logdet_impl(OutputTensor &out, const InputTensor &a, const Executor &exec, LogDetMethod method)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  MATX_ASSERT_STR(!(is_host_executor_v<Executor> && !MATX_EN_CPU_SOLVER), matxInvalidExecutor,
+    "Trying to run a host Solver executor but host Solver support is not configured");
+
+  static_assert(OutputTensor::Rank() == InputTensor::Rank() - 2, "Output tensor rank must be 2 less than input for logdet()");
+  static_assert(!is_complex_v<typename OutputTensor::value_type>, "logdet() output must be real");
+  constexpr int RANK = InputTensor::Rank();
+  using value_type = typename InputTensor::value_type;
+  using piv_value_type = std::conditional_t<is_cuda_executor_v<Executor>, int64_t, lapack_int_t>;
+
+  MATX_ASSERT_STR(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize, "logdet() requires square matrices");
+
+  tensor_t<value_type, RANK> ac;
+  if constexpr (is_cuda_executor_v<Executor>) {
+    make_tensor(ac, a.Shape(), MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  } else {
+    make_tensor(ac, a.Shape(), MATX_HOST_MALLOC_MEMORY);
+  }
+
+  if (method == LogDetMethod::CHOLESKY) {
+    chol_impl(ac, a, exec, SolverFillMode::LOWER);
+  }
+  else {
+    cuda::std::array<index_t, RANK - 1> s;
+    for (int i = 0; i < RANK - 2; i++) {
+      s[i] = a.Size(i);
+    }
+    s[RANK - 2] = a.Size(RANK - 1);
+
+    tensor_t<piv_value_type, RANK - 1> piv;
+    if constexpr (is_cuda_executor_v<Executor>) {
+      make_tensor(piv, s, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+    } else {
+      make_tensor(piv, s, MATX_HOST_MALLOC_MEMORY);
+    }
+    lu_impl(ac, piv, a, exec);
+  }
+
+  detail::logdet_from_factor(out, ac, method, exec);
+}
+
+/**
+ * Solve A X^T = B^T and compute the log-determinant of A from the same factorization
+ *
+ * A Gaussian log-likelihood needs both A^-1 b and log(det(A)). Calling solve() and logdet() separately
+ * factors A twice; here the diagonal of the factors left by the solve gives the log-determinant.
+ *
+ * @param x
+ *   Solution, the same shape as B
+ * @param ld
+ *   Rank-0 log-determinant of A
+ * @param a
+ *   Rank-2 square matrix A
+ * @param b
+ *   Rank-1 right-hand side, or rank-2 with one right-hand side per row
+ * @param exec
+ *   CUDA executor
+ * @param method
+ *   Factorization to use
+ */
+template <typename XTensor, typename LdTensor, typename ATensor, typename BTensor>
+void solve_logdet_impl(XTensor &&x, LdTensor &&ld, const ATensor &a, const BTensor &b,
+                       const cudaExecutor &exec, LogDetMethod method)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T = typename ATensor::value_type;
+  constexpr int BRANK = BTensor::Rank();
+  MATX_STATIC_ASSERT_STR(ATensor::Rank() == 2, matxInvalidDim, "solve_logdet() requires a rank-2 A");
+  MATX_STATIC_ASSERT_STR(BRANK == 1 || BRANK == 2, matxInvalidDim, "solve_logdet() requires a rank-1 or rank-2 B");
+  MATX_STATIC_ASSERT_STR(remove_cvref_t<LdTensor>::Rank() == 0, matxInvalidDim, "solve_logdet() log-determinant output must be rank 0");
+  MATX_STATIC_ASSERT_STR((std::is_same_v<T, typename BTensor::value_type>), matxInvalidType,
+                         "A and B types must match in solve_logdet()");
+
+  const index_t n = a.Size(1);
+  MATX_ASSERT_STR(a.Size(0) == n, matxInvalidSize, "solve_logdet() requires a square A");
+  MATX_ASSERT_STR(b.Size(BRANK - 1) == n, matxInvalidSize, "Rows of B must have as many elements as A has columns");
+
+  const auto stream = exec.getStream();
+  auto allocate_tensor = [&](auto shape) {
+    detail::ScratchScope scratch{stream};
+    return make_tensor<T>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  };
+
+  // The diagonal is the same in the column-major factors, so they are read without transposing back
+  auto at = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+  auto bt = allocate_tensor(Shape(b));
+  auto xt = allocate_tensor(Shape(b));
+  (at = transpose_matrix(a)).run(exec);
+  (bt = b).run(exec);
+
+  detail::dense_solve_factored(xt.Data(), at.Data(), bt.Data(), n, BRANK == 1 ? 1 : b.Size(0),
+                               SolvePrecision::FULL, method == LogDetMethod::CHOLESKY, exec);
+
+  (x = xt).run(exec);
+  detail::logdet_from_factor(ld, at, method, exec);
+}
+
+} // end namespace matx
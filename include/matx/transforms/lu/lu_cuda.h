@@ -96,7 +96,7 @@ public:
                        const ATensor &a,
                        const cudaExecutor &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK-1 == PivotTensor::Rank(), matxInvalidDim, "Pivot tensor rank must be one less than output");
@@ -140,7 +140,7 @@ public:
   void Exec(OutputTensor &out, PivotTensor &piv,
             const ATensor &a, const cudaExecutor &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Batch size checks
     for(int i = 0 ; i < RANK-2; i++) {
@@ -264,7 +264,7 @@ template <typename OutputTensor, typename PivotTensor, typename ATensor>
 void lu_impl(OutputTensor &&out, PivotTensor &&piv,
         const ATensor &a, const cudaExecutor &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
     
   using T1 = typename remove_cvref_t<OutputTensor>::value_type;
 
@@ -94,7 +94,7 @@ public:
   matxDnLUHostPlan_t(PivotTensor &piv,
                        const ATensor &a)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK-1 == PivotTensor::Rank(), matxInvalidDim, "Pivot tensor rank must be one less than output");
@@ -127,7 +127,7 @@ public:
   void Exec(OutputTensor &out, PivotTensor &piv,
             const ATensor &a, const HostExecutor<MODE> &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Batch size checks
     for(int i = 0 ; i < RANK-2; i++) {
@@ -146,18 +146,19 @@ public:
       (out = a).run(exec);
     }
 
-    lapack_int_t info;
-    for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
+    const lapack_int_t info = this->ExecBatches(exec, [&](size_t i, void *, void *, void *) {
+      lapack_int_t batch_info;
       getrf_dispatch(&params.m, &params.n, reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
-                     &params.m, reinterpret_cast<T2*>(this->batch_piv_ptrs[i]), &info);
-
-      if (info < 0) {
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
-          ("Parameter " + std::to_string(-info) + " had an illegal value in LAPACK getrf").c_str());
-      } else {
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError, 
-          ("U is singular: U(" + std::to_string(info) + "," + std::to_string(info) + ") = 0 in LAPACK getrf").c_str());
-      }
+                     &params.m, reinterpret_cast<T2*>(this->batch_piv_ptrs[i]), &batch_info);
+      return batch_info;
+    });
+
+    if (info < 0) {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        ("Parameter " + std::to_string(-info) + " had an illegal value in LAPACK getrf").c_str());
+    } else {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, 
+        ("U is singular: U(" + std::to_string(info) + "," + std::to_string(info) + ") = 0 in LAPACK getrf").c_str());
     }
   }
 
@@ -225,7 +226,7 @@ void lu_impl([[maybe_unused]] OutputTensor &&out,
              [[maybe_unused]] const ATensor &a,
              [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   MATX_ASSERT_STR(MATX_EN_CPU_SOLVER, matxInvalidExecutor,
     "Trying to run a host Solver executor but host Solver support is not configured");
 #if MATX_EN_CPU_SOLVER
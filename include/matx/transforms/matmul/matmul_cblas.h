@@ -49,6 +49,7 @@
     #define nvpl_dcomplex_t cuda::std::complex<double>
   #endif
   #include <nvpl_blas_cblas.h>
+  #include <nvpl_blas_service.h>
   using cblas_int_t = nvpl_int_t;
 #elif defined(MATX_EN_OPENBLAS)
   #include <cblas.h>
@@ -110,7 +111,7 @@ static MatMulCBLASParams_t GetGemmParams(TensorTypeC &c,
                                          const TensorTypeA &a,
                                          const TensorTypeB &b)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   static constexpr int RANK = TensorTypeC::Rank();
 
   /* If a user passes in a tensor where the last two dimensions are transposed
@@ -241,7 +242,7 @@ __MATX_INLINE__ void matmul_exec(TensorTypeC &c,
                                  const float beta,
                                  [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   static constexpr int RANK = TensorTypeC::Rank();
   using value_type = typename TensorTypeC::value_type;
@@ -275,6 +276,7 @@ __MATX_INLINE__ void matmul_exec(TensorTypeC &c,
   }
 
 #ifdef MATX_EN_NVPL
+  nvpl_blas_set_num_threads_local(exec.GetNumThreads());
   if constexpr (RANK <= 3) {
     auto a_ptr = a.Data();
     auto b_ptr = b.Data();
@@ -404,7 +406,7 @@ __MATX_INLINE__ void matmul_dispatch(TensorTypeC &c,
                                      const float beta,
                                      const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   static constexpr int RANK = TensorTypeC::Rank();
 
@@ -490,7 +492,7 @@ void matmul_impl([[maybe_unused]] TensorTypeC C,
                  [[maybe_unused]] float alpha = 1.0,
                  [[maybe_unused]] float beta = 0.0)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   MATX_ASSERT_STR(MATX_EN_CPU_MATMUL, matxInvalidExecutor, "Trying to run MatMul on host executor but host MatMul support is not configured");
 
 #if MATX_EN_CPU_MATMUL
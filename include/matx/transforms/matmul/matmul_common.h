@@ -32,8 +32,30 @@
 
 #pragma once
 
+#include "matx/core/error.h"
+#include "matx/core/type_utils.h"
+#include "matx/operators/binary_operators.h"
+#include "matx/operators/clone.h"
+#include "matx/operators/unary_operators.h"
+
 namespace matx {
 
+/**
+ * Element-wise epilogue applied to the output of a GEMM
+ *
+ * The bias is a rank-1 tensor with one value per row of C (C.Size(C.Rank() - 2)) and is
+ * broadcast across the columns and any batch dimensions. GELU uses the tanh approximation.
+ * Epilogues are only supported for real types.
+ */
+enum class MatMulEpilogue_t {
+  NONE,       ///< No epilogue
+  RELU,       ///< max(C, 0)
+  GELU,       ///< GELU of C
+  BIAS,       ///< C + bias
+  RELU_BIAS,  ///< max(C + bias, 0)
+  GELU_BIAS,  ///< GELU of C + bias
+};
+
 namespace detail {
 
 union MatMulScaleType_t {
@@ -42,7 +64,69 @@ union MatMulScaleType_t {
   float cf32[2];
   double cf64[2];
 };
-    
+
+// Placeholder bias type for epilogues without a bias
+struct matmul_no_bias_t {};
+
+__MATX_INLINE__ constexpr bool MatMulEpilogueHasBias(MatMulEpilogue_t epilogue) {
+  return epilogue == MatMulEpilogue_t::BIAS || epilogue == MatMulEpilogue_t::RELU_BIAS ||
+         epilogue == MatMulEpilogue_t::GELU_BIAS;
+}
+
+/**
+ * Apply a GEMM epilogue to C as a separate element-wise pass
+ *
+ * This is the fallback for providers or layouts where the epilogue cannot be fused into the
+ * GEMM itself.
+ */
+template <typename TensorTypeC, typename BiasType, typename Executor>
+void apply_matmul_epilogue(TensorTypeC &C, [[maybe_unused]] const BiasType &bias, MatMulEpilogue_t epilogue,
+                           [[maybe_unused]] const Executor &exec) {
+  using T = typename TensorTypeC::value_type;
+  constexpr int RANK = TensorTypeC::Rank();
+
+  if (epilogue == MatMulEpilogue_t::NONE) {
+    return;
+  }
+
+  if constexpr (is_complex_v<T>) {
+    MATX_THROW(matxInvalidType, "GEMM epilogues are only supported for real types");
+  }
+  else {
+    auto activate = [&](const auto &x) {
+      if (epilogue == MatMulEpilogue_t::RELU || epilogue == MatMulEpilogue_t::RELU_BIAS) {
+        (C = matx::max(x, static_cast<T>(0.0f))).run(exec);
+      }
+      else if (epilogue == MatMulEpilogue_t::GELU || epilogue == MatMulEpilogue_t::GELU_BIAS) {
+        (C = static_cast<T>(0.5f) * x * (static_cast<T>(1.0f) +
+              matx::tanh(static_cast<T>(0.7978845608f) * (x + static_cast<T>(0.044715f) * x * x * x)))).run(exec);
+      }
+      else {
+        (C = x).run(exec);
+      }
+    };
+
+    if (MatMulEpilogueHasBias(epilogue)) {
+      if constexpr (std::is_same_v<BiasType, matmul_no_bias_t>) {
+        MATX_THROW(matxInvalidParameter, "GEMM epilogue requires a bias tensor");
+      }
+      else {
+        MATX_ASSERT_STR(bias.Size(0) == C.Size(RANK - 2), matxInvalidSize,
+            "GEMM bias must have one element per row of the output");
+        cuda::std::array<index_t, RANK> shape;
+        for (int i = 0; i < RANK; i++) {
+          shape[i] = C.Size(i);
+        }
+        shape[RANK - 2] = matxKeepDim;
+        activate(C + clone<RANK>(bias, shape));
+      }
+    }
+    else {
+      activate(C);
+    }
+  }
+}
+
 } // end namespace detail
 
 
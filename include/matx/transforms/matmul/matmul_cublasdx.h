@@ -367,7 +367,18 @@ namespace matx {
         return true;
       }
 
-      std::string GetFuncStr(const std::string &gemm_func_name, float alpha, float beta) const {
+      // Builds the argument list for loading an operand of rank in_rank: the batch
+      // dimensions are taken from the trailing batch indices of the output
+      static std::string BatchIndexStr(int out_rank, int in_rank) {
+        std::string idx;
+        for (int r = 0; r < in_rank - 2; r++) {
+          idx += "out_idx[" + std::to_string(out_rank - in_rank + r) + "], ";
+        }
+        return idx;
+      }
+
+      std::string GetFuncStr(const std::string &gemm_func_name, float alpha, float beta,
+                             int out_rank, int a_rank, int b_rank) const {
         std::string result = R"(
           using value_type = )";
         result += detail::type_to_string<InputType>();
@@ -390,38 +401,47 @@ namespace matx {
           value_type* smem_b = reinterpret_cast<value_type*>(smem + a_size);
           value_type* smem_c = reinterpret_cast<value_type*>(smem + a_size + b_size);
           
-          // Cooperatively load A and B from global to shared memory using operator()
-          // Batch indices are already preset in the operators, so we only need 2D matrix indices
           const int tid = threadIdx.x + threadIdx.y * blockDim.x + threadIdx.z * blockDim.x * blockDim.y;
           const int total_threads = blockDim.x * blockDim.y * blockDim.z;
-          // Load A matrix (m x k) - each thread loads multiple elements strided by total_threads
-          constexpr index_t a_cols = )";
+          const cuda::std::array<index_t, sizeof...(Is)> out_idx{static_cast<index_t>(indices)...};
+          constexpr index_t c_cols = )";
+        result += std::to_string(static_cast<int>(n_));
+        result += R"(;
+          const index_t out_flat = out_idx[sizeof...(Is) - 2] * c_cols + out_idx[sizeof...(Is) - 1];
+
+          // The kernel walks the output tile in passes of total_threads elements. Only the first
+          // pass computes the GEMM; later passes read the tile already sitting in shared memory.
+          if (out_flat < total_threads) {
+            // Cooperatively load A and B from global to shared memory using operator(). The
+            // batch indices come from the output indices, which are uniform across the block.
+            // Load A matrix (m x k) - each thread loads multiple elements strided by total_threads
+            constexpr index_t a_cols = )";
         result += std::to_string(static_cast<int>(k_));
         result += R"(;
-          for (int i = tid; i < )";
+            for (int i = tid; i < )";
         result += std::to_string(static_cast<int>(m_ * k_));
         result += R"(; i += total_threads) {
-            const index_t row = i / a_cols;
-            const index_t col = i % a_cols;
-            smem_a[row * a_cols + col] = a_.template operator()<CapType>(row, col);
-          }
+              const index_t row = i / a_cols;
+              const index_t col = i % a_cols;
+              smem_a[row * a_cols + col] = a_.template operator()<CapType>()" + BatchIndexStr(out_rank, a_rank) + R"(row, col);
+            }
           
-          // Load B matrix (k x n) - each thread loads multiple elements strided by total_threads
-          constexpr index_t b_cols = )";
+            // Load B matrix (k x n) - each thread loads multiple elements strided by total_threads
+            constexpr index_t b_cols = )";
         result += std::to_string(static_cast<int>(n_));
         result += R"(;
-          for (int i = tid; i < )";
+            for (int i = tid; i < )";
         result += std::to_string(static_cast<int>(k_ * n_));
         result += R"(; i += total_threads) {
-            const index_t row = i / b_cols;
-            const index_t col = i % b_cols;
-            smem_b[row * b_cols + col] = b_.template operator()<CapType>(row, col);
-          }
+              const index_t row = i / b_cols;
+              const index_t col = i % b_cols;
+              smem_b[row * b_cols + col] = b_.template operator()<CapType>()" + BatchIndexStr(out_rank, b_rank) + R"(row, col);
+            }
           
-          __syncthreads();
+            __syncthreads();
           
-          // Call the cuBLASDx generated GEMM function
-          // Signature: void func(value_type* alpha, value_type* a, value_type* b, value_type* beta, value_type* c)
+            // Call the cuBLASDx generated GEMM function
+            // Signature: void func(value_type* alpha, value_type* a, value_type* b, value_type* beta, value_type* c)
         )";
         using literal_type = cuda::std::conditional_t<
             std::is_same_v<InputType, double> || std::is_same_v<InputType, cuda::std::complex<double>>,
@@ -432,15 +452,17 @@ namespace matx {
         result += gemm_func_name;
         result += R"((&alpha_val, smem_a, smem_b, &beta_val, smem_c);
           
-          __syncthreads();
+            __syncthreads();
+          }
           
-          // Each thread returns its portion of the result
-          // For vectorized execution, return a Vector; for scalar, return scalar
+          // Each thread returns its element of the result
           static_assert(CapType::ept == ElementsPerThread::ONE, "cuBLASDx only supports ONE elements per thread");
-          if constexpr (CapType::ept == ElementsPerThread::ONE) {
-            const int output_idx = threadIdx.x;
-            return smem_c[output_idx];
+          if (out_flat >= )";
+        result += std::to_string(static_cast<int>(m_ * n_));
+        result += R"() {
+            return value_type{};
           }
+          return static_cast<value_type>(smem_c[out_flat]);
         )";
 
         return result;
@@ -39,14 +39,23 @@
 #include "cutlass/gemm/device/gemm_batched.h"
 #endif
 
+#include <atomic>
 #include <cstdio>
+#include <cstring>
+#include <limits>
+#include <mutex>
 #include <numeric>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "cublas_v2.h"
 #include "matx/core/cache.h"
 #include "matx/core/error.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/tensor.h"
+#include "matx/kernels/matmul_complex.cuh"
 #include "matx/transforms/matmul/matmul_common.h"
 
 namespace matx {
@@ -138,6 +147,86 @@ struct MatMulCUDAParams_t {
   MatXDataType_t dtype;
   cublasOperation_t opA;
   cublasOperation_t opB;
+  MatMulEpilogue_t epilogue = MatMulEpilogue_t::NONE;
+};
+
+// Number of cuBLASLt heuristic candidates benchmarked when autotuning
+static constexpr int MATMUL_AUTOTUNE_DEFAULT_CANDIDATES = 8;
+
+/**
+ * Process-wide record of autotuned cuBLASLt algorithm choices
+ *
+ * Each entry maps a GEMM shape/type/GPU key to the index of the fastest algorithm in the list
+ * returned by cublasLtMatmulAlgoGetHeuristic. The heuristic list is deterministic for a given
+ * key, which includes the cuBLASLt version, so the index identifies the same algorithm in later
+ * processes. Entries are persisted to a text file in the kernel cache directory.
+ */
+class MatMulAutotuneCache {
+public:
+  static MatMulAutotuneCache &Get() {
+    static MatMulAutotuneCache cache;
+    return cache;
+  }
+
+  void SetEnabled(bool enabled, int candidates) {
+    enabled_ = enabled;
+    candidates_ = std::max(1, candidates);
+  }
+
+  bool Enabled() const { return enabled_; }
+  int Candidates() const { return candidates_; }
+
+  bool Lookup(const std::string &key, int &index) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    Load();
+    auto it = choices_.find(key);
+    if (it == choices_.end()) {
+      return false;
+    }
+    index = it->second;
+    return true;
+  }
+
+  void Store(const std::string &key, int index) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    Load();
+    choices_[key] = index;
+
+    std::string contents;
+    for (const auto &[k, v] : choices_) {
+      contents += k + " " + std::to_string(v) + "\n";
+    }
+    GetCache().WriteKernelCacheFile(FILENAME, contents.data(), contents.size());
+  }
+
+private:
+  static constexpr const char *FILENAME = "cublaslt_autotune.txt";
+
+  MatMulAutotuneCache() {
+    const char *env = std::getenv("MATX_MATMUL_AUTOTUNE");
+    enabled_ = env != nullptr && std::strcmp(env, "0") != 0;
+  }
+
+  // Must be called with mtx_ held
+  void Load() {
+    if (loaded_) {
+      return;
+    }
+    loaded_ = true;
+
+    std::istringstream in(GetCache().ReadKernelCacheFile(FILENAME));
+    std::string key;
+    int index;
+    while (in >> key >> index) {
+      choices_[key] = index;
+    }
+  }
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<int> candidates_{MATMUL_AUTOTUNE_DEFAULT_CANDIDATES};
+  bool loaded_ = false;
+  std::unordered_map<std::string, int> choices_;
+  std::mutex mtx_;
 };
 
 template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB,
@@ -180,12 +269,14 @@ public:
    *   A matrix view
    * @param b
    *   B matrix view
+   * @param epilogue
+   *   Epilogue to fuse into the GEMM if the provider supports it
    *
    */
   MatMulCUDAHandle_t(TensorTypeC &c, const TensorTypeA &a,
-                     const TensorTypeB &b)
+                     const TensorTypeB &b, MatMulEpilogue_t epilogue = MatMulEpilogue_t::NONE)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     static_assert(RANK >= 2);
     MATX_ASSERT(a.Size(TensorTypeA::Rank() - 1) == b.Size(TensorTypeB::Rank() - 2), matxInvalidSize);
@@ -204,6 +295,7 @@ public:
 
     // This must come before the things below to properly set class parameters
     params_ = GetGemmParams(c, a, b);
+    params_.epilogue = epilogue;
 
     if constexpr (PROV == PROVIDER_TYPE_CUBLASLT) {
       // The recommended cublas workspace size is 4 MiB for pre-Hopper and 32 MiB for Hopper+:
@@ -211,11 +303,10 @@ public:
       // Thus, try to detect if we are running on Hopper or newer and use a 32 MiB workspace
       // if so. Otherwise, default to 4 MiB, which still works on Hopper+.
       constexpr size_t MiB = 1024*1024;
+      // The workspace itself is not owned by the handle. It is borrowed from the per-stream
+      // workspace cache at execution time so that all GEMMs on a stream share one buffer.
       workspaceSize = detail::IsHopperOrAbove() ? 32*MiB : 4*MiB;
 
-      // Workspace buffer
-      matxAlloc((void **)&workspace, workspaceSize, MATX_DEVICE_MEMORY);
-
       ConfigureCublasLt();
     }
 
@@ -442,14 +533,11 @@ public:
   /**
    * GEMM handle destructor
    *
-   * Destroys any helper data used for provider type and any workspace memory
-   * created
+   * Destroys any helper data used for provider type
    *
    */
   ~MatMulCUDAHandle_t()
   {
-    matxFree(workspace);
-
     if constexpr (PROV == PROVIDER_TYPE_CUBLASLT) {
       cublasLtMatmulPreferenceDestroy(preference);
       cublasLtMatrixLayoutDestroy(Cdesc);
@@ -497,18 +585,30 @@ public:
  *   Alpha value
  * @param beta
  *   Beta value
+ * @param bias
+ *   Device pointer to the bias vector when the fused epilogue uses one
  *
  */
   __MATX_INLINE__ void Exec(TensorTypeC &c, const TensorTypeA &a,
                    const TensorTypeB &b, cudaStream_t stream,
-                   float alpha = 1.0f, float beta = 0.0f)
+                   float alpha = 1.0f, float beta = 0.0f, const void *bias = nullptr)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     // Reorder C/A to match cutlass API
 
+    // Handles shared between threads never carry a bias, so only write it when it changes
+    if (bias_ != bias) {
+      bias_ = bias;
+    }
     MatMulDispatchA(a, b, c, stream, alpha, beta);
   }
 
+  /**
+   * Whether the epilogue requested at construction is fused into the GEMM. If not, the caller
+   * must apply it separately.
+   */
+  bool EpilogueFused() const { return epilogue_fused_; }
+
 private:
   // Member variables
   cublasLtHandle_t ltHandle;
@@ -531,13 +631,16 @@ private:
   void *a_hp = nullptr;
   void *b_hp = nullptr;
   size_t workspaceSize = 0;
-  void *workspace = nullptr;
+  std::vector<cublasLtMatmulHeuristicResult_t> autotune_candidates; // Non-empty until autotuned
+  std::string autotune_key;
+  bool epilogue_fused_ = false;
+  const void *bias_ = nullptr;
   detail::MatMulCUDAParams_t params_;
 
   void ConfigureCublasLt()
   {
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     ret = cublasLtCreate(&ltHandle);
     MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
 
@@ -729,13 +832,186 @@ private:
       MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
     }
 
+    ConfigureEpilogue();
+
+    auto &autotune = MatMulAutotuneCache::Get();
+    if (!autotune.Enabled()) {
+      int res;
+      ret = cublasLtMatmulAlgoGetHeuristic(ltHandle, operationDesc, Adesc,
+                                                 Bdesc, Cdesc, Cdesc, preference,
+                                                 1, &heuristicResult,
+                                                 &res);
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+      MATX_ASSERT(res > 0, matxMatMulError);
+      return;
+    }
+
+    // Autotuning: keep the top candidates and use a previously-tuned choice if there is one.
+    // Otherwise the first execution benchmarks the candidates.
     int res;
+    autotune_candidates.resize(autotune.Candidates());
     ret = cublasLtMatmulAlgoGetHeuristic(ltHandle, operationDesc, Adesc,
                                                Bdesc, Cdesc, Cdesc, preference,
-                                               1, &heuristicResult,
-                                               &res);
+                                               static_cast<int>(autotune_candidates.size()),
+                                               autotune_candidates.data(), &res);
     MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
     MATX_ASSERT(res > 0, matxMatMulError);
+    autotune_candidates.resize(res);
+    heuristicResult = autotune_candidates[0];
+
+    autotune_key = GetAutotuneKey();
+    int index;
+    if (autotune.Lookup(autotune_key, index) && index >= 0 && index < res) {
+      MATX_LOG_DEBUG("Using autotuned cuBLASLt algorithm {} for {}", index, autotune_key);
+      heuristicResult = autotune_candidates[index];
+      autotune_candidates.clear();
+    }
+  }
+
+  // Set the cuBLASLt epilogue for the requested MatX epilogue. The epilogue is only kept if at
+  // least one algorithm supports it for this type and layout; otherwise the caller applies it
+  // as a separate pass.
+  void ConfigureEpilogue()
+  {
+    epilogue_fused_ = false;
+    if constexpr (!is_complex_v<T1> && !is_complex_half_v<T1>) {
+      cublasLtEpilogue_t lt_epilogue;
+      switch (params_.epilogue) {
+        case MatMulEpilogue_t::RELU:      lt_epilogue = CUBLASLT_EPILOGUE_RELU; break;
+        case MatMulEpilogue_t::GELU:      lt_epilogue = CUBLASLT_EPILOGUE_GELU; break;
+        case MatMulEpilogue_t::BIAS:      lt_epilogue = CUBLASLT_EPILOGUE_BIAS; break;
+        case MatMulEpilogue_t::RELU_BIAS: lt_epilogue = CUBLASLT_EPILOGUE_RELU_BIAS; break;
+        case MatMulEpilogue_t::GELU_BIAS: lt_epilogue = CUBLASLT_EPILOGUE_GELU_BIAS; break;
+        default: return;
+      }
+
+      ret = cublasLtMatmulDescSetAttribute(
+                      operationDesc, CUBLASLT_MATMUL_DESC_EPILOGUE, &lt_epilogue,
+                      sizeof(lt_epilogue));
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+
+      cublasLtMatmulHeuristicResult_t probe;
+      int res = 0;
+      const auto probe_ret = cublasLtMatmulAlgoGetHeuristic(ltHandle, operationDesc, Adesc,
+                                                 Bdesc, Cdesc, Cdesc, preference,
+                                                 1, &probe, &res);
+      if (probe_ret == CUBLAS_STATUS_SUCCESS && res > 0) {
+        epilogue_fused_ = true;
+        return;
+      }
+
+      MATX_LOG_DEBUG("cuBLASLt cannot fuse epilogue {} for this GEMM, applying it separately",
+                     static_cast<int>(params_.epilogue));
+      lt_epilogue = CUBLASLT_EPILOGUE_DEFAULT;
+      ret = cublasLtMatmulDescSetAttribute(
+                      operationDesc, CUBLASLT_MATMUL_DESC_EPILOGUE, &lt_epilogue,
+                      sizeof(lt_epilogue));
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+    }
+  }
+
+  // Key identifying a GEMM for autotuning: shape, layout, types, GPU, and cuBLASLt version
+  std::string GetAutotuneKey() const
+  {
+    int device;
+    cudaDeviceProp prop;
+    MATX_CUDA_CHECK(cudaGetDevice(&device));
+    MATX_CUDA_CHECK(cudaGetDeviceProperties(&prop, device));
+
+    std::string gpu = prop.name;
+    for (auto &ch : gpu) {
+      if (ch == ' ') {
+        ch = '_';
+      }
+    }
+
+    std::stringstream key;
+    key << gpu << "_sm" << prop.major << prop.minor << "_lt" << cublasLtGetVersion()
+        << "_t" << static_cast<int>(MatXTypeToCudaType<T1>()) << "." << static_cast<int>(MatXTypeToCudaType<T2>())
+        << "." << static_cast<int>(MatXTypeToCudaType<T3>())
+        << "_r" << params_.rank << "_m" << params_.m << "_n" << params_.n << "_k" << params_.k
+        << "_ld" << params_.lda << "." << params_.ldb << "." << params_.ldc
+        << "_b" << params_.batch << "_s" << params_.astride << "." << params_.bstride << "." << params_.cstride
+        << "_a" << params_.a_rows << "x" << params_.a_cols << "_b" << params_.b_rows << "x" << params_.b_cols
+        << "_c" << params_.c_rows << "x" << params_.c_cols
+        << "_op" << static_cast<int>(params_.opA) << static_cast<int>(params_.opB)
+        << "_e" << static_cast<int>(epilogue_fused_ ? params_.epilogue : MatMulEpilogue_t::NONE);
+    return key.str();
+  }
+
+  /**
+   * Benchmark the heuristic candidates and keep the fastest
+   *
+   * Candidates run on the real A/B inputs but write into a scratch output with beta = 0, so the
+   * contents of C are not disturbed. This synchronizes the stream once, on first use of the
+   * handle only.
+   */
+  void Autotune(void *a_ptr, void *b_ptr, const TensorTypeC &c_ref, const void *salpha,
+                void *workspace, cudaStream_t stream)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    constexpr int NUM_ITERS = 5;
+
+    // Size of the region C's descriptor can touch
+    index_t span = 1;
+    for (int i = 0; i < c_ref.Rank(); i++) {
+      span += (c_ref.Size(i) - 1) * c_ref.Stride(i);
+    }
+
+    void *scratch;
+    matxAlloc(&scratch, static_cast<size_t>(span) * sizeof(T1), MATX_ASYNC_DEVICE_MEMORY, stream);
+
+    MatMulScaleType_t szero;
+    memset(&szero, 0, sizeof(szero));
+
+    cudaEvent_t start, stop;
+    MATX_CUDA_CHECK(cudaEventCreate(&start));
+    MATX_CUDA_CHECK(cudaEventCreate(&stop));
+
+    int best = -1;
+    float best_ms = std::numeric_limits<float>::max();
+    for (int i = 0; i < static_cast<int>(autotune_candidates.size()); i++) {
+      const auto &cand = autotune_candidates[i];
+      if (cand.state != CUBLAS_STATUS_SUCCESS || cand.workspaceSize > workspaceSize) {
+        continue;
+      }
+
+      auto launch = [&]() {
+        return cublasLtMatmul(ltHandle, operationDesc, salpha, a_ptr, Adesc, b_ptr, Bdesc, &szero,
+                              scratch, Cdesc, scratch, Cdesc, &cand.algo, workspace, workspaceSize, stream);
+      };
+
+      // Warmup, which also filters out candidates that fail to launch
+      if (launch() != CUBLAS_STATUS_SUCCESS) {
+        continue;
+      }
+
+      MATX_CUDA_CHECK(cudaEventRecord(start, stream));
+      for (int iter = 0; iter < NUM_ITERS; iter++) {
+        launch();
+      }
+      MATX_CUDA_CHECK(cudaEventRecord(stop, stream));
+      MATX_CUDA_CHECK(cudaEventSynchronize(stop));
+
+      float ms;
+      MATX_CUDA_CHECK(cudaEventElapsedTime(&ms, start, stop));
+      MATX_LOG_DEBUG("cuBLASLt autotune candidate {}: {} ms", i, ms / NUM_ITERS);
+      if (ms < best_ms) {
+        best_ms = ms;
+        best = i;
+      }
+    }
+
+    cudaEventDestroy(start);
+    cudaEventDestroy(stop);
+    matxFree(scratch, stream);
+
+    if (best >= 0) {
+      MATX_LOG_DEBUG("cuBLASLt autotune selected candidate {} for {}", best, autotune_key);
+      heuristicResult = autotune_candidates[best];
+      MatMulAutotuneCache::Get().Store(autotune_key, best);
+    }
+    autotune_candidates.clear();
   }
 
   // TODO: Fix the unused parameters once we support mixes of col/row on cublas
@@ -760,7 +1036,7 @@ private:
                  "A/B/C types must all be half complex if any of them are");
     }
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     // Make copies of each tensor in case we have to do a transformation before
     // the GEMM
     [[maybe_unused]] TensorTypeA a_adj { a };
@@ -824,6 +1100,11 @@ private:
     // For cuBLASLt most of the parameters have already been set in the
     // configure stage
     if constexpr (PROV == PROVIDER_TYPE_CUBLASLT) {
+      // Work queued on the same stream is serialized, so every handle used on this stream can
+      // share the stream's workspace without further synchronization
+      void *workspace = GetCache().GetStreamAlloc(stream, workspaceSize);
+      MATX_ASSERT_STR(workspace != nullptr, matxCudaError, "Failed to get workspace for stream");
+
       MatMulScaleType_t salpha, sbeta;
       memset(&salpha, 0, sizeof(salpha));
       memset(&sbeta, 0, sizeof(sbeta));
@@ -846,6 +1127,23 @@ private:
         sbeta.f64 = beta;
       }
 
+      if (epilogue_fused_ && MatMulEpilogueHasBias(params_.epilogue)) {
+        MATX_ASSERT_STR(bias_ != nullptr, matxInvalidParameter, "GEMM epilogue requires a bias pointer");
+        ret = cublasLtMatmulDescSetAttribute(
+                        operationDesc, CUBLASLT_MATMUL_DESC_BIAS_POINTER, &bias_,
+                        sizeof(bias_));
+        MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+      }
+
+      // Autotuning synchronizes the stream, so it is deferred while the stream is being captured
+      if (!autotune_candidates.empty()) {
+        cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+        MATX_CUDA_CHECK(cudaStreamIsCapturing(stream, &capture_status));
+        if (capture_status == cudaStreamCaptureStatusNone) {
+          Autotune((void *)a_adj.Data(), (void *)b_adj.Data(), c_adj, &salpha, workspace, stream);
+        }
+      }
+
       if constexpr (RANK <= MATMUL_BATCH_RANK_THRESHOLD) {
         // For ranks up to threshold, we can handle everything in a single batch operation
         [[maybe_unused]] auto res = cublasLtMatmul(
@@ -1015,7 +1313,7 @@ private:
                               TensorTypeC &c, cudaStream_t stream,
                               float alpha, float beta)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (c.Stride(RANK - 1) <= 1) {
       MatMulLaunch<OrderA, OrderB, MEM_ORDER_ROW_MAJOR>(a, b, c, stream, alpha,
@@ -1042,7 +1340,7 @@ private:
                               TensorTypeC &c, cudaStream_t stream,
                               float alpha, float beta)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (b.Stride(TensorTypeB::Rank() - 1) == 1) {
       MatMulDispatchC<OrderA, MEM_ORDER_ROW_MAJOR>(a, b, c, stream, alpha,
@@ -1063,7 +1361,7 @@ private:
                               TensorTypeC &c, cudaStream_t stream,
                               float alpha, float beta)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     if (a.Stride(TensorTypeA::Rank() - 1) == 1) {
       MatMulDispatchB<MEM_ORDER_ROW_MAJOR>(a, b, c, stream, alpha, beta);
@@ -1109,7 +1407,7 @@ struct MatMulCUDAParamsKeyEq {
            l.stream == t.stream && l.lda == t.lda &&
            l.ldb == t.ldb && l.ldc == t.ldc && l.batch == t.batch &&
            l.prov == t.prov && l.dtype == t.dtype && l.opA == t.opA &&
-           l.opB == t.opB && l.rank == t.rank;
+           l.opB == t.opB && l.rank == t.rank && l.epilogue == t.epilogue;
   }
 };
 
@@ -1137,6 +1435,116 @@ __MATX_INLINE__ auto getCublasSupportedTensor( const Op &in, cudaStream_t stream
   return GetSupportedTensor(in, support_func, MATX_ASYNC_DEVICE_MEMORY, stream);
 }
 
+/**
+ * Algorithm used for GEMMs on complex half-precision (fp16/bf16) types
+ */
+enum class MatMulComplexHalfAlgo_t {
+  PLANAR,  ///< Convert to planar complex and use cuBLASLt's planar complex GEMM
+  GEMM_3M, ///< Three real half-precision tensor core GEMMs (Gauss/Karatsuba 3M)
+  GEMM_4M, ///< Four real half-precision tensor core GEMMs
+};
+
+namespace detail {
+
+__MATX_INLINE__ std::atomic<MatMulComplexHalfAlgo_t> &MatMulComplexHalfAlgo() {
+  static std::atomic<MatMulComplexHalfAlgo_t> algo{MatMulComplexHalfAlgo_t::PLANAR};
+  return algo;
+}
+
+/**
+ * Run a batch of real GEMMs on stacked planes through the cached cuBLASLt handle
+ *
+ * The planes are half precision and the products are accumulated and stored in fp32, so the
+ * 3M/4M combination step does not lose precision to cancellation in half.
+ */
+template <typename TensorTypeT, typename TensorTypeA, typename TensorTypeB>
+void matmul_planes_impl(TensorTypeT &t, const TensorTypeA &a, const TensorTypeB &b, const cudaExecutor &exec)
+{
+  const auto stream = exec.getStream();
+  using cache_val_type = detail::MatMulCUDAHandle_t<TensorTypeT, TensorTypeA, TensorTypeB, PROVIDER_TYPE_CUBLASLT>;
+  auto params = cache_val_type::GetGemmParams(t, a, b);
+  params.stream = stream;
+
+  auto cache_id = detail::GetCacheIdFromType<detail::gemm_cuda_cache_t>();
+  detail::GetCache().LookupAndExec<detail::gemm_cuda_cache_t>(
+    cache_id,
+    params,
+    [&]() {
+      return std::make_shared<cache_val_type>(t, a, b);
+    },
+    [&](std::shared_ptr<cache_val_type> cache_type) {
+      cache_type->Exec(t, a, b, stream, 1.0f, 0.0f);
+    },
+    exec
+  );
+}
+
+/**
+ * Complex half-precision GEMM through real tensor core GEMMs
+ *
+ * A and B are split into real planes by one kernel each, the real products run as strided
+ * batched half-precision GEMMs with fp32 output, and one kernel combines the products into the
+ * interleaved output with alpha/beta applied. 3M needs three real GEMMs instead of four at the
+ * cost of one extra half-precision rounding of (re + im) in each operand.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+void matmul_complex_half_impl([[maybe_unused]] TensorTypeC &C, [[maybe_unused]] const TensorTypeA &A,
+                              [[maybe_unused]] const TensorTypeB &B, [[maybe_unused]] const cudaExecutor &exec,
+                              [[maybe_unused]] float alpha, [[maybe_unused]] float beta,
+                              [[maybe_unused]] MatMulComplexHalfAlgo_t algo)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using plane_t = typename TensorTypeA::value_type::value_type;
+  const auto stream = exec.getStream();
+  const index_t m = A.Size(0);
+  const index_t k = A.Size(1);
+  const index_t n = B.Size(1);
+  const bool is_3m = algo == MatMulComplexHalfAlgo_t::GEMM_3M;
+
+  MATX_ASSERT_STR(B.Size(0) == k && C.Size(0) == m && C.Size(1) == n, matxInvalidSize,
+      "matmul: A, B and C sizes do not match");
+
+  // 3M: A = [Ar, Ai, Ar+Ai], B = [Br, Bi, Br+Bi] -> one batch of 3
+  // 4M: A = [Ar, Ai], B = [Br, Bi, Br] -> batches [Br, Bi] and [Bi, Br]
+  const index_t a_planes = is_3m ? 3 : 2;
+  const index_t t_planes = is_3m ? 3 : 4;
+  auto ap = make_tensor<plane_t>({a_planes, m, k}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto bp = make_tensor<plane_t>({3, k, n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto tp = make_tensor<float>({t_planes, m, n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  typename detail::base_type_t<TensorTypeA> a_op = A;
+  typename detail::base_type_t<TensorTypeB> b_op = B;
+  typename detail::base_type_t<TensorTypeC> c_op = C;
+
+  constexpr int THREADS = 16;
+  const dim3 block(THREADS, THREADS);
+  const dim3 grid_a(static_cast<unsigned>((k + THREADS - 1) / THREADS), static_cast<unsigned>((m + THREADS - 1) / THREADS));
+  const dim3 grid_b(static_cast<unsigned>((n + THREADS - 1) / THREADS), static_cast<unsigned>((k + THREADS - 1) / THREADS));
+  const dim3 grid_c(static_cast<unsigned>((n + THREADS - 1) / THREADS), static_cast<unsigned>((m + THREADS - 1) / THREADS));
+
+  if (is_3m) {
+    complex_split_planes_kernel<ComplexSplitMode_t::REAL_IMAG_SUM><<<grid_a, block, 0, stream>>>(ap.Data(), a_op, m, k);
+    complex_split_planes_kernel<ComplexSplitMode_t::REAL_IMAG_SUM><<<grid_b, block, 0, stream>>>(bp.Data(), b_op, k, n);
+    matmul_planes_impl(tp, ap, bp, exec);
+    complex_combine_planes_kernel<true><<<grid_c, block, 0, stream>>>(c_op, tp.Data(), m, n, alpha, beta);
+  }
+  else {
+    complex_split_planes_kernel<ComplexSplitMode_t::REAL_IMAG><<<grid_a, block, 0, stream>>>(ap.Data(), a_op, m, k);
+    complex_split_planes_kernel<ComplexSplitMode_t::REAL_IMAG_REAL><<<grid_b, block, 0, stream>>>(bp.Data(), b_op, k, n);
+    auto t_direct = tp.Slice({0, 0, 0}, {2, matxEnd, matxEnd});
+    auto t_cross = tp.Slice({2, 0, 0}, {4, matxEnd, matxEnd});
+    matmul_planes_impl(t_direct, ap, bp.Slice({0, 0, 0}, {2, matxEnd, matxEnd}), exec);
+    matmul_planes_impl(t_cross, ap, bp.Slice({1, 0, 0}, {3, matxEnd, matxEnd}), exec);
+    complex_combine_planes_kernel<false><<<grid_c, block, 0, stream>>>(c_op, tp.Data(), m, n, alpha, beta);
+  }
+#else
+  MATX_THROW(matxNotSupported, "Complex half-precision 3M/4M GEMMs require compiling with nvcc");
+#endif
+}
+
+} // end namespace detail
+
 /**
  * Run a GEMM without a plan
  *
@@ -1167,14 +1575,20 @@ __MATX_INLINE__ auto getCublasSupportedTensor( const Op &in, cudaStream_t stream
  *   Scalar multiplier to apply to operator A
  * @param beta
  *   Scalar multiplier to apply to operator C on input
+ * @param epilogue
+ *   Element-wise epilogue applied to the output. cuBLASLt fuses it into the GEMM when the
+ *   type, layout, and bias allow it; otherwise it runs as a separate pass.
+ * @param bias
+ *   Bias vector with one element per row of C, used by the bias epilogues
  */
 template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB,
-          MatMulCUDAProvider_t PROV = PROVIDER_TYPE_CUBLASLT>
+          MatMulCUDAProvider_t PROV = PROVIDER_TYPE_CUBLASLT, typename BiasType = detail::matmul_no_bias_t>
 void matmul_impl(TensorTypeC C, const TensorTypeA A,
             const TensorTypeB B, const cudaExecutor &exec,
-            float alpha = 1.0, float beta = 0.0)
+            float alpha = 1.0, float beta = 0.0,
+            MatMulEpilogue_t epilogue = MatMulEpilogue_t::NONE, const BiasType &bias = {})
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   constexpr auto is_c_complex = is_complex_v<typename TensorTypeC::value_type>;
@@ -1185,6 +1599,18 @@ void matmul_impl(TensorTypeC C, const TensorTypeA A,
     static_assert(is_a_complex || is_b_complex, "If C is complex then either A or B should be complex ");
   }
 
+  // Complex half GEMMs can optionally run as real half-precision GEMMs on tensor cores
+  if constexpr (is_complex_half_v<typename TensorTypeC::value_type> && PROV == PROVIDER_TYPE_CUBLASLT &&
+                TensorTypeC::Rank() == 2 && TensorTypeA::Rank() == 2 && TensorTypeB::Rank() == 2 &&
+                std::is_same_v<typename TensorTypeA::value_type, typename TensorTypeC::value_type> &&
+                std::is_same_v<typename TensorTypeB::value_type, typename TensorTypeC::value_type>) {
+    const auto algo = detail::MatMulComplexHalfAlgo().load();
+    if (algo != MatMulComplexHalfAlgo_t::PLANAR && epilogue == MatMulEpilogue_t::NONE) {
+      detail::matmul_complex_half_impl(C, A, B, exec, alpha, beta, algo);
+      return;
+    }
+  }
+
   // promote A and B to the type of C
   auto A_ = as_type<typename TensorTypeC::value_type>(A);
   auto B_ = as_type<typename TensorTypeC::value_type>(B);
@@ -1214,12 +1640,30 @@ void matmul_impl(TensorTypeC C, const TensorTypeA A,
     (c = C).run(stream);
   }
 
+  // The bias can only be fused when it is a contiguous vector of C's type with one element per row
+  [[maybe_unused]] const void *bias_ptr = nullptr;
+  bool epilogue_fused = false;
+  MatMulEpilogue_t fused_epilogue = epilogue;
+  if (detail::MatMulEpilogueHasBias(epilogue)) {
+    fused_epilogue = MatMulEpilogue_t::NONE;
+    if constexpr (is_tensor_view_v<BiasType>) {
+      if constexpr (BiasType::Rank() == 1 &&
+                    std::is_same_v<typename BiasType::value_type, typename TensorTypeC::value_type>) {
+        if (bias.Stride(0) == 1 && bias.Size(0) == c.Size(c.Rank() - 2)) {
+          fused_epilogue = epilogue;
+          bias_ptr = bias.Data();
+        }
+      }
+    }
+  }
+
 #ifndef MATX_ENABLE_CUTLASS
   // cublasLt does not allow transpose modes on C.  Thus we need to make sure that the right most dimension has a stride of 1.
   // Use the identity CT = BT * AT to do the transpose through the gemm automatically.  Note we only want to do this transpose if
   // the rightmost stride is !=1 or this function will be an infinite recursion.
   if ( c.Stride(c.Rank()-2) == 1 && c.Stride(c.Rank()-1) > 1 ) {  // column major check
-    // Column major
+    // Column major. The transpose swaps the roles of rows and columns, so a bias epilogue can't be
+    // fused here.
     matmul_impl(transpose_matrix(c), transpose_matrix(b), transpose_matrix(a), exec, alpha, beta);
   } else
 #endif
@@ -1227,7 +1671,15 @@ void matmul_impl(TensorTypeC C, const TensorTypeA A,
     // Get parameters required by these tensors
     auto params =
       detail::MatMulCUDAHandle_t<ctype, atype, btype, PROV>::GetGemmParams(c, a, b);
-    params.stream = stream;
+    params.epilogue = fused_epilogue;
+
+    // A cuBLASLt handle takes its workspace from the stream on every execution, so it can serve
+    // every thread and stream on the device unless Exec modifies it. That happens when setting a
+    // bias pointer, autotuning the algorithm, or staging complex half inputs in planar buffers.
+    const bool shared = PROV == PROVIDER_TYPE_CUBLASLT && !is_complex_half_v<typename ctype::value_type> &&
+                        !detail::MatMulEpilogueHasBias(fused_epilogue) &&
+                        !detail::MatMulAutotuneCache::Get().Enabled();
+    params.stream = shared ? cudaStream_t{} : stream;
 
     using cache_val_type = detail::MatMulCUDAHandle_t<ctype, atype, btype, PROV>;
     auto cache_id = detail::GetCacheIdFromType<detail::gemm_cuda_cache_t>();
@@ -1236,12 +1688,14 @@ void matmul_impl(TensorTypeC C, const TensorTypeA A,
       cache_id,
       params,
       [&]() {
-        return std::make_shared<cache_val_type>(c, a, b);
+        return std::make_shared<cache_val_type>(c, a, b, fused_epilogue);
       },
       [&](std::shared_ptr<cache_val_type> cache_type) {
-        cache_type->Exec(c, a, b, stream, alpha, beta);
+        cache_type->Exec(c, a, b, stream, alpha, beta, bias_ptr);
+        epilogue_fused = cache_type->EpilogueFused();
       },
-      exec
+      exec,
+      shared ? detail::CacheSharing::PER_DEVICE : detail::CacheSharing::PER_THREAD
     );
    }
 
@@ -1249,7 +1703,45 @@ void matmul_impl(TensorTypeC C, const TensorTypeA A,
   if(!c.isSameView(C)) {
     (C = c).run(stream);
   }
+
+  if (epilogue != MatMulEpilogue_t::NONE && !epilogue_fused) {
+    detail::apply_matmul_epilogue(C, bias, epilogue, exec);
+  }
 }
 
 
+/**
+ * Enable or disable cuBLASLt algorithm autotuning
+ *
+ * By default cuBLASLt GEMMs use the top algorithm returned by the cuBLASLt heuristic. When
+ * autotuning is enabled, the first execution of each new GEMM shape benchmarks the top
+ * candidates and keeps the fastest. The choice is saved in the kernel cache directory
+ * (MATX_CACHE_DIR or ~/.matx/kernel_cache), keyed by the GEMM parameters and GPU, so later
+ * processes reuse it without benchmarking. Autotuning can also be enabled by setting the
+ * environment variable MATX_MATMUL_AUTOTUNE=1. Only GEMM shapes first used after enabling are
+ * tuned.
+ *
+ * @param enable Whether to autotune
+ * @param candidates Number of heuristic candidates to benchmark
+ */
+__MATX_INLINE__ void SetMatMulAutotune(bool enable, int candidates = detail::MATMUL_AUTOTUNE_DEFAULT_CANDIDATES) {
+  detail::MatMulAutotuneCache::Get().SetEnabled(enable, candidates);
+}
+
+/**
+ * Select the algorithm used for complex half-precision GEMMs
+ *
+ * PLANAR (the default) converts the operands to planar complex and uses cuBLASLt's planar
+ * complex GEMM. GEMM_3M and GEMM_4M instead split the operands into real half-precision planes
+ * in a single pass, run three or four real GEMMs on tensor cores with fp32 accumulation and
+ * output, and recombine. 3M does 25% less GEMM work than 4M but rounds the sums of the real
+ * and imaginary parts to half precision, so 4M is more accurate. The real GEMM paths apply to
+ * rank-2 operands without an epilogue; other GEMMs keep using PLANAR.
+ *
+ * @param algo Algorithm for complex half GEMMs
+ */
+__MATX_INLINE__ void SetMatMulComplexHalfAlgo(MatMulComplexHalfAlgo_t algo) {
+  detail::MatMulComplexHalfAlgo().store(algo);
+}
+
 } // end namespace matx
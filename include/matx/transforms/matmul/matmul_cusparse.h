@@ -35,11 +35,14 @@
 
 #include <cusparse.h>
 
+#include <algorithm>
 #include <numeric>
 
 #include "matx/core/cache.h"
 #include "matx/core/sparse_tensor.h"
 #include "matx/core/tensor.h"
+#include "matx/transforms/convert/dense2sparse_cusparse.h"
+#include "matx/transforms/matmul/matmul_cusparse_common.h"
 
 namespace matx {
 
@@ -63,6 +66,8 @@ struct MatMulCUSPARSEParams_t {
   cusparseOperation_t opB;
   // Matrix handles in cuSPARSE are data specific (unlike e.g. cuBLAS
   // where the same plan can be shared between different data buffers).
+  // Only the buffers of A identify a plan, since its preprocessing depends
+  // on A alone. The dense matrices are rebound on every call.
   void *ptrA0;
   void *ptrA1;
   void *ptrA2;
@@ -83,14 +88,13 @@ public:
   using TCOMP = std::conditional_t<is_matx_half_v<TC>, float, TC>;
 
   /**
-   * Construct a sparse GEMM handle
-   *   SpMM        <- for now
-   *   SpGEMM
+   * Construct a sparse x dense GEMM (SpMM) handle. The sparse x sparse
+   * case (SpGEMM) is handled by SpGEMMCUSPARSEHandle_t below.
    */
   MatMulCUSPARSEHandle_t(TensorTypeC &c, const TensorTypeA &a,
                          const TensorTypeB &b, cudaStream_t stream, float alpha,
                          float beta) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     params_ = GetGemmParams(c, a, b, stream, alpha, beta);
 
     // Properly typed alpha, beta.
@@ -108,6 +112,8 @@ public:
 
     [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
     MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseSetStream(handle_, stream);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
 
     // Create cuSPARSE handle for sparse matrix A.
     static_assert(is_sparse_tensor_v<TensorTypeA>);
@@ -129,8 +135,25 @@ public:
       ret = cusparseCreateCsc(&matA_, params_.m, params_.k, params_.nse,
                               params_.ptrA2, params_.ptrA4, params_.ptrA0, pt,
                               ct, zb, dta);
+#if CUDART_VERSION >= 12010
+    } else if constexpr (TensorTypeA::Format::isBSR() ||
+                         TensorTypeA::Format::isBSRCol()) {
+      // Block sparse rows, with row-major or column-major blocks. Half
+      // precision blocks accumulate in FP32 (see TCOMP), which engages the
+      // tensor core kernels of cuSPARSE for suitable block sizes.
+      using Format = typename TensorTypeA::Format;
+      constexpr index_t BM = Format::blockRows();
+      constexpr index_t BN = Format::blockCols();
+      const cusparseOrder_t border = Format::isBSR() ? CUSPARSE_ORDER_ROW
+                                                     : CUSPARSE_ORDER_COL;
+      ret = cusparseCreateBsr(&matA_, params_.m / BM, params_.k / BN,
+                              params_.nse / (BM * BN), BM, BN, params_.ptrA2,
+                              params_.ptrA4, params_.ptrA0, pt, ct, zb, dta,
+                              border);
+#endif
     } else {
-      MATX_THROW(matxNotSupported, "SpMM currently only supports COO/CSR/CSC");
+      MATX_THROW(matxNotSupported,
+                 "SpMM currently only supports COO/CSR/CSC/BSR");
     }
     MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
 
@@ -147,26 +170,125 @@ public:
                               params_.ptrC, dtc, order);
     MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
 
-    // Allocate a workspace for SpMM.
-    const cusparseSpMMAlg_t algo = CUSPARSE_SPMM_ALG_DEFAULT;
-    const cudaDataType comptp = MatXTypeToCudaType<TCOMP>();
-    ret = cusparseSpMM_bufferSize(handle_, params_.opA, params_.opB, &salpha_,
-                                  matA_, matB_, &sbeta_, matC_, comptp, algo,
-                                  &workspaceSize_);
-    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
-    if (workspaceSize_) {
-      matxAlloc((void **)&workspace_, workspaceSize_, MATX_DEVICE_MEMORY,
-                stream);
+    // Pick the algorithm from the shape, or from a previous autotuning run,
+    // then allocate its workspace and preprocess A once for all later calls.
+    using Format = typename TensorTypeA::Format;
+    algo_ = SelectSpMMAlg<Format>(params_.m, params_.n, params_.nse);
+    auto &autotune = SparseAutotuneCache::Get();
+    if (autotune.Enabled()) {
+      const bool index32 = sizeof(typename TensorTypeA::pos_type) == 4 &&
+                           sizeof(typename TensorTypeA::crd_type) == 4;
+      const auto candidates = SpMMAlgCandidates<Format>(index32);
+      const auto key = SparseAutotuneKey("spmm", SparseFormatName<Format>(),
+                                         dta, ct, params_.m, params_.n,
+                                         params_.k, params_.nse);
+      int index;
+      if (autotune.Lookup(key, index) && index >= 0 &&
+          index < static_cast<int>(candidates.size())) {
+        MATX_LOG_DEBUG("Using autotuned SpMM algorithm {} for {}", index, key);
+        algo_ = candidates[index];
+      } else if (SparseCanAutotune(stream)) {
+        index = Autotune(candidates);
+        if (index >= 0) {
+          MATX_LOG_DEBUG("SpMM autotune selected candidate {} for {}", index, key);
+          algo_ = candidates[index];
+          autotune.Store(key, index);
+        }
+      }
     }
+    ret = Prepare(algo_);
+    if (ret != CUSPARSE_STATUS_SUCCESS && algo_ != CUSPARSE_SPMM_ALG_DEFAULT) {
+      // Not every algorithm supports every type, so fall back to the default
+      algo_ = CUSPARSE_SPMM_ALG_DEFAULT;
+      ret = Prepare(algo_);
+    }
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
   }
 
   ~MatMulCUSPARSEHandle_t() {
     if (workspaceSize_) {
       matxFree(workspace_, params_.stream);
     }
+    cusparseDestroyDnMat(matB_);
+    cusparseDestroyDnMat(matC_);
+    cusparseDestroySpMat(matA_);
     cusparseDestroy(handle_);
   }
 
+  /**
+   * Size and allocate the workspace for an algorithm and run the one-time
+   * preprocessing of A
+   */
+  cusparseStatus_t Prepare(cusparseSpMMAlg_t algo) {
+    if (workspaceSize_) {
+      matxFree(workspace_, params_.stream);
+      workspace_ = nullptr;
+    }
+    const cudaDataType comptp = MatXTypeToCudaType<TCOMP>();
+    cusparseStatus_t ret = cusparseSpMM_bufferSize(
+        handle_, params_.opA, params_.opB, &salpha_, matA_, matB_, &sbeta_,
+        matC_, comptp, algo, &workspaceSize_);
+    if (ret != CUSPARSE_STATUS_SUCCESS) {
+      workspaceSize_ = 0;
+      return ret;
+    }
+    if (workspaceSize_) {
+      matxAlloc((void **)&workspace_, workspaceSize_, MATX_DEVICE_MEMORY,
+                params_.stream);
+    }
+    // Preprocessing is an optimization, so algorithms without it still run
+    if (cusparseSpMM_preprocess(handle_, params_.opA, params_.opB, &salpha_,
+                                matA_, matB_, &sbeta_, matC_, comptp, algo,
+                                workspace_) != CUSPARSE_STATUS_SUCCESS) {
+      MATX_LOG_DEBUG("SpMM preprocessing not supported for algorithm {}",
+                     static_cast<int>(algo));
+    }
+    return ret;
+  }
+
+  /**
+   * Benchmark the candidate algorithms and return the index of the fastest,
+   * or -1 if none ran. The candidates write into a scratch C with beta = 0,
+   * so the contents of C are not disturbed.
+   */
+  int Autotune(const std::vector<cusparseSpMMAlg_t> &candidates) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    const cudaDataType comptp = MatXTypeToCudaType<TCOMP>();
+    const TCOMP szero{};
+    void *scratch;
+    matxAlloc(&scratch, params_.m * params_.n * sizeof(TC),
+              MATX_ASYNC_DEVICE_MEMORY, params_.stream);
+    cusparseDnMatDescr_t matS;
+    [[maybe_unused]] cusparseStatus_t ret = cusparseCreateDnMat(
+        &matS, params_.m, params_.n, /*ld=*/params_.n, scratch,
+        MatXTypeToCudaType<TC>(), CUSPARSE_ORDER_ROW);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    int best = -1;
+    float best_ms = std::numeric_limits<float>::infinity();
+    for (int i = 0; i < static_cast<int>(candidates.size()); i++) {
+      if (Prepare(candidates[i]) != CUSPARSE_STATUS_SUCCESS) {
+        continue;
+      }
+      const float ms = SparseAutotuneTime(
+          [&]() {
+            return cusparseSpMM(handle_, params_.opA, params_.opB, &salpha_,
+                                matA_, matB_, &szero, matS, comptp,
+                                candidates[i], workspace_);
+          },
+          params_.stream);
+      MATX_LOG_DEBUG("SpMM autotune candidate {}: {} ms", i, ms);
+      if (ms < best_ms) {
+        best_ms = ms;
+        best = i;
+      }
+    }
+
+    cusparseDestroyDnMat(matS);
+    matxFree(scratch, params_.stream);
+    return best;
+  }
+
   static detail::MatMulCUSPARSEParams_t
   GetGemmParams(TensorTypeC &c, const TensorTypeA &a, const TensorTypeB &b,
                 cudaStream_t stream, float alpha, float beta) {
@@ -196,15 +318,23 @@ public:
     return params;
   }
 
-  __MATX_INLINE__ void Exec([[maybe_unused]] TensorTypeC &c,
-                            [[maybe_unused]] const TensorTypeA &a,
-                            [[maybe_unused]] const TensorTypeB &b) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
-    const cusparseSpMMAlg_t algo = CUSPARSE_SPMM_ALG_DEFAULT;
+  __MATX_INLINE__ void Exec(TensorTypeC &c, [[maybe_unused]] const TensorTypeA &a,
+                            const TensorTypeB &b) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
+    [[maybe_unused]] cusparseStatus_t ret;
+    if (b.Data() != params_.ptrB) {
+      params_.ptrB = b.Data();
+      ret = cusparseDnMatSetValues(matB_, params_.ptrB);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    }
+    if (c.Data() != params_.ptrC) {
+      params_.ptrC = c.Data();
+      ret = cusparseDnMatSetValues(matC_, params_.ptrC);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    }
     const cudaDataType comptp = MatXTypeToCudaType<TCOMP>();
-    [[maybe_unused]] cusparseStatus_t ret =
-        cusparseSpMM(handle_, params_.opA, params_.opB, &salpha_, matA_, matB_,
-                     &sbeta_, matC_, comptp, algo, workspace_);
+    ret = cusparseSpMM(handle_, params_.opA, params_.opB, &salpha_, matA_,
+                       matB_, &sbeta_, matC_, comptp, algo_, workspace_);
     MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
   }
 
@@ -213,6 +343,7 @@ private:
   cusparseSpMatDescr_t matA_ = nullptr;
   cusparseDnMatDescr_t matB_ = nullptr;
   cusparseDnMatDescr_t matC_ = nullptr;
+  cusparseSpMMAlg_t algo_ = CUSPARSE_SPMM_ALG_DEFAULT;
   size_t workspaceSize_ = 0;
   void *workspace_ = nullptr;
   detail::MatMulCUSPARSEParams_t params_;
@@ -228,8 +359,8 @@ private:
 struct MatMulCUSPARSEParamsKeyHash {
   std::size_t operator()(const MatMulCUSPARSEParams_t &k) const noexcept {
     return std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA0)) +
-           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrB)) +
-           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrC)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA2)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA4)) +
            std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.stream));
   }
 };
@@ -246,7 +377,7 @@ struct MatMulCUSPARSEParamsKeyEq {
            l.nse == t.nse && l.m == t.m && l.n == t.n && l.k == t.k &&
            l.opA == t.opA && l.opB == t.opB && l.ptrA0 == t.ptrA0 &&
            l.ptrA1 == t.ptrA1 && l.ptrA2 == t.ptrA2 && l.ptrA3 == t.ptrA3 &&
-           l.ptrA4 == t.ptrA4 && l.ptrB == t.ptrB && l.ptrC == t.ptrC;
+           l.ptrA4 == t.ptrA4;
   }
 };
 
@@ -267,13 +398,234 @@ __MATX_INLINE__ auto getCuSparseGemmSupportedTensor(const Op &in,
   return GetSupportedTensor(in, func, MATX_ASYNC_DEVICE_MEMORY, stream);
 }
 
+/**
+ * Parameters needed to execute a cuSPARSE SpGEMM.
+ */
+struct SpGEMMCUSPARSEParams_t {
+  MatXDataType_t dtype;
+  cudaStream_t stream;
+  float alpha;
+  index_t nseA;
+  index_t nseB;
+  index_t m;
+  index_t n;
+  index_t k;
+  // The buffers of A and B identify the product. The output C is identified
+  // by its row positions, like a dense2sparse output, since its coordinates
+  // and values are (re)allocated when the plan is created.
+  void *ptrA0;
+  void *ptrA2;
+  void *ptrA4;
+  void *ptrB0;
+  void *ptrB2;
+  void *ptrB4;
+  void *ptrC2;
+};
+
+/**
+ * Sparse x sparse GEMM plan based on the cuSPARSE SpGEMM "reuse" API
+ *
+ * Creating the plan runs the work estimation and nnz phases, allocates
+ * the coordinates and values of C for the exact nnz, and computes the
+ * structure of C. Executing the plan only runs the numeric phase, so calls
+ * that share the sparsity patterns of A and B reuse all workspaces.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+class SpGEMMCUSPARSEHandle_t {
+public:
+  using TA = typename TensorTypeA::value_type;
+  using TC = typename TensorTypeC::value_type;
+  using VAL = typename TensorTypeC::val_type;
+  using CRD = typename TensorTypeC::crd_type;
+
+  SpGEMMCUSPARSEHandle_t(TensorTypeC &c, const TensorTypeA &a,
+                         const TensorTypeB &b, cudaStream_t stream,
+                         float alpha) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    params_ = GetSpGEMMParams(c, a, b, stream, alpha);
+
+    if constexpr (std::is_same_v<TC, cuda::std::complex<float>> ||
+                  std::is_same_v<TC, cuda::std::complex<double>>) {
+      salpha_ = {alpha, 0};
+    } else {
+      salpha_ = alpha;
+    }
+    sbeta_ = TC(0);
+
+    [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseSetStream(handle_, stream);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    const cusparseIndexType_t it = CUSPARSE_INDEX_32I;
+    const cusparseIndexBase_t zb = CUSPARSE_INDEX_BASE_ZERO;
+    const cudaDataType dt = MatXTypeToCudaType<TC>();
+    ret = cusparseCreateCsr(&matA_, params_.m, params_.k, params_.nseA,
+                            params_.ptrA2, params_.ptrA4, params_.ptrA0, it,
+                            it, zb, dt);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseCreateCsr(&matB_, params_.k, params_.n, params_.nseB,
+                            params_.ptrB2, params_.ptrB4, params_.ptrB0, it,
+                            it, zb, dt);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseCreateCsr(&matC_, params_.m, params_.n, 0, params_.ptrC2,
+                            nullptr, nullptr, it, it, zb, dt);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseSpGEMM_createDescr(&spgemm_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    const auto op = CUSPARSE_OPERATION_NON_TRANSPOSE;
+    const auto alg = CUSPARSE_SPGEMM_DEFAULT;
+
+    // Phase 1: work estimation.
+    size_t size1 = 0;
+    void *buf1 = nullptr;
+    ret = cusparseSpGEMMreuse_workEstimation(handle_, op, op, matA_, matB_,
+                                             matC_, alg, spgemm_, &size1,
+                                             nullptr);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    Alloc(&buf1, size1);
+    ret = cusparseSpGEMMreuse_workEstimation(handle_, op, op, matA_, matB_,
+                                             matC_, alg, spgemm_, &size1, buf1);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    // Phase 2: nnz of C.
+    size_t size2 = 0;
+    void *buf2 = nullptr;
+    size_t size3 = 0;
+    void *buf3 = nullptr;
+    ret = cusparseSpGEMMreuse_nnz(handle_, op, op, matA_, matB_, matC_, alg,
+                                  spgemm_, &size2, nullptr, &size3, nullptr,
+                                  &size4_, nullptr);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    Alloc(&buf2, size2);
+    Alloc(&buf3, size3);
+    Alloc(&buf4_, size4_);
+    ret = cusparseSpGEMMreuse_nnz(handle_, op, op, matA_, matB_, matC_, alg,
+                                  spgemm_, &size2, buf2, &size3, buf3, &size4_,
+                                  buf4_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    matxFree(buf1, stream);
+    matxFree(buf2, stream);
+
+    // Allocate the output for the exact nnz, in the memory space of its
+    // row positions.
+    [[maybe_unused]] int64_t rows_tmp, cols_tmp, nnz;
+    ret = cusparseSpMatGetSize(matC_, &rows_tmp, &cols_tmp, &nnz);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    matxMemorySpace_t space = GetPointerKind(params_.ptrC2);
+    c.SetVal(makeDefaultNonOwningStorage<VAL>(nnz, space, stream));
+    c.SetCrd(1, makeDefaultNonOwningStorage<CRD>(nnz, space, stream));
+    c.SetSparseDataImpl();
+    ret = cusparseCsrSetPointers(matC_, c.POSData(1), c.CRDData(1), c.Data());
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    // Phase 3: structure of C.
+    size_t size5 = 0;
+    ret = cusparseSpGEMMreuse_copy(handle_, op, op, matA_, matB_, matC_, alg,
+                                   spgemm_, &size5, nullptr);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    Alloc(&buf5_, size5);
+    ret = cusparseSpGEMMreuse_copy(handle_, op, op, matA_, matB_, matC_, alg,
+                                   spgemm_, &size5, buf5_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    matxFree(buf3, stream);
+  }
+
+  ~SpGEMMCUSPARSEHandle_t() {
+    matxFree(buf4_, params_.stream);
+    matxFree(buf5_, params_.stream);
+    cusparseSpGEMM_destroyDescr(spgemm_);
+    cusparseDestroySpMat(matA_);
+    cusparseDestroySpMat(matB_);
+    cusparseDestroySpMat(matC_);
+    cusparseDestroy(handle_);
+  }
+
+  static detail::SpGEMMCUSPARSEParams_t
+  GetSpGEMMParams(TensorTypeC &c, const TensorTypeA &a, const TensorTypeB &b,
+                  cudaStream_t stream, float alpha) {
+    detail::SpGEMMCUSPARSEParams_t params;
+    params.dtype = TypeToInt<typename TensorTypeA::val_type>();
+    params.stream = stream;
+    params.alpha = alpha;
+    params.nseA = a.Nse();
+    params.nseB = b.Nse();
+    params.m = a.Size(0);
+    params.n = b.Size(1);
+    params.k = a.Size(1);
+    params.ptrA0 = a.Data();
+    params.ptrA2 = a.POSData(1);
+    params.ptrA4 = a.CRDData(1);
+    params.ptrB0 = b.Data();
+    params.ptrB2 = b.POSData(1);
+    params.ptrB4 = b.CRDData(1);
+    params.ptrC2 = c.POSData(1);
+    return params;
+  }
+
+  // Numeric phase, using the current values of A and B.
+  __MATX_INLINE__ void Exec([[maybe_unused]] TensorTypeC &c,
+                            [[maybe_unused]] const TensorTypeA &a,
+                            [[maybe_unused]] const TensorTypeB &b) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
+    const auto op = CUSPARSE_OPERATION_NON_TRANSPOSE;
+    [[maybe_unused]] cusparseStatus_t ret = cusparseSpGEMMreuse_compute(
+        handle_, op, op, &salpha_, matA_, matB_, &sbeta_, matC_,
+        MatXTypeToCudaType<TC>(), CUSPARSE_SPGEMM_DEFAULT, spgemm_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+  }
+
+private:
+  void Alloc(void **ptr, size_t size) {
+    matxAlloc(ptr, std::max(size, size_t{1}), MATX_ASYNC_DEVICE_MEMORY,
+              params_.stream);
+  }
+
+  cusparseHandle_t handle_ = nullptr;
+  cusparseSpMatDescr_t matA_ = nullptr;
+  cusparseSpMatDescr_t matB_ = nullptr;
+  cusparseSpMatDescr_t matC_ = nullptr;
+  cusparseSpGEMMDescr_t spgemm_ = nullptr;
+  size_t size4_ = 0;
+  void *buf4_ = nullptr;
+  void *buf5_ = nullptr;
+  detail::SpGEMMCUSPARSEParams_t params_;
+  TC salpha_;
+  TC sbeta_;
+};
+
+struct SpGEMMCUSPARSEParamsKeyHash {
+  std::size_t operator()(const SpGEMMCUSPARSEParams_t &k) const noexcept {
+    return std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA0)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrB0)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrC2)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.stream));
+  }
+};
+
+struct SpGEMMCUSPARSEParamsKeyEq {
+  bool operator()(const SpGEMMCUSPARSEParams_t &l,
+                  const SpGEMMCUSPARSEParams_t &t) const noexcept {
+    return l.dtype == t.dtype && l.stream == t.stream && l.alpha == t.alpha &&
+           l.nseA == t.nseA && l.nseB == t.nseB && l.m == t.m && l.n == t.n &&
+           l.k == t.k && l.ptrA0 == t.ptrA0 && l.ptrA2 == t.ptrA2 &&
+           l.ptrA4 == t.ptrA4 && l.ptrB0 == t.ptrB0 && l.ptrB2 == t.ptrB2 &&
+           l.ptrB4 == t.ptrB4 && l.ptrC2 == t.ptrC2;
+  }
+};
+
+using spgemm_cusparse_cache_t =
+    std::unordered_map<SpGEMMCUSPARSEParams_t, std::any,
+                       SpGEMMCUSPARSEParamsKeyHash, SpGEMMCUSPARSEParamsKeyEq>;
+
 } // end namespace detail
 
 template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
 void sparse_matmul_impl(TensorTypeC &C, const TensorTypeA &a,
                         const TensorTypeB &B, const cudaExecutor &exec,
                         float alpha = 1.0, float beta = 0.0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   // Transform into supported form.
@@ -338,4 +690,70 @@ void sparse_matmul_impl(TensorTypeC &C, const TensorTypeA &a,
   }
 }
 
+/**
+ * Sparse x sparse GEMM C = alpha * A * B with CSR operands and output
+ *
+ * The output C must be a CSR tensor whose row positions are allocated
+ * (e.g. from make_zero_tensor_csr). Its coordinates and values are
+ * allocated for the exact number of nonzeros of the product.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+void sparse_spgemm_impl(TensorTypeC &c, const TensorTypeA &a,
+                        const TensorTypeB &b, const cudaExecutor &exec,
+                        float alpha = 1.0, float beta = 0.0) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  const auto stream = exec.getStream();
+
+  using TA = typename TensorTypeA::value_type;
+  using TB = typename TensorTypeB::value_type;
+  using TC = typename TensorTypeC::value_type;
+
+  // Restrictions.
+  static_assert(TensorTypeA::Rank() == 2 && TensorTypeB::Rank() == 2 &&
+                    TensorTypeC::Rank() == 2,
+                "tensors must have rank-2");
+  static_assert(TensorTypeA::Format::isCSR() && TensorTypeB::Format::isCSR() &&
+                    TensorTypeC::Format::isCSR(),
+                "SpGEMM currently only supports CSR");
+  static_assert(std::is_same_v<TC, TA> && std::is_same_v<TC, TB>,
+                "tensors must have the same data type");
+  static_assert(std::is_same_v<TC, float> || std::is_same_v<TC, double> ||
+                    std::is_same_v<TC, cuda::std::complex<float>> ||
+                    std::is_same_v<TC, cuda::std::complex<double>>,
+                "unsupported data type");
+  static_assert(
+      std::is_same_v<typename TensorTypeA::pos_type, int32_t> &&
+          std::is_same_v<typename TensorTypeA::crd_type, int32_t> &&
+          std::is_same_v<typename TensorTypeB::pos_type, int32_t> &&
+          std::is_same_v<typename TensorTypeB::crd_type, int32_t> &&
+          std::is_same_v<typename TensorTypeC::pos_type, int32_t> &&
+          std::is_same_v<typename TensorTypeC::crd_type, int32_t>,
+      "SpGEMM only supports 32-bit indices");
+  MATX_ASSERT(a.Size(1) == b.Size(0) && c.Size(0) == a.Size(0) &&
+                  c.Size(1) == b.Size(1),
+              matxInvalidSize);
+  MATX_ASSERT_STR(beta == 0.0f, matxInvalidParameter,
+                  "SpGEMM does not support accumulating into C");
+  MATX_ASSERT_STR(c.POSData(1) != nullptr, matxInvalidParameter,
+                  "SpGEMM output needs allocated row positions");
+
+  // Get parameters required by these tensors (for caching).
+  using cache_val_type =
+      detail::SpGEMMCUSPARSEHandle_t<TensorTypeC, TensorTypeA, TensorTypeB>;
+  auto params = cache_val_type::GetSpGEMMParams(c, a, b, stream, alpha);
+
+  // Lookup and cache.
+  auto cache_id = detail::GetCacheIdFromType<detail::spgemm_cusparse_cache_t>();
+  MATX_LOG_DEBUG("SpGEMM CUSPARSE transform: cache_id={}", cache_id);
+  detail::GetCache().LookupAndExec<detail::spgemm_cusparse_cache_t>(
+      cache_id, params,
+      [&]() {
+        return std::make_shared<cache_val_type>(c, a, b, stream, alpha);
+      },
+      [&](std::shared_ptr<cache_val_type> cache_type) {
+        cache_type->Exec(c, a, b);
+      },
+      exec);
+}
+
 } // end namespace matx
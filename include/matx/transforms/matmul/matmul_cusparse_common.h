@@ -0,0 +1,291 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cusparse.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "matx/core/cache.h"
+#include "matx/core/error.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Process-wide record of autotuned cuSPARSE SpMV/SpMM algorithm choices
+ *
+ * Each entry maps a key built from the operation, sparse format, types, shape, nnz, GPU and
+ * cuSPARSE version to the index of the fastest algorithm in the candidate list for that format.
+ * Entries are persisted to a text file in the kernel cache directory, like the cuBLASLt choices.
+ */
+class SparseAutotuneCache {
+public:
+  static SparseAutotuneCache &Get() {
+    static SparseAutotuneCache cache;
+    return cache;
+  }
+
+  void SetEnabled(bool enabled) { enabled_ = enabled; }
+  bool Enabled() const { return enabled_; }
+
+  bool Lookup(const std::string &key, int &index) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    Load();
+    auto it = choices_.find(key);
+    if (it == choices_.end()) {
+      return false;
+    }
+    index = it->second;
+    return true;
+  }
+
+  void Store(const std::string &key, int index) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    Load();
+    choices_[key] = index;
+
+    std::string contents;
+    for (const auto &[k, v] : choices_) {
+      contents += k + " " + std::to_string(v) + "\n";
+    }
+    GetCache().WriteKernelCacheFile(FILENAME, contents.data(), contents.size());
+  }
+
+private:
+  static constexpr const char *FILENAME = "cusparse_autotune.txt";
+
+  SparseAutotuneCache() {
+    const char *env = std::getenv("MATX_SPARSE_AUTOTUNE");
+    enabled_ = env != nullptr && std::strcmp(env, "0") != 0;
+  }
+
+  // Must be called with mtx_ held
+  void Load() {
+    if (loaded_) {
+      return;
+    }
+    loaded_ = true;
+
+    std::istringstream in(GetCache().ReadKernelCacheFile(FILENAME));
+    std::string key;
+    int index;
+    while (in >> key >> index) {
+      choices_[key] = index;
+    }
+  }
+
+  std::atomic<bool> enabled_{false};
+  bool loaded_ = false;
+  std::unordered_map<std::string, int> choices_;
+  std::mutex mtx_;
+};
+
+// Key identifying a sparse product for autotuning
+__MATX_INLINE__ std::string SparseAutotuneKey(const char *op, const char *format, cudaDataType dt,
+                                              cusparseIndexType_t it, index_t m, index_t n, index_t k,
+                                              index_t nse) {
+  int device;
+  cudaDeviceProp prop;
+  MATX_CUDA_CHECK(cudaGetDevice(&device));
+  MATX_CUDA_CHECK(cudaGetDeviceProperties(&prop, device));
+
+  std::string gpu = prop.name;
+  for (auto &ch : gpu) {
+    if (ch == ' ') {
+      ch = '_';
+    }
+  }
+
+  std::stringstream key;
+  key << gpu << "_sm" << prop.major << prop.minor << "_sp" << CUSPARSE_VERSION << "_" << op << "_"
+      << format << "_t" << static_cast<int>(dt) << "_i" << static_cast<int>(it) << "_m" << m
+      << "_n" << n << "_k" << k << "_nse" << nse;
+  return key.str();
+}
+
+template <typename Format>
+__MATX_INLINE__ const char *SparseFormatName() {
+  if constexpr (Format::isCOO()) {
+    return "coo";
+  } else if constexpr (Format::isCSR()) {
+    return "csr";
+  } else if constexpr (Format::isBSR() || Format::isBSRCol()) {
+    return "bsr";
+  } else {
+    return "csc";
+  }
+}
+
+/**
+ * SpMV algorithms worth trying for a format. The first entry is the default
+ * choice when neither the heuristic nor autotuning applies.
+ */
+template <typename Format>
+__MATX_INLINE__ std::vector<cusparseSpMVAlg_t> SpMVAlgCandidates() {
+  if constexpr (Format::isCOO()) {
+    return {CUSPARSE_SPMV_COO_ALG1, CUSPARSE_SPMV_COO_ALG2};
+  } else if constexpr (Format::isCSR()) {
+    return {CUSPARSE_SPMV_CSR_ALG1, CUSPARSE_SPMV_CSR_ALG2};
+  } else {
+    return {CUSPARSE_SPMV_ALG_DEFAULT};
+  }
+}
+
+/**
+ * Shape based SpMV algorithm choice
+ *
+ * The merge-path CSR_ALG2 balances work across nonzeros rather than rows, which
+ * wins when rows are long or when there are too few rows to fill the GPU with
+ * the row-parallel CSR_ALG1.
+ */
+template <typename Format>
+__MATX_INLINE__ cusparseSpMVAlg_t SelectSpMVAlg(index_t m, [[maybe_unused]] index_t n, index_t nse) {
+  if constexpr (Format::isCSR()) {
+    const double avg_row = m > 0 ? static_cast<double>(nse) / static_cast<double>(m) : 0.0;
+    return (avg_row > 32.0 || m < 4096) ? CUSPARSE_SPMV_CSR_ALG2 : CUSPARSE_SPMV_CSR_ALG1;
+  } else if constexpr (Format::isCOO()) {
+    return CUSPARSE_SPMV_COO_ALG1;
+  } else {
+    return CUSPARSE_SPMV_ALG_DEFAULT;
+  }
+}
+
+/**
+ * SpMM algorithms worth trying for a format with row-major dense operands
+ */
+template <typename Format>
+__MATX_INLINE__ std::vector<cusparseSpMMAlg_t> SpMMAlgCandidates(bool index32) {
+  if constexpr (Format::isCOO()) {
+    return {CUSPARSE_SPMM_COO_ALG4, CUSPARSE_SPMM_COO_ALG1, CUSPARSE_SPMM_COO_ALG2, CUSPARSE_SPMM_COO_ALG3};
+  } else if constexpr (Format::isCSR()) {
+    // CSR_ALG3 only supports 32-bit indices
+    if (index32) {
+      return {CUSPARSE_SPMM_CSR_ALG2, CUSPARSE_SPMM_CSR_ALG1, CUSPARSE_SPMM_CSR_ALG3};
+    }
+    return {CUSPARSE_SPMM_CSR_ALG2, CUSPARSE_SPMM_CSR_ALG1};
+#if CUDART_VERSION >= 12010
+  } else if constexpr (Format::isBSR() || Format::isBSRCol()) {
+    return {CUSPARSE_SPMM_BSR_ALG1, CUSPARSE_SPMM_ALG_DEFAULT};
+#endif
+  } else {
+    return {CUSPARSE_SPMM_ALG_DEFAULT};
+  }
+}
+
+/**
+ * Shape based SpMM algorithm choice for row-major dense operands
+ *
+ * COO_ALG4 and CSR_ALG2 are the row-major algorithms and are best for wide
+ * right-hand sides. For a narrow B the generic COO_ALG1/CSR_ALG1 kernels do
+ * better since there is little reuse of each nonzero across columns.
+ */
+template <typename Format>
+__MATX_INLINE__ cusparseSpMMAlg_t SelectSpMMAlg([[maybe_unused]] index_t m, index_t n,
+                                                [[maybe_unused]] index_t nse) {
+  if constexpr (Format::isCOO()) {
+    return n >= 32 ? CUSPARSE_SPMM_COO_ALG4 : CUSPARSE_SPMM_COO_ALG1;
+  } else if constexpr (Format::isCSR()) {
+    return n >= 32 ? CUSPARSE_SPMM_CSR_ALG2 : CUSPARSE_SPMM_CSR_ALG1;
+#if CUDART_VERSION >= 12010
+  } else if constexpr (Format::isBSR() || Format::isBSRCol()) {
+    return CUSPARSE_SPMM_BSR_ALG1;
+#endif
+  } else {
+    return CUSPARSE_SPMM_ALG_DEFAULT;
+  }
+}
+
+/**
+ * Time a launch in milliseconds per call. Returns infinity when the launch fails.
+ */
+template <typename Launch>
+__MATX_INLINE__ float SparseAutotuneTime(Launch &&launch, cudaStream_t stream) {
+  constexpr int NUM_ITERS = 5;
+
+  // Warmup, which also filters out candidates that fail to launch
+  if (launch() != CUSPARSE_STATUS_SUCCESS) {
+    return std::numeric_limits<float>::infinity();
+  }
+
+  cudaEvent_t start, stop;
+  MATX_CUDA_CHECK(cudaEventCreate(&start));
+  MATX_CUDA_CHECK(cudaEventCreate(&stop));
+  MATX_CUDA_CHECK(cudaEventRecord(start, stream));
+  for (int iter = 0; iter < NUM_ITERS; iter++) {
+    launch();
+  }
+  MATX_CUDA_CHECK(cudaEventRecord(stop, stream));
+  MATX_CUDA_CHECK(cudaEventSynchronize(stop));
+
+  float ms;
+  MATX_CUDA_CHECK(cudaEventElapsedTime(&ms, start, stop));
+  cudaEventDestroy(start);
+  cudaEventDestroy(stop);
+  return ms / NUM_ITERS;
+}
+
+// Autotuning needs to synchronize, which is not allowed while capturing a graph
+__MATX_INLINE__ bool SparseCanAutotune(cudaStream_t stream) {
+  cudaStreamCaptureStatus capture_status;
+  MATX_CUDA_CHECK(cudaStreamIsCapturing(stream, &capture_status));
+  return capture_status == cudaStreamCaptureStatusNone;
+}
+
+} // end namespace detail
+
+/**
+ * Enable or disable cuSPARSE SpMV/SpMM algorithm autotuning
+ *
+ * By default sparse products pick a cuSPARSE algorithm from the sparse format, shape and number
+ * of nonzeros. When autotuning is enabled, the first execution of each new product benchmarks
+ * the candidate algorithms for its format and keeps the fastest. As with SetMatMulAutotune, the
+ * choice is saved in the kernel cache directory so later processes reuse it. Autotuning can also
+ * be enabled by setting the environment variable MATX_SPARSE_AUTOTUNE=1.
+ *
+ * @param enable Whether to autotune
+ */
+__MATX_INLINE__ void SetSparseAutotune(bool enable) {
+  detail::SparseAutotuneCache::Get().SetEnabled(enable);
+}
+
+} // end namespace matx
@@ -0,0 +1,306 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "cublas_v2.h"
+#include "matx/core/cache.h"
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/transforms/matmul/matmul_cuda.h"
+
+namespace matx {
+
+namespace detail {
+
+// cublasGemmGroupedBatchedEx was added in cuBLAS 12.5
+#if CUBLAS_VERSION >= 120500
+#define MATX_EN_CUBLAS_GROUPED_GEMM
+#endif
+
+template <typename T>
+inline constexpr bool is_grouped_gemm_type_v = std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                                               std::is_same_v<T, matxFp16> || std::is_same_v<T, matxBf16>;
+
+/**
+ * Parameters for a grouped GEMM. Each GEMM contributes m, n, k and its three leading
+ * dimensions, in list order.
+ */
+struct MatMulGroupedParams_t {
+  std::vector<index_t> dims;
+  MatXDataType_t dtype;
+  float alpha;
+  float beta;
+  cudaStream_t stream;
+};
+
+struct MatMulGroupedParamsKeyHash {
+  std::size_t operator()(const MatMulGroupedParams_t &k) const noexcept
+  {
+    size_t h = std::hash<uint64_t>()(k.dims.size()) + std::hash<uint64_t>()((size_t)k.stream);
+    for (const auto d : k.dims) {
+      h = h * 31 + std::hash<uint64_t>()(d);
+    }
+
+    return h;
+  }
+};
+
+struct MatMulGroupedParamsKeyEq {
+  bool operator()(const MatMulGroupedParams_t &l, const MatMulGroupedParams_t &t) const noexcept
+  {
+    return l.dims == t.dims && l.dtype == t.dtype && l.alpha == t.alpha && l.beta == t.beta &&
+           l.stream == t.stream;
+  }
+};
+
+using gemm_grouped_cache_t = std::unordered_map<MatMulGroupedParams_t, std::any,
+      MatMulGroupedParamsKeyHash, MatMulGroupedParamsKeyEq>;
+
+#ifdef MATX_EN_CUBLAS_GROUPED_GEMM
+/**
+ * Plan for a list of row-major GEMMs executed by one cublasGemmGroupedBatchedEx call
+ *
+ * GEMMs with identical shapes and leading dimensions share a group, so a list made of a few
+ * distinct sizes costs a few group descriptors no matter how many matrices it has. Row-major
+ * C = A * B is issued as column-major C^T = B^T * A^T, which needs no transposes.
+ *
+ * @tparam T Element type of A, B and C
+ */
+template <typename T>
+class MatMulGroupedHandle_t {
+public:
+  using scalar_t = std::conditional_t<std::is_same_v<T, double>, double, float>;
+
+  MatMulGroupedHandle_t(const MatMulGroupedParams_t &params)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    [[maybe_unused]] cublasStatus_t ret = cublasCreate(&handle_);
+    MATX_ASSERT_STR(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError, "Failed to create cuBLAS handle");
+
+    const size_t count = params.dims.size() / 6;
+    std::map<std::array<index_t, 6>, size_t> group_of;
+    std::vector<std::vector<size_t>> members;
+    for (size_t i = 0; i < count; i++) {
+      std::array<index_t, 6> key;
+      std::copy(params.dims.begin() + static_cast<std::ptrdiff_t>(6 * i),
+                params.dims.begin() + static_cast<std::ptrdiff_t>(6 * i + 6), key.begin());
+
+      auto el = group_of.find(key);
+      if (el == group_of.end()) {
+        el = group_of.emplace(key, members.size()).first;
+        members.emplace_back();
+
+        // Column-major: m' = n, n' = m, with B as the left operand
+        m_.push_back(static_cast<int>(key[1]));
+        n_.push_back(static_cast<int>(key[0]));
+        k_.push_back(static_cast<int>(key[2]));
+        lda_.push_back(static_cast<int>(key[4]));
+        ldb_.push_back(static_cast<int>(key[3]));
+        ldc_.push_back(static_cast<int>(key[5]));
+      }
+      members[el->second].push_back(i);
+    }
+
+    for (const auto &g : members) {
+      group_size_.push_back(static_cast<int>(g.size()));
+      order_.insert(order_.end(), g.begin(), g.end());
+    }
+
+    const size_t groups = members.size();
+    trans_.assign(groups, CUBLAS_OP_N);
+    alpha_.assign(groups, static_cast<scalar_t>(params.alpha));
+    beta_.assign(groups, static_cast<scalar_t>(params.beta));
+    host_ptrs_.resize(3 * count);
+    matxAlloc(reinterpret_cast<void **>(&dev_ptrs_), 3 * count * sizeof(void *), MATX_DEVICE_MEMORY);
+  }
+
+  ~MatMulGroupedHandle_t()
+  {
+    matxFree(dev_ptrs_);
+    cublasDestroy(handle_);
+  }
+
+  void Exec(const std::vector<T *> &c, const std::vector<const T *> &a, const std::vector<const T *> &b,
+            cudaStream_t stream)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    const size_t count = order_.size();
+    for (size_t i = 0; i < count; i++) {
+      host_ptrs_[i] = b[order_[i]];
+      host_ptrs_[count + i] = a[order_[i]];
+      host_ptrs_[2 * count + i] = c[order_[i]];
+    }
+
+    // Pageable copies are staged before cudaMemcpyAsync returns, so host_ptrs_ can be reused
+    [[maybe_unused]] auto err = cudaMemcpyAsync(dev_ptrs_, host_ptrs_.data(), 3 * count * sizeof(void *),
+                                                cudaMemcpyHostToDevice, stream);
+    MATX_ASSERT(err == cudaSuccess, matxCudaError);
+
+    cublasSetStream(handle_, stream);
+    const cublasComputeType_t compute = std::is_same_v<T, double> ? CUBLAS_COMPUTE_64F : CUBLAS_COMPUTE_32F;
+    [[maybe_unused]] auto ret = cublasGemmGroupedBatchedEx(handle_,
+        trans_.data(), trans_.data(),
+        m_.data(), n_.data(), k_.data(),
+        alpha_.data(),
+        dev_ptrs_, MatXTypeToCudaType<T>(), lda_.data(),
+        dev_ptrs_ + count, MatXTypeToCudaType<T>(), ldb_.data(),
+        beta_.data(),
+        const_cast<void *const *>(dev_ptrs_ + 2 * count), MatXTypeToCudaType<T>(), ldc_.data(),
+        static_cast<int>(group_size_.size()), group_size_.data(), compute);
+    MATX_ASSERT_STR(ret == CUBLAS_STATUS_SUCCESS, matxMatMulError, "cublasGemmGroupedBatchedEx failed");
+  }
+
+private:
+  cublasHandle_t handle_;
+  std::vector<cublasOperation_t> trans_;
+  std::vector<int> m_, n_, k_, lda_, ldb_, ldc_, group_size_;
+  std::vector<scalar_t> alpha_, beta_;
+  std::vector<size_t> order_;
+  std::vector<const void *> host_ptrs_;
+  const void **dev_ptrs_ = nullptr;
+};
+#endif
+
+} // end namespace detail
+
+/**
+ * Run a list of independent GEMMs with different shapes
+ *
+ * Computes `C[i] = alpha * A[i] * B[i] + beta * C[i]` for every i. Unlike batched matmul(), the
+ * shapes may differ between entries. For float, double, fp16 and bf16 rank-2 tensors with a unit
+ * last stride, all GEMMs run in a single cuBLAS grouped GEMM call (cuBLAS 12.5 or newer), with
+ * identically-shaped entries sharing a group. Other types, layouts or older cuBLAS versions fall
+ * back to one matmul per entry. The plan is cached on the list of shapes.
+ *
+ * @tparam TensorTypeC Type of the C tensors
+ * @tparam TensorTypeA Type of the A tensors
+ * @tparam TensorTypeB Type of the B tensors
+ * @param C Output tensors, each `m_i x n_i`
+ * @param A Input tensors, each `m_i x k_i`
+ * @param B Input tensors, each `k_i x n_i`
+ * @param exec CUDA executor
+ * @param alpha Scalar multiplier applied to every product
+ * @param beta Scalar multiplier applied to every C on input
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+void matmul_grouped(std::vector<TensorTypeC> &C, const std::vector<TensorTypeA> &A,
+                    const std::vector<TensorTypeB> &B, const cudaExecutor &exec,
+                    float alpha = 1.0f, float beta = 0.0f)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  MATX_ASSERT_STR(A.size() == B.size() && A.size() == C.size(), matxInvalidSize,
+      "matmul_grouped: A, B and C lists must have the same length");
+
+  if (C.empty()) {
+    return;
+  }
+
+  for (size_t i = 0; i < C.size(); i++) {
+    MATX_ASSERT_STR(A[i].Size(TensorTypeA::Rank() - 1) == B[i].Size(TensorTypeB::Rank() - 2), matxInvalidSize,
+        "matmul_grouped: inner dimensions of A and B must match");
+    MATX_ASSERT_STR(C[i].Size(TensorTypeC::Rank() - 2) == A[i].Size(TensorTypeA::Rank() - 2) &&
+                    C[i].Size(TensorTypeC::Rank() - 1) == B[i].Size(TensorTypeB::Rank() - 1), matxInvalidSize,
+        "matmul_grouped: C must be m x n");
+  }
+
+  auto fallback = [&]() {
+    for (size_t i = 0; i < C.size(); i++) {
+      matmul_impl(C[i], A[i], B[i], exec, alpha, beta);
+    }
+  };
+
+#ifdef MATX_EN_CUBLAS_GROUPED_GEMM
+  using T = typename TensorTypeC::value_type;
+  if constexpr (detail::is_grouped_gemm_type_v<T> &&
+                std::is_same_v<T, typename TensorTypeA::value_type> &&
+                std::is_same_v<T, typename TensorTypeB::value_type> &&
+                TensorTypeC::Rank() == 2 && TensorTypeA::Rank() == 2 && TensorTypeB::Rank() == 2 &&
+                is_tensor_view_v<TensorTypeC> && is_tensor_view_v<TensorTypeA> && is_tensor_view_v<TensorTypeB>) {
+    const auto stream = exec.getStream();
+    detail::MatMulGroupedParams_t params;
+    params.dtype = detail::TypeToInt<T>();
+    params.alpha = alpha;
+    params.beta = beta;
+    params.stream = stream;
+    params.dims.reserve(6 * C.size());
+
+    std::vector<T *> c_ptrs;
+    std::vector<const T *> a_ptrs;
+    std::vector<const T *> b_ptrs;
+    for (size_t i = 0; i < C.size(); i++) {
+      const bool unit = C[i].Stride(1) == 1 && A[i].Stride(1) == 1 && B[i].Stride(1) == 1;
+      const bool positive_ld = C[i].Stride(0) >= C[i].Size(1) && A[i].Stride(0) >= A[i].Size(1) &&
+                               B[i].Stride(0) >= B[i].Size(1);
+      if (!unit || !positive_ld) {
+        fallback();
+        return;
+      }
+
+      params.dims.insert(params.dims.end(), {A[i].Size(0), B[i].Size(1), A[i].Size(1),
+                                             A[i].Stride(0), B[i].Stride(0), C[i].Stride(0)});
+      c_ptrs.push_back(C[i].Data());
+      a_ptrs.push_back(A[i].Data());
+      b_ptrs.push_back(B[i].Data());
+    }
+
+    using cache_val_type = detail::MatMulGroupedHandle_t<T>;
+    auto cache_id = detail::GetCacheIdFromType<detail::gemm_grouped_cache_t>();
+    MATX_LOG_DEBUG("Grouped GEMM transform: cache_id={}", cache_id);
+    detail::GetCache().LookupAndExec<detail::gemm_grouped_cache_t>(
+      cache_id,
+      params,
+      [&]() {
+        return std::make_shared<cache_val_type>(params);
+      },
+      [&](std::shared_ptr<cache_val_type> ctype) {
+        ctype->Exec(c_ptrs, a_ptrs, b_ptrs, stream);
+      },
+      exec
+    );
+  }
+  else {
+    fallback();
+  }
+#else
+  fallback();
+#endif
+}
+
+} // end namespace matx
@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Multiply a Kronecker product by a matrix without forming the product
+ *
+ * Computes C = alpha * kron(A, B) * X + beta * C where A is M x N, B is P x Q and
+ * X is (N*Q) x K. Each column of X reshaped to an N x Q matrix Xk gives the matching
+ * column of C as A * Xk * B^T reshaped to M*P, so the product is evaluated as one
+ * GEMM with A followed by one GEMM with B. For a single column the second GEMM is
+ * U * B^T, otherwise it is B broadcast over a batch of M matrices of size Q x K.
+ *
+ * @param C
+ *   Output tensor of shape (M*P) x K
+ * @param A
+ *   Left factor of the Kronecker product
+ * @param B
+ *   Right factor of the Kronecker product
+ * @param X
+ *   Right-hand side of shape (N*Q) x K
+ * @param exec
+ *   Executor
+ * @param alpha
+ *   Scalar multiplier to apply to the product
+ * @param beta
+ *   Scalar multiplier to apply to C on input
+ */
+template <typename TensorTypeC, typename OpA, typename OpB, typename OpX, typename Executor>
+__MATX_INLINE__ void kron_matmul_impl(TensorTypeC C, const OpA &A, const OpB &B, const OpX &X,
+                                      const Executor &exec, float alpha = 1.0, float beta = 0.0)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T = typename TensorTypeC::value_type;
+
+  MATX_STATIC_ASSERT_STR(OpA::Rank() == 2 && OpB::Rank() == 2, matxInvalidDim,
+    "matmul: Kronecker factors must be rank 2");
+  MATX_STATIC_ASSERT_STR(OpX::Rank() == 2 && TensorTypeC::Rank() == 2, matxInvalidDim,
+    "matmul: Kronecker product must be multiplied by a rank-2 operand");
+
+  const index_t m = A.Size(0);
+  const index_t n = A.Size(1);
+  const index_t p = B.Size(0);
+  const index_t q = B.Size(1);
+  const index_t k = X.Size(1);
+
+  MATX_ASSERT_STR(X.Size(0) == n * q, matxInvalidSize,
+    "matmul: inner dimensions of the Kronecker product and B must match");
+  MATX_ASSERT_STR(C.Size(0) == m * p && C.Size(1) == k, matxInvalidSize,
+    "matmul: output must be (M*P) x K for a Kronecker product input");
+
+  auto allocate = [&](tensor_t<T, 2> &t, index_t rows, index_t cols) {
+    if constexpr (is_cuda_executor_v<Executor>) {
+      detail::ScratchScope scratch{exec.getStream()};
+      make_tensor(t, {rows, cols}, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+    }
+    else {
+      make_tensor(t, {rows, cols}, MATX_HOST_MALLOC_MEMORY);
+    }
+  };
+
+  // Both reshapes below require dense row-major storage, so anything else is staged
+  T *x_ptr = nullptr;
+  tensor_t<T, 2> x_tmp;
+  if constexpr (is_tensor_v<OpX> && std::is_same_v<typename OpX::value_type, T>) {
+    if (X.IsContiguous()) {
+      x_ptr = X.Data();
+    }
+  }
+  if (x_ptr == nullptr) {
+    allocate(x_tmp, n * q, k);
+    (x_tmp = X).run(exec);
+    x_ptr = x_tmp.Data();
+  }
+
+  T *c_ptr = nullptr;
+  tensor_t<T, 2> c_tmp;
+  if constexpr (is_tensor_v<TensorTypeC>) {
+    if (C.IsContiguous()) {
+      c_ptr = C.Data();
+    }
+  }
+  if (c_ptr == nullptr) {
+    allocate(c_tmp, m * p, k);
+    if (beta != 0.0f) {
+      (c_tmp = C).run(exec);
+    }
+    c_ptr = c_tmp.Data();
+  }
+
+  // U = A * [X_0 ... X_{K-1}] where row j of the view holds X(j*Q + l, col) at l*K + col
+  tensor_t<T, 2> u;
+  allocate(u, m, q * k);
+  auto xv = make_tensor<T>(x_ptr, {n, q * k});
+  matmul_impl(u, A, xv, exec);
+
+  if (k == 1) {
+    auto cv = make_tensor<T>(c_ptr, {m, p});
+    matmul_impl(cv, u, transpose_matrix(B), exec, alpha, beta);
+  }
+  else {
+    auto cv = make_tensor<T>(c_ptr, {m, p, k});
+    auto uv = make_tensor<T>(u.Data(), {m, q, k});
+    matmul_impl(cv, B, uv, exec, alpha, beta);
+  }
+
+  if (c_tmp.Data() != nullptr) {
+    (C = c_tmp).run(exec);
+  }
+}
+
+} // end namespace detail
+
+} // end namespace matx
@@ -0,0 +1,424 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cublasLt.h>
+
+#include "matx/core/cache.h"
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/core/utils.h"
+
+namespace matx {
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_matmul_fp8_v = std::is_same_v<T, matxFp8E4M3> || std::is_same_v<T, matxFp8E5M2>;
+
+/**
+ * Input type combinations accepted by the scaled GEMM. cuBLASLt has no kernels for
+ * E5M2 on both inputs.
+ */
+template <typename TA, typename TB>
+constexpr bool CompatibleScaledGemmCUDATypes() {
+  if constexpr (is_matmul_fp8_v<TA> && is_matmul_fp8_v<TB>) {
+    return !(std::is_same_v<TA, matxFp8E5M2> && std::is_same_v<TB, matxFp8E5M2>);
+  }
+  else {
+    return std::is_same_v<TA, int8_t> && std::is_same_v<TB, int8_t>;
+  }
+}
+
+/**
+ * Parameters needed to execute a scaled low-precision GEMM. The GEMM is always issued in
+ * cuBLASLt's column-major TN form, so only the leading dimensions can vary.
+ */
+struct MatMulScaledCUDAParams_t {
+  index_t m = 0;
+  index_t n = 0;
+  index_t k = 0;
+  index_t lda = 0;
+  index_t ldb = 0;
+  index_t ldd = 0;
+  MatXDataType_t dtype_a;
+  MatXDataType_t dtype_b;
+  MatXDataType_t dtype_d;
+  bool fused_scales = false;
+  cudaStream_t stream;
+};
+
+struct MatMulScaledCUDAParamsKeyHash {
+  std::size_t operator()(const MatMulScaledCUDAParams_t &k) const noexcept
+  {
+    return std::hash<uint64_t>()(k.m) + std::hash<uint64_t>()(k.n) +
+           std::hash<uint64_t>()(k.k) + std::hash<uint64_t>()(k.dtype_a) +
+           std::hash<uint64_t>()((size_t)k.stream);
+  }
+};
+
+struct MatMulScaledCUDAParamsKeyEq {
+  bool operator()(const MatMulScaledCUDAParams_t &l, const MatMulScaledCUDAParams_t &t) const noexcept
+  {
+    return l.m == t.m && l.n == t.n && l.k == t.k &&
+           l.lda == t.lda && l.ldb == t.ldb && l.ldd == t.ldd &&
+           l.dtype_a == t.dtype_a && l.dtype_b == t.dtype_b && l.dtype_d == t.dtype_d &&
+           l.fused_scales == t.fused_scales && l.stream == t.stream;
+  }
+};
+
+using gemm_scaled_cuda_cache_t = std::unordered_map<MatMulScaledCUDAParams_t, std::any,
+      MatMulScaledCUDAParamsKeyHash, MatMulScaledCUDAParamsKeyEq>;
+
+/**
+ * cuBLASLt plan for an FP8 or INT8 GEMM
+ *
+ * A row-major `m x k` A and a column-major `k x n` B are handed to cuBLASLt as the
+ * column-major TN product `D^T = B^T A`, which is the only layout cuBLASLt accepts for FP8
+ * and the fastest one for INT8. D^T in column-major order is the row-major `m x n` result.
+ *
+ * @tparam TA Type of A
+ * @tparam TB Type of B
+ * @tparam TD Type of the GEMM output
+ */
+template <typename TA, typename TB, typename TD>
+class MatMulScaledCUDAHandle_t {
+public:
+  static constexpr bool is_int = std::is_same_v<TA, int8_t>;
+
+  MatMulScaledCUDAHandle_t(const MatMulScaledCUDAParams_t &params) : params_(params)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    constexpr size_t MiB = 1024*1024;
+    workspaceSize_ = detail::IsHopperOrAbove() ? 32*MiB : 4*MiB;
+
+    ret_ = cublasLtCreate(&ltHandle_);
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+
+    const cublasComputeType_t compute = is_int ? CUBLAS_COMPUTE_32I : CUBLAS_COMPUTE_32F;
+    const cudaDataType_t scale = is_int ? CUDA_R_32I : CUDA_R_32F;
+    ret_ = cublasLtMatmulDescCreate(&operationDesc_, compute, scale);
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+
+    const cublasOperation_t opT = CUBLAS_OP_T;
+    const cublasOperation_t opN = CUBLAS_OP_N;
+    ret_ = cublasLtMatmulDescSetAttribute(operationDesc_, CUBLASLT_MATMUL_DESC_TRANSA, &opT, sizeof(opT));
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+    ret_ = cublasLtMatmulDescSetAttribute(operationDesc_, CUBLASLT_MATMUL_DESC_TRANSB, &opN, sizeof(opN));
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+
+    // cuBLASLt's A is our B and vice versa
+    ret_ = cublasLtMatrixLayoutCreate(&Adesc_, MatXTypeToCudaType<TB>(), params_.k, params_.n, params_.ldb);
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+    ret_ = cublasLtMatrixLayoutCreate(&Bdesc_, MatXTypeToCudaType<TA>(), params_.k, params_.m, params_.lda);
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+    ret_ = cublasLtMatrixLayoutCreate(&Ddesc_, MatXTypeToCudaType<TD>(), params_.n, params_.m, params_.ldd);
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+
+    ret_ = cublasLtMatmulPreferenceCreate(&preference_);
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+    ret_ = cublasLtMatmulPreferenceSetAttribute(preference_, CUBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                                &workspaceSize_, sizeof(workspaceSize_));
+    MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+
+    int returned = 0;
+    ret_ = cublasLtMatmulAlgoGetHeuristic(ltHandle_, operationDesc_, Adesc_, Bdesc_, Ddesc_, Ddesc_,
+                                          preference_, 1, &heuristicResult_, &returned);
+    MATX_ASSERT_STR(ret_ == CUBLAS_STATUS_SUCCESS && returned > 0, matxMatMulError,
+        "No cuBLASLt algorithm found for the scaled GEMM");
+  }
+
+  ~MatMulScaledCUDAHandle_t()
+  {
+    cublasLtMatmulPreferenceDestroy(preference_);
+    cublasLtMatrixLayoutDestroy(Ddesc_);
+    cublasLtMatrixLayoutDestroy(Bdesc_);
+    cublasLtMatrixLayoutDestroy(Adesc_);
+    cublasLtMatmulDescDestroy(operationDesc_);
+    cublasLtDestroy(ltHandle_);
+  }
+
+  /**
+   * Execute the GEMM
+   *
+   * @param d Output pointer
+   * @param a Pointer to row-major A
+   * @param b Pointer to column-major B
+   * @param scale_a Device pointer to A's per-tensor scale when scales are fused, otherwise unused
+   * @param scale_b Device pointer to B's per-tensor scale when scales are fused, otherwise unused
+   * @param stream CUDA stream
+   */
+  void Exec(void *d, const void *a, const void *b, const float *scale_a, const float *scale_b,
+            cudaStream_t stream)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    if (params_.fused_scales) {
+      ret_ = cublasLtMatmulDescSetAttribute(operationDesc_, CUBLASLT_MATMUL_DESC_A_SCALE_POINTER,
+                                            &scale_b, sizeof(scale_b));
+      MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+      ret_ = cublasLtMatmulDescSetAttribute(operationDesc_, CUBLASLT_MATMUL_DESC_B_SCALE_POINTER,
+                                            &scale_a, sizeof(scale_a));
+      MATX_ASSERT(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError);
+    }
+
+    void *workspace = GetCache().GetStreamAlloc(stream, workspaceSize_);
+    MATX_ASSERT_STR(workspace != nullptr, matxCudaError, "Failed to get workspace for stream");
+
+    using scale_t = std::conditional_t<is_int, int32_t, float>;
+    const scale_t alpha = 1;
+    const scale_t beta = 0;
+    ret_ = cublasLtMatmul(ltHandle_, operationDesc_, &alpha, b, Adesc_, a, Bdesc_, &beta,
+                          d, Ddesc_, d, Ddesc_, &heuristicResult_.algo,
+                          workspace, workspaceSize_, stream);
+    MATX_ASSERT_STR(ret_ == CUBLAS_STATUS_SUCCESS, matxMatMulError, "cublasLtMatmul failed for scaled GEMM");
+  }
+
+private:
+  cublasLtHandle_t ltHandle_;
+  cublasStatus_t ret_ = CUBLAS_STATUS_SUCCESS;
+  cublasLtMatmulDesc_t operationDesc_ = nullptr;
+  cublasLtMatrixLayout_t Adesc_ = nullptr;
+  cublasLtMatrixLayout_t Bdesc_ = nullptr;
+  cublasLtMatrixLayout_t Ddesc_ = nullptr;
+  cublasLtMatmulPreference_t preference_ = nullptr;
+  cublasLtMatmulHeuristicResult_t heuristicResult_ = {};
+  size_t workspaceSize_ = 0;
+  MatMulScaledCUDAParams_t params_;
+};
+
+/**
+ * Broadcast a rank-0 or rank-1 scale to an `m x n` output. A's scales run along the rows of
+ * the output and B's along the columns.
+ */
+template <bool ALONG_ROWS, typename ScaleOp>
+__MATX_INLINE__ auto matmul_scale_bcast(const ScaleOp &s, index_t m, index_t n) {
+  auto sf = as_type<float>(s);
+  if constexpr (ScaleOp::Rank() == 0) {
+    return clone<2>(sf, {m, n});
+  }
+  else if constexpr (ALONG_ROWS) {
+    return clone<2>(sf, {matxKeepDim, n});
+  }
+  else {
+    return clone<2>(sf, {m, matxKeepDim});
+  }
+}
+
+} // end namespace detail
+
+/**
+ * Run an FP8 or INT8 GEMM with scale factors
+ *
+ * Computes `C(i,j) = scale_a(i) * scale_b(j) * sum_k A(i,k) * B(k,j)` with FP32 accumulation for
+ * FP8 inputs and INT32 accumulation for INT8 inputs. Each scale is either rank 0 (per tensor) or
+ * rank 1 (per channel: one value per row of A, or one per column of B). FP8 GEMMs with per-tensor
+ * scales and a float, fp16 or bf16 contiguous output pass the scales to cuBLASLt and write C
+ * directly. All other combinations accumulate into a temporary, and one element-wise pass applies
+ * the scales and converts to C's type.
+ *
+ * A is used in place when it is row-major with a unit last stride. B is used in place when it is
+ * column-major, e.g. the transpose of an `n x k` tensor, which is how weights are usually stored.
+ * Other layouts and operators are copied first.
+ *
+ * @tparam TensorTypeC Type of C
+ * @tparam OpA Type of A
+ * @tparam OpB Type of B
+ * @tparam ScaleA Type of A's scale
+ * @tparam ScaleB Type of B's scale
+ * @param C Output tensor of shape `m x n`
+ * @param A Input of shape `m x k`
+ * @param B Input of shape `k x n`
+ * @param scale_a Rank-0 or length-`m` scale for A
+ * @param scale_b Rank-0 or length-`n` scale for B
+ * @param exec CUDA executor
+ */
+template <typename TensorTypeC, typename OpA, typename OpB, typename ScaleA, typename ScaleB>
+void matmul_scaled_impl(TensorTypeC C, const OpA &A, const OpB &B, const ScaleA &scale_a,
+                        const ScaleB &scale_b, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using TA = typename OpA::value_type;
+  using TB = typename OpB::value_type;
+  using TC = typename TensorTypeC::value_type;
+  constexpr bool is_fp8 = detail::is_matmul_fp8_v<TA>;
+  using acc_t = std::conditional_t<is_fp8, float, int32_t>;
+
+  static_assert(detail::CompatibleScaledGemmCUDATypes<TA, TB>(),
+      "matmul_scaled: A and B must both be FP8 (not both E5M2) or both int8");
+  static_assert(OpA::Rank() == 2 && OpB::Rank() == 2 && TensorTypeC::Rank() == 2,
+      "matmul_scaled: only rank-2 inputs and outputs are supported");
+  static_assert(ScaleA::Rank() <= 1 && ScaleB::Rank() <= 1,
+      "matmul_scaled: scales must be rank 0 (per tensor) or rank 1 (per channel)");
+
+  const auto stream = exec.getStream();
+  const index_t m = A.Size(0);
+  const index_t k = A.Size(1);
+  const index_t n = B.Size(1);
+
+  MATX_ASSERT_STR(B.Size(0) == k, matxInvalidSize, "matmul_scaled: inner dimensions of A and B must match");
+  MATX_ASSERT_STR(C.Size(0) == m && C.Size(1) == n, matxInvalidSize, "matmul_scaled: C must be m x n");
+  if constexpr (ScaleA::Rank() == 1) {
+    MATX_ASSERT_STR(scale_a.Size(0) == m, matxInvalidSize, "matmul_scaled: per-channel scale_a must have one value per row of A");
+  }
+  if constexpr (ScaleB::Rank() == 1) {
+    MATX_ASSERT_STR(scale_b.Size(0) == n, matxInvalidSize, "matmul_scaled: per-channel scale_b must have one value per column of B");
+  }
+
+  if constexpr (is_fp8) {
+    MATX_ASSERT_STR(detail::GetComputeCapability() >= 890, matxNotSupported,
+        "matmul_scaled: FP8 GEMMs require compute capability 8.9 or newer");
+    MATX_ASSERT_STR(k % 16 == 0, matxInvalidSize, "matmul_scaled: FP8 GEMMs require k to be a multiple of 16");
+  }
+  else {
+    MATX_ASSERT_STR(k % 4 == 0, matxInvalidSize, "matmul_scaled: INT8 GEMMs require k to be a multiple of 4");
+  }
+
+  // A must be row-major with a unit last stride
+  auto a = detail::GetSupportedTensor(A, [&]() {
+    if constexpr (is_tensor_view_v<OpA>) {
+      return A.Stride(1) == 1 && A.Stride(0) >= k;
+    }
+    else {
+      return true;
+    }
+  }, MATX_ASYNC_DEVICE_MEMORY, stream);
+  if (!a.isSameView(A)) {
+    (a = A).run(stream);
+  }
+
+  // B must be column-major. Otherwise store its transpose as a row-major n x k tensor.
+  const TB *b_ptr = nullptr;
+  index_t ldb = 0;
+  bool b_direct = false;
+  if constexpr (is_tensor_view_v<OpB>) {
+    b_direct = B.Stride(0) == 1 && B.Stride(1) >= k;
+  }
+
+  tensor_t<TB, 2> bt;
+  if (b_direct) {
+    if constexpr (is_tensor_view_v<OpB>) {
+      b_ptr = B.Data();
+      ldb = B.Stride(1);
+    }
+  }
+  else {
+    make_tensor(bt, {n, k}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    (bt = transpose_matrix(B)).run(stream);
+    b_ptr = bt.Data();
+    ldb = k;
+  }
+
+  // cuBLASLt applies per-tensor FP8 scales itself and can write fp32/fp16/bf16 outputs
+  constexpr bool fusable = is_fp8 && ScaleA::Rank() == 0 && ScaleB::Rank() == 0 &&
+      (std::is_same_v<TC, float> || std::is_same_v<TC, matxFp16> || std::is_same_v<TC, matxBf16>);
+  bool direct_out = false;
+  if constexpr (fusable) {
+    direct_out = C.Stride(1) == 1 && C.Stride(0) >= n;
+  }
+
+  detail::MatMulScaledCUDAParams_t params;
+  params.m = m;
+  params.n = n;
+  params.k = k;
+  params.lda = a.Stride(0);
+  params.ldb = ldb;
+  params.dtype_a = detail::TypeToInt<TA>();
+  params.dtype_b = detail::TypeToInt<TB>();
+  params.stream = stream;
+
+  auto cache_id = detail::GetCacheIdFromType<detail::gemm_scaled_cuda_cache_t>();
+  MATX_LOG_DEBUG("Scaled GEMM transform: cache_id={}", cache_id);
+
+  if (direct_out) {
+    if constexpr (fusable) {
+      auto get_scale = [&](const auto &s) {
+        using S = remove_cvref_t<decltype(s)>;
+        if constexpr (is_tensor_view_v<S> && std::is_same_v<typename S::value_type, float>) {
+          return s;
+        }
+        else {
+          auto t = make_tensor<float>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
+          (t = as_type<float>(s)).run(stream);
+          return t;
+        }
+      };
+      auto sa = get_scale(scale_a);
+      auto sb = get_scale(scale_b);
+
+      params.ldd = C.Stride(0);
+      params.dtype_d = detail::TypeToInt<TC>();
+      params.fused_scales = true;
+
+      using cache_val_type = detail::MatMulScaledCUDAHandle_t<TA, TB, TC>;
+      detail::GetCache().LookupAndExec<detail::gemm_scaled_cuda_cache_t>(
+        cache_id,
+        params,
+        [&]() {
+          return std::make_shared<cache_val_type>(params);
+        },
+        [&](std::shared_ptr<cache_val_type> ctype) {
+          ctype->Exec(C.Data(), a.Data(), b_ptr, sa.Data(), sb.Data(), stream);
+        },
+        exec
+      );
+    }
+  }
+  else {
+    auto d = make_tensor<acc_t>({m, n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    params.ldd = n;
+    params.dtype_d = detail::TypeToInt<acc_t>();
+
+    using cache_val_type = detail::MatMulScaledCUDAHandle_t<TA, TB, acc_t>;
+    detail::GetCache().LookupAndExec<detail::gemm_scaled_cuda_cache_t>(
+      cache_id,
+      params,
+      [&]() {
+        return std::make_shared<cache_val_type>(params);
+      },
+      [&](std::shared_ptr<cache_val_type> ctype) {
+        ctype->Exec(d.Data(), a.Data(), b_ptr, nullptr, nullptr, stream);
+      },
+      exec
+    );
+
+    (C = as_type<TC>(as_type<float>(d) *
+                     detail::matmul_scale_bcast<true>(scale_a, m, n) *
+                     detail::matmul_scale_bcast<false>(scale_b, m, n))).run(stream);
+  }
+}
+
+} // end namespace matx
@@ -41,6 +41,7 @@
 #include "matx/core/sparse_tensor.h"
 #include "matx/core/tensor.h"
 #include "matx/kernels/matvec.cuh"
+#include "matx/transforms/matmul/matmul_cusparse_common.h"
 
 namespace matx {
 
@@ -62,6 +63,8 @@ struct MatVecCUSPARSEParams_t {
   cusparseOperation_t opA;
   // Matrix handles in cuSPARSE are data specific (unlike e.g. cuBLAS
   // where the same plan can be shared between different data buffers).
+  // Only the buffers of A identify a plan, since its preprocessing depends
+  // on A alone. The dense vectors are rebound on every call.
   void *ptrA0;
   void *ptrA1;
   void *ptrA2;
@@ -87,7 +90,7 @@ public:
   MatVecCUSPARSEHandle_t(TensorTypeC &c, const TensorTypeA &a,
                          const TensorTypeB &b, cudaStream_t stream, float alpha,
                          float beta) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     params_ = GetSpMVParams(c, a, b, stream, alpha, beta);
 
     // Properly typed alpha, beta.
@@ -105,6 +108,8 @@ public:
 
     [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
     MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseSetStream(handle_, stream);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
 
     // Create cuSPARSE handle for sparse matrix A.
     static_assert(is_sparse_tensor_v<TensorTypeA>);
@@ -141,24 +146,122 @@ public:
     ret = cusparseCreateDnVec(&vecC_, params_.m, params_.ptrC, dtc);
     MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
 
-    // Allocate a workspace for SpMV.
-    const cusparseSpMVAlg_t algo = CUSPARSE_SPMV_ALG_DEFAULT;
+    // Pick the algorithm from the shape, or from a previous autotuning run,
+    // then allocate its workspace and preprocess A once for all later calls.
+    using Format = typename TensorTypeA::Format;
+    algo_ = SelectSpMVAlg<Format>(params_.m, params_.n, params_.nse);
+    auto &autotune = SparseAutotuneCache::Get();
+    if (autotune.Enabled()) {
+      const auto candidates = SpMVAlgCandidates<Format>();
+      const auto key = SparseAutotuneKey("spmv", SparseFormatName<Format>(),
+                                         dta, ct, params_.m, params_.n, 1,
+                                         params_.nse);
+      int index;
+      if (autotune.Lookup(key, index) && index >= 0 &&
+          index < static_cast<int>(candidates.size())) {
+        MATX_LOG_DEBUG("Using autotuned SpMV algorithm {} for {}", index, key);
+        algo_ = candidates[index];
+      } else if (SparseCanAutotune(stream)) {
+        index = Autotune(candidates);
+        if (index >= 0) {
+          MATX_LOG_DEBUG("SpMV autotune selected candidate {} for {}", index, key);
+          algo_ = candidates[index];
+          autotune.Store(key, index);
+        }
+      }
+    }
+    ret = Prepare(algo_);
+    if (ret != CUSPARSE_STATUS_SUCCESS && algo_ != CUSPARSE_SPMV_ALG_DEFAULT) {
+      // Not every algorithm supports every type, so fall back to the default
+      algo_ = CUSPARSE_SPMV_ALG_DEFAULT;
+      ret = Prepare(algo_);
+    }
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+  }
+
+  ~MatVecCUSPARSEHandle_t() {
+    if (workspaceSize_) {
+      matxFree(workspace_, params_.stream);
+    }
+    cusparseDestroyDnVec(vecB_);
+    cusparseDestroyDnVec(vecC_);
+    cusparseDestroySpMat(matA_);
+    cusparseDestroy(handle_);
+  }
+
+  /**
+   * Size and allocate the workspace for an algorithm and run the one-time
+   * preprocessing of A
+   */
+  cusparseStatus_t Prepare(cusparseSpMVAlg_t algo) {
+    if (workspaceSize_) {
+      matxFree(workspace_, params_.stream);
+      workspace_ = nullptr;
+    }
     const cudaDataType comptp = MatXTypeToCudaType<TCOMP>();
-    ret =
+    cusparseStatus_t ret =
         cusparseSpMV_bufferSize(handle_, params_.opA, &salpha_, matA_, vecB_,
                                 &sbeta_, vecC_, comptp, algo, &workspaceSize_);
-    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    if (ret != CUSPARSE_STATUS_SUCCESS) {
+      workspaceSize_ = 0;
+      return ret;
+    }
     if (workspaceSize_) {
       matxAlloc((void **)&workspace_, workspaceSize_, MATX_DEVICE_MEMORY,
-                stream);
+                params_.stream);
     }
+#if CUDART_VERSION >= 12040
+    // Preprocessing is an optimization, so algorithms without it still run
+    if (cusparseSpMV_preprocess(handle_, params_.opA, &salpha_, matA_, vecB_,
+                                &sbeta_, vecC_, comptp, algo,
+                                workspace_) != CUSPARSE_STATUS_SUCCESS) {
+      MATX_LOG_DEBUG("SpMV preprocessing not supported for algorithm {}",
+                     static_cast<int>(algo));
+    }
+#endif
+    return ret;
   }
 
-  ~MatVecCUSPARSEHandle_t() {
-    if (workspaceSize_) {
-      matxFree(workspace_, params_.stream);
+  /**
+   * Benchmark the candidate algorithms and return the index of the fastest,
+   * or -1 if none ran. The candidates write into C with beta = 0, so this
+   * must run before the first real SpMV.
+   */
+  int Autotune(const std::vector<cusparseSpMVAlg_t> &candidates) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    const cudaDataType comptp = MatXTypeToCudaType<TCOMP>();
+    const TCOMP szero{};
+    void *scratch;
+    matxAlloc(&scratch, params_.m * sizeof(TC), MATX_ASYNC_DEVICE_MEMORY,
+              params_.stream);
+    cusparseDnVecDescr_t vecS;
+    [[maybe_unused]] cusparseStatus_t ret = cusparseCreateDnVec(
+        &vecS, params_.m, scratch, MatXTypeToCudaType<TC>());
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    int best = -1;
+    float best_ms = std::numeric_limits<float>::infinity();
+    for (int i = 0; i < static_cast<int>(candidates.size()); i++) {
+      if (Prepare(candidates[i]) != CUSPARSE_STATUS_SUCCESS) {
+        continue;
+      }
+      const float ms = SparseAutotuneTime(
+          [&]() {
+            return cusparseSpMV(handle_, params_.opA, &salpha_, matA_, vecB_,
+                                &szero, vecS, comptp, candidates[i],
+                                workspace_);
+          },
+          params_.stream);
+      MATX_LOG_DEBUG("SpMV autotune candidate {}: {} ms", i, ms);
+      if (ms < best_ms) {
+        best_ms = ms;
+        best = i;
+      }
     }
-    cusparseDestroy(handle_);
+
+    cusparseDestroyDnVec(vecS);
+    matxFree(scratch, params_.stream);
+    return best;
   }
 
   static detail::MatVecCUSPARSEParams_t
@@ -188,15 +291,23 @@ public:
     return params;
   }
 
-  __MATX_INLINE__ void Exec([[maybe_unused]] TensorTypeC &c,
-                            [[maybe_unused]] const TensorTypeA &a,
-                            [[maybe_unused]] const TensorTypeB &b) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
-    const cusparseSpMVAlg_t algo = CUSPARSE_SPMV_ALG_DEFAULT;
+  __MATX_INLINE__ void Exec(TensorTypeC &c, [[maybe_unused]] const TensorTypeA &a,
+                            const TensorTypeB &b) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
+    [[maybe_unused]] cusparseStatus_t ret;
+    if (b.Data() != params_.ptrB) {
+      params_.ptrB = b.Data();
+      ret = cusparseDnVecSetValues(vecB_, params_.ptrB);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    }
+    if (c.Data() != params_.ptrC) {
+      params_.ptrC = c.Data();
+      ret = cusparseDnVecSetValues(vecC_, params_.ptrC);
+      MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    }
     const cudaDataType comptp = MatXTypeToCudaType<TCOMP>();
-    [[maybe_unused]] cusparseStatus_t ret =
-        cusparseSpMV(handle_, params_.opA, &salpha_, matA_, vecB_, &sbeta_,
-                     vecC_, comptp, algo, workspace_);
+    ret = cusparseSpMV(handle_, params_.opA, &salpha_, matA_, vecB_, &sbeta_,
+                       vecC_, comptp, algo_, workspace_);
     MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
   }
 
@@ -205,6 +316,7 @@ private:
   cusparseSpMatDescr_t matA_ = nullptr;
   cusparseDnVecDescr_t vecB_ = nullptr;
   cusparseDnVecDescr_t vecC_ = nullptr;
+  cusparseSpMVAlg_t algo_ = CUSPARSE_SPMV_ALG_DEFAULT;
   size_t workspaceSize_ = 0;
   void *workspace_ = nullptr;
   detail::MatVecCUSPARSEParams_t params_;
@@ -220,8 +332,8 @@ private:
 struct MatVecCUSPARSEParamsKeyHash {
   std::size_t operator()(const MatVecCUSPARSEParams_t &k) const noexcept {
     return std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA0)) +
-           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrB)) +
-           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrC)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA2)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA4)) +
            std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.stream));
   }
 };
@@ -237,8 +349,7 @@ struct MatVecCUSPARSEParamsKeyEq {
            l.stream == t.stream && l.alpha == t.alpha && l.beta == t.beta &&
            l.nse == t.nse && l.m == t.m && l.n == t.n && l.opA == t.opA &&
            l.ptrA0 == t.ptrA0 && l.ptrA1 == t.ptrA1 && l.ptrA2 == t.ptrA2 &&
-           l.ptrA3 == t.ptrA3 && l.ptrA4 == t.ptrA4 && l.ptrB == t.ptrB &&
-           l.ptrC == t.ptrC;
+           l.ptrA3 == t.ptrA3 && l.ptrA4 == t.ptrA4;
   }
 };
 
@@ -265,7 +376,7 @@ template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
 void sparse_matvec_impl(TensorTypeC &C, const TensorTypeA &a,
                         const TensorTypeB &B, const cudaExecutor &exec,
                         float alpha = 1.0, float beta = 0.0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   // Transform into supported form.
@@ -288,7 +399,9 @@ void sparse_matvec_impl(TensorTypeC &C, const TensorTypeA &a,
   static constexpr int RANKC = ctype::Rank();
 
   // Restrictions.
-  static_assert(RANKA == 2 && RANKB == 1 && RANKC == 1,
+  static constexpr bool BATCHED = atype::Format::isBatchedDIAIUniform();
+  static_assert((RANKA == 2 || (BATCHED && RANKA == 3)) && RANKB == 1 &&
+                    RANKC == 1,
                 "tensors must have SpMV rank");
   static_assert(std::is_same_v<TC, TA> && std::is_same_v<TC, TB>,
                 "tensors must have the same data type");
@@ -298,13 +411,16 @@ void sparse_matvec_impl(TensorTypeC &C, const TensorTypeA &a,
                     std::is_same_v<TC, cuda::std::complex<float>> ||
                     std::is_same_v<TC, cuda::std::complex<double>>,
                 "unsupported data type");
-  MATX_ASSERT(a.Size(RANKA - 1) == b.Size(RANKB - 1) &&
-                  a.Size(RANKA - 2) == c.Size(RANKC - 1),
+  // A uniform batch of matrices operates on stacked vectors.
+  [[maybe_unused]] const index_t batches = BATCHED ? a.Size(0) : 1;
+  MATX_ASSERT(batches * a.Size(RANKA - 1) == b.Size(RANKB - 1) &&
+                  batches * a.Size(RANKA - 2) == c.Size(RANKC - 1),
               matxInvalidSize);
   MATX_ASSERT(b.Stride(RANKB - 1) == 1 && c.Stride(RANKC - 1) == 1,
               matxInvalidParameter);
 
-  if constexpr (atype::Format::isDIAI() || atype::Format::isDIAJ()) {
+  if constexpr (atype::Format::isDIAI() || atype::Format::isDIAJ() ||
+                BATCHED) {
 
     // Fall back to a hand-written kernel for DIA format, since
     // this format is not supported in cuSPARSE. The hand-written
@@ -313,7 +429,7 @@ void sparse_matvec_impl(TensorTypeC &C, const TensorTypeA &a,
 #ifndef __CUDACC__
     MATX_THROW(matxNotSupported, "DIA SpMV not supported on host");
 #else
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     assert(alpha == 1.0 && beta == 0.0); // optimized for this case
     using CRD = typename atype::crd_type;
     TA *AD = a.Data();
@@ -321,17 +437,22 @@ void sparse_matvec_impl(TensorTypeC &C, const TensorTypeA &a,
     TA *CD = c.Data();
     CRD *diags = a.CRDData(0);
     uint64_t numD = a.crdSize(0);
-    uint64_t m = a.Size(0);
-    uint64_t n = a.Size(1);
-    uint32_t THREADS = static_cast<uint32_t>(std::min(m, 1024LU));
-    uint32_t BATCHES = static_cast<uint32_t>(
-        cuda::std::ceil(static_cast<double>(m) / THREADS));
-    if constexpr (atype::Format::isDIAI())
-      diai_spmv_kernel<<<BATCHES, THREADS, 0, stream>>>(AD, diags, numD, BD, CD,
-                                                        m, n);
+    uint64_t m = a.Size(RANKA - 2);
+    uint64_t n = a.Size(RANKA - 1);
+    // Each block stages a window of B of up to four times its row tile,
+    // which covers all bands of up to 3 x THREADS diagonals wide.
+    uint32_t THREADS = static_cast<uint32_t>(std::min(m, 256LU));
+    uint64_t window = 4 * static_cast<uint64_t>(THREADS);
+    size_t shm = window * sizeof(TA);
+    dim3 grid(static_cast<uint32_t>(
+                  cuda::std::ceil(static_cast<double>(m) / THREADS)),
+              static_cast<uint32_t>(batches));
+    if constexpr (atype::Format::isDIAJ())
+      dia_spmv_kernel<false><<<grid, THREADS, shm, stream>>>(
+          AD, diags, numD, BD, CD, m, n, window);
     else
-      diaj_spmv_kernel<<<BATCHES, THREADS, 0, stream>>>(AD, diags, numD, BD, CD,
-                                                        m, n);
+      dia_spmv_kernel<true><<<grid, THREADS, shm, stream>>>(
+          AD, diags, numD, BD, CD, m, n, window);
 #endif
 
   } else {
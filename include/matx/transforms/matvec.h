@@ -32,8 +32,90 @@
 
 #pragma once
 
+#include <algorithm>
+
+#include "matx/kernels/matvec.cuh"
+
 namespace matx {
 
+namespace detail {
+
+// Matrices up to this size in both dimensions use the batched small-matrix kernel
+constexpr index_t MATVEC_SMALL_MAX_DIM = 32;
+
+template <typename T>
+inline constexpr bool is_small_matvec_type_v = std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                                               std::is_same_v<T, cuda::std::complex<float>> ||
+                                               std::is_same_v<T, cuda::std::complex<double>>;
+
+/**
+ * Batched matvec over many tiny matrices with a custom kernel
+ *
+ * cuBLAS handles each batch entry of a batched GEMV with far more threads than a 4x4 to
+ * 32x32 matrix can use. This kernel packs several matrices into each block instead and
+ * computes one output element per thread. Square sizes of 4, 8, 16 and 32 are compiled with
+ * static sizes.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB, typename Executor>
+void matvec_small_impl([[maybe_unused]] TensorTypeC &C, [[maybe_unused]] const TensorTypeA &A,
+                       [[maybe_unused]] const TensorTypeB &B, [[maybe_unused]] const Executor &exec,
+                       [[maybe_unused]] float alpha, [[maybe_unused]] float beta)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using T = typename TensorTypeA::value_type;
+  constexpr int block = 256;
+  constexpr size_t max_smem = 48 * 1024;
+
+  const index_t batches = A.Size(0);
+  const index_t m = A.Size(1);
+  const index_t n = A.Size(2);
+  const index_t ld = (n % 2 == 0) ? n + 1 : n;
+  const size_t smem_per_mat = static_cast<size_t>(m * ld + n) * sizeof(T);
+
+  // Enough matrices to give every thread a row, limited by shared memory
+  index_t mats_per_block = std::max(index_t{1}, static_cast<index_t>(block) / m);
+  mats_per_block = std::min(mats_per_block, static_cast<index_t>(max_smem / smem_per_mat));
+  mats_per_block = std::min(mats_per_block, batches);
+
+  const size_t smem = smem_per_mat * static_cast<size_t>(mats_per_block);
+  const auto blocks = static_cast<unsigned int>((batches + mats_per_block - 1) / mats_per_block);
+  const auto stream = exec.getStream();
+
+  using CT = base_type_t<TensorTypeC>;
+  using AT = base_type_t<TensorTypeA>;
+  using BT = base_type_t<TensorTypeB>;
+  CT c_base = C;
+  const AT a_base = A;
+  const BT b_base = B;
+
+  auto launch = [&](auto kernel) {
+    kernel<<<blocks, block, smem, stream>>>(c_base, a_base, b_base, batches, m, n, mats_per_block,
+                                            static_cast<T>(alpha), static_cast<T>(beta));
+  };
+
+  if (m == n && m == 4) {
+    launch(small_batched_matvec_kernel<4, 4, T, CT, AT, BT>);
+  }
+  else if (m == n && m == 8) {
+    launch(small_batched_matvec_kernel<8, 8, T, CT, AT, BT>);
+  }
+  else if (m == n && m == 16) {
+    launch(small_batched_matvec_kernel<16, 16, T, CT, AT, BT>);
+  }
+  else if (m == n && m == 32) {
+    launch(small_batched_matvec_kernel<32, 32, T, CT, AT, BT>);
+  }
+  else {
+    launch(small_batched_matvec_kernel<0, 0, T, CT, AT, BT>);
+  }
+#else
+  MATX_THROW(matxNotSupported, "Small batched matvec requires CUDA");
+#endif
+}
+
+} // end namespace detail
+
 /**
  * Run a GEMV without a plan
  *
@@ -79,6 +161,18 @@ __MATX_INLINE__ void matvec_impl(TensorTypeC C, const TensorTypeA A,
   MATX_ASSERT_STR(C.Size(TensorTypeB::Rank()-1) == A.Size(TensorTypeA::Rank()-2), matxInvalidDim, "matvec: C last size must match A second last Size");
   MATX_ASSERT_STR(B.Size(TensorTypeB::Rank()-1) == A.Size(TensorTypeA::Rank()-1), matxInvalidDim, "matvec: B last size must match A last size");
 
+  // Batches of tiny matrices run one matrix per group of threads instead of going through cuBLAS
+  if constexpr (is_cuda_executor_v<Executor> && TensorTypeA::Rank() == 3 &&
+                detail::is_small_matvec_type_v<typename TensorTypeA::value_type> &&
+                std::is_same_v<typename TensorTypeA::value_type, typename TensorTypeB::value_type> &&
+                std::is_same_v<typename TensorTypeA::value_type, typename TensorTypeC::value_type>) {
+    if (A.Size(1) <= detail::MATVEC_SMALL_MAX_DIM && A.Size(2) <= detail::MATVEC_SMALL_MAX_DIM &&
+        A.Size(0) > 0 && B.Size(0) == A.Size(0) && C.Size(0) == A.Size(0)) {
+      detail::matvec_small_impl(C, A, B, exec, alpha, beta);
+      return;
+    }
+  }
+
   // need to clone c and b 1 along inner dim to use cublas
   cuda::std::array<index_t, TensorTypeC::Rank()+1> shape;
   for(int i = 0; i < TensorTypeC::Rank(); i++) {
@@ -0,0 +1,345 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cublas_v2.h>
+#include <cusolverDn.h>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/core/cache.h"
+#include "matx/kernels/mvdr.cuh"
+#include "matx/transforms/solver_common.h"
+
+#include <vector>
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Parameters of an MVDR weight computation. Plans own their covariance and
+ * solve buffers, so they are keyed on the problem shape and stream only.
+ */
+struct MvdrParams_t {
+  index_t m;
+  index_t k;
+  index_t beams;
+  size_t batch_size;
+  MatXDataType_t dtype;
+  cudaStream_t stream;
+};
+
+template <typename T>
+class matxMvdrPlan_t {
+  static_assert(std::is_same_v<T, cuda::std::complex<float>> || std::is_same_v<T, cuda::std::complex<double>>,
+                "mvdr() only supports complex float and complex double");
+  using real_type = typename T::value_type;
+
+public:
+  /**
+   * Plan for computing MVDR weights
+   *
+   * Allocates the batch of covariance matrices, the batch of right-hand sides
+   * and the cuBLAS/cuSolver pointer arrays that address them.
+   *
+   * @param params
+   *   Problem parameters
+   */
+  matxMvdrPlan_t(const MvdrParams_t &params) : params_(params)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    MATX_ASSERT_STR(params.m <= std::numeric_limits<int>::max() && params.k <= std::numeric_limits<int>::max() &&
+                    params.beams <= std::numeric_limits<int>::max() &&
+                    params.batch_size <= static_cast<size_t>(std::numeric_limits<int>::max()),
+                    matxInvalidSize, "mvdr() dimensions must fit in 32 bits");
+
+    [[maybe_unused]] cublasStatus_t ret = cublasCreate(&blas_handle_);
+    MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxCudaError);
+    [[maybe_unused]] cusolverStatus_t solver_ret = cusolverDnCreate(&solver_handle_);
+    MATX_ASSERT(solver_ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+
+    const auto stream = params.stream;
+    make_tensor(r_, {static_cast<index_t>(params.batch_size), params.m, params.m}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    make_tensor(z_, {static_cast<index_t>(params.batch_size), params.beams, params.m}, MATX_ASYNC_DEVICE_MEMORY, stream);
+
+    std::vector<T *> r_ptrs(params.batch_size);
+    std::vector<T *> z_ptrs(params.batch_size);
+    for (size_t b = 0; b < params.batch_size; b++) {
+      r_ptrs[b] = r_.Data() + b * params.m * params.m;
+      z_ptrs[b] = z_.Data() + b * params.beams * params.m;
+    }
+
+    matxAlloc((void **)&d_r_ptrs_, params.batch_size * sizeof(T *), MATX_ASYNC_DEVICE_MEMORY, stream);
+    matxAlloc((void **)&d_z_ptrs_, params.batch_size * sizeof(T *), MATX_ASYNC_DEVICE_MEMORY, stream);
+    matxAlloc((void **)&d_info_, params.batch_size * sizeof(int), MATX_ASYNC_DEVICE_MEMORY, stream);
+    cudaMemcpyAsync(d_r_ptrs_, r_ptrs.data(), params.batch_size * sizeof(T *), cudaMemcpyHostToDevice, stream);
+    cudaMemcpyAsync(d_z_ptrs_, z_ptrs.data(), params.batch_size * sizeof(T *), cudaMemcpyHostToDevice, stream);
+    // The host vectors go out of scope before the copies above are guaranteed to have completed
+    cudaStreamSynchronize(stream);
+  }
+
+  ~matxMvdrPlan_t()
+  {
+    matxFree(d_r_ptrs_, cudaStreamDefault);
+    matxFree(d_z_ptrs_, cudaStreamDefault);
+    matxFree(d_info_, cudaStreamDefault);
+    cublasDestroy(blas_handle_);
+    cusolverDnDestroy(solver_handle_);
+  }
+
+  template <typename XTensor>
+  static MvdrParams_t GetMvdrParams(const XTensor &x, index_t beams, cudaStream_t stream)
+  {
+    constexpr int RANK = XTensor::Rank();
+    MvdrParams_t params;
+    params.m = x.Size(RANK - 2);
+    params.k = x.Size(RANK - 1);
+    params.beams = beams;
+    params.batch_size = RANK == 3 ? static_cast<size_t>(x.Size(0)) : 1;
+    params.dtype = TypeToInt<T>();
+    params.stream = stream;
+    return params;
+  }
+
+  /**
+   * Compute the MVDR weights of every batch
+   *
+   * cuBLAS and cuSolver are column-major, so the row-major snapshots x are
+   * seen as x^T and herk with op C forms conj(R) = R^T, whose storage is the
+   * row-major R. Its lower triangle is factored in place and the right-hand
+   * sides are conj(v), so the solve yields conj(R^-1 v).
+   */
+  template <typename WTensor, typename XTensor, typename VOp>
+  void Exec(WTensor &w, const XTensor &x, const VOp &v, real_type load, const cudaExecutor &exec)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    constexpr int THREADS = 128;
+    const auto stream = exec.getStream();
+    const int m = static_cast<int>(params_.m);
+    const int k = static_cast<int>(params_.k);
+    const int beams = static_cast<int>(params_.beams);
+    const int batches = static_cast<int>(params_.batch_size);
+
+    cublasSetStream(blas_handle_, stream);
+    cusolverDnSetStream(solver_handle_, stream);
+
+    // Diagonal loading goes in first and herk accumulates on top of it with beta = 1
+    const index_t total = r_.TotalSize();
+    mvdr_diag_load_kernel<<<static_cast<unsigned int>((total + 255) / 256), 256, 0, stream>>>(
+        r_.Data(), params_.m, total, load);
+
+    const real_type alpha = real_type(1) / static_cast<real_type>(params_.k);
+    const real_type beta = 1;
+    const index_t x_batch_stride = XTensor::Rank() == 3 ? x.Stride(0) : 0;
+    const int ldx = static_cast<int>(x.Stride(XTensor::Rank() - 2));
+    [[maybe_unused]] cublasStatus_t ret = CUBLAS_STATUS_SUCCESS;
+    for (int b = 0; b < batches; b++) {
+      const T *xb = x.Data() + b * x_batch_stride;
+      T *rb = r_.Data() + static_cast<index_t>(b) * params_.m * params_.m;
+      if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+        ret = cublasCherk(blas_handle_, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_C, m, k, &alpha,
+                          reinterpret_cast<const cuComplex *>(xb), ldx, &beta, reinterpret_cast<cuComplex *>(rb), m);
+      }
+      else {
+        ret = cublasZherk(blas_handle_, CUBLAS_FILL_MODE_LOWER, CUBLAS_OP_C, m, k, &alpha,
+                          reinterpret_cast<const cuDoubleComplex *>(xb), ldx, &beta,
+                          reinterpret_cast<cuDoubleComplex *>(rb), m);
+      }
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxCudaError);
+    }
+
+    [[maybe_unused]] cusolverStatus_t solver_ret;
+    if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+      solver_ret = cusolverDnCpotrfBatched(solver_handle_, CUBLAS_FILL_MODE_LOWER, m,
+                                           reinterpret_cast<cuComplex **>(d_r_ptrs_), m, d_info_, batches);
+    }
+    else {
+      solver_ret = cusolverDnZpotrfBatched(solver_handle_, CUBLAS_FILL_MODE_LOWER, m,
+                                           reinterpret_cast<cuDoubleComplex **>(d_r_ptrs_), m, d_info_, batches);
+    }
+    MATX_ASSERT(solver_ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+
+    if constexpr (VOp::Rank() == XTensor::Rank()) {
+      (z_ = hermitianT(v)).run(exec);
+    }
+    else {
+      (z_ = clone<3>(hermitianT(v), {static_cast<index_t>(params_.batch_size), matxKeepDim, matxKeepDim})).run(exec);
+    }
+
+    // Forward and back substitution with L and L^H. potrsBatched only takes one right-hand side, so
+    // the triangular solves are done with trsmBatched to cover all beams at once.
+    const T one{1};
+    for (const auto op : {CUBLAS_OP_N, CUBLAS_OP_C}) {
+      if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+        ret = cublasCtrsmBatched(blas_handle_, CUBLAS_SIDE_LEFT, CUBLAS_FILL_MODE_LOWER, op, CUBLAS_DIAG_NON_UNIT,
+                                 m, beams, reinterpret_cast<const cuComplex *>(&one),
+                                 reinterpret_cast<const cuComplex *const *>(d_r_ptrs_), m,
+                                 reinterpret_cast<cuComplex *const *>(d_z_ptrs_), m, batches);
+      }
+      else {
+        ret = cublasZtrsmBatched(blas_handle_, CUBLAS_SIDE_LEFT, CUBLAS_FILL_MODE_LOWER, op, CUBLAS_DIAG_NON_UNIT,
+                                 m, beams, reinterpret_cast<const cuDoubleComplex *>(&one),
+                                 reinterpret_cast<const cuDoubleComplex *const *>(d_r_ptrs_), m,
+                                 reinterpret_cast<cuDoubleComplex *const *>(d_z_ptrs_), m, batches);
+      }
+      MATX_ASSERT(ret == CUBLAS_STATUS_SUCCESS, matxCudaError);
+    }
+
+#ifdef __CUDACC__
+    mvdr_normalize_kernel<THREADS><<<static_cast<unsigned int>(batches * beams), THREADS, 0, stream>>>(
+        z_.Data(), v, w, params_.m, params_.beams);
+#endif
+
+    std::vector<int> h_info(params_.batch_size);
+    cudaMemcpyAsync(h_info.data(), d_info_, sizeof(int) * params_.batch_size, cudaMemcpyDeviceToHost, stream);
+    cudaStreamSynchronize(stream);
+    for (const auto &info : h_info) {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        (std::to_string(info) + "-th leading minor of the covariance is not positive definite in mvdr()").c_str());
+    }
+  }
+
+private:
+  MvdrParams_t params_;
+  cublasHandle_t blas_handle_;
+  cusolverDnHandle_t solver_handle_;
+  tensor_t<T, 3> r_;
+  tensor_t<T, 3> z_;
+  T **d_r_ptrs_ = nullptr;
+  T **d_z_ptrs_ = nullptr;
+  int *d_info_ = nullptr;
+};
+
+struct MvdrParamsKeyHash {
+  std::size_t operator()(const MvdrParams_t &k) const noexcept
+  {
+    return (std::hash<uint64_t>()(k.m)) + (std::hash<uint64_t>()(k.k)) +
+           (std::hash<uint64_t>()(k.beams)) + (std::hash<uint64_t>()(k.batch_size)) +
+           (std::hash<uint64_t>()((uint64_t)(k.stream)));
+  }
+};
+
+struct MvdrParamsKeyEq {
+  bool operator()(const MvdrParams_t &l, const MvdrParams_t &t) const noexcept
+  {
+    return l.m == t.m && l.k == t.k && l.beams == t.beams && l.batch_size == t.batch_size &&
+           l.dtype == t.dtype && l.stream == t.stream;
+  }
+};
+
+using mvdr_cache_t = std::unordered_map<MvdrParams_t, std::any, MvdrParamsKeyHash, MvdrParamsKeyEq>;
+
+} // end namespace detail
+
+/**
+ * Compute MVDR beamforming weights
+ *
+ * The sample covariance of the snapshots is formed with a Hermitian rank-k
+ * update on top of the diagonal loading, factored with a batched Cholesky
+ * decomposition, and the steering vectors of all beams are solved against the
+ * factors. The normalization by v^H R^-1 v is fused into the final write of
+ * the weights.
+ *
+ * @param w
+ *   Output weights of shape `[batch] x elements x beams`
+ * @param x
+ *   Snapshots of shape `[batch] x elements x snapshots`
+ * @param v
+ *   Steering vectors of shape `[batch] x elements x beams`. A rank 2 operator is used for every batch.
+ * @param load
+ *   Diagonal loading added to the sample covariance
+ * @param exec
+ *   CUDA executor
+ */
+template <typename WTensor, typename XOp, typename VOp>
+void mvdr_impl(WTensor &w, const XOp &x, const VOp &v, typename detail::inner_op_type_t<typename XOp::value_type>::type load,
+               const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T = typename XOp::value_type;
+  constexpr int RANK = XOp::Rank();
+  static_assert(RANK == 2 || RANK == 3, "mvdr() snapshots must be rank 2 or 3");
+  static_assert(VOp::Rank() == 2 || VOp::Rank() == RANK, "mvdr() steering vectors must be rank 2 or match the snapshots");
+  static_assert(WTensor::Rank() == RANK, "mvdr() weights must have the rank of the snapshots");
+  static_assert(std::is_same_v<T, typename VOp::value_type> && std::is_same_v<T, typename WTensor::value_type>,
+                "mvdr() snapshots, steering vectors and weights must have the same type");
+
+  const index_t m = x.Size(RANK - 2);
+  const index_t beams = v.Size(VOp::Rank() - 1);
+  MATX_ASSERT_STR(v.Size(VOp::Rank() - 2) == m, matxInvalidSize, "mvdr() steering vectors must have one row per element");
+  MATX_ASSERT_STR(w.Size(RANK - 2) == m && w.Size(RANK - 1) == beams, matxInvalidSize,
+                  "mvdr() weights must be elements x beams");
+  if constexpr (RANK == 3) {
+    MATX_ASSERT_STR(w.Size(0) == x.Size(0), matxInvalidSize, "mvdr() weights must have one batch per snapshot batch");
+    if constexpr (VOp::Rank() == 3) {
+      MATX_ASSERT_STR(v.Size(0) == x.Size(0), matxInvalidSize, "mvdr() steering vectors must have one batch per snapshot batch");
+    }
+  }
+
+  // herk reads the snapshots in place when the rows have unit stride, such as a slice of a longer recording
+  const auto stream = exec.getStream();
+  const auto support_func = [&]() {
+    if constexpr (is_tensor_view_v<XOp>) {
+      return x.Stride(RANK - 1) == 1 && x.Stride(RANK - 2) >= x.Size(RANK - 1);
+    }
+    else {
+      return true;
+    }
+  };
+  auto x_new = detail::GetSupportedTensor(x, support_func, MATX_ASYNC_DEVICE_MEMORY, stream);
+  if (!is_matx_transform_op<XOp>() && !x_new.isSameView(x)) {
+    (x_new = x).run(exec);
+  }
+
+  auto params = detail::matxMvdrPlan_t<T>::GetMvdrParams(x_new, beams, stream);
+
+  using cache_val_type = detail::matxMvdrPlan_t<T>;
+  auto cache_id = detail::GetCacheIdFromType<detail::mvdr_cache_t>();
+  MATX_LOG_DEBUG("MVDR transform: cache_id={}", cache_id);
+  detail::GetCache().LookupAndExec<detail::mvdr_cache_t>(
+    cache_id,
+    params,
+    [&]() {
+      return std::make_shared<cache_val_type>(params);
+    },
+    [&](std::shared_ptr<cache_val_type> ctype) {
+      ctype->Exec(w, x_new, v, load, exec);
+    },
+    exec
+  );
+}
+
+} // end namespace matx
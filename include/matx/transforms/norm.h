@@ -41,6 +41,7 @@
 #include "matx/core/nvtx.h"
 #include "matx/core/tensor.h"
 #include "matx/operators/sum.h"
+#include "matx/kernels/normalize.cuh"
 
 namespace matx {
 
@@ -56,14 +57,105 @@ namespace detail {
   struct NormTypeMatrix{};
 };
 
+namespace detail {
+// Longest single row given to the fused row norm kernel. One block per row cannot fill the GPU, so a single
+// longer row is better served by the device-wide reductions.
+constexpr index_t ROW_NORM_MAX_SINGLE_ROW = 1 << 16;
+
+/**
+ * Launch the fused row norm kernel over the last dimension of the permuted input
+ *
+ * Rows of up to ROW_NORM_WARP_MAX_COLS elements are handled by one warp each and longer rows by one block.
+ * When NORMALIZE is set, the output has the input's shape and receives each element divided by its row's
+ * norm; the rows a block works on are cached in shared memory when they fit. Otherwise perm must be the
+ * identity and the output, which drops the last dimension, receives the norm of each row.
+ *
+ * @param out Output operator
+ * @param in Input operator
+ * @param perm Permutation moving the normalized dimension last
+ * @param kind Norm to compute
+ * @param p Exponent for RowNormKind::LP
+ * @param stream CUDA stream
+ */
+template <bool NORMALIZE, typename OutType, typename InType, int RANK>
+void row_norm_fused_impl(OutType &out, const InType &in, const cuda::std::array<int, RANK> &perm,
+                         RowNormKind kind, typename InType::value_type p, cudaStream_t stream)
+{
+#ifdef __CUDACC__
+  using acc_type = typename InType::value_type;
+  constexpr int threads = ROW_NORM_THREADS;
+
+  cuda::std::array<index_t, RANK> pshape;
+  index_t rows = 1;
+  for (int r = 0; r < RANK; r++) {
+    pshape[r] = in.Size(perm[r]);
+    if (r < RANK - 1) {
+      rows *= pshape[r];
+    }
+  }
+  const index_t cols = pshape[RANK - 1];
+
+  if (rows == 0 || cols == 0) {
+    return;
+  }
+
+  auto launch = [&](auto group, auto cache_row, size_t cache_bytes) {
+    constexpr int GROUP = decltype(group)::value;
+    constexpr int GROUPS = threads / GROUP;
+    const auto blocks = static_cast<unsigned int>((rows + GROUPS - 1) / GROUPS);
+    row_norm_kernel<threads, GROUP, decltype(cache_row)::value, NORMALIZE, acc_type>
+        <<<blocks, threads, cache_bytes, stream>>>(out, in, perm, pshape, rows, cols, kind, p);
+  };
+
+  const int group = cols <= ROW_NORM_WARP_MAX_COLS ? 32 : threads;
+  const size_t cache_bytes = static_cast<size_t>(threads / group) * static_cast<size_t>(cols) * sizeof(acc_type);
+  const bool cache_row = NORMALIZE && cache_bytes <= ROW_NORM_MAX_CACHED_BYTES;
+
+  if (group == 32) {
+    if (cache_row) {
+      launch(std::integral_constant<int, 32>{}, std::bool_constant<NORMALIZE>{}, cache_bytes);
+    }
+    else {
+      launch(std::integral_constant<int, 32>{}, std::false_type{}, 0);
+    }
+  }
+  else {
+    if (cache_row) {
+      launch(std::integral_constant<int, threads>{}, std::bool_constant<NORMALIZE>{}, cache_bytes);
+    }
+    else {
+      launch(std::integral_constant<int, threads>{}, std::false_type{}, 0);
+    }
+  }
+  MATX_CUDA_CHECK_LAST_ERROR();
+#endif
+}
+} // end namespace detail
+
 
 template <typename NormType, typename OutputOp, typename InputOp, typename Executor>
 __MATX_INLINE__ void norm_impl(OutputOp out, const InputOp &in,
           NormOrder order, Executor &&exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   if constexpr (std::is_same_v<NormType, detail::NormTypeVector>) {
+    // Real inputs on the device compute each row's norm in a single fused launch
+    if constexpr (is_cuda_executor_v<Executor> && InputOp::Rank() > 0 &&
+                  std::is_floating_point_v<typename InputOp::value_type>) {
+      const index_t cols = in.Size(InputOp::Rank() - 1);
+      if ((order == NormOrder::NONE || order == NormOrder::L2 || order == NormOrder::L1) &&
+          (TotalSize(in) > cols || cols <= detail::ROW_NORM_MAX_SINGLE_ROW)) {
+        cuda::std::array<int, InputOp::Rank()> perm;
+        for (int r = 0; r < InputOp::Rank(); r++) {
+          perm[r] = r;
+        }
+        const auto kind = order == NormOrder::L1 ? detail::RowNormKind::L1 : detail::RowNormKind::L2;
+        detail::row_norm_fused_impl<false>(out, in, perm, kind, typename InputOp::value_type{0}, exec.getStream());
+        return;
+      }
+    }
+
     if (order == NormOrder::NONE || order == NormOrder::L2) {
       // This is really just:
       // (out = sqrt(sum(abs2(in), {InputOp::Rank() - 1}))).run(exec);
@@ -43,6 +43,7 @@
 #include "matx/operators/min.h"
 #include "matx/operators/mean.h"
 #include "matx/operators/stdd.h"
+#include "matx/transforms/norm.h"
 
 namespace matx
 {
@@ -75,6 +76,38 @@ namespace matx
     }
 
     if (method == NORMALIZE_RANGE::NORM) {
+      // Real inputs on the device compute each row's norm and divide by it in one launch. A single row
+      // too long for one block falls back to a reduction followed by the divide.
+      if constexpr (is_cuda_executor_v<Executor> && InputOp::Rank() > 0 &&
+                  std::is_floating_point_v<typename InputOp::value_type>) {
+        const index_t cols = in.Size(norm_dim);
+        if (TotalSize(in) > cols || cols <= detail::ROW_NORM_MAX_SINGLE_ROW) {
+          MATX_ASSERT_STR(p < 0.0f || p > 0.0f, matxInvalidParameter, "p should be positive non zero");
+          cuda::std::array<int, InputOp::Rank()> perm;
+          int d = 0;
+          for (int r = 0; r < InputOp::Rank(); r++) {
+            if (r != norm_dim) {
+              perm[d++] = r;
+            }
+          }
+          perm[InputOp::Rank() - 1] = norm_dim;
+
+          detail::RowNormKind kind = detail::RowNormKind::LP;
+          if (p < 0.0f) {
+            kind = detail::RowNormKind::MAX;
+          }
+          else if (p == 1.0f) {
+            kind = detail::RowNormKind::L1;
+          }
+          else if (p == 2.0f) {
+            kind = detail::RowNormKind::L2;
+          }
+          detail::row_norm_fused_impl<true>(out, in, perm, kind,
+                                            static_cast<typename InputOp::value_type>(p), ex.getStream());
+          return;
+        }
+      }
+
       if (p < 0.0f) {
         // max norm
         const auto absOp = abs(in);
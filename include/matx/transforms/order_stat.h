@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/type_utils.h"
+#include "matx/kernels/order_stat.cuh"
+
+#include <limits>
+
+namespace matx {
+
+namespace detail {
+
+// Value types the radix select kernel can map onto ordered unsigned keys.
+// Everything else (complex, fp16/bf16 from cuda_fp16.h directly) falls back to
+// sorting.
+template <typename T>
+inline constexpr bool order_stat_supported_v =
+  (std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8) || is_matx_half_v<T>;
+
+/**
+ * Select the k-th smallest value (0-based) of every row of a rank 1 or rank 2
+ * operator, and optionally the (k+1)-th smallest into hi. Rows are the last
+ * dimension of the input, and lo/hi are contiguous with one entry per row. The
+ * whole batch is one launch, costs one read of each row per key byte, and
+ * needs no workspace. The input is not modified.
+ */
+template <typename T, typename InType>
+void order_stat_impl([[maybe_unused]] T *lo, [[maybe_unused]] T *hi, [[maybe_unused]] const InType &in,
+                     [[maybe_unused]] index_t k, [[maybe_unused]] cudaStream_t stream)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  static_assert(InType::Rank() == 1 || InType::Rank() == 2, "order statistics are computed over rows of a rank 1 or 2 operator");
+  static_assert(order_stat_supported_v<T>, "order statistics require a real arithmetic or MatX half type");
+
+  constexpr int THREADS = 256;
+  const index_t n = in.Size(InType::Rank() - 1);
+  const index_t batches = InType::Rank() == 1 ? 1 : in.Size(0);
+
+  MATX_ASSERT_STR(k >= 0 && k < n, matxInvalidParameter, "order statistic rank out of range");
+  MATX_ASSERT_STR(n <= std::numeric_limits<unsigned int>::max(), matxInvalidSize,
+    "order statistic rows are limited to 2^32-1 elements");
+
+  if (batches == 0) {
+    return;
+  }
+
+  order_stat_kernel<THREADS, T><<<static_cast<unsigned int>(batches), THREADS, 0, stream>>>(in, lo, hi, n, k);
+#endif
+}
+
+} // end namespace detail
+
+} // end namespace matx
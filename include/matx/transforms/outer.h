@@ -93,16 +93,19 @@ __MATX_INLINE__ void outer_impl(TensorTypeC C, const TensorTypeA A,
     MATX_ASSERT_STR(A.Size(r) == B.Size(r), matxInvalidSize, "A and B tensors must match batch sizes");
   }
 
-  ac[ac.size() - 1] = 1;
-  bc[bc.size() - 2] = 1;
+  // Each output element is a single product, so broadcast both inputs instead of running a K=1 GEMM
+  ac[ac.size() - 1] = B.Size(B.Rank() - 1);
+  bc[bc.size() - 2] = A.Size(A.Rank() - 1);
 
   auto act = clone<TensorTypeA::Rank() + 1>(A, ac);
   auto bct = clone<TensorTypeB::Rank() + 1>(B, bc);
 
-  if constexpr (is_cuda_executor_v<Executor>) {
-    matmul_impl<decltype(C), decltype(act), decltype(bct), PROV>(C, act, bct, exec, alpha, beta);
-  } else {
-    matmul_impl<decltype(C), decltype(act), decltype(bct)>(C, act, bct, exec, alpha, beta);
+  using value_type = typename TensorTypeC::value_type;
+  if (alpha == 1.0f && beta == 0.0f) {
+    (C = act * bct).run(exec);
+  }
+  else {
+    (C = static_cast<value_type>(alpha) * act * bct + static_cast<value_type>(beta) * C).run(exec);
   }
 }
 
@@ -11,39 +11,46 @@
 #include "matx/core/utils.h"
 #include "matx/transforms/cub.h"
 #include "matx/transforms/copy.h"
+#include "matx/transforms/order_stat.h"
 #include "matx/core/half.h"
 
 namespace matx {
 namespace detail {
 
 /**
- * Calculate the median of values in a tensor
+ * Calculate a percentile of values in a tensor
  *
- * Calculates the median of rows in a tensor. The median is computed by sorting
- * the data into a temporary tensor, then picking the middle element of each
- * row. For an even number of items, the mean of the two middle elements is
- * selected. Currently only works on tensor views as input since it uses CUB
- * sorting as a backend, and the tensor views must be rank 2 reducing to rank 1,
- * or rank 1 reducing to rank 0.
+ * Calculates the q-th percentile of either the whole input (rank 0 output) or
+ * of each row of a rank 2 input (rank 1 output). Every method needs at most two
+ * adjacent order statistics, so on CUDA executors they are found with a
+ * batched radix select in one launch instead of sorting a copy of the input.
+ * Types the select does not support, and host executors, sort instead.
  *
- * @tparam T
+ * @tparam OutType
  *   Output data type
- * @tparam RANK
- *   Rank of output tensor
- * @tparam RANK_IN
- *   Input rank
+ * @tparam InType
+ *   Input data type
+ * @tparam Executor
+ *   Executor type
  *
  * @param dest
  *   Destination view of reduction
  * @param in
  *   Input data to reduce
+ * @param q
+ *   Percentile to compute in [0, 100]
+ * @param method
+ *   Interpolation method
  * @param exec
- *   CUDA executor
+ *   Executor
  */
 template <typename OutType, typename InType, typename Executor>
 void __MATX_INLINE__ percentile_impl(OutType dest, const InType &in, uint32_t q, PercentileMethod method, Executor &&exec)
 {
-  MATX_NVTX_START("percentile_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("percentile_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  using value_type = typename InType::value_type;
+  static_assert(OutType::Rank() == 0 || (OutType::Rank() == 1 && InType::Rank() == 2),
+    "percentile() reduces either the whole input or the rows of a rank 2 input");
 
   double alpha = 0.;
   double beta = 0.;
@@ -87,72 +94,120 @@ void __MATX_INLINE__ percentile_impl(OutType dest, const InType &in, uint32_t q,
     }
   }
 
-  if constexpr (OutType::Rank() == 0) {
-    auto insize = TotalSize(in);
-    matx::tensor_t<typename InType::value_type, 1> sort_out;
-    if constexpr (is_cuda_executor_v<Executor>) {
-      make_tensor(sort_out, {insize}, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  auto rows = [&]() {
+    if constexpr (OutType::Rank() == 0) {
+      return flatten(in);
     }
     else {
-      make_tensor(sort_out, {insize}, MATX_HOST_MEMORY);  
+      return in;
     }
+  }();
+  const index_t insize = rows.Size(rows.Rank() - 1);
 
-    sort_impl(sort_out, flatten(in), SORT_DIR_ASC, exec);
+  // If we're landing directly onto an index after the q multiplication we should make sure that's the case
+  // and not allow floating point error to move us to the wrong index.
+  double base_index = ((q * (insize - 1)) % 100) == 0 ? static_cast<double>(q * (insize - 1) / 100) : static_cast<double>(insize - 1) * q/100.;
 
-    // If we're landing directly onto an index after the q multiplication we should make sure that's the case
-    // and not allow floating point error to move us to the wrong index.
-    double base_index = ((q * (insize - 1)) % 100) == 0 ? static_cast<double>(q * (insize - 1) / 100) : static_cast<double>(insize - 1) * q/100.;
+  // Every method is a function of the k-th smallest value (lo) and, for the
+  // interpolating ones, the next one (hi)
+  index_t k = 0;
+  double frac = 0.;
+  bool interpolate = false;
+  bool midpoint = false;
 
-    if (q == 0) {
-      (dest = at(sort_out, 0)).run(exec);
+  if (q == 100) {
+    k = insize - 1;
+  }
+  else if (q != 0) {
+    switch (method) {
+      case PercentileMethod::LINEAR: [[fallthrough]];
+      case PercentileMethod::HAZEN: [[fallthrough]];
+      case PercentileMethod::WEIBULL: [[fallthrough]];
+      case PercentileMethod::MEDIAN_UNBIASED: [[fallthrough]];
+      case PercentileMethod::NORMAL_UNBIASED:
+      {
+        subidx = q/100. * (static_cast<double>(insize) - alpha - beta + 1) + alpha - 1;
+        k = static_cast<index_t>(subidx);
+        frac = subidx - std::floor(subidx);
+        interpolate = true;
+        break;
+      }
+      case PercentileMethod::LOWER: {
+        k = static_cast<index_t>(base_index);
+        break;
+      }
+      case PercentileMethod::HIGHER: {
+        k = static_cast<index_t>(cuda::std::ceil(base_index));
+        break;
+      }
+      case PercentileMethod::MIDPOINT: {
+        k = static_cast<index_t>(cuda::std::ceil(base_index));
+        midpoint = true;
+        break;
+      }
+      case PercentileMethod::NEAREST: {
+        k = static_cast<index_t>(cuda::std::round(base_index));
+        break;
+      }
+      default:
+        break;
     }
-    else if (q == 100) {
-      (dest = at(sort_out, insize - 1)).run(exec);
+  }
+
+  const bool need_hi = interpolate || midpoint;
+
+  matxMemorySpace_t space = MATX_HOST_MEMORY;
+  cudaStream_t stream = 0;
+  if constexpr (is_cuda_executor_v<Executor>) {
+    space = MATX_ASYNC_DEVICE_MEMORY;
+    stream = exec.getStream();
+  }
+
+  // Every temporary here is freed before returning, so on a CUDA executor they come from the stream's scratch arena
+  const auto allocate_tensor = [&](auto shape) {
+    detail::ScratchScope scratch{stream, is_cuda_executor_v<Executor>};
+    return make_tensor<value_type>(shape, space, stream);
+  };
+
+  auto lo = allocate_tensor(dest.Shape());
+  auto hi = allocate_tensor(dest.Shape());
+
+  if constexpr (is_cuda_executor_v<Executor> && detail::order_stat_supported_v<value_type>) {
+    detail::order_stat_impl(lo.Data(), need_hi ? hi.Data() : nullptr, rows, k, stream);
+  }
+  else {
+    const index_t k1 = std::min(k + 1, insize - 1);
+
+    if constexpr (OutType::Rank() == 0) {
+      auto sort_out = allocate_tensor(cuda::std::array<index_t, 1>{insize});
+      sort_impl(sort_out, rows, SORT_DIR_ASC, exec);
+
+      (lo = at(sort_out, k)).run(exec);
+      if (need_hi) {
+        (hi = at(sort_out, k1)).run(exec);
+      }
     }
     else {
-      switch (method) {
-        case PercentileMethod::LINEAR: [[fallthrough]];
-        case PercentileMethod::HAZEN: [[fallthrough]];
-        case PercentileMethod::WEIBULL: [[fallthrough]];
-        case PercentileMethod::MEDIAN_UNBIASED: [[fallthrough]];
-        case PercentileMethod::NORMAL_UNBIASED:
-        {
-          subidx = q/100. * (static_cast<double>(insize) - alpha - beta + 1) + alpha - 1; 
-          auto int_val = at(sort_out, static_cast<index_t>(subidx));
-          (dest = at(sort_out,  static_cast<index_t>(subidx)) + 
-                                as_type<typename InType::value_type>(
-                                  (subidx - std::floor(subidx)) * 
-                                  as_type<double>(at(sort_out, static_cast<index_t>(subidx + 1)) - int_val)
-                                )
-          ).run(exec);
-          break;
-        }
-        case PercentileMethod::LOWER: {
-          (dest = at(sort_out, static_cast<index_t>(base_index))).run(exec);
-          break;
-        }
-        case PercentileMethod::HIGHER: {
-          (dest = at(sort_out, static_cast<index_t>(cuda::std::ceil(base_index)))).run(exec);
-          break;
-        }
-        case PercentileMethod::MIDPOINT: {
-          (dest = as_type<typename InType::value_type>(
-                  (at(sort_out, static_cast<index_t>(cuda::std::ceil(base_index))) + 
-                   at(sort_out, static_cast<index_t>(cuda::std::ceil(base_index + 1)))) / 
-                   static_cast<typename InType::value_type>(2))
-          ).run(exec);
-          break;
-        }
-        case PercentileMethod::NEAREST: {
-          (dest = at(sort_out, static_cast<index_t>(cuda::std::round(base_index)))).run(exec);
-          break;
-        }        
-        default:
-          break;
+      auto sort_out = allocate_tensor(cuda::std::array<index_t, 2>{rows.Size(0), insize});
+      sort_impl(sort_out, rows, SORT_DIR_ASC, exec);
+
+      (lo = slice<1>(sort_out, {0, k}, {matxEnd, matxDropDim})).run(exec);
+      if (need_hi) {
+        (hi = slice<1>(sort_out, {0, k1}, {matxEnd, matxDropDim})).run(exec);
       }
     }
   }
+
+  if (interpolate) {
+    (dest = lo + as_type<value_type>(frac * as_type<double>(hi - lo))).run(exec);
+  }
+  else if (midpoint) {
+    (dest = as_type<value_type>((lo + hi) / static_cast<value_type>(2))).run(exec);
+  }
+  else {
+    (dest = lo).run(exec);
+  }
 }
 
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "matx/core/error.h"
+#include "matx/core/log.h"
+#include "matx/core/type_utils.h"
+#include "matx/kernels/transpose.cuh"
+
+namespace matx {
+
+namespace detail {
+
+// Below this many elements along either tile dimension most of each tile is idle
+static constexpr index_t PERMUTE_TILED_MIN_DIM = 8;
+
+/**
+ * Copy between two views of the same shape with a tiled transpose kernel
+ *
+ * When the unit-stride dimension of the output differs from the unit-stride
+ * dimension of the input (for example the output is contiguous and the input is
+ * a permuted view, or the other way around), the element-wise kernel can only
+ * coalesce one side. This plans a 2D tile over those two dimensions and
+ * flattens the rest into the grid's z dimension. Nothing is launched and false
+ * is returned when the views do not fit that pattern, so the caller can fall
+ * back to the element-wise kernel.
+ *
+ * @param out Output view
+ * @param in Input view
+ * @param stream CUDA stream
+ * @return True if the copy was launched
+ */
+template <typename OutputTensor, typename InputTensor>
+bool permute_copy_tiled([[maybe_unused]] OutputTensor &out, [[maybe_unused]] const InputTensor &in,
+                        [[maybe_unused]] cudaStream_t stream)
+{
+  constexpr int RANK = OutputTensor::Rank();
+  if constexpr (RANK < 2 || RANK > 4 || InputTensor::Rank() != RANK ||
+                !std::is_same_v<typename OutputTensor::value_type, typename InputTensor::value_type>) {
+    return false;
+  }
+  else {
+#ifdef __CUDACC__
+    using T = typename OutputTensor::value_type;
+    PermuteTileParams<RANK> p;
+    p.a = -1;
+    p.b = -1;
+    for (int d = 0; d < RANK; d++) {
+      if (out.Size(d) != in.Size(d) || out.Stride(d) == 0) {
+        return false;
+      }
+      p.size[d] = out.Size(d);
+      p.in_stride[d] = in.Stride(d);
+      p.out_stride[d] = out.Stride(d);
+      if (out.Stride(d) == 1 && out.Size(d) > 1 && p.a < 0) {
+        p.a = d;
+      }
+      if (in.Stride(d) == 1 && in.Size(d) > 1 && p.b < 0) {
+        p.b = d;
+      }
+    }
+
+    if (p.a < 0 || p.b < 0 || p.a == p.b ||
+        p.size[p.a] < PERMUTE_TILED_MIN_DIM || p.size[p.b] < PERMUTE_TILED_MIN_DIM) {
+      return false;
+    }
+
+    p.nother = 0;
+    p.batches = 1;
+    for (int d = 0; d < RANK; d++) {
+      if (d != p.a && d != p.b) {
+        p.other[p.nother++] = d;
+        p.batches *= p.size[d];
+      }
+    }
+
+    constexpr index_t tile = static_cast<index_t>(TILE_DIM);
+    const index_t tiles_a = (p.size[p.a] + tile - 1) / tile;
+    const index_t tiles_b = (p.size[p.b] + tile - 1) / tile;
+    if (tiles_a > 65535 || tiles_b > std::numeric_limits<int>::max()) {
+      return false;
+    }
+
+    MATX_LOG_TRACE("Tiled permute copy: rank={}, out unit dim={}, in unit dim={}, batches={}", RANK, p.a, p.b, p.batches);
+
+    const size_t shm = sizeof(T) * TILE_DIM * (TILE_DIM + 1);
+    dim3 block(TILE_DIM, 8);
+    dim3 grid(static_cast<unsigned>(tiles_b), static_cast<unsigned>(tiles_a),
+              static_cast<unsigned>(std::min<index_t>(p.batches, 65535)));
+    permute_tiled_kernel<T, RANK><<<grid, block, shm, stream>>>(out.Data(), in.Data(), p);
+    return true;
+#else
+    return false;
+#endif
+  }
+}
+
+} // end namespace detail
+
+} // end namespace matx
@@ -38,23 +38,177 @@
 #include "matx/core/cache.h"
 #include "matx/executors/host.h"
 #include "matx/executors/support.h"
+#include "matx/operators/diag.h"
+#include "matx/operators/max.h"
+#include "matx/operators/min.h"
+#include "matx/operators/reshape.h"
+#include "matx/operators/unary_operators.h"
+#include "matx/transforms/qr/qr_tall.h"
+#include "matx/transforms/solve/solve_cuda.h"
 #include "matx/transforms/svd/svd_cuda.h"
 #ifdef MATX_EN_CPU_SOLVER
   #include "matx/transforms/svd/svd_lapack.h"
 #endif
 
+#include <cmath>
 #include <cstdio>
+#include <limits>
 #include <numeric>
 #include <cuda/std/__algorithm/min.h>
 
 namespace matx {
 
+namespace detail {
+
+/**
+ * Smallest ratio of the smallest to the largest diagonal magnitude of a triangular factor, over all batches
+ *
+ * The diagonal of the R factor of A lies between the smallest and largest singular values of A, so a small ratio
+ * means A is rank deficient or badly conditioned. A large ratio does not prove A is well conditioned, but a rank
+ * deficient A gives a diagonal entry near rounding level, which is what the fast paths need to detect.
+ */
+template <typename RTensor>
+double triangular_diag_ratio(const RTensor &r, const cudaExecutor &exec)
+{
+  using inner_type = typename inner_op_type_t<typename RTensor::value_type>::type;
+  constexpr int RANK = RTensor::Rank();
+
+  auto d = abs(diag(r));
+  auto ratio = make_tensor<inner_type>({}, MATX_HOST_MEMORY);
+  if constexpr (RANK == 2) {
+    (ratio = min(d) / max(d)).run(exec);
+  }
+  else {
+    (ratio = min(min(d, {RANK - 2}) / max(d, {RANK - 2}))).run(exec);
+  }
+  exec.sync();
+  return static_cast<double>(ratio());
+}
+
+/**
+ * Smallest diagonal ratio of R for which A^+ = R^-1 Q^H is used instead of the SVD
+ */
+template <typename T>
+double pinv_qr_min_ratio(float rcond)
+{
+  using inner_type = typename inner_op_type_t<T>::type;
+  return std::max(static_cast<double>(rcond), std::sqrt(static_cast<double>(std::numeric_limits<inner_type>::epsilon())));
+}
+
+/**
+ * Smallest diagonal ratio of the Cholesky factor of A^H A for which the normal equations are used. Their error grows
+ * with cond(A)^2, so this keeps it near the square root of the machine epsilon
+ */
+template <typename T>
+double pinv_cholesky_min_ratio()
+{
+  using inner_type = typename inner_op_type_t<T>::type;
+  return std::sqrt(std::sqrt(static_cast<double>(std::numeric_limits<inner_type>::epsilon())));
+}
+
+/**
+ * Upper Cholesky factor R of A^H A, with the lower triangle zeroed, leaving A^H A in gram. Returns false if R shows
+ * that A is too badly conditioned for the normal equations
+ */
+template <typename RTensor, typename ATensor>
+bool gram_cholesky(RTensor &r, RTensor &gram, const ATensor &a, const cudaExecutor &exec)
+{
+  using T = typename ATensor::value_type;
+  constexpr int RANK = ATensor::Rank();
+
+  (gram = matmul(conj(transpose_matrix(a)), a)).run(exec);
+  (r = chol(gram, SolverFillMode::UPPER)).run(exec);
+  // chol only writes the upper triangle
+  (IF(index(RANK - 2) > index(RANK - 1), r = T(0))).run(exec);
+  return triangular_diag_ratio(r, exec) >= pinv_cholesky_min_ratio<T>();
+}
+
+/**
+ * Pseudo-inverse of a tall matrix of full column rank from its QR or Cholesky factors. Returns false when the
+ * factors show that a slower method is needed, leaving out unset
+ */
+template <typename OutputTensor, typename ATensor>
+bool pinv_full_rank(OutputTensor &out, const ATensor &a, const cudaExecutor &exec, float rcond, PinvMethod method)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using T = typename ATensor::value_type;
+  constexpr int RANK = ATensor::Rank();
+  const auto stream = exec.getStream();
+  const index_t n = a.Size(RANK - 1);
+
+  auto allocate_tensor = [&](auto shape) {
+    ScratchScope scratch{stream};
+    return make_tensor<T>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  };
+
+  auto square_shape = Shape(a);
+  square_shape[RANK - 2] = n;
+  auto r = allocate_tensor(square_shape);
+  auto r_inv = allocate_tensor(square_shape);
+
+  if (method == PinvMethod::CHOLESKY) {
+    if (gram_cholesky(r, r_inv, a, exec)) {
+      // A^+ = (A^H A)^-1 A^H = R^-1 R^-H A^H
+      auto w = allocate_tensor(Shape(out));
+      (r_inv = inv(r)).run(exec);
+      (w = matmul(conj(transpose_matrix(r_inv)), conj(transpose_matrix(a)))).run(exec);
+      (out = matmul(r_inv, w)).run(exec);
+      return true;
+    }
+    MATX_LOG_DEBUG("pinv: A is too badly conditioned for Cholesky, using QR");
+  }
+
+  auto q = allocate_tensor(Shape(a));
+  qr_econ_impl(q, r, a, exec, QRMethod::AUTO);
+  if (!(triangular_diag_ratio(r, exec) >= pinv_qr_min_ratio<T>(rcond))) {
+    MATX_LOG_DEBUG("pinv: R is rank deficient, using SVD");
+    return false;
+  }
+
+  (r_inv = inv(r)).run(exec);
+  (out = matmul(r_inv, conj(transpose_matrix(q)))).run(exec);
+  return true;
+}
+
+/**
+ * SVD factors of A for the pseudo-inverse: v is V, ut is U^H and s holds the inverted singular values, with those
+ * below rcond times the largest set to zero
+ */
+template <typename VTensor, typename STensor, typename MaskTensor, typename UtTensor, typename ATensor, typename Executor>
+void pinv_svd_factors(VTensor &v, STensor &s, MaskTensor &s_mask, UtTensor &ut, const ATensor &a,
+                      const Executor &exec, float rcond)
+{
+  using inner_type = typename STensor::value_type;
+  constexpr int RANK = ATensor::Rank();
+  const index_t k = s.Size(RANK - 2);
+
+  svd_impl(v, s, ut, transpose_matrix(conj(a)), exec, SVDMode::REDUCED);
+
+  // discard small singular values
+  cuda::std::array<index_t, RANK-1> cutoffShape;
+  cutoffShape.fill(matxKeepDim);
+  cutoffShape[RANK-2] = k; // repeat across last dim
+
+  auto cutoff = rcond * max(s, {RANK-2});
+  auto cutoff_add_axis = clone<RANK-1>(cutoff, cutoffShape);
+
+  // Need to explicitly run before inverting s since the mask needs to be created
+  // based on original singular values.
+  (s_mask = s > cutoff_add_axis).run(exec);
+  
+  // IF required to avoid nans when singular value is 0
+  (IF(s != inner_type(0), s = inner_type(1) / s)).run(exec);
+  (s *= s_mask).run(exec);
+}
+
+} // end namespace detail
 
 /**
  * Compute the Moore-penrose pseudo-inverse of a matrix
  *
- * Perfom a generalized inverse of a matrix using its singular-value decomposition (SVD).
- * It automatically removes small singular values for stability.
+ * Perfom a generalized inverse of a matrix using its singular-value decomposition (SVD),
+ * or for tall and square matrices of full column rank, its QR or Cholesky factors.
+ * Small singular values are removed for stability.
  *
  * @tparam T1
  *   Data type of matrix A
@@ -71,14 +225,17 @@ namespace matx {
  *   Cutoff for small singular values. For stability, singular values
  *   smaller than rcond * largest_singular_value are set to 0 for each matrix
  *   in the batch. By default, rcond is the machine epsilon of the tensor dtype.
+ * @param method
+ *   Factorization to use. QR and Cholesky are only used by the non-JIT CUDA executor
  */
 template <typename OutputTensor, typename InputTensor, typename Executor>
 void pinv_impl(OutputTensor &out,
               const InputTensor &a,
               const Executor &exec,
-              float rcond)
+              float rcond,
+              PinvMethod method = PinvMethod::AUTO)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   MATX_ASSERT_STR(!(is_host_executor_v<Executor> && !MATX_EN_CPU_SOLVER), matxInvalidExecutor,
     "Trying to run a host Solver executor but host Solver support is not configured");
   
@@ -101,6 +258,26 @@ void pinv_impl(OutputTensor &out,
 
   MATX_ASSERT_STR((out.Size(RANK-1) == m) && (out.Size(RANK-2) == n), matxInvalidSize,
       "Out must be ... x n x m for A ... x m x n");
+
+  if constexpr (is_cuda_non_jit_executor_v<Executor>) {
+    if (method != PinvMethod::SVD) {
+      MATX_ASSERT_STR(method == PinvMethod::AUTO || m >= n, matxInvalidSize,
+          "QR and Cholesky pinv require at least as many rows as columns");
+      if (m >= n) {
+        auto a_new = OpToTensor(a, exec);
+        if (!is_matx_transform_op<InputTensor>() && !a_new.isSameView(a)) {
+          (a_new = a).run(exec);
+        }
+        if (detail::pinv_full_rank(out, a_new, exec, rcond, method)) {
+          return;
+        }
+      }
+    }
+  }
+  else {
+    MATX_ASSERT_STR(method == PinvMethod::AUTO || method == PinvMethod::SVD, matxNotSupported,
+        "pinv only supports the SVD method on this executor");
+  }
   
   /* 
     Need to perform pinv = V * S^-1 * U^H where svd(A) = U * S * V^H.
@@ -144,23 +321,7 @@ void pinv_impl(OutputTensor &out,
     make_tensor(ut, utShape, MATX_HOST_MALLOC_MEMORY);
   }
 
-  svd_impl(v, s, ut, transpose_matrix(conj(a)), exec, SVDMode::REDUCED);
-
-  // discard small singular values
-  cuda::std::array<index_t, RANK-1> cutoffShape;
-  cutoffShape.fill(matxKeepDim);
-  cutoffShape[RANK-2] = k; // repeat across last dim
-
-  auto cutoff = rcond * max(s, {RANK-2});
-  auto cutoff_add_axis = clone<RANK-1>(cutoff, cutoffShape);
-
-  // Need to explicitly run before inverting s since the mask needs to be created
-  // based on original singular values.
-  (s_mask = s > cutoff_add_axis).run(exec);
-  
-  // IF required to avoid nans when singular value is 0
-  (IF(s != inner_type(0), s = inner_type(1) / s)).run(exec);
-  (s *= s_mask).run(exec);
+  detail::pinv_svd_factors(v, s, s_mask, ut, a, exec, rcond);
 
   // V = V * S^-1
   auto dShape = v.Shape();
@@ -173,4 +334,104 @@ void pinv_impl(OutputTensor &out,
   matmul_impl(out, v, ut, exec);
 }
 
-} // end namespace matx
\ No newline at end of file
+/**
+ * Least-squares solution of A X^T = B^T without forming the pseudo-inverse
+ *
+ * Each right-hand side and solution is one row of B and X, as in solve(). QR solves R x = Q^H b, Cholesky solves
+ * the normal equations A^H A x = A^H b, and the SVD applies V S^-1 U^H to b. For a rank deficient A the SVD gives
+ * the minimum-norm solution, and AUTO and QR fall back to it when R shows that A is rank deficient.
+ *
+ * @param out
+ *   Solution, rank 1 of size n or rank 2 of size nrhs x n
+ * @param a
+ *   Rank-2 m x n matrix A with m >= n
+ * @param b
+ *   Rank-1 right-hand side of size m, or rank 2 of size nrhs x m
+ * @param exec
+ *   CUDA executor
+ * @param rcond
+ *   Cutoff for small singular values, relative to the largest
+ * @param method
+ *   Factorization to use
+ */
+template <typename OutputTensor, typename ATensor, typename BTensor>
+void lstsq_impl(OutputTensor &&out, const ATensor &a, const BTensor &b, const cudaExecutor &exec,
+                float rcond, PinvMethod method)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T = typename ATensor::value_type;
+  using inner_type = typename inner_op_type_t<T>::type;
+  constexpr int BRANK = BTensor::Rank();
+  MATX_STATIC_ASSERT_STR(ATensor::Rank() == 2, matxInvalidDim, "lstsq() requires a rank-2 A");
+  MATX_STATIC_ASSERT_STR(BRANK == 1 || BRANK == 2, matxInvalidDim, "lstsq() requires a rank-1 or rank-2 B");
+  MATX_STATIC_ASSERT_STR((std::is_same_v<T, typename BTensor::value_type>), matxInvalidType,
+                         "A and B types must match in lstsq()");
+
+  const index_t m = a.Size(0);
+  const index_t n = a.Size(1);
+  const index_t nrhs = BRANK == 1 ? 1 : b.Size(0);
+  MATX_ASSERT_STR(m >= n, matxInvalidSize, "lstsq() requires at least as many rows as columns");
+  MATX_ASSERT_STR(b.Size(BRANK - 1) == m, matxInvalidSize, "Rows of B must have as many elements as A has rows");
+
+  const auto stream = exec.getStream();
+  auto allocate_tensor = [&](auto shape) {
+    detail::ScratchScope scratch{stream};
+    return make_tensor<T>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  };
+
+  auto a_new = OpToTensor(a, exec);
+  if (!is_matx_transform_op<ATensor>() && !a_new.isSameView(a)) {
+    (a_new = a).run(exec);
+  }
+
+  // Right-hand sides as rows, and the solution in the same layout
+  auto b_rows = allocate_tensor(cuda::std::array<index_t, 2>{nrhs, m});
+  auto x_rows = allocate_tensor(cuda::std::array<index_t, 2>{nrhs, n});
+  (reshape<BRANK>(b_rows, Shape(b)) = b).run(exec);
+  auto write_out = [&]() { (out = reshape<BRANK>(x_rows, Shape(out))).run(exec); };
+
+  auto r = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+  auto rt = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+  // (A^H b)^T = b^T conj(A), and (Q^H b)^T = b^T conj(Q)
+  auto y = allocate_tensor(cuda::std::array<index_t, 2>{nrhs, n});
+
+  if (method == PinvMethod::CHOLESKY) {
+    if (detail::gram_cholesky(r, rt, a_new, exec)) {
+      // rt holds the Hermitian Gram matrix, whose column-major form is its conjugate
+      (rt = conj(rt)).run(exec);
+      (y = matmul(b_rows, conj(a_new))).run(exec);
+      detail::dense_solve_factored(x_rows.Data(), rt.Data(), y.Data(), n, nrhs, SolvePrecision::FULL, true, exec);
+      write_out();
+      return;
+    }
+    MATX_LOG_DEBUG("lstsq: A is too badly conditioned for Cholesky, using QR");
+  }
+
+  if (method != PinvMethod::SVD) {
+    auto q = allocate_tensor(cuda::std::array<index_t, 2>{m, n});
+    qr_econ_impl(q, r, a_new, exec, QRMethod::AUTO);
+    if (detail::triangular_diag_ratio(r, exec) >= detail::pinv_qr_min_ratio<T>(rcond)) {
+      // R is upper triangular, so the pivoted LU of the solve takes no row swaps and is a back substitution
+      (rt = transpose_matrix(r)).run(exec);
+      (y = matmul(b_rows, conj(q))).run(exec);
+      detail::dense_solve_factored(x_rows.Data(), rt.Data(), y.Data(), n, nrhs, SolvePrecision::FULL, false, exec);
+      write_out();
+      return;
+    }
+    MATX_LOG_DEBUG("lstsq: R is rank deficient, using SVD");
+  }
+
+  // x^T = b^T conj(U) S^+ V^T, with the factors of A^H giving V and U^H
+  auto v = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+  auto ut = allocate_tensor(cuda::std::array<index_t, 2>{n, m});
+  auto s = make_tensor<inner_type>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto s_mask = make_tensor<bool>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  detail::pinv_svd_factors(v, s, s_mask, ut, a_new, exec, rcond);
+
+  (y = matmul(b_rows, transpose_matrix(ut))).run(exec);
+  (y = y * clone<2>(s, {nrhs, matxKeepDim})).run(exec);
+  (x_rows = matmul(y, transpose_matrix(v))).run(exec);
+  write_out();
+}
+
+} // end namespace matx
@@ -36,47 +36,123 @@
 
 namespace matx
 {
-  template <typename PxxType, typename xType, typename wType, typename fsType>
-    __MATX_INLINE__ void pwelch_impl(PxxType Pxx, const xType& x, const wType& w, index_t nperseg, index_t noverlap, index_t nfft, PwelchOutputScaleMode output_scale_mode, fsType fs, cudaStream_t stream=0)
-  {
-    #ifndef __CUDACC__
-      MATX_THROW(matxNotSupported, "pwelch not supported on host");
-    #else
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  namespace detail {
+    /**
+     * Number of Welch segments of nperseg samples with noverlap samples of overlap that fit in n samples
+     */
+    __MATX_INLINE__ index_t pwelch_num_segments(index_t n, index_t nperseg, index_t noverlap)
+    {
+      return n < nperseg ? 0 : (n - nperseg) / (nperseg - noverlap) + 1;
+    }
 
-      MATX_ASSERT_STR(Pxx.Rank() == x.Rank(), matxInvalidDim, "pwelch:  Pxx rank must be the same as x rank");
-      MATX_ASSERT_STR(nfft >= nperseg, matxInvalidDim, "pwelch:  nfft must be >= nperseg");
-      MATX_ASSERT_STR((noverlap >= 0) && (noverlap < nperseg), matxInvalidDim, "pwelch:  Must have 0 <= noverlap < nperseg");
+    /**
+     * Add |X|^2 of every windowed segment of x into the nfft-long accumulator acc
+     *
+     * The segments are an overlap view of x times the window, zero-padded to nfft with pad(), so
+     * they are formed on the fly as the FFT reads them. When the input is JIT-able this expression
+     * is compiled into a cuFFT load callback and the overlapping segments are never written out.
+     *
+     * @return Number of segments accumulated
+     */
+    template <typename AccType, typename xType, typename wType>
+    __MATX_INLINE__ index_t pwelch_accumulate_impl([[maybe_unused]] AccType *acc, [[maybe_unused]] const xType &x,
+        [[maybe_unused]] const wType &w, [[maybe_unused]] index_t nperseg, [[maybe_unused]] index_t noverlap,
+        [[maybe_unused]] index_t nfft, [[maybe_unused]] cudaStream_t stream)
+    {
+#ifdef __CUDACC__
+      using complex_type = typename xType::value_type;
+      const index_t batches = pwelch_num_segments(x.Size(0), nperseg, noverlap);
+      if (batches == 0) {
+        return 0;
+      }
 
-      // Create overlapping view
-      auto x_with_overlaps = overlap(x,{nperseg}, {nperseg - noverlap});
+      auto X_with_overlaps = [&]() {
+        ScratchScope scratch{stream};
+        return make_tensor<cuda::std::complex<AccType>>({batches, nfft}, MATX_ASYNC_DEVICE_MEMORY, stream);
+      }();
 
-      // Create temporary space for fft outputs
-      index_t batches = x_with_overlaps.Shape()[0];
-      auto X_with_overlaps = make_tensor<cuda::std::complex<typename PxxType::value_type>>({batches,static_cast<index_t>(nfft)},MATX_ASYNC_DEVICE_MEMORY,stream);
+      const auto spectra = [&](const auto &segments) {
+        if (nfft > nperseg) {
+          (X_with_overlaps = fft(pad(segments, 1, {0, nfft - nperseg}, complex_type{0}))).run(stream);
+        }
+        else {
+          (X_with_overlaps = fft(segments)).run(stream);
+        }
+      };
 
+      auto x_with_overlaps = overlap(x, {nperseg}, {nperseg - noverlap});
       if constexpr (std::is_same_v<wType, std::nullopt_t>) {
-        (X_with_overlaps = fft(x_with_overlaps,nfft)).run(stream);
+        spectra(x_with_overlaps);
       }
       else {
-        (X_with_overlaps = fft(x_with_overlaps * w,nfft)).run(stream);
+        spectra(x_with_overlaps * w);
       }
 
+      const index_t col_blocks = (nfft + PWELCH_ACC_COLS - 1) / PWELCH_ACC_COLS;
+      const index_t row_blocks = std::min<index_t>((batches + PWELCH_ACC_ROWS - 1) / PWELCH_ACC_ROWS,
+                                                   std::max<index_t>(1, 1024 / col_blocks));
+      const dim3 block(PWELCH_ACC_COLS, PWELCH_ACC_ROWS);
+      const dim3 grid(static_cast<uint32_t>(col_blocks), static_cast<uint32_t>(row_blocks));
+      pwelch_accumulate_kernel<<<grid, block, 0, stream>>>(X_with_overlaps, acc);
+
+      return batches;
+#else
+      return 0;
+#endif
+    }
+
+    /**
+     * Scale an accumulated sum of |X|^2 over batches segments into Pxx
+     */
+    template <typename PxxType, typename AccType, typename fsType>
+    __MATX_INLINE__ void pwelch_finalize_impl([[maybe_unused]] PxxType &Pxx, [[maybe_unused]] const AccType *acc,
+        [[maybe_unused]] index_t batches, [[maybe_unused]] PwelchOutputScaleMode output_scale_mode,
+        [[maybe_unused]] fsType fs, [[maybe_unused]] cudaStream_t stream)
+    {
+#ifdef __CUDACC__
       int tpb = 512;
-      int bpk = (static_cast<int>(nfft) + tpb - 1) / tpb;
+      int bpk = (static_cast<int>(Pxx.Size(0)) + tpb - 1) / tpb;
 
       if (output_scale_mode == PwelchOutputScaleMode_Spectrum) {
-        detail::pwelch_kernel<PwelchOutputScaleMode_Spectrum><<<bpk, tpb, 0, stream>>>(X_with_overlaps, Pxx, fs);
+        pwelch_finalize_kernel<PwelchOutputScaleMode_Spectrum><<<bpk, tpb, 0, stream>>>(acc, Pxx, batches, fs);
       }
       else if (output_scale_mode == PwelchOutputScaleMode_Density) {
-        detail::pwelch_kernel<PwelchOutputScaleMode_Density><<<bpk, tpb, 0, stream>>>(X_with_overlaps, Pxx, fs);
+        pwelch_finalize_kernel<PwelchOutputScaleMode_Density><<<bpk, tpb, 0, stream>>>(acc, Pxx, batches, fs);
       }
       else if (output_scale_mode == PwelchOutputScaleMode_Spectrum_dB) {
-        detail::pwelch_kernel<PwelchOutputScaleMode_Spectrum_dB><<<bpk, tpb, 0, stream>>>(X_with_overlaps, Pxx, fs);
+        pwelch_finalize_kernel<PwelchOutputScaleMode_Spectrum_dB><<<bpk, tpb, 0, stream>>>(acc, Pxx, batches, fs);
       }
       else { //if (output_scale_mode == PwelchOutputScaleMode_Density_dB)
-        detail::pwelch_kernel<PwelchOutputScaleMode_Density_dB><<<bpk, tpb, 0, stream>>>(X_with_overlaps, Pxx, fs);
+        pwelch_finalize_kernel<PwelchOutputScaleMode_Density_dB><<<bpk, tpb, 0, stream>>>(acc, Pxx, batches, fs);
       }
+#endif
+    }
+  } // end namespace detail
+
+  template <typename PxxType, typename xType, typename wType, typename fsType>
+    __MATX_INLINE__ void pwelch_impl(PxxType Pxx, const xType& x, const wType& w, index_t nperseg, index_t noverlap, index_t nfft, PwelchOutputScaleMode output_scale_mode, fsType fs, cudaStream_t stream=0)
+  {
+    #ifndef __CUDACC__
+      MATX_THROW(matxNotSupported, "pwelch not supported on host");
+    #else
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+
+      MATX_ASSERT_STR(Pxx.Rank() == x.Rank(), matxInvalidDim, "pwelch:  Pxx rank must be the same as x rank");
+      MATX_ASSERT_STR(nfft >= nperseg, matxInvalidDim, "pwelch:  nfft must be >= nperseg");
+      MATX_ASSERT_STR((noverlap >= 0) && (noverlap < nperseg), matxInvalidDim, "pwelch:  Must have 0 <= noverlap < nperseg");
+
+      using acc_type = typename PxxType::value_type;
+      acc_type *acc;
+      {
+        detail::ScratchScope scratch{stream};
+        matxAlloc(reinterpret_cast<void **>(&acc), sizeof(acc_type) * nfft, MATX_ASYNC_DEVICE_MEMORY, stream);
+      }
+      MATX_CUDA_CHECK(cudaMemsetAsync(acc, 0, sizeof(acc_type) * nfft, stream));
+
+      const index_t batches = detail::pwelch_accumulate_impl(acc, x, w, nperseg, noverlap, nfft, stream);
+      detail::pwelch_finalize_impl(Pxx, acc, batches, output_scale_mode, fs, stream);
+
+      matxFree(acc, stream);
     #endif
   }
 } // end namespace matx
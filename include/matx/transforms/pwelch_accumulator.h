@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+#pragma once
+
+#include <optional>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/operators/pwelch.h"
+
+namespace matx {
+namespace experimental {
+
+/**
+ * @brief Running Welch power spectral density estimate over a stream of samples
+ *
+ * Update() takes the next block of samples and adds |X|^2 of every complete segment to a running
+ * sum, so a PSD estimate can be read with Estimate() at any point while samples keep arriving.
+ * Samples past the last complete segment are kept for the next call, so the segments are exactly
+ * those pwelch() would form over the concatenation of all blocks. The segments are formed and
+ * windowed on the fly as the FFT reads them, as in pwelch().
+ *
+ * All work is ordered on the stream given at construction.
+ *
+ * @tparam T Complex sample type
+ * @tparam WType Window operator type, or std::nullopt_t for no window
+ */
+template <typename T, typename WType = std::nullopt_t>
+class PwelchAccumulator {
+  static_assert(is_complex_v<T>, "PwelchAccumulator: samples must be complex");
+
+  public:
+    using value_type = typename T::value_type;
+
+    /**
+     * @brief Set up a running estimate
+     *
+     * @param nperseg Length of each segment
+     * @param noverlap Number of samples shared by consecutive segments
+     * @param nfft FFT size of each segment, at least nperseg
+     * @param w Window applied to each segment
+     * @param stream CUDA stream all updates run on
+     */
+    PwelchAccumulator(index_t nperseg, index_t noverlap, index_t nfft, const WType &w, cudaStream_t stream = 0)
+      : nperseg_(nperseg), noverlap_(noverlap), nfft_(nfft), w_(w), stream_(stream)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      MATX_ASSERT_STR(nfft >= nperseg, matxInvalidDim, "PwelchAccumulator: nfft must be >= nperseg");
+      MATX_ASSERT_STR((noverlap >= 0) && (noverlap < nperseg), matxInvalidDim,
+                      "PwelchAccumulator: Must have 0 <= noverlap < nperseg");
+
+      acc_ = make_tensor<value_type>({nfft}, MATX_DEVICE_MEMORY);
+      tail_ = make_tensor<T>({nperseg}, MATX_DEVICE_MEMORY);
+      Reset();
+    }
+
+    /**
+     * @brief Set up a running estimate without a window
+     *
+     * @param nperseg Length of each segment
+     * @param noverlap Number of samples shared by consecutive segments
+     * @param nfft FFT size of each segment, at least nperseg
+     * @param stream CUDA stream all updates run on
+     */
+    PwelchAccumulator(index_t nperseg, index_t noverlap, index_t nfft, cudaStream_t stream = 0)
+      requires std::is_same_v<WType, std::nullopt_t>
+      : PwelchAccumulator(nperseg, noverlap, nfft, std::nullopt, stream)
+    {
+    }
+
+    /**
+     * @brief Add the segments completed by the next block of samples
+     *
+     * @param x 1D block of samples following those of the previous call
+     */
+    template <typename XType>
+    void Update(const XType &x)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      static_assert(XType::Rank() == 1, "PwelchAccumulator: samples must be 1D");
+
+      const index_t n = tail_len_ + x.Size(0);
+      auto staging = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream_);
+      if (tail_len_ > 0) {
+        (slice(staging, {0}, {tail_len_}) = slice(tail_, {0}, {tail_len_})).run(stream_);
+      }
+      (slice(staging, {tail_len_}, {n}) = x).run(stream_);
+
+      const index_t segments = detail::pwelch_accumulate_impl(acc_.Data(), staging, w_, nperseg_, noverlap_, nfft_, stream_);
+      segments_ += segments;
+
+      // Fewer than nperseg samples remain past the start of the next segment
+      const index_t consumed = segments * (nperseg_ - noverlap_);
+      tail_len_ = n - consumed;
+      if (tail_len_ > 0) {
+        (slice(tail_, {0}, {tail_len_}) = slice(staging, {consumed}, {n})).run(stream_);
+      }
+    }
+
+    /**
+     * @brief Write the PSD estimate of all segments seen so far
+     *
+     * @param Pxx 1D output of length nfft
+     * @param output_scale_mode Output scale mode, as for pwelch()
+     * @param fs Sampling frequency
+     */
+    template <typename PxxType, typename fsType = float>
+    void Estimate(PxxType &Pxx, PwelchOutputScaleMode output_scale_mode = PwelchOutputScaleMode_Spectrum, fsType fs = 1) const
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      static_assert(std::is_same_v<typename PxxType::value_type, value_type>,
+                    "PwelchAccumulator: Pxx must have the real type of the samples");
+      MATX_ASSERT_STR(Pxx.Size(0) == nfft_, matxInvalidSize, "PwelchAccumulator: Pxx must have nfft elements");
+      MATX_ASSERT_STR(segments_ > 0, matxInvalidParameter, "PwelchAccumulator: no complete segment has been seen yet");
+
+      detail::pwelch_finalize_impl(Pxx, acc_.Data(), segments_, output_scale_mode, fs, stream_);
+    }
+
+    /**
+     * @brief Discard all accumulated segments and buffered samples
+     */
+    void Reset()
+    {
+      MATX_CUDA_CHECK(cudaMemsetAsync(acc_.Data(), 0, sizeof(value_type) * nfft_, stream_));
+      tail_len_ = 0;
+      segments_ = 0;
+    }
+
+    /**
+     * @brief Number of segments included in the estimate
+     */
+    index_t Segments() const { return segments_; }
+
+  private:
+    index_t nperseg_;
+    index_t noverlap_;
+    index_t nfft_;
+    WType w_;
+    cudaStream_t stream_;
+    tensor_t<value_type, 1> acc_;
+    tensor_t<T, 1> tail_;
+    index_t tail_len_ = 0;
+    index_t segments_ = 0;
+};
+
+} // end namespace experimental
+} // end namespace matx
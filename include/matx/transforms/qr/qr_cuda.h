@@ -76,7 +76,7 @@ namespace detail {
 
   template<typename QType, typename RType, typename AType, typename WType>
     inline void qr_internal(QType &Q, RType &R, const AType &A, WType workspace, const cudaExecutor &exec) {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
       const auto stream = exec.getStream();
 
       static_assert(AType::Rank() >= 2);
@@ -216,7 +216,7 @@ namespace detail {
 template<typename QType, typename RType, typename AType>
 inline void qr_impl(QType &Q, RType &R, const AType &A, const cudaExecutor &exec) {
   const auto stream = exec.getStream();
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   static_assert(AType::Rank() >= 2);
   static_assert(QType::Rank() == AType::Rank());
@@ -286,7 +286,7 @@ public:
                        const ATensor &a,
                        const cudaExecutor &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK-1 == TauTensor::Rank(), matxInvalidDim, "Tau tensor must be one rank less than output tensor");
@@ -330,7 +330,7 @@ public:
   void Exec(OutTensor &out, TauTensor &tau,
             const ATensor &a, const cudaExecutor &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Batch size checks
     for(int i = 0 ; i < RANK-2; i++) {
@@ -448,7 +448,7 @@ template <typename OutTensor, typename TauTensor, typename ATensor>
 void qr_solver_impl(OutTensor &&out, TauTensor &&tau,
         const ATensor &a, const cudaExecutor &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   using T1 = typename remove_cvref_t<OutTensor>::value_type;
 
   auto tau_new = OpToTensor(tau, exec);
@@ -540,7 +540,7 @@ public:
                        const ATensor &a,
                        const cudaExecutor &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK-1 == TauTensor::Rank(), matxInvalidDim, "Tau tensor must be one rank less than output tensor");
@@ -595,7 +595,7 @@ public:
   void Exec(OutTensor &out, RTensor &out_r, TauTensor &tau,
             const ATensor &a, const cudaExecutor &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Batch size checks
     for(int i = 0 ; i < RANK-2; i++) {
@@ -816,7 +816,7 @@ template <typename OutTensor, typename RTensor, typename ATensor>
 void qr_econ_impl(OutTensor &&out, RTensor &&out_r,
         const ATensor &a, const cudaExecutor &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   using T1 = typename remove_cvref_t<OutTensor>::value_type;
   const int RANK = ATensor::Rank();
 
@@ -98,7 +98,7 @@ public:
   matxDnQRHostPlan_t(TauTensor &tau,
                        const ATensor &a)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(RANK-1 == TauTensor::Rank(), matxInvalidDim, "Tau tensor must be one rank less than output tensor");
@@ -153,7 +153,7 @@ public:
   void Exec(OutTensor &out, TauTensor &tau,
             const ATensor &a, const HostExecutor<MODE> &exec)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Batch size checks
     for(int i = 0 ; i < RANK-2; i++) {
@@ -172,14 +172,15 @@ public:
       (out = a).run(exec);
     }
 
-    lapack_int_t info;
-    for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
+    const lapack_int_t info = this->ExecBatches(exec, [&](size_t i, void *ws, void *, void *) {
+      lapack_int_t batch_info;
       geqrf_dispatch(&params.m, &params.n, reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
                      &params.m, reinterpret_cast<T1*>(this->batch_tau_ptrs[i]),
-                     reinterpret_cast<T1*>(this->work), &this->lwork, &info);
+                     reinterpret_cast<T1*>(ws), &this->lwork, &batch_info);
+      return batch_info;
+    });
 
-      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "LAPACK geqrf error");
-    }
+    MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "LAPACK geqrf error");
   }
 
   /**
@@ -269,7 +270,7 @@ void qr_solver_impl([[maybe_unused]] OutTensor &&out,
                       [[maybe_unused]] const ATensor &a,
                       [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   MATX_ASSERT_STR(MATX_EN_CPU_SOLVER, matxInvalidExecutor,
     "Trying to run a host Solver executor but host Solver support is not configured");
 #if MATX_EN_CPU_SOLVER
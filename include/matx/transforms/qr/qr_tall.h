@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/generators/zeros.h"
+#include "matx/operators/chol.h"
+#include "matx/operators/if.h"
+#include "matx/operators/index.h"
+#include "matx/operators/inverse.h"
+#include "matx/operators/matmul.h"
+#include "matx/operators/slice.h"
+#include "matx/transforms/qr/qr_cuda.h"
+
+namespace matx {
+
+namespace detail {
+
+// With QRMethod::AUTO, matrices at least this many times taller than wide use TSQR
+constexpr index_t QR_TALL_ASPECT = 16;
+// TSQR factors a matrix directly once it has no more than this many rows per column
+constexpr index_t TSQR_DIRECT_ROWS_PER_COL = 8;
+// Upper bound on the number of leaves in one level of the TSQR tree
+constexpr index_t TSQR_MAX_LEAVES = 256;
+
+/**
+ * Communication-avoiding QR of a tall m x n matrix
+ *
+ * The rows are split into p leaves of b >= 4n rows, the last one padded with zeros, and every
+ * leaf is factored in one batched economic QR. The p stacked n x n R factors form a (p n) x n
+ * matrix that is factored the same way, so each level shrinks the height by at least 4x until it
+ * is small enough to factor directly. Q is rebuilt on the way back up by multiplying each leaf's
+ * Q with its n x n block of the next level's Q in one batched GEMM.
+ */
+template <typename QType, typename RType, typename AType>
+void tsqr_impl(QType &Q, RType &R, const AType &A, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using T = typename AType::value_type;
+  const auto stream = exec.getStream();
+  const index_t m = A.Size(0);
+  const index_t n = A.Size(1);
+
+  if (m <= TSQR_DIRECT_ROWS_PER_COL * n) {
+    qr_econ_impl(Q, R, A, exec);
+    return;
+  }
+
+  auto allocate_tensor = [&](auto shape) {
+    ScratchScope scratch{stream};
+    return make_tensor<T>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  };
+
+  const index_t b = cuda::std::max(4 * n, (m + TSQR_MAX_LEAVES - 1) / TSQR_MAX_LEAVES);
+  const index_t p = (m + b - 1) / b;
+
+  auto leaves = allocate_tensor(cuda::std::array<index_t, 3>{p, b, n});
+  auto rows = make_tensor(leaves.Data(), {p * b, n});
+  (slice(rows, {0, 0}, {m, matxEnd}) = A).run(exec);
+  if (p * b > m) {
+    (slice(rows, {m, 0}, {matxEnd, matxEnd}) = zeros<T>({p * b - m, n})).run(exec);
+  }
+
+  auto leaf_q = allocate_tensor(cuda::std::array<index_t, 3>{p, b, n});
+  auto leaf_r = allocate_tensor(cuda::std::array<index_t, 3>{p, n, n});
+  qr_econ_impl(leaf_q, leaf_r, leaves, exec);
+
+  // The stacked R factors are the next level's input, and its Q holds one n x n block per leaf
+  auto stacked_r = make_tensor(leaf_r.Data(), {p * n, n});
+  auto upper_q = allocate_tensor(cuda::std::array<index_t, 2>{p * n, n});
+  tsqr_impl(upper_q, R, stacked_r, exec);
+
+  auto upper_blocks = make_tensor(upper_q.Data(), {p, n, n});
+  (leaves = matmul(leaf_q, upper_blocks)).run(exec);
+  (Q = slice(rows, {0, 0}, {m, matxEnd})).run(exec);
+}
+
+/**
+ * CholeskyQR2 of a tall m x n matrix
+ *
+ * One CholeskyQR pass forms the Gram matrix G = A^H A, factors G = R^H R and sets Q = A R^-1. It
+ * only touches A through two GEMMs, but the orthogonality of Q degrades with cond(A)^2, so a second
+ * pass on Q restores it and R is the product of both factors. The Cholesky factorization fails when
+ * cond(A) is near the inverse square root of the machine epsilon, so this is only suitable for
+ * well-conditioned inputs.
+ */
+template <typename QType, typename RType, typename AType>
+void cholqr2_impl(QType &Q, RType &R, const AType &A, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using T = typename AType::value_type;
+  const auto stream = exec.getStream();
+  const index_t m = A.Size(0);
+  const index_t n = A.Size(1);
+
+  auto allocate_tensor = [&](auto shape) {
+    ScratchScope scratch{stream};
+    return make_tensor<T>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  };
+
+  auto gram = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+  auto r_inv = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+
+  auto cholqr = [&](auto &q_out, auto &r_out, const auto &a_in) {
+    (gram = matmul(conj(transpose_matrix(a_in)), a_in)).run(exec);
+    (r_out = chol(gram, SolverFillMode::UPPER)).run(exec);
+    // chol only writes the upper triangle
+    (IF(index(0) > index(1), r_out = T(0))).run(exec);
+    (r_inv = inv(r_out)).run(exec);
+    (q_out = matmul(a_in, r_inv)).run(exec);
+  };
+
+  auto q1 = allocate_tensor(cuda::std::array<index_t, 2>{m, n});
+  auto r1 = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+  auto r2 = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+  cholqr(q1, r1, A);
+  cholqr(Q, r2, q1);
+  (R = matmul(r2, r1)).run(exec);
+}
+
+} // end namespace detail
+
+/**
+ * Economic QR decomposition with a choice of algorithm
+ *
+ * TSQR and CholeskyQR2 only apply to rank-2 inputs with m >= n. AUTO picks TSQR when m is at least
+ * QR_TALL_ASPECT times n and cuSolver geqrf otherwise.
+ *
+ * @param out
+ *   Orthogonal matrix Q
+ * @param out_r
+ *   Upper triangular output matrix R
+ * @param a
+ *   Input tensor A
+ * @param exec
+ *   CUDA executor
+ * @param method
+ *   Algorithm to use
+ */
+template <typename OutTensor, typename RTensor, typename ATensor>
+void qr_econ_impl(OutTensor &&out, RTensor &&out_r, const ATensor &a, const cudaExecutor &exec, QRMethod method)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  constexpr int RANK = ATensor::Rank();
+
+  if constexpr (RANK == 2) {
+    const index_t m = a.Size(0);
+    const index_t n = a.Size(1);
+    if (method == QRMethod::AUTO) {
+      method = (m >= detail::QR_TALL_ASPECT * n) ? QRMethod::TSQR : QRMethod::GEQRF;
+    }
+
+    if (method != QRMethod::GEQRF) {
+      MATX_ASSERT_STR(m >= n, matxInvalidSize, "TSQR and CholeskyQR2 require a matrix with at least as many rows as columns");
+      auto a_new = OpToTensor(a, exec);
+      if (!is_matx_transform_op<ATensor>() && !a_new.isSameView(a)) {
+        (a_new = a).run(exec);
+      }
+
+      if (method == QRMethod::TSQR) {
+        detail::tsqr_impl(out, out_r, a_new, exec);
+      }
+      else {
+        detail::cholqr2_impl(out, out_r, a_new, exec);
+      }
+      return;
+    }
+  }
+  else {
+    MATX_ASSERT_STR(method == QRMethod::AUTO || method == QRMethod::GEQRF, matxNotSupported,
+                    "TSQR and CholeskyQR2 only support rank-2 inputs");
+  }
+
+  qr_econ_impl(out, out_r, a, exec);
+}
+
+} // end namespace matx
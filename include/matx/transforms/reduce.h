@@ -46,11 +46,17 @@
 #include "matx/core/nvtx.h"
 #include "matx/transforms/cub.h"
 #include "matx/transforms/copy.h"
+#include "matx/transforms/order_stat.h"
 #include "matx/core/reduce_utils.h"
 #include "matx/core/half.h"
+#include "matx/kernels/compensated_sum.cuh"
+#include "matx/kernels/reduce_axes.cuh"
+#include "matx/kernels/softmax.cuh"
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__algorithm/max.h>
 #include <cuda/std/tuple>
+#include <cuda/std/utility>
+#include <vector>
 
 union HalfBits {
   constexpr HalfBits(short x) : i(x) {}
@@ -192,6 +198,268 @@ public:
 
 #endif
 
+#ifdef __CUDACC__
+/**
+ * Compensated sum of float or complex<float> input on a CUDA stream
+ *
+ * The first pass writes one float-float partial per row and block of columns, and the second pass
+ * combines the partials of each row and writes sum * scale to dest.
+ */
+template <typename OutType, typename InType>
+void compensated_sum_cuda(OutType &dest, const InType &in, float scale, cudaStream_t stream)
+{
+  using T = typename InType::value_type;
+  constexpr int THREADS = COMP_SUM_THREADS;
+
+  const index_t rows = TotalSize(dest);
+  const index_t cols = TotalSize(in) / rows;
+  const index_t col_blocks = (cols + COMP_SUM_COLS_PER_BLOCK - 1) / COMP_SUM_COLS_PER_BLOCK;
+  const unsigned row_blocks = static_cast<unsigned>(cuda::std::min(rows, index_t{65535}));
+
+  CompensatedSum<T> *partials;
+  matxAlloc(reinterpret_cast<void **>(&partials), static_cast<size_t>(rows * col_blocks) * sizeof(CompensatedSum<T>),
+            MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  dim3 grid1(static_cast<unsigned>(col_blocks), row_blocks);
+  compensated_sum_partial_kernel<THREADS, T><<<grid1, THREADS, 0, stream>>>(
+      partials, in, Shape(in), rows, cols, COMP_SUM_COLS_PER_BLOCK);
+
+  cuda::std::array<index_t, OutType::Rank() == 0 ? 1 : OutType::Rank()> out_shape{1};
+  if constexpr (OutType::Rank() > 0) {
+    out_shape = Shape(dest);
+  }
+  compensated_sum_final_kernel<THREADS, T><<<row_blocks, THREADS, 0, stream>>>(
+      dest, partials, out_shape, rows, col_blocks, scale);
+
+  matxFree(partials, stream);
+}
+
+/**
+ * Split the dimensions of a strided tensor into kept and reduced ones
+ *
+ * @return the dimension with the smallest stride among those longer than one, or -1 if there is none
+ */
+template <int KEEP, int RED, typename InType>
+int reduce_axes_layout(ReduceAxesLayout<KEEP, RED> &layout, const InType &in)
+{
+  int inner = -1;
+  for (int d = 0; d < InType::Rank(); d++) {
+    const index_t stride = in.Stride(d);
+    if (d < KEEP) {
+      layout.keep_sizes[d] = in.Size(d);
+      layout.keep_strides[d] = stride;
+    }
+    else {
+      layout.red_sizes[d - KEEP] = in.Size(d);
+      layout.red_strides[d - KEEP] = stride;
+    }
+
+    if (in.Size(d) > 1 && (inner < 0 || std::abs(stride) < std::abs(in.Stride(inner)))) {
+      inner = d;
+    }
+  }
+
+  return inner;
+}
+
+/**
+ * Reduce each row of a strided tensor with a row policy from reduce_axes.cuh
+ *
+ * A row is everything the output keeps fixed. The mapping of threads to rows follows the row length:
+ * rows of up to REDUCE_ROWS_THREAD_MAX elements get one thread each, rows of up to REDUCE_ROWS_WARP_MAX a
+ * warp each, and longer rows a whole block. CUB's segmented reductions give every row a block, which
+ * leaves most of each block idle when there are many short rows.
+ *
+ * @return false if the input is not a strided tensor whose unit-stride dimension is reduced, or if it is
+ *   contiguous with rows long enough for CUB, and nothing was launched
+ */
+template <int KEEP, typename Policy, typename InType>
+bool reduce_rows_cuda(const Policy &policy, const InType &in, cudaStream_t stream)
+{
+  constexpr int RED = InType::Rank() - KEEP;
+  using InT = typename InType::value_type;
+
+  if constexpr (!is_tensor_view_v<InType> || KEEP == 0 || RED <= 0 ||
+                !(std::is_arithmetic_v<InT> || is_cuda_complex_v<InT>)) {
+    return false;
+  }
+  else {
+    const index_t total = TotalSize(in);
+    if (total == 0) {
+      return false;
+    }
+
+    index_t outputs = 1;
+    for (int d = 0; d < KEEP; d++) {
+      outputs *= in.Size(d);
+    }
+    const index_t reduced = total / outputs;
+
+    // Long contiguous rows already fill a CUB block each
+    if (in.IsContiguous() && reduced > REDUCE_ROWS_WARP_MAX) {
+      return false;
+    }
+
+    ReduceAxesLayout<KEEP, RED> layout;
+    const int inner = reduce_axes_layout(layout, in);
+    if (inner < KEEP) {
+      return false;
+    }
+
+    // Step along the reduced dimensions from the largest stride to the smallest so that consecutive
+    // threads of a group read consecutive elements
+    if constexpr (Policy::reorderable) {
+      for (int i = 1; i < RED; i++) {
+        for (int j = i; j > 0 && std::abs(layout.red_strides[j - 1]) < std::abs(layout.red_strides[j]); j--) {
+          std::swap(layout.red_strides[j - 1], layout.red_strides[j]);
+          std::swap(layout.red_sizes[j - 1], layout.red_sizes[j]);
+        }
+      }
+    }
+    else {
+      // Rows are read in the view's own order, which only coalesces when the last dimension is the unit-stride one
+      if (inner != InType::Rank() - 1) {
+        return false;
+      }
+    }
+
+    const InT *in_ptr = in.Data();
+    if (reduced <= REDUCE_ROWS_THREAD_MAX) {
+      const auto blocks = static_cast<unsigned>((outputs + REDUCE_AXES_THREADS - 1) / REDUCE_AXES_THREADS);
+      reduce_rows_kernel<1, Policy, InT, KEEP, RED><<<blocks, REDUCE_AXES_THREADS, 0, stream>>>(
+          policy, in_ptr, layout, outputs, reduced);
+    }
+    else if (reduced <= REDUCE_ROWS_WARP_MAX) {
+      constexpr int GROUPS = REDUCE_AXES_THREADS / 32;
+      const auto blocks = static_cast<unsigned>((outputs + GROUPS - 1) / GROUPS);
+      reduce_rows_kernel<32, Policy, InT, KEEP, RED><<<blocks, REDUCE_AXES_THREADS, 0, stream>>>(
+          policy, in_ptr, layout, outputs, reduced);
+    }
+    else {
+      reduce_rows_kernel<REDUCE_AXES_THREADS, Policy, InT, KEEP, RED><<<static_cast<unsigned>(outputs), REDUCE_AXES_THREADS, 0, stream>>>(
+          policy, in_ptr, layout, outputs, reduced);
+    }
+
+    return true;
+  }
+}
+
+/**
+ * Reduce a strided tensor over its trailing dimensions straight from its strides
+ *
+ * Reductions over non-trailing axes arrive here as permuted views. Going through CUB, such a view is
+ * read through an operator iterator whose loads are strided. Instead the unit-stride dimension picks the
+ * strategy: when it is kept, threads take consecutive outputs and loads coalesce across the kept axis;
+ * when it is reduced, reduce_rows_cuda steps along it. Neither copies the input.
+ *
+ * @return false if the input is not a strided tensor this applies to, and nothing was launched
+ */
+template <typename OutType, typename InType, typename ReduceOp>
+bool reduce_axes_cuda(OutType &dest, const InType &in, [[maybe_unused]] ReduceOp op, cudaStream_t stream)
+{
+  constexpr int KEEP = OutType::Rank();
+  constexpr int RED = InType::Rank() - OutType::Rank();
+  using OutT = typename OutType::value_type;
+  using InT = typename InType::value_type;
+
+  if constexpr (!is_tensor_view_v<InType> || !is_tensor_view_v<OutType> || KEEP == 0 || RED <= 0 ||
+                !(std::is_arithmetic_v<OutT> || is_cuda_complex_v<OutT>) || !(std::is_arithmetic_v<InT> || is_cuda_complex_v<InT>)) {
+    return false;
+  }
+  else {
+    if (!dest.IsContiguous()) {
+      return false;
+    }
+
+    const index_t outputs = TotalSize(dest);
+    if (outputs == 0 || TotalSize(in) == 0) {
+      return false;
+    }
+    const index_t reduced = TotalSize(in) / outputs;
+
+    ReduceAxesLayout<KEEP, RED> layout;
+    const int inner = reduce_axes_layout(layout, in);
+    if (inner < 0) {
+      return false;
+    }
+
+    OutT *out_ptr = dest.Data();
+    if (inner >= KEEP) {
+      return reduce_rows_cuda<KEEP>(ReduceRowsValuePolicy<ReduceOp, OutT>{out_ptr}, in, stream);
+    }
+
+    // Only the innermost output dimension keeps the writes of consecutive threads consecutive too
+    if (inner != KEEP - 1) {
+      return false;
+    }
+
+    const InT *in_ptr = in.Data();
+    constexpr int COLS = REDUCE_AXES_THREADS / REDUCE_AXES_COL_SPLIT;
+    const index_t col_blocks = (outputs + COLS - 1) / COLS;
+
+    // Few outputs with long reductions cannot fill the GPU one block per column group, so the
+    // reduction is split into chunks whose partials are combined by a second pass
+    int dev;
+    int num_sms;
+    MATX_CUDA_CHECK(cudaGetDevice(&dev));
+    MATX_CUDA_CHECK(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev));
+    const index_t target_blocks = static_cast<index_t>(num_sms) * 8;
+    const index_t max_chunks = cuda::std::max(index_t{1}, reduced / (REDUCE_AXES_COL_SPLIT * 64));
+    const index_t chunks = cuda::std::min(cuda::std::min((target_blocks + col_blocks - 1) / col_blocks, max_chunks), index_t{65535});
+    const index_t chunk = (reduced + chunks - 1) / chunks;
+
+    const dim3 threads(COLS, REDUCE_AXES_COL_SPLIT);
+    if (chunks == 1) {
+      reduce_axes_column_kernel<OutT, InT, ReduceOp, KEEP, RED><<<dim3(static_cast<unsigned>(col_blocks), 1), threads, 0, stream>>>(
+          out_ptr, in_ptr, layout, outputs, reduced, reduced);
+    }
+    else {
+      OutT *partials;
+      matxAlloc(reinterpret_cast<void **>(&partials), static_cast<size_t>(chunks * outputs) * sizeof(OutT),
+                MATX_ASYNC_DEVICE_MEMORY, stream);
+
+      reduce_axes_column_kernel<OutT, InT, ReduceOp, KEEP, RED><<<dim3(static_cast<unsigned>(col_blocks), static_cast<unsigned>(chunks)), threads, 0, stream>>>(
+          partials, in_ptr, layout, outputs, reduced, chunk);
+
+      // The partials are a contiguous chunks x outputs array, itself a column reduction
+      const ReduceAxesLayout<1, 1> partial_layout{{outputs}, {1}, {chunks}, {outputs}};
+      reduce_axes_column_kernel<OutT, OutT, ReduceOp, 1, 1><<<dim3(static_cast<unsigned>(col_blocks), 1), threads, 0, stream>>>(
+          out_ptr, partials, partial_layout, outputs, chunks, chunks);
+
+      matxFree(partials, stream);
+    }
+
+    return true;
+  }
+}
+#endif
+
+/**
+ * Compensated sum, or mean when average is set, of float or complex<float> input on the host
+ */
+template <typename OutType, typename InType, typename Executor>
+void compensated_sum_host(OutType &dest, const InType &in, const Executor &exec, bool average)
+{
+  using T = typename InType::value_type;
+  using acc_t = CompensatedSum<T>;
+
+  auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    const auto ts = TotalSize(in);
+    const auto sums = HostReduceRows<OutType::Rank(), acc_t>(exec, ts, lin, lbegin, lend,
+      [](index_t) { return acc_t::Zero(); },
+      [&](index_t i) { auto a = acc_t::Zero(); a.Add(static_cast<T>(lin[i])); return a; },
+      [](acc_t a, const acc_t &b) { a.Add(b); return a; });
+
+    const index_t count = OutType::Rank() == 0 ? ts : ts / TotalSize(dest);
+    const float scale = average ? 1.0f / static_cast<float>(count) : 1.0f;
+    for (size_t b = 0; b < sums.size(); b++) {
+      lout[static_cast<index_t>(b)] = sums[b].Value(scale);
+    }
+  };
+
+  ReduceInputNoConvert(ft, dest, in);
+}
+
 } // namespace detail
 
 /**
@@ -234,7 +502,13 @@ template <typename OutType, typename InType, typename ReduceOp>
 void __MATX_INLINE__ reduce(OutType dest, const InType &in, ReduceOp op,
                    cudaStream_t stream = 0, [[maybe_unused]] bool init = true)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+#ifdef __CUDACC__
+  if (detail::reduce_axes_cuda(dest, in, op, stream)) {
+    return;
+  }
+#endif
+
   // Use CUB implementation if we have a tensor on the RHS and it's not blocked from using CUB
   cub_reduce<OutType, InType, ReduceOp>(dest, in, op.Init(), stream);
 }
@@ -264,10 +538,10 @@ void __MATX_INLINE__ reduce(OutType dest, const InType &in, ReduceOp op,
  */
 template <typename OutType, typename InType>
 void __MATX_INLINE__ mean_impl(OutType dest, const InType &in,
-                 const cudaExecutor &exec)
+                 const cudaExecutor &exec, SumAccuracy accuracy = SumAccuracy::DEFAULT)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("mean_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("mean_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   static_assert(OutType::Rank() < InType::Rank(), "reduction dimensions must be <= Rank of input");
 
   using inner_type = typename inner_op_type_t<typename InType::value_type>::type;
@@ -275,15 +549,22 @@ void __MATX_INLINE__ mean_impl(OutType dest, const InType &in,
 
   cudaStream_t stream = exec.getStream();
 
-
-  sum_impl(dest, in, stream);
-
   // The reduction is performed over the difference in ranks between input and
   // output. This loop computes the number of elements it was performed over.
   for (int i = 1; i <= InType::Rank() - OutType::Rank(); i++) {
     scale *= static_cast<inner_type>(in.Size(InType::Rank() - i));
   }
 
+  if constexpr (detail::is_compensated_sum_type_v<typename InType::value_type>) {
+    if (accuracy == SumAccuracy::COMPENSATED) {
+      // Scaling in the final pass keeps the division in float-float as well
+      detail::compensated_sum_cuda(dest, in, 1.0f / scale, stream);
+      return;
+    }
+  }
+
+  sum_impl(dest, in, stream);
+
   (dest = dest * static_cast<inner_type>(1) / scale).run(stream);
 #endif
 }
@@ -312,21 +593,34 @@ void __MATX_INLINE__ mean_impl(OutType dest, const InType &in,
  *   Single thread host executor
  */
 template <typename OutType, typename InType, ThreadsMode MODE>
-void __MATX_INLINE__ mean_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
+void __MATX_INLINE__ mean_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec,
+                               SumAccuracy accuracy = SumAccuracy::DEFAULT)
 {
-  MATX_NVTX_START("mean_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("mean_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   static_assert(OutType::Rank() < InType::Rank(), "reduction dimensions must be <= Rank of input");
+  if constexpr (detail::is_compensated_sum_type_v<typename InType::value_type>) {
+    if (accuracy == SumAccuracy::COMPENSATED) {
+      detail::compensated_sum_host(dest, in, exec, true);
+      return;
+    }
+  }
   using inner_type = typename inner_op_type_t<typename InType::value_type>::type;
 
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    using T = typename InType::value_type;
+    const auto ts = TotalSize(in);
+    const auto sums = detail::HostReduceRows<OutType::Rank(), T>(exec, ts, lin, lbegin, lend,
+      [](index_t) { return static_cast<T>(0); },
+      [&](index_t i) { return static_cast<T>(lin[i]); },
+      [](const T &a, const T &b) { return static_cast<T>(a + b); });
+
     if constexpr (OutType::Rank() == 0) {
-      auto ts = TotalSize(in);
-      *lout = std::accumulate(lin, lin + ts, static_cast<typename InType::value_type>(0)) / static_cast<inner_type>(ts);
+      *lout = sums[0] / static_cast<inner_type>(ts);
     }
     else {
       for (index_t b = 0; b < lin.Size(0); b++) {
-        *(lout + b) = std::accumulate(lin + lbegin[b], lin + lend[b], static_cast<typename InType::value_type>(0)) / static_cast<inner_type>(lin.Size(1));
+        *(lout + b) = sums[static_cast<size_t>(b)] / static_cast<inner_type>(lin.Size(1));
       }
     }
   };
@@ -358,12 +652,78 @@ void __MATX_INLINE__ mean_impl(OutType dest, const InType &in, [[maybe_unused]]
  * @param stream
  *   CUDA stream
  */
+// Longest single row computed by the online softmax kernel. One block per row cannot use the whole GPU, so
+// a single longer row uses the device-wide max and sum reductions instead.
+constexpr index_t SOFTMAX_ONLINE_MAX_SINGLE_ROW = 1 << 16;
+
+/**
+ * Online softmax over the last ndims dimensions of the permuted input
+ *
+ * The max and the sum of exponentials are computed together in a single pass over each row, followed by
+ * a pass that writes the output. Rows short enough to be cached in shared memory are only read once.
+ *
+ * @param dest Destination for softmax output
+ * @param in Input data
+ * @param mask Operator of the same shape as in. Elements where it is false are excluded and written as zero
+ * @param perm Permutation moving the softmax dimensions last
+ * @param ndims Number of softmax dimensions
+ * @param stream CUDA stream
+ */
+template <typename OutType, typename InType, typename MaskType, int RANK>
+void softmax_online_impl(OutType &dest, const InType &in, const MaskType &mask,
+                         const cuda::std::array<int, RANK> &perm, int ndims, cudaStream_t stream)
+{
+#ifdef __CUDACC__
+  using value_type = typename InType::value_type;
+  using acc_type = cuda::std::conditional_t<std::is_same_v<value_type, double>, double, float>;
+
+  cuda::std::array<index_t, RANK> pshape;
+  index_t rows = 1;
+  index_t cols = 1;
+  for (int r = 0; r < RANK; r++) {
+    pshape[r] = in.Size(perm[r]);
+    if (r < RANK - ndims) {
+      rows *= pshape[r];
+    }
+    else {
+      cols *= pshape[r];
+    }
+  }
+
+  if (rows == 0 || cols == 0) {
+    return;
+  }
+
+  const size_t cache_bytes = static_cast<size_t>(cols) * sizeof(acc_type);
+  if (cache_bytes <= SOFTMAX_MAX_CACHED_ROW_BYTES) {
+    softmax_online_kernel<SOFTMAX_THREADS, true, acc_type><<<static_cast<unsigned int>(rows), SOFTMAX_THREADS, cache_bytes, stream>>>(
+        dest, in, mask, perm, pshape, cols);
+  }
+  else {
+    softmax_online_kernel<SOFTMAX_THREADS, false, acc_type><<<static_cast<unsigned int>(rows), SOFTMAX_THREADS, 0, stream>>>(
+        dest, in, mask, perm, pshape, cols);
+  }
+  MATX_CUDA_CHECK_LAST_ERROR();
+#endif
+}
+
 template <typename OutType, typename InType>
 void __MATX_INLINE__ softmax_impl(OutType dest, const InType &in,
                  cudaStream_t stream = 0)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("softmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("softmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+
+  if constexpr (InType::Rank() > 0 && !is_complex_v<typename InType::value_type>) {
+    if (TotalSize(in) <= SOFTMAX_ONLINE_MAX_SINGLE_ROW) {
+      cuda::std::array<int, InType::Rank()> perm;
+      for (int r = 0; r < InType::Rank(); r++) {
+        perm[r] = r;
+      }
+      softmax_online_impl(dest, in, SoftmaxNoMask{}, perm, InType::Rank(), stream);
+      return;
+    }
+  }
 
   auto tmp_sum = make_tensor<typename InType::value_type>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
   auto tmp_max = make_tensor<typename InType::value_type>({}, MATX_ASYNC_DEVICE_MEMORY, stream);
@@ -403,13 +763,24 @@ template <typename OutType, typename InType, typename PermDims>
 void __MATX_INLINE__ softmax_impl(OutType dest, const InType &in, PermDims dims, cudaStream_t stream = 0)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("softmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("softmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   static_assert(dims.size() < InType::Rank(), "softmax dimensions must be <= Rank of input");
   static_assert(OutType::Rank() == InType::Rank(), "softmax output rank must equal input rank");
 
   auto perm = detail::getPermuteDims<InType::Rank()>(dims);
 
+  if constexpr (!is_complex_v<typename InType::value_type>) {
+    index_t cols = 1;
+    for (int r = InType::Rank() - (int)dims.size(); r < InType::Rank(); r++) {
+      cols *= in.Size(perm[r]);
+    }
+    if (TotalSize(in) > cols || cols <= SOFTMAX_ONLINE_MAX_SINGLE_ROW) {
+      softmax_online_impl(dest, in, SoftmaxNoMask{}, perm, (int)dims.size(), stream);
+      return;
+    }
+  }
+
   // Create the shape of the summed tensor based on the permutation params
   cuda::std::array<index_t, InType::Rank() - (int)dims.size()> red_shape{};
   MATX_LOOP_UNROLL
@@ -443,15 +814,98 @@ void __MATX_INLINE__ softmax_impl(OutType dest, const InType &in, PermDims dims,
 #endif
 }
 
+/**
+ * Calculate the softmax of values in a tensor treated as a flat vector, excluding masked elements
+ *
+ * Elements where the mask is false do not contribute to the max or the sum and are written as zero.
+ * A row with every element masked is written as all zeros.
+ *
+ * @tparam OutType
+ *   Output data type
+ * @tparam InType
+ *   Input data type
+ * @tparam MaskType
+ *   Mask operator type
+ *
+ * @param dest
+ *   Destination for softmax output
+ * @param in
+ *   Input data to compute the softmax
+ * @param mask
+ *   Operator with the same shape as the input that is true for elements to include
+ * @param stream
+ *   CUDA stream
+ */
+template <typename OutType, typename InType, typename MaskType>
+void __MATX_INLINE__ softmax_masked_impl(OutType dest, const InType &in, const MaskType &mask,
+                 cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("softmax_masked_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+
+  static_assert(!is_complex_v<typename InType::value_type>, "masked softmax requires a real input type");
+  static_assert(MaskType::Rank() == InType::Rank(), "softmax mask rank must equal input rank");
+  for (int r = 0; r < InType::Rank(); r++) {
+    MATX_ASSERT_STR(mask.Size(r) == in.Size(r), matxInvalidSize, "softmax mask must have the same shape as the input");
+  }
+
+  cuda::std::array<int, InType::Rank()> perm;
+  for (int r = 0; r < InType::Rank(); r++) {
+    perm[r] = r;
+  }
+  softmax_online_impl(dest, in, mask, perm, InType::Rank(), stream);
+}
+
+/**
+ * Calculate the softmax of values in a tensor over the given dimensions, excluding masked elements
+ *
+ * Elements where the mask is false do not contribute to the max or the sum and are written as zero.
+ * A row with every element masked is written as all zeros.
+ *
+ * @tparam OutType
+ *   Output data type
+ * @tparam InType
+ *   Input data type
+ * @tparam MaskType
+ *   Mask operator type
+ * @tparam PermDims
+ *   Permutation array
+ *
+ * @param dest
+ *   Destination for softmax output
+ * @param in
+ *   Input data to compute the softmax
+ * @param mask
+ *   Operator with the same shape as the input that is true for elements to include
+ * @param dims
+ *   C-style array containing the dimensions to sum over
+ * @param stream
+ *   CUDA stream
+ */
+template <typename OutType, typename InType, typename MaskType, typename PermDims>
+void __MATX_INLINE__ softmax_masked_impl(OutType dest, const InType &in, const MaskType &mask, PermDims dims,
+                 cudaStream_t stream = 0)
+{
+  MATX_NVTX_START_CACHED("softmax_masked_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+
+  static_assert(dims.size() < InType::Rank(), "softmax dimensions must be <= Rank of input");
+  static_assert(!is_complex_v<typename InType::value_type>, "masked softmax requires a real input type");
+  static_assert(MaskType::Rank() == InType::Rank(), "softmax mask rank must equal input rank");
+  for (int r = 0; r < InType::Rank(); r++) {
+    MATX_ASSERT_STR(mask.Size(r) == in.Size(r), matxInvalidSize, "softmax mask must have the same shape as the input");
+  }
+
+  softmax_online_impl(dest, in, mask, detail::getPermuteDims<InType::Rank()>(dims), (int)dims.size(), stream);
+}
+
 /**
  * Calculate the median of values in a tensor
  *
- * Calculates the median of rows in a tensor. The median is computed by sorting
- * the data into a temporary tensor, then picking the middle element of each
- * row. For an even number of items, the mean of the two middle elements is
- * selected. Currently only works on tensor views as input since it uses CUB
- * sorting as a backend, and the tensor views must be rank 2 reducing to rank 1,
- * or rank 1 reducing to rank 0.
+ * Calculates the median of rows in a tensor. For real types, including half, the
+ * middle element(s) of every row are found with a batched radix select in a
+ * single launch, without sorting or copying the input. Other types sort the
+ * data into a temporary tensor and pick the middle element of each row. For an
+ * even number of items, the mean of the two middle elements is selected. The
+ * input must be rank 2 reducing to rank 1, or rank 1 reducing to rank 0.
  *
  * @tparam T
  *   Output data type
@@ -473,51 +927,72 @@ void __MATX_INLINE__ median_impl(OutType dest,
 {
 #ifdef __CUDACC__
   if constexpr ( OutType::Rank() <= 1 && InType::Rank() <=2 ) {
-    MATX_NVTX_START("median_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("median_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
     using T = typename OutType::value_type;
     constexpr int RANK_IN = InType::Rank();
     static_assert(RANK_IN <= 2 && (RANK_IN == OutType::Rank() + 1));
 
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
     cudaStream_t stream = exec.getStream();
 
-    auto tmp_sort = make_tensor<T>(in.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
+    if constexpr (detail::order_stat_supported_v<T>) {
+      // Select the middle element(s) of each row directly rather than sorting
+      if constexpr (RANK_IN == 2) {
+        MATX_ASSERT(dest.Size(0) == in.Size(0), matxInvalidSize);
+      }
 
-    // If the rank is 0 we're finding the median of a vector
-    if constexpr (RANK_IN == 1) {
-      matx::sort_impl(tmp_sort, in, SORT_DIR_ASC, stream);
+      const index_t n = in.Size(RANK_IN - 1);
+      auto lo = make_tensor<T>(dest.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
 
-      // Store median
-      if (tmp_sort.Lsize() & 1) {
-        auto middlev =
-          slice<0>(tmp_sort, {tmp_sort.Lsize() / 2}, {matxDropDim});
-        matx::copy(dest, middlev, stream);
+      if (n & 1) {
+        detail::order_stat_impl(lo.Data(), static_cast<T *>(nullptr), in, n / 2, stream);
+        (dest = lo).run(stream);
       }
       else {
-        auto middle1v =
-          slice<0>(tmp_sort, {tmp_sort.Lsize() / 2 - 1}, {matxDropDim});
-        auto middle2v =
-          slice<0>(tmp_sort, {tmp_sort.Lsize() / 2}, {matxDropDim});
-        (dest = (middle1v + middle2v) / 2.0f).run(stream);
+        auto hi = make_tensor<T>(dest.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
+        detail::order_stat_impl(lo.Data(), hi.Data(), in, n / 2 - 1, stream);
+        (dest = (lo + hi) / 2.0f).run(stream);
       }
     }
-    else if constexpr (RANK_IN == 2) {
-      MATX_ASSERT(dest.Size(0) == in.Size(0), matxInvalidSize);
+    else {
+      auto tmp_sort = make_tensor<T>(in.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
 
-      matx::sort_impl(tmp_sort, in, SORT_DIR_ASC, stream);
+      // If the rank is 0 we're finding the median of a vector
+      if constexpr (RANK_IN == 1) {
+        matx::sort_impl(tmp_sort, in, SORT_DIR_ASC, stream);
 
-      if (tmp_sort.Lsize() & 1) {
-        auto sv = slice<1>(tmp_sort, {0, tmp_sort.Lsize() / 2},
-            {matxEnd, matxDropDim});
-        (dest = self(sv)).run(stream);
+        // Store median
+        if (tmp_sort.Lsize() & 1) {
+          auto middlev =
+            slice<0>(tmp_sort, {tmp_sort.Lsize() / 2}, {matxDropDim});
+          matx::copy(dest, middlev, stream);
+        }
+        else {
+          auto middle1v =
+            slice<0>(tmp_sort, {tmp_sort.Lsize() / 2 - 1}, {matxDropDim});
+          auto middle2v =
+            slice<0>(tmp_sort, {tmp_sort.Lsize() / 2}, {matxDropDim});
+          (dest = (middle1v + middle2v) / 2.0f).run(stream);
+        }
       }
-      else {
-        auto sv = slice<1>(tmp_sort, {0, tmp_sort.Lsize() / 2 - 1},
-            {matxEnd, matxDropDim});
-        auto sv2 = slice<1>(tmp_sort, {0, tmp_sort.Lsize() / 2},
-            {matxEnd, matxDropDim});
-        (dest = (sv + sv2) / 2.0f).run(stream);
+      else if constexpr (RANK_IN == 2) {
+        MATX_ASSERT(dest.Size(0) == in.Size(0), matxInvalidSize);
+
+        matx::sort_impl(tmp_sort, in, SORT_DIR_ASC, stream);
+
+        if (tmp_sort.Lsize() & 1) {
+          auto sv = slice<1>(tmp_sort, {0, tmp_sort.Lsize() / 2},
+              {matxEnd, matxDropDim});
+          (dest = self(sv)).run(stream);
+        }
+        else {
+          auto sv = slice<1>(tmp_sort, {0, tmp_sort.Lsize() / 2 - 1},
+              {matxEnd, matxDropDim});
+          auto sv2 = slice<1>(tmp_sort, {0, tmp_sort.Lsize() / 2},
+              {matxEnd, matxDropDim});
+          (dest = (sv + sv2) / 2.0f).run(stream);
+        }
       }
     }
   } else {
@@ -579,17 +1054,16 @@ void __MATX_INLINE__ median_impl(OutType dest,
 template <typename OutType, typename InType, ThreadsMode MODE>
 void __MATX_INLINE__ median_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("median_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("median_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
     if constexpr (OutType::Rank() == 0) {
       auto insize = TotalSize(in);
       auto tin = new typename InType::value_type[insize];
-      std::partial_sort_copy( lin,
-                              lin + insize,
-                              tin,
-                              tin + insize);
+      std::copy(lin, lin + insize, tin);
+      // Only the middle element(s) are needed, so select rather than sort
+      std::nth_element(tin, tin + insize / 2, tin + insize);
       if ((insize % 2) == 0) {
-        *lout = (tin[insize / 2] + tin[insize / 2 - 1]) / 2.0f;
+        *lout = (tin[insize / 2] + *std::max_element(tin, tin + insize / 2)) / 2.0f;
       }
       else {
         *lout = tin[insize / 2];
@@ -601,13 +1075,11 @@ void __MATX_INLINE__ median_impl(OutType dest, const InType &in, [[maybe_unused]
       auto insize = lin.Size(1);
       auto tin = new typename InType::value_type[insize];
       for (index_t b = 0; b < lin.Size(0); b++) {
-        std::partial_sort_copy( lin + lbegin[b],
-                                lin + lend[b],
-                                tin,
-                                tin + insize);
+        std::copy(lin + lbegin[b], lin + lend[b], tin);
+        std::nth_element(tin, tin + insize / 2, tin + insize);
 
         if ((insize % 2) == 0) {
-          *(lout + b) = (tin[insize / 2] + tin[insize / 2 - 1]) / 2.0f;
+          *(lout + b) = (tin[insize / 2] + *std::max_element(tin, tin + insize / 2)) / 2.0f;
         }
         else {
           *(lout + b) = tin[insize / 2];
@@ -641,12 +1113,24 @@ void __MATX_INLINE__ median_impl(OutType dest, const InType &in, [[maybe_unused]
  *   CUDA executor
  */
 template <typename OutType, typename InType>
-void __MATX_INLINE__ sum_impl(OutType dest, const InType &in, const cudaExecutor &exec)
+void __MATX_INLINE__ sum_impl(OutType dest, const InType &in, const cudaExecutor &exec,
+                              SumAccuracy accuracy = SumAccuracy::DEFAULT)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("sum_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("sum_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   cudaStream_t stream = exec.getStream();
+  if constexpr (detail::is_compensated_sum_type_v<typename InType::value_type>) {
+    if (accuracy == SumAccuracy::COMPENSATED) {
+      detail::compensated_sum_cuda(dest, in, 1.0f, stream);
+      return;
+    }
+  }
+
+  if (detail::reduce_axes_cuda(dest, in, detail::reduceOpSum<typename OutType::value_type>(), stream)) {
+    return;
+  }
+
   cub_sum<OutType, InType>(dest, in, stream);
 #endif
 }
@@ -669,18 +1153,26 @@ void __MATX_INLINE__ sum_impl(OutType dest, const InType &in, const cudaExecutor
  *   Single thread host executor
  */
 template <typename OutType, typename InType, ThreadsMode MODE>
-void __MATX_INLINE__ sum_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
+void __MATX_INLINE__ sum_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec,
+                              SumAccuracy accuracy = SumAccuracy::DEFAULT)
 {
-  MATX_NVTX_START("sum_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
-  auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
-    if constexpr (OutType::Rank() == 0) {
-      *lout = std::accumulate(lin, lin + lin.Size(0), static_cast<typename InType::value_type>(0));
+  MATX_NVTX_START_CACHED("sum_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  if constexpr (detail::is_compensated_sum_type_v<typename InType::value_type>) {
+    if (accuracy == SumAccuracy::COMPENSATED) {
+      detail::compensated_sum_host(dest, in, exec, false);
+      return;
     }
-    else {
-      for (index_t b = 0; b < lin.Size(0); b++) {
-        auto f = std::accumulate(lin + lbegin[b], lin + lend[b], static_cast<typename InType::value_type>(0));
-        *(lout + b) = f;
-      }
+  }
+
+  auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    using T = typename InType::value_type;
+    const auto sums = detail::HostReduceRows<OutType::Rank(), T>(exec, TotalSize(in), lin, lbegin, lend,
+      [](index_t) { return static_cast<T>(0); },
+      [&](index_t i) { return static_cast<T>(lin[i]); },
+      [](const T &a, const T &b) { return static_cast<T>(a + b); });
+
+    for (size_t b = 0; b < sums.size(); b++) {
+      lout[static_cast<index_t>(b)] = sums[b];
     }
   };
 
@@ -710,7 +1202,7 @@ template <typename OutType, typename InType>
 void __MATX_INLINE__ prod_impl(OutType dest, const InType &in, const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("prod_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("prod_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   cudaStream_t stream = exec.getStream();
   // Reduce "in" into "dest" using a product operation as the reduction type
@@ -738,21 +1230,16 @@ void __MATX_INLINE__ prod_impl(OutType dest, const InType &in, const cudaExecuto
 template <typename OutType, typename InType, ThreadsMode MODE>
 void __MATX_INLINE__ prod_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("prod_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("prod_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
-    if constexpr (OutType::Rank() == 0) {
-      *lout = std::accumulate(lin,
-                              lin + TotalSize(in),
-                              static_cast<typename InType::value_type>(1),
-                              std::multiplies<typename InType::value_type>());
-    }
-    else {
-      for (index_t b = 0; b < lin.Size(0); b++) {
-        *(lout + b) = std::accumulate(lin + lbegin[b],
-                                      lin + lend[b],
-                                      static_cast<typename InType::value_type>(1),
-                                      std::multiplies<typename InType::value_type>());
-      }
+    using T = typename InType::value_type;
+    const auto prods = detail::HostReduceRows<OutType::Rank(), T>(exec, TotalSize(in), lin, lbegin, lend,
+      [](index_t) { return static_cast<T>(1); },
+      [&](index_t i) { return static_cast<T>(lin[i]); },
+      [](const T &a, const T &b) { return static_cast<T>(a * b); });
+
+    for (size_t b = 0; b < prods.size(); b++) {
+      lout[static_cast<index_t>(b)] = prods[b];
     }
   };
 
@@ -782,9 +1269,15 @@ template <typename OutType, typename InType>
 void __MATX_INLINE__ max_impl(OutType dest, const InType &in, const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("max_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("max_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   cudaStream_t stream = exec.getStream();
+  if constexpr (!is_complex_v<typename OutType::value_type>) {
+    if (detail::reduce_axes_cuda(dest, in, detail::reduceOpMax<typename OutType::value_type>(), stream)) {
+      return;
+    }
+  }
+
   cub_max<OutType, InType>(dest, in, stream);
 #endif
 }
@@ -809,17 +1302,18 @@ void __MATX_INLINE__ max_impl(OutType dest, const InType &in, const cudaExecutor
 template <typename OutType, typename InType, ThreadsMode MODE>
 void __MATX_INLINE__ max_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("max_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("max_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
-    if constexpr (OutType::Rank() == 0) {
-      *lout = *std::max_element(lin, lin + TotalSize(in));
-    }
-    else {
-      const index_t BATCHES = TotalSize(dest);
-      for (index_t b = 0; b < BATCHES; b++) {
-        lout[b] = *std::max_element(lin + lbegin[b], lin + lend[b]);
-      }
+    using T = remove_cvref_t<decltype(lin[0])>;
+    // max is idempotent, so the first element of a batch seeds every accumulator
+    const auto vals = detail::HostReduceRows<OutType::Rank(), T>(exec, TotalSize(in), lin, lbegin, lend,
+      [&](index_t first) { return static_cast<T>(lin[first]); },
+      [&](index_t i) { return static_cast<T>(lin[i]); },
+      [](const T &a, const T &b) { return a < b ? b : a; });
+
+    for (size_t b = 0; b < vals.size(); b++) {
+      lout[static_cast<index_t>(b)] = vals[b];
     }
   };
 
@@ -852,13 +1346,25 @@ template <typename OutType, typename TensorIndexType, typename InType>
 void __MATX_INLINE__ argmax_impl(OutType dest, TensorIndexType &idest, const InType &in, const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("argmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("argmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   const auto initial_value = cuda::std::make_tuple(static_cast<matx::index_t>(-1), std::numeric_limits<typename InType::value_type>::lowest());
   using reduce_param_type = typename detail::ReduceParams_t<typename detail::CustomArgMaxCmp, decltype(initial_value)>;
   auto reduce_params = reduce_param_type{detail::CustomArgMaxCmp{}, initial_value};
 
   cudaStream_t stream = exec.getStream();
+  if constexpr (is_tensor_view_v<OutType> && is_tensor_view_v<TensorIndexType> &&
+                std::is_arithmetic_v<typename OutType::value_type> &&
+                std::is_same_v<typename TensorIndexType::value_type, index_t>) {
+    if (dest.IsContiguous() && idest.IsContiguous()) {
+      const index_t row_len = TotalSize(dest) == 0 ? 0 : TotalSize(in) / TotalSize(dest);
+      const detail::ReduceRowsArgPolicy<typename OutType::value_type, true> policy{dest.Data(), idest.Data(), row_len};
+      if (detail::reduce_rows_cuda<OutType::Rank()>(policy, in, stream)) {
+        return;
+      }
+    }
+  }
+
   cub_argreduce(dest, idest, in, reduce_params, stream);
 #endif
 }
@@ -887,24 +1393,33 @@ void __MATX_INLINE__ argmax_impl(OutType dest, TensorIndexType &idest, const InT
 template <typename OutType, typename TensorIndexType, typename InType, ThreadsMode MODE>
 void __MATX_INLINE__ argmax_impl(OutType dest, TensorIndexType &idest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("argmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("argmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
+  // The values and indices are found in a single pass and then written to both outputs
+  using V = detail::convert_matx_type_t<typename InType::value_type>;
+  using T = cuda::std::pair<V, index_t>;
+  std::vector<T> found;
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
-    if constexpr (OutType::Rank() == 0) {
-      *lout = static_cast<index_t>(cuda::std::max_element(lin, lin + TotalSize(in)) - lin);
-    }
-    else {
-      const index_t BATCHES = TotalSize(dest);
-      for (index_t b = 0; b < BATCHES; b++) {
-        lout[b] = static_cast<index_t>(cuda::std::max_element(lin + lbegin[b], lin + lend[b]) - lin);
-      }
+    // Ties go to the lower index to match the first max element found by a serial search
+    found = detail::HostReduceRows<OutType::Rank(), T>(exec, TotalSize(in), lin, lbegin, lend,
+      [&](index_t first) { return T{static_cast<V>(lin[first]), first}; },
+      [&](index_t i) { return T{static_cast<V>(lin[i]), i}; },
+      [](const T &a, const T &b) {
+        return (a.first < b.first || (!(b.first < a.first) && b.second < a.second)) ? b : a;
+      });
+
+    for (size_t b = 0; b < found.size(); b++) {
+      lout[static_cast<index_t>(b)] = found[b].second;
     }
   };
-
-  // This could be more efficient by not running two reductions to find the same values, but
-  // for brevity this is faster
   ReduceInput(ft, idest, in);
-  max_impl(dest, in, exec);
+
+  auto store_val = [&]([[maybe_unused]] auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    for (size_t b = 0; b < found.size(); b++) {
+      lout[static_cast<index_t>(b)] = found[b].first;
+    }
+  };
+  ReduceInput(store_val, dest, in);
 }
 
 
@@ -930,9 +1445,15 @@ template <typename OutType, typename InType>
 void __MATX_INLINE__ min_impl(OutType dest, const InType &in, const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("min_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("min_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   cudaStream_t stream = exec.getStream();
+  if constexpr (!is_complex_v<typename OutType::value_type>) {
+    if (detail::reduce_axes_cuda(dest, in, detail::reduceOpMin<typename OutType::value_type>(), stream)) {
+      return;
+    }
+  }
+
   cub_min<OutType, InType>(dest, in, stream);
 #endif
 }
@@ -957,16 +1478,17 @@ void __MATX_INLINE__ min_impl(OutType dest, const InType &in, const cudaExecutor
 template <typename OutType, typename InType, ThreadsMode MODE>
 void __MATX_INLINE__ min_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("min_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("min_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
-    if constexpr (OutType::Rank() == 0) {
-      *lout = *std::min_element(lin, lin + TotalSize(in));
-    }
-    else {
-      const index_t BATCHES = TotalSize(dest);
-      for (index_t b = 0; b < BATCHES; b++) {
-        lout[b] = *std::min_element(lin + lbegin[b], lin + lend[b]);
-      }
+    using T = remove_cvref_t<decltype(lin[0])>;
+    // min is idempotent, so the first element of a batch seeds every accumulator
+    const auto vals = detail::HostReduceRows<OutType::Rank(), T>(exec, TotalSize(in), lin, lbegin, lend,
+      [&](index_t first) { return static_cast<T>(lin[first]); },
+      [&](index_t i) { return static_cast<T>(lin[i]); },
+      [](const T &a, const T &b) { return b < a ? b : a; });
+
+    for (size_t b = 0; b < vals.size(); b++) {
+      lout[static_cast<index_t>(b)] = vals[b];
     }
   };
 
@@ -1000,13 +1522,25 @@ void __MATX_INLINE__ argmin_impl(OutType dest, TensorIndexType &idest, const InT
 {
   static_assert(OutType::Rank() == TensorIndexType::Rank());
 #ifdef __CUDACC__
-  MATX_NVTX_START("argmin_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("argmin_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   const auto initial_value = cuda::std::make_tuple(static_cast<matx::index_t>(-1), std::numeric_limits<typename InType::value_type>::max());
   using reduce_param_type = typename detail::ReduceParams_t<typename detail::CustomArgMinCmp, decltype(initial_value)>;
   auto reduce_params = reduce_param_type{detail::CustomArgMinCmp{}, initial_value};
 
   cudaStream_t stream = exec.getStream();
+  if constexpr (is_tensor_view_v<OutType> && is_tensor_view_v<TensorIndexType> &&
+                std::is_arithmetic_v<typename OutType::value_type> &&
+                std::is_same_v<typename TensorIndexType::value_type, index_t>) {
+    if (dest.IsContiguous() && idest.IsContiguous()) {
+      const index_t row_len = TotalSize(dest) == 0 ? 0 : TotalSize(in) / TotalSize(dest);
+      const detail::ReduceRowsArgPolicy<typename OutType::value_type, false> policy{dest.Data(), idest.Data(), row_len};
+      if (detail::reduce_rows_cuda<OutType::Rank()>(policy, in, stream)) {
+        return;
+      }
+    }
+  }
+
   cub_argreduce(dest, idest, in, reduce_params, stream);
 #endif
 }
@@ -1037,24 +1571,33 @@ void __MATX_INLINE__ argmin_impl(OutType dest, TensorIndexType &idest, const InT
 template <typename OutType, typename TensorIndexType, typename InType, ThreadsMode MODE>
 void __MATX_INLINE__ argmin_impl(OutType dest, TensorIndexType &idest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("argmin_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("argmin_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
+  // The values and indices are found in a single pass and then written to both outputs
+  using V = detail::convert_matx_type_t<typename InType::value_type>;
+  using T = cuda::std::pair<V, index_t>;
+  std::vector<T> found;
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
-    if constexpr (OutType::Rank() == 0) {
-      *lout = static_cast<index_t>(cuda::std::min_element(lin, lin + TotalSize(in)) - lin);
-    }
-    else {
-      const index_t BATCHES = TotalSize(dest);
-      for (index_t b = 0; b < BATCHES; b++) {
-        lout[b] = static_cast<index_t>(cuda::std::min_element(lin + lbegin[b], lin + lend[b]) - lin);
-      }
+    // Ties go to the lower index to match the first min element found by a serial search
+    found = detail::HostReduceRows<OutType::Rank(), T>(exec, TotalSize(in), lin, lbegin, lend,
+      [&](index_t first) { return T{static_cast<V>(lin[first]), first}; },
+      [&](index_t i) { return T{static_cast<V>(lin[i]), i}; },
+      [](const T &a, const T &b) {
+        return (b.first < a.first || (!(a.first < b.first) && b.second < a.second)) ? b : a;
+      });
+
+    for (size_t b = 0; b < found.size(); b++) {
+      lout[static_cast<index_t>(b)] = found[b].second;
     }
   };
-
-  // This could be more efficient by not running two reductions to find the same values, but
-  // for brevity this is faster
   ReduceInput(ft, idest, in);
-  min_impl(dest, in, exec);
+
+  auto store_val = [&]([[maybe_unused]] auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    for (size_t b = 0; b < found.size(); b++) {
+      lout[static_cast<index_t>(b)] = found[b].first;
+    }
+  };
+  ReduceInput(store_val, dest, in);
 }
 
 /**
@@ -1087,7 +1630,7 @@ void __MATX_INLINE__ argminmax_impl(OutType destmin, TensorIndexType &idestmin,
 {
   static_assert(OutType::Rank() == TensorIndexType::Rank());
 #ifdef __CUDACC__
-  MATX_NVTX_START("argminmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("argminmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   const auto initial_value = cuda::std::make_tuple(
     static_cast<matx::index_t>(-1),
@@ -1134,12 +1677,42 @@ template <typename OutType, typename TensorIndexType, typename InType, ThreadsMo
 void __MATX_INLINE__ argminmax_impl(OutType destmin, TensorIndexType &idestmin, OutType destmax, TensorIndexType &idestmax, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
   static_assert(OutType::Rank() == TensorIndexType::Rank());
-  MATX_NVTX_START("argminmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("argminmax_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+
+  // The min and max are tracked together so the input is only read once
+  using V = detail::convert_matx_type_t<typename InType::value_type>;
+  using P = cuda::std::pair<V, index_t>;
+  using T = cuda::std::pair<P, P>;
+  std::vector<T> found;
+  auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    found = detail::HostReduceRows<OutType::Rank(), T>(exec, TotalSize(in), lin, lbegin, lend,
+      [&](index_t first) { return T{P{static_cast<V>(lin[first]), first}, P{static_cast<V>(lin[first]), first}}; },
+      [&](index_t i) { return T{P{static_cast<V>(lin[i]), i}, P{static_cast<V>(lin[i]), i}}; },
+      [](const T &a, const T &b) {
+        const P &mn = (b.first.first < a.first.first ||
+                       (!(a.first.first < b.first.first) && b.first.second < a.first.second)) ? b.first : a.first;
+        const P &mx = (a.second.first < b.second.first ||
+                       (!(b.second.first < a.second.first) && b.second.second < a.second.second)) ? b.second : a.second;
+        return T{mn, mx};
+      });
 
-  // This could be more efficient by not running argmin and argmax separately but
-  // for brevity this is faster
-  argmin_impl(destmin, idestmin, in, exec);
-  argmax_impl(destmax, idestmax, in, exec);
+    for (size_t b = 0; b < found.size(); b++) {
+      lout[static_cast<index_t>(b)] = found[b].first.second;
+    }
+  };
+  ReduceInput(ft, idestmin, in);
+
+  auto store = [&](auto &&lout, auto &&get) {
+    for (size_t b = 0; b < found.size(); b++) {
+      lout[static_cast<index_t>(b)] = get(found[b]);
+    }
+  };
+  ReduceInput([&]([[maybe_unused]] auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    store(lout, [](const T &f) { return f.second.second; }); }, idestmax, in);
+  ReduceInput([&]([[maybe_unused]] auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    store(lout, [](const T &f) { return f.first.first; }); }, destmin, in);
+  ReduceInput([&]([[maybe_unused]] auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
+    store(lout, [](const T &f) { return f.second.first; }); }, destmax, in);
 }
 
 
@@ -1166,7 +1739,7 @@ template <typename OutType, typename InType>
 void __MATX_INLINE__ any_impl(OutType dest, const InType &in, const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("any_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("any_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   cudaStream_t stream = exec.getStream();
   reduce(dest, in, detail::reduceOpAny<typename OutType::value_type>(), stream, true);
 #endif
@@ -1194,20 +1767,17 @@ void __MATX_INLINE__ any_impl(OutType dest, const InType &in, const cudaExecutor
 template <typename OutType, typename InType, ThreadsMode MODE>
 void __MATX_INLINE__ any_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("any_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("any_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
-    if constexpr (OutType::Rank() == 0) {
-      *lout = std::any_of(lin, lin + TotalSize(in), [](typename InType::value_type vin) {
-          return vin != static_cast<typename InType::value_type>(0);
-        });
-    }
-    else {
-      for (index_t b = 0; b < lin.Size(0); b++) {
-        lout[b] = std::any_of(lin + lbegin[b], lin + lend[b], [](typename InType::value_type vin) {
-          return vin != static_cast<typename InType::value_type>(0);
-        });
-      }
+    // The lanes are combined without short-circuiting so the loop stays vectorizable
+    const auto res = detail::HostReduceRows<OutType::Rank(), int>(exec, TotalSize(in), lin, lbegin, lend,
+      [](index_t) { return 0; },
+      [&](index_t i) { return static_cast<int>(static_cast<typename InType::value_type>(lin[i]) != static_cast<typename InType::value_type>(0)); },
+      [](int a, int b) { return a | b; });
+
+    for (size_t b = 0; b < res.size(); b++) {
+      lout[static_cast<index_t>(b)] = res[b] != 0;
     }
   };
 
@@ -1239,7 +1809,7 @@ template <typename OutType, typename InType>
 void __MATX_INLINE__ all_impl(OutType dest, const InType &in, const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("all_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("all_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   cudaStream_t stream = exec.getStream();
   reduce(dest, in, detail::reduceOpAll<typename OutType::value_type>(), stream, true);
 #endif
@@ -1267,20 +1837,17 @@ void __MATX_INLINE__ all_impl(OutType dest, const InType &in, const cudaExecutor
 template <typename OutType, typename InType, ThreadsMode MODE>
 void __MATX_INLINE__ all_impl(OutType dest, const InType &in, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("all_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("all_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   auto ft = [&](auto &&lin, auto &&lout, [[maybe_unused]] auto &&lbegin, [[maybe_unused]] auto &&lend) {
-    if constexpr (OutType::Rank() == 0) {
-      *lout = std::all_of(lin, lin + TotalSize(in), [](typename InType::value_type vin) {
-          return vin != static_cast<typename InType::value_type>(0);
-        });
-    }
-    else {
-      for (index_t b = 0; b < lin.Size(0); b++) {
-        lout[b] = std::all_of(lin + lbegin[b], lin + lend[b], [](typename InType::value_type vin) {
-          return vin != static_cast<typename InType::value_type>(0);
-        });
-      }
+    // The lanes are combined without short-circuiting so the loop stays vectorizable
+    const auto res = detail::HostReduceRows<OutType::Rank(), int>(exec, TotalSize(in), lin, lbegin, lend,
+      [](index_t) { return 1; },
+      [&](index_t i) { return static_cast<int>(static_cast<typename InType::value_type>(lin[i]) != static_cast<typename InType::value_type>(0)); },
+      [](int a, int b) { return a & b; });
+
+    for (size_t b = 0; b < res.size(); b++) {
+      lout[static_cast<index_t>(b)] = res[b] != 0;
     }
   };
 
@@ -1317,7 +1884,7 @@ template <typename OutType, typename InType1, typename InType2>
 void __MATX_INLINE__ allclose(OutType dest, const InType1 &in1, const InType2 &in2, double rtol, double atol, const cudaExecutor &exec)
 {
 #ifdef __CUDACC__
-  MATX_NVTX_START("allclose(" + get_type_str(in1) + ", " + get_type_str(in2) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("allclose(" + get_type_str(in1) + ", " + get_type_str(in2) + ")", matx::MATX_NVTX_LOG_API)
   static_assert(OutType::Rank() == 0, "allclose output must be rank 0");
 
   cudaStream_t stream = exec.getStream();
@@ -1353,7 +1920,7 @@ void __MATX_INLINE__ allclose(OutType dest, const InType1 &in1, const InType2 &i
 template <typename OutType, typename InType1, typename InType2, ThreadsMode MODE>
 void __MATX_INLINE__ allclose(OutType dest, const InType1 &in1, const InType2 &in2, double rtol, double atol, [[maybe_unused]] const HostExecutor<MODE> &exec)
 {
-  MATX_NVTX_START("allclose(" + get_type_str(in1) + ", " + get_type_str(in2) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("allclose(" + get_type_str(in1) + ", " + get_type_str(in2) + ")", matx::MATX_NVTX_LOG_API)
   static_assert(OutType::Rank() == 0, "allclose output must be rank 0");
 
   auto isc = isclose(in1, in2, rtol, atol);
@@ -1400,7 +1967,7 @@ template <typename OutType, typename InType, typename Executor>
 #endif
 void __MATX_INLINE__ var_impl(OutType dest, const InType &in, Executor &&exec, int ddof = 1)
 {
-  MATX_NVTX_START("var_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("var_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   matxMemorySpace_t space;
   using inner_type = typename inner_op_type_t<typename InType::value_type>::type;
 
@@ -1411,6 +1978,20 @@ void __MATX_INLINE__ var_impl(OutType dest, const InType &in, Executor &&exec, i
     space = MATX_HOST_MALLOC_MEMORY;
   }
 
+#ifdef __CUDACC__
+  // Many short rows are reduced in a single pass instead of a mean followed by a sum of squares
+  if constexpr (is_cuda_executor_v<Executor> && is_tensor_view_v<OutType> &&
+                (std::is_same_v<typename OutType::value_type, float> || std::is_same_v<typename OutType::value_type, double>) &&
+                std::is_arithmetic_v<typename InType::value_type>) {
+    if (dest.IsContiguous()) {
+      const detail::ReduceRowsVarPolicy<typename OutType::value_type> policy{dest.Data(), ddof};
+      if (detail::reduce_rows_cuda<OutType::Rank()>(policy, in, exec.getStream())) {
+        return;
+      }
+    }
+  }
+#endif
+
   auto mean_tns = make_tensor<typename InType::value_type>(dest.Descriptor(), space);
   mean_impl(mean_tns, in, exec);
 
@@ -1468,11 +2049,118 @@ template <typename OutType, typename InType, typename Executor>
 #endif
 void __MATX_INLINE__ stdd_impl(OutType dest, InType &&in, Executor &&exec, int ddof = 1)
 {
-  MATX_NVTX_START("stdd_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("stdd_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
   var_impl(dest, in, exec, ddof);
   (dest = sqrt(dest)).run(exec);
 }
 
+/**
+ * Compute the mean, variance, minimum and maximum of an operator in one pass
+ *
+ * All four statistics are produced by a single reduction over the input, with
+ * the variance accumulated using Welford's algorithm. This reads the input once
+ * instead of once per statistic as separate mean(), var(), min() and max()
+ * calls would. The reduction is performed over the difference in ranks between
+ * the input and the outputs.
+ *
+ * @tparam OutType
+ *   Output data type
+ * @tparam InType
+ *   Input data type
+ *
+ * @param dmean
+ *   Destination view of the mean
+ * @param dvar
+ *   Destination view of the variance
+ * @param dmin
+ *   Destination view of the minimum
+ * @param dmax
+ *   Destination view of the maximum
+ * @param in
+ *   Input data to reduce
+ * @param exec
+ *   CUDA executor
+ * @param ddof
+ *   Delta Degrees Of Freedom used in the divisor of the variance as N - ddof
+ */
+template <typename OutType, typename InType>
+void __MATX_INLINE__ stats_impl(OutType dmean, OutType dvar, OutType dmin, OutType dmax, const InType &in,
+                                const cudaExecutor &exec, int ddof = 1)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("stats_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  static_assert(OutType::Rank() < InType::Rank(), "reduction dimensions must be <= Rank of input");
+  using value_type = typename InType::value_type;
+  MATX_STATIC_ASSERT_STR((std::is_same_v<value_type, float> || std::is_same_v<value_type, double>),
+    matxInvalidType, "stats() only supports float and double inputs");
+
+  MATX_ASSERT_STR(dmean.IsContiguous() && dvar.IsContiguous() && dmin.IsContiguous() && dmax.IsContiguous(),
+    matxInvalidParameter, "stats() outputs must be contiguous");
+
+  cudaStream_t stream = exec.getStream();
+  auto count = make_tensor<index_t>(dmean.Shape(), MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  const auto initial_value = cuda::std::make_tuple(
+    static_cast<index_t>(0),
+    static_cast<value_type>(0),
+    static_cast<value_type>(0),
+    std::numeric_limits<value_type>::max(),
+    std::numeric_limits<value_type>::lowest()
+  );
+  using reduce_param_type = typename detail::ReduceParams_t<typename detail::CustomStatsCmp, decltype(initial_value)>;
+  auto reduce_params = reduce_param_type{detail::CustomStatsCmp{}, initial_value};
+
+  // The variance output holds M2 (sum of squared deviations) until it is scaled below
+  cub_stats(count, dmean, dvar, dmin, dmax, in, reduce_params, stream);
+
+  index_t N = 1;
+  for (int i = 1; i <= InType::Rank() - OutType::Rank(); i++) {
+    N *= in.Size(InType::Rank() - i);
+  }
+
+  (dvar = dvar / static_cast<value_type>(N - ddof)).run(stream);
+#endif
+}
+
+/**
+ * Compute the mean, variance, minimum and maximum of an operator
+ *
+ * @tparam OutType
+ *   Output data type
+ * @tparam InType
+ *   Input data type
+ * @tparam MODE
+ *   Host executor threads mode
+ *
+ * @param dmean
+ *   Destination view of the mean
+ * @param dvar
+ *   Destination view of the variance
+ * @param dmin
+ *   Destination view of the minimum
+ * @param dmax
+ *   Destination view of the maximum
+ * @param in
+ *   Input data to reduce
+ * @param exec
+ *   Host executor
+ * @param ddof
+ *   Delta Degrees Of Freedom used in the divisor of the variance as N - ddof
+ */
+template <typename OutType, typename InType, ThreadsMode MODE>
+void __MATX_INLINE__ stats_impl(OutType dmean, OutType dvar, OutType dmin, OutType dmax, const InType &in,
+                                const HostExecutor<MODE> &exec, int ddof = 1)
+{
+  MATX_NVTX_START_CACHED("stats_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+
+  // The host path is not bandwidth bound in the same way, so reuse the
+  // individual reductions
+  mean_impl(dmean, in, exec);
+  var_impl(dvar, in, exec, ddof);
+  min_impl(dmin, in, exec);
+  max_impl(dmax, in, exec);
+}
+
 
 /**
  * Computes the trace of a tensor
@@ -1499,7 +2187,7 @@ template <typename OutType, typename InType, typename Executor>
 #endif
 void __MATX_INLINE__ trace_impl(OutType dest, const InType &in, Executor &&exec)
 {
-  MATX_NVTX_START("trace(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("trace(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
 
   auto d = diag(in);
   sum_impl(dest, d, exec);
@@ -32,27 +32,41 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <numeric>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
 
 #include "matx/core/error.h"
+#include "matx/core/kernel_autotune.h"
+#include "matx/core/make_tensor.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/tensor.h"
 #include "matx/operators/clone.h"
+#include "matx/operators/concat.h"
+#include "matx/operators/slice.h"
 #include "matx/kernels/resample_poly.cuh"
 
 namespace matx {
 namespace detail {
 
-template <typename OutType, typename InType, typename FilterType>
-inline void matxResamplePoly1DInternal(OutType &o, const InType &i,
+enum class ResampleKernel {
+  PhaseBlock,
+  ElemBlock,
+  WarpCentric,
+};
+
+// Launch one resampler kernel with THREADS threads per block. Returns false without launching if
+// the kernel does not support this problem.
+template <int THREADS, typename OutType, typename InType, typename FilterType>
+inline bool matxResamplePoly1DLaunch(ResampleKernel kernel, OutType &o, const InType &i,
                                      const FilterType &filter, index_t up, index_t down,
-                                     cudaStream_t stream)
+                                     index_t up_phase, cudaStream_t stream)
 {
-#ifdef __CUDACC__  
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
-  
+#ifdef __CUDACC__
   using filter_t = typename FilterType::value_type;
   using output_t = typename OutType::value_type;
   using shape_type = typename OutType::shape_type;
@@ -63,7 +77,7 @@ inline void matxResamplePoly1DInternal(OutType &o, const InType &i,
     ((filter_len + 1 + up - 1) / up) :
     ((filter_len + up - 1) / up);
 
-  auto downcast_to_32b_index = [&i, filter_len, up, down]() -> bool {
+  auto downcast_to_32b_index = [&i, filter_len, up, down, up_phase]() -> bool {
       if constexpr (sizeof(index_t) == 4) {
         // The index is already 32 bits
         return false;
@@ -72,36 +86,13 @@ inline void matxResamplePoly1DInternal(OutType &o, const InType &i,
           // + 1 because we may include a zero padded after the last input element
           (i.Size(i.Rank() - 1)+1) * up <= std::numeric_limits<int32_t>::max() &&
           (filter_len+1) <= std::numeric_limits<int32_t>::max() &&
-          down <= std::numeric_limits<int32_t>::max();
+          down <= std::numeric_limits<int32_t>::max() &&
+          up_phase <= std::numeric_limits<int32_t>::max();
       }
   };
 
   const index_t output_len = o.Size(OutType::Rank()-1);
 
-  // We default to the ElemBlock kernel as it tends to work well for general problems.
-  enum class ResampleKernel {
-    PhaseBlock,
-    ElemBlock,
-    WarpCentric,
-  } kernel = ResampleKernel::ElemBlock;
-
-  // The WarpCentric kernel currently uses cg::reduce(), which requires trivially-copyable types.
-  if constexpr (std::is_trivially_copyable_v<output_t>) {
-    // There are a couple cases where a warp-centric resampler tends to be faster:
-    // 1. When we have a small number of output points, handling one or a few points per warp is an effective
-    // way to achieve higher occupancy.
-    // 2. When we have many filter taps per output point, each thread in the warp will be able to read
-    // multiple elements and the warp will tend to achieve coalesced reads. This helps to prevent loop
-    // overhead and barrier stalls from dominating.
-    if (output_len <= 2048 || max_phase_len > 256) {
-      kernel = ResampleKernel::WarpCentric;
-    }
-  }
-
-  // Currently, we select only ElemBlock or WarpCentric to keep things simpler. However, there are some
-  // cases where PhaseBlock is the fastest kernel. If there are specific parameter sets of interest, then
-  // we can benchmark the PhaseBlock method and, if it proves fastest, use that method in those cases.
-
   // Desired number of blocks to reach high occupancy
   constexpr index_t DESIRED_MIN_GRID_SIZE = 8192;
   const int num_batches = static_cast<int>(TotalSize(i)/i.Size(i.Rank() - 1));
@@ -118,8 +109,12 @@ inline void matxResamplePoly1DInternal(OutType &o, const InType &i,
     return (max_outlen_per_cta + cta_comp_unit_count * grid.z - 1) / (cta_comp_unit_count * grid.z);
   };
 
-  constexpr int THREADS = MATX_RESAMPLE_POLY_MAX_NUM_THREADS;
+  static_assert(THREADS <= MATX_RESAMPLE_POLY_MAX_NUM_THREADS);
   if (kernel == ResampleKernel::PhaseBlock) {
+    // PhaseBlock computes the filter phase of each output from its index alone
+    if (up_phase != 0) {
+      return false;
+    }
     const size_t smemBytes = (sizeof(filter_t) * max_phase_len <= MATX_RESAMPLE_POLY_MAX_SMEM_BYTES) ?
       sizeof(filter_t) * max_phase_len : 0;
     const index_t max_output_len_per_phase = (output_len + up - 1) / up;
@@ -140,14 +135,14 @@ inline void matxResamplePoly1DInternal(OutType &o, const InType &i,
     if (downcast_to_32b_index()) {
       ResamplePoly1D_ElemBlock<THREADS, OutType, InType, FilterType, int32_t><<<grid, THREADS, smemBytes, stream>>>(
         o, i, filter, static_cast<int32_t>(up), static_cast<int32_t>(down),
-        static_cast<int32_t>(elems_per_thread));
+        static_cast<int32_t>(elems_per_thread), static_cast<int32_t>(up_phase));
     } else {
       ResamplePoly1D_ElemBlock<THREADS, OutType, InType, FilterType, index_t><<<grid, THREADS, smemBytes, stream>>>(
-        o, i, filter, up, down, elems_per_thread);
+        o, i, filter, up, down, elems_per_thread, up_phase);
     }
   } else {
-    // We only select the WarpCentric kernel for trivially copyable types, but we need this
-    // constexpr if to avoid instantiating the kernel with inappropriate types.
+    // The WarpCentric kernel currently uses cg::reduce(), which requires trivially-copyable types,
+    // so we need this constexpr if to avoid instantiating the kernel with inappropriate types.
     if constexpr (std::is_trivially_copyable_v<output_t>) {
       const size_t filter_sz_bytes = (filter_len % 2 == 0) ? sizeof(filter_t)*(filter_len+1) : sizeof(filter_t)*filter_len;
       const size_t smemBytes = (filter_sz_bytes <= MATX_RESAMPLE_POLY_MAX_SMEM_BYTES) ? filter_sz_bytes : 0;
@@ -156,13 +151,82 @@ inline void matxResamplePoly1DInternal(OutType &o, const InType &i,
       if (downcast_to_32b_index()) {
         ResamplePoly1D_WarpCentric<THREADS, OutType, InType, FilterType, int32_t><<<grid, THREADS, smemBytes, stream>>>(
           o, i, filter, static_cast<int32_t>(up), static_cast<int32_t>(down),
-          static_cast<int32_t>(elems_per_warp));
+          static_cast<int32_t>(elems_per_warp), static_cast<int32_t>(up_phase));
       } else {
         ResamplePoly1D_WarpCentric<THREADS, OutType, InType, FilterType, index_t><<<grid, THREADS, smemBytes, stream>>>(
-          o, i, filter, up, down, elems_per_warp);
+          o, i, filter, up, down, elems_per_warp, up_phase);
       }
+    } else {
+      return false;
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+template <typename OutType, typename InType, typename FilterType>
+inline void matxResamplePoly1DInternal(OutType &o, const InType &i,
+                                     const FilterType &filter, index_t up, index_t down,
+                                     index_t up_phase, cudaStream_t stream)
+{
+#ifdef __CUDACC__  
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  using output_t = typename OutType::value_type;
+
+  constexpr int THREADS = MATX_RESAMPLE_POLY_MAX_NUM_THREADS;
+  constexpr ResampleKernel KERNELS[] = {
+    ResampleKernel::PhaseBlock, ResampleKernel::ElemBlock, ResampleKernel::WarpCentric };
+  constexpr int NUM_KERNELS = static_cast<int>(sizeof(KERNELS) / sizeof(KERNELS[0]));
+
+  // Every kernel is tried with a full and a half-size block. Candidate c uses KERNELS[c / 2] and
+  // the smaller block when c is odd.
+  auto launch = [&](int c) -> bool {
+    if (c % 2 == 0) {
+      return matxResamplePoly1DLaunch<THREADS>(KERNELS[c / 2], o, i, filter, up, down, up_phase, stream);
+    }
+    return matxResamplePoly1DLaunch<THREADS / 2>(KERNELS[c / 2], o, i, filter, up, down, up_phase, stream);
+  };
+
+  const std::string key = "resample_poly_" + std::string(typeid(OutType).name()) + "_" +
+    typeid(InType).name() + "_" + typeid(FilterType).name() + "_" +
+    std::to_string(TotalSize(i)) + "_" + std::to_string(i.Size(InType::Rank()-1)) + "_" +
+    std::to_string(o.Size(OutType::Rank()-1)) + "_" + std::to_string(filter.Size(FilterType::Rank()-1)) + "_" +
+    std::to_string(up) + "_" + std::to_string(down) + "_" + std::to_string(up_phase != 0);
+  const int tuned = KernelAutotuneSelect(key, 2 * NUM_KERNELS, launch, stream);
+  if (tuned >= 0) {
+    launch(tuned);
+    return;
+  }
+
+  const index_t filter_len = filter.Size(FilterType::Rank()-1);
+  const index_t max_phase_len = (filter_len % 2 == 0) ?
+    ((filter_len + 1 + up - 1) / up) :
+    ((filter_len + up - 1) / up);
+  const index_t output_len = o.Size(OutType::Rank()-1);
+
+  // We default to the ElemBlock kernel as it tends to work well for general problems.
+  ResampleKernel kernel = ResampleKernel::ElemBlock;
+
+  // The WarpCentric kernel currently uses cg::reduce(), which requires trivially-copyable types.
+  if constexpr (std::is_trivially_copyable_v<output_t>) {
+    // There are a couple cases where a warp-centric resampler tends to be faster:
+    // 1. When we have a small number of output points, handling one or a few points per warp is an effective
+    // way to achieve higher occupancy.
+    // 2. When we have many filter taps per output point, each thread in the warp will be able to read
+    // multiple elements and the warp will tend to achieve coalesced reads. This helps to prevent loop
+    // overhead and barrier stalls from dominating.
+    if (output_len <= 2048 || max_phase_len > 256) {
+      kernel = ResampleKernel::WarpCentric;
     }
   }
+
+  // Currently, the heuristic selects only ElemBlock or WarpCentric to keep things simpler. There are
+  // some cases where PhaseBlock is the fastest kernel; enable kernel autotuning (SetKernelAutotune)
+  // to benchmark all of the kernels for a given problem.
+  matxResamplePoly1DLaunch<THREADS>(kernel, o, i, filter, up, down, up_phase, stream);
 #endif
 }
 
@@ -185,7 +249,7 @@ inline void matxResamplePoly1DInternal(OutType &o, const InType &i,
 template <typename OutType, typename InType, typename FilterType>
 inline void resample_poly_impl(OutType &out, const InType &in, const FilterType &f,
                    index_t up, index_t down, cudaStream_t stream = 0) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
 
   constexpr int RANK = InType::Rank();
 
@@ -220,7 +284,192 @@ inline void resample_poly_impl(OutType &out, const InType &in, const FilterType
     return;
   }
 
-  matxResamplePoly1DInternal(out, in, f, up, down, stream);
+  matxResamplePoly1DInternal(out, in, f, up, down, 0, stream);
 }
 
+/**
+ * @brief Stateful 1D polyphase resampler for signals that arrive in blocks
+ *
+ * Each call to Process() consumes the next block of input and writes every output sample whose
+ * filter support is fully covered by the input seen so far. The resampler keeps the output phase
+ * and the last ~filter_len / up input samples between calls, so the concatenation of all
+ * Process() outputs followed by Flush() is identical to a single resample_poly() call over the
+ * whole signal. Because the filter is centered on each output, the outputs lag the input by about
+ * filter_len / (2 * down) samples, and the number of outputs per block can vary by one. Use
+ * OutputSize() to query the count before a call.
+ *
+ * The history is read through a concatenated view of the retained samples and the new block, so
+ * the input is never copied to build the overlap. Only the retained samples are copied after each
+ * block, into the idle one of two history buffers.
+ *
+ * @tparam T Input type of the signal
+ * @tparam FilterT Type of the filter taps
+ */
+template <typename T, typename FilterT = T>
+class StreamingResamplePoly {
+public:
+  /**
+   * @brief Create a streaming resampler
+   *
+   * @param filter Rank-1 filter taps
+   * @param up Factor by which to upsample
+   * @param down Factor by which to downsample
+   * @param stream CUDA stream on which to run the kernel(s)
+   */
+  template <typename FilterOp>
+  StreamingResamplePoly(const FilterOp &filter, index_t up, index_t down, cudaStream_t stream = 0) :
+      stream_(stream)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_STATIC_ASSERT(FilterOp::Rank() == 1, matxInvalidDim);
+    MATX_ASSERT_STR(up > 0, matxInvalidParameter, "up must be positive");
+    MATX_ASSERT_STR(down > 0, matxInvalidParameter, "down must be positive");
+    MATX_ASSERT_STR(filter.Size(0) > 0, matxInvalidSize, "resample_poly: filter must not be empty");
+
+    const index_t g = std::gcd(up, down);
+    up_ = up / g;
+    down_ = down / g;
+
+    // Outputs are emitted once their rightmost tap is available, so the leftmost tap of the
+    // next pending output reaches back at most 2 * half upsampled samples.
+    half_ = filter.Size(0) / 2;
+    hist_len_ = std::max(static_cast<index_t>(1), (2 * half_ + up_ - 1) / up_);
+
+    make_tensor(filter_, {filter.Size(0)}, MATX_DEVICE_MEMORY, stream_);
+    (filter_ = filter).run(stream_);
+    for (auto &buf : hist_) {
+      make_tensor(buf, {hist_len_}, MATX_DEVICE_MEMORY, stream_);
+    }
+    Reset();
+  }
+
+  /**
+   * @brief Clear the history so the next block starts a new signal
+   */
+  void Reset()
+  {
+    for (auto &buf : hist_) {
+      (buf = static_cast<T>(0)).run(stream_);
+    }
+    cur_ = 0;
+    in_count_ = 0;
+    out_count_ = 0;
+  }
+
+  /**
+   * @brief Number of outputs the next Process() call produces for a block of in_len samples
+   *
+   * @param in_len Length of the next input block
+   * @returns Number of output samples
+   */
+  index_t OutputSize(index_t in_len) const
+  {
+    if (IsIdentity()) {
+      return in_len;
+    }
+
+    const index_t last = (in_count_ + in_len) * up_ - 1 - half_;
+    const index_t ready = (last < 0) ? 0 : last / down_ + 1;
+    return ready - out_count_;
+  }
+
+  /**
+   * @brief Number of outputs Flush() produces
+   *
+   * @returns Number of output samples
+   */
+  index_t FlushSize() const
+  {
+    if (IsIdentity()) {
+      return 0;
+    }
+
+    const index_t total = (in_count_ * up_ + down_ - 1) / down_;
+    return std::max(static_cast<index_t>(0), total - out_count_);
+  }
+
+  /**
+   * @brief Resample the next block of the signal
+   *
+   * @param out Output with at least OutputSize(in.Size(0)) elements. Only that many are written.
+   * @param in Next input block
+   * @returns Number of output samples written
+   */
+  template <typename OutType, typename InType>
+  index_t Process(OutType &out, const InType &in)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_STATIC_ASSERT(OutType::Rank() == 1 && InType::Rank() == 1, matxInvalidDim);
+
+    const index_t in_len = in.Size(0);
+    const index_t count = OutputSize(in_len);
+    MATX_ASSERT_STR(out.Size(0) >= count, matxInvalidSize, "resample_poly: output block is too small");
+    if (in_len == 0) {
+      return 0;
+    }
+
+    if (IsIdentity()) {
+      (slice(out, {0}, {in_len}) = in).run(stream_);
+      in_count_ += in_len;
+      out_count_ += in_len;
+      return in_len;
+    }
+
+    auto &hist = hist_[cur_];
+    auto &next = hist_[cur_ ^ 1];
+    auto signal = concat(0, hist, in);
+    if (count > 0) {
+      auto o = slice(out, {0}, {count});
+      detail::matxResamplePoly1DInternal(o, signal, filter_, up_, down_, UpPhase(), stream_);
+    }
+
+    (next = slice(signal, {in_len}, {in_len + hist_len_})).run(stream_);
+    cur_ ^= 1;
+    in_count_ += in_len;
+    out_count_ += count;
+    return count;
+  }
+
+  /**
+   * @brief Write the outputs that depend on the zero padding past the end of the signal and reset
+   *
+   * @param out Output with at least FlushSize() elements
+   * @returns Number of output samples written
+   */
+  template <typename OutType>
+  index_t Flush(OutType &out)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+    MATX_STATIC_ASSERT(OutType::Rank() == 1, matxInvalidDim);
+
+    const index_t count = FlushSize();
+    MATX_ASSERT_STR(out.Size(0) >= count, matxInvalidSize, "resample_poly: output block is too small");
+    if (count > 0) {
+      auto o = slice(out, {0}, {count});
+      detail::matxResamplePoly1DInternal(o, hist_[cur_], filter_, up_, down_, UpPhase(), stream_);
+    }
+
+    Reset();
+    return count;
+  }
+
+private:
+  bool IsIdentity() const { return up_ == 1 && down_ == 1; }
+
+  // Offset of the next output in the upsampled history. hist_[cur_](0) holds global input
+  // sample in_count_ - hist_len_, where negative indices are the zero padding before the signal.
+  index_t UpPhase() const { return out_count_ * down_ - (in_count_ - hist_len_) * up_; }
+
+  cudaStream_t stream_;
+  index_t up_;
+  index_t down_;
+  index_t half_;
+  index_t hist_len_;
+  index_t in_count_ = 0;
+  index_t out_count_ = 0;
+  tensor_t<FilterT, 1> filter_;
+  tensor_t<T, 1> hist_[2];
+  int cur_ = 0;
+};
+
 } // end namespace matx
@@ -48,7 +48,7 @@ template <typename OutImageType, typename InitialImageType, typename RangeProfil
 inline void sar_bp_impl(OutImageType &out, const InitialImageType &initial_image, const RangeProfilesType &range_profiles, const PlatPosType &platform_positions,
   const VoxLocType &voxel_locations, const RangeToMcpType &range_to_mcp, const SarBpParams &params, cudaStream_t stream = 0) {
 #ifdef __CUDACC__
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   using image_t = typename OutImageType::value_type;
   using range_profiles_t = typename RangeProfilesType::value_type;
   using plat_pos_t = typename PlatPosType::value_type;
@@ -65,6 +65,11 @@ inline void sar_bp_impl(OutImageType &out, const InitialImageType &initial_image
     MATX_THROW(matxInvalidParameter, "sar_bp: FloatFloat compute type requires phase LUT optimization");
   }
 
+  const bool fltflt_accumulation = has_feature(params.features, SarBpFeature::FloatFloatAccumulation);
+  if (fltflt_accumulation && params.compute_type != SarBpComputeType::FloatFloat) {
+    MATX_THROW(matxInvalidParameter, "sar_bp: FloatFloatAccumulation feature requires the FloatFloat compute type");
+  }
+
   const double dr_inv = 1.0 / params.del_r;
 
   const dim3 block(16, 16);
@@ -93,8 +98,13 @@ inline void sar_bp_impl(OutImageType &out, const InitialImageType &initial_image
     } else if (params.compute_type == SarBpComputeType::FloatFloat) {
       cuda::std::complex<float> *phase_lut = static_cast<cuda::std::complex<float> *>(workspace);
       SarBpFillPhaseLUT<double, float><<<lut_grid, lut_block, 0, stream>>>(phase_lut, params.center_frequency, params.del_r, range_profiles.Size(1));
-      SarBp<SarBpComputeType::FloatFloat, OutImageType, InitialImageType, RangeProfilesType, PlatPosType, VoxLocType, RangeToMcpType, PhaseLUT><<<grid, block, 0, stream>>>(
-        out, initial_image, range_profiles, platform_positions, voxel_locations, range_to_mcp, dr_inv, phase_correction_partial, phase_lut);
+      if (fltflt_accumulation) {
+        SarBp<SarBpComputeType::FloatFloat, OutImageType, InitialImageType, RangeProfilesType, PlatPosType, VoxLocType, RangeToMcpType, PhaseLUT, true><<<grid, block, 0, stream>>>(
+          out, initial_image, range_profiles, platform_positions, voxel_locations, range_to_mcp, dr_inv, phase_correction_partial, phase_lut);
+      } else {
+        SarBp<SarBpComputeType::FloatFloat, OutImageType, InitialImageType, RangeProfilesType, PlatPosType, VoxLocType, RangeToMcpType, PhaseLUT><<<grid, block, 0, stream>>>(
+          out, initial_image, range_profiles, platform_positions, voxel_locations, range_to_mcp, dr_inv, phase_correction_partial, phase_lut);
+      }
     } else {
       cuda::std::complex<float> *phase_lut = static_cast<cuda::std::complex<float> *>(workspace);
       SarBpFillPhaseLUT<float, float><<<lut_grid, lut_block, 0, stream>>>(phase_lut, static_cast<float>(params.center_frequency), static_cast<float>(params.del_r), range_profiles.Size(1));
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/sharded_tensor.h"
+#include "matx/operators/sar_bp.h"
+
+namespace matx {
+namespace experimental {
+
+/**
+ * @brief Incremental SAR backprojection of pulse blocks into a tiled image
+ *
+ * The image and its voxel locations are sharded_tensor_t objects split along the
+ * image rows, and each shard is one tile of the voxel grid. Shards on different
+ * devices spread the image across GPUs; listing the same device several times when
+ * creating the sharded tensors splits the image into tiles on separate streams of
+ * one GPU.
+ *
+ * Accumulate() backprojects one block of pulses into every tile, adding to what the
+ * tile already holds, so pulses can be processed as they arrive and Gather() on the
+ * image returns a partial image at any point after Sync(). Each shard owns two
+ * staging buffers for the pulse data and a copy stream, so the copy of the next block
+ * to a device overlaps the backprojection of the current one. The image should be
+ * zeroed (or hold an initial image) before the first block.
+ *
+ * @tparam ImageT Complex image type
+ * @tparam VoxLocT Voxel location type (float3, float4, double3 or double4)
+ * @tparam RangeProfileT Complex range profile type
+ * @tparam PlatPosT Platform position type (float3, float4, double3 or double4)
+ * @tparam RangeToMcpT Range to motion compensation point type (float or double)
+ */
+template <typename ImageT, typename VoxLocT, typename RangeProfileT, typename PlatPosT, typename RangeToMcpT = double>
+class SarBpAccumulator {
+  static_assert(is_complex_v<ImageT>, "Image must be complex");
+  static_assert(is_complex_v<RangeProfileT>, "Range profiles must be complex");
+  static_assert(std::is_same_v<RangeToMcpT, float> || std::is_same_v<RangeToMcpT, double>,
+                "Range to MCP must be float or double");
+
+  public:
+    /**
+     * @brief Set up the staging buffers for every tile of an image
+     *
+     * @param image Image accumulated into, split by rows across devices or streams
+     * @param voxel_locations Voxel locations with the same shape and split as image
+     * @param max_pulses Largest number of pulses passed to one Accumulate() call
+     * @param num_range_bins Number of range bins per pulse
+     * @param params SAR backprojection parameters
+     */
+    SarBpAccumulator(const sharded_tensor_t<ImageT, 2> &image, const sharded_tensor_t<VoxLocT, 2> &voxel_locations,
+                     index_t max_pulses, index_t num_range_bins, const SarBpParams &params)
+      : image_(image), voxel_locations_(voxel_locations), params_(params), max_pulses_(max_pulses),
+        num_range_bins_(num_range_bins)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      MATX_ASSERT_STR(max_pulses > 0 && num_range_bins > 1, matxInvalidSize,
+                      "SarBpAccumulator: need at least one pulse and two range bins");
+      MATX_ASSERT_STR(image.NumShards() == voxel_locations.NumShards(), matxInvalidParameter,
+                      "SarBpAccumulator: image and voxel locations must have the same number of shards");
+      for (int s = 0; s < image.NumShards(); s++) {
+        MATX_ASSERT_STR(image.Device(s) == voxel_locations.Device(s) &&
+                        image.ShardOffset(s) == voxel_locations.ShardOffset(s) &&
+                        image.Shard(s).Size(0) == voxel_locations.Shard(s).Size(0) &&
+                        image.Shard(s).Size(1) == voxel_locations.Shard(s).Size(1),
+                        matxInvalidSize, "SarBpAccumulator: image and voxel locations must be split the same way");
+      }
+
+      shards_.resize(image.NumShards());
+      for (int s = 0; s < image.NumShards(); s++) {
+        detail::ShardDeviceGuard guard(image.Device(s));
+        auto &sh = shards_[s];
+        MATX_CUDA_CHECK(cudaStreamCreateWithFlags(&sh.copy_stream, cudaStreamNonBlocking));
+        for (int b = 0; b < 2; b++) {
+          MATX_CUDA_CHECK(cudaEventCreateWithFlags(&sh.copied[b], cudaEventDisableTiming));
+          MATX_CUDA_CHECK(cudaEventCreateWithFlags(&sh.done[b], cudaEventDisableTiming));
+          sh.range_profiles[b] = make_tensor<RangeProfileT>({max_pulses, num_range_bins}, MATX_DEVICE_MEMORY);
+          sh.platform_positions[b] = make_tensor<PlatPosT>({max_pulses}, MATX_DEVICE_MEMORY);
+          sh.range_to_mcp[b] = make_tensor<RangeToMcpT>({max_pulses}, MATX_DEVICE_MEMORY);
+        }
+      }
+    }
+
+    ~SarBpAccumulator()
+    {
+      for (int s = 0; s < static_cast<int>(shards_.size()); s++) {
+        detail::ShardDeviceGuard guard(image_.Device(s));
+        auto &sh = shards_[s];
+        cudaStreamSynchronize(image_.Executor(s).getStream());
+        cudaStreamSynchronize(sh.copy_stream);
+        for (int b = 0; b < 2; b++) {
+          cudaEventDestroy(sh.copied[b]);
+          cudaEventDestroy(sh.done[b]);
+        }
+        cudaStreamDestroy(sh.copy_stream);
+      }
+    }
+
+    SarBpAccumulator(const SarBpAccumulator &) = delete;
+    SarBpAccumulator &operator=(const SarBpAccumulator &) = delete;
+
+    /**
+     * @brief Backproject a block of pulses into every tile of the image
+     *
+     * The block is copied to every device and backprojected asynchronously on each
+     * tile's stream. The inputs can be reused as soon as the call returns; device
+     * inputs must be complete before the call.
+     *
+     * @param range_profiles Contiguous num_pulses x num_range_bins tensor in host or device memory
+     * @param platform_positions Contiguous tensor of num_pulses platform positions
+     * @param range_to_mcp Scalar, 0D tensor or contiguous tensor of num_pulses ranges to the MCP
+     */
+    template <typename RangeProfilesType, typename PlatPosType, typename RangeToMcpType>
+    void Accumulate(const RangeProfilesType &range_profiles, const PlatPosType &platform_positions,
+                    const RangeToMcpType &range_to_mcp)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      static_assert(is_tensor_view_v<RangeProfilesType> && is_tensor_view_v<PlatPosType>,
+                    "SarBpAccumulator: range profiles and platform positions must be tensors");
+      static_assert(RangeProfilesType::Rank() == 2 && PlatPosType::Rank() == 1,
+                    "SarBpAccumulator: range profiles must be 2D and platform positions 1D");
+      static_assert(std::is_same_v<typename RangeProfilesType::value_type, RangeProfileT> &&
+                    std::is_same_v<typename PlatPosType::value_type, PlatPosT>,
+                    "SarBpAccumulator: input types must match the accumulator types");
+
+      const index_t pulses = range_profiles.Size(0);
+      MATX_ASSERT_STR(pulses > 0 && pulses <= max_pulses_, matxInvalidSize,
+                      "SarBpAccumulator: pulse block is empty or larger than max_pulses");
+      MATX_ASSERT_STR(range_profiles.Size(1) == num_range_bins_ && platform_positions.Size(0) == pulses,
+                      matxInvalidSize, "SarBpAccumulator: pulse block sizes do not match");
+      MATX_ASSERT_STR(range_profiles.IsContiguous() && platform_positions.IsContiguous(), matxInvalidParameter,
+                      "SarBpAccumulator: range profiles and platform positions must be contiguous");
+
+      const int buf = static_cast<int>(blocks_ % 2);
+      for (int s = 0; s < static_cast<int>(shards_.size()); s++) {
+        detail::ShardDeviceGuard guard(image_.Device(s));
+        auto &sh = shards_[s];
+        const cudaStream_t stream = image_.Executor(s).getStream();
+
+        // The buffer is free once the block that used it two calls ago is done
+        MATX_CUDA_CHECK(cudaStreamWaitEvent(sh.copy_stream, sh.done[buf]));
+        MATX_CUDA_CHECK(cudaMemcpyAsync(sh.range_profiles[buf].Data(), range_profiles.Data(),
+                                        static_cast<size_t>(pulses * num_range_bins_) * sizeof(RangeProfileT),
+                                        cudaMemcpyDefault, sh.copy_stream));
+        MATX_CUDA_CHECK(cudaMemcpyAsync(sh.platform_positions[buf].Data(), platform_positions.Data(),
+                                        static_cast<size_t>(pulses) * sizeof(PlatPosT), cudaMemcpyDefault, sh.copy_stream));
+        if constexpr (is_tensor_view_v<RangeToMcpType>) {
+          static_assert(std::is_same_v<typename RangeToMcpType::value_type, RangeToMcpT>,
+                        "SarBpAccumulator: range to MCP type must match the accumulator type");
+          const index_t n = RangeToMcpType::Rank() == 0 ? 1 : pulses;
+          MATX_CUDA_CHECK(cudaMemcpyAsync(sh.range_to_mcp[buf].Data(), range_to_mcp.Data(),
+                                          static_cast<size_t>(n) * sizeof(RangeToMcpT), cudaMemcpyDefault, sh.copy_stream));
+        }
+        MATX_CUDA_CHECK(cudaEventRecord(sh.copied[buf], sh.copy_stream));
+
+        MATX_CUDA_CHECK(cudaStreamWaitEvent(stream, sh.copied[buf]));
+        auto &img = image_.Shard(s);
+        const auto &vox = voxel_locations_.Shard(s);
+        auto rp = slice(sh.range_profiles[buf], {0, 0}, {pulses, matxEnd});
+        auto pos = slice(sh.platform_positions[buf], {0}, {pulses});
+        if constexpr (!is_tensor_view_v<RangeToMcpType>) {
+          sar_bp_impl(img, img, rp, pos, vox, range_to_mcp, params_, stream);
+        }
+        else if constexpr (RangeToMcpType::Rank() == 0) {
+          auto r2m = make_tensor<RangeToMcpT>(sh.range_to_mcp[buf].Data(), {});
+          sar_bp_impl(img, img, rp, pos, vox, r2m, params_, stream);
+        }
+        else {
+          auto r2m = slice(sh.range_to_mcp[buf], {0}, {pulses});
+          sar_bp_impl(img, img, rp, pos, vox, r2m, params_, stream);
+        }
+        MATX_CUDA_CHECK(cudaEventRecord(sh.done[buf], stream));
+      }
+
+      // Host inputs may be overwritten by the caller once the copies have landed
+      for (int s = 0; s < static_cast<int>(shards_.size()); s++) {
+        detail::ShardDeviceGuard guard(image_.Device(s));
+        MATX_CUDA_CHECK(cudaStreamSynchronize(shards_[s].copy_stream));
+      }
+
+      blocks_++;
+      pulses_ += pulses;
+    }
+
+    /**
+     * @brief Wait for every block accumulated so far
+     */
+    void Sync() const { image_.Sync(); }
+
+    /**
+     * @brief Number of pulses accumulated into the image so far
+     */
+    index_t PulsesProcessed() const { return pulses_; }
+
+  private:
+    struct Shard {
+      cudaStream_t copy_stream{};
+      cudaEvent_t copied[2]{};
+      cudaEvent_t done[2]{};
+      tensor_t<RangeProfileT, 2> range_profiles[2];
+      tensor_t<PlatPosT, 1> platform_positions[2];
+      tensor_t<RangeToMcpT, 1> range_to_mcp[2];
+    };
+
+    sharded_tensor_t<ImageT, 2> image_;
+    sharded_tensor_t<VoxLocT, 2> voxel_locations_;
+    SarBpParams params_;
+    index_t max_pulses_;
+    index_t num_range_bins_;
+    index_t blocks_ = 0;
+    index_t pulses_ = 0;
+    std::vector<Shard> shards_;
+};
+
+} // end namespace experimental
+} // end namespace matx
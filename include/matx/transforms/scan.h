@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <limits>
+
+#include "matx/core/error.h"
+#include "matx/core/iterator.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/operator_options.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/cuda.h"
+#include "matx/executors/host.h"
+#include "matx/kernels/scan.cuh"
+
+namespace matx {
+
+namespace detail {
+
+// Lines at least this long along the last dimension use the look-back scan.
+// Shorter lines are scanned by one thread each.
+static constexpr index_t SCAN_LOOKBACK_MIN_LEN = 256;
+
+template <typename T, typename Func>
+__MATX_INLINE__ void scan_dispatch(ScanFunc func, Func &&f)
+{
+  switch (func) {
+    case ScanFunc::SUM: f(ScanSumOp<T>{}); break;
+    case ScanFunc::PROD: f(ScanProdOp<T>{}); break;
+    case ScanFunc::MIN:
+    case ScanFunc::MAX:
+      if constexpr (is_complex_v<T>) {
+        MATX_THROW(matxInvalidType, "Min and max scans do not support complex types");
+      }
+      else {
+        if (func == ScanFunc::MIN) {
+          f(ScanMinOp<T>{});
+        }
+        else {
+          f(ScanMaxOp<T>{});
+        }
+      }
+      break;
+    default: MATX_THROW(matxInvalidParameter, "Unknown scan operation");
+  }
+}
+
+// Sizes of the input viewed as [outer, len, inner] around the scanned dimension
+template <typename Op>
+__MATX_INLINE__ cuda::std::array<index_t, 3> scan_shape(const Op &a, int dim)
+{
+  MATX_ASSERT_STR(dim >= 0 && dim < Op::Rank(), matxInvalidDim, "scan() dimension out of range");
+  cuda::std::array<index_t, 3> s{1, a.Size(dim), 1};
+  for (int r = 0; r < dim; r++) {
+    s[0] *= a.Size(r);
+  }
+  for (int r = dim + 1; r < Op::Rank(); r++) {
+    s[2] *= a.Size(r);
+  }
+  return s;
+}
+
+template <typename OutputTensor, typename InputOperator>
+__MATX_INLINE__ void scan_check(const OutputTensor &a_out, const InputOperator &a)
+{
+  static_assert(OutputTensor::Rank() == InputOperator::Rank(), "scan() output must have the same rank as the input");
+  for (int r = 0; r < InputOperator::Rank(); r++) {
+    MATX_ASSERT_STR(a_out.Size(r) == a.Size(r), matxInvalidSize, "scan() output must have the same shape as the input");
+  }
+  MATX_ASSERT_STR(a_out.IsContiguous(), matxInvalidParameter, "scan() output must be contiguous");
+}
+
+} // end namespace detail
+
+/**
+ * Scan along any dimension of an operator
+ *
+ * Computes an inclusive or exclusive scan with an associative operator along
+ * dimension dim, with all other dimensions batched into a single launch and
+ * without permuting the input. Long lines along the last dimension use a
+ * single-pass scan with decoupled look-back between tiles. Other dimensions,
+ * and short lines, are scanned by one thread per line with coalesced strided
+ * loads.
+ *
+ * @tparam OutputTensor
+ *   Output tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @param a_out
+ *   Output tensor with the same shape as the input. Must be contiguous
+ * @param a
+ *   Input operator
+ * @param dim
+ *   Dimension to scan along
+ * @param func
+ *   Associative operator of the scan
+ * @param type
+ *   Inclusive or exclusive scan
+ * @param exec
+ *   CUDA executor
+ */
+template <typename OutputTensor, typename InputOperator>
+void scan_impl(OutputTensor &a_out, const InputOperator &a, int dim, ScanFunc func, ScanType type,
+               const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("scan_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename OutputTensor::value_type;
+  detail::scan_check(a_out, a);
+
+  const auto shape = detail::scan_shape(a, dim);
+  const index_t outer = shape[0];
+  const index_t len = shape[1];
+  const index_t inner = shape[2];
+  if (outer * len * inner == 0) {
+    return;
+  }
+
+  cudaStream_t stream = exec.getStream();
+  const bool exclusive = type == ScanType::EXCLUSIVE;
+  const auto in = RandomOperatorIterator{a};
+
+  detail::scan_dispatch<T>(func, [&](auto op) {
+    if constexpr (sizeof(T) % sizeof(unsigned int) == 0) {
+      if (inner == 1 && len >= detail::SCAN_LOOKBACK_MIN_LEN) {
+        constexpr int THREADS = 256;
+        constexpr int ITEMS = sizeof(T) > 8 ? 4 : 8;
+        constexpr index_t TILE = THREADS * ITEMS;
+        const index_t tiles_per_line = (len + TILE - 1) / TILE;
+        const index_t tiles = outer * tiles_per_line;
+        MATX_ASSERT_STR(tiles <= std::numeric_limits<int>::max(), matxInvalidSize, "Too many tiles in scan()");
+
+        // Tile flags and the tile counter share one allocation so a single
+        // memset resets them
+        int *flags = nullptr;
+        T *vals = nullptr;
+        matxAlloc((void **)&flags, (tiles + 1) * sizeof(int), MATX_ASYNC_DEVICE_MEMORY, stream);
+        matxAlloc((void **)&vals, 2 * tiles * sizeof(T), MATX_ASYNC_DEVICE_MEMORY, stream);
+        MATX_CUDA_CHECK(cudaMemsetAsync(flags, 0, (tiles + 1) * sizeof(int), stream));
+
+        detail::scan_lookback_kernel<THREADS, ITEMS, T><<<static_cast<unsigned int>(tiles), THREADS, 0, stream>>>(
+          in, a_out.Data(), len, tiles_per_line, flags, vals, vals + tiles,
+          reinterpret_cast<unsigned int *>(flags + tiles), op, exclusive);
+
+        matxFree(flags, stream);
+        matxFree(vals, stream);
+        return;
+      }
+    }
+
+    constexpr int THREADS = 256;
+    const index_t lines = outer * inner;
+    detail::scan_strided_kernel<T><<<static_cast<unsigned int>((lines + THREADS - 1) / THREADS), THREADS, 0, stream>>>(
+      in, a_out.Data(), outer, len, inner, op, exclusive);
+  });
+#endif
+}
+
+/**
+ * Scan along any dimension of an operator
+ *
+ * @tparam OutputTensor
+ *   Output tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam MODE
+ *   Host executor threads mode
+ * @param a_out
+ *   Output tensor with the same shape as the input. Must be contiguous
+ * @param a
+ *   Input operator
+ * @param dim
+ *   Dimension to scan along
+ * @param func
+ *   Associative operator of the scan
+ * @param type
+ *   Inclusive or exclusive scan
+ * @param exec
+ *   Host executor
+ */
+template <typename OutputTensor, typename InputOperator, ThreadsMode MODE>
+void scan_impl(OutputTensor &a_out, const InputOperator &a, int dim, ScanFunc func, ScanType type,
+               [[maybe_unused]] const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START_CACHED("scan_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename OutputTensor::value_type;
+  detail::scan_check(a_out, a);
+
+  const auto shape = detail::scan_shape(a, dim);
+  const index_t outer = shape[0];
+  const index_t len = shape[1];
+  const index_t inner = shape[2];
+  const bool exclusive = type == ScanType::EXCLUSIVE;
+  const auto in = RandomOperatorIterator{a};
+  T *out = a_out.Data();
+
+  detail::scan_dispatch<T>(func, [&](auto op) {
+    for (index_t o = 0; o < outer; o++) {
+      for (index_t i = 0; i < inner; i++) {
+        T run = op.Init();
+        for (index_t l = 0, off = o * len * inner + i; l < len; l++, off += inner) {
+          const T v = static_cast<T>(in[off]);
+          if (exclusive) {
+            out[off] = run;
+            run = op(run, v);
+          }
+          else {
+            run = op(run, v);
+            out[off] = run;
+          }
+        }
+      }
+    }
+  });
+}
+
+} // end namespace matx
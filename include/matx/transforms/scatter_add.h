@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/type_utils.h"
+#include "matx/kernels/scatter.cuh"
+
+namespace matx {
+namespace detail {
+
+/**
+ * Sum values into the output locations given by an index operator
+ *
+ * out is zeroed and then out(idx(i)) += vals(i) for every i. Indices outside [0, out.Size(0)) are skipped.
+ * On CUDA executors the additions use warp-aggregated atomics, so repeated or sorted indices are combined
+ * within each warp before reaching global memory.
+ *
+ * @param out Rank 1 output tensor
+ * @param vals Rank 1 values to add
+ * @param idx Rank 1 destination indices, the same length as vals
+ * @param exec Executor
+ */
+template <typename OutputTensor, typename ValOp, typename IdxOp, typename Executor>
+void scatter_add_impl(OutputTensor &out, const ValOp &vals, const IdxOp &idx, Executor &&exec)
+{
+  MATX_NVTX_START_CACHED("scatter_add_impl(" + get_type_str(vals) + ")", matx::MATX_NVTX_LOG_API)
+  using out_t = typename OutputTensor::value_type;
+  static_assert(OutputTensor::Rank() == 1 && ValOp::Rank() == 1 && IdxOp::Rank() == 1,
+    "scatter_add() values, indices and output must be rank 1");
+  static_assert(std::is_integral_v<typename IdxOp::value_type>, "scatter_add() indices must be an integral type");
+
+  const index_t n = vals.Size(0);
+  const index_t out_size = out.Size(0);
+  MATX_ASSERT_STR(idx.Size(0) == n, matxInvalidSize, "scatter_add() values and indices must have the same length");
+
+  (out = static_cast<out_t>(0)).run(exec);
+  if (n == 0 || out_size == 0) {
+    return;
+  }
+
+  if constexpr (is_cuda_executor_v<Executor>) {
+#ifdef __CUDACC__
+    static_assert(!is_matx_half_v<out_t> && !is_complex_half_v<out_t>,
+      "scatter_add() does not support half precision on the device");
+    constexpr int THREADS = 256;
+    const auto blocks = static_cast<unsigned int>((n + THREADS - 1) / THREADS);
+    scatter_add_kernel<THREADS><<<blocks, THREADS, 0, exec.getStream()>>>(out, vals, idx, n, out_size);
+    MATX_CUDA_CHECK_LAST_ERROR();
+#endif
+  }
+  else {
+    exec.sync();
+    for (index_t i = 0; i < n; i++) {
+      const auto j = static_cast<index_t>(idx(i));
+      if (j >= 0 && j < out_size) {
+        out(j) += static_cast<out_t>(vals(i));
+      }
+    }
+  }
+}
+
+} // end namespace detail
+} // end namespace matx
@@ -0,0 +1,449 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/cuda.h"
+#include "matx/executors/host.h"
+#include "matx/kernels/segmented.cuh"
+#include "matx/transforms/cub.h"
+
+namespace matx {
+
+namespace detail {
+
+// Average segment length at or below which segmented reductions use one warp
+// per segment instead of cub::DeviceSegmentedReduce
+static constexpr index_t SEGMENTED_WARP_MAX_AVG_LEN = 64;
+
+template <typename InType, typename OffsetType>
+__MATX_INLINE__ index_t segmented_check(const InType &in, const OffsetType &offsets)
+{
+  static_assert(InType::Rank() == 1, "Segmented operations require a rank 1 input");
+  static_assert(OffsetType::Rank() == 1, "Segment offsets must be rank 1");
+  static_assert(std::is_integral_v<typename OffsetType::value_type>, "Segment offsets must be an integral type");
+  MATX_ASSERT_STR(offsets.Size(0) >= 1, matxInvalidSize,
+    "Segment offsets must have at least one entry");
+  MATX_ASSERT_STR(in.Size(0) <= std::numeric_limits<int>::max(), matxInvalidSize,
+    "Segmented operations are limited to 2^31-1 items");
+  return offsets.Size(0) - 1;
+}
+
+/**
+ * Sort keys, and optionally values, within segments with cub::DeviceSegmentedSort
+ *
+ * CUB partitions the segments by size and sorts small and medium segments
+ * in a warp or block, so ragged batches with many short segments do not pay
+ * for a device-wide sort per segment.
+ */
+template <typename KeyType, typename ValueType, typename OffsetType>
+void segmented_sort_pairs_inner(const KeyType *keys_in, KeyType *keys_out,
+                                const ValueType *vals_in, ValueType *vals_out,
+                                index_t num_items, index_t num_segments, const OffsetType &offsets,
+                                SortDirection_t dir, cudaStream_t stream)
+{
+#ifdef __CUDACC__
+  void *d_temp = nullptr;
+  size_t temp_storage_bytes = 0;
+  const auto begin = RandomOperatorIterator{offsets};
+  const auto end = begin + 1;
+
+  auto run = [&]() {
+    if constexpr (std::is_same_v<ValueType, void>) {
+      if (dir == SORT_DIR_ASC) {
+        cub::DeviceSegmentedSort::SortKeys(d_temp, temp_storage_bytes, keys_in, keys_out,
+          static_cast<int>(num_items), static_cast<int>(num_segments), begin, end, stream);
+      }
+      else {
+        cub::DeviceSegmentedSort::SortKeysDescending(d_temp, temp_storage_bytes, keys_in, keys_out,
+          static_cast<int>(num_items), static_cast<int>(num_segments), begin, end, stream);
+      }
+    }
+    else {
+      if (dir == SORT_DIR_ASC) {
+        cub::DeviceSegmentedSort::SortPairs(d_temp, temp_storage_bytes, keys_in, keys_out, vals_in, vals_out,
+          static_cast<int>(num_items), static_cast<int>(num_segments), begin, end, stream);
+      }
+      else {
+        cub::DeviceSegmentedSort::SortPairsDescending(d_temp, temp_storage_bytes, keys_in, keys_out, vals_in, vals_out,
+          static_cast<int>(num_items), static_cast<int>(num_segments), begin, end, stream);
+      }
+    }
+  };
+
+  // First call to get size
+  run();
+  matxAlloc((void **)&d_temp, temp_storage_bytes, MATX_ASYNC_DEVICE_MEMORY, stream);
+  run();
+  matxFree(d_temp, stream);
+#endif
+}
+
+} // end namespace detail
+
+/**
+ * Sort the values of every segment of a ragged input
+ *
+ * Segment s covers elements [offsets(s), offsets(s+1)) of the input, so
+ * offsets has one more entry than there are segments, like the positions
+ * array of a CSR matrix. Elements before offsets(0) or after the last offset
+ * are copied to the output unsorted.
+ *
+ * @tparam OutputTensor
+ *   Output tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @param a_out
+ *   Sorted output, with the same size as the input
+ * @param a
+ *   Input operator
+ * @param offsets
+ *   Segment offsets
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @param exec
+ *   CUDA executor
+ */
+template <typename OutputTensor, typename InputOperator, typename OffsetOperator>
+void segmented_sort_impl(OutputTensor &a_out, const InputOperator &a, const OffsetOperator &offsets,
+                         const SortDirection_t dir, const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("segmented_sort_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename InputOperator::value_type;
+  const index_t num_segments = detail::segmented_check(a, offsets);
+  const index_t n = a.Size(0);
+  MATX_ASSERT_STR(a_out.Size(0) == n, matxInvalidSize, "segmented_sort() output must match the input size");
+  MATX_ASSERT_STR(a_out.IsContiguous(), matxInvalidParameter, "segmented_sort() output must be contiguous");
+
+  cudaStream_t stream = exec.getStream();
+
+  // Sorting needs contiguous keys, so copy the input unless it already is
+  const T *keys_in = nullptr;
+  T *in_ptr = nullptr;
+  if constexpr (is_tensor_view_v<InputOperator>) {
+    if (a.IsContiguous()) {
+      keys_in = a.Data();
+    }
+  }
+  if (keys_in == nullptr) {
+    matxAlloc((void **)&in_ptr, n * sizeof(T), MATX_ASYNC_DEVICE_MEMORY, stream);
+    auto tmp_in = make_tensor<T>(in_ptr, {n});
+    (tmp_in = a).run(exec);
+    keys_in = in_ptr;
+  }
+
+  // Elements outside the segments are not touched by the sort
+  (a_out = a).run(exec);
+
+  detail::segmented_sort_pairs_inner<T, void>(keys_in, a_out.Data(), nullptr, nullptr,
+    n, num_segments, offsets, dir, stream);
+
+  if (in_ptr != nullptr) {
+    matxFree(in_ptr, stream);
+  }
+#endif
+}
+
+/**
+ * Sort the values of every segment of a ragged input
+ *
+ * @tparam OutputTensor
+ *   Output tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @tparam MODE
+ *   Host executor threads mode
+ * @param a_out
+ *   Sorted output, with the same size as the input
+ * @param a
+ *   Input operator
+ * @param offsets
+ *   Segment offsets
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @param exec
+ *   Host executor
+ */
+template <typename OutputTensor, typename InputOperator, typename OffsetOperator, ThreadsMode MODE>
+void segmented_sort_impl(OutputTensor &a_out, const InputOperator &a, const OffsetOperator &offsets,
+                         const SortDirection_t dir, const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START_CACHED("segmented_sort_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename OutputTensor::value_type;
+  const index_t num_segments = detail::segmented_check(a, offsets);
+  MATX_ASSERT_STR(a_out.Size(0) == a.Size(0), matxInvalidSize, "segmented_sort() output must match the input size");
+  MATX_ASSERT_STR(a_out.IsContiguous(), matxInvalidParameter, "segmented_sort() output must be contiguous");
+
+  (a_out = a).run(exec);
+
+  T *data = a_out.Data();
+  for (index_t s = 0; s < num_segments; s++) {
+    const index_t begin = static_cast<index_t>(offsets(s));
+    const index_t end = static_cast<index_t>(offsets(s + 1));
+    if (dir == SORT_DIR_ASC) {
+      std::sort(data + begin, data + end);
+    }
+    else {
+      std::sort(data + begin, data + end, [](const T &x, const T &y) { return y < x; });
+    }
+  }
+}
+
+/**
+ * Compute the indices that sort every segment of a ragged input
+ *
+ * Segment s covers elements [offsets(s), offsets(s+1)) of the input. The
+ * indices are positions in the whole input rather than in the segment, so
+ * they can be used to gather from the input directly. Positions outside the
+ * segments map to themselves.
+ *
+ * @tparam OutputTensor
+ *   Output index tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @param idx_out
+ *   Output indices, with the same size as the input
+ * @param a
+ *   Input operator
+ * @param offsets
+ *   Segment offsets
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @param exec
+ *   CUDA executor
+ */
+template <typename OutputTensor, typename InputOperator, typename OffsetOperator>
+void segmented_argsort_impl(OutputTensor &idx_out, const InputOperator &a, const OffsetOperator &offsets,
+                            const SortDirection_t dir, const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("segmented_argsort_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename InputOperator::value_type;
+  static_assert(std::is_same_v<typename OutputTensor::value_type, index_t>, "segmented_argsort() output must be index_t");
+  const index_t num_segments = detail::segmented_check(a, offsets);
+  const index_t n = a.Size(0);
+  MATX_ASSERT_STR(idx_out.Size(0) == n, matxInvalidSize, "segmented_argsort() output must match the input size");
+  MATX_ASSERT_STR(idx_out.IsContiguous(), matxInvalidParameter, "segmented_argsort() output must be contiguous");
+
+  cudaStream_t stream = exec.getStream();
+
+  T *keys_ptr = nullptr;
+  index_t *idx_in_ptr = nullptr;
+  matxAlloc((void **)&keys_ptr, 2 * n * sizeof(T), MATX_ASYNC_DEVICE_MEMORY, stream);
+  matxAlloc((void **)&idx_in_ptr, n * sizeof(index_t), MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto keys_in = make_tensor<T>(keys_ptr, {n});
+  auto idx_in = make_tensor<index_t>(idx_in_ptr, {n});
+  (keys_in = a).run(exec);
+  (idx_in = range<0>(idx_in.Shape(), 0, 1)).run(exec);
+  (idx_out = idx_in).run(exec);
+
+  detail::segmented_sort_pairs_inner(keys_ptr, keys_ptr + n, idx_in_ptr, idx_out.Data(),
+    n, num_segments, offsets, dir, stream);
+
+  matxFree(keys_ptr, stream);
+  matxFree(idx_in_ptr, stream);
+#endif
+}
+
+/**
+ * Compute the indices that sort every segment of a ragged input
+ *
+ * @tparam OutputTensor
+ *   Output index tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @tparam MODE
+ *   Host executor threads mode
+ * @param idx_out
+ *   Output indices, with the same size as the input
+ * @param a
+ *   Input operator
+ * @param offsets
+ *   Segment offsets
+ * @param dir
+ *   Direction to sort (either SORT_DIR_ASC or SORT_DIR_DESC)
+ * @param exec
+ *   Host executor
+ */
+template <typename OutputTensor, typename InputOperator, typename OffsetOperator, ThreadsMode MODE>
+void segmented_argsort_impl(OutputTensor &idx_out, const InputOperator &a, const OffsetOperator &offsets,
+                            const SortDirection_t dir, [[maybe_unused]] const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START_CACHED("segmented_argsort_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  static_assert(std::is_same_v<typename OutputTensor::value_type, index_t>, "segmented_argsort() output must be index_t");
+  const index_t num_segments = detail::segmented_check(a, offsets);
+  MATX_ASSERT_STR(idx_out.Size(0) == a.Size(0), matxInvalidSize, "segmented_argsort() output must match the input size");
+  MATX_ASSERT_STR(idx_out.IsContiguous(), matxInvalidParameter, "segmented_argsort() output must be contiguous");
+
+  index_t *idx = idx_out.Data();
+  std::iota(idx, idx + a.Size(0), 0);
+  for (index_t s = 0; s < num_segments; s++) {
+    const index_t begin = static_cast<index_t>(offsets(s));
+    const index_t end = static_cast<index_t>(offsets(s + 1));
+    std::stable_sort(idx + begin, idx + end, [&](index_t i, index_t j) {
+      return dir == SORT_DIR_ASC ? a(i) < a(j) : a(j) < a(i);
+    });
+  }
+}
+
+/**
+ * Reduce every segment of a ragged input
+ *
+ * Segment s covers elements [offsets(s), offsets(s+1)) of the input and is
+ * reduced into output s. Empty segments produce op.Init(). When the average
+ * segment is short, each segment is reduced by a single warp. Otherwise
+ * cub::DeviceSegmentedReduce is used.
+ *
+ * @tparam OutputTensor
+ *   Output tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @tparam ReduceOp
+ *   Reduction functor type
+ * @param a_out
+ *   Output, with one entry per segment
+ * @param a
+ *   Input operator
+ * @param offsets
+ *   Segment offsets
+ * @param op
+ *   Reduction functor
+ * @param exec
+ *   CUDA executor
+ */
+template <typename OutputTensor, typename InputOperator, typename OffsetOperator, typename ReduceOp>
+void segmented_reduce_impl(OutputTensor &a_out, const InputOperator &a, const OffsetOperator &offsets,
+                           ReduceOp op, const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("segmented_reduce_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename OutputTensor::value_type;
+  const index_t num_segments = detail::segmented_check(a, offsets);
+  MATX_ASSERT_STR(a_out.Size(0) == num_segments, matxInvalidSize,
+    "Segmented reduction output must have one entry per segment");
+  MATX_ASSERT_STR(a_out.IsContiguous(), matxInvalidParameter, "Segmented reduction output must be contiguous");
+
+  if (num_segments == 0) {
+    return;
+  }
+
+  cudaStream_t stream = exec.getStream();
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (a.Size(0) <= num_segments * detail::SEGMENTED_WARP_MAX_AVG_LEN) {
+      constexpr int THREADS = 256;
+      constexpr int WARPS = THREADS / 32;
+      const index_t blocks = (num_segments + WARPS - 1) / WARPS;
+      detail::segmented_reduce_warp_kernel<THREADS, T><<<static_cast<unsigned int>(blocks), THREADS, 0, stream>>>(
+        a_out.Data(), a, offsets, num_segments, op);
+      return;
+    }
+  }
+
+  void *d_temp = nullptr;
+  size_t temp_storage_bytes = 0;
+  const auto begin = RandomOperatorIterator{offsets};
+  const auto end = begin + 1;
+
+  // First call to get size
+  cub::DeviceSegmentedReduce::Reduce(d_temp, temp_storage_bytes, RandomOperatorIterator{a}, a_out.Data(),
+    static_cast<int>(num_segments), begin, end, op, op.Init(), stream);
+  matxAlloc((void **)&d_temp, temp_storage_bytes, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto err = cub::DeviceSegmentedReduce::Reduce(d_temp, temp_storage_bytes, RandomOperatorIterator{a}, a_out.Data(),
+    static_cast<int>(num_segments), begin, end, op, op.Init(), stream);
+  MATX_ASSERT_STR_EXP(err, cudaSuccess, matxCudaError, "Error in cub::DeviceSegmentedReduce::Reduce");
+  matxFree(d_temp, stream);
+#endif
+}
+
+/**
+ * Reduce every segment of a ragged input
+ *
+ * @tparam OutputTensor
+ *   Output tensor type
+ * @tparam InputOperator
+ *   Input operator type
+ * @tparam OffsetOperator
+ *   Segment offsets type
+ * @tparam ReduceOp
+ *   Reduction functor type
+ * @tparam MODE
+ *   Host executor threads mode
+ * @param a_out
+ *   Output, with one entry per segment
+ * @param a
+ *   Input operator
+ * @param offsets
+ *   Segment offsets
+ * @param op
+ *   Reduction functor
+ * @param exec
+ *   Host executor
+ */
+template <typename OutputTensor, typename InputOperator, typename OffsetOperator, typename ReduceOp, ThreadsMode MODE>
+void segmented_reduce_impl(OutputTensor &a_out, const InputOperator &a, const OffsetOperator &offsets,
+                           ReduceOp op, [[maybe_unused]] const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START_CACHED("segmented_reduce_impl(" + get_type_str(a) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename OutputTensor::value_type;
+  const index_t num_segments = detail::segmented_check(a, offsets);
+  MATX_ASSERT_STR(a_out.Size(0) == num_segments, matxInvalidSize,
+    "Segmented reduction output must have one entry per segment");
+
+  for (index_t s = 0; s < num_segments; s++) {
+    T v = op.Init();
+    for (index_t i = static_cast<index_t>(offsets(s)); i < static_cast<index_t>(offsets(s + 1)); i++) {
+      v = op(v, static_cast<T>(a(i)));
+    }
+    a_out(s) = v;
+  }
+}
+
+} // end namespace matx
@@ -0,0 +1,345 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cusolverDn.h>
+
+#include "matx/core/cache.h"
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/transforms/solver_common.h"
+
+#include <string>
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Parameters needed to execute a dense solve
+ */
+struct DnSolveCUDAParams_t {
+  int64_t n;
+  int64_t nrhs;
+  MatXDataType_t dtype;
+  SolvePrecision precision;
+  bool hpd;
+  cudaExecutor exec;
+};
+
+template <typename T>
+constexpr cusolverPrecType_t IRSMainPrecision()
+{
+  if constexpr (std::is_same_v<T, float>) {
+    return CUSOLVER_R_32F;
+  }
+  else if constexpr (std::is_same_v<T, double>) {
+    return CUSOLVER_R_64F;
+  }
+  else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+    return CUSOLVER_C_32F;
+  }
+  else {
+    return CUSOLVER_C_64F;
+  }
+}
+
+/**
+ * Plan for solving A X = B with a dense square A
+ *
+ * Pointers passed to Exec() are column-major. With SolvePrecision::FULL the system is solved with
+ * Xgetrf and Xgetrs in the input precision, or Xpotrf and Xpotrs when A is Hermitian positive
+ * definite, and the factors are left in A. With SolvePrecision::REFINED cusolverDnIRSXgesv factors A
+ * in TF32 and refines the solution to the input precision. Fallback is enabled, so when refinement
+ * does not converge cuSolver solves the system again in the input precision.
+ */
+template <typename T>
+class matxDnSolveCUDAPlan_t : matxDnCUDASolver_t {
+public:
+  matxDnSolveCUDAPlan_t(const DnSolveCUDAParams_t &p) : params(p)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_STATIC_ASSERT_STR((std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                            std::is_same_v<T, cuda::std::complex<float>> ||
+                            std::is_same_v<T, cuda::std::complex<double>>),
+                           matxInvalidType, "Dense solve supports float, double, and their complex types");
+
+    if (params.precision == SolvePrecision::REFINED) {
+      [[maybe_unused]] cusolverStatus_t ret = cusolverDnIRSParamsCreate(&irs_params);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+      ret = cusolverDnIRSParamsSetSolverPrecisions(irs_params, IRSMainPrecision<T>(),
+                                                   is_complex_v<T> ? CUSOLVER_C_TF32 : CUSOLVER_R_TF32);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+      ret = cusolverDnIRSParamsSetRefinementSolver(irs_params, CUSOLVER_IRS_REFINE_CLASSICAL);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+      ret = cusolverDnIRSParamsEnableFallback(irs_params);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+      ret = cusolverDnIRSInfosCreate(&irs_infos);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+    }
+    else if (!params.hpd) {
+      matxAlloc(reinterpret_cast<void **>(&piv), params.n * sizeof(int64_t), MATX_ASYNC_DEVICE_MEMORY,
+                params.exec.getStream());
+    }
+
+    this->GetWorkspaceSize();
+    this->AllocateWorkspace(1, false, params.exec);
+  }
+
+  void GetWorkspaceSize() override
+  {
+    [[maybe_unused]] cusolverStatus_t ret;
+    if (params.precision == SolvePrecision::REFINED) {
+      ret = cusolverDnIRSXgesv_bufferSize(this->handle, irs_params, static_cast<cusolver_int_t>(params.n),
+                                          static_cast<cusolver_int_t>(params.nrhs), &this->dspace);
+      this->hspace = 0;
+    }
+    else if (params.hpd) {
+      ret = cusolverDnXpotrf_bufferSize(this->handle, this->dn_params, CUBLAS_FILL_MODE_LOWER, params.n,
+                                        MatXTypeToCudaType<T>(), nullptr, params.n,
+                                        MatXTypeToCudaType<T>(), &this->dspace, &this->hspace);
+    }
+    else {
+      ret = cusolverDnXgetrf_bufferSize(this->handle, this->dn_params, params.n, params.n,
+                                        MatXTypeToCudaType<T>(), nullptr, params.n,
+                                        MatXTypeToCudaType<T>(), &this->dspace, &this->hspace);
+    }
+    MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+  }
+
+  /**
+   * Solve the system. a and b may be overwritten.
+   *
+   * @param x Column-major n x nrhs solution
+   * @param a Column-major n x n matrix
+   * @param b Column-major n x nrhs right-hand sides
+   * @param exec CUDA executor
+   */
+  void Exec(T *x, T *a, T *b, const cudaExecutor &exec)
+  {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    const auto stream = exec.getStream();
+    cusolverDnSetStream(this->handle, stream);
+    int h_info = 0;
+
+    if (params.precision == SolvePrecision::REFINED) {
+      const auto n = static_cast<cusolver_int_t>(params.n);
+      cusolver_int_t niters = 0;
+      [[maybe_unused]] auto ret = cusolverDnIRSXgesv(this->handle, irs_params, irs_infos, n,
+                                                     static_cast<cusolver_int_t>(params.nrhs), a, n, b, n, x, n,
+                                                     this->d_workspace, this->dspace, &niters, this->d_info);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+      if (niters < 0) {
+        MATX_LOG_DEBUG("Dense solve: refinement did not converge (niters={}), solved in full precision", niters);
+      }
+    }
+    else if (params.hpd) {
+      [[maybe_unused]] auto ret = cusolverDnXpotrf(
+          this->handle, this->dn_params, CUBLAS_FILL_MODE_LOWER, params.n, MatXTypeToCudaType<T>(), a, params.n,
+          MatXTypeToCudaType<T>(), this->d_workspace, this->dspace, this->h_workspace, this->hspace,
+          this->d_info);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+
+      ret = cusolverDnXpotrs(this->handle, this->dn_params, CUBLAS_FILL_MODE_LOWER, params.n, params.nrhs,
+                             MatXTypeToCudaType<T>(), a, params.n, MatXTypeToCudaType<T>(), b, params.n,
+                             this->d_info);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+
+      cudaMemcpyAsync(x, b, params.n * params.nrhs * sizeof(T), cudaMemcpyDeviceToDevice, stream);
+    }
+    else {
+      [[maybe_unused]] auto ret = cusolverDnXgetrf(
+          this->handle, this->dn_params, params.n, params.n, MatXTypeToCudaType<T>(), a, params.n, piv,
+          MatXTypeToCudaType<T>(), this->d_workspace, this->dspace, this->h_workspace, this->hspace,
+          this->d_info);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+
+      ret = cusolverDnXgetrs(this->handle, this->dn_params, CUBLAS_OP_N, params.n, params.nrhs,
+                             MatXTypeToCudaType<T>(), a, params.n, piv, MatXTypeToCudaType<T>(), b,
+                             params.n, this->d_info);
+      MATX_ASSERT(ret == CUSOLVER_STATUS_SUCCESS, matxSolverError);
+
+      cudaMemcpyAsync(x, b, params.n * params.nrhs * sizeof(T), cudaMemcpyDeviceToDevice, stream);
+    }
+
+    cudaMemcpyAsync(&h_info, this->d_info, sizeof(h_info), cudaMemcpyDeviceToHost, stream);
+    cudaStreamSynchronize(stream);
+
+    if (h_info < 0) {
+      MATX_ASSERT_STR_EXP(h_info, 0, matxSolverError,
+        ("Parameter " + std::to_string(-h_info) + " had an illegal value in the dense solve").c_str());
+    }
+    else if (params.hpd) {
+      MATX_ASSERT_STR_EXP(h_info, 0, matxSolverError,
+        ("The leading minor of order " + std::to_string(h_info) + " is not positive definite in the dense solve").c_str());
+    }
+    else {
+      MATX_ASSERT_STR_EXP(h_info, 0, matxSolverError,
+        ("U is singular: U(" + std::to_string(h_info) + "," + std::to_string(h_info) + ") = 0 in the dense solve").c_str());
+    }
+  }
+
+  ~matxDnSolveCUDAPlan_t()
+  {
+    if (irs_infos != nullptr) {
+      cusolverDnIRSInfosDestroy(irs_infos);
+    }
+    if (irs_params != nullptr) {
+      cusolverDnIRSParamsDestroy(irs_params);
+    }
+    matxFree(piv, cudaStreamDefault);
+  }
+
+private:
+  DnSolveCUDAParams_t params;
+  cusolverDnIRSParams_t irs_params = nullptr;
+  cusolverDnIRSInfos_t irs_infos = nullptr;
+  int64_t *piv = nullptr;
+};
+
+struct DnSolveCUDAParamsKeyHash {
+  std::size_t operator()(const DnSolveCUDAParams_t &k) const noexcept
+  {
+    return (std::hash<uint64_t>()(k.n)) + (std::hash<uint64_t>()(k.nrhs)) +
+           (std::hash<int>()(static_cast<int>(k.precision))) + (std::hash<bool>()(k.hpd)) +
+           (std::hash<uint64_t>()((uint64_t)(k.exec.getStream())));
+  }
+};
+
+struct DnSolveCUDAParamsKeyEq {
+  bool operator()(const DnSolveCUDAParams_t &l, const DnSolveCUDAParams_t &t) const noexcept
+  {
+    return l.n == t.n && l.nrhs == t.nrhs && l.dtype == t.dtype && l.precision == t.precision &&
+           l.hpd == t.hpd && l.exec.getStream() == t.exec.getStream();
+  }
+};
+
+using dense_solve_cuda_cache_t =
+    std::unordered_map<DnSolveCUDAParams_t, std::any, DnSolveCUDAParamsKeyHash, DnSolveCUDAParamsKeyEq>;
+
+/**
+ * Solve column-major A X = B with a cached plan. a is overwritten with its factors when precision
+ * is SolvePrecision::FULL: L and U from getrf, or the lower Cholesky factor when hpd is set.
+ */
+template <typename T>
+void dense_solve_factored(T *x, T *a, T *b, index_t n, index_t nrhs, SolvePrecision precision, bool hpd,
+                          const cudaExecutor &exec)
+{
+  DnSolveCUDAParams_t params;
+  params.n = n;
+  params.nrhs = nrhs;
+  params.dtype = TypeToInt<T>();
+  params.precision = precision;
+  params.hpd = hpd;
+  params.exec = exec;
+
+  using cache_val_type = matxDnSolveCUDAPlan_t<T>;
+  auto cache_id = GetCacheIdFromType<dense_solve_cuda_cache_t>();
+  MATX_LOG_DEBUG("Dense solve transform: cache_id={}", cache_id);
+  GetCache().LookupAndExec<dense_solve_cuda_cache_t>(
+    cache_id,
+    params,
+    [&]() {
+      return std::make_shared<cache_val_type>(params);
+    },
+    [&](std::shared_ptr<cache_val_type> ctype) {
+      ctype->Exec(x, a, b, exec);
+    },
+    exec
+  );
+}
+
+} // end namespace detail
+
+/**
+ * Solve A X^T = B^T for a dense square A
+ *
+ * As with the sparse solve, each right-hand side and solution is one row of B and X. cuSolver is
+ * column-major, so A is copied transposed before factoring, while the rows of B are already the
+ * columns cuSolver expects.
+ *
+ * @tparam OutputTensor
+ *   Output tensor type
+ * @tparam ATensor
+ *   Type of A
+ * @tparam BTensor
+ *   Type of B
+ *
+ * @param out
+ *   Solution, the same shape as B
+ * @param a
+ *   Rank-2 square matrix A
+ * @param b
+ *   Rank-1 right-hand side, or rank-2 with one right-hand side per row
+ * @param exec
+ *   CUDA executor
+ * @param precision
+ *   Arithmetic used by the solve
+ */
+template <typename OutputTensor, typename ATensor, typename BTensor>
+void dense_solve_impl(OutputTensor &&out, const ATensor &a, const BTensor &b,
+                      const cudaExecutor &exec, SolvePrecision precision)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T = typename remove_cvref_t<ATensor>::value_type;
+  constexpr int BRANK = BTensor::Rank();
+  MATX_STATIC_ASSERT_STR(ATensor::Rank() == 2, matxInvalidDim, "Dense solve requires a rank-2 A");
+  MATX_STATIC_ASSERT_STR(BRANK == 1 || BRANK == 2, matxInvalidDim, "Dense solve requires a rank-1 or rank-2 B");
+  MATX_STATIC_ASSERT_STR((std::is_same_v<T, typename BTensor::value_type>), matxInvalidType,
+                         "A and B types must match in dense solve");
+
+  const index_t n = a.Size(1);
+  MATX_ASSERT_STR(a.Size(0) == n, matxInvalidSize, "Dense solve requires a square A");
+  MATX_ASSERT_STR(b.Size(BRANK - 1) == n, matxInvalidSize, "Rows of B must have as many elements as A has columns");
+
+  const auto stream = exec.getStream();
+  auto allocate_tensor = [&](auto shape) {
+    detail::ScratchScope scratch{stream};
+    return make_tensor<T>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  };
+
+  // The row-major transpose of A is A in column-major order
+  auto at = allocate_tensor(cuda::std::array<index_t, 2>{n, n});
+  auto bt = allocate_tensor(Shape(b));
+  auto xt = allocate_tensor(Shape(b));
+  (at = transpose_matrix(a)).run(exec);
+  (bt = b).run(exec);
+
+  detail::dense_solve_factored(xt.Data(), at.Data(), bt.Data(), n, BRANK == 1 ? 1 : b.Size(0), precision, false, exec);
+
+  (out = xt).run(exec);
+}
+
+} // end namespace matx
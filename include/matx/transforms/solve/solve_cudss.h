@@ -57,8 +57,9 @@ struct SolveCUDSSParams_t {
   index_t m;
   index_t n;
   index_t k;
-  // Matrix handles in cuDSS are data specific (unlike e.g. cuBLAS
-  // where the same plan can be shared between different data buffers).
+  // The sparsity pattern buffers identify a cached analysis. The values
+  // of A and the dense B and C are rebound on every call, so a time
+  // stepping loop that only changes values reuses the symbolic phase.
   void *ptrA0;
   void *ptrA1;
   void *ptrA2;
@@ -77,11 +78,13 @@ public:
 
   SolveCUDSSHandle_t(TensorTypeC &c, const TensorTypeA &a, const TensorTypeB &b,
                      cudaStream_t stream) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
     params_ = GetSolveParams(c, a, b, stream);
 
     [[maybe_unused]] cudssStatus_t ret = cudssCreate(&handle_);
     MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
+    ret = cudssSetStream(handle_, stream);
+    MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
 
     // Create cuDSS handle for sparse matrix A.
     static_assert(is_sparse_tensor_v<TensorTypeA>);
@@ -129,6 +132,9 @@ public:
   }
 
   ~SolveCUDSSHandle_t() {
+    cudssMatrixDestroy(matA_);
+    cudssMatrixDestroy(matB_);
+    cudssMatrixDestroy(matC_);
     cudssConfigDestroy(config_);
     cudssDataDestroy(handle_, data_);
     cudssDestroy(handle_);
@@ -160,18 +166,49 @@ public:
     return params;
   }
 
-  __MATX_INLINE__ void Exec([[maybe_unused]] TensorTypeC &c,
-                            [[maybe_unused]] const TensorTypeA &a,
-                            [[maybe_unused]] const TensorTypeB &b) {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
-    // TODO: provide a way to expose these three different steps
-    //       (analysis/factorization/solve) individually to user?
-    [[maybe_unused]] cudssStatus_t ret = cudssExecute(
-        handle_, CUDSS_PHASE_ANALYSIS, config_, data_, matA_, matC_, matB_);
-    MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
-    ret = cudssExecute(handle_, CUDSS_PHASE_FACTORIZATION, config_, data_,
-                       matA_, matC_, matB_);
-    MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
+  /**
+   * Solve with the cached analysis. The first call runs the analysis and
+   * factorization. Later calls only refactorize, or skip the numeric phase
+   * entirely when refactor is false and A still points at the same values.
+   */
+  __MATX_INLINE__ void Exec(TensorTypeC &c, const TensorTypeA &a,
+                            const TensorTypeB &b, bool refactor) {
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
+    [[maybe_unused]] cudssStatus_t ret;
+
+    // Rebind the data buffers, which are not part of the cache key.
+    bool new_values = false;
+    if (a.Data() != params_.ptrA0) {
+      params_.ptrA0 = a.Data();
+      ret = cudssMatrixSetValues(matA_, params_.ptrA0);
+      MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
+      new_values = true;
+    }
+    if (b.Data() != params_.ptrB) {
+      params_.ptrB = b.Data();
+      ret = cudssMatrixSetValues(matB_, params_.ptrB);
+      MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
+    }
+    if (c.Data() != params_.ptrC) {
+      params_.ptrC = c.Data();
+      ret = cudssMatrixSetValues(matC_, params_.ptrC);
+      MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
+    }
+
+    if (!analyzed_) {
+      ret = cudssExecute(handle_, CUDSS_PHASE_ANALYSIS, config_, data_, matA_,
+                         matC_, matB_);
+      MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
+      ret = cudssExecute(handle_, CUDSS_PHASE_FACTORIZATION, config_, data_,
+                         matA_, matC_, matB_);
+      MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
+      analyzed_ = true;
+    } else if (refactor || new_values) {
+      ret = cudssExecute(handle_, CUDSS_PHASE_REFACTORIZATION, config_, data_,
+                         matA_, matC_, matB_);
+      MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
+    }
+
     ret = cudssExecute(handle_, CUDSS_PHASE_SOLVE, config_, data_, matA_, matC_,
                        matB_);
     MATX_ASSERT(ret == CUDSS_STATUS_SUCCESS, matxSolverError);
@@ -185,6 +222,7 @@ private:
   cudssMatrix_t matB_ = nullptr;
   cudssMatrix_t matC_ = nullptr;
   detail::SolveCUDSSParams_t params_;
+  bool analyzed_ = false;
 };
 
 /**
@@ -194,9 +232,9 @@ private:
  */
 struct SolveCUDSSParamsKeyHash {
   std::size_t operator()(const SolveCUDSSParams_t &k) const noexcept {
-    return std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA0)) +
-           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrB)) +
-           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrC)) +
+    return std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA2)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA4)) +
+           std::hash<uint64_t>()(static_cast<uint64_t>(k.n)) +
            std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.stream));
   }
 };
@@ -204,15 +242,16 @@ struct SolveCUDSSParamsKeyHash {
 /**
  * Test SOLVE parameters for equality. Unlike the hash, all parameters must
  * match exactly to ensure the hashed kernel can be reused for the computation.
+ * The value buffers of A, B and C are deliberately excluded, since the handle
+ * rebinds them on every call.
  */
 struct SolveCUDSSParamsKeyEq {
   bool operator()(const SolveCUDSSParams_t &l,
                   const SolveCUDSSParams_t &t) const noexcept {
     return l.dtype == t.dtype && l.ptype == t.ptype && l.ctype == t.ctype &&
            l.stream == t.stream && l.nse == t.nse && l.m == t.m && l.n == t.n &&
-           l.k == t.k && l.ptrA0 == t.ptrA0 && l.ptrA1 == t.ptrA1 &&
-           l.ptrA2 == t.ptrA2 && l.ptrA3 == t.ptrA3 && l.ptrA4 == t.ptrA4 &&
-           l.ptrB == t.ptrB && l.ptrC == t.ptrC;
+           l.k == t.k && l.ptrA1 == t.ptrA1 && l.ptrA2 == t.ptrA2 &&
+           l.ptrA3 == t.ptrA3 && l.ptrA4 == t.ptrA4;
   }
 };
 
@@ -237,8 +276,9 @@ __MATX_INLINE__ auto getSolveSupportedTensor(const Op &in,
 
 template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
 void sparse_solve_impl(TensorTypeC &C, const TensorTypeA &a,
-                       const TensorTypeB &B, const cudaExecutor &exec) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+                       const TensorTypeB &B, const cudaExecutor &exec,
+                       bool refactor = true) {
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   // Transform into supported form.
@@ -292,7 +332,7 @@ void sparse_solve_impl(TensorTypeC &C, const TensorTypeA &a,
       cache_id, params,
       [&]() { return std::make_shared<cache_val_type>(c, a, b, stream); },
       [&](std::shared_ptr<cache_val_type> cache_type) {
-        cache_type->Exec(c, a, b);
+        cache_type->Exec(c, a, b, refactor);
       },
       exec);
 
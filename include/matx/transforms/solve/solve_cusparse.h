@@ -161,7 +161,7 @@ __MATX_INLINE__ auto getCuSparseSolveSupportedTensor(const Op &in,
 template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
 void sparse_dia_solve_impl(TensorTypeC &C, const TensorTypeA &a,
                            const TensorTypeB &B, const cudaExecutor &exec) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   // Transform into supported form.
@@ -232,7 +232,7 @@ template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
 void sparse_batched_dia_solve_impl(TensorTypeC &C, const TensorTypeA &a,
                                    const TensorTypeB &B,
                                    const cudaExecutor &exec) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   const auto stream = exec.getStream();
 
   // Transform into supported form.
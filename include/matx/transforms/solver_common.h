@@ -32,6 +32,10 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
+#include "matx/executors/host.h"
+
 namespace matx {
 
 #ifdef MATX_EN_NVPL
@@ -139,7 +143,7 @@ enum class BatchType {
 template <BatchType BTYPE, typename TensorType, typename PointerType = typename TensorType::value_type>
 __MATX_INLINE__ void SetBatchPointers(const TensorType &a, std::vector<PointerType *> &batch_ptrs)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
   batch_ptrs.clear();
 
@@ -188,7 +192,7 @@ class matxDnCUDASolver_t {
 public:
   matxDnCUDASolver_t()
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     [[maybe_unused]] cusolverStatus_t  ret;
     ret = cusolverDnCreate(&handle);
@@ -275,7 +279,7 @@ class matxDnHostSolver_t {
 public:
   matxDnHostSolver_t()
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   }
 
   virtual ~matxDnHostSolver_t()
@@ -283,6 +287,12 @@ public:
     matxFree(work);
     matxFree(rwork);
     matxFree(iwork);
+
+    for (auto &ws : slot_workspaces) {
+      matxFree(ws[0]);
+      matxFree(ws[1]);
+      matxFree(ws[2]);
+    }
   }
 
   void AllocateWorkspace([[maybe_unused]] size_t batches)
@@ -305,6 +315,75 @@ public:
   virtual void GetWorkspaceSize() {};
 
 protected:
+  /**
+   * Run fn(batch, work, rwork, iwork) for every batch and return the info code of the first batch
+   * that failed, or 0.
+   *
+   * With a multi-threaded executor and more than one batch, the batches are split into one
+   * contiguous range per thread. The first range uses the plan's workspace and every other range
+   * gets its own copy, allocated the first time the plan runs that wide. Each LAPACK call is then
+   * limited to one thread so the library and the executor do not oversubscribe the cores. Errors
+   * are reported after every range has finished, since exceptions cannot leave the worker threads.
+   */
+  template <ThreadsMode MODE, typename Func>
+  lapack_int_t ExecBatches(const HostExecutor<MODE> &exec, const Func &fn)
+  {
+    const size_t batches = batch_a_ptrs.size();
+    const size_t slots = cuda::std::min(batches, static_cast<size_t>(cuda::std::max(exec.GetNumThreads(), 1)));
+
+    if (slots <= 1) {
+#ifdef MATX_EN_NVPL
+      nvpl_lapack_set_num_threads_local(exec.GetNumThreads());
+#endif
+      for (size_t i = 0; i < batches; i++) {
+        const lapack_int_t info = fn(i, work, rwork, iwork);
+        if (info != 0) {
+          return info;
+        }
+      }
+
+      return 0;
+    }
+
+    while (slot_workspaces.size() < slots - 1) {
+      std::array<void *, 3> ws{nullptr, nullptr, nullptr};
+      if (lwork > 0) {
+        matxAlloc(&ws[0], lwork * sizeof(ValueType), MATX_HOST_MALLOC_MEMORY);
+      }
+      if (lrwork > 0) {
+        matxAlloc(&ws[1], lrwork * sizeof(typename inner_op_type_t<ValueType>::type), MATX_HOST_MALLOC_MEMORY);
+      }
+      if (liwork > 0) {
+        matxAlloc(&ws[2], liwork * sizeof(lapack_int_t), MATX_HOST_MALLOC_MEMORY);
+      }
+      slot_workspaces.push_back(ws);
+    }
+
+    std::vector<lapack_int_t> infos(batches, 0);
+    const size_t per_slot = (batches + slots - 1) / slots;
+    exec.ParallelFor(static_cast<index_t>(slots), [&](index_t slot_idx) {
+#ifdef MATX_EN_NVPL
+      nvpl_lapack_set_num_threads_local(1);
+#endif
+      const auto slot = static_cast<size_t>(slot_idx);
+      void *w = slot == 0 ? work : slot_workspaces[slot - 1][0];
+      void *rw = slot == 0 ? rwork : slot_workspaces[slot - 1][1];
+      void *iw = slot == 0 ? iwork : slot_workspaces[slot - 1][2];
+      const size_t end = cuda::std::min(batches, (slot + 1) * per_slot);
+      for (size_t i = slot * per_slot; i < end; i++) {
+        infos[i] = fn(i, w, rw, iw);
+      }
+    });
+
+    for (const auto info : infos) {
+      if (info != 0) {
+        return info;
+      }
+    }
+
+    return 0;
+  }
+
   std::vector<void *> batch_a_ptrs;
   void *work = nullptr;  // work array of input type
   void *rwork = nullptr; // real valued work array
@@ -312,6 +391,7 @@ protected:
   lapack_int_t lwork = -1;
   lapack_int_t lrwork = -1;
   lapack_int_t liwork = -1;
+  std::vector<std::array<void *, 3>> slot_workspaces; // work, rwork, iwork for each extra batch range
 };
 #endif
 
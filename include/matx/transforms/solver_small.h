@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/operator_options.h"
+#include "matx/core/type_utils.h"
+#include "matx/kernels/small_solver.cuh"
+
+#include <algorithm>
+
+namespace matx {
+
+namespace detail {
+
+// Batched square matrices up to this size are inverted, factored or reduced by
+// the warp-per-matrix kernels in small_solver.cuh rather than by cuBLAS/cuSolver.
+// Since all work happens in shared memory with one launch for the whole batch,
+// this is much faster for the large batches of tiny systems common in adaptive
+// beamforming, where the batched library calls are dominated by overhead.
+static constexpr index_t SMALL_SOLVER_MAX_N = 32;
+
+template <typename T>
+__MATX_INLINE__ bool UseSmallSolver(index_t n, size_t batches)
+{
+  return !is_half_v<T> && batches > 1 && n <= SMALL_SOLVER_MAX_N;
+}
+
+// Picks the number of matrices per block such that their shared memory stays
+// within the default 48KB limit, with at most 8 warps per block.
+__MATX_INLINE__ void SmallSolverLaunchDims(size_t warp_bytes, size_t batches,
+                                           uint32_t &blocks, uint32_t &threads, size_t &shm)
+{
+  const size_t warps = std::clamp<size_t>((48 * 1024) / warp_bytes, 1, 8);
+  blocks = static_cast<uint32_t>((batches + warps - 1) / warps);
+  threads = static_cast<uint32_t>(warps * 32);
+  shm = warps * warp_bytes;
+}
+
+/**
+ * Invert a batch of contiguous n x n matrices with n <= SMALL_SOLVER_MAX_N.
+ * info must hold one entry per matrix and is set to nonzero for singular ones.
+ * A and A_inv may be the same pointer.
+ */
+template <typename T>
+void small_inv_impl([[maybe_unused]] T *a_inv, [[maybe_unused]] const T *a, [[maybe_unused]] int *info,
+                    [[maybe_unused]] index_t n, [[maybe_unused]] size_t batches, [[maybe_unused]] cudaStream_t stream)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  uint32_t blocks, threads;
+  size_t shm;
+  SmallSolverLaunchDims((2 * n * n + n) * sizeof(T), batches, blocks, threads, shm);
+  small_inv_kernel<<<blocks, threads, shm, stream>>>(a, a_inv, info,
+      static_cast<index_t>(batches), static_cast<int>(n));
+#endif
+}
+
+/**
+ * Cholesky-factor a batch of contiguous n x n matrices in place with
+ * n <= SMALL_SOLVER_MAX_N. uplo refers to the row-major layout of MatX. info
+ * must hold one entry per matrix and is set to nonzero for matrices that are
+ * not positive definite.
+ */
+template <typename T>
+void small_chol_impl([[maybe_unused]] T *a, [[maybe_unused]] int *info, [[maybe_unused]] index_t n,
+                     [[maybe_unused]] size_t batches, [[maybe_unused]] SolverFillMode uplo,
+                     [[maybe_unused]] cudaStream_t stream)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  uint32_t blocks, threads;
+  size_t shm;
+  SmallSolverLaunchDims(n * n * sizeof(T), batches, blocks, threads, shm);
+  small_chol_kernel<<<blocks, threads, shm, stream>>>(a, info,
+      static_cast<index_t>(batches), static_cast<int>(n), uplo == SolverFillMode::UPPER);
+#endif
+}
+
+/**
+ * Compute the determinants of a batch of contiguous n x n matrices with
+ * n <= SMALL_SOLVER_MAX_N into the contiguous vector det.
+ */
+template <typename T>
+void small_det_impl([[maybe_unused]] T *det, [[maybe_unused]] const T *a, [[maybe_unused]] index_t n,
+                    [[maybe_unused]] size_t batches, [[maybe_unused]] cudaStream_t stream)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  uint32_t blocks, threads;
+  size_t shm;
+  SmallSolverLaunchDims((n * n + n) * sizeof(T), batches, blocks, threads, shm);
+  small_det_kernel<<<blocks, threads, shm, stream>>>(a, det,
+      static_cast<index_t>(batches), static_cast<int>(n));
+#endif
+}
+
+} // end namespace detail
+
+} // end namespace matx
@@ -0,0 +1,385 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/core/type_utils.h"
+#include "matx/transforms/fft/fft_cuda.h"
+
+namespace matx {
+namespace detail {
+
+template <typename T>
+using stft_complex_t = cuda::std::conditional_t<is_complex_v<T>, T, cuda::std::complex<T>>;
+
+/**
+ * Number of STFT frames of win_len samples, hop samples apart, that fit in n samples
+ */
+__MATX_INLINE__ index_t stft_num_frames(index_t n, index_t win_len, index_t hop)
+{
+  return n < win_len ? 0 : (n - win_len) / hop + 1;
+}
+
+/**
+ * Windowed, zero-padded STFT frames of a signal, computed on the fly
+ *
+ * Element (..., f, k) is x(..., f * hop + k) * w(k) for k < win_len and zero for the padding up to
+ * nfft. Leading dimensions of x are independent channels. Real signals are promoted to complex so the
+ * frames can feed a C2C FFT, and the operator is JIT-able so it can be compiled into a cuFFT load
+ * callback instead of materializing the overlapping frames.
+ */
+template <typename XOp, typename WOp>
+class StftFrameOp : public BaseOp<StftFrameOp<XOp, WOp>> {
+private:
+  typename detail::base_type_t<XOp> x_;
+  typename detail::base_type_t<WOp> w_;
+  index_t nfft_;
+  index_t hop_;
+  index_t frames_;
+
+  static constexpr int XRANK = XOp::Rank();
+
+public:
+  using matxop = bool;
+  using value_type = stft_complex_t<typename XOp::value_type>;
+
+#ifdef MATX_EN_JIT
+  struct JIT_Storage {
+    typename detail::inner_storage_or_self_t<detail::base_type_t<XOp>> x_;
+    typename detail::inner_storage_or_self_t<detail::base_type_t<WOp>> w_;
+  };
+
+  JIT_Storage ToJITStorage() const {
+    return JIT_Storage{detail::to_jit_storage(x_), detail::to_jit_storage(w_)};
+  }
+
+  __MATX_INLINE__ std::string get_jit_class_name() const {
+    return std::format("JITStftFrame_r{}_n{}_h{}_w{}", Rank(), nfft_, hop_, w_.Size(0));
+  }
+
+  __MATX_INLINE__ auto get_jit_op_str() const {
+    const std::string func_name = get_jit_class_name();
+    cuda::std::array<index_t, Rank()> out_dims_;
+    for (int i = 0; i < Rank(); ++i) {
+      out_dims_[i] = Size(i);
+    }
+
+    return cuda::std::make_tuple(
+      func_name,
+      std::format("template <typename XT, typename WT> struct {} {{\n"
+          "  using value_type = {};\n"
+          "  using matxop = bool;\n"
+          "  constexpr static int Rank_ = {};\n"
+          "  constexpr static index_t hop_ = {};\n"
+          "  constexpr static index_t win_len_ = {};\n"
+          "  constexpr static cuda::std::array<index_t, Rank_> out_dims_ = {{ {} }};\n"
+          "  typename detail::inner_storage_or_self_t<detail::base_type_t<XT>> x_;\n"
+          "  typename detail::inner_storage_or_self_t<detail::base_type_t<WT>> w_;\n"
+          "  template <typename CapType, typename... Is>\n"
+          "  __MATX_INLINE__ __MATX_DEVICE__ value_type operator()(Is... indices) const\n"
+          "  {{\n"
+          "    const cuda::std::array<index_t, Rank_> idx{{indices...}};\n"
+          "    const index_t k = idx[Rank_ - 1];\n"
+          "    if (k >= win_len_) {{\n"
+          "      return value_type{{0}};\n"
+          "    }}\n"
+          "    cuda::std::array<index_t, Rank_ - 1> xidx;\n"
+          "    for (int r = 0; r < Rank_ - 2; r++) {{\n"
+          "      xidx[r] = idx[r];\n"
+          "    }}\n"
+          "    xidx[Rank_ - 2] = idx[Rank_ - 2] * hop_ + k;\n"
+          "    return static_cast<value_type>(value_type(get_value<CapType>(x_, xidx)) * w_.template operator()<CapType>(k));\n"
+          "  }}\n"
+          "  static __MATX_INLINE__ constexpr __MATX_DEVICE__ int32_t Rank() {{ return Rank_; }}\n"
+          "  constexpr __MATX_INLINE__ __MATX_DEVICE__ index_t Size(int dim) const {{ return out_dims_[dim]; }}\n"
+          "}};\n",
+          func_name, detail::type_to_string<value_type>(), Rank(), hop_, w_.Size(0), detail::array_to_string(out_dims_))
+    );
+  }
+#endif
+
+  __MATX_INLINE__ std::string str() const { return "stft_frames(" + get_type_str(x_) + "," + get_type_str(w_) + ")"; }
+
+  StftFrameOp(const XOp &x, const WOp &w, index_t nfft, index_t hop) :
+      x_(x), w_(w), nfft_(nfft), hop_(hop), frames_(stft_num_frames(x.Size(XRANK - 1), w.Size(0), hop))
+  {
+  }
+
+  template <typename CapType, typename... Is>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(Is... indices) const
+  {
+    if constexpr (CapType::ept == ElementsPerThread::ONE) {
+      const cuda::std::array<index_t, Rank()> idx{indices...};
+      const index_t k = idx[Rank() - 1];
+      if (k >= w_.Size(0)) {
+        return value_type{0};
+      }
+
+      cuda::std::array<index_t, XRANK> xidx;
+      for (int r = 0; r < XRANK - 1; r++) {
+        xidx[r] = idx[r];
+      }
+      xidx[XRANK - 1] = idx[Rank() - 2] * hop_ + k;
+      return static_cast<value_type>(value_type(get_value<CapType>(x_, xidx)) * w_.template operator()<CapType>(k));
+    }
+    else {
+      return value_type{0};
+    }
+  }
+
+  template <typename... Is>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(Is... indices) const
+  {
+    return this->template operator()<DefaultCapabilities>(indices...);
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const noexcept
+  {
+    if (dim == Rank() - 1) {
+      return nfft_;
+    }
+    if (dim == Rank() - 2) {
+      return frames_;
+    }
+    return x_.Size(dim);
+  }
+
+  static inline constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+  {
+    return XRANK + 1;
+  }
+
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+    if constexpr (Cap == OperatorCapability::JIT_TYPE_QUERY) {
+#ifdef MATX_EN_JIT
+      const auto x_jit_name = detail::get_operator_capability<Cap>(x_, in);
+      const auto w_jit_name = detail::get_operator_capability<Cap>(w_, in);
+      return std::format("{}<{},{}>", get_jit_class_name(), x_jit_name, w_jit_name);
+#else
+      return "";
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+#ifdef MATX_EN_JIT
+      return combine_capabilities<Cap>(true,
+          detail::get_operator_capability<Cap>(x_, in),
+          detail::get_operator_capability<Cap>(w_, in));
+#else
+      return false;
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::JIT_CLASS_QUERY) {
+#ifdef MATX_EN_JIT
+      const auto [key, value] = get_jit_op_str();
+      if (in.find(key) == in.end()) {
+        in[key] = value;
+      }
+      detail::get_operator_capability<Cap>(x_, in);
+      detail::get_operator_capability<Cap>(w_, in);
+      return true;
+#else
+      return false;
+#endif
+    }
+    else if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+      const auto my_cap = cuda::std::array<ElementsPerThread, 2>{ElementsPerThread::ONE, ElementsPerThread::ONE};
+      return combine_capabilities<Cap>(my_cap,
+          detail::get_operator_capability<Cap>(x_, in),
+          detail::get_operator_capability<Cap>(w_, in));
+    }
+    else {
+      auto self_has_cap = capability_attributes<Cap>::default_value;
+      return combine_capabilities<Cap>(self_has_cap,
+          detail::get_operator_capability<Cap>(x_, in),
+          detail::get_operator_capability<Cap>(w_, in));
+    }
+  }
+};
+
+/**
+ * Weighted overlap-add of inverse-transformed STFT frames
+ *
+ * Output sample (..., n) sums frames(..., f, n - f * hop) * w(n - f * hop) over every frame covering n,
+ * divided by the sum of w^2 over the same frames. This inverts StftFrameOp followed by an FFT whenever
+ * the window's squared overlap-add is nonzero.
+ */
+template <typename FOp, typename WOp>
+class IstftOverlapAddOp : public BaseOp<IstftOverlapAddOp<FOp, WOp>> {
+private:
+  typename detail::base_type_t<FOp> frames_;
+  typename detail::base_type_t<WOp> w_;
+  index_t hop_;
+
+  static constexpr int FRANK = FOp::Rank();
+
+public:
+  using matxop = bool;
+  using value_type = typename FOp::value_type;
+
+  __MATX_INLINE__ std::string str() const { return "istft_ola(" + get_type_str(frames_) + "," + get_type_str(w_) + ")"; }
+
+  IstftOverlapAddOp(const FOp &frames, const WOp &w, index_t hop) : frames_(frames), w_(w), hop_(hop)
+  {
+  }
+
+  template <typename CapType, typename... Is>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(Is... indices) const
+  {
+    if constexpr (CapType::ept == ElementsPerThread::ONE) {
+      using scalar_type = typename value_type::value_type;
+      const cuda::std::array<index_t, Rank()> idx{indices...};
+      const index_t n = idx[Rank() - 1];
+      const index_t win_len = w_.Size(0);
+      const index_t num_frames = frames_.Size(FRANK - 2);
+
+      const index_t f_lo = n < win_len ? 0 : (n - win_len) / hop_ + 1;
+      const index_t f_hi = cuda::std::min(num_frames - 1, n / hop_);
+
+      cuda::std::array<index_t, FRANK> fidx;
+      for (int r = 0; r < FRANK - 2; r++) {
+        fidx[r] = idx[r];
+      }
+
+      value_type sum{0};
+      scalar_type norm = 0;
+      for (index_t f = f_lo; f <= f_hi; f++) {
+        const index_t k = n - f * hop_;
+        const scalar_type wk = static_cast<scalar_type>(w_.template operator()<CapType>(k));
+        fidx[FRANK - 2] = f;
+        fidx[FRANK - 1] = k;
+        sum += get_value<CapType>(frames_, fidx) * wk;
+        norm += wk * wk;
+      }
+
+      return norm > cuda::std::numeric_limits<scalar_type>::epsilon() ? sum / norm : value_type{0};
+    }
+    else {
+      return value_type{0};
+    }
+  }
+
+  template <typename... Is>
+  __MATX_DEVICE__ __MATX_INLINE__ __MATX_HOST__ value_type operator()(Is... indices) const
+  {
+    return this->template operator()<DefaultCapabilities>(indices...);
+  }
+
+  constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const noexcept
+  {
+    if (dim == Rank() - 1) {
+      return (frames_.Size(FRANK - 2) - 1) * hop_ + w_.Size(0);
+    }
+    return frames_.Size(dim);
+  }
+
+  static inline constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+  {
+    return FRANK - 1;
+  }
+
+  template <OperatorCapability Cap, typename InType>
+  __MATX_INLINE__ __MATX_HOST__ auto get_capability([[maybe_unused]] InType& in) const {
+    if constexpr (Cap == OperatorCapability::SUPPORTS_JIT) {
+      return false;
+    }
+    else {
+      auto self_has_cap = capability_attributes<Cap>::default_value;
+      return combine_capabilities<Cap>(self_has_cap,
+          detail::get_operator_capability<Cap>(frames_, in),
+          detail::get_operator_capability<Cap>(w_, in));
+    }
+  }
+};
+
+/**
+ * Short-time Fourier transform of x into out
+ *
+ * The frames are formed by StftFrameOp and fused into cuFFT's loads when LTO callbacks are
+ * available. Otherwise they are written straight into out and transformed in place, so the
+ * overlapping frames never need a buffer of their own.
+ */
+template <typename OutputTensor, typename XOp, typename WOp>
+void stft_impl(OutputTensor &out, const XOp &x, const WOp &w, index_t nfft, index_t hop, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == XOp::Rank() + 1, matxInvalidDim,
+      "stft: output rank must be one more than the input rank");
+  MATX_STATIC_ASSERT_STR(WOp::Rank() == 1, matxInvalidDim, "stft: window must be 1D");
+  MATX_ASSERT_STR(hop > 0, matxInvalidParameter, "stft: hop must be positive");
+  MATX_ASSERT_STR(w.Size(0) <= nfft, matxInvalidSize, "stft: window must not be longer than nfft");
+
+  auto frames = StftFrameOp(x, w, nfft, hop);
+  for (int r = 0; r < OutputTensor::Rank(); r++) {
+    MATX_ASSERT_STR(out.Size(r) == frames.Size(r), matxInvalidSize, "stft: output must be (..., frames, nfft)");
+  }
+
+  if (!fft_load_callback_impl(out, frames, 0, FFTNorm::BACKWARD, FFTDirection::FORWARD, exec)) {
+    (out = frames).run(exec);
+    fft_impl(out, out, 0, FFTNorm::BACKWARD, exec);
+  }
+}
+
+/**
+ * Inverse short-time Fourier transform of s into out by weighted overlap-add
+ */
+template <typename OutputTensor, typename SOp, typename WOp>
+void istft_impl(OutputTensor &out, const SOp &s, const WOp &w, index_t hop, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using complex_type = typename SOp::value_type;
+  constexpr int RANK = SOp::Rank();
+  MATX_STATIC_ASSERT_STR(is_complex_v<complex_type>, matxInvalidType, "istft: input must be complex");
+  MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == RANK - 1, matxInvalidDim,
+      "istft: output rank must be one less than the input rank");
+  MATX_STATIC_ASSERT_STR(!is_complex_v<typename WOp::value_type>, matxInvalidType, "istft: window must be real");
+  MATX_ASSERT_STR(hop > 0 && hop <= w.Size(0), matxInvalidParameter, "istft: hop must be between 1 and the window length");
+  MATX_ASSERT_STR(w.Size(0) <= s.Size(RANK - 1), matxInvalidSize, "istft: window must not be longer than nfft");
+
+  cuda::std::array<index_t, RANK> shape;
+  for (int r = 0; r < RANK; r++) {
+    shape[r] = s.Size(r);
+  }
+
+  auto time_frames = make_tensor<complex_type>(shape, MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  ifft_impl(time_frames, s, 0, FFTNorm::BACKWARD, exec);
+  (out = IstftOverlapAddOp(time_frames, w, hop)).run(exec);
+}
+
+} // end namespace detail
+} // end namespace matx
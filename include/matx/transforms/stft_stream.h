@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/operators/stft.h"
+
+namespace matx {
+namespace experimental {
+
+/**
+ * @brief Streaming short-time Fourier transform
+ *
+ * Push() takes the next block of samples and writes the spectrum of every frame completed by it,
+ * so spectrogram columns are produced as samples arrive. Samples that do not yet complete a frame
+ * are kept for the next call, so the frames are exactly those stft() would form over the
+ * concatenation of all blocks.
+ *
+ * All work is ordered on the executor given at construction.
+ *
+ * @tparam T Sample type
+ * @tparam WOp Window type
+ */
+template <typename T, typename WOp>
+class StftStream {
+  public:
+    using value_type = detail::stft_complex_t<T>;
+
+    /**
+     * @brief Set up a streaming transform
+     *
+     * @param nfft FFT size of each frame
+     * @param hop Number of samples between the starts of consecutive frames, at most the window length
+     * @param w Window of at most nfft samples
+     * @param exec CUDA executor all work runs on
+     */
+    StftStream(index_t nfft, index_t hop, const WOp &w, const cudaExecutor &exec = cudaExecutor{})
+      : nfft_(nfft), hop_(hop), w_(w), exec_(exec)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      MATX_ASSERT_STR(hop > 0 && hop <= w.Size(0), matxInvalidParameter,
+                      "StftStream: hop must be between 1 and the window length");
+      MATX_ASSERT_STR(w.Size(0) <= nfft, matxInvalidSize, "StftStream: window must not be longer than nfft");
+      tail_ = make_tensor<T>({w.Size(0)}, MATX_DEVICE_MEMORY);
+    }
+
+    /**
+     * @brief Number of frames the next Push() of n samples will complete
+     */
+    index_t FramesFor(index_t n) const
+    {
+      return detail::stft_num_frames(tail_len_ + n, w_.Size(0), hop_);
+    }
+
+    /**
+     * @brief Transform the frames completed by the next block of samples
+     *
+     * @param x 1D block of samples following those of the previous call
+     * @param out 2D output with nfft columns and at least FramesFor(x.Size(0)) rows. The first
+     *   rows receive the new frames in order.
+     * @return Number of frames written
+     */
+    template <typename XType, typename OutType>
+    index_t Push(const XType &x, OutType &out)
+    {
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+      static_assert(XType::Rank() == 1, "StftStream: samples must be 1D");
+      static_assert(OutType::Rank() == 2, "StftStream: output must be 2D");
+
+      const auto stream = exec_.getStream();
+      const index_t n = tail_len_ + x.Size(0);
+      const index_t frames = detail::stft_num_frames(n, w_.Size(0), hop_);
+      MATX_ASSERT_STR(out.Size(0) >= frames && out.Size(1) == nfft_, matxInvalidSize,
+                      "StftStream: output is too small for the completed frames");
+
+      auto staging = make_tensor<T>({n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+      if (tail_len_ > 0) {
+        (slice(staging, {0}, {tail_len_}) = slice(tail_, {0}, {tail_len_})).run(exec_);
+      }
+      (slice(staging, {tail_len_}, {n}) = x).run(exec_);
+
+      if (frames > 0) {
+        auto out_frames = slice(out, {0, 0}, {frames, matxEnd});
+        detail::stft_impl(out_frames, staging, w_, nfft_, hop_, exec_);
+      }
+
+      // Keep everything from the start of the next frame, which is less than a window
+      const index_t consumed = frames * hop_;
+      tail_len_ = n - consumed;
+      if (tail_len_ > 0) {
+        (slice(tail_, {0}, {tail_len_}) = slice(staging, {consumed}, {n})).run(exec_);
+      }
+
+      frames_ += frames;
+      return frames;
+    }
+
+    /**
+     * @brief Total number of frames produced so far
+     */
+    index_t Frames() const { return frames_; }
+
+    /**
+     * @brief Discard buffered samples and start a new stream
+     */
+    void Reset()
+    {
+      tail_len_ = 0;
+      frames_ = 0;
+    }
+
+  private:
+    index_t nfft_;
+    index_t hop_;
+    WOp w_;
+    cudaExecutor exec_;
+    tensor_t<T, 1> tail_;
+    index_t tail_len_ = 0;
+    index_t frames_ = 0;
+};
+
+} // end namespace experimental
+} // end namespace matx
@@ -134,7 +134,7 @@ inline auto svdbpi_impl_workspace(const AType &A, cudaStream_t stream) {
  */
 template<typename UType, typename SType, typename VTType, typename AType, typename X0Type>
 void svdpi_impl(UType &U, SType &S, VTType &VT, AType &A, X0Type &x0, int iterations,  const cudaExecutor &exec, index_t k=-1) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
   const auto stream = exec.getStream();
 
   static_assert(UType::Rank() == AType::Rank());
@@ -394,7 +394,7 @@ void svdpi_impl(UType &U, SType &S, VTType &VT, AType &A, X0Type &x0, int iterat
  */
 template<typename UType, typename SType, typename VTType, typename AType>
 inline void svdbpi_impl(UType &U, SType &S, VTType &VT, const AType &A, int max_iters, float tol,  const cudaExecutor &exec) {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL);
   const auto stream = exec.getStream();
 
   static_assert(UType::Rank() == AType::Rank());
@@ -446,46 +446,65 @@ inline void svdbpi_impl(UType &U, SType &S, VTType &VT, const AType &A, int max_
 
   (Qold = Q = clone<RANK>(e2, cShape)).run(stream);
 
-  // TODO multistream?
-  for(int i = 0; i < max_iters; i+=2)
-  {
-
-    // double pump this iteration so we get Qold and Q for tolerance checking.
-    // We might take an extra iteration but it will overheads associated with checking concergence.
+  // double pump each iteration so we get Qold and Q for tolerance checking.
+  // We might take an extra iteration but it will overheads associated with checking concergence.
+  auto iterate = [&]() {
     matmul_impl(Z, AT, Q, exec);
     detail::qr_internal(Qold, R, Z, qr_workspace, exec);
 
     matmul_impl(Z, AT, Qold, exec);
     detail::qr_internal(Q, R, Z, qr_workspace, exec);
+  };
 
-    if(tol!=0.0f) {
+  auto check_convergence = [&]() {
+    //compute L2(Q-Qold)
+    // sqrt folded into next operation
+    (l2Norm = sum(abs2(Q-Qold))).run(stream);
 
-      cudaStreamSynchronize(d2h);  // wait for d2h transfer to finish
-      if(converged_host == true) {
-        // if converged exit loop
-        break;
-      }
+    // compute if all batches have converged
+    if constexpr (RANK > 2) {
+      (converged = all(as_int(sqrt(l2Norm) < tol))).run(stream);
+    } else {
+      (converged = as_int(sqrt(l2Norm) < tol)).run(stream);
+    }
+  };
+
+  if (tol != 0.0f && max_iters > 0 && exec.supports_device_while()) {
+    // The first pair runs eagerly to create the GEMM, QR and reduction plans. The remaining pairs loop on the
+    // device until every batch converged, so the host never waits on the convergence flag
+    iterate();
+    check_convergence();
+    exec.device_while(converged == 0, [&]() {
+      iterate();
+      check_convergence();
+    }, (max_iters - 1) / 2);
+  }
+  else {
+    // TODO multistream?
+    for(int i = 0; i < max_iters; i+=2)
+    {
+      iterate();
 
-      //compute L2(Q-Qold)
-      // sqrt folded into next operation
-      (l2Norm = sum(abs2(Q-Qold))).run(stream);
+      if(tol!=0.0f) {
 
-      // compute if all batches have converged
-      if constexpr (RANK > 2) {
-        (converged = all(as_int(sqrt(l2Norm) < tol))).run(stream);
-      } else {
-        (converged = as_int(sqrt(l2Norm) < tol)).run(stream);
-      }
+        cudaStreamSynchronize(d2h);  // wait for d2h transfer to finish
+        if(converged_host == true) {
+          // if converged exit loop
+          break;
+        }
+
+        check_convergence();
 
-      // event to record when converged is ready in stream
-      cudaEventRecord(event, stream);
-      // wait for d2h transfer until converged is ready
-      cudaStreamWaitEvent(d2h, event);
+        // event to record when converged is ready in stream
+        cudaEventRecord(event, stream);
+        // wait for d2h transfer until converged is ready
+        cudaStreamWaitEvent(d2h, event);
 
-      // copy convergence criteria to host.
-      // This is in unpinned memory and cannot on most systems run asynchronously.
-      // We do this here to hide the copy/sync behind prior launch latency/execution of next iteration.
-      cudaMemcpyAsync(&converged_host, converged.Data(), sizeof(int), cudaMemcpyDeviceToHost, d2h);
+        // copy convergence criteria to host.
+        // This is in unpinned memory and cannot on most systems run asynchronously.
+        // We do this here to hide the copy/sync behind prior launch latency/execution of next iteration.
+        cudaMemcpyAsync(&converged_host, converged.Data(), sizeof(int), cudaMemcpyDeviceToHost, d2h);
+      }
     }
   }
 
@@ -549,7 +568,7 @@ struct DnSVDCUDAParams_t {
 };
 
 template <typename ATensor>
-static __MATX_INLINE__ SVDMethod GetCUDASVDMethod(const ATensor &a) {
+static __MATX_INLINE__ SVDMethod GetCUDASVDMethod(const ATensor &a, const JacobiParams &jacobi = {}) {
   static constexpr int RANK = ATensor::Rank();
   index_t m = a.Size(RANK - 2);
   index_t n = a.Size(RANK - 1);
@@ -557,7 +576,7 @@ static __MATX_INLINE__ SVDMethod GetCUDASVDMethod(const ATensor &a) {
   // gesvd is a good default for non-batched
   SVDMethod method = detail::SVDMethod::GESVD;
 
-  if (a.Rank() != 2) {
+  if (a.Rank() != 2 && jacobi.enable) {
     if (m <= 32 &&
         n <= 32) {
       if constexpr (is_tensor_view_v<ATensor>) {
@@ -630,7 +649,7 @@ public:
                         const cudaExecutor &exec,
                         const char jobz = 'A')
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(UTensor::Rank()-1 == STensor::Rank(), matxInvalidDim, "S tensor must be 1 rank lower than U tensor in SVD");
@@ -651,12 +670,6 @@ public:
       [[maybe_unused]] cusolverStatus_t ret;
       ret = cusolverDnCreateGesvdjInfo(&batch_params);
       MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError, "Failure in cusolverDnCreateGesvdjInfo");
-
-      ret = cusolverDnXgesvdjSetTolerance(batch_params, 1e-9);
-      MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError, "Failure in cusolverDnXgesvdjSetTolerance");
-
-      ret = cusolverDnXgesvdjSetMaxSweeps(batch_params, 15);
-      MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError, "Failure in cusolverDnXgesvdjSetMaxSweeps");
     }
 
     this->GetWorkspaceSize();
@@ -744,9 +757,9 @@ public:
 
   void Exec(UTensor &u, STensor &s, VtTensor &vt,
             const ATensor &a, const cudaExecutor &exec,
-            const char jobz = 'A')
+            const char jobz = 'A', const JacobiParams &jacobi = {})
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     [[maybe_unused]] cusolverStatus_t ret;
 
@@ -796,6 +809,13 @@ public:
       }
     }
     else if (params.method == SVDMethod::GESVDJ_BATCHED) {
+      // The convergence controls are cheap to set and not part of the plan, so they are applied per call
+      ret = cusolverDnXgesvdjSetTolerance(batch_params, jacobi.tol);
+      MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError, "Failure in cusolverDnXgesvdjSetTolerance");
+
+      ret = cusolverDnXgesvdjSetMaxSweeps(batch_params, jacobi.max_sweeps);
+      MATX_ASSERT_STR_EXP(ret, CUSOLVER_STATUS_SUCCESS, matxSolverError, "Failure in cusolverDnXgesvdjSetMaxSweeps");
+
       if constexpr (std::is_same_v<float, T1>) {
         ret = cusolverDnSgesvdjBatched(
                 this->handle, CUSOLVER_EIG_MODE_VECTOR, static_cast<int>(params.m), static_cast<int>(params.n),
@@ -899,6 +919,7 @@ struct DnSVDCUDAParamsKeyEq {
             l.m == t.m &&
             l.batch_size == t.batch_size &&
             l.dtype == t.dtype &&
+            l.method == t.method &&
             l.exec.getStream() == t.exec.getStream();
   }
 };
@@ -933,14 +954,17 @@ using svd_cuda_cache_t = std::unordered_map<DnSVDCUDAParams_t, std::any, DnSVDCU
  * @param jobz
  *   Specifies options for computing all, part, or none of the matrices U and VT. See
  * SVDMode documentation for more info
+ * @param jacobi
+ *   Controls for the batched Jacobi solver used for batches of small matrices
  *
  */
 template <typename UTensor, typename STensor, typename VtTensor, typename ATensor>
 void svd_impl(UTensor &&u, STensor &&s,
          VtTensor &&vt, const ATensor &a,
-         const cudaExecutor &exec, const SVDMode jobz = SVDMode::ALL)
+         const cudaExecutor &exec, const SVDMode jobz = SVDMode::ALL,
+         const JacobiParams &jacobi = {})
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   using T1 = typename ATensor::value_type;
   constexpr int RANK = ATensor::Rank();
   const auto stream = exec.getStream();
@@ -963,7 +987,7 @@ void svd_impl(UTensor &&u, STensor &&s,
 
   const char job_cusolver = detail::SVDModeToChar(jobz);
   const bool m_leq_n = a.Size(RANK-2) <= a.Size(RANK-1);
-  const auto method = GetCUDASVDMethod(a);
+  const auto method = GetCUDASVDMethod(a, jacobi);
 
   // The power iteration method is a custom kernel so we don't need to test the types
   if (method == detail::SVDMethod::POW_ITER) {
@@ -998,6 +1022,7 @@ void svd_impl(UTensor &&u, STensor &&s,
     // Get parameters required by these tensors
     auto params = detail::matxDnSVDCUDAPlan_t<decltype(u_in), decltype(s_new), decltype(vt_in), decltype(at_col_maj)>::
       GetSVDParams(u_in, s_new, vt_in, at_col_maj, job_cusolver, exec);
+    params.method = method;
 
     // Get cache or new SVD plan if it doesn't exist
     using cache_val_type = detail::matxDnSVDCUDAPlan_t<decltype(u_in), decltype(s_new), decltype(vt_in), decltype(at_col_maj)>;
@@ -1010,7 +1035,7 @@ void svd_impl(UTensor &&u, STensor &&s,
         return std::make_shared<cache_val_type>(u_in, s_new, vt_in, at_col_maj, method, exec, job_cusolver);
       },
       [&](std::shared_ptr<cache_val_type> ctype) {
-        ctype->Exec(u_in, s_new, vt_in, at_col_maj, exec, job_cusolver);
+        ctype->Exec(u_in, s_new, vt_in, at_col_maj, exec, job_cusolver, jacobi);
       },
       exec
     );
@@ -1038,6 +1063,7 @@ void svd_impl(UTensor &&u, STensor &&s,
     // Get parameters required by these tensors
     auto params = detail::matxDnSVDCUDAPlan_t<decltype(u_col_maj), decltype(s_new), decltype(vt_col_maj), decltype(tvt)>::
         GetSVDParams(u_col_maj, s_new, vt_col_maj, tvt, job_cusolver, exec);
+    params.method = method;
 
     // Get cache or new SVD plan if it doesn't exist
     using cache_val_type = detail::matxDnSVDCUDAPlan_t<decltype(u_col_maj), decltype(s_new), decltype(vt_col_maj), decltype(tvt)>;
@@ -1050,7 +1076,7 @@ void svd_impl(UTensor &&u, STensor &&s,
         return std::make_shared<cache_val_type>(u_col_maj, s_new, vt_col_maj, tvt, method, exec, job_cusolver);
       },
       [&](std::shared_ptr<cache_val_type> ctype) {
-        ctype->Exec(u_col_maj, s_new, vt_col_maj, tvt, exec, job_cusolver);
+        ctype->Exec(u_col_maj, s_new, vt_col_maj, tvt, exec, job_cusolver, jacobi);
       },
       exec
     );
@@ -1082,4 +1108,125 @@ void svd_impl(UTensor &&u, STensor &&s,
   matxFree(tp);
 }
 
+/**
+ * Perform a randomized truncated SVD
+ *
+ * Computes the k leading singular triplets of A with the randomized range finder of
+ * Halko, Martinsson, and Tropp. A is multiplied by a random Gaussian matrix with
+ * k + oversample columns, optionally followed by power iterations that sharpen the
+ * decay of the spectrum, and the resulting basis Q is orthonormalized with an
+ * economic QR. The SVD of the small matrix Q^H A then yields the singular triplets.
+ * Only GEMMs with k + oversample columns touch A, so the cost is O(m n l) rather than
+ * the O(m n min(m,n)) of a full SVD.
+ *
+ * @tparam UTensor
+ *   Output tensor type for U
+ * @tparam STensor
+ *   Output tensor type for S
+ * @tparam VtTensor
+ *   Output tensor type for VT
+ * @tparam ATensor
+ *   Input tensor or operator type for A
+ *
+ * @param u
+ *   U output of shape `... x m x k`
+ * @param s
+ *   S output of shape `... x k`
+ * @param vt
+ *   VT output of shape `... x k x n`
+ * @param a
+ *   Input of shape `... x m x n`
+ * @param k
+ *   Number of singular values to compute
+ * @param oversample
+ *   Number of additional random samples used by the range finder
+ * @param power_iters
+ *   Number of power iterations
+ * @param exec
+ *   CUDA executor
+ */
+template <typename UTensor, typename STensor, typename VtTensor, typename ATensor>
+void rsvd_impl(UTensor &&u, STensor &&s, VtTensor &&vt, const ATensor &a,
+               index_t k, index_t oversample, int power_iters, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using T1 = typename ATensor::value_type;
+  constexpr int RANK = ATensor::Rank();
+  static_assert(RANK >= 2, "Input to rsvd() must be rank 2 or higher");
+  const auto stream = exec.getStream();
+
+  const index_t m = a.Size(RANK - 2);
+  const index_t n = a.Size(RANK - 1);
+  const index_t l = cuda::std::min(k + oversample, cuda::std::min(m, n));
+  MATX_ASSERT_STR(k > 0 && k <= l, matxInvalidParameter, "rsvd() requires 0 < k <= min(m, n)");
+  MATX_ASSERT_STR(oversample >= 0 && power_iters >= 0, matxInvalidParameter,
+                  "rsvd() requires a non-negative oversample and number of power iterations");
+  MATX_ASSERT_STR(u.Size(RANK - 2) == m && u.Size(RANK - 1) == k, matxInvalidSize, "U must be ... x m x k");
+  MATX_ASSERT_STR(vt.Size(RANK - 2) == k && vt.Size(RANK - 1) == n, matxInvalidSize, "VT must be ... x k x n");
+  MATX_ASSERT_STR(s.Size(RANK - 2) == k, matxInvalidSize, "S must be ... x k");
+
+  auto a_new = OpToTensor(a, exec);
+  if (!is_matx_transform_op<ATensor>() && !a_new.isSameView(a)) {
+    (a_new = a).run(exec);
+  }
+
+  auto shape = [&](index_t rows, index_t cols) {
+    auto sh = a.Shape();
+    sh[RANK - 2] = rows;
+    sh[RANK - 1] = cols;
+    return sh;
+  };
+
+  auto omega = make_tensor<T1>(shape(n, l), MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto Y = make_tensor<T1>(shape(m, l), MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto Q = make_tensor<T1>(shape(m, l), MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto R = make_tensor<T1>(shape(l, l), MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto B = make_tensor<T1>(shape(l, n), MATX_ASYNC_DEVICE_MEMORY, stream);
+
+  // Range finder: Y = A * omega, with the basis re-orthonormalized between the
+  // multiplications by A^H and A of each power iteration to prevent round-off
+  // from collapsing it onto the dominant singular vectors
+  (omega = random<T1>(shape(n, l), NORMAL)).run(exec);
+  matmul_impl(Y, a_new, omega, exec);
+
+  if (power_iters > 0) {
+    auto Qn = make_tensor<T1>(shape(n, l), MATX_ASYNC_DEVICE_MEMORY, stream);
+    for (int i = 0; i < power_iters; i++) {
+      qr_econ_impl(Q, R, Y, exec);
+      matmul_impl(omega, conj(transpose_matrix(a_new)), Q, exec);
+      qr_econ_impl(Qn, R, omega, exec);
+      matmul_impl(Y, a_new, Qn, exec);
+    }
+  }
+
+  qr_econ_impl(Q, R, Y, exec);
+
+  // B = Q^H * A is only l x n, so its SVD is cheap
+  matmul_impl(B, conj(transpose_matrix(Q)), a_new, exec);
+
+  auto Ub = make_tensor<T1>(shape(l, l), MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto VTb = make_tensor<T1>(shape(l, n), MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto s_shape = s.Shape();
+  s_shape[RANK - 2] = l;
+  auto Sb = make_tensor<typename inner_op_type_t<T1>::type>(s_shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  svd_impl(Ub, Sb, VTb, B, exec, SVDMode::REDUCED);
+
+  // Truncate to the k leading triplets and lift the left singular vectors back: U = Q * Ub
+  cuda::std::array<index_t, RANK> begin, end;
+  begin.fill(0);
+  end.fill(matxEnd);
+  end[RANK - 1] = k;
+  matmul_impl(u, Q, slice<RANK>(Ub, begin, end), exec);
+
+  end[RANK - 1] = matxEnd;
+  end[RANK - 2] = k;
+  (vt = slice<RANK>(VTb, begin, end)).run(exec);
+
+  cuda::std::array<index_t, RANK - 1> sbegin, send;
+  sbegin.fill(0);
+  send.fill(matxEnd);
+  send[RANK - 2] = k;
+  (s = slice<RANK - 1>(Sb, sbegin, send)).run(exec);
+}
+
 } // end namespace matx
@@ -118,7 +118,7 @@ public:
                       const char jobz = 'A',
                       SVDHostAlgo algo = SVDHostAlgo::DC)
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Dim checks
     MATX_STATIC_ASSERT_STR(UTensor::Rank()-1 == STensor::Rank(), matxInvalidDim, "S tensor must be 1 rank lower than U tensor in SVD");
@@ -227,7 +227,7 @@ public:
             const ATensor &a, [[maybe_unused]] const HostExecutor<MODE> &exec,
             const char jobz = 'A')
   {
-    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
 
     // Batch size checks
     for(int i = 0 ; i < RANK-2; i++) {
@@ -252,35 +252,37 @@ public:
     SetBatchPointers<BatchType::MATRIX>(vt, this->batch_vt_ptrs);
     SetBatchPointers<BatchType::VECTOR>(s, this->batch_s_ptrs);
 
-    lapack_int_t info;
     lapack_int_t ldvt = vt.Size(RANK-2);
     if (params.algo == SVDHostAlgo::QR) {
-      for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
+      const lapack_int_t info = this->ExecBatches(exec, [&](size_t i, void *ws, void *rws, void *) {
+        lapack_int_t batch_info;
         gesvd_dispatch(&jobz, &jobz, &params.m, &params.n,
                         reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
                         &params.m, reinterpret_cast<T3*>(this->batch_s_ptrs[i]),
                         reinterpret_cast<T1*>(this->batch_u_ptrs[i]), &params.m,
                         reinterpret_cast<T1*>(this->batch_vt_ptrs[i]), &ldvt,
-                        reinterpret_cast<T1*>(this->work), &this->lwork,
-                        reinterpret_cast<T3*>(this->rwork), &info);
-
+                        reinterpret_cast<T1*>(ws), &this->lwork,
+                        reinterpret_cast<T3*>(rws), &batch_info);
+        return batch_info;
+      });
 
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
-          (std::to_string(info) + " superdiagonals of an intermediate bidiagonal form did not converge to zero in LAPACK").c_str());
-      }
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        (std::to_string(info) + " superdiagonals of an intermediate bidiagonal form did not converge to zero in LAPACK").c_str());
     } else if (params.algo == SVDHostAlgo::DC) {
-      for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
+      const lapack_int_t info = this->ExecBatches(exec, [&](size_t i, void *ws, void *rws, void *iws) {
+        lapack_int_t batch_info;
         gesdd_dispatch(&jobz, &params.m, &params.n,
                         reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
                         &params.m, reinterpret_cast<T3*>(this->batch_s_ptrs[i]),
                         reinterpret_cast<T1*>(this->batch_u_ptrs[i]), &params.m,
                         reinterpret_cast<T1*>(this->batch_vt_ptrs[i]), &ldvt,
-                        reinterpret_cast<T1*>(this->work), &this->lwork,
-                        reinterpret_cast<T3*>(this->rwork),
-                        reinterpret_cast<lapack_int_t*>(this->iwork), &info);
+                        reinterpret_cast<T1*>(ws), &this->lwork,
+                        reinterpret_cast<T3*>(rws),
+                        reinterpret_cast<lapack_int_t*>(iws), &batch_info);
+        return batch_info;
+      });
 
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "gesdd error in LAPACK");
-      }
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "gesdd error in LAPACK");
     }
   }
 
@@ -409,7 +411,7 @@ void svd_impl([[maybe_unused]] UTensor &&u,
               [[maybe_unused]] const SVDMode jobz = SVDMode::ALL,
               [[maybe_unused]] const SVDHostAlgo algo = SVDHostAlgo::DC)
 {
-  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
   MATX_ASSERT_STR(MATX_EN_CPU_SOLVER, matxInvalidExecutor,
     "Trying to run a host Solver executor but host Solver support is not configured");
 #if MATX_EN_CPU_SOLVER
@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/core/type_utils.h"
+#include "matx/generators/range.h"
+#include "matx/generators/zeros.h"
+#include "matx/kernels/toeplitz_solve.cuh"
+#include "matx/operators/cast.h"
+#include "matx/operators/clone.h"
+#include "matx/operators/fft.h"
+#include "matx/operators/max.h"
+#include "matx/operators/reverse.h"
+#include "matx/operators/slice.h"
+#include "matx/operators/sum.h"
+#include "matx/operators/unary_operators.h"
+#include <cuda/std/__algorithm/min.h>
+
+namespace matx
+{
+namespace detail {
+
+/**
+ * Preconditioned conjugate gradient for Hermitian Toeplitz systems, with nb systems of size n
+ *
+ * T is never formed. Products with T embed it in a circulant matrix of size 2n, whose eigenvalues are
+ * the FFT of its first column, so T p is the first n points of ifft(fft(c) * fft(p, 2n)). The
+ * preconditioner is T. Chan's optimal circulant approximation of T, which is inverted the same way
+ * with transforms of size n. The clustered spectrum of the preconditioned system usually gives
+ * convergence in a number of iterations that does not grow with n.
+ */
+template <typename XType, typename TType, typename BType>
+void toeplitz_pcg(XType &x, const TType &t, const BType &b, double tol, int max_iters, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_INTERNAL)
+  using complex_type = typename XType::value_type;
+  using real_type = typename inner_op_type_t<complex_type>::type;
+  const auto stream = exec.getStream();
+  const index_t nb = x.Size(0);
+  const index_t n = x.Size(1);
+
+  auto allocate_tensor = [&](auto shape) {
+    ScratchScope scratch{stream};
+    return make_tensor<complex_type>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  };
+
+  // Eigenvalues of the 2n circulant embedding with first column [t, 0, conj(t[n-1..1])]
+  auto embed_eig = allocate_tensor(cuda::std::array<index_t, 2>{nb, 2 * n});
+  (slice(embed_eig, {0, 0}, {matxEnd, n}) = t).run(exec);
+  (slice(embed_eig, {0, n}, {matxEnd, n + 1}) = zeros<complex_type>({nb, 1})).run(exec);
+  if (n > 1) {
+    (slice(embed_eig, {0, n + 1}, {matxEnd, matxEnd}) = conj(reverse<1>(slice(t, {0, 1}, {matxEnd, matxEnd})))).run(exec);
+  }
+  (embed_eig = fft(embed_eig)).run(exec);
+
+  // Chan's preconditioner has first column c[k] = ((n - k) t[k] + k conj(t[n - k])) / n
+  auto precond_eig = allocate_tensor(cuda::std::array<index_t, 2>{nb, n});
+  auto t_wrap = allocate_tensor(cuda::std::array<index_t, 2>{nb, n});
+  (slice(t_wrap, {0, 0}, {matxEnd, 1}) = zeros<complex_type>({nb, 1})).run(exec);
+  if (n > 1) {
+    (slice(t_wrap, {0, 1}, {matxEnd, matxEnd}) = reverse<1>(slice(t, {0, 1}, {matxEnd, matxEnd}))).run(exec);
+  }
+  auto k = range<1>(cuda::std::array<index_t, 2>{nb, n}, real_type(0), real_type(1));
+  const real_type rn = static_cast<real_type>(n);
+  (precond_eig = fft(((rn - k) * t + k * conj(t_wrap)) / rn)).run(exec);
+
+  auto r = allocate_tensor(cuda::std::array<index_t, 2>{nb, n});
+  auto z = allocate_tensor(cuda::std::array<index_t, 2>{nb, n});
+  auto p = allocate_tensor(cuda::std::array<index_t, 2>{nb, n});
+  auto Ap = allocate_tensor(cuda::std::array<index_t, 2>{nb, n});
+  auto rz = allocate_tensor(cuda::std::array<index_t, 1>{nb});
+  auto rz_next = allocate_tensor(cuda::std::array<index_t, 1>{nb});
+  auto pAp = allocate_tensor(cuda::std::array<index_t, 1>{nb});
+  auto rr = make_tensor<real_type>({nb}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto bb = make_tensor<real_type>({nb}, MATX_ASYNC_DEVICE_MEMORY, stream);
+  auto worst = make_tensor<real_type>({});
+
+  auto per_row = [n](const auto &op) { return clone<2>(op, {matxKeepDim, n}); };
+  auto apply_precond = [&]() { (z = ifft(fft(r) / precond_eig)).run(exec); };
+
+  // x = 0, so r = b
+  (x = zeros<complex_type>({nb, n})).run(exec);
+  (r = b).run(exec);
+  (bb = sum(abs2(r), {1})).run(exec);
+  apply_precond();
+  (p = z).run(exec);
+  (rz = sum(conj(r) * z, {1})).run(exec);
+
+  const real_type tol2 = static_cast<real_type>(tol * tol);
+  for (int i = 0; i < max_iters; i++) {
+    (Ap = slice(ifft(embed_eig * fft(p, static_cast<uint64_t>(2 * n))), {0, 0}, {matxEnd, n})).run(exec);
+    (pAp = sum(conj(p) * Ap, {1})).run(exec);
+
+    (x = x + per_row(rz / pAp) * p).run(exec);
+    (r = r - per_row(rz / pAp) * Ap).run(exec);
+
+    (rr = sum(abs2(r), {1})).run(exec);
+    (worst = max(rr / bb)).run(exec);
+    exec.sync();
+    if (worst() < tol2) {
+      MATX_LOG_DEBUG("Toeplitz PCG converged after {} iterations", i + 1);
+      break;
+    }
+
+    apply_precond();
+    (rz_next = sum(conj(r) * z, {1})).run(exec);
+    (p = z + per_row(rz_next / rz) * p).run(exec);
+    (rz = rz_next).run(exec);
+  }
+}
+
+} // end namespace detail
+
+/**
+ * Solve Hermitian Toeplitz systems without forming the matrix
+ *
+ * @param out
+ *   Solution of the same shape as b
+ * @param t
+ *   First column of T. Rank 1 to share T across every system, or the same rank as b with one
+ *   column per system
+ * @param b
+ *   Right-hand sides, one per innermost row
+ * @param method
+ *   Solver to use
+ * @param tol
+ *   Relative residual norm at which PCG stops. Unused by Levinson.
+ * @param max_iters
+ *   Maximum iterations of PCG. Unused by Levinson.
+ * @param exec
+ *   CUDA executor
+ */
+template <typename OutType, typename TType, typename BType>
+void toeplitz_solve_impl(OutType &out, const TType &t, const BType &b, ToeplitzSolveMethod method,
+                         double tol, int max_iters, const cudaExecutor &exec)
+{
+  MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
+  using value_type = typename BType::value_type;
+  constexpr int RANK = BType::Rank();
+  static_assert(TType::Rank() == 1 || TType::Rank() == RANK, "toeplitz_solve() t must be rank 1 or match the rank of b");
+  static_assert(std::is_same_v<value_type, typename TType::value_type>, "toeplitz_solve() t and b must have the same type");
+  static_assert(std::is_same_v<value_type, float> || std::is_same_v<value_type, double> ||
+                std::is_same_v<value_type, cuda::std::complex<float>> || std::is_same_v<value_type, cuda::std::complex<double>>,
+                "toeplitz_solve() supports float, double, and their complex types");
+
+  const index_t n = b.Size(RANK - 1);
+  const index_t nb = TotalSize(b) / n;
+  MATX_ASSERT_STR(t.Size(TType::Rank() - 1) == n, matxInvalidSize, "toeplitz_solve() t must have as many entries as each row of b");
+
+  const auto stream = exec.getStream();
+  auto allocate_tensor = [&](auto shape) {
+    detail::ScratchScope scratch{stream};
+    return make_tensor<value_type>(shape, MATX_ASYNC_DEVICE_MEMORY, stream);
+  };
+
+  // Contiguous copies with every batch dimension folded into one
+  auto t_full = allocate_tensor(Shape(b));
+  auto b_full = allocate_tensor(Shape(b));
+  auto x_full = allocate_tensor(Shape(b));
+  if constexpr (TType::Rank() == 1 && RANK > 1) {
+    cuda::std::array<index_t, RANK> clone_shape = Shape(b);
+    clone_shape[RANK - 1] = matxKeepDim;
+    (t_full = clone<RANK>(t, clone_shape)).run(exec);
+  }
+  else {
+    (t_full = t).run(exec);
+  }
+  (b_full = b).run(exec);
+
+  auto t_rows = make_tensor<value_type>(t_full.Data(), {nb, n});
+  auto b_rows = make_tensor<value_type>(b_full.Data(), {nb, n});
+  auto x_rows = make_tensor<value_type>(x_full.Data(), {nb, n});
+
+  if (method == ToeplitzSolveMethod::LEVINSON) {
+    auto y = allocate_tensor(cuda::std::array<index_t, 2>{nb, n});
+#ifdef __CUDACC__
+    const auto blocks = static_cast<unsigned int>(cuda::std::min(nb, static_cast<index_t>(65535)));
+    detail::LevinsonKernel<<<blocks, LEVINSON_THREADS, 0, stream>>>(t_rows.Data(), b_rows.Data(), x_rows.Data(),
+                                                                     y.Data(), n, nb);
+#endif
+  }
+  else {
+    using complex_type = detail::complex_from_scalar_t<value_type>;
+    auto xc = [&]() {
+      detail::ScratchScope scratch{stream};
+      return make_tensor<complex_type>({nb, n}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    }();
+    detail::toeplitz_pcg(xc, as_type<complex_type>(t_rows), as_type<complex_type>(b_rows), tol, max_iters, exec);
+    if constexpr (is_complex_v<value_type>) {
+      (x_rows = xc).run(exec);
+    }
+    else {
+      (x_rows = real(xc)).run(exec);
+    }
+  }
+
+  (out = x_full).run(exec);
+}
+
+} // end namespace matx
@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/operator_options.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/cuda.h"
+#include "matx/executors/host.h"
+#include "matx/operators/collapse.h"
+#include "matx/transforms/order_stat.h"
+
+namespace matx {
+
+namespace detail {
+
+// Largest k supported by topk(). The selected entries of a row are sorted in
+// shared memory, and this bounds that to 16KB per block.
+static constexpr index_t TOPK_MAX_K = 1024;
+
+template <typename OutType, typename IdxType, typename InType>
+__MATX_INLINE__ void topk_check(const OutType &vals, const IdxType &idx, const InType &in, index_t k)
+{
+  static_assert(OutType::Rank() == InType::Rank() && IdxType::Rank() == InType::Rank(),
+    "topk() outputs must have the same rank as the input");
+  static_assert(std::is_same_v<typename IdxType::value_type, index_t>, "topk() indices must be index_t");
+  constexpr int RANK = InType::Rank();
+  const index_t n = in.Size(RANK - 1);
+
+  MATX_ASSERT_STR(k >= 1 && k <= n, matxInvalidParameter, "topk() k must be between 1 and the row length");
+  MATX_ASSERT_STR(k <= TOPK_MAX_K, matxInvalidParameter, "topk() supports k up to 1024");
+  MATX_ASSERT_STR(vals.Size(RANK - 1) == k && idx.Size(RANK - 1) == k, matxInvalidSize,
+    "topk() outputs must have k elements in the last dimension");
+  for (int r = 0; r < RANK - 1; r++) {
+    MATX_ASSERT_STR(vals.Size(r) == in.Size(r) && idx.Size(r) == in.Size(r), matxInvalidSize,
+      "topk() outputs must match the input in all but the last dimension");
+  }
+  MATX_ASSERT_STR(vals.IsContiguous() && idx.IsContiguous(), matxInvalidParameter,
+    "topk() outputs must be contiguous");
+}
+
+} // end namespace detail
+
+/**
+ * Find the k largest or smallest values of every row and their indices
+ *
+ * Rows are the last dimension of the input and all other dimensions are
+ * batched. Each row is handled by one block: a radix select finds the k-th
+ * value without sorting the row, then only the k selected entries are sorted.
+ * The outputs are ordered by value (ties by index), and the indices are
+ * relative to the start of each row.
+ *
+ * @tparam OutType
+ *   Output values type
+ * @tparam IdxType
+ *   Output index type
+ * @tparam InType
+ *   Input data type
+ *
+ * @param vals
+ *   Output values, with k elements in the last dimension
+ * @param idx
+ *   Output indices, with k elements in the last dimension
+ * @param in
+ *   Input data
+ * @param k
+ *   Number of values to select from each row
+ * @param dir
+ *   SORT_DIR_DESC for the largest values, SORT_DIR_ASC for the smallest
+ * @param exec
+ *   CUDA executor
+ */
+template <typename OutType, typename IdxType, typename InType>
+void topk_impl(OutType &vals, IdxType &idx, const InType &in, index_t k, SortDirection_t dir,
+               const cudaExecutor &exec)
+{
+#ifdef __CUDACC__
+  MATX_NVTX_START_CACHED("topk_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename InType::value_type;
+  MATX_STATIC_ASSERT_STR(detail::order_stat_supported_v<T>, matxInvalidType,
+    "topk() requires a real arithmetic or MatX half input type");
+
+  detail::topk_check(vals, idx, in, k);
+
+  constexpr int THREADS = 256;
+  const auto rows = lcollapse<InType::Rank() - 1>(in);
+  const index_t n = in.Size(InType::Rank() - 1);
+  const index_t batches = TotalSize(in) / n;
+
+  MATX_ASSERT_STR(n <= std::numeric_limits<unsigned int>::max(), matxInvalidSize,
+    "topk() rows are limited to 2^32-1 elements");
+
+  if (batches == 0) {
+    return;
+  }
+
+  int P = 1;
+  while (P < k) {
+    P *= 2;
+  }
+  const size_t shm = static_cast<size_t>(P) * (sizeof(index_t) + sizeof(detail::order_stat_key_t<T>));
+
+  cudaStream_t stream = exec.getStream();
+  if (dir == SORT_DIR_DESC) {
+    detail::topk_kernel<THREADS, true, T><<<static_cast<unsigned int>(batches), THREADS, shm, stream>>>(
+      rows, vals.Data(), idx.Data(), n, k, P);
+  }
+  else {
+    detail::topk_kernel<THREADS, false, T><<<static_cast<unsigned int>(batches), THREADS, shm, stream>>>(
+      rows, vals.Data(), idx.Data(), n, k, P);
+  }
+#endif
+}
+
+/**
+ * Find the k largest or smallest values of every row and their indices
+ *
+ * @tparam OutType
+ *   Output values type
+ * @tparam IdxType
+ *   Output index type
+ * @tparam InType
+ *   Input data type
+ * @tparam MODE
+ *   Host executor threads mode
+ *
+ * @param vals
+ *   Output values, with k elements in the last dimension
+ * @param idx
+ *   Output indices, with k elements in the last dimension
+ * @param in
+ *   Input data
+ * @param k
+ *   Number of values to select from each row
+ * @param dir
+ *   SORT_DIR_DESC for the largest values, SORT_DIR_ASC for the smallest
+ * @param exec
+ *   Host executor
+ */
+template <typename OutType, typename IdxType, typename InType, ThreadsMode MODE>
+void topk_impl(OutType &vals, IdxType &idx, const InType &in, index_t k, SortDirection_t dir,
+               [[maybe_unused]] const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START_CACHED("topk_impl(" + get_type_str(in) + ")", matx::MATX_NVTX_LOG_API)
+  using T = typename InType::value_type;
+
+  detail::topk_check(vals, idx, in, k);
+
+  const auto rows = lcollapse<InType::Rank() - 1>(in);
+  const index_t n = in.Size(InType::Rank() - 1);
+  const index_t batches = TotalSize(in) / n;
+
+  auto load = [&rows](index_t b, index_t i) -> T {
+    if constexpr (remove_cvref_t<decltype(rows)>::Rank() == 1) {
+      return rows(i);
+    }
+    else {
+      return rows(b, i);
+    }
+  };
+
+  std::vector<index_t> order(n);
+  for (index_t b = 0; b < batches; b++) {
+    std::iota(order.begin(), order.end(), 0);
+    std::partial_sort(order.begin(), order.begin() + k, order.end(), [&](index_t i, index_t j) {
+      const T vi = load(b, i);
+      const T vj = load(b, j);
+      if (vi == vj) {
+        return i < j;
+      }
+      return dir == SORT_DIR_DESC ? vj < vi : vi < vj;
+    });
+
+    for (index_t i = 0; i < k; i++) {
+      vals.Data()[b * k + i] = static_cast<typename OutType::value_type>(load(b, order[i]));
+      idx.Data()[b * k + i] = order[i];
+    }
+  }
+}
+
+} // end namespace matx
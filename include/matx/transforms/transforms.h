@@ -33,3 +33,4 @@
 #pragma once
 
 #include "matx/transforms/reduce.h"
+#include "matx/transforms/convert/coo2csr_assemble.h"
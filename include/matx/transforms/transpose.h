@@ -62,7 +62,7 @@ namespace matx
     __MATX_INLINE__ void transpose_matrix_impl([[maybe_unused]] OutputTensor &out,
         const InputTensor &in, const cudaExecutor &exec)
     {
-      MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+      MATX_NVTX_START_CACHED("", matx::MATX_NVTX_LOG_API)
       
       [[ maybe_unused ]] cudaStream_t stream = exec.getStream();
 
@@ -375,4 +375,396 @@ TYPED_TEST(FileIoTestsNonComplexFloatTypes, NPYWrite)
   }
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+TYPED_TEST(FileIoTestsNonComplexFloatTypes, NPYWriteDeviceRoundTrip)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  auto t = make_tensor<TestType>({3, 5}, MATX_DEVICE_MEMORY);
+  auto t2 = make_tensor<TestType>({3, 5}, MATX_DEVICE_MEMORY);
+  auto h = make_tensor<TestType>({3, 5});
+  auto h2 = make_tensor<TestType>({3, 5});
+  for (index_t i = 0; i < h.Size(0); i++) {
+    for (index_t j = 0; j < h.Size(1); j++) {
+      h(i, j) = static_cast<TestType>(i * 10 + j);
+    }
+  }
+
+  (t = h).run(this->exec);
+  this->exec.sync();
+
+  // Device tensors are staged through pinned memory in both directions
+  io::write_npy(t, "test_write_device.npy");
+  io::read_npy(t2, "test_write_device.npy");
+
+  (h2 = t2).run(this->exec);
+  this->exec.sync();
+  for (index_t i = 0; i < h.Size(0); i++) {
+    for (index_t j = 0; j < h.Size(1); j++) {
+      ASSERT_EQ(h(i, j), h2(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(FileIoNpyTests, NPYReadMmap)
+{
+  MATX_ENTER_HANDLER();
+
+  // example-begin read_npy_mmap-test-1
+  // Zero-copy host tensor backed by the file contents
+  auto t = io::read_npy_mmap<float, 2>("../test/00_io/test.npy");
+  // example-end read_npy_mmap-test-1
+
+  ASSERT_EQ(t.Size(0), 2);
+  ASSERT_EQ(t.Size(1), 3);
+  ASSERT_EQ(t(0, 0), 1.5f);
+  ASSERT_EQ(t(1, 2), 6.5f);
+
+  // The mapping is private, so writes do not reach the file
+  t(0, 0) = 0.0f;
+  auto t2 = io::read_npy_mmap<float, 2>("../test/00_io/test.npy");
+  ASSERT_EQ(t2(0, 0), 1.5f);
+
+  // The dtype must match exactly for zero-copy access
+  ASSERT_THROW({
+    [[maybe_unused]] auto td = io::read_npy_mmap<double, 2>("../test/00_io/test.npy");
+  }, matx::detail::matxException);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(FileIoNpyTests, NPZRead)
+{
+  MATX_ENTER_HANDLER();
+
+  // test.npz holds a = test.npy and b = int32 [1, 2, 3, 4], written by np.savez
+  auto a = io::read_npz_mmap<float, 2>("../test/00_io/test.npz", "a");
+  ASSERT_EQ(a(0, 1), 2.5f);
+  ASSERT_EQ(a(1, 0), 4.5f);
+
+  // example-begin read_npz-test-1
+  auto b = make_tensor<float>({4});
+  io::read_npz(b, "../test/00_io/test.npz", "b");
+  // example-end read_npz-test-1
+  for (index_t i = 0; i < b.Size(0); i++) {
+    ASSERT_EQ(b(i), static_cast<float>(i + 1));
+  }
+
+  ASSERT_THROW({
+    io::read_npz(b, "../test/00_io/test.npz", "missing");
+  }, matx::detail::matxException);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FileIoTestsNonComplexFloatTypes, RawReadWriteDevice)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  auto t = make_tensor<TestType>({4, 8}, MATX_DEVICE_MEMORY);
+  auto t2 = make_tensor<TestType>({4, 8}, MATX_DEVICE_MEMORY);
+  auto h = make_tensor<TestType>({4, 8});
+  auto h2 = make_tensor<TestType>({4, 8});
+  for (index_t i = 0; i < h.Size(0); i++) {
+    for (index_t j = 0; j < h.Size(1); j++) {
+      h(i, j) = static_cast<TestType>(i * 8 + j);
+    }
+  }
+  (t = h).run(this->exec);
+
+  // example-begin write_raw-test-1
+  // Ordered after the copy above on the same stream
+  io::write_raw(t, "test_write_raw.bin", 0, this->exec.getStream());
+  io::read_raw(t2, "test_write_raw.bin", 0, this->exec.getStream());
+  // example-end write_raw-test-1
+
+  (h2 = t2).run(this->exec);
+  this->exec.sync();
+  for (index_t i = 0; i < h.Size(0); i++) {
+    for (index_t j = 0; j < h.Size(1); j++) {
+      ASSERT_EQ(h(i, j), h2(i, j));
+    }
+  }
+
+  // Reads past the end of the file are rejected
+  ASSERT_THROW({
+    io::read_raw(t2, "test_write_raw.bin", sizeof(TestType));
+  }, matx::detail::matxException);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(FileIoNpyTests, GdsBatchRead)
+{
+  MATX_ENTER_HANDLER();
+
+  cudaExecutor exec{};
+  auto src = make_tensor<float>({3, 1024}, MATX_DEVICE_MEMORY);
+  (src = ones<float>({3, 1024}) * 2.0f).run(exec);
+  io::write_raw(src, "test_gds_batch.bin", 0, exec.getStream());
+  exec.sync();
+
+  // example-begin gds-batch-test-1
+  // Read one row per submission plus an NPY file, all ordered on the executor's stream
+  auto rows = make_tensor<float>({3, 1024}, MATX_DEVICE_MEMORY);
+  auto small = make_tensor<float>({2, 3}, MATX_DEVICE_MEMORY);
+  {
+    io::gdsBatch batch(exec.getStream());
+    for (index_t r = 0; r < rows.Size(0); r++) {
+      auto row = slice<1>(rows, {r, 0}, {matxDropDim, matxEnd});
+      batch.Read(row, "test_gds_batch.bin", static_cast<size_t>(r) * 1024 * sizeof(float));
+    }
+    batch.ReadNpy(small, "../test/00_io/test.npy");
+    batch.Wait();
+  }
+  // example-end gds-batch-test-1
+
+  auto h = make_tensor<float>({3, 1024});
+  auto hs = make_tensor<float>({2, 3});
+  (h = rows).run(exec);
+  (hs = small).run(exec);
+  exec.sync();
+  for (index_t r = 0; r < h.Size(0); r++) {
+    for (index_t c = 0; c < h.Size(1); c++) {
+      ASSERT_EQ(h(r, c), 2.0f);
+    }
+  }
+  ASSERT_EQ(hs(0, 0), 1.5f);
+  ASSERT_EQ(hs(1, 2), 6.5f);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(OocTensorTests, TiledReductions)
+{
+  MATX_ENTER_HANDLER();
+
+  cudaExecutor exec{};
+  constexpr index_t rows = 1000;
+  constexpr index_t cols = 64;
+
+  // example-begin ooc_tensor-test-1
+  auto in = make_ooc_tensor<float>("test_ooc_in.bin", {rows, cols}, oocMode::CREATE);
+  for (index_t i = 0; i < in.TotalSize(); i++) {
+    in.Data()[i] = static_cast<float>(i % 7);
+  }
+
+  // 96 rows per tile leaves a partial tile at the end
+  auto total = make_tensor<float>({});
+  ooc_sum(total, in, exec, 96);
+  // example-end ooc_tensor-test-1
+
+  auto peak = make_tensor<float>({});
+  auto counts = make_tensor<int>({7});
+  ooc_max(peak, in, exec, 96);
+  ooc_hist(counts, in, 0.0f, 7.0f, exec, 96);
+  exec.sync();
+
+  double expected = 0;
+  cuda::std::array<int, 7> expected_counts{};
+  for (index_t i = 0; i < in.TotalSize(); i++) {
+    expected += static_cast<double>(i % 7);
+    expected_counts[static_cast<size_t>(i % 7)]++;
+  }
+  ASSERT_NEAR(total(), expected, 1e-3 * expected);
+  ASSERT_EQ(peak(), 6.0f);
+  for (index_t i = 0; i < 7; i++) {
+    ASSERT_EQ(counts(i), expected_counts[static_cast<size_t>(i)]);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(OocTensorTests, TiledFFTAndTransform)
+{
+  MATX_ENTER_HANDLER();
+  using complex = cuda::std::complex<float>;
+
+  cudaExecutor exec{};
+  constexpr index_t rows = 100;
+  constexpr index_t cols = 32;
+
+  auto in = make_ooc_tensor<complex>("test_ooc_fft_in.bin", {rows, cols}, oocMode::CREATE);
+  auto out = make_ooc_tensor<complex>("test_ooc_fft_out.bin", {rows, cols}, oocMode::CREATE);
+  auto ref_in = make_tensor<complex>({rows, cols});
+  auto ref_out = make_tensor<complex>({rows, cols});
+  for (index_t i = 0; i < rows; i++) {
+    for (index_t j = 0; j < cols; j++) {
+      const complex v{static_cast<float>((i + j) % 5), static_cast<float>(i % 3)};
+      in.Data()[i * cols + j] = v;
+      ref_in(i, j) = v;
+    }
+  }
+
+  ooc_fft(out, in, exec, 30);
+  (ref_out = fft(ref_in)).run(exec);
+  exec.sync();
+
+  auto out_host = out.Tile(0, rows);
+  for (index_t i = 0; i < rows; i++) {
+    for (index_t j = 0; j < cols; j++) {
+      ASSERT_NEAR(out_host(i, j).real(), ref_out(i, j).real(), 1e-3);
+      ASSERT_NEAR(out_host(i, j).imag(), ref_out(i, j).imag(), 1e-3);
+    }
+  }
+
+  // example-begin ooc_transform-test-1
+  // Element-wise expressions run on each device tile and are written back to the output file
+  ooc_transform(out, in, [&](auto &out_tile, const auto &in_tile) {
+    (out_tile = in_tile * 2.0f).run(exec);
+  }, exec, 30);
+  // example-end ooc_transform-test-1
+
+  for (index_t i = 0; i < rows; i++) {
+    for (index_t j = 0; j < cols; j++) {
+      ASSERT_EQ(out_host(i, j), ref_in(i, j) * 2.0f);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FileIoTestsNonComplexFloatTypes, CSVRoundTripDevice)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  // Large enough to be split across several parsing threads
+  constexpr index_t rows = 200000;
+  auto h = make_tensor<TestType>({rows, 3});
+  for (index_t i = 0; i < rows; i++) {
+    h(i, 0) = static_cast<TestType>(i);
+    h(i, 1) = static_cast<TestType>(i) / static_cast<TestType>(7);
+    h(i, 2) = -static_cast<TestType>(i) * static_cast<TestType>(1e-3);
+  }
+
+  io::write_csv(h, "temp_large.csv", ",");
+
+  auto d = make_tensor<TestType>({rows, 3}, MATX_DEVICE_MEMORY);
+  auto h2 = make_tensor<TestType>({rows, 3});
+  io::read_csv(d, "temp_large.csv", ",", false, this->exec.getStream());
+  (h2 = d).run(this->exec);
+  this->exec.sync();
+
+  // Values are written with the shortest representation that round-trips
+  for (index_t i = 0; i < rows; i++) {
+    for (index_t j = 0; j < 3; j++) {
+      ASSERT_EQ(h(i, j), h2(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FileIoTestsComplexFloatTypes, CSVRoundTrip)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  auto t = make_tensor<TestType>({4, 2});
+  auto t2 = make_tensor<TestType>({4, 2});
+  using inner_type = typename inner_op_type_t<TestType>::type;
+  const float vals[4][2][2] = {{{1.5f, -2.f}, {0.f, 3.f}}, {{-0.25f, 0.f}, {4.f, -4.f}},
+                               {{1e-3f, 2e3f}, {-1.f, -1.f}}, {{0.f, 0.f}, {7.f, 0.5f}}};
+  for (index_t i = 0; i < t.Size(0); i++) {
+    for (index_t j = 0; j < t.Size(1); j++) {
+      t(i, j) = TestType{static_cast<inner_type>(vals[i][j][0]), static_cast<inner_type>(vals[i][j][1])};
+    }
+  }
+
+  io::write_csv(t, "temp_complex.csv", ";");
+  io::read_csv(t2, "temp_complex.csv", ";", false);
+  for (index_t i = 0; i < t.Size(0); i++) {
+    for (index_t j = 0; j < t.Size(1); j++) {
+      ASSERT_EQ(t(i, j), t2(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+#ifdef MATX_EN_HDF5
+// Write a chunked, shuffled, and deflated dataset with the HDF5 API for the reader to consume
+static void WriteHdf5Test(const std::string &fname, const std::vector<float> &vals, hsize_t rows, hsize_t cols)
+{
+  hid_t file = H5Fcreate(fname.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  hsize_t dims[2] = {rows, cols};
+  hsize_t chunk[2] = {7, 16};
+  hid_t space = H5Screate_simple(2, dims, nullptr);
+
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(dcpl, 2, chunk);
+  H5Pset_shuffle(dcpl);
+  H5Pset_deflate(dcpl, 4);
+  hid_t d = H5Dcreate2(file, "/signal", H5T_NATIVE_FLOAT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+  H5Dwrite(d, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, vals.data());
+  H5Dclose(d);
+
+  // Same values contiguous and stored as doubles, which goes through H5Dread with type conversion
+  std::vector<double> dvals(vals.begin(), vals.end());
+  hid_t d2 = H5Dcreate2(file, "/contig", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  H5Dwrite(d2, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, dvals.data());
+  H5Dclose(d2);
+
+  H5Pclose(dcpl);
+  H5Sclose(space);
+  H5Fclose(file);
+}
+
+TEST(FileIoHdf5Tests, ChunkedHyperslabRead)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t rows = 100;
+  constexpr index_t cols = 50;
+  const std::string fname = "/tmp/matx_hdf5_test.h5";
+  std::vector<float> vals(rows * cols);
+  for (index_t i = 0; i < rows * cols; i++) {
+    vals[i] = static_cast<float>(i);
+  }
+  WriteHdf5Test(fname, vals, rows, cols);
+
+  // example-begin hdf5-test-1
+  io::hdf5File f(fname, 4);
+  const auto shape = f.Shape("/signal");
+
+  // Hyperslab straight into device memory
+  auto d = make_tensor<float>({30, 20}, MATX_DEVICE_MEMORY);
+  f.Read(d, "/signal", {13, 9});
+  // example-end hdf5-test-1
+  ASSERT_EQ(shape.size(), 2u);
+  ASSERT_EQ(shape[0], rows);
+  ASSERT_EQ(shape[1], cols);
+
+  auto h = make_tensor<float>({30, 20});
+  (h = d).run();
+  cudaDeviceSynchronize();
+  for (index_t r = 0; r < 30; r++) {
+    for (index_t c = 0; c < 20; c++) {
+      ASSERT_EQ(h(r, c), vals[(r + 13) * cols + c + 9]);
+    }
+  }
+
+  // Whole contiguous dataset with conversion from double, into pinned memory
+  auto p = make_tensor<float>({rows, cols}, MATX_HOST_MEMORY);
+  f.Read(p, "/contig");
+  ASSERT_EQ(p(rows - 1, cols - 1), vals[rows * cols - 1]);
+
+  // Streaming blocks along the first dimension, with a partial last block
+  // example-begin hdf5-test-2
+  io::hdf5BlockReader<float, 2> reader(f, "/signal", make_tensor<float>({32, cols}, MATX_HOST_MEMORY));
+  index_t total = 0;
+  while (index_t n = reader.Next()) {
+    ASSERT_EQ(reader.Block()(0, 0), vals[total * cols]);
+    total += n;
+  }
+  // example-end hdf5-test-2
+  ASSERT_EQ(total, rows);
+
+  MATX_EXIT_HANDLER();
+}
+#endif
@@ -176,3 +176,33 @@ TEST_F(NvtxIOTests, testNvtxMacros)
   MATX_EXIT_HANDLER();
 }
 
+
+
+//
+// Test cached ranges with registered names and payloads
+//
+TEST_F(NvtxIOTests, testNvtxCached)
+{
+  MATX_ENTER_HANDLER();
+
+  setNVTXLogLevel(matx_nvxtLogLevels::MATX_NVTX_LOG_USER);
+
+  ASSERT_TRUE(nvtxLevelEnabled<matx_nvxtLogLevels::MATX_NVTX_LOG_USER>());
+  ASSERT_FALSE(nvtxLevelEnabled<matx_nvxtLogLevels::MATX_NVTX_LOG_API>());
+
+  const NvtxRegisteredName name = nvtxRegisterName("CachedRange", "testNvtxCached");
+  NvtxEvent myEventUser(&name, matx_nvxtLogLevels::MATX_NVTX_LOG_USER, static_cast<uint64_t>(data.TotalSize()));
+  NvtxEvent myEventApi(&name, matx_nvxtLogLevels::MATX_NVTX_LOG_API, 0);
+  ASSERT_TRUE(myEventUser.active_);
+  ASSERT_FALSE(myEventApi.active_);
+  ASSERT_STREQ(nvtxCurrentRangeName, "CachedRange");
+
+  for (int i = 0; i < 3; i++) {
+    MATX_NVTX_START_CACHED("CachedLoop(" + detail::get_type_str(data) + ")", matx_nvxtLogLevels::MATX_NVTX_LOG_USER)
+    MATX_NVTX_START_CACHED("", matx_nvxtLogLevels::MATX_NVTX_LOG_USER, data.TotalSize())
+  }
+
+  setNVTXLogLevel(matx_nvxtLogLevels::MATX_NVTX_LOG_API);
+
+  MATX_EXIT_HANDLER();
+}
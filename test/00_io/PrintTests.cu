@@ -420,3 +420,44 @@ TEST_F(PrintTest, PythonTest5)
 }
 
 
+
+TEST_F(PrintTest, AsyncMatchesSync)
+{
+  MATX_ENTER_HANDLER();
+  cudaExecutor exec{};
+  auto A2 = reshape(A1, {4,4});
+  auto dev = make_tensor<cuda::std::complex<double>>({4, 4}, MATX_DEVICE_MEMORY);
+  (dev = A2).run(exec);
+  exec.sync();
+
+  auto read_file = [](const char *name) {
+    FILE *fp = fopen(name, "r");
+    std::string text;
+    char buf[256];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+      text.append(buf, n);
+    }
+    fclose(fp);
+    return text;
+  };
+
+  FILE *fp = fopen("/tmp/matx_test_output.txt", "w");
+  ASSERT_FALSE(fp == NULL);
+  fprint(fp, A2);
+  fprint(fp, dev, 2, 0);
+  fclose(fp);
+
+  // example-begin print-async-1
+  // Formatting is deferred to a host callback on the executor's stream, so nothing is synchronized here
+  FILE *fp_async = fopen("/tmp/matx_test_output_async.txt", "w");
+  fprint_async(fp_async, A2, exec);
+  fprint_async(fp_async, dev, exec, 2, 0);
+  exec.sync();
+  fclose(fp_async);
+  // example-end print-async-1
+
+  ASSERT_EQ(read_file("/tmp/matx_test_output_async.txt"), read_file("/tmp/matx_test_output.txt"));
+
+  MATX_EXIT_HANDLER();
+}
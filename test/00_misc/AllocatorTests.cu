@@ -38,6 +38,7 @@
 #include <iostream>
 #include <vector>
 #include <unordered_map>
+#include <thread>
 
 using namespace matx;
 
@@ -445,3 +446,308 @@ TEST_F(DuckTypingAllocatorTest, MakeTensorWithAllocatorPointer) {
     
     MATX_EXIT_HANDLER();
 }
+
+TEST(MemoryPoolTests, ReuseOnSameStream) {
+    MATX_ENTER_HANDLER();
+
+    cudaStream_t stream;
+    cudaStreamCreate(&stream);
+    cudaExecutor exec{stream};
+
+    const bool was_enabled = GetMemoryPoolEnabled();
+    SetMemoryPoolEnabled(true);
+    TrimMemoryPool();
+
+    void *first;
+    {
+        auto t = make_tensor<float>({1000}, MATX_ASYNC_DEVICE_MEMORY, stream);
+        (t = ones<float>({1000})).run(exec);
+        first = t.Data();
+    }
+    EXPECT_GT(GetMemoryPoolCachedBytes(), 0);
+
+    size_t current, total, max;
+    matxGetMemoryStats(&current, &total, &max);
+    const size_t current_before = current;
+
+    {
+        // Same size class on the same stream should get the cached block back
+        auto t = make_tensor<float>({900}, MATX_ASYNC_DEVICE_MEMORY, stream);
+        EXPECT_EQ(t.Data(), first);
+        matxGetMemoryStats(&current, &total, &max);
+        EXPECT_EQ(current, current_before + 900 * sizeof(float));
+    }
+
+    matxGetMemoryStats(&current, &total, &max);
+    EXPECT_EQ(current, current_before);
+
+    {
+        // Allocator objects always use the pool
+        auto t = make_tensor<float>({1000}, matx_pool_allocator{stream});
+        EXPECT_EQ(t.Data(), first);
+    }
+
+    EXPECT_GT(TrimMemoryPool(stream), 0);
+    EXPECT_EQ(GetMemoryPoolCachedBytes(), 0);
+
+    exec.sync();
+    SetMemoryPoolEnabled(was_enabled);
+    cudaStreamDestroy(stream);
+
+    MATX_EXIT_HANDLER();
+}
+
+TEST(ScratchArenaTests, RewindsWhenIdle) {
+    MATX_ENTER_HANDLER();
+
+    cudaStream_t stream;
+    cudaStreamCreate(&stream);
+    cudaExecutor exec{stream};
+
+    const bool was_enabled = GetScratchArenaEnabled();
+    SetScratchArenaEnabled(true);
+
+    void *first;
+    {
+        detail::ScratchScope scratch{stream};
+        auto a = make_tensor<float>({1000}, MATX_ASYNC_DEVICE_MEMORY, stream);
+        auto b = make_tensor<float>({1000}, MATX_ASYNC_DEVICE_MEMORY, stream);
+        first = a.Data();
+        // Bump allocations are contiguous after rounding to the arena alignment
+        EXPECT_EQ(reinterpret_cast<uint8_t *>(b.Data()) - reinterpret_cast<uint8_t *>(a.Data()), 4096);
+    }
+    EXPECT_GT(GetScratchArenaReservedBytes(), 0);
+
+    {
+        // Nothing is live, so the arena starts over
+        detail::ScratchScope scratch{stream};
+        auto a = make_tensor<float>({500}, MATX_ASYNC_DEVICE_MEMORY, stream);
+        EXPECT_EQ(a.Data(), first);
+    }
+
+    // FFT convolution temporaries are served by the arena, so repeated calls don't grow it
+    auto in = make_tensor<float>({4096}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    auto filt = make_tensor<float>({1024}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    auto out = make_tensor<float>({4096 + 1024 - 1}, MATX_ASYNC_DEVICE_MEMORY, stream);
+    (in = ones<float>({4096})).run(exec);
+    (filt = ones<float>({1024})).run(exec);
+
+    (out = conv1d(in, filt, MATX_C_MODE_FULL, MATX_C_METHOD_FFT)).run(exec);
+    const size_t reserved = GetScratchArenaReservedBytes();
+    for (int i = 0; i < 3; i++) {
+        (out = conv1d(in, filt, MATX_C_MODE_FULL, MATX_C_METHOD_FFT)).run(exec);
+    }
+    EXPECT_EQ(GetScratchArenaReservedBytes(), reserved);
+
+    exec.sync();
+    EXPECT_GT(TrimScratchArena(stream), 0);
+    EXPECT_EQ(GetScratchArenaReservedBytes(), 0);
+
+    SetScratchArenaEnabled(was_enabled);
+    cudaStreamDestroy(stream);
+
+    MATX_EXIT_HANDLER();
+}
+
+TEST(AllocationTraceTests, SteadyStateLoop) {
+    MATX_ENTER_HANDLER();
+
+    cudaStream_t stream;
+    cudaStreamCreate(&stream);
+    cudaExecutor exec{stream};
+
+    const bool was_enabled = GetMemoryPoolEnabled();
+    SetMemoryPoolEnabled(true);
+
+    auto iteration = [&]() {
+        auto tmp = make_tensor<float>({1000}, MATX_ASYNC_DEVICE_MEMORY, stream);
+        (tmp = ones<float>({1000})).run(exec);
+    };
+
+    // Warm up the pool, then every later iteration must be served from it
+    iteration();
+    {
+        AllocationTrace trace{AllocationTraceMode::THROW};
+        for (int i = 0; i < 3; i++) {
+            iteration();
+        }
+        ASSERT_EQ(trace.Records().size(), 3);
+        EXPECT_TRUE(trace.Records()[0].cached);
+        EXPECT_EQ(trace.Records()[0].bytes, 1000 * sizeof(float));
+        EXPECT_EQ(trace.UncachedCount(), 0);
+    }
+
+    size_t current, total, max;
+    matxGetMemoryStats(&current, &total, &max);
+    const size_t current_before = current;
+    {
+        AllocationTrace outer;
+        {
+            AllocationTrace trace{AllocationTraceMode::THROW};
+            EXPECT_THROW(make_tensor<float>({100}, MATX_DEVICE_MEMORY), matx::detail::matxException);
+            EXPECT_EQ(trace.UncachedCount(), 1);
+        }
+        // Enclosing traces see the allocation too, and the failed allocation was released
+        EXPECT_EQ(outer.UncachedCount(), 1);
+        matxGetMemoryStats(&current, &total, &max);
+        EXPECT_EQ(current, current_before);
+    }
+
+    exec.sync();
+    TrimMemoryPool(stream);
+    SetMemoryPoolEnabled(was_enabled);
+    cudaStreamDestroy(stream);
+
+    MATX_EXIT_HANDLER();
+}
+
+TEST(MemTrackerTests, ConcurrentStatsExact) {
+    MATX_ENTER_HANDLER();
+
+    constexpr int num_threads = 16;
+    constexpr int iters = 1000;
+    constexpr size_t bytes = 64;
+
+    size_t current_before, total_before, max_before;
+    matxGetMemoryStats(&current_before, &total_before, &max_before);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < iters; i++) {
+                void *ptr;
+                matxAlloc(&ptr, bytes, MATX_HOST_MALLOC_MEMORY);
+                EXPECT_TRUE(IsAllocated(ptr));
+                EXPECT_EQ(GetPointerKind(ptr), MATX_HOST_MALLOC_MEMORY);
+                matxFree(ptr);
+            }
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    size_t current, total, max;
+    matxGetMemoryStats(&current, &total, &max);
+    EXPECT_EQ(current, current_before);
+    EXPECT_EQ(total, total_before + num_threads * iters * bytes);
+    EXPECT_GE(max, current_before + bytes);
+    EXPECT_LE(max, cuda::std::max(max_before, current_before + num_threads * bytes));
+
+    MATX_EXIT_HANDLER();
+}
+
+TEST(TransformTempTests, ChainReleasesInputs) {
+    MATX_ENTER_HANDLER();
+
+    cudaStream_t stream;
+    cudaStreamCreate(&stream);
+    cudaExecutor exec{stream};
+
+    constexpr index_t n = 2048;
+    constexpr size_t bytes = n * n * sizeof(float);
+    auto in = make_tensor<float>({n, n});
+    auto out = make_tensor<float>({n, n});
+    (in = random<float>({n, n}, UNIFORM)).run(exec);
+    exec.sync();
+
+    size_t current_before, total_before, max_before;
+    matxGetMemoryStats(&current_before, &total_before, &max_before);
+
+    // Four chained temporaries, but each is released once the next transpose has consumed it
+    (out = transpose_matrix(transpose_matrix(transpose_matrix(transpose_matrix(transpose_matrix(in)))))).run(exec);
+    exec.sync();
+
+    size_t current, total, max;
+    matxGetMemoryStats(&current, &total, &max);
+    EXPECT_EQ(current, current_before);
+    EXPECT_LE(max, cuda::std::max(max_before, current_before + 3 * bytes));
+
+    auto expected = make_tensor<float>({n, n});
+    (expected = transpose_matrix(in)).run(exec);
+    exec.sync();
+    for (index_t i = 0; i < n; i += 127) {
+        for (index_t j = 0; j < n; j += 131) {
+            ASSERT_EQ(out(i, j), expected(i, j));
+        }
+    }
+
+    cudaStreamDestroy(stream);
+
+    MATX_EXIT_HANDLER();
+}
+
+TEST(SystemMemoryTests, PrefetchTouchedTensors) {
+    MATX_ENTER_HANDLER();
+
+    cudaStream_t stream;
+    cudaStreamCreate(&stream);
+    cudaExecutor exec{stream};
+    exec.set_prefetch(true);
+
+    // Falls back to managed memory when the device cannot access pageable memory
+    constexpr index_t n = 4096;
+    auto a = make_tensor<float>({n}, MATX_SYSTEM_MEMORY);
+    auto b = make_tensor<float>({n}, MATX_SYSTEM_MEMORY);
+    const auto kind = GetPointerKind(a.Data());
+    EXPECT_TRUE(kind == MATX_SYSTEM_MEMORY || kind == MATX_MANAGED_MEMORY || kind == MATX_HOST_MEMORY);
+
+    for (index_t i = 0; i < n; i++) {
+        a(i) = static_cast<float>(i);
+    }
+
+    // Only the sliced half of a is prefetched; the result must be unaffected
+    (slice(b, {0}, {n / 2}) = slice(a, {n / 2}, {n}) * 2.0f).run(exec);
+    exec.sync();
+
+    for (index_t i = 0; i < n / 2; i++) {
+        ASSERT_EQ(b(i), static_cast<float>(i + n / 2) * 2.0f);
+    }
+
+    cudaStreamDestroy(stream);
+
+    MATX_EXIT_HANDLER();
+}
+
+TEST(OversubscriptionTests, EvictAndFaultIn) {
+    MATX_ENTER_HANDLER();
+
+    cudaStream_t stream;
+    cudaStreamCreate(&stream);
+    cudaExecutor exec{stream};
+
+    const bool was_enabled = GetOversubscriptionEnabled();
+    SetOversubscriptionEnabled(true);
+
+    {
+        constexpr index_t n = 1 << 20;
+        auto a = make_tensor<float>({n}, MATX_DEVICE_MEMORY);
+        auto b = make_tensor<float>({n}, MATX_DEVICE_MEMORY);
+        auto c = make_tensor<float>({n}, MATX_DEVICE_MEMORY);
+        (a = ones<float>({n})).run(exec);
+        (b = a * 2.0f).run(exec);
+
+        // Force both inputs out to host as if the device had run out of memory
+        const void *a_ptr = a.Data();
+        EXPECT_TRUE(GetAllocMap().oversubscribed.EvictBytes(2 * n * sizeof(float)));
+        EXPECT_GE(GetOversubscribedSpilledBytes(), 2 * n * sizeof(float));
+
+        // Both are faulted back in at the same address before the expression runs
+        (c = a + b).run(exec);
+        exec.sync();
+        EXPECT_EQ(GetOversubscribedSpilledBytes(), 0);
+        EXPECT_EQ(a.Data(), a_ptr);
+
+        auto c_host = make_tensor<float>({n}, MATX_HOST_MEMORY);
+        (c_host = c).run(exec);
+        exec.sync();
+        EXPECT_EQ(c_host(0), 3.0f);
+        EXPECT_EQ(c_host(n - 1), 3.0f);
+    }
+
+    SetOversubscriptionEnabled(was_enabled);
+    cudaStreamDestroy(stream);
+
+    MATX_EXIT_HANDLER();
+}
@@ -36,6 +36,7 @@
 #include "utilities.h"
 #include "gtest/gtest.h"
 #include <iostream>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
@@ -49,7 +50,7 @@ TEST(ClearCacheTests, TestCase) {
     cudaError_t err = cudaMemGetInfo(&initial_free_mem, &total_mem);
     ASSERT_EQ(err, cudaSuccess);
 
-    // The cuBLAS handle will allocate an associated workspace of 4 MiB on pre-Hopper and
+    // The cuBLAS handle will use a per-stream workspace of 4 MiB on pre-Hopper and
     // 32 MiB on Hopper+.
     {
         auto c = matx::make_tensor<float, 2>({1024, 1024});
@@ -69,6 +70,8 @@ TEST(ClearCacheTests, TestCase) {
     ASSERT_EQ(err, cudaSuccess);
 
     matx::ClearCachesAndAllocations();
+    // The shared GEMM workspace is stream-ordered memory and is returned once the device syncs
+    cudaDeviceSynchronize();
 
     size_t post_clear_free_mem = 0;
     err = cudaMemGetInfo(&post_clear_free_mem, &total_mem);
@@ -83,4 +86,139 @@ TEST(ClearCacheTests, TestCase) {
     ASSERT_GE(freed, 2 * four_MiB);
 
     MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+TEST(ClearCacheTests, LRUEviction) {
+    MATX_ENTER_HANDLER();
+
+    matx::ClearCaches();
+    matx::SetCacheLimits(0, 1);
+
+    size_t hits0, misses0, evictions0, entries0, bytes0;
+    matx::GetCacheStats(&hits0, &misses0, &evictions0, &entries0, &bytes0);
+    ASSERT_EQ(entries0, 0);
+
+    auto c1 = matx::make_tensor<float, 2>({64, 64});
+    auto a1 = matx::make_tensor<float, 2>({64, 64});
+    auto b1 = matx::make_tensor<float, 2>({64, 64});
+    auto c2 = matx::make_tensor<float, 2>({128, 128});
+    auto a2 = matx::make_tensor<float, 2>({128, 128});
+    auto b2 = matx::make_tensor<float, 2>({128, 128});
+
+    (c1 = matx::matmul(a1, b1)).run();
+    (c1 = matx::matmul(a1, b1)).run();
+    (c2 = matx::matmul(a2, b2)).run();
+    cudaDeviceSynchronize();
+
+    size_t hits, misses, evictions, entries, bytes;
+    matx::GetCacheStats(&hits, &misses, &evictions, &entries, &bytes);
+    ASSERT_EQ(hits - hits0, 1);
+    ASSERT_EQ(misses - misses0, 2);
+    ASSERT_EQ(evictions - evictions0, 1);
+    ASSERT_EQ(entries, 1);
+
+    // The evicted handle is recreated on its next use
+    (c1 = matx::matmul(a1, b1)).run();
+    cudaDeviceSynchronize();
+    matx::GetCacheStats(&hits, &misses, &evictions, &entries, &bytes);
+    ASSERT_EQ(misses - misses0, 3);
+    ASSERT_EQ(evictions - evictions0, 2);
+
+    matx::SetCacheLimits(0, 0);
+    matx::ClearCaches();
+
+    MATX_EXIT_HANDLER();
+}
+
+TEST(ClearCacheTests, ConcurrentLookups) {
+    MATX_ENTER_HANDLER();
+
+    matx::ClearCaches();
+
+    constexpr int num_threads = 8;
+    constexpr int iters = 20;
+
+    size_t hits0, misses0, evictions0, entries0, bytes0;
+    matx::GetCacheStats(&hits0, &misses0, &evictions0, &entries0, &bytes0);
+
+    // cuBLASLt handles without a bias or autotuning are shared by every thread and stream on the
+    // device, so only the first lookup builds one and every other call is a hit
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+      threads.emplace_back([]() {
+        cudaStream_t stream;
+        cudaStreamCreate(&stream);
+        matx::cudaExecutor exec{stream};
+        auto c = matx::make_tensor<float, 2>({64, 64});
+        auto a = matx::make_tensor<float, 2>({64, 64});
+        auto b = matx::make_tensor<float, 2>({64, 64});
+        for (int i = 0; i < iters; i++) {
+          (c = matx::matmul(a, b)).run(exec);
+        }
+        cudaStreamSynchronize(stream);
+        cudaStreamDestroy(stream);
+      });
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+
+    size_t hits, misses, evictions, entries, bytes;
+    matx::GetCacheStats(&hits, &misses, &evictions, &entries, &bytes);
+    ASSERT_EQ(misses - misses0, 1);
+    ASSERT_EQ(hits - hits0, num_threads * iters - 1);
+    ASSERT_EQ(entries, 1);
+
+    matx::ClearCaches();
+
+    MATX_EXIT_HANDLER();
+}
+
+TEST(ClearCacheTests, SharedFFTPlans) {
+    MATX_ENTER_HANDLER();
+
+    matx::ClearCaches();
+
+    constexpr int num_threads = 4;
+    constexpr index_t n = 1024;
+
+    size_t hits0, misses0, evictions0, entries0, bytes0;
+    matx::GetCacheStats(&hits0, &misses0, &evictions0, &entries0, &bytes0);
+
+    // Each thread runs on its own stream, but they all reuse one plan
+    std::vector<std::thread> threads;
+    std::vector<int> ok(num_threads, 0);
+    for (int t = 0; t < num_threads; t++) {
+      threads.emplace_back([&ok, t]() {
+        cudaStream_t stream;
+        cudaStreamCreate(&stream);
+        matx::cudaExecutor exec{stream};
+        auto x = matx::make_tensor<cuda::std::complex<float>>({n});
+        auto y = matx::make_tensor<cuda::std::complex<float>>({n});
+        (x = static_cast<float>(t + 1)).run(exec);
+        (y = matx::fft(x)).run(exec);
+        cudaStreamSynchronize(stream);
+
+        // A constant input transforms to n times the constant in the first bin only
+        ok[t] = std::abs(y(0).real() - static_cast<float>(n * (t + 1))) < 1e-2f * n &&
+                std::abs(y(1).real()) < 1e-2f;
+        cudaStreamDestroy(stream);
+      });
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+
+    for (int t = 0; t < num_threads; t++) {
+      ASSERT_TRUE(ok[t]);
+    }
+
+    size_t hits, misses, evictions, entries, bytes;
+    matx::GetCacheStats(&hits, &misses, &evictions, &entries, &bytes);
+    ASSERT_EQ(misses - misses0, 1);
+    ASSERT_EQ(hits - hits0, num_threads - 1);
+    ASSERT_EQ(entries, 1);
+
+    matx::ClearCaches();
+
+    MATX_EXIT_HANDLER();
+}
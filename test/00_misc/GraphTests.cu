@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+TEST(GraphTests, CaptureAndReplay)
+{
+  MATX_ENTER_HANDLER();
+
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  auto a = make_tensor<float>({256});
+  auto b = make_tensor<cuda::std::complex<float>>({256});
+  auto c = make_tensor<float>({256});
+  (a = 0.0f).run(exec);
+
+  // example-begin capture-test-1
+  cudaGraph graph;
+  exec.capture(graph, [&]() {
+    (a = a + 1.0f).run(exec);
+    (b = fft(a)).run(exec);
+    (c = abs(b)).run(exec);
+  });
+
+  for (int i = 0; i < 5; i++) {
+    exec.launch(graph);
+  }
+  // example-end capture-test-1
+  exec.sync();
+
+  ASSERT_TRUE(graph.is_instantiated());
+  ASSERT_EQ(graph.num_instantiations(), 1);
+
+  // One eager warmup execution plus five replays
+  for (index_t i = 0; i < a.Size(0); i++) {
+    ASSERT_EQ(a(i), 6.0f);
+  }
+  ASSERT_NEAR(c(0), 6.0f * 256.0f, 1e-2f);
+
+  // Recapturing the same sequence with different pointers updates the graph in place
+  auto a2 = make_tensor<float>({256});
+  (a2 = 10.0f).run(exec);
+  exec.capture(graph, [&]() {
+    (a2 = a2 + 1.0f).run(exec);
+    (b = fft(a2)).run(exec);
+    (c = abs(b)).run(exec);
+  });
+  exec.launch(graph);
+  exec.sync();
+
+  ASSERT_EQ(graph.num_instantiations(), 1);
+  ASSERT_EQ(graph.num_updates(), 1);
+  ASSERT_EQ(a2(0), 11.0f);
+
+  cudaStreamDestroy(stream);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(GraphTests, TaskGraphSchedulesIndependentTasks)
+{
+  MATX_ENTER_HANDLER();
+
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  auto a = make_tensor<float>({1024});
+  auto b = make_tensor<float>({1024});
+  auto c = make_tensor<float>({1024});
+
+  // example-begin task-graph-test-1
+  // The two fills are independent and run on different streams. The scale of "a" continues on the
+  // stream of the first fill, and the sum waits for both chains.
+  taskGraph tg(2);
+  const int fill_a = tg.add((a = 1.0f), {}, {a});
+  const int fill_b = tg.add((b = 2.0f), {}, {b});
+  const int scale_a = tg.add((a = a * 3.0f), {a}, {a});
+  const int sum = tg.add([&](cudaExecutor &ex) {
+    (c = a + b).run(ex);
+  }, {a, b}, {c});
+
+  tg.run(exec);
+  // example-end task-graph-test-1
+  exec.sync();
+
+  ASSERT_TRUE(tg.dependencies(fill_a).empty());
+  ASSERT_TRUE(tg.dependencies(fill_b).empty());
+  ASSERT_EQ(tg.dependencies(scale_a), std::vector<int>{fill_a});
+  ASSERT_EQ(tg.dependencies(sum), (std::vector<int>{fill_a, fill_b, scale_a}));
+  ASSERT_NE(tg.stream_of(fill_a), tg.stream_of(fill_b));
+  ASSERT_EQ(tg.stream_of(scale_a), tg.stream_of(fill_a));
+
+  for (index_t i = 0; i < c.Size(0); i++) {
+    ASSERT_EQ(c(i), 5.0f);
+  }
+
+  // The same schedule captured into a CUDA graph gives the same result on replay
+  (c = 0.0f).run(exec);
+  cudaGraph graph;
+  tg.capture(exec, graph, false);
+  exec.launch(graph);
+  exec.sync();
+
+  for (index_t i = 0; i < c.Size(0); i++) {
+    ASSERT_EQ(c(i), 5.0f);
+  }
+
+  cudaStreamDestroy(stream);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(GraphTests, DeviceWhileLoop)
+{
+  MATX_ENTER_HANDLER();
+
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  if (!exec.supports_device_while()) {
+    cudaStreamDestroy(stream);
+    GTEST_SKIP() << "Device loops need CUDA 12.4 or newer";
+  }
+
+  auto x = make_tensor<float>({1024});
+  auto total = make_tensor<float>({});
+  (x = ones<float>({1024})).run(exec);
+
+  // Creates the reduction plan before it is captured
+  (total = sum(x)).run(exec);
+
+  // example-begin device-while-test-1
+  // Halve x until its sum drops below 1. The sum is never read on the host
+  exec.device_while(total >= 1.0f, [&]() {
+    (x = x * 0.5f).run(exec);
+    (total = sum(x)).run(exec);
+  }, 100);
+  // example-end device-while-test-1
+  exec.sync();
+
+  // 1024 halved 11 times is the first sum below 1
+  ASSERT_EQ(total(), 0.5f);
+  ASSERT_EQ(x(0), 0.5f / 1024.0f);
+
+  // The iteration limit ends the loop while the condition still holds
+  (x = ones<float>({1024})).run(exec);
+  (total = sum(x)).run(exec);
+  exec.device_while(total >= 1.0f, [&]() {
+    (x = x * 0.5f).run(exec);
+    (total = sum(x)).run(exec);
+  }, 3);
+  exec.sync();
+
+  ASSERT_EQ(total(), 128.0f);
+
+  cudaStreamDestroy(stream);
+
+  MATX_EXIT_HANDLER();
+}
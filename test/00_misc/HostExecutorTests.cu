@@ -0,0 +1,392 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+#include <thread>
+#include <algorithm>
+
+using namespace matx;
+
+template <typename Exec>
+static void CheckRank3Fill(Exec &exec, index_t d0, index_t d1, index_t d2)
+{
+  auto t = make_tensor<float>({d0, d1, d2}, MATX_HOST_MALLOC_MEMORY);
+  (t = (range<0>({d0, d1, d2}, 0.0f, 1.0f) * 10000.0f +
+        range<1>({d0, d1, d2}, 0.0f, 1.0f) * 100.0f +
+        range<2>({d0, d1, d2}, 0.0f, 1.0f))).run(exec);
+
+  for (index_t i = 0; i < d0; i++) {
+    for (index_t j = 0; j < d1; j++) {
+      for (index_t k = 0; k < d2; k++) {
+        ASSERT_EQ(t(i, j, k), static_cast<float>(i * 10000 + j * 100 + k));
+      }
+    }
+  }
+}
+
+TEST(HostExecutorTests, TiledTraversal)
+{
+  MATX_ENTER_HANDLER();
+
+  SingleThreadedHostExecutor single;
+  CheckRank3Fill(single, 3, 5, 77);
+
+  // Fewer rows than threads forces rows to be split into tiles
+  HostExecutor<ThreadsMode::SELECT> multi{HostExecParams{4}};
+  CheckRank3Fill(multi, 1, 2, 99);
+  CheckRank3Fill(multi, 4, 9, 33);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, PersistentPool)
+{
+  MATX_ENTER_HANDLER();
+
+  HostExecutor<ThreadsMode::SELECT> exec{HostExecParams{4, true}};
+  ASSERT_EQ(exec.GetNumThreads(), 4);
+
+  // Repeated small dispatches reuse the same workers
+  for (int i = 0; i < 100; i++) {
+    CheckRank3Fill(exec, 2, 3, 5);
+  }
+  CheckRank3Fill(exec, 7, 11, 130);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, PinnedPool)
+{
+  MATX_ENTER_HANDLER();
+
+  host_cpu_set_t cpus{0};
+  const int ncpu = static_cast<int>(std::min(2u, std::max(1u, std::thread::hardware_concurrency())));
+  for (int i = 0; i < ncpu; i++) {
+    cpus.set(i);
+  }
+
+  HostExecutor<ThreadsMode::SELECT> exec{HostExecParams{cpus}};
+  ASSERT_EQ(exec.GetNumThreads(), ncpu);
+  CheckRank3Fill(exec, 4, 8, 16);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, NumaFirstTouch)
+{
+  MATX_ENTER_HANDLER();
+
+  host_cpu_set_t cpus{0};
+  const int ncpu = static_cast<int>(std::min(4u, std::max(1u, std::thread::hardware_concurrency())));
+  for (int i = 0; i < ncpu; i++) {
+    cpus.set(i);
+  }
+  HostExecutor<ThreadsMode::SELECT> exec{HostExecParams{cpus}};
+
+  const index_t d0 = 6, d1 = 7, d2 = 4099;
+  auto t = make_tensor<float>({d0, d1, d2}, MATX_HOST_NUMA_MEMORY);
+  ASSERT_EQ(GetPointerKind(t.Data()), MATX_HOST_NUMA_MEMORY);
+  exec.FirstTouch(t);
+
+  for (index_t i = 0; i < d0; i++) {
+    for (index_t j = 0; j < d1; j++) {
+      for (index_t k = 0; k < d2; k++) {
+        ASSERT_EQ(t(i, j, k), 0.0f);
+      }
+    }
+  }
+
+  (t = range<2>({d0, d1, d2}, 1.0f, 1.0f)).run(exec);
+  for (index_t k = 0; k < d2; k++) {
+    ASSERT_EQ(t(d0 - 1, d1 - 1, k), static_cast<float>(k + 1));
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, HalfConversions)
+{
+  MATX_ENTER_HANDLER();
+
+  // Every fp16 and bf16 value must convert to float exactly as the CUDA host conversions do
+  for (uint32_t b = 0; b <= 0xffff; b++) {
+    const auto bits = static_cast<uint16_t>(b);
+    const float fp16_ref = __half2float(cuda::std::bit_cast<__half>(bits));
+    const float fp16 = detail::fp16_bits_to_float(bits);
+    const float bf16_ref = __bfloat162float(cuda::std::bit_cast<__nv_bfloat16>(bits));
+    const float bf16 = detail::bf16_bits_to_float(bits);
+    if (cuda::std::isnan(fp16_ref)) {
+      ASSERT_TRUE(cuda::std::isnan(fp16));
+    } else {
+      ASSERT_EQ(cuda::std::bit_cast<uint32_t>(fp16), cuda::std::bit_cast<uint32_t>(fp16_ref));
+    }
+    if (cuda::std::isnan(bf16_ref)) {
+      ASSERT_TRUE(cuda::std::isnan(bf16));
+    } else {
+      ASSERT_EQ(cuda::std::bit_cast<uint32_t>(bf16), cuda::std::bit_cast<uint32_t>(bf16_ref));
+    }
+  }
+
+  // Rounding from float must match round-to-nearest-even, including halfway cases and subnormals
+  for (uint32_t b = 0; b < 0xffffffffu - 4093u; b += 4093u) {
+    const float f = cuda::std::bit_cast<float>(b);
+    const auto fp16_ref = cuda::std::bit_cast<uint16_t>(__float2half_rn(f));
+    const auto bf16_ref = cuda::std::bit_cast<uint16_t>(__float2bfloat16_rn(f));
+    if (cuda::std::isnan(f)) {
+      ASSERT_TRUE(cuda::std::isnan(detail::fp16_bits_to_float(detail::float_to_fp16_bits(f))));
+      ASSERT_TRUE(cuda::std::isnan(detail::bf16_bits_to_float(detail::float_to_bf16_bits(f))));
+    } else {
+      ASSERT_EQ(detail::float_to_fp16_bits(f), fp16_ref);
+      ASSERT_EQ(detail::float_to_bf16_bits(f), bf16_ref);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, HalfElementwise)
+{
+  MATX_ENTER_HANDLER();
+
+  const index_t n = 1000;
+  HostExecutor<ThreadsMode::SELECT> exec{HostExecParams{4}};
+  auto a = make_tensor<matxFp16>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto b = make_tensor<matxFp16>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto c = make_tensor<matxFp16>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto ca = make_tensor<matxFp16Complex>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto cc = make_tensor<matxFp16Complex>({n}, MATX_HOST_MALLOC_MEMORY);
+
+  for (index_t i = 0; i < n; i++) {
+    a(i) = static_cast<float>(i) * 0.25f;
+    b(i) = 1.0f - static_cast<float>(i) * 0.001f;
+    ca(i) = matxFp16Complex{static_cast<float>(i % 17) * 0.5f, 1.0f - static_cast<float>(i % 5)};
+  }
+
+  (c = a * b + a).run(exec);
+  (cc = ca * ca - ca).run(exec);
+
+  for (index_t i = 0; i < n; i++) {
+    const float af = static_cast<float>(a(i));
+    const float bf = static_cast<float>(b(i));
+    const float prod = static_cast<float>(matxFp16{af * bf});
+    ASSERT_EQ(static_cast<float>(c(i)), static_cast<float>(matxFp16{prod + af}));
+
+    const cuda::std::complex<float> z{static_cast<float>(ca(i).real()), static_cast<float>(ca(i).imag())};
+    const cuda::std::complex<float> sq = z * z;
+    const cuda::std::complex<float> sqh{static_cast<float>(matxFp16{sq.real()}), static_cast<float>(matxFp16{sq.imag()})};
+    ASSERT_EQ(static_cast<float>(cc(i).real()), static_cast<float>(matxFp16{sqh.real() - z.real()}));
+    ASSERT_EQ(static_cast<float>(cc(i).imag()), static_cast<float>(matxFp16{sqh.imag() - z.imag()}));
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, ParallelReductions)
+{
+  MATX_ENTER_HANDLER();
+
+  // Large enough that a full reduction is split into chunks across the threads
+  const index_t n = 100003;
+  const index_t rows = 3;
+  HostExecutor<ThreadsMode::SELECT> exec{HostExecParams{4}};
+  auto a = make_tensor<int>({rows, n}, MATX_HOST_MALLOC_MEMORY);
+  for (index_t r = 0; r < rows; r++) {
+    for (index_t i = 0; i < n; i++) {
+      a(r, i) = static_cast<int>((i * 7919 + r) % 1000) - 500;
+    }
+  }
+  // Repeated extremes check that ties resolve to the first index
+  a(1, 500) = 5000;
+  a(1, 90000) = 5000;
+  a(2, 700) = -5000;
+  a(2, 80000) = -5000;
+
+  auto s0 = make_tensor<int>({}, MATX_HOST_MALLOC_MEMORY);
+  auto mn = make_tensor<int>({rows}, MATX_HOST_MALLOC_MEMORY);
+  auto mx = make_tensor<int>({rows}, MATX_HOST_MALLOC_MEMORY);
+  auto mni = make_tensor<index_t>({rows}, MATX_HOST_MALLOC_MEMORY);
+  auto mxi = make_tensor<index_t>({rows}, MATX_HOST_MALLOC_MEMORY);
+  auto anyv = make_tensor<bool>({}, MATX_HOST_MALLOC_MEMORY);
+
+  (s0 = sum(a)).run(exec);
+  (mtie(mn, mni, mx, mxi) = argminmax(a, {1})).run(exec);
+  (anyv = any(a == 5000)).run(exec);
+
+  long long ref_sum = 0;
+  for (index_t r = 0; r < rows; r++) {
+    index_t ref_mni = 0, ref_mxi = 0;
+    for (index_t i = 0; i < n; i++) {
+      ref_sum += a(r, i);
+      if (a(r, i) < a(r, ref_mni)) ref_mni = i;
+      if (a(r, i) > a(r, ref_mxi)) ref_mxi = i;
+    }
+    ASSERT_EQ(mn(r), a(r, ref_mni));
+    ASSERT_EQ(mx(r), a(r, ref_mxi));
+    ASSERT_EQ(mni(r), r * n + ref_mni);
+    ASSERT_EQ(mxi(r), r * n + ref_mxi);
+  }
+  ASSERT_EQ(s0(), static_cast<int>(ref_sum));
+  ASSERT_TRUE(anyv());
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, ParallelSort)
+{
+  MATX_ENTER_HANDLER();
+
+  // One long row is sorted in chunks that are merged, two short rows are sorted whole
+  const index_t n = 200003;
+  HostExecutor<ThreadsMode::SELECT> exec{HostExecParams{4}};
+  auto a = make_tensor<int>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto s = make_tensor<int>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto idx = make_tensor<index_t>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto a2 = make_tensor<int>({2, 1000}, MATX_HOST_MALLOC_MEMORY);
+  auto s2 = make_tensor<int>({2, 1000}, MATX_HOST_MALLOC_MEMORY);
+  auto u = make_tensor<int>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto num = make_tensor<int>({}, MATX_HOST_MALLOC_MEMORY);
+
+  for (index_t i = 0; i < n; i++) {
+    a(i) = static_cast<int>((i * 7919) % 5003);
+  }
+  for (index_t i = 0; i < 1000; i++) {
+    a2(0, i) = static_cast<int>((i * 31) % 97);
+    a2(1, i) = static_cast<int>((i * 17) % 89);
+  }
+
+  (s = sort(a, SORT_DIR_ASC)).run(exec);
+  (idx = argsort(a, SORT_DIR_DESC)).run(exec);
+  (s2 = sort(a2, SORT_DIR_DESC)).run(exec);
+  (mtie(u, num) = unique(a)).run(exec);
+
+  for (index_t i = 1; i < n; i++) {
+    ASSERT_LE(s(i - 1), s(i));
+    ASSERT_GE(a(idx(i - 1)), a(idx(i)));
+  }
+  for (index_t r = 0; r < 2; r++) {
+    for (index_t i = 1; i < 1000; i++) {
+      ASSERT_GE(s2(r, i - 1), s2(r, i));
+    }
+  }
+  ASSERT_EQ(num(), 5003);
+  for (index_t i = 0; i < num(); i++) {
+    ASSERT_EQ(u(i), i);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, ParallelFind)
+{
+  MATX_ENTER_HANDLER();
+
+  const index_t n = 100003;
+  HostExecutor<ThreadsMode::SELECT> exec{HostExecParams{4}};
+  auto a = make_tensor<float>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto vals = make_tensor<float>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto idx = make_tensor<int>({n}, MATX_HOST_MALLOC_MEMORY);
+  auto num_vals = make_tensor<int>({}, MATX_HOST_MALLOC_MEMORY);
+  auto num_idx = make_tensor<int>({}, MATX_HOST_MALLOC_MEMORY);
+
+  for (index_t i = 0; i < n; i++) {
+    a(i) = static_cast<float>((i * 7919) % 1000);
+  }
+
+  (mtie(vals, num_vals) = find(a, GT{900.0f})).run(exec);
+  (mtie(idx, num_idx) = find_idx(a, GT{900.0f})).run(exec);
+
+  // Matches must come out in input order, as with a serial scan
+  int cnt = 0;
+  for (index_t i = 0; i < n; i++) {
+    if (a(i) > 900.0f) {
+      ASSERT_EQ(vals(cnt), a(i));
+      ASSERT_EQ(idx(cnt), static_cast<int>(i));
+      cnt++;
+    }
+  }
+  ASSERT_EQ(num_vals(), cnt);
+  ASSERT_EQ(num_idx(), cnt);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(HostExecutorTests, HybridBatchSplit)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t batches = 64;
+  constexpr index_t len = 4096;
+  auto in = make_tensor<float>({batches, len}, MATX_HOST_MEMORY);
+  auto out = make_tensor<float>({batches, len}, MATX_HOST_MEMORY);
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < len; i++) {
+      in(b, i) = static_cast<float>(b + i % 16);
+    }
+  }
+
+  // example-begin hybrid-batch-test-1
+  hybridBatchExecutor<SelectThreadsHostExecutor> hybrid{cudaExecutor{}, SelectThreadsHostExecutor{HostExecParams{4}}, 0.25};
+  hybrid.run(batches, [&](index_t begin, index_t end, auto &exec) {
+    auto in_s = slice<2>(in, {begin, 0}, {end, matxEnd});
+    auto out_s = slice<2>(out, {begin, 0}, {end, matxEnd});
+    (out_s = in_s * 2.0f + 1.0f).run(exec);
+  });
+  // example-end hybrid-batch-test-1
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < len; i++) {
+      ASSERT_EQ(out(b, i), in(b, i) * 2.0f + 1.0f);
+    }
+  }
+
+  // Both sides did work, so the split was updated from the measurement
+  ASSERT_NE(hybrid.host_fraction(), 0.25);
+  ASSERT_GE(hybrid.host_fraction(), 0.0);
+  ASSERT_LE(hybrid.host_fraction(), 1.0);
+
+  // All on one side
+  hybrid.set_host_fraction(1.0);
+  (out = zeros<float>({batches, len})).run(SingleThreadedHostExecutor{});
+  hybrid.run(batches, [&](index_t begin, index_t end, auto &exec) {
+    auto out_s = slice<2>(out, {begin, 0}, {end, matxEnd});
+    (out_s = ones<float>({end - begin, len})).run(exec);
+  });
+  ASSERT_EQ(out(0, 0), 1.0f);
+  ASSERT_EQ(out(batches - 1, len - 1), 1.0f);
+  ASSERT_EQ(hybrid.host_fraction(), 1.0);
+
+  MATX_EXIT_HANDLER();
+}
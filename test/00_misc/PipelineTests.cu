@@ -0,0 +1,358 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <coroutine>
+#include <thread>
+
+using namespace matx;
+
+namespace {
+// Minimal fire-and-forget coroutine for awaiting completions in tests
+struct DetachedTask {
+  struct promise_type {
+    DetachedTask get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+}
+
+TEST(PipelineTests, ProducerConsumer)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t len = 1 << 16;
+  constexpr int iterations = 10;
+
+  // example-begin host-pipeline-test-1
+  hostDevicePipeline<float, 1> pipe({len}, {len},
+    [](tensor_t<float, 1> &out, const tensor_t<float, 1> &in, cudaExecutor &exec) {
+      (out = in * 2.0f + 1.0f).run(exec);
+    });
+
+  // Producer thread filling pinned input buffers, as an ingest thread would
+  std::thread producer([&]() {
+    for (int it = 0; it < iterations; it++) {
+      const int slot = pipe.AcquireInput();
+      auto &in = pipe.HostInput(slot);
+      for (index_t i = 0; i < len; i++) {
+        in(i) = static_cast<float>(it);
+      }
+      pipe.Submit(slot);
+    }
+    pipe.Close();
+  });
+
+  // Consumer receiving outputs in submission order
+  int received = 0;
+  for (int slot = pipe.AcquireOutput(); slot >= 0; slot = pipe.AcquireOutput()) {
+    const auto &out = pipe.HostOutput(slot);
+    EXPECT_EQ(out(0), static_cast<float>(received) * 2.0f + 1.0f);
+    EXPECT_EQ(out(len - 1), static_cast<float>(received) * 2.0f + 1.0f);
+    pipe.ReleaseOutput(slot);
+    received++;
+  }
+  producer.join();
+  // example-end host-pipeline-test-1
+
+  ASSERT_EQ(received, iterations);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(PipelineTests, CrossStreamDependencies)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t len = 1 << 22;
+  cudaStream_t stream_a, stream_b;
+  cudaStreamCreate(&stream_a);
+  cudaStreamCreate(&stream_b);
+  cudaExecutor exec_a{stream_a};
+  cudaExecutor exec_b{stream_b};
+  exec_a.set_track_dependencies(true);
+  exec_b.set_track_dependencies(true);
+
+  auto x = make_tensor<float>({len});
+  auto y = make_tensor<float>({len});
+  auto z = make_tensor<float>({len});
+
+  // Long producer chain on stream A, consumers on stream B with no explicit events
+  (x = ones<float>({len})).run(exec_a);
+  for (int i = 0; i < 20; i++) {
+    (x = x + 1.0f).run(exec_a);
+  }
+  (y = x * 2.0f).run(exec_b);
+
+  // Writing half of y on A must wait for B, and the other half keeps B as its writer
+  (slice(y, {0}, {len / 2}) = zeros<float>({len / 2})).run(exec_a);
+  (z = y + 1.0f).run(exec_b);
+  exec_b.sync();
+
+  ASSERT_EQ(z(0), 1.0f);
+  ASSERT_EQ(z(len / 2 - 1), 1.0f);
+  ASSERT_EQ(z(len / 2), 43.0f);
+  ASSERT_EQ(z(len - 1), 43.0f);
+
+  exec_a.sync();
+  cudaStreamDestroy(stream_a);
+  cudaStreamDestroy(stream_b);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(PipelineTests, SkipUnchangedTransforms)
+{
+  MATX_ENTER_HANDLER();
+
+  cudaExecutor exec{};
+  SetTransformMemoization(true);
+
+  auto x = make_tensor<cuda::std::complex<float>>({64});
+  auto X = make_tensor<cuda::std::complex<float>>({64});
+  (x = ones<cuda::std::complex<float>>({64})).run(exec);
+
+  (X = fft(x)).run(exec);
+  exec.sync();
+  ASSERT_EQ(X(0).real(), 64.0f);
+
+  // A host write that is not marked is invisible to memoization, which shows the second run was skipped
+  X(0) = {-1.0f, 0.0f};
+  (X = fft(x)).run(exec);
+  exec.sync();
+  ASSERT_EQ(X(0).real(), -1.0f);
+
+  // Marking the output as written runs the transform again
+  MarkModified(X);
+  (X = fft(x)).run(exec);
+  exec.sync();
+  ASSERT_EQ(X(0).real(), 64.0f);
+
+  // So does writing an input through run()
+  (x = x * 2.0f).run(exec);
+  (X = fft(x)).run(exec);
+  exec.sync();
+  ASSERT_EQ(X(0).real(), 128.0f);
+
+  // A view of the same memory with a different layout is a different input
+  auto A = make_tensor<float>({2, 2});
+  auto Ainv = make_tensor<float>({2, 2});
+  A(0, 0) = 1.0f; A(0, 1) = 2.0f;
+  A(1, 0) = 0.0f; A(1, 1) = 1.0f;
+  MarkModified(A);
+  (Ainv = inv(A)).run(exec);
+  (Ainv = inv(transpose(A))).run(exec);
+  exec.sync();
+  ASSERT_NEAR(Ainv(1, 0), -2.0f, 1e-5f);
+  ASSERT_NEAR(Ainv(0, 1), 0.0f, 1e-5f);
+
+  SetTransformMemoization(false);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(PipelineTests, CompletionCallbacks)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t len = 1 << 20;
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  auto x = make_tensor<float>({len});
+
+  // example-begin completion-test-1
+  std::atomic<int> callbacks{0};
+  (x = ones<float>({len})).run(exec);
+  exec.then([&] { callbacks++; });
+
+  auto done = exec.record();
+  done.wait();
+  ASSERT_TRUE(done.ready());
+  ASSERT_EQ(x(len - 1), 1.0f);
+  // example-end completion-test-1
+
+  // Continuations added after the completion fired run immediately
+  done.then([&] { callbacks++; });
+  ASSERT_EQ(callbacks.load(), 2);
+
+  // A coroutine suspended on the completion resumes once the work has finished
+  std::atomic<bool> resumed{false};
+  (x = x + 1.0f).run(exec);
+  auto task = [](cudaCompletion c, std::atomic<bool> &flag) -> DetachedTask {
+    co_await c;
+    flag = true;
+  };
+  auto second = exec.record();
+  task(second, resumed);
+  second.wait();
+  exec.sync();
+  ASSERT_TRUE(resumed.load());
+  ASSERT_EQ(x(0), 2.0f);
+
+  cudaStreamDestroy(stream);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(PipelineTests, PriorityAndPartitionExecutors)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t len = 1 << 20;
+  int least, greatest;
+  cudaDeviceGetStreamPriorityRange(&least, &greatest);
+
+  auto x = make_tensor<float>({len});
+
+  // High priority stream for latency-critical work
+  cudaExecutor fast{cudaExecutorParams{.priority = greatest}};
+  (x = ones<float>({len})).run(fast);
+  fast.sync();
+  ASSERT_EQ(fast.get_priority(), greatest);
+  ASSERT_EQ(fast.get_sm_count(), 0);
+  ASSERT_EQ(x(len - 1), 1.0f);
+
+  // Copies share the owned stream
+  cudaExecutor copy = fast;
+  ASSERT_EQ(copy.getStream(), fast.getStream());
+
+#if CUDA_VERSION >= 12050
+  int dev, sms;
+  cudaGetDevice(&dev);
+  cudaDeviceGetAttribute(&sms, cudaDevAttrMultiProcessorCount, dev);
+  if (sms >= 16) {
+    // example-begin partition-executor-test-2
+    cudaExecutor detector{cudaExecutorParams{.priority = greatest, .sm_count = 8}};
+    cudaExecutor bulk{cudaExecutorParams{.sm_count = 8, .remaining = true}};
+    // example-end partition-executor-test-2
+    ASSERT_GE(detector.get_sm_count(), 8);
+    ASSERT_LE(detector.get_sm_count() + bulk.get_sm_count(), sms);
+
+    (x = x + 1.0f).run(bulk);
+    bulk.sync();
+    (x = x * 2.0f).run(detector);
+    detector.sync();
+    ASSERT_EQ(x(0), 4.0f);
+    ASSERT_EQ(x(len - 1), 4.0f);
+  }
+#endif
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(PipelineTests, ReceiveRing)
+{
+  MATX_ENTER_HANDLER();
+
+  // 8 slots of 64-byte header plus 256 complex samples, padded to 2304 bytes
+  using T = cuda::std::complex<float>;
+  constexpr index_t slots = 8;
+  constexpr index_t header = 64;
+  constexpr index_t spp = 256;
+  constexpr index_t slot_bytes = 2304;
+
+  uint8_t *ring;
+  uint32_t *flags;
+  cudaMalloc(&ring, slots * slot_bytes);
+  cudaMalloc(&flags, slots * sizeof(uint32_t));
+  cudaMemset(flags, 0, slots * sizeof(uint32_t));
+
+  // Host image of the packets the NIC would write, with headers full of garbage
+  std::vector<uint8_t> image(slots * slot_bytes, 0xAB);
+  for (index_t p = 0; p < slots; p++) {
+    T *payload = reinterpret_cast<T *>(image.data() + p * slot_bytes + header);
+    for (index_t i = 0; i < spp; i++) {
+      payload[i] = T(static_cast<float>(p * spp + i), 0.0f);
+    }
+  }
+
+  cudaStream_t nic_stream, stream;
+  cudaStreamCreateWithFlags(&nic_stream, cudaStreamNonBlocking);
+  cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking);
+  cudaExecutor exec{stream};
+  auto out = make_tensor<T>({4 * spp});
+
+  // example-begin rx-ring-test-1
+  rxRing<T> rx(ring, flags, slots, slot_bytes, header, spp);
+
+  // Packets 6..9 wrap the ring. The consumer waits on the device for their flags
+  rx.Wait(6, 4, exec);
+  (out = rx.Samples(6, 4)).run(exec);
+  rx.Release(6, 4, exec);
+  // example-end rx-ring-test-1
+
+  // The "NIC" delivers the payloads and then raises the flags, after the consumer was queued
+  std::vector<uint32_t> ones_h(slots, 1);
+  cudaMemcpyAsync(ring, image.data(), slots * slot_bytes, cudaMemcpyHostToDevice, nic_stream);
+  cudaMemcpyAsync(flags, ones_h.data(), slots * sizeof(uint32_t), cudaMemcpyHostToDevice, nic_stream);
+  cudaStreamSynchronize(nic_stream);
+  exec.sync();
+
+  for (index_t i = 0; i < 4 * spp; i++) {
+    const index_t p = (6 + i / spp) % slots;
+    ASSERT_EQ(out(i), T(static_cast<float>(p * spp + i % spp), 0.0f));
+  }
+
+  // Released flags are cleared and the others stay set
+  std::vector<uint32_t> flags_h(slots);
+  cudaMemcpy(flags_h.data(), flags, slots * sizeof(uint32_t), cudaMemcpyDeviceToHost);
+  for (index_t p = 0; p < slots; p++) {
+    ASSERT_EQ(flags_h[p], (p >= 6 || p < 2) ? 0u : 1u);
+  }
+
+  // Strided per-packet view skips the headers
+  auto pk = rx.Packets(2, 3);
+  auto sums = make_tensor<T>({3});
+  (sums = sum(pk, {1})).run(exec);
+  exec.sync();
+  for (index_t p = 0; p < 3; p++) {
+    const float base = static_cast<float>((p + 2) * spp);
+    ASSERT_EQ(sums(p).real(), base * spp + static_cast<float>(spp * (spp - 1) / 2));
+  }
+
+  cudaStreamDestroy(nic_stream);
+  cudaStreamDestroy(stream);
+  cudaFree(ring);
+  cudaFree(flags);
+
+  MATX_EXIT_HANDLER();
+}
@@ -365,3 +365,53 @@ TEST(ProfilingTests, DefaultStreamProfilingTest)
   
   MATX_EXIT_HANDLER();
 }
+
+// Test the per-operator profiler
+TEST(ProfilingTests, OpProfilerTest)
+{
+  MATX_ENTER_HANDLER();
+
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  const index_t N = 1 << 20;
+  auto a = make_tensor<float>({N});
+  auto b = make_tensor<float>({N});
+  auto c = make_tensor<float>({N});
+  (a = 1.0f).run(exec);
+  (b = 2.0f).run(exec);
+
+  // example-begin op-profiler-1
+  SetOpProfiling(true);
+  ResetOpProfile();
+
+  for (int i = 0; i < 10; i++) {
+    (c = a * b + a).run(exec);
+  }
+
+  SetOpProfiling(false);
+  // Per-operator time, bandwidth, flops and launch dimensions, slowest first
+  auto profile = GetOpProfile();
+  std::cout << OpProfileReport();
+  // example-end op-profiler-1
+
+  ASSERT_EQ(profile.size(), 1u);
+  EXPECT_EQ(profile[0].calls, 10u);
+  EXPECT_GT(profile[0].total_ms, 0.0);
+  EXPECT_GT(profile[0].grid.x, 0u);
+  // a is referenced twice by the expression
+  EXPECT_EQ(profile[0].bytes_read, 10u * 3u * N * sizeof(float));
+  EXPECT_EQ(profile[0].bytes_written, 10u * N * sizeof(float));
+  EXPECT_EQ(profile[0].flops, 10.0 * 2.0 * static_cast<double>(N));
+
+  // Nothing is recorded once profiling is disabled
+  (c = a + b).run(exec);
+  EXPECT_EQ(GetOpProfile().size(), 1u);
+  ResetOpProfile();
+  EXPECT_TRUE(GetOpProfile().empty());
+
+  cudaStreamDestroy(stream);
+
+  MATX_EXIT_HANDLER();
+}
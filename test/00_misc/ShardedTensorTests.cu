@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+TEST(ShardedTensorTests, ElementwiseAndReduce)
+{
+  MATX_ENTER_HANDLER();
+
+  int num_devices = 0;
+  cudaGetDeviceCount(&num_devices);
+  const std::vector<int> devices = num_devices >= 2 ? std::vector<int>{0, 1} : std::vector<int>{0, 0};
+
+  constexpr index_t rows = 101;
+  constexpr index_t cols = 64;
+  auto host = make_tensor<float>({rows, cols}, MATX_HOST_MEMORY);
+  for (index_t i = 0; i < rows; i++) {
+    for (index_t j = 0; j < cols; j++) {
+      host(i, j) = static_cast<float>((i * cols + j) % 17) - 8.0f;
+    }
+  }
+
+  // example-begin sharded-tensor-test-1
+  auto a = make_sharded_tensor<float>({rows, cols}, devices);
+  auto b = make_sharded_tensor<float>({rows, cols}, devices);
+  a.Scatter(host);
+
+  // Element-wise work runs on each shard's device and stream
+  for_each_shard(b, [&](int s, auto &shard, auto &exec) {
+    (shard = a.Shard(s) * 2.0f + 1.0f).run(exec);
+  });
+  b.Sync();
+
+  // Reductions finish on the host from one partial result per shard
+  float total = sharded_sum(b);
+  float largest = sharded_max(b);
+  // example-end sharded-tensor-test-1
+
+  ASSERT_EQ(a.NumShards(), 2);
+  ASSERT_EQ(a.Shard(0).Size(0), 51);
+  ASSERT_EQ(a.Shard(1).Size(0), 50);
+  ASSERT_EQ(a.ShardOffset(1), 51);
+
+  auto out = make_tensor<float>({rows, cols}, MATX_HOST_MEMORY);
+  b.Gather(out);
+
+  float ref_total = 0.0f;
+  float ref_max = -1e9f;
+  float ref_min = 1e9f;
+  for (index_t i = 0; i < rows; i++) {
+    for (index_t j = 0; j < cols; j++) {
+      const float v = host(i, j) * 2.0f + 1.0f;
+      ASSERT_EQ(out(i, j), v);
+      ref_total += v;
+      ref_max = std::max(ref_max, v);
+      ref_min = std::min(ref_min, v);
+    }
+  }
+
+  ASSERT_NEAR(total, ref_total, 1e-2);
+  ASSERT_EQ(largest, ref_max);
+  ASSERT_EQ(sharded_min(b), ref_min);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(ShardedTensorTests, MultiGpuExecutor)
+{
+  MATX_ENTER_HANDLER();
+
+  int num_devices = 0;
+  cudaGetDeviceCount(&num_devices);
+  const std::vector<int> devices = num_devices >= 2 ? std::vector<int>{0, 1} : std::vector<int>{0, 0};
+
+  constexpr index_t batches = 37;
+  constexpr index_t n = 256;
+  using complex = cuda::std::complex<float>;
+  auto in = make_tensor<complex>({batches, n}, MATX_HOST_MEMORY);
+  auto out = make_tensor<complex>({batches, n}, MATX_MANAGED_MEMORY);
+  auto ref = make_tensor<complex>({batches, n}, MATX_MANAGED_MEMORY);
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < n; i++) {
+      in(b, i) = complex(static_cast<float>((b * n + i) % 13) - 6.0f, static_cast<float>((b + i) % 5));
+    }
+  }
+
+  cudaExecutor exec{};
+  (ref = fft(in)).run(exec);
+  exec.sync();
+
+  // example-begin multi-gpu-executor-test-1
+  multiGpuExecutor multi{devices};
+  multi.run(batches, [&](index_t begin, index_t end, auto &dev_exec) {
+    // Host input is copied to the device owning this range, the managed output is written in place
+    auto in_s = multi.stage(slice<2>(in, {begin, 0}, {end, matxEnd}), dev_exec);
+    auto out_s = slice<2>(out, {begin, 0}, {end, matxEnd});
+    (out_s = fft(in_s)).run(dev_exec);
+  });
+  // example-end multi-gpu-executor-test-1
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < n; i++) {
+      ASSERT_NEAR(out(b, i).real(), ref(b, i).real(), 1e-3) << b << " " << i;
+      ASSERT_NEAR(out(b, i).imag(), ref(b, i).imag(), 1e-3) << b << " " << i;
+    }
+  }
+
+  // Fewer batches than devices leaves the extra devices idle
+  (out = zeros<complex>({batches, n})).run(exec);
+  exec.sync();
+  multi.run(1, [&](index_t begin, index_t end, auto &dev_exec) {
+    auto out_s = slice<2>(out, {begin, 0}, {end, matxEnd});
+    (out_s = ones<complex>({end - begin, n})).run(dev_exec);
+  });
+  ASSERT_EQ(out(0, n - 1).real(), 1.0f);
+  ASSERT_EQ(out(1, 0).real(), 0.0f);
+
+  MATX_EXIT_HANDLER();
+}
@@ -136,6 +136,45 @@ TYPED_TEST(BasicGeneratorTestsFloatNonComplex, Windows)
   MATX_EXIT_HANDLER();  
 }
 
+TYPED_TEST(BasicGeneratorTestsFloatNonComplex, WindowTables)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;  
+  ExecType exec{};
+
+  auto pb = std::make_unique<detail::MatXPybind>();
+  const index_t win_size = 100;
+  pb->InitAndRunTVGenerator<TestType>("00_operators", "window", "run",
+                                       {win_size});
+  auto ov = make_tensor<TestType>({win_size});
+
+  // example-begin window-table-test-1
+  // Tabulate a Hanning window once and reuse it on every later call
+  auto win = window_table<TestType>(WindowType::HANNING, win_size, exec);
+  (ov = win).run(exec);
+  // example-end window-table-test-1
+  MATX_TEST_ASSERT_COMPARE(pb, ov, "hanning", 0.01);
+
+  // A second lookup with the same key returns the cached table
+  auto win2 = window_table<TestType>(WindowType::HANNING, win_size, exec);
+  ASSERT_EQ(win.Data(), win2.Data());
+
+  const std::pair<WindowType, const char *> windows[] = {
+    {WindowType::HAMMING, "hamming"},
+    {WindowType::BARTLETT, "bartlett"},
+    {WindowType::BLACKMAN, "blackman"},
+    {WindowType::FLATTOP, "flattop"},
+  };
+  for (const auto &[type, name] : windows) {
+    (ov = window_table<TestType>(type, win_size, exec)).run(exec);
+    MATX_TEST_ASSERT_COMPARE(pb, ov, name, 0.01);
+  }
+
+  MATX_EXIT_HANDLER();  
+}
+
 TYPED_TEST(BasicGeneratorTestsAll, Diag)
 {
   using TestType = cuda::std::tuple_element_t<0, TypeParam>;
@@ -777,4 +816,37 @@ TYPED_TEST(BasicGeneratorTestsFloatNonComplexNonHalf, Chirp)
   MATX_EXIT_HANDLER();
 }
 
+TEST(ChirpTests, FloatFloatPhase)
+{
+  MATX_ENTER_HANDLER();
+  cudaExecutor exec{};
+
+  const index_t count = index_t{1} << 24;
+  const float end = 10.0f;
+  const float f0 = 1000.0f;
+  const float f1 = 2e6f;
+
+  // example-begin chirp-gen-test-2
+  auto t1 = make_tensor<float>({count});
+  auto t1c = make_tensor<cuda::std::complex<float>>({count});
+  // The phase is tracked from the sample index in float-float, so it stays accurate over millions of cycles
+  (t1 = chirp(count, end, f0, end, f1, ChirpMethod::CHIRP_METHOD_LINEAR, PhaseAccuracy::FLTFLT)).run(exec);
+  (t1c = cchirp(count, end, f0, end, f1, ChirpMethod::CHIRP_METHOD_LINEAR, PhaseAccuracy::FLTFLT)).run(exec);
+  // example-end chirp-gen-test-2
+  exec.sync();
+
+  const double dt = static_cast<double>(end) / static_cast<double>(count - 1);
+  const double k = (static_cast<double>(f1) - static_cast<double>(f0)) / static_cast<double>(end);
+  for (index_t i = 0; i < count; i += 4099) {
+    const double t = static_cast<double>(i) * dt;
+    const double cycles = static_cast<double>(f0) * t + 0.5 * k * t * t;
+    const double angle = 2.0 * M_PI * (cycles - std::floor(cycles));
+    ASSERT_NEAR(t1(i), std::cos(angle), 1e-3) << i;
+    ASSERT_NEAR(t1c(i).real(), std::cos(angle), 1e-3) << i;
+    ASSERT_NEAR(t1c(i).imag(), std::sin(angle), 1e-3) << i;
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 
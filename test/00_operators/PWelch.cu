@@ -191,3 +191,42 @@ TEST(PWelchOpTest, xin_complex_float)
     EXPECT_NEAR(Pxx(k), 0, thresh) << "failure at index k=" << k;
   }
 }
+
+TEST(PWelchOpTest, accumulator_matches_pwelch)
+{
+  MATX_ENTER_HANDLER();
+  index_t signal_size = 1000;
+  index_t nperseg = 64;
+  index_t noverlap = 16;
+  index_t nfft = 128;
+  cudaExecutor exec{};
+
+  auto x = make_tensor<cuda::std::complex<float>>({signal_size});
+  (x = random<cuda::std::complex<float>>({signal_size}, NORMAL)).run(exec);
+  auto w = make_tensor<float>({nperseg});
+  (w = hanning<0,1,float>({nperseg})).run(exec);
+
+  auto Pxx = make_tensor<float>({nfft});
+  (Pxx = pwelch(x, w, nperseg, noverlap, nfft, PwelchOutputScaleMode_Density, 2.0f)).run(exec);
+
+  // example-begin pwelch-test-2
+  // Feed the same samples in uneven blocks and read the running estimate at the end
+  auto Pxx_running = make_tensor<float>({nfft});
+  experimental::PwelchAccumulator<cuda::std::complex<float>, decltype(w)> acc(nperseg, noverlap, nfft, w, exec.getStream());
+  const index_t blocks[] = {10, 200, 63, 1, 400, 326};
+  index_t start = 0;
+  for (index_t len : blocks) {
+    acc.Update(slice(x, {start}, {start + len}));
+    start += len;
+  }
+  acc.Estimate(Pxx_running, PwelchOutputScaleMode_Density, 2.0f);
+  // example-end pwelch-test-2
+
+  exec.sync();
+
+  ASSERT_EQ(acc.Segments(), (signal_size - nperseg) / (nperseg - noverlap) + 1);
+  for (index_t k = 0; k < nfft; k++) {
+    EXPECT_NEAR(Pxx_running(k), Pxx(k), 1e-3f * std::max(1.0f, std::abs(Pxx(k)))) << "failure at index k=" << k;
+  }
+  MATX_EXIT_HANDLER();
+}
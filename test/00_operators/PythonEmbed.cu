@@ -41,3 +41,51 @@ TEST(BasicPythonTest, Print)
   pb.InitAndRunTVGenerator<int>("00_python_tests", "matx_python_tests", "run",
                                 {});
 }
+
+TEST(BasicPythonTest, TensorViewToNumpyAsync)
+{
+  MATX_ENTER_HANDLER();
+  auto pb = detail::MatXPybind{};
+  cudaExecutor exec{};
+
+  auto t = make_tensor<float>({4, 8}, MATX_DEVICE_MEMORY);
+  (t = reshape<2>(linspace(0.0f, 31.0f, 32), {4, 8})).run(exec);
+
+  auto transfer = pb.TensorViewToNumpyAsync(t, exec.getStream());
+  auto arr = pybind11::array_t<float>(transfer.get());
+  ASSERT_TRUE(transfer.ready());
+  ASSERT_EQ(arr.ndim(), 2);
+  ASSERT_EQ(arr.shape(0), 4);
+  ASSERT_EQ(arr.shape(1), 8);
+  for (index_t i = 0; i < 4; i++) {
+    for (index_t j = 0; j < 8; j++) {
+      ASSERT_EQ(arr.at(i, j), static_cast<float>(i * 8 + j));
+    }
+  }
+
+  // Device tensors passed to the synchronous path are staged the same way
+  auto arr_sync = pb.TensorViewToNumpy(t);
+  ASSERT_EQ(arr_sync.at(3, 7), 31.0f);
+  MATX_EXIT_HANDLER();
+}
+
+TEST(BasicPythonTest, TensorViewToCudaArrayInterface)
+{
+  MATX_ENTER_HANDLER();
+  auto pb = detail::MatXPybind{};
+  cudaExecutor exec{};
+
+  auto t = make_tensor<double>({3, 5}, MATX_DEVICE_MEMORY);
+  auto obj = pb.TensorViewToCudaArrayInterface(t, exec.getStream());
+  auto cai = obj.attr("__cuda_array_interface__").cast<pybind11::dict>();
+
+  ASSERT_EQ(cai["version"].cast<int>(), 3);
+  ASSERT_EQ(cai["typestr"].cast<std::string>(), "<f8");
+  ASSERT_EQ(cai["shape"].cast<std::tuple<index_t, index_t>>(), std::make_tuple(index_t{3}, index_t{5}));
+  ASSERT_EQ(cai["strides"].cast<std::tuple<index_t, index_t>>(),
+            std::make_tuple(index_t{5 * sizeof(double)}, index_t{sizeof(double)}));
+  auto data = cai["data"].cast<std::tuple<uintptr_t, bool>>();
+  ASSERT_EQ(std::get<0>(data), reinterpret_cast<uintptr_t>(t.Data()));
+  ASSERT_FALSE(std::get<1>(data));
+  MATX_EXIT_HANDLER();
+}
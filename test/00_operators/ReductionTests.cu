@@ -37,6 +37,9 @@
 #include "gtest/gtest.h"
 #include <type_traits>
 #include <random>
+#include <algorithm>
+#include <map>
+#include <vector>
 
 using namespace matx;
 
@@ -314,6 +317,48 @@ TYPED_TEST(ReductionTestsNumericNoHalfAllExecs, Sum)
 }
 
 
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, CompensatedSum)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+  constexpr index_t rows = 4;
+  constexpr index_t cols = 1 << 20;
+
+  auto a = make_tensor<TestType>({rows, cols});
+  std::vector<double> ref(rows, 0.0);
+  for (index_t r = 0; r < rows; r++) {
+    for (index_t c = 0; c < cols; c++) {
+      a(r, c) = static_cast<TestType>(0.1 + 1e-3 * static_cast<double>((c * 7 + r) % 13));
+      ref[r] += static_cast<double>(a(r, c));
+    }
+  }
+
+  // example-begin sum-test-3
+  // Accumulate float input as float-float pairs for close to double accuracy
+  auto rsum = make_tensor<TestType>({rows});
+  (rsum = sum(a, {1}, SumAccuracy::COMPENSATED)).run(exec);
+  // example-end sum-test-3
+
+  auto total = make_tensor<TestType>({});
+  auto avg = make_tensor<TestType>({rows});
+  (total = sum(a, SumAccuracy::COMPENSATED)).run(exec);
+  (avg = mean(a, {1}, SumAccuracy::COMPENSATED)).run(exec);
+  exec.sync();
+
+  double ref_total = 0.0;
+  for (index_t r = 0; r < rows; r++) {
+    ASSERT_NEAR(static_cast<double>(rsum(r)) / ref[r], 1.0, 1e-6) << "row " << r;
+    ASSERT_NEAR(static_cast<double>(avg(r)) / (ref[r] / static_cast<double>(cols)), 1.0, 1e-6) << "row " << r;
+    ref_total += ref[r];
+  }
+  ASSERT_NEAR(static_cast<double>(total()) / ref_total, 1.0, 1e-6);
+
+  MATX_EXIT_HANDLER();
+}
+
 // This works with half precision, but we need the proper test infrastructure to prevent compiling
 // half types for CCs that don't support it. Disable half on this test for now
 TYPED_TEST(ReductionTestsFloatNonComplex, Softmax)
@@ -350,6 +395,101 @@ TYPED_TEST(ReductionTestsFloatNonComplex, Softmax)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalf, SoftmaxOnlineRows)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  // Short rows are cached in shared memory and long rows are read twice
+  for (index_t cols : {index_t{300}, index_t{20000}}) {
+    constexpr index_t rows = 6;
+    auto t = make_tensor<TestType>({rows, cols});
+    auto out = make_tensor<TestType>({rows, cols});
+    auto mask = make_tensor<bool>({rows, cols});
+    auto out_masked = make_tensor<TestType>({rows, cols});
+    (t = random<TestType>({rows, cols}, NORMAL) * static_cast<TestType>(10)).run(exec);
+    exec.sync();
+
+    // Row 0 is fully masked, the others keep a growing prefix
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t c = 0; c < cols; c++) {
+        mask(r, c) = c < r * cols / rows;
+      }
+    }
+
+    (out = softmax(t, {1})).run(exec);
+    // example-begin softmax-test-3
+    (out_masked = softmax(t, mask, {1})).run(exec);
+    // example-end softmax-test-3
+    exec.sync();
+
+    for (index_t r = 0; r < rows; r++) {
+      double mx = -std::numeric_limits<double>::infinity();
+      double mx_masked = mx;
+      for (index_t c = 0; c < cols; c++) {
+        mx = std::max(mx, static_cast<double>(t(r, c)));
+        if (mask(r, c)) {
+          mx_masked = std::max(mx_masked, static_cast<double>(t(r, c)));
+        }
+      }
+      double sum = 0;
+      double sum_masked = 0;
+      for (index_t c = 0; c < cols; c++) {
+        sum += std::exp(static_cast<double>(t(r, c)) - mx);
+        if (mask(r, c)) {
+          sum_masked += std::exp(static_cast<double>(t(r, c)) - mx_masked);
+        }
+      }
+      for (index_t c = 0; c < cols; c++) {
+        const double ref = std::exp(static_cast<double>(t(r, c)) - mx) / sum;
+        const double ref_masked = mask(r, c) ? std::exp(static_cast<double>(t(r, c)) - mx_masked) / sum_masked : 0.0;
+        ASSERT_NEAR(static_cast<double>(out(r, c)), ref, 1e-5) << "row " << r << " col " << c;
+        ASSERT_NEAR(static_cast<double>(out_masked(r, c)), ref_masked, 1e-5) << "row " << r << " col " << c;
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalf, AsyncScalar)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+  constexpr index_t size = 1000;
+
+  auto a = make_tensor<TestType>({size});
+  auto b = make_tensor<TestType>({size});
+  (a = range<0>({size}, 1, 1)).run(exec);
+
+  // example-begin async-scalar-test-1
+  // Sum into mapped pinned memory and use the result on the device without a host sync
+  auto total = make_async_scalar<TestType>();
+  total.Run(sum(a), exec);
+  (b = a / total.Tensor()).run(exec);
+
+  // Poll without synchronizing the stream, then fetch once the reduction is done
+  while (!total.Ready()) {}
+  TestType host_total = total.Get();
+  // example-end async-scalar-test-1
+
+  ASSERT_NEAR(host_total, static_cast<TestType>(size * (size + 1) / 2), 1e-3);
+
+  // Device-resident scalar copied to a pinned shadow on Record()
+  auto peak = make_async_scalar<TestType>(MATX_ASYNC_DEVICE_MEMORY, exec.getStream());
+  (peak.Tensor() = max(b)).run(exec);
+  peak.Record(exec);
+  ASSERT_NEAR(peak.Get(), static_cast<TestType>(size) / host_total, 1e-6);
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, PermutedReduce)
 {
   MATX_ENTER_HANDLER();
@@ -873,6 +1013,53 @@ TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, Median)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, MedianPercentileBatched)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  // Rows with negative values and many duplicates, with even and odd lengths
+  for (const index_t cols : {1000, 1001}) {
+    const index_t rows = 7;
+    auto t2 = make_tensor<TestType>({rows, cols});
+    auto tmed = make_tensor<TestType>({rows});
+    auto tpct = make_tensor<TestType>({rows});
+
+    std::vector<TestType> ref(cols);
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t c = 0; c < cols; c++) {
+        t2(r, c) = static_cast<TestType>(((c * 37 + r * 11) % 101) - 50) / static_cast<TestType>(4);
+      }
+    }
+
+    (tmed = median(t2, {1})).run(exec);
+    (tpct = percentile(t2, 30, {1}, PercentileMethod::LINEAR)).run(exec);
+    exec.sync();
+
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t c = 0; c < cols; c++) {
+        ref[c] = t2(r, c);
+      }
+      std::sort(ref.begin(), ref.end());
+
+      const TestType expected_med = (cols & 1) ? ref[cols / 2] :
+        (ref[cols / 2 - 1] + ref[cols / 2]) / static_cast<TestType>(2);
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(tmed(r), expected_med));
+
+      const double subidx = 0.3 * static_cast<double>(cols - 1);
+      const index_t k = static_cast<index_t>(subidx);
+      const TestType expected_pct = ref[k] +
+        static_cast<TestType>((subidx - std::floor(subidx)) * static_cast<double>(ref[k + 1] - ref[k]));
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(tpct(r), expected_pct));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, MinMaxNegative)
 {
   MATX_ENTER_HANDLER();
@@ -1185,6 +1372,73 @@ TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, ArgMinMax)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, Stats)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+  using T = TestType;
+
+  {
+    // example-begin stats-test-1
+    auto t0mean = make_tensor<TestType>({});
+    auto t0var = make_tensor<TestType>({});
+    auto t0min = make_tensor<TestType>({});
+    auto t0max = make_tensor<TestType>({});
+    auto t1 = make_tensor<TestType>({8});
+    t1.SetVals({(T)2, (T)4, (T)4, (T)4, (T)5, (T)5, (T)7, (T)9});
+
+    // Mean, variance, minimum and maximum from a single pass over "t1"
+    (mtie(t0mean, t0var, t0min, t0max) = stats(t1)).run(exec);
+    // example-end stats-test-1
+    exec.sync();
+
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0mean(), (TestType)(5)));
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0var(), (TestType)(32.0 / 7.0)));
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0min(), (TestType)(2)));
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0max(), (TestType)(9)));
+
+    (mtie(t0mean, t0var, t0min, t0max) = stats(t1, 0)).run(exec);
+    exec.sync();
+    EXPECT_TRUE(MatXUtils::MatXTypeCompare(t0var(), (TestType)(4)));
+  }
+
+  {
+    const int BATCHES = 6;
+    const int ROWS = 33;
+    const int COLUMNS = 47;
+    auto t3 = make_tensor<TestType>({BATCHES, ROWS, COLUMNS});
+    (t3 = random<TestType>(t3.Shape(), NORMAL)).run(exec);
+
+    auto smean = make_tensor<TestType>({BATCHES});
+    auto svar = make_tensor<TestType>({BATCHES});
+    auto smin = make_tensor<TestType>({BATCHES});
+    auto smax = make_tensor<TestType>({BATCHES});
+    auto rmean = make_tensor<TestType>({BATCHES});
+    auto rvar = make_tensor<TestType>({BATCHES});
+    auto rmin = make_tensor<TestType>({BATCHES});
+    auto rmax = make_tensor<TestType>({BATCHES});
+
+    (mtie(smean, svar, smin, smax) = stats(t3, {1, 2})).run(exec);
+    (rmean = mean(t3, {1, 2})).run(exec);
+    (rvar = var(t3, {1, 2})).run(exec);
+    (rmin = min(t3, {1, 2})).run(exec);
+    (rmax = max(t3, {1, 2})).run(exec);
+    exec.sync();
+
+    for (int n = 0; n < BATCHES; n++) {
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(smean(n), rmean(n), 1e-4));
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(svar(n), rvar(n), 1e-4));
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(smin(n), rmin(n)));
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(smax(n), rmax(n)));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, Mean)
 {
   MATX_ENTER_HANDLER();
@@ -1446,6 +1700,111 @@ TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, FindIdxAndSelect)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, FindIdxFirstN)
+{
+  MATX_ENTER_HANDLER();
+  {
+    using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+    using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+    tensor_t<int, 0> num_found{{}};
+    tensor_t<TestType, 1> t1{{100}};
+    tensor_t<int, 1> t1o_idx{{100}};
+    tensor_t<TestType, 1> t1o{{100}};
+    TestType thresh = (TestType)0.5;
+
+    ExecType exec{};
+
+    for (int i = 0; i < t1.Size(0); i++) {
+      t1(i) = static_cast<detail::value_promote_t<TestType>>((float)rand() /
+                                                      (float)INT_MAX * 2.0f);
+    }
+    (t1o_idx = 0).run(exec);
+    (t1o = static_cast<TestType>(-1)).run(exec);
+
+    // example-begin first_n-test-1
+    (mtie(t1o_idx, num_found) = find_idx(t1, GT{thresh})).run(exec);
+
+    // The number found stays on the device. Only the first num_found entries are gathered, with no
+    // synchronization in between
+    (t1o = first_n(select(t1, t1o_idx), num_found)).run(exec);
+    // example-end first_n-test-1
+    exec.sync();
+
+    int output_found = 0;
+    for (int i = 0; i < t1.Size(0); i++) {
+      if (t1(i) > thresh) {
+        ASSERT_EQ(t1o(output_found), t1(i));
+        output_found++;
+      }
+    }
+    ASSERT_EQ(output_found, num_found());
+
+    // The bounded launch leaves the tail untouched on the device
+    if constexpr (is_cuda_executor_v<ExecType>) {
+      for (int i = output_found; i < t1o.Size(0); i++) {
+        ASSERT_EQ(t1o(i), static_cast<TestType>(-1));
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, FindGather)
+{
+  MATX_ENTER_HANDLER();
+  {
+    using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+    using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+    ExecType exec{};
+
+    tensor_t<int, 0> num_found{{}};
+    tensor_t<TestType, 1> t1{{100}};
+    tensor_t<TestType, 1> t2{{100}};
+    tensor_t<TestType, 1> t1o{{100}};
+    tensor_t<int, 1> t1o_idx{{100}};
+    tensor_t<TestType, 1> t2o{{100}};
+    tensor_t<TestType, 1> t3o{{100}};
+
+    for (int i = 0; i < t1.Size(0); i++) {
+      t1(i) = static_cast<detail::value_promote_t<TestType>>((float)rand() /
+                                                      (float)INT_MAX * 2.0f);
+      t2(i) = static_cast<TestType>(i);
+    }
+
+    // example-begin find_gather-test-1
+    // Compact the values above 0.5, their indices, and two associated operators in one pass
+    TestType thresh = (TestType)0.5;
+    (mtie(t1o, t1o_idx, t2o, t3o, num_found) = find_gather(t1, GT{thresh}, t2, t1 * t2)).run(exec);
+    // example-end find_gather-test-1
+    exec.sync();
+
+    int output_found = 0;
+    for (int i = 0; i < t1.Size(0); i++) {
+      if (t1(i) > thresh) {
+        ASSERT_EQ(t1o_idx(output_found), i);
+        ASSERT_EQ(t1o(output_found), t1(i));
+        ASSERT_EQ(t2o(output_found), t2(i));
+        ASSERT_EQ(t3o(output_found), t1(i) * t2(i));
+        output_found++;
+      }
+    }
+    ASSERT_EQ(output_found, num_found());
+
+    // No extra operators behaves like find() and find_idx() together
+    (mtie(t1o, t1o_idx, num_found) = find_gather(t1, GT{thresh})).run(exec);
+    exec.sync();
+    ASSERT_EQ(output_found, num_found());
+    for (int i = 0; i < output_found; i++) {
+      ASSERT_EQ(t1o(i), t1(t1o_idx(i)));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, Unique)
 {
   MATX_ENTER_HANDLER();
@@ -1479,6 +1838,100 @@ TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, Unique)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, UniqueUnordered)
+{
+  MATX_ENTER_HANDLER();
+  {
+    using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+    using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+    ExecType exec{};
+
+    tensor_t<int, 0> num_found{{}};
+    tensor_t<TestType, 1> t1{{1000}};
+    tensor_t<TestType, 1> t1o{{1000}};
+
+    for (int i = 0; i < t1.Size(0); i++) {
+      t1(i) = (TestType)((i * 37) % 97);
+    }
+
+    // example-begin unique-test-2
+    // Unique values in any order from a hash table instead of a sort
+    (mtie(t1o, num_found) = unique(t1, UniqueMode::UNORDERED)).run(exec);
+    // example-end unique-test-2
+    exec.sync();
+
+    ASSERT_EQ(97, num_found());
+
+    std::vector<TestType> found(t1o.Data(), t1o.Data() + num_found());
+    std::sort(found.begin(), found.end());
+    for (int i = 0; i < 97; i++) {
+      ASSERT_EQ(found[i], (TestType)i);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, GroupByReduce)
+{
+  MATX_ENTER_HANDLER();
+  {
+    using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+    using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+    ExecType exec{};
+
+    const index_t n = 1000;
+    auto keys = make_tensor<int>({n});
+    auto vals = make_tensor<TestType>({n});
+    for (index_t i = 0; i < n; i++) {
+      keys(i) = static_cast<int>((i * 7) % 13) - 6;
+      vals(i) = static_cast<TestType>(i % 50);
+    }
+
+    // example-begin groupby-test-1
+    // Sum the values of each distinct key, e.g. the detections in each range bin
+    auto gkeys = make_tensor<int>({n});
+    auto gvals = make_tensor<TestType>({n});
+    auto gcounts = make_tensor<int>({n});
+    auto num_groups = make_tensor<int>({});
+    (mtie(gkeys, gvals, gcounts, num_groups) = groupby_reduce(keys, vals, GroupByOp::SUM)).run(exec);
+    // example-end groupby-test-1
+    exec.sync();
+
+    std::map<int, std::pair<TestType, int>> ref;
+    for (index_t i = 0; i < n; i++) {
+      ref[keys(i)].first += vals(i);
+      ref[keys(i)].second++;
+    }
+
+    ASSERT_EQ(num_groups(), static_cast<int>(ref.size()));
+    for (int g = 0; g < num_groups(); g++) {
+      ASSERT_EQ(ref.count(gkeys(g)), 1u);
+      ASSERT_NEAR(gvals(g), ref[gkeys(g)].first, 0.001);
+      ASSERT_EQ(gcounts(g), ref[gkeys(g)].second);
+    }
+
+    (mtie(gkeys, gvals, gcounts, num_groups) = groupby_reduce(keys, vals, GroupByOp::MAX)).run(exec);
+    exec.sync();
+
+    ASSERT_EQ(num_groups(), static_cast<int>(ref.size()));
+    for (int g = 0; g < num_groups(); g++) {
+      TestType mx = std::numeric_limits<TestType>::lowest();
+      for (index_t i = 0; i < n; i++) {
+        if (keys(i) == gkeys(g)) {
+          mx = std::max(mx, vals(i));
+        }
+      }
+      ASSERT_EQ(gvals(g), mx);
+      ASSERT_EQ(gcounts(g), ref[gkeys(g)].second);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, Trace)
 {
   using TestType = cuda::std::tuple_element_t<0, TypeParam>;
@@ -1504,3 +1957,159 @@ TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, Trace)
 }
 
 
+
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, ContiguousBatchedMatchesOperator)
+{
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec;
+
+  MATX_ENTER_HANDLER();
+
+  // A contiguous tensor is read through a raw pointer and an expression through an iterator, at any rank
+  auto t3 = make_tensor<TestType>({4, 6, 9});
+  auto out_tensor = make_tensor<TestType>({4, 6});
+  auto out_op = make_tensor<TestType>({4, 6});
+  auto idx_tensor = make_tensor<index_t>({4});
+  auto idx_op = make_tensor<index_t>({4});
+  auto max_tensor = make_tensor<TestType>({4});
+  auto max_op = make_tensor<TestType>({4});
+
+  for (index_t i = 0; i < t3.Size(0); i++) {
+    for (index_t j = 0; j < t3.Size(1); j++) {
+      for (index_t k = 0; k < t3.Size(2); k++) {
+        t3(i, j, k) = static_cast<TestType>((i * 7 + j * 5 + k * 3) % 11);
+      }
+    }
+  }
+
+  (out_tensor = min(t3, {2})).run(exec);
+  (out_op = min(t3 + static_cast<TestType>(0), {2})).run(exec);
+  (mtie(max_tensor, idx_tensor) = argmax(t3, {1, 2})).run(exec);
+  (mtie(max_op, idx_op) = argmax(t3 + static_cast<TestType>(0), {1, 2})).run(exec);
+  exec.sync();
+
+  for (index_t i = 0; i < out_tensor.Size(0); i++) {
+    for (index_t j = 0; j < out_tensor.Size(1); j++) {
+      ASSERT_EQ(out_tensor(i, j), out_op(i, j));
+    }
+    ASSERT_EQ(max_tensor(i), max_op(i));
+    ASSERT_EQ(idx_tensor(i), idx_op(i));
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, NonTrailingAxes)
+{
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec;
+
+  MATX_ENTER_HANDLER();
+
+  // Few outputs over a long outer axis, an inner axis reduced with an outer one, and a single column
+  auto t3 = make_tensor<TestType>({5000, 3, 4});
+  auto sum_outer = make_tensor<TestType>({3, 4});
+  auto max_mixed = make_tensor<TestType>({3});
+  auto sum_cols = make_tensor<TestType>({4});
+
+  for (index_t i = 0; i < t3.Size(0); i++) {
+    for (index_t j = 0; j < t3.Size(1); j++) {
+      for (index_t k = 0; k < t3.Size(2); k++) {
+        t3(i, j, k) = static_cast<TestType>((i + 2 * j + 3 * k) % 7);
+      }
+    }
+  }
+
+  (sum_outer = sum(t3, {0})).run(exec);
+  (max_mixed = max(t3, {0, 2})).run(exec);
+  (sum_cols = sum(t3, {0, 1})).run(exec);
+  exec.sync();
+
+  for (index_t j = 0; j < t3.Size(1); j++) {
+    TestType mx = t3(0, j, 0);
+    for (index_t k = 0; k < t3.Size(2); k++) {
+      TestType s = 0;
+      for (index_t i = 0; i < t3.Size(0); i++) {
+        s += t3(i, j, k);
+        mx = std::max(mx, t3(i, j, k));
+      }
+      ASSERT_EQ(sum_outer(j, k), s);
+    }
+    ASSERT_EQ(max_mixed(j), mx);
+  }
+
+  for (index_t k = 0; k < t3.Size(2); k++) {
+    TestType s = 0;
+    for (index_t i = 0; i < t3.Size(0); i++) {
+      for (index_t j = 0; j < t3.Size(1); j++) {
+        s += t3(i, j, k);
+      }
+    }
+    ASSERT_EQ(sum_cols(k), s);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ReductionTestsFloatNonComplexNonHalfAllExecs, ManyShortRows)
+{
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec;
+
+  MATX_ENTER_HANDLER();
+
+  // Row lengths for a thread, a warp and a block per row
+  const std::array<std::pair<index_t, index_t>, 3> shapes{{{3000, 4}, {1000, 64}, {20, 5000}}};
+  for (const auto &[rows, len] : shapes) {
+    auto t2 = make_tensor<TestType>({rows, len});
+    auto sums = make_tensor<TestType>({rows});
+    auto maxes = make_tensor<TestType>({rows});
+    auto vars = make_tensor<TestType>({rows});
+    auto amax = make_tensor<TestType>({rows});
+    auto amax_idx = make_tensor<index_t>({rows});
+
+    for (index_t i = 0; i < rows; i++) {
+      for (index_t j = 0; j < len; j++) {
+        t2(i, j) = static_cast<TestType>((3 * i + 5 * j) % 11);
+      }
+    }
+
+    (sums = sum(t2)).run(exec);
+    (maxes = max(t2)).run(exec);
+    (vars = var(t2)).run(exec);
+    (mtie(amax, amax_idx) = argmax(t2)).run(exec);
+    exec.sync();
+
+    for (index_t i = 0; i < rows; i++) {
+      TestType s = 0;
+      index_t best = 0;
+      for (index_t j = 0; j < len; j++) {
+        s += t2(i, j);
+        if (t2(i, j) > t2(i, best)) {
+          best = j;
+        }
+      }
+
+      double m2 = 0;
+      const double mean = static_cast<double>(s) / static_cast<double>(len);
+      for (index_t j = 0; j < len; j++) {
+        m2 += (static_cast<double>(t2(i, j)) - mean) * (static_cast<double>(t2(i, j)) - mean);
+      }
+
+      ASSERT_EQ(sums(i), s);
+      ASSERT_EQ(maxes(i), t2(i, best));
+      ASSERT_EQ(amax(i), t2(i, best));
+      // Ties go to the first element, and the index counts over the whole input
+      ASSERT_EQ(amax_idx(i), i * len + best);
+      ASSERT_NEAR(static_cast<double>(vars(i)), m2 / static_cast<double>(len - 1), 1e-3);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -123,6 +123,20 @@ struct DiagonalAccessFunctor {
   }
 };
 
+// Vector-aware functor producing N consecutive elements from the index of the first
+template<typename T>
+struct RampVectorFunctor {
+  template<int N, typename Op>
+  __host__ __device__ auto operator()(cuda::std::integral_constant<int, N>, cuda::std::array<index_t, 2> idx, const Op& op) const {
+    cuda::std::array<T, N> out;
+    for (int i = 0; i < N; i++) {
+      using value_t = typename detail::value_promote_t<T>;
+      out[i] = op(idx[0], idx[1] + i) + T(static_cast<value_t>((idx[0] + idx[1] + i) % 5));
+    }
+    return out;
+  }
+};
+
 TYPED_TEST(OperatorTestsNumericAllExecs, ApplyIdxOp)
 {
   MATX_ENTER_HANDLER();
@@ -703,4 +717,35 @@ TYPED_TEST(OperatorTestsNumericAllExecs, ApplyIdxWithStdApply)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(OperatorTestsFloatAllExecs, ApplyIdxOpVectorFunctor)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
 
+  // example-begin apply-idx-test-5
+  auto t_in = make_tensor<TestType>({8, 256});
+  auto t_out = make_tensor<TestType>({8, 256});
+
+  for (index_t i = 0; i < t_in.Size(0); i++) {
+    for (index_t j = 0; j < t_in.Size(1); j++) {
+      t_in(i, j) = static_cast<detail::value_promote_t<TestType>>((i + j) % 7);
+    }
+  }
+
+  // The functor is told how many consecutive elements along the last dimension to produce
+  (t_out = matx::apply_idx(RampVectorFunctor<TestType>{}, t_in)).run(exec);
+  // example-end apply-idx-test-5
+  exec.sync();
+
+  for (index_t i = 0; i < t_in.Size(0); i++) {
+    for (index_t j = 0; j < t_in.Size(1); j++) {
+      const TestType expected = t_in(i, j) + TestType(static_cast<detail::value_promote_t<TestType>>((i + j) % 5));
+      ASSERT_TRUE(MatXUtils::MatXTypeCompare(t_out(i, j), expected));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -52,6 +52,36 @@ struct CustomMathFunctor {
   __host__ __device__ auto operator()(T x) const { return x * x + T(2) * x + T(1); }
 };
 
+// Vector-aware functor taking every value a thread processes at once
+template<typename T>
+struct AxpyVectorFunctor {
+  template<size_t N>
+  __host__ __device__ auto operator()(const cuda::std::array<T, N> &x, const cuda::std::array<T, N> &y) const {
+    cuda::std::array<T, N> out;
+    for (size_t i = 0; i < N; i++) {
+      out[i] = T(3) * x[i] + y[i];
+    }
+    return out;
+  }
+};
+
+// Functor with both signatures, opting into the vector one
+template<typename T>
+struct SquareBothFunctor {
+  using matx_vector_func = bool;
+
+  __host__ __device__ T operator()(T x) const { return x * x; }
+
+  template<size_t N>
+  __host__ __device__ auto operator()(const cuda::std::array<T, N> &x) const {
+    cuda::std::array<T, N> out;
+    for (size_t i = 0; i < N; i++) {
+      out[i] = x[i] * x[i];
+    }
+    return out;
+  }
+};
+
 TYPED_TEST(OperatorTestsNumericAllExecs, ApplyOp)
 {
   MATX_ENTER_HANDLER();
@@ -303,3 +333,35 @@ TYPED_TEST(OperatorTestsFloatAllExecs, ApplyOpFloat)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(OperatorTestsFloatAllExecs, ApplyOpVectorFunctor)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  // example-begin apply-test-4
+  auto x = make_tensor<TestType>({1024});
+  auto y = make_tensor<TestType>({1024});
+  auto axpy = make_tensor<TestType>({1024});
+  auto sq = make_tensor<TestType>({1024});
+
+  for (index_t i = 0; i < x.Size(0); i++) {
+    x(i) = static_cast<detail::value_promote_t<TestType>>(i % 7);
+    y(i) = static_cast<detail::value_promote_t<TestType>>(i % 5);
+  }
+
+  // Each call receives all the elements a thread processes, and is also fused with other operators
+  (axpy = matx::apply(AxpyVectorFunctor<TestType>{}, x, y)).run(exec);
+  (sq = matx::apply(SquareBothFunctor<TestType>{}, x) + y).run(exec);
+  // example-end apply-test-4
+  exec.sync();
+
+  for (index_t i = 0; i < x.Size(0); i++) {
+    ASSERT_TRUE(MatXUtils::MatXTypeCompare(axpy(i), TestType(3) * x(i) + y(i)));
+    ASSERT_TRUE(MatXUtils::MatXTypeCompare(sq(i), x(i) * x(i) + y(i)));
+  }
+
+  MATX_EXIT_HANDLER();
+}
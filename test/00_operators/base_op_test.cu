@@ -30,4 +30,189 @@ TYPED_TEST(OperatorTestsAllExecs, BaseOp)
   EXPECT_TRUE(A.TotalSize() == op.TotalSize());
 
   MATX_EXIT_HANDLER();
-} 
\ No newline at end of file
+} 
+TEST(OperatorIndexTests, Index32BitDispatch)
+{
+  MATX_ENTER_HANDLER();
+
+  cudaExecutor exec{};
+
+  // Small tensors fit in 32-bit offsets, so the executor runs them with 32-bit index math
+  auto a = make_tensor<float>({37, 5, 129});
+  auto b = make_tensor<float>({37, 5, 129});
+  auto c = make_tensor<float>({37, 5, 129});
+  EXPECT_TRUE(detail::get_operator_capability<detail::OperatorCapability::INDEX_32BIT>(c = a + b));
+
+  // A view whose strides reach past 2^31 elements must keep 64-bit offsets. It is never dereferenced
+  auto wide = make_tensor<float>(a.Data(), {4, 2}, {index_t{1} << 31, 1});
+  EXPECT_FALSE(detail::get_operator_capability<detail::OperatorCapability::INDEX_32BIT>(wide));
+  EXPECT_FALSE(detail::get_operator_capability<detail::OperatorCapability::INDEX_32BIT>(wide + 1.0f));
+
+  for (index_t i = 0; i < a.Size(0); i++) {
+    for (index_t j = 0; j < a.Size(1); j++) {
+      for (index_t k = 0; k < a.Size(2); k++) {
+        a(i, j, k) = static_cast<float>(i * 1000 + j * 100 + k);
+        b(i, j, k) = 0.5f;
+      }
+    }
+  }
+
+  (c = a + b).run(exec);
+  exec.sync();
+
+  for (index_t i = 0; i < a.Size(0); i++) {
+    for (index_t j = 0; j < a.Size(1); j++) {
+      for (index_t k = 0; k < a.Size(2); k++) {
+        ASSERT_EQ(c(i, j, k), static_cast<float>(i * 1000 + j * 100 + k) + 0.5f);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(OperatorIndexTests, LoweredTensorViews)
+{
+  MATX_ENTER_HANDLER();
+
+  // Operators hold the storage-free base view of each tensor, so copying an expression for a launch
+  // never touches a reference count
+  auto a = make_tensor<float>({16, 16});
+  auto b = make_tensor<float>({16, 16});
+  using view_t = detail::base_type_t<decltype(a)>;
+  static_assert(std::is_trivially_copy_constructible_v<view_t>);
+  static_assert(sizeof(view_t) < sizeof(a));
+
+  auto op = a + b;
+  static_assert(std::is_trivially_copy_constructible_v<decltype(op)>);
+  EXPECT_EQ(a.GetRefCount(), 1);
+
+  MATX_EXIT_HANDLER();
+}
+
+#ifdef MATX_EN_JIT
+TEST(OperatorIndexTests, JitAliasedLeaves)
+{
+  MATX_ENTER_HANDLER();
+
+  CUDAJITExecutor exec{};
+
+  auto x = make_tensor<float>({1000});
+  auto y = make_tensor<float>({1000});
+  auto out = make_tensor<float>({1000});
+  for (index_t i = 0; i < x.Size(0); i++) {
+    x(i) = static_cast<float>(i % 17) - 8.0f;
+    y(i) = 1.0f;
+  }
+
+  // Both abs(x) subtrees read x, so the two copies of its pointer are found
+  auto op = (out = where(abs(x) > 4.0f, abs(x), 0.0f));
+  EXPECT_FALSE(detail::jit_aliased_pointer_slots(op.ToJITStorage()).empty());
+  EXPECT_TRUE(detail::jit_aliased_pointer_slots((out = abs(x) + abs(y)).ToJITStorage()).empty());
+
+  op.run(exec);
+  exec.sync();
+  for (index_t i = 0; i < x.Size(0); i++) {
+    const float v = std::abs(static_cast<float>(i % 17) - 8.0f);
+    ASSERT_EQ(out(i), v > 4.0f ? v : 0.0f);
+  }
+
+  // Same expression type without aliasing must not reuse the kernel compiled with the assumption
+  (out = where(abs(y) > 4.0f, abs(x), 0.0f)).run(exec);
+  exec.sync();
+  for (index_t i = 0; i < x.Size(0); i++) {
+    ASSERT_EQ(out(i), 0.0f);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+#endif
+
+#ifdef MATX_EN_JIT
+TEST(OperatorIndexTests, JitFoldedScalars)
+{
+  MATX_ENTER_HANDLER();
+
+  CUDAJITExecutor exec{};
+  exec.set_fold_scalars(true);
+
+  auto x = make_tensor<float>({1000});
+  auto out = make_tensor<float>({1000});
+  for (index_t i = 0; i < x.Size(0); i++) {
+    x(i) = static_cast<float>(i % 17) - 8.0f;
+  }
+
+  auto op = (out = where(x > 0.5f, x * 2.0f, -1.0f));
+  {
+    detail::JITFoldScalarsScope fold{true};
+    EXPECT_NE(detail::get_operator_capability<detail::OperatorCapability::JIT_TYPE_QUERY>(op).find("JITScalar_"), std::string::npos);
+  }
+  EXPECT_EQ(detail::get_operator_capability<detail::OperatorCapability::JIT_TYPE_QUERY>(op).find("JITScalar_"), std::string::npos);
+
+  op.run(exec);
+  exec.sync();
+  for (index_t i = 0; i < x.Size(0); i++) {
+    ASSERT_EQ(out(i), x(i) > 0.5f ? x(i) * 2.0f : -1.0f);
+  }
+
+  // A different constant must compile its own kernel rather than reuse the folded one
+  (out = where(x > 0.5f, x * 3.0f, -1.0f)).run(exec);
+  exec.sync();
+  for (index_t i = 0; i < x.Size(0); i++) {
+    ASSERT_EQ(out(i), x(i) > 0.5f ? x(i) * 3.0f : -1.0f);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+#endif
+
+#if defined(MATX_EN_JIT) && defined(NVRTC_CUDA_ARCH)
+TEST(OperatorIndexTests, JitApplyLTOIR)
+{
+  MATX_ENTER_HANDLER();
+
+  // Build the user function the same way an application would ship it: as LTO-IR from NVRTC
+  const char *src = "extern \"C\" __device__ float scaled_sum(float a, float b) { return 2.0f * a + b; }\n";
+  nvrtcProgram prog;
+  ASSERT_EQ(nvrtcCreateProgram(&prog, src, "scaled_sum.cu", 0, nullptr, nullptr), NVRTC_SUCCESS);
+  const char *opts[] = {"-dlto", "-rdc=true", "-arch=compute_" NVRTC_CUDA_ARCH};
+  ASSERT_EQ(nvrtcCompileProgram(prog, 3, opts), NVRTC_SUCCESS);
+  size_t lto_size = 0;
+  ASSERT_EQ(nvrtcGetLTOIRSize(prog, &lto_size), NVRTC_SUCCESS);
+  std::vector<char> ltoir(lto_size);
+  ASSERT_EQ(nvrtcGetLTOIR(prog, ltoir.data()), NVRTC_SUCCESS);
+  nvrtcDestroyProgram(&prog);
+
+  RegisterJITFunction("scaled_sum", ltoir.data(), ltoir.size());
+
+  // example-begin apply_ltoir-test-1
+  auto a = make_tensor<float>({100});
+  auto b = make_tensor<float>({100});
+  auto out = make_tensor<float>({100});
+  (a = range<0>({100}, 0.0f, 1.0f)).run();
+  (b = ones<float>({100})).run();
+
+  // Calls the registered device function, fused with the surrounding expression
+  (out = apply_ltoir<float>("scaled_sum", a, b) + 1.0f).run(CUDAJITExecutor{});
+  // example-end apply_ltoir-test-1
+  cudaStreamSynchronize(0);
+
+  for (index_t i = 0; i < out.Size(0); i++) {
+    ASSERT_EQ(out(i), 2.0f * a(i) + b(i) + 1.0f);
+  }
+
+  // Dropping the LTO-IR cache must not drop registered functions
+  detail::GetCache().ClearLTOIRMemory();
+  (out = apply_ltoir<float>("scaled_sum", b, a)).run(CUDAJITExecutor{});
+  cudaStreamSynchronize(0);
+  for (index_t i = 0; i < out.Size(0); i++) {
+    ASSERT_EQ(out(i), 2.0f * b(i) + a(i));
+  }
+
+  EXPECT_TRUE(UnregisterJITFunction("scaled_sum"));
+  EXPECT_THROW(apply_ltoir<float>("scaled_sum", a, b), matx::detail::matxException);
+  EXPECT_THROW(RegisterJITFunction("not a name", ltoir.data(), ltoir.size()), matx::detail::matxException);
+
+  MATX_EXIT_HANDLER();
+}
+#endif
@@ -0,0 +1,40 @@
+#include "operator_test_types.hpp"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+
+using namespace matx;
+using namespace matx::test;
+
+TYPED_TEST(OperatorTestsFloatNonComplexNonHalfAllExecsWithoutJIT, FastMath)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+  constexpr index_t n = 1000;
+  auto x = make_tensor<TestType>({n});
+  auto y = make_tensor<TestType>({n});
+  auto ref = make_tensor<TestType>({n});
+  auto out = make_tensor<TestType>({n});
+
+  for (index_t i = 0; i < n; i++) {
+    x(i) = static_cast<TestType>(-3.0 + 6.0 * static_cast<double>(i) / static_cast<double>(n));
+    y(i) = static_cast<TestType>(0.5 + static_cast<double>(i) / static_cast<double>(n));
+  }
+
+  (ref = exp(-x * x) * sin(x) + log(y) / y - cos(x)).run(exec);
+  // example-begin fast-math-test-1
+  (out = fast_math(exp(-x * x) * sin(x) + log(y) / y - cos(x))).run(exec);
+  // example-end fast-math-test-1
+  exec.sync();
+
+  // The intrinsics are only used for float on the device; everything else is unchanged
+  const double tol = (cuda::std::is_same_v<TestType, float> && is_cuda_executor_v<ExecType>) ? 1e-5 : 0.0;
+  for (index_t i = 0; i < n; i++) {
+    ASSERT_NEAR(static_cast<double>(out(i)), static_cast<double>(ref(i)), tol);
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -97,6 +97,48 @@ TYPED_TEST(OperatorTestsFloatNonHalf, FFTShiftWithTransform)
       ASSERT_NEAR(T4(i).real(), T4_expected[i].real(), thresh);
       ASSERT_NEAR(T4(i).imag(), T4_expected[i].imag(), thresh);
     }
+
+    // Shifts applied directly to fft()/ifft() are folded into the transform input. Compare
+    // them to shifting a materialized transform for odd and even batched lengths.
+    for (const index_t n : {index_t{7}, index_t{8}}) {
+      auto x = make_tensor<complex_type>({3, n});
+      auto X = make_tensor<complex_type>({3, n});
+      auto folded = make_tensor<complex_type>({3, n});
+      auto ref = make_tensor<complex_type>({3, n});
+      for (index_t b = 0; b < 3; b++) {
+        for (index_t i = 0; i < n; i++) {
+          x(b, i) = complex_type{static_cast<inner_type>(b + i), static_cast<inner_type>(b * i % 5)};
+        }
+      }
+      exec.sync();
+
+      const inner_type fold_thresh = static_cast<inner_type>(1.0e-4);
+      auto check = [&]() {
+        exec.sync();
+        for (index_t b = 0; b < 3; b++) {
+          for (index_t i = 0; i < n; i++) {
+            ASSERT_NEAR(folded(b, i).real(), ref(b, i).real(), fold_thresh);
+            ASSERT_NEAR(folded(b, i).imag(), ref(b, i).imag(), fold_thresh);
+          }
+        }
+      };
+
+      (X = fft(x)).run(exec);
+      (ref = fftshift1D(X)).run(exec);
+      (folded = fftshift1D(fft(x))).run(exec);
+      check();
+      (ref = ifftshift1D(X)).run(exec);
+      (folded = ifftshift1D(fft(x))).run(exec);
+      check();
+
+      (X = ifft(x)).run(exec);
+      (ref = fftshift1D(X)).run(exec);
+      (folded = fftshift1D(ifft(x))).run(exec);
+      check();
+      (ref = ifftshift1D(X)).run(exec);
+      (folded = ifftshift1D(ifft(x))).run(exec);
+      check();
+    }
   }
 
   // Verify that fftshift2D/ifftshift2D work with nested transforms. We do not
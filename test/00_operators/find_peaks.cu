@@ -34,4 +34,57 @@ TYPED_TEST(OperatorTestsFloatNonComplexSingleThreadedHostAllExecs, FindPeaks)
   }
 
   MATX_EXIT_HANDLER();
-} 
\ No newline at end of file
+} 
+TYPED_TEST(OperatorTestsFloatNonComplexAllExecsWithoutJIT, FindPeaksBatched)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  // example-begin findpeaks-test-2
+  auto x = make_tensor<TestType>({2, 16});
+  x.SetVals({{0, 1, 0, 3, 0, 2, 0, 0, 5, 1, 4, 1, 0, 2, 1, 0},
+             {0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0}});
+  auto idx = make_tensor<index_t>({2, 16});
+  auto num_found = make_tensor<int>({2});
+  auto prom = make_tensor<TestType>({2, 16});
+  auto width = make_tensor<TestType>({2, 16});
+
+  // Peaks at least 0.5 high and 3 samples apart with a prominence of at least 2.5
+  FindPeaksParams params;
+  params.height = 0.5;
+  params.distance = 3;
+  params.prominence = 2.5;
+  (mtie(idx, num_found, prom, width) = find_peaks(x, params)).run(exec);
+  // example-end findpeaks-test-2
+  exec.sync();
+
+  ASSERT_EQ(num_found(0), 2);
+  ASSERT_EQ(num_found(1), 1);
+  ASSERT_EQ(idx(0, 0), 3);
+  ASSERT_EQ(idx(0, 1), 8);
+  ASSERT_EQ(idx(1, 0), 7);
+  ASSERT_NEAR(static_cast<double>(prom(0, 0)), 3.0, 1e-3);
+  ASSERT_NEAR(static_cast<double>(prom(0, 1)), 5.0, 1e-3);
+  ASSERT_NEAR(static_cast<double>(prom(1, 0)), 4.0, 1e-3);
+  ASSERT_NEAR(static_cast<double>(width(0, 0)), 1.0, 1e-3);
+  ASSERT_NEAR(static_cast<double>(width(0, 1)), 1.125, 1e-3);
+  ASSERT_NEAR(static_cast<double>(width(1, 0)), 1.0, 1e-3);
+
+  // Without the prominence test the distance suppression alone keeps the peak at 13
+  params.prominence = 0;
+  (mtie(idx, num_found) = find_peaks(x, params)).run(exec);
+  exec.sync();
+
+  ASSERT_EQ(num_found(0), 3);
+  ASSERT_EQ(num_found(1), 1);
+  std::vector<index_t> expected_idxs = {3, 8, 13};
+  for (int i = 0; i < num_found(0); i++) {
+    ASSERT_EQ(idx(0, i), expected_idxs[i]);
+  }
+  ASSERT_EQ(idx(1, 0), 7);
+
+  MATX_EXIT_HANDLER();
+}
@@ -256,3 +256,45 @@ TEST(InterpTests, Interp)
 
   MATX_EXIT_HANDLER();
 }
+
+TEST(InterpTests, InterpSearch)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = float;
+  cudaExecutor exec{};
+
+  // Uniform sample grid, with sorted queries spanning several search tiles and both sides out of range
+  const index_t n = 100;
+  const index_t nq = 1000;
+  auto x = make_tensor<TestType>({n});
+  auto v = make_tensor<TestType>({n});
+  auto xq = make_tensor<TestType>({2, nq});
+  (x = linspace(TestType{0}, TestType{99}, n)).run(exec);
+  (v = sin(x * TestType{0.1})).run(exec);
+  (xq = clone<2>(linspace(TestType{-5.0}, TestType{105.0}, nq), {2, matxKeepDim})).run(exec);
+
+  for (auto method : {InterpMethod::LINEAR, InterpMethod::NEAREST, InterpMethod::NEXT,
+                      InterpMethod::PREV, InterpMethod::SPLINE}) {
+    auto ref = make_tensor<TestType>(xq.Shape());
+    auto out_sorted = make_tensor<TestType>(xq.Shape());
+    auto out_uniform = make_tensor<TestType>(xq.Shape());
+
+    (ref = interp1(x, v, xq, method)).run(exec);
+    // example-begin interp-test-3
+    // Query points are sorted, so each tile of queries only searches its own window of samples
+    (out_sorted = interp1(x, v, xq, method, InterpSearch::SORTED)).run(exec);
+    // Sample points are uniformly spaced, so the interval is computed directly
+    (out_uniform = interp1(x, v, xq, method, InterpSearch::UNIFORM)).run(exec);
+    // example-end interp-test-3
+    exec.sync();
+
+    for (index_t b = 0; b < xq.Size(0); b++) {
+      for (index_t i = 0; i < nq; i++) {
+        ASSERT_EQ(out_sorted(b, i), ref(b, i));
+        ASSERT_EQ(out_uniform(b, i), ref(b, i));
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -84,4 +84,45 @@ TYPED_TEST(OperatorTestsNumericNonComplexAllExecs, Overlap)
   }  
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+
+TYPED_TEST(OperatorTestsNumericNonComplexAllExecs, OverlapStridedView)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  // A column of a row-major matrix is a 1D view with an element stride of 3
+  tensor_t<TestType, 2> m{{10, 3}};
+  for (index_t i = 0; i < m.Size(0); i++) {
+    for (index_t j = 0; j < m.Size(1); j++) {
+      m(i, j) = static_cast<TestType>(i * 10 + j);
+    }
+  }
+  auto col = slice<1>(m, {0, 1}, {matxEnd, matxDropDim});
+
+  // The overlapped frames are still a view of m, with strides in elements of m
+  auto co = overlap(col, {4}, {2});
+  ASSERT_EQ(co.Size(0), 4);
+  ASSERT_EQ(co.Size(1), 4);
+  ASSERT_EQ(co.Stride(0), 6);
+  ASSERT_EQ(co.Stride(1), 3);
+  ASSERT_EQ(co.Data(), m.Data() + 1);
+  for (index_t i = 0; i < co.Size(0); i++) {
+    for (index_t j = 0; j < co.Size(1); j++) {
+      ASSERT_EQ(co(i, j), static_cast<TestType>((2 * i + j) * 10 + 1));
+    }
+  }
+
+  // A hop equal to the window gives non-overlapping frames
+  auto cn = overlap(col, {5}, {5});
+  ASSERT_EQ(cn.Size(0), 2);
+  ASSERT_EQ(cn.Size(1), 5);
+  for (index_t i = 0; i < cn.Size(0); i++) {
+    for (index_t j = 0; j < cn.Size(1); j++) {
+      ASSERT_EQ(cn(i, j), static_cast<TestType>((5 * i + j) * 10 + 1));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -31,4 +31,60 @@ TYPED_TEST(OperatorTestsFloatNonComplexNonHalfAllExecs, PolyVal)
   MATX_TEST_ASSERT_COMPARE(pb, out, "out", 0.01);
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+TYPED_TEST(OperatorTestsFloatNonComplexNonHalfAllExecs, PolyValFixed)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+  const index_t rows = 3;
+  const index_t n = 50;
+  auto x = make_tensor<TestType>({rows, n});
+  auto out = make_tensor<TestType>({rows, n});
+  auto ref = make_tensor<TestType>({rows, n});
+  for (index_t r = 0; r < rows; r++) {
+    for (index_t i = 0; i < n; i++) {
+      x(r, i) = static_cast<TestType>(-1.0 + 2.0 * static_cast<double>(r * n + i) / static_cast<double>(rows * n));
+    }
+  }
+
+  // Compare the compile-time coefficient counts against the runtime-coefficient path, on a batched
+  // input, for both the plain and the second-order Horner evaluation
+  auto check = [&](const auto &coeffs) {
+    constexpr size_t N = cuda::std::tuple_size_v<std::remove_cvref_t<decltype(coeffs)>>;
+    auto c = make_tensor<TestType>({static_cast<index_t>(N)});
+    for (size_t k = 0; k < N; k++) {
+      c(static_cast<index_t>(k)) = coeffs[k];
+    }
+    (ref = polyval(x, c)).run(exec);
+    (out = polyval(x, coeffs)).run(exec);
+    exec.sync();
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t i = 0; i < n; i++) {
+        ASSERT_NEAR(out(r, i), ref(r, i), 1e-4);
+      }
+    }
+  };
+
+  check(cuda::std::array<TestType, 1>{TestType(3)});
+  check(cuda::std::array<TestType, 4>{TestType(1), TestType(-2), TestType(0.5), TestType(4)});
+  check(cuda::std::array<TestType, 6>{TestType(0.1), TestType(1), TestType(-2), TestType(0.5), TestType(4), TestType(-1)});
+  check(cuda::std::array<TestType, 9>{TestType(1), TestType(0.3), TestType(-1), TestType(2), TestType(0.7),
+                                      TestType(-0.2), TestType(1.5), TestType(-3), TestType(0.25)});
+
+  // example-begin polyval-test-2
+  // Coefficients given inline are fixed at compile time and evaluated fully unrolled
+  (out = polyval(x, {TestType(2), TestType(-1), TestType(0.5)})).run(exec);
+  // example-end polyval-test-2
+  exec.sync();
+  for (index_t r = 0; r < rows; r++) {
+    for (index_t i = 0; i < n; i++) {
+      const TestType v = x(r, i);
+      ASSERT_NEAR(out(r, i), TestType(2) * v * v - v + TestType(0.5), 1e-4);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
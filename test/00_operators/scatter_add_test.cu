@@ -0,0 +1,61 @@
+#include "operator_test_types.hpp"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+
+using namespace matx;
+using namespace matx::test;
+
+TYPED_TEST(OperatorTestsNumericNoHalfAllExecsWithoutJIT, ScatterAdd)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  using inner_type = typename inner_op_type_t<TestType>::type;
+
+  ExecType exec{};
+
+  const index_t n = 1000;
+  const index_t m = 40;
+  auto vals = make_tensor<TestType>({n});
+  auto idx = make_tensor<int>({n});
+  auto out = make_tensor<TestType>({m});
+  std::vector<TestType> ref(m);
+
+  for (index_t i = 0; i < n; i++) {
+    vals(i) = TestType(static_cast<inner_type>(i % 7 + 1));
+  }
+
+  // Repeating destinations within a warp, sorted runs, and out of range indices that are skipped
+  for (const int pattern : {0, 1, 2}) {
+    std::fill(ref.begin(), ref.end(), TestType(0));
+    for (index_t i = 0; i < n; i++) {
+      int j = 0;
+      if (pattern == 0) {
+        j = static_cast<int>(i % 17);
+      }
+      else if (pattern == 1) {
+        j = static_cast<int>(i / 25);
+      }
+      else {
+        j = static_cast<int>(i % (m + 5)) - 2;
+      }
+      idx(i) = j;
+      if (j >= 0 && j < m) {
+        ref[j] += vals(i);
+      }
+    }
+
+    // example-begin scatter_add-test-1
+    // out(j) is the sum of every vals(i) with idx(i) == j
+    (out = scatter_add(vals, idx, m)).run(exec);
+    // example-end scatter_add-test-1
+    exec.sync();
+
+    for (index_t j = 0; j < m; j++) {
+      ASSERT_TRUE(out(j) == ref[j]);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
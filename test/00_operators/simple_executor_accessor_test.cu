@@ -74,4 +74,42 @@ TYPED_TEST(OperatorTestsAllExecsWithoutJIT, SimpleExecutorAccessorTests)
   }
 
   MATX_EXIT_HANDLER();
-} 
\ No newline at end of file
+} 
+TEST(CudaExecutorLaunchTests, PersistentGridStride)
+{
+  MATX_ENTER_HANDLER();
+
+  // These are large enough to exceed several waves of resident threads on any current GPU,
+  // so the CUDA executor shrinks the grid and launches the grid-stride kernels. Odd sizes
+  // make sure the stride loops cover the tails of every dimension.
+  cudaExecutor exec{};
+  const index_t n1 = (1 << 24) + 3;
+  auto t1 = make_tensor<int64_t>({n1});
+  auto t2 = make_tensor<int>({4099, 4097});
+  auto t3 = make_tensor<int>({259, 257, 255});
+  auto t4 = make_tensor<int>({17, 19, 241, 243});
+
+  (t1 = range<0>(t1.Shape(), int64_t{0}, int64_t{1})).run(exec);
+  (t2 = 5).run(exec);
+  (t3 = 5).run(exec);
+  (t4 = 5).run(exec);
+  IF(t2 == 5, t2 = 7).run(exec);
+  IF(t3 == 5, t3 = 7).run(exec);
+  IF(t4 == 5, t4 = 7).run(exec);
+  exec.sync();
+
+  for (index_t i = 0; i < n1; i++) {
+    ASSERT_EQ(t1(i), i);
+  }
+  for (index_t i = 0; i < t2.TotalSize(); i++) {
+    ASSERT_EQ(t2.Data()[i], 7);
+  }
+  for (index_t i = 0; i < t3.TotalSize(); i++) {
+    ASSERT_EQ(t3.Data()[i], 7);
+  }
+  for (index_t i = 0; i < t4.TotalSize(); i++) {
+    ASSERT_EQ(t4.Data()[i], 7);
+  }
+
+  MATX_EXIT_HANDLER();
+}
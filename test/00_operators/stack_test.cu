@@ -45,6 +45,20 @@ TYPED_TEST(OperatorTestsNumericAllExecs, Stack)
       ASSERT_EQ(op(i,2), t1c(i));
     }
   }  
-  
+
+  {
+    // Assigning into a tensor writes each input straight into its slice of the output
+    auto out = make_tensor<TestType>({t1a.Size(0), 3});
+    (t1a = (TestType)1).run(exec);
+    (out = stack(1, t1a, t1a + t1b, t1c)).run(exec);
+    exec.sync();
+
+    for(int i = 0; i < t1a.Size(0); i++) {
+      ASSERT_EQ(out(i,0), t1a(i));
+      ASSERT_EQ(out(i,1), t1a(i) + t1b(i));
+      ASSERT_EQ(out(i,2), t1c(i));
+    }
+  }
+
   MATX_EXIT_HANDLER();
 }
\ No newline at end of file
@@ -125,6 +125,24 @@ TEST_F(LoggingTest, DisabledLoggingNoOverhead) {
   SUCCEED();
 }
 
+TEST_F(LoggingTest, LazyArgumentEvaluation) {
+  int evaluated = 0;
+  const auto count = [&evaluated]() { return ++evaluated; };
+
+  detail::Logger::instance().set_min_level(detail::LogLevel::ERROR);
+  EXPECT_FALSE(detail::Logger::enabled(detail::LogLevel::DEBUG));
+  EXPECT_TRUE(detail::Logger::enabled(detail::LogLevel::ERROR));
+
+  // Arguments of disabled calls are never evaluated
+  MATX_LOG_DEBUG("Count: {}", count());
+  EXPECT_EQ(evaluated, 0);
+
+  // Calls below the compile-time level are removed, so they are not evaluated even when enabled
+  detail::Logger::instance().set_min_level(detail::LogLevel::TRACE);
+  MATX_LOG_TRACE("Count: {}", count());
+  EXPECT_EQ(evaluated, MATX_LOG_COMPILE_LEVEL <= static_cast<int>(detail::LogLevel::TRACE) ? 1 : 0);
+}
+
 TEST_F(LoggingTest, ConvenienceMacros) {
   detail::Logger::instance().set_min_level(detail::LogLevel::TRACE);
   
@@ -47,3 +47,46 @@ TYPED_TEST(OperatorTestsFloatNonComplexNonHalfAllExecs, Unwrap)
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(OperatorTestsFloatNonComplexNonHalfAllExecs, UnwrapLong)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  // Long enough along the last axis to take the look-back scan path
+  constexpr index_t batches = 3;
+  constexpr index_t len = 100000;
+  constexpr double two_pi = 2.0 * cuda::std::numbers::pi;
+
+  ExecType exec{};
+  auto in = make_tensor<TestType>({batches, len});
+  auto out = make_tensor<TestType>({batches, len});
+
+  // Wrapped linear phase ramps with different slopes per batch
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < len; i++) {
+      const double phase = 0.1 * static_cast<double>(b + 1) * static_cast<double>(i % 1000);
+      in(b, i) = static_cast<TestType>(std::remainder(phase, two_pi));
+    }
+  }
+
+  (out = unwrap(in)).run(exec);
+  exec.sync();
+
+  for (index_t b = 0; b < batches; b++) {
+    double correction = 0.0;
+    for (index_t i = 0; i < len; i++) {
+      if (i > 0) {
+        const double delta = static_cast<double>(in(b, i)) - static_cast<double>(in(b, i - 1));
+        if (std::abs(delta) >= two_pi / 2.0) {
+          correction -= two_pi * std::round(delta / two_pi);
+        }
+      }
+      const double ref = static_cast<double>(in(b, i)) + correction;
+      ASSERT_NEAR(static_cast<double>(out(b, i)), ref, 1e-3 * std::max(1.0, std::abs(ref)));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
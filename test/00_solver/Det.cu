@@ -141,4 +141,60 @@ TYPED_TEST(DetSolverTestFloatTypes, DeterminantBasicBatched)
   }
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+TYPED_TEST(DetSolverTestFloatTypes, LogDeterminant)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  using RealType = typename inner_op_type_t<TestType>::type;
+
+  auto Av = make_tensor<TestType>({m, m});
+  auto detv = make_tensor<TestType>({});
+  auto ldv = make_tensor<RealType>({});
+  auto ld_luv = make_tensor<RealType>({});
+
+  // Symmetric and diagonally dominant, so positive definite
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < m; j++) {
+      Av(i, j) = static_cast<TestType>(i == j ? 2.0 * m : 1.0 / static_cast<double>(1 + std::abs(i - j)));
+    }
+  }
+
+  (detv = det(Av)).run(this->exec);
+  // example-begin logdet-test-1
+  (ldv = logdet(Av)).run(this->exec);
+  (ld_luv = logdet(Av, LogDetMethod::LU)).run(this->exec);
+  // example-end logdet-test-1
+  this->exec.sync();
+
+  const double ref = std::log(static_cast<double>(cuda::std::abs(detv())));
+  ASSERT_NEAR(ldv(), ref, this->relTol * std::abs(ref));
+  ASSERT_NEAR(ld_luv(), ref, this->relTol * std::abs(ref));
+
+  if constexpr (is_cuda_executor_v<ExecType>) {
+    auto bv = make_tensor<TestType>({m});
+    auto xv = make_tensor<TestType>({m});
+    auto ld_solvev = make_tensor<RealType>({});
+    for (index_t i = 0; i < m; i++) {
+      bv(i) = static_cast<TestType>(static_cast<double>(i + 1));
+    }
+
+    // example-begin solve-logdet-test-1
+    // Solve A x = b and compute log(det(A)) from the same Cholesky factorization
+    (mtie(xv, ld_solvev) = solve_logdet(Av, bv)).run(this->exec);
+    // example-end solve-logdet-test-1
+    this->exec.sync();
+
+    ASSERT_NEAR(ld_solvev(), ref, this->relTol * std::abs(ref));
+    for (index_t i = 0; i < m; i++) {
+      TestType r = -bv(i);
+      for (index_t j = 0; j < m; j++) {
+        r += Av(i, j) * xv(j);
+      }
+      ASSERT_LT(getMaxMagnitude(r), 1e-3);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
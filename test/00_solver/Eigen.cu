@@ -173,4 +173,97 @@ TYPED_TEST(EigenSolverTestFloatTypes, EigenBasicBatched)
   }
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+TYPED_TEST(EigenSolverTestFloatTypes, EigenSmallBatchedJacobi)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using value_type = typename inner_op_type_t<TestType>::type;
+
+  // Batches of matrices up to 32x32 use the batched Jacobi solver on CUDA. Compare it against
+  // the general-size solver, which both sort the eigenvalues in ascending order.
+  constexpr index_t batches = 50;
+  constexpr index_t n = 16;
+  auto Bv = make_tensor<TestType>({batches, n, n});
+  auto Evv = make_tensor<TestType>({batches, n, n});
+  auto Wov = make_tensor<value_type>({batches, n});
+  auto Wov_ref = make_tensor<value_type>({batches, n});
+
+  this->pb->template InitAndRunTVGenerator<TestType>("00_solver", "eig", "run", {batches, n});
+  this->pb->NumpyToTensorView(Bv, "B");
+
+  // example-begin eig-test-2
+  JacobiParams jacobi;
+  jacobi.tol = 1e-7;
+  jacobi.max_sweeps = 20;
+  (mtie(Evv, Wov) = eig(Bv, EigenMode::VECTOR, SolverFillMode::UPPER, jacobi)).run(this->exec);
+  // example-end eig-test-2
+
+  jacobi.enable = false;
+  (mtie(Evv, Wov_ref) = eig(Bv, EigenMode::VECTOR, SolverFillMode::UPPER, jacobi)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < n; i++) {
+      // Relative to the largest eigenvalue
+      ASSERT_NEAR(Wov(b, i), Wov_ref(b, i), this->thresh * Wov_ref(b, n - 1));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(EigenSolverTestFloatTypes, EigenPartial)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  using value_type = typename inner_op_type_t<TestType>::type;
+
+  if constexpr (!is_cuda_executor_v<ExecType>) {
+    GTEST_SKIP();
+  }
+  else {
+    constexpr index_t k = 8;
+    auto Bv = make_tensor<TestType>({dim_size, dim_size});
+    auto Evv = make_tensor<TestType>({dim_size, dim_size});
+    auto Wov = make_tensor<value_type>({dim_size});
+    auto Vk = make_tensor<TestType>({dim_size, k});
+    auto Wk = make_tensor<value_type>({k});
+
+    auto Gv = make_tensor<TestType>({dim_size, 1});
+    auto Lvv = make_tensor<TestType>({dim_size, 1});
+
+    this->pb->template InitAndRunTVGenerator<TestType>("00_solver", "eig", "run", {dim_size});
+    this->pb->NumpyToTensorView(Bv, "B");
+
+    // example-begin eig-test-3
+    // The k largest eigenvalues in ascending order, and their eigenvectors in the columns of Vk
+    (mtie(Vk, Wk) = eig(Bv, k)).run(this->exec);
+    // example-end eig-test-3
+
+    (mtie(Evv, Wov) = eig(Bv)).run(this->exec);
+    this->exec.sync();
+
+    for (index_t i = 0; i < k; i++) {
+      ASSERT_NEAR(Wk(i), Wov(dim_size - k + i), this->thresh * cuda::std::abs(Wov(dim_size - 1)));
+
+      auto v = slice<2>(Vk, {0, i}, {matxEnd, i + 1});
+      (Lvv = Wk(i) * v).run(this->exec);
+      (Gv = matmul(Bv, v)).run(this->exec);
+      this->exec.sync();
+
+      for (index_t j = 0; j < dim_size; j++) {
+        if constexpr (is_complex_v<TestType>) {
+          ASSERT_NEAR(Gv(j, 0).real(), Lvv(j, 0).real(), this->thresh);
+          ASSERT_NEAR(Gv(j, 0).imag(), Lvv(j, 0).imag(), this->thresh);
+        }
+        else {
+          ASSERT_NEAR(Gv(j, 0), Lvv(j, 0), this->thresh);
+        }
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -260,6 +260,43 @@ TYPED_TEST(InvSolverTestFloatTypes, Inv8x8Batched)
   MATX_EXIT_HANDLER();
 }    
 
+TYPED_TEST(InvSolverTestFloatTypes, Inv5x5BatchedTransposed)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  // An odd size with enough batches to span several blocks of the small batched kernel, and a
+  // transposed input that does not match the contiguous layout the kernel works on
+  constexpr index_t batches = 1000;
+  auto A = make_tensor<TestType>({batches, 5, 5});
+  auto Ainv = make_tensor<TestType>({batches, 5, 5});
+  auto Ainv_ref = make_tensor<TestType>({batches, 5, 5});
+
+  this->pb->template InitAndRunTVGenerator<TestType>("00_solver", "inv", "run", {batches, 5});
+  this->pb->NumpyToTensorView(A, "A");
+  this->pb->NumpyToTensorView(Ainv_ref, "A_inv");
+
+  // inv(A^T) = inv(A)^T
+  (Ainv = inv(permute(A, {0, 2, 1}))).run(this->exec);
+  this->exec.sync();
+
+  for (index_t b = 0; b < A.Size(0); b++) {
+    for (index_t i = 0; i < A.Size(1); i++) {
+      for (index_t j = 0; j < A.Size(2); j++) {
+        if constexpr (is_complex_v<TestType>) {
+          ASSERT_NEAR(Ainv_ref(b, j, i).real(), Ainv(b, i, j).real(), this->thresh);
+          ASSERT_NEAR(Ainv_ref(b, j, i).imag(), Ainv(b, i, j).imag(), this->thresh);
+        }
+        else {
+          ASSERT_NEAR(Ainv_ref(b, j, i), Ainv(b, i, j), this->thresh);
+        }
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(InvSolverTestFloatTypes, Inv256x256)
 {
   MATX_ENTER_HANDLER();
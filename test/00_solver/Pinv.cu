@@ -169,4 +169,92 @@ TYPED_TEST(PinvSolverTestFloatTypes, PinvBatchedRankDeficient)
   MATX_TEST_ASSERT_COMPARE(this->pb, A_pinv, "pinv", this->thresh);
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+template <typename TensorType>
+class PinvSolverTestCUDAFloatTypes : public PinvSolverTest<TensorType> {
+};
+
+TYPED_TEST_SUITE(PinvSolverTestCUDAFloatTypes,
+                 MatXFloatNonHalfTypesCUDAExec);
+
+TYPED_TEST(PinvSolverTestCUDAFloatTypes, PinvMethods)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  constexpr int m = 100;
+  constexpr int n = 50;
+  auto A = make_tensor<TestType>({m, n});
+  auto A_pinv = make_tensor<TestType>({n, m});
+
+  this->pb->template InitAndRunTVGenerator<TestType>("00_solver", "pinv", "run", {m, n});
+  this->pb->NumpyToTensorView(A, "A");
+
+  // example-begin pinv-test-2
+  // A is tall and full rank, so the QR factors give the pseudo-inverse without an SVD
+  (A_pinv = pinv(A, PinvMethod::QR)).run(this->exec);
+  // example-end pinv-test-2
+  this->exec.sync();
+  MATX_TEST_ASSERT_COMPARE(this->pb, A_pinv, "pinv", this->thresh);
+
+  (A_pinv = pinv(A, PinvMethod::CHOLESKY)).run(this->exec);
+  this->exec.sync();
+  MATX_TEST_ASSERT_COMPARE(this->pb, A_pinv, "pinv", this->thresh);
+
+  (A_pinv = pinv(A, PinvMethod::SVD)).run(this->exec);
+  this->exec.sync();
+  MATX_TEST_ASSERT_COMPARE(this->pb, A_pinv, "pinv", this->thresh);
+
+  // A rank-deficient input falls back from QR to the SVD
+  this->pb->template InitAndRunTVGenerator<TestType>("00_solver", "pinv", "run_rank_deficient", {m, n});
+  this->pb->NumpyToTensorView(A, "A");
+
+  (A_pinv = pinv(A, PinvMethod::QR)).run(this->exec);
+  this->exec.sync();
+  MATX_TEST_ASSERT_COMPARE(this->pb, A_pinv, "pinv", this->thresh);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(PinvSolverTestCUDAFloatTypes, Lstsq)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  constexpr int m = 100;
+  constexpr int n = 50;
+  constexpr int nrhs = 3;
+  auto A = make_tensor<TestType>({m, n});
+  auto A_pinv = make_tensor<TestType>({n, m});
+  auto B = make_tensor<TestType>({nrhs, m});
+  auto X = make_tensor<TestType>({nrhs, n});
+  auto Xref = make_tensor<TestType>({nrhs, n});
+
+  this->pb->template InitAndRunTVGenerator<TestType>("00_solver", "pinv", "run", {m, n});
+  this->pb->NumpyToTensorView(A, "A");
+  for (index_t r = 0; r < nrhs; r++) {
+    for (index_t i = 0; i < m; i++) {
+      B(r, i) = TestType(static_cast<double>((i * 3 + r * 7) % 11) / 11.0 - 0.5);
+    }
+  }
+
+  (A_pinv = pinv(A, PinvMethod::SVD)).run(this->exec);
+  (Xref = matmul(B, transpose_matrix(A_pinv))).run(this->exec);
+
+  for (const auto method : {PinvMethod::AUTO, PinvMethod::QR, PinvMethod::CHOLESKY, PinvMethod::SVD}) {
+    // example-begin lstsq-test-1
+    // Each row of B is a right-hand side, and the matching row of X minimizes its residual
+    (X = lstsq(A, B, method)).run(this->exec);
+    // example-end lstsq-test-1
+    this->exec.sync();
+
+    for (index_t r = 0; r < nrhs; r++) {
+      for (index_t j = 0; j < n; j++) {
+        ASSERT_NEAR(cuda::std::abs(X(r, j) - Xref(r, j)), 0.0, this->thresh)
+            << "method " << static_cast<int>(method) << " " << r << " " << j;
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
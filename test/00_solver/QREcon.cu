@@ -47,7 +47,7 @@ TYPED_TEST_SUITE(QREconSolverTestNonHalfTypes,
   MatXFloatNonHalfTypesCUDAExec);
 
 template <typename TestType, int RANK>
-void qr_econ_test( const index_t (&AshapeA)[RANK]) { 
+void qr_econ_test( const index_t (&AshapeA)[RANK], QRMethod method = QRMethod::GEQRF, double tol = .00001) { 
   using AType = TestType;
   using SType = typename inner_op_type_t<AType>::type;
   
@@ -73,9 +73,16 @@ void qr_econ_test( const index_t (&AshapeA)[RANK]) {
   
   (A = random<AType>(Ashape, NORMAL)).run(exec);
   
-  // example-begin qr-econ-test-1
-  (mtie(Q, R) = qr_econ(A)).run(exec);
-  // example-end qr-econ-test-1
+  if (method == QRMethod::GEQRF) {
+    // example-begin qr-econ-test-1
+    (mtie(Q, R) = qr_econ(A)).run(exec);
+    // example-end qr-econ-test-1
+  }
+  else {
+    // example-begin qr-econ-test-2
+    (mtie(Q, R) = qr_econ(A, method)).run(exec);
+    // example-end qr-econ-test-2
+  }
 
   auto mdiffQTQ = make_tensor<SType>({});
   auto mdiffQR = make_tensor<SType>({});
@@ -109,8 +116,8 @@ void qr_econ_test( const index_t (&AshapeA)[RANK]) {
 
   exec.sync();
 
-  ASSERT_NEAR( mdiffQTQ(), SType(0), .00001);
-  ASSERT_NEAR( mdiffQR(), SType(0), .00001);
+  ASSERT_NEAR( mdiffQTQ(), SType(0), tol);
+  ASSERT_NEAR( mdiffQR(), SType(0), tol);
 }
 
 TYPED_TEST(QREconSolverTestNonHalfTypes, QREcon)
@@ -133,3 +140,19 @@ TYPED_TEST(QREconSolverTestNonHalfTypes, QREcon)
   
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(QREconSolverTestNonHalfTypes, QREconTall)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  // Small enough for TSQR to factor directly, then one and two levels of the tree
+  qr_econ_test<TestType>({64,16}, QRMethod::TSQR);
+  qr_econ_test<TestType>({1000,16}, QRMethod::TSQR, .0001);
+  qr_econ_test<TestType>({100000,8}, QRMethod::TSQR, .001);
+
+  qr_econ_test<TestType>({1000,16}, QRMethod::CHOLQR2, .0001);
+  qr_econ_test<TestType>({4096,32}, QRMethod::AUTO, .0001);
+
+  MATX_EXIT_HANDLER();
+}
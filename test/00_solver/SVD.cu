@@ -586,6 +586,85 @@ void svdpi_test( const index_t (&AshapeA)[RANK], Executor exec) {
   ASSERT_NEAR( mdiffA(), SType(0), .00001);
 }
 
+template <typename TypeParam, int RANK, typename Executor>
+void rsvd_test( const index_t (&AshapeA)[RANK], index_t rank, Executor exec) {
+  using AType = TypeParam;
+  using SType = typename inner_op_type_t<AType>::type;
+
+  cuda::std::array<index_t, RANK> Ashape = detail::to_array(AshapeA);
+
+  index_t mm = Ashape[RANK-2];
+
+  // Build an exactly rank-deficient A = X * Y so that the truncated SVD reproduces it
+  auto Xshape = Ashape;
+  Xshape[RANK-1] = rank;
+  auto Yshape = Ashape;
+  Yshape[RANK-2] = rank;
+
+  auto Ushape = Ashape;
+  Ushape[RANK-1] = rank;
+  auto VTshape = Ashape;
+  VTshape[RANK-2] = rank;
+  cuda::std::array<index_t, RANK-1> Sshape;
+  for(index_t i = 0; i < RANK-2; i++) {
+    Sshape[i] = Ashape[i];
+  }
+  Sshape[RANK-2] = rank;
+
+  auto X = make_tensor<AType>(Xshape);
+  auto Y = make_tensor<AType>(Yshape);
+  (X = random<AType>(Xshape, NORMAL)).run(exec);
+  (Y = random<AType>(Yshape, NORMAL)).run(exec);
+
+  // example-begin rsvd-test-1
+  auto A = make_tensor<AType>(Ashape);
+  auto U = make_tensor<AType>(Ushape);
+  auto VT = make_tensor<AType>(VTshape);
+  auto S = make_tensor<SType>(Sshape);
+
+  (A = matmul(X, Y)).run(exec);
+
+  // Compute the rank leading singular triplets with 10 extra samples and 2 power iterations
+  (mtie(U, S, VT) = rsvd(A, rank, 10, 2)).run(exec);
+  // example-end rsvd-test-1
+
+  cuda::std::array<index_t, RANK> Dshape;
+  Dshape.fill(matxKeepDim);
+  Dshape[RANK-2] = mm;
+
+  auto UD = make_tensor<AType>(Ushape);
+  auto UDVT = make_tensor<AType>(Ashape);
+  auto Ad = make_tensor<SType>(Ashape);
+  auto Amax = make_tensor<SType>({});
+  auto mdiffA = make_tensor<SType>({});
+
+  (UD = U * clone<RANK>(S, Dshape)).run(exec);
+  (UDVT = matmul(UD, VT)).run(exec);
+  (Ad = abs(A - UDVT)).run(exec);
+  (mdiffA = max(Ad)).run(exec);
+  (Amax = max(abs(A))).run(exec);
+  exec.sync();
+
+  ASSERT_LT(mdiffA(), SType(1e-3) * Amax());
+  if constexpr (RANK == 2) {
+    for (index_t i = 1; i < rank; i++) {
+      ASSERT_GE(S(i - 1), S(i));
+    }
+  }
+}
+
+TYPED_TEST(SVDPISolverTestNonHalfTypes, RSVD)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  rsvd_test<TestType>({500, 40}, 4, this->exec);
+  rsvd_test<TestType>({40, 500}, 4, this->exec);
+  rsvd_test<TestType>({5, 300, 30}, 3, this->exec);
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(SVDPISolverTestNonHalfTypes, SVDPI)
 {
   MATX_ENTER_HANDLER();
@@ -188,6 +188,76 @@ TYPED_TEST(ConvertSparseTestsAll, ConvertCSR) {
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(ConvertSparseTestsAll, ConvertCSRCapacity) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  auto D = makeD<TestType>();
+  const auto m = D.Size(0);
+  const auto n = D.Size(1);
+
+  // example-begin dense2sparse-capacity-test-1
+  // Room for up to 8 nonzeros. The count never leaves the device, so the
+  // conversion can be captured and replayed as D changes
+  auto S =
+      experimental::make_zero_tensor_csr<TestType, index_t, index_t>({m, n});
+  cudaGraph graph;
+  exec.capture(graph, [&]() {
+    (S = dense2sparse(D, 8)).run(exec);
+  });
+  exec.launch(graph);
+  // example-end dense2sparse-capacity-test-1
+  exec.sync();
+
+  ASSERT_EQ(S.Nse(), 8);
+  ASSERT_EQ(S.posSize(1), m + 1);
+  ASSERT_EQ(S.POSData(1)[m], 4);
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_EQ(S(i, j), D(i, j));
+    }
+  }
+
+  // A replay counts the nonzeros again
+  D(2, 3) = static_cast<TestType>(5);
+  exec.launch(graph);
+  exec.sync();
+  ASSERT_EQ(S.POSData(1)[m], 5);
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_EQ(S(i, j), D(i, j));
+    }
+  }
+
+  // Nonzeros past the capacity are dropped in row-major order
+  (S = dense2sparse(D, 2)).run(exec);
+  exec.sync();
+  ASSERT_EQ(S.Nse(), 2);
+  ASSERT_EQ(S.POSData(1)[m], 2);
+  ASSERT_EQ(S(0, 1), D(0, 1));
+  ASSERT_EQ(S(2, 3), D(2, 3));
+  ASSERT_EQ(S(4, 4), static_cast<TestType>(0));
+
+  // CSC counts and places the nonzeros per column
+  auto C =
+      experimental::make_zero_tensor_csc<TestType, index_t, index_t>({m, n});
+  (C = dense2sparse(D, m * n)).run(exec);
+  exec.sync();
+  ASSERT_EQ(C.POSData(1)[n], 5);
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_EQ(C(i, j), D(i, j));
+    }
+  }
+
+  cudaStreamDestroy(stream);
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(ConvertSparseTestsAll, ConvertCSC) {
   MATX_ENTER_HANDLER();
   using TestType = cuda::std::tuple_element_t<0, TypeParam>;
@@ -252,3 +322,48 @@ TYPED_TEST(ConvertSparseTestsAll, ConvertCSC) {
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(ConvertSparseTestsAll, AssembleCSR) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto D = makeD<TestType>();
+  const auto m = D.Size(0);
+  const auto n = D.Size(1);
+
+  // Unsorted triplets with duplicates that sum to the entries of D.
+  const index_t nnz = 7;
+  const int rows[nnz] = {9, 0, 4, 9, 0, 9, 4};
+  const int cols[nnz] = {9, 1, 4, 1, 1, 9, 4};
+  const float vals[nnz] = {1.0f, 0.5f, 1.5f, 3.0f, 0.5f, 3.0f, 0.5f};
+  auto V = make_tensor<TestType>({nnz});
+  auto R = make_tensor<int>({nnz});
+  auto C = make_tensor<int>({nnz});
+  for (index_t k = 0; k < nnz; k++) {
+    V(k) = static_cast<TestType>(vals[k]);
+    R(k) = rows[k];
+    C(k) = cols[k];
+  }
+
+  // example-begin make_tensor_csr_from_coo-test-1
+  auto A = experimental::make_tensor_csr_from_coo(V, R, C, {m, n}, exec);
+  // example-end make_tensor_csr_from_coo-test-1
+  ASSERT_EQ(A.Rank(), 2);
+  ASSERT_EQ(A.Size(0), m);
+  ASSERT_EQ(A.Size(1), n);
+  ASSERT_EQ(A.Nse(), 4);
+  ASSERT_EQ(A.posSize(1), m + 1);
+  ASSERT_EQ(A.crdSize(1), 4);
+
+  exec.sync();
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_EQ(A(i, j), D(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+// Helper method
+template <typename T> static auto makeD(int variant) {
+  const index_t m = 10;
+  const index_t n = 10;
+  tensor_t<T, 2> D = make_tensor<T>({m, n});
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      D(i, j) = static_cast<T>(0);
+    }
+  }
+  if (variant == 0) {
+    D(0, 1) = static_cast<T>(1);
+    D(4, 4) = static_cast<T>(2);
+    D(9, 1) = static_cast<T>(3);
+    D(9, 9) = static_cast<T>(4);
+  } else {
+    D(0, 1) = static_cast<T>(5);
+    D(0, 2) = static_cast<T>(6);
+    D(5, 5) = static_cast<T>(7);
+    D(9, 9) = static_cast<T>(-4);
+  }
+  return D;
+}
+
+template <typename T> class ElementwiseSparseTest : public ::testing::Test {
+protected:
+  using GTestType = cuda::std::tuple_element_t<0, T>;
+  using GExecType = cuda::std::tuple_element_t<1, T>;
+  void SetUp() override { CheckTestTypeSupport<GTestType>(); }
+};
+
+template <typename T>
+class ElementwiseSparseTestsAll : public ElementwiseSparseTest<T> {};
+
+TYPED_TEST_SUITE(ElementwiseSparseTestsAll,
+                 MatXFloatNonComplexNonHalfTypesCUDAExec);
+
+TYPED_TEST(ElementwiseSparseTestsAll, SparseMapCSR) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto D = makeD<TestType>(0);
+  const auto m = D.Size(0);
+  const auto n = D.Size(1);
+  auto A = experimental::make_zero_tensor_csr<TestType, int, int>({m, n});
+  (A = dense2sparse(D)).run(exec);
+
+  // Scale the stored values into a new sparse tensor with the same pattern.
+  // example-begin sparse-map-test-1
+  auto B = experimental::make_zero_tensor_csr<TestType, int, int>({m, n});
+  (B = sparse_map(A, [](auto v) { return v * static_cast<TestType>(2); }))
+      .run(exec);
+  // example-end sparse-map-test-1
+  ASSERT_EQ(B.Nse(), 4);
+
+  // Negate in-place, and then apply abs to the values view directly.
+  (A = sparse_map(A, [](auto v) { return -v; })).run(exec);
+  exec.sync();
+  ASSERT_EQ(A.Nse(), 4);
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_EQ(A(i, j), -D(i, j));
+      ASSERT_EQ(B(i, j), static_cast<TestType>(2) * D(i, j));
+    }
+  }
+  // example-begin sparse-values-test-1
+  auto V = A.Values();
+  (V = abs(V)).run(exec);
+  // example-end sparse-values-test-1
+  exec.sync();
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_EQ(A(i, j), D(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ElementwiseSparseTestsAll, SparseAddCSR) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto D = makeD<TestType>(0);
+  auto E = makeD<TestType>(1);
+  const auto m = D.Size(0);
+  const auto n = D.Size(1);
+  auto A = experimental::make_zero_tensor_csr<TestType, int, int>({m, n});
+  auto B = experimental::make_zero_tensor_csr<TestType, int, int>({m, n});
+  (A = dense2sparse(D)).run(exec);
+  (B = dense2sparse(E)).run(exec);
+
+  // example-begin sparse-add-test-1
+  auto C = experimental::make_zero_tensor_csr<TestType, int, int>({m, n});
+  (C = sparse_add(A, B, 1.0f, 2.0f)).run(exec);
+  // example-end sparse-add-test-1
+
+  // Union of the patterns.
+  ASSERT_EQ(C.Nse(), 6);
+  exec.sync();
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_EQ(C(i, j), D(i, j) + static_cast<TestType>(2) * E(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+template <typename T> class KrylovSparseTest : public ::testing::Test {
+protected:
+  using GTestType = cuda::std::tuple_element_t<0, T>;
+  using GExecType = cuda::std::tuple_element_t<1, T>;
+  void SetUp() override {
+    CheckTestTypeSupport<GTestType>();
+  }
+
+  // 1D convection-diffusion matrix. Symmetric positive definite when c == 0
+  template <typename TestType>
+  auto MakeMatrix(index_t n, double c) {
+    auto A = make_tensor<TestType>({n, n});
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        A(i, j) = (i == j) ? TestType(2.5) : (j == i - 1 ? TestType(-1 - c) : (j == i + 1 ? TestType(-1 + c) : TestType(0)));
+      }
+    }
+    return A;
+  }
+
+  float thresh = 0.001f;
+};
+
+template <typename T> class KrylovSparseTestsAll : public KrylovSparseTest<T> {};
+
+TYPED_TEST_SUITE(KrylovSparseTestsAll, MatXFloatNonComplexNonHalfTypesCUDAExec);
+
+TYPED_TEST(KrylovSparseTestsAll, PCG) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  ExecType exec{};
+
+  const index_t N = 64;
+  auto A = this->template MakeMatrix<TestType>(N, 0.0);
+  auto S = experimental::make_zero_tensor_csr<TestType, int, int>({N, N});
+  (S = dense2sparse(A)).run(exec);
+
+  auto X = make_tensor<TestType>({N});
+  auto B = make_tensor<TestType>({N});
+  auto AX = make_tensor<TestType>({N});
+  (B = ones()).run(exec);
+
+  for (auto precond : {KrylovPrecond::NONE, KrylovPrecond::JACOBI, KrylovPrecond::ILU0, KrylovPrecond::IC0}) {
+    (X = zeros()).run(exec);
+    // example-begin pcgsolve-test-1
+    // Incomplete Cholesky preconditioned CG on a CSR matrix with 32-bit indices
+    (X = pcgsolve(S, B, precond, 1e-5, 2 * N, 4)).run(exec);
+    // example-end pcgsolve-test-1
+    (AX = matvec(A, X)).run(exec);
+    exec.sync();
+
+    for (index_t i = 0; i < N; i++) {
+      ASSERT_NEAR(AX(i), TestType(1), this->thresh);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(KrylovSparseTestsAll, PipelinedCG) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  ExecType exec{};
+
+  const index_t N = 64;
+  auto A = this->template MakeMatrix<TestType>(N, 0.0);
+  auto S = experimental::make_zero_tensor_csr<TestType, index_t, index_t>({N, N});
+  (S = dense2sparse(A)).run(exec);
+
+  auto X = make_tensor<TestType>({N});
+  auto B = make_tensor<TestType>({N});
+  auto AX = make_tensor<TestType>({N});
+  (B = ones()).run(exec);
+  (X = zeros()).run(exec);
+
+  // example-begin pipelined-cgsolve-test-1
+  (X = pipelined_cgsolve(S, B, KrylovPrecond::JACOBI, 1e-5, 2 * N, 8)).run(exec);
+  // example-end pipelined-cgsolve-test-1
+  (AX = matvec(A, X)).run(exec);
+  exec.sync();
+
+  for (index_t i = 0; i < N; i++) {
+    ASSERT_NEAR(AX(i), TestType(1), this->thresh);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(KrylovSparseTestsAll, NonSymmetric) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  ExecType exec{};
+
+  const index_t N = 64;
+  auto A = this->template MakeMatrix<TestType>(N, 0.4);
+  auto S = experimental::make_zero_tensor_csr<TestType, int, int>({N, N});
+  (S = dense2sparse(A)).run(exec);
+
+  auto X = make_tensor<TestType>({N});
+  auto B = make_tensor<TestType>({N});
+  auto AX = make_tensor<TestType>({N});
+  (B = ones()).run(exec);
+
+  // BiCGStab and restarted GMRES
+  (X = zeros()).run(exec);
+  // example-begin bicgstabsolve-test-1
+  (X = bicgstabsolve(S, B, KrylovPrecond::ILU0, 1e-5, 2 * N)).run(exec);
+  // example-end bicgstabsolve-test-1
+  (AX = matvec(A, X)).run(exec);
+  exec.sync();
+  for (index_t i = 0; i < N; i++) {
+    ASSERT_NEAR(AX(i), TestType(1), this->thresh);
+  }
+
+  (X = zeros()).run(exec);
+  // example-begin gmressolve-test-1
+  // GMRES(16) with a Jacobi preconditioner
+  (X = gmressolve(S, B, 16, KrylovPrecond::JACOBI, 1e-5, 4 * N)).run(exec);
+  // example-end gmressolve-test-1
+  (AX = matvec(A, X)).run(exec);
+  exec.sync();
+  for (index_t i = 0; i < N; i++) {
+    ASSERT_NEAR(AX(i), TestType(1), this->thresh);
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -274,3 +274,113 @@ TYPED_TEST(MatmulSparseTestsAll, MatmulCSC) {
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(MatmulSparseTestsAll, MatmulBSR) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto B = makeB<TestType>();
+  auto E = makeE<TestType>();
+  const index_t m = 4;
+  const index_t k = 8;
+  const auto n = B.Size(1);
+
+  // The matrix of makeA() in 2x2 blocks, stored row-major per block.
+  const float blocks[5][4] = {
+      {1, 2, 0, 0}, {0, 0, 0, 3}, {0, 0, 5, 6}, {0, 0, 0, 7}, {4, 0, 0, 0}};
+  auto V = make_tensor<TestType>({5 * 4});
+  for (index_t b = 0; b < 5; b++) {
+    for (index_t e = 0; e < 4; e++) {
+      V(b * 4 + e) = static_cast<TestType>(blocks[b][e]);
+    }
+  }
+  auto P = make_tensor<int>({3});
+  P(0) = 0;
+  P(1) = 2;
+  P(2) = 5;
+  auto C = make_tensor<int>({5});
+  C(0) = 0;
+  C(1) = 3;
+  C(2) = 1;
+  C(3) = 2;
+  C(4) = 3;
+  // example-begin matmul-bsr-test-1
+  auto S = experimental::make_tensor_bsr<2, 2>(V, P, C, {m, k});
+  auto O = make_tensor<TestType>({m, n});
+  (O = matmul(S, B)).run(exec);
+  // example-end matmul-bsr-test-1
+
+  // Verify result.
+  exec.sync();
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_NEAR(O(i, j), E(i, j), this->thresh);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+template <typename T>
+class MatmulSparseTestsFloat : public MatmulSparseTest<T> {};
+
+TYPED_TEST_SUITE(MatmulSparseTestsFloat, MatXFloatNonComplexNonHalfTypesCUDAExec);
+
+TYPED_TEST(MatmulSparseTestsFloat, SpGEMMCSR) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto A = makeA<TestType>();
+  const auto m = A.Size(0);
+  const auto k = A.Size(1);
+  auto At = make_tensor<TestType>({k, m});
+  auto E = make_tensor<TestType>({m, m});
+  (At = transpose(A)).run(exec);
+  (E = matmul(A, At)).run(exec);
+
+  // Convert dense A and its transpose to sparse CSR.
+  auto SA =
+      experimental::make_zero_tensor_csr<TestType, int32_t, int32_t>({m, k});
+  auto SB =
+      experimental::make_zero_tensor_csr<TestType, int32_t, int32_t>({k, m});
+  (SA = dense2sparse(A)).run(exec);
+  (SB = dense2sparse(At)).run(exec);
+
+  // example-begin spgemm-test-1
+  // Sparse x sparse into a new sparse tensor. The nnz of C comes from the
+  // cuSPARSE estimation, and C's storage is allocated to fit.
+  auto SC =
+      experimental::make_zero_tensor_csr<TestType, int32_t, int32_t>({m, m});
+  (SC = matmul(SA, SB)).run(exec);
+  // example-end spgemm-test-1
+
+  auto O = make_tensor<TestType>({m, m});
+  (O = sparse2dense(SC)).run(exec);
+  exec.sync();
+  ASSERT_EQ(SC.Nse(), 4); // rows of A have disjoint columns
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < m; j++) {
+      ASSERT_NEAR(O(i, j), E(i, j), this->thresh);
+    }
+  }
+
+  // Same pattern, new values: only the numeric phase runs again.
+  auto vals = make_tensor<TestType>(SA.Data(), {SA.Nse()});
+  (vals = vals * static_cast<TestType>(2)).run(exec);
+  (SC = matmul(SA, SB)).run(exec);
+  (O = sparse2dense(SC)).run(exec);
+  exec.sync();
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < m; j++) {
+      ASSERT_NEAR(O(i, j), 2 * E(i, j), this->thresh);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -206,3 +206,39 @@ TYPED_TEST(MatvecSparseTestsAll, MatvecCSC) {
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(MatvecSparseTestsAll, MatvecCSRAutotune) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto A = makeA<TestType>();
+  auto B = makeB<TestType>();
+  auto C = makeC<TestType>();
+  const auto m = A.Size(0);
+  const auto n = A.Size(1);
+
+  auto S =
+      experimental::make_zero_tensor_csr<TestType, int32_t, int32_t>({m, n});
+  (S = dense2sparse(A)).run(exec);
+
+  // Benchmarking the candidate algorithms must not disturb the output, and
+  // the cached plan must rebind new dense vectors.
+  auto O1 = make_tensor<TestType>({m});
+  auto O2 = make_tensor<TestType>({m});
+  SetSparseAutotune(true);
+  (O1 = matvec(S, B)).run(exec);
+  (O2 = matvec(S, B)).run(exec);
+  SetSparseAutotune(false);
+
+  // Verify result.
+  exec.sync();
+  for (index_t i = 0; i < m; i++) {
+    ASSERT_NEAR(O1(i), C(i), this->thresh);
+    ASSERT_NEAR(O2(i), C(i), this->thresh);
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -155,3 +155,73 @@ TYPED_TEST(SolveSparseTestsAll, SolveCSR) {
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(SolveSparseTestsAll, SolveCSRRefactor) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  // Tridiagonal system with a fixed sparsity pattern.
+  const index_t N = 16;
+  auto A = make_tensor<TestType>({N, N});
+  auto X = make_tensor<TestType>({2, N});
+  auto E = make_tensor<TestType>({2, N});
+  auto Y = make_tensor<TestType>({2, N});
+  (A = zeros()).run(exec);
+  exec.sync();
+  for (index_t i = 0; i < N; i++) {
+    A(i, i) = static_cast<TestType>(4);
+    if (i > 0) {
+      A(i, i - 1) = static_cast<TestType>(-1);
+    }
+    if (i < N - 1) {
+      A(i, i + 1) = static_cast<TestType>(1);
+    }
+    E(0, i) = static_cast<TestType>(i + 1);
+    E(1, i) = static_cast<TestType>(N - i);
+  }
+  auto S = experimental::make_zero_tensor_csr<TestType, int32_t, int32_t>({N, N});
+  (S = dense2sparse(A)).run(exec);
+  (Y = transpose(matmul(A, transpose(E)))).run(exec);
+
+  // example-begin solve-test-2
+  // The first solve runs the cuDSS analysis. Later solves with the same
+  // sparsity pattern only refactorize.
+  (X = solve(S, Y)).run(exec);
+  auto vals = make_tensor<TestType>(S.Data(), {S.Nse()});
+  (vals = vals * static_cast<TestType>(2)).run(exec);
+  (X = solve(S, Y)).run(exec);
+  // example-end solve-test-2
+
+  exec.sync();
+  for (index_t i = 0; i < 2; i++) {
+    for (index_t j = 0; j < N; j++) {
+      if constexpr (is_complex_v<TestType>) {
+        ASSERT_NEAR(2 * X(i, j).real(), E(i, j).real(), this->thresh);
+        ASSERT_NEAR(2 * X(i, j).imag(), E(i, j).imag(), this->thresh);
+      } else {
+        ASSERT_NEAR(2 * X(i, j), E(i, j), this->thresh);
+      }
+    }
+  }
+
+  // Reuse the factorization for a new right-hand side.
+  (Y = Y * static_cast<TestType>(2)).run(exec);
+  (X = solve(S, Y, false)).run(exec);
+
+  exec.sync();
+  for (index_t i = 0; i < 2; i++) {
+    for (index_t j = 0; j < N; j++) {
+      if constexpr (is_complex_v<TestType>) {
+        ASSERT_NEAR(X(i, j).real(), E(i, j).real(), this->thresh);
+        ASSERT_NEAR(X(i, j).imag(), E(i, j).imag(), this->thresh);
+      } else {
+        ASSERT_NEAR(X(i, j), E(i, j), this->thresh);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
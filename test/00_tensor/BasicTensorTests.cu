@@ -564,3 +564,45 @@ TYPED_TEST(BasicTensorTestsAll, DLPack)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(BasicTensorTestsAll, DLPackImport)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  auto t = make_tensor<TestType>({5,10,20});
+  auto sl = slice(t, {1, 0, 2}, {4, matxEnd, matxEnd}, {1, 2, 1});
+  const auto refs = t.GetRefCount();
+
+  {
+    // Owning import keeps the exported tensor alive until the last MatX reference is gone
+    tensor_t<TestType, 3> t2;
+    make_tensor(t2, sl.ToDlPack());
+    ASSERT_EQ(t.GetRefCount(), refs + 1);
+    ASSERT_EQ(t2.Data(), sl.Data());
+    for (int r = 0; r < 3; r++) {
+      ASSERT_EQ(t2.Size(r), sl.Size(r));
+      ASSERT_EQ(t2.Stride(r), sl.Stride(r));
+    }
+  }
+  ASSERT_EQ(t.GetRefCount(), refs);
+
+  // Null strides are compact row-major and byte_offset is applied to the data pointer
+  int64_t shape[2] = {10, 20};
+  DLManagedTensor dlm{};
+  dlm.dl_tensor.data        = t.Data();
+  dlm.dl_tensor.ndim        = 2;
+  dlm.dl_tensor.dtype       = detail::TypeToDLPackType<TestType>();
+  dlm.dl_tensor.shape       = shape;
+  dlm.dl_tensor.strides     = nullptr;
+  dlm.dl_tensor.byte_offset = 200 * sizeof(TestType);
+
+  tensor_t<TestType, 2> t3;
+  make_tensor(t3, dlm);
+  ASSERT_EQ(t3.Data(), t.Data() + 200);
+  ASSERT_EQ(t3.Stride(0), 20);
+  ASSERT_EQ(t3.Stride(1), 1);
+
+  MATX_EXIT_HANDLER();
+}
+
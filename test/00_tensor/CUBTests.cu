@@ -132,6 +132,85 @@ TEST(TensorStats, Hist)
   MATX_EXIT_HANDLER();
 }
 
+TEST(TensorStats, HistBatched)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr int levels = 7;
+  cudaExecutor exec{};
+
+  auto in = make_tensor<float>({3, 10});
+  auto out = make_tensor<int>({3, levels - 1});
+  for (index_t r = 0; r < in.Size(0); r++) {
+    for (index_t i = 0; i < in.Size(1); i++) {
+      in(r, i) = static_cast<float>((r * 7 + i * 3) % 13);
+    }
+  }
+
+  (out = hist(in, 0.0f, 12.0f, levels)).run(exec);
+  exec.sync();
+
+  for (index_t r = 0; r < in.Size(0); r++) {
+    for (int b = 0; b < levels - 1; b++) {
+      int cnt = 0;
+      for (index_t i = 0; i < in.Size(1); i++) {
+        cnt += (in(r, i) >= 2.0f * b && in(r, i) < 2.0f * (b + 1)) ? 1 : 0;
+      }
+      ASSERT_EQ(out(r, b), cnt);
+    }
+  }
+
+  // Non-uniform edges
+  auto edges = make_tensor<float>({4});
+  edges.SetVals({0.0f, 1.0f, 5.0f, 12.0f});
+  auto out_range = make_tensor<int>({3, 3});
+  // example-begin hist-test-2
+  // Count each row of "in" into the bins [0, 1), [1, 5) and [5, 12)
+  (out_range = hist(in, edges)).run(exec);
+  // example-end hist-test-2
+  exec.sync();
+
+  for (index_t r = 0; r < in.Size(0); r++) {
+    for (index_t b = 0; b < 3; b++) {
+      int cnt = 0;
+      for (index_t i = 0; i < in.Size(1); i++) {
+        cnt += (in(r, i) >= edges(b) && in(r, i) < edges(b + 1)) ? 1 : 0;
+      }
+      ASSERT_EQ(out_range(r, b), cnt);
+    }
+  }
+
+  // Joint histogram of two inputs
+  auto y = make_tensor<float>({3, 10});
+  for (index_t r = 0; r < y.Size(0); r++) {
+    for (index_t i = 0; i < y.Size(1); i++) {
+      y(r, i) = static_cast<float>((r + i * 5) % 8) * 0.5f;
+    }
+  }
+
+  auto out2d = make_tensor<int>({3, 4, 2});
+  // example-begin hist2d-test-1
+  // 4 bins of "in" over [0, 12) by 2 bins of "y" over [0, 4) for each row
+  (out2d = hist2d(in, y, 0.0f, 12.0f, 5, 0.0f, 4.0f, 3)).run(exec);
+  // example-end hist2d-test-1
+  exec.sync();
+
+  for (index_t r = 0; r < in.Size(0); r++) {
+    for (int bx = 0; bx < 4; bx++) {
+      for (int by = 0; by < 2; by++) {
+        int cnt = 0;
+        for (index_t i = 0; i < in.Size(1); i++) {
+          cnt += (in(r, i) >= 3.0f * bx && in(r, i) < 3.0f * (bx + 1) &&
+                  y(r, i) >= 2.0f * by && y(r, i) < 2.0f * (by + 1)) ? 1 : 0;
+        }
+        ASSERT_EQ(out2d(r, bx, by), cnt);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(CUBTestsNumericNonComplexAllExecs, CumSum)
 {
   MATX_ENTER_HANDLER();
@@ -179,6 +258,96 @@ TYPED_TEST(CUBTestsNumericNonComplexAllExecs, CumSum)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(CUBTestsNumericNonComplexAllExecs, Scan)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  auto t3 = make_tensor<TestType>({4, 300, 5});
+  for (index_t i = 0; i < t3.Size(0); i++) {
+    for (index_t j = 0; j < t3.Size(1); j++) {
+      for (index_t k = 0; k < t3.Size(2); k++) {
+        t3(i, j, k) = static_cast<TestType>((i * 7 + j * 3 + k * 5) % 11 - 5);
+      }
+    }
+  }
+
+  // example-begin scan-test-1
+  // Cumulative sum down the middle dimension, with no permute or copy
+  auto csum = make_tensor<TestType>(t3.Shape());
+  (csum = cumsum(t3, 1)).run(this->exec);
+
+  // Exclusive running maximum along the last dimension
+  auto cmax = make_tensor<TestType>(t3.Shape());
+  (cmax = scan(t3, 2, ScanFunc::MAX, ScanType::EXCLUSIVE)).run(this->exec);
+  // example-end scan-test-1
+  this->exec.sync();
+
+  for (index_t i = 0; i < t3.Size(0); i++) {
+    for (index_t k = 0; k < t3.Size(2); k++) {
+      TestType ttl = 0;
+      for (index_t j = 0; j < t3.Size(1); j++) {
+        ttl += t3(i, j, k);
+        ASSERT_NEAR(csum(i, j, k), ttl, 0.001) << i << " " << j << " " << k;
+      }
+    }
+
+    for (index_t j = 0; j < t3.Size(1); j++) {
+      TestType mx = std::numeric_limits<TestType>::lowest();
+      for (index_t k = 0; k < t3.Size(2); k++) {
+        ASSERT_EQ(cmax(i, j, k), mx);
+        mx = std::max(mx, t3(i, j, k));
+      }
+    }
+  }
+
+  // Long rows take the single-pass look-back scan across several tiles
+  auto t2 = make_tensor<TestType>({3, 5000});
+  for (index_t i = 0; i < t2.Size(0); i++) {
+    for (index_t j = 0; j < t2.Size(1); j++) {
+      t2(i, j) = static_cast<TestType>((i + j * 3) % 5 - 2);
+    }
+  }
+
+  auto rsum = make_tensor<TestType>(t2.Shape());
+  auto rsum_ex = make_tensor<TestType>(t2.Shape());
+  auto rmin = make_tensor<TestType>(t2.Shape());
+  (rsum = cumsum(t2)).run(this->exec);
+  (rsum_ex = scan(t2, 1, ScanFunc::SUM, ScanType::EXCLUSIVE)).run(this->exec);
+  (rmin = scan(t2, 1, ScanFunc::MIN)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t i = 0; i < t2.Size(0); i++) {
+    TestType ttl = 0;
+    TestType mn = std::numeric_limits<TestType>::max();
+    for (index_t j = 0; j < t2.Size(1); j++) {
+      ASSERT_NEAR(rsum_ex(i, j), ttl, 0.001) << i << " " << j;
+      ttl += t2(i, j);
+      mn = std::min(mn, t2(i, j));
+      ASSERT_NEAR(rsum(i, j), ttl, 0.001) << i << " " << j;
+      ASSERT_EQ(rmin(i, j), mn);
+    }
+  }
+
+  // Product scan
+  auto t1 = make_tensor<TestType>({20});
+  for (index_t i = 0; i < t1.Size(0); i++) {
+    t1(i) = static_cast<TestType>(i % 2 == 0 ? 2 : -1);
+  }
+  auto cprod = make_tensor<TestType>({20});
+  (cprod = scan(t1, 0, ScanFunc::PROD)).run(this->exec);
+  this->exec.sync();
+
+  TestType p = 1;
+  for (index_t i = 0; i < t1.Size(0); i++) {
+    p *= t1(i);
+    ASSERT_NEAR(cprod(i), p, 0.001);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(CUBTestsNumericNonComplexAllExecs, Sort)
 {
   MATX_ENTER_HANDLER();
@@ -259,10 +428,115 @@ TYPED_TEST(CUBTestsNumericNonComplexAllExecs, Sort)
     }
   }
 
+  // Sorting a tensor into itself
+  (tmpv = this->t1).run(this->exec);
+  (tmpv = matx::sort(tmpv, SORT_DIR_ASC)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t i = 1; i < tmpv.Lsize(); i++) {
+    ASSERT_TRUE(tmpv(i) > tmpv(i - 1));
+  }
+
+  (tmpv2 = this->t2).run(this->exec);
+  (tmpv2 = matx::sort(tmpv2, SORT_DIR_DESC)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t i = 0; i < tmpv2.Size(0); i++) {
+    for (index_t j = 1; j < tmpv2.Size(1); j++) {
+      ASSERT_TRUE(tmpv2(i, j) < tmpv2(i, j - 1));
+    }
+  }
+
   MATX_EXIT_HANDLER();
 }
 
 
+TYPED_TEST(CUBTestsFloatNonComplex, SortFloatKeys)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  // A permutation of -100..99, which every float type including bfloat16 holds exactly. Half and bfloat16
+  // keys are sorted by CUB as 16-bit keys
+  const index_t N = 200;
+  auto in = make_tensor<TestType>({4, N});
+  auto out = make_tensor<TestType>({4, N});
+  auto idx = make_tensor<index_t>({4, N});
+  for (index_t b = 0; b < 4; b++) {
+    for (index_t i = 0; i < N; i++) {
+      in(b, i) = static_cast<TestType>(static_cast<float>(((i + b) * 37) % N - 100));
+    }
+  }
+
+  (out = matx::sort(in, SORT_DIR_ASC)).run(this->exec);
+  (idx = matx::argsort(in, SORT_DIR_DESC)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t b = 0; b < 4; b++) {
+    for (index_t i = 0; i < N; i++) {
+      ASSERT_EQ(static_cast<float>(out(b, i)), static_cast<float>(i - 100));
+      ASSERT_EQ(static_cast<float>(in(b, idx(b, i))), static_cast<float>(N - 101 - i));
+    }
+  }
+
+  auto in1 = slice<1>(in, {0, 0}, {matxDropDim, matxEnd});
+  auto out1 = make_tensor<TestType>({N});
+  (out1 = matx::sort(in1, SORT_DIR_DESC)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t i = 0; i < N; i++) {
+    ASSERT_EQ(static_cast<float>(out1(i)), static_cast<float>(N - 101 - i));
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CUBTestsComplex, SortByMagnitude)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using inner_type = typename inner_op_type_t<TestType>::type;
+
+  // Magnitudes are a permutation of 0..63, placed on either axis so the components alone don't order them
+  const index_t N = 64;
+  auto in = make_tensor<TestType>({N});
+  auto out = make_tensor<TestType>({N});
+  auto idx = make_tensor<index_t>({N});
+  auto mag = [](const TestType &v) {
+    const float re = static_cast<float>(v.real());
+    const float im = static_cast<float>(v.imag());
+    return std::sqrt(re * re + im * im);
+  };
+  for (index_t i = 0; i < N; i++) {
+    const auto m = static_cast<float>((i * 37) % N);
+    in(i) = (i % 2) ? TestType(inner_type(0.0f), static_cast<inner_type>(m)) : TestType(static_cast<inner_type>(-m), inner_type(0.0f));
+  }
+
+  // example-begin sort-test-3
+  // Complex values are sorted by magnitude
+  (out = matx::sort(in, SORT_DIR_ASC)).run(this->exec);
+  // example-end sort-test-3
+  (idx = matx::argsort(in, SORT_DIR_DESC)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t i = 0; i < N; i++) {
+    ASSERT_EQ(mag(out(i)), static_cast<float>(i));
+    ASSERT_EQ(mag(in(idx(i))), static_cast<float>(N - 1 - i));
+  }
+
+  // Sorting into the input is staged through a copy of the values
+  (in = matx::sort(in, SORT_DIR_DESC)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t i = 0; i < N; i++) {
+    ASSERT_EQ(mag(in(i)), static_cast<float>(N - 1 - i));
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(CUBTestsNumericNonComplexAllExecs, Argsort)
 {
   MATX_ENTER_HANDLER();
@@ -345,3 +619,188 @@ TYPED_TEST(CUBTestsNumericNonComplexAllExecs, Argsort)
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(CUBTestsNumericNonComplexAllExecs, TopK)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  const index_t n = 1000;
+  const index_t k = 100;
+  auto in = make_tensor<TestType>({2, 3, n});
+
+  // Each row is a permutation of -n/2 .. n/2-1
+  for (index_t i = 0; i < in.Size(0); i++) {
+    for (index_t j = 0; j < in.Size(1); j++) {
+      for (index_t c = 0; c < n; c++) {
+        in(i, j, c) = static_cast<TestType>((c * 7919 + (i * 3 + j) * 13) % n - n / 2);
+      }
+    }
+  }
+
+  // example-begin topk-test-1
+  // Largest 100 values of every row of "in", and where they came from
+  auto vals = make_tensor<TestType>({2, 3, k});
+  auto idx = make_tensor<index_t>({2, 3, k});
+  (mtie(vals, idx) = topk(in, k)).run(this->exec);
+  // example-end topk-test-1
+  this->exec.sync();
+
+  for (index_t i = 0; i < in.Size(0); i++) {
+    for (index_t j = 0; j < in.Size(1); j++) {
+      for (index_t c = 0; c < k; c++) {
+        ASSERT_EQ(vals(i, j, c), static_cast<TestType>(n / 2 - 1 - c));
+        ASSERT_EQ(in(i, j, idx(i, j, c)), vals(i, j, c));
+      }
+    }
+  }
+
+  (mtie(vals, idx) = topk(in, k, SORT_DIR_ASC)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t i = 0; i < in.Size(0); i++) {
+    for (index_t j = 0; j < in.Size(1); j++) {
+      for (index_t c = 0; c < k; c++) {
+        ASSERT_EQ(vals(i, j, c), static_cast<TestType>(c - n / 2));
+        ASSERT_EQ(in(i, j, idx(i, j, c)), vals(i, j, c));
+      }
+    }
+  }
+
+  // Ties: every value appears twice, so the top 3 are 9, 9, 8 with ties by index
+  auto t1 = make_tensor<TestType>({20});
+  for (index_t c = 0; c < 20; c++) {
+    t1(c) = static_cast<TestType>(c % 10);
+  }
+  auto v1 = make_tensor<TestType>({3});
+  auto i1 = make_tensor<index_t>({3});
+  (mtie(v1, i1) = topk(t1, 3)).run(this->exec);
+  this->exec.sync();
+
+  ASSERT_EQ(v1(0), static_cast<TestType>(9));
+  ASSERT_EQ(v1(1), static_cast<TestType>(9));
+  ASSERT_EQ(v1(2), static_cast<TestType>(8));
+  ASSERT_EQ(i1(0), 9);
+  ASSERT_EQ(i1(1), 19);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CUBTestsNumericNonComplexAllExecs, Segmented)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  // Ragged segments, including an empty one
+  const std::vector<index_t> lens = {3, 0, 5, 1, 200};
+  auto offsets = make_tensor<index_t>({static_cast<index_t>(lens.size()) + 1});
+  offsets(0) = 0;
+  for (size_t s = 0; s < lens.size(); s++) {
+    offsets(s + 1) = offsets(s) + lens[s];
+  }
+
+  const index_t n = offsets(lens.size());
+  auto in = make_tensor<TestType>({n});
+  for (index_t i = 0; i < n; i++) {
+    in(i) = static_cast<TestType>((i * 37) % 101 - 50);
+  }
+
+  // example-begin segmented-sort-test-1
+  // Sort each segment [offsets(s), offsets(s+1)) of "in" independently
+  auto sorted = make_tensor<TestType>({n});
+  (sorted = segmented_sort(in, offsets)).run(this->exec);
+  // example-end segmented-sort-test-1
+
+  // example-begin segmented-argsort-test-1
+  auto idx = make_tensor<index_t>({n});
+  (idx = segmented_argsort(in, offsets, SORT_DIR_DESC)).run(this->exec);
+  // example-end segmented-argsort-test-1
+
+  // example-begin segmented-reduce-test-1
+  // One sum, min and max per segment
+  auto sums = make_tensor<TestType>({static_cast<index_t>(lens.size())});
+  auto mins = make_tensor<TestType>({static_cast<index_t>(lens.size())});
+  auto maxs = make_tensor<TestType>({static_cast<index_t>(lens.size())});
+  (sums = segmented_sum(in, offsets)).run(this->exec);
+  (mins = segmented_min(in, offsets)).run(this->exec);
+  (maxs = segmented_max(in, offsets)).run(this->exec);
+  // example-end segmented-reduce-test-1
+  this->exec.sync();
+
+  for (size_t s = 0; s < lens.size(); s++) {
+    std::vector<TestType> ref;
+    for (index_t i = offsets(s); i < offsets(s + 1); i++) {
+      ref.push_back(in(i));
+    }
+    std::sort(ref.begin(), ref.end());
+
+    TestType sum = 0;
+    for (size_t i = 0; i < ref.size(); i++) {
+      ASSERT_EQ(sorted(offsets(s) + i), ref[i]);
+      ASSERT_EQ(in(idx(offsets(s) + i)), ref[ref.size() - 1 - i]);
+      ASSERT_GE(idx(offsets(s) + i), offsets(s));
+      ASSERT_LT(idx(offsets(s) + i), offsets(s + 1));
+      sum += ref[i];
+    }
+
+    ASSERT_NEAR(sums(s), sum, 0.001);
+    if (ref.empty()) {
+      ASSERT_EQ(mins(s), cuda::std::numeric_limits<TestType>::max());
+      ASSERT_EQ(maxs(s), cuda::std::numeric_limits<TestType>::lowest());
+    }
+    else {
+      ASSERT_EQ(mins(s), ref.front());
+      ASSERT_EQ(maxs(s), ref.back());
+    }
+  }
+
+  // A single long segment takes the block per segment reduction
+  auto offsets_long = make_tensor<index_t>({2});
+  offsets_long.SetVals({0, n});
+  auto sum_long = make_tensor<TestType>({1});
+  auto max_long = make_tensor<TestType>({1});
+  (sum_long = segmented_sum(in, offsets_long)).run(this->exec);
+  (max_long = segmented_max(in, offsets_long)).run(this->exec);
+  this->exec.sync();
+
+  TestType sum = 0;
+  TestType mx = in(0);
+  for (index_t i = 0; i < n; i++) {
+    sum += in(i);
+    mx = std::max(mx, in(i));
+  }
+  ASSERT_NEAR(sum_long(0), sum, 0.001);
+  ASSERT_EQ(max_long(0), mx);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CUBTestsFloatNonComplex, TopKHalf)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  // Small integers so the values are exact in every floating point type
+  const index_t n = 200;
+  const index_t k = 16;
+  auto in = make_tensor<TestType>({4, n});
+  for (index_t r = 0; r < in.Size(0); r++) {
+    for (index_t c = 0; c < n; c++) {
+      in(r, c) = static_cast<TestType>(static_cast<float>((c * 7919 + r * 13) % n - n / 2));
+    }
+  }
+
+  auto vals = make_tensor<TestType>({4, k});
+  auto idx = make_tensor<index_t>({4, k});
+  (mtie(vals, idx) = topk(in, k)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t r = 0; r < in.Size(0); r++) {
+    for (index_t c = 0; c < k; c++) {
+      ASSERT_EQ(static_cast<float>(vals(r, c)), static_cast<float>(n / 2 - 1 - c));
+      ASSERT_EQ(static_cast<float>(in(r, idx(r, c))), static_cast<float>(vals(r, c)));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
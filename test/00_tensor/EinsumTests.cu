@@ -96,6 +96,11 @@ TYPED_TEST_SUITE(EinsumTestsIntegral, MatXAllIntegralTypesCUDAExec);
 TYPED_TEST_SUITE(EinsumTestsNumericNonComplex, MatXNumericNonComplexTypesCUDAExec);
 TYPED_TEST_SUITE(EinsumTestsBoolean, MatXBoolTypesCUDAExec);
 
+template <typename TensorType>
+class EinsumTestsFloatNonHalfAllExecs : public EinsumTest<TensorType> {
+};
+TYPED_TEST_SUITE(EinsumTestsFloatNonHalfAllExecs, MatXFloatNonHalfTypesAllExecs);
+
 #if MATX_EN_CUTENSOR
 TYPED_TEST(EinsumTestsFloatNonComplexNonHalfTypes, Contraction3D)
 {
@@ -240,6 +245,53 @@ TYPED_TEST(EinsumTestsFloatNonComplexNonHalfTypes, GEMMTranspose)
   }
 }
 
+TYPED_TEST(EinsumTestsFloatNonComplexNonHalfTypes, ContractionPlanReuse)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto a = make_tensor<TestType>({8,16});
+  auto b = make_tensor<TestType>({16,12});
+  auto c = make_tensor<TestType>({12,4});
+  auto ab = make_tensor<TestType>({8,12});
+  auto abc = make_tensor<TestType>({8,4});
+  auto ref = make_tensor<TestType>({8,4});
+  (a = ones()).run(exec);
+  (b = ones()).run(exec);
+  (c = ones()).run(exec);
+
+  matx::ClearCaches();
+
+  // Repeated calls with the same shapes reuse the cached plans for both the direct
+  // two-operand path and the multi-operand network path
+  size_t hits0, misses0, evictions0, entries0, bytes0;
+  matx::GetCacheStats(&hits0, &misses0, &evictions0, &entries0, &bytes0);
+
+  for (int iter = 0; iter < 3; iter++) {
+    (ab = cutensor::einsum("ij,jk->ik", a, b)).run(exec);
+    (abc = cutensor::einsum("ij,jk,kl->il", a, b, c)).run(exec);
+  }
+  (ref = matmul(ab, c)).run(exec);
+  exec.sync();
+
+  size_t hits, misses, evictions, entries, bytes;
+  matx::GetCacheStats(&hits, &misses, &evictions, &entries, &bytes);
+  ASSERT_EQ(misses - misses0, 3); // two einsum plans and one matmul
+  ASSERT_EQ(hits - hits0, 4);
+
+  for (index_t i = 0; i < abc.Size(0); i++) {
+    ASSERT_EQ(ab(i, 0), static_cast<TestType>(16));
+    for (index_t j = 0; j < abc.Size(1); j++) {
+      MATX_ASSERT_EQ(abc(i, j), ref(i, j));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(EinsumTestsFloatNonComplexNonHalfTypes, Permute)
 {
   using TestType = cuda::std::tuple_element_t<0, TypeParam>;
@@ -331,3 +383,110 @@ TYPED_TEST(EinsumTestsFloatNonComplexNonHalfTypes, Trace)
 
 
 #endif
+
+TYPED_TEST(EinsumTestsFloatNonHalfAllExecs, MultiOperandContraction)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  if constexpr (is_cuda_executor_v<ExecType>) {
+#if !MATX_EN_CUTENSOR
+    GTEST_SKIP();
+#endif
+  }
+  else if constexpr (!MATX_EN_CPU_MATMUL) {
+    GTEST_SKIP();
+  }
+
+  ExecType exec{};
+  if constexpr (is_select_threads_host_executor_v<ExecType>) {
+    HostExecParams params{4};
+    exec = SelectThreadsHostExecutor{params};
+  }
+
+  const auto val = [](index_t i) {
+    return TestType(static_cast<float>((i * 7) % 13) / 13.0f - 0.5f);
+  };
+
+  auto a = make_tensor<TestType>({6, 7});
+  auto b = make_tensor<TestType>({7, 5});
+  auto c = make_tensor<TestType>({5, 4});
+  auto out = make_tensor<TestType>({6, 4});
+  auto x = make_tensor<TestType>({8, 6, 7});
+  auto y = make_tensor<TestType>({8, 5, 7});
+  auto xy = make_tensor<TestType>({8, 6, 5});
+  auto tr = make_tensor<TestType>({});
+
+  for (index_t i = 0; i < 7; i++) {
+    for (index_t j = 0; j < 7; j++) {
+      if (i < 6) {
+        a(i, j) = val(i * 7 + j);
+      }
+      if (j < 5) {
+        b(i, j) = val(i * 5 + j + 3);
+      }
+      if (i < 5 && j < 4) {
+        c(i, j) = val(i * 4 + j + 5);
+      }
+    }
+  }
+  for (index_t n = 0; n < 8; n++) {
+    for (index_t i = 0; i < 6; i++) {
+      for (index_t j = 0; j < 7; j++) {
+        x(n, i, j) = val(n * 42 + i * 7 + j + 1);
+        if (i < 5) {
+          y(n, i, j) = val(n * 35 + i * 7 + j + 2);
+        }
+      }
+    }
+  }
+
+  // example-begin einsum-host-1
+  // Chain of three matrices. The contraction order is chosen by the path search, and each
+  // pairwise contraction runs as a GEMM
+  (out = cutensor::einsum("ij,jk,kl->il", a, b, c)).run(exec);
+
+  // Batched contraction with the second operand transposed, one GEMM per batch n
+  (xy = cutensor::einsum("nij,nkj->nik", x, y)).run(exec);
+  // example-end einsum-host-1
+  exec.sync();
+
+  for (index_t i = 0; i < 6; i++) {
+    for (index_t l = 0; l < 4; l++) {
+      TestType ref = TestType(0);
+      for (index_t j = 0; j < 7; j++) {
+        for (index_t k = 0; k < 5; k++) {
+          ref += a(i, j) * b(j, k) * c(k, l);
+        }
+      }
+      ASSERT_NEAR(cuda::std::abs(out(i, l) - ref), 0.0, this->thresh) << i << " " << l;
+    }
+  }
+
+  for (index_t n = 0; n < 8; n++) {
+    for (index_t i = 0; i < 6; i++) {
+      for (index_t k = 0; k < 5; k++) {
+        TestType ref = TestType(0);
+        for (index_t j = 0; j < 7; j++) {
+          ref += x(n, i, j) * y(n, k, j);
+        }
+        ASSERT_NEAR(cuda::std::abs(xy(n, i, k) - ref), 0.0, this->thresh) << n << " " << i << " " << k;
+      }
+    }
+  }
+
+  if constexpr (is_host_executor_v<ExecType>) {
+    // Traces do not need a GEMM
+    (tr = cutensor::einsum("ii->", a.Slice({0, 0}, {6, 6}))).run(exec);
+    exec.sync();
+
+    TestType ref = TestType(0);
+    for (index_t i = 0; i < 6; i++) {
+      ref += a(i, i);
+    }
+    ASSERT_NEAR(cuda::std::abs(tr() - ref), 0.0, this->thresh);
+  }
+
+  MATX_EXIT_HANDLER();
+}
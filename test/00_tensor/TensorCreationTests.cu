@@ -90,6 +90,7 @@ class TensorCreationTestsAll : public ::testing::Test,
 
 
 TYPED_TEST_SUITE(TensorCreationTestsAll, MatXAllTypesAllExecs);
+TYPED_TEST_SUITE(TensorCreationTestsFloatNonComplex, MatXFloatNonComplexNonHalfTypesCUDAExec);
 
 TYPED_TEST(TensorCreationTestsAll, MakeShape)
 {
@@ -136,3 +137,150 @@ TYPED_TEST(TensorCreationTestsAll, MakeStaticShape)
   ASSERT_EQ(mt4.Size(2), 30);    
   ASSERT_EQ(mt4.Size(3), 6);    
 }
+
+TYPED_TEST(TensorCreationTestsFloatNonComplex, StaticShapeExec)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  ExecType exec{};
+
+  // example-begin make_static_tensor-test-1
+  // The shape, strides and total size of a static tensor are compile-time constants, and assignments
+  // into it launch a kernel with fully unrolled index math
+  auto a = make_static_tensor<TestType, 8, 12, 33>();
+  auto b = make_static_tensor<TestType, 8, 12, 33>();
+  static_assert(decltype(a)::desc_type::TotalSize() == 8 * 12 * 33);
+  static_assert(is_static_shape_v<decltype(a)>);
+  static_assert(is_static_shape_v<decltype(b = a * 2)>);
+
+  for (index_t i = 0; i < a.TotalSize(); i++) {
+    a(i / (12 * 33), (i / 33) % 12, i % 33) = static_cast<TestType>(i);
+  }
+
+  (b = a * static_cast<TestType>(2) + static_cast<TestType>(1)).run(exec);
+  // example-end make_static_tensor-test-1
+  exec.sync();
+
+  for (index_t i = 0; i < a.TotalSize(); i++) {
+    const auto idx = detail::GetIdxFromAbs(b, i);
+    ASSERT_EQ(idx[0], i / (12 * 33));
+    ASSERT_EQ(idx[1], (i / 33) % 12);
+    ASSERT_EQ(idx[2], i % 33);
+    ASSERT_NEAR(b(idx[0], idx[1], idx[2]), static_cast<TestType>(2 * i + 1), 1e-3);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(TensorCreationTests, MakeRegisteredTensor)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t n = 1 << 16;
+  std::vector<float> buffer(n, 1.0f);
+  cudaExecutor exec{};
+
+  {
+    // example-begin make_tensor_registered-test-1
+    // Page-lock an externally allocated host buffer for async copies and zero-copy device access
+    auto t = make_tensor_registered<float>(buffer.data(), {n});
+    (t = t * 2.0f + 1.0f).run(exec);
+    exec.sync();
+    // example-end make_tensor_registered-test-1
+
+    unsigned int flags = 0;
+    ASSERT_EQ(cudaHostGetFlags(&flags, buffer.data()), cudaSuccess);
+    ASSERT_EQ(buffer[0], 3.0f);
+    ASSERT_EQ(buffer[n - 1], 3.0f);
+
+    // Views keep the registration alive
+    auto half = slice(t, {0}, {n / 2});
+    {
+      auto again = make_tensor_registered<float>(buffer.data(), {n});
+      ASSERT_EQ(again(0), 3.0f);
+    }
+    ASSERT_EQ(cudaHostGetFlags(&flags, buffer.data()), cudaSuccess);
+    ASSERT_EQ(half(0), 3.0f);
+  }
+
+  // Unregistered with the last view
+  unsigned int flags = 0;
+  ASSERT_NE(cudaHostGetFlags(&flags, buffer.data()), cudaSuccess);
+  cudaGetLastError();
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(TensorCreationTests, IpcExportHandle)
+{
+  MATX_ENTER_HANDLER();
+
+  // Importing requires a second process (see examples/ipc_tensor.cu), so only the exported description is
+  // checked here
+  auto t = make_tensor<float>({64, 32}, MATX_DEVICE_MEMORY);
+  auto view = slice(t, {8, 4}, {40, 20});
+
+  ipcTensorExport<float, 2> ex{view};
+  const auto &h = ex.Handle();
+  ASSERT_EQ(h.offset, static_cast<size_t>((8 * 32 + 4) * sizeof(float)));
+  ASSERT_EQ(h.shape[0], 32);
+  ASSERT_EQ(h.shape[1], 16);
+  ASSERT_EQ(h.strides[0], 32);
+  ASSERT_EQ(h.strides[1], 1);
+  static_assert(std::is_trivially_copyable_v<ipcTensorHandle<float, 2>>);
+
+  cudaExecutor exec{};
+  ex.Record(exec);
+  exec.sync();
+
+  // Stream-ordered pool memory cannot be exported
+  auto pooled = make_tensor<float>({16}, MATX_ASYNC_DEVICE_MEMORY);
+  ASSERT_THROW({ ipcTensorExport<float, 1> bad{pooled}; }, matx::detail::matxException);
+  cudaGetLastError();
+
+  MATX_EXIT_HANDLER();
+}
+
+#ifdef MATX_EN_NVCOMP
+TEST(TensorCreationTests, CompressedTensorSpill)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t n = 1 << 20;
+  cudaExecutor exec{};
+  auto t = make_tensor<float>({4, n / 4}, MATX_DEVICE_MEMORY);
+  auto expected = make_tensor<float>({4, n / 4}, MATX_DEVICE_MEMORY);
+  (t = ones<float>({4, n / 4})).run(exec);
+  (expected = t).run(exec);
+
+  for (auto algo : {CompressionAlgo::LZ4, CompressionAlgo::BITCOMP, CompressionAlgo::ANS}) {
+    // example-begin compressed_tensor-test-1
+    // Compress a rarely used intermediate and move it off the device until it is needed again
+    auto c = compressed_tensor_t<float, 2>::Compress(t, exec, algo);
+    c.Spill(exec);
+
+    // Decompress before using it in an expression. Spilled data is fetched back first
+    auto restored = c.Decompress(exec);
+    // example-end compressed_tensor-test-1
+
+    ASSERT_EQ(c.Bytes(), static_cast<size_t>(n) * sizeof(float));
+    ASSERT_LT(c.CompressedBytes(), c.Bytes());
+    ASSERT_FALSE(c.IsSpilled());
+    ASSERT_EQ(restored.Size(0), 4);
+    ASSERT_EQ(restored.Size(1), n / 4);
+
+    auto mismatches = make_tensor<int>({});
+    (mismatches = sum(as_int(restored != expected))).run(exec);
+    exec.sync();
+    ASSERT_EQ(mismatches(), 0);
+  }
+
+  // Only contiguous tensors can be compressed
+  auto view = slice(t, {0, 0}, {4, 16}, {1, 2});
+  ASSERT_THROW({ auto bad = compressed_tensor_t<float, 2>::Compress(view, exec); }, matx::detail::matxException);
+
+  MATX_EXIT_HANDLER();
+}
+#endif
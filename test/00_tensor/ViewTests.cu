@@ -517,6 +517,103 @@ TYPED_TEST(ViewTestsIntegral, Randomi)
 }
 
 
+TYPED_TEST(ViewTestsFloatNonComplexNonHalf, RandomStateless)
+{
+  MATX_ENTER_HANDLER();
+  {
+    using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+    // example-begin random_stateless-test-1
+    index_t count = 50;
+
+    tensor_t<TestType, 3> t3f({count, count, count});
+
+    // No generator state is allocated; each value depends only on seed, offset and index
+    auto rnd = random_stateless<TestType>({count, count, count}, UNIFORM, 1234, 0);
+    (t3f = rnd).run(this->exec);
+    // example-end random_stateless-test-1
+    this->exec.sync();
+
+    TestType total = 0;
+    for (index_t i = 0; i < count; i++) {
+      for (index_t j = 0; j < count; j++) {
+        for (index_t k = 0; k < count; k++) {
+          TestType val = t3f(i, j, k);
+          ASSERT_EQ(val, rnd(i, j, k));
+          ASSERT_LE(val, 1.0f);
+          ASSERT_LT(0.0f, val);
+          total += val - 0.5f;
+        }
+      }
+    }
+
+    ASSERT_LT(fabs(total / (count * count * count)), .05);
+
+    // A different offset gives a different stream, and a fused expression matches the operator
+    tensor_t<TestType, 3> t3f2({count, count, count});
+    (t3f2 = random_stateless<TestType>({count, count, count}, UNIFORM, 1234, 1)).run(this->exec);
+    (t3f = 2 * random_stateless<TestType>({count, count, count}, NORMAL, 1234, 0)).run(this->exec);
+    this->exec.sync();
+
+    auto nrm = random_stateless<TestType>({count, count, count}, NORMAL, 1234, 0);
+    index_t same = 0;
+    total = 0;
+    for (index_t i = 0; i < count; i++) {
+      for (index_t j = 0; j < count; j++) {
+        for (index_t k = 0; k < count; k++) {
+          same += (t3f2(i, j, k) == rnd(i, j, k));
+          ASSERT_NEAR(t3f(i, j, k), 2 * nrm(i, j, k), 1e-4);
+          total += nrm(i, j, k);
+        }
+      }
+    }
+
+    ASSERT_LT(same, count);
+    ASSERT_LT(fabs(total / (count * count * count)), .05);
+
+    // Noise added in a vectorized expression matches the values evaluated one at a time
+    const index_t n = 4096;
+    auto x = make_tensor<TestType>({n});
+    auto y = make_tensor<TestType>({n});
+    auto noise = random_stateless<TestType>({n}, NORMAL, 99, 0);
+    (x = linspace(static_cast<TestType>(0), static_cast<TestType>(1), n)).run(this->exec);
+    (y = x + noise).run(this->exec);
+    this->exec.sync();
+
+    for (index_t i = 0; i < n; i++) {
+      ASSERT_NEAR(y(i), x(i) + noise(i), 1e-4);
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ViewTestsIntegral, RandomiStateless)
+{
+  MATX_ENTER_HANDLER();
+  {
+    using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+    index_t count = 50;
+    tensor_t<TestType, 3> t3f({count, count, count});
+
+    auto rnd = randomi_stateless<TestType>({count, count, count}, 7, 0, 10, 20);
+    (t3f = rnd).run(this->exec);
+    this->exec.sync();
+
+    for (index_t i = 0; i < count; i++) {
+      for (index_t j = 0; j < count; j++) {
+        for (index_t k = 0; k < count; k++) {
+          TestType val = t3f(i, j, k);
+          ASSERT_EQ(val, rnd(i, j, k));
+          ASSERT_LE((TestType)10, val);
+          ASSERT_LT(val, (TestType)20);
+        }
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(ViewTestsComplex, RealComplexView)
 {
   MATX_ENTER_HANDLER();
@@ -559,6 +559,72 @@ TYPED_TEST(ChannelizePolyTestNonHalfFloatTypes, Operators)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(ChannelizePolyTestNonHalfFloatTypes, Streaming)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ComplexType = typename test_types::complex_type<TestType>::type;
+
+  struct {
+    index_t num_channels;
+    index_t f_len;
+  } test_cases[] = {
+    // Fused-channel kernel with a partial last filter phase
+    { 5, 37 },
+    // Separate filter and FFT with several taps per phase
+    { 16, 161 },
+    // Single tap per phase, so there is no history to carry
+    { 8, 8 },
+  };
+
+  for (size_t i = 0; i < sizeof(test_cases)/sizeof(test_cases[0]); i++) {
+    const index_t num_channels = test_cases[i].num_channels;
+    const index_t f_len = test_cases[i].f_len;
+    const index_t block_len = 64 * num_channels;
+    const index_t num_blocks = 5;
+    const index_t a_len = block_len * num_blocks;
+    const index_t b_elem_per_channel = a_len / num_channels;
+
+    auto a = make_tensor<TestType>({a_len});
+    auto f = make_tensor<TestType>({f_len});
+    for (index_t j = 0; j < a_len; j++) {
+      a(j) = static_cast<TestType>(static_cast<double>((j * 37) % 101) / 101.0 - 0.5);
+    }
+    for (index_t j = 0; j < f_len; j++) {
+      f(j) = static_cast<TestType>(static_cast<double>(f_len - j) / static_cast<double>(f_len * num_channels));
+    }
+
+    auto ref = make_tensor<ComplexType>({b_elem_per_channel, num_channels});
+    (ref = channelize_poly(a, f, num_channels, num_channels)).run(this->exec);
+
+    // The consumer drains each slot on its own stream, and with two slots the producer has to
+    // wait on the consumer's release before reusing a buffer
+    cudaStream_t consumer;
+    cudaStreamCreate(&consumer);
+    auto b = make_tensor<ComplexType>({b_elem_per_channel, num_channels});
+    StreamingChannelizePoly<TestType> chan(f, num_channels, block_len, 2, this->exec.getStream());
+    const index_t rows = block_len / num_channels;
+    for (index_t k = 0; k < num_blocks; k++) {
+      const index_t slot = chan.Process(slice(a, {k * block_len}, {(k + 1) * block_len}));
+      chan.Acquire(slot, consumer);
+      (slice(b, {k * rows, 0}, {(k + 1) * rows, matxEnd}) = chan.Slot(slot)).run(consumer);
+      chan.Release(slot, consumer);
+    }
+    cudaStreamSynchronize(consumer);
+    cudaStreamDestroy(consumer);
+    this->exec.sync();
+
+    for (index_t t = 0; t < b_elem_per_channel; t++) {
+      for (index_t c = 0; c < num_channels; c++) {
+        ASSERT_NEAR(cuda::std::abs(ref(t, c) - b(t, c)), 0.0, this->thresh) << "elem " << t << " channel " << c;
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 // Test case inspired by the 10 channel polyphase channelizer example in
 // "Digital Receivers and Transmitters Using Polyphase Filter Banks for Wireless Communications",
 // F. J. Harris, C. Dick, M. Rice, IEEE Transactions on Microwave Theory and Techniques,
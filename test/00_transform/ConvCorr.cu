@@ -271,6 +271,251 @@ TYPED_TEST(CorrelationConvolutionLargeFFTTestFloatTypes, FFT1DConvolutionLarge)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(CorrelationConvolutionLargeFFTTestFloatTypes, FFT1DConvolutionLargeSameValid)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  this->pb->template InitTVGenerator<TestType>("00_transforms", "conv_operators", {a_len, b_len});
+  this->pb->RunTVGenerator("conv");
+  this->pb->NumpyToTensorView(this->av, "a_op");
+  this->pb->NumpyToTensorView(this->bv, "b_op");
+
+  // Long signals with short filters use overlap-save, which slices SAME and VALID out of the
+  // blocked output
+  auto cv_same = make_tensor<TestType>({a_len});
+  (cv_same = conv1d(this->av, this->bv, MATX_C_MODE_SAME, MATX_C_METHOD_FFT)).run(this->exec);
+  MATX_TEST_ASSERT_COMPARE(this->pb, cv_same, "conv_same", this->thresh);
+
+  auto cv_valid = make_tensor<TestType>({a_len - b_len + 1});
+  (cv_valid = conv1d(this->av, this->bv, MATX_C_MODE_VALID, MATX_C_METHOD_FFT)).run(this->exec);
+  MATX_TEST_ASSERT_COMPARE(this->pb, cv_valid, "conv_valid", this->thresh);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(StreamingConvTests, MatchesFullConvolution)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t chunk = 1000;
+  constexpr index_t chunks = 4;
+  constexpr index_t taps = 33;
+  cudaExecutor exec{};
+
+  auto x = make_tensor<float>({chunk * chunks});
+  auto h = make_tensor<float>({taps});
+  for (index_t i = 0; i < x.Size(0); i++) {
+    x(i) = static_cast<float>((i * 37) % 101) / 101.0f - 0.5f;
+  }
+  for (index_t i = 0; i < taps; i++) {
+    h(i) = static_cast<float>(taps - i) / static_cast<float>(taps);
+  }
+
+  auto ref = make_tensor<float>({chunk * chunks + taps - 1});
+  (ref = conv1d(x, h, MATX_C_MODE_FULL)).run(exec);
+
+  // Chunked output must match the head of one FULL convolution over the whole signal
+  auto y = make_tensor<float>({chunk * chunks});
+  StreamingConv1D<float> sconv(h, chunk, exec);
+  for (index_t c = 0; c < chunks; c++) {
+    auto yc = slice(y, {c * chunk}, {(c + 1) * chunk});
+    sconv.Process(yc, slice(x, {c * chunk}, {(c + 1) * chunk}));
+  }
+  exec.sync();
+
+  for (index_t i = 0; i < y.Size(0); i++) {
+    ASSERT_NEAR(y(i), ref(i), 1e-3f) << "index " << i;
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(ConvFilterSpectrumTests, MatchesConvAndCorr)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 3;
+  constexpr index_t len = 500;
+  constexpr index_t taps = 24;
+  cudaExecutor exec{};
+
+  auto x = make_tensor<cuda::std::complex<float>>({batches, len});
+  auto h = make_tensor<cuda::std::complex<float>>({taps});
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < len; i++) {
+      x(b, i) = {static_cast<float>((i * 37 + b * 11) % 101) / 101.0f - 0.5f,
+                 static_cast<float>((i * 13 + b) % 29) / 29.0f - 0.5f};
+    }
+  }
+  for (index_t i = 0; i < taps; i++) {
+    h(i) = {static_cast<float>(taps - i) / static_cast<float>(taps), static_cast<float>(i % 3) - 1.0f};
+  }
+
+  // example-begin conv-filter-spectrum-test-1
+  // The filter is transformed once and reused for every call
+  ConvFilterSpectrum<cuda::std::complex<float>> conv_spec(h, len, false, exec);
+  ConvFilterSpectrum<cuda::std::complex<float>> corr_spec(h, len, true, exec);
+
+  auto y = make_tensor<cuda::std::complex<float>>({batches, len + taps - 1});
+  conv_spec.Apply(y, x, MATX_C_MODE_FULL);
+  // example-end conv-filter-spectrum-test-1
+
+  auto ref = make_tensor<cuda::std::complex<float>>({batches, len + taps - 1});
+  (ref = conv1d(x, h, MATX_C_MODE_FULL, MATX_C_METHOD_FFT)).run(exec);
+  exec.sync();
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < ref.Size(1); i++) {
+      ASSERT_NEAR(y(b, i).real(), ref(b, i).real(), 1e-3f) << "conv full " << b << " " << i;
+      ASSERT_NEAR(y(b, i).imag(), ref(b, i).imag(), 1e-3f) << "conv full " << b << " " << i;
+    }
+  }
+
+  auto ys = make_tensor<cuda::std::complex<float>>({batches, len});
+  auto refs = make_tensor<cuda::std::complex<float>>({batches, len});
+  corr_spec.Apply(ys, x, MATX_C_MODE_SAME);
+  (refs = corr(x, h, MATX_C_MODE_SAME, MATX_C_METHOD_FFT)).run(exec);
+  exec.sync();
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < len; i++) {
+      ASSERT_NEAR(ys(b, i).real(), refs(b, i).real(), 1e-3f) << "corr same " << b << " " << i;
+      ASSERT_NEAR(ys(b, i).imag(), refs(b, i).imag(), 1e-3f) << "corr same " << b << " " << i;
+    }
+  }
+
+  auto yv = make_tensor<cuda::std::complex<float>>({batches, len - taps + 1});
+  auto refv = make_tensor<cuda::std::complex<float>>({batches, len - taps + 1});
+  corr_spec.Apply(yv, x, MATX_C_MODE_VALID);
+  (refv = corr(x, h, MATX_C_MODE_VALID, MATX_C_METHOD_FFT)).run(exec);
+  exec.sync();
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < yv.Size(1); i++) {
+      ASSERT_NEAR(yv(b, i).real(), refv(b, i).real(), 1e-3f) << "corr valid " << b << " " << i;
+      ASSERT_NEAR(yv(b, i).imag(), refv(b, i).imag(), 1e-3f) << "corr valid " << b << " " << i;
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(GemmConvTests, MatchesFFTConvolution)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 16;
+  constexpr index_t len = 2000;
+  constexpr index_t taps = 101;
+  cudaExecutor exec{};
+
+  auto x = make_tensor<float>({batches, len});
+  auto h = make_tensor<float>({taps});
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t i = 0; i < len; i++) {
+      x(b, i) = static_cast<float>((i * 37 + b * 11) % 101) / 101.0f - 0.5f;
+    }
+  }
+  for (index_t i = 0; i < taps; i++) {
+    h(i) = static_cast<float>(taps - i) / static_cast<float>(taps);
+  }
+
+  const matxConvCorrMode_t modes[] = {MATX_C_MODE_FULL, MATX_C_MODE_SAME, MATX_C_MODE_VALID};
+  const index_t out_lens[] = {len + taps - 1, len, len - taps + 1};
+  for (int m = 0; m < 3; m++) {
+    auto ref = make_tensor<float>({batches, out_lens[m]});
+    auto tc = make_tensor<float>({batches, out_lens[m]});
+    auto autom = make_tensor<float>({batches, out_lens[m]});
+    (ref = conv1d(x, h, modes[m], MATX_C_METHOD_FFT)).run(exec);
+    (tc = conv1d(x, h, modes[m], MATX_C_METHOD_TC)).run(exec);
+    (autom = conv1d(h, x, modes[m], MATX_C_METHOD_AUTO)).run(exec);
+    exec.sync();
+
+    for (index_t b = 0; b < batches; b++) {
+      for (index_t i = 0; i < out_lens[m]; i++) {
+        ASSERT_NEAR(tc(b, i), ref(b, i), 1e-2f) << "mode " << m << " batch " << b << " index " << i;
+        ASSERT_NEAR(autom(b, i), ref(b, i), 1e-2f) << "mode " << m << " batch " << b << " index " << i;
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+
+TEST(GemmConvTests, AutotunedMethodMatchesFFT)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 32;
+  constexpr index_t len = 4096;
+  constexpr index_t taps = 200;
+  cudaExecutor exec{};
+
+  auto x = make_tensor<float>({batches, len});
+  auto h = make_tensor<float>({taps});
+  (x = random<float>({batches, len}, NORMAL)).run(exec);
+  (h = random<float>({taps}, NORMAL)).run(exec);
+
+  auto ref = make_tensor<float>({batches, len});
+  auto y = make_tensor<float>({batches, len});
+  (ref = conv1d(x, h, MATX_C_MODE_SAME, MATX_C_METHOD_FFT)).run(exec);
+
+  // The first call times every method, the second uses the cached winner
+  SetKernelAutotune(true);
+  for (int iter = 0; iter < 2; iter++) {
+    (y = zeros<float>({batches, len})).run(exec);
+    (y = conv1d(x, h, MATX_C_MODE_SAME, MATX_C_METHOD_AUTO)).run(exec);
+    exec.sync();
+    for (index_t b = 0; b < batches; b++) {
+      for (index_t i = 0; i < len; i++) {
+        ASSERT_NEAR(y(b, i), ref(b, i), 5e-2f) << "iteration " << iter << " batch " << b << " index " << i;
+      }
+    }
+  }
+  SetKernelAutotune(false);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(BatchedFilterConvTests, MatchesReference)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t batches = 8;
+  constexpr index_t taps = 64;
+  cudaExecutor exec{};
+
+  // The long signal takes the batched overlap-save path, the short one a full-length FFT
+  for (const index_t len : {index_t{4096}, index_t{500}}) {
+    auto x = make_tensor<float>({batches, len});
+    auto h = make_tensor<float>({batches, taps});
+    auto full_d = make_tensor<float>({batches, len + taps - 1});
+    auto full_f = make_tensor<float>({batches, len + taps - 1});
+    auto same_f = make_tensor<float>({batches, len});
+    (x = random<float>({batches, len}, NORMAL)).run(exec);
+    (h = random<float>({batches, taps}, NORMAL)).run(exec);
+
+    // example-begin conv1d-test-4
+    // Each row of x is filtered by the matching row of h
+    (full_d = conv1d(x, h, MATX_C_MODE_FULL, MATX_C_METHOD_DIRECT)).run(exec);
+    (full_f = conv1d(x, h, MATX_C_MODE_FULL, MATX_C_METHOD_FFT)).run(exec);
+    // example-end conv1d-test-4
+    (same_f = conv1d(x, h, MATX_C_MODE_SAME, MATX_C_METHOD_FFT)).run(exec);
+    exec.sync();
+
+    const index_t same_off = (taps - 1) / 2;
+    for (index_t b = 0; b < batches; b++) {
+      for (index_t i = 0; i < len + taps - 1; i++) {
+        double ref = 0.0;
+        for (index_t k = 0; k < taps; k++) {
+          if (i - k >= 0 && i - k < len) {
+            ref += static_cast<double>(x(b, i - k)) * static_cast<double>(h(b, k));
+          }
+        }
+        ASSERT_NEAR(full_d(b, i), ref, 1e-3) << "direct len " << len << " batch " << b << " index " << i;
+        ASSERT_NEAR(full_f(b, i), ref, 1e-3) << "fft len " << len << " batch " << b << " index " << i;
+        if (i >= same_off && i - same_off < len) {
+          ASSERT_NEAR(same_f(b, i - same_off), ref, 1e-3) << "same len " << len << " batch " << b << " index " << i;
+        }
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
 
 // Real/real direct 1D convolution
 TYPED_TEST(CorrelationConvolutionDirectTestFloatTypes, Direct1DConvolutionFullEven)
@@ -363,6 +608,58 @@ TYPED_TEST(CorrelationConvolution2DTestFloatTypes, Direct2DConvolutionSameEven)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(CorrelationConvolution2DTestFloatTypes, Separable2DConvolution)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  const index_t rows = 64;
+  const index_t cols = 80;
+  const index_t kcol = 5;
+  const index_t krow = 4;
+
+  auto a = make_tensor<TestType>({rows, cols});
+  auto hc = make_tensor<TestType>({kcol});
+  auto hr = make_tensor<TestType>({krow});
+  auto h2 = make_tensor<TestType>({kcol, krow});
+  for (index_t i = 0; i < rows; i++) {
+    for (index_t j = 0; j < cols; j++) {
+      a(i, j) = static_cast<TestType>(static_cast<double>((i * 31 + j * 17) % 23) / 23.0 - 0.5);
+    }
+  }
+  for (index_t i = 0; i < kcol; i++) {
+    hc(i) = static_cast<TestType>(static_cast<double>(i + 1) / kcol);
+  }
+  for (index_t j = 0; j < krow; j++) {
+    hr(j) = static_cast<TestType>(static_cast<double>(krow - j) / krow);
+  }
+  for (index_t i = 0; i < kcol; i++) {
+    for (index_t j = 0; j < krow; j++) {
+      h2(i, j) = hc(i) * hr(j);
+    }
+  }
+
+  // The separable path must match conv2d with the outer-product filter in every mode, including
+  // the centering of SAME with an even-length row filter
+  for (const auto mode : {MATX_C_MODE_FULL, MATX_C_MODE_SAME, MATX_C_MODE_VALID}) {
+    auto ref_op = conv2d(a, h2, mode);
+    auto ref = make_tensor<TestType>({ref_op.Size(0), ref_op.Size(1)});
+    auto out = make_tensor<TestType>({ref_op.Size(0), ref_op.Size(1)});
+    (ref = ref_op).run(this->exec);
+    // example-begin conv2d_separable-test-1
+    (out = conv2d_separable(a, hc, hr, mode)).run(this->exec);
+    // example-end conv2d_separable-test-1
+    this->exec.sync();
+
+    for (index_t i = 0; i < ref.Size(0); i++) {
+      for (index_t j = 0; j < ref.Size(1); j++) {
+        ASSERT_NEAR(cuda::std::abs(ref(i, j) - out(i, j)), 0.0, this->thresh) << "mode " << mode << " at " << i << "," << j;
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(CorrelationConvolutionDirectTestFloatTypes, Direct1DConvolutionValidEven)
 {
   MATX_ENTER_HANDLER();
@@ -133,6 +133,88 @@ TYPED_TEST(CopyTestsAll, CopyOutParam)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(CopyTestsAll, CopyPermuted)
+{
+  MATX_ENTER_HANDLER();
+
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  TestType DEFAULT, TEST_VAL;
+  if constexpr (std::is_same_v<TestType, bool>) {
+    DEFAULT = true;
+    TEST_VAL = false;
+  } else {
+    DEFAULT = {2};
+    TEST_VAL = {7};
+  }
+
+  // Every 7th element in memory order is TEST_VAL, so any mix-up of dimensions shows up
+  {
+    auto in = make_tensor<TestType>({9, 40, 33});
+    auto out = make_tensor<TestType>({33, 9, 40});
+    for (index_t i = 0; i < in.Size(0); i++) {
+      for (index_t j = 0; j < in.Size(1); j++) {
+        for (index_t k = 0; k < in.Size(2); k++) {
+          in(i, j, k) = ((i * in.Size(1) + j) * in.Size(2) + k) % 7 == 0 ? TEST_VAL : DEFAULT;
+        }
+      }
+    }
+
+    (out = permute(in, {2, 0, 1})).run(exec);
+    exec.sync();
+
+    for (index_t i = 0; i < in.Size(0); i++) {
+      for (index_t j = 0; j < in.Size(1); j++) {
+        for (index_t k = 0; k < in.Size(2); k++) {
+          ASSERT_EQ(out(k, i, j), in(i, j, k));
+        }
+      }
+    }
+  }
+
+  {
+    auto in = make_tensor<TestType>({3, 20, 12, 36});
+    auto out = make_tensor<TestType>({3, 20, 12, 36});
+    auto outp = out.Permute({1, 3, 0, 2});
+    auto inp = in.Permute({1, 3, 0, 2});
+    for (index_t i = 0; i < in.Size(0); i++) {
+      for (index_t j = 0; j < in.Size(1); j++) {
+        for (index_t k = 0; k < in.Size(2); k++) {
+          for (index_t l = 0; l < in.Size(3); l++) {
+            in(i, j, k, l) = (((i * in.Size(1) + j) * in.Size(2) + k) * in.Size(3) + l) % 7 == 0 ? TEST_VAL : DEFAULT;
+          }
+        }
+      }
+    }
+
+    // Permuted destination with a contiguous source, then the reverse
+    auto tmp = make_tensor<TestType>({20, 36, 3, 12});
+    (tmp = inp).run(exec);
+    (outp = tmp).run(exec);
+    exec.sync();
+
+    for (index_t i = 0; i < in.Size(0); i++) {
+      for (index_t j = 0; j < in.Size(1); j++) {
+        for (index_t k = 0; k < in.Size(2); k++) {
+          for (index_t l = 0; l < in.Size(3); l++) {
+            ASSERT_EQ(tmp(j, l, i, k), in(i, j, k, l));
+            ASSERT_EQ(out(i, j, k, l), in(i, j, k, l));
+          }
+        }
+      }
+    }
+  }
+
+  if constexpr (std::is_same_v<ExecType,cudaExecutor>) {
+    ASSERT_EQ(cudaGetLastError(), cudaSuccess);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(CopyTestsAll, CopyReturn)
 {
   MATX_ENTER_HANDLER();
@@ -120,3 +120,33 @@ TYPED_TEST(CovarianceTestFloatTypes, BatchedCov)
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(CovarianceTestFloatTypes, UpperCov)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  this->pb->RunTVGenerator("cov");
+  this->pb->NumpyToTensorView(this->av, "a");
+
+  auto full = make_tensor<TestType>({this->cov_dim2, this->cov_dim2});
+  // example-begin cov-test-2
+  // Only the upper triangle and diagonal are written. The lower triangle is zero.
+  (this->cv = cov(this->av, CovFill::UPPER)).run(this->exec);
+  // example-end cov-test-2
+  (full = cov(this->av)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t i = 0; i < this->cov_dim2; i++) {
+    for (index_t j = 0; j < this->cov_dim2; j++) {
+      const auto expected = j >= i ? full(i, j) : TestType(0);
+      if constexpr (is_complex_v<TestType>) {
+        ASSERT_NEAR(static_cast<double>(this->cv(i, j).real()), static_cast<double>(expected.real()), this->thresh);
+        ASSERT_NEAR(static_cast<double>(this->cv(i, j).imag()), static_cast<double>(expected.imag()), this->thresh);
+      }
+      else {
+        ASSERT_NEAR(static_cast<double>(this->cv(i, j)), static_cast<double>(expected), this->thresh);
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
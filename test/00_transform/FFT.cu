@@ -659,6 +659,121 @@ TYPED_TEST(FFTTestComplexTypes, FFT1D1024PadR2C)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1DOverlappedView)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  if constexpr (!detail::CheckFFTSupport<ExecType, TestType>()) {
+    GTEST_SKIP();
+  } else {
+    const index_t n = 1024;
+    const index_t win = 64;
+    const index_t hop = 16;
+    const index_t frames = (n - win) / hop + 1;
+
+    // Every other element of a longer signal, so the overlapped view has both an element
+    // stride and a frame stride that cuFFT reads directly
+    auto sig = make_tensor<TestType>({2 * n});
+    (sig = random<TestType>(sig.Shape(), NORMAL)).run(this->exec);
+    auto x = slice(sig, {0}, {matxEnd}, {2});
+
+    auto frames_view = overlap(x, {win}, {hop});
+    auto frames_dense = make_tensor<TestType>({frames, win});
+    auto out_view = make_tensor<TestType>({frames, win});
+    auto out_dense = make_tensor<TestType>({frames, win});
+
+    (frames_dense = frames_view).run(this->exec);
+    (out_view = fft(frames_view)).run(this->exec);
+    (out_dense = fft(frames_dense)).run(this->exec);
+    this->exec.sync();
+
+    for (index_t f = 0; f < frames; f++) {
+      for (index_t k = 0; k < win; k++) {
+        ASSERT_NEAR(out_view(f, k).real(), out_dense(f, k).real(), this->thresh);
+        ASSERT_NEAR(out_view(f, k).imag(), out_dense(f, k).imag(), this->thresh);
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1DAliasedInput)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  if constexpr (!detail::CheckFFTSupport<ExecType, TestType>()) {
+    GTEST_SKIP();
+  } else {
+    const index_t n = 1024;
+
+    auto buf = make_tensor<TestType>({2 * n});
+    auto ref_in = make_tensor<TestType>({n});
+    auto ref_out = make_tensor<TestType>({n});
+    (buf = random<TestType>(buf.Shape(), NORMAL)).run(this->exec);
+    auto lo = slice(buf, {0}, {n});
+    auto hi = slice(buf, {n / 2}, {n / 2 + n});
+
+    // The same view is transformed in place
+    (ref_in = lo).run(this->exec);
+    (ref_out = fft(ref_in)).run(this->exec);
+    (lo = fft(lo)).run(this->exec);
+    this->exec.sync();
+
+    for (index_t k = 0; k < n; k++) {
+      ASSERT_NEAR(lo(k).real(), ref_out(k).real(), this->thresh);
+      ASSERT_NEAR(lo(k).imag(), ref_out(k).imag(), this->thresh);
+    }
+
+    // An output that only partly overlaps the input must see the input as it was before the call
+    (ref_in = lo).run(this->exec);
+    (ref_out = fft(ref_in)).run(this->exec);
+    (hi = fft(lo)).run(this->exec);
+    this->exec.sync();
+
+    for (index_t k = 0; k < n; k++) {
+      ASSERT_NEAR(hi(k).real(), ref_out(k).real(), this->thresh);
+      ASSERT_NEAR(hi(k).imag(), ref_out(k).imag(), this->thresh);
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1DHostMeasuredPlanner)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  if constexpr (is_cuda_executor_v<ExecType> || !detail::CheckFFTSupport<ExecType, TestType>()) {
+    GTEST_SKIP();
+  } else {
+    const index_t n = 512;
+    auto in = make_tensor<TestType>({8, n});
+    auto saved = make_tensor<TestType>({8, n});
+    auto ref = make_tensor<TestType>({8, n});
+    auto out = make_tensor<TestType>({8, n});
+    (in = random<TestType>(in.Shape(), NORMAL)).run(this->exec);
+    (saved = in).run(this->exec);
+    (ref = fft(in)).run(this->exec);
+
+    // Measuring must not overwrite the input while planning
+    SetHostFFTPlanner(HostFFTPlanner::MEASURE);
+    (out = fft(in)).run(this->exec);
+    this->exec.sync();
+    SetHostFFTPlanner(HostFFTPlanner::ESTIMATE);
+
+    for (index_t b = 0; b < in.Size(0); b++) {
+      for (index_t k = 0; k < n; k++) {
+        ASSERT_EQ(in(b, k), saved(b, k));
+        ASSERT_NEAR(out(b, k).real(), ref(b, k).real(), this->thresh);
+        ASSERT_NEAR(out(b, k).imag(), ref(b, k).imag(), this->thresh);
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1DSizeChecks)
 {
   MATX_ENTER_HANDLER();
@@ -769,6 +884,53 @@ TYPED_TEST(FFTTestComplexTypes, FFT2D16C2C)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(FFTTestComplexNonHalfTypes, FFT2DMultiGPUC2C)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  int num_devices = 0;
+  cudaGetDeviceCount(&num_devices);
+  if constexpr (!is_cuda_executor_v<ExecType>) {
+    GTEST_SKIP();
+  } else {
+    if (num_devices < 2) {
+      GTEST_SKIP();
+    }
+
+    const index_t fft_dim = 64;
+    this->pb->template InitAndRunTVGenerator<TestType>(
+        "00_transforms", "fft_operators", "fft_2d", {fft_dim, fft_dim});
+
+    auto av = make_tensor<TestType>({fft_dim, fft_dim}, MATX_HOST_MALLOC_MEMORY);
+    auto avo = make_tensor<TestType>({fft_dim, fft_dim}, MATX_HOST_MALLOC_MEMORY);
+    this->pb->NumpyToTensorView(av, "a_in");
+
+    // example-begin fft2_mgpu-1
+    // Split a 2D FFT of a host tensor across the first two GPUs
+    fft2_mgpu(avo, av, {0, 1});
+    // example-end fft2_mgpu-1
+
+    MATX_TEST_ASSERT_COMPARE(this->pb, avo, "a_out", this->thresh);
+
+    // Round trip through a plan that keeps the data on the devices
+    matxMultiGPUFFTPlan_t<TestType, 2> plan({fft_dim, fft_dim}, {0, 1});
+    plan.Load(av);
+    plan.Forward();
+    ASSERT_TRUE(plan.IsShuffled());
+    plan.Inverse();
+    plan.Store(avo);
+
+    for (index_t i = 0; i < fft_dim; i++) {
+      for (index_t j = 0; j < fft_dim; j++) {
+        ASSERT_NEAR(avo(i, j).real(), av(i, j).real(), this->thresh);
+        ASSERT_NEAR(avo(i, j).imag(), av(i, j).imag(), this->thresh);
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(FFTTestComplexTypes, FFT2D16x32C2C)
 {
   MATX_ENTER_HANDLER();
@@ -1024,4 +1186,66 @@ TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, IFFT1D1024C2CShort)
 
   MATX_TEST_ASSERT_COMPARE(this->pb, avo, "a_out", this->thresh);
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1D1024OperatorInputC2C)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  const index_t fft_dim = 1024;
+  this->pb->template InitAndRunTVGenerator<TestType>(
+      "00_transforms", "fft_operators", "fft_1d", {fft_dim, fft_dim});
+  tensor_t<TestType, 1> av{{fft_dim}};
+  tensor_t<TestType, 1> avo{{fft_dim}};
+  this->pb->NumpyToTensorView(av, "a_in");
+
+  // An operator input is fused into the FFT's loads when cuFFT LTO callbacks are available, and
+  // materialized otherwise. Both must match the plain FFT.
+  (avo = fft(conj(conj(av)))).run(this->exec);
+  this->exec.sync();
+
+  MATX_TEST_ASSERT_COMPARE(this->pb, avo, "a_out", this->thresh);
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1DPlanarInt16Input)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using inner_type = typename inner_op_type_t<TestType>::type;
+
+  const index_t batches = 4;
+  const index_t fft_dim = 256;
+  const inner_type scale = inner_type(1) / inner_type(32768);
+
+  auto iq = make_tensor<int16_t>({2 * batches, fft_dim});
+  auto ref_in = make_tensor<TestType>({batches, fft_dim});
+  auto ref_out = make_tensor<TestType>({batches, fft_dim});
+  auto out = make_tensor<TestType>({batches, fft_dim});
+
+  // The first half of the rows holds I and the second half Q, as planar ADC samples do
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t n = 0; n < fft_dim; n++) {
+      const auto i_val = static_cast<int16_t>(((b * 131 + n * 977) % 65535) - 32767);
+      const auto q_val = static_cast<int16_t>(((b * 389 + n * 613) % 65535) - 32767);
+      iq(b, n) = i_val;
+      iq(b + batches, n) = q_val;
+      ref_in(b, n) = TestType(static_cast<inner_type>(i_val) * scale, static_cast<inner_type>(q_val) * scale);
+    }
+  }
+
+  (ref_out = fft(ref_in)).run(this->exec);
+  // example-begin interleaved-test-1
+  // Raw int16 I/Q is converted, scaled and interleaved in the FFT's input stage
+  (out = fft(interleaved<TestType>(iq, scale))).run(this->exec);
+  // example-end interleaved-test-1
+  this->exec.sync();
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t n = 0; n < fft_dim; n++) {
+      ASSERT_NEAR(out(b, n).real(), ref_out(b, n).real(), 1e-3) << b << " " << n;
+      ASSERT_NEAR(out(b, n).imag(), ref_out(b, n).imag(), 1e-3) << b << " " << n;
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+// Host reference for y[n] = sum_k b[k] x[n-k] + sum_k a[k] y[n-k-1]
+template <size_t NR, size_t NNR>
+static std::vector<double> RecursiveFilterRef(const std::vector<float> &x,
+                                              const cuda::std::array<float, NR> &rec,
+                                              const cuda::std::array<float, NNR> &nonrec)
+{
+  std::vector<double> y(x.size(), 0.0);
+  for (size_t n = 0; n < x.size(); n++) {
+    for (size_t k = 0; k < NNR; k++) {
+      if (n >= k) {
+        y[n] += static_cast<double>(nonrec[k]) * static_cast<double>(x[n - k]);
+      }
+    }
+    for (size_t k = 0; k < NR; k++) {
+      if (n >= k + 1) {
+        y[n] += static_cast<double>(rec[k]) * y[n - k - 1];
+      }
+    }
+  }
+
+  return y;
+}
+
+TEST(RecursiveFilterTests, MultiChunkBatched)
+{
+  MATX_ENTER_HANDLER();
+  cudaDeviceProp prop;
+  cudaGetDeviceProperties(&prop, 0);
+  if (prop.sharedMemPerBlock < 40000) {
+    GTEST_SKIP();
+  }
+
+  // Several chunks per signal with a partial chunk at the end, so every block
+  // but the first depends on the look-back across blocks
+  constexpr index_t batches = 3;
+  constexpr index_t len = 5 * detail_filter::RECURSIVE_CHUNK_SIZE + 777;
+  const auto rec = cuda::std::array<float, 2>{0.4f, -0.1f};
+  const auto nonrec = cuda::std::array<float, 2>{2.0f, 1.0f};
+  cudaExecutor exec{};
+
+  auto in = make_tensor<float>({batches, len});
+  auto out = make_tensor<float>({batches, len});
+
+  // Run twice through the same cached plan with different inputs. The second
+  // run must not see the look-back state of the first.
+  for (int run = 0; run < 2; run++) {
+    std::vector<std::vector<float>> x(batches, std::vector<float>(len));
+    for (index_t b = 0; b < batches; b++) {
+      for (index_t i = 0; i < len; i++) {
+        x[b][i] = static_cast<float>(((i + b * 13) * (run + 7)) % 61) / 30.0f - 1.0f;
+        in(b, i) = x[b][i];
+      }
+    }
+
+    (out = filter(in, rec, nonrec)).run(exec);
+    exec.sync();
+
+    for (index_t b = 0; b < batches; b++) {
+      const auto ref = RecursiveFilterRef(x[b], rec, nonrec);
+      for (index_t i = 0; i < len; i++) {
+        ASSERT_NEAR(out(b, i), ref[i], 1e-3) << "run " << run << " batch " << b << " index " << i;
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
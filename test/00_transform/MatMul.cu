@@ -959,6 +959,43 @@ TYPED_TEST(MatMulTestFloatTypes, MediumMatVecBatch)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(MatMulTestFloatTypes, SmallMatVecBatch)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  if constexpr (!detail::CheckMatMulSupport<ExecType, TestType>()) {
+    GTEST_SKIP();
+  } else {
+    // Tiny matrices take the batched small-matrix kernel. 8x8 uses the static-size
+    // kernel and 5x7 the runtime-size one.
+    auto run_case = [&](index_t m, index_t k) {
+      constexpr index_t n = 1;
+      constexpr index_t blocks = 300;
+
+      tensor_t<TestType, 3> a{{blocks, m, k}};
+      tensor_t<TestType, 3> b{{blocks, k, n}};
+      tensor_t<TestType, 3> c{{blocks, m, n}};
+      this->pb->template InitAndRunTVGenerator<TestType>(
+          "00_transforms", "matmul_operators", "run", {blocks, m, k, n});
+
+      this->pb->NumpyToTensorView(a, "a");
+      this->pb->NumpyToTensorView(b, "b");
+
+      auto cs = slice<2>(c, {0,0,0}, {matxEnd, matxEnd, matxDropDim});
+      auto bs = slice<2>(b, {0,0,0}, {matxEnd, matxEnd, matxDropDim});
+      (cs = matvec(a, bs)).run(this->exec);
+      this->exec.sync();
+
+      MATX_TEST_ASSERT_COMPARE(this->pb, c, "c", this->thresh);
+    };
+
+    run_case(8, 8);
+    run_case(5, 7);
+  }
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(MatMulTestFloatTypes, MatVecRowVector)
 {
   MATX_ENTER_HANDLER();
@@ -1043,3 +1080,365 @@ TYPED_TEST(MatMulTestFloatTypes, OuterProduct)
   }
   MATX_EXIT_HANDLER();
 }
+
+TEST(MatMulKronTests, FactoredMatchesMaterialized)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t m = 6;
+  constexpr index_t n = 5;
+  constexpr index_t p = 4;
+  constexpr index_t q = 3;
+  cudaExecutor exec{};
+
+  auto a = make_tensor<float>({m, n});
+  auto b = make_tensor<float>({p, q});
+  auto kab = make_tensor<float>({m * p, n * q});
+  (a = random<float>({m, n}, NORMAL)).run(exec);
+  (b = random<float>({p, q}, NORMAL)).run(exec);
+  (kab = kron(a, b)).run(exec);
+
+  // A single column takes the U * B^T path and several columns take the batched path
+  for (const index_t cols : {index_t{1}, index_t{7}}) {
+    auto x = make_tensor<float>({n * q, cols});
+    auto y = make_tensor<float>({m * p, cols});
+    auto ref = make_tensor<float>({m * p, cols});
+    (x = random<float>({n * q, cols}, NORMAL)).run(exec);
+
+    // example-begin kron-matmul-test-1
+    // The Kronecker product is never formed
+    (y = matmul(kron(a, b), x)).run(exec);
+    // example-end kron-matmul-test-1
+    (ref = matmul(kab, x)).run(exec);
+    exec.sync();
+
+    for (index_t i = 0; i < m * p; i++) {
+      for (index_t j = 0; j < cols; j++) {
+        ASSERT_NEAR(y(i, j), ref(i, j), 1e-3f);
+      }
+    }
+
+    // Accumulate into the output through a strided view of x, which is staged before the GEMMs
+    auto xs = make_tensor<float>({n * q, 2 * cols});
+    (slice(xs, {0, 0}, {matxEnd, matxEnd}, {1, 2}) = x).run(exec);
+    (y = matmul(kron(a, b), slice(xs, {0, 0}, {matxEnd, matxEnd}, {1, 2}), 2.0f, 1.0f)).run(exec);
+    exec.sync();
+
+    for (index_t i = 0; i < m * p; i++) {
+      for (index_t j = 0; j < cols; j++) {
+        ASSERT_NEAR(y(i, j), 3.0f * ref(i, j), 3e-3f);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(MatMulAutotuneTests, AccumulateIntoC)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t m = 48;
+  constexpr index_t k = 96;
+  constexpr index_t n = 24;
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  auto a = make_tensor<float>({m, k});
+  auto b = make_tensor<float>({k, n});
+  auto c = make_tensor<float>({m, n});
+  (a = ones<float>({m, k})).run(exec);
+  (b = ones<float>({k, n})).run(exec);
+  (c = ones<float>({m, n})).run(exec);
+
+  // Benchmarking candidates must not disturb C, which is accumulated into with beta = 1
+  SetMatMulAutotune(true);
+  (c = matmul(a, b, 1.0f, 1.0f)).run(exec);
+  // The second call reuses the tuned handle
+  (c = matmul(a, b, 1.0f, 1.0f)).run(exec);
+  SetMatMulAutotune(false);
+  exec.sync();
+
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_NEAR(c(i, j), static_cast<float>(2 * k + 1), 0.01f);
+    }
+  }
+
+  cudaStreamDestroy(stream);
+  MATX_EXIT_HANDLER();
+}
+
+TEST(MatMulEpilogueTests, ReluBias)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t m = 32;
+  constexpr index_t k = 16;
+  constexpr index_t n = 24;
+  cudaExecutor exec{};
+
+  auto a = make_tensor<float>({m, k});
+  auto b = make_tensor<float>({k, n});
+  auto bias = make_tensor<float>({m});
+  auto c = make_tensor<float>({m, n});
+  (a = ones<float>({m, k})).run(exec);
+  (b = ones<float>({k, n})).run(exec);
+  exec.sync();
+
+  // Half the rows are pushed below zero by the bias and clamped by the ReLU
+  for (index_t i = 0; i < m; i++) {
+    bias(i) = (i % 2 == 0) ? static_cast<float>(i) : -static_cast<float>(2 * k);
+  }
+
+  // example-begin matmul-epilogue-test-1
+  (c = matmul(a, b, MatMulEpilogue_t::RELU_BIAS, bias)).run(exec);
+  // example-end matmul-epilogue-test-1
+  exec.sync();
+
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      const float expected = (i % 2 == 0) ? static_cast<float>(k + i) : 0.0f;
+      ASSERT_NEAR(c(i, j), expected, 0.01f);
+    }
+  }
+
+  // A bias operator that isn't a contiguous tensor uses the unfused path
+  (c = matmul(a, b, MatMulEpilogue_t::BIAS, bias * 2.0f)).run(exec);
+  exec.sync();
+
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_NEAR(c(i, j), static_cast<float>(k) + 2.0f * bias(i), 0.01f);
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TEST(MatMulScaledTests, Int8PerChannel)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t m = 16;
+  constexpr index_t k = 32;
+  constexpr index_t n = 24;
+  cudaExecutor exec{};
+
+  auto a = make_tensor<int8_t>({m, k});
+  auto b = make_tensor<int8_t>({k, n});
+  auto bt = make_tensor<int8_t>({n, k});
+  auto scale_a = make_tensor<float>({m});
+  auto scale_b = make_tensor<float>({n});
+  auto c = make_tensor<float>({m, n});
+  (a = ones<int8_t>({m, k})).run(exec);
+  (b = ones<int8_t>({k, n}) * static_cast<int8_t>(2)).run(exec);
+  (bt = ones<int8_t>({n, k}) * static_cast<int8_t>(2)).run(exec);
+  exec.sync();
+
+  for (index_t i = 0; i < m; i++) {
+    scale_a(i) = 0.5f * static_cast<float>(i + 1);
+  }
+  for (index_t j = 0; j < n; j++) {
+    scale_b(j) = 0.25f;
+  }
+
+  // example-begin matmul-scaled-test-1
+  // Weights stored as n x k are read in place through a transposed view
+  (c = matmul_scaled(a, bt.Permute({1, 0}), scale_a, scale_b)).run(exec);
+  // example-end matmul-scaled-test-1
+  exec.sync();
+
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_NEAR(c(i, j), 2.0f * k * scale_a(i) * scale_b(j), 1e-3f);
+    }
+  }
+
+  // A row-major B is transposed into a temporary first
+  (c = matmul_scaled(a, b, scale_a, scale_b)).run(exec);
+  exec.sync();
+
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_NEAR(c(i, j), 2.0f * k * scale_a(i) * scale_b(j), 1e-3f);
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TEST(MatMulScaledTests, Fp8PerTensorAmax)
+{
+  MATX_ENTER_HANDLER();
+  if (detail::GetComputeCapability() < 890) {
+    GTEST_SKIP();
+  }
+
+  constexpr index_t m = 32;
+  constexpr index_t k = 64;
+  constexpr index_t n = 48;
+  cudaExecutor exec{};
+
+  auto a = make_tensor<matxFp8E4M3>({m, k});
+  auto bt = make_tensor<matxFp8E4M3>({n, k});
+  auto scale_a = make_tensor<float>({});
+  auto scale_b = make_tensor<float>({});
+  auto c = make_tensor<float>({m, n});
+  auto amax = make_tensor<float>({});
+  (a = as_type<matxFp8E4M3>(ones<float>({m, k}) * 2.0f)).run(exec);
+  (bt = as_type<matxFp8E4M3>(ones<float>({n, k}) * 0.5f)).run(exec);
+  exec.sync();
+  scale_a() = 4.0f;
+  scale_b() = 0.125f;
+
+  // example-begin matmul-scaled-test-2
+  (mtie(c, amax) = matmul_scaled_amax(a, bt.Permute({1, 0}), scale_a, scale_b)).run(exec);
+  // example-end matmul-scaled-test-2
+  exec.sync();
+
+  const float expected = static_cast<float>(k) * 2.0f * 0.5f * 4.0f * 0.125f;
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_NEAR(c(i, j), expected, 1e-3f);
+    }
+  }
+  ASSERT_NEAR(amax(), expected, 1e-3f);
+  MATX_EXIT_HANDLER();
+}
+
+TEST(MatMulComplexHalfTests, Gemm3M4M)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t m = 32;
+  constexpr index_t k = 48;
+  constexpr index_t n = 40;
+  cudaExecutor exec{};
+
+  auto a = make_tensor<matxFp16Complex>({m, k});
+  auto b = make_tensor<matxFp16Complex>({k, n});
+  auto c = make_tensor<matxFp16Complex>({m, n});
+  auto af = make_tensor<cuda::std::complex<float>>({m, k});
+  auto bf = make_tensor<cuda::std::complex<float>>({k, n});
+  auto cf = make_tensor<cuda::std::complex<float>>({m, n});
+
+  // Small multiples of 1/8 are exact in fp16, so only accumulation order differs
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < k; j++) {
+      af(i, j) = {static_cast<float>((i + j) % 5) * 0.125f, static_cast<float>((i * j) % 3) * -0.125f};
+      a(i, j) = af(i, j);
+    }
+  }
+  for (index_t i = 0; i < k; i++) {
+    for (index_t j = 0; j < n; j++) {
+      bf(i, j) = {static_cast<float>((i + 2 * j) % 4) * 0.125f, static_cast<float>((i + j) % 7) * 0.125f};
+      b(i, j) = bf(i, j);
+    }
+  }
+
+  (cf = matmul(af, bf)).run(exec);
+
+  for (const auto algo : {MatMulComplexHalfAlgo_t::GEMM_3M, MatMulComplexHalfAlgo_t::GEMM_4M}) {
+    SetMatMulComplexHalfAlgo(algo);
+    (c = matmul(a, b)).run(exec);
+    exec.sync();
+
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < n; j++) {
+        ASSERT_NEAR(static_cast<float>(c(i, j).real()), cf(i, j).real(), 0.05f);
+        ASSERT_NEAR(static_cast<float>(c(i, j).imag()), cf(i, j).imag(), 0.05f);
+      }
+    }
+  }
+
+  // A transposed view is absorbed by the split kernel
+  SetMatMulComplexHalfAlgo(MatMulComplexHalfAlgo_t::GEMM_3M);
+  auto at = make_tensor<matxFp16Complex>({k, m});
+  (at = transpose(a)).run(exec);
+  (c = matmul(at.Permute({1, 0}), b)).run(exec);
+  exec.sync();
+  SetMatMulComplexHalfAlgo(MatMulComplexHalfAlgo_t::PLANAR);
+
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      ASSERT_NEAR(static_cast<float>(c(i, j).real()), cf(i, j).real(), 0.05f);
+      ASSERT_NEAR(static_cast<float>(c(i, j).imag()), cf(i, j).imag(), 0.05f);
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TEST(MatMulGroupedTests, VariableM)
+{
+  MATX_ENTER_HANDLER();
+  constexpr index_t k = 24;
+  constexpr index_t n = 16;
+  const std::vector<index_t> ms = {5, 32, 5, 17, 1};
+  cudaExecutor exec{};
+
+  using tensor2 = tensor_t<float, 2>;
+  std::vector<tensor2> as, bs, cs, refs;
+  for (size_t g = 0; g < ms.size(); g++) {
+    as.push_back(make_tensor<float>({ms[g], k}));
+    bs.push_back(make_tensor<float>({k, n}));
+    cs.push_back(make_tensor<float>({ms[g], n}));
+    refs.push_back(make_tensor<float>({ms[g], n}));
+    (as[g] = random<float>({ms[g], k}, NORMAL)).run(exec);
+    (bs[g] = random<float>({k, n}, NORMAL)).run(exec);
+    (refs[g] = matmul(as[g], bs[g])).run(exec);
+  }
+
+  // example-begin matmul-grouped-test-1
+  // Multiply five matrices with different row counts in a single call
+  matmul_grouped(cs, as, bs, exec);
+  // example-end matmul-grouped-test-1
+
+  // Second call with the same shapes reuses the cached plan
+  matmul_grouped(cs, as, bs, exec);
+  exec.sync();
+
+  for (size_t g = 0; g < ms.size(); g++) {
+    for (index_t i = 0; i < ms[g]; i++) {
+      for (index_t j = 0; j < n; j++) {
+        ASSERT_NEAR(cs[g](i, j), refs[g](i, j), 1e-3f);
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+#if defined(MATX_EN_JIT) && defined(MATX_EN_MATHDX)
+TEST(MatMulJITTests, FusedBatchedSmallGemm)
+{
+  MATX_ENTER_HANDLER();
+  // The 48x40 output tile is larger than the cuBLASDx block, so each block makes several passes
+  constexpr index_t batches = 3;
+  constexpr index_t m = 48;
+  constexpr index_t k = 32;
+  constexpr index_t n = 40;
+  CUDAJITExecutor jexec{};
+  cudaExecutor exec{};
+
+  auto a = make_tensor<float>({batches, m, k});
+  auto b = make_tensor<float>({batches, k, n});
+  auto c = make_tensor<float>({batches, m, n});
+  auto ref = make_tensor<float>({batches, m, n});
+  (a = random<float>({batches, m, k}, NORMAL)).run(exec);
+  (b = random<float>({batches, k, n}, NORMAL)).run(exec);
+  (ref = matmul(a * 2.0f, b) / 4.0f).run(exec);
+  exec.sync();
+
+  // Producer scaling, the GEMM and the normalization compile into one kernel
+  auto expr = matmul(a * 2.0f, b) / 4.0f;
+  if (!jit_supported(expr)) {
+    GTEST_SKIP();
+  }
+
+  (c = expr).run(jexec);
+  jexec.sync();
+
+  for (index_t bi = 0; bi < batches; bi++) {
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < n; j++) {
+        ASSERT_NEAR(c(bi, i, j), ref(bi, i, j), 1e-3f);
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+#endif
@@ -314,4 +314,56 @@ TYPED_TEST(NormalizeTestFloatNonComplexNonHalfAllExecs, NormalizeCenter)
   MATX_TEST_ASSERT_COMPARE(this->pb, this->out_m, "out_m", this->thresh);
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+TYPED_TEST(NormalizeTestFloatNonComplexNonHalfAllExecs, NormalizeRowsFused)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = std::tuple_element_t<0, TypeParam>;
+  using ExecType = std::tuple_element_t<1, TypeParam>;
+
+  // Normalizing along the last dimension runs the fused row kernel. The lengths cover a warp per row with
+  // cached rows, a block per row with a cached row, and a block per row that reads the input twice.
+  if constexpr (!is_cuda_executor_v<ExecType>) {
+    GTEST_SKIP();
+  }
+  else {
+    for (const index_t cols : {index_t{256}, index_t{3000}, index_t{20000}}) {
+      const index_t rows = cols == 256 ? 1000 : 5;
+      auto in = make_tensor<TestType>({rows, cols});
+      auto out = make_tensor<TestType>({rows, cols});
+      auto nrm = make_tensor<TestType>({rows});
+      (in = random<TestType>({rows, cols}, NORMAL)).run(this->exec);
+
+      for (const float p : {-1.0f, 1.0f, 2.0f, 3.0f}) {
+        // example-begin normalize-test-rows
+        (out = normalize<1>(in, NORMALIZE_RANGE::NORM, p)).run(this->exec);
+        // example-end normalize-test-rows
+        this->exec.sync();
+
+        for (index_t r = 0; r < rows; r++) {
+          double ref = 0.0;
+          for (index_t c = 0; c < cols; c++) {
+            const double a = std::abs(static_cast<double>(in(r, c)));
+            ref = p < 0.0f ? std::max(ref, a) : ref + std::pow(a, static_cast<double>(p));
+          }
+          ref = p < 0.0f ? ref : std::pow(ref, 1.0 / p);
+          for (index_t c = 0; c < cols; c += 7) {
+            ASSERT_NEAR(static_cast<double>(out(r, c)), static_cast<double>(in(r, c)) / ref, 1e-4);
+          }
+        }
+      }
+
+      (nrm = vector_norm(in, NormOrder::L2)).run(this->exec);
+      this->exec.sync();
+      for (index_t r = 0; r < rows; r++) {
+        double ref = 0.0;
+        for (index_t c = 0; c < cols; c++) {
+          ref += static_cast<double>(in(r, c)) * static_cast<double>(in(r, c));
+        }
+        ASSERT_NEAR(static_cast<double>(nrm(r)), std::sqrt(ref), 1e-3 * std::sqrt(ref));
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
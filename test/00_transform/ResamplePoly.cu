@@ -579,4 +579,107 @@ TYPED_TEST(ResamplePolyTestNonHalfFloatTypes, Operators)
   }
 
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+TYPED_TEST(ResamplePolyTestNonHalfFloatTypes, Streaming)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  struct {
+    index_t f_len;
+    index_t up;
+    index_t down;
+  } test_cases[] = {
+    { 31, 3, 5 },
+    { 48, 7, 2 },
+    { 5, 1, 4 },
+  };
+
+  // Irregular block sizes, including a single sample, exercise the carried-over phase
+  const index_t blocks[] = { 700, 1, 1299, 2000, 1000 };
+  index_t a_len = 0;
+  for (const auto b : blocks) {
+    a_len += b;
+  }
+
+  auto a = make_tensor<TestType>({a_len});
+  for (index_t j = 0; j < a_len; j++) {
+    a(j) = static_cast<TestType>(static_cast<double>((j * 37) % 101) / 101.0 - 0.5);
+  }
+
+  for (size_t i = 0; i < sizeof(test_cases)/sizeof(test_cases[0]); i++) {
+    const index_t f_len = test_cases[i].f_len;
+    const index_t up = test_cases[i].up;
+    const index_t down = test_cases[i].down;
+
+    auto f = make_tensor<TestType>({f_len});
+    for (index_t j = 0; j < f_len; j++) {
+      f(j) = static_cast<TestType>(static_cast<double>(f_len - j) / static_cast<double>(f_len));
+    }
+
+    const index_t up_len = a_len * up;
+    const index_t b_len = up_len / down + ((up_len % down) ? 1 : 0);
+    auto ref = make_tensor<TestType>({b_len});
+    (ref = resample_poly(a, f, up, down)).run(this->exec);
+
+    auto b = make_tensor<TestType>({b_len});
+    StreamingResamplePoly<TestType> resampler(f, up, down, this->exec.getStream());
+    index_t in_pos = 0;
+    index_t out_pos = 0;
+    for (const auto blk : blocks) {
+      auto out = slice(b, {out_pos}, {out_pos + resampler.OutputSize(blk)});
+      out_pos += resampler.Process(out, slice(a, {in_pos}, {in_pos + blk}));
+      in_pos += blk;
+    }
+    auto tail = slice(b, {out_pos}, {out_pos + resampler.FlushSize()});
+    out_pos += resampler.Flush(tail);
+    ASSERT_EQ(out_pos, b_len);
+
+    this->exec.sync();
+
+    for (index_t j = 0; j < b_len; j++) {
+      ASSERT_NEAR(cuda::std::abs(ref(j) - b(j)), 0.0, this->thresh) << "index " << j;
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ResamplePolyTestNonHalfFloatTypes, Autotune)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  const index_t a_len = 10000;
+  const index_t f_len = 301;
+  const index_t up = 4;
+  const index_t down = 3;
+  const index_t b_len = (a_len * up + down - 1) / down;
+
+  auto a = make_tensor<TestType>({a_len});
+  auto f = make_tensor<TestType>({f_len});
+  for (index_t j = 0; j < a_len; j++) {
+    a(j) = static_cast<TestType>(static_cast<double>((j * 37) % 101) / 101.0 - 0.5);
+  }
+  for (index_t j = 0; j < f_len; j++) {
+    f(j) = static_cast<TestType>(1.0 / static_cast<double>(f_len));
+  }
+
+  auto ref = make_tensor<TestType>({b_len});
+  (ref = resample_poly(a, f, up, down)).run(this->exec);
+
+  // The first tuned call benchmarks every kernel and the second reuses the cached winner. Both
+  // must match the heuristic's result.
+  SetKernelAutotune(true);
+  for (int iter = 0; iter < 2; iter++) {
+    auto b = make_tensor<TestType>({b_len});
+    (b = resample_poly(a, f, up, down)).run(this->exec);
+    this->exec.sync();
+    for (index_t j = 0; j < b_len; j++) {
+      ASSERT_NEAR(cuda::std::abs(ref(j) - b(j)), 0.0, this->thresh) << "index " << j;
+    }
+  }
+  SetKernelAutotune(false);
+
+  MATX_EXIT_HANDLER();
+}
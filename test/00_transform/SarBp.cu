@@ -208,6 +208,30 @@ TYPED_TEST(SarBpTestDoubleType, MixedPrecision)
     this->exec.sync();
   }
 
+  // Store the range profiles in half precision and accumulate with float-float. The all-ones
+  // profiles are exact in fp16, so the result should match the fp32-profile FloatFloat image.
+  {
+    auto range_profiles_half = matx::make_tensor<matxFp16Complex>({num_pulses, num_range_bins});
+    auto image_half = matx::make_tensor<complex_t>({image_height, image_width});
+    (range_profiles_half = matx::ones<matxFp16Complex>({num_pulses, num_range_bins})).run(this->exec);
+    params.features = SarBpFeature::PhaseLUTOptimization | SarBpFeature::FloatFloatAccumulation;
+    (image_half = matx::experimental::sar_bp(zero_image, range_profiles_half, platform_positions, voxel_locations, range_to_mcp, params)).run(this->exec);
+    this->exec.sync();
+
+    for (index_t y = 0; y < image_height; y++) {
+      for (index_t x = 0; x < image_width; x++) {
+        ASSERT_NEAR(image_half(y, x).real(), image(y, x).real(), 1.0e-3f);
+        ASSERT_NEAR(image_half(y, x).imag(), image(y, x).imag(), 1.0e-3f);
+      }
+    }
+
+    // Float-float accumulation is only supported with the FloatFloat compute type
+    params.compute_type = SarBpComputeType::Mixed;
+    ASSERT_THROW({
+      (image_half = matx::experimental::sar_bp(zero_image, range_profiles_half, platform_positions, voxel_locations, range_to_mcp, params)).run(this->exec);
+    }, matx::detail::matxException);
+  }
+
   MATX_EXIT_HANDLER();
 }
 
@@ -428,3 +452,83 @@ TYPED_TEST(SarBpTestDoubleType, PointTarget)
 
   MATX_EXIT_HANDLER();
 }
+
+// Accumulate pulse blocks into an image split into tiles on separate streams and
+// compare against backprojecting all pulses in one call.
+TYPED_TEST(SarBpTestDoubleType, TiledPulseBlocks)
+{
+  MATX_ENTER_HANDLER();
+
+  using complex_t = cuda::std::complex<double>;
+
+  const index_t num_range_bins = 128;
+  const index_t num_pulses = 128;
+  const index_t image_width = 128;
+  const index_t image_height = 100;
+  const index_t max_pulses = 48;
+
+  const double min_x = -10.0;
+  const double max_x = 10.0;
+  auto pix_coords_x = matx::linspace<double>(min_x, max_x, image_width);
+  auto pix_coords_y = matx::linspace<double>(min_x, max_x, image_height);
+  auto pix_coords_yclone = matx::clone<2>(pix_coords_y, {matx::matxKeepDim, image_width});
+  auto pix_coords_xclone = matx::clone<2>(pix_coords_x, {image_height, matx::matxKeepDim});
+  auto voxel_locations = matx::make_tensor<double3>({image_height, image_width});
+  (voxel_locations = matx::zipvec(pix_coords_xclone, pix_coords_yclone,
+                                  matx::zeros<double>({image_height, image_width}))).run(this->exec);
+
+  auto range_profiles = matx::make_tensor<complex_t>({num_pulses, num_range_bins});
+  (range_profiles = matx::random<complex_t>(range_profiles.Shape(), NORMAL)).run(this->exec);
+  auto range_to_mcp = matx::make_tensor<double>({num_pulses});
+  auto platform_positions = matx::make_tensor<double3>({num_pulses});
+  this->exec.sync();
+  const double plat_dx = (max_x - min_x) / num_pulses;
+  for (index_t i = 0; i < num_pulses; i++) {
+    const double plat_x = min_x + static_cast<double>(i) * plat_dx;
+    platform_positions(i) = double3{plat_x, -1000.0, 1000.0};
+    range_to_mcp(i) = ::sqrt(plat_x * plat_x + 2.0e6);
+  }
+
+  SarBpParams params;
+  params.compute_type = SarBpComputeType::Double;
+  params.center_frequency = 10.0e9;
+  params.del_r = (max_x - min_x) / num_range_bins;
+
+  auto expected = matx::make_tensor<complex_t>({image_height, image_width});
+  (expected = matx::experimental::sar_bp(matx::zeros<complex_t>({image_height, image_width}), range_profiles,
+      platform_positions, voxel_locations, range_to_mcp, params)).run(this->exec);
+  this->exec.sync();
+
+  // Three tiles on separate streams of the current device
+  int dev;
+  MATX_CUDA_CHECK(cudaGetDevice(&dev));
+  // example-begin sar-bp-2
+  auto image = make_sharded_tensor<complex_t>({image_height, image_width}, {dev, dev, dev});
+  auto voxels = make_sharded_tensor<double3>({image_height, image_width}, {dev, dev, dev});
+  voxels.Scatter(voxel_locations);
+  for_each_shard(image, [](int, auto &shard, auto &exec) { (shard = complex_t{0.0, 0.0}).run(exec); });
+
+  matx::experimental::SarBpAccumulator<complex_t, double3, complex_t, double3> bp(
+      image, voxels, max_pulses, num_range_bins, params);
+  for (index_t p = 0; p < num_pulses; p += max_pulses) {
+    const index_t n = std::min(max_pulses, num_pulses - p);
+    bp.Accumulate(slice(range_profiles, {p, 0}, {p + n, matxEnd}),
+                  slice(platform_positions, {p}, {p + n}),
+                  slice(range_to_mcp, {p}, {p + n}));
+  }
+  bp.Sync();
+  // example-end sar-bp-2
+  ASSERT_EQ(bp.PulsesProcessed(), num_pulses);
+
+  auto result = matx::make_tensor<complex_t>({image_height, image_width});
+  image.Gather(result);
+
+  for (index_t i = 0; i < image_height; i++) {
+    for (index_t j = 0; j < image_width; j++) {
+      ASSERT_NEAR(result(i, j).real(), expected(i, j).real(), 1e-9);
+      ASSERT_NEAR(result(i, j).imag(), expected(i, j).imag(), 1e-9);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
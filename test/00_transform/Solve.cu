@@ -93,3 +93,183 @@ TYPED_TEST(SolveTestsFloatNonComplexNonHalf, CGSolve)
   MATX_EXIT_HANDLER();
 }
 
+
+TYPED_TEST(SolveTestsFloatNonComplexNonHalf, CGSolveSparse)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;  
+  ExecType exec{};
+
+  const index_t N = 64;
+
+  auto A = make_tensor<TestType>({N, N});
+  auto X = make_tensor<TestType>({N});
+  auto B = make_tensor<TestType>({N});
+  auto AX = make_tensor<TestType>({N});
+
+  // Simple 1D Poisson matrix
+  for(index_t i = 0; i < N; i++) {
+    X(i) = TestType(0);
+    B(i) = TestType(1);
+    for(index_t j = 0; j < N; j++) {
+      A(i,j) = (i == j) ? TestType(2) : ((i == j-1 || i == j+1) ? TestType(-1) : TestType(0));
+    }
+  }
+
+  auto S = experimental::make_zero_tensor_csr<TestType, index_t, index_t>({N, N});
+  (S = dense2sparse(A)).run(exec);
+
+  // example-begin cgsolve-test-2
+  // Sparse A goes through cuSPARSE, and the host checks for convergence every 8 iterations
+  (X = cgsolve(S, B, .00001, 2 * N, 8)).run(exec);
+  // example-end cgsolve-test-2
+  (AX = matvec(A, X)).run(exec);
+  exec.sync();
+
+  for(index_t i = 0; i < N; i++) {
+    ASSERT_NEAR(AX(i), TestType(1), .001);
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(SolveTestsFloatNonComplexNonHalf, CGSolveDeviceLoop)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+  cudaExecutor exec{stream};
+
+  const index_t N = 64;
+  const index_t BATCH = 3;
+
+  auto A = make_tensor<TestType>({BATCH, N, N});
+  auto X = make_tensor<TestType>({BATCH, N});
+  auto B = make_tensor<TestType>({BATCH, N});
+  auto AX = make_tensor<TestType>({BATCH, N});
+
+  // Simple 1D Poisson matrix
+  for(index_t b = 0; b < BATCH; b++) {
+    for(index_t i = 0; i < N; i++) {
+      X(b, i) = TestType(0);
+      B(b, i) = TestType(1 + b);
+      for(index_t j = 0; j < N; j++) {
+        A(b, i, j) = (i == j) ? TestType(2) : ((i == j-1 || i == j+1) ? TestType(-1) : TestType(0));
+      }
+    }
+  }
+
+  // A check interval of 0 loops on the device until converged, or checks every iteration on the host
+  // when device loops are not available. An odd iteration limit also covers the trailing iteration
+  (X = cgsolve(A, B, .00001, 2 * N + 1, 0)).run(exec);
+  (AX = matvec(A, X)).run(exec);
+  exec.sync();
+
+  for(index_t b = 0; b < BATCH; b++) {
+    for(index_t i = 0; i < N; i++) {
+      ASSERT_NEAR(AX(b, i), TestType(1 + b), .001);
+    }
+  }
+
+  cudaStreamDestroy(stream);
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(SolveTestsFloatNonComplexNonHalf, DenseSolve)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  ExecType exec{};
+
+  const index_t N = 256;
+  const index_t NRHS = 3;
+
+  auto A = make_tensor<TestType>({N, N});
+  auto B = make_tensor<TestType>({NRHS, N});
+  auto X = make_tensor<TestType>({NRHS, N});
+  auto XR = make_tensor<TestType>({NRHS, N});
+
+  // Diagonally dominant, so the system is well conditioned
+  for (index_t i = 0; i < N; i++) {
+    for (index_t j = 0; j < N; j++) {
+      A(i, j) = (i == j) ? TestType(N) : TestType(static_cast<double>((i * 7 + j * 3) % 11) / 11.0 - 0.5);
+    }
+  }
+  for (index_t r = 0; r < NRHS; r++) {
+    for (index_t i = 0; i < N; i++) {
+      B(r, i) = TestType(static_cast<double>((i + r * 5) % 9) - 4.0);
+    }
+  }
+
+  (X = solve(A, B, SolvePrecision::FULL)).run(exec);
+  // example-begin solve-test-3
+  // Factor in TF32 and refine the solution to the precision of A
+  (XR = solve(A, B, SolvePrecision::REFINED)).run(exec);
+  // example-end solve-test-3
+  exec.sync();
+
+  for (index_t r = 0; r < NRHS; r++) {
+    for (index_t i = 0; i < N; i++) {
+      double ax = 0.0;
+      double axr = 0.0;
+      for (index_t j = 0; j < N; j++) {
+        ax += static_cast<double>(A(i, j)) * static_cast<double>(X(r, j));
+        axr += static_cast<double>(A(i, j)) * static_cast<double>(XR(r, j));
+      }
+      ASSERT_NEAR(ax, static_cast<double>(B(r, i)), 1e-3) << "full " << r << " " << i;
+      ASSERT_NEAR(axr, static_cast<double>(B(r, i)), 1e-3) << "refined " << r << " " << i;
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(SolveTestsFloatNonComplexNonHalf, ToeplitzSolve)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  ExecType exec{};
+
+  const index_t N = 300;
+  const index_t BATCH = 3;
+
+  auto t = make_tensor<TestType>({N});
+  auto B = make_tensor<TestType>({BATCH, N});
+  auto XL = make_tensor<TestType>({BATCH, N});
+  auto XP = make_tensor<TestType>({BATCH, N});
+
+  // Autocorrelation of an AR(1) process, which is positive definite
+  for (index_t i = 0; i < N; i++) {
+    t(i) = TestType(std::pow(0.6, static_cast<double>(i)));
+  }
+  for (index_t r = 0; r < BATCH; r++) {
+    for (index_t i = 0; i < N; i++) {
+      B(r, i) = TestType(static_cast<double>((i * 3 + r * 5) % 7) - 3.0);
+    }
+  }
+
+  // example-begin toeplitz-solve-test-1
+  // t is the first column of a symmetric Toeplitz matrix shared by every row of B
+  (XL = toeplitz_solve(t, B)).run(exec);
+  (XP = toeplitz_solve(t, B, ToeplitzSolveMethod::PCG, 1e-7, 50)).run(exec);
+  // example-end toeplitz-solve-test-1
+  exec.sync();
+
+  for (index_t r = 0; r < BATCH; r++) {
+    for (index_t i = 0; i < N; i++) {
+      double txl = 0.0;
+      double txp = 0.0;
+      for (index_t j = 0; j < N; j++) {
+        const double tij = static_cast<double>(t(i > j ? i - j : j - i));
+        txl += tij * static_cast<double>(XL(r, j));
+        txp += tij * static_cast<double>(XP(r, j));
+      }
+      ASSERT_NEAR(txl, static_cast<double>(B(r, i)), 1e-3) << "levinson " << r << " " << i;
+      ASSERT_NEAR(txp, static_cast<double>(B(r, i)), 1e-3) << "pcg " << r << " " << i;
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
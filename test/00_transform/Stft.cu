@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+class StftTest : public ::testing::Test {
+protected:
+  using complex = cuda::std::complex<float>;
+
+  void SetUp() override
+  {
+    (x = random<complex>(x.Shape(), NORMAL)).run(exec);
+    (w = hanning<0, 1, float>({win_len})).run(exec);
+  }
+
+  template <typename A, typename B>
+  void ExpectClose(const A &a, const B &b, float thresh)
+  {
+    for (index_t f = 0; f < a.Size(0); f++) {
+      for (index_t k = 0; k < a.Size(1); k++) {
+        ASSERT_NEAR(a(f, k).real(), b(f, k).real(), thresh) << "frame " << f << " bin " << k;
+        ASSERT_NEAR(a(f, k).imag(), b(f, k).imag(), thresh) << "frame " << f << " bin " << k;
+      }
+    }
+  }
+
+  static constexpr index_t n = 4096;
+  static constexpr index_t win_len = 200;
+  static constexpr index_t nfft = 256;
+  static constexpr index_t hop = 50;
+  static constexpr index_t frames = (n - win_len) / hop + 1;
+
+  cudaExecutor exec{};
+  tensor_t<complex, 1> x{{n}};
+  tensor_t<float, 1> w{{win_len}};
+};
+
+TEST_F(StftTest, MatchesOverlapWindowFFT)
+{
+  MATX_ENTER_HANDLER();
+
+  auto s = make_tensor<complex>({frames, nfft});
+  auto ref = make_tensor<complex>({frames, nfft});
+
+  // example-begin stft-test-1
+  (s = stft(x, nfft, hop, w)).run(exec);
+  // example-end stft-test-1
+
+  (ref = fft(overlap(x, {win_len}, {hop}) * w, nfft)).run(exec);
+  exec.sync();
+
+  ExpectClose(s, ref, 1e-3f);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST_F(StftTest, BatchedChannels)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t channels = 3;
+  auto xc = make_tensor<complex>({channels, n});
+  (xc = random<complex>(xc.Shape(), NORMAL)).run(exec);
+
+  auto s = make_tensor<complex>({channels, frames, nfft});
+  (s = stft(xc, nfft, hop, w)).run(exec);
+
+  auto ref = make_tensor<complex>({frames, nfft});
+  for (index_t c = 0; c < channels; c++) {
+    (ref = stft(slice<1>(xc, {c, 0}, {matxDropDim, matxEnd}), nfft, hop, w)).run(exec);
+    exec.sync();
+    ExpectClose(slice<2>(s, {c, 0, 0}, {matxDropDim, matxEnd, matxEnd}), ref, 1e-3f);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST_F(StftTest, InverseRoundTrip)
+{
+  MATX_ENTER_HANDLER();
+
+  constexpr index_t out_len = (frames - 1) * hop + win_len;
+  auto s = make_tensor<complex>({frames, nfft});
+  auto y = make_tensor<complex>({out_len});
+
+  // example-begin stft-test-2
+  (s = stft(x, nfft, hop, w)).run(exec);
+  (y = istft(s, hop, w)).run(exec);
+  // example-end stft-test-2
+  exec.sync();
+
+  // The window tapers to zero at its ends, so only samples covered by several frames are compared
+  for (index_t i = win_len; i < out_len - win_len; i++) {
+    ASSERT_NEAR(y(i).real(), x(i).real(), 1e-3f) << "sample " << i;
+    ASSERT_NEAR(y(i).imag(), x(i).imag(), 1e-3f) << "sample " << i;
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST_F(StftTest, StreamingMatchesBatch)
+{
+  MATX_ENTER_HANDLER();
+
+  auto ref = make_tensor<complex>({frames, nfft});
+  (ref = stft(x, nfft, hop, w)).run(exec);
+
+  // example-begin stft-test-3
+  // Samples arrive in uneven blocks; each Push() writes the frames that block completes
+  experimental::StftStream<complex, decltype(w)> stream(nfft, hop, w, exec);
+  auto s = make_tensor<complex>({frames, nfft});
+  const index_t blocks[] = {30, 170, 1, 999, 512, 2384};
+  index_t start = 0;
+  for (index_t len : blocks) {
+    auto cols = slice(s, {stream.Frames(), 0}, {matxEnd, matxEnd});
+    stream.Push(slice(x, {start}, {start + len}), cols);
+    start += len;
+  }
+  // example-end stft-test-3
+  exec.sync();
+
+  ASSERT_EQ(stream.Frames(), frames);
+  ExpectClose(s, ref, 1e-3f);
+
+  MATX_EXIT_HANDLER();
+}
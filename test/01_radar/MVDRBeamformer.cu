@@ -58,8 +58,6 @@ TEST(Radar, MVDRBeamformer)
 
   auto in_vec = mvdr.GetInVec();
   auto v = mvdr.GetV();
-  // auto cov_mat  = mvdr.GetCovMatView();
-  auto cov_inv = mvdr.GetCovMatInvView();
 
   pb->NumpyToTensorView(in_vec, "in_vec");
   pb->NumpyToTensorView(v, "v");
@@ -68,10 +66,49 @@ TEST(Radar, MVDRBeamformer)
   exec.sync();
 
   auto cbf = mvdr.GetCBFView();
+  auto weights = mvdr.GetWeights();
 
   MATX_TEST_ASSERT_COMPARE(pb, in_vec, "in_vec", 0.01);
   MATX_TEST_ASSERT_COMPARE(pb, cbf, "out_cbf", 0.01);
-  MATX_TEST_ASSERT_COMPARE(pb, cov_inv, "cov_inv", 0.01);
+  MATX_TEST_ASSERT_COMPARE(pb, weights, "weights", 0.01);
+
+  MATX_EXIT_HANDLER();
+}
+
+TEST(Radar, MVDRBatched)
+{
+  MATX_ENTER_HANDLER();
+
+  index_t num_beams = 60;
+  index_t num_el = 6;
+  index_t data_len = 1000;
+  index_t snap_len = 2 * num_el;
+
+  cudaExecutor exec{};
+
+  auto pb = std::make_unique<detail::MatXPybind>();
+  pb->InitAndRunTVGenerator<complex>("mvdr_beamformer", "mvdr_beamformer",
+                                     "run", {data_len, num_beams, num_el});
+
+  auto in_vec = make_tensor<complex>({num_el, data_len});
+  auto v = make_tensor<complex>({num_el, num_beams});
+  pb->NumpyToTensorView(in_vec, "in_vec");
+  pb->NumpyToTensorView(v, "v");
+
+  // example-begin mvdr-test-1
+  // Three batches of training snapshots sharing one set of steering vectors
+  auto snaps = make_tensor<complex>({3, num_el, snap_len});
+  (snaps = clone<3>(slice(in_vec, {0, 0}, {matxEnd, snap_len}), {3, matxKeepDim, matxKeepDim})).run(exec);
+
+  auto weights = make_tensor<complex>({3, num_el, num_beams});
+  (weights = mvdr(snaps, v, 0.1f)).run(exec);
+  // example-end mvdr-test-1
+  exec.sync();
+
+  for (index_t b = 0; b < 3; b++) {
+    auto wb = slice<2>(weights, {b, 0, 0}, {matxDropDim, matxEnd, matxEnd});
+    MATX_TEST_ASSERT_COMPARE(pb, wb, "weights", 0.01);
+  }
 
   MATX_EXIT_HANDLER();
 }
@@ -193,3 +193,33 @@ TYPED_TEST(MultiChannelRadarPipelineTypes, CFARDetection)
   ASSERT_EQ(detects, 17 * this->numChannels);
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(MultiChannelRadarPipelineTypes, CFARDetectionFused)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  auto p = RadarPipeline<TestType>(this->numPulses, this->numSamples,
+                                    this->waveformLength, this->numChannels, 0);
+  auto inView = p.GetTPCView();
+
+  this->pb->NumpyToTensorView(inView, "X_window");
+
+  p.CFARDetectionsFused();
+  p.sync();
+
+  auto detsView = p.GetDetections();
+  MATX_TEST_ASSERT_COMPARE(this->pb, detsView, "dets", 0.01);
+
+  uint32_t detects = 0;
+  for (index_t s0 = 0; s0 < detsView.Size(0); s0++) {
+    for (index_t s1 = 0; s1 < detsView.Size(1); s1++) {
+      for (index_t s2 = 0; s2 < detsView.Size(2); s2++) {
+        detects += detsView(s0, s1, s2);
+      }
+    }
+  }
+
+  ASSERT_EQ(detects, 17 * this->numChannels);
+  MATX_EXIT_HANDLER();
+}
@@ -115,3 +115,41 @@ TEST_F(RadarAmbiguityFunction, DISABLED_CutDoppler)
 
   MATX_EXIT_HANDLER();
 }
+
+TEST(RadarAmbiguityFunctionBatched, DopplerWindow)
+{
+  MATX_ENTER_HANDLER();
+
+  const index_t batches = 5;
+  const index_t n = 16;
+  const index_t lags = 2 * n - 1;
+  const index_t nfreq = 32;
+  const index_t doppler_start = 8;
+  const index_t num_doppler = 12;
+
+  auto x = make_tensor<complex>({batches, n});
+  (x = random<complex>(x.Shape(), NORMAL)).run();
+
+  auto amf = make_tensor<float>({batches, lags, num_doppler});
+
+  // example-begin ambgfun-test-3
+  // Auto-ambiguity of 5 signals, keeping Doppler bins [8, 20) of each surface
+  (amf = ambgfun_batched(x, x, doppler_start, num_doppler)).run();
+  // example-end ambgfun-test-3
+
+  // Each surface must match the Doppler window of the single-signal 2D cut
+  auto ref = make_tensor<float>({lags, nfreq});
+  for (index_t b = 0; b < batches; b++) {
+    auto xb = slice<1>(x, {b, 0}, {matxDropDim, matxEnd});
+    (ref = ambgfun(xb, 1e3, AMBGFUN_CUT_TYPE_2D, 1.0)).run();
+    cudaStreamSynchronize(0);
+
+    for (index_t d = 0; d < lags; d++) {
+      for (index_t k = 0; k < num_doppler; k++) {
+        ASSERT_NEAR(amf(b, d, k), ref(d, doppler_start + k), 1e-3);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
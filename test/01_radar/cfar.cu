@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2021, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+template <typename T> class CFARTest : public ::testing::Test {
+protected:
+  using GTestType = cuda::std::tuple_element_t<0, T>;
+  using GExecType = cuda::std::tuple_element_t<1, T>;
+
+  void SetUp() override
+  {
+    // Same window as the simple radar pipeline: a 3x3 guard box inside a 5x13 window
+    params.guard_rows = 1;
+    params.guard_cols = 1;
+    params.train_rows = 1;
+    params.train_cols = 5;
+    params.pfa = 1e-4;
+  }
+
+  // Noise with a few strong targets
+  template <typename Tensor>
+  void MakeInput(Tensor &x)
+  {
+    (x = random<GTestType>(x.Shape(), NORMAL)).run(exec);
+    exec.sync();
+    x(0, 10, 20) = GTestType{40, 0};
+    x(1, 0, 0) = GTestType{0, 40};
+    x(2, 30, 100) = GTestType{-30, 30};
+  }
+
+  GExecType exec{};
+  CFARParams params;
+  index_t channels = 3;
+  index_t rows = 40;
+  index_t cols = 150;
+};
+
+template <typename TensorType>
+class CFARTestComplexTypes : public CFARTest<TensorType> {
+};
+
+TYPED_TEST_SUITE(CFARTestComplexTypes, MatXComplexNonHalfTypesCUDAExec);
+
+TYPED_TEST(CFARTestComplexTypes, CellAveraging)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using inner_type = typename detail::inner_op_type_t<TestType>::type;
+
+  auto x = make_tensor<TestType>({this->channels, this->rows, this->cols});
+  this->MakeInput(x);
+
+  // example-begin cfar-test-1
+  auto dets = make_tensor<int>({this->channels, this->rows, this->cols});
+  (dets = cfar(x, this->params)).run(this->exec);
+  // example-end cfar-test-1
+
+  // Reference built the way the radar pipeline does it, from a masked convolution
+  auto mask = make_tensor<inner_type>({5, 13});
+  (mask = ones<inner_type>(mask.Shape())).run(this->exec);
+  this->exec.sync();
+  for (index_t r = 1; r <= 3; r++) {
+    for (index_t c = 5; c <= 7; c++) {
+      mask(r, c) = 0;
+    }
+  }
+
+  auto xpow = make_tensor<inner_type>({this->channels, this->rows, this->cols});
+  auto ba = make_tensor<inner_type>({this->channels, this->rows, this->cols});
+  auto norm = make_tensor<inner_type>({this->channels, this->rows, this->cols});
+  (xpow = abs2(x)).run(this->exec);
+  (ba = conv2d(xpow, mask, MATX_C_MODE_SAME)).run(this->exec);
+  (norm = conv2d(ones<inner_type>({this->channels, this->rows, this->cols}), mask, MATX_C_MODE_SAME)).run(this->exec);
+  this->exec.sync();
+
+  for (index_t b = 0; b < this->channels; b++) {
+    for (index_t r = 0; r < this->rows; r++) {
+      for (index_t c = 0; c < this->cols; c++) {
+        const double n = std::round(static_cast<double>(norm(b, r, c)));
+        const double alpha = n * (std::pow(this->params.pfa, -1.0 / n) - 1.0);
+        const int ref = static_cast<double>(xpow(b, r, c)) > alpha * static_cast<double>(ba(b, r, c)) / n ? 1 : 0;
+        ASSERT_EQ(dets(b, r, c), ref) << b << " " << r << " " << c;
+      }
+    }
+  }
+
+  ASSERT_EQ(dets(0, 10, 20), 1);
+  ASSERT_EQ(dets(1, 0, 0), 1);
+  ASSERT_EQ(dets(2, 30, 100), 1);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CFARTestComplexTypes, Variants)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  auto x = make_tensor<TestType>({this->channels, this->rows, this->cols});
+  this->MakeInput(x);
+
+  auto dets = make_tensor<int>({this->channels, this->rows, this->cols});
+  auto dets_host = make_tensor<int>({this->channels, this->rows, this->cols});
+  SingleThreadedHostExecutor host_exec{};
+
+  for (auto type : {CFARType::CA, CFARType::GO, CFARType::SO, CFARType::OS}) {
+    CFARParams params = this->params;
+    params.type = type;
+
+    (dets = cfar(x, params)).run(this->exec);
+    (dets_host = cfar(x, params)).run(host_exec);
+    this->exec.sync();
+
+    for (index_t b = 0; b < this->channels; b++) {
+      for (index_t r = 0; r < this->rows; r++) {
+        for (index_t c = 0; c < this->cols; c++) {
+          ASSERT_EQ(dets(b, r, c), dets_host(b, r, c)) << static_cast<int>(type) << " " << b << " " << r << " " << c;
+        }
+      }
+    }
+
+    ASSERT_EQ(dets(0, 10, 20), 1);
+    ASSERT_EQ(dets(2, 30, 100), 1);
+  }
+
+  // 1D window along a single range line
+  auto x1 = slice<1>(x, {0, 10, 0}, {matxDropDim, matxDropDim, matxEnd});
+  auto d1 = make_tensor<int>({this->cols});
+  auto d1_host = make_tensor<int>({this->cols});
+  CFARParams params1d;
+  params1d.guard_cols = 2;
+  params1d.train_cols = 16;
+  params1d.type = CFARType::OS;
+  (d1 = cfar(x1, params1d)).run(this->exec);
+  (d1_host = cfar(x1, params1d)).run(host_exec);
+  this->exec.sync();
+
+  for (index_t c = 0; c < this->cols; c++) {
+    ASSERT_EQ(d1(c), d1_host(c));
+  }
+  ASSERT_EQ(d1(20), 1);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(CFARTestComplexTypes, Detections)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  auto x = make_tensor<TestType>({this->channels, this->rows, this->cols});
+  this->MakeInput(x);
+
+  auto dets = make_tensor<int>({this->channels, this->rows, this->cols});
+  (dets = cfar(x, this->params)).run(this->exec);
+
+  // example-begin cfar-test-2
+  auto idx = make_tensor<index_t>({x.TotalSize()});
+  auto num_found = make_tensor<int>({});
+  (mtie(idx, num_found) = cfar(x, this->params)).run(this->exec);
+  // example-end cfar-test-2
+  this->exec.sync();
+
+  int expected = 0;
+  for (index_t i = 0; i < x.TotalSize(); i++) {
+    if (dets.Data()[i] != 0) {
+      ASSERT_LT(expected, num_found());
+      ASSERT_EQ(idx(expected), i);
+      expected++;
+    }
+  }
+  ASSERT_EQ(num_found(), expected);
+  ASSERT_GE(expected, 3);
+
+  MATX_EXIT_HANDLER();
+}
@@ -70,3 +70,60 @@ TEST_F(DctTests, Real1DN100)
 
   MATX_EXIT_HANDLER();
 }
+
+class DctBatchedTests : public ::testing::Test {
+protected:
+  // The odd row count exercises the unpaired middle sample of the even/odd reordering along axis 0.
+  // Rows stay even since DCT-IV needs an even length.
+  index_t rows = 15;
+  index_t cols = 62;
+  void SetUp() override
+  {
+
+    pb = std::make_unique<detail::MatXPybind>();
+    pb->InitAndRunTVGenerator<float>("01_signal", "dct_nd", "run", {rows, cols});
+
+    pb->NumpyToTensorView(xv, "x");
+  }
+
+  void TearDown() override { pb.reset(); }
+
+  tensor_t<float, 2> xv{{rows, cols}};
+  std::unique_ptr<detail::MatXPybind> pb;
+};
+
+/* DCT-II, III and IV of every row, a column DCT and a 2D DCT */
+TEST_F(DctBatchedTests, TypesAndAxes)
+{
+  MATX_ENTER_HANDLER();
+
+  auto y2 = make_tensor<float>({rows, cols});
+  auto y3 = make_tensor<float>({rows, cols});
+  auto y4 = make_tensor<float>({rows, cols});
+  auto y2_axis0 = make_tensor<float>({rows, cols});
+
+  (y2 = dct(xv)).run();
+  (y3 = dct(xv, DCTType::III)).run();
+  (y4 = dct(xv, DCTType::IV, -1, FFTNorm::ORTHO)).run();
+  (y2_axis0 = dct(xv, DCTType::II, 0, FFTNorm::ORTHO)).run();
+  cudaStreamSynchronize(0);
+
+  MATX_TEST_ASSERT_COMPARE(pb, y2, "Y2", 0.01);
+  MATX_TEST_ASSERT_COMPARE(pb, y3, "Y3", 0.01);
+  MATX_TEST_ASSERT_COMPARE(pb, y4, "Y4", 0.01);
+  MATX_TEST_ASSERT_COMPARE(pb, y2_axis0, "Y2_axis0", 0.01);
+
+  // example-begin dct-2
+  auto blocks = make_tensor<float>({rows, cols});
+  auto recon = make_tensor<float>({rows, cols});
+  // Orthonormal 2D DCT-II of an image, and the DCT-III that inverts it
+  (blocks = dct2d(xv, DCTType::II, FFTNorm::ORTHO)).run();
+  (recon = dct2d(blocks, DCTType::III, FFTNorm::ORTHO)).run();
+  // example-end dct-2
+  cudaStreamSynchronize(0);
+
+  MATX_TEST_ASSERT_COMPARE(pb, blocks, "Y2_2d", 0.01);
+  MATX_TEST_ASSERT_COMPARE(pb, recon, "x", 0.01);
+
+  MATX_EXIT_HANDLER();
+}
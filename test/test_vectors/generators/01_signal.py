@@ -24,6 +24,26 @@ class dct:
             'Y': Y
         }
 
+class dct_nd:
+    def __init__(self, dtype: str, size: List[int]):
+        self.size = size
+        self.dtype = dtype
+
+    def run(self):
+        M = self.size[0]
+        N = self.size[1]
+
+        x = np.random.randn(M, N)
+
+        return {
+            'x': x,
+            'Y2': sf.dct(x, type=2, axis=-1),
+            'Y3': sf.dct(x, type=3, axis=-1),
+            'Y4': sf.dct(x, type=4, axis=-1, norm='ortho'),
+            'Y2_axis0': sf.dct(x, type=2, axis=0, norm='ortho'),
+            'Y2_2d': sf.dctn(x, type=2, axes=(-2, -1), norm='ortho')
+        }
+
 class chirp:
     def __init__(self, dtype: str, size: List[int]):
         self.size = size
@@ -35,11 +35,14 @@ class mvdr_beamformer:
         cov_mat = np.matmul(inv_slice, inv_slice.conj().T) / \
             snap_len + load_coeff * np.eye(num_el)
         cov_inv = np.linalg.inv(cov_mat)
+        cov_inv_v = np.matmul(cov_inv, v)
+        weights = cov_inv_v / np.sum(v.conj() * cov_inv_v, axis=0)
 
         return {
             'cov_inv': cov_inv,
             'cov_mat': cov_mat,
             'in_vec': in_vec,
             'v': v,
-            'out_cbf': out_cbf
+            'out_cbf': out_cbf,
+            'weights': weights
         }